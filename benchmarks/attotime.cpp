@@ -0,0 +1,134 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    attotime.cpp
+
+    Benchmarks for attotime arithmetic as the scheduler uses it: adding
+    and subtracting times, comparing them, scaling by an integer and
+    converting to and from clock ticks.
+
+    Operands cycle through a table of times spread over a few seconds,
+    so carries between the seconds and attoseconds fields are taken as
+    often as they are in a running machine.
+
+***************************************************************************/
+
+#include "benchmark/benchmark_api.h"
+
+#include "emucore.h"
+#include "eminline.h"
+#include "attotime.h"
+
+#include <vector>
+
+
+namespace {
+
+constexpr size_t TABLE_SIZE = 1024;
+constexpr u32 TABLE_MASK = TABLE_SIZE - 1;
+
+std::vector<attotime> make_times()
+{
+	std::vector<attotime> result(TABLE_SIZE);
+	u32 rnd = 12345;
+	for (auto &t : result)
+	{
+		rnd = rnd * 1664525U + 1013904223U;
+		seconds_t const secs = rnd >> 30;
+		rnd = rnd * 1664525U + 1013904223U;
+		t = attotime(secs, attoseconds_t(rnd) * (ATTOSECONDS_PER_SECOND >> 32));
+	}
+	return result;
+}
+
+void BM_attotime_add(benchmark::State &state)
+{
+	std::vector<attotime> const times(make_times());
+	attotime sum = attotime::zero;
+	u32 i = 0;
+	while (state.KeepRunning())
+	{
+		sum += times[i++ & TABLE_MASK];
+		if (sum.seconds() > 1000)
+			sum = attotime::zero;
+	}
+	benchmark::DoNotOptimize(sum);
+}
+
+void BM_attotime_sub(benchmark::State &state)
+{
+	std::vector<attotime> const times(make_times());
+	u32 i = 0;
+	while (state.KeepRunning())
+	{
+		benchmark::DoNotOptimize(times[i & TABLE_MASK] - times[(i + 1) & TABLE_MASK]);
+		i++;
+	}
+}
+
+void BM_attotime_compare(benchmark::State &state)
+{
+	std::vector<attotime> const times(make_times());
+	u32 i = 0;
+	u32 less = 0;
+	while (state.KeepRunning())
+	{
+		less += (times[i & TABLE_MASK] < times[(i + 1) & TABLE_MASK]) ? 1 : 0;
+		i++;
+	}
+	benchmark::DoNotOptimize(less);
+}
+
+void BM_attotime_mul(benchmark::State &state)
+{
+	std::vector<attotime> const times(make_times());
+	u32 i = 0;
+	while (state.KeepRunning())
+	{
+		benchmark::DoNotOptimize(times[i & TABLE_MASK] * (i | 1));
+		i++;
+	}
+}
+
+void BM_attotime_div(benchmark::State &state)
+{
+	std::vector<attotime> const times(make_times());
+	u32 i = 0;
+	while (state.KeepRunning())
+	{
+		benchmark::DoNotOptimize(times[i & TABLE_MASK] / (i | 1));
+		i++;
+	}
+}
+
+void BM_attotime_as_ticks(benchmark::State &state)
+{
+	std::vector<attotime> const times(make_times());
+	u32 const clock = u32(state.range(0));
+	u32 i = 0;
+	while (state.KeepRunning())
+		benchmark::DoNotOptimize(times[i++ & TABLE_MASK].as_ticks(clock));
+}
+
+void BM_attotime_from_ticks(benchmark::State &state)
+{
+	u32 const clock = u32(state.range(0));
+	u64 ticks = 0;
+	while (state.KeepRunning())
+	{
+		benchmark::DoNotOptimize(attotime::from_ticks(ticks, clock));
+		ticks += 12345;
+	}
+}
+
+} // anonymous namespace
+
+
+BENCHMARK(BM_attotime_add);
+BENCHMARK(BM_attotime_sub);
+BENCHMARK(BM_attotime_compare);
+BENCHMARK(BM_attotime_mul);
+BENCHMARK(BM_attotime_div);
+BENCHMARK(BM_attotime_as_ticks)->Arg(3579545)->Arg(50000000);
+BENCHMARK(BM_attotime_from_ticks)->Arg(3579545)->Arg(50000000);
@@ -0,0 +1,112 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    delegate.cpp
+
+    Benchmarks for delegate invocation: bound to a member function, a
+    const member function, a static function taking the object by
+    reference, or wrapping a lambda.  A direct call and a std::function
+    holding the same lambda are included as baselines.
+
+    How a member function is bound depends on the ABI delegate.h was
+    built for, so results are only comparable between builds for the
+    same target.  The direct call can be inlined, so it is a lower bound
+    rather than the cost of an out-of-line handler.
+
+***************************************************************************/
+
+#include "benchmark/benchmark_api.h"
+
+#include "emucore.h"
+#include "delegate.h"
+
+#include <functional>
+
+
+namespace {
+
+class delegate_target
+{
+public:
+	delegate_target() : m_count(0) { }
+
+	void write(u32 data) { m_count += data; }
+	u32 read(u32 offset) const { return u32(m_count) + offset; }
+	static void write_static(delegate_target &target, u32 data) { target.m_count += data; }
+
+	u64 m_count;
+};
+
+using write_delegate = delegate<void (u32)>;
+using read_delegate = delegate<u32 (u32)>;
+
+void BM_direct_call(benchmark::State &state)
+{
+	delegate_target target;
+	u32 data = 0;
+	while (state.KeepRunning())
+		target.write(data++);
+	benchmark::DoNotOptimize(target.m_count);
+}
+
+void BM_delegate_member(benchmark::State &state)
+{
+	delegate_target target;
+	write_delegate const cb(&delegate_target::write, &target);
+	u32 data = 0;
+	while (state.KeepRunning())
+		cb(data++);
+	benchmark::DoNotOptimize(target.m_count);
+}
+
+void BM_delegate_const_member(benchmark::State &state)
+{
+	delegate_target target;
+	read_delegate const cb(&delegate_target::read, &target);
+	u32 offset = 0;
+	u32 sum = 0;
+	while (state.KeepRunning())
+		sum += cb(offset++);
+	benchmark::DoNotOptimize(sum);
+}
+
+void BM_delegate_static(benchmark::State &state)
+{
+	delegate_target target;
+	write_delegate const cb(&delegate_target::write_static, &target);
+	u32 data = 0;
+	while (state.KeepRunning())
+		cb(data++);
+	benchmark::DoNotOptimize(target.m_count);
+}
+
+void BM_delegate_lambda(benchmark::State &state)
+{
+	delegate_target target;
+	write_delegate const cb([&target] (u32 data) { target.write(data); });
+	u32 data = 0;
+	while (state.KeepRunning())
+		cb(data++);
+	benchmark::DoNotOptimize(target.m_count);
+}
+
+void BM_std_function(benchmark::State &state)
+{
+	delegate_target target;
+	std::function<void (u32)> const cb([&target] (u32 data) { target.write(data); });
+	u32 data = 0;
+	while (state.KeepRunning())
+		cb(data++);
+	benchmark::DoNotOptimize(target.m_count);
+}
+
+} // anonymous namespace
+
+
+BENCHMARK(BM_direct_call);
+BENCHMARK(BM_delegate_member);
+BENCHMARK(BM_delegate_const_member);
+BENCHMARK(BM_delegate_static);
+BENCHMARK(BM_delegate_lambda);
+BENCHMARK(BM_std_function);
@@ -0,0 +1,221 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    devcb.cpp
+
+    Benchmarks for device callback dispatch.  A lone plain delegate is
+    called directly, with or without an inversion fused in; with a
+    transform, an offset, or a second target appended, the call goes
+    through the std::function chain.
+
+    Only a machine_config is built; callbacks are resolved against its
+    device tree and no machine ever runs.
+
+***************************************************************************/
+
+#include "benchmark/benchmark_api.h"
+
+#include "emu.h"
+#include "emuopts.h"
+
+
+//**************************************************************************
+//  BENCH DEVICE
+//**************************************************************************
+
+class devcbbench_device : public device_t
+{
+public:
+	devcbbench_device(const machine_config &mconfig, const char *tag, device_t *owner, u32 clock = 0);
+
+	auto plain_w() { return m_plain_w.bind(); }
+	auto invert_w() { return m_invert_w.bind(); }
+	auto transform_w() { return m_transform_w.bind(); }
+	auto pair_w() { return m_pair_w.bind(); }
+	auto data_w() { return m_data_w.bind(); }
+	auto offset_w() { return m_offset_w.bind(); }
+	auto plain_r() { return m_plain_r.bind(); }
+	auto invert_r() { return m_invert_r.bind(); }
+	auto transform_r() { return m_transform_r.bind(); }
+	auto pair_r() { return m_pair_r.bind(); }
+
+	void resolve_all();
+
+	// callback targets
+	void line_w(int state) { m_count += state; }
+	void byte_w(u8 data) { m_count += data; }
+	void offset_byte_w(offs_t offset, u8 data) { m_count += offset + data; }
+	int line_r() { return int(++m_count & 1); }
+
+	devcb_write_line m_plain_w;
+	devcb_write_line m_invert_w;
+	devcb_write_line m_transform_w;
+	devcb_write_line m_pair_w;
+	devcb_write8 m_data_w;
+	devcb_write8 m_offset_w;
+	devcb_read_line m_plain_r;
+	devcb_read_line m_invert_r;
+	devcb_read_line m_transform_r;
+	devcb_read_line m_pair_r;
+
+	u64 m_count;
+
+protected:
+	// device_t implementation
+	virtual void device_start() override { }
+};
+
+DEFINE_DEVICE_TYPE(DEVCBBENCH, devcbbench_device, "devcbbench", "Device callback benchmark device")
+
+devcbbench_device::devcbbench_device(const machine_config &mconfig, const char *tag, device_t *owner, u32 clock)
+	: device_t(mconfig, DEVCBBENCH, tag, owner, clock)
+	, m_plain_w(*this)
+	, m_invert_w(*this)
+	, m_transform_w(*this)
+	, m_pair_w(*this)
+	, m_data_w(*this)
+	, m_offset_w(*this)
+	, m_plain_r(*this)
+	, m_invert_r(*this)
+	, m_transform_r(*this)
+	, m_pair_r(*this)
+	, m_count(0)
+{
+}
+
+void devcbbench_device::resolve_all()
+{
+	m_plain_w.resolve_safe();
+	m_invert_w.resolve_safe();
+	m_transform_w.resolve_safe();
+	m_pair_w.resolve_safe();
+	m_data_w.resolve_safe();
+	m_offset_w.resolve_safe();
+	m_plain_r.resolve_safe(0);
+	m_invert_r.resolve_safe(0);
+	m_transform_r.resolve_safe(0);
+	m_pair_r.resolve_safe(0);
+}
+
+
+//**************************************************************************
+//  BENCH DRIVER
+//**************************************************************************
+
+class devcbbench_state : public driver_device
+{
+public:
+	using driver_device::driver_device;
+
+	void devcbbench(machine_config &config);
+};
+
+void devcbbench_state::devcbbench(machine_config &config)
+{
+	devcbbench_device &bench(DEVCBBENCH(config, "bench"));
+	DEVCBBENCH(config, "other");
+
+	bench.plain_w().set("bench", FUNC(devcbbench_device::line_w));
+	bench.invert_w().set("bench", FUNC(devcbbench_device::line_w)).invert();
+	bench.transform_w().set("bench", FUNC(devcbbench_device::line_w)).transform([] (int state) { return state; });
+	bench.pair_w().set("bench", FUNC(devcbbench_device::line_w));
+	bench.pair_w().append("other", FUNC(devcbbench_device::line_w));
+	bench.data_w().set("bench", FUNC(devcbbench_device::byte_w));
+	bench.offset_w().set("bench", FUNC(devcbbench_device::offset_byte_w));
+	bench.plain_r().set("bench", FUNC(devcbbench_device::line_r));
+	bench.invert_r().set("bench", FUNC(devcbbench_device::line_r)).invert();
+	bench.transform_r().set("bench", FUNC(devcbbench_device::line_r)).transform([] (int state) { return state; });
+	bench.pair_r().set("bench", FUNC(devcbbench_device::line_r));
+	bench.pair_r().append("other", FUNC(devcbbench_device::line_r));
+}
+
+ROM_START( devcbbench )
+ROM_END
+
+GAME( 2021, devcbbench, 0, devcbbench, 0, devcbbench_state, empty_init, ROT0, "MAME", "Device callback benchmark", MACHINE_NO_SOUND_HW )
+
+
+namespace {
+
+//**************************************************************************
+//  HARNESS
+//**************************************************************************
+
+class devcbbench_harness
+{
+public:
+	static devcbbench_harness &instance()
+	{
+		static devcbbench_harness s_harness;
+		return s_harness;
+	}
+
+	devcbbench_device &device() { return m_device; }
+
+private:
+	devcbbench_harness()
+		: m_config(GAME_NAME(devcbbench), m_options)
+		, m_device(downcast<devcbbench_device &>(*m_config.root_device().subdevice("bench")))
+	{
+		m_device.resolve_all();
+	}
+
+	emu_options m_options;
+	machine_config m_config;
+	devcbbench_device &m_device;
+};
+
+
+//**************************************************************************
+//  BENCHMARKS
+//**************************************************************************
+
+template <devcb_write_line devcbbench_device::*Callback>
+void BM_write_line(benchmark::State &state)
+{
+	devcbbench_device &dev = devcbbench_harness::instance().device();
+	devcb_write_line &cb = dev.*Callback;
+	int data = 0;
+	while (state.KeepRunning())
+	{
+		cb(data);
+		data ^= 1;
+	}
+	benchmark::DoNotOptimize(dev.m_count);
+}
+
+template <devcb_write8 devcbbench_device::*Callback>
+void BM_write8(benchmark::State &state)
+{
+	devcbbench_device &dev = devcbbench_harness::instance().device();
+	devcb_write8 &cb = dev.*Callback;
+	u8 data = 0;
+	while (state.KeepRunning())
+		cb(data++);
+	benchmark::DoNotOptimize(dev.m_count);
+}
+
+template <devcb_read_line devcbbench_device::*Callback>
+void BM_read_line(benchmark::State &state)
+{
+	devcb_read_line &cb = devcbbench_harness::instance().device().*Callback;
+	u64 sum = 0;
+	while (state.KeepRunning())
+		sum += cb();
+	benchmark::DoNotOptimize(sum);
+}
+
+} // anonymous namespace
+
+
+BENCHMARK_TEMPLATE(BM_write_line, &devcbbench_device::m_plain_w);
+BENCHMARK_TEMPLATE(BM_write_line, &devcbbench_device::m_invert_w);
+BENCHMARK_TEMPLATE(BM_write_line, &devcbbench_device::m_transform_w);
+BENCHMARK_TEMPLATE(BM_write_line, &devcbbench_device::m_pair_w);
+BENCHMARK_TEMPLATE(BM_write8, &devcbbench_device::m_data_w);
+BENCHMARK_TEMPLATE(BM_write8, &devcbbench_device::m_offset_w);
+BENCHMARK_TEMPLATE(BM_read_line, &devcbbench_device::m_plain_r);
+BENCHMARK_TEMPLATE(BM_read_line, &devcbbench_device::m_invert_r);
+BENCHMARK_TEMPLATE(BM_read_line, &devcbbench_device::m_transform_r);
+BENCHMARK_TEMPLATE(BM_read_line, &devcbbench_device::m_pair_r);
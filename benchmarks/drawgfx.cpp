@@ -0,0 +1,105 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    drawgfx.cpp
+
+    Benchmarks for gfx_element decoding: planar, packed and irregular
+    layouts, decoded one element at a time as drawing code does on
+    demand, and all at once as after a ROM region is loaded or patched.
+
+    The irregular case is the planar layout with an XOR mask that isn't
+    a whole number of bytes, which forces the bit-at-a-time decoder.
+    Elements are decoded from random data; no palette is attached, as
+    decoding never looks at it.
+
+***************************************************************************/
+
+#include "benchmark/benchmark_api.h"
+
+#include "emu.h"
+
+#include <vector>
+
+
+namespace {
+
+constexpr u32 ELEMENTS = 4096;
+
+// 8x8 with four planes a quarter of the region apart, like gfx_8x8x4_planar
+const gfx_layout planar_layout =
+{
+	8,8,
+	ELEMENTS,
+	4,
+	{ 3*ELEMENTS*8*8, 2*ELEMENTS*8*8, 1*ELEMENTS*8*8, 0 },
+	{ STEP8(0,1) },
+	{ STEP8(0,8) },
+	8*8
+};
+
+// 16x16 with a nibble per pixel, like gfx_16x16x4_packed_msb
+const gfx_layout packed_layout =
+{
+	16,16,
+	ELEMENTS,
+	4,
+	{ STEP4(0,1) },
+	{ STEP16(0,4) },
+	{ STEP16(0,4*16) },
+	16*16*4
+};
+
+// both layouts hold four bits per pixel
+std::vector<u8> make_source(gfx_layout const &gl)
+{
+	std::vector<u8> result(gl.total * gl.width * gl.height * 4 / 8);
+	u32 rnd = 12345;
+	for (auto &b : result)
+	{
+		rnd = rnd * 1664525U + 1013904223U;
+		b = u8(rnd >> 24);
+	}
+	return result;
+}
+
+void BM_gfx_decode(benchmark::State &state, gfx_layout const &gl, u32 xormask)
+{
+	std::vector<u8> const source(make_source(gl));
+	gfx_element gfx(nullptr, gl, &source[0], xormask, 1, 0);
+	u32 code = 0;
+	while (state.KeepRunning())
+	{
+		gfx.mark_dirty(code);
+		benchmark::DoNotOptimize(gfx.get_data(code));
+		code = (code + 1) % gfx.elements();
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+void BM_gfx_decode_all(benchmark::State &state, gfx_layout const &gl, u32 xormask)
+{
+	std::vector<u8> const source(make_source(gl));
+	gfx_element gfx(nullptr, gl, &source[0], xormask, 1, 0);
+	while (state.KeepRunning())
+	{
+		gfx.mark_all_dirty();
+		gfx.decode_all();
+	}
+	state.SetItemsProcessed(state.iterations() * gfx.elements());
+}
+
+void BM_gfx_decode_planar(benchmark::State &state) { BM_gfx_decode(state, planar_layout, 0); }
+void BM_gfx_decode_packed(benchmark::State &state) { BM_gfx_decode(state, packed_layout, 0); }
+void BM_gfx_decode_bits(benchmark::State &state) { BM_gfx_decode(state, planar_layout, 1); }
+void BM_gfx_decode_all_planar(benchmark::State &state) { BM_gfx_decode_all(state, planar_layout, 0); }
+void BM_gfx_decode_all_packed(benchmark::State &state) { BM_gfx_decode_all(state, packed_layout, 0); }
+
+} // anonymous namespace
+
+
+BENCHMARK(BM_gfx_decode_planar);
+BENCHMARK(BM_gfx_decode_packed);
+BENCHMARK(BM_gfx_decode_bits);
+BENCHMARK(BM_gfx_decode_all_planar);
+BENCHMARK(BM_gfx_decode_all_packed);
@@ -0,0 +1,497 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    emumem.cpp
+
+    Benchmarks for the core memory system: address_space dispatch for
+    every supported width/addrshift/endian combination, the cache and
+    specific accessors, and passthrough taps.
+
+    A minimal running_machine is built around a driver that contains one
+    bench device per combination.  Only the memory system is initialized;
+    no devices are started and the scheduler never runs.
+
+***************************************************************************/
+
+#include "benchmark/benchmark_api.h"
+
+#include "emu.h"
+#include "emuopts.h"
+#include "main.h"
+#include "osdepend.h"
+
+
+namespace {
+
+//**************************************************************************
+//  STUB OSD AND MANAGER
+//**************************************************************************
+
+class bench_osd_interface : public osd_interface
+{
+public:
+	virtual void init(running_machine &machine) override { }
+	virtual void update(bool skip_redraw) override { }
+	virtual bool present_timing(osd_ticks_t &last_present, osd_ticks_t &period) override { return false; }
+	virtual void input_update() override { }
+	virtual void set_verbose(bool print_verbose) override { }
+	virtual void init_debugger() override { }
+	virtual void wait_for_debugger(device_t &device, bool firststop) override { }
+	virtual void update_audio_stream(const int16_t *buffer, int samples_this_frame) override { }
+	virtual int audio_float_channels() override { return 0; }
+	virtual void update_audio_stream_float(const float *buffer, int channels, int samples_this_frame) override { }
+	virtual void set_mastervolume(int attenuation) override { }
+	virtual bool no_sound() override { return true; }
+	virtual bool audio_buffer_status(int &queued, int &target) override { return false; }
+	virtual void customize_input_type_list(std::vector<input_type_entry> &typelist) override { }
+	virtual void add_audio_to_recording(const int16_t *buffer, int samples_this_frame) override { }
+	virtual std::vector<ui::menu_item> get_slider_list() override { return std::vector<ui::menu_item>(); }
+	virtual osd_font::ptr font_alloc() override { return nullptr; }
+	virtual bool get_font_families(std::string const &font_path, std::vector<std::pair<std::string, std::string> > &result) override { return false; }
+	virtual bool execute_command(const char *command) override { return false; }
+	virtual osd_midi_device *create_midi_device() override { return nullptr; }
+};
+
+class bench_machine_manager : public machine_manager
+{
+public:
+	bench_machine_manager(emu_options &options, osd_interface &osd) : machine_manager(options, osd) { }
+};
+
+} // anonymous namespace
+
+
+//**************************************************************************
+//  BENCH DEVICE
+//**************************************************************************
+
+// map layout, in bytes of the benched space
+//   0x0000-0x3fff  RAM
+//   0x4000-0x7fff  RAM with a passthrough tap installed after init
+//   0x8000-0xbfff  ROM
+//   0xc000-0xc0ff  native-width read/write handler
+constexpr offs_t RAM_BASE = 0x0000;
+constexpr offs_t TAP_BASE = 0x4000;
+constexpr offs_t ROM_BASE = 0x8000;
+constexpr offs_t HANDLER_BASE = 0xc000;
+constexpr offs_t BLOCK_SIZE = 0x4000;
+constexpr offs_t HANDLER_SIZE = 0x0100;
+
+class membench_device : public device_t, public device_memory_interface
+{
+public:
+	membench_device(const machine_config &mconfig, const char *tag, device_t *owner, u32 clock = 0);
+
+	membench_device &set_bus(int width, int addrshift, endianness_t endian);
+
+	u64 m_latch;
+	u64 m_taps;
+
+protected:
+	// device_t implementation
+	virtual void device_start() override { }
+
+	// device_memory_interface implementation
+	virtual space_config_vector memory_space_config() const override;
+
+private:
+	void map(address_map &map);
+
+	address_space_config m_program_config;
+	int m_width;
+};
+
+DEFINE_DEVICE_TYPE(MEMBENCH, membench_device, "membench", "Memory system benchmark device")
+
+membench_device::membench_device(const machine_config &mconfig, const char *tag, device_t *owner, u32 clock)
+	: device_t(mconfig, MEMBENCH, tag, owner, clock)
+	, device_memory_interface(mconfig, *this)
+	, m_latch(0)
+	, m_taps(0)
+	, m_width(0)
+{
+}
+
+membench_device &membench_device::set_bus(int width, int addrshift, endianness_t endian)
+{
+	m_width = width;
+	m_program_config = address_space_config("program", endian, 8 << width, 16 + addrshift, addrshift, address_map_constructor(FUNC(membench_device::map), this));
+	return *this;
+}
+
+device_memory_interface::space_config_vector membench_device::memory_space_config() const
+{
+	return space_config_vector {
+		std::make_pair(AS_PROGRAM, &m_program_config)
+	};
+}
+
+void membench_device::map(address_map &map)
+{
+	// the map is expressed in space addresses, which differ from byte
+	// addresses when addrshift is non-zero
+	auto const a = [this] (offs_t byte) { return m_program_config.byte2addr(byte); };
+	auto const e = [this] (offs_t byte) { return m_program_config.byte2addr_end(byte); };
+
+	map(a(RAM_BASE), e(RAM_BASE + BLOCK_SIZE - 1)).ram();
+	map(a(TAP_BASE), e(TAP_BASE + BLOCK_SIZE - 1)).ram();
+	map(a(ROM_BASE), e(ROM_BASE + BLOCK_SIZE - 1)).rom();
+
+	offs_t const hstart = a(HANDLER_BASE);
+	offs_t const hend = e(HANDLER_BASE + HANDLER_SIZE - 1);
+	switch (m_width)
+	{
+	case 0: map(hstart, hend).lrw8([this] (offs_t offset) -> u8 { return m_latch + offset; }, "latch_r", [this] (offs_t offset, u8 data) { m_latch = data; }, "latch_w"); break;
+	case 1: map(hstart, hend).lrw16([this] (offs_t offset) -> u16 { return m_latch + offset; }, "latch_r", [this] (offs_t offset, u16 data) { m_latch = data; }, "latch_w"); break;
+	case 2: map(hstart, hend).lrw32([this] (offs_t offset) -> u32 { return m_latch + offset; }, "latch_r", [this] (offs_t offset, u32 data) { m_latch = data; }, "latch_w"); break;
+	case 3: map(hstart, hend).lrw64([this] (offs_t offset) -> u64 { return m_latch + offset; }, "latch_r", [this] (offs_t offset, u64 data) { m_latch = data; }, "latch_w"); break;
+	}
+}
+
+
+//**************************************************************************
+//  BENCH DRIVER
+//**************************************************************************
+
+class membench_state : public driver_device
+{
+public:
+	using driver_device::driver_device;
+
+	void membench(machine_config &config);
+
+	virtual std::vector<std::string> searchpath() const override { return std::vector<std::string>(); }
+};
+
+void membench_state::membench(machine_config &config)
+{
+	static const struct { int width, addrshift; } combos[] = {
+		{ 0,  1 }, { 0,  0 },
+		{ 1,  3 }, { 1,  0 }, { 1, -1 },
+		{ 2,  3 }, { 2,  0 }, { 2, -1 }, { 2, -2 },
+		{ 3,  0 }, { 3, -1 }, { 3, -2 }, { 3, -3 }
+	};
+
+	for (auto const &c : combos)
+	{
+		MEMBENCH(config, string_format("w%ds%dl", c.width, c.addrshift).c_str()).set_bus(c.width, c.addrshift, ENDIANNESS_LITTLE);
+		MEMBENCH(config, string_format("w%ds%db", c.width, c.addrshift).c_str()).set_bus(c.width, c.addrshift, ENDIANNESS_BIG);
+	}
+}
+
+ROM_START( membench )
+ROM_END
+
+GAME( 2021, membench, 0, membench, 0, membench_state, empty_init, ROT0, "MAME", "Memory system benchmark", MACHINE_NO_SOUND_HW )
+
+
+namespace {
+
+//**************************************************************************
+//  HARNESS
+//**************************************************************************
+
+class membench_harness
+{
+public:
+	static membench_harness &instance()
+	{
+		static membench_harness s_harness;
+		return s_harness;
+	}
+
+	membench_device &device(int width, int addrshift, endianness_t endian)
+	{
+		std::string const tag = string_format("w%ds%d%c", width, addrshift, (endian == ENDIANNESS_LITTLE) ? 'l' : 'b');
+		return downcast<membench_device &>(*m_machine->root_device().subdevice(tag.c_str()));
+	}
+
+private:
+	membench_harness()
+		: m_manager(m_options, m_osd)
+		, m_config(GAME_NAME(membench), m_options)
+	{
+		m_machine = std::make_unique<running_machine>(m_config, m_manager);
+
+		// bring up only as much as the memory system needs; nothing here
+		// uses object finders, so the pre/post map resolution is skipped
+		m_machine->memory().initialize();
+
+		// install a counting passthrough on the tapped block of every space
+		for (membench_device &dev : device_type_iterator<membench_device>(m_machine->root_device()))
+		{
+			address_space &space = dev.space(AS_PROGRAM);
+			offs_t const start = space.byte_to_address(TAP_BASE);
+			offs_t const end = space.byte_to_address_end(TAP_BASE + BLOCK_SIZE - 1);
+			u64 &taps = dev.m_taps;
+			switch (space.data_width())
+			{
+			case 8:  space.install_readwrite_tap(start, end, "bench", [&taps] (offs_t, u8  &, u8 ) { taps++; }, [&taps] (offs_t, u8  &, u8 ) { taps++; }); break;
+			case 16: space.install_readwrite_tap(start, end, "bench", [&taps] (offs_t, u16 &, u16) { taps++; }, [&taps] (offs_t, u16 &, u16) { taps++; }); break;
+			case 32: space.install_readwrite_tap(start, end, "bench", [&taps] (offs_t, u32 &, u32) { taps++; }, [&taps] (offs_t, u32 &, u32) { taps++; }); break;
+			case 64: space.install_readwrite_tap(start, end, "bench", [&taps] (offs_t, u64 &, u64) { taps++; }, [&taps] (offs_t, u64 &, u64) { taps++; }); break;
+			}
+		}
+	}
+
+	emu_options m_options;
+	bench_osd_interface m_osd;
+	bench_machine_manager m_manager;
+	machine_config m_config;
+	std::unique_ptr<running_machine> m_machine;
+};
+
+
+//**************************************************************************
+//  NATIVE ACCESS HELPERS
+//**************************************************************************
+
+// selects the accessor matching the native width of the space
+template <int Width> struct native_access;
+
+template <> struct native_access<0>
+{
+	template <typename T> static u8 read(T &mem, offs_t address) { return mem.read_byte(address); }
+	template <typename T> static void write(T &mem, offs_t address, u8 data) { mem.write_byte(address, data); }
+};
+
+template <> struct native_access<1>
+{
+	template <typename T> static u16 read(T &mem, offs_t address) { return mem.read_word(address); }
+	template <typename T> static void write(T &mem, offs_t address, u16 data) { mem.write_word(address, data); }
+};
+
+template <> struct native_access<2>
+{
+	template <typename T> static u32 read(T &mem, offs_t address) { return mem.read_dword(address); }
+	template <typename T> static void write(T &mem, offs_t address, u32 data) { mem.write_dword(address, data); }
+};
+
+template <> struct native_access<3>
+{
+	template <typename T> static u64 read(T &mem, offs_t address) { return mem.read_qword(address); }
+	template <typename T> static void write(T &mem, offs_t address, u64 data) { mem.write_qword(address, data); }
+};
+
+// converts a byte offset into a space address, as address_space_config::byte2addr
+template <int AddrShift>
+inline offs_t to_space(offs_t byte)
+{
+	return (AddrShift > 0) ? (byte << AddrShift) : (byte >> -AddrShift);
+}
+
+
+//**************************************************************************
+//  BENCHMARKS
+//**************************************************************************
+
+template <typename T, int Width, int AddrShift>
+void run_reads(benchmark::State &state, T &mem, offs_t base, offs_t size)
+{
+	offs_t const start = to_space<AddrShift>(base);
+	offs_t const step = to_space<AddrShift>(1 << Width);
+	offs_t const span = to_space<AddrShift>(size);
+	offs_t offset = 0;
+	u64 sum = 0;
+	while (state.KeepRunning())
+	{
+		sum += native_access<Width>::read(mem, start + offset);
+		offset = (offset + step) % span;
+	}
+	benchmark::DoNotOptimize(sum);
+}
+
+template <typename T, int Width, int AddrShift>
+void run_writes(benchmark::State &state, T &mem, offs_t base, offs_t size)
+{
+	offs_t const start = to_space<AddrShift>(base);
+	offs_t const step = to_space<AddrShift>(1 << Width);
+	offs_t const span = to_space<AddrShift>(size);
+	offs_t offset = 0;
+	u64 data = 0;
+	while (state.KeepRunning())
+	{
+		native_access<Width>::write(mem, start + offset, data++);
+		offset = (offset + step) % span;
+	}
+}
+
+template <int Width, int AddrShift, endianness_t Endian>
+void BM_space_read_ram(benchmark::State &state)
+{
+	address_space &space = membench_harness::instance().device(Width, AddrShift, Endian).space(AS_PROGRAM);
+	run_reads<address_space, Width, AddrShift>(state, space, RAM_BASE, BLOCK_SIZE);
+}
+
+template <int Width, int AddrShift, endianness_t Endian>
+void BM_space_write_ram(benchmark::State &state)
+{
+	address_space &space = membench_harness::instance().device(Width, AddrShift, Endian).space(AS_PROGRAM);
+	run_writes<address_space, Width, AddrShift>(state, space, RAM_BASE, BLOCK_SIZE);
+}
+
+template <int Width, int AddrShift, endianness_t Endian>
+void BM_space_read_rom(benchmark::State &state)
+{
+	address_space &space = membench_harness::instance().device(Width, AddrShift, Endian).space(AS_PROGRAM);
+	run_reads<address_space, Width, AddrShift>(state, space, ROM_BASE, BLOCK_SIZE);
+}
+
+template <int Width, int AddrShift, endianness_t Endian>
+void BM_space_read_handler(benchmark::State &state)
+{
+	address_space &space = membench_harness::instance().device(Width, AddrShift, Endian).space(AS_PROGRAM);
+	run_reads<address_space, Width, AddrShift>(state, space, HANDLER_BASE, HANDLER_SIZE);
+}
+
+template <int Width, int AddrShift, endianness_t Endian>
+void BM_space_write_handler(benchmark::State &state)
+{
+	address_space &space = membench_harness::instance().device(Width, AddrShift, Endian).space(AS_PROGRAM);
+	run_writes<address_space, Width, AddrShift>(state, space, HANDLER_BASE, HANDLER_SIZE);
+}
+
+template <int Width, int AddrShift, endianness_t Endian>
+void BM_space_read_tap(benchmark::State &state)
+{
+	address_space &space = membench_harness::instance().device(Width, AddrShift, Endian).space(AS_PROGRAM);
+	run_reads<address_space, Width, AddrShift>(state, space, TAP_BASE, BLOCK_SIZE);
+}
+
+template <int Width, int AddrShift, endianness_t Endian>
+void BM_space_write_tap(benchmark::State &state)
+{
+	address_space &space = membench_harness::instance().device(Width, AddrShift, Endian).space(AS_PROGRAM);
+	run_writes<address_space, Width, AddrShift>(state, space, TAP_BASE, BLOCK_SIZE);
+}
+
+template <int Width, int AddrShift, endianness_t Endian>
+void BM_cache_read_ram(benchmark::State &state)
+{
+	typename memory_access<16, Width, AddrShift, Endian>::cache cache;
+	membench_harness::instance().device(Width, AddrShift, Endian).space(AS_PROGRAM).cache(cache);
+	run_reads<decltype(cache), Width, AddrShift>(state, cache, RAM_BASE, BLOCK_SIZE);
+}
+
+template <int Width, int AddrShift, endianness_t Endian>
+void BM_cache_read_mixed(benchmark::State &state)
+{
+	// alternate between two blocks so every access misses the cached range
+	typename memory_access<16, Width, AddrShift, Endian>::cache cache;
+	membench_harness::instance().device(Width, AddrShift, Endian).space(AS_PROGRAM).cache(cache);
+	offs_t const ram = to_space<AddrShift>(RAM_BASE);
+	offs_t const rom = to_space<AddrShift>(ROM_BASE);
+	u64 sum = 0;
+	bool flip = false;
+	while (state.KeepRunning())
+	{
+		sum += native_access<Width>::read(cache, flip ? rom : ram);
+		flip = !flip;
+	}
+	benchmark::DoNotOptimize(sum);
+}
+
+template <int Width, int AddrShift, endianness_t Endian>
+void BM_specific_read_ram(benchmark::State &state)
+{
+	typename memory_access<16, Width, AddrShift, Endian>::specific specific;
+	membench_harness::instance().device(Width, AddrShift, Endian).space(AS_PROGRAM).specific(specific);
+	run_reads<decltype(specific), Width, AddrShift>(state, specific, RAM_BASE, BLOCK_SIZE);
+}
+
+template <int Width, int AddrShift, endianness_t Endian>
+void BM_specific_write_ram(benchmark::State &state)
+{
+	typename memory_access<16, Width, AddrShift, Endian>::specific specific;
+	membench_harness::instance().device(Width, AddrShift, Endian).space(AS_PROGRAM).specific(specific);
+	run_writes<decltype(specific), Width, AddrShift>(state, specific, RAM_BASE, BLOCK_SIZE);
+}
+
+template <int Width, int AddrShift, endianness_t Endian>
+void BM_specific_read_handler(benchmark::State &state)
+{
+	typename memory_access<16, Width, AddrShift, Endian>::specific specific;
+	membench_harness::instance().device(Width, AddrShift, Endian).space(AS_PROGRAM).specific(specific);
+	run_reads<decltype(specific), Width, AddrShift>(state, specific, HANDLER_BASE, HANDLER_SIZE);
+}
+
+template <int Width, int AddrShift, endianness_t Endian>
+void BM_specific_read_tap(benchmark::State &state)
+{
+	typename memory_access<16, Width, AddrShift, Endian>::specific specific;
+	membench_harness::instance().device(Width, AddrShift, Endian).space(AS_PROGRAM).specific(specific);
+	run_reads<decltype(specific), Width, AddrShift>(state, specific, TAP_BASE, BLOCK_SIZE);
+}
+
+template <int Width, int AddrShift, endianness_t Endian>
+void BM_space_read_block_ram(benchmark::State &state)
+{
+	using NativeType = typename emu::detail::handler_entry_size<Width>::uX;
+	address_space &space = membench_harness::instance().device(Width, AddrShift, Endian).space(AS_PROGRAM);
+	std::vector<NativeType> buffer(BLOCK_SIZE >> Width);
+	while (state.KeepRunning())
+		space.read_block(to_space<AddrShift>(RAM_BASE), &buffer[0], buffer.size());
+	state.SetBytesProcessed(state.iterations() * BLOCK_SIZE);
+}
+
+template <int Width, int AddrShift, endianness_t Endian>
+void BM_space_read_block_handler(benchmark::State &state)
+{
+	using NativeType = typename emu::detail::handler_entry_size<Width>::uX;
+	address_space &space = membench_harness::instance().device(Width, AddrShift, Endian).space(AS_PROGRAM);
+	std::vector<NativeType> buffer(HANDLER_SIZE >> Width);
+	while (state.KeepRunning())
+		space.read_block(to_space<AddrShift>(HANDLER_BASE), &buffer[0], buffer.size());
+	state.SetBytesProcessed(state.iterations() * HANDLER_SIZE);
+}
+
+} // anonymous namespace
+
+
+// register every benchmark for one width/addrshift combination, both endians
+#define MEMBENCH_REGISTER(w, s) \
+	BENCHMARK_TEMPLATE(BM_space_read_ram,        w, s, ENDIANNESS_LITTLE); \
+	BENCHMARK_TEMPLATE(BM_space_read_ram,        w, s, ENDIANNESS_BIG); \
+	BENCHMARK_TEMPLATE(BM_space_write_ram,       w, s, ENDIANNESS_LITTLE); \
+	BENCHMARK_TEMPLATE(BM_space_write_ram,       w, s, ENDIANNESS_BIG); \
+	BENCHMARK_TEMPLATE(BM_space_read_rom,        w, s, ENDIANNESS_LITTLE); \
+	BENCHMARK_TEMPLATE(BM_space_read_rom,        w, s, ENDIANNESS_BIG); \
+	BENCHMARK_TEMPLATE(BM_space_read_handler,    w, s, ENDIANNESS_LITTLE); \
+	BENCHMARK_TEMPLATE(BM_space_read_handler,    w, s, ENDIANNESS_BIG); \
+	BENCHMARK_TEMPLATE(BM_space_write_handler,   w, s, ENDIANNESS_LITTLE); \
+	BENCHMARK_TEMPLATE(BM_space_write_handler,   w, s, ENDIANNESS_BIG); \
+	BENCHMARK_TEMPLATE(BM_space_read_tap,        w, s, ENDIANNESS_LITTLE); \
+	BENCHMARK_TEMPLATE(BM_space_read_tap,        w, s, ENDIANNESS_BIG); \
+	BENCHMARK_TEMPLATE(BM_space_write_tap,       w, s, ENDIANNESS_LITTLE); \
+	BENCHMARK_TEMPLATE(BM_space_write_tap,       w, s, ENDIANNESS_BIG); \
+	BENCHMARK_TEMPLATE(BM_cache_read_ram,        w, s, ENDIANNESS_LITTLE); \
+	BENCHMARK_TEMPLATE(BM_cache_read_ram,        w, s, ENDIANNESS_BIG); \
+	BENCHMARK_TEMPLATE(BM_cache_read_mixed,      w, s, ENDIANNESS_LITTLE); \
+	BENCHMARK_TEMPLATE(BM_cache_read_mixed,      w, s, ENDIANNESS_BIG); \
+	BENCHMARK_TEMPLATE(BM_specific_read_ram,     w, s, ENDIANNESS_LITTLE); \
+	BENCHMARK_TEMPLATE(BM_specific_read_ram,     w, s, ENDIANNESS_BIG); \
+	BENCHMARK_TEMPLATE(BM_specific_write_ram,    w, s, ENDIANNESS_LITTLE); \
+	BENCHMARK_TEMPLATE(BM_specific_write_ram,    w, s, ENDIANNESS_BIG); \
+	BENCHMARK_TEMPLATE(BM_specific_read_handler, w, s, ENDIANNESS_LITTLE); \
+	BENCHMARK_TEMPLATE(BM_specific_read_handler, w, s, ENDIANNESS_BIG); \
+	BENCHMARK_TEMPLATE(BM_specific_read_tap,     w, s, ENDIANNESS_LITTLE); \
+	BENCHMARK_TEMPLATE(BM_specific_read_tap,     w, s, ENDIANNESS_BIG); \
+	BENCHMARK_TEMPLATE(BM_space_read_block_ram,     w, s, ENDIANNESS_LITTLE); \
+	BENCHMARK_TEMPLATE(BM_space_read_block_ram,     w, s, ENDIANNESS_BIG); \
+	BENCHMARK_TEMPLATE(BM_space_read_block_handler, w, s, ENDIANNESS_LITTLE); \
+	BENCHMARK_TEMPLATE(BM_space_read_block_handler, w, s, ENDIANNESS_BIG)
+
+MEMBENCH_REGISTER(0,  1);
+MEMBENCH_REGISTER(0,  0);
+MEMBENCH_REGISTER(1,  3);
+MEMBENCH_REGISTER(1,  0);
+MEMBENCH_REGISTER(1, -1);
+MEMBENCH_REGISTER(2,  3);
+MEMBENCH_REGISTER(2,  0);
+MEMBENCH_REGISTER(2, -1);
+MEMBENCH_REGISTER(2, -2);
+MEMBENCH_REGISTER(3,  0);
+MEMBENCH_REGISTER(3, -1);
+MEMBENCH_REGISTER(3, -2);
+MEMBENCH_REGISTER(3, -3);
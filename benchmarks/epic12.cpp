@@ -0,0 +1,248 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    epic12.cpp
+
+    Benchmarks for the CV1000 EPIC12 blitter, comparing the scalar and
+    SIMD blitters on the same list of draw commands.
+
+    By default a synthetic list is used, mixing plain, flipped, tinted
+    and blended sprites in roughly the proportions seen in game.  To
+    replay a real game instead, build epic12.cpp with LOG_DRAW_COMMANDS
+    set, run the game with -log, and point EPIC12_DRAW_LOG at the
+    resulting error.log; every "GFX DRAW:" line in it is replayed.
+
+    Before timing anything, the list is drawn once with each set of
+    blitters and the results compared, so a benchmark run also checks
+    that the SIMD blitters are exact.
+
+***************************************************************************/
+
+#include "benchmark/benchmark_api.h"
+
+#include "emu.h"
+#include "video/epic12.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+
+namespace {
+
+//**************************************************************************
+//  HARNESS
+//**************************************************************************
+
+// exposes the static blitter entry points
+class epic12_bench : public epic12_device
+{
+public:
+	using epic12_device::init_colour_tables;
+	using epic12_device::draw_blit;
+	using epic12_device::simd_blit_function;
+};
+
+// one draw command, as the blitter reads it from main RAM
+struct draw_command
+{
+	u16 words[10];
+};
+
+// a batch of similar draws for the synthetic list
+struct synthetic_batch
+{
+	u16 attr;
+	u16 alpha;
+	u16 tint_r;
+	u16 tint_gb;
+	u16 width;
+	u16 height;
+	int count;
+};
+
+const synthetic_batch SYNTHETIC_LIST[] =
+{
+	{ 0x1000, 0x0000, 0x0080, 0x8080, 320, 240,   2 },  // opaque background
+	{ 0x1100, 0x0000, 0x0080, 0x8080,  32,  32, 300 },  // transparent sprites
+	{ 0x1900, 0x0000, 0x0080, 0x8080,  32,  32, 100 },  // flipped transparent sprites
+	{ 0x1100, 0x0000, 0x0040, 0x6020,  32,  32,  40 },  // tinted sprites
+	{ 0x1300, 0x80c0, 0x0080, 0x8080,  64,  64,  40 },  // +alpha source, +alpha destination
+	{ 0x1304, 0x8080, 0x0080, 0x8080,  64,  64,  40 },  // plain alpha blending
+	{ 0x1b04, 0x8080, 0x0080, 0x8080,  64,  64,  20 },  // flipped alpha blending
+	{ 0x1301, 0xc000, 0x0080, 0x8080,  48,  48,  20 },  // +alpha source, +source destination
+	{ 0x1305, 0xc000, 0x0080, 0x8080,  48,  48,  20 },  // +alpha source, -source destination
+	{ 0x1320, 0x0080, 0x0080, 0x8080, 128,  32,  10 },  // +destination source, +alpha destination
+	{ 0x1336, 0x8080, 0x0080, 0x8080,  48,  48,  10 },  // a mode with no SIMD version
+};
+
+class epic12_harness
+{
+public:
+	static epic12_harness &instance()
+	{
+		static epic12_harness harness;
+		return harness;
+	}
+
+	// draw the whole list once
+	void replay(bitmap_rgb32 &bitmap, bool allow_simd) const
+	{
+		for (draw_command const &command : m_commands)
+			epic12_bench::draw_blit(bitmap, m_clip, command.words, allow_simd);
+	}
+
+	bitmap_rgb32 &vram() { return m_vram; }
+	u64 pixels() const { return m_pixels; }
+	char const *error() const { return m_error; }
+	char const *source() const { return m_source; }
+
+private:
+	epic12_harness()
+		: m_vram(0x2000, 0x1000)
+		, m_pixels(0)
+		, m_error(nullptr)
+		, m_source("synthetic")
+	{
+		epic12_bench::init_colour_tables();
+		m_clip.set(0, 0x2000 - 1, 0, 0x1000 - 1);
+
+		char const *const log = std::getenv("EPIC12_DRAW_LOG");
+		if (!log || !load(log))
+			synthesize();
+
+		for (draw_command const &command : m_commands)
+			m_pixels += u64((command.words[6] & 0x1fff) + 1) * ((command.words[7] & 0x0fff) + 1);
+
+		// the SIMD blitters must be exact
+		fill(m_vram);
+		replay(m_vram, false);
+		bitmap_rgb32 check(0x2000, 0x1000);
+		fill(check);
+		replay(check, true);
+		for (int y = 0; y < 0x1000 && !m_error; y++)
+			if (std::memcmp(&m_vram.pix(y), &check.pix(y), 0x2000 * sizeof(u32)))
+				m_error = "SIMD blitters differ from the scalar blitters";
+		fill(m_vram);
+	}
+
+	// fill VRAM with a repeatable mix of opaque and transparent pens
+	static void fill(bitmap_rgb32 &bitmap)
+	{
+		u32 seed = 12345;
+		for (int y = 0; y < 0x1000; y++)
+		{
+			u32 *const row = &bitmap.pix(y);
+			for (int x = 0; x < 0x2000; x++)
+			{
+				seed = seed * 1103515245 + 12345;
+				u16 const pendat = (seed >> 16) | (((seed >> 8) & 3) ? 0x8000 : 0);
+				row[x] = ((pendat & 0x8000) << 14) | ((pendat & 0x7c00) << 9) | ((pendat & 0x03e0) << 6) | ((pendat & 0x001f) << 3);
+			}
+		}
+	}
+
+	// read the draw commands logged with LOG_DRAW_COMMANDS
+	bool load(char const *path)
+	{
+		FILE *const file = std::fopen(path, "r");
+		if (!file)
+			return false;
+
+		char line[256];
+		while (std::fgets(line, sizeof(line), file))
+		{
+			char const *const text = std::strstr(line, "GFX DRAW:");
+			unsigned words[10];
+			if (text && std::sscanf(text + 9, "%x %x %x %x %x %x %x %x %x %x",
+					&words[0], &words[1], &words[2], &words[3], &words[4], &words[5], &words[6], &words[7], &words[8], &words[9]) == 10)
+			{
+				draw_command command;
+				for (int i = 0; i < 10; i++)
+					command.words[i] = u16(words[i]);
+				m_commands.push_back(command);
+			}
+		}
+		std::fclose(file);
+
+		if (m_commands.empty())
+			return false;
+		m_source = path;
+		return true;
+	}
+
+	// build a list from SYNTHETIC_LIST, scattering sources and destinations
+	void synthesize()
+	{
+		u32 seed = 1;
+		auto next = [&seed] (u32 range) { seed = seed * 1103515245 + 12345; return (seed >> 16) % range; };
+
+		for (synthetic_batch const &batch : SYNTHETIC_LIST)
+		{
+			for (int i = 0; i < batch.count; i++)
+			{
+				draw_command command;
+				command.words[0] = batch.attr | (next(2) ? 0x0400 : 0);
+				command.words[1] = batch.alpha;
+				command.words[2] = next(0x2000 - batch.width);
+				command.words[3] = 0x100 + next(0x0e00);
+				command.words[4] = next(320 + batch.width) - batch.width;
+				command.words[5] = next(240 + batch.height) - batch.height;
+				command.words[6] = batch.width - 1;
+				command.words[7] = batch.height - 1;
+				command.words[8] = batch.tint_r;
+				command.words[9] = batch.tint_gb;
+				m_commands.push_back(command);
+			}
+		}
+	}
+
+	bitmap_rgb32                m_vram;
+	rectangle                   m_clip;
+	std::vector<draw_command>   m_commands;
+	u64                         m_pixels;
+	char const *                m_error;
+	char const *                m_source;
+};
+
+
+//**************************************************************************
+//  BENCHMARKS
+//**************************************************************************
+
+void run_replay(benchmark::State &state, bool allow_simd)
+{
+	epic12_harness &harness = epic12_harness::instance();
+	if (harness.error())
+	{
+		state.SkipWithError(harness.error());
+		return;
+	}
+
+	while (state.KeepRunning())
+		harness.replay(harness.vram(), allow_simd);
+	state.SetItemsProcessed(state.iterations() * harness.pixels());
+	state.SetLabel(harness.source());
+}
+
+void BM_epic12_replay_scalar(benchmark::State &state)
+{
+	run_replay(state, false);
+}
+
+void BM_epic12_replay_simd(benchmark::State &state)
+{
+	if (!epic12_bench::simd_blit_function(false, false, true, false, 0, 0))
+	{
+		state.SkipWithError("no SIMD blitters in this build");
+		return;
+	}
+	run_replay(state, true);
+}
+
+} // anonymous namespace
+
+
+BENCHMARK(BM_epic12_replay_scalar);
+BENCHMARK(BM_epic12_replay_simd);
@@ -0,0 +1,70 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    hashing.cpp
+
+    Benchmarks for the SHA-1 and CRC-32 creators used by auditing, ROM
+    verification and chdman, over buffers from a CHD sector to a large
+    ROM.  zlib's crc32 is included as the baseline for the CRC-32
+    kernels.
+
+    The creators pick SHA extension, carry-less multiply or ARMv8 kernels
+    when the CPU has them, so results are only comparable between runs on
+    the same machine.
+
+***************************************************************************/
+
+#include "benchmark/benchmark_api.h"
+
+#include "hashing.h"
+
+#include <zlib.h>
+
+#include <vector>
+
+
+namespace {
+
+std::vector<uint8_t> make_buffer(std::size_t length)
+{
+	std::vector<uint8_t> result(length);
+	uint32_t rnd = 12345;
+	for (auto &b : result)
+	{
+		rnd = rnd * 1664525U + 1013904223U;
+		b = uint8_t(rnd >> 24);
+	}
+	return result;
+}
+
+void BM_sha1_creator(benchmark::State &state)
+{
+	std::vector<uint8_t> const buffer(make_buffer(state.range(0)));
+	while (state.KeepRunning())
+		benchmark::DoNotOptimize(util::sha1_creator::simple(&buffer[0], buffer.size()));
+	state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+
+void BM_crc32_creator(benchmark::State &state)
+{
+	std::vector<uint8_t> const buffer(make_buffer(state.range(0)));
+	while (state.KeepRunning())
+		benchmark::DoNotOptimize(util::crc32_creator::simple(&buffer[0], buffer.size()));
+	state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+
+void BM_crc32_zlib(benchmark::State &state)
+{
+	std::vector<uint8_t> const buffer(make_buffer(state.range(0)));
+	while (state.KeepRunning())
+		benchmark::DoNotOptimize(crc32(0, &buffer[0], buffer.size()));
+	state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+
+} // anonymous namespace
+
+
+BENCHMARK(BM_sha1_creator)->Arg(512)->Arg(4096)->Arg(65536)->Arg(1 << 22);
+BENCHMARK(BM_crc32_creator)->Arg(512)->Arg(4096)->Arg(65536)->Arg(1 << 22);
+BENCHMARK(BM_crc32_zlib)->Arg(512)->Arg(4096)->Arg(65536)->Arg(1 << 22);
@@ -0,0 +1,238 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    machine.cpp
+
+    Benchmarks for the machine-level services drivers lean on most:
+    emu_timer adjust/reset churn, timers expiring through the scheduler,
+    and save_manager round trips through a memory buffer.
+
+    A minimal running_machine is built around an empty driver.  Nothing
+    is started: the scheduler has no executing devices, so a timeslice
+    only advances time and fires the timers due.  The saved state is a
+    mix of many small registrations, like device registers, and one
+    large block, like work RAM.
+
+***************************************************************************/
+
+#include "benchmark/benchmark_api.h"
+
+#include "emu.h"
+#include "emuopts.h"
+#include "main.h"
+#include "osdepend.h"
+
+#include <vector>
+
+
+namespace {
+
+//**************************************************************************
+//  STUB OSD AND MANAGER
+//**************************************************************************
+
+class bench_osd_interface : public osd_interface
+{
+public:
+	virtual void init(running_machine &machine) override { }
+	virtual void update(bool skip_redraw) override { }
+	virtual bool present_timing(osd_ticks_t &last_present, osd_ticks_t &period) override { return false; }
+	virtual void input_update() override { }
+	virtual void set_verbose(bool print_verbose) override { }
+	virtual void init_debugger() override { }
+	virtual void wait_for_debugger(device_t &device, bool firststop) override { }
+	virtual void update_audio_stream(const int16_t *buffer, int samples_this_frame) override { }
+	virtual int audio_float_channels() override { return 0; }
+	virtual void update_audio_stream_float(const float *buffer, int channels, int samples_this_frame) override { }
+	virtual void set_mastervolume(int attenuation) override { }
+	virtual bool no_sound() override { return true; }
+	virtual bool audio_buffer_status(int &queued, int &target) override { return false; }
+	virtual void customize_input_type_list(std::vector<input_type_entry> &typelist) override { }
+	virtual void add_audio_to_recording(const int16_t *buffer, int samples_this_frame) override { }
+	virtual std::vector<ui::menu_item> get_slider_list() override { return std::vector<ui::menu_item>(); }
+	virtual osd_font::ptr font_alloc() override { return nullptr; }
+	virtual bool get_font_families(std::string const &font_path, std::vector<std::pair<std::string, std::string> > &result) override { return false; }
+	virtual bool execute_command(const char *command) override { return false; }
+	virtual osd_midi_device *create_midi_device() override { return nullptr; }
+};
+
+class bench_machine_manager : public machine_manager
+{
+public:
+	bench_machine_manager(emu_options &options, osd_interface &osd) : machine_manager(options, osd) { }
+};
+
+} // anonymous namespace
+
+
+//**************************************************************************
+//  BENCH DRIVER
+//**************************************************************************
+
+class machbench_state : public driver_device
+{
+public:
+	using driver_device::driver_device;
+
+	void machbench(machine_config &config) { }
+};
+
+ROM_START( machbench )
+ROM_END
+
+GAME( 2021, machbench, 0, machbench, 0, machbench_state, empty_init, ROT0, "MAME", "Machine services benchmark", MACHINE_NO_SOUND_HW )
+
+
+namespace {
+
+//**************************************************************************
+//  HARNESS
+//**************************************************************************
+
+constexpr int TIMERS = 64;
+constexpr int SMALL_ITEMS = 2048;
+
+class machbench_harness
+{
+public:
+	static machbench_harness &instance()
+	{
+		static machbench_harness s_harness;
+		return s_harness;
+	}
+
+	running_machine &machine() { return *m_machine; }
+	emu_timer &timer(int index) { return *m_timers[index]; }
+	u64 fired() const { return m_fired; }
+	std::vector<u8> &ram() { return m_ram; }
+	std::vector<u8> &state() { return m_state; }
+
+private:
+	machbench_harness()
+		: m_manager(m_options, m_osd)
+		, m_config(GAME_NAME(machbench), m_options)
+		, m_fired(0)
+		, m_regs(SMALL_ITEMS)
+		, m_ram(0x100000)
+	{
+		m_machine = std::make_unique<running_machine>(m_config, m_manager);
+
+		for (int index = 0; index < TIMERS; index++)
+			m_timers.push_back(m_machine->scheduler().timer_alloc(timer_expired_delegate(FUNC(machbench_harness::timer_fired), this)));
+
+		// registrations have to happen before they are closed, as in a real machine start
+		save_manager &save = m_machine->save();
+		for (int index = 0; index < SMALL_ITEMS; index++)
+			save.save_memory(nullptr, "bench", "regs", index, "value", &m_regs[index], sizeof(m_regs[index]));
+		save.save_memory(nullptr, "bench", "ram", 0, "data", &m_ram[0], 1, m_ram.size());
+		save.allow_registration(false);
+		m_state.resize(ram_state::get_size(save));
+	}
+
+	void timer_fired(void *ptr, s32 param) { m_fired++; }
+
+	emu_options m_options;
+	bench_osd_interface m_osd;
+	bench_machine_manager m_manager;
+	machine_config m_config;
+	std::unique_ptr<running_machine> m_machine;
+	std::vector<emu_timer *> m_timers;
+	u64 m_fired;
+	std::vector<u32> m_regs;
+	std::vector<u8> m_ram;
+	std::vector<u8> m_state;
+};
+
+
+//**************************************************************************
+//  BENCHMARKS
+//**************************************************************************
+
+// re-arm a set of one-shot timers at scattered delays, as drivers do from
+// handlers; none of them fire
+void BM_timer_adjust(benchmark::State &state)
+{
+	machbench_harness &harness = machbench_harness::instance();
+	u32 rnd = 12345;
+	int index = 0;
+	while (state.KeepRunning())
+	{
+		rnd = rnd * 1664525U + 1013904223U;
+		harness.timer(index).adjust(attotime(1, attoseconds_t(rnd) * (ATTOSECONDS_PER_SECOND >> 32)));
+		index = (index + 1) % TIMERS;
+	}
+	for (int index = 0; index < TIMERS; index++)
+		harness.timer(index).reset();
+}
+
+// arm and cancel the same timer, the common pattern for watchdogs and timeouts
+void BM_timer_adjust_reset(benchmark::State &state)
+{
+	emu_timer &timer = machbench_harness::instance().timer(0);
+	while (state.KeepRunning())
+	{
+		timer.adjust(attotime::from_usec(100));
+		timer.reset();
+	}
+}
+
+// let periodic timers at unrelated rates expire through the scheduler
+void BM_timer_expire(benchmark::State &state)
+{
+	machbench_harness &harness = machbench_harness::instance();
+	int const count = state.range(0);
+	for (int index = 0; index < count; index++)
+	{
+		attotime const period = attotime::from_hz(u32(15625 + 997 * index));
+		harness.timer(index).adjust(period, 0, period);
+	}
+	u64 const start = harness.fired();
+	while (state.KeepRunning())
+		harness.machine().scheduler().timeslice();
+	state.SetItemsProcessed(harness.fired() - start);
+	for (int index = 0; index < count; index++)
+		harness.timer(index).reset();
+}
+
+void BM_save_write(benchmark::State &state)
+{
+	machbench_harness &harness = machbench_harness::instance();
+	save_manager &save = harness.machine().save();
+	std::vector<u8> &buffer = harness.state();
+	while (state.KeepRunning())
+	{
+		if (save.write_buffer(&buffer[0], buffer.size()) != STATERR_NONE)
+		{
+			state.SkipWithError("write_buffer failed");
+			return;
+		}
+	}
+	state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+
+void BM_save_round_trip(benchmark::State &state)
+{
+	machbench_harness &harness = machbench_harness::instance();
+	save_manager &save = harness.machine().save();
+	std::vector<u8> &buffer = harness.state();
+	while (state.KeepRunning())
+	{
+		harness.ram()[0]++;
+		if (save.write_buffer(&buffer[0], buffer.size()) != STATERR_NONE || save.read_buffer(&buffer[0], buffer.size()) != STATERR_NONE)
+		{
+			state.SkipWithError("state round trip failed");
+			return;
+		}
+	}
+	state.SetBytesProcessed(state.iterations() * buffer.size() * 2);
+}
+
+} // anonymous namespace
+
+
+BENCHMARK(BM_timer_adjust);
+BENCHMARK(BM_timer_adjust_reset);
+BENCHMARK(BM_timer_expire)->Arg(1)->Arg(8)->Arg(TIMERS);
+BENCHMARK(BM_save_write);
+BENCHMARK(BM_save_round_trip);
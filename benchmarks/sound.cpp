@@ -0,0 +1,138 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    sound.cpp
+
+    Benchmarks for sound stream buffer access through stream views:
+    per-sample put and get as sound_stream_update implementations do
+    them, and the bulk fill, copy, add and read operations used by
+    mixers and resamplers, over blocks from a short timeslice to a full
+    frame of audio.
+
+    The views sit on standalone sound_stream_output buffers at the
+    default 48kHz; no machine or sound_stream is involved.  Each
+    iteration covers the next block of time, so the views wrap around
+    the end of the ring buffer as they do in a running machine.
+
+***************************************************************************/
+
+#include "benchmark/benchmark_api.h"
+
+#include "emu.h"
+
+#include <vector>
+
+
+namespace {
+
+using sample_t = stream_buffer::sample_t;
+
+// hands out views over consecutive blocks of time on one output buffer
+class stream_blocks
+{
+public:
+	stream_blocks(u32 samples)
+		: m_length(attotime(0, HZ_TO_ATTOSECONDS(48000)) * samples)
+		, m_time(attotime::zero)
+	{
+	}
+
+	write_stream_view next()
+	{
+		write_stream_view view(m_output.view(m_time, m_time + m_length));
+		m_time = view.end_time();
+		return view;
+	}
+
+private:
+	sound_stream_output m_output;
+	attotime const m_length;
+	attotime m_time;
+};
+
+void BM_stream_put(benchmark::State &state)
+{
+	stream_blocks blocks(state.range(0));
+	sample_t value = 0.0f;
+	while (state.KeepRunning())
+	{
+		write_stream_view view(blocks.next());
+		for (s32 sampindex = 0; sampindex < view.samples(); sampindex++)
+		{
+			view.put(sampindex, value);
+			value += 1.0f / 65536.0f;
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_stream_get(benchmark::State &state)
+{
+	stream_blocks blocks(state.range(0));
+	sample_t sum = 0.0f;
+	while (state.KeepRunning())
+	{
+		write_stream_view view(blocks.next());
+		read_stream_view const src(view);
+		for (s32 sampindex = 0; sampindex < src.samples(); sampindex++)
+			sum += src.get(sampindex);
+	}
+	benchmark::DoNotOptimize(sum);
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_stream_fill(benchmark::State &state)
+{
+	stream_blocks blocks(state.range(0));
+	while (state.KeepRunning())
+		blocks.next().fill(0.5f);
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_stream_copy(benchmark::State &state)
+{
+	stream_blocks src_blocks(state.range(0));
+	stream_blocks dst_blocks(state.range(0));
+	while (state.KeepRunning())
+	{
+		write_stream_view src(src_blocks.next());
+		dst_blocks.next().copy(src);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_stream_add(benchmark::State &state)
+{
+	stream_blocks src_blocks(state.range(0));
+	stream_blocks dst_blocks(state.range(0));
+	while (state.KeepRunning())
+	{
+		write_stream_view src(src_blocks.next());
+		dst_blocks.next().add(src);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_stream_read(benchmark::State &state)
+{
+	stream_blocks blocks(state.range(0));
+	std::vector<sample_t> dest(state.range(0));
+	while (state.KeepRunning())
+	{
+		write_stream_view view(blocks.next());
+		read_stream_view(view).set_gain(0.5f).read(&dest[0], 0, view.samples());
+	}
+	benchmark::DoNotOptimize(dest[0]);
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // anonymous namespace
+
+
+BENCHMARK(BM_stream_put)->Arg(64)->Arg(800)->Arg(4800);
+BENCHMARK(BM_stream_get)->Arg(64)->Arg(800)->Arg(4800);
+BENCHMARK(BM_stream_fill)->Arg(64)->Arg(800)->Arg(4800);
+BENCHMARK(BM_stream_copy)->Arg(64)->Arg(800)->Arg(4800);
+BENCHMARK(BM_stream_add)->Arg(64)->Arg(800)->Arg(4800);
+BENCHMARK(BM_stream_read)->Arg(64)->Arg(800)->Arg(4800);
@@ -499,6 +499,9 @@ void ata_mass_storage_device::read_first_sector()
 	{
 		set_dasp(ASSERT_LINE);
 
+		// let the host read the sectors while the emulated drive seeks
+		prefetch_sectors(lba_address(), m_sector_count);
+
 		start_busy(seek_time(), PARAM_COMMAND);
 	}
 }
@@ -821,6 +824,7 @@ void ide_hdd_device::device_start()
 
 void ide_hdd_device::device_reset()
 {
+	m_prefetch.cancel();
 	m_handle = m_image->get_chd_file();
 	m_disk = m_image->get_hard_disk_file();
 
@@ -875,5 +879,6 @@ uint8_t ide_hdd_device::calculate_status()
 
 void ide_hdd_device::device_add_mconfig(machine_config &config)
 {
-	HARDDISK(config, "image", "ide_hdd");
+	harddisk_image_device &image(HARDDISK(config, "image", "ide_hdd"));
+	image.set_device_unload(FUNC(ide_hdd_device::image_unload));
 }
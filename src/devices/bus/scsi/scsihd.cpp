@@ -31,5 +31,6 @@ void scsihd_device::device_start()
 
 void scsihd_device::device_add_mconfig(machine_config &config)
 {
-	HARDDISK(config, "image", "scsi_hdd");
+	harddisk_image_device &image(HARDDISK(config, "image", "scsi_hdd"));
+	image.set_device_unload(FUNC(scsihd_device::image_unload));
 }
@@ -25,6 +25,9 @@ protected:
 	virtual void device_start() override;
 
 	virtual void device_add_mconfig(machine_config &config) override;
+
+private:
+	void image_unload(device_image_interface &image) { m_prefetch.cancel(); }
 };
 
 // device type definition
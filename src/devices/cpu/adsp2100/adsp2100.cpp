@@ -95,6 +95,31 @@
             0400-05ff = 512 External IOWAIT2                0400-05ff = 512 External IOWAIT2
             0600-07ff = 512 External IOWAIT3                0600-07ff = 512 External IOWAIT3
 
+****************************************************************************
+
+    Recompiler notes
+    ----------------
+
+    There is no UML recompiler for this core yet.  Things a future one
+    needs to deal with:
+    * The x64 back-end can only address memory within 2GB of the code
+      cache, so the register file (m_core, m_alt, the DAG registers,
+      the stacks and the status registers) has to move into a structure
+      allocated from the drc_cache, as the SHARC core does, before any
+      of it can be used as a UML operand.
+    * MSTAT bank switches swap m_core and m_alt wholesale; generated code
+      must reference the live set only, never cache register addresses
+      across an MSTAT write.
+    * Any instruction can be a DO loop end, since m_loop is run-time
+      state, so every instruction needs a loop-end check unless the
+      frontend can see the DO that set it up.
+    * Program RAM is rewritten by boot loads, IDMA, BDMA and PM writes,
+      so blocks have to validate their opcodes on entry.
+    * RAM data accesses already take the memory system's flat-range
+      fast path and opcode fetches go through the memory cache, so a
+      gain has to come from inlining ALU/MAC/shifter work and the DAG
+      updates rather than from dispatch.
+
 ***************************************************************************/
 
 #include "emu.h"
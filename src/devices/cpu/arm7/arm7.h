@@ -360,6 +360,7 @@ protected:
 
 	typedef void ( arm7_cpu_device::*arm7ops_ophandler )(uint32_t);
 	static const arm7ops_ophandler ops_handler[0x20];
+	static const uint16_t s_cond_passed[16];
 
 	//
 	// DRC
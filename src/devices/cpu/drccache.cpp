@@ -11,6 +11,8 @@
 #include "emu.h"
 #include "drccache.h"
 
+#include "emuopts.h"
+
 
 
 //**************************************************************************
@@ -40,11 +42,25 @@ drc_cache::drc_cache(size_t bytes)
 		m_codegen(nullptr),
 		m_size(bytes)
 {
+	memset(&m_stats, 0, sizeof(m_stats));
 	memset(m_free, 0, sizeof(m_free));
 	memset(m_nearfree, 0, sizeof(m_nearfree));
 }
 
 
+//-------------------------------------------------
+//  configured_size - return the size to use for
+//  the code area of a cache, honoring the
+//  drc_cache_size option if set
+//-------------------------------------------------
+
+size_t drc_cache::configured_size(machine_config const &mconfig, size_t default_bytes)
+{
+	int const megabytes = mconfig.options().drc_cache_size();
+	return (megabytes > 0) ? (size_t(megabytes) << 20) : default_bytes;
+}
+
+
 //-------------------------------------------------
 //  ~drc_cache - destructor
 //-------------------------------------------------
@@ -66,6 +82,12 @@ void drc_cache::flush()
 	// can't flush in the middle of codegen
 	assert(m_codegen == nullptr);
 
+	// account for the code we're throwing away
+	m_stats.flushes++;
+	m_stats.blocks_last_flush = m_stats.blocks_since_flush;
+	m_stats.blocks_max_flush = (std::max)(m_stats.blocks_max_flush, m_stats.blocks_since_flush);
+	m_stats.blocks_since_flush = 0;
+
 	// just reset the top back to the base and re-seed
 	m_top = m_base;
 }
@@ -224,6 +246,10 @@ drccodeptr drc_cache::end_codegen()
 
 	// update the cache top
 	m_top = (drccodeptr)ALIGN_PTR_UP(m_top);
+	m_stats.blocks++;
+	m_stats.blocks_since_flush++;
+	m_stats.bytes += m_top - result;
+	m_stats.peak_bytes = (std::max)(m_stats.peak_bytes, size_t(m_top - m_base));
 	m_codegen = nullptr;
 
 	return result;
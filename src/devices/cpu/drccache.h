@@ -41,14 +41,34 @@ typedef delegate<void (drccodeptr *, void *, void *)> drc_oob_delegate;
 class drc_cache
 {
 public:
+	// usage statistics
+	struct statistics
+	{
+		u64                 flushes;            // number of times the cache was flushed
+		u64                 blocks;             // blocks of code generated in total
+		u64                 bytes;              // bytes of code generated in total
+		u32                 blocks_since_flush; // blocks generated since the last flush
+		u32                 blocks_last_flush;  // blocks generated between the last two flushes
+		u32                 blocks_max_flush;   // most blocks generated between two flushes
+		size_t              peak_bytes;         // highest code area usage seen
+	};
+
 	// construction/destruction
 	drc_cache(size_t bytes);
 	~drc_cache();
 
+	// code area size, taking the drc_cache_size option into account
+	static size_t configured_size(machine_config const &mconfig, size_t default_bytes);
+
 	// getters
 	drccodeptr near() const { return m_near; }
 	drccodeptr base() const { return m_base; }
 	drccodeptr top() const { return m_top; }
+	size_t size() const { return m_size; }
+	size_t code_bytes() const { return m_end - m_base; }
+	size_t code_bytes_used() const { return m_top - m_base; }
+	size_t near_bytes_used() const { return m_neartop - m_near; }
+	statistics const &stats() const { return m_stats; }
 
 	// pointer checking
 	bool contains_pointer(const void *ptr) const { return ((const drccodeptr)ptr >= m_near && (const drccodeptr)ptr < m_near + m_size); }
@@ -88,6 +108,7 @@ private:
 	drccodeptr          m_end;              // end of cache memory
 	drccodeptr          m_codegen;          // start of generated code
 	size_t              m_size;             // size of the cache in bytes
+	statistics          m_stats;            // usage statistics
 
 	// oob management
 	struct oob_handler
@@ -0,0 +1,61 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    drcfastram.cpp
+
+    Discovery of fixed RAM regions for recompiler direct access paths.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "drcfastram.h"
+
+#include <algorithm>
+
+
+
+//**************************************************************************
+//  REGION DISCOVERY
+//**************************************************************************
+
+//-------------------------------------------------
+//  drc_find_fastram - gather the fixed memory
+//  blocks of a space, merging neighbours that
+//  continue the same block
+//-------------------------------------------------
+
+std::vector<drc_fastram_region> drc_find_fastram(address_space &space)
+{
+	std::vector<memory_entry> read_map, write_map;
+	space.dump_maps(read_map, write_map);
+
+	std::vector<drc_fastram_region> regions;
+	for (const memory_entry &e : read_map)
+	{
+		if (!e.entry->is_memory())
+			continue;
+		u8 *const base = reinterpret_cast<u8 *>(space.get_read_ptr(e.start));
+		if (base == nullptr)
+			continue;
+
+		// writes only go direct if the same block sits behind the whole range
+		auto const w = std::find_if(write_map.begin(), write_map.end(), [&e](const memory_entry &we) { return we.start <= e.start && we.end >= e.start; });
+		bool const readonly = w == write_map.end() || w->end < e.end || !w->entry->is_memory() || space.get_write_ptr(e.start) != base;
+
+		if (!regions.empty())
+		{
+			drc_fastram_region &prev = regions.back();
+			if (prev.end + 1 == e.start && prev.readonly == readonly && reinterpret_cast<u8 *>(prev.base) + (e.start - prev.start) == base)
+			{
+				prev.end = e.end;
+				continue;
+			}
+		}
+		regions.emplace_back(drc_fastram_region{ e.start, e.end, readonly, base });
+	}
+
+	// bigger regions are the likelier hits, and the callers only have a few slots
+	std::stable_sort(regions.begin(), regions.end(), [](const drc_fastram_region &a, const drc_fastram_region &b) { return a.end - a.start > b.end - b.start; });
+	return regions;
+}
@@ -0,0 +1,51 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    drcfastram.h
+
+    Discovery of fixed RAM regions for recompiler direct access paths.
+
+    The MIPS III and PowerPC recompilers compare each translated physical
+    address against a short list of "fastram" regions and load or store
+    straight through a host pointer on a hit.  Drivers used to register
+    those regions by hand; this walks the address space instead and
+    returns the ranges backed by fixed memory blocks.  Banks, taps and
+    device handlers are never returned, since their host pointer can
+    change without the space telling anyone.
+
+***************************************************************************/
+
+#ifndef MAME_CPU_DRCFASTRAM_H
+#define MAME_CPU_DRCFASTRAM_H
+
+#pragma once
+
+#include <vector>
+
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// one fixed memory region of a byte-addressed space
+struct drc_fastram_region
+{
+	offs_t      start;          // first byte of the region
+	offs_t      end;            // last byte of the region
+	bool        readonly;       // true if writes are not backed by the same block
+	void *      base;           // host pointer to the byte at start
+};
+
+
+
+//**************************************************************************
+//  FUNCTION PROTOTYPES
+//**************************************************************************
+
+// fixed memory regions of a space, largest first
+std::vector<drc_fastram_region> drc_find_fastram(address_space &space);
+
+
+#endif // MAME_CPU_DRCFASTRAM_H
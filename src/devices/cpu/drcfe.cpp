@@ -13,6 +13,9 @@
     * more aggressive handling of needed registers for conditional
         intrablock branches
 
+    * weight trace formation by how often blocks are entered rather
+        than following every static branch
+
 ***************************************************************************/
 
 #include "emu.h"
@@ -56,6 +59,8 @@ drc_frontend::drc_frontend(device_t &cpu, u32 window_start, u32 window_end, u32
 	: m_window_start(window_start)
 	, m_window_end(window_end)
 	, m_max_sequence(max_sequence)
+	, m_max_traces(0)
+	, m_max_idle_loop(0)
 	, m_cpudevice(downcast<cpu_device &>(cpu))
 	, m_program(m_cpudevice.space(AS_PROGRAM))
 	, m_pageshift(m_cpudevice.space_config(AS_PROGRAM)->page_shift())
@@ -146,14 +151,202 @@ const opcode_desc *drc_frontend::describe_code(offs_t startpc)
 		}
 	}
 
+	// flag polling loops while the descriptions are still indexed by PC
+	if (m_max_idle_loop != 0)
+		detect_idle_loops(minpc, maxpc);
+
 	// now build the list of descriptions in order
 	// first from startpc -> maxpc, then from minpc -> startpc
 	build_sequence(startpc - minpc, maxpc - minpc, OPFLAG_REDISPATCH);
 	build_sequence(minpc - minpc, startpc - minpc, OPFLAG_RETURN_TO_START);
+
+	// stitch on the targets of static branches that leave the window
+	if (m_max_traces != 0)
+		build_traces(minpc, maxpc);
 	return m_desc_live_list.first();
 }
 
 
+//-------------------------------------------------
+//  build_traces - append straight-line traces
+//  for the targets of unconditional static
+//  branches that leave the window, so they are
+//  reached with a local jump instead of a hash
+//  table dispatch
+//-------------------------------------------------
+
+void drc_frontend::build_traces(offs_t minpc, offs_t maxpc)
+{
+	// traces may only use the part of the window the block didn't need
+	u32 used = 0;
+	for (opcode_desc const *desc = m_desc_live_list.first(); desc != nullptr; desc = desc->next())
+		used += desc->length;
+	u32 budget = m_window_start + m_window_end;
+	budget = (used < budget) ? (budget - used) : 0;
+
+	// walk the list, including any traces appended along the way
+	offs_t traced[16];
+	u32 const maxtraces = (std::min)(m_max_traces, u32(ARRAY_LENGTH(traced)));
+	u32 numtraced = 0;
+	for (opcode_desc *desc = m_desc_live_list.first(); desc != nullptr && budget != 0; desc = desc->next())
+	{
+		// only static, unconditional branches that stay in the current mode
+		if ((desc->flags & (OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_INTRABLOCK_BRANCH | OPFLAG_CAN_CHANGE_MODES | OPFLAG_WILL_CAUSE_EXCEPTION)) != OPFLAG_IS_UNCONDITIONAL_BRANCH)
+			continue;
+		if (desc->targetpc == BRANCH_TARGET_DYNAMIC || (desc->targetpc >= minpc && desc->targetpc < maxpc))
+			continue;
+
+		// branches to a target that already has a trace just link to it
+		offs_t const *const found = std::find(&traced[0], &traced[numtraced], desc->targetpc);
+		if (found != &traced[numtraced])
+			desc->flags |= OPFLAG_INTRABLOCK_BRANCH;
+		else if (numtraced < maxtraces && describe_trace(desc->targetpc, minpc, maxpc, budget))
+		{
+			desc->flags |= OPFLAG_INTRABLOCK_BRANCH;
+			traced[numtraced++] = desc->targetpc;
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  detect_idle_loops - flag backward branches
+//  that close a loop with no side effects, so
+//  the backend can give up the timeslice instead
+//  of spinning
+//-------------------------------------------------
+
+void drc_frontend::detect_idle_loops(offs_t minpc, offs_t maxpc)
+{
+	for (offs_t curpc = minpc; curpc < maxpc; curpc++)
+	{
+		opcode_desc *const desc = m_desc_array[curpc - minpc];
+		if (desc == nullptr || !(desc->flags & OPFLAG_IS_BRANCH) || desc->targetpc == BRANCH_TARGET_DYNAMIC)
+			continue;
+		if (desc->targetpc > desc->pc || desc->targetpc < minpc || desc->pc - desc->targetpc >= m_max_idle_loop)
+			continue;
+		if (is_idle_loop(*desc, minpc))
+			desc->flags |= OPFLAG_IDLE_LOOP;
+	}
+}
+
+
+//-------------------------------------------------
+//  is_idle_loop - check whether the straight line
+//  of code from a branch's target back to the
+//  branch could only ever do the same thing again
+//  until memory or an interrupt changes
+//-------------------------------------------------
+
+bool drc_frontend::is_idle_loop(opcode_desc const &branch, offs_t minpc) const
+{
+	constexpr u32 SIDE_EFFECTS =
+			OPFLAG_WRITES_MEMORY | OPFLAG_WILL_CAUSE_EXCEPTION | OPFLAG_PRIVILEGED |
+			OPFLAG_CAN_TRIGGER_SW_INT | OPFLAG_CAN_EXPOSE_EXTERNAL_INT | OPFLAG_CAN_CHANGE_MODES |
+			OPFLAG_MODIFIES_TRANSLATION | OPFLAG_INVALID_OPCODE | OPFLAG_VIRTUAL_NOOP |
+			OPFLAG_COMPILER_PAGE_FAULT | OPFLAG_COMPILER_UNMAPPED;
+
+	// gather the body in execution order: straight line code, the branch, then its delay slots
+	std::vector<opcode_desc const *> body;
+	for (offs_t curpc = branch.targetpc; curpc != branch.pc; )
+	{
+		opcode_desc const *const desc = m_desc_array[curpc - minpc];
+		if (desc == nullptr || desc->length == 0 || (desc->flags & OPFLAG_IS_BRANCH) || desc->skipslots != 0)
+			return false;
+		body.push_back(desc);
+		curpc += desc->length;
+		if (curpc > branch.pc)
+			return false;
+	}
+	body.push_back(&branch);
+	for (opcode_desc const *slot = branch.delay.first(); slot != nullptr; slot = slot->next())
+		body.push_back(slot);
+
+	u32 written[4] = { 0, 0, 0, 0 };
+	for (opcode_desc const *desc : body)
+	{
+		if (desc->flags & SIDE_EFFECTS)
+			return false;
+		for (int regnum = 0; regnum < 4; regnum++)
+			written[regnum] |= desc->regout[regnum];
+	}
+
+	// a register read before this pass writes it carries state from the last
+	// pass, which makes it a counting loop rather than a wait
+	u32 fresh[4] = { 0, 0, 0, 0 };
+	for (opcode_desc const *desc : body)
+		for (int regnum = 0; regnum < 4; regnum++)
+		{
+			if (desc->regin[regnum] & ~fresh[regnum] & written[regnum])
+				return false;
+			fresh[regnum] |= desc->regout[regnum];
+		}
+	return true;
+}
+
+
+//-------------------------------------------------
+//  describe_trace - describe a single sequence
+//  starting at an out-of-window PC and append it
+//  to the live list
+//-------------------------------------------------
+
+bool drc_frontend::describe_trace(offs_t startpc, offs_t minpc, offs_t maxpc, u32 &budget)
+{
+	std::vector<opcode_desc *> trace;
+	opcode_desc *prevdesc = nullptr;
+	u32 skipsleft = 0;
+	for (offs_t curpc = startpc; trace.size() < m_max_sequence; )
+	{
+		// stop before running into the window, which has its own copy of the code
+		if (curpc >= minpc && curpc < maxpc)
+			break;
+
+		// describe the instruction, stopping if it doesn't fit
+		opcode_desc *const curdesc = describe_one(curpc, prevdesc);
+		if (curdesc->length > budget || (curdesc->flags & (OPFLAG_COMPILER_PAGE_FAULT | OPFLAG_COMPILER_UNMAPPED)))
+		{
+			m_desc_allocator.reclaim_all(curdesc->delay);
+			m_desc_allocator.reclaim(*curdesc);
+			break;
+		}
+		budget -= curdesc->length;
+		curpc += curdesc->length;
+		prevdesc = curdesc;
+
+		// skipped slots are covered by the branch's delay slots
+		if (skipsleft > 0)
+		{
+			skipsleft--;
+			m_desc_allocator.reclaim_all(curdesc->delay);
+			m_desc_allocator.reclaim(*curdesc);
+			continue;
+		}
+		skipsleft = curdesc->skipslots;
+		trace.push_back(curdesc);
+
+		// stop at the natural end of the flow; conditional branches become side exits
+		if (curdesc->flags & OPFLAG_END_SEQUENCE)
+			break;
+	}
+	if (trace.empty())
+		return false;
+
+	// the head is entered from elsewhere in the block, and the tail redispatches
+	trace.front()->flags |= OPFLAG_IS_BRANCH_TARGET | OPFLAG_VALIDATE_TLB | OPFLAG_CAN_CAUSE_EXCEPTION;
+	trace.back()->flags |= OPFLAG_END_SEQUENCE | OPFLAG_REDISPATCH;
+
+	// work out which registers we *must* generate, assuming at the end all must be
+	u32 reqmask[4] = { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff };
+	for (auto it = trace.rbegin(); it != trace.rend(); ++it)
+		accumulate_required_backwards(**it, reqmask);
+
+	for (opcode_desc *desc : trace)
+		m_desc_live_list.append(*desc);
+	return true;
+}
+
+
 //-------------------------------------------------
 //  describe_one - describe a single instruction,
 //  recursively describing opcodes in delay
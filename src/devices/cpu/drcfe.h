@@ -77,6 +77,9 @@ constexpr u32 OPFLAG_CAN_CHANGE_MODES        = 0x00080000;       // instruction
 constexpr u32 OPFLAG_READS_MEMORY            = 0x00100000;       // instruction reads memory
 constexpr u32 OPFLAG_WRITES_MEMORY           = 0x00200000;       // instruction writes memory
 
+// idle loop flags
+constexpr u32 OPFLAG_IDLE_LOOP               = 0x00400000;       // branch closes a loop that only waits on memory or interrupts
+
 
 
 //**************************************************************************
@@ -134,6 +137,13 @@ public:
 	// describe a block
 	opcode_desc const *describe_code(offs_t startpc);
 
+	// follow up to this many static branches out of the window
+	void set_max_traces(u32 count) { m_max_traces = count; }
+
+	// flag backward branches closing side-effect free loops of up to this
+	// many bytes; only for cores that describe every register they touch
+	void set_max_idle_loop(u32 bytes) { m_max_idle_loop = bytes; }
+
 protected:
 	// required overrides
 	virtual bool describe(opcode_desc &desc, opcode_desc const *prev) = 0;
@@ -142,13 +152,19 @@ private:
 	// internal helpers
 	opcode_desc *describe_one(offs_t curpc, opcode_desc const *prevdesc, bool in_delay_slot = false);
 	void build_sequence(int start, int end, u32 endflag);
+	void build_traces(offs_t minpc, offs_t maxpc);
+	bool describe_trace(offs_t startpc, offs_t minpc, offs_t maxpc, u32 &budget);
 	void accumulate_required_backwards(opcode_desc &desc, u32 *reqmask);
+	void detect_idle_loops(offs_t minpc, offs_t maxpc);
+	bool is_idle_loop(opcode_desc const &branch, offs_t minpc) const;
 	void release_descriptions();
 
 	// configuration parameters
 	u32                 m_window_start;             // code window start offset = startpc - window_start
 	u32                 m_window_end;               // code window end offset = startpc + window_end
 	u32                 m_max_sequence;             // maximum instructions to include in a sequence
+	u32                 m_max_traces;               // maximum out-of-window branch targets to stitch on
+	u32                 m_max_idle_loop;            // maximum size in bytes of a detected idle loop
 
 	// CPU parameters
 	cpu_device &        m_cpudevice;                // CPU device object
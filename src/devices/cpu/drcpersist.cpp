@@ -0,0 +1,209 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    drcpersist.cpp
+
+    Persistent record of compiled DRC block entry points.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "drcpersist.h"
+
+#include "emuopts.h"
+#include "romload.h"
+#include "hashing.h"
+
+
+
+//**************************************************************************
+//  CONSTANTS
+//**************************************************************************
+
+// bump whenever the file layout or front-end signature rules change
+static constexpr u32 PERSIST_VERSION = 1;
+
+// refuse to load or grow beyond this many entries
+static constexpr u32 PERSIST_MAX_ENTRIES = 65536;
+
+static const char PERSIST_MAGIC[8] = { 'M', 'A', 'M', 'E', 'D', 'R', 'C', 'P' };
+
+#define DRCPERSIST_STRINGIFY_(x) #x
+#define DRCPERSIST_STRINGIFY(x) DRCPERSIST_STRINGIFY_(x)
+
+
+
+//**************************************************************************
+//  PERSISTENT CACHE
+//**************************************************************************
+
+//-------------------------------------------------
+//  drc_persistent_cache - constructor
+//-------------------------------------------------
+
+drc_persistent_cache::drc_persistent_cache(device_t &device)
+	: m_device(device)
+	, m_system_key(system_key())
+	, m_backend_key(backend_key())
+{
+	load();
+}
+
+
+//-------------------------------------------------
+//  ~drc_persistent_cache - destructor
+//-------------------------------------------------
+
+drc_persistent_cache::~drc_persistent_cache()
+{
+}
+
+
+//-------------------------------------------------
+//  signature - compute the signature of a
+//  described block from its opcode bytes
+//-------------------------------------------------
+
+u32 drc_persistent_cache::signature(opcode_desc const *desclist)
+{
+	util::crc32_creator crc;
+	for (opcode_desc const *desc = desclist; desc != nullptr; desc = desc->next())
+	{
+		u32 const pc = little_endianize_int32(desc->physpc);
+		crc.append(&pc, sizeof(pc));
+		crc.append(desc->opptr.b, desc->length);
+	}
+	return crc.finish();
+}
+
+
+//-------------------------------------------------
+//  record - note a block compiled this session
+//-------------------------------------------------
+
+void drc_persistent_cache::record(u32 mode, offs_t pc, u32 signature)
+{
+	if (m_recorded.size() >= PERSIST_MAX_ENTRIES)
+		return;
+	if (m_seen.insert((u64(mode) << 32) | pc).second)
+		m_recorded.push_back(entry{ mode, pc, signature });
+}
+
+
+//-------------------------------------------------
+//  save - write the recorded entries to the
+//  NVRAM directory
+//-------------------------------------------------
+
+void drc_persistent_cache::save()
+{
+	if (m_recorded.empty())
+		return;
+
+	emu_file file(m_device.machine().options().nvram_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(filename()) != osd_file::error::NONE)
+		return;
+
+	u32 const header[4] = {
+		little_endianize_int32(PERSIST_VERSION),
+		little_endianize_int32(m_system_key),
+		little_endianize_int32(m_backend_key),
+		little_endianize_int32(m_recorded.size()) };
+	file.write(PERSIST_MAGIC, sizeof(PERSIST_MAGIC));
+	file.write(header, sizeof(header));
+	for (entry const &e : m_recorded)
+	{
+		u32 const data[3] = { little_endianize_int32(e.mode), little_endianize_int32(e.pc), little_endianize_int32(e.signature) };
+		file.write(data, sizeof(data));
+	}
+}
+
+
+//-------------------------------------------------
+//  load - read entries saved by a previous run,
+//  discarding the file if it does not match
+//-------------------------------------------------
+
+void drc_persistent_cache::load()
+{
+	emu_file file(m_device.machine().options().nvram_directory(), OPEN_FLAG_READ);
+	if (file.open(filename()) != osd_file::error::NONE)
+		return;
+
+	char magic[sizeof(PERSIST_MAGIC)];
+	u32 header[4];
+	if (file.read(magic, sizeof(magic)) != sizeof(magic) || memcmp(magic, PERSIST_MAGIC, sizeof(magic)) != 0)
+		return;
+	if (file.read(header, sizeof(header)) != sizeof(header))
+		return;
+	if (little_endianize_int32(header[0]) != PERSIST_VERSION || little_endianize_int32(header[1]) != m_system_key || little_endianize_int32(header[2]) != m_backend_key)
+	{
+		osd_printf_verbose("%s: discarding stale DRC persistent cache\n", m_device.tag());
+		return;
+	}
+
+	u32 const count = little_endianize_int32(header[3]);
+	if (count > PERSIST_MAX_ENTRIES)
+		return;
+
+	std::vector<entry> loaded;
+	loaded.reserve(count);
+	for (u32 i = 0; i < count; i++)
+	{
+		u32 data[3];
+		if (file.read(data, sizeof(data)) != sizeof(data))
+			return;
+		loaded.push_back(entry{ little_endianize_int32(data[0]), little_endianize_int32(data[1]), little_endianize_int32(data[2]) });
+	}
+
+	m_loaded = std::move(loaded);
+	osd_printf_verbose("%s: loaded %u DRC block entry points\n", m_device.tag(), count);
+}
+
+
+//-------------------------------------------------
+//  system_key - hash the hashes of every ROM in
+//  the running system
+//-------------------------------------------------
+
+u32 drc_persistent_cache::system_key() const
+{
+	util::crc32_creator crc;
+	for (device_t &device : device_iterator(m_device.machine().root_device()))
+		for (rom_entry const *region = rom_first_region(device); region != nullptr; region = rom_next_region(region))
+			for (rom_entry const *rom = rom_first_file(region); rom != nullptr; rom = rom_next_file(rom))
+				crc.append(rom->hashdata().c_str(), rom->hashdata().length());
+	return crc.finish();
+}
+
+
+//-------------------------------------------------
+//  backend_key - hash the identity of the backend
+//  that will generate code
+//-------------------------------------------------
+
+u32 drc_persistent_cache::backend_key() const
+{
+#ifdef NATIVE_DRC
+	char const *const native = DRCPERSIST_STRINGIFY(NATIVE_DRC);
+#else
+	char const *const native = "drcbe_c";
+#endif
+	std::string const ident = util::string_format("%s/%d/%s",
+			m_device.machine().options().drc_use_c() ? "drcbe_c" : native,
+			int(sizeof(void *)),
+			m_device.shortname());
+	return util::crc32_creator::simple(ident.c_str(), ident.length());
+}
+
+
+//-------------------------------------------------
+//  filename - file name relative to the NVRAM
+//  directory
+//-------------------------------------------------
+
+std::string drc_persistent_cache::filename() const
+{
+	return m_device.machine().nvram_filename(m_device) + ".drc";
+}
@@ -0,0 +1,94 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    drcpersist.h
+
+    Persistent record of compiled DRC block entry points.
+
+    Generated code embeds host pointers to the near cache, the device
+    state and the memory accessors, none of which survive a restart, so
+    native code itself cannot be reused across runs.  Instead the entry
+    points of every block compiled during a session are stored next to
+    the system's NVRAM, keyed by the ROM hashes and the DRC backend, and
+    the front-end recompiles them eagerly after its first cache flush on
+    the next run.  Each entry carries a signature of the opcodes it was
+    built from, so stale entries are skipped rather than compiled.
+
+***************************************************************************/
+
+#ifndef MAME_CPU_DRCPERSIST_H
+#define MAME_CPU_DRCPERSIST_H
+
+#pragma once
+
+#include "drcfe.h"
+
+#include <unordered_set>
+#include <vector>
+
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// drc_persistent_cache
+class drc_persistent_cache
+{
+public:
+	// one block entry point
+	struct entry
+	{
+		u32         mode;           // front-end mode the block was compiled for
+		offs_t      pc;             // starting PC of the block
+		u32         signature;      // signature of the described opcodes
+	};
+
+	// construction/destruction
+	drc_persistent_cache(device_t &device);
+	~drc_persistent_cache();
+
+	// signature of a described block
+	static u32 signature(opcode_desc const *desclist);
+
+	// recording
+	void record(u32 mode, offs_t pc, u32 signature);
+
+	// replay the entries loaded at startup; the callback returns the current signature
+	// at mode/pc, or ~0 if the block should not be compiled now
+	template <typename Signature, typename Compile> u32 replay(Signature &&current, Compile &&compile)
+	{
+		u32 compiled = 0;
+		std::vector<entry> pending;
+		pending.swap(m_loaded);
+		for (entry const &e : pending)
+			if (current(e.mode, e.pc) == e.signature)
+			{
+				compile(e.mode, e.pc);
+				compiled++;
+			}
+		return compiled;
+	}
+
+	// persistence
+	void save();
+
+private:
+	// internal helpers
+	void load();
+	u32 system_key() const;
+	u32 backend_key() const;
+	std::string filename() const;
+
+	// internal state
+	device_t &                  m_device;       // CPU device we are associated with
+	u32                         m_system_key;   // hash of the system's ROM hashes
+	u32                         m_backend_key;  // hash of the backend identity
+	std::vector<entry>          m_loaded;       // entries loaded at startup and not yet replayed
+	std::vector<entry>          m_recorded;     // entries compiled this session
+	std::unordered_set<u64>     m_seen;         // mode/pc pairs already recorded
+};
+
+
+#endif // MAME_CPU_DRCPERSIST_H
@@ -11,7 +11,8 @@
     Future improvements/changes:
 
     * UML optimizer:
-        - constant folding
+        - propagate values across labels when all branches to them
+          are known
 
     * Write a back-end validator:
         - checks all combinations of memory/register/immediate on all params
@@ -35,6 +36,9 @@
 #include "drcuml.h"
 
 #include "emuopts.h"
+#include "debugger.h"
+#include "debug/debugcon.h"
+#include "memusage.h"
 #include "drcbec.h"
 #ifdef NATIVE_DRC
 #include "drcbex86.h"
@@ -51,6 +55,7 @@
 
 #define VALIDATE_BACKEND        (0)
 #define LOG_SIMPLIFICATIONS     (0)
+#define PROPAGATE_VALUES        (1)
 
 
 
@@ -58,6 +63,13 @@
 //  TYPE DEFINITIONS
 //**************************************************************************
 
+namespace {
+
+// all live UML states, so the debugger can report on every cache
+std::list<drcuml_state *> s_drcuml_states;
+
+} // anonymous namespace
+
 // determine the type of the native DRC, falling back to C
 #ifndef NATIVE_DRC
 typedef drcbe_c drcbe_native;
@@ -137,9 +149,14 @@ drcbe_interface::~drcbe_interface()
 //-------------------------------------------------
 
 drcuml_state::drcuml_state(device_t &device, drc_cache &cache, u32 flags, int modes, int addrbits, int ignorebits)
+	: drcuml_state(device, cache, flags, modes, addrbits, ignorebits, device.machine().options().drc_use_c())
+{
+}
+
+drcuml_state::drcuml_state(device_t &device, drc_cache &cache, u32 flags, int modes, int addrbits, int ignorebits, bool use_c)
 	: m_device(device)
 	, m_cache(cache)
-	, m_beintf(device.machine().options().drc_use_c()
+	, m_beintf(use_c
 			? std::unique_ptr<drcbe_interface>{ new drcbe_c(*this, device, cache, flags, modes, addrbits, ignorebits) }
 			: std::unique_ptr<drcbe_interface>{ new drcbe_native(*this, device, cache, flags, modes, addrbits, ignorebits) })
 	, m_umllog(device.machine().options().drc_log_uml()
@@ -148,7 +165,33 @@ drcuml_state::drcuml_state(device_t &device, drc_cache &cache, u32 flags, int mo
 	, m_blocklist()
 	, m_handlelist()
 	, m_symlist()
+	, m_bgqueue(nullptr)
+	, m_bgblock(nullptr)
+	, m_bgdone(false)
 {
+	// the first state in a machine registers the debugger command and memory use for all of them
+	running_machine &machine(device.machine());
+	if (machine.phase() == machine_phase::INIT &&
+			std::find_if(s_drcuml_states.begin(), s_drcuml_states.end(), [&machine] (drcuml_state *state) { return &state->device().machine() == &machine; }) == s_drcuml_states.end())
+	{
+		if (machine.debug_enabled())
+		{
+			machine.debugger().console().register_command("drcstats", CMDFLAG_NONE, 0, 0, 0,
+					[&machine] (int ref, std::vector<std::string> const &params)
+					{
+						for (drcuml_state *state : s_drcuml_states)
+							if (&state->device().machine() == &machine)
+								machine.debugger().console().printf("%s\n", state->statistics());
+					});
+		}
+		machine.memory_usage().add_source("drc", [&machine] (memory_usage_manager &usage)
+				{
+					for (drcuml_state *state : s_drcuml_states)
+						if (&state->device().machine() == &machine)
+							usage.report(state->device(), "code cache", state->m_cache.size());
+				});
+	}
+	s_drcuml_states.push_back(this);
 }
 
 
@@ -158,6 +201,21 @@ drcuml_state::drcuml_state(device_t &device, drc_cache &cache, u32 flags, int mo
 
 drcuml_state::~drcuml_state()
 {
+	osd_printf_verbose("%s\n", statistics());
+	s_drcuml_states.remove(this);
+
+	if (m_bgqueue != nullptr)
+	{
+		// let any outstanding generation finish before the cache goes away
+		try
+		{
+			background_wait();
+		}
+		catch (...)
+		{
+		}
+		osd_work_queue_free(m_bgqueue);
+	}
 }
 
 
@@ -171,6 +229,18 @@ void drcuml_state::reset()
 	// if we error here, we are screwed
 	try
 	{
+		// any block still being generated is about to be thrown away
+		if (background_pending())
+		{
+			try
+			{
+				background_wait();
+			}
+			catch (drcuml_block::abort_compilation &)
+			{
+			}
+		}
+
 		// flush the cache
 		m_cache.flush();
 
@@ -182,17 +252,15 @@ void drcuml_state::reset()
 		m_beintf->reset();
 
 		// do a one-time validation if requested
-#if 0
 		if (VALIDATE_BACKEND)
 		{
 			static bool validated = false;
 			if (!validated)
 			{
 				validated = true;
-				validate_backend(this);
+				validate_backend();
 			}
 		}
-#endif
 	}
 	catch (drcuml_block::abort_compilation &)
 	{
@@ -207,6 +275,9 @@ void drcuml_state::reset()
 
 drcuml_block &drcuml_state::begin_block(uint32_t maxinst)
 {
+	// the cache belongs to the worker until background generation finishes
+	assert(!background_pending());
+
 	// find an inactive block that matches our qualifications
 	drcuml_block *bestblock(nullptr);
 	for (drcuml_block &block : m_blocklist)
@@ -225,6 +296,91 @@ drcuml_block &drcuml_state::begin_block(uint32_t maxinst)
 }
 
 
+
+//-------------------------------------------------
+//  enable_background - allow blocks to be
+//  optimized and generated on a worker thread
+//-------------------------------------------------
+
+void drcuml_state::enable_background()
+{
+	if (m_bgqueue == nullptr)
+		m_bgqueue = osd_work_queue_alloc(0);
+}
+
+
+//-------------------------------------------------
+//  background_wait - wait for the block being
+//  generated in the background; returns false if
+//  it ran out of cache space
+//-------------------------------------------------
+
+bool drcuml_state::background_wait()
+{
+	if (m_bgblock == nullptr)
+		return true;
+
+	// wait for the worker to finish
+	while (!osd_work_queue_wait(m_bgqueue, osd_ticks_per_second()))
+		;
+	m_bgblock = nullptr;
+	m_bgdone.store(false, std::memory_order_relaxed);
+
+	// hand any exception over to the caller
+	std::exception_ptr error;
+	std::swap(error, m_bgerror);
+	if (error)
+	{
+		try
+		{
+			std::rethrow_exception(error);
+		}
+		catch (drcuml_block::abort_compilation &)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+
+//-------------------------------------------------
+//  background_queue - hand a finished block to
+//  the worker thread
+//-------------------------------------------------
+
+void drcuml_state::background_queue(drcuml_block &block)
+{
+	assert(m_bgqueue != nullptr);
+	assert(m_bgblock == nullptr);
+
+	m_bgblock = &block;
+	m_bgerror = nullptr;
+	m_bgdone.store(false, std::memory_order_relaxed);
+	osd_work_item_queue(m_bgqueue, &drcuml_state::background_generate, this, WORK_ITEM_FLAG_AUTO_RELEASE);
+}
+
+
+//-------------------------------------------------
+//  background_generate - worker thread callback
+//  that finishes a block
+//-------------------------------------------------
+
+void *drcuml_state::background_generate(void *param, int threadid)
+{
+	drcuml_state &drcuml(*reinterpret_cast<drcuml_state *>(param));
+	try
+	{
+		drcuml.m_bgblock->end();
+	}
+	catch (...)
+	{
+		drcuml.m_bgerror = std::current_exception();
+	}
+	drcuml.m_bgdone.store(true, std::memory_order_release);
+	return nullptr;
+}
+
 //-------------------------------------------------
 //  handle_alloc - allocate a new handle
 //-------------------------------------------------
@@ -236,6 +392,28 @@ uml::code_handle *drcuml_state::handle_alloc(char const *name)
 }
 
 
+//-------------------------------------------------
+//  statistics - summarize code cache usage
+//-------------------------------------------------
+
+std::string drcuml_state::statistics() const
+{
+	drc_cache::statistics const &stats(m_cache.stats());
+	return util::string_format(
+			"%s: DRC cache %u/%u KB used, peak %u KB, near %u KB; %u flushes, %u blocks recompiled after the last, %u at most; %u blocks of %u bytes on average",
+			m_device.tag(),
+			u32(m_cache.code_bytes_used() >> 10),
+			u32(m_cache.code_bytes() >> 10),
+			u32(stats.peak_bytes >> 10),
+			u32(m_cache.near_bytes_used() >> 10),
+			stats.flushes,
+			stats.blocks_last_flush,
+			stats.blocks_max_flush,
+			stats.blocks,
+			stats.blocks ? u32(stats.bytes / stats.blocks) : 0);
+}
+
+
 //-------------------------------------------------
 //  symbol_add - add a symbol to the internal
 //  symbol table
@@ -355,6 +533,19 @@ void drcuml_block::end()
 }
 
 
+//-------------------------------------------------
+//  end_background - complete a code block on the
+//  worker thread; the owner must not touch the
+//  cache until background_wait() returns
+//-------------------------------------------------
+
+void drcuml_block::end_background()
+{
+	assert(m_inuse);
+	m_drcuml.background_queue(*this);
+}
+
+
 //-------------------------------------------------
 //  abort - abort a code block in progress
 //-------------------------------------------------
@@ -392,31 +583,30 @@ uml::instruction &drcuml_block::append()
 //-------------------------------------------------
 
 void drcuml_block::optimize()
+{
+	resolve_mapvars();
+	compute_flags();
+	if (PROPAGATE_VALUES)
+		propagate_values();
+	else
+		for (int instnum = 0; instnum < m_nextinst; instnum++)
+			m_inst[instnum].simplify();
+}
+
+
+//-------------------------------------------------
+//  resolve_mapvars - convert all mapvar
+//  parameters to immediates
+//-------------------------------------------------
+
+void drcuml_block::resolve_mapvars()
 {
 	u32 mapvar[uml::MAPVAR_COUNT] = { 0 };
 
-	// iterate over instructions
 	for (int instnum = 0; instnum < m_nextinst; instnum++)
 	{
 		uml::instruction &inst(m_inst[instnum]);
 
-		// first compute what flags we need
-		u8 accumflags(0);
-		u8 remainingflags(inst.output_flags());
-
-		// scan ahead until we run out of possible remaining flags
-		for (int scannum = instnum + 1; remainingflags != 0 && scannum < m_nextinst; scannum++)
-		{
-			// any input flags are required
-			uml::instruction const &scan(m_inst[scannum]);
-			accumflags |= scan.input_flags();
-
-			// if the scanahead instruction is unconditional, assume his flags are modified
-			if (scan.condition() == uml::COND_ALWAYS)
-				remainingflags &= ~scan.modified_flags();
-		}
-		inst.set_flags(accumflags);
-
 		// track mapvars
 		if (inst.opcode() == uml::OP_MAPVAR)
 			mapvar[inst.param(0).mapvar() - uml::MAPVAR_M0] = inst.param(1).immediate();
@@ -426,9 +616,212 @@ void drcuml_block::optimize()
 			for (int pnum = 0; pnum < inst.numparams(); pnum++)
 				if (inst.param(pnum).is_mapvar())
 					inst.set_mapvar(pnum, mapvar[inst.param(pnum).mapvar() - uml::MAPVAR_M0]);
+	}
+}
+
+
+//-------------------------------------------------
+//  compute_flags - work backwards through the
+//  block, limiting each instruction to the flags
+//  that are consumed before being overwritten
+//-------------------------------------------------
+
+void drcuml_block::compute_flags()
+{
+	u8 liveflags(0);
+	for (int instnum = m_nextinst - 1; instnum >= 0; instnum--)
+	{
+		uml::instruction &inst(m_inst[instnum]);
+		inst.set_flags(liveflags & inst.output_flags());
+
+		// an unconditional instruction kills what it modifies; then add what it reads
+		if (inst.condition() == uml::COND_ALWAYS)
+			liveflags &= ~inst.modified_flags();
+		liveflags |= inst.input_flags();
+	}
+}
+
+
+//-------------------------------------------------
+//  propagate_values - walk forwards through the
+//  block, replacing reads of integer registers
+//  holding known constants and of memory holding
+//  known values, dropping redundant stores, and
+//  simplifying each instruction as we go
+//-------------------------------------------------
+
+void drcuml_block::propagate_values()
+{
+	using namespace uml;
+
+	// a memory location whose contents are known to match a register or an immediate
+	struct memory_value
+	{
+		uintptr_t   base;
+		u8          size;
+		parameter   value;
+	};
+	constexpr int MAX_MEMORY_VALUES = 16;
+
+	// known state; nothing survives a label or an entry point, since
+	// we don't know where we came from
+	u64 regvalue[REG_I_COUNT];
+	u32 known32 = 0;            // registers whose low 32 bits are known
+	u32 known64 = 0;            // registers whose full 64 bits are known
+	memory_value memvalue[MAX_MEMORY_VALUES];
+	int memcount = 0;
+
+	auto const forget_memory = [&memvalue, &memcount] (uintptr_t base, u8 size)
+	{
+		for (int index = 0; index < memcount; )
+		{
+			if ((memvalue[index].base < base + size) && (base < memvalue[index].base + memvalue[index].size))
+				memvalue[index] = memvalue[--memcount];
+			else
+				index++;
+		}
+	};
+	auto const forget_register = [&known32, &known64, &memvalue, &memcount] (int regnum)
+	{
+		known32 &= ~(1 << regnum);
+		known64 &= ~(1 << regnum);
+		for (int index = 0; index < memcount; )
+		{
+			if (memvalue[index].value.is_int_register() && memvalue[index].value.ireg() == REG_I0 + regnum)
+				memvalue[index] = memvalue[--memcount];
+			else
+				index++;
+		}
+	};
+	auto const find_memory = [&memvalue, &memcount] (uintptr_t base, u8 size) -> memory_value *
+	{
+		for (int index = 0; index < memcount; index++)
+			if (memvalue[index].base == base && memvalue[index].size == size)
+				return &memvalue[index];
+		return nullptr;
+	};
+
+	for (int instnum = 0; instnum < m_nextinst; instnum++)
+	{
+		instruction &inst(m_inst[instnum]);
+		opcode_t const opcode = inst.opcode();
+
+		// recognize places we can be entered from elsewhere
+		if (opcode == OP_HANDLE || opcode == OP_HASH || opcode == OP_LABEL)
+		{
+			known32 = known64 = 0;
+			memcount = 0;
+			continue;
+		}
+		if (opcode == OP_COMMENT || opcode == OP_MAPVAR || opcode == OP_NOP)
+			continue;
+
+		// substitute known values for inputs
+		for (int pnum = 0; pnum < inst.numparams(); pnum++)
+		{
+			if (!inst.param_is_input(pnum) || inst.param_is_output(pnum))
+				continue;
+			parameter const &param(inst.param(pnum));
+			u8 const size = inst.param_size(pnum);
+			if (param.is_int_register())
+			{
+				int const regnum = param.ireg() - REG_I0;
+				if (BIT((size <= 4) ? known32 : known64, regnum) && inst.param_accepts(pnum, parameter::PTYPE_IMMEDIATE))
+					inst.set_param(pnum, regvalue[regnum]);
+			}
+			else if (param.is_memory() && (inst.param_accepts(pnum, parameter::PTYPE_IMMEDIATE) || inst.param_accepts(pnum, parameter::PTYPE_INT_REGISTER)))
+			{
+				memory_value const *const known = find_memory(uintptr_t(param.memory()), size);
+				if (known != nullptr && inst.param_accepts(pnum, known->value.type()))
+					inst.set_param(pnum, known->value);
+			}
+		}
+
+		// drop stores of a value the location already holds
+		if (opcode == OP_MOV && inst.condition() == COND_ALWAYS && inst.param(0).is_memory())
+		{
+			memory_value const *const known = find_memory(uintptr_t(inst.param(0).memory()), inst.size());
+			if (known != nullptr && known->value == inst.param(1))
+			{
+				inst.nop();
+				continue;
+			}
+		}
 
-		// now that flags are correct, simplify the instruction
+		// now that the inputs are final, simplify the instruction
 		inst.simplify();
+
+		// account for effects beyond the parameters
+		switch (inst.opcode())
+		{
+			// these can do anything at all
+			case OP_CALLH:
+			case OP_EXH:
+			case OP_CALLC:
+				known32 = known64 = 0;
+				memcount = 0;
+				break;
+
+			// these replace the registers
+			case OP_RESTORE:
+				known32 = known64 = 0;
+				memcount = 0;
+				break;
+
+			// these may write memory beyond their parameters, or run device code
+			case OP_DEBUG:
+			case OP_SAVE:
+			case OP_STORE:
+			case OP_FSTORE:
+			case OP_READ:
+			case OP_READM:
+			case OP_FREAD:
+			case OP_WRITE:
+			case OP_WRITEM:
+			case OP_FWRITE:
+				memcount = 0;
+				break;
+
+			default:
+				break;
+		}
+
+		// forget anything the outputs overwrite
+		for (int pnum = 0; pnum < inst.numparams(); pnum++)
+		{
+			if (!inst.param_is_output(pnum))
+				continue;
+			parameter const &param(inst.param(pnum));
+			if (param.is_int_register())
+				forget_register(param.ireg() - REG_I0);
+			else if (param.is_memory())
+				forget_memory(uintptr_t(param.memory()), inst.param_size(pnum));
+		}
+
+		// unconditional moves establish new known values
+		if (inst.opcode() == OP_MOV && inst.condition() == COND_ALWAYS)
+		{
+			parameter const &dst(inst.param(0));
+			parameter const &src(inst.param(1));
+			if (dst.is_int_register() && src.is_immediate())
+			{
+				int const regnum = dst.ireg() - REG_I0;
+				regvalue[regnum] = (inst.size() == 4) ? u32(src.immediate()) : src.immediate();
+				known32 |= 1 << regnum;
+				if (inst.size() == 8)
+					known64 |= 1 << regnum;
+			}
+			else if (dst.is_int_register() != src.is_int_register() && (dst.is_memory() || src.is_memory()) && memcount < MAX_MEMORY_VALUES)
+			{
+				// a register loaded from or stored to memory, or an immediate stored to memory
+				if (dst.is_memory())
+					memvalue[memcount++] = memory_value{ uintptr_t(dst.memory()), inst.size(), src };
+				else
+					memvalue[memcount++] = memory_value{ uintptr_t(src.memory()), inst.size(), dst };
+			}
+			else if (dst.is_memory() && src.is_immediate() && memcount < MAX_MEMORY_VALUES)
+				memvalue[memcount++] = memory_value{ uintptr_t(dst.memory()), inst.size(), src };
+		}
 	}
 }
 
@@ -526,32 +919,21 @@ char const *drcuml_block::get_comment_text(uml::instruction const &inst, std::st
 
 
 
-#if 0
+//**************************************************************************
+//  BACK-END VALIDATION
+//**************************************************************************
 
-/***************************************************************************
-    BACK-END VALIDATION
-***************************************************************************/
+// Each test is run through the active backend and through a private
+// drcbe_c instance, in several operand forms.  Both results are checked
+// against the expected values in the table, and against each other for
+// everything the table does not pin down (untouched registers, flags).
 
-//-------------------------------------------------
-//  effective_test_psize - return the effective
-//  parameter size based on the size and fixed
-//  array of parameter values
-//-------------------------------------------------
+namespace {
 
-inline uint8_t effective_test_psize(const opcode_info &opinfo, int pnum, int instsize, const uint64_t *params)
-{
-	switch (opinfo.param[pnum].size)
-	{
-		case PSIZE_4:   return 4;
-		case PSIZE_8:   return 8;
-		case PSIZE_OP:  return instsize;
-		case PSIZE_P1:  return 1 << (params[0] & 3);
-		case PSIZE_P2:  return 1 << (params[1] & 3);
-		case PSIZE_P3:  return 1 << (params[2] & 3);
-		case PSIZE_P4:  return 1 << (params[3] & 3);
-	}
-	return instsize;
-}
+using namespace uml;
+
+// sentinel for results the UML leaves undefined
+constexpr u64 UNDEFINED = 0x5555aaaa5555aaaaU;
 
 #define TEST_ENTRY_2(op, size, p1, p2, flags) { OP_##op, size, 0, flags, { u64(p1), u64(p2) } },
 #define TEST_ENTRY_2F(op, size, p1, p2, iflags, flags) { OP_##op, size, iflags, flags, { u64(p1), u64(p2) } },
@@ -686,443 +1068,258 @@ static const bevalidate_test bevalidate_test_list[] =
 };
 
 
-/*-------------------------------------------------
-    validate_backend - execute a number of
-    generic tests on the backend code generator
--------------------------------------------------*/
-
-static void validate_backend(drcuml_state *drcuml)
+// operand forms exercised for every test
+enum bevalidate_form
 {
-	uml::code_handle *handles[3];
-	int tnum;
-
-	// allocate handles for the code
-	handles[0] = drcuml->handle_alloc("test_entry");
-	handles[1] = drcuml->handle_alloc("code_start");
-	handles[2] = drcuml->handle_alloc("code_end");
+	FORM_REGISTERS,         // every operand in an integer register
+	FORM_IMMEDIATES,        // sources as immediates, destinations in registers
+	FORM_MEMORY,            // every operand in memory
+	FORM_COUNT
+};
 
-	// iterate over test entries
-	printf("Backend validation....\n");
-	for (tnum = 31; tnum < ARRAY_LENGTH(bevalidate_test_list); tnum++)
-	{
-		const bevalidate_test *test = &bevalidate_test_list[tnum];
-		parameter param[ARRAY_LENGTH(test->param)];
-		char mnemonic[20], *dst;
-		const char *src;
-
-		// progress
-		dst = mnemonic;
-		for (src = opcode_info_table[test->opcode()]->mnemonic; *src != 0; src++)
-		{
-			if (*src == '!')
-			{
-				if (test->size == 8)
-					*dst++ = 'd';
-			}
-			else if (*src == '#')
-				*dst++ = (test->size == 8) ? 'd' : 's';
-			else
-				*dst++ = *src;
-		}
-		*dst = 0;
-		printf("Executing test %d/%d (%s)", tnum + 1, (int)ARRAY_LENGTH(bevalidate_test_list), mnemonic);
+char const *const bevalidate_form_names[FORM_COUNT] = { "registers", "immediates", "memory" };
 
-		// reset parameter list and iterate
-		memset(param, 0, sizeof(param));
-		bevalidate_iterate_over_params(drcuml, handles, test, param, 0);
-		printf("\n");
-	}
-	fatalerror("All tests passed!\n");
-}
+// scratch area in the near cache of each backend
+struct bevalidate_work
+{
+	drcuml_machine_state    istate;         // state before the test
+	drcuml_machine_state    fstate;         // state after the test
+	u64                     param[4];       // memory operands
+	u32                     flags;          // flags after the test
+};
 
 
-/*-------------------------------------------------
-    bevalidate_iterate_over_params - iterate over
-    all supported types and values of a parameter
-    and recursively hand off to the next parameter,
-    or else move on to iterate over the flags
--------------------------------------------------*/
+//-------------------------------------------------
+//  bevalidate_outputs - number of leading
+//  destination operands of a tested opcode
+//-------------------------------------------------
 
-static void bevalidate_iterate_over_params(drcuml_state *drcuml, uml::code_handle **handles, const bevalidate_test *test, parameter *paramlist, int pnum)
+int bevalidate_outputs(opcode_t opcode)
 {
-	const opcode_info *opinfo = opcode_info_table[test->opcode()];
-	drcuml_ptype ptype;
-
-	// if no parameters, execute now
-	if (pnum >= ARRAY_LENGTH(opinfo->param) || opinfo->param[pnum].typemask == PTYPES_NONE)
+	switch (opcode)
 	{
-		bevalidate_iterate_over_flags(drcuml, handles, test, paramlist);
-		return;
+	case OP_CMP:    return 0;
+	case OP_MULU:
+	case OP_MULS:
+	case OP_DIVU:
+	case OP_DIVS:   return 2;
+	default:        return 1;
 	}
-
-	// iterate over valid parameter types
-	for (ptype = parameter::PTYPE_IMMEDIATE; ptype < parameter::PTYPE_MAX; ptype++)
-		if (opinfo->param[pnum].typemask & (1 << ptype))
-		{
-			int pindex, pcount;
-
-			// mapvars can only do 32-bit tests
-			if (ptype == parameter::PTYPE_MAPVAR && effective_test_psize(opinfo, pnum, test->size, test->param) == 8)
-				continue;
-
-			// for some parameter types, we wish to iterate over all possibilities
-			switch (ptype)
-			{
-				case parameter::PTYPE_INT_REGISTER:     pcount = REG_I_END - REG_I0;        break;
-				case parameter::PTYPE_FLOAT_REGISTER:   pcount = REG_F_END - REG_F0;        break;
-				default:                            pcount = 1;                                     break;
-			}
-
-			// iterate over possibilities
-			for (pindex = 0; pindex < pcount; pindex++)
-			{
-				bool skip = false;
-				int pscannum;
-
-				// for param 0, print a dot
-				if (pnum == 0)
-					printf(".");
-
-				// can't duplicate multiple source parameters unless they are immediates
-				if (ptype != parameter::PTYPE_IMMEDIATE && (opinfo->param[pnum].output & PIO_IN))
-
-					// loop over all parameters we've done before; if the parameter is a source and matches us, skip this case
-					for (pscannum = 0; pscannum < pnum; pscannum++)
-						if ((opinfo->param[pscannum].output & PIO_IN) && ptype == paramlist[pscannum].type && pindex == paramlist[pscannum].value)
-							skip = true;
-
-				// can't duplicate multiple dest parameters
-				if (opinfo->param[pnum].output & PIO_OUT)
-
-					// loop over all parameters we've done before; if the parameter is a source and matches us, skip this case
-					for (pscannum = 0; pscannum < pnum; pscannum++)
-						if ((opinfo->param[pscannum].output & PIO_OUT) && ptype == paramlist[pscannum].type && pindex == paramlist[pscannum].value)
-							skip = true;
-
-				// iterate over the next parameter in line
-				if (!skip)
-				{
-					paramlist[pnum].type = ptype;
-					paramlist[pnum].value = pindex;
-					bevalidate_iterate_over_params(drcuml, handles, test, paramlist, pnum + 1);
-				}
-			}
-		}
 }
 
 
-/*-------------------------------------------------
-    bevalidate_iterate_over_flags - iterate over
-    all supported flag masks
--------------------------------------------------*/
-
-static void bevalidate_iterate_over_flags(drcuml_state *drcuml, uml::code_handle **handles, const bevalidate_test *test, parameter *paramlist)
-{
-	const opcode_info *opinfo = opcode_info_table[test->opcode()];
-	uint8_t flagmask = opinfo->outflags;
-	uint8_t curmask;
-
-	// iterate over all possible flag combinations
-	for (curmask = 0; curmask <= flagmask; curmask++)
-		if ((curmask & flagmask) == curmask)
-			bevalidate_execute(drcuml, handles, test, paramlist, curmask);
-}
-
-
-/*-------------------------------------------------
-    bevalidate_execute - execute a single instance
-    of a test, generating code and verifying the
-    results
--------------------------------------------------*/
+//-------------------------------------------------
+//  bevalidate_operands - number of operands of a
+//  tested opcode
+//-------------------------------------------------
 
-static void bevalidate_execute(drcuml_state *drcuml, uml::code_handle **handles, const bevalidate_test *test, const parameter *paramlist, uint8_t flagmask)
+int bevalidate_operands(opcode_t opcode)
 {
-	parameter params[ARRAY_LENGTH(test->param)];
-	drcuml_machine_state istate, fstate;
-	instruction testinst;
-	drcuml_block *block;
-	uint64_t *parammem;
-	int numparams;
-
-	// allocate memory for parameters
-	parammem = (uint64_t *)drcuml->cache->alloc_near(sizeof(uint64_t) * (ARRAY_LENGTH(test->param) + 1));
-
-	// flush the cache
-	drcuml->reset();
-
-	// start a new block
-	block = drcuml->block_begin(30);
-	UML_HANDLE(block, handles[0]);
-
-	// set up a random initial state
-	bevalidate_initialize_random_state(drcuml, block, &istate);
-
-	// then populate the state with the parameters
-	numparams = bevalidate_populate_state(block, &istate, test, paramlist, params, parammem);
-
-	// generate the code
-	UML_RESTORE(block, &istate);
-	UML_HANDLE(block, handles[1]);
-	switch (numparams)
+	switch (opcode)
 	{
-		case 0:
-			block->append(test->opcode(), test->size);
-			break;
-
-		case 1:
-			block->append(test->opcode(), test->size, params[0]);
-			break;
-
-		case 2:
-			block->append(test->opcode(), test->size, params[0], params[1]);
-			break;
-
-		case 3:
-			block->append(test->opcode(), test->size, params[0], params[1], params[2]);
-			break;
-
-		case 4:
-			block->append(test->opcode(), test->size, params[0], params[1], params[2], params[3]);
-			break;
+	case OP_CMP:    return 2;
+	case OP_MULU:
+	case OP_MULS:
+	case OP_DIVU:
+	case OP_DIVS:   return 4;
+	default:        return 3;
 	}
-	testinst = block->inst[block->nextinst - 1];
-	UML_HANDLE(block, handles[2]);
-	UML_GETFLGS(block, MEM(&parammem[ARRAY_LENGTH(test->param)]), flagmask);
-	UML_SAVE(block, &fstate);
-	UML_EXIT(block, IMM(0));
-
-	// end the block
-	block->end();
-
-	// execute
-	drcuml->execute(*handles[0]);
-
-	// verify the results
-	bevalidate_verify_state(drcuml, &istate, &fstate, test, *(uint32_t *)&parammem[ARRAY_LENGTH(test->param)], params, &testinst, handles[1]->code, handles[2]->code, flagmask);
-
-	// free memory
-	drcuml->cache->dealloc(parammem, sizeof(uint64_t) * (ARRAY_LENGTH(test->param) + 1));
 }
 
 
-/*-------------------------------------------------
-    bevalidate_initialize_random_state -
-    initialize the machine state to randomness
--------------------------------------------------*/
+//-------------------------------------------------
+//  bevalidate_emit - configure an instruction for
+//  a test with the given operands
+//-------------------------------------------------
 
-static void bevalidate_initialize_random_state(drcuml_state *drcuml, drcuml_block *block, drcuml_machine_state *state)
+void bevalidate_emit(instruction &inst, bevalidate_test const &test, parameter const *p)
 {
-	running_machine &machine = drcuml->device->machine();
-	int regnum;
-
-	// initialize core state to random values
-	state->fmod = machine.rand() & 0x03;
-	state->flags = machine.rand() & 0x1f;
-	state->exp = machine.rand();
-
-	// initialize integer registers to random values
-	for (regnum = 0; regnum < ARRAY_LENGTH(state->r); regnum++)
+	bool const d = (test.size == 8);
+	switch (test.opcode)
 	{
-		state->r[regnum].w.h = machine.rand();
-		state->r[regnum].w.l = machine.rand();
+	case OP_ADD:    d ? inst.dadd(p[0], p[1], p[2]) : inst.add(p[0], p[1], p[2]);                  break;
+	case OP_ADDC:   d ? inst.daddc(p[0], p[1], p[2]) : inst.addc(p[0], p[1], p[2]);                break;
+	case OP_SUB:    d ? inst.dsub(p[0], p[1], p[2]) : inst.sub(p[0], p[1], p[2]);                  break;
+	case OP_SUBB:   d ? inst.dsubb(p[0], p[1], p[2]) : inst.subb(p[0], p[1], p[2]);                break;
+	case OP_CMP:    d ? inst.dcmp(p[0], p[1]) : inst.cmp(p[0], p[1]);                              break;
+	case OP_MULU:   d ? inst.dmulu(p[0], p[1], p[2], p[3]) : inst.mulu(p[0], p[1], p[2], p[3]);    break;
+	case OP_MULS:   d ? inst.dmuls(p[0], p[1], p[2], p[3]) : inst.muls(p[0], p[1], p[2], p[3]);    break;
+	case OP_DIVU:   d ? inst.ddivu(p[0], p[1], p[2], p[3]) : inst.divu(p[0], p[1], p[2], p[3]);    break;
+	case OP_DIVS:   d ? inst.ddivs(p[0], p[1], p[2], p[3]) : inst.divs(p[0], p[1], p[2], p[3]);    break;
+	default:        fatalerror("Unsupported opcode in backend validation\n");
 	}
-
-	// initialize float registers to random values
-	for (regnum = 0; regnum < ARRAY_LENGTH(state->f); regnum++)
-	{
-		*(uint32_t *)&state->f[regnum].s.h = machine.rand();
-		*(uint32_t *)&state->f[regnum].s.l = machine.rand();
-	}
-
-	// initialize map variables to random values
-	for (regnum = 0; regnum < MAPVAR_COUNT; regnum++)
-		UML_MAPVAR(block, MVAR(regnum), machine.rand());
 }
 
 
-/*-------------------------------------------------
-    bevalidate_populate_state - populate the
-    machine state with the proper values prior
-    to executing a test
--------------------------------------------------*/
+//-------------------------------------------------
+//  bevalidate_run - execute one test in one form
+//  on one backend, leaving the outcome in the
+//  work area
+//-------------------------------------------------
 
-static int bevalidate_populate_state(drcuml_block *block, drcuml_machine_state *state, const bevalidate_test *test, const parameter *paramlist, parameter *params, uint64_t *parammem)
+void bevalidate_run(drcuml_state &drcuml, code_handle &entry, bevalidate_work &work, drcuml_machine_state const &initial, bevalidate_test const &test, bevalidate_form form)
 {
-	const opcode_info *opinfo = opcode_info_table[test->opcode()];
-	int numparams = ARRAY_LENGTH(test->param);
-	int pnum;
-
-	// copy flags as-is
-	state->flags = test->iflags;
-
-	// iterate over parameters
-	for (pnum = 0; pnum < ARRAY_LENGTH(test->param); pnum++)
+	int const outputs = bevalidate_outputs(test.opcode);
+	int const operands = bevalidate_operands(test.opcode);
+
+	// start from the shared random state, then place the operands
+	work.istate = initial;
+	work.istate.flags = test.iflags;
+	work.flags = 0;
+	parameter params[4];
+	for (int pnum = 0; pnum < operands; pnum++)
 	{
-		int psize = effective_test_psize(opinfo, pnum, test->size, test->param);
-		parameter *curparam = &params[pnum];
-
-		// start with a copy of the parameter from the list
-		*curparam = paramlist[pnum];
-
-		// switch off the type
-		switch (curparam->type)
+		bool const output = (pnum < outputs);
+		work.param[pnum] = 0;
+		if (form == FORM_MEMORY)
 		{
-			// immediate parameters: take the value from the test entry
-			case parameter::PTYPE_IMMEDIATE:
-				curparam->value = test->param[pnum];
-				break;
-
-			// register parameters: set the register value in the state and set the parameter value to the register index
-			case parameter::PTYPE_INT_REGISTER:
-				state->r[curparam->value].d = test->param[pnum];
-				curparam->value += REG_I0;
-				break;
-
-			// register parameters: set the register value in the state and set the parameter value to the register index
-			case parameter::PTYPE_FLOAT_REGISTER:
-				state->f[curparam->value].d = test->param[pnum];
-				curparam->value += REG_F0;
-				break;
-
-			// memory parameters: set the memory value in the parameter space and set the parameter value to point to it
-			case parameter::PTYPE_MEMORY:
-				curparam->value = (uintptr_t)&parammem[pnum];
-				if (psize == 4)
-					*(uint32_t *)(uintptr_t)curparam->value = test->param[pnum];
+			if (!output)
+			{
+				if (test.size == 4)
+					*reinterpret_cast<u32 *>(&work.param[pnum]) = u32(test.param[pnum]);
 				else
-					*(uint64_t *)(uintptr_t)curparam->value = test->param[pnum];
-				break;
-
-			// map variables: issue a MAPVAR instruction to set the value and set the parameter value to the mapvar index
-			case parameter::PTYPE_MAPVAR:
-				UML_MAPVAR(block, MVAR(curparam->value), test->param[pnum]);
-				curparam->value += MAPVAR_M0;
-				break;
-
-			// use anything else to count the number of parameters
-			default:
-				numparams = MIN(numparams, pnum);
-				break;
+					work.param[pnum] = test.param[pnum];
+			}
+			params[pnum] = mem(&work.param[pnum]);
+		}
+		else if (form == FORM_IMMEDIATES && !output)
+			params[pnum] = test.param[pnum];
+		else
+		{
+			if (!output)
+				work.istate.r[pnum].d = test.param[pnum];
+			params[pnum] = ireg(pnum);
 		}
 	}
 
-	// return the total number of parameters
-	return numparams;
+	// generate and execute the block
+	drcuml.reset();
+	drcuml_block &block(drcuml.begin_block(16));
+	block.append().handle(entry);
+	block.append().restore(&work.istate);
+	bevalidate_emit(block.append(), test, params);
+	block.append().getflgs(mem(&work.flags), FLAG_U | FLAG_S | FLAG_Z | FLAG_V | FLAG_C);
+	block.append().save(&work.fstate);
+	block.append().exit(0);
+	block.end();
+	drcuml.execute(entry);
 }
 
 
-/*-------------------------------------------------
-    bevalidate_verify_state - verify the final
-    state after executing a test, and report any
-    discrepancies
--------------------------------------------------*/
+//-------------------------------------------------
+//  bevalidate_result - fetch an operand result
+//  from the work area
+//-------------------------------------------------
 
-static int bevalidate_verify_state(drcuml_state *drcuml, const drcuml_machine_state *istate, drcuml_machine_state *state, const bevalidate_test *test, uint32_t flags, const parameter *params, const instruction *testinst, drccodeptr codestart, drccodeptr codeend, uint8_t flagmask)
+u64 bevalidate_result(bevalidate_work const &work, bevalidate_test const &test, bevalidate_form form, int pnum)
 {
-	const opcode_info *opinfo = opcode_info_table[test->opcode()];
-	uint8_t ireg[REG_I_END - REG_I0] = { 0 };
-	uint8_t freg[REG_F_END - REG_F0] = { 0 };
-	char errorbuf[1024];
-	char *errend = errorbuf;
-	int pnum, regnum;
+	u64 const mask = (test.size == 4) ? 0xffffffffU : ~u64(0);
+	if (form == FORM_MEMORY)
+		return ((test.size == 4) ? *reinterpret_cast<u32 const *>(&work.param[pnum]) : work.param[pnum]) & mask;
+	return work.fstate.r[pnum].d & mask;
+}
 
-	*errend = 0;
+} // anonymous namespace
 
-	// check flags
-	if (flags != (test->flags & flagmask))
-	{
-		errend += sprintf(errend, "  Flags ... result:%c%c%c%c%c  expected:%c%c%c%c%c\n",
-			(flagmask & FLAG_U) ? ((flags & FLAG_U) ? 'U' : '.') : '-',
-			(flagmask & FLAG_S) ? ((flags & FLAG_S) ? 'S' : '.') : '-',
-			(flagmask & FLAG_Z) ? ((flags & FLAG_Z) ? 'Z' : '.') : '-',
-			(flagmask & FLAG_V) ? ((flags & FLAG_V) ? 'V' : '.') : '-',
-			(flagmask & FLAG_C) ? ((flags & FLAG_C) ? 'C' : '.') : '-',
-			(flagmask & FLAG_U) ? ((test->flags & FLAG_U) ? 'U' : '.') : '-',
-			(flagmask & FLAG_S) ? ((test->flags & FLAG_S) ? 'S' : '.') : '-',
-			(flagmask & FLAG_Z) ? ((test->flags & FLAG_Z) ? 'Z' : '.') : '-',
-			(flagmask & FLAG_V) ? ((test->flags & FLAG_V) ? 'V' : '.') : '-',
-			(flagmask & FLAG_C) ? ((test->flags & FLAG_C) ? 'C' : '.') : '-');
-	}
 
-	// check destination parameters
-	for (pnum = 0; pnum < ARRAY_LENGTH(test->param); pnum++)
-		if (opinfo->param[pnum].output & PIO_OUT)
+//-------------------------------------------------
+//  validate_backend - run the validation tests
+//  through the active backend and the C backend,
+//  and compare both against expectations and each
+//  other
+//-------------------------------------------------
+
+void drcuml_state::validate_backend()
+{
+	// the C backend serves as the reference
+	drc_cache refcache(4 * 1024 * 1024);
+	drcuml_state reference(m_device, refcache, 0, 1, 32, 0, true);
+
+	code_handle &entry(*handle_alloc("validate_entry"));
+	code_handle &refentry(*reference.handle_alloc("validate_entry"));
+	auto &work(*reinterpret_cast<bevalidate_work *>(m_cache.alloc_near(sizeof(bevalidate_work))));
+	auto &refwork(*reinterpret_cast<bevalidate_work *>(refcache.alloc_near(sizeof(bevalidate_work))));
+
+	running_machine &machine(m_device.machine());
+	int failures = 0;
+	int runs = 0;
+	for (bevalidate_test const &test : bevalidate_test_list)
+	{
+		// work out which flags this instruction defines
+		instruction probe;
+		parameter probeparams[4] = { I0, I1, I2, I3 };
+		bevalidate_emit(probe, test, probeparams);
+		u8 const flagmask = probe.output_flags();
+		std::string const disasm = probe.disasm(this);
+
+		int const outputs = bevalidate_outputs(test.opcode);
+		for (int f = 0; f < FORM_COUNT; f++)
 		{
-			int psize = effective_test_psize(opinfo, pnum, test->size, test->param);
-			uint64_t mask = u64(0xffffffffffffffff) >> (64 - 8 * psize);
-			uint64_t result = 0;
+			bevalidate_form const form = bevalidate_form(f);
+
+			// random registers, shared by both backends
+			drcuml_machine_state initial;
+			memset(&initial, 0, sizeof(initial));
+			for (auto &reg : initial.r)
+				reg.d = (u64(machine.rand()) << 32) | u32(machine.rand());
+			for (auto &reg : initial.f)
+				reg.d = 0.0;
+			initial.fmod = machine.rand() & 3;
+			initial.exp = machine.rand();
+
+			bevalidate_run(*this, entry, work, initial, test, form);
+			bevalidate_run(reference, refentry, refwork, initial, test, form);
+			runs++;
+
+			std::string errors;
+
+			// flags against expectations and against the reference
+			if ((work.flags & flagmask) != (test.flags & flagmask))
+				errors += util::string_format("  flags %02X, expected %02X\n", work.flags & flagmask, test.flags & flagmask);
+			if ((work.flags & flagmask) != (refwork.flags & flagmask))
+				errors += util::string_format("  flags %02X, drcbe_c %02X\n", work.flags & flagmask, refwork.flags & flagmask);
+
+			// destination operands
+			for (int pnum = 0; pnum < outputs; pnum++)
+			{
+				if (test.param[pnum] == UNDEFINED)
+					continue;
+				u64 const result = bevalidate_result(work, test, form, pnum);
+				u64 const refresult = bevalidate_result(refwork, test, form, pnum);
+				u64 const expected = test.param[pnum] & ((test.size == 4) ? 0xffffffffU : ~u64(0));
+				if (result != expected)
+					errors += util::string_format("  operand %d %016X, expected %016X\n", pnum, result, expected);
+				if (result != refresult)
+					errors += util::string_format("  operand %d %016X, drcbe_c %016X\n", pnum, result, refresult);
+			}
 
-			// fetch the result from the parameters
-			switch (params[pnum].type)
+			// registers that are not destinations must survive untouched
+			for (int regnum = 0; regnum < REG_I_COUNT; regnum++)
 			{
-				// integer registers fetch from the state
-				case parameter::PTYPE_INT_REGISTER:
-					ireg[params[pnum].value - REG_I0] = 1;
-					result = state->r[params[pnum].value - REG_I0].d;
-					break;
-
-				// float registers fetch from the state
-				case parameter::PTYPE_FLOAT_REGISTER:
-					freg[params[pnum].value - REG_I0] = 1;
-					result = state->f[params[pnum].value - REG_F0].d;
-					break;
-
-				// memory registers fetch from the memory address
-				case parameter::PTYPE_MEMORY:
-					if (psize == 4)
-						result = *(uint32_t *)(uintptr_t)params[pnum].value;
-					else
-						result = *(uint64_t *)(uintptr_t)params[pnum].value;
-					break;
-
-				default:
-					break;
+				if (form != FORM_MEMORY && regnum < outputs)
+					continue;
+				if (work.fstate.r[regnum].d != work.istate.r[regnum].d)
+					errors += util::string_format("  i%d altered to %016X\n", regnum, work.fstate.r[regnum].d);
 			}
 
-			// check against the mask
-			if (test->param[pnum] != UNDEFINED_U64 && (result & mask) != (test->param[pnum] & mask))
+			if (!errors.empty())
 			{
-				if ((uint32_t)mask == mask)
-					errend += sprintf(errend, "  Parameter %d ... result:%08X  expected:%08X\n", pnum,
-										(uint32_t)(result & mask), (uint32_t)(test->param[pnum] & mask));
-				else
-					errend += sprintf(errend, "  Parameter %d ... result:%08X%08X  expected:%08X%08X\n", pnum,
-										(uint32_t)((result & mask) >> 32), (uint32_t)(result & mask),
-										(uint32_t)((test->param[pnum] & mask) >> 32), (uint32_t)(test->param[pnum] & mask));
+				osd_printf_error("Backend validation failure: %s (%s)\n%s", disasm, bevalidate_form_names[form], errors);
+				failures++;
 			}
 		}
-
-	// check source integer parameters for unexpected alterations
-	for (regnum = 0; regnum < ARRAY_LENGTH(state->r); regnum++)
-		if (ireg[regnum] == 0 && istate->r[regnum].d != state->r[regnum].d)
-			errend += sprintf(errend, "  Register i%d ... result:%08X%08X  originally:%08X%08X\n", regnum,
-								(uint32_t)(state->r[regnum].d >> 32), (uint32_t)state->r[regnum].d,
-								(uint32_t)(istate->r[regnum].d >> 32), (uint32_t)istate->r[regnum].d);
-
-	// check source float parameters for unexpected alterations
-	for (regnum = 0; regnum < ARRAY_LENGTH(state->f); regnum++)
-		if (freg[regnum] == 0 && *(uint64_t *)&istate->f[regnum].d != *(uint64_t *)&state->f[regnum].d)
-			errend += sprintf(errend, "  Register f%d ... result:%08X%08X  originally:%08X%08X\n", regnum,
-								(uint32_t)(*(uint64_t *)&state->f[regnum].d >> 32), (uint32_t)*(uint64_t *)&state->f[regnum].d,
-								(uint32_t)(*(uint64_t *)&istate->f[regnum].d >> 32), (uint32_t)*(uint64_t *)&istate->f[regnum].d);
-
-	// output the error if we have one
-	if (errend != errorbuf)
-	{
-		// disassemble the test instruction
-		std::string disasm = testinst->disasm(drcuml);
-
-		// output a description of what went wrong
-		printf("\n");
-		printf("----------------------------------------------\n");
-		printf("Backend validation error:\n");
-		printf("   %s\n", disasm.c_str());
-		printf("\n");
-		printf("Errors:\n");
-		printf("%s\n", errorbuf);
-		fatalerror("Error during validation\n");
 	}
-	return errend != errorbuf;
+
+	// leave the cache clean for the caller
+	m_cache.dealloc(&work, sizeof(work));
+	refcache.dealloc(&refwork, sizeof(refwork));
+	m_cache.flush();
+	for (code_handle &handle : m_handlelist)
+		*handle.codeptr_addr() = nullptr;
+	m_beintf->reset();
+
+	if (failures != 0)
+		fatalerror("Backend validation: %d of %d runs failed\n", failures, runs);
+	osd_printf_info("Backend validation: %d runs passed\n", runs);
 }
 
-#endif
@@ -15,6 +15,8 @@
 #include "drccache.h"
 #include "uml.h"
 
+#include <atomic>
+#include <exception>
 #include <iostream>
 #include <list>
 #include <memory>
@@ -97,6 +99,7 @@ public:
 	// code generation
 	void begin();
 	void end();
+	void end_background();
 	void abort();
 
 	// instruction appending
@@ -113,6 +116,9 @@ public:
 private:
 	// internal helpers
 	void optimize();
+	void resolve_mapvars();
+	void compute_flags();
+	void propagate_values();
 	void disassemble();
 	char const *get_comment_text(uml::instruction const &inst, std::string &comment);
 
@@ -173,6 +179,13 @@ public:
 	// code generation
 	drcuml_block &begin_block(u32 maxinst);
 
+	// background code generation
+	void enable_background();
+	bool background() const { return m_bgqueue != nullptr; }
+	bool background_pending() const { return m_bgblock != nullptr; }
+	bool background_ready() const { return m_bgdone.load(std::memory_order_acquire); }
+	bool background_wait();
+
 	// back-end interface
 	void get_backend_info(drcbe_info &info) { m_beintf->get_info(info); }
 	bool hash_exists(u32 mode, u32 pc) { return m_beintf->hash_exists(mode, pc); }
@@ -181,6 +194,9 @@ public:
 	// handle management
 	uml::code_handle *handle_alloc(char const *name);
 
+	// code cache statistics
+	std::string statistics() const;
+
 	// symbol management
 	void symbol_add(void *base, u32 length, char const *name);
 	char const *symbol_find(void *base, u32 *offset = nullptr);
@@ -197,6 +213,17 @@ public:
 	bool logging_native() const { return m_beintf->logging(); }
 
 private:
+	// construction with an explicit backend choice, used for validation
+	drcuml_state(device_t &device, drc_cache &cache, u32 flags, int modes, int addrbits, int ignorebits, bool use_c);
+
+	// validate the active backend against the C backend
+	void validate_backend();
+
+	// background generation helpers
+	friend class drcuml_block;
+	void background_queue(drcuml_block &block);
+	static void *background_generate(void *param, int threadid);
+
 	// symbol class
 	class symbol
 	{
@@ -228,6 +255,12 @@ private:
 	std::list<drcuml_block>                 m_blocklist;        // list of active blocks
 	std::list<uml::code_handle>             m_handlelist;       // list of active handles
 	std::list<symbol>                       m_symlist;          // list of symbols
+
+	// background generation state
+	osd_work_queue *                        m_bgqueue;          // work queue for background generation
+	drcuml_block *                          m_bgblock;          // block being generated in the background
+	std::atomic<bool>                       m_bgdone;           // background generation has finished
+	std::exception_ptr                      m_bgerror;          // exception thrown by background generation
 };
 
 
@@ -552,6 +552,7 @@ void es5510_device::ser_w(int offset, int16_t data)
 void es5510_device::device_start() {
 	gpr = std::make_unique<int32_t[]>(0xc0);     // 24 bits, right justified
 	instr = std::make_unique<uint64_t[]>(160);    // 48 bits, right justified
+	decoded = std::make_unique<decoded_instr_t[]>(160);
 	dram = std::make_unique<int16_t[]>(DRAM_SIZE);   // there are up to 20 address bits (at least 16 expected), left justified within the 24 bits of a gpr or dadr; we preallocate all of it.
 	set_icountptr(icount);
 	state_add(STATE_GENPC,"GENPC", pc).noshow();
@@ -630,6 +631,8 @@ void es5510_device::device_reset() {
 	pc = 0x00;
 	std::fill(&gpr[0], &gpr[0xc0], 0);
 	std::fill(&instr[0], &instr[160], 0);
+	for (int addr = 0; addr < 160; addr++)
+		decode_instr(addr);
 	std::fill(&dram[0], &dram[DRAM_SIZE], 0);
 	state = STATE_RUNNING;
 	dil_latch = dol_latch = dadr_latch = gpr_latch = 0;
@@ -788,7 +791,7 @@ void es5510_device::execute_run() {
 
 			// *** T0, clock low
 			// --- Read instruction N
-			uint64_t instr = this->instr[pc];
+			const decoded_instr_t &instr = decoded_instr(pc);
 
 			// --- RAM cycle N-2 (if a Read cycle): data read from bus is stored in DIL
 			if (ram_pp.cycle != RAM_CYCLE_WRITE) {
@@ -801,13 +804,12 @@ void es5510_device::execute_run() {
 			}
 
 			// --- start of RAM cycle N
-			ram_control_t ramControl = RAM_CONTROL[((instr >> 3) & 0x07)];
-			ram.cycle = ramControl.cycle;
-			ram.io = ramControl.access == RAM_CONTROL_IO;
+			ram.cycle = instr.ram_cycle;
+			ram.io = instr.ram_access == RAM_CONTROL_IO;
 
 			// --- RAM cycle N: read offset N
 			int32_t offset = gpr[pc];
-			switch(ramControl.access) {
+			switch(instr.ram_access) {
 			case RAM_CONTROL_DELAY:
 				ram.address = (((dbase + offset) % (dlength + memincrement)) & memmask) >> memshift;
 				LOG_EXEC((". Ram Control: Delay, base=%x, offset=%x, length=%x => address=%x\n", dbase >> memshift, offset >> memshift, (dlength + memincrement) >> memshift, ram.address));
@@ -832,10 +834,8 @@ void es5510_device::execute_run() {
 
 			LOG_EXEC(("- T1.1\n"));
 
-			uint8_t operandSelect = (uint8_t)((instr >> 8) & 0x0f);
-			const op_select_t &opSelect = OPERAND_SELECT[operandSelect];
 			bool skip;
-			bool skippable = (instr & (0x01 << 7)) != 0; // aka the 'SKIP' bit in the instruction word
+			bool skippable = instr.skippable; // aka the 'SKIP' bit in the instruction word
 			if (skippable) {
 				bool skipConditionSatisfied = (ccr & cmr & FLAG_MASK) != 0;
 				if (isFlagSet(cmr, FLAG_NOT)) {
@@ -890,11 +890,11 @@ void es5510_device::execute_run() {
 
 			// --- Start of multiplier cycle N
 			LOG_EXEC((". start mulacc:\n"));
-			mulacc.cReg = (uint8_t)((instr >> 32) & 0xff);
-			mulacc.dReg = (uint8_t)((instr >> 40) & 0xff);
-			mulacc.src = opSelect.mac_src;
-			mulacc.dst = opSelect.mac_dst;
-			mulacc.accumulate = ((instr >> 6) & 0x01) != 0;
+			mulacc.cReg = instr.cReg;
+			mulacc.dReg = instr.dReg;
+			mulacc.src = instr.mac_src;
+			mulacc.dst = instr.mac_dst;
+			mulacc.accumulate = instr.accumulate;
 			mulacc.write_result = !skip;
 
 			// --- Read Multiplier Operands N
@@ -932,11 +932,11 @@ void es5510_device::execute_run() {
 
 			// --- Start of ALU cycle N
 			LOG_EXEC((". start ALU:\n"));
-			alu.aReg = (instr >> 16) & 0xff;
-			alu.bReg = (instr >> 24) & 0xff;
-			alu.op = (instr >> 12) & 0x0f;
-			alu.src = opSelect.alu_src;
-			alu.dst = opSelect.alu_dst;
+			alu.aReg = instr.aReg;
+			alu.bReg = instr.bReg;
+			alu.op = instr.alu_op;
+			alu.src = instr.alu_src;
+			alu.dst = instr.alu_dst;
 			alu.write_result = !skip;
 			alu.update_ccr = !skippable || (alu.op == OP_CMP);
 
@@ -944,8 +944,7 @@ void es5510_device::execute_run() {
 				alu_operation_end();
 			} else {
 				// --- Read ALU Operands N
-				alu_op_t aluOp = ALU_OPS[alu.op];
-				if (aluOp.operands == 1) {
+				if (instr.alu_operands == 1) {
 					if (alu.src == SRC_DST_REG) {
 						alu.bValue = read_reg(alu.bReg);
 					} else { // must be SRC_DST_DELAY
@@ -996,6 +995,30 @@ void es5510_device::execute_run() {
 	}
 }
 
+void es5510_device::decode_instr(uint8_t addr)
+{
+	const uint64_t raw = instr[addr];
+	decoded_instr_t &d = decoded[addr];
+	const ram_control_t &ramControl = RAM_CONTROL[(raw >> 3) & 0x07];
+	const op_select_t &opSelect = OPERAND_SELECT[(raw >> 8) & 0x0f];
+
+	d.raw = raw;
+	d.ram_cycle = ramControl.cycle;
+	d.ram_access = ramControl.access;
+	d.alu_src = opSelect.alu_src;
+	d.alu_dst = opSelect.alu_dst;
+	d.mac_src = opSelect.mac_src;
+	d.mac_dst = opSelect.mac_dst;
+	d.aReg = (raw >> 16) & 0xff;
+	d.bReg = (raw >> 24) & 0xff;
+	d.cReg = (raw >> 32) & 0xff;
+	d.dReg = (raw >> 40) & 0xff;
+	d.alu_op = (raw >> 12) & 0x0f;
+	d.alu_operands = ALU_OPS[d.alu_op].operands;
+	d.skippable = (raw & (0x01 << 7)) != 0;
+	d.accumulate = ((raw >> 6) & 0x01) != 0;
+}
+
 std::unique_ptr<util::disasm_interface> es5510_device::create_disassembler()
 {
 	return std::make_unique<es5510_disassembler>();
@@ -176,6 +176,34 @@ private:
 	std::unique_ptr<uint64_t[]> instr;
 	std::unique_ptr<int16_t[]> dram;
 
+	// instruction fields, decoded once and reused until the instruction word changes
+	struct decoded_instr_t {
+		uint64_t raw;                // instruction word this was decoded from
+		ram_cycle_t ram_cycle;
+		ram_control_access_t ram_access;
+		op_src_dst_t alu_src;
+		op_src_dst_t alu_dst;
+		op_src_dst_t mac_src;
+		op_src_dst_t mac_dst;
+		uint8_t aReg;
+		uint8_t bReg;
+		uint8_t cReg;
+		uint8_t dReg;
+		uint8_t alu_op;
+		uint8_t alu_operands;
+		bool skippable;
+		bool accumulate;
+	};
+
+	std::unique_ptr<decoded_instr_t[]> decoded;
+
+	void decode_instr(uint8_t addr);
+	const decoded_instr_t &decoded_instr(uint8_t addr) {
+		if (decoded[addr].raw != instr[addr])
+			decode_instr(addr);
+		return decoded[addr];
+	}
+
 	// TODO : Masked address?
 	int16_t dram_r(int addr) { return dram[addr & DRAM_MASK]; }
 	void dram_w(int addr, int16_t data) { dram[addr & DRAM_MASK] = data; }
@@ -27,6 +27,7 @@ athlonxp_device::athlonxp_device(const machine_config &mconfig, const char *tag,
 void athlonxp_device::device_start()
 {
 	i386_common_init();
+	m_code_page_enable = false; // opcodes come through the L1 cache model
 	register_state_i386_x87_xmm();
 	space(AS_DATA).specific(m_data);
 	space(AS_OPCODES).specific(m_opcodes);
@@ -325,15 +325,47 @@ void i386_device::NEAR_BRANCH(int32_t offs)
 	m_pc += offs;
 }
 
+/*-------------------------------------------------
+    code_page_fill - remember the host pointer
+    behind the page just fetched from, if it's
+    RAM that every byte of can be read directly
+-------------------------------------------------*/
+
+void i386_device::code_page_fill(uint32_t linear, uint32_t physical)
+{
+	m_code_page_skip = code_page_key(linear);
+	if (!m_code_page_enable)
+		return;
+
+	// ROM and banked regions go through the cache every time, since
+	// bank switches don't reach the change notifier
+	offs_t const base = physical & ~0xfff;
+	uint8_t *const ptr = reinterpret_cast<uint8_t *>(m_program->get_write_ptr(base));
+	if (!ptr || m_program->get_read_ptr(base) != ptr || m_program->get_read_ptr(base | 0xfff) != ptr + 0xfff)
+		return;
+
+	m_code_page_base = ptr;
+	m_code_page_tag = m_code_page_skip;
+}
+
 uint8_t i386_device::FETCH()
 {
 	uint8_t value;
 	uint32_t address = m_pc, error;
 
-	if(!translate_address(m_CPL,TRANSLATE_FETCH,&address,&error))
-		PF_THROW(error);
+	if (code_page_key(address) == m_code_page_tag)
+	{
+		value = m_code_page_base[address & 0xfff];
+	}
+	else
+	{
+		if(!translate_address(m_CPL,TRANSLATE_FETCH,&address,&error))
+			PF_THROW(error);
 
-	value = mem_pr8(address & m_a20_mask);
+		value = mem_pr8(address & m_a20_mask);
+		if (code_page_key(m_pc) != m_code_page_skip)
+			code_page_fill(m_pc, address & m_a20_mask);
+	}
 #ifdef DEBUG_MISSING_OPCODE
 	m_opcode_bytes[m_opcode_bytes_length] = value;
 	m_opcode_bytes_length = (m_opcode_bytes_length + 1) & 15;
@@ -351,10 +383,19 @@ uint16_t i386_device::FETCH16()
 		value = (FETCH() << 0);
 		value |= (FETCH() << 8);
 	} else {
-		if(!translate_address(m_CPL,TRANSLATE_FETCH,&address,&error))
-			PF_THROW(error);
-		address &= m_a20_mask;
-		value = mem_pr16(address);
+		if (code_page_key(address) == m_code_page_tag)
+		{
+			value = *reinterpret_cast<const uint16_t *>(&m_code_page_base[address & 0xfff]);
+		}
+		else
+		{
+			if(!translate_address(m_CPL,TRANSLATE_FETCH,&address,&error))
+				PF_THROW(error);
+			address &= m_a20_mask;
+			value = mem_pr16(address);
+			if (code_page_key(m_pc) != m_code_page_skip)
+				code_page_fill(m_pc, address);
+		}
 		m_eip += 2;
 		m_pc += 2;
 	}
@@ -371,11 +412,20 @@ uint32_t i386_device::FETCH32()
 		value |= (FETCH() << 16);
 		value |= (FETCH() << 24);
 	} else {
-		if(!translate_address(m_CPL,TRANSLATE_FETCH,&address,&error))
-			PF_THROW(error);
+		if (code_page_key(address) == m_code_page_tag)
+		{
+			value = *reinterpret_cast<const uint32_t *>(&m_code_page_base[address & 0xfff]);
+		}
+		else
+		{
+			if(!translate_address(m_CPL,TRANSLATE_FETCH,&address,&error))
+				PF_THROW(error);
 
-		address &= m_a20_mask;
-		value = mem_pr32(address);
+			address &= m_a20_mask;
+			value = mem_pr32(address);
+			if (code_page_key(m_pc) != m_code_page_skip)
+				code_page_fill(m_pc, address);
+		}
 		m_eip += 4;
 		m_pc += 4;
 	}
@@ -1148,6 +1198,7 @@ uint8_t i386_device::READPORT8(offs_t port)
 
 void i386_device::WRITEPORT8(offs_t port, uint8_t value)
 {
+	code_page_flush(); // chipsets remap RAM from I/O space
 	check_ioperm(port, 1);
 	m_io->write_byte(port, value);
 }
@@ -1181,6 +1232,7 @@ uint16_t i386_device::READPORT16(offs_t port)
 
 void i386_device::WRITEPORT16(offs_t port, uint16_t value)
 {
+	code_page_flush();
 	switch (port & 3)
 	{
 	case 0:
@@ -1236,6 +1288,7 @@ uint32_t i386_device::READPORT32(offs_t port)
 
 void i386_device::WRITEPORT32(offs_t port, uint32_t value)
 {
+	code_page_flush();
 	switch (port & 3)
 	{
 	case 0:
@@ -1279,6 +1332,7 @@ uint16_t i386sx_device::READPORT16(offs_t port)
 
 void i386sx_device::WRITEPORT16(offs_t port, uint16_t value)
 {
+	code_page_flush();
 	if (port & 1)
 	{
 		WRITEPORT8(port, value & 0xff);
@@ -1310,6 +1364,7 @@ uint32_t i386sx_device::READPORT32(offs_t port)
 
 void i386sx_device::WRITEPORT32(offs_t port, uint32_t value)
 {
+	code_page_flush();
 	if (port & 1)
 	{
 		WRITEPORT8(port, value & 0xff);
@@ -1902,6 +1957,7 @@ void i386_device::i386_postload()
 	for (i = 0; i < 6; i++)
 		i386_load_segment_descriptor(i);
 	CHANGE_PC(m_eip);
+	code_page_flush();
 }
 
 void i386_device::i386_common_init()
@@ -1942,6 +1998,12 @@ void i386_device::i386_common_init()
 		m_program->cache(macache32);
 	}
 
+	// the fast path reads opcodes as little-endian words straight from
+	// host memory, and would hide fetches from the debugger
+	m_code_page_enable = (ENDIANNESS_NATIVE == ENDIANNESS_LITTLE) && !(machine().debug_flags & DEBUG_FLAG_ENABLED);
+	m_code_page_base = nullptr;
+	code_page_flush();
+
 	m_io = &space(AS_IO);
 	m_smi = false;
 	m_debugger_temp = 0;
@@ -2022,6 +2084,7 @@ void i386_device::i386_common_init()
 	set_icountptr(m_cycles);
 	m_notifier = m_program->add_change_notifier([this](read_or_write mode)
 	{
+		code_page_flush();
 		dri_changed();
 	});
 }
@@ -2371,6 +2434,7 @@ void i386_device::zero_state()
 	memset( m_sreg, 0, sizeof(m_sreg) );
 	m_eip = 0;
 	m_pc = 0;
+	code_page_flush();
 	m_prev_eip = 0;
 	m_eflags = 0;
 	m_eflags_mask = 0;
@@ -2495,6 +2559,7 @@ void i386_device::enter_smm()
 	uint32_t old_flags = get_flags();
 
 	m_cr[0] &= ~(0x8000000d);
+	code_page_flush();
 	set_flags(2);
 	if(!m_smiact.isnull())
 		m_smiact(true);
@@ -2634,6 +2699,7 @@ void i386_device::leave_smm()
 	m_eflags = READ32(smram_state + SMRAM_EFLAGS);
 	m_cr[3] = READ32(smram_state + SMRAM_CR3);
 	m_cr[0] = READ32(smram_state + SMRAM_CR0);
+	code_page_flush();
 
 	m_CPL = (m_sreg[SS].flags >> 13) & 3; // cpl == dpl of ss
 
@@ -2721,6 +2787,7 @@ void i386_device::i386_set_a20_line(int state)
 	}
 	// TODO: how does A20M and the tlb interact
 	vtlb_flush_dynamic();
+	code_page_flush();
 }
 
 void i386_device::execute_run()
@@ -2728,6 +2795,7 @@ void i386_device::execute_run()
 	int cycles = m_cycles;
 	m_base_cycles = cycles;
 	CHANGE_PC(m_eip);
+	code_page_flush(); // other devices may have switched banks since the last slice
 
 	if (m_halted)
 	{
@@ -277,6 +277,16 @@ protected:
 	memory_passthrough_handler* m_dr_breakpoints[4];
 	int m_notifier;
 
+	// Instruction fetch fast path: the linear page EIP is in, tagged with
+	// the CPL that translated it, when that page is backed by plain RAM
+	bool m_code_page_enable;
+	uint32_t m_code_page_tag;
+	uint32_t m_code_page_skip;
+	uint8_t *m_code_page_base;
+	inline uint32_t code_page_key(uint32_t address) const { return (address & ~0xfff) | m_CPL; }
+	void code_page_fill(uint32_t linear, uint32_t physical);
+	void code_page_flush() { m_code_page_tag = m_code_page_skip = ~0; }
+
 	//386 Debug Register change handlers.
 	inline void dri_changed();
 	inline void dr7_changed(uint32_t old_val, uint32_t new_val);
@@ -330,6 +330,7 @@ void i386_device::i486_group0F01_16()      // Opcode 0x0f 01
 				ea = GetEA(modrm,-1);
 				CYCLES(25); // TODO: add to cycles.h
 				vtlb_flush_address(ea);
+				code_page_flush();
 				break;
 			}
 		default:
@@ -448,6 +449,7 @@ void i386_device::i486_group0F01_32()      // Opcode 0x0f 01
 				ea = GetEA(modrm,-1);
 				CYCLES(25); // TODO: add to cycles.h
 				vtlb_flush_address(ea);
+				code_page_flush();
 				break;
 			}
 		default:
@@ -532,6 +534,7 @@ void i386_device::i486_mov_cr_r32()        // Opcode 0x0f 22
 			return;
 	}
 	m_cr[cr] = data;
+	code_page_flush();
 }
 
 void i386_device::i486_wait()
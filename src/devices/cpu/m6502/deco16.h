@@ -22,6 +22,7 @@ public:
 
 	virtual void do_exec_full() override;
 	virtual void do_exec_partial() override;
+	virtual void do_exec_loop() override;
 
 protected:
 	address_space *io;
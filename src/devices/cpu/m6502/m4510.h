@@ -23,6 +23,7 @@ public:
 
 	virtual void do_exec_full() override;
 	virtual void do_exec_partial() override;
+	virtual void do_exec_loop() override;
 
 	bool get_nomap() const { return nomap; }
 
@@ -112,6 +112,7 @@ void m6502_device::init()
 	inst_state_base = 0;
 	sync = false;
 	inhibit_interrupts = false;
+	bcount = 0;
 	count_before_instruction_step = 0;
 }
 
@@ -397,6 +398,13 @@ void m6502_device::execute_run()
 	if(inst_substate)
 		do_exec_partial();
 
+	// the debugger needs to see every instruction boundary
+	if(!(machine().debug_flags & DEBUG_FLAG_ENABLED)) {
+		if(icount > 0)
+			do_exec_loop();
+		return;
+	}
+
 	while(icount > 0) {
 		if(inst_state < 0xff00) {
 			PPC = NPC;
@@ -597,14 +605,18 @@ void m6502_mcu_device::execute_run()
 		do_exec_partial();
 
 	while(icount > 0) {
-		while(icount > bcount) {
-			if(inst_state < 0xff00) {
-				PPC = NPC;
-				inst_state = IR | inst_state_base;
-				if(machine().debug_flags & DEBUG_FLAG_ENABLED)
+		if(!(machine().debug_flags & DEBUG_FLAG_ENABLED)) {
+			if(icount > bcount)
+				do_exec_loop();
+		} else {
+			while(icount > bcount) {
+				if(inst_state < 0xff00) {
+					PPC = NPC;
+					inst_state = IR | inst_state_base;
 					debugger_instruction_hook(NPC);
+				}
+				do_exec_full();
 			}
-			do_exec_full();
 		}
 		if(icount > 0)
 			while(bcount && icount <= bcount)
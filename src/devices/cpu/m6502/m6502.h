@@ -11,6 +11,13 @@
 #ifndef MAME_CPU_M6502_M6502_H
 #define MAME_CPU_M6502_M6502_H
 
+// do_exec_loop dispatches with computed gotos where the compiler has them
+#if defined(__GNUC__) && !defined(M6502_NO_THREADED_DISPATCH)
+#define M6502_THREADED_DISPATCH 1
+#else
+#define M6502_THREADED_DISPATCH 0
+#endif
+
 class m6502_device : public cpu_device {
 public:
 	enum {
@@ -139,6 +146,7 @@ protected:
 	virtual offs_t pc_to_external(u16 pc); // For paged PCs
 	virtual void do_exec_full();
 	virtual void do_exec_partial();
+	virtual void do_exec_loop();
 
 	// inline helpers
 	static inline bool page_changing(uint16_t base, int delta) { return ((base + delta) ^ base) & 0xff00; }
@@ -180,6 +180,57 @@ DO_EXEC_PARTIAL_EPILOG="""\
 }
 """
 
+DO_EXEC_LOOP_PROLOG="""\
+void %(device)s_device::do_exec_loop()
+{
+#if M6502_THREADED_DISPATCH
+\tstatic void *const dispatch[0x%(disasm_count)x] = {"""
+
+DO_EXEC_LOOP_ENTRY="""\
+\t};
+
+\t// reset and other out-of-table states go through the switch
+special:
+\twhile(inst_state >= 0xff00) {
+\t\tdo_exec_full();
+\t\tif(icount <= bcount)
+\t\t\treturn;
+\t}
+\tPPC = NPC;
+\tinst_state = IR | inst_state_base;
+\tgoto *dispatch[inst_state];
+"""
+
+DO_EXEC_LOOP_OPCODE="""\
+%(label)s:
+\t%(state)s_full();
+\tif(icount <= bcount)
+\t\treturn;
+\tif(inst_state >= 0xff00)
+\t\tgoto special;
+\tPPC = NPC;
+\tinst_state = IR | inst_state_base;
+\tgoto *dispatch[inst_state];
+"""
+
+DO_EXEC_LOOP_UNMAPPED="""\
+unmapped:
+\treturn;
+"""
+
+DO_EXEC_LOOP_EPILOG="""\
+#else
+\twhile(icount > bcount) {
+\t\tif(inst_state < 0xff00) {
+\t\t\tPPC = NPC;
+\t\t\tinst_state = IR | inst_state_base;
+\t\t}
+\t\tdo_exec_full();
+\t}
+#endif
+}
+"""
+
 DISASM_PROLOG="""\
 const %(device)s_disassembler::disasm_entry %(device)s_disassembler::disasm_entries[0x%(disasm_count)x] = {
 """
@@ -213,6 +264,23 @@ def save_tables(f, device, states):
             emit(f, "\tcase %s: %s_partial(); break;" % ("STATE_RESET", state))
     emit(f, DO_EXEC_PARTIAL_EPILOG % d)
 
+    # threaded version of the execute loop: every opcode ends with its own
+    # copy of the dispatch, which gives the branch predictor one indirect
+    # jump per opcode instead of a single shared one
+    emit(f, DO_EXEC_LOOP_PROLOG % d)
+    labels = []
+    for n, state in enumerate(states[:-1]):
+        labels.append("unmapped" if state == "." else "op_%02x" % n)
+    for n in range(0, len(labels), 8):
+        emit(f, "\t\t" + " ".join("&&%s," % l for l in labels[n:n+8]))
+    emit(f, DO_EXEC_LOOP_ENTRY % d)
+    for n, state in enumerate(states[:-1]):
+        if state == ".": continue
+        emit(f, DO_EXEC_LOOP_OPCODE % { "label": labels[n], "state": state })
+    if "unmapped" in labels:
+        emit(f, DO_EXEC_LOOP_UNMAPPED % d)
+    emit(f, DO_EXEC_LOOP_EPILOG % d)
+
 def save_dasm(f, device, states):
     total_states = len(states)
 
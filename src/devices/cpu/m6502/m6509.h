@@ -20,6 +20,7 @@ public:
 	virtual std::unique_ptr<util::disasm_interface> create_disassembler() override;
 	virtual void do_exec_full() override;
 	virtual void do_exec_partial() override;
+	virtual void do_exec_loop() override;
 
 protected:
 	class mi_6509 : public memory_interface {
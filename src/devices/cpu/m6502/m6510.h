@@ -27,6 +27,7 @@ public:
 	virtual std::unique_ptr<util::disasm_interface> create_disassembler() override;
 	virtual void do_exec_full() override;
 	virtual void do_exec_partial() override;
+	virtual void do_exec_loop() override;
 
 protected:
 	m6510_device(const machine_config &mconfig, device_type type, const char *tag, device_t *owner, uint32_t clock);
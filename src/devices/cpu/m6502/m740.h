@@ -47,6 +47,7 @@ public:
 	virtual std::unique_ptr<util::disasm_interface> create_disassembler() override;
 	virtual void do_exec_full() override;
 	virtual void do_exec_partial() override;
+	virtual void do_exec_loop() override;
 	virtual void execute_set_input(int inputnum, int state) override;
 
 protected:
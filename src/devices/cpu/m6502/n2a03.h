@@ -23,6 +23,7 @@ public:
 
 	virtual void do_exec_full() override;
 	virtual void do_exec_partial() override;
+	virtual void do_exec_loop() override;
 
 	uint8_t psg1_4014_r();
 	uint8_t psg1_4015_r();
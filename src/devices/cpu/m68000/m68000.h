@@ -13,6 +13,15 @@
 extern flag floatx80_is_nan(floatx80 a);
 #endif
 
+#include <deque>
+
+class drc_cache;
+class drcuml_state;
+class drcuml_block;
+struct opcode_desc;
+class m68000_frontend;
+namespace uml { class code_handle; }
+
 
 /* MMU constants */
 constexpr int MMU_ATC_ENTRIES = (22);    // 68851 has 64, 030 has 22
@@ -102,6 +111,7 @@ public:
 
 	// construction/destruction
 	m68000_base_device(const machine_config &mconfig, const char *tag, device_t *owner, u32 clock);
+	virtual ~m68000_base_device();
 
 	static constexpr u8 autovector(int level) { return 0x18 + level; }
 	void autovectors_map(address_map &map);
@@ -125,6 +135,18 @@ protected:
 	static const opcode_handler_struct m68k_opcode_table[];
 	static const u16 m68k_state_illegal;
 
+	/* Control flow class of each handler, used by the recompiler */
+	enum
+	{
+		DRC_FLOW_BRANCH = 0x01,              /* pc-relative branch with a static target */
+		DRC_FLOW_COND   = 0x02,              /* may fall through to the next instruction */
+		DRC_FLOW_JUMP   = 0x04,              /* target only known at run time */
+		DRC_FLOW_CALL   = 0x08,              /* pushes a return address */
+		DRC_FLOW_TRAP   = 0x10,              /* raises an exception */
+		DRC_FLOW_SYSTEM = 0x20               /* changes the supervisor state, the SR or the MMU */
+	};
+	static const u8 m68k_drc_flow_table[];
+
 	static void m68ki_set_one(unsigned short opcode, u16 state, const opcode_handler_struct &s);
 	static void m68ki_build_opcode_table(void);
 
@@ -372,6 +394,77 @@ protected:
 	// device_memory_interface overrides
 	virtual bool memory_translate(int space, int intention, offs_t &address) override;
 
+	/* Recompiler, see m68kdrc.cpp */
+	friend class m68000_frontend;
+
+	struct drc_core
+	{
+		u32 status;                        /* DRC_STATUS_* after calling a handler */
+	};
+
+	/* an instruction run through its interpreter handler */
+	struct drc_op
+	{
+		m68000_base_device *cpu;
+		u32 pc;
+		u32 next;                          /* pc of the following instruction */
+		u32 pref_addr;                     /* prefetch state left by the opcode fetch */
+		u16 pref_data;
+		u16 ir;
+	};
+
+	/* a compiled run of instructions, checked against memory on entry */
+	struct drc_sequence
+	{
+		m68000_base_device *cpu;
+		u32 start;
+		std::vector<u16> words;            /* opcode words the run was compiled from */
+		const void *first;                 /* host memory holding the first and last words, if any */
+		const void *last;
+		bool writable;
+	};
+
+	enum
+	{
+		DRC_STATUS_CONTINUE = 0,           /* carry on with the next compiled instruction */
+		DRC_STATUS_REDIRECT,               /* the handler changed the flow, look up the new pc */
+		DRC_STATUS_LEAVE                   /* return to the interpreter */
+	};
+
+	std::unique_ptr<drc_cache> m_drccache;
+	std::unique_ptr<drcuml_state> m_drcuml;
+	std::unique_ptr<m68000_frontend> m_drcfe;
+	drc_core *m_drccore;                   /* state shared with generated code, in near cache memory */
+	std::deque<drc_op> m_drc_ops;           /* per-instruction parameters of the compiled code */
+	std::deque<drc_sequence> m_drc_sequences;
+	bool m_drc_dirty;
+	u32 m_drc_labelnum;
+
+	uml::code_handle *m_drc_entry;
+	uml::code_handle *m_drc_nocode;
+	uml::code_handle *m_drc_out_of_cycles;
+	uml::code_handle *m_drc_redirect;
+
+	void init_drc();
+	bool drc_usable() const { return m_drcuml && !(m_t1_flag | m_t0_flag) && !m_pmmu_enabled && !m_hmmu_enabled && !(m_pc & 1); }
+	void execute_run_drc();
+	void drc_flush_cache();
+	void drc_compile_block(offs_t pc);
+	void drc_static_generate_entry_point();
+	void drc_static_generate_nocode_handler();
+	void drc_static_generate_out_of_cycles();
+	void drc_static_generate_redirect();
+	void drc_generate_sequence_check(drcuml_block &block, offs_t start, offs_t end);
+	void drc_generate_branch(drcuml_block &block, const opcode_desc &desc, s32 cycles);
+	void drc_generate_instruction(drcuml_block &block, const opcode_desc &desc);
+	void drc_generate_call_handler(drcuml_block &block, const opcode_desc &desc);
+	void drc_generate_check_cycles(drcuml_block &block, s32 cycles, offs_t nextpc);
+	void drc_generate_condition(drcuml_block &block, int cc, u32 false_label);
+	void drc_execute_op(const drc_op &op);
+	void drc_check_sequence(drc_sequence &seq);
+	static void drc_cfunc_execute_op(void *param);
+	static void drc_cfunc_check_sequence(void *param);
+
 #include "m68kcpu.h"
 #include "m68kops.h"
 #include "m68kfpu.hxx"
@@ -28,6 +28,8 @@ static const char copyright_notice[] =
 #include "debugger.h"
 #include "m68000.h"
 #include "m68kdasm.h"
+#include "m68kfe.h"
+#include "cpu/drcuml.h"
 
 // Generated data
 
@@ -890,6 +892,16 @@ void m68000_base_device::execute_run()
 		/* Main loop.  Keep going until we run out of clock cycles */
 		while (m_icount > 0)
 		{
+			/* Run compiled code while nothing needs the interpreter's attention */
+			if (drc_usable())
+			{
+				m_tracing = 0;
+				execute_run_drc();
+				if (m_address_error)
+					goto check_address_error;
+				continue;
+			}
+
 			/* Set tracing accodring to T1. (T0 is done inside instruction) */
 			m68ki_trace_t1(); /* auto-disable (see m68kcpu.h) */
 
@@ -1084,6 +1096,7 @@ void m68000_base_device::init_cpu_common(void)
 	set_icountptr(m_icount);
 	m_icount = 0;
 
+	init_drc();
 }
 
 void m68000_base_device::device_reset()
@@ -2349,6 +2362,10 @@ m68000_base_device::m68000_base_device(const machine_config &mconfig, const char
 	clear_all();
 }
 
+m68000_base_device::~m68000_base_device()
+{
+}
+
 void m68000_base_device::clear_all()
 {
 	m_cpu_type= 0;
@@ -2463,6 +2480,14 @@ void m68000_base_device::clear_all()
 	}
 
 	m_internal = nullptr;
+
+	m_drccore = nullptr;
+	m_drc_dirty = false;
+	m_drc_labelnum = 0;
+	m_drc_entry = nullptr;
+	m_drc_nocode = nullptr;
+	m_drc_out_of_cycles = nullptr;
+	m_drc_redirect = nullptr;
 }
 
 void m68000_base_device::autovectors_map(address_map &map)
@@ -0,0 +1,663 @@
+// license:BSD-3-Clause
+// copyright-holders:Karl Stenerud
+/***************************************************************************
+
+    m68kdrc.cpp
+
+    Recompiler for the 680x0 family.
+
+    Runs of instructions found by the front end are compiled to UML.
+    Branches, loops and moveq are generated directly; every other
+    instruction calls its handler from m68kops.cpp, so compiled code
+    takes exactly the interpreter's cycles and raises the same
+    exceptions.  Each run is checked against memory when it is entered,
+    which keeps banked ROM and self-modifying code working.
+
+    The interpreter takes over whenever tracing, the PMMU or the HMMU
+    is active, and the recompiler is never used under the debugger.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "m68000.h"
+#include "m68kfe.h"
+#include "cpu/drcuml.h"
+#include "cpu/drcumlsh.h"
+
+/***************************************************************************
+    CONSTANTS
+***************************************************************************/
+
+namespace {
+
+constexpr size_t CACHE_SIZE                  = 32 * 1024 * 1024;
+
+constexpr u32 COMPILE_BACKWARDS_BYTES        = 128;
+constexpr u32 COMPILE_FORWARDS_BYTES         = 512;
+constexpr u32 COMPILE_MAX_SEQUENCE           = 64;
+
+// labels for sequences that can be reached with a local jump
+constexpr u32 LABEL_PC                       = 0x80000000;
+
+// exit codes
+enum : int
+{
+	EXECUTE_OUT_OF_CYCLES       = 0,
+	EXECUTE_MISSING_CODE        = 1,
+	EXECUTE_UNMAPPED_CODE       = 2,
+	EXECUTE_RESET_CACHE         = 3
+};
+
+} // anonymous namespace
+
+
+/***************************************************************************
+    CORE EXECUTION
+***************************************************************************/
+
+/*-------------------------------------------------
+    init_drc - set up the recompiler if it's
+    allowed for this machine
+-------------------------------------------------*/
+
+void m68000_base_device::init_drc()
+{
+	// generated code can't stop for the debugger
+	if (!allow_drc() || (machine().debug_flags & DEBUG_FLAG_ENABLED))
+		return;
+
+	m_drccache = std::make_unique<drc_cache>(drc_cache::configured_size(mconfig(), CACHE_SIZE));
+	m_drccore = reinterpret_cast<drc_core *>(m_drccache->alloc_near(sizeof(drc_core)));
+	m_drccore->status = DRC_STATUS_CONTINUE;
+
+	m_drcuml = std::make_unique<drcuml_state>(*this, *m_drccache, 0, 1, 32, 1);
+	m_drcuml->symbol_add(&m_drccore->status, sizeof(m_drccore->status), "status");
+	m_drcfe = std::make_unique<m68000_frontend>(*this, COMPILE_BACKWARDS_BYTES, COMPILE_FORWARDS_BYTES, COMPILE_MAX_SEQUENCE);
+	m_drc_dirty = true;
+}
+
+
+/*-------------------------------------------------
+    execute_run_drc - run compiled code until the
+    cycles run out or the interpreter is needed
+-------------------------------------------------*/
+
+void m68000_base_device::execute_run_drc()
+{
+	if (m_drc_dirty)
+	{
+		drc_flush_cache();
+		m_drc_dirty = false;
+	}
+
+	int execute_result;
+	do
+	{
+		execute_result = m_drcuml->execute(*m_drc_entry);
+
+		if (execute_result == EXECUTE_MISSING_CODE)
+			drc_compile_block(m_pc);
+		else if (execute_result == EXECUTE_UNMAPPED_CODE)
+			fatalerror("%s: Attempted to execute unmapped code at PC=%08X\n", tag(), m_pc);
+		else if (execute_result == EXECUTE_RESET_CACHE)
+			drc_flush_cache();
+	} while (execute_result != EXECUTE_OUT_OF_CYCLES);
+}
+
+
+/***************************************************************************
+    C FUNCTION CALLBACKS
+***************************************************************************/
+
+/*-------------------------------------------------
+    drc_execute_op - run one instruction through
+    its interpreter handler
+-------------------------------------------------*/
+
+void m68000_base_device::drc_execute_op(const drc_op &op)
+{
+	// recreate what the interpreter's opcode fetch leaves behind
+	m_ppc = op.pc;
+	m_pc = op.pc + 2;
+	m_ir = op.ir;
+	m_pref_addr = op.pref_addr;
+	m_pref_data = op.pref_data;
+	m_run_mode = RUN_MODE_NORMAL;
+
+	try
+	{
+		(this->*m68k_handler_table[m_state_table[m_ir]])();
+		m_icount -= m_cyc_instruction[m_ir];
+	}
+	catch (int error)
+	{
+		if (error != 10)
+			throw;
+		m_address_error = 1;
+	}
+
+	if (m_address_error || m_icount <= 0 || !drc_usable())
+		m_drccore->status = DRC_STATUS_LEAVE;
+	else if (m_pc != op.next)
+		m_drccore->status = DRC_STATUS_REDIRECT;
+	else
+		m_drccore->status = DRC_STATUS_CONTINUE;
+}
+
+void m68000_base_device::drc_cfunc_execute_op(void *param)
+{
+	const drc_op &op = *reinterpret_cast<const drc_op *>(param);
+	op.cpu->drc_execute_op(op);
+}
+
+
+/*-------------------------------------------------
+    drc_check_sequence - make sure the memory a
+    sequence was compiled from hasn't changed
+-------------------------------------------------*/
+
+void m68000_base_device::drc_check_sequence(drc_sequence &seq)
+{
+	offs_t const mask = m_oprogram->addrmask();
+	offs_t const lastpc = seq.start + (seq.words.size() - 1) * 2;
+	const void *const first = m_oprogram->get_read_ptr(seq.start & mask);
+	const void *const last = m_oprogram->get_read_ptr(lastpc & mask);
+	m_drccore->status = DRC_STATUS_CONTINUE;
+
+	// read-only memory still mapped at the same place can't have changed
+	if (!seq.writable && first && first == seq.first && last == seq.last)
+		return;
+
+	for (size_t i = 0; i < seq.words.size(); i++)
+	{
+		if (m_readimm16(seq.start + i * 2) != seq.words[i])
+		{
+			m_drccore->status = DRC_STATUS_REDIRECT;
+			return;
+		}
+	}
+
+	// the same code in another bank is fine too
+	seq.first = first;
+	seq.last = last;
+}
+
+void m68000_base_device::drc_cfunc_check_sequence(void *param)
+{
+	drc_sequence &seq = *reinterpret_cast<drc_sequence *>(param);
+	seq.cpu->drc_check_sequence(seq);
+}
+
+
+/***************************************************************************
+    CACHE MANAGEMENT
+***************************************************************************/
+
+/*-------------------------------------------------
+    drc_flush_cache - flush the cache and
+    regenerate static code
+-------------------------------------------------*/
+
+void m68000_base_device::drc_flush_cache()
+{
+	m_drcuml->reset();
+	m_drc_ops.clear();
+	m_drc_sequences.clear();
+
+	try
+	{
+		drc_static_generate_entry_point();
+		drc_static_generate_nocode_handler();
+		drc_static_generate_out_of_cycles();
+		drc_static_generate_redirect();
+	}
+	catch (drcuml_block::abort_compilation &)
+	{
+		fatalerror("%s: Unable to generate static 680x0 code\n", tag());
+	}
+}
+
+
+/*-------------------------------------------------
+    drc_compile_block - compile a block starting
+    at the specified pc
+-------------------------------------------------*/
+
+void m68000_base_device::drc_compile_block(offs_t pc)
+{
+	bool override = false;
+
+	g_profiler.start(PROFILER_DRC_COMPILE);
+
+	// get a description of this sequence
+	const opcode_desc *const desclist = m_drcfe->describe_code(pc);
+
+	bool succeeded = false;
+	while (!succeeded)
+	{
+		try
+		{
+			drcuml_block &block(m_drcuml->begin_block(1024 * 8));
+			m_drc_labelnum = 1;
+
+			// loop until we get through all instruction sequences
+			const opcode_desc *seqlast;
+			for (const opcode_desc *seqhead = desclist; seqhead != nullptr; seqhead = seqlast->next())
+			{
+				if (m_drcuml->logging())
+					block.append_comment("-------------------------");
+
+				// determine the last instruction in this sequence
+				for (seqlast = seqhead; seqlast != nullptr; seqlast = seqlast->next())
+					if (seqlast->flags & OPFLAG_END_SEQUENCE)
+						break;
+				assert(seqlast != nullptr);
+
+				// if we don't have a hash for this pc, or if we are overriding all, add one
+				if (override || !m_drcuml->hash_exists(0, seqhead->pc))
+					UML_HASH(block, 0, seqhead->pc);
+
+				// if we already have a hash, and this is the first sequence, assume that we
+				// are recompiling because the code changed and allow future overrides
+				else if (seqhead == desclist)
+				{
+					override = true;
+					UML_HASH(block, 0, seqhead->pc);
+				}
+
+				// otherwise, redispatch to that fixed pc and skip the rest of the processing
+				else
+				{
+					UML_LABEL(block, seqhead->pc | LABEL_PC);
+					UML_HASHJMP(block, 0, seqhead->pc, *m_drc_nocode);
+					continue;
+				}
+
+				offs_t const nextpc = seqlast->pc + seqlast->length;
+				drc_generate_sequence_check(block, seqhead->pc, nextpc);
+
+				// label this sequence, if it may be jumped to locally
+				if (seqhead->flags & OPFLAG_IS_BRANCH_TARGET)
+					UML_LABEL(block, seqhead->pc | LABEL_PC);
+
+				for (const opcode_desc *curdesc = seqhead; curdesc != seqlast->next(); curdesc = curdesc->next())
+					drc_generate_instruction(block, *curdesc);
+
+				// if the next sequence doesn't follow on, go through the hash table
+				if (seqlast->next() == nullptr || seqlast->next()->pc != nextpc)
+					UML_HASHJMP(block, 0, nextpc, *m_drc_nocode);
+			}
+
+			block.end();
+			g_profiler.stop();
+			succeeded = true;
+		}
+		catch (drcuml_block::abort_compilation &)
+		{
+			drc_flush_cache();
+		}
+	}
+}
+
+
+/***************************************************************************
+    STATIC CODEGEN
+***************************************************************************/
+
+/*-------------------------------------------------
+    alloc_handle - allocate a handle if not
+    already allocated
+-------------------------------------------------*/
+
+static inline void alloc_handle(drcuml_state &drcuml, uml::code_handle *&handleptr, const char *name)
+{
+	if (!handleptr)
+		handleptr = drcuml.handle_alloc(name);
+}
+
+
+/*-------------------------------------------------
+    drc_static_generate_entry_point - generate a
+    static entry point
+-------------------------------------------------*/
+
+void m68000_base_device::drc_static_generate_entry_point()
+{
+	drcuml_block &block(m_drcuml->begin_block(20));
+
+	// forward references
+	alloc_handle(*m_drcuml, m_drc_nocode, "nocode");
+
+	alloc_handle(*m_drcuml, m_drc_entry, "entry");
+	UML_HANDLE(block, *m_drc_entry);
+
+	UML_LOAD(block, I0, &m_pc, 0, SIZE_DWORD, SCALE_x4);
+	UML_HASHJMP(block, 0, I0, *m_drc_nocode);
+
+	block.end();
+}
+
+
+/*-------------------------------------------------
+    drc_static_generate_nocode_handler - generate
+    an exception handler for "out of code"
+-------------------------------------------------*/
+
+void m68000_base_device::drc_static_generate_nocode_handler()
+{
+	drcuml_block &block(m_drcuml->begin_block(10));
+
+	alloc_handle(*m_drcuml, m_drc_nocode, "nocode");
+	UML_HANDLE(block, *m_drc_nocode);
+	UML_GETEXP(block, I0);
+	UML_STORE(block, &m_pc, 0, I0, SIZE_DWORD, SCALE_x4);
+	UML_EXIT(block, EXECUTE_MISSING_CODE);
+
+	block.end();
+}
+
+
+/*-------------------------------------------------
+    drc_static_generate_out_of_cycles - generate
+    an out of cycles exception handler
+-------------------------------------------------*/
+
+void m68000_base_device::drc_static_generate_out_of_cycles()
+{
+	drcuml_block &block(m_drcuml->begin_block(10));
+
+	alloc_handle(*m_drcuml, m_drc_out_of_cycles, "out_of_cycles");
+	UML_HANDLE(block, *m_drc_out_of_cycles);
+	UML_GETEXP(block, I0);
+	UML_STORE(block, &m_pc, 0, I0, SIZE_DWORD, SCALE_x4);
+	UML_EXIT(block, EXECUTE_OUT_OF_CYCLES);
+
+	block.end();
+}
+
+
+/*-------------------------------------------------
+    drc_static_generate_redirect - generate the
+    handler taken when an interpreted instruction
+    didn't fall through to the next one
+-------------------------------------------------*/
+
+void m68000_base_device::drc_static_generate_redirect()
+{
+	drcuml_block &block(m_drcuml->begin_block(20));
+
+	alloc_handle(*m_drcuml, m_drc_nocode, "nocode");
+
+	alloc_handle(*m_drcuml, m_drc_redirect, "redirect");
+	UML_HANDLE(block, *m_drc_redirect);
+
+	// the handler has already updated the pc
+	UML_CMP(block, mem(&m_drccore->status), DRC_STATUS_REDIRECT);
+	UML_EXITc(block, uml::COND_NE, EXECUTE_OUT_OF_CYCLES);
+	UML_LOAD(block, I0, &m_pc, 0, SIZE_DWORD, SCALE_x4);
+	UML_HASHJMP(block, 0, I0, *m_drc_nocode);
+
+	block.end();
+}
+
+
+/***************************************************************************
+    CODE GENERATION
+***************************************************************************/
+
+/*-------------------------------------------------
+    drc_generate_sequence_check - check a sequence
+    against memory before running it
+-------------------------------------------------*/
+
+void m68000_base_device::drc_generate_sequence_check(drcuml_block &block, offs_t start, offs_t end)
+{
+	offs_t const mask = m_oprogram->addrmask();
+	offs_t const lastpc = end - 2;
+
+	m_drc_sequences.emplace_back();
+	drc_sequence &seq = m_drc_sequences.back();
+	seq.cpu = this;
+	seq.start = start;
+	for (offs_t pc = start; pc != end; pc += 2)
+		seq.words.push_back(m_readimm16(pc));
+	seq.first = m_oprogram->get_read_ptr(start & mask);
+	seq.last = m_oprogram->get_read_ptr(lastpc & mask);
+	seq.writable = m_oprogram->get_write_ptr(start & mask) || m_oprogram->get_write_ptr(lastpc & mask)
+			|| m_program->get_write_ptr(start & mask) || m_program->get_write_ptr(lastpc & mask);
+
+	UML_CALLC(block, &drc_cfunc_check_sequence, &seq);
+	UML_CMP(block, mem(&m_drccore->status), DRC_STATUS_CONTINUE);
+	UML_EXHc(block, uml::COND_NE, *m_drc_nocode, start);
+}
+
+
+/*-------------------------------------------------
+    drc_generate_check_cycles - charge an
+    instruction's cycles and leave once they've
+    run out
+-------------------------------------------------*/
+
+void m68000_base_device::drc_generate_check_cycles(drcuml_block &block, s32 cycles, offs_t nextpc)
+{
+	UML_LOAD(block, I0, &m_icount, 0, SIZE_DWORD, SCALE_x4);
+	UML_SUB(block, I0, I0, cycles);
+	UML_STORE(block, &m_icount, 0, I0, SIZE_DWORD, SCALE_x4);
+	UML_CMP(block, I0, 0);
+	UML_EXHc(block, uml::COND_LE, *m_drc_out_of_cycles, nextpc);
+}
+
+
+/*-------------------------------------------------
+    drc_generate_condition - jump to a label if a
+    condition code test fails; cc ^ 1 is always
+    the opposite test
+-------------------------------------------------*/
+
+void m68000_base_device::drc_generate_condition(drcuml_block &block, int cc, u32 false_label)
+{
+	switch (cc)
+	{
+	case 2: // hi
+	case 3: // ls
+		UML_LOAD(block, I0, &m_c_flag, 0, SIZE_DWORD, SCALE_x4);
+		UML_TEST(block, I0, 0x100);
+		UML_SETc(block, uml::COND_NZ, I1);
+		UML_LOAD(block, I0, &m_not_z_flag, 0, SIZE_DWORD, SCALE_x4);
+		UML_CMP(block, I0, 0);
+		UML_SETc(block, uml::COND_E, I0);
+		UML_OR(block, I0, I0, I1);
+		UML_CMP(block, I0, 0);
+		UML_JMPc(block, (cc == 2) ? uml::COND_NE : uml::COND_E, false_label);
+		break;
+
+	case 4: // cc
+	case 5: // cs
+		UML_LOAD(block, I0, &m_c_flag, 0, SIZE_DWORD, SCALE_x4);
+		UML_TEST(block, I0, 0x100);
+		UML_JMPc(block, (cc == 4) ? uml::COND_NZ : uml::COND_Z, false_label);
+		break;
+
+	case 6: // ne
+	case 7: // eq
+		UML_LOAD(block, I0, &m_not_z_flag, 0, SIZE_DWORD, SCALE_x4);
+		UML_CMP(block, I0, 0);
+		UML_JMPc(block, (cc == 6) ? uml::COND_E : uml::COND_NE, false_label);
+		break;
+
+	case 8: // vc
+	case 9: // vs
+		UML_LOAD(block, I0, &m_v_flag, 0, SIZE_DWORD, SCALE_x4);
+		UML_TEST(block, I0, 0x80);
+		UML_JMPc(block, (cc == 8) ? uml::COND_NZ : uml::COND_Z, false_label);
+		break;
+
+	case 10: // pl
+	case 11: // mi
+		UML_LOAD(block, I0, &m_n_flag, 0, SIZE_DWORD, SCALE_x4);
+		UML_TEST(block, I0, 0x80);
+		UML_JMPc(block, (cc == 10) ? uml::COND_NZ : uml::COND_Z, false_label);
+		break;
+
+	case 12: // ge
+	case 13: // lt
+		UML_LOAD(block, I0, &m_n_flag, 0, SIZE_DWORD, SCALE_x4);
+		UML_LOAD(block, I1, &m_v_flag, 0, SIZE_DWORD, SCALE_x4);
+		UML_XOR(block, I0, I0, I1);
+		UML_TEST(block, I0, 0x80);
+		UML_JMPc(block, (cc == 12) ? uml::COND_NZ : uml::COND_Z, false_label);
+		break;
+
+	case 14: // gt
+	case 15: // le
+		UML_LOAD(block, I0, &m_n_flag, 0, SIZE_DWORD, SCALE_x4);
+		UML_LOAD(block, I1, &m_v_flag, 0, SIZE_DWORD, SCALE_x4);
+		UML_XOR(block, I0, I0, I1);
+		UML_TEST(block, I0, 0x80);
+		UML_SETc(block, uml::COND_NZ, I1);
+		UML_LOAD(block, I0, &m_not_z_flag, 0, SIZE_DWORD, SCALE_x4);
+		UML_CMP(block, I0, 0);
+		UML_SETc(block, uml::COND_E, I0);
+		UML_OR(block, I0, I0, I1);
+		UML_CMP(block, I0, 0);
+		UML_JMPc(block, (cc == 14) ? uml::COND_NE : uml::COND_E, false_label);
+		break;
+
+	default:
+		throw emu_fatalerror("m68000_base_device::drc_generate_condition: unexpected condition %d", cc);
+	}
+}
+
+
+/*-------------------------------------------------
+    drc_generate_branch - charge the cycles of a
+    taken branch and jump to its target
+-------------------------------------------------*/
+
+void m68000_base_device::drc_generate_branch(drcuml_block &block, const opcode_desc &desc, s32 cycles)
+{
+	drc_generate_check_cycles(block, cycles, desc.targetpc);
+	if (desc.flags & OPFLAG_INTRABLOCK_BRANCH)
+		UML_JMP(block, desc.targetpc | LABEL_PC);
+	else
+		UML_HASHJMP(block, 0, desc.targetpc, *m_drc_nocode);
+}
+
+
+/*-------------------------------------------------
+    drc_generate_call_handler - call the
+    interpreter handler for an instruction
+-------------------------------------------------*/
+
+void m68000_base_device::drc_generate_call_handler(drcuml_block &block, const opcode_desc &desc)
+{
+	m_drc_ops.emplace_back();
+	drc_op &op = m_drc_ops.back();
+	op.cpu = this;
+	op.pc = desc.pc;
+	op.next = desc.pc + desc.length;
+	op.ir = desc.opptr.w[0];
+
+	// one-word instructions leave the next opcode in the prefetch, so
+	// make the interpreter fetch that itself
+	op.pref_addr = (desc.length > 2) ? desc.pc + 2 : ~0U;
+	op.pref_data = desc.opptr.w[1];
+
+	UML_CALLC(block, &drc_cfunc_execute_op, &op);
+	UML_CMP(block, mem(&m_drccore->status), DRC_STATUS_CONTINUE);
+	UML_EXHc(block, uml::COND_NE, *m_drc_redirect, op.next);
+}
+
+
+/*-------------------------------------------------
+    drc_generate_instruction - generate code for
+    one instruction
+-------------------------------------------------*/
+
+void m68000_base_device::drc_generate_instruction(drcuml_block &block, const opcode_desc &desc)
+{
+	u16 const op = desc.opptr.w[0];
+	u16 const state = m_state_table[op];
+	u8 const flow = m68k_drc_flow_table[state];
+	s32 const cycles = m_cyc_instruction[op];
+	offs_t const nextpc = desc.pc + desc.length;
+	int const cc = (op >> 8) & 15;
+
+	if (state == m68k_state_illegal)
+	{
+		drc_generate_call_handler(block, desc);
+		return;
+	}
+
+	// moveq
+	if ((op & 0xf100) == 0x7000)
+	{
+		u32 const res = u32(s32(s8(op & 0xff)));
+		UML_STORE(block, &m_dar[(op >> 9) & 7], 0, res, SIZE_DWORD, SCALE_x4);
+		UML_STORE(block, &m_n_flag, 0, res >> 24, SIZE_DWORD, SCALE_x4);
+		UML_STORE(block, &m_not_z_flag, 0, res, SIZE_DWORD, SCALE_x4);
+		UML_STORE(block, &m_v_flag, 0, 0, SIZE_DWORD, SCALE_x4);
+		UML_STORE(block, &m_c_flag, 0, 0, SIZE_DWORD, SCALE_x4);
+		drc_generate_check_cycles(block, cycles, nextpc);
+		return;
+	}
+
+	// nop and dbt only take time
+	if (op == 0x4e71 || (op & 0xfff8) == 0x50c8)
+	{
+		drc_generate_check_cycles(block, cycles, nextpc);
+		return;
+	}
+
+	// odd targets and bsr are left to the handlers
+	if (!(flow & DRC_FLOW_BRANCH) || (flow & DRC_FLOW_CALL) || desc.targetpc == BRANCH_TARGET_DYNAMIC)
+	{
+		drc_generate_call_handler(block, desc);
+		return;
+	}
+
+	// bra and bcc
+	if ((op & 0xf000) == 0x6000)
+	{
+		if (!(flow & DRC_FLOW_COND))
+		{
+			drc_generate_branch(block, desc, cycles);
+			return;
+		}
+
+		u32 const not_taken = m_drc_labelnum++;
+		drc_generate_condition(block, cc, not_taken);
+		drc_generate_branch(block, desc, cycles);
+
+		UML_LABEL(block, not_taken);
+		s32 const extra = (desc.length == 2) ? s32(m_cyc_bcc_notake_b) : (desc.length == 4) ? s32(m_cyc_bcc_notake_w) : 0;
+		drc_generate_check_cycles(block, cycles + extra, nextpc);
+		return;
+	}
+
+	// dbf and dbcc
+	u32 const done = m_drc_labelnum++;
+	u32 const expired = m_drc_labelnum++;
+	u32 *const reg = &m_dar[op & 7];
+
+	if (cc != 1)
+		drc_generate_condition(block, cc ^ 1, done);
+
+	UML_LOAD(block, I0, reg, 0, SIZE_DWORD, SCALE_x4);
+	UML_SUB(block, I1, I0, 1);
+	UML_AND(block, I1, I1, 0xffff);
+	UML_AND(block, I0, I0, 0xffff0000);
+	UML_OR(block, I0, I0, I1);
+	UML_STORE(block, reg, 0, I0, SIZE_DWORD, SCALE_x4);
+	UML_CMP(block, I1, 0xffff);
+	UML_JMPc(block, uml::COND_E, expired);
+	drc_generate_branch(block, desc, cycles + s32(m_cyc_dbcc_f_noexp));
+
+	UML_LABEL(block, expired);
+	UML_LOAD(block, I0, &m_icount, 0, SIZE_DWORD, SCALE_x4);
+	UML_SUB(block, I0, I0, s32(m_cyc_dbcc_f_exp));
+	UML_STORE(block, &m_icount, 0, I0, SIZE_DWORD, SCALE_x4);
+
+	UML_LABEL(block, done);
+	drc_generate_check_cycles(block, cycles, nextpc);
+}
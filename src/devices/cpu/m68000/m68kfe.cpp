@@ -0,0 +1,97 @@
+// license:BSD-3-Clause
+// copyright-holders:Karl Stenerud
+/***************************************************************************
+
+    m68kfe.cpp
+
+    Front end for the 680x0 recompiler.  Control flow comes from the
+    table m68kmake.py builds alongside the interpreter's handler table,
+    so the two can't disagree about what an opcode is.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "m68kfe.h"
+
+#include <algorithm>
+
+
+m68000_frontend::m68000_frontend(m68000_base_device &cpu, u32 window_start, u32 window_end, u32 max_sequence)
+	: drc_frontend(cpu, window_start, window_end, max_sequence)
+	, m_cpu(cpu)
+	, m_dasm(cpu.create_disassembler())
+	, m_opcodes(cpu.m_readimm16)
+{
+}
+
+
+/*-------------------------------------------------
+    describe - build a description of a single
+    instruction
+-------------------------------------------------*/
+
+bool m68000_frontend::describe(opcode_desc &desc, const opcode_desc *prev)
+{
+	u16 const op = m_cpu.m_readimm16(desc.physpc);
+	u8 const flow = m68000_base_device::m68k_drc_flow_table[m_cpu.m_state_table[op]];
+
+	// the disassembler knows how many extension words each addressing mode takes
+	m_discard.str("");
+	offs_t const length = m_dasm->disassemble(m_discard, desc.pc, m_opcodes, m_opcodes) & util::disasm_interface::LENGTHMASK;
+	desc.length = std::min<offs_t>(std::max<offs_t>(length & ~1, 2), 22);
+	for (int i = 0; i < std::min<int>(desc.length / 2, ARRAY_LENGTH(desc.opptr.w)); i++)
+		desc.opptr.w[i] = m_cpu.m_readimm16(desc.physpc + i * 2);
+	desc.cycles = m_cpu.m_cyc_instruction[op];
+
+	if (flow & m68000_base_device::DRC_FLOW_BRANCH)
+	{
+		desc.targetpc = branch_target(desc);
+		if (flow & m68000_base_device::DRC_FLOW_COND)
+			desc.flags |= OPFLAG_IS_CONDITIONAL_BRANCH;
+		else
+			desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE;
+	}
+	else if (flow & m68000_base_device::DRC_FLOW_JUMP)
+	{
+		if (flow & m68000_base_device::DRC_FLOW_COND)
+			desc.flags |= OPFLAG_IS_CONDITIONAL_BRANCH;
+		else
+			desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE;
+	}
+
+	if (flow & m68000_base_device::DRC_FLOW_TRAP)
+	{
+		desc.flags |= OPFLAG_CAN_CAUSE_EXCEPTION;
+		if (!(flow & m68000_base_device::DRC_FLOW_COND))
+			desc.flags |= OPFLAG_WILL_CAUSE_EXCEPTION | OPFLAG_END_SEQUENCE;
+	}
+
+	// anything touching the SR may unmask an interrupt or change the mode
+	if (flow & m68000_base_device::DRC_FLOW_SYSTEM)
+		desc.flags |= OPFLAG_CAN_CHANGE_MODES | OPFLAG_END_SEQUENCE;
+
+	return true;
+}
+
+
+/*-------------------------------------------------
+    branch_target - work out where a bra, bsr,
+    bcc or dbcc goes
+-------------------------------------------------*/
+
+offs_t m68000_frontend::branch_target(const opcode_desc &desc) const
+{
+	u16 const op = desc.opptr.w[0];
+	offs_t const base = desc.pc + 2;
+	offs_t target;
+
+	if ((op & 0xf0f8) == 0x50c8 || (op & 0xff) == 0x00)
+		target = base + s16(desc.opptr.w[1]);
+	else if ((op & 0xff) == 0xff && desc.length == 6)
+		target = base + s32((u32(desc.opptr.w[1]) << 16) | desc.opptr.w[2]);
+	else
+		target = base + s8(op & 0xff);
+
+	// odd targets raise an address error, which is left to the handler
+	return (target & 1) ? BRANCH_TARGET_DYNAMIC : target;
+}
@@ -0,0 +1,55 @@
+// license:BSD-3-Clause
+// copyright-holders:Karl Stenerud
+/***************************************************************************
+
+    m68kfe.h
+
+    Front end for the 680x0 recompiler
+
+***************************************************************************/
+
+#ifndef MAME_CPU_M68000_M68KFE_H
+#define MAME_CPU_M68000_M68KFE_H
+
+#pragma once
+
+#include "m68000.h"
+#include "cpu/drcfe.h"
+
+#include <sstream>
+
+
+class m68000_frontend : public drc_frontend
+{
+public:
+	m68000_frontend(m68000_base_device &cpu, u32 window_start, u32 window_end, u32 max_sequence);
+
+protected:
+	// required overrides
+	virtual bool describe(opcode_desc &desc, const opcode_desc *prev) override;
+
+private:
+	// feeds the disassembler the same words the interpreter fetches
+	class opcode_buffer : public util::disasm_interface::data_buffer
+	{
+	public:
+		opcode_buffer(const std::function<u16 (offs_t)> &readimm16) : m_readimm16(readimm16) { }
+
+		virtual u8  r8 (offs_t pc) const override { return m_readimm16(pc & ~1) >> ((~pc & 1) * 8); }
+		virtual u16 r16(offs_t pc) const override { return m_readimm16(pc); }
+		virtual u32 r32(offs_t pc) const override { return (u32(r16(pc)) << 16) | r16(pc + 2); }
+		virtual u64 r64(offs_t pc) const override { return (u64(r32(pc)) << 32) | r32(pc + 4); }
+
+	private:
+		const std::function<u16 (offs_t)> &m_readimm16;
+	};
+
+	offs_t branch_target(const opcode_desc &desc) const;
+
+	m68000_base_device &m_cpu;
+	std::unique_ptr<util::disasm_interface> m_dasm;    // used to size instructions
+	opcode_buffer m_opcodes;
+	std::ostringstream m_discard;
+};
+
+#endif // MAME_CPU_M68000_M68KFE_H
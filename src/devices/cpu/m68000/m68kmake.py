@@ -23,6 +23,68 @@ cpu_names = '071234fc'
 cc_table_up = [ "T", "F", "HI", "LS", "CC", "CS", "NE", "EQ", "VC", "VS", "PL", "MI", "GE", "LT", "GT", "LE" ]
 cc_table_dn = [ "t", "f", "hi", "ls", "cc", "cs", "ne", "eq", "vc", "vs", "pl", "mi", "ge", "lt", "gt", "le" ]
 
+# Control flow classes for the recompiler, must match DRC_FLOW_* in m68000.h
+DRC_FLOW_BRANCH = 0x01  # pc-relative branch with a static target
+DRC_FLOW_COND   = 0x02  # may fall through to the next instruction
+DRC_FLOW_JUMP   = 0x04  # target only known at run time
+DRC_FLOW_CALL   = 0x08  # pushes a return address
+DRC_FLOW_TRAP   = 0x10  # raises an exception
+DRC_FLOW_SYSTEM = 0x20  # changes the supervisor state, the SR or the MMU
+
+drc_flow_names = {
+    'bra'      : DRC_FLOW_BRANCH,
+    'bsr'      : DRC_FLOW_BRANCH | DRC_FLOW_CALL,
+    'dbf'      : DRC_FLOW_BRANCH | DRC_FLOW_COND,
+    'dbt'      : 0,
+    'jmp'      : DRC_FLOW_JUMP,
+    'jsr'      : DRC_FLOW_JUMP | DRC_FLOW_CALL,
+    'callm'    : DRC_FLOW_JUMP | DRC_FLOW_CALL,
+    'rts'      : DRC_FLOW_JUMP,
+    'rtr'      : DRC_FLOW_JUMP,
+    'rtd'      : DRC_FLOW_JUMP,
+    'rtm'      : DRC_FLOW_JUMP,
+    'rte'      : DRC_FLOW_JUMP | DRC_FLOW_SYSTEM,
+    'trap'     : DRC_FLOW_TRAP,
+    'trapt'    : DRC_FLOW_TRAP,
+    'illegal'  : DRC_FLOW_TRAP,
+    '1010'     : DRC_FLOW_TRAP,
+    '1111'     : DRC_FLOW_TRAP,
+    'bkpt'     : DRC_FLOW_TRAP,
+    'trapv'    : DRC_FLOW_TRAP | DRC_FLOW_COND,
+    'chk'      : DRC_FLOW_TRAP | DRC_FLOW_COND,
+    'chk2cmp2' : DRC_FLOW_TRAP | DRC_FLOW_COND,
+    'cptrapcc' : DRC_FLOW_TRAP | DRC_FLOW_COND,
+    'ftrapcc'  : DRC_FLOW_TRAP | DRC_FLOW_COND,
+    'cpbcc'    : DRC_FLOW_JUMP | DRC_FLOW_COND,
+    'cpdbcc'   : DRC_FLOW_JUMP | DRC_FLOW_COND,
+    'stop'     : DRC_FLOW_SYSTEM,
+    'reset'    : DRC_FLOW_SYSTEM,
+    'movec'    : DRC_FLOW_SYSTEM,
+    'moves'    : DRC_FLOW_SYSTEM,
+    'pmmu'     : DRC_FLOW_SYSTEM,
+    'pflusha'  : DRC_FLOW_SYSTEM,
+    'pflushan' : DRC_FLOW_SYSTEM,
+    'ptest'    : DRC_FLOW_SYSTEM,
+    'cinv'     : DRC_FLOW_SYSTEM,
+    'cpush'    : DRC_FLOW_SYSTEM,
+    '040fpu0'  : DRC_FLOW_SYSTEM,
+    '040fpu1'  : DRC_FLOW_SYSTEM,
+}
+
+def drc_flow(name, op_value):
+    if name in drc_flow_names:
+        return drc_flow_names[name]
+    # condition code variants, e.g. bhi, dbne, traplt
+    base = name[:-2]
+    if base == 'b' or base == 'db':
+        return DRC_FLOW_BRANCH | DRC_FLOW_COND
+    if base == 'trap':
+        return DRC_FLOW_TRAP | DRC_FLOW_COND
+    # move to sr, move usp and the immediate logic ops on sr
+    if (op_value & 0xffc0) == 0x46c0 or (op_value & 0xfff0) == 0x4e60 or op_value in (0x027c, 0x0a7c, 0x007c):
+        return DRC_FLOW_SYSTEM
+    return 0
+
 
 # Probably incorrect starting with the 030 and further
 #
@@ -199,6 +261,7 @@ class OpcodeHandler:
                 self.cycles[i] = op.cycles[i] + ea_cycle_table[ea_mode][i][size_order]
         self.op_value = op.op_value | ea_info_table[ea_mode][2]
         self.op_mask  = op.op_mask  | ea_info_table[ea_mode][1]
+        self.drc_flow = drc_flow(op.name, self.op_value)
         self.function_name = 'x%04x_%s%s%s_' % (self.op_value, op.name, '' if op.size == '.' else '_' + op.size, '' if ea_mode == 'none' else '_' + ea_mode)
         for i in range(0, CPU_COUNT):
             if self.cycles[i] != None:
@@ -282,7 +345,12 @@ class Info:
                     f.write(", ")
                 f.write("%3d" % (255 if oh.cycles[i] == None else oh.cycles[i]))
             f.write("}},\n")
-        f.write("\t{ 0, 0, {0, 0, 0, 0, 0}}\n};\n")
+        f.write("\t{ 0, 0, {0, 0, 0, 0, 0}}\n};\n\n")
+        f.write("const u8 m68000_base_device::m68k_drc_flow_table[] =\n{\n\n")
+        for id in order:
+            oh = self.opcode_handlers[id]
+            f.write("\t0x%02x, // %s\n" % (oh.drc_flow, oh.function_name))
+        f.write("};\n")
 
 def main(argv):
     if len(argv) != 4:
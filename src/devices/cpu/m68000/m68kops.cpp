@@ -35405,3 +35405,2058 @@ const m68000_base_device::opcode_handler_struct m68000_base_device::m68k_opcode_
 	{ 0xeff9, 0xffff, {255, 255, 255,  21,  21,  21,  21,  17}},
 	{ 0, 0, {0, 0, 0, 0, 0}}
 };
+
+const u8 m68000_base_device::m68k_drc_flow_table[] =
+{
+
+	0x10, // xa000_1010_071234fc
+	0x10, // xf000_1111_071234fc
+	0x00, // x7000_moveq_l_071234fc
+	0x06, // xf080_cpbcc_l_23
+	0x00, // xf000_cpgen_l_23
+	0x00, // xf040_cpscc_l_23
+	0x20, // xf000_pmmu_l_234fc
+	0x01, // x6000_bra_b_071234fc
+	0x09, // x6100_bsr_b_071234fc
+	0x03, // x6200_bhi_b_071234fc
+	0x03, // x6300_bls_b_071234fc
+	0x03, // x6400_bcc_b_071234fc
+	0x03, // x6500_bcs_b_071234fc
+	0x03, // x6600_bne_b_071234fc
+	0x03, // x6700_beq_b_071234fc
+	0x03, // x6800_bvc_b_071234fc
+	0x03, // x6900_bvs_b_071234fc
+	0x03, // x6a00_bpl_b_071234fc
+	0x03, // x6b00_bmi_b_071234fc
+	0x03, // x6c00_bge_b_071234fc
+	0x03, // x6d00_blt_b_071234fc
+	0x03, // x6e00_bgt_b_071234fc
+	0x03, // x6f00_ble_b_071234fc
+	0x20, // xf200_040fpu0_l_234f
+	0x20, // xf300_040fpu1_l_234f
+	0x20, // xf400_cinv_l_4
+	0x20, // xf420_cpush_l_4
+	0x00, // x0100_btst_l_071234fc
+	0x00, // x0108_movep_w_071234fc
+	0x00, // x0110_btst_b_ai_071234fc
+	0x00, // x0118_btst_b_pi_071234fc
+	0x00, // x0120_btst_b_pd_071234fc
+	0x00, // x0128_btst_b_di_071234fc
+	0x00, // x0130_btst_b_ix_071234fc
+	0x00, // x0140_bchg_l_071234fc
+	0x00, // x0148_movep_l_071234fc
+	0x00, // x0150_bchg_b_ai_071234fc
+	0x00, // x0158_bchg_b_pi_071234fc
+	0x00, // x0160_bchg_b_pd_071234fc
+	0x00, // x0168_bchg_b_di_071234fc
+	0x00, // x0170_bchg_b_ix_071234fc
+	0x00, // x0180_bclr_l_071234fc
+	0x00, // x0188_movep_w_071234fc
+	0x00, // x0190_bclr_b_ai_071234fc
+	0x00, // x0198_bclr_b_pi_071234fc
+	0x00, // x01a0_bclr_b_pd_071234fc
+	0x00, // x01a8_bclr_b_di_071234fc
+	0x00, // x01b0_bclr_b_ix_071234fc
+	0x00, // x01c0_bset_l_071234fc
+	0x00, // x01c8_movep_l_071234fc
+	0x00, // x01d0_bset_b_ai_071234fc
+	0x00, // x01d8_bset_b_pi_071234fc
+	0x00, // x01e0_bset_b_pd_071234fc
+	0x00, // x01e8_bset_b_di_071234fc
+	0x00, // x01f0_bset_b_ix_071234fc
+	0x00, // x1000_move_b_071234fc
+	0x00, // x1010_move_b_ai_071234fc
+	0x00, // x1018_move_b_pi_071234fc
+	0x00, // x1020_move_b_pd_071234fc
+	0x00, // x1028_move_b_di_071234fc
+	0x00, // x1030_move_b_ix_071234fc
+	0x00, // x1080_move_b_071234fc
+	0x00, // x1090_move_b_ai_071234fc
+	0x00, // x1098_move_b_pi_071234fc
+	0x00, // x10a0_move_b_pd_071234fc
+	0x00, // x10a8_move_b_di_071234fc
+	0x00, // x10b0_move_b_ix_071234fc
+	0x00, // x10c0_move_b_071234fc
+	0x00, // x10d0_move_b_ai_071234fc
+	0x00, // x10d8_move_b_pi_071234fc
+	0x00, // x10e0_move_b_pd_071234fc
+	0x00, // x10e8_move_b_di_071234fc
+	0x00, // x10f0_move_b_ix_071234fc
+	0x00, // x1100_move_b_071234fc
+	0x00, // x1110_move_b_ai_071234fc
+	0x00, // x1118_move_b_pi_071234fc
+	0x00, // x1120_move_b_pd_071234fc
+	0x00, // x1128_move_b_di_071234fc
+	0x00, // x1130_move_b_ix_071234fc
+	0x00, // x1140_move_b_071234fc
+	0x00, // x1150_move_b_ai_071234fc
+	0x00, // x1158_move_b_pi_071234fc
+	0x00, // x1160_move_b_pd_071234fc
+	0x00, // x1168_move_b_di_071234fc
+	0x00, // x1170_move_b_ix_071234fc
+	0x00, // x1180_move_b_071234fc
+	0x00, // x1190_move_b_ai_071234fc
+	0x00, // x1198_move_b_pi_071234fc
+	0x00, // x11a0_move_b_pd_071234fc
+	0x00, // x11a8_move_b_di_071234fc
+	0x00, // x11b0_move_b_ix_071234fc
+	0x00, // x2000_move_l_071234fc
+	0x00, // x2008_move_l_071234fc
+	0x00, // x2010_move_l_ai_071234fc
+	0x00, // x2018_move_l_pi_071234fc
+	0x00, // x2020_move_l_pd_071234fc
+	0x00, // x2028_move_l_di_071234fc
+	0x00, // x2030_move_l_ix_071234fc
+	0x00, // x2040_movea_l_071234fc
+	0x00, // x2048_movea_l_071234fc
+	0x00, // x2050_movea_l_ai_071234fc
+	0x00, // x2058_movea_l_pi_071234fc
+	0x00, // x2060_movea_l_pd_071234fc
+	0x00, // x2068_movea_l_di_071234fc
+	0x00, // x2070_movea_l_ix_071234fc
+	0x00, // x2080_move_l_071234fc
+	0x00, // x2088_move_l_071234fc
+	0x00, // x2090_move_l_ai_071234fc
+	0x00, // x2098_move_l_pi_071234fc
+	0x00, // x20a0_move_l_pd_071234fc
+	0x00, // x20a8_move_l_di_071234fc
+	0x00, // x20b0_move_l_ix_071234fc
+	0x00, // x20c0_move_l_071234fc
+	0x00, // x20c8_move_l_071234fc
+	0x00, // x20d0_move_l_ai_071234fc
+	0x00, // x20d8_move_l_pi_071234fc
+	0x00, // x20e0_move_l_pd_071234fc
+	0x00, // x20e8_move_l_di_071234fc
+	0x00, // x20f0_move_l_ix_071234fc
+	0x00, // x2100_move_l_071234fc
+	0x00, // x2108_move_l_071234fc
+	0x00, // x2110_move_l_ai_071234fc
+	0x00, // x2118_move_l_pi_071234fc
+	0x00, // x2120_move_l_pd_071234fc
+	0x00, // x2128_move_l_di_071234fc
+	0x00, // x2130_move_l_ix_071234fc
+	0x00, // x2140_move_l_071234fc
+	0x00, // x2148_move_l_071234fc
+	0x00, // x2150_move_l_ai_071234fc
+	0x00, // x2158_move_l_pi_071234fc
+	0x00, // x2160_move_l_pd_071234fc
+	0x00, // x2168_move_l_di_071234fc
+	0x00, // x2170_move_l_ix_071234fc
+	0x00, // x2180_move_l_071234fc
+	0x00, // x2188_move_l_071234fc
+	0x00, // x2190_move_l_ai_071234fc
+	0x00, // x2198_move_l_pi_071234fc
+	0x00, // x21a0_move_l_pd_071234fc
+	0x00, // x21a8_move_l_di_071234fc
+	0x00, // x21b0_move_l_ix_071234fc
+	0x00, // x3000_move_w_071234fc
+	0x00, // x3008_move_w_071234fc
+	0x00, // x3010_move_w_ai_071234fc
+	0x00, // x3018_move_w_pi_071234fc
+	0x00, // x3020_move_w_pd_071234fc
+	0x00, // x3028_move_w_di_071234fc
+	0x00, // x3030_move_w_ix_071234fc
+	0x00, // x3040_movea_w_071234fc
+	0x00, // x3048_movea_w_071234fc
+	0x00, // x3050_movea_w_ai_071234fc
+	0x00, // x3058_movea_w_pi_071234fc
+	0x00, // x3060_movea_w_pd_071234fc
+	0x00, // x3068_movea_w_di_071234fc
+	0x00, // x3070_movea_w_ix_071234fc
+	0x00, // x3080_move_w_071234fc
+	0x00, // x3088_move_w_071234fc
+	0x00, // x3090_move_w_ai_071234fc
+	0x00, // x3098_move_w_pi_071234fc
+	0x00, // x30a0_move_w_pd_071234fc
+	0x00, // x30a8_move_w_di_071234fc
+	0x00, // x30b0_move_w_ix_071234fc
+	0x00, // x30c0_move_w_071234fc
+	0x00, // x30c8_move_w_071234fc
+	0x00, // x30d0_move_w_ai_071234fc
+	0x00, // x30d8_move_w_pi_071234fc
+	0x00, // x30e0_move_w_pd_071234fc
+	0x00, // x30e8_move_w_di_071234fc
+	0x00, // x30f0_move_w_ix_071234fc
+	0x00, // x3100_move_w_071234fc
+	0x00, // x3108_move_w_071234fc
+	0x00, // x3110_move_w_ai_071234fc
+	0x00, // x3118_move_w_pi_071234fc
+	0x00, // x3120_move_w_pd_071234fc
+	0x00, // x3128_move_w_di_071234fc
+	0x00, // x3130_move_w_ix_071234fc
+	0x00, // x3140_move_w_071234fc
+	0x00, // x3148_move_w_071234fc
+	0x00, // x3150_move_w_ai_071234fc
+	0x00, // x3158_move_w_pi_071234fc
+	0x00, // x3160_move_w_pd_071234fc
+	0x00, // x3168_move_w_di_071234fc
+	0x00, // x3170_move_w_ix_071234fc
+	0x00, // x3180_move_w_071234fc
+	0x00, // x3188_move_w_071234fc
+	0x00, // x3190_move_w_ai_071234fc
+	0x00, // x3198_move_w_pi_071234fc
+	0x00, // x31a0_move_w_pd_071234fc
+	0x00, // x31a8_move_w_di_071234fc
+	0x00, // x31b0_move_w_ix_071234fc
+	0x12, // x4100_chk_l_234fc
+	0x12, // x4110_chk_l_ai_234fc
+	0x12, // x4118_chk_l_pi_234fc
+	0x12, // x4120_chk_l_pd_234fc
+	0x12, // x4128_chk_l_di_234fc
+	0x12, // x4130_chk_l_ix_234fc
+	0x12, // x4180_chk_w_071234fc
+	0x12, // x4190_chk_w_ai_071234fc
+	0x12, // x4198_chk_w_pi_071234fc
+	0x12, // x41a0_chk_w_pd_071234fc
+	0x12, // x41a8_chk_w_di_071234fc
+	0x12, // x41b0_chk_w_ix_071234fc
+	0x00, // x41d0_lea_l_ai_071234fc
+	0x00, // x41e8_lea_l_di_071234fc
+	0x00, // x41f0_lea_l_ix_071234fc
+	0x00, // x5000_addq_b_071234fc
+	0x00, // x5010_addq_b_ai_071234fc
+	0x00, // x5018_addq_b_pi_071234fc
+	0x00, // x5020_addq_b_pd_071234fc
+	0x00, // x5028_addq_b_di_071234fc
+	0x00, // x5030_addq_b_ix_071234fc
+	0x00, // x5040_addq_w_071234fc
+	0x00, // x5048_addq_w_071234fc
+	0x00, // x5050_addq_w_ai_071234fc
+	0x00, // x5058_addq_w_pi_071234fc
+	0x00, // x5060_addq_w_pd_071234fc
+	0x00, // x5068_addq_w_di_071234fc
+	0x00, // x5070_addq_w_ix_071234fc
+	0x00, // x5080_addq_l_071234fc
+	0x00, // x5088_addq_l_071234fc
+	0x00, // x5090_addq_l_ai_071234fc
+	0x00, // x5098_addq_l_pi_071234fc
+	0x00, // x50a0_addq_l_pd_071234fc
+	0x00, // x50a8_addq_l_di_071234fc
+	0x00, // x50b0_addq_l_ix_071234fc
+	0x00, // x5100_subq_b_071234fc
+	0x00, // x5110_subq_b_ai_071234fc
+	0x00, // x5118_subq_b_pi_071234fc
+	0x00, // x5120_subq_b_pd_071234fc
+	0x00, // x5128_subq_b_di_071234fc
+	0x00, // x5130_subq_b_ix_071234fc
+	0x00, // x5140_subq_w_071234fc
+	0x00, // x5148_subq_w_071234fc
+	0x00, // x5150_subq_w_ai_071234fc
+	0x00, // x5158_subq_w_pi_071234fc
+	0x00, // x5160_subq_w_pd_071234fc
+	0x00, // x5168_subq_w_di_071234fc
+	0x00, // x5170_subq_w_ix_071234fc
+	0x00, // x5180_subq_l_071234fc
+	0x00, // x5188_subq_l_071234fc
+	0x00, // x5190_subq_l_ai_071234fc
+	0x00, // x5198_subq_l_pi_071234fc
+	0x00, // x51a0_subq_l_pd_071234fc
+	0x00, // x51a8_subq_l_di_071234fc
+	0x00, // x51b0_subq_l_ix_071234fc
+	0x00, // x8000_or_b_071234fc
+	0x00, // x8010_or_b_ai_071234fc
+	0x00, // x8018_or_b_pi_071234fc
+	0x00, // x8020_or_b_pd_071234fc
+	0x00, // x8028_or_b_di_071234fc
+	0x00, // x8030_or_b_ix_071234fc
+	0x00, // x8040_or_w_071234fc
+	0x00, // x8050_or_w_ai_071234fc
+	0x00, // x8058_or_w_pi_071234fc
+	0x00, // x8060_or_w_pd_071234fc
+	0x00, // x8068_or_w_di_071234fc
+	0x00, // x8070_or_w_ix_071234fc
+	0x00, // x8080_or_l_071234fc
+	0x00, // x8090_or_l_ai_071234fc
+	0x00, // x8098_or_l_pi_071234fc
+	0x00, // x80a0_or_l_pd_071234fc
+	0x00, // x80a8_or_l_di_071234fc
+	0x00, // x80b0_or_l_ix_071234fc
+	0x00, // x80c0_divu_w_071234fc
+	0x00, // x80d0_divu_w_ai_071234fc
+	0x00, // x80d8_divu_w_pi_071234fc
+	0x00, // x80e0_divu_w_pd_071234fc
+	0x00, // x80e8_divu_w_di_071234fc
+	0x00, // x80f0_divu_w_ix_071234fc
+	0x00, // x8100_sbcd_b_071234fc
+	0x00, // x8108_sbcd_b_071234fc
+	0x00, // x8110_or_b_ai_071234fc
+	0x00, // x8118_or_b_pi_071234fc
+	0x00, // x8120_or_b_pd_071234fc
+	0x00, // x8128_or_b_di_071234fc
+	0x00, // x8130_or_b_ix_071234fc
+	0x00, // x8140_pack_w_234fc
+	0x00, // x8148_pack_w_234fc
+	0x00, // x8150_or_w_ai_071234fc
+	0x00, // x8158_or_w_pi_071234fc
+	0x00, // x8160_or_w_pd_071234fc
+	0x00, // x8168_or_w_di_071234fc
+	0x00, // x8170_or_w_ix_071234fc
+	0x00, // x8180_unpk_w_234fc
+	0x00, // x8188_unpk_w_234fc
+	0x00, // x8190_or_l_ai_071234fc
+	0x00, // x8198_or_l_pi_071234fc
+	0x00, // x81a0_or_l_pd_071234fc
+	0x00, // x81a8_or_l_di_071234fc
+	0x00, // x81b0_or_l_ix_071234fc
+	0x00, // x81c0_divs_w_071234fc
+	0x00, // x81d0_divs_w_ai_071234fc
+	0x00, // x81d8_divs_w_pi_071234fc
+	0x00, // x81e0_divs_w_pd_071234fc
+	0x00, // x81e8_divs_w_di_071234fc
+	0x00, // x81f0_divs_w_ix_071234fc
+	0x00, // x9000_sub_b_071234fc
+	0x00, // x9010_sub_b_ai_071234fc
+	0x00, // x9018_sub_b_pi_071234fc
+	0x00, // x9020_sub_b_pd_071234fc
+	0x00, // x9028_sub_b_di_071234fc
+	0x00, // x9030_sub_b_ix_071234fc
+	0x00, // x9040_sub_w_071234fc
+	0x00, // x9048_sub_w_071234fc
+	0x00, // x9050_sub_w_ai_071234fc
+	0x00, // x9058_sub_w_pi_071234fc
+	0x00, // x9060_sub_w_pd_071234fc
+	0x00, // x9068_sub_w_di_071234fc
+	0x00, // x9070_sub_w_ix_071234fc
+	0x00, // x9080_sub_l_071234fc
+	0x00, // x9088_sub_l_071234fc
+	0x00, // x9090_sub_l_ai_071234fc
+	0x00, // x9098_sub_l_pi_071234fc
+	0x00, // x90a0_sub_l_pd_071234fc
+	0x00, // x90a8_sub_l_di_071234fc
+	0x00, // x90b0_sub_l_ix_071234fc
+	0x00, // x90c0_suba_w_071234fc
+	0x00, // x90c8_suba_w_071234fc
+	0x00, // x90d0_suba_w_ai_071234fc
+	0x00, // x90d8_suba_w_pi_071234fc
+	0x00, // x90e0_suba_w_pd_071234fc
+	0x00, // x90e8_suba_w_di_071234fc
+	0x00, // x90f0_suba_w_ix_071234fc
+	0x00, // x9100_subx_b_071234fc
+	0x00, // x9108_subx_b_071234fc
+	0x00, // x9110_sub_b_ai_071234fc
+	0x00, // x9118_sub_b_pi_071234fc
+	0x00, // x9120_sub_b_pd_071234fc
+	0x00, // x9128_sub_b_di_071234fc
+	0x00, // x9130_sub_b_ix_071234fc
+	0x00, // x9140_subx_w_071234fc
+	0x00, // x9148_subx_w_071234fc
+	0x00, // x9150_sub_w_ai_071234fc
+	0x00, // x9158_sub_w_pi_071234fc
+	0x00, // x9160_sub_w_pd_071234fc
+	0x00, // x9168_sub_w_di_071234fc
+	0x00, // x9170_sub_w_ix_071234fc
+	0x00, // x9180_subx_l_071234fc
+	0x00, // x9188_subx_l_071234fc
+	0x00, // x9190_sub_l_ai_071234fc
+	0x00, // x9198_sub_l_pi_071234fc
+	0x00, // x91a0_sub_l_pd_071234fc
+	0x00, // x91a8_sub_l_di_071234fc
+	0x00, // x91b0_sub_l_ix_071234fc
+	0x00, // x91c0_suba_l_071234fc
+	0x00, // x91c8_suba_l_071234fc
+	0x00, // x91d0_suba_l_ai_071234fc
+	0x00, // x91d8_suba_l_pi_071234fc
+	0x00, // x91e0_suba_l_pd_071234fc
+	0x00, // x91e8_suba_l_di_071234fc
+	0x00, // x91f0_suba_l_ix_071234fc
+	0x00, // xb000_cmp_b_071234fc
+	0x00, // xb010_cmp_b_ai_071234fc
+	0x00, // xb018_cmp_b_pi_071234fc
+	0x00, // xb020_cmp_b_pd_071234fc
+	0x00, // xb028_cmp_b_di_071234fc
+	0x00, // xb030_cmp_b_ix_071234fc
+	0x00, // xb040_cmp_w_071234fc
+	0x00, // xb048_cmp_w_071234fc
+	0x00, // xb050_cmp_w_ai_071234fc
+	0x00, // xb058_cmp_w_pi_071234fc
+	0x00, // xb060_cmp_w_pd_071234fc
+	0x00, // xb068_cmp_w_di_071234fc
+	0x00, // xb070_cmp_w_ix_071234fc
+	0x00, // xb080_cmp_l_071234fc
+	0x00, // xb088_cmp_l_071234fc
+	0x00, // xb090_cmp_l_ai_071234fc
+	0x00, // xb098_cmp_l_pi_071234fc
+	0x00, // xb0a0_cmp_l_pd_071234fc
+	0x00, // xb0a8_cmp_l_di_071234fc
+	0x00, // xb0b0_cmp_l_ix_071234fc
+	0x00, // xb0c0_cmpa_w_071234fc
+	0x00, // xb0c8_cmpa_w_071234fc
+	0x00, // xb0d0_cmpa_w_ai_071234fc
+	0x00, // xb0d8_cmpa_w_pi_071234fc
+	0x00, // xb0e0_cmpa_w_pd_071234fc
+	0x00, // xb0e8_cmpa_w_di_071234fc
+	0x00, // xb0f0_cmpa_w_ix_071234fc
+	0x00, // xb100_eor_b_071234fc
+	0x00, // xb108_cmpm_b_071234fc
+	0x00, // xb110_eor_b_ai_071234fc
+	0x00, // xb118_eor_b_pi_071234fc
+	0x00, // xb120_eor_b_pd_071234fc
+	0x00, // xb128_eor_b_di_071234fc
+	0x00, // xb130_eor_b_ix_071234fc
+	0x00, // xb140_eor_w_071234fc
+	0x00, // xb148_cmpm_w_071234fc
+	0x00, // xb150_eor_w_ai_071234fc
+	0x00, // xb158_eor_w_pi_071234fc
+	0x00, // xb160_eor_w_pd_071234fc
+	0x00, // xb168_eor_w_di_071234fc
+	0x00, // xb170_eor_w_ix_071234fc
+	0x00, // xb180_eor_l_071234fc
+	0x00, // xb188_cmpm_l_071234fc
+	0x00, // xb190_eor_l_ai_071234fc
+	0x00, // xb198_eor_l_pi_071234fc
+	0x00, // xb1a0_eor_l_pd_071234fc
+	0x00, // xb1a8_eor_l_di_071234fc
+	0x00, // xb1b0_eor_l_ix_071234fc
+	0x00, // xb1c0_cmpa_l_071234fc
+	0x00, // xb1c8_cmpa_l_071234fc
+	0x00, // xb1d0_cmpa_l_ai_071234fc
+	0x00, // xb1d8_cmpa_l_pi_071234fc
+	0x00, // xb1e0_cmpa_l_pd_071234fc
+	0x00, // xb1e8_cmpa_l_di_071234fc
+	0x00, // xb1f0_cmpa_l_ix_071234fc
+	0x00, // xc000_and_b_071234fc
+	0x00, // xc010_and_b_ai_071234fc
+	0x00, // xc018_and_b_pi_071234fc
+	0x00, // xc020_and_b_pd_071234fc
+	0x00, // xc028_and_b_di_071234fc
+	0x00, // xc030_and_b_ix_071234fc
+	0x00, // xc040_and_w_071234fc
+	0x00, // xc050_and_w_ai_071234fc
+	0x00, // xc058_and_w_pi_071234fc
+	0x00, // xc060_and_w_pd_071234fc
+	0x00, // xc068_and_w_di_071234fc
+	0x00, // xc070_and_w_ix_071234fc
+	0x00, // xc080_and_l_071234fc
+	0x00, // xc090_and_l_ai_071234fc
+	0x00, // xc098_and_l_pi_071234fc
+	0x00, // xc0a0_and_l_pd_071234fc
+	0x00, // xc0a8_and_l_di_071234fc
+	0x00, // xc0b0_and_l_ix_071234fc
+	0x00, // xc0c0_mulu_w_071234fc
+	0x00, // xc0d0_mulu_w_ai_071234fc
+	0x00, // xc0d8_mulu_w_pi_071234fc
+	0x00, // xc0e0_mulu_w_pd_071234fc
+	0x00, // xc0e8_mulu_w_di_071234fc
+	0x00, // xc0f0_mulu_w_ix_071234fc
+	0x00, // xc100_abcd_b_071234fc
+	0x00, // xc108_abcd_b_071234fc
+	0x00, // xc110_and_b_ai_071234fc
+	0x00, // xc118_and_b_pi_071234fc
+	0x00, // xc120_and_b_pd_071234fc
+	0x00, // xc128_and_b_di_071234fc
+	0x00, // xc130_and_b_ix_071234fc
+	0x00, // xc140_exg_l_071234fc
+	0x00, // xc148_exg_l_071234fc
+	0x00, // xc150_and_w_ai_071234fc
+	0x00, // xc158_and_w_pi_071234fc
+	0x00, // xc160_and_w_pd_071234fc
+	0x00, // xc168_and_w_di_071234fc
+	0x00, // xc170_and_w_ix_071234fc
+	0x00, // xc188_exg_l_071234fc
+	0x00, // xc190_and_l_ai_071234fc
+	0x00, // xc198_and_l_pi_071234fc
+	0x00, // xc1a0_and_l_pd_071234fc
+	0x00, // xc1a8_and_l_di_071234fc
+	0x00, // xc1b0_and_l_ix_071234fc
+	0x00, // xc1c0_muls_w_071234fc
+	0x00, // xc1d0_muls_w_ai_071234fc
+	0x00, // xc1d8_muls_w_pi_071234fc
+	0x00, // xc1e0_muls_w_pd_071234fc
+	0x00, // xc1e8_muls_w_di_071234fc
+	0x00, // xc1f0_muls_w_ix_071234fc
+	0x00, // xd000_add_b_071234fc
+	0x00, // xd010_add_b_ai_071234fc
+	0x00, // xd018_add_b_pi_071234fc
+	0x00, // xd020_add_b_pd_071234fc
+	0x00, // xd028_add_b_di_071234fc
+	0x00, // xd030_add_b_ix_071234fc
+	0x00, // xd040_add_w_071234fc
+	0x00, // xd048_add_w_071234fc
+	0x00, // xd050_add_w_ai_071234fc
+	0x00, // xd058_add_w_pi_071234fc
+	0x00, // xd060_add_w_pd_071234fc
+	0x00, // xd068_add_w_di_071234fc
+	0x00, // xd070_add_w_ix_071234fc
+	0x00, // xd080_add_l_071234fc
+	0x00, // xd088_add_l_071234fc
+	0x00, // xd090_add_l_ai_071234fc
+	0x00, // xd098_add_l_pi_071234fc
+	0x00, // xd0a0_add_l_pd_071234fc
+	0x00, // xd0a8_add_l_di_071234fc
+	0x00, // xd0b0_add_l_ix_071234fc
+	0x00, // xd0c0_adda_w_071234fc
+	0x00, // xd0c8_adda_w_071234fc
+	0x00, // xd0d0_adda_w_ai_071234fc
+	0x00, // xd0d8_adda_w_pi_071234fc
+	0x00, // xd0e0_adda_w_pd_071234fc
+	0x00, // xd0e8_adda_w_di_071234fc
+	0x00, // xd0f0_adda_w_ix_071234fc
+	0x00, // xd100_addx_b_071234fc
+	0x00, // xd108_addx_b_071234fc
+	0x00, // xd110_add_b_ai_071234fc
+	0x00, // xd118_add_b_pi_071234fc
+	0x00, // xd120_add_b_pd_071234fc
+	0x00, // xd128_add_b_di_071234fc
+	0x00, // xd130_add_b_ix_071234fc
+	0x00, // xd140_addx_w_071234fc
+	0x00, // xd148_addx_w_071234fc
+	0x00, // xd150_add_w_ai_071234fc
+	0x00, // xd158_add_w_pi_071234fc
+	0x00, // xd160_add_w_pd_071234fc
+	0x00, // xd168_add_w_di_071234fc
+	0x00, // xd170_add_w_ix_071234fc
+	0x00, // xd180_addx_l_071234fc
+	0x00, // xd188_addx_l_071234fc
+	0x00, // xd190_add_l_ai_071234fc
+	0x00, // xd198_add_l_pi_071234fc
+	0x00, // xd1a0_add_l_pd_071234fc
+	0x00, // xd1a8_add_l_di_071234fc
+	0x00, // xd1b0_add_l_ix_071234fc
+	0x00, // xd1c0_adda_l_071234fc
+	0x00, // xd1c8_adda_l_071234fc
+	0x00, // xd1d0_adda_l_ai_071234fc
+	0x00, // xd1d8_adda_l_pi_071234fc
+	0x00, // xd1e0_adda_l_pd_071234fc
+	0x00, // xd1e8_adda_l_di_071234fc
+	0x00, // xd1f0_adda_l_ix_071234fc
+	0x00, // xe000_asr_b_071234fc
+	0x00, // xe008_lsr_b_071234fc
+	0x00, // xe010_roxr_b_071234fc
+	0x00, // xe018_ror_b_071234fc
+	0x00, // xe020_asr_b_071234fc
+	0x00, // xe028_lsr_b_071234fc
+	0x00, // xe030_roxr_b_071234fc
+	0x00, // xe038_ror_b_071234fc
+	0x00, // xe040_asr_w_071234fc
+	0x00, // xe048_lsr_w_071234fc
+	0x00, // xe050_roxr_w_071234fc
+	0x00, // xe058_ror_w_071234fc
+	0x00, // xe060_asr_w_071234fc
+	0x00, // xe068_lsr_w_071234fc
+	0x00, // xe070_roxr_w_071234fc
+	0x00, // xe078_ror_w_071234fc
+	0x00, // xe080_asr_l_071234fc
+	0x00, // xe088_lsr_l_071234fc
+	0x00, // xe090_roxr_l_071234fc
+	0x00, // xe098_ror_l_071234fc
+	0x00, // xe0a0_asr_l_071234fc
+	0x00, // xe0a8_lsr_l_071234fc
+	0x00, // xe0b0_roxr_l_071234fc
+	0x00, // xe0b8_ror_l_071234fc
+	0x00, // xe100_asl_b_071234fc
+	0x00, // xe108_lsl_b_071234fc
+	0x00, // xe110_roxl_b_071234fc
+	0x00, // xe118_rol_b_071234fc
+	0x00, // xe120_asl_b_071234fc
+	0x00, // xe128_lsl_b_071234fc
+	0x00, // xe130_roxl_b_071234fc
+	0x00, // xe138_rol_b_071234fc
+	0x00, // xe140_asl_w_071234fc
+	0x00, // xe148_lsl_w_071234fc
+	0x00, // xe150_roxl_w_071234fc
+	0x00, // xe158_rol_w_071234fc
+	0x00, // xe160_asl_w_071234fc
+	0x00, // xe168_lsl_w_071234fc
+	0x00, // xe170_roxl_w_071234fc
+	0x00, // xe178_rol_w_071234fc
+	0x00, // xe180_asl_l_071234fc
+	0x00, // xe188_lsl_l_071234fc
+	0x00, // xe190_roxl_l_071234fc
+	0x00, // xe198_rol_l_071234fc
+	0x00, // xe1a0_asl_l_071234fc
+	0x00, // xe1a8_lsl_l_071234fc
+	0x00, // xe1b0_roxl_l_071234fc
+	0x00, // xe1b8_rol_l_071234fc
+	0x06, // xf048_cpdbcc_l_23
+	0x12, // xf078_cptrapcc_l_23
+	0x20, // xf548_ptest_l_4
+	0x04, // x06c0_rtm_l_234fc
+	0x10, // x4e40_trap_071234fc
+	0x00, // x011f_btst_b_pi7_071234fc
+	0x00, // x0127_btst_b_pd7_071234fc
+	0x00, // x0138_btst_b_aw_071234fc
+	0x00, // x0139_btst_b_al_071234fc
+	0x00, // x013a_btst_b_pcdi_071234fc
+	0x00, // x013b_btst_b_pcix_071234fc
+	0x00, // x013c_btst_b_i_071234fc
+	0x00, // x015f_bchg_b_pi7_071234fc
+	0x00, // x0167_bchg_b_pd7_071234fc
+	0x00, // x0178_bchg_b_aw_071234fc
+	0x00, // x0179_bchg_b_al_071234fc
+	0x00, // x019f_bclr_b_pi7_071234fc
+	0x00, // x01a7_bclr_b_pd7_071234fc
+	0x00, // x01b8_bclr_b_aw_071234fc
+	0x00, // x01b9_bclr_b_al_071234fc
+	0x00, // x01df_bset_b_pi7_071234fc
+	0x00, // x01e7_bset_b_pd7_071234fc
+	0x00, // x01f8_bset_b_aw_071234fc
+	0x00, // x01f9_bset_b_al_071234fc
+	0x00, // x101f_move_b_pi7_071234fc
+	0x00, // x1027_move_b_pd7_071234fc
+	0x00, // x1038_move_b_aw_071234fc
+	0x00, // x1039_move_b_al_071234fc
+	0x00, // x103a_move_b_pcdi_071234fc
+	0x00, // x103b_move_b_pcix_071234fc
+	0x00, // x103c_move_b_i_071234fc
+	0x00, // x109f_move_b_pi7_071234fc
+	0x00, // x10a7_move_b_pd7_071234fc
+	0x00, // x10b8_move_b_aw_071234fc
+	0x00, // x10b9_move_b_al_071234fc
+	0x00, // x10ba_move_b_pcdi_071234fc
+	0x00, // x10bb_move_b_pcix_071234fc
+	0x00, // x10bc_move_b_i_071234fc
+	0x00, // x10df_move_b_pi7_071234fc
+	0x00, // x10e7_move_b_pd7_071234fc
+	0x00, // x10f8_move_b_aw_071234fc
+	0x00, // x10f9_move_b_al_071234fc
+	0x00, // x10fa_move_b_pcdi_071234fc
+	0x00, // x10fb_move_b_pcix_071234fc
+	0x00, // x10fc_move_b_i_071234fc
+	0x00, // x111f_move_b_pi7_071234fc
+	0x00, // x1127_move_b_pd7_071234fc
+	0x00, // x1138_move_b_aw_071234fc
+	0x00, // x1139_move_b_al_071234fc
+	0x00, // x113a_move_b_pcdi_071234fc
+	0x00, // x113b_move_b_pcix_071234fc
+	0x00, // x113c_move_b_i_071234fc
+	0x00, // x115f_move_b_pi7_071234fc
+	0x00, // x1167_move_b_pd7_071234fc
+	0x00, // x1178_move_b_aw_071234fc
+	0x00, // x1179_move_b_al_071234fc
+	0x00, // x117a_move_b_pcdi_071234fc
+	0x00, // x117b_move_b_pcix_071234fc
+	0x00, // x117c_move_b_i_071234fc
+	0x00, // x119f_move_b_pi7_071234fc
+	0x00, // x11a7_move_b_pd7_071234fc
+	0x00, // x11b8_move_b_aw_071234fc
+	0x00, // x11b9_move_b_al_071234fc
+	0x00, // x11ba_move_b_pcdi_071234fc
+	0x00, // x11bb_move_b_pcix_071234fc
+	0x00, // x11bc_move_b_i_071234fc
+	0x00, // x2038_move_l_aw_071234fc
+	0x00, // x2039_move_l_al_071234fc
+	0x00, // x203a_move_l_pcdi_071234fc
+	0x00, // x203b_move_l_pcix_071234fc
+	0x00, // x203c_move_l_i_071234fc
+	0x00, // x2078_movea_l_aw_071234fc
+	0x00, // x2079_movea_l_al_071234fc
+	0x00, // x207a_movea_l_pcdi_071234fc
+	0x00, // x207b_movea_l_pcix_071234fc
+	0x00, // x207c_movea_l_i_071234fc
+	0x00, // x20b8_move_l_aw_071234fc
+	0x00, // x20b9_move_l_al_071234fc
+	0x00, // x20ba_move_l_pcdi_071234fc
+	0x00, // x20bb_move_l_pcix_071234fc
+	0x00, // x20bc_move_l_i_071234fc
+	0x00, // x20f8_move_l_aw_071234fc
+	0x00, // x20f9_move_l_al_071234fc
+	0x00, // x20fa_move_l_pcdi_071234fc
+	0x00, // x20fb_move_l_pcix_071234fc
+	0x00, // x20fc_move_l_i_071234fc
+	0x00, // x2138_move_l_aw_071234fc
+	0x00, // x2139_move_l_al_071234fc
+	0x00, // x213a_move_l_pcdi_071234fc
+	0x00, // x213b_move_l_pcix_071234fc
+	0x00, // x213c_move_l_i_071234fc
+	0x00, // x2178_move_l_aw_071234fc
+	0x00, // x2179_move_l_al_071234fc
+	0x00, // x217a_move_l_pcdi_071234fc
+	0x00, // x217b_move_l_pcix_071234fc
+	0x00, // x217c_move_l_i_071234fc
+	0x00, // x21b8_move_l_aw_071234fc
+	0x00, // x21b9_move_l_al_071234fc
+	0x00, // x21ba_move_l_pcdi_071234fc
+	0x00, // x21bb_move_l_pcix_071234fc
+	0x00, // x21bc_move_l_i_071234fc
+	0x00, // x3038_move_w_aw_071234fc
+	0x00, // x3039_move_w_al_071234fc
+	0x00, // x303a_move_w_pcdi_071234fc
+	0x00, // x303b_move_w_pcix_071234fc
+	0x00, // x303c_move_w_i_071234fc
+	0x00, // x3078_movea_w_aw_071234fc
+	0x00, // x3079_movea_w_al_071234fc
+	0x00, // x307a_movea_w_pcdi_071234fc
+	0x00, // x307b_movea_w_pcix_071234fc
+	0x00, // x307c_movea_w_i_071234fc
+	0x00, // x30b8_move_w_aw_071234fc
+	0x00, // x30b9_move_w_al_071234fc
+	0x00, // x30ba_move_w_pcdi_071234fc
+	0x00, // x30bb_move_w_pcix_071234fc
+	0x00, // x30bc_move_w_i_071234fc
+	0x00, // x30f8_move_w_aw_071234fc
+	0x00, // x30f9_move_w_al_071234fc
+	0x00, // x30fa_move_w_pcdi_071234fc
+	0x00, // x30fb_move_w_pcix_071234fc
+	0x00, // x30fc_move_w_i_071234fc
+	0x00, // x3138_move_w_aw_071234fc
+	0x00, // x3139_move_w_al_071234fc
+	0x00, // x313a_move_w_pcdi_071234fc
+	0x00, // x313b_move_w_pcix_071234fc
+	0x00, // x313c_move_w_i_071234fc
+	0x00, // x3178_move_w_aw_071234fc
+	0x00, // x3179_move_w_al_071234fc
+	0x00, // x317a_move_w_pcdi_071234fc
+	0x00, // x317b_move_w_pcix_071234fc
+	0x00, // x317c_move_w_i_071234fc
+	0x00, // x31b8_move_w_aw_071234fc
+	0x00, // x31b9_move_w_al_071234fc
+	0x00, // x31ba_move_w_pcdi_071234fc
+	0x00, // x31bb_move_w_pcix_071234fc
+	0x00, // x31bc_move_w_i_071234fc
+	0x12, // x4138_chk_l_aw_234fc
+	0x12, // x4139_chk_l_al_234fc
+	0x12, // x413a_chk_l_pcdi_234fc
+	0x12, // x413b_chk_l_pcix_234fc
+	0x12, // x413c_chk_l_i_234fc
+	0x12, // x41b8_chk_w_aw_071234fc
+	0x12, // x41b9_chk_w_al_071234fc
+	0x12, // x41ba_chk_w_pcdi_071234fc
+	0x12, // x41bb_chk_w_pcix_071234fc
+	0x12, // x41bc_chk_w_i_071234fc
+	0x00, // x41f8_lea_l_aw_071234fc
+	0x00, // x41f9_lea_l_al_071234fc
+	0x00, // x41fa_lea_l_pcdi_071234fc
+	0x00, // x41fb_lea_l_pcix_071234fc
+	0x00, // x501f_addq_b_pi7_071234fc
+	0x00, // x5027_addq_b_pd7_071234fc
+	0x00, // x5038_addq_b_aw_071234fc
+	0x00, // x5039_addq_b_al_071234fc
+	0x00, // x5078_addq_w_aw_071234fc
+	0x00, // x5079_addq_w_al_071234fc
+	0x00, // x50b8_addq_l_aw_071234fc
+	0x00, // x50b9_addq_l_al_071234fc
+	0x00, // x511f_subq_b_pi7_071234fc
+	0x00, // x5127_subq_b_pd7_071234fc
+	0x00, // x5138_subq_b_aw_071234fc
+	0x00, // x5139_subq_b_al_071234fc
+	0x00, // x5178_subq_w_aw_071234fc
+	0x00, // x5179_subq_w_al_071234fc
+	0x00, // x51b8_subq_l_aw_071234fc
+	0x00, // x51b9_subq_l_al_071234fc
+	0x00, // x801f_or_b_pi7_071234fc
+	0x00, // x8027_or_b_pd7_071234fc
+	0x00, // x8038_or_b_aw_071234fc
+	0x00, // x8039_or_b_al_071234fc
+	0x00, // x803a_or_b_pcdi_071234fc
+	0x00, // x803b_or_b_pcix_071234fc
+	0x00, // x803c_or_b_i_071234fc
+	0x00, // x8078_or_w_aw_071234fc
+	0x00, // x8079_or_w_al_071234fc
+	0x00, // x807a_or_w_pcdi_071234fc
+	0x00, // x807b_or_w_pcix_071234fc
+	0x00, // x807c_or_w_i_071234fc
+	0x00, // x80b8_or_l_aw_071234fc
+	0x00, // x80b9_or_l_al_071234fc
+	0x00, // x80ba_or_l_pcdi_071234fc
+	0x00, // x80bb_or_l_pcix_071234fc
+	0x00, // x80bc_or_l_i_071234fc
+	0x00, // x80f8_divu_w_aw_071234fc
+	0x00, // x80f9_divu_w_al_071234fc
+	0x00, // x80fa_divu_w_pcdi_071234fc
+	0x00, // x80fb_divu_w_pcix_071234fc
+	0x00, // x80fc_divu_w_i_071234fc
+	0x00, // x810f_sbcd_b_071234fc
+	0x00, // x811f_or_b_pi7_071234fc
+	0x00, // x8127_or_b_pd7_071234fc
+	0x00, // x8138_or_b_aw_071234fc
+	0x00, // x8139_or_b_al_071234fc
+	0x00, // x814f_pack_w_234fc
+	0x00, // x8178_or_w_aw_071234fc
+	0x00, // x8179_or_w_al_071234fc
+	0x00, // x818f_unpk_w_234fc
+	0x00, // x81b8_or_l_aw_071234fc
+	0x00, // x81b9_or_l_al_071234fc
+	0x00, // x81f8_divs_w_aw_071234fc
+	0x00, // x81f9_divs_w_al_071234fc
+	0x00, // x81fa_divs_w_pcdi_071234fc
+	0x00, // x81fb_divs_w_pcix_071234fc
+	0x00, // x81fc_divs_w_i_071234fc
+	0x00, // x901f_sub_b_pi7_071234fc
+	0x00, // x9027_sub_b_pd7_071234fc
+	0x00, // x9038_sub_b_aw_071234fc
+	0x00, // x9039_sub_b_al_071234fc
+	0x00, // x903a_sub_b_pcdi_071234fc
+	0x00, // x903b_sub_b_pcix_071234fc
+	0x00, // x903c_sub_b_i_071234fc
+	0x00, // x9078_sub_w_aw_071234fc
+	0x00, // x9079_sub_w_al_071234fc
+	0x00, // x907a_sub_w_pcdi_071234fc
+	0x00, // x907b_sub_w_pcix_071234fc
+	0x00, // x907c_sub_w_i_071234fc
+	0x00, // x90b8_sub_l_aw_071234fc
+	0x00, // x90b9_sub_l_al_071234fc
+	0x00, // x90ba_sub_l_pcdi_071234fc
+	0x00, // x90bb_sub_l_pcix_071234fc
+	0x00, // x90bc_sub_l_i_071234fc
+	0x00, // x90f8_suba_w_aw_071234fc
+	0x00, // x90f9_suba_w_al_071234fc
+	0x00, // x90fa_suba_w_pcdi_071234fc
+	0x00, // x90fb_suba_w_pcix_071234fc
+	0x00, // x90fc_suba_w_i_071234fc
+	0x00, // x910f_subx_b_071234fc
+	0x00, // x911f_sub_b_pi7_071234fc
+	0x00, // x9127_sub_b_pd7_071234fc
+	0x00, // x9138_sub_b_aw_071234fc
+	0x00, // x9139_sub_b_al_071234fc
+	0x00, // x9178_sub_w_aw_071234fc
+	0x00, // x9179_sub_w_al_071234fc
+	0x00, // x91b8_sub_l_aw_071234fc
+	0x00, // x91b9_sub_l_al_071234fc
+	0x00, // x91f8_suba_l_aw_071234fc
+	0x00, // x91f9_suba_l_al_071234fc
+	0x00, // x91fa_suba_l_pcdi_071234fc
+	0x00, // x91fb_suba_l_pcix_071234fc
+	0x00, // x91fc_suba_l_i_071234fc
+	0x00, // xb01f_cmp_b_pi7_071234fc
+	0x00, // xb027_cmp_b_pd7_071234fc
+	0x00, // xb038_cmp_b_aw_071234fc
+	0x00, // xb039_cmp_b_al_071234fc
+	0x00, // xb03a_cmp_b_pcdi_071234fc
+	0x00, // xb03b_cmp_b_pcix_071234fc
+	0x00, // xb03c_cmp_b_i_071234fc
+	0x00, // xb078_cmp_w_aw_071234fc
+	0x00, // xb079_cmp_w_al_071234fc
+	0x00, // xb07a_cmp_w_pcdi_071234fc
+	0x00, // xb07b_cmp_w_pcix_071234fc
+	0x00, // xb07c_cmp_w_i_071234fc
+	0x00, // xb0b8_cmp_l_aw_071234fc
+	0x00, // xb0b9_cmp_l_al_071234fc
+	0x00, // xb0ba_cmp_l_pcdi_071234fc
+	0x00, // xb0bb_cmp_l_pcix_071234fc
+	0x00, // xb0bc_cmp_l_i_071234fc
+	0x00, // xb0f8_cmpa_w_aw_071234fc
+	0x00, // xb0f9_cmpa_w_al_071234fc
+	0x00, // xb0fa_cmpa_w_pcdi_071234fc
+	0x00, // xb0fb_cmpa_w_pcix_071234fc
+	0x00, // xb0fc_cmpa_w_i_071234fc
+	0x00, // xb10f_cmpm_b_071234fc
+	0x00, // xb11f_eor_b_pi7_071234fc
+	0x00, // xb127_eor_b_pd7_071234fc
+	0x00, // xb138_eor_b_aw_071234fc
+	0x00, // xb139_eor_b_al_071234fc
+	0x00, // xb178_eor_w_aw_071234fc
+	0x00, // xb179_eor_w_al_071234fc
+	0x00, // xb1b8_eor_l_aw_071234fc
+	0x00, // xb1b9_eor_l_al_071234fc
+	0x00, // xb1f8_cmpa_l_aw_071234fc
+	0x00, // xb1f9_cmpa_l_al_071234fc
+	0x00, // xb1fa_cmpa_l_pcdi_071234fc
+	0x00, // xb1fb_cmpa_l_pcix_071234fc
+	0x00, // xb1fc_cmpa_l_i_071234fc
+	0x00, // xc01f_and_b_pi7_071234fc
+	0x00, // xc027_and_b_pd7_071234fc
+	0x00, // xc038_and_b_aw_071234fc
+	0x00, // xc039_and_b_al_071234fc
+	0x00, // xc03a_and_b_pcdi_071234fc
+	0x00, // xc03b_and_b_pcix_071234fc
+	0x00, // xc03c_and_b_i_071234fc
+	0x00, // xc078_and_w_aw_071234fc
+	0x00, // xc079_and_w_al_071234fc
+	0x00, // xc07a_and_w_pcdi_071234fc
+	0x00, // xc07b_and_w_pcix_071234fc
+	0x00, // xc07c_and_w_i_071234fc
+	0x00, // xc0b8_and_l_aw_071234fc
+	0x00, // xc0b9_and_l_al_071234fc
+	0x00, // xc0ba_and_l_pcdi_071234fc
+	0x00, // xc0bb_and_l_pcix_071234fc
+	0x00, // xc0bc_and_l_i_071234fc
+	0x00, // xc0f8_mulu_w_aw_071234fc
+	0x00, // xc0f9_mulu_w_al_071234fc
+	0x00, // xc0fa_mulu_w_pcdi_071234fc
+	0x00, // xc0fb_mulu_w_pcix_071234fc
+	0x00, // xc0fc_mulu_w_i_071234fc
+	0x00, // xc10f_abcd_b_071234fc
+	0x00, // xc11f_and_b_pi7_071234fc
+	0x00, // xc127_and_b_pd7_071234fc
+	0x00, // xc138_and_b_aw_071234fc
+	0x00, // xc139_and_b_al_071234fc
+	0x00, // xc178_and_w_aw_071234fc
+	0x00, // xc179_and_w_al_071234fc
+	0x00, // xc1b8_and_l_aw_071234fc
+	0x00, // xc1b9_and_l_al_071234fc
+	0x00, // xc1f8_muls_w_aw_071234fc
+	0x00, // xc1f9_muls_w_al_071234fc
+	0x00, // xc1fa_muls_w_pcdi_071234fc
+	0x00, // xc1fb_muls_w_pcix_071234fc
+	0x00, // xc1fc_muls_w_i_071234fc
+	0x00, // xd01f_add_b_pi7_071234fc
+	0x00, // xd027_add_b_pd7_071234fc
+	0x00, // xd038_add_b_aw_071234fc
+	0x00, // xd039_add_b_al_071234fc
+	0x00, // xd03a_add_b_pcdi_071234fc
+	0x00, // xd03b_add_b_pcix_071234fc
+	0x00, // xd03c_add_b_i_071234fc
+	0x00, // xd078_add_w_aw_071234fc
+	0x00, // xd079_add_w_al_071234fc
+	0x00, // xd07a_add_w_pcdi_071234fc
+	0x00, // xd07b_add_w_pcix_071234fc
+	0x00, // xd07c_add_w_i_071234fc
+	0x00, // xd0b8_add_l_aw_071234fc
+	0x00, // xd0b9_add_l_al_071234fc
+	0x00, // xd0ba_add_l_pcdi_071234fc
+	0x00, // xd0bb_add_l_pcix_071234fc
+	0x00, // xd0bc_add_l_i_071234fc
+	0x00, // xd0f8_adda_w_aw_071234fc
+	0x00, // xd0f9_adda_w_al_071234fc
+	0x00, // xd0fa_adda_w_pcdi_071234fc
+	0x00, // xd0fb_adda_w_pcix_071234fc
+	0x00, // xd0fc_adda_w_i_071234fc
+	0x00, // xd10f_addx_b_071234fc
+	0x00, // xd11f_add_b_pi7_071234fc
+	0x00, // xd127_add_b_pd7_071234fc
+	0x00, // xd138_add_b_aw_071234fc
+	0x00, // xd139_add_b_al_071234fc
+	0x00, // xd178_add_w_aw_071234fc
+	0x00, // xd179_add_w_al_071234fc
+	0x00, // xd1b8_add_l_aw_071234fc
+	0x00, // xd1b9_add_l_al_071234fc
+	0x00, // xd1f8_adda_l_aw_071234fc
+	0x00, // xd1f9_adda_l_al_071234fc
+	0x00, // xd1fa_adda_l_pcdi_071234fc
+	0x00, // xd1fb_adda_l_pcix_071234fc
+	0x00, // xd1fc_adda_l_i_071234fc
+	0x00, // x0000_ori_b_071234fc
+	0x00, // x0010_ori_b_ai_071234fc
+	0x00, // x0018_ori_b_pi_071234fc
+	0x00, // x0020_ori_b_pd_071234fc
+	0x00, // x0028_ori_b_di_071234fc
+	0x00, // x0030_ori_b_ix_071234fc
+	0x00, // x0040_ori_w_071234fc
+	0x00, // x0050_ori_w_ai_071234fc
+	0x00, // x0058_ori_w_pi_071234fc
+	0x00, // x0060_ori_w_pd_071234fc
+	0x00, // x0068_ori_w_di_071234fc
+	0x00, // x0070_ori_w_ix_071234fc
+	0x00, // x0080_ori_l_071234fc
+	0x00, // x0090_ori_l_ai_071234fc
+	0x00, // x0098_ori_l_pi_071234fc
+	0x00, // x00a0_ori_l_pd_071234fc
+	0x00, // x00a8_ori_l_di_071234fc
+	0x00, // x00b0_ori_l_ix_071234fc
+	0x12, // x00d0_chk2cmp2_b_ai_234fc
+	0x12, // x00e8_chk2cmp2_b_di_234fc
+	0x12, // x00f0_chk2cmp2_b_ix_234fc
+	0x00, // x0200_andi_b_071234fc
+	0x00, // x0210_andi_b_ai_071234fc
+	0x00, // x0218_andi_b_pi_071234fc
+	0x00, // x0220_andi_b_pd_071234fc
+	0x00, // x0228_andi_b_di_071234fc
+	0x00, // x0230_andi_b_ix_071234fc
+	0x00, // x0240_andi_w_071234fc
+	0x00, // x0250_andi_w_ai_071234fc
+	0x00, // x0258_andi_w_pi_071234fc
+	0x00, // x0260_andi_w_pd_071234fc
+	0x00, // x0268_andi_w_di_071234fc
+	0x00, // x0270_andi_w_ix_071234fc
+	0x00, // x0280_andi_l_071234fc
+	0x00, // x0290_andi_l_ai_071234fc
+	0x00, // x0298_andi_l_pi_071234fc
+	0x00, // x02a0_andi_l_pd_071234fc
+	0x00, // x02a8_andi_l_di_071234fc
+	0x00, // x02b0_andi_l_ix_071234fc
+	0x12, // x02d0_chk2cmp2_w_ai_234fc
+	0x12, // x02e8_chk2cmp2_w_di_234fc
+	0x12, // x02f0_chk2cmp2_w_ix_234fc
+	0x00, // x0400_subi_b_071234fc
+	0x00, // x0410_subi_b_ai_071234fc
+	0x00, // x0418_subi_b_pi_071234fc
+	0x00, // x0420_subi_b_pd_071234fc
+	0x00, // x0428_subi_b_di_071234fc
+	0x00, // x0430_subi_b_ix_071234fc
+	0x00, // x0440_subi_w_071234fc
+	0x00, // x0450_subi_w_ai_071234fc
+	0x00, // x0458_subi_w_pi_071234fc
+	0x00, // x0460_subi_w_pd_071234fc
+	0x00, // x0468_subi_w_di_071234fc
+	0x00, // x0470_subi_w_ix_071234fc
+	0x00, // x0480_subi_l_071234fc
+	0x00, // x0490_subi_l_ai_071234fc
+	0x00, // x0498_subi_l_pi_071234fc
+	0x00, // x04a0_subi_l_pd_071234fc
+	0x00, // x04a8_subi_l_di_071234fc
+	0x00, // x04b0_subi_l_ix_071234fc
+	0x12, // x04d0_chk2cmp2_l_ai_234fc
+	0x12, // x04e8_chk2cmp2_l_di_234fc
+	0x12, // x04f0_chk2cmp2_l_ix_234fc
+	0x00, // x0600_addi_b_071234fc
+	0x00, // x0610_addi_b_ai_071234fc
+	0x00, // x0618_addi_b_pi_071234fc
+	0x00, // x0620_addi_b_pd_071234fc
+	0x00, // x0628_addi_b_di_071234fc
+	0x00, // x0630_addi_b_ix_071234fc
+	0x00, // x0640_addi_w_071234fc
+	0x00, // x0650_addi_w_ai_071234fc
+	0x00, // x0658_addi_w_pi_071234fc
+	0x00, // x0660_addi_w_pd_071234fc
+	0x00, // x0668_addi_w_di_071234fc
+	0x00, // x0670_addi_w_ix_071234fc
+	0x00, // x0680_addi_l_071234fc
+	0x00, // x0690_addi_l_ai_071234fc
+	0x00, // x0698_addi_l_pi_071234fc
+	0x00, // x06a0_addi_l_pd_071234fc
+	0x00, // x06a8_addi_l_di_071234fc
+	0x00, // x06b0_addi_l_ix_071234fc
+	0x0c, // x06d0_callm_l_ai_2f
+	0x0c, // x06e8_callm_l_di_2f
+	0x0c, // x06f0_callm_l_ix_2f
+	0x00, // x0800_btst_l_071234fc
+	0x00, // x0810_btst_b_ai_071234fc
+	0x00, // x0818_btst_b_pi_071234fc
+	0x00, // x0820_btst_b_pd_071234fc
+	0x00, // x0828_btst_b_di_071234fc
+	0x00, // x0830_btst_b_ix_071234fc
+	0x00, // x0840_bchg_l_071234fc
+	0x00, // x0850_bchg_b_ai_071234fc
+	0x00, // x0858_bchg_b_pi_071234fc
+	0x00, // x0860_bchg_b_pd_071234fc
+	0x00, // x0868_bchg_b_di_071234fc
+	0x00, // x0870_bchg_b_ix_071234fc
+	0x00, // x0880_bclr_l_071234fc
+	0x00, // x0890_bclr_b_ai_071234fc
+	0x00, // x0898_bclr_b_pi_071234fc
+	0x00, // x08a0_bclr_b_pd_071234fc
+	0x00, // x08a8_bclr_b_di_071234fc
+	0x00, // x08b0_bclr_b_ix_071234fc
+	0x00, // x08c0_bset_l_071234fc
+	0x00, // x08d0_bset_b_ai_071234fc
+	0x00, // x08d8_bset_b_pi_071234fc
+	0x00, // x08e0_bset_b_pd_071234fc
+	0x00, // x08e8_bset_b_di_071234fc
+	0x00, // x08f0_bset_b_ix_071234fc
+	0x00, // x0a00_eori_b_071234fc
+	0x00, // x0a10_eori_b_ai_071234fc
+	0x00, // x0a18_eori_b_pi_071234fc
+	0x00, // x0a20_eori_b_pd_071234fc
+	0x00, // x0a28_eori_b_di_071234fc
+	0x00, // x0a30_eori_b_ix_071234fc
+	0x00, // x0a40_eori_w_071234fc
+	0x00, // x0a50_eori_w_ai_071234fc
+	0x00, // x0a58_eori_w_pi_071234fc
+	0x00, // x0a60_eori_w_pd_071234fc
+	0x00, // x0a68_eori_w_di_071234fc
+	0x00, // x0a70_eori_w_ix_071234fc
+	0x00, // x0a80_eori_l_071234fc
+	0x00, // x0a90_eori_l_ai_071234fc
+	0x00, // x0a98_eori_l_pi_071234fc
+	0x00, // x0aa0_eori_l_pd_071234fc
+	0x00, // x0aa8_eori_l_di_071234fc
+	0x00, // x0ab0_eori_l_ix_071234fc
+	0x00, // x0ad0_cas_b_ai_234fc
+	0x00, // x0ad8_cas_b_pi_234fc
+	0x00, // x0ae0_cas_b_pd_234fc
+	0x00, // x0ae8_cas_b_di_234fc
+	0x00, // x0af0_cas_b_ix_234fc
+	0x00, // x0c00_cmpi_b_071234fc
+	0x00, // x0c10_cmpi_b_ai_071234fc
+	0x00, // x0c18_cmpi_b_pi_071234fc
+	0x00, // x0c20_cmpi_b_pd_071234fc
+	0x00, // x0c28_cmpi_b_di_071234fc
+	0x00, // x0c30_cmpi_b_ix_071234fc
+	0x00, // x0c40_cmpi_w_071234fc
+	0x00, // x0c50_cmpi_w_ai_071234fc
+	0x00, // x0c58_cmpi_w_pi_071234fc
+	0x00, // x0c60_cmpi_w_pd_071234fc
+	0x00, // x0c68_cmpi_w_di_071234fc
+	0x00, // x0c70_cmpi_w_ix_071234fc
+	0x00, // x0c80_cmpi_l_071234fc
+	0x00, // x0c90_cmpi_l_ai_071234fc
+	0x00, // x0c98_cmpi_l_pi_071234fc
+	0x00, // x0ca0_cmpi_l_pd_071234fc
+	0x00, // x0ca8_cmpi_l_di_071234fc
+	0x00, // x0cb0_cmpi_l_ix_071234fc
+	0x00, // x0cd0_cas_w_ai_234fc
+	0x00, // x0cd8_cas_w_pi_234fc
+	0x00, // x0ce0_cas_w_pd_234fc
+	0x00, // x0ce8_cas_w_di_234fc
+	0x00, // x0cf0_cas_w_ix_234fc
+	0x20, // x0e10_moves_b_ai_134fc
+	0x20, // x0e10_moves_b_ai_2
+	0x20, // x0e18_moves_b_pi_134fc
+	0x20, // x0e18_moves_b_pi_2
+	0x20, // x0e20_moves_b_pd_134fc
+	0x20, // x0e20_moves_b_pd_2
+	0x20, // x0e28_moves_b_di_134fc
+	0x20, // x0e28_moves_b_di_2
+	0x20, // x0e30_moves_b_ix_134fc
+	0x20, // x0e30_moves_b_ix_2
+	0x20, // x0e50_moves_w_ai_134fc
+	0x20, // x0e50_moves_w_ai_2
+	0x20, // x0e58_moves_w_pi_134fc
+	0x20, // x0e58_moves_w_pi_2
+	0x20, // x0e60_moves_w_pd_134fc
+	0x20, // x0e60_moves_w_pd_2
+	0x20, // x0e68_moves_w_di_134fc
+	0x20, // x0e68_moves_w_di_2
+	0x20, // x0e70_moves_w_ix_134fc
+	0x20, // x0e70_moves_w_ix_2
+	0x20, // x0e90_moves_l_ai_134fc
+	0x20, // x0e90_moves_l_ai_2
+	0x20, // x0e98_moves_l_pi_134fc
+	0x20, // x0e98_moves_l_pi_2
+	0x20, // x0ea0_moves_l_pd_134fc
+	0x20, // x0ea0_moves_l_pd_2
+	0x20, // x0ea8_moves_l_di_134fc
+	0x20, // x0ea8_moves_l_di_2
+	0x20, // x0eb0_moves_l_ix_134fc
+	0x20, // x0eb0_moves_l_ix_2
+	0x00, // x0ed0_cas_l_ai_234fc
+	0x00, // x0ed8_cas_l_pi_234fc
+	0x00, // x0ee0_cas_l_pd_234fc
+	0x00, // x0ee8_cas_l_di_234fc
+	0x00, // x0ef0_cas_l_ix_234fc
+	0x00, // x11c0_move_b_071234fc
+	0x00, // x11d0_move_b_ai_071234fc
+	0x00, // x11d8_move_b_pi_071234fc
+	0x00, // x11e0_move_b_pd_071234fc
+	0x00, // x11e8_move_b_di_071234fc
+	0x00, // x11f0_move_b_ix_071234fc
+	0x00, // x13c0_move_b_071234fc
+	0x00, // x13d0_move_b_ai_071234fc
+	0x00, // x13d8_move_b_pi_071234fc
+	0x00, // x13e0_move_b_pd_071234fc
+	0x00, // x13e8_move_b_di_071234fc
+	0x00, // x13f0_move_b_ix_071234fc
+	0x00, // x1ec0_move_b_071234fc
+	0x00, // x1ed0_move_b_ai_071234fc
+	0x00, // x1ed8_move_b_pi_071234fc
+	0x00, // x1ee0_move_b_pd_071234fc
+	0x00, // x1ee8_move_b_di_071234fc
+	0x00, // x1ef0_move_b_ix_071234fc
+	0x00, // x1f00_move_b_071234fc
+	0x00, // x1f10_move_b_ai_071234fc
+	0x00, // x1f18_move_b_pi_071234fc
+	0x00, // x1f20_move_b_pd_071234fc
+	0x00, // x1f28_move_b_di_071234fc
+	0x00, // x1f30_move_b_ix_071234fc
+	0x00, // x21c0_move_l_071234fc
+	0x00, // x21c8_move_l_071234fc
+	0x00, // x21d0_move_l_ai_071234fc
+	0x00, // x21d8_move_l_pi_071234fc
+	0x00, // x21e0_move_l_pd_071234fc
+	0x00, // x21e8_move_l_di_071234fc
+	0x00, // x21f0_move_l_ix_071234fc
+	0x00, // x23c0_move_l_071234fc
+	0x00, // x23c8_move_l_071234fc
+	0x00, // x23d0_move_l_ai_071234fc
+	0x00, // x23d8_move_l_pi_071234fc
+	0x00, // x23e0_move_l_pd_071234fc
+	0x00, // x23e8_move_l_di_071234fc
+	0x00, // x23f0_move_l_ix_071234fc
+	0x00, // x31c0_move_w_071234fc
+	0x00, // x31c8_move_w_071234fc
+	0x00, // x31d0_move_w_ai_071234fc
+	0x00, // x31d8_move_w_pi_071234fc
+	0x00, // x31e0_move_w_pd_071234fc
+	0x00, // x31e8_move_w_di_071234fc
+	0x00, // x31f0_move_w_ix_071234fc
+	0x00, // x33c0_move_w_071234fc
+	0x00, // x33c8_move_w_071234fc
+	0x00, // x33d0_move_w_ai_071234fc
+	0x00, // x33d8_move_w_pi_071234fc
+	0x00, // x33e0_move_w_pd_071234fc
+	0x00, // x33e8_move_w_di_071234fc
+	0x00, // x33f0_move_w_ix_071234fc
+	0x00, // x4000_negx_b_071234fc
+	0x00, // x4010_negx_b_ai_071234fc
+	0x00, // x4018_negx_b_pi_071234fc
+	0x00, // x4020_negx_b_pd_071234fc
+	0x00, // x4028_negx_b_di_071234fc
+	0x00, // x4030_negx_b_ix_071234fc
+	0x00, // x4040_negx_w_071234fc
+	0x00, // x4050_negx_w_ai_071234fc
+	0x00, // x4058_negx_w_pi_071234fc
+	0x00, // x4060_negx_w_pd_071234fc
+	0x00, // x4068_negx_w_di_071234fc
+	0x00, // x4070_negx_w_ix_071234fc
+	0x00, // x4080_negx_l_071234fc
+	0x00, // x4090_negx_l_ai_071234fc
+	0x00, // x4098_negx_l_pi_071234fc
+	0x00, // x40a0_negx_l_pd_071234fc
+	0x00, // x40a8_negx_l_di_071234fc
+	0x00, // x40b0_negx_l_ix_071234fc
+	0x00, // x40c0_move_w_07
+	0x00, // x40c0_move_w_1234fc
+	0x00, // x40d0_move_w_ai_07
+	0x00, // x40d0_move_w_ai_1234fc
+	0x00, // x40d8_move_w_pi_07
+	0x00, // x40d8_move_w_pi_1234fc
+	0x00, // x40e0_move_w_pd_07
+	0x00, // x40e0_move_w_pd_1234fc
+	0x00, // x40e8_move_w_di_07
+	0x00, // x40e8_move_w_di_1234fc
+	0x00, // x40f0_move_w_ix_07
+	0x00, // x40f0_move_w_ix_1234fc
+	0x00, // x4200_clr_b_071234fc
+	0x00, // x4210_clr_b_ai_0
+	0x00, // x4210_clr_b_ai_71234fc
+	0x00, // x4218_clr_b_pi_0
+	0x00, // x4218_clr_b_pi_71234fc
+	0x00, // x4220_clr_b_pd_0
+	0x00, // x4220_clr_b_pd_71234fc
+	0x00, // x4228_clr_b_di_0
+	0x00, // x4228_clr_b_di_71234fc
+	0x00, // x4230_clr_b_ix_0
+	0x00, // x4230_clr_b_ix_71234fc
+	0x00, // x4240_clr_w_071234fc
+	0x00, // x4250_clr_w_ai_0
+	0x00, // x4250_clr_w_ai_71234fc
+	0x00, // x4258_clr_w_pi_0
+	0x00, // x4258_clr_w_pi_71234fc
+	0x00, // x4260_clr_w_pd_0
+	0x00, // x4260_clr_w_pd_71234fc
+	0x00, // x4268_clr_w_di_0
+	0x00, // x4268_clr_w_di_71234fc
+	0x00, // x4270_clr_w_ix_0
+	0x00, // x4270_clr_w_ix_71234fc
+	0x00, // x4280_clr_l_071234fc
+	0x00, // x4290_clr_l_ai_0
+	0x00, // x4290_clr_l_ai_71234fc
+	0x00, // x4298_clr_l_pi_0
+	0x00, // x4298_clr_l_pi_71234fc
+	0x00, // x42a0_clr_l_pd_0
+	0x00, // x42a0_clr_l_pd_71234fc
+	0x00, // x42a8_clr_l_di_0
+	0x00, // x42a8_clr_l_di_71234fc
+	0x00, // x42b0_clr_l_ix_0
+	0x00, // x42b0_clr_l_ix_71234fc
+	0x00, // x42c0_move_w_1234fc
+	0x00, // x42d0_move_w_ai_1234fc
+	0x00, // x42d8_move_w_pi_1234fc
+	0x00, // x42e0_move_w_pd_1234fc
+	0x00, // x42e8_move_w_di_1234fc
+	0x00, // x42f0_move_w_ix_1234fc
+	0x00, // x4400_neg_b_071234fc
+	0x00, // x4410_neg_b_ai_071234fc
+	0x00, // x4418_neg_b_pi_071234fc
+	0x00, // x4420_neg_b_pd_071234fc
+	0x00, // x4428_neg_b_di_071234fc
+	0x00, // x4430_neg_b_ix_071234fc
+	0x00, // x4440_neg_w_071234fc
+	0x00, // x4450_neg_w_ai_071234fc
+	0x00, // x4458_neg_w_pi_071234fc
+	0x00, // x4460_neg_w_pd_071234fc
+	0x00, // x4468_neg_w_di_071234fc
+	0x00, // x4470_neg_w_ix_071234fc
+	0x00, // x4480_neg_l_071234fc
+	0x00, // x4490_neg_l_ai_071234fc
+	0x00, // x4498_neg_l_pi_071234fc
+	0x00, // x44a0_neg_l_pd_071234fc
+	0x00, // x44a8_neg_l_di_071234fc
+	0x00, // x44b0_neg_l_ix_071234fc
+	0x00, // x44c0_move_w_071234fc
+	0x00, // x44d0_move_w_ai_071234fc
+	0x00, // x44d8_move_w_pi_071234fc
+	0x00, // x44e0_move_w_pd_071234fc
+	0x00, // x44e8_move_w_di_071234fc
+	0x00, // x44f0_move_w_ix_071234fc
+	0x00, // x4600_not_b_071234fc
+	0x00, // x4610_not_b_ai_071234fc
+	0x00, // x4618_not_b_pi_071234fc
+	0x00, // x4620_not_b_pd_071234fc
+	0x00, // x4628_not_b_di_071234fc
+	0x00, // x4630_not_b_ix_071234fc
+	0x00, // x4640_not_w_071234fc
+	0x00, // x4650_not_w_ai_071234fc
+	0x00, // x4658_not_w_pi_071234fc
+	0x00, // x4660_not_w_pd_071234fc
+	0x00, // x4668_not_w_di_071234fc
+	0x00, // x4670_not_w_ix_071234fc
+	0x00, // x4680_not_l_071234fc
+	0x00, // x4690_not_l_ai_071234fc
+	0x00, // x4698_not_l_pi_071234fc
+	0x00, // x46a0_not_l_pd_071234fc
+	0x00, // x46a8_not_l_di_071234fc
+	0x00, // x46b0_not_l_ix_071234fc
+	0x20, // x46c0_move_w_071234fc
+	0x20, // x46d0_move_w_ai_071234fc
+	0x20, // x46d8_move_w_pi_071234fc
+	0x20, // x46e0_move_w_pd_071234fc
+	0x20, // x46e8_move_w_di_071234fc
+	0x20, // x46f0_move_w_ix_071234fc
+	0x00, // x4800_nbcd_b_071234fc
+	0x00, // x4808_link_l_234fc
+	0x00, // x4810_nbcd_b_ai_071234fc
+	0x00, // x4818_nbcd_b_pi_071234fc
+	0x00, // x4820_nbcd_b_pd_071234fc
+	0x00, // x4828_nbcd_b_di_071234fc
+	0x00, // x4830_nbcd_b_ix_071234fc
+	0x00, // x4840_swap_l_071234fc
+	0x10, // x4848_bkpt_1
+	0x10, // x4848_bkpt_234fc
+	0x00, // x4850_pea_l_ai_071234fc
+	0x00, // x4868_pea_l_di_071234fc
+	0x00, // x4870_pea_l_ix_071234fc
+	0x00, // x4880_ext_w_071234fc
+	0x00, // x4890_movem_w_ai_071234fc
+	0x00, // x48a0_movem_w_071234fc
+	0x00, // x48a8_movem_w_di_071234fc
+	0x00, // x48b0_movem_w_ix_071234fc
+	0x00, // x48c0_ext_l_071234fc
+	0x00, // x48d0_movem_l_ai_071234fc
+	0x00, // x48e0_movem_l_071234fc
+	0x00, // x48e8_movem_l_di_071234fc
+	0x00, // x48f0_movem_l_ix_071234fc
+	0x00, // x49c0_extb_l_234fc
+	0x00, // x4a00_tst_b_071234fc
+	0x00, // x4a10_tst_b_ai_071234fc
+	0x00, // x4a18_tst_b_pi_071234fc
+	0x00, // x4a20_tst_b_pd_071234fc
+	0x00, // x4a28_tst_b_di_071234fc
+	0x00, // x4a30_tst_b_ix_071234fc
+	0x00, // x4a40_tst_w_071234fc
+	0x00, // x4a48_tst_w_234fc
+	0x00, // x4a50_tst_w_ai_071234fc
+	0x00, // x4a58_tst_w_pi_071234fc
+	0x00, // x4a60_tst_w_pd_071234fc
+	0x00, // x4a68_tst_w_di_071234fc
+	0x00, // x4a70_tst_w_ix_071234fc
+	0x00, // x4a80_tst_l_071234fc
+	0x00, // x4a88_tst_l_234fc
+	0x00, // x4a90_tst_l_ai_071234fc
+	0x00, // x4a98_tst_l_pi_071234fc
+	0x00, // x4aa0_tst_l_pd_071234fc
+	0x00, // x4aa8_tst_l_di_071234fc
+	0x00, // x4ab0_tst_l_ix_071234fc
+	0x00, // x4ac0_tas_b_071234fc
+	0x00, // x4ad0_tas_b_ai_071234fc
+	0x00, // x4ad8_tas_b_pi_071234fc
+	0x00, // x4ae0_tas_b_pd_071234fc
+	0x00, // x4ae8_tas_b_di_071234fc
+	0x00, // x4af0_tas_b_ix_071234fc
+	0x00, // x4c00_mull_l_234fc
+	0x00, // x4c10_mull_l_ai_234fc
+	0x00, // x4c18_mull_l_pi_234fc
+	0x00, // x4c20_mull_l_pd_234fc
+	0x00, // x4c28_mull_l_di_234fc
+	0x00, // x4c30_mull_l_ix_234fc
+	0x00, // x4c40_divl_l_234fc
+	0x00, // x4c50_divl_l_ai_234fc
+	0x00, // x4c58_divl_l_pi_234fc
+	0x00, // x4c60_divl_l_pd_234fc
+	0x00, // x4c68_divl_l_di_234fc
+	0x00, // x4c70_divl_l_ix_234fc
+	0x00, // x4c90_movem_w_ai_071234fc
+	0x00, // x4c98_movem_w_071234fc
+	0x00, // x4ca8_movem_w_di_071234fc
+	0x00, // x4cb0_movem_w_ix_071234fc
+	0x00, // x4cd0_movem_l_ai_071234fc
+	0x00, // x4cd8_movem_l_071234fc
+	0x00, // x4ce8_movem_l_di_071234fc
+	0x00, // x4cf0_movem_l_ix_071234fc
+	0x00, // x4e50_link_w_071234fc
+	0x00, // x4e58_unlk_l_071234fc
+	0x20, // x4e60_move_l_071234fc
+	0x20, // x4e68_move_l_071234fc
+	0x0c, // x4e90_jsr_l_ai_071234fc
+	0x0c, // x4ea8_jsr_l_di_071234fc
+	0x0c, // x4eb0_jsr_l_ix_071234fc
+	0x04, // x4ed0_jmp_l_ai_071234fc
+	0x04, // x4ee8_jmp_l_di_071234fc
+	0x04, // x4ef0_jmp_l_ix_071234fc
+	0x00, // x50c0_st_b_071234fc
+	0x00, // x50c8_dbt_w_071234fc
+	0x00, // x50d0_st_b_ai_071234fc
+	0x00, // x50d8_st_b_pi_071234fc
+	0x00, // x50e0_st_b_pd_071234fc
+	0x00, // x50e8_st_b_di_071234fc
+	0x00, // x50f0_st_b_ix_071234fc
+	0x00, // x51c0_sf_b_071234fc
+	0x03, // x51c8_dbf_w_071234fc
+	0x00, // x51d0_sf_b_ai_071234fc
+	0x00, // x51d8_sf_b_pi_071234fc
+	0x00, // x51e0_sf_b_pd_071234fc
+	0x00, // x51e8_sf_b_di_071234fc
+	0x00, // x51f0_sf_b_ix_071234fc
+	0x00, // x52c0_shi_b_071234fc
+	0x03, // x52c8_dbhi_w_071234fc
+	0x00, // x52d0_shi_b_ai_071234fc
+	0x00, // x52d8_shi_b_pi_071234fc
+	0x00, // x52e0_shi_b_pd_071234fc
+	0x00, // x52e8_shi_b_di_071234fc
+	0x00, // x52f0_shi_b_ix_071234fc
+	0x00, // x53c0_sls_b_071234fc
+	0x03, // x53c8_dbls_w_071234fc
+	0x00, // x53d0_sls_b_ai_071234fc
+	0x00, // x53d8_sls_b_pi_071234fc
+	0x00, // x53e0_sls_b_pd_071234fc
+	0x00, // x53e8_sls_b_di_071234fc
+	0x00, // x53f0_sls_b_ix_071234fc
+	0x00, // x54c0_scc_b_071234fc
+	0x03, // x54c8_dbcc_w_071234fc
+	0x00, // x54d0_scc_b_ai_071234fc
+	0x00, // x54d8_scc_b_pi_071234fc
+	0x00, // x54e0_scc_b_pd_071234fc
+	0x00, // x54e8_scc_b_di_071234fc
+	0x00, // x54f0_scc_b_ix_071234fc
+	0x00, // x55c0_scs_b_071234fc
+	0x03, // x55c8_dbcs_w_071234fc
+	0x00, // x55d0_scs_b_ai_071234fc
+	0x00, // x55d8_scs_b_pi_071234fc
+	0x00, // x55e0_scs_b_pd_071234fc
+	0x00, // x55e8_scs_b_di_071234fc
+	0x00, // x55f0_scs_b_ix_071234fc
+	0x00, // x56c0_sne_b_071234fc
+	0x03, // x56c8_dbne_w_071234fc
+	0x00, // x56d0_sne_b_ai_071234fc
+	0x00, // x56d8_sne_b_pi_071234fc
+	0x00, // x56e0_sne_b_pd_071234fc
+	0x00, // x56e8_sne_b_di_071234fc
+	0x00, // x56f0_sne_b_ix_071234fc
+	0x00, // x57c0_seq_b_071234fc
+	0x03, // x57c8_dbeq_w_071234fc
+	0x00, // x57d0_seq_b_ai_071234fc
+	0x00, // x57d8_seq_b_pi_071234fc
+	0x00, // x57e0_seq_b_pd_071234fc
+	0x00, // x57e8_seq_b_di_071234fc
+	0x00, // x57f0_seq_b_ix_071234fc
+	0x00, // x58c0_svc_b_071234fc
+	0x03, // x58c8_dbvc_w_071234fc
+	0x00, // x58d0_svc_b_ai_071234fc
+	0x00, // x58d8_svc_b_pi_071234fc
+	0x00, // x58e0_svc_b_pd_071234fc
+	0x00, // x58e8_svc_b_di_071234fc
+	0x00, // x58f0_svc_b_ix_071234fc
+	0x00, // x59c0_svs_b_071234fc
+	0x03, // x59c8_dbvs_w_071234fc
+	0x00, // x59d0_svs_b_ai_071234fc
+	0x00, // x59d8_svs_b_pi_071234fc
+	0x00, // x59e0_svs_b_pd_071234fc
+	0x00, // x59e8_svs_b_di_071234fc
+	0x00, // x59f0_svs_b_ix_071234fc
+	0x00, // x5ac0_spl_b_071234fc
+	0x03, // x5ac8_dbpl_w_071234fc
+	0x00, // x5ad0_spl_b_ai_071234fc
+	0x00, // x5ad8_spl_b_pi_071234fc
+	0x00, // x5ae0_spl_b_pd_071234fc
+	0x00, // x5ae8_spl_b_di_071234fc
+	0x00, // x5af0_spl_b_ix_071234fc
+	0x00, // x5bc0_smi_b_071234fc
+	0x03, // x5bc8_dbmi_w_071234fc
+	0x00, // x5bd0_smi_b_ai_071234fc
+	0x00, // x5bd8_smi_b_pi_071234fc
+	0x00, // x5be0_smi_b_pd_071234fc
+	0x00, // x5be8_smi_b_di_071234fc
+	0x00, // x5bf0_smi_b_ix_071234fc
+	0x00, // x5cc0_sge_b_071234fc
+	0x03, // x5cc8_dbge_w_071234fc
+	0x00, // x5cd0_sge_b_ai_071234fc
+	0x00, // x5cd8_sge_b_pi_071234fc
+	0x00, // x5ce0_sge_b_pd_071234fc
+	0x00, // x5ce8_sge_b_di_071234fc
+	0x00, // x5cf0_sge_b_ix_071234fc
+	0x00, // x5dc0_slt_b_071234fc
+	0x03, // x5dc8_dblt_w_071234fc
+	0x00, // x5dd0_slt_b_ai_071234fc
+	0x00, // x5dd8_slt_b_pi_071234fc
+	0x00, // x5de0_slt_b_pd_071234fc
+	0x00, // x5de8_slt_b_di_071234fc
+	0x00, // x5df0_slt_b_ix_071234fc
+	0x00, // x5ec0_sgt_b_071234fc
+	0x03, // x5ec8_dbgt_w_071234fc
+	0x00, // x5ed0_sgt_b_ai_071234fc
+	0x00, // x5ed8_sgt_b_pi_071234fc
+	0x00, // x5ee0_sgt_b_pd_071234fc
+	0x00, // x5ee8_sgt_b_di_071234fc
+	0x00, // x5ef0_sgt_b_ix_071234fc
+	0x00, // x5fc0_sle_b_071234fc
+	0x03, // x5fc8_dble_w_071234fc
+	0x00, // x5fd0_sle_b_ai_071234fc
+	0x00, // x5fd8_sle_b_pi_071234fc
+	0x00, // x5fe0_sle_b_pd_071234fc
+	0x00, // x5fe8_sle_b_di_071234fc
+	0x00, // x5ff0_sle_b_ix_071234fc
+	0x00, // x8f08_sbcd_b_071234fc
+	0x00, // x8f48_pack_w_234fc
+	0x00, // x8f88_unpk_w_234fc
+	0x00, // x9f08_subx_b_071234fc
+	0x00, // xbf08_cmpm_b_071234fc
+	0x00, // xcf08_abcd_b_071234fc
+	0x00, // xdf08_addx_b_071234fc
+	0x00, // xe0d0_asr_w_ai_071234fc
+	0x00, // xe0d8_asr_w_pi_071234fc
+	0x00, // xe0e0_asr_w_pd_071234fc
+	0x00, // xe0e8_asr_w_di_071234fc
+	0x00, // xe0f0_asr_w_ix_071234fc
+	0x00, // xe1d0_asl_w_ai_071234fc
+	0x00, // xe1d8_asl_w_pi_071234fc
+	0x00, // xe1e0_asl_w_pd_071234fc
+	0x00, // xe1e8_asl_w_di_071234fc
+	0x00, // xe1f0_asl_w_ix_071234fc
+	0x00, // xe2d0_lsr_w_ai_071234fc
+	0x00, // xe2d8_lsr_w_pi_071234fc
+	0x00, // xe2e0_lsr_w_pd_071234fc
+	0x00, // xe2e8_lsr_w_di_071234fc
+	0x00, // xe2f0_lsr_w_ix_071234fc
+	0x00, // xe3d0_lsl_w_ai_071234fc
+	0x00, // xe3d8_lsl_w_pi_071234fc
+	0x00, // xe3e0_lsl_w_pd_071234fc
+	0x00, // xe3e8_lsl_w_di_071234fc
+	0x00, // xe3f0_lsl_w_ix_071234fc
+	0x00, // xe4d0_roxr_w_ai_071234fc
+	0x00, // xe4d8_roxr_w_pi_071234fc
+	0x00, // xe4e0_roxr_w_pd_071234fc
+	0x00, // xe4e8_roxr_w_di_071234fc
+	0x00, // xe4f0_roxr_w_ix_071234fc
+	0x00, // xe5d0_roxl_w_ai_071234fc
+	0x00, // xe5d8_roxl_w_pi_071234fc
+	0x00, // xe5e0_roxl_w_pd_071234fc
+	0x00, // xe5e8_roxl_w_di_071234fc
+	0x00, // xe5f0_roxl_w_ix_071234fc
+	0x00, // xe6d0_ror_w_ai_071234fc
+	0x00, // xe6d8_ror_w_pi_071234fc
+	0x00, // xe6e0_ror_w_pd_071234fc
+	0x00, // xe6e8_ror_w_di_071234fc
+	0x00, // xe6f0_ror_w_ix_071234fc
+	0x00, // xe7d0_rol_w_ai_071234fc
+	0x00, // xe7d8_rol_w_pi_071234fc
+	0x00, // xe7e0_rol_w_pd_071234fc
+	0x00, // xe7e8_rol_w_di_071234fc
+	0x00, // xe7f0_rol_w_ix_071234fc
+	0x00, // xe8c0_bftst_l_234fc
+	0x00, // xe8d0_bftst_l_ai_234fc
+	0x00, // xe8e8_bftst_l_di_234fc
+	0x00, // xe8f0_bftst_l_ix_234fc
+	0x00, // xe9c0_bfextu_l_234fc
+	0x00, // xe9d0_bfextu_l_ai_234fc
+	0x00, // xe9e8_bfextu_l_di_234fc
+	0x00, // xe9f0_bfextu_l_ix_234fc
+	0x00, // xeac0_bfchg_l_234fc
+	0x00, // xead0_bfchg_l_ai_234fc
+	0x00, // xeae8_bfchg_l_di_234fc
+	0x00, // xeaf0_bfchg_l_ix_234fc
+	0x00, // xebc0_bfexts_l_234fc
+	0x00, // xebd0_bfexts_l_ai_234fc
+	0x00, // xebe8_bfexts_l_di_234fc
+	0x00, // xebf0_bfexts_l_ix_234fc
+	0x00, // xecc0_bfclr_l_234fc
+	0x00, // xecd0_bfclr_l_ai_234fc
+	0x00, // xece8_bfclr_l_di_234fc
+	0x00, // xecf0_bfclr_l_ix_234fc
+	0x00, // xedc0_bfffo_l_234fc
+	0x00, // xedd0_bfffo_l_ai_234fc
+	0x00, // xede8_bfffo_l_di_234fc
+	0x00, // xedf0_bfffo_l_ix_234fc
+	0x00, // xeec0_bfset_l_234fc
+	0x00, // xeed0_bfset_l_ai_234fc
+	0x00, // xeee8_bfset_l_di_234fc
+	0x00, // xeef0_bfset_l_ix_234fc
+	0x00, // xefc0_bfins_l_234fc
+	0x00, // xefd0_bfins_l_ai_234fc
+	0x00, // xefe8_bfins_l_di_234fc
+	0x00, // xeff0_bfins_l_ix_234fc
+	0x12, // xf278_ftrapcc_l_23
+	0x20, // xf510_pflushan_l_4fc
+	0x20, // xf518_pflusha_l_4fc
+	0x00, // xf620_move16_l_4fc
+	0x00, // x001f_ori_b_pi7_071234fc
+	0x00, // x0027_ori_b_pd7_071234fc
+	0x00, // x0038_ori_b_aw_071234fc
+	0x00, // x0039_ori_b_al_071234fc
+	0x00, // x003c_ori_w_071234fc
+	0x00, // x0078_ori_w_aw_071234fc
+	0x00, // x0079_ori_w_al_071234fc
+	0x20, // x007c_ori_w_071234fc
+	0x00, // x00b8_ori_l_aw_071234fc
+	0x00, // x00b9_ori_l_al_071234fc
+	0x12, // x00f8_chk2cmp2_b_aw_234fc
+	0x12, // x00f9_chk2cmp2_b_al_234fc
+	0x12, // x00fa_chk2cmp2_b_234fc
+	0x12, // x00fb_chk2cmp2_b_234fc
+	0x00, // x021f_andi_b_pi7_071234fc
+	0x00, // x0227_andi_b_pd7_071234fc
+	0x00, // x0238_andi_b_aw_071234fc
+	0x00, // x0239_andi_b_al_071234fc
+	0x00, // x023c_andi_w_071234fc
+	0x00, // x0278_andi_w_aw_071234fc
+	0x00, // x0279_andi_w_al_071234fc
+	0x20, // x027c_andi_w_071234fc
+	0x00, // x02b8_andi_l_aw_071234fc
+	0x00, // x02b9_andi_l_al_071234fc
+	0x12, // x02f8_chk2cmp2_w_aw_234fc
+	0x12, // x02f9_chk2cmp2_w_al_234fc
+	0x12, // x02fa_chk2cmp2_w_234fc
+	0x12, // x02fb_chk2cmp2_w_234fc
+	0x00, // x041f_subi_b_pi7_071234fc
+	0x00, // x0427_subi_b_pd7_071234fc
+	0x00, // x0438_subi_b_aw_071234fc
+	0x00, // x0439_subi_b_al_071234fc
+	0x00, // x0478_subi_w_aw_071234fc
+	0x00, // x0479_subi_w_al_071234fc
+	0x00, // x04b8_subi_l_aw_071234fc
+	0x00, // x04b9_subi_l_al_071234fc
+	0x12, // x04f8_chk2cmp2_l_aw_234fc
+	0x12, // x04f9_chk2cmp2_l_al_234fc
+	0x12, // x04fa_chk2cmp2_l_234fc
+	0x12, // x04fb_chk2cmp2_l_234fc
+	0x00, // x061f_addi_b_pi7_071234fc
+	0x00, // x0627_addi_b_pd7_071234fc
+	0x00, // x0638_addi_b_aw_071234fc
+	0x00, // x0639_addi_b_al_071234fc
+	0x00, // x0678_addi_w_aw_071234fc
+	0x00, // x0679_addi_w_al_071234fc
+	0x00, // x06b8_addi_l_aw_071234fc
+	0x00, // x06b9_addi_l_al_071234fc
+	0x0c, // x06f8_callm_l_aw_2f
+	0x0c, // x06f9_callm_l_al_2f
+	0x0c, // x06fa_callm_l_pcdi_2f
+	0x0c, // x06fb_callm_l_pcix_2f
+	0x00, // x081f_btst_b_pi7_071234fc
+	0x00, // x0827_btst_b_pd7_071234fc
+	0x00, // x0838_btst_b_aw_071234fc
+	0x00, // x0839_btst_b_al_071234fc
+	0x00, // x083a_btst_b_pcdi_071234fc
+	0x00, // x083b_btst_b_pcix_071234fc
+	0x00, // x085f_bchg_b_pi7_071234fc
+	0x00, // x0867_bchg_b_pd7_071234fc
+	0x00, // x0878_bchg_b_aw_071234fc
+	0x00, // x0879_bchg_b_al_071234fc
+	0x00, // x089f_bclr_b_pi7_071234fc
+	0x00, // x08a7_bclr_b_pd7_071234fc
+	0x00, // x08b8_bclr_b_aw_071234fc
+	0x00, // x08b9_bclr_b_al_071234fc
+	0x00, // x08df_bset_b_pi7_071234fc
+	0x00, // x08e7_bset_b_pd7_071234fc
+	0x00, // x08f8_bset_b_aw_071234fc
+	0x00, // x08f9_bset_b_al_071234fc
+	0x00, // x0a1f_eori_b_pi7_071234fc
+	0x00, // x0a27_eori_b_pd7_071234fc
+	0x00, // x0a38_eori_b_aw_071234fc
+	0x00, // x0a39_eori_b_al_071234fc
+	0x00, // x0a3c_eori_w_071234fc
+	0x00, // x0a78_eori_w_aw_071234fc
+	0x00, // x0a79_eori_w_al_071234fc
+	0x20, // x0a7c_eori_w_071234fc
+	0x00, // x0ab8_eori_l_aw_071234fc
+	0x00, // x0ab9_eori_l_al_071234fc
+	0x00, // x0adf_cas_b_pi7_234fc
+	0x00, // x0ae7_cas_b_pd7_234fc
+	0x00, // x0af8_cas_b_aw_234fc
+	0x00, // x0af9_cas_b_al_234fc
+	0x00, // x0c1f_cmpi_b_pi7_071234fc
+	0x00, // x0c27_cmpi_b_pd7_071234fc
+	0x00, // x0c38_cmpi_b_aw_071234fc
+	0x00, // x0c39_cmpi_b_al_071234fc
+	0x00, // x0c3a_cmpi_b_234fc
+	0x00, // x0c3b_cmpi_b_234fc
+	0x00, // x0c78_cmpi_w_aw_071234fc
+	0x00, // x0c79_cmpi_w_al_071234fc
+	0x00, // x0c7a_cmpi_w_234fc
+	0x00, // x0c7b_cmpi_w_234fc
+	0x00, // x0cb8_cmpi_l_aw_071234fc
+	0x00, // x0cb9_cmpi_l_al_071234fc
+	0x00, // x0cba_cmpi_l_234fc
+	0x00, // x0cbb_cmpi_l_234fc
+	0x00, // x0cf8_cas_w_aw_234fc
+	0x00, // x0cf9_cas_w_al_234fc
+	0x00, // x0cfc_cas2_w_234fc
+	0x20, // x0e1f_moves_b_pi7_134fc
+	0x20, // x0e1f_moves_b_pi7_2
+	0x20, // x0e27_moves_b_pd7_134fc
+	0x20, // x0e27_moves_b_pd7_2
+	0x20, // x0e38_moves_b_aw_134fc
+	0x20, // x0e38_moves_b_aw_2
+	0x20, // x0e39_moves_b_al_134fc
+	0x20, // x0e39_moves_b_al_2
+	0x20, // x0e78_moves_w_aw_134fc
+	0x20, // x0e78_moves_w_aw_2
+	0x20, // x0e79_moves_w_al_134fc
+	0x20, // x0e79_moves_w_al_2
+	0x20, // x0eb8_moves_l_aw_134fc
+	0x20, // x0eb8_moves_l_aw_2
+	0x20, // x0eb9_moves_l_al_134fc
+	0x20, // x0eb9_moves_l_al_2
+	0x00, // x0ef8_cas_l_aw_234fc
+	0x00, // x0ef9_cas_l_al_234fc
+	0x00, // x0efc_cas2_l_234fc
+	0x00, // x11df_move_b_pi7_071234fc
+	0x00, // x11e7_move_b_pd7_071234fc
+	0x00, // x11f8_move_b_aw_071234fc
+	0x00, // x11f9_move_b_al_071234fc
+	0x00, // x11fa_move_b_pcdi_071234fc
+	0x00, // x11fb_move_b_pcix_071234fc
+	0x00, // x11fc_move_b_i_071234fc
+	0x00, // x13df_move_b_pi7_071234fc
+	0x00, // x13e7_move_b_pd7_071234fc
+	0x00, // x13f8_move_b_aw_071234fc
+	0x00, // x13f9_move_b_al_071234fc
+	0x00, // x13fa_move_b_pcdi_071234fc
+	0x00, // x13fb_move_b_pcix_071234fc
+	0x00, // x13fc_move_b_i_071234fc
+	0x00, // x1edf_move_b_pi7_071234fc
+	0x00, // x1ee7_move_b_pd7_071234fc
+	0x00, // x1ef8_move_b_aw_071234fc
+	0x00, // x1ef9_move_b_al_071234fc
+	0x00, // x1efa_move_b_pcdi_071234fc
+	0x00, // x1efb_move_b_pcix_071234fc
+	0x00, // x1efc_move_b_i_071234fc
+	0x00, // x1f1f_move_b_pi7_071234fc
+	0x00, // x1f27_move_b_pd7_071234fc
+	0x00, // x1f38_move_b_aw_071234fc
+	0x00, // x1f39_move_b_al_071234fc
+	0x00, // x1f3a_move_b_pcdi_071234fc
+	0x00, // x1f3b_move_b_pcix_071234fc
+	0x00, // x1f3c_move_b_i_071234fc
+	0x00, // x21f8_move_l_aw_071234fc
+	0x00, // x21f9_move_l_al_071234fc
+	0x00, // x21fa_move_l_pcdi_071234fc
+	0x00, // x21fb_move_l_pcix_071234fc
+	0x00, // x21fc_move_l_i_071234fc
+	0x00, // x23f8_move_l_aw_071234fc
+	0x00, // x23f9_move_l_al_071234fc
+	0x00, // x23fa_move_l_pcdi_071234fc
+	0x00, // x23fb_move_l_pcix_071234fc
+	0x00, // x23fc_move_l_i_071234fc
+	0x00, // x31f8_move_w_aw_071234fc
+	0x00, // x31f9_move_w_al_071234fc
+	0x00, // x31fa_move_w_pcdi_071234fc
+	0x00, // x31fb_move_w_pcix_071234fc
+	0x00, // x31fc_move_w_i_071234fc
+	0x00, // x33f8_move_w_aw_071234fc
+	0x00, // x33f9_move_w_al_071234fc
+	0x00, // x33fa_move_w_pcdi_071234fc
+	0x00, // x33fb_move_w_pcix_071234fc
+	0x00, // x33fc_move_w_i_071234fc
+	0x00, // x401f_negx_b_pi7_071234fc
+	0x00, // x4027_negx_b_pd7_071234fc
+	0x00, // x4038_negx_b_aw_071234fc
+	0x00, // x4039_negx_b_al_071234fc
+	0x00, // x4078_negx_w_aw_071234fc
+	0x00, // x4079_negx_w_al_071234fc
+	0x00, // x40b8_negx_l_aw_071234fc
+	0x00, // x40b9_negx_l_al_071234fc
+	0x00, // x40f8_move_w_aw_07
+	0x00, // x40f8_move_w_aw_1234fc
+	0x00, // x40f9_move_w_al_07
+	0x00, // x40f9_move_w_al_1234fc
+	0x00, // x421f_clr_b_pi7_0
+	0x00, // x421f_clr_b_pi7_71234fc
+	0x00, // x4227_clr_b_pd7_0
+	0x00, // x4227_clr_b_pd7_71234fc
+	0x00, // x4238_clr_b_aw_0
+	0x00, // x4238_clr_b_aw_71234fc
+	0x00, // x4239_clr_b_al_0
+	0x00, // x4239_clr_b_al_71234fc
+	0x00, // x4278_clr_w_aw_0
+	0x00, // x4278_clr_w_aw_71234fc
+	0x00, // x4279_clr_w_al_0
+	0x00, // x4279_clr_w_al_71234fc
+	0x00, // x42b8_clr_l_aw_0
+	0x00, // x42b8_clr_l_aw_71234fc
+	0x00, // x42b9_clr_l_al_0
+	0x00, // x42b9_clr_l_al_71234fc
+	0x00, // x42f8_move_w_aw_1234fc
+	0x00, // x42f9_move_w_al_1234fc
+	0x00, // x441f_neg_b_pi7_071234fc
+	0x00, // x4427_neg_b_pd7_071234fc
+	0x00, // x4438_neg_b_aw_071234fc
+	0x00, // x4439_neg_b_al_071234fc
+	0x00, // x4478_neg_w_aw_071234fc
+	0x00, // x4479_neg_w_al_071234fc
+	0x00, // x44b8_neg_l_aw_071234fc
+	0x00, // x44b9_neg_l_al_071234fc
+	0x00, // x44f8_move_w_aw_071234fc
+	0x00, // x44f9_move_w_al_071234fc
+	0x00, // x44fa_move_w_pcdi_071234fc
+	0x00, // x44fb_move_w_pcix_071234fc
+	0x00, // x44fc_move_w_i_071234fc
+	0x00, // x461f_not_b_pi7_071234fc
+	0x00, // x4627_not_b_pd7_071234fc
+	0x00, // x4638_not_b_aw_071234fc
+	0x00, // x4639_not_b_al_071234fc
+	0x00, // x4678_not_w_aw_071234fc
+	0x00, // x4679_not_w_al_071234fc
+	0x00, // x46b8_not_l_aw_071234fc
+	0x00, // x46b9_not_l_al_071234fc
+	0x20, // x46f8_move_w_aw_071234fc
+	0x20, // x46f9_move_w_al_071234fc
+	0x20, // x46fa_move_w_pcdi_071234fc
+	0x20, // x46fb_move_w_pcix_071234fc
+	0x20, // x46fc_move_w_i_071234fc
+	0x00, // x480f_link_l_234fc
+	0x00, // x481f_nbcd_b_pi7_071234fc
+	0x00, // x4827_nbcd_b_pd7_071234fc
+	0x00, // x4838_nbcd_b_aw_071234fc
+	0x00, // x4839_nbcd_b_al_071234fc
+	0x00, // x4878_pea_l_aw_071234fc
+	0x00, // x4879_pea_l_al_071234fc
+	0x00, // x487a_pea_l_pcdi_071234fc
+	0x00, // x487b_pea_l_pcix_071234fc
+	0x00, // x48b8_movem_w_aw_071234fc
+	0x00, // x48b9_movem_w_al_071234fc
+	0x00, // x48f8_movem_l_aw_071234fc
+	0x00, // x48f9_movem_l_al_071234fc
+	0x00, // x4a1f_tst_b_pi7_071234fc
+	0x00, // x4a27_tst_b_pd7_071234fc
+	0x00, // x4a38_tst_b_aw_071234fc
+	0x00, // x4a39_tst_b_al_071234fc
+	0x00, // x4a3a_tst_b_234fc
+	0x00, // x4a3b_tst_b_234fc
+	0x00, // x4a3c_tst_b_234fc
+	0x00, // x4a78_tst_w_aw_071234fc
+	0x00, // x4a79_tst_w_al_071234fc
+	0x00, // x4a7a_tst_w_234fc
+	0x00, // x4a7b_tst_w_234fc
+	0x00, // x4a7c_tst_w_234fc
+	0x00, // x4ab8_tst_l_aw_071234fc
+	0x00, // x4ab9_tst_l_al_071234fc
+	0x00, // x4aba_tst_l_234fc
+	0x00, // x4abb_tst_l_234fc
+	0x00, // x4abc_tst_l_234fc
+	0x00, // x4adf_tas_b_pi7_071234fc
+	0x00, // x4ae7_tas_b_pd7_071234fc
+	0x00, // x4af8_tas_b_aw_071234fc
+	0x00, // x4af9_tas_b_al_071234fc
+	0x10, // x4afc_illegal_071234fc
+	0x00, // x4c38_mull_l_aw_234fc
+	0x00, // x4c39_mull_l_al_234fc
+	0x00, // x4c3a_mull_l_pcdi_234fc
+	0x00, // x4c3b_mull_l_pcix_234fc
+	0x00, // x4c3c_mull_l_i_234fc
+	0x00, // x4c78_divl_l_aw_234fc
+	0x00, // x4c79_divl_l_al_234fc
+	0x00, // x4c7a_divl_l_pcdi_234fc
+	0x00, // x4c7b_divl_l_pcix_234fc
+	0x00, // x4c7c_divl_l_i_234fc
+	0x00, // x4cb8_movem_w_aw_071234fc
+	0x00, // x4cb9_movem_w_al_071234fc
+	0x00, // x4cba_movem_w_071234fc
+	0x00, // x4cbb_movem_w_071234fc
+	0x00, // x4cf8_movem_l_aw_071234fc
+	0x00, // x4cf9_movem_l_al_071234fc
+	0x00, // x4cfa_movem_l_071234fc
+	0x00, // x4cfb_movem_l_071234fc
+	0x00, // x4e57_link_w_071234fc
+	0x00, // x4e5f_unlk_l_071234fc
+	0x20, // x4e70_reset_071234fc
+	0x00, // x4e71_nop_071234fc
+	0x20, // x4e72_stop_071234fc
+	0x24, // x4e73_rte_l_0
+	0x24, // x4e73_rte_l_71
+	0x24, // x4e73_rte_l_234fc
+	0x04, // x4e74_rtd_l_1234fc
+	0x04, // x4e75_rts_l_071234fc
+	0x12, // x4e76_trapv_071234fc
+	0x04, // x4e77_rtr_l_071234fc
+	0x20, // x4e7a_movec_l_1
+	0x20, // x4e7a_movec_l_23f
+	0x20, // x4e7a_movec_l_4
+	0x20, // x4e7a_movec_l_c
+	0x20, // x4e7b_movec_l_1
+	0x20, // x4e7b_movec_l_2f
+	0x20, // x4e7b_movec_l_3
+	0x20, // x4e7b_movec_l_4
+	0x20, // x4e7b_movec_l_c
+	0x0c, // x4eb8_jsr_l_aw_071234fc
+	0x0c, // x4eb9_jsr_l_al_071234fc
+	0x0c, // x4eba_jsr_l_pcdi_071234fc
+	0x0c, // x4ebb_jsr_l_pcix_071234fc
+	0x04, // x4ef8_jmp_l_aw_071234fc
+	0x04, // x4ef9_jmp_l_al_071234fc
+	0x04, // x4efa_jmp_l_pcdi_071234fc
+	0x04, // x4efb_jmp_l_pcix_071234fc
+	0x00, // x50df_st_b_pi7_071234fc
+	0x00, // x50e7_st_b_pd7_071234fc
+	0x00, // x50f8_st_b_aw_071234fc
+	0x00, // x50f9_st_b_al_071234fc
+	0x10, // x50fa_trapt_w_234fc
+	0x10, // x50fb_trapt_l_234fc
+	0x10, // x50fc_trapt_234fc
+	0x00, // x51df_sf_b_pi7_071234fc
+	0x00, // x51e7_sf_b_pd7_071234fc
+	0x00, // x51f8_sf_b_aw_071234fc
+	0x00, // x51f9_sf_b_al_071234fc
+	0x00, // x51fa_trapf_w_234fc
+	0x00, // x51fb_trapf_l_234fc
+	0x00, // x51fc_trapf_234fc
+	0x00, // x52df_shi_b_pi7_071234fc
+	0x00, // x52e7_shi_b_pd7_071234fc
+	0x00, // x52f8_shi_b_aw_071234fc
+	0x00, // x52f9_shi_b_al_071234fc
+	0x12, // x52fa_traphi_w_234fc
+	0x12, // x52fb_traphi_l_234fc
+	0x12, // x52fc_traphi_234fc
+	0x00, // x53df_sls_b_pi7_071234fc
+	0x00, // x53e7_sls_b_pd7_071234fc
+	0x00, // x53f8_sls_b_aw_071234fc
+	0x00, // x53f9_sls_b_al_071234fc
+	0x12, // x53fa_trapls_w_234fc
+	0x12, // x53fb_trapls_l_234fc
+	0x12, // x53fc_trapls_234fc
+	0x00, // x54df_scc_b_pi7_071234fc
+	0x00, // x54e7_scc_b_pd7_071234fc
+	0x00, // x54f8_scc_b_aw_071234fc
+	0x00, // x54f9_scc_b_al_071234fc
+	0x12, // x54fa_trapcc_w_234fc
+	0x12, // x54fb_trapcc_l_234fc
+	0x12, // x54fc_trapcc_234fc
+	0x00, // x55df_scs_b_pi7_071234fc
+	0x00, // x55e7_scs_b_pd7_071234fc
+	0x00, // x55f8_scs_b_aw_071234fc
+	0x00, // x55f9_scs_b_al_071234fc
+	0x12, // x55fa_trapcs_w_234fc
+	0x12, // x55fb_trapcs_l_234fc
+	0x12, // x55fc_trapcs_234fc
+	0x00, // x56df_sne_b_pi7_071234fc
+	0x00, // x56e7_sne_b_pd7_071234fc
+	0x00, // x56f8_sne_b_aw_071234fc
+	0x00, // x56f9_sne_b_al_071234fc
+	0x12, // x56fa_trapne_w_234fc
+	0x12, // x56fb_trapne_l_234fc
+	0x12, // x56fc_trapne_234fc
+	0x00, // x57df_seq_b_pi7_071234fc
+	0x00, // x57e7_seq_b_pd7_071234fc
+	0x00, // x57f8_seq_b_aw_071234fc
+	0x00, // x57f9_seq_b_al_071234fc
+	0x12, // x57fa_trapeq_w_234fc
+	0x12, // x57fb_trapeq_l_234fc
+	0x12, // x57fc_trapeq_234fc
+	0x00, // x58df_svc_b_pi7_071234fc
+	0x00, // x58e7_svc_b_pd7_071234fc
+	0x00, // x58f8_svc_b_aw_071234fc
+	0x00, // x58f9_svc_b_al_071234fc
+	0x12, // x58fa_trapvc_w_234fc
+	0x12, // x58fb_trapvc_l_234fc
+	0x12, // x58fc_trapvc_234fc
+	0x00, // x59df_svs_b_pi7_071234fc
+	0x00, // x59e7_svs_b_pd7_071234fc
+	0x00, // x59f8_svs_b_aw_071234fc
+	0x00, // x59f9_svs_b_al_071234fc
+	0x12, // x59fa_trapvs_w_234fc
+	0x12, // x59fb_trapvs_l_234fc
+	0x12, // x59fc_trapvs_234fc
+	0x00, // x5adf_spl_b_pi7_071234fc
+	0x00, // x5ae7_spl_b_pd7_071234fc
+	0x00, // x5af8_spl_b_aw_071234fc
+	0x00, // x5af9_spl_b_al_071234fc
+	0x12, // x5afa_trappl_w_234fc
+	0x12, // x5afb_trappl_l_234fc
+	0x12, // x5afc_trappl_234fc
+	0x00, // x5bdf_smi_b_pi7_071234fc
+	0x00, // x5be7_smi_b_pd7_071234fc
+	0x00, // x5bf8_smi_b_aw_071234fc
+	0x00, // x5bf9_smi_b_al_071234fc
+	0x12, // x5bfa_trapmi_w_234fc
+	0x12, // x5bfb_trapmi_l_234fc
+	0x12, // x5bfc_trapmi_234fc
+	0x00, // x5cdf_sge_b_pi7_071234fc
+	0x00, // x5ce7_sge_b_pd7_071234fc
+	0x00, // x5cf8_sge_b_aw_071234fc
+	0x00, // x5cf9_sge_b_al_071234fc
+	0x12, // x5cfa_trapge_w_234fc
+	0x12, // x5cfb_trapge_l_234fc
+	0x12, // x5cfc_trapge_234fc
+	0x00, // x5ddf_slt_b_pi7_071234fc
+	0x00, // x5de7_slt_b_pd7_071234fc
+	0x00, // x5df8_slt_b_aw_071234fc
+	0x00, // x5df9_slt_b_al_071234fc
+	0x12, // x5dfa_traplt_w_234fc
+	0x12, // x5dfb_traplt_l_234fc
+	0x12, // x5dfc_traplt_234fc
+	0x00, // x5edf_sgt_b_pi7_071234fc
+	0x00, // x5ee7_sgt_b_pd7_071234fc
+	0x00, // x5ef8_sgt_b_aw_071234fc
+	0x00, // x5ef9_sgt_b_al_071234fc
+	0x12, // x5efa_trapgt_w_234fc
+	0x12, // x5efb_trapgt_l_234fc
+	0x12, // x5efc_trapgt_234fc
+	0x00, // x5fdf_sle_b_pi7_071234fc
+	0x00, // x5fe7_sle_b_pd7_071234fc
+	0x00, // x5ff8_sle_b_aw_071234fc
+	0x00, // x5ff9_sle_b_al_071234fc
+	0x12, // x5ffa_traple_w_234fc
+	0x12, // x5ffb_traple_l_234fc
+	0x12, // x5ffc_traple_234fc
+	0x01, // x6000_bra_w_071234fc
+	0x01, // x60ff_bra_l_234fc
+	0x09, // x6100_bsr_w_071234fc
+	0x09, // x61ff_bsr_l_234fc
+	0x03, // x6200_bhi_w_071234fc
+	0x03, // x62ff_bhi_l_071
+	0x03, // x62ff_bhi_l_234fc
+	0x03, // x6300_bls_w_071234fc
+	0x03, // x63ff_bls_l_071
+	0x03, // x63ff_bls_l_234fc
+	0x03, // x6400_bcc_w_071234fc
+	0x03, // x64ff_bcc_l_071
+	0x03, // x64ff_bcc_l_234fc
+	0x03, // x6500_bcs_w_071234fc
+	0x03, // x65ff_bcs_l_071
+	0x03, // x65ff_bcs_l_234fc
+	0x03, // x6600_bne_w_071234fc
+	0x03, // x66ff_bne_l_071
+	0x03, // x66ff_bne_l_234fc
+	0x03, // x6700_beq_w_071234fc
+	0x03, // x67ff_beq_l_071
+	0x03, // x67ff_beq_l_234fc
+	0x03, // x6800_bvc_w_071234fc
+	0x03, // x68ff_bvc_l_071
+	0x03, // x68ff_bvc_l_234fc
+	0x03, // x6900_bvs_w_071234fc
+	0x03, // x69ff_bvs_l_071
+	0x03, // x69ff_bvs_l_234fc
+	0x03, // x6a00_bpl_w_071234fc
+	0x03, // x6aff_bpl_l_071
+	0x03, // x6aff_bpl_l_234fc
+	0x03, // x6b00_bmi_w_071234fc
+	0x03, // x6bff_bmi_l_071
+	0x03, // x6bff_bmi_l_234fc
+	0x03, // x6c00_bge_w_071234fc
+	0x03, // x6cff_bge_l_071
+	0x03, // x6cff_bge_l_234fc
+	0x03, // x6d00_blt_w_071234fc
+	0x03, // x6dff_blt_l_071
+	0x03, // x6dff_blt_l_234fc
+	0x03, // x6e00_bgt_w_071234fc
+	0x03, // x6eff_bgt_l_071
+	0x03, // x6eff_bgt_l_234fc
+	0x03, // x6f00_ble_w_071234fc
+	0x03, // x6fff_ble_l_071
+	0x03, // x6fff_ble_l_234fc
+	0x00, // x8f0f_sbcd_b_071234fc
+	0x00, // x8f4f_pack_w_234fc
+	0x00, // x8f8f_unpk_w_234fc
+	0x00, // x9f0f_subx_b_071234fc
+	0x00, // xbf0f_cmpm_b_071234fc
+	0x00, // xcf0f_abcd_b_071234fc
+	0x00, // xdf0f_addx_b_071234fc
+	0x00, // xe0f8_asr_w_aw_071234fc
+	0x00, // xe0f9_asr_w_al_071234fc
+	0x00, // xe1f8_asl_w_aw_071234fc
+	0x00, // xe1f9_asl_w_al_071234fc
+	0x00, // xe2f8_lsr_w_aw_071234fc
+	0x00, // xe2f9_lsr_w_al_071234fc
+	0x00, // xe3f8_lsl_w_aw_071234fc
+	0x00, // xe3f9_lsl_w_al_071234fc
+	0x00, // xe4f8_roxr_w_aw_071234fc
+	0x00, // xe4f9_roxr_w_al_071234fc
+	0x00, // xe5f8_roxl_w_aw_071234fc
+	0x00, // xe5f9_roxl_w_al_071234fc
+	0x00, // xe6f8_ror_w_aw_071234fc
+	0x00, // xe6f9_ror_w_al_071234fc
+	0x00, // xe7f8_rol_w_aw_071234fc
+	0x00, // xe7f9_rol_w_al_071234fc
+	0x00, // xe8f8_bftst_l_aw_234fc
+	0x00, // xe8f9_bftst_l_al_234fc
+	0x00, // xe8fa_bftst_l_pcdi_234fc
+	0x00, // xe8fb_bftst_l_pcix_234fc
+	0x00, // xe9f8_bfextu_l_aw_234fc
+	0x00, // xe9f9_bfextu_l_al_234fc
+	0x00, // xe9fa_bfextu_l_pcdi_234fc
+	0x00, // xe9fb_bfextu_l_pcix_234fc
+	0x00, // xeaf8_bfchg_l_aw_234fc
+	0x00, // xeaf9_bfchg_l_al_234fc
+	0x00, // xebf8_bfexts_l_aw_234fc
+	0x00, // xebf9_bfexts_l_al_234fc
+	0x00, // xebfa_bfexts_l_pcdi_234fc
+	0x00, // xebfb_bfexts_l_pcix_234fc
+	0x00, // xecf8_bfclr_l_aw_234fc
+	0x00, // xecf9_bfclr_l_al_234fc
+	0x00, // xedf8_bfffo_l_aw_234fc
+	0x00, // xedf9_bfffo_l_al_234fc
+	0x00, // xedfa_bfffo_l_pcdi_234fc
+	0x00, // xedfb_bfffo_l_pcix_234fc
+	0x00, // xeef8_bfset_l_aw_234fc
+	0x00, // xeef9_bfset_l_al_234fc
+	0x00, // xeff8_bfins_l_aw_234fc
+	0x00, // xeff9_bfins_l_al_234fc
+};
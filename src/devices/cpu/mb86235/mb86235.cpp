@@ -268,7 +268,7 @@ mb86235_device::mb86235_device(const machine_config &mconfig, const char *tag, d
 	, m_fifoin(*this, finder_base::DUMMY_TAG)
 	, m_fifoout0(*this, finder_base::DUMMY_TAG)
 	, m_fifoout1(*this, finder_base::DUMMY_TAG)
-	, m_cache(CACHE_SIZE + sizeof(mb86235_internal_state))
+	, m_cache(drc_cache::configured_size(mconfig, CACHE_SIZE) + sizeof(mb86235_internal_state))
 	, m_drcuml(nullptr)
 	, m_drcfe(nullptr)
 {
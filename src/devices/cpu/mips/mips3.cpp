@@ -10,6 +10,7 @@
 
 #include "emu.h"
 #include "debugger.h"
+#include "emuopts.h"
 #include "mips3.h"
 #include "mips3com.h"
 #include "mips3dsm.h"
@@ -167,8 +168,9 @@ mips3_device::mips3_device(const machine_config &mconfig, device_type type, cons
 	, c_dcache_size(0)
 	, c_secondary_cache_line_size(0)
 	, m_fastram_select(0)
+	, m_fastram_auto(0)
 	, m_debugger_temp(0)
-	, m_drc_cache(DRC_CACHE_SIZE + sizeof(internal_mips3_state) + 0x800000)
+	, m_drc_cache(drc_cache::configured_size(mconfig, DRC_CACHE_SIZE) + sizeof(internal_mips3_state) + 0x800000)
 	, m_drcuml(nullptr)
 	, m_drcfe(nullptr)
 	, m_drcoptions(0)
@@ -230,6 +232,11 @@ void mips3_device::device_stop()
 	{
 		m_drcuml = nullptr;
 	}
+	if (m_drcpersist != nullptr)
+	{
+		m_drcpersist->save();
+		m_drcpersist = nullptr;
+	}
 }
 
 /***************************************************************************
@@ -431,6 +438,15 @@ void mips3_device::device_start()
 	/* set up the endianness */
 	m_program->accessors(m_memory);
 
+	/* regions found in the map go stale as soon as it changes */
+	m_program->add_change_notifier([this](read_or_write) {
+		if (m_fastram_auto != 0)
+		{
+			fastram_drop_auto();
+			abort_timeslice();
+		}
+	});
+
 	/* allocate a timer for the compare interrupt */
 	m_compare_int_timer = machine().scheduler().timer_alloc(timer_expired_delegate(FUNC(mips3_device::compare_int_callback), this));
 
@@ -438,6 +454,14 @@ void mips3_device::device_start()
 	/* initialize the UML generator */
 	m_drcuml = std::make_unique<drcuml_state>(*this, m_drc_cache, flags, 8, 32, 2);
 
+	/* load the entry points compiled by a previous run */
+	if (m_isdrc && machine().options().drc_persist())
+		m_drcpersist = std::make_unique<drc_persistent_cache>(*this);
+
+	/* let the back-end generate code while we interpret */
+	if (m_isdrc && machine().options().drc_background())
+		m_drcuml->enable_background();
+
 	/* add symbols for our stuff */
 	m_drcuml->symbol_add(&m_core->pc, sizeof(m_core->pc), "pc");
 	m_drcuml->symbol_add(&m_core->icount, sizeof(m_core->icount), "icount");
@@ -483,6 +507,10 @@ void mips3_device::device_start()
 
 	/* initialize the front-end helper */
 	m_drcfe = std::make_unique<mips3_frontend>(this, COMPILE_BACKWARDS_BYTES, COMPILE_FORWARDS_BYTES, SINGLE_INSTRUCTION_MODE ? 1 : COMPILE_MAX_SEQUENCE);
+	if (!SINGLE_INSTRUCTION_MODE)
+		m_drcfe->set_max_traces(COMPILE_MAX_TRACES);
+	if (!SINGLE_INSTRUCTION_MODE && allow_idle_skip())
+		m_drcfe->set_max_idle_loop(COMPILE_MAX_IDLE_LOOP);
 
 	/* allocate memory for cache-local state and initialize it */
 	memcpy(m_fpmode, fpmode_source, sizeof(fpmode_source));
@@ -5056,19 +5084,36 @@ void mips3_device::execute_run()
 
 		/* reset the cache if dirty */
 		if (m_drc_cache_dirty)
+		{
 			code_flush_cache();
+			if (m_drcpersist != nullptr)
+				code_replay_persistent();
+		}
 		m_drc_cache_dirty = false;
 
 		/* execute */
 		do
 		{
+			/* pick up any block generated in the background */
+			if (m_drcuml->background_pending())
+				code_finish_background();
+
 			/* run as much as we can */
 			execute_result = m_drcuml->execute(*m_entry);
 
 			/* if we need to recompile, do it */
 			if (execute_result == EXECUTE_MISSING_CODE)
 			{
-				code_compile_block(m_core->mode, m_core->pc);
+				if (m_drcuml->background())
+				{
+					/* interpret until the back-end is done with the block */
+					code_compile_block(m_core->mode, m_core->pc, true);
+					execute_interpreted(true);
+					if (m_core->icount <= 0)
+						execute_result = EXECUTE_OUT_OF_CYCLES;
+				}
+				else
+					code_compile_block(m_core->mode, m_core->pc);
 			}
 			else if (execute_result == EXECUTE_UNMAPPED_CODE)
 			{
@@ -5084,6 +5129,19 @@ void mips3_device::execute_run()
 		return;
 	}
 
+	execute_interpreted(false);
+}
+
+
+/*-------------------------------------------------
+    execute_interpreted - run the interpreter
+    until out of cycles or, in background mode,
+    until the back-end has finished the pending
+    block
+-------------------------------------------------*/
+
+void mips3_device::execute_interpreted(bool background)
+{
 	/* count cycles and interrupt cycles */
 	m_core->icount -= m_interrupt_cycles;
 	m_interrupt_cycles = 0;
@@ -5314,10 +5372,14 @@ void mips3_device::execute_run()
 			elf_loaded = true;
 		}
 #endif
-	} while (m_core->icount > 0 || m_nextpc != ~0);
+	} while ((m_core->icount > 0 && !(background && m_drcuml->background_ready())) || m_nextpc != ~0);
 
 	m_core->icount -= m_interrupt_cycles;
 	m_interrupt_cycles = 0;
+
+	/* the interpreter doesn't track the mode, so bring it up to date for the DRC */
+	if (background)
+		m_core->mode = ((SR & (SR_EXL | SR_ERL)) ? 0 : ((SR >> 2) & 0x06)) | ((SR >> 26) & 0x01);
 }
 
 
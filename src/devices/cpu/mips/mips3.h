@@ -17,6 +17,7 @@ MIPS III/IV emulator.
 
 #include "divtlb.h"
 #include "cpu/drcfe.h"
+#include "cpu/drcpersist.h"
 #include "cpu/drcuml.h"
 #include "ps2vu.h"
 
@@ -468,6 +469,7 @@ protected:
 		uint16_t *  offset_base16;              /* base in memory where the RAM lives, 16-bit pointer, with the start offset pre-applied  */
 		uint32_t *  offset_base32;              /* base in memory where the RAM lives, 32-bit pointer, with the start offset pre-applied  */
 	}               m_fastram[MIPS3_MAX_FASTRAM];
+	uint32_t        m_fastram_auto;             /* trailing entries filled in from the address map */
 
 	uint32_t        m_debugger_temp;
 
@@ -475,6 +477,13 @@ protected:
 	drc_cache       m_drc_cache;                /* pointer to the DRC code cache */
 	std::unique_ptr<drcuml_state>      m_drcuml;/* DRC UML generator state */
 	std::unique_ptr<mips3_frontend>    m_drcfe; /* pointer to the DRC front-end state */
+	std::unique_ptr<drc_persistent_cache> m_drcpersist; /* compiled block entry points kept across runs */
+	struct
+	{
+		uint8_t     mode;                       /* mode of the block being generated in the background */
+		offs_t      pc;                         /* starting PC of the block */
+		uint32_t    signature;                  /* signature of the described opcodes */
+	}               m_bgblock;
 	uint32_t        m_drcoptions;               /* configurable DRC options */
 
 												/* internal stuff */
@@ -594,7 +603,12 @@ private:
 	void load_fast_iregs(drcuml_block &block);
 	void save_fast_iregs(drcuml_block &block);
 	void code_flush_cache();
-	void code_compile_block(uint8_t mode, offs_t pc);
+	void fastram_drop_auto();
+	void fastram_fill_auto();
+	void code_compile_block(uint8_t mode, offs_t pc, bool background = false);
+	void code_finish_background();
+	void code_replay_persistent();
+	void execute_interpreted(bool background);
 public:
 	void func_get_cycles();
 	void func_printf_exception();
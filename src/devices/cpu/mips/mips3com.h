@@ -50,6 +50,8 @@
 #define COMPILE_FORWARDS_BYTES          512
 #define COMPILE_MAX_INSTRUCTIONS        ((COMPILE_BACKWARDS_BYTES/4) + (COMPILE_FORWARDS_BYTES/4))
 #define COMPILE_MAX_SEQUENCE            64
+#define COMPILE_MAX_TRACES              4
+#define COMPILE_MAX_IDLE_LOOP           32
 
 /* exit codes */
 #define EXECUTE_OUT_OF_CYCLES           0
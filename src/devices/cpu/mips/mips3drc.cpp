@@ -29,6 +29,7 @@
 #include "mips3fe.h"
 #include "mips3dsm.h"
 #include "ps2vu.h"
+#include "cpu/drcfastram.h"
 #include "cpu/drcfe.h"
 #include "cpu/drcuml.h"
 #include "cpu/drcumlsh.h"
@@ -162,6 +163,7 @@ void mips3_device::mips3drc_set_options(uint32_t options)
 -------------------------------------------------*/
 void mips3_device::clear_fastram(uint32_t select_start)
 {
+	fastram_drop_auto();
 	m_fastram_select=select_start;
 	// Set cache to dirty so that re-mapping occurs
 	m_drc_cache_dirty = true;
@@ -174,6 +176,7 @@ void mips3_device::clear_fastram(uint32_t select_start)
 
 void mips3_device::add_fastram(offs_t start, offs_t end, uint8_t readonly, void *base)
 {
+	fastram_drop_auto();
 	if (m_fastram_select < ARRAY_LENGTH(m_fastram))
 	{
 		m_fastram[m_fastram_select].start = start;
@@ -190,6 +193,63 @@ void mips3_device::add_fastram(offs_t start, offs_t end, uint8_t readonly, void
 }
 
 
+/*-------------------------------------------------
+    fastram_drop_auto - forget the regions that
+    were filled in from the address map
+-------------------------------------------------*/
+
+void mips3_device::fastram_drop_auto()
+{
+	if (m_fastram_auto != 0)
+	{
+		m_fastram_select -= std::min(m_fastram_auto, m_fastram_select);
+		m_fastram_auto = 0;
+		m_drc_cache_dirty = true;
+	}
+}
+
+
+/*-------------------------------------------------
+    fastram_fill_auto - fill the free fastram
+    slots with fixed RAM from the address map
+-------------------------------------------------*/
+
+void mips3_device::fastram_fill_auto()
+{
+	m_fastram_select -= std::min(m_fastram_auto, m_fastram_select);
+	m_fastram_auto = 0;
+
+	/* the generated accessors assume dword-wide host storage */
+	if (m_data_bits != 32)
+		return;
+
+	uint32_t const fixed = m_fastram_select;
+	for (const drc_fastram_region &region : drc_find_fastram(*m_program))
+	{
+		if (m_fastram_select == ARRAY_LENGTH(m_fastram))
+			break;
+
+		/* the driver's own regions win */
+		bool overlaps = false;
+		for (uint32_t ramnum = 0; ramnum < fixed; ramnum++)
+			if (region.start <= m_fastram[ramnum].end && region.end >= m_fastram[ramnum].start)
+				overlaps = true;
+		if (overlaps)
+			continue;
+
+		m_fastram[m_fastram_select].start = region.start;
+		m_fastram[m_fastram_select].end = region.end;
+		m_fastram[m_fastram_select].readonly = region.readonly;
+		m_fastram[m_fastram_select].base = region.base;
+		m_fastram[m_fastram_select].offset_base8 = (uint8_t*)region.base - region.start;
+		m_fastram[m_fastram_select].offset_base16 = (uint16_t*)((uint8_t*)region.base - region.start);
+		m_fastram[m_fastram_select].offset_base32 = (uint32_t*)((uint8_t*)region.base - region.start);
+		m_fastram_select++;
+	}
+	m_fastram_auto = m_fastram_select - fixed;
+}
+
+
 /*-------------------------------------------------
     mips3drc_add_hotspot - add a new hotspot
 -------------------------------------------------*/
@@ -224,6 +284,9 @@ void mips3_device::code_flush_cache()
 	/* empty the transient cache contents */
 	m_drcuml->reset();
 
+	/* the memory accessors below bake in the fastram table */
+	fastram_fill_auto();
+
 	try
 	{
 		/* generate the entry point and out-of-cycles handlers */
@@ -279,7 +342,7 @@ void mips3_device::code_flush_cache()
     given mode at the specified pc
 -------------------------------------------------*/
 
-void mips3_device::code_compile_block(uint8_t mode, offs_t pc)
+void mips3_device::code_compile_block(uint8_t mode, offs_t pc, bool background)
 {
 	compiler_state compiler = { 0 };
 	const opcode_desc *seqhead, *seqlast;
@@ -292,6 +355,7 @@ void mips3_device::code_compile_block(uint8_t mode, offs_t pc)
 	desclist = m_drcfe->describe_code(pc);
 	if (m_drcuml->logging() || m_drcuml->logging_native())
 		log_opcode_desc(desclist, 0);
+	uint32_t const signature = (m_drcpersist != nullptr) ? drc_persistent_cache::signature(desclist) : 0;
 
 	/* if we get an error back, flush the cache and try again */
 	bool succeeded = false;
@@ -377,7 +441,16 @@ void mips3_device::code_compile_block(uint8_t mode, offs_t pc)
 				}
 			}
 
-			/* end the sequence */
+			/* end the sequence, leaving optimization and code generation to the worker if asked */
+			if (background)
+			{
+				m_bgblock.mode = mode;
+				m_bgblock.pc = pc;
+				m_bgblock.signature = signature;
+				block.end_background();
+				g_profiler.stop();
+				return;
+			}
 			block.end();
 			g_profiler.stop();
 			succeeded = true;
@@ -387,6 +460,52 @@ void mips3_device::code_compile_block(uint8_t mode, offs_t pc)
 			code_flush_cache();
 		}
 	}
+
+	/* remember the entry point for the next run */
+	if (m_drcpersist != nullptr)
+		m_drcpersist->record(mode, pc, signature);
+}
+
+
+/*-------------------------------------------------
+    code_finish_background - wait for the block
+    being generated in the background
+-------------------------------------------------*/
+
+void mips3_device::code_finish_background()
+{
+	/* if the back-end ran out of space, flush; the block will be requested again */
+	if (!m_drcuml->background_wait())
+	{
+		code_flush_cache();
+		return;
+	}
+
+	/* remember the entry point for the next run */
+	if (m_drcpersist != nullptr)
+		m_drcpersist->record(m_bgblock.mode, m_bgblock.pc, m_bgblock.signature);
+}
+
+
+/*-------------------------------------------------
+    code_replay_persistent - compile the blocks
+    recorded by a previous run that still match
+    the code in memory
+-------------------------------------------------*/
+
+void mips3_device::code_replay_persistent()
+{
+	uint32_t const compiled = m_drcpersist->replay(
+			[this] (uint32_t mode, offs_t pc) -> uint32_t
+			{
+				/* hash jumps out of a block assume the current mode, so leave other modes alone */
+				if (mode != m_core->mode || m_drcuml->hash_exists(mode, pc))
+					return ~uint32_t(0);
+				return drc_persistent_cache::signature(m_drcfe->describe_code(pc));
+			},
+			[this] (uint32_t mode, offs_t pc) { code_compile_block(mode, pc); });
+	if (compiled != 0)
+		osd_printf_verbose("%s: precompiled %u DRC blocks\n", tag(), compiled);
 }
 
 
@@ -1334,6 +1453,9 @@ void mips3_device::generate_delay_slot_and_branch(drcuml_block &block, compiler_
 	/* update the cycles and jump through the hash table to the target */
 	if (desc->targetpc != BRANCH_TARGET_DYNAMIC)
 	{
+		/* going round an idle loop again can't change anything, so give up the timeslice */
+		if (desc->flags & OPFLAG_IDLE_LOOP)
+			UML_MOV(block, mem(&m_core->icount), 0);                                   // mov     icount,0
 		generate_update_cycles(block, compiler_temp, desc->targetpc, true); // <subtract cycles>
 		if (!(m_drcoptions & MIPS3DRC_DISABLE_INTRABLOCK) && desc->flags & OPFLAG_INTRABLOCK_BRANCH)
 		{
@@ -596,6 +596,7 @@ protected:
 
 	uint32_t              m_fastram_select;
 	fast_ram_info       m_fastram[PPC_MAX_FASTRAM];
+	uint32_t              m_fastram_auto;               /* trailing entries filled in from the address map */
 
 	/* hotspots */
 	/* hotspot info */
@@ -647,6 +648,8 @@ protected:
 	uint32_t compute_crf_mask(uint8_t crm);
 	uint32_t compute_spr(uint32_t spr);
 	void code_flush_cache();
+	void fastram_drop_auto();
+	void fastram_fill_auto();
 	void code_compile_block(uint8_t mode, offs_t pc);
 	void static_generate_entry_point();
 	void static_generate_nocode_handler();
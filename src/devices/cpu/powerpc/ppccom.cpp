@@ -223,7 +223,7 @@ ppc_device::ppc_device(const machine_config &mconfig, device_type type, const ch
 	, m_dcstore_cb(*this)
 	, m_ext_dma_read_cb(*this)
 	, m_ext_dma_write_cb(*this)
-	, m_cache(CACHE_SIZE + sizeof(internal_ppc_state))
+	, m_cache(drc_cache::configured_size(mconfig, CACHE_SIZE) + sizeof(internal_ppc_state))
 	, m_drcuml(nullptr)
 	, m_drcfe(nullptr)
 	, m_drcoptions(0)
@@ -711,6 +711,7 @@ void ppc_device::device_start()
 
 	m_arg1 = 0;
 	m_fastram_select = 0;
+	m_fastram_auto = 0;
 	memset(m_fastram, 0, sizeof(m_fastram));
 	m_hotspot_select = 0;
 	memset(m_hotspot, 0, sizeof(m_hotspot));
@@ -745,6 +746,16 @@ void ppc_device::device_start()
 				return ptr;
 			};
 	}
+
+	/* regions found in the map go stale as soon as it changes */
+	m_program->add_change_notifier([this](read_or_write) {
+		if (m_fastram_auto != 0)
+		{
+			fastram_drop_auto();
+			abort_timeslice();
+		}
+	});
+
 	m_system_clock = c_bus_frequency != 0 ? c_bus_frequency : clock();
 	m_dcr_read_func.set(nullptr);
 	m_dcr_write_func.set(nullptr);
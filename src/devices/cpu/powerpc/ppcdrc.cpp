@@ -20,6 +20,7 @@
 #include "ppcfe.h"
 #include "ppc_dasm.h"
 
+#include "cpu/drcfastram.h"
 #include "cpu/drcfe.h"
 #include "cpu/drcuml.h"
 #include "cpu/drcumlsh.h"
@@ -268,6 +269,7 @@ void ppc_device::ppcdrc_set_options(uint32_t options)
 
 void ppc_device::ppcdrc_add_fastram(offs_t start, offs_t end, uint8_t readonly, void *base)
 {
+	fastram_drop_auto();
 	if (m_fastram_select < ARRAY_LENGTH(m_fastram))
 	{
 		m_fastram[m_fastram_select].start = start;
@@ -279,6 +281,58 @@ void ppc_device::ppcdrc_add_fastram(offs_t start, offs_t end, uint8_t readonly,
 }
 
 
+/*-------------------------------------------------
+    fastram_drop_auto - forget the regions that
+    were filled in from the address map
+-------------------------------------------------*/
+
+void ppc_device::fastram_drop_auto()
+{
+	if (m_fastram_auto != 0)
+	{
+		for ( ; m_fastram_auto != 0 && m_fastram_select != 0; m_fastram_auto--)
+			m_fastram[--m_fastram_select].base = nullptr;
+		m_fastram_auto = 0;
+		m_cache_dirty = true;
+	}
+}
+
+
+/*-------------------------------------------------
+    fastram_fill_auto - fill the free fastram
+    slots with fixed RAM from the address map
+-------------------------------------------------*/
+
+void ppc_device::fastram_fill_auto()
+{
+	for ( ; m_fastram_auto != 0 && m_fastram_select != 0; m_fastram_auto--)
+		m_fastram[--m_fastram_select].base = nullptr;
+	m_fastram_auto = 0;
+
+	uint32_t const fixed = m_fastram_select;
+	for (const drc_fastram_region &region : drc_find_fastram(*m_program))
+	{
+		if (m_fastram_select == ARRAY_LENGTH(m_fastram))
+			break;
+
+		/* the driver's own regions win */
+		bool overlaps = false;
+		for (uint32_t ramnum = 0; ramnum < fixed; ramnum++)
+			if (region.start <= m_fastram[ramnum].end && region.end >= m_fastram[ramnum].start)
+				overlaps = true;
+		if (overlaps)
+			continue;
+
+		m_fastram[m_fastram_select].start = region.start;
+		m_fastram[m_fastram_select].end = region.end;
+		m_fastram[m_fastram_select].readonly = region.readonly;
+		m_fastram[m_fastram_select].base = region.base;
+		m_fastram_select++;
+	}
+	m_fastram_auto = m_fastram_select - fixed;
+}
+
+
 /*-------------------------------------------------
     ppcdrc_add_hotspot - add a new hotspot
 -------------------------------------------------*/
@@ -310,6 +364,9 @@ void ppc_device::code_flush_cache()
 	/* empty the transient cache contents */
 	m_drcuml->reset();
 
+	/* the memory accessors below bake in the fastram table */
+	fastram_fill_auto();
+
 	try
 	{
 		/* generate the entry point and out-of-cycles handlers */
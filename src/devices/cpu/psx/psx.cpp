@@ -63,6 +63,33 @@
  *
  *  Bus errors caused by instruction burst fetches are not supported.
  *
+ * Recompiler notes:
+ *
+ *  There is no UML recompiler for this core. Things one needs to deal with:
+ *
+ *  mips3_frontend is written against mips3_device's state and MIPS III decoding (64-bit ops,
+ *  branch likely, TLB), so it can't be reused as is; an R3000A frontend has to be derived
+ *  from drc_frontend directly, using mips3fe.cpp as the model.
+ *
+ *  The register file ( m_r, m_hi, m_lo, m_cp0r ) and the GTE registers are device members.
+ *  The x64 back-end can only address memory within 2GB of the code cache, so they have to
+ *  move into a drc_cache allocation before generated code can use them as operands.
+ *
+ *  The load delay slot is architecturally visible: the loaded value isn't written until after
+ *  the next instruction, and that instruction can overwrite or cancel it ( see m_delayr,
+ *  m_delayv and the load() helpers ). The frontend has to track the pending register across
+ *  each block boundary, or end blocks after loads.
+ *
+ *  Cache isolation ( SR_ISC ) switches data accesses to the cache ram through
+ *  update_memory_handlers(). ZN-1/ZN-2/System 11/System 12 BIOSes use it to flush the
+ *  instruction cache, so isolation needs its own compile mode, selected on MTC0 to SR.
+ *
+ *  Program ram is rewritten by the CPU and by DMA, so blocks have to validate their
+ *  opcodes on entry.
+ *
+ *  GTE commands ( gte::docop2 ) are long enough that calling them from generated code would
+ *  be no slower than inlining them.
+ *
  */
 
 #include "emu.h"
@@ -104,7 +104,7 @@ DEFINE_DEVICE_TYPE(RSP, rsp_device, "rsp", "Nintendo & SGI Reality Signal Proces
 rsp_device::rsp_device(const machine_config &mconfig, const char *tag, device_t *owner, uint32_t clock)
 	: cpu_device(mconfig, RSP, tag, owner, clock)
 	, m_program_config("program", ENDIANNESS_BIG, 32, 32)
-	, m_cache(CACHE_SIZE + sizeof(internal_rsp_state))
+	, m_cache(drc_cache::configured_size(mconfig, CACHE_SIZE) + sizeof(internal_rsp_state))
 	, m_drcuml(nullptr)
 //  , m_drcuml(*this, m_cache, 0, 8, 32, 2)
 	, m_drcfe(nullptr)
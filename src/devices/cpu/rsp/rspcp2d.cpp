@@ -2918,6 +2918,56 @@ void rsp_device::cop2_drc::vrsqh()
 }
 
 
+/*-------------------------------------------------
+    generate_vector_logic - generate inline code
+    for VMRG and the bitwise vector opcodes, which
+    only write the result and ACCUM_L
+-------------------------------------------------*/
+
+void rsp_device::cop2_drc::generate_vector_logic(drcuml_block &block, uint32_t op, int kind)
+{
+	const int vdreg = VDREG;
+	const int vs1reg = VS1REG;
+	const int vs2reg = VS2REG;
+	const int el = EL;
+
+	// the element shuffle is fixed by the opcode, so each lane reads its VS2 element directly;
+	// lane results are held in I2-I9 until all lanes are read, as VD may also be a source
+	for (int i = 0; i < 8; i++)
+	{
+		const uml::parameter res = uml::parameter::make_ireg(uml::REG_I0 + 2 + i);
+		UML_LOAD(block, res, &m_v[vs1reg].s[0], i, SIZE_WORD, SCALE_x2);                 // load    res,vs1[i]
+		UML_LOAD(block, I1, &m_v[vs2reg].s[0], VEC_EL_2(el, i), SIZE_WORD, SCALE_x2);    // load    i1,vs2[el(i)]
+		switch (kind)
+		{
+			case LOGIC_AND:
+			case LOGIC_NAND:
+				UML_AND(block, res, res, I1);                                            // and     res,res,i1
+				break;
+			case LOGIC_OR:
+			case LOGIC_NOR:
+				UML_OR(block, res, res, I1);                                             // or      res,res,i1
+				break;
+			case LOGIC_XOR:
+			case LOGIC_NXOR:
+				UML_XOR(block, res, res, I1);                                            // xor     res,res,i1
+				break;
+			case LOGIC_MERGE:
+				UML_LOAD(block, I0, &m_vflag[COMPARE][0], i, SIZE_WORD, SCALE_x2);       // load    i0,compare[i]
+				UML_TEST(block, I0, I0);                                                 // test    i0,i0
+				UML_MOVc(block, COND_Z, res, I1);                                        // mov     res,i1,Z
+				break;
+		}
+		if (kind == LOGIC_NAND || kind == LOGIC_NOR || kind == LOGIC_NXOR)
+			UML_XOR(block, res, res, 0xffff);                                            // xor     res,res,0xffff
+		UML_STORE(block, &m_accum[i].w[1], 0, res, SIZE_WORD, SCALE_x2);                 // store   accum_l[i],res
+	}
+
+	for (int i = 0; i < 8; i++)
+		UML_STORE(block, &m_v[vdreg].s[0], i, uml::parameter::make_ireg(uml::REG_I0 + 2 + i), SIZE_WORD, SCALE_x2);    // store   vd[i],res
+}
+
+
 /*-------------------------------------------------
     generate_vector_opcode - generate code for a
     vector opcode
@@ -3080,38 +3130,31 @@ bool rsp_device::cop2_drc::generate_vector_opcode(drcuml_block &block, rsp_devic
 			return true;
 
 		case 0x27:      /* VMRG */
-			UML_MOV(block, mem(&m_rspcop2_state->op), desc->opptr.l[0]);        // mov     [arg0],desc->opptr.l
-			UML_CALLC(block, &cop2_drc::cfunc_vmrg, this);
+			generate_vector_logic(block, op, LOGIC_MERGE);
 			return true;
 
 		case 0x28:      /* VAND */
-			UML_MOV(block, mem(&m_rspcop2_state->op), desc->opptr.l[0]);        // mov     [arg0],desc->opptr.l
-			UML_CALLC(block, &cop2_drc::cfunc_vand, this);
+			generate_vector_logic(block, op, LOGIC_AND);
 			return true;
 
 		case 0x29:      /* VNAND */
-			UML_MOV(block, mem(&m_rspcop2_state->op), desc->opptr.l[0]);        // mov     [arg0],desc->opptr.l
-			UML_CALLC(block, &cop2_drc::cfunc_vnand, this);
+			generate_vector_logic(block, op, LOGIC_NAND);
 			return true;
 
 		case 0x2a:      /* VOR */
-			UML_MOV(block, mem(&m_rspcop2_state->op), desc->opptr.l[0]);        // mov     [arg0],desc->opptr.l
-			UML_CALLC(block, &cop2_drc::cfunc_vor, this);
+			generate_vector_logic(block, op, LOGIC_OR);
 			return true;
 
 		case 0x2b:      /* VNOR */
-			UML_MOV(block, mem(&m_rspcop2_state->op), desc->opptr.l[0]);        // mov     [arg0],desc->opptr.l
-			UML_CALLC(block, &cop2_drc::cfunc_vnor, this);
+			generate_vector_logic(block, op, LOGIC_NOR);
 			return true;
 
 		case 0x2c:      /* VXOR */
-			UML_MOV(block, mem(&m_rspcop2_state->op), desc->opptr.l[0]);        // mov     [arg0],desc->opptr.l
-			UML_CALLC(block, &cop2_drc::cfunc_vxor, this);
+			generate_vector_logic(block, op, LOGIC_XOR);
 			return true;
 
 		case 0x2d:      /* VNXOR */
-			UML_MOV(block, mem(&m_rspcop2_state->op), desc->opptr.l[0]);        // mov     [arg0],desc->opptr.l
-			UML_CALLC(block, &cop2_drc::cfunc_vnxor, this);
+			generate_vector_logic(block, op, LOGIC_NXOR);
 			return true;
 
 		case 0x30:      /* VRCP */
@@ -173,7 +173,19 @@ public:
 	virtual void ctc2() override;
 
 private:
+	enum
+	{
+		LOGIC_AND,
+		LOGIC_NAND,
+		LOGIC_OR,
+		LOGIC_NOR,
+		LOGIC_XOR,
+		LOGIC_NXOR,
+		LOGIC_MERGE
+	};
+
 	virtual bool generate_vector_opcode(drcuml_block &block, rsp_device::compiler_state &compiler, const opcode_desc *desc) override;
+	void generate_vector_logic(drcuml_block &block, uint32_t op, int kind);
 };
 
 #endif // MAME_CPU_RSP_RSPCP2D_H
@@ -104,7 +104,7 @@ public:
 	sh_common_execution(const machine_config &mconfig, device_type type, const char *tag, device_t *owner, uint32_t clock, endianness_t endianness, address_map_constructor internal)
 		: cpu_device(mconfig, type, tag, owner, clock)
 		, m_sh2_state(nullptr)
-		, m_cache(CACHE_SIZE + sizeof(internal_sh2_state))
+		, m_cache(drc_cache::configured_size(mconfig, CACHE_SIZE) + sizeof(internal_sh2_state))
 		, m_drcuml(nullptr)
 		, m_drcoptions(0)
 		, m_entry(nullptr)
@@ -360,6 +360,10 @@ protected:
 	virtual void TRAPA(uint32_t i) = 0;
 	virtual void ILLEGAL() = 0;
 
+	/* each instance needs its own code cache, even when two CPUs run the same code from
+	   shared memory: generated code addresses m_sh2_state (allocated in this cache's near
+	   area) and the fast RAM pointers directly, and UML has no base-register addressing
+	   that would let one translation serve several instances */
 	drc_cache           m_cache;                  /* pointer to the DRC code cache */
 
 public:
@@ -3855,15 +3855,19 @@ bool sh34_base_device::generate_group_15_op1111_0x13_FCNVDS(drcuml_block &block,
 	return true;
 }
 
-void sh34_base_device::func_FIPR() { FIPR(m_sh2_state->arg0); }
-static void cfunc_FIPR(void *param) { ((sh34_base_device *)param)->func_FIPR(); };
-
 bool sh34_base_device::generate_group_15_op1111_0x13_FIPR(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t opcode, int in_delay_slot, uint32_t ovrpc)
 {
-	save_fast_iregs(block);
-	UML_MOV(block, mem(&m_sh2_state->arg0), desc->opptr.w[0]);
-	UML_CALLC(block, cfunc_FIPR, this);
-	load_fast_iregs(block);
+	// same order of operations as the interpreter, so results match bit for bit
+	uint32_t const n = Rn & 12;
+	uint32_t const m = (Rn & 3) << 2;
+
+	UML_FSMUL(block, F0, FPS32(n + 0), FPS32(m + 0));
+	UML_FSMUL(block, F1, FPS32(n + 1), FPS32(m + 1));
+	UML_FSMUL(block, F2, FPS32(n + 2), FPS32(m + 2));
+	UML_FSMUL(block, F3, FPS32(n + 3), FPS32(m + 3));
+	UML_FSADD(block, F0, F0, F1);
+	UML_FSADD(block, F0, F0, F2);
+	UML_FSADD(block, FPS32(n + 3), F0, F3);
 	return true;
 }
 
@@ -3922,15 +3926,24 @@ bool sh34_base_device::generate_group_15_op1111_0x13_op1111_0xf13_FRCHG(drcuml_b
 	return true;
 }
 
-void sh34_base_device::func_FTRV() { FTRV(m_sh2_state->arg0); }
-static void cfunc_FTRV(void *param) { ((sh34_base_device *)param)->func_FTRV(); };
-
 bool sh34_base_device::generate_group_15_op1111_0x13_op1111_0xf13_FTRV(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t opcode, int in_delay_slot, uint32_t ovrpc)
 {
-	save_fast_iregs(block);
-	UML_MOV(block, mem(&m_sh2_state->arg0), desc->opptr.w[0]);
-	UML_CALLC(block, cfunc_FTRV, this);
-	load_fast_iregs(block);
+	// the interpreter sums from +0.0 in column order, which decides the sign
+	// of zero results; keep all four sums in registers until FVn is consumed
+	uint32_t const n = Rn & 12;
+	uml::parameter const sum[4] = { uml::F0, uml::F1, uml::F2, uml::F3 };
+
+	UML_FSFRINT(block, F5, 0, SIZE_DWORD);
+	for (int i = 0; i < 4; i++)
+	{
+		for (int j = 0; j < 4; j++)
+		{
+			UML_FSMUL(block, F4, uml::mem((float *)&m_sh2_state->m_xf[(j << 2) + i]), FPS32(n + j));
+			UML_FSADD(block, sum[i], j ? sum[i] : F5, F4);
+		}
+	}
+	for (int i = 0; i < 4; i++)
+		UML_FSMOV(block, FPS32(n + i), sum[i]);
 	return true;
 }
 
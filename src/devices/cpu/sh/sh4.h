@@ -231,11 +231,9 @@ public:
 	void func_FMAC();
 	void func_FABS();
 	void func_FLDS();
-	void func_FTRV();
 	void func_FSTS();
 	void func_FSSCA();
 	void func_FCNVSD();
-	void func_FIPR();
 	void func_FSRRA();
 	void func_FSQRT();
 	void func_FCNVDS();
@@ -1863,6 +1863,24 @@ void FUNCTION_NAME(tms340x0_device::fill)(int dst_is_linear)
 		m_gfxcycles += 2;
 		m_st |= STBIT_P;
 
+		/* a plain replace writes the same value to every full word, and can */
+		/* write straight into RAM on a 16-bit bus when the debugger isn't watching */
+		uint16_t fullword = 0;
+		bool const direct = !PIXEL_OP_REQUIRES_SOURCE && !TRANSPARENCY && full_words != 0 &&
+				word_write == &tms340x0_device::memory_w && space(AS_PROGRAM).data_width() == 16 &&
+				!(machine().debug_flags & DEBUG_FLAG_ENABLED);
+		if (!PIXEL_OP_REQUIRES_SOURCE && !TRANSPARENCY)
+		{
+			uint16_t dstmask = PIXEL_MASK, pixel;
+			for (x = 0; x < PIXELS_PER_WORD; x++)
+			{
+				pixel = COLOR1() & dstmask;
+				PIXEL_OP(fullword, dstmask, pixel);
+				fullword = (fullword & ~dstmask) | pixel;
+				dstmask = dstmask << BITS_PER_PIXEL;
+			}
+		}
+
 		/* loop over rows */
 		for (y = 0; y < dy; y++)
 		{
@@ -1899,8 +1917,26 @@ void FUNCTION_NAME(tms340x0_device::fill)(int dst_is_linear)
 				(this->*word_write)(dwordaddr++ << 4, dstword);
 			}
 
+			/* a plain replace stores the precomputed word, directly if the row is in one RAM block */
+			words = 0;
+			if (!PIXEL_OP_REQUIRES_SOURCE && !TRANSPARENCY)
+			{
+				uint16_t *const dest = direct ? reinterpret_cast<uint16_t *>(space(AS_PROGRAM).get_write_ptr(dwordaddr << 4)) : nullptr;
+				if (dest && reinterpret_cast<uint16_t *>(space(AS_PROGRAM).get_write_ptr((dwordaddr + full_words - 1) << 4)) == dest + full_words - 1)
+				{
+					std::fill_n(dest, full_words, fullword);
+					dwordaddr += full_words;
+				}
+				else
+				{
+					for ( ; words < full_words; words++)
+						(this->*word_write)(dwordaddr++ << 4, fullword);
+				}
+				words = full_words;
+			}
+
 			/* loop over full words */
-			for (words = 0; words < full_words; words++)
+			for ( ; words < full_words; words++)
 			{
 				/* fetch the destination word (if necessary) */
 				if (PIXEL_OP_REQUIRES_SOURCE || TRANSPARENCY)
@@ -54,6 +54,11 @@ WRITE_LINE_MEMBER(tms57002_device::pload_w)
 			ca = 0;
 			sti &= ~(SU_MASK);
 		}
+		else
+		{
+			// the program may have changed under the decoded blocks
+			cache_flush();
+		}
 	}
 }
 
@@ -945,6 +950,11 @@ void tms57002_device::device_resolve_objects()
 	m_empty_callback.resolve_safe();
 }
 
+void tms57002_device::device_post_load()
+{
+	cache_flush();
+}
+
 void tms57002_device::device_start()
 {
 	sti = S_IDLE;
@@ -836,6 +836,64 @@ u8 uml::instruction::modified_flags() const
 }
 
 
+//-------------------------------------------------
+//  param_is_input - return true if a parameter
+//  is read by the instruction
+//-------------------------------------------------
+
+bool uml::instruction::param_is_input(int paramnum) const
+{
+	assert(paramnum < m_numparams);
+	return (s_opcode_info_table[m_opcode].param[paramnum].output & PIO_IN) != 0;
+}
+
+
+//-------------------------------------------------
+//  param_is_output - return true if a parameter
+//  is written by the instruction
+//-------------------------------------------------
+
+bool uml::instruction::param_is_output(int paramnum) const
+{
+	assert(paramnum < m_numparams);
+	return (s_opcode_info_table[m_opcode].param[paramnum].output & PIO_OUT) != 0;
+}
+
+
+//-------------------------------------------------
+//  param_accepts - return true if a parameter
+//  may be of the given type
+//-------------------------------------------------
+
+bool uml::instruction::param_accepts(int paramnum, parameter::parameter_type type) const
+{
+	assert(paramnum < m_numparams);
+	return (s_opcode_info_table[m_opcode].param[paramnum].typemask & (1 << type)) != 0;
+}
+
+
+//-------------------------------------------------
+//  param_size - return the size in bytes of the
+//  value a parameter refers to
+//-------------------------------------------------
+
+u8 uml::instruction::param_size(int paramnum) const
+{
+	assert(paramnum < m_numparams);
+	switch (s_opcode_info_table[m_opcode].param[paramnum].size)
+	{
+		case PSIZE_4:   return 4;
+		case PSIZE_8:   return 8;
+		case PSIZE_P1:  return 1 << m_param[0].size();
+		case PSIZE_P2:  return 1 << m_param[1].size();
+		case PSIZE_P3:  return 1 << m_param[2].size();
+		case PSIZE_P4:  return 1 << m_param[3].size();
+		default:
+		case PSIZE_OP:  return m_size;
+	}
+}
+
+
 //-------------------------------------------------
 //  disasm - disassemble an instruction to the
 //  given buffer
@@ -884,18 +942,7 @@ std::string uml::instruction::disasm(drcuml_state *drcuml) const
 		case parameter::PTYPE_IMMEDIATE:
 			{
 				// determine the size of the immediate
-				int size;
-				switch (opinfo.param[pnum].size)
-				{
-					case PSIZE_4:   size = 4; break;
-					case PSIZE_8:   size = 8; break;
-					case PSIZE_P1:  size = 1 << m_param[0].size(); break;
-					case PSIZE_P2:  size = 1 << m_param[1].size(); break;
-					case PSIZE_P3:  size = 1 << m_param[2].size(); break;
-					case PSIZE_P4:  size = 1 << m_param[3].size(); break;
-					default:
-					case PSIZE_OP:  size = m_size; break;
-				}
+				int const size = param_size(pnum);
 
 				// truncate to size
 				u64 value = param.immediate();
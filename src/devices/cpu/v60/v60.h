@@ -166,9 +166,12 @@ private:
 	memory_access<32, 1, 0, ENDIANNESS_LITTLE>::cache m_cache16;
 	memory_access<32, 2, 0, ENDIANNESS_LITTLE>::cache m_cache32;
 
-	std::function<u8  (offs_t)> m_pr8;
-	std::function<u16 (offs_t)> m_pr16;
-	std::function<u32 (offs_t)> m_pr32;
+	bool m_bus16;       // V60 has a 16-bit bus, V70 a 32-bit one
+
+	// opcode fetches, inline so decoding doesn't go through an indirect call per byte
+	u8  op_read8(offs_t address)  { return m_bus16 ? m_cache16.read_byte(address) : m_cache32.read_byte(address); }
+	u16 op_read16(offs_t address) { return m_bus16 ? m_cache16.read_word_unaligned(address) : m_cache32.read_word_unaligned(address); }
+	u32 op_read32(offs_t address) { return m_bus16 ? m_cache16.read_dword_unaligned(address) : m_cache32.read_dword_unaligned(address); }
 	address_space *m_io;
 	uint32_t              m_PPC;
 	int                 m_icount;
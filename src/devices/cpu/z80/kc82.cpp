@@ -62,6 +62,10 @@ void kc82_device::device_start()
 {
 	z80_device::device_start();
 
+	// every access goes through the MMU
+	m_memory_hooks = true;
+	m_fetch_hooks = true;
+
 	for (int n = 1; n <= 4; n++)
 	{
 		state_add(KC82_B1 + n - 1, string_format("B%d", n).c_str(), m_mmu_b[n],
@@ -202,30 +206,30 @@ bool kc82_device::memory_translate(int spacenum, int intention, offs_t &address)
 
 
 //-------------------------------------------------
-//  rm - read one byte from memory
+//  rm_hook - read one byte from memory
 //-------------------------------------------------
 
-u8 kc82_device::rm(u16 addr)
+u8 kc82_device::rm_hook(u16 addr)
 {
 	return m_data.read_byte(addr + m_mmu_base[addr >> 10]);
 }
 
 
 //-------------------------------------------------
-//  wm - write one byte to memory
+//  wm_hook - write one byte to memory
 //-------------------------------------------------
 
-void kc82_device::wm(u16 addr, u8 value)
+void kc82_device::wm_hook(u16 addr, u8 value)
 {
 	m_data.write_byte(addr + m_mmu_base[addr >> 10], value);
 }
 
 
 //-------------------------------------------------
-//  rop - read opcode
+//  rop_hook - read opcode
 //-------------------------------------------------
 
-u8 kc82_device::rop()
+u8 kc82_device::rop_hook()
 {
 	u32 pc = m_pc.w.l + m_mmu_base[m_pc.b.h >> 2];
 	m_pc.w.l++;
@@ -235,10 +239,10 @@ u8 kc82_device::rop()
 
 
 //-------------------------------------------------
-//  arg - read 8-bit argument
+//  arg_hook - read 8-bit argument
 //-------------------------------------------------
 
-u8 kc82_device::arg()
+u8 kc82_device::arg_hook()
 {
 	u32 pc = m_pc.w.l + m_mmu_base[m_pc.b.h >> 2];
 	m_pc.w.l++;
@@ -247,12 +251,12 @@ u8 kc82_device::arg()
 
 
 //-------------------------------------------------
-//  arg16 - read 16-bit argument
+//  arg16_hook - read 16-bit argument
 //-------------------------------------------------
 
-u16 kc82_device::arg16()
+u16 kc82_device::arg16_hook()
 {
-	u16 d16 = arg();
-	d16 |= u16(arg()) << 8;
+	u16 d16 = arg_hook();
+	d16 |= u16(arg_hook()) << 8;
 	return d16;
 }
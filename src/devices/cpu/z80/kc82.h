@@ -41,11 +41,11 @@ protected:
 	virtual bool memory_translate(int spacenum, int intention, offs_t &address) override;
 
 	// z80_device overrides
-	virtual u8 rm(u16 addr) override;
-	virtual void wm(u16 addr, u8 value) override;
-	virtual u8 rop() override;
-	virtual u8 arg() override;
-	virtual u16 arg16() override;
+	virtual u8 rm_hook(u16 addr) override;
+	virtual void wm_hook(u16 addr, u8 value) override;
+	virtual u8 rop_hook() override;
+	virtual u8 arg_hook() override;
+	virtual u16 arg16_hook() override;
 
 	// MMU access
 	u8 mmu_r(offs_t offset);
@@ -438,7 +438,12 @@ inline void z80_device::out(uint16_t port, uint8_t value)
 /***************************************************************
  * Read a byte from given memory location
  ***************************************************************/
-uint8_t z80_device::rm(uint16_t addr)
+inline uint8_t z80_device::rm(uint16_t addr)
+{
+	return m_memory_hooks ? rm_hook(addr) : m_data.read_byte(addr);
+}
+
+uint8_t z80_device::rm_hook(uint16_t addr)
 {
 	return m_data.read_byte(addr);
 }
@@ -455,7 +460,15 @@ inline void z80_device::rm16(uint16_t addr, PAIR &r)
 /***************************************************************
  * Write a byte to given memory location
  ***************************************************************/
-void z80_device::wm(uint16_t addr, uint8_t value)
+inline void z80_device::wm(uint16_t addr, uint8_t value)
+{
+	if (m_memory_hooks)
+		wm_hook(addr, value);
+	else
+		m_data.write_byte(addr, value);
+}
+
+void z80_device::wm_hook(uint16_t addr, uint8_t value)
 {
 	m_data.write_byte(addr, value);
 }
@@ -474,7 +487,17 @@ inline void z80_device::wm16(uint16_t addr, PAIR &r)
  * reading opcodes. In case of system with memory mapped I/O,
  * this function can be used to greatly speed up emulation
  ***************************************************************/
-uint8_t z80_device::rop()
+inline uint8_t z80_device::rop()
+{
+	if (m_fetch_hooks)
+		return rop_hook();
+
+	unsigned pc = PCD;
+	PC++;
+	return m_opcodes.read_byte(pc);
+}
+
+uint8_t z80_device::rop_hook()
 {
 	unsigned pc = PCD;
 	PC++;
@@ -491,14 +514,34 @@ uint8_t z80_device::rop()
  * support systems that use different encoding mechanisms for
  * opcodes and opcode arguments
  ***************************************************************/
-uint8_t z80_device::arg()
+inline uint8_t z80_device::arg()
+{
+	if (m_memory_hooks)
+		return arg_hook();
+
+	unsigned pc = PCD;
+	PC++;
+	return m_args.read_byte(pc);
+}
+
+uint8_t z80_device::arg_hook()
 {
 	unsigned pc = PCD;
 	PC++;
 	return m_args.read_byte(pc);
 }
 
-uint16_t z80_device::arg16()
+inline uint16_t z80_device::arg16()
+{
+	if (m_memory_hooks)
+		return arg16_hook();
+
+	unsigned pc = PCD;
+	PC += 2;
+	return m_args.read_word(pc);
+}
+
+uint16_t z80_device::arg16_hook()
 {
 	unsigned pc = PCD;
 	PC += 2;
@@ -3454,6 +3497,10 @@ void z80_device::device_start()
 	m_cc_xycb = cc_xycb;
 	m_cc_ex = cc_ex;
 
+	// without a refresh callback there's nothing to do between fetches
+	m_memory_hooks = false;
+	m_fetch_hooks = !m_refresh_cb.isnull();
+
 	m_irqack_cb.resolve_safe();
 	m_refresh_cb.resolve_safe();
 	m_halt_cb.resolve_safe();
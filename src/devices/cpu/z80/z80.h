@@ -148,13 +148,20 @@ protected:
 	void leave_halt();
 	uint8_t in(uint16_t port);
 	void out(uint16_t port, uint8_t value);
-	virtual uint8_t rm(uint16_t addr);
+	uint8_t rm(uint16_t addr);
 	void rm16(uint16_t addr, PAIR &r);
-	virtual void wm(uint16_t addr, uint8_t value);
+	void wm(uint16_t addr, uint8_t value);
 	void wm16(uint16_t addr, PAIR &r);
-	virtual uint8_t rop();
-	virtual uint8_t arg();
-	virtual uint16_t arg16();
+	uint8_t rop();
+	uint8_t arg();
+	uint16_t arg16();
+
+	// precise accessors, only used when m_memory_hooks or m_fetch_hooks is set
+	virtual uint8_t rm_hook(uint16_t addr);
+	virtual void wm_hook(uint16_t addr, uint8_t value);
+	virtual uint8_t rop_hook();
+	virtual uint8_t arg_hook();
+	virtual uint16_t arg16_hook();
 	void eax();
 	void eay();
 	void pop(PAIR &r);
@@ -246,6 +253,9 @@ protected:
 	devcb_write8 m_refresh_cb;
 	devcb_write_line m_halt_cb;
 
+	bool            m_memory_hooks;     // a subclass remaps memory
+	bool            m_fetch_hooks;      // opcode fetches need the refresh callback or remapping
+
 	PAIR            m_prvpc;
 	PAIR            m_pc;
 	PAIR            m_sp;
@@ -27,10 +27,15 @@ avivideo_image_device::avivideo_image_device(const machine_config &mconfig, cons
 	device_t(mconfig, IMAGE_AVIVIDEO, tag, owner, clock),
 	device_image_interface(mconfig, *this),
 	m_frame(nullptr),
+	m_next_frame(nullptr),
 	m_avi(nullptr),
 	m_frame_timer(nullptr),
 	m_frame_count(0),
-	m_frame_num(0)
+	m_frame_num(0),
+	m_work_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_IO)),
+	m_read_item(nullptr),
+	m_next_frame_num(~0U),
+	m_next_result(avi_file::error::NONE)
 {
 }
 
@@ -41,6 +46,7 @@ avivideo_image_device::avivideo_image_device(const machine_config &mconfig, cons
 avivideo_image_device::~avivideo_image_device()
 {
 	call_unload();
+	osd_work_queue_free(m_work_queue);
 }
 
 
@@ -64,17 +70,25 @@ void avivideo_image_device::device_timer(emu_timer &timer, device_timer_id id, i
 	{
 		if (m_avi != nullptr)
 		{
-			avi_file::error avierr = m_avi->read_uncompressed_video_frame(m_frame_num, *m_frame);
-			if (avierr != avi_file::error::NONE)
+			// use the frame read ahead if it's the right one, otherwise read it now
+			finish_read();
+			if (m_next_frame_num != m_frame_num)
+			{
+				m_next_frame_num = m_frame_num;
+				m_next_result = m_avi->read_uncompressed_video_frame(m_frame_num, *m_next_frame);
+			}
+			if (m_next_result != avi_file::error::NONE)
 			{
 				m_frame_timer->adjust(attotime::never);
 				return;
 			}
+			std::swap(m_frame, m_next_frame);
 			m_frame_num++;
 			if (m_frame_num >= m_frame_count)
 			{
 				m_frame_num = 0;
 			}
+			queue_read(m_frame_num);
 		}
 		else
 		{
@@ -86,11 +100,14 @@ void avivideo_image_device::device_timer(emu_timer &timer, device_timer_id id, i
 image_init_result avivideo_image_device::call_load()
 {
 	m_frame = new bitmap_argb32;
+	m_next_frame = new bitmap_argb32;
 	avi_file::error avierr = avi_file::open(filename(), m_avi);
 	if (avierr != avi_file::error::NONE)
 	{
 		delete m_frame;
+		delete m_next_frame;
 		m_frame = nullptr;
+		m_next_frame = nullptr;
 		return image_init_result::FAIL;
 	}
 
@@ -100,19 +117,52 @@ image_init_result avivideo_image_device::call_load()
 	m_frame_timer->adjust(frame_time, 0, frame_time);
 	m_frame_count = aviinfo.video_numsamples;
 	m_frame_num = 0;
+	queue_read(m_frame_num);
 	return image_init_result::PASS;
 }
 
 void avivideo_image_device::call_unload()
 {
+	finish_read();
+	m_next_frame_num = ~0U;
 	if (m_frame)
 	{
 		delete m_frame;
 		m_frame = nullptr;
 	}
+	if (m_next_frame)
+	{
+		delete m_next_frame;
+		m_next_frame = nullptr;
+	}
 	if (m_avi)
 	{
 		m_avi.release();
 		m_avi = nullptr;
 	}
 }
+
+void avivideo_image_device::queue_read(uint32_t frame_num)
+{
+	m_next_frame_num = frame_num;
+	m_read_item = osd_work_item_queue(m_work_queue, read_async_static, this, 0);
+	if (m_read_item == nullptr)
+		m_next_frame_num = ~0U;
+}
+
+void avivideo_image_device::finish_read()
+{
+	if (m_read_item != nullptr)
+	{
+		osd_work_item_wait(m_read_item, osd_ticks_per_second() * 10);
+		osd_work_item_release(m_read_item);
+		m_read_item = nullptr;
+	}
+}
+
+void *avivideo_image_device::read_async_static(void *param, int threadid)
+{
+	avivideo_image_device &dev = *reinterpret_cast<avivideo_image_device *>(param);
+	dev.m_next_result = dev.m_avi->read_uncompressed_video_frame(dev.m_next_frame_num, *dev.m_next_frame);
+	return nullptr;
+}
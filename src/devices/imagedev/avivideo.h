@@ -52,12 +52,23 @@ protected:
 private:
 	static constexpr device_timer_id TIMER_FRAME = 0;
 
+	void queue_read(uint32_t frame_num);
+	void finish_read();
+	static void *read_async_static(void *param, int threadid);
+
 	bitmap_argb32 *m_frame;
+	bitmap_argb32 *m_next_frame;
 	avi_file::ptr m_avi;
 
 	emu_timer *m_frame_timer;
 	uint32_t m_frame_count;
 	uint32_t m_frame_num;
+
+	// the next frame is read on a work queue while the current one is shown
+	osd_work_queue *m_work_queue;
+	osd_work_item *m_read_item;
+	uint32_t m_next_frame_num;
+	avi_file::error m_next_result;
 };
 
 
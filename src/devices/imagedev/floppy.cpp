@@ -11,8 +11,15 @@
 
 #include "speaker.h"
 #include "formats/imageutl.h"
+#include "hashing.h"
 #include "zippath.h"
 
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
 /*
     Debugging flags. Set to 0 or 1.
 */
@@ -25,6 +32,68 @@
 
 #define FLOPSND_TAG "floppysound"
 
+namespace {
+
+// images up to this size are read into memory once, identified there in parallel and remembered by hash
+constexpr uint64_t MAX_BUFFERED_IDENTIFY = 64 * 1024 * 1024;
+
+// bytes offered to the format prefilters
+constexpr size_t IDENTIFY_HEADER = 256;
+
+// ioprocs over an image read into memory, so each format can identify it on its own thread
+struct memory_image
+{
+	const std::vector<uint8_t> *data;
+	uint64_t pos;
+};
+
+int memory_image_seekproc(void *file, int64_t offset, int whence)
+{
+	memory_image &mem = *reinterpret_cast<memory_image *>(file);
+	switch(whence) {
+	case SEEK_SET: mem.pos = offset; break;
+	case SEEK_CUR: mem.pos += offset; break;
+	case SEEK_END: mem.pos = mem.data->size() + offset; break;
+	}
+	return 0;
+}
+
+size_t memory_image_readproc(void *file, void *buffer, size_t length)
+{
+	memory_image &mem = *reinterpret_cast<memory_image *>(file);
+	if(mem.pos >= mem.data->size())
+		return 0;
+	length = std::min<uint64_t>(length, mem.data->size() - mem.pos);
+	memcpy(buffer, &(*mem.data)[mem.pos], length);
+	mem.pos += length;
+	return length;
+}
+
+size_t memory_image_writeproc(void *file, const void *buffer, size_t length)
+{
+	return 0;
+}
+
+uint64_t memory_image_filesizeproc(void *file)
+{
+	return reinterpret_cast<memory_image *>(file)->data->size();
+}
+
+const io_procs memory_image_ioprocs =
+{
+	nullptr,
+	memory_image_seekproc,
+	memory_image_readproc,
+	memory_image_writeproc,
+	memory_image_filesizeproc
+};
+
+// format chosen for each image seen, keyed by content hash, form factor and format list
+std::mutex s_identify_mutex;
+std::unordered_map<std::string, std::string> s_identify_cache;
+
+} // anonymous namespace
+
 // device type definition
 DEFINE_DEVICE_TYPE(FLOPPY_CONNECTOR, floppy_connector, "floppy_connector", "Floppy drive connector abstraction")
 
@@ -409,17 +478,91 @@ floppy_image_format_t *floppy_image_device::identify(std::string filename)
 	io.file = fd.get();
 	io.procs = &corefile_ioprocs_noclose;
 	io.filler = 0xff;
+	floppy_image_format_t *const best_format = identify_format(&io);
+	fd.reset();
+	return best_format;
+}
+
+floppy_image_format_t *floppy_image_device::identify_format(io_generic *io)
+{
+	// cheap pass: let formats with a signature reject the image from its first bytes
+	uint64_t const size = io_generic_size(io);
+	uint8_t header[IDENTIFY_HEADER];
+	io_generic_read(io, header, 0, sizeof(header));
+	std::vector<floppy_image_format_t *> candidates;
+	for(floppy_image_format_t *format = fif_list; format; format = format->next)
+		if(format->prefilter(header, sizeof(header), size, form_factor))
+			candidates.push_back(format);
+	if(candidates.empty())
+		return nullptr;
+
+	// huge images are left alone: identify the few candidates straight from the file
+	if(size > MAX_BUFFERED_IDENTIFY) {
+		int best = 0;
+		floppy_image_format_t *best_format = nullptr;
+		for(floppy_image_format_t *format : candidates) {
+			int score = format->identify(io, form_factor);
+			if(score > best) {
+				best = score;
+				best_format = format;
+			}
+		}
+		return best_format;
+	}
+
+	std::vector<uint8_t> data(size);
+	if(size)
+		io_generic_read(io, &data[0], 0, size);
+
+	// the same image under the same format list always gets the same answer
+	util::sha1_creator hash;
+	if(size)
+		hash.append(&data[0], size);
+	std::string key = string_format("%s %u", hash.finish().as_string(), form_factor);
+	for(floppy_image_format_t *format = fif_list; format; format = format->next)
+		key.append(" ").append(format->name());
+	{
+		std::lock_guard<std::mutex> lock(s_identify_mutex);
+		auto const found = s_identify_cache.find(key);
+		if(found != s_identify_cache.end()) {
+			for(floppy_image_format_t *format = fif_list; format; format = format->next)
+				if(found->second == format->name())
+					return format;
+			return nullptr;
+		}
+	}
+
+	// full pass: each remaining format reads its own view of the image on a worker
+	std::vector<int> scores(candidates.size(), 0);
+	std::atomic<size_t> next(0);
+	auto const worker = [this, io, &data, &candidates, &scores, &next] ()
+	{
+		for(size_t i = next++; i < candidates.size(); i = next++) {
+			memory_image mem{ &data, 0 };
+			io_generic mio{ &memory_image_ioprocs, &mem, io->filler };
+			scores[i] = candidates[i]->identify(&mio, form_factor);
+		}
+	};
+	size_t const threads = std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1U), candidates.size());
+	std::vector<std::future<void>> workers;
+	for(size_t i = 1; i < threads; i++)
+		workers.emplace_back(std::async(std::launch::async, worker));
+	worker();
+	for(auto &w : workers)
+		w.get();
+
+	// ties go to the format listed first, as they always have
 	int best = 0;
 	floppy_image_format_t *best_format = nullptr;
-	for (floppy_image_format_t *format = fif_list; format; format = format->next)
-	{
-		int score = format->identify(&io, form_factor);
-		if(score > best) {
-			best = score;
-			best_format = format;
+	for(size_t i = 0; i < candidates.size(); i++) {
+		if(scores[i] > best) {
+			best = scores[i];
+			best_format = candidates[i];
 		}
 	}
-	fd.reset();
+
+	std::lock_guard<std::mutex> lock(s_identify_mutex);
+	s_identify_cache.emplace(std::move(key), best_format ? best_format->name() : "");
 	return best_format;
 }
 
@@ -457,15 +600,7 @@ image_init_result floppy_image_device::call_load()
 	io.file = (device_image_interface *)this;
 	io.procs = &image_ioprocs;
 	io.filler = 0xff;
-	int best = 0;
-	floppy_image_format_t *best_format = nullptr;
-	for(floppy_image_format_t *format = fif_list; format; format = format->next) {
-		int score = format->identify(&io, form_factor);
-		if(score > best) {
-			best = score;
-			best_format = format;
-		}
-	}
+	floppy_image_format_t *const best_format = identify_format(&io);
 
 	if(!best_format)
 	{
@@ -933,6 +1068,91 @@ attotime floppy_image_device::get_next_transition(const attotime &from_when)
 	}
 }
 
+// Skip ahead for controllers hunting for an address mark: walk the
+// track buffer with ideal cell timing instead of a pll, looking for the
+// 16 cells of pattern.  Returns a time a little before the mark, so
+// the controller's pll has some gap to lock onto, or a little before
+// limit if there's no mark until then.  Returns from_when, i.e. "read
+// it the slow way", when the track has weak or missing flux on the way,
+// since what the pll makes of those can't be predicted.
+attotime floppy_image_device::find_next_mark(const attotime &from_when, const attotime &limit, const attotime &cell, u16 pattern)
+{
+	// cells of margin before a mark and before the limit
+	const int margin = 64;
+
+	if(!image || mon || limit <= from_when + cell*(2*margin))
+		return from_when;
+
+	std::vector<uint32_t> &buf = image->get_buffer(cyl, ss, subcyl);
+	int cells = buf.size();
+	if(cells <= 1)
+		return from_when;
+
+	// start a little early, in case a mark straddles from_when
+	attotime base;
+	uint32_t start = find_position(base, from_when - cell*32);
+	int index = find_index(start, buf);
+	if(index == -1)
+		return from_when;
+
+	double cell_pos = cell.as_double() * floppy_ratio_1 * 1000000.0;
+	double weak_pos = 16e-6 * floppy_ratio_1 * 1000000.0;
+	int64_t end = int64_t(start) + ((limit - (from_when - cell*32))*floppy_ratio_1).as_ticks(1000000);
+	if(end - start > 200000000)
+		return from_when;
+
+	int64_t offset = 0;
+	int64_t prev = -1;
+	u16 shift = 0;
+	for(;;) {
+		u32 type = buf[index] & floppy_image::MG_MASK;
+		if(type != floppy_image::MG_A && type != floppy_image::MG_B)
+			return from_when;
+
+		index++;
+		if(index >= cells) {
+			index = test_track_last_entry_warps(buf) ? 1 : 0;
+			offset += 200000000;
+		}
+		int64_t pos = offset + (buf[index] & floppy_image::TIME_MASK);
+		if(pos > end)
+			break;
+		if(pos <= start)
+			continue;
+
+		if(prev >= 0) {
+			double delta = double(pos - prev);
+			if(delta >= weak_pos)
+				return from_when;
+
+			// shift in the zero cells, then the one
+			int count = int(delta / cell_pos + 0.5);
+			if(count < 1)
+				count = 1;
+			int64_t match = -1;
+			for(int i = 1; i < count && i <= 16 && match < 0; i++) {
+				shift <<= 1;
+				if(shift == pattern)
+					match = prev + int64_t(i * cell_pos);
+			}
+			shift = (shift << 1) | 1;
+			if(match < 0 && shift == pattern)
+				match = pos;
+
+			if(match >= 0) {
+				int64_t resume = match - int64_t((15 + margin) * cell_pos);
+				if(resume <= start + int64_t(32 * cell_pos))
+					return from_when;
+				return position_to_time(base, int(resume));
+			}
+		}
+		prev = pos;
+	}
+
+	attotime when = limit - cell*margin;
+	return when > from_when ? when : from_when;
+}
+
 void floppy_image_device::write_flux(const attotime &start, const attotime &end, int transition_count, const attotime *transitions)
 {
 	if(!image || mon)
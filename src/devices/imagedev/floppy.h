@@ -124,6 +124,7 @@ public:
 	void index_resync();
 	attotime time_next_index();
 	attotime get_next_transition(const attotime &from_when);
+	attotime find_next_mark(const attotime &from_when, const attotime &limit, const attotime &cell, u16 pattern);
 	void write_flux(const attotime &start, const attotime &end, int transition_count, const attotime *transitions);
 	void set_write_splice(const attotime &when);
 	int get_sides() { return sides; }
@@ -151,6 +152,7 @@ protected:
 	virtual void setup_characteristics() = 0;
 
 	void init_floppy_load(bool write_supported);
+	floppy_image_format_t *identify_format(io_generic *io);
 
 	floppy_image_format_t *input_format;
 	floppy_image_format_t *output_format;
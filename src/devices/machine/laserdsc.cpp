@@ -76,6 +76,13 @@ laserdisc_device::laserdisc_device(const machine_config &mconfig, device_type ty
 		m_readresult(CHDERR_NONE),
 		m_chdtracks(0),
 		m_work_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_IO)),
+		m_read_item(nullptr),
+		m_queued_hunknum(0),
+		m_readhistory{ 0, 0 },
+		m_prefetch_item(nullptr),
+		m_prefetch_hunknum(~0U),
+		m_prefetch_result(CHDERR_NONE),
+		m_prefetch_samples(0),
 		m_audiosquelch(0),
 		m_videosquelch(0),
 		m_fieldnum(0),
@@ -236,6 +243,11 @@ void laserdisc_device::device_stop()
 	// make sure all async operations have completed
 	if (m_disc != nullptr)
 		osd_work_queue_wait(m_work_queue, osd_ticks_per_second() * 10);
+	if (m_read_item != nullptr)
+		osd_work_item_release(m_read_item);
+	if (m_prefetch_item != nullptr)
+		osd_work_item_release(m_prefetch_item);
+	m_read_item = m_prefetch_item = nullptr;
 
 	// free any textures and palettes
 	if (m_videotex != nullptr)
@@ -719,6 +731,9 @@ void laserdisc_device::init_video()
 		frame.m_visbitmap.set_palette(m_videopalette);
 	}
 
+	// fields are prefetched into a bitmap of their own
+	m_prefetch_bitmap.allocate(m_width, m_height);
+
 	// allocate an empty frame of the same size
 	m_emptyframe.allocate(m_width, m_height * 2);
 	m_emptyframe.set_palette(m_videopalette);
@@ -769,6 +784,8 @@ void laserdisc_device::init_audio()
 	m_audiobufsize = m_audiomaxsamples * 4;
 	m_audiobuffer[0].resize(m_audiobufsize);
 	m_audiobuffer[1].resize(m_audiobufsize);
+	m_prefetch_audio[0].resize(m_audiomaxsamples);
+	m_prefetch_audio[1].resize(m_audiomaxsamples);
 }
 
 
@@ -953,18 +970,111 @@ void laserdisc_device::read_track_data()
 		m_metadata[m_fieldnum].line17 = m_metadata[m_fieldnum].line18 = m_metadata[m_fieldnum].line1718 = VBI_CODE_LEADIN;
 	}
 
-	// configure the codec and then read
+	// take the field from the prefetch if we predicted it, otherwise read it
 	m_readresult = CHDERR_FILE_NOT_FOUND;
 	if (m_disc != nullptr && !m_videosquelch)
 	{
-		m_readresult = m_disc->codec_configure(CHD_CODEC_AVHUFF, AVHUFF_CODEC_DECOMPRESS_CONFIG, &m_avhuff_config);
-		if (m_readresult == CHDERR_NONE)
+		if (readhunk == m_prefetch_hunknum)
+			use_prefetch();
+		else
 		{
+			// the CHD only does one read at a time, so a stale prefetch has to finish first
+			finish_prefetch();
 			m_queued_hunknum = readhunk;
 			m_readresult = CHDERR_OPERATION_PENDING;
-			osd_work_item_queue(m_work_queue, read_async_static, this, WORK_ITEM_FLAG_AUTO_RELEASE);
+			m_read_item = osd_work_item_queue(m_work_queue, read_async_static, this, 0);
+			if (m_read_item == nullptr)
+				m_readresult = CHDERR_FILE_NOT_FOUND;
 		}
+
+		// fields two apart step by the same amount whether playing, scanning or
+		// holding a still frame, so predict the next field from the one before this
+		int64_t const predicted = int64_t(m_readhistory[0]) + int64_t(readhunk) - int64_t(m_readhistory[1]);
+		if (predicted >= 0 && predicted < int64_t(m_chdtracks) * 2)
+			queue_prefetch(uint32_t(predicted));
 	}
+	m_readhistory[1] = m_readhistory[0];
+	m_readhistory[0] = readhunk;
+}
+
+
+//-------------------------------------------------
+//  queue_prefetch - start decoding a field we
+//  expect to be asked for next
+//-------------------------------------------------
+
+void laserdisc_device::queue_prefetch(uint32_t hunknum)
+{
+	finish_prefetch();
+	m_prefetch_hunknum = hunknum;
+	m_prefetch_result = CHDERR_OPERATION_PENDING;
+	m_prefetch_item = osd_work_item_queue(m_work_queue, prefetch_async_static, this, 0);
+	if (m_prefetch_item == nullptr)
+		m_prefetch_hunknum = ~0U;
+}
+
+
+//-------------------------------------------------
+//  finish_prefetch - wait for any outstanding
+//  prefetch to complete
+//-------------------------------------------------
+
+void laserdisc_device::finish_prefetch()
+{
+	if (m_prefetch_item != nullptr)
+	{
+		osd_work_item_wait(m_prefetch_item, osd_ticks_per_second() * 10);
+		osd_work_item_release(m_prefetch_item);
+		m_prefetch_item = nullptr;
+	}
+	m_prefetch_hunknum = ~0U;
+}
+
+
+//-------------------------------------------------
+//  use_prefetch - copy the prefetched field to
+//  the current read targets
+//-------------------------------------------------
+
+void laserdisc_device::use_prefetch()
+{
+	finish_prefetch();
+	m_readresult = m_prefetch_result;
+	if (m_readresult != CHDERR_NONE)
+		return;
+
+	// copy the video a line at a time into the frame
+	bitmap_yuy16 &dest = m_avhuff_config.video;
+	int const width = std::min(dest.width(), m_prefetch_bitmap.width());
+	int const height = std::min(dest.height(), m_prefetch_bitmap.height());
+	for (int y = 0; y < height; y++)
+		memcpy(&dest.pix16(y), &m_prefetch_bitmap.pix16(y), width * sizeof(uint16_t));
+
+	// and the audio
+	m_audiocursamples = std::min(m_prefetch_samples, m_audiomaxsamples);
+	for (int chnum = 0; chnum < 2; chnum++)
+		memcpy(m_avhuff_config.audio[chnum], &m_prefetch_audio[chnum][0], m_audiocursamples * sizeof(int16_t));
+}
+
+
+//-------------------------------------------------
+//  prefetch_async_static - work item callback for
+//  prefetches
+//-------------------------------------------------
+
+void *laserdisc_device::prefetch_async_static(void *param, int threadid)
+{
+	laserdisc_device &ld = *reinterpret_cast<laserdisc_device *>(param);
+	ld.m_prefetch_config.video.wrap(&ld.m_prefetch_bitmap.pix16(0), ld.m_prefetch_bitmap.width(), ld.m_prefetch_bitmap.height(), ld.m_prefetch_bitmap.rowpixels());
+	ld.m_prefetch_config.audio[0] = &ld.m_prefetch_audio[0][0];
+	ld.m_prefetch_config.audio[1] = &ld.m_prefetch_audio[1][0];
+	ld.m_prefetch_config.maxsamples = ld.m_audiomaxsamples;
+	ld.m_prefetch_config.actsamples = &ld.m_prefetch_samples;
+	ld.m_prefetch_samples = 0;
+	ld.m_prefetch_result = ld.m_disc->codec_configure(CHD_CODEC_AVHUFF, AVHUFF_CODEC_DECOMPRESS_CONFIG, &ld.m_prefetch_config);
+	if (ld.m_prefetch_result == CHDERR_NONE)
+		ld.m_prefetch_result = ld.m_disc->read_hunk(ld.m_prefetch_hunknum, nullptr);
+	return nullptr;
 }
 
 
@@ -976,7 +1086,9 @@ void laserdisc_device::read_track_data()
 void *laserdisc_device::read_async_static(void *param, int threadid)
 {
 	laserdisc_device &ld = *reinterpret_cast<laserdisc_device *>(param);
-	ld.m_readresult = ld.m_disc->read_hunk(ld.m_queued_hunknum, nullptr);
+	ld.m_readresult = ld.m_disc->codec_configure(CHD_CODEC_AVHUFF, AVHUFF_CODEC_DECOMPRESS_CONFIG, &ld.m_avhuff_config);
+	if (ld.m_readresult == CHDERR_NONE)
+		ld.m_readresult = ld.m_disc->read_hunk(ld.m_queued_hunknum, nullptr);
 	return nullptr;
 }
 
@@ -988,9 +1100,13 @@ void *laserdisc_device::read_async_static(void *param, int threadid)
 
 void laserdisc_device::process_track_data()
 {
-	// wait for the async operation to complete
-	if (m_readresult == CHDERR_OPERATION_PENDING)
-		osd_work_queue_wait(m_work_queue, osd_ticks_per_second() * 10);
+	// wait for the read to complete; a prefetch queued behind it can carry on
+	if (m_read_item != nullptr)
+	{
+		osd_work_item_wait(m_read_item, osd_ticks_per_second() * 10);
+		osd_work_item_release(m_read_item);
+		m_read_item = nullptr;
+	}
 	assert(m_readresult != CHDERR_OPERATION_PENDING);
 
 	// remove the video if we had an error
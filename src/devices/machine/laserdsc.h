@@ -260,6 +260,10 @@ private:
 	void read_track_data();
 	static void *read_async_static(void *param, int threadid);
 	void process_track_data();
+	void queue_prefetch(uint32_t hunknum);
+	void finish_prefetch();
+	void use_prefetch();
+	static void *prefetch_async_static(void *param, int threadid);
 	void config_load(config_type cfg_type, util::xml::data_node const *parentnode);
 	void config_save(config_type cfg_type, util::xml::data_node *parentnode);
 
@@ -285,7 +289,18 @@ private:
 
 	// async operations
 	osd_work_queue *    m_work_queue;           // work queue
+	osd_work_item *     m_read_item;            // outstanding read, if any
 	uint32_t              m_queued_hunknum;       // queued hunk
+	uint32_t              m_readhistory[2];       // previous two hunks read, most recent first
+
+	// prefetched field
+	osd_work_item *     m_prefetch_item;        // outstanding prefetch, if any
+	uint32_t              m_prefetch_hunknum;     // hunk prefetched, or ~0 if none
+	int                 m_prefetch_result;      // result of the prefetch
+	uint32_t              m_prefetch_samples;     // audio samples in the prefetched field
+	avhuff_decompress_config m_prefetch_config; // decompression configuration for the prefetch
+	bitmap_yuy16        m_prefetch_bitmap;      // prefetched field
+	std::vector<int16_t>       m_prefetch_audio[2];    // prefetched audio
 
 	// core states
 	uint8_t               m_audiosquelch;         // audio squelch state: bit 0 = audio 1, bit 1 = audio 2
@@ -16,17 +16,22 @@
 #include "netlist/nl_factory.h"
 #include "netlist/nl_parser.h"
 #include "netlist/nl_interface.h"
+#include "netlist/solver/nld_solver.h"
 
 #include "netlist/plib/palloc.h"
 #include "netlist/plib/pmempool.h"
 #include "netlist/plib/pdynlib.h"
 #include "netlist/plib/pstonum.h"
+#include "netlist/plib/pstream.h"
+#include "netlist/plib/putil.h"
 
 #include "debugger.h"
 #include "romload.h"
 #include "emuopts.h"
 
 #include <cmath>
+#include <cstdio>
+#include <cstdlib>
 #include <memory>
 #include <string>
 #include <utility>
@@ -287,27 +292,32 @@ void netlist_mame_device::register_memregion_source(netlist::nlparse_t &parser,
 void netlist_mame_analog_input_device::write(const double val)
 {
 	m_value_for_device_timer = val * m_mult + m_offset;
-	if (m_value_for_device_timer != (*m_param)())
+	if (m_value_for_device_timer != m_requested)
 	{
+		m_requested = m_value_for_device_timer;
 		synchronize(0, 0, &m_value_for_device_timer);
 }
 }
 
 void netlist_mame_analog_input_device::device_timer(emu_timer &timer, device_timer_id id, int param, void *ptr)
 {
-	update_to_current_time();
+	const double v = *((double *) ptr);
+	apply_input([this, v]()
+	{
 #if NETLIST_CREATE_CSV
-	nl_owner().log_add(m_param_name, *((double *) ptr), true);
+		nl_owner().log_add(m_param_name, v, true);
 #endif
-	m_param->set(*((double *) ptr));
+		m_param->set(v);
+	});
 }
 
 void netlist_mame_int_input_device::write(const uint32_t val)
 {
 	const uint32_t v = (val >> m_shift) & m_mask;
-	if (v != (*m_param)())
+	if (v != m_requested)
 	{
 		LOGDEBUG("write %s\n", this->tag());
+		m_requested = v;
 		synchronize(0, v);
 }
 }
@@ -315,29 +325,34 @@ void netlist_mame_int_input_device::write(const uint32_t val)
 void netlist_mame_logic_input_device::write(const uint32_t val)
 {
 	const uint32_t v = (val >> m_shift) & 1;
-	if (v != (*m_param)())
+	if (v != m_requested)
 	{
 		LOGDEBUG("write %s\n", this->tag());
+		m_requested = v;
 		synchronize(0, v);
 	}
 }
 
 void netlist_mame_int_input_device::device_timer(emu_timer &timer, device_timer_id id, int param, void *ptr)
 {
-	update_to_current_time();
+	apply_input([this, param]()
+	{
 #if NETLIST_CREATE_CSV
-	nl_owner().log_add(m_param_name, param, false);
+		nl_owner().log_add(m_param_name, param, false);
 #endif
-	m_param->set(param);
+		m_param->set(param);
+	});
 }
 
 void netlist_mame_logic_input_device::device_timer(emu_timer &timer, device_timer_id id, int param, void *ptr)
 {
-	update_to_current_time();
+	apply_input([this, param]()
+	{
 #if NETLIST_CREATE_CSV
-	nl_owner().log_add(m_param_name, param, false);
+		nl_owner().log_add(m_param_name, param, false);
 #endif
-	m_param->set(param);
+		m_param->set(param);
+	});
 }
 
 void netlist_mame_ram_pointer_device::device_timer(emu_timer &timer, device_timer_id id, int param, void *ptr)
@@ -432,6 +447,7 @@ netlist_mame_analog_input_device::netlist_mame_analog_input_device(const machine
 	, m_auto_port(true)
 	, m_param_name(param_name)
 	, m_value_for_device_timer(0)
+	, m_requested(0)
 {
 }
 
@@ -442,6 +458,7 @@ netlist_mame_analog_input_device::netlist_mame_analog_input_device(const machine
 	, m_auto_port(true)
 	, m_param_name("")
 	, m_value_for_device_timer(0)
+	, m_requested(0)
 {
 }
 
@@ -460,6 +477,8 @@ void netlist_mame_analog_input_device::device_start()
 		// disable automatic scaling for ioports
 		m_auto_port = false;
 	}
+	m_requested = (*m_param)();
+	save_item(NAME(m_requested));
 }
 
 void netlist_mame_analog_input_device::validity_helper(validity_checker &valid,
@@ -587,6 +606,7 @@ netlist_mame_int_input_device::netlist_mame_int_input_device(const machine_confi
 	, m_mask(0xffffffff)
 	, m_shift(0)
 	, m_param_name("")
+	, m_requested(0)
 {
 }
 
@@ -607,6 +627,8 @@ void netlist_mame_int_input_device::device_start()
 	{
 		fatalerror("device %s wrong parameter type for %s\n", basetag(), m_param_name);
 	}
+	m_requested = (*m_param)();
+	save_item(NAME(m_requested));
 }
 
 void netlist_mame_int_input_device::validity_helper(validity_checker &valid,
@@ -630,6 +652,7 @@ netlist_mame_logic_input_device::netlist_mame_logic_input_device(const machine_c
 	, m_param(nullptr)
 	, m_shift(0)
 	, m_param_name("")
+	, m_requested(0)
 {
 }
 
@@ -649,6 +672,8 @@ void netlist_mame_logic_input_device::device_start()
 	{
 		fatalerror("device %s wrong parameter type for %s\n", basetag(), m_param_name);
 	}
+	m_requested = (*m_param)();
+	save_item(NAME(m_requested));
 }
 
 void netlist_mame_logic_input_device::validity_helper(validity_checker &valid,
@@ -892,6 +917,8 @@ netlist_mame_device::netlist_mame_device(const machine_config &mconfig, device_t
 netlist_mame_device::~netlist_mame_device()
 {
 	LOGDEVCALLS("~netlist_mame_device\n");
+	if (m_static_solver_build.joinable())
+		m_static_solver_build.join();
 }
 
 void netlist_mame_device::device_config_complete()
@@ -1048,6 +1075,7 @@ void netlist_mame_device::device_start_common()
 	common_dev_start(m_netlist.get());
 	m_netlist->setup().prepare_to_run();
 
+	load_static_solver_cache();
 
 	m_device_reset_called = false;
 
@@ -1065,6 +1093,85 @@ void netlist_mame_device::device_start_common()
 }
 
 
+// ----------------------------------------------------------------------------------------
+// static solver cache
+//
+// Solvers which have no static solver compiled into MAME get one built
+// on first run if NL_STATIC_SOLVER_CACHE names a directory. The code for
+// all missing solvers is compiled into one library in the background
+// and loaded on subsequent runs. Symbol names encode the solver matrix,
+// so their hash keys the library and a changed netlist gets a new one.
+// NL_STATIC_SOLVER_CXX overrides the compiler command.
+// ----------------------------------------------------------------------------------------
+
+void netlist_mame_device::load_static_solver_cache()
+{
+#if !NL_DISABLE_DYNAMIC_LOAD
+	const pstring dir(plib::util::environment("NL_STATIC_SOLVER_CACHE", ""));
+	if (dir.empty() || netlist().exec().solver() == nullptr)
+		return;
+
+	auto code(netlist().exec().solver()->create_solver_code(netlist::solver::CXX_EXTERNAL_C, true));
+	if (code.empty())
+		return;
+
+	putf8string names;
+	for (auto &e : code)
+		names += putf8string(e.first) + ";";
+	const pstring base(plib::util::buildpath({dir, plib::pfmt("nl_static_{1:x}")(plib::hash(names.c_str(), names.size()))}));
+#ifdef _WIN32
+	const pstring libname(base + ".dll");
+	const pstring cxx(plib::util::environment("NL_STATIC_SOLVER_CXX", "g++ -O2 -shared"));
+#else
+	const pstring libname(base + ".so");
+	const pstring cxx(plib::util::environment("NL_STATIC_SOLVER_CXX", "c++ -O2 -shared -fPIC"));
+#endif
+
+	if (plib::util::exists(libname))
+	{
+		auto lib(std::make_unique<plib::dynlib>(libname));
+		if (lib->isLoaded())
+		{
+			netlist().log().info("Loading static solvers from {1}", libname);
+			netlist().exec().solver()->load_static_solvers(*lib);
+			// the library must live as long as the solvers using it
+			netlist().set_static_solver_lib(std::move(lib));
+			return;
+		}
+		netlist().log().warning("Unable to load static solvers from {1}", libname);
+		return;
+	}
+
+	const pstring source(base + ".cpp");
+	{
+		plib::ofstream sout(source);
+		if (sout.fail())
+		{
+			netlist().log().warning("Unable to write static solver source {1}", source);
+			return;
+		}
+		sout << "// static solvers generated by MAME for " << machine().system().name << tag() << "\n\n";
+		sout << "namespace plib { template <typename... Ts> inline void unused_var(Ts&&...) noexcept { } }\n\n";
+		for (auto &e : code)
+			sout << putf8string(e.second);
+	}
+
+	// compile to a temporary name so a partial library is never loaded
+	const putf8string tmpname(putf8string(base) + plib::pfmt(".{1}.tmp")(osd_getpid()));
+	const putf8string cmd(plib::pfmt("{1} -o \"{2}\" \"{3}\"")(cxx, pstring(tmpname), source));
+	const putf8string target(libname);
+	netlist().log().info("Building static solvers {1}", libname);
+	m_static_solver_build = std::thread([cmd, tmpname, target]()
+	{
+		if (std::system(cmd.c_str()) == 0)
+			std::rename(tmpname.c_str(), target.c_str());
+		else
+			std::remove(tmpname.c_str());
+	});
+#endif
+}
+
+
 void netlist_mame_device::device_start()
 {
 	LOGDEVCALLS("device_start entry\n");
@@ -1325,6 +1432,7 @@ netlist_mame_sound_device::netlist_mame_sound_device(const machine_config &mconf
 	, m_sound_clock(clock)
 	, m_attotime_per_clock(attotime::zero)
 	, m_last_update_to_current_time(attotime::zero)
+	, m_block_inputs(false)
 {
 }
 
@@ -1400,6 +1508,14 @@ void netlist_mame_sound_device::device_start()
 	}
 	m_inbuffer.resize(m_in.size());
 
+	// Inputs can only wait for the next stream block if nothing reads the
+	// netlist back: output devices feed the driver and need it to be current.
+
+	m_block_inputs = true;
+	for (device_t &d : subdevices())
+		if (dynamic_cast<netlist_mame_analog_output_device *>(&d) || dynamic_cast<netlist_mame_logic_output_device *>(&d))
+			m_block_inputs = false;
+
 	/* initialize the stream(s) */
 	m_stream = stream_alloc(m_in.size(), m_out.size(), m_sound_clock, STREAM_DISABLE_INPUT_RESAMPLING);
 
@@ -1444,6 +1560,44 @@ void netlist_mame_sound_device::update_to_current_time()
 		LOGTIMING("%s : %f us before machine time\n", this->name(), (cur - mtime).as_double() * 1000000.0);
 }
 
+void netlist_mame_sound_device::queue_input(std::function<void()> &&apply)
+{
+	m_queued_inputs.push_back(queued_input{ nltime_from_attotime(machine().time()), std::move(apply) });
+}
+
+void netlist_mame_sound_device::process_until(netlist::netlist_time_ext target)
+{
+	// apply queued input changes at the time they were made on the way
+	auto it = m_queued_inputs.begin();
+	for ( ; it != m_queued_inputs.end() && it->time <= target; ++it)
+	{
+		const auto cur(netlist().exec().time());
+		if (it->time > cur)
+			netlist().exec().process_queue(it->time - cur);
+		it->apply();
+	}
+	m_queued_inputs.erase(m_queued_inputs.begin(), it);
+
+	const auto cur(netlist().exec().time());
+	if (cur < target)
+		netlist().exec().process_queue(target - cur);
+}
+
+void netlist_mame_sound_device::flush_queued_inputs()
+{
+	if (m_queued_inputs.empty())
+		return;
+	get_stream()->update();
+	process_until(nltime_from_attotime(machine().time()));
+}
+
+void netlist_mame_sound_device::device_pre_save()
+{
+	// queued input changes aren't part of the saved state
+	flush_queued_inputs();
+	netlist_mame_device::device_pre_save();
+}
+
 void netlist_mame_sound_device::sound_stream_update(sound_stream &stream, std::vector<read_stream_view> const &inputs, std::vector<write_stream_view> &outputs)
 {
 	for (auto &e : m_in)
@@ -1462,11 +1616,7 @@ void netlist_mame_sound_device::sound_stream_update(sound_stream &stream, std::v
 	// so subtract one sample period so that we only process up to the minimum
 	auto nl_target_time = nltime_from_attotime(outputs[0].end_time() - outputs[0].sample_period());
 
-	auto nltime(netlist().exec().time());
-	if (nltime < nl_target_time)
-	{
-		netlist().exec().process_queue(nl_target_time - nltime);
-	}
+	process_until(nl_target_time);
 
 	for (auto &e : m_out)
 	{
@@ -13,6 +13,7 @@
 
 #include <functional>
 #include <deque>
+#include <thread>
 
 #include "../../lib/netlist/nltypes.h"
 
@@ -107,8 +108,10 @@ protected:
 private:
 
 	void common_dev_start(netlist::netlist_state_t *lnetlist) const;
+	void load_static_solver_cache();
 
 	std::unique_ptr<netlist_mame_t> m_netlist;
+	std::thread m_static_solver_build;
 
 	func_type m_setup_func;
 	bool m_device_reset_called;
@@ -272,6 +275,10 @@ public:
 	inline sound_stream *get_stream() { return m_stream; }
 	void update_to_current_time();
 
+	// input changes are queued and applied while the stream block is computed
+	bool block_inputs() const { return m_block_inputs; }
+	void queue_input(std::function<void()> &&apply);
+
 	void register_stream_output(int channel, netlist_mame_stream_output_device *so);
 
 protected:
@@ -281,12 +288,22 @@ protected:
 
 	// device_t overrides
 	virtual void device_start() override;
+	virtual void device_pre_save() override;
 	// device_sound_interface overrides
 	virtual void sound_stream_update(sound_stream &stream, std::vector<read_stream_view> const &inputs, std::vector<write_stream_view> &outputs) override;
 	virtual void device_validity_check(validity_checker &valid) const override;
 	//virtual void device_reset() override;
 
 private:
+	struct queued_input
+	{
+		netlist::netlist_time_ext time;
+		std::function<void()> apply;
+	};
+
+	void process_until(netlist::netlist_time_ext target);
+	void flush_queued_inputs();
+
 	std::map<int, netlist_mame_stream_output_device *> m_out;
 	std::map<std::size_t, nld_sound_in *> m_in;
 	std::vector<netlist_mame_sound_input_buffer> m_inbuffer;
@@ -295,6 +312,8 @@ private:
 	uint32_t m_sound_clock;
 	attotime m_attotime_per_clock;
 	attotime m_last_update_to_current_time;
+	bool m_block_inputs;
+	std::vector<queued_input> m_queued_inputs;
 };
 
 // ----------------------------------------------------------------------------------------
@@ -332,6 +351,19 @@ public:
 		}
 	}
 
+	// apply an input change now, or queue it for the next stream block
+	template <typename F>
+	void apply_input(F &&f)
+	{
+		if (m_sound != nullptr && m_sound->block_inputs())
+			m_sound->queue_input(std::forward<F>(f));
+		else
+		{
+			update_to_current_time();
+			f();
+		}
+	}
+
 	void set_mult_offset(const double mult, const double offset);
 
 	netlist_mame_sound_device *sound() { return m_sound;}
@@ -389,6 +421,7 @@ private:
 	bool   m_auto_port;
 	const char *m_param_name;
 	double m_value_for_device_timer;
+	double m_requested;
 };
 
 // ----------------------------------------------------------------------------------------
@@ -489,6 +522,7 @@ private:
 	uint32_t m_mask;
 	uint32_t m_shift;
 	const char *m_param_name;
+	uint32_t m_requested;
 };
 
 
@@ -529,6 +563,7 @@ private:
 	netlist::param_num_t<bool> *m_param;
 	uint32_t m_shift;
 	const char *m_param_name;
+	uint32_t m_requested;
 };
 
 // ----------------------------------------------------------------------------------------
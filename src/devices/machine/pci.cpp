@@ -881,6 +881,10 @@ void pci_host_device::device_reset()
 void pci_host_device::regenerate_mapping()
 {
 	logerror("Regenerating mapping\n");
+
+	// rebuild both windows before telling anything the maps changed
+	address_space::remap_batch memory_batch(*memory_space);
+	address_space::remap_batch io_batch(*io_space);
 	memory_space->unmap_readwrite(memory_window_start, memory_window_end);
 	io_space->unmap_readwrite(io_window_start, io_window_end);
 
@@ -16,6 +16,7 @@ void t10sbc::t10_reset()
 {
 	t10spc::t10_reset();
 
+	m_prefetch.cancel();
 	m_lba = 0;
 	m_blocks = 0;
 	m_sector_bytes = 512;
@@ -58,6 +59,7 @@ void t10sbc::ExecCommand()
 		m_blocks = SCSILengthFromUINT8( &command[4] );
 
 		m_device->logerror("T10SBC: READ at LBA %x for %x blocks\n", m_lba, m_blocks);
+		m_prefetch.start(m_disk, m_lba, m_blocks);
 
 		m_phase = SCSI_PHASE_DATAIN;
 		m_status_code = SCSI_STATUS_CODE_GOOD;
@@ -105,6 +107,7 @@ void t10sbc::ExecCommand()
 		m_blocks = SCSILengthFromUINT16( &command[7] );
 
 		m_device->logerror("T10SBC: READ at LBA %x for %x blocks\n", m_lba, m_blocks);
+		m_prefetch.start(m_disk, m_lba, m_blocks);
 
 		m_phase = SCSI_PHASE_DATAIN;
 		m_status_code = SCSI_STATUS_CODE_GOOD;
@@ -127,6 +130,7 @@ void t10sbc::ExecCommand()
 		m_blocks = command[6]<<24 | command[7]<<16 | command[8]<<8 | command[9];
 
 		m_device->logerror("T10SBC: READ at LBA %x for %x blocks\n", m_lba, m_blocks);
+		m_prefetch.start(m_disk, m_lba, m_blocks);
 
 		m_phase = SCSI_PHASE_DATAIN;
 		m_status_code = SCSI_STATUS_CODE_GOOD;
@@ -278,7 +282,7 @@ void t10sbc::ReadData( uint8_t *data, int dataLength )
 			m_device->logerror("T10SBC: Reading %d bytes from HD\n", dataLength);
 			while (dataLength > 0)
 			{
-				if (!hard_disk_read(m_disk, m_lba,  data))
+				if (!m_prefetch.read(m_disk, m_lba, data))
 				{
 					m_device->logerror("T10SBC: HD read error!\n");
 				}
@@ -303,6 +307,8 @@ void t10sbc::ReadData( uint8_t *data, int dataLength )
 
 void t10sbc::WriteData( uint8_t *data, int dataLength )
 {
+	m_prefetch.cancel();
+
 	if (!m_disk)
 	{
 		return;
@@ -96,6 +96,7 @@ protected:
 
 	hard_disk_file *m_disk;
 	device_t *m_device;
+	hard_disk_prefetch m_prefetch;
 };
 
 #endif // MAME_MACHINE_T10SBC_H
@@ -682,6 +682,7 @@ void upd765_family_device::live_start(floppy_info &fi, int state)
 	cur_live.previous_type = live_info::PT_NONE;
 	cur_live.data_bit_context = false;
 	cur_live.byte_counter = 0;
+	cur_live.next_skip = cur_live.tm;
 	cur_live.pll.reset(cur_live.tm);
 	cur_live.pll.set_clock(attotime::from_hz(mfm ? 2*cur_rate : cur_rate));
 	checkpoint_live = cur_live;
@@ -777,6 +778,20 @@ void upd765_family_device::live_run(attotime limit)
 	for(;;) {
 		switch(cur_live.state) {
 		case SEARCH_ADDRESS_MARK_HEADER:
+			if(cur_live.tm >= cur_live.next_skip && cur_live.fi->dev) {
+				// Look for the mark in the track data rather than bit by
+				// bit, then let the pll read up to it.  Don't try again
+				// until the pll has had a chance to find it.
+				attotime when = cur_live.fi->dev->find_next_mark(cur_live.tm, limit, cur_live.pll.period, mfm ? 0x4489 : 0xf57e);
+				if(when != cur_live.tm) {
+					LOGLIVE("%s: Skipping to %s\n", tts(cur_live.tm), tts(when));
+					cur_live.tm = when;
+					cur_live.shift_reg = 0;
+					cur_live.pll.read_reset(when);
+				}
+				cur_live.next_skip = when + cur_live.pll.period*256;
+			}
+
 			if(read_one_bit(limit))
 				return;
 
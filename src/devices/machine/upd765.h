@@ -226,6 +226,7 @@ protected:
 		bool data_separator_phase, data_bit_context;
 		uint8_t data_reg;
 		uint8_t idbuf[6];
+		attotime next_skip;
 		fdc_pll_t pll;
 	};
 
@@ -1494,6 +1494,7 @@ void wd_fdc_device_base::live_start(int state)
 	cur_live.previous_type = live_info::PT_NONE;
 	cur_live.data_bit_context = false;
 	cur_live.byte_counter = 0;
+	cur_live.next_skip = cur_live.tm;
 
 	if (!enmf_cb.isnull() && has_enmf)
 		enmf = enmf_cb() ? false : true;
@@ -1661,6 +1662,19 @@ void wd_fdc_device_base::live_run(attotime limit)
 		switch(cur_live.state) {
 		case SEARCH_ADDRESS_MARK_HEADER:
 			LOGLIVE("%s - SEARCH_ADDRESS_MARK_HEADER\n", FUNCNAME);
+			if(cur_live.tm >= cur_live.next_skip && floppy) {
+				// Look for the mark in the track data rather than bit by
+				// bit, then let the pll read up to it.  Don't try again
+				// until the pll has had a chance to find it.
+				attotime when = floppy->find_next_mark(cur_live.tm, limit, pll_cell_time(), dden ? 0xf57e : 0x4489);
+				if(when != cur_live.tm) {
+					cur_live.tm = when;
+					cur_live.shift_reg = 0;
+					pll_reset(dden, enmf, when);
+				}
+				cur_live.next_skip = when + pll_cell_time()*256;
+			}
+
 			if(read_one_bit(limit))
 				return;
 
@@ -2323,6 +2337,11 @@ void wd_fdc_analog_device_base::pll_reset(bool fm, bool enmf, const attotime &wh
 	cur_pll.set_clock(clocks_to_attotime(clocks));
 }
 
+attotime wd_fdc_analog_device_base::pll_cell_time() const
+{
+	return cur_pll.period;
+}
+
 void wd_fdc_analog_device_base::pll_start_writing(const attotime &tm)
 {
 	cur_pll.start_writing(tm);
@@ -2377,6 +2396,12 @@ void wd_fdc_digital_device_base::pll_reset(bool fm, bool enmf, const attotime &w
 	cur_pll.set_clock(clocks_to_attotime(clocks));
 }
 
+attotime wd_fdc_digital_device_base::pll_cell_time() const
+{
+	// the counter takes 16 slots per cell at the nominal increment
+	return cur_pll.delays[15];
+}
+
 void wd_fdc_digital_device_base::pll_start_writing(const attotime &tm)
 {
 	cur_pll.start_writing(tm);
@@ -124,6 +124,7 @@ protected:
 	virtual int settle_time() const;
 
 	virtual void pll_reset(bool fm, bool enmf, const attotime &when) = 0;
+	virtual attotime pll_cell_time() const = 0;
 	virtual void pll_start_writing(const attotime &tm) = 0;
 	virtual void pll_commit(floppy_image_device *floppy, const attotime &tm) = 0;
 	virtual void pll_stop_writing(floppy_image_device *floppy, const attotime &tm) = 0;
@@ -253,6 +254,7 @@ private:
 		bool data_separator_phase, data_bit_context;
 		uint8_t data_reg;
 		uint8_t idbuf[6];
+		attotime next_skip;
 	};
 
 	enum {
@@ -370,6 +372,7 @@ protected:
 	wd_fdc_analog_device_base(const machine_config &mconfig, device_type type, const char *tag, device_t *owner, uint32_t clock);
 
 	virtual void pll_reset(bool fm, bool enmf, const attotime &when) override;
+	virtual attotime pll_cell_time() const override;
 	virtual void pll_start_writing(const attotime &tm) override;
 	virtual void pll_commit(floppy_image_device *floppy, const attotime &tm) override;
 	virtual void pll_stop_writing(floppy_image_device *floppy, const attotime &tm) override;
@@ -389,6 +392,7 @@ protected:
 	static constexpr int wd_digital_step_times[4] = { 12000, 24000, 40000, 60000 };
 
 	virtual void pll_reset(bool fm, bool enmf, const attotime &when) override;
+	virtual attotime pll_cell_time() const override;
 	virtual void pll_start_writing(const attotime &tm) override;
 	virtual void pll_commit(floppy_image_device *floppy, const attotime &tm) override;
 	virtual void pll_stop_writing(floppy_image_device *floppy, const attotime &tm) override;
@@ -917,6 +917,7 @@ void aica_device::w16(u32 addr,u16 val)
 		else if (addr < 0x3c00)
 		{
 			*((u16 *)(m_DSP.MPRO+(addr - 0x3400) / 2)) = val;
+			m_DSP.invalidate();
 
 			if (addr == 0x3bfe)
 			{
@@ -1488,6 +1489,8 @@ void aica_device::device_start()
 
 void aica_device::device_post_load()
 {
+	m_DSP.invalidate();
+
 	for (int slot = 0; slot < 64; slot++)
 		Compute_LFO(&m_Slots[slot]);
 }
@@ -69,244 +69,151 @@ void AICADSP::step()
 	if (Stopped)
 		return;
 
+	if (!Translated)
+		translate();
+
 	std::fill(std::begin(EFREG), std::end(EFREG), 0);
-#if 0
-	int dump=0;
-	FILE *f=nullptr;
-	if (dump)
-		f=fopen("dsp.txt","wt");
-#endif
+
+	//operations are done at 24 bit precision
 	for (int step = 0; step < /*128*/LastStep; ++step)
 	{
-		u16 *IPtr=MPRO+step*8;
-
-//      if (IPtr[0]==0 && IPtr[1]==0 && IPtr[2]==0 && IPtr[3]==0)
-//          break;
-
-		const u32 TRA   = (IPtr[0] >>  9) & 0x7F;
-		const u32 TWT   = (IPtr[0] >>  8) & 0x01;
-		const u32 TWA   = (IPtr[0] >>  1) & 0x7F;
-
-		const u32 XSEL  = (IPtr[2] >> 15) & 0x01;
-		const u32 YSEL  = (IPtr[2] >> 13) & 0x03;
-		const u32 IRA   = (IPtr[2] >>  7) & 0x3F;
-		const u32 IWT   = (IPtr[2] >>  6) & 0x01;
-		const u32 IWA   = (IPtr[2] >>  1) & 0x1F;
-
-		const u32 TABLE = (IPtr[4] >> 15) & 0x01;
-		const u32 MWT   = (IPtr[4] >> 14) & 0x01;
-		const u32 MRD   = (IPtr[4] >> 13) & 0x01;
-		const u32 EWT   = (IPtr[4] >> 12) & 0x01;
-		const u32 EWA   = (IPtr[4] >>  8) & 0x0F;
-		const u32 ADRL  = (IPtr[4] >>  7) & 0x01;
-		const u32 FRCL  = (IPtr[4] >>  6) & 0x01;
-		const u32 SHIFT = (IPtr[4] >>  4) & 0x03;
-		const u32 YRL   = (IPtr[4] >>  3) & 0x01;
-		const u32 NEGB  = (IPtr[4] >>  2) & 0x01;
-		const u32 ZERO  = (IPtr[4] >>  1) & 0x01;
-		const u32 BSEL  = (IPtr[4] >>  0) & 0x01;
-
-		const u32 NOFL  = (IPtr[6] >> 15) & 1;        //????
-		const u32 COEF  = step;
-
-		const u32 MASA  = (IPtr[6] >>  9) & 0x1f;  //???
-		const u32 ADREB = (IPtr[6] >>  8) & 0x1;
-		const u32 NXADR = (IPtr[6] >>  7) & 0x1;
-
-		//operations are done at 24 bit precision
-#if 0
-		if (MASA)
-			int a=1;
-		if (NOFL)
-			int a=1;
-
-//      int dump=0;
-
-		if (f)
+		const Op &op = Program[step];
+		const u32 flags = op.Flags;
+
+		//INPUTS RW
+		s32 INPUTS; //24 bit
+		switch (op.ISRC)
 		{
-#define DUMP(v) fprintf(f," " #v ": %04X",v);
-
-			fprintf(f,"%d: ",step);
-			DUMP(ACC);
-			DUMP(SHIFTED);
-			DUMP(X);
-			DUMP(Y);
-			DUMP(B);
-			DUMP(INPUTS);
-			DUMP(MEMVAL);
-			DUMP(FRC_REG);
-			DUMP(Y_REG);
-			DUMP(ADDR);
-			DUMP(ADRS_REG);
-			fprintf(f,"\n");
+		case INPUT_MEMS: INPUTS = MEMS[op.IRA];       break;
+		case INPUT_MIXS: INPUTS = MIXS[op.IRA] << 4;  break;  //MIXS is 20 bit
+		case INPUT_EXTS: INPUTS = EXTS[op.IRA] << 8;  break;  //EXTS is 16 bit
+		default:         INPUTS = 0;                  break;
 		}
-#endif
-		//INPUTS RW
-		assert(IRA<0x32);
-		s32 INPUTS=0; //24 bit
-		if (IRA <= 0x1f)
-			INPUTS = MEMS[IRA];
-		else if (IRA <= 0x2F)
-			INPUTS = MIXS[IRA - 0x20] << 4;  //MIXS is 20 bit
-		else if (IRA <= 0x31)
-			INPUTS = EXTS[IRA - 0x30] << 8;  //EXTS is 16 bit
-
 		INPUTS <<= 8;
 		INPUTS >>= 8;
-		//if (INPUTS & 0x00800000)
-		//  INPUTS |= 0xFF000000;
 
-		if (IWT)
+		if (flags & OP_IWT)
 		{
-			MEMS[IWA] = MEMVAL;  //MEMVAL was selected in previous MRD
-			if (IRA == IWA)
+			MEMS[op.IWA] = MEMVAL;  //MEMVAL was selected in previous MRD
+			if (flags & OP_IWT_FWD)
 				INPUTS = MEMVAL;
 		}
 
 		//Operand sel
+		s32 T = TEMP[(op.TRA + DEC) & 0x7F];
+		T <<= 8;
+		T >>= 8;
+
 		//B
 		s32 B;  //26 bit
-		if (!ZERO)
+		if (flags & OP_B_ZERO)
+			B = 0;
+		else
 		{
-			if (BSEL)
-				B = ACC;
-			else
-			{
-				B = TEMP[(TRA + DEC) & 0x7F];
-				B <<= 8;
-				B >>= 8;
-				//if (B & 0x00800000)
-				//  B |= 0xFF000000;  //Sign extend
-			}
-			if (NEGB)
+			B = (flags & OP_B_ACC) ? ACC : T;
+			if (flags & OP_NEGB)
 				B = 0 - B;
 		}
-		else
-			B = 0;
 
 		//X
-		s32 X;  //24 bit
-		if (XSEL)
-			X = INPUTS;
-		else
+		const s32 X = (flags & OP_XSEL) ? INPUTS : T;  //24 bit
+
+		//Y
+		s32 Y;  //13 bit
+		switch (op.YSEL)
 		{
-			X = TEMP[(TRA + DEC) & 0x7F];
-			X <<= 8;
-			X >>= 8;
-			//if (X & 0x00800000)
-			//  X |= 0xFF000000;
+		case 0:  Y = FRC_REG;                    break;
+		case 1:  Y = this->COEF[op.COEF] >> 3;   break;  //COEF is 16 bits
+		case 2:  Y = (Y_REG >> 11) & 0x1FFF;     break;
+		default: Y = (Y_REG >> 4) & 0x0FFF;      break;
 		}
 
-		//Y
-		s32 Y = 0;  //13 bit
-		if (YSEL == 0)
-			Y = FRC_REG;
-		else if (YSEL == 1)
-			Y = this->COEF[COEF << 1] >> 3;    //COEF is 16 bits
-		else if (YSEL == 2)
-			Y = (Y_REG >> 11) & 0x1FFF;
-		else if (YSEL == 3)
-			Y = (Y_REG >> 4) & 0x0FFF;
-
-		if (YRL)
+		if (flags & OP_YRL)
 			Y_REG = INPUTS;
 
 		//Shifter
-		s32 SHIFTED = 0;    //24 bit
-		if (SHIFT == 0)
+		s32 SHIFTED;    //24 bit
+		switch (op.SHIFT)
+		{
+		case 0:
 			SHIFTED = std::max<s32>(std::min<s32>(ACC, 0x007FFFFF), -0x00800000);
-		else if (SHIFT == 1)
+			break;
+		case 1:
 			SHIFTED = std::max<s32>(std::min<s32>(ACC * 2, 0x007FFFFF), -0x00800000);
-		else if (SHIFT == 2)
-		{
+			break;
+		case 2:
 			SHIFTED = ACC * 2;
 			SHIFTED <<= 8;
 			SHIFTED >>= 8;
-			//SHIFTED &= 0x00FFFFFF;
-			//if (SHIFTED & 0x00800000)
-			//  SHIFTED |= 0xFF000000;
-		}
-		else if (SHIFT == 3)
-		{
+			break;
+		default:
 			SHIFTED = ACC;
 			SHIFTED <<= 8;
 			SHIFTED >>= 8;
-			//SHIFTED &= 0x00FFFFFF;
-			//if (SHIFTED & 0x00800000)
-			//  SHIFTED |= 0xFF000000;
+			break;
 		}
 
 		//ACCUM
 		Y <<= 19;
 		Y >>= 19;
-		//if (Y & 0x1000)
-		//  Y |= 0xFFFFF000;
 
 		const s64 v = (((s64)X * (s64)Y) >> 12);
 		ACC = (int)v + B;
 
-		if (TWT)
-			TEMP[(TWA + DEC) & 0x7F] = SHIFTED;
+		if (flags & OP_TWT)
+			TEMP[(op.TWA + DEC) & 0x7F] = SHIFTED;
 
-		if (FRCL)
+		if (flags & OP_FRCL)
 		{
-			if (SHIFT == 3)
+			if (op.SHIFT == 3)
 				FRC_REG = SHIFTED & 0x0FFF;
 			else
 				FRC_REG = (SHIFTED >> 11) & 0x1FFF;
 		}
 
-		u32 ADDR;
-		if (MRD || MWT)
-		//if (0)
+		if (flags & (OP_MRD | OP_MWT))
 		{
-			ADDR = MADRS[MASA << 1];
-			if (!TABLE)
+			u32 ADDR = MADRS[op.MASA];
+			if (!(flags & OP_TABLE))
 				ADDR += DEC;
-			if (ADREB)
+			if (flags & OP_ADREB)
 				ADDR += ADRS_REG & 0x0FFF;
-			if (NXADR)
+			if (flags & OP_NXADR)
 				ADDR++;
-			if (!TABLE)
+			if (!(flags & OP_TABLE))
 				ADDR &= RBL - 1;
 			else
 				ADDR &= 0xFFFF;
-			//ADDR <<= 1;
-			//ADDR += RBP << 13;
-			//MEMVAL = space.read_word(ADDR >> 1);
 			ADDR += RBP << 10;
-			if (MRD && (step & 1)) //memory only allowed on odd? DoA inserts NOPs on even
+			if (flags & OP_MRD)
 			{
-				if (NOFL)
+				if (flags & OP_NOFL)
 					MEMVAL = cache.read_word(ADDR) << 8;
 				else
 					MEMVAL = UNPACK(cache.read_word(ADDR));
 			}
-			if (MWT && (step&1))
+			if (flags & OP_MWT)
 			{
-				if (NOFL)
+				if (flags & OP_NOFL)
 					space.write_word(ADDR, SHIFTED>>8);
 				else
 					space.write_word(ADDR, PACK(SHIFTED));
 			}
 		}
 
-		if (ADRL)
+		if (flags & OP_ADRL)
 		{
-			if (SHIFT == 3)
+			if (op.SHIFT == 3)
 				ADRS_REG = (SHIFTED >> 12) & 0xFFF;
 			else
 				ADRS_REG = (INPUTS >> 16);
 		}
 
-		if (EWT)
-			EFREG[EWA] += SHIFTED >> 8;
-
+		if (flags & OP_EWT)
+			EFREG[op.EWA] += SHIFTED >> 8;
 	}
 	--DEC;
 	std::fill(std::begin(MIXS), std::end(MIXS), 0);
-//  if (f)
-//      fclose(f);
 }
 
 void AICADSP::setsample(s32 sample, u8 SEL, s32 MXL)
@@ -329,4 +236,71 @@ void AICADSP::start()
 			break;
 	}
 	LastStep = i + 1;
+	Translated = false;
+}
+
+// decode each step's fields once so step() only has to act on them; memory
+// access on even steps, which never happens, is dropped here too
+void AICADSP::translate()
+{
+	for (int step = 0; step < LastStep; ++step)
+	{
+		const u16 *IPtr = MPRO + step * 8;
+		Op &op = Program[step];
+
+		const u32 IRA = (IPtr[2] >>  7) & 0x3F;
+		assert(IRA<0x32);
+		if (IRA <= 0x1f)
+		{
+			op.ISRC = INPUT_MEMS;
+			op.IRA = IRA;
+		}
+		else if (IRA <= 0x2F)
+		{
+			op.ISRC = INPUT_MIXS;
+			op.IRA = IRA - 0x20;
+		}
+		else if (IRA <= 0x31)
+		{
+			op.ISRC = INPUT_EXTS;
+			op.IRA = IRA - 0x30;
+		}
+		else
+		{
+			op.ISRC = INPUT_NONE;
+			op.IRA = 0;
+		}
+
+		op.TRA   = (IPtr[0] >>  9) & 0x7F;
+		op.TWA   = (IPtr[0] >>  1) & 0x7F;
+		op.YSEL  = (IPtr[2] >> 13) & 0x03;
+		op.IWA   = (IPtr[2] >>  1) & 0x1F;
+		op.EWA   = (IPtr[4] >>  8) & 0x0F;
+		op.SHIFT = (IPtr[4] >>  4) & 0x03;
+		op.COEF  = step << 1;
+		op.MASA  = ((IPtr[6] >>  9) & 0x1f) << 1;
+
+		u32 flags = 0;
+		if (BIT(IPtr[0], 8))  flags |= OP_TWT;
+		if (BIT(IPtr[2], 15)) flags |= OP_XSEL;
+		if (BIT(IPtr[2], 6))  flags |= OP_IWT | ((IRA == op.IWA) ? OP_IWT_FWD : 0);
+		if (BIT(IPtr[4], 1))  flags |= OP_B_ZERO;
+		if (BIT(IPtr[4], 0))  flags |= OP_B_ACC;
+		if (BIT(IPtr[4], 2))  flags |= OP_NEGB;
+		if (BIT(IPtr[4], 3))  flags |= OP_YRL;
+		if (BIT(IPtr[4], 6))  flags |= OP_FRCL;
+		if (BIT(IPtr[4], 7))  flags |= OP_ADRL;
+		if (BIT(IPtr[4], 12)) flags |= OP_EWT;
+		if (step & 1) //memory only allowed on odd? DoA inserts NOPs on even
+		{
+			if (BIT(IPtr[4], 13)) flags |= OP_MRD;
+			if (BIT(IPtr[4], 14)) flags |= OP_MWT;
+		}
+		if (BIT(IPtr[4], 15)) flags |= OP_TABLE;
+		if (BIT(IPtr[6], 8))  flags |= OP_ADREB;
+		if (BIT(IPtr[6], 7))  flags |= OP_NXADR;
+		if (BIT(IPtr[6], 15)) flags |= OP_NOFL;
+		op.Flags = flags;
+	}
+	Translated = true;
 }
@@ -125,7 +125,7 @@ void c140_device::device_start()
 	m_int1_callback.resolve_safe();
 	m_int1_timer = machine().scheduler().timer_alloc(timer_expired_delegate(FUNC(c140_device::int1_on), this));
 
-	m_stream = stream_alloc(0, 2, m_sample_rate);
+	m_stream = stream_alloc(0, 2, m_sample_rate, STREAM_PARALLEL_UPDATE);
 
 	// make decompress pcm table (Verified from Wii Virtual Console Arcade Starblade)
 	for (int i = 0; i < 256; i++)
@@ -42,6 +42,7 @@
 
 #include <atomic>
 #include <iostream>
+#include <thread>
 
 
 /* for_each collides with c++ standard libraries - include it here */
@@ -91,18 +92,21 @@ DEFINE_DEVICE_TYPE(DISCRETE, discrete_sound_device, "discrete", "Discrete Sound"
  *
  *************************************/
 
+class discrete_task;
+
 struct output_buffer
 {
 	double                      *node_buf;
 	const double                *source;
-	volatile double             *ptr;
+	double                      *ptr;               /* next sample to write; only the owning task touches it */
 	int                         node_num;
 };
 
 struct input_buffer
 {
-	volatile const double       *ptr;               /* pointer into linked_outbuf.nodebuf */
+	const double                *ptr;               /* pointer into linked_outbuf.nodebuf */
 	output_buffer *             linked_outbuf;      /* what output are we connected to ? */
+	const discrete_task *       linked_task;        /* task writing linked_outbuf */
 	double                      buffer;             /* input[] will point here */
 };
 
@@ -116,9 +120,12 @@ public:
 	inline bool lock_threadid(int32_t threadid)
 	{
 		int expected = -1;
-		return m_threadid.compare_exchange_weak(expected, threadid, std::memory_order_release,std::memory_order_relaxed);
+		return m_threadid.compare_exchange_weak(expected, threadid, std::memory_order_acquire, std::memory_order_relaxed);
 	}
-	inline void unlock(void) { m_threadid = -1; }
+	inline void unlock(void) { m_threadid.store(-1, std::memory_order_release); }
+
+	/* samples of this update whose outputs other tasks may read */
+	inline int published(void) const { return m_published.load(std::memory_order_acquire); }
 
 	//const linked_list_entry *list;
 	node_step_list_t        step_list;
@@ -130,7 +137,8 @@ public:
 
 
 	discrete_task(discrete_device &pdev)
-	: task_group(0), m_device(pdev), m_threadid(-1), m_samples(0)
+	: task_group(0), m_device(pdev), m_threadid(-1), m_samples(0), m_published(0),
+		m_run_time(0), m_slices(0), m_stalls(0)
 {
 		source_list.clear();
 		step_list.clear();
@@ -139,7 +147,7 @@ public:
 
 protected:
 	static void *task_callback(void *param, int threadid);
-	inline bool process(void);
+	inline int process(void);
 
 	void check(discrete_task *dest_task);
 	void prepare_for_queue(int samples);
@@ -148,9 +156,14 @@ protected:
 	discrete_device &                   m_device;
 
 private:
-	std::atomic<int32_t>      m_threadid;
-	volatile int            m_samples;
-
+	std::atomic<int32_t>    m_threadid;
+	int                     m_samples;          /* samples left this update; only touched with the task locked */
+	std::atomic<int>        m_published;        /* samples finished this update */
+
+	/* profiling */
+	osd_ticks_t             m_run_time;         /* ticks spent processing slices */
+	uint64_t                m_slices;           /* slices processed */
+	uint64_t                m_stalls;           /* times nothing could be done while waiting on inputs */
 };
 
 
@@ -221,57 +234,80 @@ void *discrete_task::task_callback(void *param, int threadid)
 	task_list_t *list = (task_list_t *) param;
 	do
 	{
+		bool progress = false;
 		for_each(discrete_task **, task, list)
 		{
 			/* try to lock */
 			if ((*task)->lock_threadid(threadid))
 			{
-				if (!(*task)->process())
+				if ((*task)->process() > 0)
+					progress = true;
+				if ((*task)->m_samples == 0)
+				{
+					/* return and keep the task locked so it is not picked up by other worker threads */
 					return nullptr;
+				}
 				(*task)->unlock();
 			}
 		}
+
+		/* everything we could lock is waiting on another thread, so let that thread have the core */
+		if (!progress)
+			std::this_thread::yield();
 	} while (1);
 
 	return nullptr;
 }
 
-bool discrete_task::process(void)
+int discrete_task::process(void)
 {
-	int samples = std::min(int(m_samples), MAX_SAMPLES_PER_TASK_SLICE);
+	int samples = std::min(m_samples, MAX_SAMPLES_PER_TASK_SLICE);
 
-	/* check dependencies */
+	/* check dependencies; producers publish whole slices, so this is one load per source */
 	for_each(input_buffer *, sn, &source_list)
 	{
 		int avail;
 
-		avail = sn->linked_outbuf->ptr - sn->ptr;
+		avail = sn->linked_outbuf->node_buf + sn->linked_task->published() - sn->ptr;
 		if (avail < 0)
 			throw emu_fatalerror("discrete_task::process: available samples are negative");
 		if (avail < samples)
 			samples = avail;
 	}
 
+	if (samples == 0)
+	{
+		if (UNEXPECTED(m_device.profiling()))
+			m_stalls++;
+		return 0;
+	}
+
+	osd_ticks_t const start = UNEXPECTED(m_device.profiling()) ? get_profile_ticks() : 0;
+
 	m_samples -= samples;
 	if (m_samples < 0)
 		throw emu_fatalerror("discrete_task::process: m_samples got negative");
-	while (samples > 0)
+	for (int i = 0; i < samples; i++)
 	{
 		/* step */
 		step_nodes();
-		samples--;
 	}
-	if (m_samples == 0)
+
+	/* make the whole slice visible to the tasks reading our outputs at once */
+	m_published.store(m_published.load(std::memory_order_relaxed) + samples, std::memory_order_release);
+
+	if (UNEXPECTED(m_device.profiling()))
 	{
-		/* return and keep the task locked so it is not picked up by other worker threads */
-		return false;
+		m_run_time += get_profile_ticks() - start;
+		m_slices++;
 	}
-	return true;
+	return samples;
 }
 
 void discrete_task::prepare_for_queue(int samples)
 {
 	m_samples = samples;
+	m_published.store(0, std::memory_order_relaxed);
 	/* set up task buffers */
 	for_each(output_buffer *, ob, &m_buffers)
 		ob->ptr = ob->node_buf;
@@ -340,6 +376,7 @@ void discrete_task::check(discrete_task *dest_task)
 						//source.task = this;
 						//source.output_node = i;
 						source.linked_outbuf = pbuf;
+						source.linked_task = this;
 						source.buffer = 0.0; /* please compiler */
 						source.ptr = nullptr;
 						dest_task->source_list.add(source);
@@ -664,12 +701,16 @@ void discrete_device::display_profiling(void)
 				util::stream_format(std::cout, "%3d: %20s %8.2f %10.2f\n", (*node)->index(), (*node)->module_name(), double(step->run_time) / double(total) * 100.0, double(step->run_time) / double(m_total_samples));
 	}
 
-	/* Task information */
+	/* Task information: share of node time and node time per sample, then the task's own time per sample
+	 * including buffering, its average slice length, and how often it found its inputs not ready */
 	for_each(discrete_task **, task, &task_list)
 	{
 		tt =  step_list_run_time((*task)->step_list);
 
-		util::stream_format(std::cout, "Task(%d): %8.2f %15.2f\n", (*task)->task_group, tt / double(total) * 100.0, tt / double(m_total_samples));
+		util::stream_format(std::cout, "Task(%d): %8.2f %15.2f %15.2f %8.2f %10d\n", (*task)->task_group, tt / double(total) * 100.0, tt / double(m_total_samples),
+				double((*task)->m_run_time) / double(m_total_samples),
+				(*task)->m_slices ? double(m_total_samples) / double((*task)->m_slices) : 0.0,
+				(*task)->m_stalls);
 	}
 
 	util::stream_format(std::cout, "Average samples/double->update: %8.2f\n", double(m_total_samples) / double(m_total_stream_updates));
@@ -837,7 +878,6 @@ discrete_device::discrete_device(const machine_config &mconfig, device_type type
 		m_neg_sample_time(0),
 		m_indexed_node(nullptr),
 		m_disclogfile(nullptr),
-		m_queue(nullptr),
 		m_profiling(0),
 		m_total_samples(0),
 		m_total_stream_updates(0)
@@ -908,9 +948,6 @@ void discrete_device::device_start()
 		(*node)->resolve_input_nodes();
 	}
 
-	/* allocate a queue */
-	m_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
-
 	/* Process nodes which have a start func */
 	for_each(discrete_base_node **, node, &m_node_list)
 	{
@@ -930,11 +967,6 @@ void discrete_device::device_start()
 
 void discrete_device::device_stop()
 {
-	if (m_queue)
-	{
-		osd_work_queue_free(m_queue);
-	}
-
 	if (m_profiling)
 	{
 		display_profiling();
@@ -1045,12 +1077,21 @@ void discrete_device::process(int samples)
 		(*task)->prepare_for_queue(samples);
 	}
 
-	for_each(discrete_task **, task, &task_list)
+	if (task_list.count() == 1)
+	{
+		/* nothing to overlap with, so skip the hand-off to another thread */
+		discrete_task *task = task_list[0];
+		while (task->m_samples > 0)
+			task->process();
+	}
+	else
 	{
-		/* Fire a work item for each task */
-		osd_work_item_queue(m_queue, discrete_task::task_callback, (void *) &task_list, WORK_ITEM_FLAG_AUTO_RELEASE);
+		/* fire a work item for each task on the sound system's shared pool; we help out while waiting */
+		osd_work_queue *const queue = machine().sound().work_queue();
+		for_each(discrete_task **, task, &task_list)
+			osd_work_item_queue(queue, discrete_task::task_callback, (void *) &task_list, WORK_ITEM_FLAG_AUTO_RELEASE);
+		osd_work_queue_wait(queue, osd_ticks_per_second()*10);
 	}
-	osd_work_queue_wait(m_queue, osd_ticks_per_second()*10);
 
 	if (m_profiling)
 	{
@@ -4346,9 +4346,6 @@ private:
 	/* debugging statistics */
 	FILE *                  m_disclogfile;
 
-	/* parallel tasks */
-	osd_work_queue *        m_queue;
-
 	/* profiling */
 	int                     m_profiling;
 	uint64_t                  m_total_samples;
@@ -4499,7 +4496,7 @@ public:
 template <class C>
 discrete_base_node * discrete_node_factory<C>::Create(discrete_device * pdev, const discrete_block *block)
 {
-	discrete_base_node *r = auto_alloc_clear(pdev->machine(), <C>());
+	discrete_base_node *r = &pdev->machine().arena().make_clear<C>(machine_arena::category::DEVICE);
 
 	r->init(pdev, block);
 	return r;
@@ -1471,6 +1471,17 @@ static inline void refresh_fc_eg_slot(FM_OPN *OPN, FM_SLOT *SLOT , int fc , int
 	}
 }
 
+/* true if a channel can't be heard until its next key on: every operator
+   is off and nothing is left in the feedback or MEM delays.  Key on resets
+   the phase, so skipping such a channel for a whole update changes nothing,
+   and only register writes (which update the stream first) can wake it. */
+static inline bool chan_silent(const FM_CH *CH)
+{
+	return (CH->SLOT[SLOT1].state == EG_OFF) && (CH->SLOT[SLOT2].state == EG_OFF) &&
+			(CH->SLOT[SLOT3].state == EG_OFF) && (CH->SLOT[SLOT4].state == EG_OFF) &&
+			!CH->op1_out[0] && !CH->op1_out[1] && !CH->mem_value;
+}
+
 /* update phase increment counters */
 /* Changed from static inline to static to work around gcc 4.2.1 codegen bug */
 static void refresh_fc_eg_chan(FM_OPN *OPN, FM_CH *CH )
@@ -2146,6 +2157,11 @@ void ym2203_update_one(void *chip, FMSAMPLE *buffer, int length)
 	OPN->LFO_AM = 0;
 	OPN->LFO_PM = 0;
 
+	/* channels that stay silent for the whole update are left out */
+	bool active[3];
+	for (int c = 0; c < 3; c++)
+		active[c] = !chan_silent(cch[c]);
+
 	/* buffering */
 	for (i=0; i < length ; i++)
 	{
@@ -2167,9 +2183,9 @@ void ym2203_update_one(void *chip, FMSAMPLE *buffer, int length)
 		}
 
 		/* calculate FM */
-		chan_calc(OPN, cch[0], 0 );
-		chan_calc(OPN, cch[1], 1 );
-		chan_calc(OPN, cch[2], 2 );
+		if (active[0]) chan_calc(OPN, cch[0], 0 );
+		if (active[1]) chan_calc(OPN, cch[1], 1 );
+		if (active[2]) chan_calc(OPN, cch[2], 2 );
 
 		/* buffering */
 		{
@@ -2769,6 +2785,11 @@ void ym2608_update_one(void *chip, FMSAMPLE * const *buffer, int length)
 	refresh_fc_eg_chan( OPN, cch[5] );
 
 
+	/* channels that stay silent for the whole update are left out */
+	bool active[6];
+	for (int c = 0; c < 6; c++)
+		active[c] = !chan_silent(cch[c]);
+
 	/* buffering */
 	for(i=0; i < length ; i++)
 	{
@@ -2786,12 +2807,12 @@ void ym2608_update_one(void *chip, FMSAMPLE * const *buffer, int length)
 		out_fm[5] = 0;
 
 		/* calculate FM */
-		chan_calc(OPN, cch[0], 0 );
-		chan_calc(OPN, cch[1], 1 );
-		chan_calc(OPN, cch[2], 2 );
-		chan_calc(OPN, cch[3], 3 );
-		chan_calc(OPN, cch[4], 4 );
-		chan_calc(OPN, cch[5], 5 );
+		if (active[0]) chan_calc(OPN, cch[0], 0 );
+		if (active[1]) chan_calc(OPN, cch[1], 1 );
+		if (active[2]) chan_calc(OPN, cch[2], 2 );
+		if (active[3]) chan_calc(OPN, cch[3], 3 );
+		if (active[4]) chan_calc(OPN, cch[4], 4 );
+		if (active[5]) chan_calc(OPN, cch[5], 5 );
 
 		/* deltaT ADPCM */
 		if( DELTAT->portstate&0x80 )
@@ -3322,6 +3343,11 @@ void ym2610_update_one(void *chip, FMSAMPLE * const *buffer, int length)
 	refresh_fc_eg_chan( OPN, cch[2] );
 	refresh_fc_eg_chan( OPN, cch[3] );
 
+	/* channels that stay silent for the whole update are left out */
+	bool active[4];
+	for (int c = 0; c < 4; c++)
+		active[c] = !chan_silent(cch[c]);
+
 	/* buffering */
 	for(i=0; i < length ; i++)
 	{
@@ -3350,10 +3376,10 @@ void ym2610_update_one(void *chip, FMSAMPLE * const *buffer, int length)
 		}
 
 		/* calculate FM */
-		chan_calc(OPN, cch[0], 1 ); /*remapped to 1*/
-		chan_calc(OPN, cch[1], 2 ); /*remapped to 2*/
-		chan_calc(OPN, cch[2], 4 ); /*remapped to 4*/
-		chan_calc(OPN, cch[3], 5 ); /*remapped to 5*/
+		if (active[0]) chan_calc(OPN, cch[0], 1 ); /*remapped to 1*/
+		if (active[1]) chan_calc(OPN, cch[1], 2 ); /*remapped to 2*/
+		if (active[2]) chan_calc(OPN, cch[2], 4 ); /*remapped to 4*/
+		if (active[3]) chan_calc(OPN, cch[3], 5 ); /*remapped to 5*/
 
 		/* deltaT ADPCM */
 		if( DELTAT->portstate&0x80 )
@@ -3452,6 +3478,11 @@ void ym2610b_update_one(void *chip, FMSAMPLE * const *buffer, int length)
 	refresh_fc_eg_chan( OPN, cch[4] );
 	refresh_fc_eg_chan( OPN, cch[5] );
 
+	/* channels that stay silent for the whole update are left out */
+	bool active[6];
+	for (int c = 0; c < 6; c++)
+		active[c] = !chan_silent(cch[c]);
+
 	/* buffering */
 	for(i=0; i < length ; i++)
 	{
@@ -3484,12 +3515,12 @@ void ym2610b_update_one(void *chip, FMSAMPLE * const *buffer, int length)
 		}
 
 		/* calculate FM */
-		chan_calc(OPN, cch[0], 0 );
-		chan_calc(OPN, cch[1], 1 );
-		chan_calc(OPN, cch[2], 2 );
-		chan_calc(OPN, cch[3], 3 );
-		chan_calc(OPN, cch[4], 4 );
-		chan_calc(OPN, cch[5], 5 );
+		if (active[0]) chan_calc(OPN, cch[0], 0 );
+		if (active[1]) chan_calc(OPN, cch[1], 1 );
+		if (active[2]) chan_calc(OPN, cch[2], 2 );
+		if (active[3]) chan_calc(OPN, cch[3], 3 );
+		if (active[4]) chan_calc(OPN, cch[4], 4 );
+		if (active[5]) chan_calc(OPN, cch[5], 5 );
 
 		/* deltaT ADPCM */
 		if( DELTAT->portstate&0x80 )
@@ -568,7 +568,10 @@ public:
 			OPL_CH   &CH  = P_CH[i/2];
 			OPL_SLOT &op  = CH.SLOT[i&1];
 
-			/* Phase Generator */
+			/* Phase Generator; an operator that's off restarts its phase at key on, so it can be left alone,
+			   except on channels 6-8, whose phases the rhythm section shares across instruments */
+			if ((op.state == EG_OFF) && (i < 12))
+				continue;
 			if(op.vib)
 			{
 				unsigned int block_fnum                    = CH.block_fnum;
@@ -630,6 +633,30 @@ public:
 		}
 	}
 
+	/* mask of the melody channels that can be heard before the next register write: a channel
+	   with both operators off and nothing left in its feedback adds nothing, and only a key on
+	   (which updates the stream first) can change that */
+	unsigned active_channels(bool rhythm) const
+	{
+		unsigned mask = 0;
+		for (int ch = 0; ch < (rhythm ? 6 : 9); ch++)
+		{
+			OPL_SLOT const &op1 = P_CH[ch].SLOT[SLOT1];
+			OPL_SLOT const &op2 = P_CH[ch].SLOT[SLOT2];
+			if ((op1.state != EG_OFF) || (op2.state != EG_OFF) || op1.op1_out[0] || op1.op1_out[1])
+				mask |= 1U << ch;
+		}
+		return mask;
+	}
+
+	/* calculate output of the channels in an active_channels mask */
+	void CALC_CHANNELS(unsigned active)
+	{
+		for (int ch = 0; active; ch++, active >>= 1)
+			if (active & 1)
+				CALC_CH(P_CH[ch]);
+	}
+
 	/* calculate output */
 	void CALC_CH(OPL_CH &CH)
 	{
@@ -2210,6 +2237,7 @@ void ym3812_update_one(void *chip, OPLSAMPLE *buffer, int length)
 {
 	FM_OPL      *OPL = (FM_OPL *)chip;
 	uint8_t       rhythm = OPL->rhythm&0x20;
+	unsigned      active = OPL->active_channels(rhythm);
 	OPLSAMPLE   *buf = buffer;
 	int i;
 
@@ -2222,20 +2250,9 @@ void ym3812_update_one(void *chip, OPLSAMPLE *buffer, int length)
 		OPL->advance_lfo();
 
 		/* FM part */
-		OPL->CALC_CH(OPL->P_CH[0]);
-		OPL->CALC_CH(OPL->P_CH[1]);
-		OPL->CALC_CH(OPL->P_CH[2]);
-		OPL->CALC_CH(OPL->P_CH[3]);
-		OPL->CALC_CH(OPL->P_CH[4]);
-		OPL->CALC_CH(OPL->P_CH[5]);
-
-		if(!rhythm)
-		{
-			OPL->CALC_CH(OPL->P_CH[6]);
-			OPL->CALC_CH(OPL->P_CH[7]);
-			OPL->CALC_CH(OPL->P_CH[8]);
-		}
-		else        /* Rhythm part */
+		OPL->CALC_CHANNELS(active);
+
+		if(rhythm)  /* Rhythm part */
 		{
 			OPL->CALC_RH();
 		}
@@ -2339,6 +2356,7 @@ void ym3526_update_one(void *chip, OPLSAMPLE *buffer, int length)
 {
 	FM_OPL      *OPL = (FM_OPL *)chip;
 	uint8_t       rhythm = OPL->rhythm&0x20;
+	unsigned      active = OPL->active_channels(rhythm);
 	OPLSAMPLE   *buf = buffer;
 	int i;
 
@@ -2351,20 +2369,9 @@ void ym3526_update_one(void *chip, OPLSAMPLE *buffer, int length)
 		OPL->advance_lfo();
 
 		/* FM part */
-		OPL->CALC_CH(OPL->P_CH[0]);
-		OPL->CALC_CH(OPL->P_CH[1]);
-		OPL->CALC_CH(OPL->P_CH[2]);
-		OPL->CALC_CH(OPL->P_CH[3]);
-		OPL->CALC_CH(OPL->P_CH[4]);
-		OPL->CALC_CH(OPL->P_CH[5]);
-
-		if(!rhythm)
-		{
-			OPL->CALC_CH(OPL->P_CH[6]);
-			OPL->CALC_CH(OPL->P_CH[7]);
-			OPL->CALC_CH(OPL->P_CH[8]);
-		}
-		else        /* Rhythm part */
+		OPL->CALC_CHANNELS(active);
+
+		if(rhythm)  /* Rhythm part */
 		{
 			OPL->CALC_RH();
 		}
@@ -2496,6 +2503,7 @@ void y8950_update_one(void *chip, OPLSAMPLE *buffer, int length)
 	int i;
 	FM_OPL      *OPL = (FM_OPL *)chip;
 	uint8_t       rhythm  = OPL->rhythm&0x20;
+	unsigned      active  = OPL->active_channels(rhythm);
 	YM_DELTAT   &DELTAT = *OPL->deltat;
 	OPLSAMPLE   *buf    = buffer;
 
@@ -2513,20 +2521,9 @@ void y8950_update_one(void *chip, OPLSAMPLE *buffer, int length)
 			DELTAT.ADPCM_CALC();
 
 		/* FM part */
-		OPL->CALC_CH(OPL->P_CH[0]);
-		OPL->CALC_CH(OPL->P_CH[1]);
-		OPL->CALC_CH(OPL->P_CH[2]);
-		OPL->CALC_CH(OPL->P_CH[3]);
-		OPL->CALC_CH(OPL->P_CH[4]);
-		OPL->CALC_CH(OPL->P_CH[5]);
-
-		if(!rhythm)
-		{
-			OPL->CALC_CH(OPL->P_CH[6]);
-			OPL->CALC_CH(OPL->P_CH[7]);
-			OPL->CALC_CH(OPL->P_CH[8]);
-		}
-		else        /* Rhythm part */
+		OPL->CALC_CHANNELS(active);
+
+		if(rhythm)  /* Rhythm part */
 		{
 			OPL->CALC_RH();
 		}
@@ -326,7 +326,7 @@ void k054539_device::init_chip()
 	cur_ptr = 0;
 	memset(ram.get(), 0, 0x4000);
 
-	stream = stream_alloc(0, 2, clock() / 384);
+	stream = stream_alloc(0, 2, clock() / 384, STREAM_PARALLEL_UPDATE);
 
 	save_item(NAME(voltab));
 	save_item(NAME(pantab));
@@ -145,6 +145,7 @@ void okim6295_device::device_reset()
 	m_stream->update();
 	for (auto & elem : m_voice)
 		elem.m_playing = false;
+	m_stream->set_idle(true);
 }
 
 
@@ -155,6 +156,7 @@ void okim6295_device::device_reset()
 void okim6295_device::device_post_load()
 {
 	device_clock_changed();
+	update_idle();
 }
 
 
@@ -183,6 +185,23 @@ void okim6295_device::sound_stream_update(sound_stream &stream, std::vector<read
 	// iterate over voices and accumulate sample data
 	for (auto & elem : m_voice)
 		elem.generate_adpcm(*this, outputs[0]);
+
+	// once every voice has finished, stop calling us until one starts again
+	update_idle();
+}
+
+
+//-------------------------------------------------
+//  update_idle - mark the stream idle whenever
+//  no voices are playing
+//-------------------------------------------------
+
+void okim6295_device::update_idle()
+{
+	bool playing = false;
+	for (auto & elem : m_voice)
+		playing |= elem.m_playing;
+	m_stream->set_idle(!playing);
 }
 
 
@@ -276,6 +295,7 @@ void okim6295_device::write(uint8_t command)
 						// also reset the ADPCM parameters
 						voice.m_adpcm.reset();
 						voice.m_volume = s_volume_table[command & 0x0f];
+						m_stream->set_idle(false);
 					}
 
 					// invalid samples go here
@@ -309,6 +329,7 @@ void okim6295_device::write(uint8_t command)
 		for (int voicenum = 0; voicenum < OKIM6295_VOICES; voicenum++, voicemask >>= 1)
 			if (voicemask & 1)
 				m_voice[voicenum].m_playing = false;
+		update_idle();
 	}
 }
 
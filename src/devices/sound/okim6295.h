@@ -80,6 +80,9 @@ protected:
 		stream_buffer::sample_t m_volume; // output volume
 	};
 
+	// internal helpers
+	void update_idle();
+
 	// configuration state
 	optional_memory_region  m_region;
 
@@ -64,7 +64,7 @@ void qsound_hle_device::rom_bank_updated()
 
 void qsound_hle_device::device_start()
 {
-	m_stream = stream_alloc_legacy(0, 2, clock() / 2 / 1248); // DSP program uses 1248 machine cycles per iteration
+	m_stream = stream_alloc_legacy(0, 2, clock() / 2 / 1248, STREAM_PARALLEL_UPDATE); // DSP program uses 1248 machine cycles per iteration
 
 	init_register_map();
 
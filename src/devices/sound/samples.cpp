@@ -12,6 +12,13 @@
     discrete sound circuits where proper low-level simulation isn't
     available.  Also used for tape loops and similar.
 
+    Samples are decoded when first played, or ahead of time by a
+    background pre-decode, into a cache with a fixed budget; the least
+    recently played samples are dropped when it fills up.  Long WAV
+    samples are streamed from the file instead of being decoded.  FLAC
+    samples are always decoded whole, since the decoder can't stop part
+    way through a frame.
+
     Current limitations
       - Only supports single channel samples!
 
@@ -26,9 +33,12 @@
 #include "samples.h"
 
 #include "emuopts.h"
+#include "memusage.h"
 
 #include "flac.h"
 
+#include <algorithm>
+
 
 //**************************************************************************
 //  GLOBAL VARIABLES
@@ -58,6 +68,10 @@ samples_device::samples_device(const machine_config &mconfig, device_type type,
 	, m_channels(0)
 	, m_names(nullptr)
 	, m_samples_start_cb(*this)
+	, m_cached_bytes(0)
+	, m_use_count(0)
+	, m_queue(nullptr)
+	, m_stopping(false)
 {
 }
 
@@ -84,13 +98,9 @@ void samples_device::start(uint8_t channel, uint32_t samplenum, bool loop)
 	chan.stream->update();
 
 	// update the parameters
-	sample_t &sample = m_sample[samplenum];
-	chan.source = (sample.data.size() > 0) ? &sample.data[0] : nullptr;
-	chan.source_num = (chan.source_len > 0) ? samplenum : -1;
-	chan.source_len = sample.data.size();
+	attach(chan, samplenum);
 	chan.pos = 0;
-	chan.basefreq = sample.frequency;
-	chan.curfreq = sample.frequency;
+	chan.curfreq = chan.basefreq;
 	chan.loop = loop;
 }
 
@@ -109,6 +119,7 @@ void samples_device::start_raw(uint8_t channel, const int16_t *sampledata, uint3
 	chan.stream->update();
 
 	// update the parameters
+	chan.reader.reset();
 	chan.source = sampledata;
 	chan.source_num = -1;
 	chan.source_len = samples;
@@ -175,6 +186,7 @@ void samples_device::stop(uint8_t channel)
 	channel_t &chan = m_channel[channel];
 	chan.source = nullptr;
 	chan.source_num = -1;
+	chan.reader.reset();
 }
 
 
@@ -229,8 +241,8 @@ bool samples_device::playing(uint8_t channel) const
 
 void samples_device::device_start()
 {
-	// read audio samples
-	load_samples();
+	// find the audio samples; they're decoded when they're needed
+	locate_samples();
 
 	// allocate channels
 	m_channel.resize(m_channels);
@@ -244,6 +256,8 @@ void samples_device::device_start()
 		chan.pos = 0;
 		chan.loop = 0;
 		chan.paused = 0;
+		chan.window_base = 0;
+		chan.window_len = 0;
 
 		// register with the save state system
 		save_item(NAME(chan.source_num), channel);
@@ -253,6 +267,13 @@ void samples_device::device_start()
 		save_item(NAME(chan.paused), channel);
 	}
 
+	// decode what fits in the cache in the background, in the order the samples are listed
+	m_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+	if (m_queue != nullptr)
+		osd_work_item_queue(m_queue, predecode_static, this, 0);
+
+	machine().memory_usage().add_source("samples", *this, "decoded samples", [this] () { return m_cached_bytes; });
+
 	// initialize any custom handlers
 	m_samples_start_cb.resolve();
 
@@ -271,6 +292,24 @@ void samples_device::device_reset()
 }
 
 
+//-------------------------------------------------
+//  device_stop - stop the background pre-decode
+//-------------------------------------------------
+
+void samples_device::device_stop()
+{
+	if (m_queue != nullptr)
+	{
+		m_stopping = true;
+		while (!osd_work_queue_wait(m_queue, osd_ticks_per_second()))
+		{
+		}
+		osd_work_queue_free(m_queue);
+		m_queue = nullptr;
+	}
+}
+
+
 //-------------------------------------------------
 //  device_post_load - handle updating after a
 //  restore
@@ -284,13 +323,7 @@ void samples_device::device_post_load()
 		// attach any samples that were loaded and playing
 		channel_t &chan = m_channel[channel];
 		if (chan.source_num >= 0 && chan.source_num < m_sample.size())
-		{
-			sample_t &sample = m_sample[chan.source_num];
-			chan.source = &sample.data[0];
-			chan.source_len = sample.data.size();
-			if (sample.data.empty())
-				chan.source_num = -1;
-		}
+			attach(chan, chan.source_num);
 
 		// validate the position against the length in case the sample is smaller
 		double endpos = chan.source_len;
@@ -333,6 +366,7 @@ void samples_device::sound_stream_update(sound_stream &stream, std::vector<read_
 				double step = double(chan.curfreq) / double(buffer.sample_rate());
 				double endpos = chan.source_len;
 				const int16_t *sample = chan.source;
+				bool const streamed = bool(chan.reader);
 
 				for (int sampindex = 0; sampindex < buffer.samples(); sampindex++)
 				{
@@ -341,8 +375,17 @@ void samples_device::sound_stream_update(sound_stream &stream, std::vector<read_
 					double frac = chan.pos - pos_floor;
 					int32_t ipos = int32_t(pos_floor);
 
-					stream_buffer::sample_t sample1 = stream_buffer::sample_t(sample[ipos++]);
-					stream_buffer::sample_t sample2 = stream_buffer::sample_t(sample[(ipos + 1) % chan.source_len]);
+					stream_buffer::sample_t sample1, sample2;
+					if (!streamed)
+					{
+						sample1 = stream_buffer::sample_t(sample[ipos++]);
+						sample2 = stream_buffer::sample_t(sample[(ipos + 1) % chan.source_len]);
+					}
+					else
+					{
+						sample1 = stream_buffer::sample_t(streamed_sample(chan, ipos++));
+						sample2 = stream_buffer::sample_t(streamed_sample(chan, (ipos + 1) % chan.source_len));
+					}
 					buffer.put(sampindex, sample_scale * ((1.0 - frac) * sample1 + frac * sample2));
 
 					// advance
@@ -404,10 +447,11 @@ bool samples_device::read_sample(emu_file &file, sample_t &sample)
 
 
 //-------------------------------------------------
-//  read_wav_sample - read a WAV file as a sample
+//  read_wav_header - read a WAV file's header,
+//  leaving the file at the start of the data
 //-------------------------------------------------
 
-bool samples_device::read_wav_sample(emu_file &file, sample_t &sample)
+bool samples_device::read_wav_header(emu_file &file, uint32_t &rate, uint16_t &bits, uint32_t &length)
 {
 	// we already read the opening 'RIFF' tag
 	uint32_t offset = 4;
@@ -437,7 +481,6 @@ bool samples_device::read_wav_sample(emu_file &file, sample_t &sample)
 	}
 
 	// seek until we find a format tag
-	uint32_t length;
 	while (1)
 	{
 		offset += file.read(buf, 4);
@@ -476,7 +519,6 @@ bool samples_device::read_wav_sample(emu_file &file, sample_t &sample)
 	}
 
 	// sample rate
-	uint32_t rate;
 	offset += file.read(&rate, 4);
 	rate = little_endianize_int32(rate);
 
@@ -484,7 +526,6 @@ bool samples_device::read_wav_sample(emu_file &file, sample_t &sample)
 	offset += file.read(buf, 6);
 
 	// bits/sample
-	uint16_t bits;
 	offset += file.read(&bits, 2);
 	bits = little_endianize_int16(bits);
 	if (bits != 8 && bits != 16)
@@ -522,6 +563,20 @@ bool samples_device::read_wav_sample(emu_file &file, sample_t &sample)
 		osd_printf_warning("empty data block (%s)\n", file.filename());
 		return false;
 	}
+	return true;
+}
+
+
+//-------------------------------------------------
+//  read_wav_sample - read a WAV file as a sample
+//-------------------------------------------------
+
+bool samples_device::read_wav_sample(emu_file &file, sample_t &sample)
+{
+	uint32_t rate, length;
+	uint16_t bits;
+	if (!read_wav_header(file, rate, bits, length))
+		return false;
 
 	// fill in the sample data
 	sample.frequency = rate;
@@ -583,12 +638,13 @@ bool samples_device::read_flac_sample(emu_file &file, sample_t &sample)
 
 
 //-------------------------------------------------
-//  load_samples - load all the samples in our
-//  attached interface
-//  Returns true when all samples were successfully read, else false
+//  locate_samples - find the files for all the
+//  samples in our attached interface and read
+//  their headers, without decoding anything
+//  Returns true when all samples were found, else false
 //-------------------------------------------------
 
-bool samples_device::load_samples()
+bool samples_device::locate_samples()
 {
 	bool ok = true;
 	// if the user doesn't want to use samples, bail
@@ -600,28 +656,71 @@ bool samples_device::load_samples()
 	samples_iterator iter(*this);
 	const char *altbasename = iter.altbasename();
 
-	// pre-size the array
+	// pre-size the arrays
 	m_sample.resize(iter.count());
+	m_info.resize(iter.count());
 
-	// load the samples
+	// find the samples
 	int index = 0;
 	for (const char *samplename = iter.first(); samplename != nullptr; index++, samplename = iter.next())
 	{
+		sample_info &info = m_info[index];
+		info.flac = false;
+		info.bits = 16;
+		info.frequency = 0;
+		info.length = 0;
+		info.data_offset = 0;
+		info.streamed = false;
+		info.loaded = false;
+		info.last_used = 0;
+		m_sample[index].frequency = 0;
+
 		// attempt to open as FLAC first
 		emu_file file(machine().options().sample_path(), OPEN_FLAG_READ);
-		osd_file::error filerr = file.open(util::string_format("%s" PATH_SEPARATOR "%s.flac", basename, samplename));
+		std::string filename = util::string_format("%s" PATH_SEPARATOR "%s.flac", basename, samplename);
+		osd_file::error filerr = file.open(filename);
 		if (filerr != osd_file::error::NONE && altbasename != nullptr)
-			filerr = file.open(util::string_format("%s" PATH_SEPARATOR "%s.flac", altbasename, samplename));
+			filerr = file.open(filename = util::string_format("%s" PATH_SEPARATOR "%s.flac", altbasename, samplename));
 
 		// if not, try as WAV
 		if (filerr != osd_file::error::NONE)
-			filerr = file.open(util::string_format("%s" PATH_SEPARATOR "%s.wav", basename, samplename));
+			filerr = file.open(filename = util::string_format("%s" PATH_SEPARATOR "%s.wav", basename, samplename));
 		if (filerr != osd_file::error::NONE && altbasename != nullptr)
-			filerr = file.open(util::string_format("%s" PATH_SEPARATOR "%s.wav", altbasename, samplename));
+			filerr = file.open(filename = util::string_format("%s" PATH_SEPARATOR "%s.wav", altbasename, samplename));
 
-		// if opened, read it
+		// if opened, read the header
 		if (filerr == osd_file::error::NONE)
-			read_sample(file, m_sample[index]);
+		{
+			uint8_t buf[4];
+			if (file.read(buf, 4) < 4)
+				osd_printf_warning("Unable to read %s, 0-byte file?\n", file.filename());
+			else if (memcmp(&buf[0], "RIFF", 4) == 0)
+			{
+				uint32_t length;
+				if (read_wav_header(file, info.frequency, info.bits, length))
+				{
+					info.filename = filename;
+					info.length = length / (info.bits / 8);
+					info.data_offset = file.tell();
+					info.streamed = uint64_t(info.length) * sizeof(int16_t) > STREAM_BYTES;
+				}
+			}
+			else if (memcmp(&buf[0], "fLaC", 4) == 0)
+			{
+				file.seek(0, SEEK_SET);
+				flac_decoder decoder((util::core_file &)file);
+				if (decoder.channels() == 1 && decoder.bits_per_sample() == 16)
+				{
+					info.filename = filename;
+					info.flac = true;
+					info.frequency = decoder.sample_rate();
+					info.length = decoder.total_samples();
+				}
+			}
+			else
+				osd_printf_warning("Unable to read %s, corrupt file?\n", file.filename());
+			m_sample[index].frequency = info.frequency;
+		}
 		else if (filerr == osd_file::error::NOT_FOUND)
 		{
 			logerror("%s: Sample '%s' NOT FOUND\n", tag(), samplename);
@@ -630,3 +729,213 @@ bool samples_device::load_samples()
 	}
 	return ok;
 }
+
+
+//-------------------------------------------------
+//  load_samples - load all the samples in our
+//  attached interface
+//  Returns true when all samples were successfully read, else false
+//-------------------------------------------------
+
+bool samples_device::load_samples()
+{
+	bool const ok = locate_samples();
+
+	// decode everything now, and keep it
+	for (uint32_t index = 0; index < m_info.size(); index++)
+	{
+		sample_info &info = m_info[index];
+		if (!info.filename.empty())
+		{
+			if (!decode_sample(info, m_sample[index]))
+				m_sample[index].data.clear();
+			info.streamed = false;
+			info.loaded = true;
+			m_cached_bytes += m_sample[index].data.size() * sizeof(int16_t);
+		}
+	}
+	return ok;
+}
+
+
+//-------------------------------------------------
+//  decode_sample - decode a sample from the file
+//  it was found in
+//-------------------------------------------------
+
+bool samples_device::decode_sample(sample_info const &info, sample_t &sample) const
+{
+	emu_file file(machine().options().sample_path(), OPEN_FLAG_READ);
+	if (info.filename.empty() || file.open(info.filename) != osd_file::error::NONE)
+		return false;
+	return read_sample(file, sample);
+}
+
+
+//-------------------------------------------------
+//  attach - point a channel at a sample, decoding
+//  it or opening it for streaming if need be
+//-------------------------------------------------
+
+void samples_device::attach(channel_t &chan, uint32_t samplenum)
+{
+	sample_info &info = m_info[samplenum];
+	chan.reader.reset();
+	chan.source = nullptr;
+	chan.source_num = -1;
+	chan.source_len = 0;
+	chan.basefreq = info.frequency;
+
+	// long samples play straight from the file, a window at a time
+	if (info.streamed)
+	{
+		auto reader = std::make_unique<emu_file>(machine().options().sample_path(), OPEN_FLAG_READ);
+		if (reader->open(info.filename) != osd_file::error::NONE)
+			return;
+		chan.reader = std::move(reader);
+		chan.window.resize(STREAM_WINDOW);
+		chan.window_base = 0;
+		chan.window_len = 0;
+		chan.source = &chan.window[0];
+		chan.source_num = samplenum;
+		chan.source_len = info.length;
+		return;
+	}
+
+	// everything else is decoded the first time it's played
+	std::lock_guard<std::mutex> lock(m_lock);
+	sample_t &sample = m_sample[samplenum];
+	if (!info.loaded && !info.filename.empty())
+	{
+		if (!decode_sample(info, sample))
+			sample.data.clear();
+		info.loaded = true;
+		m_cached_bytes += sample.data.size() * sizeof(int16_t);
+	}
+	info.last_used = ++m_use_count;
+
+	if (!sample.data.empty())
+	{
+		chan.source = &sample.data[0];
+		chan.source_num = samplenum;
+		chan.source_len = sample.data.size();
+		chan.basefreq = sample.frequency;
+	}
+
+	// make room for it
+	evict();
+}
+
+
+//-------------------------------------------------
+//  evict - drop the least recently played samples
+//  until the cache is back within its budget;
+//  called with the lock held
+//-------------------------------------------------
+
+void samples_device::evict()
+{
+	while (m_cached_bytes > CACHE_BYTES)
+	{
+		// find the least recently played sample that isn't playing now
+		int32_t victim = -1;
+		for (int32_t index = 0; index < m_info.size(); index++)
+		{
+			if (!m_info[index].loaded || m_sample[index].data.empty())
+				continue;
+			if (victim >= 0 && m_info[index].last_used >= m_info[victim].last_used)
+				continue;
+			if (std::any_of(m_channel.begin(), m_channel.end(), [index] (channel_t const &chan) { return chan.source_num == index && !chan.reader; }))
+				continue;
+			victim = index;
+		}
+		if (victim < 0)
+			break;
+
+		m_cached_bytes -= m_sample[victim].data.size() * sizeof(int16_t);
+		m_sample[victim].data.clear();
+		m_sample[victim].data.shrink_to_fit();
+		m_info[victim].loaded = false;
+	}
+}
+
+
+//-------------------------------------------------
+//  streamed_sample - fetch one sample of a
+//  streamed WAV, reading in the window that
+//  starts with it if it isn't there already
+//-------------------------------------------------
+
+int16_t samples_device::streamed_sample(channel_t &chan, uint32_t index)
+{
+	if (index - chan.window_base >= chan.window_len)
+	{
+		sample_info const &info = m_info[chan.source_num];
+		uint32_t count = (info.length - index < STREAM_WINDOW) ? (info.length - index) : STREAM_WINDOW;
+		chan.reader->seek(info.data_offset + uint64_t(index) * (info.bits / 8), SEEK_SET);
+		if (info.bits == 8)
+		{
+			// convert 8-bit data to signed samples
+			uint8_t *tempptr = reinterpret_cast<uint8_t *>(&chan.window[0]);
+			count = chan.reader->read(tempptr, count);
+			for (int32_t sindex = count - 1; sindex >= 0; sindex--)
+				chan.window[sindex] = int8_t(tempptr[sindex] ^ 0x80) * 256;
+		}
+		else
+		{
+			count = chan.reader->read(&chan.window[0], count * 2) / 2;
+
+			// swap high/low on big-endian systems
+			if (ENDIANNESS_NATIVE != ENDIANNESS_LITTLE)
+				for (uint32_t sindex = 0; sindex < count; sindex++)
+					chan.window[sindex] = little_endianize_int16(chan.window[sindex]);
+		}
+		chan.window_base = index;
+		chan.window_len = count;
+
+		// a file shorter than its header says plays silence
+		if (count == 0)
+			return 0;
+	}
+	return chan.window[index - chan.window_base];
+}
+
+
+//-------------------------------------------------
+//  predecode_static - decode samples in the
+//  background until the cache is full
+//-------------------------------------------------
+
+void *samples_device::predecode_static(void *param, int threadid)
+{
+	samples_device &samples = *reinterpret_cast<samples_device *>(param);
+	for (uint32_t index = 0; index < samples.m_info.size() && !samples.m_stopping; index++)
+	{
+		sample_info &info = samples.m_info[index];
+		if (info.filename.empty() || info.streamed)
+			continue;
+
+		// stop once the next sample won't fit
+		{
+			std::lock_guard<std::mutex> lock(samples.m_lock);
+			if (info.loaded)
+				continue;
+			if (samples.m_cached_bytes + size_t(info.length) * sizeof(int16_t) > CACHE_BYTES)
+				break;
+		}
+
+		// decode without holding the lock, then hand it over unless it was played meanwhile
+		sample_t sample;
+		if (!samples.decode_sample(info, sample))
+			sample.data.clear();
+		std::lock_guard<std::mutex> lock(samples.m_lock);
+		if (!info.loaded)
+		{
+			samples.m_sample[index].frequency = sample.frequency;
+			samples.m_sample[index].data = std::move(sample.data);
+			info.loaded = true;
+			samples.m_cached_bytes += samples.m_sample[index].data.size() * sizeof(int16_t);
+		}
+	}
+	return nullptr;
+}
@@ -6,6 +6,14 @@
 
     Sound device for sample playback.
 
+    Sample sets are located when the device starts but decoded on demand:
+    a sample is decoded the first time it is played, or earlier by a
+    background pre-decode that fills the cache in the order the driver
+    lists its samples.  Decoded samples are kept in a cache with a fixed
+    budget; when it is exceeded, the least recently played samples that
+    aren't playing are dropped.  WAV samples too long to be worth keeping
+    in memory are played straight from the file instead.
+
 ***************************************************************************/
 
 #ifndef MAME_SOUND_SAMPLES_H
@@ -13,6 +21,9 @@
 
 #pragma once
 
+#include <atomic>
+#include <mutex>
+
 
 //**************************************************************************
 //  GLOBAL VARIABLES
@@ -82,6 +93,7 @@ protected:
 	// device-level overrides
 	virtual void device_start() override;
 	virtual void device_reset() override;
+	virtual void device_stop() override;
 	virtual void device_post_load() override;
 
 	// device_sound_interface overrides
@@ -99,23 +111,57 @@ protected:
 		uint32_t        curfreq;
 		bool            loop;
 		bool            paused;
+		std::unique_ptr<emu_file> reader;   // file a streamed sample plays from
+		std::vector<int16_t> window;        // part of a streamed sample read in
+		uint32_t        window_base;        // index of the first sample in the window
+		uint32_t        window_len;         // samples in the window
+	};
+
+	// where a sample comes from, and whether it's decoded
+	struct sample_info
+	{
+		std::string     filename;           // file it was found in, empty if missing
+		bool            flac;               // FLAC rather than WAV
+		uint16_t        bits;               // WAV bits per sample
+		uint32_t        frequency;          // sample rate from the header
+		uint32_t        length;             // samples, from the header
+		uint64_t        data_offset;        // WAV: where the sample data starts
+		bool            streamed;           // played from the file rather than decoded
+		bool            loaded;             // decoded into m_sample
+		uint64_t        last_used;          // play count when last started, for eviction
 	};
 
 	// internal helpers
+	static bool read_wav_header(emu_file &file, uint32_t &rate, uint16_t &bits, uint32_t &length);
 	static bool read_wav_sample(emu_file &file, sample_t &sample);
 	static bool read_flac_sample(emu_file &file, sample_t &sample);
+	bool locate_samples();
 	bool load_samples();
+	bool decode_sample(sample_info const &info, sample_t &sample) const;
+	void attach(channel_t &chan, uint32_t samplenum);
+	void evict();
+	int16_t streamed_sample(channel_t &chan, uint32_t index);
+	static void *predecode_static(void *param, int threadid);
 
 	start_cb_delegate m_samples_start_cb; // optional callback
 
 	// internal state
 	std::vector<channel_t>    m_channel;
 	std::vector<sample_t>     m_sample;
+	std::vector<sample_info>  m_info;
+	std::mutex                m_lock;           // guards m_sample, loaded and m_cached_bytes
+	size_t                    m_cached_bytes;   // bytes of decoded sample data
+	uint64_t                  m_use_count;      // samples started, for eviction order
+	osd_work_queue *          m_queue;          // background pre-decode
+	std::atomic<bool>         m_stopping;       // tells the pre-decode to give up
 
 	// internal constants
 	static constexpr uint8_t FRAC_BITS = 24;
 	static constexpr uint32_t FRAC_ONE = 1 << FRAC_BITS;
 	static constexpr uint32_t FRAC_MASK = FRAC_ONE - 1;
+	static constexpr size_t CACHE_BYTES = 16 << 20;         // decoded samples kept
+	static constexpr size_t STREAM_BYTES = 2 << 20;         // WAV samples longer than this are streamed
+	static constexpr uint32_t STREAM_WINDOW = 4096;         // samples read at a time when streaming
 };
 
 // iterator, since lots of people are interested in these devices
@@ -70,14 +70,10 @@ void SCSPDSP::Step()
 	if (Stopped)
 		return;
 
-	std::fill(std::begin(EFREG), std::end(EFREG), 0);
+	if (!Translated)
+		Translate();
 
-#if 0
-	int dump=0;
-	FILE *f=nullptr;
-	if(dump)
-		f=fopen("dsp.txt","wt");
-#endif
+	std::fill(std::begin(EFREG), std::end(EFREG), 0);
 
 	s32 ACC = 0;    //26 bit
 	s32 MEMVAL = 0;
@@ -85,234 +81,148 @@ void SCSPDSP::Step()
 	s32 Y_REG = 0;      //24 bit
 	u32 ADRS_REG = 0;  //13 bit
 
-	for (int step = 0; step < /*128*/LastStep; ++step)
+	//operations are done at 24 bit precision
+	for (int step = 0; step < ProgramSteps; ++step)
 	{
-		u16 *const IPtr = MPRO + (step * 4);
-
-		//if (!IPtr[0] && !IPtr[1] && !IPtr[2] && !IPtr[3])
-			//break;
-
-		u32 const TRA   = (IPtr[0] >>  8) & 0x7F;
-		u32 const TWT   = (IPtr[0] >>  7) & 0x01;
-		u32 const TWA   = (IPtr[0] >>  0) & 0x7F;
-
-		u32 const XSEL  = (IPtr[1] >> 15) & 0x01;
-		u32 const YSEL  = (IPtr[1] >> 13) & 0x03;
-		u32 const IRA   = (IPtr[1] >>  6) & 0x3F;
-		u32 const IWT   = (IPtr[1] >>  5) & 0x01;
-		u32 const IWA   = (IPtr[1] >>  0) & 0x1F;
-
-		u32 const TABLE = (IPtr[2] >> 15) & 0x01;
-		u32 const MWT   = (IPtr[2] >> 14) & 0x01;
-		u32 const MRD   = (IPtr[2] >> 13) & 0x01;
-		u32 const EWT   = (IPtr[2] >> 12) & 0x01;
-		u32 const EWA   = (IPtr[2] >>  8) & 0x0F;
-		u32 const ADRL  = (IPtr[2] >>  7) & 0x01;
-		u32 const FRCL  = (IPtr[2] >>  6) & 0x01;
-		u32 const SHIFT = (IPtr[2] >>  4) & 0x03;
-		u32 const YRL   = (IPtr[2] >>  3) & 0x01;
-		u32 const NEGB  = (IPtr[2] >>  2) & 0x01;
-		u32 const ZERO  = (IPtr[2] >>  1) & 0x01;
-		u32 const BSEL  = (IPtr[2] >>  0) & 0x01;
-
-		u32 const NOFL  = (IPtr[3] >> 15) & 0x01;  //????
-		u32 const COEF  = (IPtr[3] >>  9) & 0x3f;
-
-		u32 const MASA  = (IPtr[3] >>  2) & 0x1f;  //???
-		u32 const ADREB = (IPtr[3] >>  1) & 0x01;
-		u32 const NXADR = (IPtr[3] >>  0) & 0x01;
-
-		//operations are done at 24 bit precision
-#if 0
-		if (MASA)
-			int a=1;
-		if (NOFL)
-			int a=1;
-
-		//int dump=0;
-
-		if (f)
-		{
-#define DUMP(v) fprintf(f, " " #v ": %04X", v);
-			fprintf(f, "%d: ", step);
-			DUMP(ACC);
-			DUMP(SHIFTED);
-			DUMP(X);
-			DUMP(Y);
-			DUMP(B);
-			DUMP(INPUTS);
-			DUMP(MEMVAL);
-			DUMP(FRC_REG);
-			DUMP(Y_REG);
-			DUMP(ADDR);
-			DUMP(ADRS_REG);
-			fprintf(f, "\n");
-#undef DUMP
-		}
-#endif
+		Op const &op = Program[step];
+		u32 const flags = op.Flags;
 
 		//INPUTS RW
-		// colmns97 hits this
-		//assert(IRA < 0x32);
 		s32 INPUTS; // 24-bit
-		if (IRA <= 0x1f)
-			INPUTS = MEMS[IRA];
-		else if (IRA <= 0x2F)
-			INPUTS = MIXS[IRA - 0x20] << 4;  //MIXS is 20 bit
-		else if (IRA <= 0x31)
-			INPUTS = EXTS[IRA - 0x30] << 8;  //EXTS is 16 bit
+		if (op.ISRC == INPUT_MEMS)
+			INPUTS = MEMS[op.IRA];
+		else if (op.ISRC == INPUT_MIXS)
+			INPUTS = MIXS[op.IRA] << 4;  //MIXS is 20 bit
 		else
-			return;
-
+			INPUTS = EXTS[op.IRA] << 8;  //EXTS is 16 bit
 		INPUTS <<= 8;
 		INPUTS >>= 8;
-		//if(INPUTS & 0x00800000)
-			//INPUTS |= 0xFF000000;
 
-		if (IWT)
+		if (flags & OP_IWT)
 		{
-			MEMS[IWA] = MEMVAL;  // MEMVAL was selected in previous MRD
-			if (IRA == IWA)
+			MEMS[op.IWA] = MEMVAL;  // MEMVAL was selected in previous MRD
+			if (flags & OP_IWT_FWD)
 				INPUTS = MEMVAL;
 		}
 
 		//Operand sel
+		s32 T = TEMP[(op.TRA + DEC) & 0x7F];
+		T <<= 8;
+		T >>= 8;
+
 		s32 B; // 26-bit
-		if (!ZERO)
+		if (flags & OP_B_ZERO)
+			B = 0;
+		else
 		{
-			if (BSEL)
-				B = ACC;
-			else
-			{
-				B = TEMP[(TRA + DEC) & 0x7F];
-				B <<= 8;
-				B >>= 8;
-				//if (B & 0x00800000)
-					//B |= 0xFF000000;  //Sign extend
-			}
-			if (NEGB)
+			B = (flags & OP_B_ACC) ? ACC : T;
+			if (flags & OP_NEGB)
 				B = 0 - B;
 		}
-		else
-			B = 0;
 
-		s32 X; // 24-bit
-		if (XSEL)
-			X = INPUTS;
-		else
+		s32 const X = (flags & OP_XSEL) ? INPUTS : T; // 24-bit
+
+		s32 Y;  //13 bit
+		switch (op.YSEL)
 		{
-			X = TEMP[(TRA + DEC) & 0x7F];
-			X <<= 8;
-			X >>= 8;
-			//if (X & 0x00800000)
-				//X |= 0xFF000000;
+		case 0:  Y = FRC_REG;                    break;
+		case 1:  Y = this->COEF[op.COEF] >> 3;   break;  //COEF is 16 bits
+		case 2:  Y = (Y_REG >> 11) & 0x1FFF;     break;
+		default: Y = (Y_REG >> 4) & 0x0FFF;      break;
 		}
 
-		s32 Y = 0;  //13 bit
-		if (YSEL == 0)
-			Y = FRC_REG;
-		else if (YSEL == 1)
-			Y = this->COEF[COEF] >> 3;   //COEF is 16 bits
-		else if (YSEL == 2)
-			Y = (Y_REG >> 11) & 0x1FFF;
-		else if (YSEL == 3)
-			Y = (Y_REG >> 4) & 0x0FFF;
-
-		if (YRL)
+		if (flags & OP_YRL)
 			Y_REG = INPUTS;
 
 		//Shifter
-		s32 SHIFTED = 0;    //24 bit
-		if (SHIFT == 0)
+		s32 SHIFTED;    //24 bit
+		switch (op.SHIFT)
+		{
+		case 0:
 			SHIFTED = std::max<s32>(std::min<s32>(ACC, 0x007FFFFF), -0x00800000);
-		else if (SHIFT == 1)
+			break;
+		case 1:
 			SHIFTED = std::max<s32>(std::min<s32>(ACC * 2, 0x007FFFFF), -0x00800000);
-		else if (SHIFT == 2)
-		{
+			break;
+		case 2:
 			SHIFTED = ACC * 2;
 			SHIFTED <<= 8;
 			SHIFTED >>= 8;
-			//SHIFTED &= 0x00FFFFFF;
-			//if (SHIFTED & 0x00800000)
-				//SHIFTED |= 0xFF000000;
-		}
-		else if (SHIFT == 3)
-		{
+			break;
+		default:
 			SHIFTED = ACC;
 			SHIFTED <<= 8;
 			SHIFTED >>= 8;
-			//SHIFTED &= 0x00FFFFFF;
-			//if (SHIFTED & 0x00800000)
-				//SHIFTED |= 0xFF000000;
+			break;
 		}
 
 		//ACCUM
 		Y <<= 19;
 		Y >>= 19;
-		//if (Y & 0x1000)
-			//Y |= 0xFFFFF000;
 
 		int64_t const v = (int64_t(X) * int64_t(Y)) >> 12;
 		ACC = int(v + B);
 
-		if (TWT)
-			TEMP[(TWA + DEC) & 0x7F] = SHIFTED;
+		if (flags & OP_TWT)
+			TEMP[(op.TWA + DEC) & 0x7F] = SHIFTED;
 
-		if (FRCL)
+		if (flags & OP_FRCL)
 		{
-			if (SHIFT == 3)
+			if (op.SHIFT == 3)
 				FRC_REG = SHIFTED & 0x0FFF;
 			else
 				FRC_REG = (SHIFTED >> 11) & 0x1FFF;
 		}
 
-		if (MRD || MWT)
-		//if (0)
+		if (flags & (OP_MRD | OP_MWT))
 		{
-			u32 ADDR = MADRS[MASA];
-			if (!TABLE)
+			u32 ADDR = MADRS[op.MASA];
+			if (!(flags & OP_TABLE))
 				ADDR += DEC;
-			if (ADREB)
+			if (flags & OP_ADREB)
 				ADDR += ADRS_REG & 0x0FFF;
-			if (NXADR)
+			if (flags & OP_NXADR)
 				ADDR++;
-			if (!TABLE)
+			if (!(flags & OP_TABLE))
 				ADDR &= RBL - 1;
 			else
 				ADDR &= 0xFFFF;
 			ADDR += RBP << 12;
 			ADDR <<= 1;
-			if (MRD && (step & 1)) //memory only allowed on odd? DoA inserts NOPs on even
+			if (flags & OP_MRD)
 			{
-				if (NOFL)
+				if (flags & OP_NOFL)
 					MEMVAL = space->read_word(ADDR) << 8;
 				else
 					MEMVAL = UNPACK(space->read_word(ADDR));
 			}
-			if (MWT && (step & 1))
+			if (flags & OP_MWT)
 			{
-				if (NOFL)
+				if (flags & OP_NOFL)
 					space->write_word(ADDR, SHIFTED >> 8);
 				else
 					space->write_word(ADDR, PACK(SHIFTED));
 			}
 		}
 
-		if (ADRL)
+		if (flags & OP_ADRL)
 		{
-			if (SHIFT == 3)
+			if (op.SHIFT == 3)
 				ADRS_REG = (SHIFTED >> 12) & 0xFFF;
 			else
 				ADRS_REG = INPUTS >> 16;
 		}
 
-		if (EWT)
-			EFREG[EWA] += SHIFTED >> 8;
+		if (flags & OP_EWT)
+			EFREG[op.EWA] += SHIFTED >> 8;
 	}
+
+	// colmns97 hits this
+	if (ProgramHalts)
+		return;
+
 	--DEC;
 	std::fill(std::begin(MIXS), std::end(MIXS), 0);
-	//if (f)
-		//fclose(f);
 }
 
 void SCSPDSP::SetSample(s32 sample, int SEL, int MXL)
@@ -334,4 +244,73 @@ void SCSPDSP::Start()
 			break;
 	}
 	LastStep = i + 1;
+	Translated = false;
+}
+
+// decode each step's fields once so Step() only has to act on them; memory
+// access on even steps, which never happens, is dropped here too
+void SCSPDSP::Translate()
+{
+	ProgramSteps = LastStep;
+	ProgramHalts = false;
+	for (int step = 0; step < LastStep; ++step)
+	{
+		u16 const *const IPtr = MPRO + (step * 4);
+		Op &op = Program[step];
+
+		u32 const IRA = (IPtr[1] >>  6) & 0x3F;
+		if (IRA > 0x31)
+		{
+			ProgramSteps = step;
+			ProgramHalts = true;
+			break;
+		}
+		if (IRA <= 0x1f)
+		{
+			op.ISRC = INPUT_MEMS;
+			op.IRA = IRA;
+		}
+		else if (IRA <= 0x2F)
+		{
+			op.ISRC = INPUT_MIXS;
+			op.IRA = IRA - 0x20;
+		}
+		else
+		{
+			op.ISRC = INPUT_EXTS;
+			op.IRA = IRA - 0x30;
+		}
+
+		op.TRA   = (IPtr[0] >>  8) & 0x7F;
+		op.TWA   = (IPtr[0] >>  0) & 0x7F;
+		op.YSEL  = (IPtr[1] >> 13) & 0x03;
+		op.IWA   = (IPtr[1] >>  0) & 0x1F;
+		op.EWA   = (IPtr[2] >>  8) & 0x0F;
+		op.SHIFT = (IPtr[2] >>  4) & 0x03;
+		op.COEF  = (IPtr[3] >>  9) & 0x3f;
+		op.MASA  = (IPtr[3] >>  2) & 0x1f;
+
+		u32 flags = 0;
+		if (BIT(IPtr[0], 7))  flags |= OP_TWT;
+		if (BIT(IPtr[1], 15)) flags |= OP_XSEL;
+		if (BIT(IPtr[1], 5))  flags |= OP_IWT | ((IRA == op.IWA) ? OP_IWT_FWD : 0);
+		if (BIT(IPtr[2], 1))  flags |= OP_B_ZERO;
+		if (BIT(IPtr[2], 0))  flags |= OP_B_ACC;
+		if (BIT(IPtr[2], 2))  flags |= OP_NEGB;
+		if (BIT(IPtr[2], 3))  flags |= OP_YRL;
+		if (BIT(IPtr[2], 6))  flags |= OP_FRCL;
+		if (BIT(IPtr[2], 7))  flags |= OP_ADRL;
+		if (BIT(IPtr[2], 12)) flags |= OP_EWT;
+		if (step & 1) //memory only allowed on odd? DoA inserts NOPs on even
+		{
+			if (BIT(IPtr[2], 13)) flags |= OP_MRD;
+			if (BIT(IPtr[2], 14)) flags |= OP_MWT;
+		}
+		if (BIT(IPtr[2], 15)) flags |= OP_TABLE;
+		if (BIT(IPtr[3], 1))  flags |= OP_ADREB;
+		if (BIT(IPtr[3], 0))  flags |= OP_NXADR;
+		if (BIT(IPtr[3], 15)) flags |= OP_NOFL;
+		op.Flags = flags;
+	}
+	Translated = true;
 }
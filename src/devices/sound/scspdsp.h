@@ -32,10 +32,63 @@ struct SCSPDSP
 	bool Stopped;
 	int LastStep;
 
+//translated microprogram, rebuilt before the next step after MPRO changes
+	enum : u32
+	{
+		OP_TWT      = 1 << 0,
+		OP_XSEL     = 1 << 1,
+		OP_IWT      = 1 << 2,
+		OP_IWT_FWD  = 1 << 3,   // IWT to the register IRA reads
+		OP_B_ZERO   = 1 << 4,
+		OP_B_ACC    = 1 << 5,
+		OP_NEGB     = 1 << 6,
+		OP_YRL      = 1 << 7,
+		OP_FRCL     = 1 << 8,
+		OP_ADRL     = 1 << 9,
+		OP_EWT      = 1 << 10,
+		OP_MRD      = 1 << 11,  // only set on odd steps, where memory access happens
+		OP_MWT      = 1 << 12,  // likewise
+		OP_TABLE    = 1 << 13,
+		OP_ADREB    = 1 << 14,
+		OP_NXADR    = 1 << 15,
+		OP_NOFL     = 1 << 16
+	};
+
+	enum : u8
+	{
+		INPUT_MEMS,
+		INPUT_MIXS,
+		INPUT_EXTS
+	};
+
+	struct Op
+	{
+		u32 Flags;  // OP_*
+		u8 ISRC;    // INPUT_*
+		u8 IRA;     // index into the INPUTS source
+		u8 IWA;
+		u8 TRA;
+		u8 TWA;
+		u8 YSEL;
+		u8 SHIFT;
+		u8 COEF;
+		u8 MASA;
+		u8 EWA;
+	};
+
+	Op Program[128];
+	int ProgramSteps;   // steps to run, short of LastStep if the program halts
+	bool ProgramHalts;  // an out of range IRA ends the sample early
+	bool Translated;
+
 	void Init();
 	void SetSample(s32 sample, s32 SEL, s32 MXL);
 	void Step();
 	void Start();
+	void Invalidate() { Translated = false; }
+
+private:
+	void Translate();
 };
 
 #endif // MAME_SOUND_SCSPDSP_H
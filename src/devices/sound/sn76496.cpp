@@ -293,8 +293,7 @@ void sn76496_base_device::device_clock_changed()
 
 void sn76496_base_device::stereo_w(u8 data)
 {
-	m_sound->update();
-	if (m_stereo) m_stereo_mask = data;
+	if (m_stereo) m_sound->queue_write(1, data);
 	else fatalerror("sn76496_base_device: Call to stereo write with mono chip!\n");
 }
 
@@ -305,11 +304,24 @@ void sn76496_base_device::device_timer(emu_timer &timer, device_timer_id id, int
 }
 
 void sn76496_base_device::write(u8 data)
+{
+	// the stream applies the write at the sample it was made in
+	m_sound->queue_write(0, data);
+
+	m_ready_state = false;
+	m_ready_handler(CLEAR_LINE);
+	m_ready_timer->adjust(attotime::from_hz(clock()/(4*m_clock_divider)));
+}
+
+void sn76496_base_device::register_w(offs_t offset, u8 data)
 {
 	int n, r, c;
 
-	// update the output buffer before changing the registers
-	m_sound->update();
+	if (offset == 1)
+	{
+		m_stereo_mask = data;
+		return;
+	}
 
 	if (data & 0x80)
 	{
@@ -358,10 +370,6 @@ void sn76496_base_device::write(u8 data)
 			}
 			break;
 	}
-
-	m_ready_state = false;
-	m_ready_handler(CLEAR_LINE);
-	m_ready_timer->adjust(attotime::from_hz(clock()/(4*m_clock_divider)));
 }
 
 inline bool sn76496_base_device::in_noise_mode()
@@ -381,6 +389,8 @@ void sn76496_base_device::sound_stream_update(sound_stream &stream, std::vector<
 	constexpr stream_buffer::sample_t sample_scale = 1.0 / 32768.0;
 	for (int sampindex = 0; sampindex < lbuffer->samples(); sampindex++)
 	{
+		stream.apply_queued_writes(sampindex, [this] (offs_t offset, u32 data) { register_w(offset, data); });
+
 		// clock chip once
 		if (m_current_clock > 0) // not ready for new divided clock
 		{
@@ -48,6 +48,7 @@ protected:
 
 private:
 	inline bool     in_noise_mode();
+	void            register_w(offs_t offset, u8 data);
 	void            register_for_save_states();
 	void            device_timer(emu_timer &timer, device_timer_id id, int param, void *ptr) override;
 
@@ -1744,7 +1744,9 @@ void ymf271_device::device_start()
 	m_irq_handler.resolve();
 
 	m_master_clock = clock();
-	init_tables();
+
+	// the tables are only used once sound is running, so they can be built alongside other devices starting
+	machine().add_startup_work([this] () { init_tables(); });
 	init_state();
 
 	m_mix_buffer.resize(m_master_clock/(384/4));
@@ -285,6 +285,7 @@ void sega315_5313_device::device_post_load()
 	gfx(3)->mark_all_dirty();
 	gfx(4)->mark_all_dirty();
 	gfx(5)->mark_all_dirty();
+	std::fill_n(m_palette_line_cache.get(), PALETTE_PER_FRAME, 0xffff);
 }
 
 void sega315_5313_device::device_start()
@@ -343,6 +344,9 @@ void sega315_5313_device::device_start()
 
 	memset(m_palette_lookup.get(), 0x00, 0x40 * 2);
 
+	m_palette_line_cache = std::make_unique<u16[]>(PALETTE_PER_FRAME);
+	std::fill_n(m_palette_line_cache.get(), PALETTE_PER_FRAME, 0xffff);
+
 	if (!m_use_alt_timing)
 		m_render_bitmap = std::make_unique<bitmap_rgb32>(1280, 512); // allocate maximum sizes we're going to use, it's safer.
 	else
@@ -2121,77 +2125,76 @@ void sega315_5313_device::render_videobuffer_to_screenbuffer(int scanline)
 			if (!MEGADRIVE_REG0_SPECIAL_PAL) // 3 bit color mode, correct?
 				clut &= 0x49; // (1 << 6) | (1 << 3) | (1 << 0);
 
+			// most lines reuse the previous frame's colours, so only touch the pens that changed
+			if (m_palette_line_cache[p + palette_per_scanline] == clut)
+				continue;
+			m_palette_line_cache[p + palette_per_scanline] = clut;
+
 			m_gfx_palette->set_pen_color(        p + palette_per_scanline, m_palette_lut->pen(clut));
 			m_gfx_palette_shadow->set_pen_color( p + palette_per_scanline, m_palette_lut->pen(0x200 | clut));
 			m_gfx_palette_hilight->set_pen_color(p + palette_per_scanline, m_palette_lut->pen(0x400 | clut));
 		}
 	}
 
+	const pen_t *const normal = m_gfx_palette->pens() + palette_per_scanline;
+	if (!MEGADRIVE_REG0C_SHADOW_HIGLIGHT && (mul == 1))
+	{
+		// common case: one output pixel per source pixel and no shadow/highlight, kept branch-free
+		for (int x = 0; x < horz; x++)
+		{
+			const u32 dat = m_video_renderline[x];
+			lineptr[x] = normal[dat & 0x3f];
+			m_render_line_raw[x] = ((dat & 0x20000) ? 0x000 : 0x100) | ((dat & 0x10000) ? 0x080 : 0x040) | (dat & 0x3f);
+		}
+		return;
+	}
+
+	/* Verify my handling.. I'm not sure all cases are correct */
+	// raw output mode bits for each combination of dat bits 13-16, 0xff where it can't happen
+	static const u8 shadow_highlight_mode[16] =
+	{
+		0x000,  // 0x00000: low priority, no shadow sprite, no highlight = shadow
+		0x000,  // 0x02000: low priority, shadow sprite, no highlight = shadow
+		0x040,  // 0x04000: normal pri, no shadow sprite, no highlight = normal;
+		0x000,  // 0x06000: normal pri,   shadow sprite, no highlight = shadow?
+		0x040,  // 0x08000: low pri, highlight sprite = normal;
+		0xff,   // 0x0a000: shadow set, highlight set - not possible
+		0x0c0,  // 0x0c000: normal pri, highlight set = highlight?
+		0xff,   // 0x0e000: shadow set, highlight set, normal set, not possible
+		0x000,  // 0x10000: (sprite) low priority, no shadow sprite, no highlight = shadow
+		0x000,  // 0x12000: (sprite) low priority, shadow sprite, no highlight = shadow
+		0x080,  // 0x14000: (sprite) normal pri, no shadow sprite, no highlight = normal;
+		0x000,  // 0x16000: (sprite) normal pri,   shadow sprite, no highlight = shadow?
+		0x080,  // 0x18000: (sprite) low pri, highlight sprite = normal;
+		0xff,   // 0x1a000: (sprite)shadow set, highlight set - not possible
+		0x0c0,  // 0x1c000: (sprite) normal pri, highlight set = highlight?
+		0xff    // 0x1e000: (sprite)shadow set, highlight set, normal set, not possible
+	};
+	const pen_t *const pens[4] =
+	{
+		m_gfx_palette_shadow->pens() + palette_per_scanline,
+		normal,
+		normal,
+		m_gfx_palette_hilight->pens() + palette_per_scanline
+	};
+	const bool shadow_highlight = MEGADRIVE_REG0C_SHADOW_HIGLIGHT;
+
 	for (int srcx = 0, xx = 0, dstx = 0; srcx < horz; dstx++)
 	{
 		const u32 dat = m_video_renderline[srcx];
-		const u16 clut = (dat & 0x3f) + palette_per_scanline;
+		const u16 raw = (dat & 0x20000) ? 0x000 : 0x100;
+		const u8 mode = shadow_highlight ? shadow_highlight_mode[(dat >> 13) & 0xf] : ((dat & 0x10000) ? 0x080 : 0x040);
 
-		if (!(dat & 0x20000))
-			m_render_line_raw[srcx] = 0x100;
-		else
-			m_render_line_raw[srcx] = 0x000;
-
-		if (!MEGADRIVE_REG0C_SHADOW_HIGLIGHT)
+		if (mode != 0xff)
 		{
-			if (dat & 0x10000)
-			{
-				lineptr[dstx] = m_gfx_palette->pen(clut);
-				m_render_line_raw[srcx] |= (dat & 0x3f) | 0x080;
-			}
-			else
-			{
-				lineptr[dstx] = m_gfx_palette->pen(clut);
-				m_render_line_raw[srcx] |= (dat & 0x3f) | 0x040;
-			}
+			lineptr[dstx] = pens[mode >> 6][dat & 0x3f];
+			m_render_line_raw[srcx] = raw | mode | (dat & 0x3f);
 		}
 		else
 		{
-			/* Verify my handling.. I'm not sure all cases are correct */
-			switch (dat & 0x1e000)
-			{
-				case 0x00000: // low priority, no shadow sprite, no highlight = shadow
-				case 0x02000: // low priority, shadow sprite, no highlight = shadow
-				case 0x06000: // normal pri,   shadow sprite, no highlight = shadow?
-				case 0x10000: // (sprite) low priority, no shadow sprite, no highlight = shadow
-				case 0x12000: // (sprite) low priority, shadow sprite, no highlight = shadow
-				case 0x16000: // (sprite) normal pri,   shadow sprite, no highlight = shadow?
-					lineptr[dstx] = m_gfx_palette_shadow->pen(clut);
-					m_render_line_raw[srcx] |= (dat & 0x3f) | 0x000;
-					break;
-
-				case 0x4000: // normal pri, no shadow sprite, no highlight = normal;
-				case 0x8000: // low pri, highlight sprite = normal;
-					lineptr[dstx] = m_gfx_palette->pen(clut);
-					m_render_line_raw[srcx] |= (dat & 0x3f) | 0x040;
-					break;
-
-				case 0x14000: // (sprite) normal pri, no shadow sprite, no highlight = normal;
-				case 0x18000: // (sprite) low pri, highlight sprite = normal;
-					lineptr[dstx] = m_gfx_palette->pen(clut);
-					m_render_line_raw[srcx] |= (dat & 0x3f) | 0x080;
-					break;
-
-				case 0x0c000: // normal pri, highlight set = highlight?
-				case 0x1c000: // (sprite) normal pri, highlight set = highlight?
-					lineptr[dstx] = m_gfx_palette_hilight->pen(clut);
-					m_render_line_raw[srcx] |= (dat & 0x3f) | 0x0c0;
-					break;
-
-				case 0x0a000: // shadow set, highlight set - not possible
-				case 0x0e000: // shadow set, highlight set, normal set, not possible
-				case 0x1a000: // (sprite)shadow set, highlight set - not possible
-				case 0x1e000: // (sprite)shadow set, highlight set, normal set, not possible
-				default:
-					lineptr[dstx] = m_render_line_raw[srcx] |= (machine().rand() & 0x3f);
-					break;
-			}
+			lineptr[dstx] = m_render_line_raw[srcx] = raw | (machine().rand() & 0x3f);
 		}
+
 		if (++xx >= mul)
 		{
 			srcx++;
@@ -227,6 +227,7 @@ private:
 	std::unique_ptr<u8[]> m_highpri_renderline;
 	std::unique_ptr<u32[]> m_video_renderline;
 	std::unique_ptr<u16[]> m_palette_lookup;
+	std::unique_ptr<u16[]> m_palette_line_cache; // CRAM value each per-line pen was last set from
 
 	address_space *m_space68k;
 	required_device<m68000_base_device> m_cpu68k;
@@ -6,6 +6,8 @@
 #include "epic12.h"
 #include "screen.h"
 
+#define LOG_DRAW_COMMANDS 0 // log draw commands for replaying with the epic12 benchmark
+
 DEFINE_DEVICE_TYPE(EPIC12, epic12_device, "epic12", "EPIC12 Blitter")
 
 epic12_device::epic12_device(const machine_config &mconfig, const char *tag, device_t *owner, u32 clock)
@@ -89,6 +91,13 @@ void epic12_device::device_reset()
 		m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_HIGH_FREQ);
 	}
 
+	init_colour_tables();
+
+	m_blitter_busy = 0;
+}
+
+void epic12_device::init_colour_tables()
+{
 	// cache table to avoid divides in blit code, also pre-clamped
 	for (int y = 0; y < 0x40; y++)
 	{
@@ -107,8 +116,6 @@ void epic12_device::device_reset()
 			colrtable_add[x][y] = std::min((x + y), 0x1f);
 		}
 	}
-
-	m_blitter_busy = 0;
 }
 
 // todo, get these into the device class without ruining performance
@@ -217,8 +224,6 @@ inline void epic12_device::gfx_upload(offs_t *addr)
 	}
 }
 
-#define draw_params m_bitmaps.get(), &m_clip, &m_bitmaps->pix(0,0),src_x,src_y, x,y, dimx,dimy, flipy, s_alpha, d_alpha, &tint_clr
-
 
 const epic12_device::blitfunction epic12_device::f0_ti1_tr1_blit_funcs[64] =
 {
@@ -372,20 +377,34 @@ inline void epic12_device::gfx_draw_shadow_copy(address_space &space, offs_t *ad
 
 
 inline void epic12_device::gfx_draw(offs_t *addr)
+{
+	u16 params[10];
+	for (int i = 0; i < 10; i++)
+		params[i] = READ_NEXT_WORD(addr);
+
+	if (LOG_DRAW_COMMANDS)
+		logerror("GFX DRAW: %04X %04X %04X %04X %04X %04X %04X %04X %04X %04X\n",
+				params[0], params[1], params[2], params[3], params[4], params[5], params[6], params[7], params[8], params[9]);
+
+	draw_blit(*m_bitmaps, m_clip, params, true);
+}
+
+
+void epic12_device::draw_blit(bitmap_rgb32 &bitmap, const rectangle &clip, const u16 *params, bool allow_simd)
 {
 	clr_t tint_clr;
 	bool tinted = false;
 
-	const u16 attr        = READ_NEXT_WORD(addr);
-	const u16 alpha       = READ_NEXT_WORD(addr);
-	u16 src_x             = READ_NEXT_WORD(addr);
-	u16 src_y             = READ_NEXT_WORD(addr);
-	const u16 dst_x_start = READ_NEXT_WORD(addr);
-	const u16 dst_y_start = READ_NEXT_WORD(addr);
-	const u16 w           = READ_NEXT_WORD(addr);
-	const u16 h           = READ_NEXT_WORD(addr);
-	const u16 tint_r      = READ_NEXT_WORD(addr);
-	const u16 tint_gb     = READ_NEXT_WORD(addr);
+	const u16 attr        = params[0];
+	const u16 alpha       = params[1];
+	u16 src_x             = params[2];
+	u16 src_y             = params[3];
+	const u16 dst_x_start = params[4];
+	const u16 dst_y_start = params[5];
+	const u16 w           = params[6];
+	const u16 h           = params[7];
+	const u16 tint_r      = params[8];
+	const u16 tint_gb     = params[9];
 
 	// 0: +alpha
 	// 1: +source
@@ -438,6 +457,15 @@ inline void epic12_device::gfx_draw(offs_t *addr)
 	if ((s_mode == 0 && s_alpha == 0x1f) && (d_mode == 4 && d_alpha == 0x1f))
 		blend = false;
 
+	blitfunction blit = allow_simd ? simd_blit_function(flipx, tinted, trans, blend, s_mode, d_mode) : nullptr;
+	if (blit == nullptr)
+		blit = scalar_blit_function(flipx, tinted, trans, blend, s_mode, d_mode);
+	blit(&bitmap, &clip, &bitmap.pix(0, 0), src_x, src_y, x, y, dimx, dimy, flipy, s_alpha, d_alpha, &tint_clr);
+}
+
+
+epic12_device::blitfunction epic12_device::scalar_blit_function(bool flipx, bool tinted, bool trans, bool blend, u8 s_mode, u8 d_mode)
+{
 	if (tinted)
 	{
 		if (!flipx)
@@ -446,22 +474,22 @@ inline void epic12_device::gfx_draw(offs_t *addr)
 			{
 				if (!blend)
 				{
-					draw_sprite_f0_ti1_tr1_plain(draw_params);
+					return draw_sprite_f0_ti1_tr1_plain;
 				}
 				else
 				{
-					f0_ti1_tr1_blit_funcs[s_mode | (d_mode << 3)](draw_params);
+					return f0_ti1_tr1_blit_funcs[s_mode | (d_mode << 3)];
 				}
 			}
 			else
 			{
 			if (!blend)
 				{
-					draw_sprite_f0_ti1_tr0_plain(draw_params);
+					return draw_sprite_f0_ti1_tr0_plain;
 				}
 				else
 				{
-					f0_ti1_tr0_blit_funcs[s_mode | (d_mode << 3)](draw_params);
+					return f0_ti1_tr0_blit_funcs[s_mode | (d_mode << 3)];
 				}
 			}
 		}
@@ -471,22 +499,22 @@ inline void epic12_device::gfx_draw(offs_t *addr)
 			{
 				if (!blend)
 				{
-					draw_sprite_f1_ti1_tr1_plain(draw_params);
+					return draw_sprite_f1_ti1_tr1_plain;
 				}
 				else
 				{
-					f1_ti1_tr1_blit_funcs[s_mode | (d_mode << 3)](draw_params);
+					return f1_ti1_tr1_blit_funcs[s_mode | (d_mode << 3)];
 				}
 			}
 			else
 			{
 			if (!blend)
 				{
-					draw_sprite_f1_ti1_tr0_plain(draw_params);
+					return draw_sprite_f1_ti1_tr0_plain;
 				}
 				else
 				{
-					f1_ti1_tr0_blit_funcs[s_mode | (d_mode << 3)](draw_params);
+					return f1_ti1_tr0_blit_funcs[s_mode | (d_mode << 3)];
 				}
 			}
 		}
@@ -499,27 +527,26 @@ inline void epic12_device::gfx_draw(offs_t *addr)
 			{
 				if (trans)
 				{
-					draw_sprite_f0_ti0_tr1_simple(draw_params);
+					return draw_sprite_f0_ti0_tr1_simple;
 				}
 				else
 				{
-					draw_sprite_f0_ti0_tr0_simple(draw_params);
+					return draw_sprite_f0_ti0_tr0_simple;
 				}
 			}
 			else
 			{
 				if (trans)
 				{
-					draw_sprite_f1_ti0_tr1_simple(draw_params);
+					return draw_sprite_f1_ti0_tr1_simple;
 				}
 				else
 				{
-					draw_sprite_f1_ti0_tr0_simple(draw_params);
+					return draw_sprite_f1_ti0_tr0_simple;
 				}
 
 			}
 
-			return;
 		}
 
 		//printf("smode %d dmode %d\n", s_mode, d_mode);
@@ -530,22 +557,22 @@ inline void epic12_device::gfx_draw(offs_t *addr)
 			{
 				if (!blend)
 				{
-					draw_sprite_f0_ti0_plain(draw_params);
+					return draw_sprite_f0_ti0_plain;
 				}
 				else
 				{
-					f0_ti0_tr1_blit_funcs[s_mode | (d_mode << 3)](draw_params);
+					return f0_ti0_tr1_blit_funcs[s_mode | (d_mode << 3)];
 				}
 			}
 			else
 			{
 			if (!blend)
 				{
-					draw_sprite_f0_ti0_tr0_plain(draw_params);
+					return draw_sprite_f0_ti0_tr0_plain;
 				}
 				else
 				{
-					f0_ti0_tr0_blit_funcs[s_mode | (d_mode << 3)](draw_params);
+					return f0_ti0_tr0_blit_funcs[s_mode | (d_mode << 3)];
 				}
 			}
 		}
@@ -555,22 +582,22 @@ inline void epic12_device::gfx_draw(offs_t *addr)
 			{
 				if (!blend)
 				{
-					draw_sprite_f1_ti0_plain(draw_params);
+					return draw_sprite_f1_ti0_plain;
 				}
 				else
 				{
-					f1_ti0_tr1_blit_funcs[s_mode | (d_mode << 3)](draw_params);
+					return f1_ti0_tr1_blit_funcs[s_mode | (d_mode << 3)];
 				}
 			}
 			else
 			{
 			if (!blend)
 				{
-					draw_sprite_f1_ti0_tr0_plain(draw_params);
+					return draw_sprite_f1_ti0_tr0_plain;
 				}
 				else
 				{
-					f1_ti0_tr0_blit_funcs[s_mode | (d_mode << 3)](draw_params);
+					return f1_ti0_tr0_blit_funcs[s_mode | (d_mode << 3)];
 				}
 			}
 		}
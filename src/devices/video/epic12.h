@@ -8,6 +8,13 @@
 
 #define DEBUG_VRAM_VIEWER 0 // VRAM viewer for debug
 
+// use the SSE2 blitters where they can be assumed, the same way rgbutil.h does
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)) || defined(_M_X64))
+#define EPIC12_USE_SSE2 1
+#else
+#define EPIC12_USE_SSE2 0
+#endif
+
 class epic12_device : public device_t, public device_video_interface
 {
 public:
@@ -792,7 +799,7 @@ protected:
 	};
 
 	// convert separate r,g,b biases (0..80..ff) to clr_t (-1f..0..1f)
-	void tint_to_clr(u8 r, u8 g, u8 b, clr_t *clr)
+	static void tint_to_clr(u8 r, u8 g, u8 b, clr_t *clr)
 	{
 		clr->r  =   r>>2;
 		clr->g  =   g>>2;
@@ -832,6 +839,18 @@ protected:
 	rectangle m_curr_screen_visarea;
 #endif
 
+	// blit selection; draw_blit takes the ten words of a draw command
+	static void init_colour_tables();
+	static void draw_blit(bitmap_rgb32 &bitmap, const rectangle &clip, const u16 *params, bool allow_simd);
+	static blitfunction scalar_blit_function(bool flipx, bool tinted, bool trans, bool blend, u8 s_mode, u8 d_mode);
+	static blitfunction simd_blit_function(bool flipx, bool tinted, bool trans, bool blend, u8 s_mode, u8 d_mode);
+
+#if EPIC12_USE_SSE2
+	// SSE2 versions of the common cases, in epic12_blitsse.cpp
+	template <int SMode, int DMode, bool Blend> static blitfunction sse2_blit_function(bool flipx, bool tinted, bool trans);
+	template <int SMode, int DMode, bool Blend, bool FlipX, bool Tint, bool Trans> static void draw_sprite_sse2(BLIT_PARAMS);
+#endif
+
 	static u8 colrtable[0x20][0x40];
 	static u8 colrtable_rev[0x20][0x40];
 	static u8 colrtable_add[0x20][0x20];
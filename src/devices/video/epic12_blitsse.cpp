@@ -0,0 +1,240 @@
+// license:BSD-3-Clause
+// copyright-holders:David Haywood
+/* SSE2 versions of the most heavily used blitters
+
+   These give exactly the same results as the table driven blitters built
+   from epic12in.hxx and epic12pixel.hxx.  Each colour channel gets its own
+   16-bit lane, two pixels to a register, and the tables are replaced with
+   the arithmetic they cache:
+
+       colrtable[a][b]     = min(a * b / 31, 31)
+       colrtable_rev[a][b] = colrtable[a ^ 31][b]
+       colrtable_add[a][b] = min(a + b, 31)
+
+   Four pixels are handled per step and any remainder one at a time with the
+   same code.  Modes not listed in simd_blit_function use the scalar blitters.
+*/
+
+#include "emu.h"
+#include "epic12.h"
+
+#if EPIC12_USE_SSE2
+
+#include <emmintrin.h>
+
+
+namespace {
+
+// colrtable; the high multiply divides by 31 exactly for products up to 31 * 63
+inline __m128i sse2_mul(__m128i a, __m128i b)
+{
+	const __m128i product = _mm_mullo_epi16(a, b);
+	return _mm_min_epi16(_mm_mulhi_epu16(product, _mm_set1_epi16(2115)), _mm_set1_epi16(0x1f));
+}
+
+// colrtable_rev
+inline __m128i sse2_mul_rev(__m128i a, __m128i b)
+{
+	return sse2_mul(_mm_xor_si128(a, _mm_set1_epi16(0x1f)), b);
+}
+
+// colrtable_add
+inline __m128i sse2_add(__m128i a, __m128i b)
+{
+	return _mm_min_epi16(_mm_add_epi16(a, b), _mm_set1_epi16(0x1f));
+}
+
+// copy the red lane of each pixel over green and blue, as add_with_clr_square does
+inline __m128i sse2_red(__m128i a)
+{
+	return _mm_shufflehi_epi16(_mm_shufflelo_epi16(a, _MM_SHUFFLE(3, 2, 2, 2)), _MM_SHUFFLE(3, 2, 2, 2));
+}
+
+// source and destination terms for each blending mode, following epic12pixel.hxx
+template <int SMode, int DMode>
+inline __m128i sse2_blend(__m128i s, __m128i d, __m128i s_alpha, __m128i d_alpha)
+{
+	__m128i clr0;
+	switch (SMode)
+	{
+		case 0: clr0 = sse2_mul(s_alpha, s); break;
+		case 1: clr0 = sse2_mul(s, s); break;
+		case 2: clr0 = sse2_mul(d, s); break;
+		case 4: clr0 = sse2_mul_rev(s_alpha, s); break;
+		case 5: clr0 = sse2_mul_rev(s, s); break;
+		case 6: clr0 = sse2_mul_rev(d, s); break;
+		default: clr0 = s; break;
+	}
+
+	switch (DMode)
+	{
+		case 0: return sse2_add(clr0, sse2_mul(d, d_alpha));
+		case 1: return sse2_add(clr0, sse2_mul(s, d));
+		case 2: return sse2_add(sse2_red(clr0), sse2_mul(d, d));
+		case 4: return sse2_add(clr0, sse2_mul_rev(d_alpha, d));
+		case 5: return sse2_add(clr0, sse2_mul_rev(s, d));
+		case 6: return sse2_add(clr0, sse2_mul_rev(d, d));
+		default: return sse2_add(clr0, d);
+	}
+}
+
+// draw up to four pixels, returning the new destination
+template <int SMode, int DMode, bool Blend, bool Tint, bool Trans>
+inline __m128i sse2_pixels(__m128i pen, __m128i dst, __m128i tint, __m128i s_alpha, __m128i d_alpha)
+{
+	__m128i result = pen;
+
+	if (Blend || Tint)
+	{
+		// --t- ---- rrrr r--- gggg g--- bbbb b--- to one channel per lane
+		const __m128i zero = _mm_setzero_si128();
+		__m128i s_lo = _mm_srli_epi16(_mm_unpacklo_epi8(pen, zero), 3);
+		__m128i s_hi = _mm_srli_epi16(_mm_unpackhi_epi8(pen, zero), 3);
+
+		if (Tint)
+		{
+			s_lo = sse2_mul(s_lo, tint);
+			s_hi = sse2_mul(s_hi, tint);
+		}
+
+		if (Blend)
+		{
+			const __m128i d_lo = _mm_srli_epi16(_mm_unpacklo_epi8(dst, zero), 3);
+			const __m128i d_hi = _mm_srli_epi16(_mm_unpackhi_epi8(dst, zero), 3);
+			s_lo = sse2_blend<SMode, DMode>(s_lo, d_lo, s_alpha, d_alpha);
+			s_hi = sse2_blend<SMode, DMode>(s_hi, d_hi, s_alpha, d_alpha);
+		}
+
+		// back to pens, keeping the source transparency bit
+		result = _mm_packus_epi16(_mm_slli_epi16(s_lo, 3), _mm_slli_epi16(s_hi, 3));
+		result = _mm_or_si128(_mm_and_si128(result, _mm_set1_epi32(0x00f8f8f8)), _mm_and_si128(pen, _mm_set1_epi32(0x20000000)));
+	}
+
+	if (Trans)
+	{
+		// leave the destination alone where the source is transparent
+		const __m128i opaque = _mm_cmpeq_epi32(_mm_and_si128(pen, _mm_set1_epi32(0x20000000)), _mm_set1_epi32(0x20000000));
+		result = _mm_or_si128(_mm_and_si128(opaque, result), _mm_andnot_si128(opaque, dst));
+	}
+
+	return result;
+}
+
+} // anonymous namespace
+
+
+template <int SMode, int DMode, bool Blend, bool FlipX, bool Tint, bool Trans>
+void epic12_device::draw_sprite_sse2(BLIT_PARAMS)
+{
+	int yf;
+
+	if (FlipX)
+		src_x += (dimx-1);
+
+	if (flipy)  { yf = -1; src_y += (dimy-1); }
+	else        { yf = +1;                    }
+
+	int starty = 0;
+	const int dst_y_end = dst_y_start + dimy;
+
+	if (dst_y_start < clip->min_y)
+		starty = clip->min_y - dst_y_start;
+
+	if (dst_y_end > clip->max_y)
+		dimy -= (dst_y_end-1) - clip->max_y;
+
+	// sources wrapping round an edge of vram aren't drawn, same as the scalar blitters
+	if (FlipX ? ((src_x & 0x1fff) < ((src_x-(dimx-1)) & 0x1fff)) : ((src_x & 0x1fff) > ((src_x+(dimx-1)) & 0x1fff)))
+		return;
+
+	int startx = 0;
+	const int dst_x_end = dst_x_start + dimx;
+
+	if (dst_x_start < clip->min_x)
+		startx = clip->min_x - dst_x_start;
+
+	if (dst_x_end > clip->max_x)
+		dimx -= (dst_x_end-1) - clip->max_x;
+
+	// wrong/unsafe slowdown sim
+	if (dimy > starty && dimx > startx)
+		blit_delay += (dimy - starty) * (dimx - startx);
+
+	const __m128i tint = _mm_set_epi16(0, tint_clr->r, tint_clr->g, tint_clr->b, 0, tint_clr->r, tint_clr->g, tint_clr->b);
+	const __m128i salpha = _mm_set1_epi16(s_alpha);
+	const __m128i dalpha = _mm_set1_epi16(d_alpha);
+	const int step = FlipX ? -1 : 1;
+
+	for (int y = starty; y < dimy; y++)
+	{
+		u32 *bmp = &bitmap->pix(dst_y_start + y, dst_x_start + startx);
+		u32 *const end = bmp + (dimx - startx);
+		const u32 *gfx2 = gfx + ((src_y + yf * y) & 0x0fff) * 0x2000 + (FlipX ? (src_x - startx) : (src_x + startx));
+
+		// a line drawn over its own source may read pixels it has just written, so keep those in order
+		const u32 *const src_first = FlipX ? (gfx2 - (end - bmp) + 1) : gfx2;
+		const u32 *const src_last = FlipX ? gfx2 : (gfx2 + (end - bmp) - 1);
+		if (src_first >= end || src_last < bmp)
+		{
+			while (end - bmp >= 4)
+			{
+				const __m128i pen = FlipX
+						? _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(gfx2 - 3)), _MM_SHUFFLE(0, 1, 2, 3))
+						: _mm_loadu_si128(reinterpret_cast<const __m128i *>(gfx2));
+				const __m128i dst = (Blend || Trans) ? _mm_loadu_si128(reinterpret_cast<const __m128i *>(bmp)) : _mm_setzero_si128();
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(bmp), sse2_pixels<SMode, DMode, Blend, Tint, Trans>(pen, dst, tint, salpha, dalpha));
+				bmp += 4;
+				gfx2 += 4 * step;
+			}
+		}
+
+		while (bmp < end)
+		{
+			const __m128i result = sse2_pixels<SMode, DMode, Blend, Tint, Trans>(_mm_cvtsi32_si128(*gfx2), _mm_cvtsi32_si128(*bmp), tint, salpha, dalpha);
+			*bmp++ = _mm_cvtsi128_si32(result);
+			gfx2 += step;
+		}
+	}
+}
+
+
+template <int SMode, int DMode, bool Blend>
+epic12_device::blitfunction epic12_device::sse2_blit_function(bool flipx, bool tinted, bool trans)
+{
+	static const blitfunction funcs[8] =
+	{
+		draw_sprite_sse2<SMode, DMode, Blend, false, false, false>,
+		draw_sprite_sse2<SMode, DMode, Blend, false, false, true>,
+		draw_sprite_sse2<SMode, DMode, Blend, false, true, false>,
+		draw_sprite_sse2<SMode, DMode, Blend, false, true, true>,
+		draw_sprite_sse2<SMode, DMode, Blend, true, false, false>,
+		draw_sprite_sse2<SMode, DMode, Blend, true, false, true>,
+		draw_sprite_sse2<SMode, DMode, Blend, true, true, false>,
+		draw_sprite_sse2<SMode, DMode, Blend, true, true, true>,
+	};
+
+	return funcs[(flipx ? 4 : 0) | (tinted ? 2 : 0) | (trans ? 1 : 0)];
+}
+
+#endif // EPIC12_USE_SSE2
+
+
+// returns nullptr for anything without a SIMD version
+epic12_device::blitfunction epic12_device::simd_blit_function(bool flipx, bool tinted, bool trans, bool blend, u8 s_mode, u8 d_mode)
+{
+#if EPIC12_USE_SSE2
+	if (!blend)
+		return sse2_blit_function<0, 0, false>(flipx, tinted, trans);
+
+	switch (s_mode | (d_mode << 3))
+	{
+		case 0 | (0 << 3): return sse2_blit_function<0, 0, true>(flipx, tinted, trans); // in game, futari title screens etc.
+		case 0 | (1 << 3): return sse2_blit_function<0, 1, true>(flipx, tinted, trans); // futari
+		case 0 | (4 << 3): return sse2_blit_function<0, 4, true>(flipx, tinted, trans); // plain alpha blending
+		case 0 | (5 << 3): return sse2_blit_function<0, 5, true>(flipx, tinted, trans); // futari black character select
+		case 2 | (0 << 3): return sse2_blit_function<2, 0, true>(flipx, tinted, trans); // espgal2 highscore screen
+	}
+#endif
+
+	return nullptr;
+}
@@ -118,6 +118,7 @@ mc6845_device::mc6845_device(const machine_config &mconfig, device_type type, co
 	, m_reconfigure_cb(*this)
 	, m_begin_update_cb(*this)
 	, m_update_row_cb(*this)
+	, m_update_frame_cb(*this)
 	, m_end_update_cb(*this)
 	, m_on_update_addr_changed_cb(*this)
 	, m_out_de_cb(*this)
@@ -1128,19 +1129,24 @@ uint8_t mc6845_device::draw_scanline(int y, bitmap_rgb32 &bitmap, const rectangl
 	int hbp = m_horiz_pix_total - m_hsync_off_pos;
 	if (hbp < 0) hbp = 0;
 
-	/* call the external system to draw it */
+	/* call the external system to draw it, or note it down for drawing the whole frame */
+	uint16_t ma = m_current_disp_addr;
 	if (MODE_ROW_COLUMN_ADDRESSING)
 	{
 		uint8_t cc = 0;
 		uint8_t cr = y / (m_max_ras_addr + (MODE_INTERLACE_AND_VIDEO ? m_interlace_adjust : m_noninterlace_adjust));
-		uint16_t ma = (cr << 8) | cc;
-
-		m_update_row_cb(bitmap, cliprect, ma + m_disp_start_addr, ra, y, m_horiz_disp, cursor_x, de, hbp, vbp);
+		ma = ((cr << 8) | cc) + m_disp_start_addr;
 	}
-	else
+
+	if (!m_update_frame_cb.isnull())
 	{
-		m_update_row_cb(bitmap, cliprect, m_current_disp_addr, ra, y, m_horiz_disp, cursor_x, de, hbp, vbp);
+		m_frame.x_count = m_horiz_disp;
+		m_frame.hbp = hbp;
+		m_frame.vbp = vbp;
+		m_frame.lines.push_back({ ma, ra, uint16_t(y), cursor_x, uint8_t(de) });
 	}
+	else
+		m_update_row_cb(bitmap, cliprect, ma, ra, y, m_horiz_disp, cursor_x, de, hbp, vbp);
 
 	/* update MA if the last raster address */
 	if (ra == m_max_ras_addr + (MODE_INTERLACE_AND_VIDEO ? m_interlace_adjust : m_noninterlace_adjust) - 1)
@@ -1176,7 +1182,7 @@ uint32_t mc6845_device::screen_update(screen_device &screen, bitmap_rgb32 &bitma
 
 	if (m_has_valid_parameters)
 	{
-		assert(!m_update_row_cb.isnull());
+		assert(!m_update_row_cb.isnull() || !m_update_frame_cb.isnull());
 
 		if (m_display_disabled_msg_shown == true)
 		{
@@ -1195,11 +1201,15 @@ uint32_t mc6845_device::screen_update(screen_device &screen, bitmap_rgb32 &bitma
 		}
 
 		/* for each row in the visible region */
+		m_frame.lines.clear();
 		for (uint16_t y = cliprect.min_y; y <= cliprect.max_y; y++)
 		{
 			this->draw_scanline(y, bitmap, cliprect);
 		}
 
+		if (!m_update_frame_cb.isnull() && !m_frame.lines.empty())
+			m_update_frame_cb(bitmap, cliprect, m_frame);
+
 		/* call the tear down function if any */
 		if (!m_end_update_cb.isnull())
 			m_end_update_cb(bitmap, cliprect);
@@ -1226,6 +1236,7 @@ void mc6845_device::device_start()
 	m_reconfigure_cb.resolve();
 	m_begin_update_cb.resolve();
 	m_update_row_cb.resolve();
+	m_update_frame_cb.resolve();
 	m_end_update_cb.resolve();
 	m_on_update_addr_changed_cb.resolve();
 
@@ -43,6 +43,8 @@
 #define MC6845_UPDATE_ROW(name)     void name(bitmap_rgb32 &bitmap, const rectangle &cliprect, uint16_t ma, uint8_t ra, \
 												uint16_t y, uint8_t x_count, int8_t cursor_x, int de, int hbp, int vbp)
 
+#define MC6845_UPDATE_FRAME(name)   void name(bitmap_rgb32 &bitmap, const rectangle &cliprect, const mc6845_device::frame_info &frame)
+
 #define MC6845_END_UPDATE(name)     void name(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 #define MC6845_ON_UPDATE_ADDR_CHANGED(name) void name(int address, int strobe)
@@ -52,10 +54,29 @@ class mc6845_device :   public device_t,
 						public device_video_interface
 {
 public:
+	/* what update_row() would have been told about one scanline */
+	struct scanline_info
+	{
+		uint16_t ma;
+		uint8_t ra;
+		uint16_t y;
+		int8_t cursor_x;
+		uint8_t de;
+	};
+
+	/* the scanlines in the area being updated, in order */
+	struct frame_info
+	{
+		uint8_t x_count;
+		int hbp, vbp;
+		std::vector<scanline_info> lines;
+	};
+
 	typedef device_delegate<void (int width, int height, const rectangle &visarea, attoseconds_t frame_period)> reconfigure_delegate;
 	typedef device_delegate<void (bitmap_rgb32 &bitmap, const rectangle &cliprect)> begin_update_delegate;
 	typedef device_delegate<void (bitmap_rgb32 &bitmap, const rectangle &cliprect, uint16_t ma, uint8_t ra,
 									uint16_t y, uint8_t x_count, int8_t cursor_x, int de, int hbp, int vbp)> update_row_delegate;
+	typedef device_delegate<void (bitmap_rgb32 &bitmap, const rectangle &cliprect, const frame_info &frame)> update_frame_delegate;
 	typedef device_delegate<void (bitmap_rgb32 &bitmap, const rectangle &cliprect)> end_update_delegate;
 	typedef device_delegate<void (int address, int strobe)> on_update_addr_changed_delegate;
 
@@ -75,6 +96,7 @@ public:
 	template <typename... T> void set_reconfigure_callback(T &&... args) { m_reconfigure_cb.set(std::forward<T>(args)...); }
 	template <typename... T> void set_begin_update_callback(T &&... args) { m_begin_update_cb.set(std::forward<T>(args)...); }
 	template <typename... T> void set_update_row_callback(T &&... args) { m_update_row_cb.set(std::forward<T>(args)...); }
+	template <typename... T> void set_update_frame_callback(T &&... args) { m_update_frame_cb.set(std::forward<T>(args)...); }
 	template <typename... T> void set_end_update_callback(T &&... args) { m_end_update_cb.set(std::forward<T>(args)...); }
 	template <typename... T> void set_on_update_addr_change_callback(T &&... args) { m_on_update_addr_changed_cb.set(std::forward<T>(args)...); }
 
@@ -120,8 +142,9 @@ public:
 	void set_hpixels_per_column(int hpixels_per_column);
 
 	/* updates the screen -- this will call begin_update(),
-	   followed by update_row() repeatedly and after all row
-	   updating is complete, end_update() */
+	   followed by update_row() repeatedly, or update_frame()
+	   once, and after all row updating is complete,
+	   end_update() */
 	uint32_t screen_update(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect);
 
 protected:
@@ -272,6 +295,12 @@ protected:
 	 if there is no cursor on this row */
 	update_row_delegate  m_update_row_cb;
 
+	/* if specified instead of update_row, this gets called once per
+	 update with the parameters of every scanline, so the driver can
+	 draw them all in one go */
+	update_frame_delegate m_update_frame_cb;
+	frame_info           m_frame;
+
 	/* if specified, this gets called after all row updating is complete */
 	end_update_delegate  m_end_update_cb;
 
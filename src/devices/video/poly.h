@@ -64,6 +64,7 @@ public:
 	static constexpr uint8_t FLAG_INCLUDE_BOTTOM_EDGE = 0x01;
 	static constexpr uint8_t FLAG_INCLUDE_RIGHT_EDGE  = 0x02;
 	static constexpr uint8_t FLAG_NO_WORK_QUEUE       = 0x04;
+	static constexpr uint8_t FLAG_BINNED              = 0x08;    // hold work until wait(), then draw each bucket on one thread
 
 	// each vertex has an X/Y coordinate and a set of parameters
 	struct vertex_t
@@ -251,7 +252,29 @@ private:
 		return polygon;
 	}
 
+	// add a unit to the end of its bucket
+	void bucket_unit(work_unit &unit, uint32_t bucketnum, uint32_t unit_index)
+	{
+		if (!(m_flags & FLAG_BINNED))
+		{
+			// chain back to the last unit in the bucket so the worker can detect conflicts
+			unit.previtem = m_unit_bucket[bucketnum];
+		}
+		else
+		{
+			// nothing is queued until the bins are flushed, so link forward through the
+			// upper half of count_next exactly as a resolved conflict would
+			unit.previtem = 0xffff;
+			if (m_unit_bucket[bucketnum] == 0xffff)
+				m_bin_head[bucketnum] = unit_index;
+			else
+				m_unit[m_unit_bucket[bucketnum]].count_next |= unit_index << 16;
+		}
+		m_unit_bucket[bucketnum] = unit_index;
+	}
+
 	static void *work_item_callback(void *param, int threadid);
+	void flush_bins();
 	void presave() { wait("pre-save"); }
 
 	// queue management
@@ -269,6 +292,7 @@ private:
 
 	// buckets
 	uint16_t              m_unit_bucket[TOTAL_BUCKETS]; // buckets for tracking unit usage
+	uint16_t              m_bin_head[TOTAL_BUCKETS];    // first unit in each bucket, when binned
 
 	// statistics
 	uint32_t              m_tiles;                    // number of tiles queued
@@ -324,6 +348,7 @@ poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::poly_manager(running_ma
 		m_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
 
 	memset(m_unit_bucket, 0xff, sizeof(m_unit_bucket));
+	memset(m_bin_head, 0xff, sizeof(m_bin_head));
 
 	// request a pre-save callback for synchronization
 	machine.save().register_presave(save_prepost_delegate(FUNC(poly_manager::presave), this));
@@ -430,6 +455,30 @@ void *poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::work_item_callbac
 }
 
 
+//-------------------------------------------------
+//  flush_bins - start one work item per bucket,
+//  each drawing every unit binned there in the
+//  order it was submitted
+//-------------------------------------------------
+
+template<typename BaseType, class ObjectData, int MaxParams, int MaxPolys>
+void poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::flush_bins()
+{
+	for (int bucketnum = 0; bucketnum < TOTAL_BUCKETS; bucketnum++)
+	{
+		if (m_bin_head[bucketnum] == 0xffff)
+			continue;
+
+		work_unit &head = m_unit[m_bin_head[bucketnum]];
+		if (m_queue != nullptr)
+			osd_work_item_queue(m_queue, work_item_callback, &head, WORK_ITEM_FLAG_AUTO_RELEASE);
+		else
+			work_item_callback(&head, 0);
+		m_bin_head[bucketnum] = 0xffff;
+	}
+}
+
+
 //-------------------------------------------------
 //  wait - stall until all work is complete
 //-------------------------------------------------
@@ -443,12 +492,16 @@ void poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::wait(const char *d
 	if (POLY_LOG_WAITS)
 		time = get_profile_ticks();
 
+	// binned work has not been started yet
+	if (m_flags & FLAG_BINNED)
+		flush_bins();
+
 	// wait for all pending work items to complete
 	if (m_queue != nullptr)
 		osd_work_queue_wait(m_queue, osd_ticks_per_second() * 100);
 
 	// if we don't have a queue, just run the whole list now
-	else
+	else if (!(m_flags & FLAG_BINNED))
 		for (int unitnum = 0; unitnum < m_unit.count(); unitnum++)
 			work_item_callback(&m_unit[unitnum], 0);
 
@@ -464,6 +517,7 @@ void poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::wait(const char *d
 	m_polygon.reset();
 	m_unit.reset();
 	memset(m_unit_bucket, 0xff, sizeof(m_unit_bucket));
+	memset(m_bin_head, 0xff, sizeof(m_bin_head));
 
 	// we need to preserve the last object data that was supplied
 	if (m_object.count() > 0)
@@ -584,8 +638,7 @@ uint32_t poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::render_tile(co
 		unit.polygon = &polygon;
 		unit.count_next = std::min(v2yclip - curscan, scaninc);
 		unit.scanline = curscan;
-		unit.previtem = m_unit_bucket[bucketnum];
-		m_unit_bucket[bucketnum] = unit_index;
+		bucket_unit(unit, bucketnum, unit_index);
 
 		// iterate over extents
 		for (int extnum = 0; extnum < unit.count_next; extnum++)
@@ -611,7 +664,7 @@ uint32_t poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::render_tile(co
 	}
 
 	// enqueue the work items
-	if (m_queue != nullptr)
+	if (m_queue != nullptr && !(m_flags & FLAG_BINNED))
 		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
 
 	// return the total number of pixels in the triangle
@@ -742,8 +795,7 @@ uint32_t poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::render_triangl
 		unit.polygon = &polygon;
 		unit.count_next = std::min(v3yclip - curscan, scaninc);
 		unit.scanline = curscan;
-		unit.previtem = m_unit_bucket[bucketnum];
-		m_unit_bucket[bucketnum] = unit_index;
+		bucket_unit(unit, bucketnum, unit_index);
 
 		// iterate over extents
 		for (int extnum = 0; extnum < unit.count_next; extnum++)
@@ -799,7 +851,7 @@ uint32_t poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::render_triangl
 	}
 
 	// enqueue the work items
-	if (m_queue != nullptr)
+	if (m_queue != nullptr && !(m_flags & FLAG_BINNED))
 		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
 
 	// return the total number of pixels in the triangle
@@ -875,8 +927,7 @@ uint32_t poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::render_triangl
 		unit.polygon = &polygon;
 		unit.count_next = std::min(v3yclip - curscan, scaninc);
 		unit.scanline = curscan;
-		unit.previtem = m_unit_bucket[bucketnum];
-		m_unit_bucket[bucketnum] = unit_index;
+		bucket_unit(unit, bucketnum, unit_index);
 
 		// iterate over extents
 		for (int extnum = 0; extnum < unit.count_next; extnum++)
@@ -915,7 +966,7 @@ uint32_t poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::render_triangl
 	}
 
 	// enqueue the work items
-	if (m_queue != nullptr)
+	if (m_queue != nullptr && !(m_flags & FLAG_BINNED))
 		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
 
 	// return the total number of pixels in the object
@@ -1050,8 +1101,7 @@ uint32_t poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::render_polygon
 		unit.polygon = &polygon;
 		unit.count_next = std::min(maxyclip - curscan, scaninc);
 		unit.scanline = curscan;
-		unit.previtem = m_unit_bucket[bucketnum];
-		m_unit_bucket[bucketnum] = unit_index;
+		bucket_unit(unit, bucketnum, unit_index);
 
 		// iterate over extents
 		for (int extnum = 0; extnum < unit.count_next; extnum++)
@@ -1114,7 +1164,7 @@ uint32_t poly_manager<BaseType, ObjectData, MaxParams, MaxPolys>::render_polygon
 	}
 
 	// enqueue the work items
-	if (m_queue != nullptr)
+	if (m_queue != nullptr && !(m_flags & FLAG_BINNED))
 		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
 
 	// return the total number of pixels in the triangle
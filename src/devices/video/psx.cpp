@@ -64,6 +64,29 @@ void psxgpu_device::device_start()
 	{
 		psx_gpu_init( 2 );
 	}
+
+	m_render_queue = nullptr;
+	m_batch = 0;
+	m_dirty.set( 0, -1, 0, -1 );
+#if PSXGPU_THREADED && !PSXGPU_DEBUG_VIEWER
+	m_render_queue = osd_work_queue_alloc( 0 );
+	machine().save().register_preload( save_prepost_delegate( FUNC( psxgpu_device::sync_render ), this ) );
+#endif
+}
+
+void psxgpu_device::device_stop()
+{
+	if( m_render_queue != nullptr )
+	{
+		sync_render();
+		osd_work_queue_free( m_render_queue );
+		m_render_queue = nullptr;
+	}
+}
+
+void psxgpu_device::device_pre_save()
+{
+	sync_render();
 }
 
 void psxgpu_device::device_reset()
@@ -649,6 +672,12 @@ void psxgpu_device::psx_gpu_init( int n_gputype )
 
 void psxgpu_device::device_post_load()
 {
+	m_cpu_drawarea_x1 = n_drawarea_x1;
+	m_cpu_drawarea_y1 = n_drawarea_y1;
+	m_cpu_drawarea_x2 = n_drawarea_x2;
+	m_cpu_drawarea_y2 = n_drawarea_y2;
+	m_cpu_drawoffset_x = n_drawoffset_x;
+	m_cpu_drawoffset_y = n_drawoffset_y;
 	updatevisiblearea();
 }
 
@@ -684,6 +713,17 @@ uint32_t psxgpu_device::update_screen(screen_device &screen, bitmap_rgb32 &bitma
 	}
 	else
 	{
+		// only wait for the renderer if it may still be drawing into the area being shown
+		if( b_reverseflag )
+		{
+			sync_dirty( vram_area( 0, n_displaystarty, 1024, n_screenheight ) );
+		}
+		else
+		{
+			int const n_vramcolumns = ( ( n_gpustatus & ( 1 << 0x15 ) ) != 0 ) ? n_screenwidth * 3 : n_screenwidth;
+			sync_dirty( vram_area( m_n_displaystartx, n_displaystarty, n_vramcolumns, n_screenheight ) );
+		}
+
 		if( b_reverseflag )
 		{
 			n_displaystartx = ( 1023 - m_n_displaystartx );
@@ -835,8 +875,6 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 {
 	if( m_n_gputype == 2 )
 	{
-		n_gpustatus = ( n_gpustatus & 0xffff7800 ) | ( tpage & 0x7ff ) | ( ( tpage & 0x800 ) << 4 );
-
 		m_n_tx = ( tpage & 0x0f ) << 6;
 		m_n_ty = ( ( tpage & 0x10 ) << 4 ) | ( ( tpage & 0x800 ) >> 2 );
 		n_abr = ( tpage & 0x60 ) >> 5;
@@ -844,11 +882,31 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 		n_ix = ( tpage & 0x1000 ) >> 12;
 		n_iy = ( tpage & 0x2000 ) >> 13;
 		n_ti = 0;
+	}
+	else
+	{
+		m_n_tx = ( tpage & 0x0f ) << 6;
+		m_n_ty = ( ( tpage & 0x60 ) << 3 );
+		n_abr = ( tpage & 0x180 ) >> 7;
+		n_tp = ( tpage & 0x600 ) >> 9;
+		n_ti = ( tpage & 0x2000 ) >> 13;
+		n_ix = 0;
+		n_iy = 0;
+	}
+}
+
+/* the status register and logging half of decode_tpage, done when the packet arrives rather than when it is drawn */
+void psxgpu_device::decode_tpage_status( uint32_t tpage )
+{
+	if( m_n_gputype == 2 )
+	{
+		n_gpustatus = ( n_gpustatus & 0xffff7800 ) | ( tpage & 0x7ff ) | ( ( tpage & 0x800 ) << 4 );
+
 		if( ( tpage & ~0x39ff ) != 0 )
 		{
 			verboselog( *this, 1, "not handled: draw mode %08x\n", tpage & ~0x39ff );
 		}
-		if( n_tp == 3 )
+		if( ( ( tpage & 0x180 ) >> 7 ) == 3 )
 		{
 			verboselog( *this, 0, "not handled: tp == 3\n" );
 		}
@@ -858,22 +916,15 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 		// TODO: confirm status bits on real type 1 gpu
 		n_gpustatus = ( n_gpustatus & 0xffffe000 ) | ( tpage & 0x1fff );
 
-		m_n_tx = ( tpage & 0x0f ) << 6;
-		m_n_ty = ( ( tpage & 0x60 ) << 3 );
-		n_abr = ( tpage & 0x180 ) >> 7;
-		n_tp = ( tpage & 0x600 ) >> 9;
-		n_ti = ( tpage & 0x2000 ) >> 13;
-		n_ix = 0;
-		n_iy = 0;
 		if( ( tpage & ~0x27ef ) != 0 )
 		{
 			verboselog( *this, 1, "not handled: draw mode %08x\n", tpage & ~0x27ef );
 		}
-		if( n_tp == 3 )
+		if( ( ( tpage & 0x600 ) >> 9 ) == 3 )
 		{
 			verboselog( *this, 0, "not handled: tp == 3\n" );
 		}
-		else if( n_tp == 2 && n_ti != 0 )
+		else if( ( ( tpage & 0x600 ) >> 9 ) == 2 && ( tpage & 0x2000 ) != 0 )
 		{
 			verboselog( *this, 0, "not handled: interleaved 15 bit texture\n" );
 		}
@@ -1356,8 +1407,8 @@ static inline int CullVertex( int a, int b )
 
 #define CULLPOINT( PacketType, p1, p2 ) \
 ( \
-	CullVertex( COORD_Y( m_packet.PacketType.vertex[ p1 ].n_coord ), COORD_Y( m_packet.PacketType.vertex[ p2 ].n_coord ) ) || \
-	CullVertex( COORD_X( m_packet.PacketType.vertex[ p1 ].n_coord ), COORD_X( m_packet.PacketType.vertex[ p2 ].n_coord ) ) \
+	CullVertex( COORD_Y( m_draw_packet.PacketType.vertex[ p1 ].n_coord ), COORD_Y( m_draw_packet.PacketType.vertex[ p2 ].n_coord ) ) || \
+	CullVertex( COORD_X( m_draw_packet.PacketType.vertex[ p1 ].n_coord ), COORD_X( m_draw_packet.PacketType.vertex[ p2 ].n_coord ) ) \
 )
 
 #define CULLTRIANGLE( PacketType, start ) \
@@ -1368,7 +1419,7 @@ static inline int CullVertex( int a, int b )
 #define FINDTOPLEFT( PacketType ) \
 	for( int n_point = 0; n_point < n_points; n_point++ ) \
 	{ \
-		GET_COORD( m_packet.PacketType.vertex[ n_point ].n_coord ); \
+		GET_COORD( m_draw_packet.PacketType.vertex[ n_point ].n_coord ); \
 	} \
 	\
 	const int *p_n_rightpointlist; \
@@ -1411,9 +1462,9 @@ static inline int CullVertex( int a, int b )
 	\
 	for( int n_point = n_leftpoint + 1; n_point < n_points; n_point++ ) \
 	{ \
-		if( COORD_Y( m_packet.PacketType.vertex[ n_point ].n_coord ) < COORD_Y( m_packet.PacketType.vertex[ n_leftpoint ].n_coord ) || \
-			( COORD_Y( m_packet.PacketType.vertex[ n_point ].n_coord ) == COORD_Y( m_packet.PacketType.vertex[ n_leftpoint ].n_coord ) && \
-			COORD_X( m_packet.PacketType.vertex[ n_point ].n_coord ) < COORD_X( m_packet.PacketType.vertex[ n_leftpoint ].n_coord ) ) ) \
+		if( COORD_Y( m_draw_packet.PacketType.vertex[ n_point ].n_coord ) < COORD_Y( m_draw_packet.PacketType.vertex[ n_leftpoint ].n_coord ) || \
+			( COORD_Y( m_draw_packet.PacketType.vertex[ n_point ].n_coord ) == COORD_Y( m_draw_packet.PacketType.vertex[ n_leftpoint ].n_coord ) && \
+			COORD_X( m_draw_packet.PacketType.vertex[ n_point ].n_coord ) < COORD_X( m_draw_packet.PacketType.vertex[ n_leftpoint ].n_coord ) ) ) \
 		{ \
 			n_leftpoint = n_point; \
 		} \
@@ -1429,34 +1480,34 @@ void psxgpu_device::FlatPolygon( int n_points )
 	}
 	for( int n_point = 0; n_point < n_points; n_point++ )
 	{
-		DebugMesh( SINT11( COORD_X( m_packet.FlatPolygon.vertex[ n_point ].n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_packet.FlatPolygon.vertex[ n_point ].n_coord ) ) + n_drawoffset_y );
+		DebugMesh( SINT11( COORD_X( m_draw_packet.FlatPolygon.vertex[ n_point ].n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_draw_packet.FlatPolygon.vertex[ n_point ].n_coord ) ) + n_drawoffset_y );
 	}
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.FlatPolygon.n_bgr );
+	uint8_t n_cmd = BGR_C( m_draw_packet.FlatPolygon.n_bgr );
 
 	PAIR n_cx1; n_cx1.d = 0;
 	PAIR n_cx2; n_cx2.d = 0;
 
 	SOLIDSETUP
 
-	PAIR n_r; n_r.w.h = BGR_R( m_packet.FlatPolygon.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = BGR_G( m_packet.FlatPolygon.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = BGR_B( m_packet.FlatPolygon.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = BGR_R( m_draw_packet.FlatPolygon.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = BGR_G( m_draw_packet.FlatPolygon.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = BGR_B( m_draw_packet.FlatPolygon.n_bgr ); n_b.w.l = 0;
 
 	FINDTOPLEFT( FlatPolygon )
 
 	int32_t n_dx1 = 0;
 	int32_t n_dx2 = 0;
 
-	int16_t n_y = COORD_Y( m_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord );
+	int16_t n_y = COORD_Y( m_draw_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord );
 
 	for( ;; )
 	{
-		if( n_y == COORD_Y( m_packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ) )
+		if( n_y == COORD_Y( m_draw_packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.FlatPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( m_draw_packet.FlatPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
 			{
 				n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 				if( n_leftpoint == n_rightpoint )
@@ -1465,21 +1516,21 @@ void psxgpu_device::FlatPolygon( int n_points )
 				}
 			}
 
-			n_cx1.sw.h = COORD_X( m_packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
+			n_cx1.sw.h = COORD_X( m_draw_packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
 			n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( m_draw_packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx1 = (int32_t)( ( COORD_X( m_packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
+			n_dx1 = (int32_t)( ( COORD_X( m_draw_packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
 		}
 
-		if( n_y == COORD_Y( m_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ) )
+		if( n_y == COORD_Y( m_draw_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.FlatPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( m_draw_packet.FlatPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
 			{
 				n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 				if( n_rightpoint == n_leftpoint )
@@ -1488,16 +1539,16 @@ void psxgpu_device::FlatPolygon( int n_points )
 				}
 			}
 
-			n_cx2.sw.h = COORD_X( m_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
+			n_cx2.sw.h = COORD_X( m_draw_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
 			n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( m_draw_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx2 = (int32_t)( ( COORD_X( m_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
+			n_dx2 = (int32_t)( ( COORD_X( m_draw_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
 		}
 
 		int drawy = n_y + n_drawoffset_y;
@@ -1544,15 +1595,15 @@ void psxgpu_device::FlatTexturedPolygon( int n_points )
 	}
 	for( int n_point = 0; n_point < n_points; n_point++ )
 	{
-		DebugMesh( SINT11( COORD_X( m_packet.FlatTexturedPolygon.vertex[ n_point ].n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_packet.FlatTexturedPolygon.vertex[ n_point ].n_coord ) ) + n_drawoffset_y );
+		DebugMesh( SINT11( COORD_X( m_draw_packet.FlatTexturedPolygon.vertex[ n_point ].n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_draw_packet.FlatTexturedPolygon.vertex[ n_point ].n_coord ) ) + n_drawoffset_y );
 	}
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.FlatTexturedPolygon.n_bgr );
+	uint8_t n_cmd = BGR_C( m_draw_packet.FlatTexturedPolygon.n_bgr );
 
-	uint32_t n_clutx = ( m_packet.FlatTexturedPolygon.vertex[ 0 ].n_texture.w.h & 0x3f ) << 4;
-	uint32_t n_cluty = ( m_packet.FlatTexturedPolygon.vertex[ 0 ].n_texture.w.h >> 6 ) & 0x3ff;
+	uint32_t n_clutx = ( m_draw_packet.FlatTexturedPolygon.vertex[ 0 ].n_texture.w.h & 0x3f ) << 4;
+	uint32_t n_cluty = ( m_draw_packet.FlatTexturedPolygon.vertex[ 0 ].n_texture.w.h >> 6 ) & 0x3ff;
 
 	PAIR n_cx1; n_cx1.d = 0;
 	PAIR n_cu1; n_cu1.d = 0;
@@ -1561,12 +1612,12 @@ void psxgpu_device::FlatTexturedPolygon( int n_points )
 	PAIR n_cu2; n_cu2.d = 0;
 	PAIR n_cv2; n_cv2.d = 0;
 
-	decode_tpage( m_packet.FlatTexturedPolygon.vertex[ 1 ].n_texture.w.h );
+	decode_tpage( m_draw_packet.FlatTexturedPolygon.vertex[ 1 ].n_texture.w.h );
 	TEXTURESETUP
 
-	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_packet.FlatTexturedPolygon.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_packet.FlatTexturedPolygon.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_packet.FlatTexturedPolygon.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_draw_packet.FlatTexturedPolygon.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_draw_packet.FlatTexturedPolygon.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_draw_packet.FlatTexturedPolygon.n_bgr ); n_b.w.l = 0;
 
 	FINDTOPLEFT( FlatTexturedPolygon )
 
@@ -1577,13 +1628,13 @@ void psxgpu_device::FlatTexturedPolygon( int n_points )
 	int32_t n_dv1 = 0;
 	int32_t n_dv2 = 0;
 
-	int16_t n_y = COORD_Y( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord );
+	int16_t n_y = COORD_Y( m_draw_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord );
 
 	for( ;; )
 	{
-		if( n_y == COORD_Y( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ) )
+		if( n_y == COORD_Y( m_draw_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.FlatTexturedPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( m_draw_packet.FlatTexturedPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
 			{
 				n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 				if( n_leftpoint == n_rightpoint )
@@ -1592,25 +1643,25 @@ void psxgpu_device::FlatTexturedPolygon( int n_points )
 				}
 			}
 
-			n_cx1.sw.h = COORD_X( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
-			n_cu1.w.h = TEXTURE_U( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cu1.w.l = 0;
-			n_cv1.w.h = TEXTURE_V( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cv1.w.l = 0;
+			n_cx1.sw.h = COORD_X( m_draw_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
+			n_cu1.w.h = TEXTURE_U( m_draw_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cu1.w.l = 0;
+			n_cv1.w.h = TEXTURE_V( m_draw_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cv1.w.l = 0;
 			n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( m_draw_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx1 = (int32_t)( ( COORD_X( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
-			n_du1 = (int32_t)( ( TEXTURE_U( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cu1.d ) / n_distance;
-			n_dv1 = (int32_t)( ( TEXTURE_V( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cv1.d ) / n_distance;
+			n_dx1 = (int32_t)( ( COORD_X( m_draw_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
+			n_du1 = (int32_t)( ( TEXTURE_U( m_draw_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cu1.d ) / n_distance;
+			n_dv1 = (int32_t)( ( TEXTURE_V( m_draw_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cv1.d ) / n_distance;
 		}
 
-		if( n_y == COORD_Y( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ) )
+		if( n_y == COORD_Y( m_draw_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.FlatTexturedPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( m_draw_packet.FlatTexturedPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
 			{
 				n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 				if( n_rightpoint == n_leftpoint )
@@ -1619,20 +1670,20 @@ void psxgpu_device::FlatTexturedPolygon( int n_points )
 				}
 			}
 
-			n_cx2.sw.h = COORD_X( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
-			n_cu2.w.h = TEXTURE_U( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cu2.w.l = 0;
-			n_cv2.w.h = TEXTURE_V( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cv2.w.l = 0;
+			n_cx2.sw.h = COORD_X( m_draw_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
+			n_cu2.w.h = TEXTURE_U( m_draw_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cu2.w.l = 0;
+			n_cv2.w.h = TEXTURE_V( m_draw_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cv2.w.l = 0;
 			n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( m_draw_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx2 = (int32_t)( ( COORD_X( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
-			n_du2 = (int32_t)( ( TEXTURE_U( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cu2.d ) / n_distance;
-			n_dv2 = (int32_t)( ( TEXTURE_V( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cv2.d ) / n_distance;
+			n_dx2 = (int32_t)( ( COORD_X( m_draw_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
+			n_du2 = (int32_t)( ( TEXTURE_U( m_draw_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cu2.d ) / n_distance;
+			n_dv2 = (int32_t)( ( TEXTURE_V( m_draw_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cv2.d ) / n_distance;
 		}
 
 		int drawy = n_y + n_drawoffset_y;
@@ -1699,12 +1750,12 @@ void psxgpu_device::GouraudPolygon( int n_points )
 	}
 	for( int n_point = 0; n_point < n_points; n_point++ )
 	{
-		DebugMesh( SINT11( COORD_X( m_packet.GouraudPolygon.vertex[ n_point ].n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_packet.GouraudPolygon.vertex[ n_point ].n_coord ) ) + n_drawoffset_y );
+		DebugMesh( SINT11( COORD_X( m_draw_packet.GouraudPolygon.vertex[ n_point ].n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_draw_packet.GouraudPolygon.vertex[ n_point ].n_coord ) ) + n_drawoffset_y );
 	}
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.GouraudPolygon.vertex[ 0 ].n_bgr );
+	uint8_t n_cmd = BGR_C( m_draw_packet.GouraudPolygon.vertex[ 0 ].n_bgr );
 
 	PAIR n_cx1; n_cx1.d = 0;
 	PAIR n_cr1; n_cr1.d = 0;
@@ -1728,13 +1779,13 @@ void psxgpu_device::GouraudPolygon( int n_points )
 	int32_t n_db1 = 0;
 	int32_t n_db2 = 0;
 
-	int16_t n_y = COORD_Y( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord );
+	int16_t n_y = COORD_Y( m_draw_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord );
 
 	for( ;; )
 	{
-		if( n_y == COORD_Y( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ) )
+		if( n_y == COORD_Y( m_draw_packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.GouraudPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( m_draw_packet.GouraudPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
 			{
 				n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 				if( n_leftpoint == n_rightpoint )
@@ -1743,27 +1794,27 @@ void psxgpu_device::GouraudPolygon( int n_points )
 				}
 			}
 
-			n_cx1.sw.h = COORD_X( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
-			n_cr1.w.h = BGR_R( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ); n_cr1.w.l = 0;
-			n_cg1.w.h = BGR_G( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ); n_cg1.w.l = 0;
-			n_cb1.w.h = BGR_B( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ); n_cb1.w.l = 0;
+			n_cx1.sw.h = COORD_X( m_draw_packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
+			n_cr1.w.h = BGR_R( m_draw_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ); n_cr1.w.l = 0;
+			n_cg1.w.h = BGR_G( m_draw_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ); n_cg1.w.l = 0;
+			n_cb1.w.h = BGR_B( m_draw_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ); n_cb1.w.l = 0;
 			n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( m_draw_packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx1 = (int32_t)( ( COORD_X( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
-			n_dr1 = (int32_t)( ( BGR_R( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cr1.d ) / n_distance;
-			n_dg1 = (int32_t)( ( BGR_G( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cg1.d ) / n_distance;
-			n_db1 = (int32_t)( ( BGR_B( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cb1.d ) / n_distance;
+			n_dx1 = (int32_t)( ( COORD_X( m_draw_packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
+			n_dr1 = (int32_t)( ( BGR_R( m_draw_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cr1.d ) / n_distance;
+			n_dg1 = (int32_t)( ( BGR_G( m_draw_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cg1.d ) / n_distance;
+			n_db1 = (int32_t)( ( BGR_B( m_draw_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cb1.d ) / n_distance;
 		}
 
-		if( n_y == COORD_Y( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ) )
+		if( n_y == COORD_Y( m_draw_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.GouraudPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( m_draw_packet.GouraudPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
 			{
 				n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 				if( n_rightpoint == n_leftpoint )
@@ -1772,22 +1823,22 @@ void psxgpu_device::GouraudPolygon( int n_points )
 				}
 			}
 
-			n_cx2.sw.h = COORD_X( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
-			n_cr2.w.h = BGR_R( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ); n_cr2.w.l = 0;
-			n_cg2.w.h = BGR_G( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ); n_cg2.w.l = 0;
-			n_cb2.w.h = BGR_B( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ); n_cb2.w.l = 0;
+			n_cx2.sw.h = COORD_X( m_draw_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
+			n_cr2.w.h = BGR_R( m_draw_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ); n_cr2.w.l = 0;
+			n_cg2.w.h = BGR_G( m_draw_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ); n_cg2.w.l = 0;
+			n_cb2.w.h = BGR_B( m_draw_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ); n_cb2.w.l = 0;
 			n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( m_draw_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx2 = (int32_t)( ( COORD_X( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
-			n_dr2 = (int32_t)( ( BGR_R( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cr2.d ) / n_distance;
-			n_dg2 = (int32_t)( ( BGR_G( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cg2.d ) / n_distance;
-			n_db2 = (int32_t)( ( BGR_B( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cb2.d ) / n_distance;
+			n_dx2 = (int32_t)( ( COORD_X( m_draw_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
+			n_dr2 = (int32_t)( ( BGR_R( m_draw_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cr2.d ) / n_distance;
+			n_dg2 = (int32_t)( ( BGR_G( m_draw_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cg2.d ) / n_distance;
+			n_db2 = (int32_t)( ( BGR_B( m_draw_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cb2.d ) / n_distance;
 		}
 
 		int drawy = n_y + n_drawoffset_y;
@@ -1863,15 +1914,15 @@ void psxgpu_device::GouraudTexturedPolygon( int n_points )
 	}
 	for( int n_point = 0; n_point < n_points; n_point++ )
 	{
-		DebugMesh( SINT11( COORD_X( m_packet.GouraudTexturedPolygon.vertex[ n_point ].n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ n_point ].n_coord ) ) + n_drawoffset_y );
+		DebugMesh( SINT11( COORD_X( m_draw_packet.GouraudTexturedPolygon.vertex[ n_point ].n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_draw_packet.GouraudTexturedPolygon.vertex[ n_point ].n_coord ) ) + n_drawoffset_y );
 	}
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.GouraudTexturedPolygon.vertex[ 0 ].n_bgr );
+	uint8_t n_cmd = BGR_C( m_draw_packet.GouraudTexturedPolygon.vertex[ 0 ].n_bgr );
 
-	uint32_t n_clutx = ( m_packet.GouraudTexturedPolygon.vertex[ 0 ].n_texture.w.h & 0x3f ) << 4;
-	uint32_t n_cluty = ( m_packet.GouraudTexturedPolygon.vertex[ 0 ].n_texture.w.h >> 6 ) & 0x3ff;
+	uint32_t n_clutx = ( m_draw_packet.GouraudTexturedPolygon.vertex[ 0 ].n_texture.w.h & 0x3f ) << 4;
+	uint32_t n_cluty = ( m_draw_packet.GouraudTexturedPolygon.vertex[ 0 ].n_texture.w.h >> 6 ) & 0x3ff;
 
 	PAIR n_cx1; n_cx1.d = 0;
 	PAIR n_cr1; n_cr1.d = 0;
@@ -1886,7 +1937,7 @@ void psxgpu_device::GouraudTexturedPolygon( int n_points )
 	PAIR n_cu2; n_cu2.d = 0;
 	PAIR n_cv2; n_cv2.d = 0;
 
-	decode_tpage( m_packet.GouraudTexturedPolygon.vertex[ 1 ].n_texture.w.h );
+	decode_tpage( m_draw_packet.GouraudTexturedPolygon.vertex[ 1 ].n_texture.w.h );
 	TEXTURESETUP
 
 	FINDTOPLEFT( GouraudTexturedPolygon )
@@ -1904,13 +1955,13 @@ void psxgpu_device::GouraudTexturedPolygon( int n_points )
 	int32_t n_dv1 = 0;
 	int32_t n_dv2 = 0;
 
-	int16_t n_y = COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord );
+	int16_t n_y = COORD_Y( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord );
 
 	for( ;; )
 	{
-		if( n_y == COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ) )
+		if( n_y == COORD_Y( m_draw_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( m_draw_packet.GouraudTexturedPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
 			{
 				n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 				if( n_leftpoint == n_rightpoint )
@@ -1919,31 +1970,31 @@ void psxgpu_device::GouraudTexturedPolygon( int n_points )
 				}
 			}
 
-			n_cx1.sw.h = COORD_X( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
-			n_cr1.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ); n_cr1.w.l = 0;
-			n_cg1.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ); n_cg1.w.l = 0;
-			n_cb1.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ); n_cb1.w.l = 0;
-			n_cu1.w.h = TEXTURE_U( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cu1.w.l = 0;
-			n_cv1.w.h = TEXTURE_V( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cv1.w.l = 0;
+			n_cx1.sw.h = COORD_X( m_draw_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
+			n_cr1.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_draw_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ); n_cr1.w.l = 0;
+			n_cg1.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_draw_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ); n_cg1.w.l = 0;
+			n_cb1.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_draw_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ); n_cb1.w.l = 0;
+			n_cu1.w.h = TEXTURE_U( m_draw_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cu1.w.l = 0;
+			n_cv1.w.h = TEXTURE_V( m_draw_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cv1.w.l = 0;
 			n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( m_draw_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx1 = (int32_t)( ( COORD_X( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
-			n_dr1 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_R( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cr1.d ) / n_distance;
-			n_dg1 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_G( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cg1.d ) / n_distance;
-			n_db1 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_B( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cb1.d ) / n_distance;
-			n_du1 = (int32_t)( ( TEXTURE_U( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cu1.d ) / n_distance;
-			n_dv1 = (int32_t)( ( TEXTURE_V( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cv1.d ) / n_distance;
+			n_dx1 = (int32_t)( ( COORD_X( m_draw_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
+			n_dr1 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_R( m_draw_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cr1.d ) / n_distance;
+			n_dg1 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_G( m_draw_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cg1.d ) / n_distance;
+			n_db1 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_B( m_draw_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cb1.d ) / n_distance;
+			n_du1 = (int32_t)( ( TEXTURE_U( m_draw_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cu1.d ) / n_distance;
+			n_dv1 = (int32_t)( ( TEXTURE_V( m_draw_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cv1.d ) / n_distance;
 		}
 
-		if( n_y == COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ) )
+		if( n_y == COORD_Y( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( m_draw_packet.GouraudTexturedPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
 			{
 				n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 				if( n_rightpoint == n_leftpoint )
@@ -1952,26 +2003,26 @@ void psxgpu_device::GouraudTexturedPolygon( int n_points )
 				}
 			}
 
-			n_cx2.sw.h = COORD_X( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
-			n_cr2.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ); n_cr2.w.l = 0;
-			n_cg2.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ); n_cg2.w.l = 0;
-			n_cb2.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ); n_cb2.w.l = 0;
-			n_cu2.w.h = TEXTURE_U( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cu2.w.l = 0;
-			n_cv2.w.h = TEXTURE_V( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cv2.w.l = 0;
+			n_cx2.sw.h = COORD_X( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
+			n_cr2.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ); n_cr2.w.l = 0;
+			n_cg2.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ); n_cg2.w.l = 0;
+			n_cb2.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ); n_cb2.w.l = 0;
+			n_cu2.w.h = TEXTURE_U( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cu2.w.l = 0;
+			n_cv2.w.h = TEXTURE_V( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cv2.w.l = 0;
 			n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx2 = (int32_t)( ( COORD_X( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
-			n_dr2 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_R( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cr2.d ) / n_distance;
-			n_dg2 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_G( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cg2.d ) / n_distance;
-			n_db2 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_B( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cb2.d ) / n_distance;
-			n_du2 = (int32_t)( ( TEXTURE_U( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cu2.d ) / n_distance;
-			n_dv2 = (int32_t)( ( TEXTURE_V( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cv2.d ) / n_distance;
+			n_dx2 = (int32_t)( ( COORD_X( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
+			n_dr2 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_R( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cr2.d ) / n_distance;
+			n_dg2 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_G( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cg2.d ) / n_distance;
+			n_db2 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_B( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cb2.d ) / n_distance;
+			n_du2 = (int32_t)( ( TEXTURE_U( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cu2.d ) / n_distance;
+			n_dv2 = (int32_t)( ( TEXTURE_V( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cv2.d ) / n_distance;
 		}
 
 		int drawy = n_y + n_drawoffset_y;
@@ -2063,20 +2114,20 @@ void psxgpu_device::MonochromeLine()
 	{
 		return;
 	}
-	DebugMesh( SINT11( COORD_X( m_packet.MonochromeLine.vertex[ 0 ].n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_packet.MonochromeLine.vertex[ 0 ].n_coord ) ) + n_drawoffset_y );
-	DebugMesh( SINT11( COORD_X( m_packet.MonochromeLine.vertex[ 1 ].n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_packet.MonochromeLine.vertex[ 1 ].n_coord ) ) + n_drawoffset_y );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.MonochromeLine.vertex[ 0 ].n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_draw_packet.MonochromeLine.vertex[ 0 ].n_coord ) ) + n_drawoffset_y );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.MonochromeLine.vertex[ 1 ].n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_draw_packet.MonochromeLine.vertex[ 1 ].n_coord ) ) + n_drawoffset_y );
 	DebugMeshEnd();
 #endif
 
-	int32_t n_xstart = SINT11( COORD_X( m_packet.MonochromeLine.vertex[ 0 ].n_coord ) );
-	int32_t n_xend = SINT11( COORD_X( m_packet.MonochromeLine.vertex[ 1 ].n_coord ) );
-	int32_t n_ystart = SINT11( COORD_Y( m_packet.MonochromeLine.vertex[ 0 ].n_coord ) );
-	int32_t n_yend = SINT11( COORD_Y( m_packet.MonochromeLine.vertex[ 1 ].n_coord ) );
+	int32_t n_xstart = SINT11( COORD_X( m_draw_packet.MonochromeLine.vertex[ 0 ].n_coord ) );
+	int32_t n_xend = SINT11( COORD_X( m_draw_packet.MonochromeLine.vertex[ 1 ].n_coord ) );
+	int32_t n_ystart = SINT11( COORD_Y( m_draw_packet.MonochromeLine.vertex[ 0 ].n_coord ) );
+	int32_t n_yend = SINT11( COORD_Y( m_draw_packet.MonochromeLine.vertex[ 1 ].n_coord ) );
 
-	uint8_t n_cmd = BGR_C( m_packet.MonochromeLine.n_bgr );
-	uint8_t n_r = BGR_R( m_packet.MonochromeLine.n_bgr );
-	uint8_t n_g = BGR_G( m_packet.MonochromeLine.n_bgr );
-	uint8_t n_b = BGR_B( m_packet.MonochromeLine.n_bgr );
+	uint8_t n_cmd = BGR_C( m_draw_packet.MonochromeLine.n_bgr );
+	uint8_t n_r = BGR_R( m_draw_packet.MonochromeLine.n_bgr );
+	uint8_t n_g = BGR_G( m_draw_packet.MonochromeLine.n_bgr );
+	uint8_t n_b = BGR_B( m_draw_packet.MonochromeLine.n_bgr );
 
 	TRANSPARENCYSETUP
 
@@ -2163,26 +2214,26 @@ void psxgpu_device::GouraudLine()
 	{
 		return;
 	}
-	DebugMesh( SINT11( COORD_X( m_packet.GouraudLine.vertex[ 0 ].n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_packet.GouraudLine.vertex[ 0 ].n_coord ) ) + n_drawoffset_y );
-	DebugMesh( SINT11( COORD_X( m_packet.GouraudLine.vertex[ 1 ].n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_packet.GouraudLine.vertex[ 1 ].n_coord ) ) + n_drawoffset_y );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.GouraudLine.vertex[ 0 ].n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_draw_packet.GouraudLine.vertex[ 0 ].n_coord ) ) + n_drawoffset_y );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.GouraudLine.vertex[ 1 ].n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_draw_packet.GouraudLine.vertex[ 1 ].n_coord ) ) + n_drawoffset_y );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.GouraudLine.vertex[ 0 ].n_bgr );
+	uint8_t n_cmd = BGR_C( m_draw_packet.GouraudLine.vertex[ 0 ].n_bgr );
 
 	TRANSPARENCYSETUP
 
-	int32_t n_xstart = SINT11( COORD_X( m_packet.GouraudLine.vertex[ 0 ].n_coord ) );
-	int32_t n_ystart = SINT11( COORD_Y( m_packet.GouraudLine.vertex[ 0 ].n_coord ) );
-	PAIR n_cr1; n_cr1.w.h = BGR_R( m_packet.GouraudLine.vertex[ 0 ].n_bgr ); n_cr1.w.l = 0;
-	PAIR n_cg1; n_cg1.w.h = BGR_G( m_packet.GouraudLine.vertex[ 0 ].n_bgr ); n_cg1.w.l = 0;
-	PAIR n_cb1; n_cb1.w.h = BGR_B( m_packet.GouraudLine.vertex[ 0 ].n_bgr ); n_cb1.w.l = 0;
+	int32_t n_xstart = SINT11( COORD_X( m_draw_packet.GouraudLine.vertex[ 0 ].n_coord ) );
+	int32_t n_ystart = SINT11( COORD_Y( m_draw_packet.GouraudLine.vertex[ 0 ].n_coord ) );
+	PAIR n_cr1; n_cr1.w.h = BGR_R( m_draw_packet.GouraudLine.vertex[ 0 ].n_bgr ); n_cr1.w.l = 0;
+	PAIR n_cg1; n_cg1.w.h = BGR_G( m_draw_packet.GouraudLine.vertex[ 0 ].n_bgr ); n_cg1.w.l = 0;
+	PAIR n_cb1; n_cb1.w.h = BGR_B( m_draw_packet.GouraudLine.vertex[ 0 ].n_bgr ); n_cb1.w.l = 0;
 
-	int32_t n_xend = SINT11( COORD_X( m_packet.GouraudLine.vertex[ 1 ].n_coord ) );
-	int32_t n_yend = SINT11( COORD_Y( m_packet.GouraudLine.vertex[ 1 ].n_coord ) );
-	PAIR n_cr2; n_cr2.w.h = BGR_R( m_packet.GouraudLine.vertex[ 1 ].n_bgr ); n_cr2.w.l = 0;
-	PAIR n_cg2; n_cg2.w.h = BGR_G( m_packet.GouraudLine.vertex[ 1 ].n_bgr ); n_cg2.w.l = 0;
-	PAIR n_cb2; n_cb2.w.h = BGR_B( m_packet.GouraudLine.vertex[ 1 ].n_bgr ); n_cb2.w.l = 0;
+	int32_t n_xend = SINT11( COORD_X( m_draw_packet.GouraudLine.vertex[ 1 ].n_coord ) );
+	int32_t n_yend = SINT11( COORD_Y( m_draw_packet.GouraudLine.vertex[ 1 ].n_coord ) );
+	PAIR n_cr2; n_cr2.w.h = BGR_R( m_draw_packet.GouraudLine.vertex[ 1 ].n_bgr ); n_cr2.w.l = 0;
+	PAIR n_cg2; n_cg2.w.h = BGR_G( m_draw_packet.GouraudLine.vertex[ 1 ].n_bgr ); n_cg2.w.l = 0;
+	PAIR n_cb2; n_cb2.w.h = BGR_B( m_draw_packet.GouraudLine.vertex[ 1 ].n_bgr ); n_cb2.w.l = 0;
 
 
 	PAIR n_x; n_x.sw.h = n_xstart; n_x.sw.l = 0;
@@ -2277,24 +2328,24 @@ void psxgpu_device::FrameBufferRectangleDraw()
 	{
 		return;
 	}
-	DebugMesh( SINT11( COORD_X( m_packet.FlatRectangle.n_coord ) ), SINT11( COORD_Y( m_packet.FlatRectangle.n_coord ) ) );
-	DebugMesh( SINT11( COORD_X( m_packet.FlatRectangle.n_coord ) ) + SIZE_W( m_packet.FlatRectangle.n_size ), SINT11( COORD_Y( m_packet.FlatRectangle.n_coord ) ) );
-	DebugMesh( SINT11( COORD_X( m_packet.FlatRectangle.n_coord ) ), SINT11( COORD_Y( m_packet.FlatRectangle.n_coord ) ) + SIZE_H( m_packet.FlatRectangle.n_size ) );
-	DebugMesh( SINT11( COORD_X( m_packet.FlatRectangle.n_coord ) ) + SIZE_W( m_packet.FlatRectangle.n_size ), SINT11( COORD_Y( m_packet.FlatRectangle.n_coord ) ) + SIZE_H( m_packet.FlatRectangle.n_size ) );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.FlatRectangle.n_coord ) ), SINT11( COORD_Y( m_draw_packet.FlatRectangle.n_coord ) ) );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.FlatRectangle.n_coord ) ) + SIZE_W( m_draw_packet.FlatRectangle.n_size ), SINT11( COORD_Y( m_draw_packet.FlatRectangle.n_coord ) ) );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.FlatRectangle.n_coord ) ), SINT11( COORD_Y( m_draw_packet.FlatRectangle.n_coord ) ) + SIZE_H( m_draw_packet.FlatRectangle.n_size ) );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.FlatRectangle.n_coord ) ) + SIZE_W( m_draw_packet.FlatRectangle.n_size ), SINT11( COORD_Y( m_draw_packet.FlatRectangle.n_coord ) ) + SIZE_H( m_draw_packet.FlatRectangle.n_size ) );
 	DebugMeshEnd();
 #endif
 
-	PAIR n_r; n_r.w.h = BGR_R( m_packet.FlatRectangle.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = BGR_G( m_packet.FlatRectangle.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = BGR_B( m_packet.FlatRectangle.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = BGR_R( m_draw_packet.FlatRectangle.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = BGR_G( m_draw_packet.FlatRectangle.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = BGR_B( m_draw_packet.FlatRectangle.n_bgr ); n_b.w.l = 0;
 
-	int16_t n_y = COORD_Y( m_packet.FlatRectangle.n_coord );
-	int32_t n_h = SIZE_H( m_packet.FlatRectangle.n_size );
+	int16_t n_y = COORD_Y( m_draw_packet.FlatRectangle.n_coord );
+	int32_t n_h = SIZE_H( m_draw_packet.FlatRectangle.n_size );
 
 	while( n_h > 0 )
 	{
-		int16_t n_x = COORD_X( m_packet.FlatRectangle.n_coord );
-		int32_t n_distance = SIZE_W( m_packet.FlatRectangle.n_size );
+		int16_t n_x = COORD_X( m_draw_packet.FlatRectangle.n_coord );
+		int32_t n_distance = SIZE_W( m_draw_packet.FlatRectangle.n_size );
 
 		while( n_distance > 0 )
 		{
@@ -2318,28 +2369,28 @@ void psxgpu_device::FlatRectangle()
 	{
 		return;
 	}
-	DebugMesh( SINT11( COORD_X( m_packet.FlatRectangle.n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_packet.FlatRectangle.n_coord ) ) + n_drawoffset_y );
-	DebugMesh( SINT11( COORD_X( m_packet.FlatRectangle.n_coord ) ) + n_drawoffset_x + SIZE_W( m_packet.FlatRectangle.n_size ), SINT11( COORD_Y( m_packet.FlatRectangle.n_coord ) ) + n_drawoffset_y );
-	DebugMesh( SINT11( COORD_X( m_packet.FlatRectangle.n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_packet.FlatRectangle.n_coord ) ) + n_drawoffset_y + SIZE_H( m_packet.FlatRectangle.n_size ) );
-	DebugMesh( SINT11( COORD_X( m_packet.FlatRectangle.n_coord ) ) + n_drawoffset_x + SIZE_W( m_packet.FlatRectangle.n_size ), SINT11( COORD_Y( m_packet.FlatRectangle.n_coord ) ) + n_drawoffset_y + SIZE_H( m_packet.FlatRectangle.n_size ) );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.FlatRectangle.n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_draw_packet.FlatRectangle.n_coord ) ) + n_drawoffset_y );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.FlatRectangle.n_coord ) ) + n_drawoffset_x + SIZE_W( m_draw_packet.FlatRectangle.n_size ), SINT11( COORD_Y( m_draw_packet.FlatRectangle.n_coord ) ) + n_drawoffset_y );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.FlatRectangle.n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_draw_packet.FlatRectangle.n_coord ) ) + n_drawoffset_y + SIZE_H( m_draw_packet.FlatRectangle.n_size ) );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.FlatRectangle.n_coord ) ) + n_drawoffset_x + SIZE_W( m_draw_packet.FlatRectangle.n_size ), SINT11( COORD_Y( m_draw_packet.FlatRectangle.n_coord ) ) + n_drawoffset_y + SIZE_H( m_draw_packet.FlatRectangle.n_size ) );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.FlatRectangle.n_bgr );
+	uint8_t n_cmd = BGR_C( m_draw_packet.FlatRectangle.n_bgr );
 
 	SOLIDSETUP
 
-	PAIR n_r; n_r.w.h = BGR_R( m_packet.FlatRectangle.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = BGR_G( m_packet.FlatRectangle.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = BGR_B( m_packet.FlatRectangle.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = BGR_R( m_draw_packet.FlatRectangle.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = BGR_G( m_draw_packet.FlatRectangle.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = BGR_B( m_draw_packet.FlatRectangle.n_bgr ); n_b.w.l = 0;
 
-	int16_t n_x = SINT11( COORD_X( m_packet.FlatRectangle.n_coord ) );
-	int16_t n_y = SINT11( COORD_Y( m_packet.FlatRectangle.n_coord ) );
-	int32_t n_h = SIZE_H( m_packet.FlatRectangle.n_size );
+	int16_t n_x = SINT11( COORD_X( m_draw_packet.FlatRectangle.n_coord ) );
+	int16_t n_y = SINT11( COORD_Y( m_draw_packet.FlatRectangle.n_coord ) );
+	int32_t n_h = SIZE_H( m_draw_packet.FlatRectangle.n_size );
 
 	while( n_h > 0 )
 	{
-		int32_t n_distance = SIZE_W( m_packet.FlatRectangle.n_size );
+		int32_t n_distance = SIZE_W( m_draw_packet.FlatRectangle.n_size );
 		int drawy = n_y + n_drawoffset_y;
 
 		if( n_distance > 0 && drawy >= (int32_t)n_drawarea_y1 && drawy <= (int32_t)n_drawarea_y2 )
@@ -2367,23 +2418,23 @@ void psxgpu_device::FlatRectangle8x8()
 	{
 		return;
 	}
-	DebugMesh( SINT11( COORD_X( m_packet.FlatRectangle8x8.n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_packet.FlatRectangle8x8.n_coord ) ) + n_drawoffset_y );
-	DebugMesh( SINT11( COORD_X( m_packet.FlatRectangle8x8.n_coord ) ) + n_drawoffset_x + 8, SINT11( COORD_Y( m_packet.FlatRectangle8x8.n_coord ) ) + n_drawoffset_y );
-	DebugMesh( SINT11( COORD_X( m_packet.FlatRectangle8x8.n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_packet.FlatRectangle8x8.n_coord ) ) + n_drawoffset_y + 8 );
-	DebugMesh( SINT11( COORD_X( m_packet.FlatRectangle8x8.n_coord ) ) + n_drawoffset_x + 8, SINT11( COORD_Y( m_packet.FlatRectangle8x8.n_coord ) ) + n_drawoffset_y + 8 );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.FlatRectangle8x8.n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_draw_packet.FlatRectangle8x8.n_coord ) ) + n_drawoffset_y );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.FlatRectangle8x8.n_coord ) ) + n_drawoffset_x + 8, SINT11( COORD_Y( m_draw_packet.FlatRectangle8x8.n_coord ) ) + n_drawoffset_y );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.FlatRectangle8x8.n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_draw_packet.FlatRectangle8x8.n_coord ) ) + n_drawoffset_y + 8 );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.FlatRectangle8x8.n_coord ) ) + n_drawoffset_x + 8, SINT11( COORD_Y( m_draw_packet.FlatRectangle8x8.n_coord ) ) + n_drawoffset_y + 8 );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.FlatRectangle8x8.n_bgr );
+	uint8_t n_cmd = BGR_C( m_draw_packet.FlatRectangle8x8.n_bgr );
 
 	SOLIDSETUP
 
-	PAIR n_r; n_r.w.h = BGR_R( m_packet.FlatRectangle8x8.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = BGR_G( m_packet.FlatRectangle8x8.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = BGR_B( m_packet.FlatRectangle8x8.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = BGR_R( m_draw_packet.FlatRectangle8x8.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = BGR_G( m_draw_packet.FlatRectangle8x8.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = BGR_B( m_draw_packet.FlatRectangle8x8.n_bgr ); n_b.w.l = 0;
 
-	int16_t n_x = SINT11( COORD_X( m_packet.FlatRectangle8x8.n_coord ) );
-	int16_t n_y = SINT11( COORD_Y( m_packet.FlatRectangle8x8.n_coord ) );
+	int16_t n_x = SINT11( COORD_X( m_draw_packet.FlatRectangle8x8.n_coord ) );
+	int16_t n_y = SINT11( COORD_Y( m_draw_packet.FlatRectangle8x8.n_coord ) );
 	int32_t n_h = 8;
 
 	while( n_h > 0 )
@@ -2416,23 +2467,23 @@ void psxgpu_device::FlatRectangle16x16()
 	{
 		return;
 	}
-	DebugMesh( SINT11( COORD_X( m_packet.FlatRectangle16x16.n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_packet.FlatRectangle16x16.n_coord ) ) + n_drawoffset_y );
-	DebugMesh( SINT11( COORD_X( m_packet.FlatRectangle16x16.n_coord ) ) + n_drawoffset_x + 16, SINT11( COORD_Y( m_packet.FlatRectangle16x16.n_coord ) ) + n_drawoffset_y );
-	DebugMesh( SINT11( COORD_X( m_packet.FlatRectangle16x16.n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_packet.FlatRectangle16x16.n_coord ) ) + n_drawoffset_y + 16 );
-	DebugMesh( SINT11( COORD_X( m_packet.FlatRectangle16x16.n_coord ) ) + n_drawoffset_x + 16, SINT11( COORD_Y( m_packet.FlatRectangle16x16.n_coord ) ) + n_drawoffset_y + 16 );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.FlatRectangle16x16.n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_draw_packet.FlatRectangle16x16.n_coord ) ) + n_drawoffset_y );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.FlatRectangle16x16.n_coord ) ) + n_drawoffset_x + 16, SINT11( COORD_Y( m_draw_packet.FlatRectangle16x16.n_coord ) ) + n_drawoffset_y );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.FlatRectangle16x16.n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_draw_packet.FlatRectangle16x16.n_coord ) ) + n_drawoffset_y + 16 );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.FlatRectangle16x16.n_coord ) ) + n_drawoffset_x + 16, SINT11( COORD_Y( m_draw_packet.FlatRectangle16x16.n_coord ) ) + n_drawoffset_y + 16 );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.FlatRectangle16x16.n_bgr );
+	uint8_t n_cmd = BGR_C( m_draw_packet.FlatRectangle16x16.n_bgr );
 
 	SOLIDSETUP
 
-	PAIR n_r; n_r.w.h = BGR_R( m_packet.FlatRectangle16x16.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = BGR_G( m_packet.FlatRectangle16x16.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = BGR_B( m_packet.FlatRectangle16x16.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = BGR_R( m_draw_packet.FlatRectangle16x16.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = BGR_G( m_draw_packet.FlatRectangle16x16.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = BGR_B( m_draw_packet.FlatRectangle16x16.n_bgr ); n_b.w.l = 0;
 
-	int16_t n_x = SINT11( COORD_X( m_packet.FlatRectangle16x16.n_coord ) );
-	int16_t n_y = SINT11( COORD_Y( m_packet.FlatRectangle16x16.n_coord ) );
+	int16_t n_x = SINT11( COORD_X( m_draw_packet.FlatRectangle16x16.n_coord ) );
+	int16_t n_y = SINT11( COORD_Y( m_draw_packet.FlatRectangle16x16.n_coord ) );
 	int32_t n_h = 16;
 
 	while( n_h > 0 )
@@ -2465,34 +2516,34 @@ void psxgpu_device::FlatTexturedRectangle()
 	{
 		return;
 	}
-	DebugMesh( SINT11( COORD_X( m_packet.FlatTexturedRectangle.n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_packet.FlatTexturedRectangle.n_coord ) ) + n_drawoffset_y );
-	DebugMesh( SINT11( COORD_X( m_packet.FlatTexturedRectangle.n_coord ) ) + n_drawoffset_x + SIZE_W( m_packet.FlatTexturedRectangle.n_size ), SINT11( COORD_Y( m_packet.FlatTexturedRectangle.n_coord ) ) + n_drawoffset_y );
-	DebugMesh( SINT11( COORD_X( m_packet.FlatTexturedRectangle.n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_packet.FlatTexturedRectangle.n_coord ) ) + n_drawoffset_y + SIZE_H( m_packet.FlatTexturedRectangle.n_size ) );
-	DebugMesh( SINT11( COORD_X( m_packet.FlatTexturedRectangle.n_coord ) ) + n_drawoffset_x + SIZE_W( m_packet.FlatTexturedRectangle.n_size ), SINT11( COORD_Y( m_packet.FlatTexturedRectangle.n_coord ) ) + n_drawoffset_y + SIZE_H( m_packet.FlatTexturedRectangle.n_size ) );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.FlatTexturedRectangle.n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_draw_packet.FlatTexturedRectangle.n_coord ) ) + n_drawoffset_y );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.FlatTexturedRectangle.n_coord ) ) + n_drawoffset_x + SIZE_W( m_draw_packet.FlatTexturedRectangle.n_size ), SINT11( COORD_Y( m_draw_packet.FlatTexturedRectangle.n_coord ) ) + n_drawoffset_y );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.FlatTexturedRectangle.n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_draw_packet.FlatTexturedRectangle.n_coord ) ) + n_drawoffset_y + SIZE_H( m_draw_packet.FlatTexturedRectangle.n_size ) );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.FlatTexturedRectangle.n_coord ) ) + n_drawoffset_x + SIZE_W( m_draw_packet.FlatTexturedRectangle.n_size ), SINT11( COORD_Y( m_draw_packet.FlatTexturedRectangle.n_coord ) ) + n_drawoffset_y + SIZE_H( m_draw_packet.FlatTexturedRectangle.n_size ) );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.FlatTexturedRectangle.n_bgr );
+	uint8_t n_cmd = BGR_C( m_draw_packet.FlatTexturedRectangle.n_bgr );
 
-	uint32_t n_clutx = ( m_packet.FlatTexturedRectangle.n_texture.w.h & 0x3f ) << 4;
-	uint32_t n_cluty = ( m_packet.FlatTexturedRectangle.n_texture.w.h >> 6 ) & 0x3ff;
+	uint32_t n_clutx = ( m_draw_packet.FlatTexturedRectangle.n_texture.w.h & 0x3f ) << 4;
+	uint32_t n_cluty = ( m_draw_packet.FlatTexturedRectangle.n_texture.w.h >> 6 ) & 0x3ff;
 
 	TEXTURESETUP
 	SPRITESETUP
 
-	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_packet.FlatTexturedRectangle.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_packet.FlatTexturedRectangle.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_packet.FlatTexturedRectangle.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_draw_packet.FlatTexturedRectangle.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_draw_packet.FlatTexturedRectangle.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_draw_packet.FlatTexturedRectangle.n_bgr ); n_b.w.l = 0;
 
-	int16_t n_x = SINT11( COORD_X( m_packet.FlatTexturedRectangle.n_coord ) );
-	int16_t n_y = SINT11( COORD_Y( m_packet.FlatTexturedRectangle.n_coord ) );
-	uint8_t n_v = TEXTURE_V( m_packet.FlatTexturedRectangle.n_texture );
-	uint32_t n_h = SIZE_H( m_packet.FlatTexturedRectangle.n_size );
+	int16_t n_x = SINT11( COORD_X( m_draw_packet.FlatTexturedRectangle.n_coord ) );
+	int16_t n_y = SINT11( COORD_Y( m_draw_packet.FlatTexturedRectangle.n_coord ) );
+	uint8_t n_v = TEXTURE_V( m_draw_packet.FlatTexturedRectangle.n_texture );
+	uint32_t n_h = SIZE_H( m_draw_packet.FlatTexturedRectangle.n_size );
 
 	while( n_h > 0 )
 	{
-		uint8_t n_u = TEXTURE_U( m_packet.FlatTexturedRectangle.n_texture );
-		int16_t n_distance = SIZE_W( m_packet.FlatTexturedRectangle.n_size );
+		uint8_t n_u = TEXTURE_U( m_draw_packet.FlatTexturedRectangle.n_texture );
+		int16_t n_distance = SIZE_W( m_draw_packet.FlatTexturedRectangle.n_size );
 		int drawy = n_y + n_drawoffset_y;
 
 		if( n_distance > 0 && drawy >= (int32_t)n_drawarea_y1 && drawy <= (int32_t)n_drawarea_y2 )
@@ -2522,33 +2573,33 @@ void psxgpu_device::Sprite8x8()
 	{
 		return;
 	}
-	DebugMesh( SINT11( COORD_X( m_packet.Sprite8x8.n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_packet.Sprite8x8.n_coord ) ) + n_drawoffset_y );
-	DebugMesh( SINT11( COORD_X( m_packet.Sprite8x8.n_coord ) ) + n_drawoffset_x + 7, SINT11( COORD_Y( m_packet.Sprite8x8.n_coord ) ) + n_drawoffset_y );
-	DebugMesh( SINT11( COORD_X( m_packet.Sprite8x8.n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_packet.Sprite8x8.n_coord ) ) + n_drawoffset_y + 7 );
-	DebugMesh( SINT11( COORD_X( m_packet.Sprite8x8.n_coord ) ) + n_drawoffset_x + 7, SINT11( COORD_Y( m_packet.Sprite8x8.n_coord ) ) + n_drawoffset_y + 7 );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.Sprite8x8.n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_draw_packet.Sprite8x8.n_coord ) ) + n_drawoffset_y );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.Sprite8x8.n_coord ) ) + n_drawoffset_x + 7, SINT11( COORD_Y( m_draw_packet.Sprite8x8.n_coord ) ) + n_drawoffset_y );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.Sprite8x8.n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_draw_packet.Sprite8x8.n_coord ) ) + n_drawoffset_y + 7 );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.Sprite8x8.n_coord ) ) + n_drawoffset_x + 7, SINT11( COORD_Y( m_draw_packet.Sprite8x8.n_coord ) ) + n_drawoffset_y + 7 );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.Sprite8x8.n_bgr );
+	uint8_t n_cmd = BGR_C( m_draw_packet.Sprite8x8.n_bgr );
 
-	uint32_t n_clutx = ( m_packet.Sprite8x8.n_texture.w.h & 0x3f ) << 4;
-	uint32_t n_cluty = ( m_packet.Sprite8x8.n_texture.w.h >> 6 ) & 0x3ff;
+	uint32_t n_clutx = ( m_draw_packet.Sprite8x8.n_texture.w.h & 0x3f ) << 4;
+	uint32_t n_cluty = ( m_draw_packet.Sprite8x8.n_texture.w.h >> 6 ) & 0x3ff;
 
 	TEXTURESETUP
 	SPRITESETUP
 
-	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_packet.Sprite8x8.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_packet.Sprite8x8.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_packet.Sprite8x8.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_draw_packet.Sprite8x8.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_draw_packet.Sprite8x8.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_draw_packet.Sprite8x8.n_bgr ); n_b.w.l = 0;
 
-	int16_t n_x = SINT11( COORD_X( m_packet.Sprite8x8.n_coord ) );
-	int16_t n_y = SINT11( COORD_Y( m_packet.Sprite8x8.n_coord ) );
-	uint8_t n_v = TEXTURE_V( m_packet.Sprite8x8.n_texture );
+	int16_t n_x = SINT11( COORD_X( m_draw_packet.Sprite8x8.n_coord ) );
+	int16_t n_y = SINT11( COORD_Y( m_draw_packet.Sprite8x8.n_coord ) );
+	uint8_t n_v = TEXTURE_V( m_draw_packet.Sprite8x8.n_texture );
 	uint32_t n_h = 8;
 
 	while( n_h > 0 )
 	{
-		uint8_t n_u = TEXTURE_U( m_packet.Sprite8x8.n_texture );
+		uint8_t n_u = TEXTURE_U( m_draw_packet.Sprite8x8.n_texture );
 		int16_t n_distance = 8;
 
 		int drawy = n_y + n_drawoffset_y;
@@ -2580,33 +2631,33 @@ void psxgpu_device::Sprite16x16()
 	{
 		return;
 	}
-	DebugMesh( SINT11( COORD_X( m_packet.Sprite16x16.n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_packet.Sprite16x16.n_coord ) ) + n_drawoffset_y );
-	DebugMesh( SINT11( COORD_X( m_packet.Sprite16x16.n_coord ) ) + n_drawoffset_x + 7, SINT11( COORD_Y( m_packet.Sprite16x16.n_coord ) ) + n_drawoffset_y );
-	DebugMesh( SINT11( COORD_X( m_packet.Sprite16x16.n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_packet.Sprite16x16.n_coord ) ) + n_drawoffset_y + 7 );
-	DebugMesh( SINT11( COORD_X( m_packet.Sprite16x16.n_coord ) ) + n_drawoffset_x + 7, SINT11( COORD_Y( m_packet.Sprite16x16.n_coord ) ) + n_drawoffset_y + 7 );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.Sprite16x16.n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_draw_packet.Sprite16x16.n_coord ) ) + n_drawoffset_y );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.Sprite16x16.n_coord ) ) + n_drawoffset_x + 7, SINT11( COORD_Y( m_draw_packet.Sprite16x16.n_coord ) ) + n_drawoffset_y );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.Sprite16x16.n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_draw_packet.Sprite16x16.n_coord ) ) + n_drawoffset_y + 7 );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.Sprite16x16.n_coord ) ) + n_drawoffset_x + 7, SINT11( COORD_Y( m_draw_packet.Sprite16x16.n_coord ) ) + n_drawoffset_y + 7 );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.Sprite16x16.n_bgr );
+	uint8_t n_cmd = BGR_C( m_draw_packet.Sprite16x16.n_bgr );
 
-	uint32_t n_clutx = ( m_packet.Sprite16x16.n_texture.w.h & 0x3f ) << 4;
-	uint32_t n_cluty = ( m_packet.Sprite16x16.n_texture.w.h >> 6 ) & 0x3ff;
+	uint32_t n_clutx = ( m_draw_packet.Sprite16x16.n_texture.w.h & 0x3f ) << 4;
+	uint32_t n_cluty = ( m_draw_packet.Sprite16x16.n_texture.w.h >> 6 ) & 0x3ff;
 
 	TEXTURESETUP
 	SPRITESETUP
 
-	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_packet.Sprite16x16.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_packet.Sprite16x16.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_packet.Sprite16x16.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_draw_packet.Sprite16x16.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_draw_packet.Sprite16x16.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_draw_packet.Sprite16x16.n_bgr ); n_b.w.l = 0;
 
-	int16_t n_x = SINT11( COORD_X( m_packet.Sprite16x16.n_coord ) );
-	int16_t n_y = SINT11( COORD_Y( m_packet.Sprite16x16.n_coord ) );
-	uint8_t n_v = TEXTURE_V( m_packet.Sprite16x16.n_texture );
+	int16_t n_x = SINT11( COORD_X( m_draw_packet.Sprite16x16.n_coord ) );
+	int16_t n_y = SINT11( COORD_Y( m_draw_packet.Sprite16x16.n_coord ) );
+	uint8_t n_v = TEXTURE_V( m_draw_packet.Sprite16x16.n_texture );
 	uint32_t n_h = 16;
 
 	while( n_h > 0 )
 	{
-		uint8_t n_u = TEXTURE_U( m_packet.Sprite16x16.n_texture );
+		uint8_t n_u = TEXTURE_U( m_draw_packet.Sprite16x16.n_texture );
 		int16_t n_distance = 16;
 
 		int drawy = n_y + n_drawoffset_y;
@@ -2638,16 +2689,16 @@ void psxgpu_device::Dot()
 	{
 		return;
 	}
-	DebugMesh( SINT11( COORD_X( m_packet.Dot.vertex.n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_packet.Dot.vertex.n_coord ) ) + n_drawoffset_y );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.Dot.vertex.n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_draw_packet.Dot.vertex.n_coord ) ) + n_drawoffset_y );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.Dot.n_bgr );
-	uint8_t n_r = BGR_R( m_packet.Dot.n_bgr );
-	uint8_t n_g = BGR_G( m_packet.Dot.n_bgr );
-	uint8_t n_b = BGR_B( m_packet.Dot.n_bgr );
-	int32_t n_x = SINT11( COORD_X( m_packet.Dot.vertex.n_coord ) );
-	int32_t n_y = SINT11( COORD_Y( m_packet.Dot.vertex.n_coord ) );
+	uint8_t n_cmd = BGR_C( m_draw_packet.Dot.n_bgr );
+	uint8_t n_r = BGR_R( m_draw_packet.Dot.n_bgr );
+	uint8_t n_g = BGR_G( m_draw_packet.Dot.n_bgr );
+	uint8_t n_b = BGR_B( m_draw_packet.Dot.n_bgr );
+	int32_t n_x = SINT11( COORD_X( m_draw_packet.Dot.vertex.n_coord ) );
+	int32_t n_y = SINT11( COORD_Y( m_draw_packet.Dot.vertex.n_coord ) );
 
 	TRANSPARENCYSETUP
 
@@ -2686,22 +2737,22 @@ void psxgpu_device::TexturedDot()
 	{
 		return;
 	}
-	DebugMesh( SINT11( COORD_X( m_packet.TexturedDot.vertex.n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_packet.TexturedDot.vertex.n_coord ) ) + n_drawoffset_y );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.TexturedDot.vertex.n_coord ) ) + n_drawoffset_x, SINT11( COORD_Y( m_draw_packet.TexturedDot.vertex.n_coord ) ) + n_drawoffset_y );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.TexturedDot.n_bgr );
+	uint8_t n_cmd = BGR_C( m_draw_packet.TexturedDot.n_bgr );
 
-	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_packet.TexturedDot.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_packet.TexturedDot.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_packet.TexturedDot.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_draw_packet.TexturedDot.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_draw_packet.TexturedDot.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_draw_packet.TexturedDot.n_bgr ); n_b.w.l = 0;
 
-	int32_t n_x = SINT11( COORD_X( m_packet.TexturedDot.vertex.n_coord ) );
-	int32_t n_y = SINT11( COORD_Y( m_packet.TexturedDot.vertex.n_coord ) );
-	uint8_t n_u = TEXTURE_U(m_packet.TexturedDot.vertex.n_texture );
-	uint8_t n_v = TEXTURE_V(m_packet.TexturedDot.vertex.n_texture );
-	uint32_t n_clutx = ( m_packet.TexturedDot.vertex.n_texture.w.h & 0x3f ) << 4;
-	uint32_t n_cluty = ( m_packet.TexturedDot.vertex.n_texture.w.h >> 6 ) & 0x3ff;
+	int32_t n_x = SINT11( COORD_X( m_draw_packet.TexturedDot.vertex.n_coord ) );
+	int32_t n_y = SINT11( COORD_Y( m_draw_packet.TexturedDot.vertex.n_coord ) );
+	uint8_t n_u = TEXTURE_U(m_draw_packet.TexturedDot.vertex.n_texture );
+	uint8_t n_v = TEXTURE_V(m_draw_packet.TexturedDot.vertex.n_texture );
+	uint32_t n_clutx = ( m_draw_packet.TexturedDot.vertex.n_texture.w.h & 0x3f ) << 4;
+	uint32_t n_cluty = ( m_draw_packet.TexturedDot.vertex.n_texture.w.h >> 6 ) & 0x3ff;
 
 	TEXTURESETUP
 
@@ -2724,22 +2775,22 @@ void psxgpu_device::MoveImage()
 	{
 		return;
 	}
-	DebugMesh( SINT11( COORD_X( m_packet.MoveImage.vertex[ 1 ].n_coord ) ), SINT11( COORD_Y( m_packet.MoveImage.vertex[ 1 ].n_coord ) ) );
-	DebugMesh( SINT11( COORD_X( m_packet.MoveImage.vertex[ 1 ].n_coord ) ) + SIZE_W( m_packet.MoveImage.n_size ), SINT11( COORD_Y( m_packet.MoveImage.vertex[ 1 ].n_coord ) ) );
-	DebugMesh( SINT11( COORD_X( m_packet.MoveImage.vertex[ 1 ].n_coord ) ), SINT11( COORD_Y( m_packet.MoveImage.vertex[ 1 ].n_coord ) ) + SIZE_H( m_packet.MoveImage.n_size ) );
-	DebugMesh( SINT11( COORD_X( m_packet.MoveImage.vertex[ 1 ].n_coord ) ) + SIZE_W( m_packet.MoveImage.n_size ), SINT11( COORD_Y( m_packet.MoveImage.vertex[ 1 ].n_coord ) ) + SIZE_H( m_packet.MoveImage.n_size ) );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.MoveImage.vertex[ 1 ].n_coord ) ), SINT11( COORD_Y( m_draw_packet.MoveImage.vertex[ 1 ].n_coord ) ) );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.MoveImage.vertex[ 1 ].n_coord ) ) + SIZE_W( m_draw_packet.MoveImage.n_size ), SINT11( COORD_Y( m_draw_packet.MoveImage.vertex[ 1 ].n_coord ) ) );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.MoveImage.vertex[ 1 ].n_coord ) ), SINT11( COORD_Y( m_draw_packet.MoveImage.vertex[ 1 ].n_coord ) ) + SIZE_H( m_draw_packet.MoveImage.n_size ) );
+	DebugMesh( SINT11( COORD_X( m_draw_packet.MoveImage.vertex[ 1 ].n_coord ) ) + SIZE_W( m_draw_packet.MoveImage.n_size ), SINT11( COORD_Y( m_draw_packet.MoveImage.vertex[ 1 ].n_coord ) ) + SIZE_H( m_draw_packet.MoveImage.n_size ) );
 	DebugMeshEnd();
 #endif
 
-	int16_t n_srcy = COORD_Y( m_packet.MoveImage.vertex[ 0 ].n_coord );
-	int16_t n_dsty = COORD_Y( m_packet.MoveImage.vertex[ 1 ].n_coord );
-	int16_t n_h = SIZE_H( m_packet.MoveImage.n_size );
+	int16_t n_srcy = COORD_Y( m_draw_packet.MoveImage.vertex[ 0 ].n_coord );
+	int16_t n_dsty = COORD_Y( m_draw_packet.MoveImage.vertex[ 1 ].n_coord );
+	int16_t n_h = SIZE_H( m_draw_packet.MoveImage.n_size );
 
 	while( n_h > 0 )
 	{
-		int16_t n_srcx = COORD_X( m_packet.MoveImage.vertex[ 0 ].n_coord );
-		int16_t n_dstx = COORD_X( m_packet.MoveImage.vertex[ 1 ].n_coord );
-		int16_t n_w = SIZE_W( m_packet.MoveImage.n_size );
+		int16_t n_srcx = COORD_X( m_draw_packet.MoveImage.vertex[ 0 ].n_coord );
+		int16_t n_dstx = COORD_X( m_draw_packet.MoveImage.vertex[ 1 ].n_coord );
+		int16_t n_w = SIZE_W( m_draw_packet.MoveImage.n_size );
 
 		while( n_w > 0 )
 		{
@@ -2756,9 +2807,253 @@ void psxgpu_device::MoveImage()
 	}
 }
 
+int32_t psxgpu_device::drawoffset_x( uint32_t data ) const
+{
+	return SINT11( data & 2047 );
+}
+
+int32_t psxgpu_device::drawoffset_y( uint32_t data ) const
+{
+	return SINT11( ( data >> ( ( m_n_gputype == 2 ) ? 11 : 12 ) ) & 2047 );
+}
+
+/* the renderer's half of the state setting packets */
+void psxgpu_device::set_draw_state( uint32_t data )
+{
+	switch( data >> 24 )
+	{
+	case 0xe1:
+		decode_tpage( data & 0xffffff );
+		break;
+	case 0xe2:
+		n_twy = ( ( ( data >> 15 ) & 0x1f ) << 3 );
+		n_twx = ( ( ( data >> 10 ) & 0x1f ) << 3 );
+		n_twh = 255 - ( ( ( data >> 5 ) & 0x1f ) << 3 );
+		n_tww = 255 - ( ( data & 0x1f ) << 3 );
+		break;
+	case 0xe3:
+		n_drawarea_x1 = drawarea_x( data );
+		n_drawarea_y1 = drawarea_y( data );
+		break;
+	case 0xe4:
+		n_drawarea_x2 = drawarea_x( data );
+		n_drawarea_y2 = drawarea_y( data );
+		break;
+	case 0xe5:
+		n_drawoffset_x = drawoffset_x( data );
+		n_drawoffset_y = drawoffset_y( data );
+		break;
+	case 0xe6:
+		m_draw_stp = BIT( data, 0 );
+		m_check_stp = BIT( data, 1 );
+		break;
+	}
+}
+
+void psxgpu_device::execute( const render_command &command )
+{
+	if( command.op == RENDER_WRITE_PIXELS )
+	{
+		for( int n_pixel = 0; n_pixel < command.count; n_pixel++ )
+		{
+			uint32_t n_address = command.packet.n_entry[ n_pixel * 2 ];
+			uint16_t *p_vram = p_p_vram[ n_address >> 10 ] + ( n_address & 1023 );
+			WRITE_PIXEL( uint16_t( command.packet.n_entry[ ( n_pixel * 2 ) + 1 ] ) )
+		}
+		return;
+	}
+
+	m_draw_packet = command.packet;
+	switch( command.op )
+	{
+	case RENDER_STATE: set_draw_state( m_draw_packet.n_entry[ 0 ] ); break;
+	case RENDER_FRAME_BUFFER_RECTANGLE: FrameBufferRectangleDraw(); break;
+	case RENDER_FLAT_POLYGON: FlatPolygon( command.count ); break;
+	case RENDER_FLAT_TEXTURED_POLYGON: FlatTexturedPolygon( command.count ); break;
+	case RENDER_GOURAUD_POLYGON: GouraudPolygon( command.count ); break;
+	case RENDER_GOURAUD_TEXTURED_POLYGON: GouraudTexturedPolygon( command.count ); break;
+	case RENDER_MONOCHROME_LINE: MonochromeLine(); break;
+	case RENDER_GOURAUD_LINE: GouraudLine(); break;
+	case RENDER_FLAT_RECTANGLE: FlatRectangle(); break;
+	case RENDER_FLAT_RECTANGLE_8X8: FlatRectangle8x8(); break;
+	case RENDER_FLAT_RECTANGLE_16X16: FlatRectangle16x16(); break;
+	case RENDER_FLAT_TEXTURED_RECTANGLE: FlatTexturedRectangle(); break;
+	case RENDER_SPRITE_8X8: Sprite8x8(); break;
+	case RENDER_SPRITE_16X16: Sprite16x16(); break;
+	case RENDER_DOT: Dot(); break;
+	case RENDER_TEXTURED_DOT: TexturedDot(); break;
+	case RENDER_MOVE_IMAGE: MoveImage(); break;
+	}
+}
+
+void *psxgpu_device::render_callback( void *param, int threadid )
+{
+	render_batch &batch = *reinterpret_cast<render_batch *>( param );
+	for( const render_command &command : batch.commands )
+	{
+		batch.gpu->execute( command );
+	}
+	return nullptr;
+}
+
+psxgpu_device::render_batch &psxgpu_device::current_batch()
+{
+	if( m_batch == m_batches.size() )
+	{
+		m_batches.emplace_back( std::make_unique<render_batch>() );
+		m_batches.back()->gpu = this;
+		m_batches.back()->commands.reserve( COMMANDS_PER_BATCH );
+	}
+	return *m_batches[ m_batch ];
+}
+
+/* hand the packet to the renderer, or draw it now if there isn't one */
+void psxgpu_device::submit( uint8_t op, int count )
+{
+	if( m_render_queue == nullptr )
+	{
+		execute( render_command{ op, uint8_t( count ), m_packet } );
+		return;
+	}
+
+	render_batch &batch = current_batch();
+	batch.commands.push_back( render_command{ op, uint8_t( count ), m_packet } );
+	if( batch.commands.size() >= COMMANDS_PER_BATCH )
+	{
+		flush_render();
+	}
+}
+
+/* primitives never draw outside the drawing area */
+void psxgpu_device::submit_draw( uint8_t op, int count )
+{
+	if( m_cpu_drawarea_x2 >= m_cpu_drawarea_x1 && m_cpu_drawarea_y2 >= m_cpu_drawarea_y1 )
+	{
+		mark_dirty( vram_area( m_cpu_drawarea_x1, m_cpu_drawarea_y1, ( m_cpu_drawarea_x2 - m_cpu_drawarea_x1 ) + 1, ( m_cpu_drawarea_y2 - m_cpu_drawarea_y1 ) + 1 ) );
+	}
+	submit( op, count );
+}
+
+void psxgpu_device::submit_pixel( uint32_t x, uint32_t y, uint16_t pixel )
+{
+	if( m_render_queue == nullptr )
+	{
+		uint16_t *p_vram = p_p_vram[ y ] + x;
+		WRITE_PIXEL( pixel )
+		return;
+	}
+
+	render_batch &batch = current_batch();
+	if( batch.commands.empty() || batch.commands.back().op != RENDER_WRITE_PIXELS || batch.commands.back().count == PIXELS_PER_COMMAND )
+	{
+		batch.commands.push_back( render_command{ RENDER_WRITE_PIXELS, 0, m_packet } );
+	}
+
+	render_command &command = batch.commands.back();
+	command.packet.n_entry[ command.count * 2 ] = ( y << 10 ) | x;
+	command.packet.n_entry[ ( command.count * 2 ) + 1 ] = pixel;
+	command.count++;
+	if( command.count == PIXELS_PER_COMMAND && batch.commands.size() >= COMMANDS_PER_BATCH )
+	{
+		flush_render();
+	}
+}
+
+/* start the renderer on whatever has been submitted so far */
+void psxgpu_device::flush_render()
+{
+	if( m_render_queue == nullptr || m_batch == m_batches.size() || m_batches[ m_batch ]->commands.empty() )
+	{
+		return;
+	}
+
+	osd_work_item_queue( m_render_queue, render_callback, m_batches[ m_batch ].get(), WORK_ITEM_FLAG_AUTO_RELEASE );
+	m_batch++;
+	if( m_batch >= MAX_PENDING_BATCHES )
+	{
+		sync_render();
+	}
+}
+
+/* wait for the renderer to finish everything submitted so far */
+void psxgpu_device::sync_render()
+{
+	if( m_render_queue == nullptr )
+	{
+		return;
+	}
+
+	flush_render();
+	if( m_batch != 0 )
+	{
+		while( !osd_work_queue_wait( m_render_queue, osd_ticks_per_second() * 10 ) )
+		{
+		}
+		for( unsigned n_batch = 0; n_batch < m_batch; n_batch++ )
+		{
+			m_batches[ n_batch ]->commands.clear();
+		}
+		m_batch = 0;
+	}
+	m_dirty.set( 0, -1, 0, -1 );
+}
+
+/* the VRAM an area covers, widened to the full width or height wherever it wraps */
+rectangle psxgpu_device::vram_area( int32_t x, int32_t y, int32_t width, int32_t height ) const
+{
+	int32_t const n_rows = ( vramSize / 1024 ) / sizeof( uint16_t );
+	if( width <= 0 || height <= 0 )
+	{
+		return rectangle( 0, -1, 0, -1 );
+	}
+
+	x &= 1023;
+	y = ( y & 1023 ) % n_rows;
+	rectangle area( x, x + width - 1, y, y + height - 1 );
+	if( area.right() > 1023 )
+	{
+		area.setx( 0, 1023 );
+	}
+	if( area.bottom() >= n_rows )
+	{
+		area.sety( 0, n_rows - 1 );
+	}
+	return area;
+}
+
+/* note VRAM the renderer may still be writing */
+void psxgpu_device::mark_dirty( const rectangle &area )
+{
+	if( m_render_queue == nullptr || area.empty() )
+	{
+		return;
+	}
+
+	if( m_dirty.empty() )
+	{
+		m_dirty = area;
+	}
+	else
+	{
+		m_dirty |= area;
+	}
+}
+
+/* wait for the renderer before reading VRAM it may still be writing */
+void psxgpu_device::sync_dirty( const rectangle &area )
+{
+	rectangle overlap = m_dirty;
+	overlap &= area;
+	if( !m_dirty.empty() && !overlap.empty() )
+	{
+		sync_render();
+	}
+}
+
 void psxgpu_device::dma_write( uint32_t *p_n_psxram, uint32_t n_address, int32_t n_size )
 {
 	gpu_write( &p_n_psxram[ n_address / 4 ], n_size );
+	flush_render();
 }
 
 void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
@@ -2786,7 +3081,8 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			{
 				verboselog( *this, 1, "%02x: frame buffer rectangle %u,%u %u,%u\n", m_packet.n_entry[ 0 ] >> 24,
 					m_packet.n_entry[ 1 ] & 0xffff, m_packet.n_entry[ 1 ] >> 16, m_packet.n_entry[ 2 ] & 0xffff, m_packet.n_entry[ 2 ] >> 16 );
-				FrameBufferRectangleDraw();
+				mark_dirty( vram_area( m_packet.n_entry[ 1 ] & 0xffff, m_packet.n_entry[ 1 ] >> 16, m_packet.n_entry[ 2 ] & 0xffff, m_packet.n_entry[ 2 ] >> 16 ) );
+				submit( RENDER_FRAME_BUFFER_RECTANGLE );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2801,7 +3097,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				verboselog( *this, 1, "%02x: monochrome 3 point polygon\n", m_packet.n_entry[ 0 ] >> 24 );
-				FlatPolygon( 3 );
+				submit_draw( RENDER_FLAT_POLYGON, 3 );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2816,7 +3112,8 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				verboselog( *this, 1, "%02x: textured 3 point polygon\n", m_packet.n_entry[ 0 ] >> 24 );
-				FlatTexturedPolygon( 3 );
+				decode_tpage_status( m_packet.FlatTexturedPolygon.vertex[ 1 ].n_texture.w.h );
+				submit_draw( RENDER_FLAT_TEXTURED_POLYGON, 3 );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2831,7 +3128,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				verboselog( *this, 1, "%02x: monochrome 4 point polygon\n", m_packet.n_entry[ 0 ] >> 24 );
-				FlatPolygon( 4 );
+				submit_draw( RENDER_FLAT_POLYGON, 4 );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2846,7 +3143,8 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				verboselog( *this, 1, "%02x: textured 4 point polygon\n", m_packet.n_entry[ 0 ] >> 24 );
-				FlatTexturedPolygon( 4 );
+				decode_tpage_status( m_packet.FlatTexturedPolygon.vertex[ 1 ].n_texture.w.h );
+				submit_draw( RENDER_FLAT_TEXTURED_POLYGON, 4 );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2861,7 +3159,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				verboselog( *this, 1, "%02x: gouraud 3 point polygon\n", m_packet.n_entry[ 0 ] >> 24 );
-				GouraudPolygon( 3 );
+				submit_draw( RENDER_GOURAUD_POLYGON, 3 );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2876,7 +3174,8 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				verboselog( *this, 1, "%02x: gouraud textured 3 point polygon\n", m_packet.n_entry[ 0 ] >> 24 );
-				GouraudTexturedPolygon( 3 );
+				decode_tpage_status( m_packet.GouraudTexturedPolygon.vertex[ 1 ].n_texture.w.h );
+				submit_draw( RENDER_GOURAUD_TEXTURED_POLYGON, 3 );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2891,7 +3190,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				verboselog( *this, 1, "%02x: gouraud 4 point polygon\n", m_packet.n_entry[ 0 ] >> 24 );
-				GouraudPolygon( 4 );
+				submit_draw( RENDER_GOURAUD_POLYGON, 4 );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2906,7 +3205,8 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				verboselog( *this, 1, "%02x: gouraud textured 4 point polygon\n", m_packet.n_entry[ 0 ] >> 24 );
-				GouraudTexturedPolygon( 4 );
+				decode_tpage_status( m_packet.GouraudTexturedPolygon.vertex[ 1 ].n_texture.w.h );
+				submit_draw( RENDER_GOURAUD_TEXTURED_POLYGON, 4 );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2921,7 +3221,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				verboselog( *this, 1, "%02x: monochrome line\n", m_packet.n_entry[ 0 ] >> 24 );
-				MonochromeLine();
+				submit_draw( RENDER_MONOCHROME_LINE );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2936,7 +3236,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				verboselog( *this, 1, "%02x: monochrome polyline\n", m_packet.n_entry[ 0 ] >> 24 );
-				MonochromeLine();
+				submit_draw( RENDER_MONOCHROME_LINE );
 				if( ( m_packet.n_entry[ 3 ] & 0xf000f000 ) != 0x50005000 )
 				{
 					m_packet.n_entry[ 1 ] = m_packet.n_entry[ 2 ];
@@ -2960,7 +3260,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				verboselog( *this, 1, "%02x: gouraud line\n", m_packet.n_entry[ 0 ] >> 24 );
-				GouraudLine();
+				submit_draw( RENDER_GOURAUD_LINE );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2976,7 +3276,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				verboselog( *this, 1, "%02x: gouraud polyline\n", m_packet.n_entry[ 0 ] >> 24 );
-				GouraudLine();
+				submit_draw( RENDER_GOURAUD_LINE );
 				if( ( m_packet.n_entry[ 4 ] & 0xf000f000 ) != 0x50005000 )
 				{
 					m_packet.n_entry[ 0 ] = ( m_packet.n_entry[ 0 ] & 0xff000000 ) | ( m_packet.n_entry[ 2 ] & 0x00ffffff );
@@ -3005,7 +3305,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 					m_packet.n_entry[ 0 ] >> 24,
 					(int16_t)( m_packet.n_entry[ 1 ] & 0xffff ), (int16_t)( m_packet.n_entry[ 1 ] >> 16 ),
 					(int16_t)( m_packet.n_entry[ 2 ] & 0xffff ), (int16_t)( m_packet.n_entry[ 2 ] >> 16 ) );
-				FlatRectangle();
+				submit_draw( RENDER_FLAT_RECTANGLE );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3024,7 +3324,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 					(int16_t)( m_packet.n_entry[ 1 ] & 0xffff ), (int16_t)( m_packet.n_entry[ 1 ] >> 16 ),
 					m_packet.n_entry[ 3 ] & 0xffff, m_packet.n_entry[ 3 ] >> 16,
 					m_packet.n_entry[ 0 ], m_packet.n_entry[ 2 ] );
-				FlatTexturedRectangle();
+				submit_draw( RENDER_FLAT_TEXTURED_RECTANGLE );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3042,7 +3342,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 					m_packet.n_entry[ 0 ] >> 24,
 					(int16_t)( m_packet.n_entry[ 1 ] & 0xffff ), (int16_t)( m_packet.n_entry[ 1 ] >> 16 ),
 					m_packet.n_entry[ 0 ] & 0xffffff );
-				Dot();
+				submit_draw( RENDER_DOT );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3060,7 +3360,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 					m_packet.n_entry[ 0 ] >> 24,
 					(int16_t)( m_packet.n_entry[ 1 ] & 0xffff ), (int16_t)( m_packet.n_entry[ 1 ] >> 16 ),
 					m_packet.n_entry[ 0 ] & 0xffffff );
-				TexturedDot();
+				submit_draw( RENDER_TEXTURED_DOT );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3077,7 +3377,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			{
 				verboselog( *this, 1, "%02x: 16x16 rectangle %08x %08x\n", m_packet.n_entry[ 0 ] >> 24,
 					m_packet.n_entry[ 0 ], m_packet.n_entry[ 1 ] );
-				FlatRectangle8x8();
+				submit_draw( RENDER_FLAT_RECTANGLE_8X8 );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3093,7 +3393,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			{
 				verboselog( *this, 1, "%02x: 8x8 sprite %08x %08x %08x\n", m_packet.n_entry[ 0 ] >> 24,
 					m_packet.n_entry[ 0 ], m_packet.n_entry[ 1 ], m_packet.n_entry[ 2 ] );
-				Sprite8x8();
+				submit_draw( RENDER_SPRITE_8X8 );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3110,7 +3410,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			{
 				verboselog( *this, 1, "%02x: 16x16 rectangle %08x %08x\n", m_packet.n_entry[ 0 ] >> 24,
 					m_packet.n_entry[ 0 ], m_packet.n_entry[ 1 ] );
-				FlatRectangle16x16();
+				submit_draw( RENDER_FLAT_RECTANGLE_16X16 );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3126,7 +3426,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			{
 				verboselog( *this, 1, "%02x: 16x16 sprite %08x %08x %08x\n", m_packet.n_entry[ 0 ] >> 24,
 					m_packet.n_entry[ 0 ], m_packet.n_entry[ 1 ], m_packet.n_entry[ 2 ] );
-				Sprite16x16();
+				submit_draw( RENDER_SPRITE_16X16 );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3138,7 +3438,8 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				verboselog( *this, 1, "move image in frame buffer %08x %08x %08x %08x\n", m_packet.n_entry[ 0 ], m_packet.n_entry[ 1 ], m_packet.n_entry[ 2 ], m_packet.n_entry[ 3 ] );
-				MoveImage();
+				mark_dirty( vram_area( m_packet.n_entry[ 2 ] & 0xffff, m_packet.n_entry[ 2 ] >> 16, m_packet.n_entry[ 3 ] & 0xffff, m_packet.n_entry[ 3 ] >> 16 ) );
+				submit( RENDER_MOVE_IMAGE );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3149,6 +3450,11 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			}
 			else
 			{
+				if( n_vramx == 0 && n_vramy == 0 )
+				{
+					mark_dirty( vram_area( m_packet.n_entry[ 1 ] & 0xffff, m_packet.n_entry[ 1 ] >> 16, m_packet.n_entry[ 2 ] & 0xffff, m_packet.n_entry[ 2 ] >> 16 ) );
+				}
+
 				for( int n_pixel = 0; n_pixel < 2; n_pixel++ )
 				{
 					verboselog( *this, 2, "send image to framebuffer ( pixel %u,%u = %u )\n",
@@ -3156,8 +3462,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 						( n_vramy + ( m_packet.n_entry[ 1 ] >> 16 ) ) & 1023,
 						data & 0xffff );
 
-					uint16_t *p_vram = p_p_vram[ ( n_vramy + ( m_packet.n_entry[ 1 ] >> 16 ) ) & 1023 ] + ( ( n_vramx + m_packet.n_entry[ 1 ] ) & 1023 );
-					WRITE_PIXEL( data & 0xffff )
+					submit_pixel( ( n_vramx + m_packet.n_entry[ 1 ] ) & 1023, ( n_vramy + ( m_packet.n_entry[ 1 ] >> 16 ) ) & 1023, data & 0xffff );
 					n_vramx++;
 					if( n_vramx >= ( m_packet.n_entry[ 2 ] & 0xffff ) )
 					{
@@ -3186,68 +3491,49 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				verboselog( *this, 1, "%02x: copy image from frame buffer\n", m_packet.n_entry[ 0 ] >> 24 );
+				sync_dirty( vram_area( m_packet.n_entry[ 1 ] & 0xffff, m_packet.n_entry[ 1 ] >> 16, m_packet.n_entry[ 2 ] & 0xffff, m_packet.n_entry[ 2 ] >> 16 ) );
 				n_gpustatus |= ( 1L << 0x1b );
 			}
 			break;
 		case 0xe1:
 			verboselog( *this, 1, "%02x: draw mode %06x\n", m_packet.n_entry[ 0 ] >> 24,
 				m_packet.n_entry[ 0 ] & 0xffffff );
-			decode_tpage( m_packet.n_entry[ 0 ] & 0xffffff );
+			decode_tpage_status( m_packet.n_entry[ 0 ] & 0xffffff );
+			submit( RENDER_STATE );
 			break;
 		case 0xe2:
-			n_twy = ( ( ( m_packet.n_entry[ 0 ] >> 15 ) & 0x1f ) << 3 );
-			n_twx = ( ( ( m_packet.n_entry[ 0 ] >> 10 ) & 0x1f ) << 3 );
-			n_twh = 255 - ( ( ( m_packet.n_entry[ 0 ] >> 5 ) & 0x1f ) << 3 );
-			n_tww = 255 - ( ( m_packet.n_entry[ 0 ] & 0x1f ) << 3 );
 			verboselog( *this, 1, "%02x: texture window %u,%u %u,%u\n", m_packet.n_entry[ 0 ] >> 24,
-				n_twx, n_twy, n_tww, n_twh );
+				( ( m_packet.n_entry[ 0 ] >> 10 ) & 0x1f ) << 3, ( ( m_packet.n_entry[ 0 ] >> 15 ) & 0x1f ) << 3,
+				255 - ( ( m_packet.n_entry[ 0 ] & 0x1f ) << 3 ), 255 - ( ( ( m_packet.n_entry[ 0 ] >> 5 ) & 0x1f ) << 3 ) );
+			submit( RENDER_STATE );
 			break;
 		case 0xe3:
-			n_drawarea_x1 = m_packet.n_entry[ 0 ] & 1023;
-			if( m_n_gputype == 2 )
-			{
-				n_drawarea_y1 = ( m_packet.n_entry[ 0 ] >> 10 ) & 1023;
-			}
-			else
-			{
-				n_drawarea_y1 = ( m_packet.n_entry[ 0 ] >> 12 ) & 1023;
-			}
+			m_cpu_drawarea_x1 = drawarea_x( m_packet.n_entry[ 0 ] );
+			m_cpu_drawarea_y1 = drawarea_y( m_packet.n_entry[ 0 ] );
 			verboselog( *this, 1, "%02x: drawing area top left %d,%d\n", m_packet.n_entry[ 0 ] >> 24,
-				n_drawarea_x1, n_drawarea_y1 );
+				m_cpu_drawarea_x1, m_cpu_drawarea_y1 );
+			submit( RENDER_STATE );
 			break;
 		case 0xe4:
-			n_drawarea_x2 = m_packet.n_entry[ 0 ] & 1023;
-			if( m_n_gputype == 2 )
-			{
-				n_drawarea_y2 = ( m_packet.n_entry[ 0 ] >> 10 ) & 1023;
-			}
-			else
-			{
-				n_drawarea_y2 = ( m_packet.n_entry[ 0 ] >> 12 ) & 1023;
-			}
+			m_cpu_drawarea_x2 = drawarea_x( m_packet.n_entry[ 0 ] );
+			m_cpu_drawarea_y2 = drawarea_y( m_packet.n_entry[ 0 ] );
 			verboselog( *this, 1, "%02x: drawing area bottom right %d,%d\n", m_packet.n_entry[ 0 ] >> 24,
-				n_drawarea_x2, n_drawarea_y2 );
+				m_cpu_drawarea_x2, m_cpu_drawarea_y2 );
+			submit( RENDER_STATE );
 			break;
 		case 0xe5:
-			n_drawoffset_x = SINT11( m_packet.n_entry[ 0 ] & 2047 );
-			if( m_n_gputype == 2 )
-			{
-				n_drawoffset_y = SINT11( ( m_packet.n_entry[ 0 ] >> 11 ) & 2047 );
-			}
-			else
-			{
-				n_drawoffset_y = SINT11( ( m_packet.n_entry[ 0 ] >> 12 ) & 2047 );
-			}
+			m_cpu_drawoffset_x = drawoffset_x( m_packet.n_entry[ 0 ] );
+			m_cpu_drawoffset_y = drawoffset_y( m_packet.n_entry[ 0 ] );
 			verboselog( *this, 1, "%02x: drawing offset %d,%d\n", m_packet.n_entry[ 0 ] >> 24,
-				n_drawoffset_x, n_drawoffset_y );
+				m_cpu_drawoffset_x, m_cpu_drawoffset_y );
+			submit( RENDER_STATE );
 			break;
 		case 0xe6:
-			m_draw_stp = BIT( data, 0 );
-			m_check_stp = BIT( data, 1 );
 			// TODO: confirm status bits on real type 1 gpu
 			n_gpustatus &= ~( 3L << 0xb );
 			n_gpustatus |= ( data & 0x03 ) << 0xb;
 			verboselog( *this, 1, "mask setting %d\n", m_packet.n_entry[ 0 ] & 3 );
+			submit( RENDER_STATE );
 			break;
 		default:
 #if defined( MAME_DEBUG )
@@ -3345,33 +3631,33 @@ void psxgpu_device::write(offs_t offset, uint32_t data, uint32_t mem_mask)
 			case 0x03:
 				if( m_n_gputype == 2 )
 				{
-					n_gpuinfo = n_drawarea_x1 | ( n_drawarea_y1 << 10 );
+					n_gpuinfo = m_cpu_drawarea_x1 | ( m_cpu_drawarea_y1 << 10 );
 				}
 				else
 				{
-					n_gpuinfo = n_drawarea_x1 | ( n_drawarea_y1 << 12 );
+					n_gpuinfo = m_cpu_drawarea_x1 | ( m_cpu_drawarea_y1 << 12 );
 				}
 				verboselog( *this, 1, "GPU Info - Draw area top left %08x\n", n_gpuinfo );
 				break;
 			case 0x04:
 				if( m_n_gputype == 2 )
 				{
-					n_gpuinfo = n_drawarea_x2 | ( n_drawarea_y2 << 10 );
+					n_gpuinfo = m_cpu_drawarea_x2 | ( m_cpu_drawarea_y2 << 10 );
 				}
 				else
 				{
-					n_gpuinfo = n_drawarea_x2 | ( n_drawarea_y2 << 12 );
+					n_gpuinfo = m_cpu_drawarea_x2 | ( m_cpu_drawarea_y2 << 12 );
 				}
 				verboselog( *this, 1, "GPU Info - Draw area bottom right %08x\n", n_gpuinfo );
 				break;
 			case 0x05:
 				if( m_n_gputype == 2 )
 				{
-					n_gpuinfo = ( n_drawoffset_x & 2047 ) | ( ( n_drawoffset_y & 2047 ) << 11 );
+					n_gpuinfo = ( m_cpu_drawoffset_x & 2047 ) | ( ( m_cpu_drawoffset_y & 2047 ) << 11 );
 				}
 				else
 				{
-					n_gpuinfo = ( n_drawoffset_x & 2047 ) | ( ( n_drawoffset_y & 2047 ) << 12 );
+					n_gpuinfo = ( m_cpu_drawoffset_x & 2047 ) | ( ( m_cpu_drawoffset_y & 2047 ) << 12 );
 				}
 				verboselog( *this, 1, "GPU Info - Draw offset %08x\n", n_gpuinfo );
 				break;
@@ -3414,6 +3700,11 @@ void psxgpu_device::dma_read( uint32_t *p_n_psxram, uint32_t n_address, int32_t
 
 void psxgpu_device::gpu_read( uint32_t *p_ram, int32_t n_size )
 {
+	if( ( n_gpustatus & ( 1L << 0x1b ) ) != 0 )
+	{
+		sync_dirty( vram_area( m_packet.n_entry[ 1 ] & 0xffff, m_packet.n_entry[ 1 ] >> 16, m_packet.n_entry[ 2 ] & 0xffff, m_packet.n_entry[ 2 ] >> 16 ) );
+	}
+
 	while( n_size > 0 )
 	{
 		if( ( n_gpustatus & ( 1L << 0x1b ) ) != 0 )
@@ -3490,12 +3781,16 @@ void psxgpu_device::vblank(screen_device &screen, bool vblank_state)
 
 		n_gpustatus ^= ( 1L << 31 );
 		m_vblank_handler(1);
+
+		// don't let a partial batch sit until the next time the CPU looks at VRAM
+		flush_render();
 	}
 }
 
 void psxgpu_device::gpu_reset()
 {
 	verboselog( *this, 1, "reset gpu\n" );
+	sync_render();
 	n_gpu_buffer_offset = 0;
 	n_gpustatus = 0x14802000;
 	n_drawarea_x1 = 0;
@@ -3504,6 +3799,12 @@ void psxgpu_device::gpu_reset()
 	n_drawarea_y2 = 1023;
 	n_drawoffset_x = 0;
 	n_drawoffset_y = 0;
+	m_cpu_drawarea_x1 = n_drawarea_x1;
+	m_cpu_drawarea_y1 = n_drawarea_y1;
+	m_cpu_drawarea_x2 = n_drawarea_x2;
+	m_cpu_drawarea_y2 = n_drawarea_y2;
+	m_cpu_drawoffset_x = n_drawoffset_x;
+	m_cpu_drawoffset_y = n_drawoffset_y;
 	m_n_displaystartx = 0;
 	n_displaystarty = 0;
 	n_horiz_disstart = 0x260;
@@ -14,6 +14,9 @@
 
 #define PSXGPU_DEBUG_VIEWER ( 0 )
 
+// draw on a worker thread, waiting for it only when the CPU or the screen needs VRAM it may still be drawing into
+#define PSXGPU_THREADED ( 1 )
+
 DECLARE_DEVICE_TYPE(CXD8514Q,  cxd8514q_device)
 DECLARE_DEVICE_TYPE(CXD8538Q,  cxd8538q_device)
 DECLARE_DEVICE_TYPE(CXD8561Q,  cxd8561q_device)
@@ -49,6 +52,8 @@ protected:
 	psxgpu_device(const machine_config &mconfig, device_type type, const char *tag, device_t *owner, uint32_t clock);
 
 	virtual void device_start() override;
+	virtual void device_stop() override;
+	virtual void device_pre_save() override;
 	virtual void device_post_load() override;
 	virtual void device_reset() override;
 	virtual void device_config_complete() override;
@@ -196,8 +201,66 @@ private:
 		} TexturedDot;
 	};
 
+	// operations handed to the renderer
+	enum : uint8_t
+	{
+		RENDER_STATE,
+		RENDER_FRAME_BUFFER_RECTANGLE,
+		RENDER_FLAT_POLYGON,
+		RENDER_FLAT_TEXTURED_POLYGON,
+		RENDER_GOURAUD_POLYGON,
+		RENDER_GOURAUD_TEXTURED_POLYGON,
+		RENDER_MONOCHROME_LINE,
+		RENDER_GOURAUD_LINE,
+		RENDER_FLAT_RECTANGLE,
+		RENDER_FLAT_RECTANGLE_8X8,
+		RENDER_FLAT_RECTANGLE_16X16,
+		RENDER_FLAT_TEXTURED_RECTANGLE,
+		RENDER_SPRITE_8X8,
+		RENDER_SPRITE_16X16,
+		RENDER_DOT,
+		RENDER_TEXTURED_DOT,
+		RENDER_MOVE_IMAGE,
+		RENDER_WRITE_PIXELS
+	};
+
+	static constexpr unsigned PIXELS_PER_COMMAND = 8;
+	static constexpr unsigned COMMANDS_PER_BATCH = 256;
+	static constexpr unsigned MAX_PENDING_BATCHES = 64;
+
+	// a completed packet, or for RENDER_WRITE_PIXELS up to PIXELS_PER_COMMAND address/pixel pairs
+	struct render_command
+	{
+		uint8_t op;
+		uint8_t count;
+		PACKET packet;
+	};
+
+	struct render_batch
+	{
+		psxgpu_device *gpu;
+		std::vector<render_command> commands;
+	};
+
 	void updatevisiblearea();
 	void decode_tpage( uint32_t tpage );
+	void decode_tpage_status( uint32_t tpage );
+	void set_draw_state( uint32_t data );
+	uint32_t drawarea_x( uint32_t data ) const { return data & 1023; }
+	uint32_t drawarea_y( uint32_t data ) const { return ( data >> ( ( m_n_gputype == 2 ) ? 10 : 12 ) ) & 1023; }
+	int32_t drawoffset_x( uint32_t data ) const;
+	int32_t drawoffset_y( uint32_t data ) const;
+	void submit( uint8_t op, int count = 0 );
+	void submit_draw( uint8_t op, int count = 0 );
+	void submit_pixel( uint32_t x, uint32_t y, uint16_t pixel );
+	void execute( const render_command &command );
+	render_batch &current_batch();
+	void flush_render();
+	void sync_render();
+	rectangle vram_area( int32_t x, int32_t y, int32_t width, int32_t height ) const;
+	void mark_dirty( const rectangle &area );
+	void sync_dirty( const rectangle &area );
+	static void *render_callback( void *param, int threadid );
 	void FlatPolygon( int n_points );
 	void FlatTexturedPolygon( int n_points );
 	void GouraudPolygon( int n_points );
@@ -259,6 +322,20 @@ private:
 	bool m_check_stp;
 
 	PACKET m_packet;
+	PACKET m_draw_packet;
+
+	// drawing state as the CPU sees it; the renderer keeps its own copy in the fields above
+	uint32_t m_cpu_drawarea_x1;
+	uint32_t m_cpu_drawarea_y1;
+	uint32_t m_cpu_drawarea_x2;
+	uint32_t m_cpu_drawarea_y2;
+	int32_t m_cpu_drawoffset_x;
+	int32_t m_cpu_drawoffset_y;
+
+	osd_work_queue *m_render_queue;
+	std::vector<std::unique_ptr<render_batch>> m_batches;
+	unsigned m_batch;
+	rectangle m_dirty;
 
 	uint16_t *p_p_vram[ 1024 ];
 
@@ -295,6 +295,7 @@ void saturn_state::stv_set_framebuffer_config( void )
 
 void saturn_state::saturn_vdp1_regs_w(offs_t offset, uint16_t data, uint16_t mem_mask)
 {
+	stv_vdp1_sync();
 	COMBINE_DATA(&m_vdp1_regs[offset]);
 
 	switch(offset)
@@ -347,6 +348,7 @@ void saturn_state::saturn_vdp1_vram_w(offs_t offset, uint32_t data, uint32_t mem
 {
 	uint8_t *vdp1 = m_vdp1.gfx_decode.get();
 
+	stv_vdp1_sync();
 	COMBINE_DATA (&m_vdp1_vram[offset]);
 
 //  if (((offset * 4) > 0xdf) && ((offset * 4) < 0x140))
@@ -365,6 +367,7 @@ void saturn_state::saturn_vdp1_vram_w(offs_t offset, uint32_t data, uint32_t mem
 void saturn_state::saturn_vdp1_framebuffer0_w(offs_t offset, uint32_t data, uint32_t mem_mask)
 {
 	//popmessage ("STV VDP1 Framebuffer 0 WRITE offset %08x data %08x",offset, data);
+	stv_vdp1_sync();
 	if ( STV_VDP1_TVM & 1 )
 	{
 		/* 8-bit mode */
@@ -408,6 +411,7 @@ uint32_t saturn_state::saturn_vdp1_framebuffer0_r(offs_t offset, uint32_t mem_ma
 {
 	uint32_t result = 0;
 	//popmessage ("STV VDP1 Framebuffer 0 READ offset %08x",offset);
+	stv_vdp1_sync();
 	if ( STV_VDP1_TVM & 1 )
 	{
 		/* 8-bit mode */
@@ -1421,12 +1425,12 @@ void saturn_state::vdp1_fill_quad(const rectangle &cliprect, int patterndata, in
 
 int saturn_state::x2s(int v)
 {
-	return (int32_t)(int16_t)v + m_vdp1.local_x;
+	return (int32_t)(int16_t)v + m_vdp1.draw_local_x;
 }
 
 int saturn_state::y2s(int v)
 {
-	return (int32_t)(int16_t)v + m_vdp1.local_y;
+	return (int32_t)(int16_t)v + m_vdp1.draw_local_y;
 }
 
 void saturn_state::stv_vdp1_draw_line(const rectangle &cliprect)
@@ -1822,7 +1826,7 @@ void saturn_state::stv_vdp1_process_list( void )
 	int position;
 	int spritecount;
 	int vdp1_nest;
-	rectangle *cliprect;
+	bool threaded = m_vdp1_queue != nullptr;
 
 	spritecount = 0;
 	position = 0;
@@ -1831,7 +1835,7 @@ void saturn_state::stv_vdp1_process_list( void )
 
 	vdp1_nest = -1;
 
-	stv_clear_gouraud_shading();
+	m_vdp1_commands.clear();
 
 	/*Set CEF bit to 0*/
 	CEF_0;
@@ -1959,65 +1963,31 @@ void saturn_state::stv_vdp1_process_list( void )
 		/* continue to draw this sprite only if the command wasn't to skip it */
 		if (draw_this_sprite ==1)
 		{
-			if ( stv2_current_sprite.CMDPMOD & 0x0400 )
-			{
-				//if(stv2_current_sprite.CMDPMOD & 0x0200) /* TODO: Bio Hazard inventory screen uses outside cliprect */
-				//  cliprect = &m_vdp1.system_cliprect;
-				//else
-					cliprect = &m_vdp1.user_cliprect;
-			}
-			else
-			{
-				cliprect = &m_vdp1.system_cliprect;
-			}
-
-			stv_vdp1_set_drawpixel();
-
 			switch (stv2_current_sprite.CMDCTRL & 0x000f)
 			{
 				case 0x0000:
-					if (VDP1_LOG) logerror ("Sprite List Normal Sprite (%d %d)\n",stv2_current_sprite.CMDXA,stv2_current_sprite.CMDYA);
-					stv2_current_sprite.ispoly = 0;
-					stv_vdp1_draw_normal_sprite(*cliprect, 0);
-					break;
-
 				case 0x0001:
-					if (VDP1_LOG) logerror ("Sprite List Scaled Sprite (%d %d)\n",stv2_current_sprite.CMDXA,stv2_current_sprite.CMDYA);
-					stv2_current_sprite.ispoly = 0;
-					stv_vdp1_draw_scaled_sprite(*cliprect);
-					break;
-
 				case 0x0002:
-				case 0x0003: // used by Hardcore 4x4
-					if (VDP1_LOG) logerror ("Sprite List Distorted Sprite\n");
-					if (VDP1_LOG) logerror ("(A: %d %d)\n",stv2_current_sprite.CMDXA,stv2_current_sprite.CMDYA);
-					if (VDP1_LOG) logerror ("(B: %d %d)\n",stv2_current_sprite.CMDXB,stv2_current_sprite.CMDYB);
-					if (VDP1_LOG) logerror ("(C: %d %d)\n",stv2_current_sprite.CMDXC,stv2_current_sprite.CMDYC);
-					if (VDP1_LOG) logerror ("(D: %d %d)\n",stv2_current_sprite.CMDXD,stv2_current_sprite.CMDYD);
-					if (VDP1_LOG) logerror ("CMDPMOD = %04x\n",stv2_current_sprite.CMDPMOD);
-
-					stv2_current_sprite.ispoly = 0;
-					stv_vdp1_draw_distorted_sprite(*cliprect);
-					break;
-
+				case 0x0003:
 				case 0x0004:
-					if (VDP1_LOG) logerror ("Sprite List Polygon\n");
-					stv2_current_sprite.ispoly = 1;
-					stv_vdp1_draw_distorted_sprite(*cliprect);
-					break;
-
 				case 0x0005:
-//              case 0x0007: // mirror? Baroque uses it, crashes for whatever reason
-					if (VDP1_LOG) logerror ("Sprite List Polyline\n");
-					stv2_current_sprite.ispoly = 1;
-					stv_vdp1_draw_poly_line(*cliprect);
-					break;
-
 				case 0x0006:
-					if (VDP1_LOG) logerror ("Sprite List Line\n");
-					stv2_current_sprite.ispoly = 1;
-					stv_vdp1_draw_line(*cliprect);
+				{
+					m_vdp1_commands.emplace_back();
+					stv_vdp1_queued_command &cmd = m_vdp1_commands.back();
+					cmd.sprite = stv2_current_sprite;
+					//if(stv2_current_sprite.CMDPMOD & 0x0200) /* TODO: Bio Hazard inventory screen uses outside cliprect */
+					//  cmd.cliprect = m_vdp1.system_cliprect;
+					//else
+					cmd.cliprect = (stv2_current_sprite.CMDPMOD & 0x0400) ? m_vdp1.user_cliprect : m_vdp1.system_cliprect;
+					cmd.local_x = m_vdp1.local_x;
+					cmd.local_y = m_vdp1.local_y;
+
+					// the illegal sprite mode draws random pixels, which has to happen on this thread
+					if (((stv2_current_sprite.CMDCTRL & 0x000c) == 0) && ((stv2_current_sprite.CMDPMOD & 0x0038) == 0x0030))
+						threaded = false;
 					break;
+				}
 
 				case 0x0008:
 //              case 0x000b: // mirror? Bug 2
@@ -2052,6 +2022,15 @@ void saturn_state::stv_vdp1_process_list( void )
 	end:
 	m_vdp1.copr = (position * 0x20) >> 3;
 
+	/* the list is drawn from the snapshot above, so it can go on while the CPUs run; anything that touches VDP1 waits for it */
+	if (!m_vdp1_commands.empty())
+	{
+		if (threaded && osd_work_item_queue(m_vdp1_queue, stv_vdp1_draw_static, this, 0))
+			m_vdp1_drawing = true;
+		else
+			stv_vdp1_draw_commands();
+	}
+
 
 	/* TODO: what's the exact formula? Guess it should be a mix between number of pixels written and actual command data fetched. */
 	// if spritecount = 10000 don't send a vdp1 draw end
@@ -2061,6 +2040,85 @@ void saturn_state::stv_vdp1_process_list( void )
 	if (VDP1_LOG) logerror ("End of list processing!\n");
 }
 
+void saturn_state::stv_vdp1_draw_commands( void )
+{
+	stv_clear_gouraud_shading();
+
+	for (const stv_vdp1_queued_command &cmd : m_vdp1_commands)
+	{
+		stv2_current_sprite = cmd.sprite;
+		m_vdp1.draw_local_x = cmd.local_x;
+		m_vdp1.draw_local_y = cmd.local_y;
+
+		stv_vdp1_set_drawpixel();
+
+		switch (stv2_current_sprite.CMDCTRL & 0x000f)
+		{
+			case 0x0000:
+				if (VDP1_LOG) logerror ("Sprite List Normal Sprite (%d %d)\n",stv2_current_sprite.CMDXA,stv2_current_sprite.CMDYA);
+				stv2_current_sprite.ispoly = 0;
+				stv_vdp1_draw_normal_sprite(cmd.cliprect, 0);
+				break;
+
+			case 0x0001:
+				if (VDP1_LOG) logerror ("Sprite List Scaled Sprite (%d %d)\n",stv2_current_sprite.CMDXA,stv2_current_sprite.CMDYA);
+				stv2_current_sprite.ispoly = 0;
+				stv_vdp1_draw_scaled_sprite(cmd.cliprect);
+				break;
+
+			case 0x0002:
+			case 0x0003: // used by Hardcore 4x4
+				if (VDP1_LOG) logerror ("Sprite List Distorted Sprite\n");
+				if (VDP1_LOG) logerror ("(A: %d %d)\n",stv2_current_sprite.CMDXA,stv2_current_sprite.CMDYA);
+				if (VDP1_LOG) logerror ("(B: %d %d)\n",stv2_current_sprite.CMDXB,stv2_current_sprite.CMDYB);
+				if (VDP1_LOG) logerror ("(C: %d %d)\n",stv2_current_sprite.CMDXC,stv2_current_sprite.CMDYC);
+				if (VDP1_LOG) logerror ("(D: %d %d)\n",stv2_current_sprite.CMDXD,stv2_current_sprite.CMDYD);
+				if (VDP1_LOG) logerror ("CMDPMOD = %04x\n",stv2_current_sprite.CMDPMOD);
+
+				stv2_current_sprite.ispoly = 0;
+				stv_vdp1_draw_distorted_sprite(cmd.cliprect);
+				break;
+
+			case 0x0004:
+				if (VDP1_LOG) logerror ("Sprite List Polygon\n");
+				stv2_current_sprite.ispoly = 1;
+				stv_vdp1_draw_distorted_sprite(cmd.cliprect);
+				break;
+
+			case 0x0005:
+//          case 0x0007: // mirror? Baroque uses it, crashes for whatever reason
+				if (VDP1_LOG) logerror ("Sprite List Polyline\n");
+				stv2_current_sprite.ispoly = 1;
+				stv_vdp1_draw_poly_line(cmd.cliprect);
+				break;
+
+			case 0x0006:
+				if (VDP1_LOG) logerror ("Sprite List Line\n");
+				stv2_current_sprite.ispoly = 1;
+				stv_vdp1_draw_line(cmd.cliprect);
+				break;
+		}
+	}
+}
+
+void *saturn_state::stv_vdp1_draw_static(void *param, int threadid)
+{
+	reinterpret_cast<saturn_state *>(param)->stv_vdp1_draw_commands();
+	return nullptr;
+}
+
+/* wait for the worker to finish drawing the current list */
+void saturn_state::stv_vdp1_sync( void )
+{
+	if (!m_vdp1_drawing)
+		return;
+
+	while (!osd_work_queue_wait(m_vdp1_queue, osd_ticks_per_second()))
+	{
+	}
+	m_vdp1_drawing = false;
+}
+
 void saturn_state::video_update_vdp1( void )
 {
 	int framebuffer_changed = 0;
@@ -2080,6 +2138,8 @@ void saturn_state::video_update_vdp1( void )
 //          fclose(fp);
 //      }
 //  }
+	stv_vdp1_sync();
+
 	if (VDP1_LOG) logerror("video_update_vdp1 called\n");
 	if (VDP1_LOG) logerror( "FBCR = %0x, accessed = %d\n", STV_VDP1_FBCR, m_vdp1.fbcr_accessed );
 
@@ -2162,6 +2222,8 @@ void saturn_state::stv_vdp1_state_save_postload( void )
 	int offset;
 	uint32_t data;
 
+	stv_vdp1_sync();
+
 	m_vdp1.framebuffer_mode = -1;
 	m_vdp1.framebuffer_double_interlace = -1;
 
@@ -2204,6 +2266,12 @@ int saturn_state::stv_vdp1_start ( void )
 	m_vdp1.system_cliprect.set(0, 0, 0, 0);
 	/* Kidou Senshi Z Gundam - Zenpen Zeta no Kodou loves to use the user cliprect vars in an undefined state ... */
 	m_vdp1.user_cliprect.set(0, 512, 0, 256);
+	m_vdp1.local_x = m_vdp1.local_y = 0;
+	m_vdp1.draw_local_x = m_vdp1.draw_local_y = 0;
+
+	m_vdp1_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_HIGH_FREQ);
+	m_vdp1_drawing = false;
+	machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&saturn_state::stv_vdp1_exit, this));
 
 	// save state
 	save_pointer(NAME(m_vdp1_regs), 0x020/2);
@@ -2214,6 +2282,15 @@ int saturn_state::stv_vdp1_start ( void )
 	save_item(NAME(m_vdp1.framebuffer_clear_on_next_frame));
 	save_item(NAME(m_vdp1.local_x));
 	save_item(NAME(m_vdp1.local_y));
+	machine().save().register_presave(save_prepost_delegate(FUNC(saturn_state::stv_vdp1_sync), this));
 	machine().save().register_postload(save_prepost_delegate(FUNC(saturn_state::stv_vdp1_state_save_postload), this));
 	return 0;
 }
+
+void saturn_state::stv_vdp1_exit( void )
+{
+	stv_vdp1_sync();
+	if (m_vdp1_queue)
+		osd_work_queue_free(m_vdp1_queue);
+	m_vdp1_queue = nullptr;
+}
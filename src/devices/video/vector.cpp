@@ -158,6 +158,23 @@ uint32_t vector_device::screen_update(screen_device &screen, bitmap_rgb32 &bitma
 	int lastx = 0;
 	int lasty = 0;
 
+	// a line that the next one may carry on in the same direction
+	bool pending = false;
+	render_bounds pending_coords;
+	float pending_width = 0.0f;
+	rgb_t pending_color;
+	int pending_dx = 0, pending_dy = 0;
+	auto flush_pending = [&] ()
+	{
+		if (pending)
+			screen.container().add_line(
+				pending_coords.x0, pending_coords.y0, pending_coords.x1, pending_coords.y1,
+				pending_width,
+				pending_color,
+				flags);
+		pending = false;
+	};
+
 	curpoint = m_vector_list.get();
 
 	screen.container().empty();
@@ -189,18 +206,41 @@ uint32_t vector_device::screen_update(screen_device &screen, bitmap_rgb32 &bitma
 
 		if (curpoint->intensity != 0)
 		{
-			screen.container().add_line(
-				coords.x0, coords.y0, coords.x1, coords.y1,
-				beam_width,
-				(curpoint->intensity << 24) | (curpoint->col & 0xffffff),
-				flags);
+			rgb_t color = (curpoint->intensity << 24) | (curpoint->col & 0xffffff);
+			int dx = curpoint->x - lastx;
+			int dy = curpoint->y - lasty;
+
+			// Long strokes often arrive as runs of short segments; join
+			// ones that carry straight on with the same beam, so there
+			// are fewer lines for the renderer to clip and draw.
+			if (pending && color == pending_color && beam_width == pending_width
+					&& (dx || dy) && (pending_dx || pending_dy)
+					&& s64(dx) * pending_dy == s64(dy) * pending_dx
+					&& s64(dx) * pending_dx + s64(dy) * pending_dy > 0)
+			{
+				pending_coords.x1 = coords.x1;
+				pending_coords.y1 = coords.y1;
+			}
+			else
+			{
+				flush_pending();
+				pending = true;
+				pending_coords = coords;
+				pending_width = beam_width;
+				pending_color = color;
+				pending_dx = dx;
+				pending_dy = dy;
+			}
 		}
+		else
+			flush_pending();
 
 		lastx = curpoint->x;
 		lasty = curpoint->y;
 
 		curpoint++;
 	}
+	flush_pending();
 
 	return 0;
 }
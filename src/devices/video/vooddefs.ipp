@@ -2631,9 +2631,8 @@ inline bool ATTR_FORCE_INLINE voodoo_device::combineColor(voodoo_device *vd, sta
 
 #define RASTERIZER(name, TMUS, FBZCOLORPATH, FBZMODE, ALPHAMODE, FOGMODE, TEXMODE0, TEXMODE1) \
 																				\
-void voodoo_device::raster_##name(void *destbase, int32_t y, const poly_extent *extent, const void *extradata, int threadid) \
+void voodoo_device::raster_##name(void *destbase, int32_t y, const poly_extent *extent, const poly_extra_data *extra, int threadid) \
 {                                                                               \
-	const poly_extra_data *extra = (const poly_extra_data *)extradata;          \
 	voodoo_device *vd = extra->device; \
 	stats_block *stats = &vd->thread_stats[threadid];                            \
 	DECLARE_DITHER_POINTERS;                                                    \
@@ -721,43 +721,6 @@ const char *const banshee_agp_reg_name[] =
 } // anonymous namespace
 
 
-struct voodoo_device::poly_extra_data
-{
-	voodoo_device * device;
-	raster_info *       info;                   // pointer to rasterizer information
-
-	int16_t             ax, ay;                 // vertex A x,y (12.4)
-	int32_t             startr, startg, startb, starta; // starting R,G,B,A (12.12)
-	int32_t             startz;                 // starting Z (20.12)
-	int64_t             startw;                 // starting W (16.32)
-	int32_t             drdx, dgdx, dbdx, dadx; // delta R,G,B,A per X
-	int32_t             dzdx;                   // delta Z per X
-	int64_t             dwdx;                   // delta W per X
-	int32_t             drdy, dgdy, dbdy, dady; // delta R,G,B,A per Y
-	int32_t             dzdy;                   // delta Z per Y
-	int64_t             dwdy;                   // delta W per Y
-
-	int64_t             starts0, startt0;       // starting S,T (14.18)
-	int64_t             startw0;                // starting W (2.30)
-	int64_t             ds0dx, dt0dx;           // delta S,T per X
-	int64_t             dw0dx;                  // delta W per X
-	int64_t             ds0dy, dt0dy;           // delta S,T per Y
-	int64_t             dw0dy;                  // delta W per Y
-	int32_t             lodbase0;               // used during rasterization
-
-	int64_t             starts1, startt1;       // starting S,T (14.18)
-	int64_t             startw1;                // starting W (2.30)
-	int64_t             ds1dx, dt1dx;           // delta S,T per X
-	int64_t             dw1dx;                  // delta W per X
-	int64_t             ds1dy, dt1dy;           // delta S,T per Y
-	int64_t             dw1dy;                  // delta W per Y
-	int32_t             lodbase1;               // used during rasterization
-
-	uint16_t            dither[16];             // dither matrix, for fastfill
-};
-
-
-
 /*************************************
  *
  *  Statics
@@ -2989,21 +2952,21 @@ int32_t voodoo_device::register_w(voodoo_device *vd, offs_t offset, uint32_t dat
 
 		/* mask off invalid bits for different cards */
 		case fbzColorPath:
-			poly_wait(vd->poly, vd->regnames[regnum]);
+			vd->poly->wait(vd->regnames[regnum]);
 			if (vd->vd_type < TYPE_VOODOO_2)
 				data &= 0x0fffffff;
 			if (chips & 1) vd->reg[fbzColorPath].u = data;
 			break;
 
 		case fbzMode:
-			poly_wait(vd->poly, vd->regnames[regnum]);
+			vd->poly->wait(vd->regnames[regnum]);
 			if (vd->vd_type < TYPE_VOODOO_2)
 				data &= 0x001fffff;
 			if (chips & 1) vd->reg[fbzMode].u = data;
 			break;
 
 		case fogMode:
-			poly_wait(vd->poly, vd->regnames[regnum]);
+			vd->poly->wait(vd->regnames[regnum]);
 			if (vd->vd_type < TYPE_VOODOO_2)
 				data &= 0x0000003f;
 			if (chips & 1) vd->reg[fogMode].u = data;
@@ -3032,7 +2995,7 @@ int32_t voodoo_device::register_w(voodoo_device *vd, offs_t offset, uint32_t dat
 
 		/* other commands */
 		case nopCMD:
-			poly_wait(vd->poly, vd->regnames[regnum]);
+			vd->poly->wait(vd->regnames[regnum]);
 			if (data & 1)
 				vd->reset_counters();
 			if (data & 2)
@@ -3044,12 +3007,12 @@ int32_t voodoo_device::register_w(voodoo_device *vd, offs_t offset, uint32_t dat
 			break;
 
 		case swapbufferCMD:
-			poly_wait(vd->poly, vd->regnames[regnum]);
+			vd->poly->wait(vd->regnames[regnum]);
 			cycles = swapbuffer(vd, data);
 			break;
 
 		case userIntrCMD:
-			poly_wait(vd->poly, vd->regnames[regnum]);
+			vd->poly->wait(vd->regnames[regnum]);
 			// Bit 5 of intrCtrl enables user interrupts
 			if (vd->reg[intrCtrl].u & 0x20) {
 				// Bits 19:12 are set to cmd 9:2, bit 11 is user interrupt flag
@@ -3066,7 +3029,7 @@ int32_t voodoo_device::register_w(voodoo_device *vd, offs_t offset, uint32_t dat
 		case clutData:
 			if (vd->vd_type <= TYPE_VOODOO_2 && (chips & 1))
 			{
-				poly_wait(vd->poly, vd->regnames[regnum]);
+				vd->poly->wait(vd->regnames[regnum]);
 				if (!FBIINIT1_VIDEO_TIMING_RESET(vd->reg[fbiInit1].u))
 				{
 					int index = data >> 24;
@@ -3085,7 +3048,7 @@ int32_t voodoo_device::register_w(voodoo_device *vd, offs_t offset, uint32_t dat
 		case dacData:
 			if (vd->vd_type <= TYPE_VOODOO_2 && (chips & 1))
 			{
-				poly_wait(vd->poly, vd->regnames[regnum]);
+				vd->poly->wait(vd->regnames[regnum]);
 				if (!(data & 0x800))
 					vd->dac.data_w((data >> 8) & 7, data & 0xff);
 				else
@@ -3100,7 +3063,7 @@ int32_t voodoo_device::register_w(voodoo_device *vd, offs_t offset, uint32_t dat
 		case videoDimensions:
 			if (vd->vd_type <= TYPE_VOODOO_2 && (chips & 1))
 			{
-				poly_wait(vd->poly, vd->regnames[regnum]);
+				vd->poly->wait(vd->regnames[regnum]);
 				vd->reg[regnum].u = data;
 				if (vd->reg[hSync].u != 0 && vd->reg[vSync].u != 0 && vd->reg[videoDimensions].u != 0)
 				{
@@ -3190,7 +3153,7 @@ int32_t voodoo_device::register_w(voodoo_device *vd, offs_t offset, uint32_t dat
 
 		/* fbiInit0 can only be written if initEnable says we can -- Voodoo/Voodoo2 only */
 		case fbiInit0:
-			poly_wait(vd->poly, vd->regnames[regnum]);
+			vd->poly->wait(vd->regnames[regnum]);
 			if (vd->vd_type <= TYPE_VOODOO_2 && (chips & 1) && INITEN_ENABLE_HW_INIT(vd->pci.init_enable))
 			{
 				vd->reg[fbiInit0].u = data;
@@ -3214,7 +3177,7 @@ int32_t voodoo_device::register_w(voodoo_device *vd, offs_t offset, uint32_t dat
 		case fbiInit1:
 		case fbiInit2:
 		case fbiInit4:
-			poly_wait(vd->poly, vd->regnames[regnum]);
+			vd->poly->wait(vd->regnames[regnum]);
 			if (vd->vd_type <= TYPE_VOODOO_2 && (chips & 1) && INITEN_ENABLE_HW_INIT(vd->pci.init_enable))
 			{
 				vd->reg[regnum].u = data;
@@ -3224,7 +3187,7 @@ int32_t voodoo_device::register_w(voodoo_device *vd, offs_t offset, uint32_t dat
 			break;
 
 		case fbiInit3:
-			poly_wait(vd->poly, vd->regnames[regnum]);
+			vd->poly->wait(vd->regnames[regnum]);
 			if (vd->vd_type <= TYPE_VOODOO_2 && (chips & 1) && INITEN_ENABLE_HW_INIT(vd->pci.init_enable))
 			{
 				vd->reg[regnum].u = data;
@@ -3238,7 +3201,7 @@ int32_t voodoo_device::register_w(voodoo_device *vd, offs_t offset, uint32_t dat
 /*      case swapPending: -- Banshee */
 			if (vd->vd_type == TYPE_VOODOO_2 && (chips & 1) && INITEN_ENABLE_HW_INIT(vd->pci.init_enable))
 			{
-				poly_wait(vd->poly, vd->regnames[regnum]);
+				vd->poly->wait(vd->regnames[regnum]);
 				vd->reg[regnum].u = data;
 				vd->fbi.cmdfifo[0].enable = FBIINIT7_CMDFIFO_ENABLE(data);
 				vd->fbi.cmdfifo[0].count_holes = !FBIINIT7_DISABLE_CMDFIFO_HOLES(data);
@@ -3251,7 +3214,7 @@ int32_t voodoo_device::register_w(voodoo_device *vd, offs_t offset, uint32_t dat
 		case cmdFifoBaseAddr:
 			if (vd->vd_type == TYPE_VOODOO_2 && (chips & 1))
 			{
-				poly_wait(vd->poly, vd->regnames[regnum]);
+				vd->poly->wait(vd->regnames[regnum]);
 				vd->reg[regnum].u = data;
 				vd->fbi.cmdfifo[0].base = (data & 0x3ff) << 12;
 				vd->fbi.cmdfifo[0].end = (((data >> 16) & 0x3ff) + 1) << 12;
@@ -3327,7 +3290,7 @@ int32_t voodoo_device::register_w(voodoo_device *vd, offs_t offset, uint32_t dat
 		case nccTable+9:
 		case nccTable+10:
 		case nccTable+11:
-			poly_wait(vd->poly, vd->regnames[regnum]);
+			vd->poly->wait(vd->regnames[regnum]);
 			if (chips & 2) vd->tmu[0].ncc[0].write(regnum - nccTable, data);
 			if (chips & 4) vd->tmu[1].ncc[0].write(regnum - nccTable, data);
 			break;
@@ -3344,7 +3307,7 @@ int32_t voodoo_device::register_w(voodoo_device *vd, offs_t offset, uint32_t dat
 		case nccTable+21:
 		case nccTable+22:
 		case nccTable+23:
-			poly_wait(vd->poly, vd->regnames[regnum]);
+			vd->poly->wait(vd->regnames[regnum]);
 			if (chips & 2) vd->tmu[0].ncc[1].write(regnum - (nccTable+12), data);
 			if (chips & 4) vd->tmu[1].ncc[1].write(regnum - (nccTable+12), data);
 			break;
@@ -3382,7 +3345,7 @@ int32_t voodoo_device::register_w(voodoo_device *vd, offs_t offset, uint32_t dat
 		case fogTable+29:
 		case fogTable+30:
 		case fogTable+31:
-			poly_wait(vd->poly, vd->regnames[regnum]);
+			vd->poly->wait(vd->regnames[regnum]);
 			if (chips & 1)
 			{
 				int base = 2 * (regnum - fogTable);
@@ -3404,7 +3367,7 @@ int32_t voodoo_device::register_w(voodoo_device *vd, offs_t offset, uint32_t dat
 			if (chips & 2)
 			{
 				if (vd->tmu[0].reg[regnum].u != data) {
-					poly_wait(vd->poly, vd->regnames[regnum]);
+					vd->poly->wait(vd->regnames[regnum]);
 					vd->tmu[0].regdirty = true;
 					vd->tmu[0].reg[regnum].u = data;
 				}
@@ -3412,7 +3375,7 @@ int32_t voodoo_device::register_w(voodoo_device *vd, offs_t offset, uint32_t dat
 			if (chips & 4)
 			{
 				if (vd->tmu[1].reg[regnum].u != data) {
-					poly_wait(vd->poly, vd->regnames[regnum]);
+					vd->poly->wait(vd->regnames[regnum]);
 					vd->tmu[1].regdirty = true;
 					vd->tmu[1].reg[regnum].u = data;
 				}
@@ -3436,7 +3399,7 @@ int32_t voodoo_device::register_w(voodoo_device *vd, offs_t offset, uint32_t dat
 		case color0:
 		case clipLowYHighY:
 		case clipLeftRight:
-			poly_wait(vd->poly, vd->regnames[regnum]);
+			vd->poly->wait(vd->regnames[regnum]);
 			/* fall through to default implementation */
 
 		/* by default, just feed the data to the chips */
@@ -3775,7 +3738,7 @@ int32_t voodoo_device::lfb_w(voodoo_device* vd, offs_t offset, uint32_t data, ui
 		COMPUTE_DITHER_POINTERS_NO_DITHER_VAR(vd->reg[fbzMode].u, y);
 
 		/* wait for any outstanding work to finish */
-		poly_wait(vd->poly, "LFB Write");
+		vd->poly->wait("LFB Write");
 
 		/* loop over up to two pixels */
 		for (pix = 0; mask; pix++)
@@ -3938,7 +3901,7 @@ int32_t voodoo_device::lfb_w(voodoo_device* vd, offs_t offset, uint32_t data, ui
 					applyFogging(vd, vd->reg[fbzMode].u, vd->reg[fogMode].u, vd->reg[fbzColorPath].u, x, dither4, biasdepth, color, iterz, iterw, iterargb);
 
 				/* wait for any outstanding work to finish */
-				poly_wait(vd->poly, "LFB Write");
+				vd->poly->wait("LFB Write");
 
 				/* perform alpha blending */
 				if (ALPHAMODE_ALPHABLEND(vd->reg[alphaMode].u))
@@ -3981,7 +3944,7 @@ int32_t voodoo_device::texture_w(voodoo_device *vd, offs_t offset, uint32_t data
 		fatalerror("Texture direct write!\n");
 
 	/* wait for any outstanding work to finish */
-	poly_wait(vd->poly, "Texture write");
+	vd->poly->wait("Texture write");
 
 	/* update texture info if dirty */
 	if (t->regdirty)
@@ -4669,7 +4632,7 @@ static uint32_t lfb_r(voodoo_device *vd, offs_t offset, bool lfb_3d)
 	}
 
 	/* wait for any outstanding work to finish */
-	poly_wait(vd->poly, "LFB read");
+	vd->poly->wait("LFB read");
 
 	/* compute the data */
 	data = buffer[bufoffs + 0] | (buffer[bufoffs + 1] << 16);
@@ -5631,7 +5594,7 @@ void voodoo_device::device_start()
 	m_pciint.resolve();
 
 	/* create a multiprocessor work queue */
-	poly = poly_alloc(machine(), 64, sizeof(poly_extra_data), 0);
+	poly = std::make_unique<voodoo_renderer>(machine());
 	thread_stats = std::make_unique<stats_block[]>(WORK_MAX_THREADS);
 
 	/* create a table of precomputed 1/n and log2(n) values */
@@ -5870,13 +5833,15 @@ int32_t voodoo_device::fastfill(voodoo_device *vd)
 	/* iterate over blocks of extents */
 	for (y = sy; y < ey; y += ARRAY_LENGTH(extents))
 	{
-		poly_extra_data *extra = (poly_extra_data *)poly_get_extra_data(vd->poly);
+		poly_extra_data &extra = vd->poly->object_data_alloc();
 		int count = (std::min)(ey - y, int(ARRAY_LENGTH(extents)));
 
-		extra->device = vd;
-		memcpy(extra->dither, dithermatrix, sizeof(extra->dither));
+		extra.device = vd;
+		extra.info = nullptr;
+		extra.destbase = drawbuf;
+		memcpy(extra.dither, dithermatrix, sizeof(extra.dither));
 
-		pixels += poly_render_triangle_custom(vd->poly, drawbuf, global_cliprect, raster_fastfill, y, count, extents);
+		pixels += vd->poly->render_triangle_custom(global_cliprect, voodoo_renderer::render_delegate(&voodoo_device::render_fastfill, vd), y, count, extents);
 	}
 
 	/* 2 pixels per clock */
@@ -5964,7 +5929,7 @@ int32_t voodoo_device::triangle(voodoo_device *vd)
 	}
 
 	/* wait for any outstanding work to finish */
-//  poly_wait(vd->poly, "triangle");
+//  vd->poly->wait("triangle");
 
 	/* determine the draw buffer */
 	destbuf = (vd->vd_type >= TYPE_VOODOO_BANSHEE) ? 1 : FBZMODE_DRAW_BUFFER(vd->reg[fbzMode].u);
@@ -6215,10 +6180,10 @@ int32_t voodoo_device::setup_and_draw_triangle(voodoo_device *vd)
 
 int32_t voodoo_device::triangle_create_work_item(voodoo_device* vd, uint16_t *drawbuf, int texcount)
 {
-	poly_extra_data *extra = (poly_extra_data *)poly_get_extra_data(vd->poly);
+	poly_extra_data *extra = &vd->poly->object_data_alloc();
 
 	raster_info *info = find_rasterizer(vd, texcount);
-	poly_vertex vert[3];
+	voodoo_renderer::vertex_t vert[3];
 
 	/* fill in the vertex data */
 	vert[0].x = (float)vd->fbi.ax * (1.0f / 16.0f);
@@ -6231,6 +6196,7 @@ int32_t voodoo_device::triangle_create_work_item(voodoo_device* vd, uint16_t *dr
 	/* fill in the extra data */
 	extra->device = vd;
 	extra->info = info;
+	extra->destbase = drawbuf;
 
 	/* fill in triangle parameters */
 	extra->ax = vd->fbi.ax;
@@ -6288,7 +6254,7 @@ int32_t voodoo_device::triangle_create_work_item(voodoo_device* vd, uint16_t *dr
 
 	/* farm the rasterization out to other threads */
 	info->polys++;
-	return poly_render_triangle(vd->poly, drawbuf, global_cliprect, info->callback, 0, &vert[0], &vert[1], &vert[2]);
+	return vd->poly->render_triangle(global_cliprect, voodoo_renderer::render_delegate(&voodoo_device::render_scanline, vd), 0, vert[0], vert[1], vert[2]);
 }
 
 
@@ -6488,8 +6454,11 @@ void voodoo_device::device_reset()
 void voodoo_device::device_stop()
 {
 	/* release the work queue, ensuring all work is finished */
-	if (poly != nullptr)
-		poly_free(poly);
+	if (poly)
+	{
+		poly->wait("device_stop");
+		poly.reset();
+	}
 }
 
 
@@ -6535,14 +6504,36 @@ voodoo_3_device::voodoo_3_device(const machine_config &mconfig, const char *tag,
     GENERIC RASTERIZERS
 ***************************************************************************/
 
+/*-------------------------------------------------
+    render_fastfill - poly_manager callback that
+    forwards one scanline to raster_fastfill
+-------------------------------------------------*/
+
+void voodoo_device::render_fastfill(int32_t y, const poly_extent &extent, const poly_extra_data &extra, int threadid)
+{
+	raster_fastfill(extra.destbase, y, &extent, &extra, threadid);
+}
+
+
+/*-------------------------------------------------
+    render_scanline - poly_manager callback that
+    forwards one scanline to the rasterizer chosen
+    for the triangle
+-------------------------------------------------*/
+
+void voodoo_device::render_scanline(int32_t y, const poly_extent &extent, const poly_extra_data &extra, int threadid)
+{
+	(*extra.info->callback)(extra.destbase, y, &extent, &extra, threadid);
+}
+
+
 /*-------------------------------------------------
     raster_fastfill - per-scanline
     implementation of the 'fastfill' command
 -------------------------------------------------*/
 
-void voodoo_device::raster_fastfill(void *destbase, int32_t y, const poly_extent *extent, const void *extradata, int threadid)
+void voodoo_device::raster_fastfill(void *destbase, int32_t y, const poly_extent *extent, const poly_extra_data *extra, int threadid)
 {
-	const poly_extra_data *extra = (const poly_extra_data *)extradata;
 	voodoo_device* vd = extra->device;
 	stats_block *stats = &vd->thread_stats[threadid];
 	int32_t startx = extent->startx;
@@ -6563,6 +6554,12 @@ void voodoo_device::raster_fastfill(void *destbase, int32_t y, const poly_extent
 
 		for (x = startx; x < stopx && (x & 3) != 0; x++)
 			dest[x] = ditherow[x & 3];
+#if ((!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_MSC_VER)) && defined(PTR64))
+		// the dither pattern repeats every 4 pixels, so 8 aligned pixels are the row twice
+		const __m128i expanded2 = _mm_set1_epi64x(expanded);
+		for ( ; x + 8 <= stopx; x += 8)
+			_mm_storeu_si128((__m128i *)&dest[x], expanded2);
+#endif
 		for ( ; x < (stopx & ~3); x += 4)
 			*(uint64_t *)&dest[x] = expanded;
 		for ( ; x < stopx; x++)
@@ -6579,6 +6576,11 @@ void voodoo_device::raster_fastfill(void *destbase, int32_t y, const poly_extent
 
 		for (x = startx; x < stopx && (x & 3) != 0; x++)
 			dest[x] = depth;
+#if ((!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_MSC_VER)) && defined(PTR64))
+		const __m128i expanded2 = _mm_set1_epi16(depth);
+		for ( ; x + 8 <= stopx; x += 8)
+			_mm_storeu_si128((__m128i *)&dest[x], expanded2);
+#endif
 		for ( ; x < (stopx & ~3); x += 4)
 			*(uint64_t *)&dest[x] = expanded;
 		for ( ; x < stopx; x++)
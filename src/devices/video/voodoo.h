@@ -13,7 +13,7 @@
 
 #pragma once
 
-#include "video/polylgcy.h"
+#include "video/poly.h"
 #include "video/rgbutil.h"
 #include "screen.h"
 
@@ -1193,12 +1193,57 @@ protected:
 	};
 
 
+	struct raster_info;
+
+
+	struct poly_extra_data
+	{
+		voodoo_device *     device;                 // owning device
+		raster_info *       info;                   // pointer to rasterizer information
+		void *              destbase;               // base of the buffer being drawn
+
+		int16_t             ax, ay;                 // vertex A x,y (12.4)
+		int32_t             startr, startg, startb, starta; // starting R,G,B,A (12.12)
+		int32_t             startz;                 // starting Z (20.12)
+		int64_t             startw;                 // starting W (16.32)
+		int32_t             drdx, dgdx, dbdx, dadx; // delta R,G,B,A per X
+		int32_t             dzdx;                   // delta Z per X
+		int64_t             dwdx;                   // delta W per X
+		int32_t             drdy, dgdy, dbdy, dady; // delta R,G,B,A per Y
+		int32_t             dzdy;                   // delta Z per Y
+		int64_t             dwdy;                   // delta W per Y
+
+		int64_t             starts0, startt0;       // starting S,T (14.18)
+		int64_t             startw0;                // starting W (2.30)
+		int64_t             ds0dx, dt0dx;           // delta S,T per X
+		int64_t             dw0dx;                  // delta W per X
+		int64_t             ds0dy, dt0dy;           // delta S,T per Y
+		int64_t             dw0dy;                  // delta W per Y
+		int32_t             lodbase0;               // used during rasterization
+
+		int64_t             starts1, startt1;       // starting S,T (14.18)
+		int64_t             startw1;                // starting W (2.30)
+		int64_t             ds1dx, dt1dx;           // delta S,T per X
+		int64_t             dw1dx;                  // delta W per X
+		int64_t             ds1dy, dt1dy;           // delta S,T per Y
+		int64_t             dw1dy;                  // delta W per Y
+		int32_t             lodbase1;               // used during rasterization
+
+		uint16_t            dither[16];             // dither matrix, for fastfill
+	};
+
+
+	typedef poly_manager<float, poly_extra_data, 1, 64> voodoo_renderer;
+	typedef voodoo_renderer::extent_t poly_extent;
+	typedef void (*raster_func)(void *destbase, int32_t y, const poly_extent *extent, const poly_extra_data *extra, int threadid);
+
+
 	struct raster_info
 	{
 		uint32_t compute_hash() const;
 
 		raster_info *       next = nullptr;         // pointer to next entry with the same hash
-		poly_draw_scanline_func callback = nullptr; // callback pointer
+		raster_func         callback = nullptr;     // callback pointer
 		bool                is_generic = false;     // true if this is one of the generic rasterizers
 		uint8_t             display;                // display index
 		uint32_t            hits;                   // how many hits (pixels) we've used this for
@@ -1213,9 +1258,6 @@ protected:
 	};
 
 
-	struct poly_extra_data;
-
-
 	struct banshee_info
 	{
 		uint32_t            io[0x40];               // I/O registers
@@ -1287,13 +1329,15 @@ protected:
 
 	static void init_save_state(voodoo_device *vd);
 
-	static void raster_fastfill(void *dest, int32_t scanline, const poly_extent *extent, const void *extradata, int threadid);
-	static void raster_generic_0tmu(void *dest, int32_t scanline, const poly_extent *extent, const void *extradata, int threadid);
-	static void raster_generic_1tmu(void *dest, int32_t scanline, const poly_extent *extent, const void *extradata, int threadid);
-	static void raster_generic_2tmu(void *dest, int32_t scanline, const poly_extent *extent, const void *extradata, int threadid);
+	void render_fastfill(int32_t y, const poly_extent &extent, const poly_extra_data &extra, int threadid);
+	void render_scanline(int32_t y, const poly_extent &extent, const poly_extra_data &extra, int threadid);
+	static void raster_fastfill(void *dest, int32_t scanline, const poly_extent *extent, const poly_extra_data *extra, int threadid);
+	static void raster_generic_0tmu(void *dest, int32_t scanline, const poly_extent *extent, const poly_extra_data *extra, int threadid);
+	static void raster_generic_1tmu(void *dest, int32_t scanline, const poly_extent *extent, const poly_extra_data *extra, int threadid);
+	static void raster_generic_2tmu(void *dest, int32_t scanline, const poly_extent *extent, const poly_extra_data *extra, int threadid);
 
 #define RASTERIZER_HEADER(name) \
-	static void raster_##name(void *destbase, int32_t y, const poly_extent *extent, const void *extradata, int threadid);
+	static void raster_##name(void *destbase, int32_t y, const poly_extent *extent, const poly_extra_data *extra, int threadid);
 #define RASTERIZER_ENTRY(fbzcp, alpha, fog, fbz, tex0, tex1) \
 	RASTERIZER_HEADER(fbzcp##_##alpha##_##fog##_##fbz##_##tex0##_##tex1)
 #include "voodoo_rast.ipp"
@@ -1337,7 +1381,7 @@ public:
 	tmu_shared_state    tmushare;               // TMU shared state
 	banshee_info        banshee;                // Banshee state
 
-	legacy_poly_manager * poly;                 // polygon manager
+	std::unique_ptr<voodoo_renderer> poly;      // polygon manager
 	std::unique_ptr<stats_block[]> thread_stats; // per-thread statistics
 
 	voodoo_stats        stats;                  // internal statistics
@@ -0,0 +1,184 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    audiorec.cpp
+
+    Background audio recording.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "audiorec.h"
+
+#include "flac.h"
+
+
+
+//**************************************************************************
+//  AUDIO RECORDER
+//**************************************************************************
+
+//-------------------------------------------------
+//  audio_recorder - constructor
+//-------------------------------------------------
+
+audio_recorder::audio_recorder()
+	: m_format(format::NONE)
+	, m_channels(0)
+	, m_chunk_samples(0)
+	, m_queue(nullptr)
+	, m_wav(nullptr)
+	, m_failed(false)
+{
+}
+
+
+//-------------------------------------------------
+//  ~audio_recorder - destructor
+//-------------------------------------------------
+
+audio_recorder::~audio_recorder()
+{
+	close();
+	if (m_queue != nullptr)
+		osd_work_queue_free(m_queue);
+}
+
+
+//-------------------------------------------------
+//  open - start a WAV or FLAC file, picked by the
+//  extension
+//-------------------------------------------------
+
+bool audio_recorder::open(std::string const &filename, int sample_rate, int channels)
+{
+	close();
+
+	m_filename = filename;
+	m_channels = channels;
+	m_chunk_samples = size_t(sample_rate / 2) * channels;
+	m_pending.reserve(m_chunk_samples);
+	m_failed = false;
+
+	if (core_filename_ends_with(filename, ".flac"))
+	{
+		if (util::core_file::open(filename, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE, m_file) != osd_file::error::NONE)
+			return false;
+		m_flac = std::make_unique<flac_encoder>();
+		m_flac->set_sample_rate(sample_rate);
+		m_flac->set_num_channels(channels);
+		if (!m_flac->reset(*m_file))
+		{
+			m_flac.reset();
+			m_file.reset();
+			return false;
+		}
+		m_format = format::FLAC;
+	}
+	else
+	{
+		m_wav = wav_open(filename.c_str(), sample_rate, channels);
+		if (m_wav == nullptr)
+			return false;
+		m_format = format::WAV;
+	}
+
+	if (m_queue == nullptr)
+		m_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+	return true;
+}
+
+
+//-------------------------------------------------
+//  close - write out everything queued and
+//  finish the file
+//-------------------------------------------------
+
+void audio_recorder::close()
+{
+	if (!is_open())
+		return;
+
+	queue_pending();
+	if (m_queue != nullptr)
+	{
+		while (!osd_work_queue_wait(m_queue, osd_ticks_per_second()))
+		{
+		}
+	}
+
+	if (m_format == format::FLAC)
+	{
+		m_flac->finish();
+		m_flac.reset();
+		m_file.reset();
+	}
+	else
+	{
+		wav_close(m_wav);
+		m_wav = nullptr;
+	}
+	m_format = format::NONE;
+
+	if (m_failed)
+		osd_printf_error("Error writing audio to %s\n", m_filename);
+}
+
+
+//-------------------------------------------------
+//  add - queue interleaved samples for writing
+//-------------------------------------------------
+
+void audio_recorder::add(s16 const *data, int samples)
+{
+	if (!is_open())
+		return;
+
+	m_pending.insert(m_pending.end(), data, data + samples);
+	if (m_pending.size() >= m_chunk_samples)
+		queue_pending();
+}
+
+
+//-------------------------------------------------
+//  queue_pending - hand the samples collected so
+//  far to the worker
+//-------------------------------------------------
+
+void audio_recorder::queue_pending()
+{
+	if (m_pending.empty())
+		return;
+
+	auto item = std::make_unique<chunk>(chunk{ this, std::move(m_pending) });
+	m_pending.clear();
+	m_pending.reserve(m_chunk_samples);
+	if (m_queue != nullptr && osd_work_item_queue(m_queue, write_static, item.get(), WORK_ITEM_FLAG_AUTO_RELEASE) != nullptr)
+		item.release();
+	else
+		write_static(item.release(), 0);
+}
+
+
+//-------------------------------------------------
+//  write_static - write one chunk; the queue is
+//  serial, so chunks arrive in order
+//-------------------------------------------------
+
+void *audio_recorder::write_static(void *param, int threadid)
+{
+	std::unique_ptr<chunk> const item(reinterpret_cast<chunk *>(param));
+	audio_recorder &recorder(*item->owner);
+
+	if (recorder.m_format == format::FLAC)
+	{
+		if (!recorder.m_flac->encode_interleaved(&item->data[0], item->data.size() / recorder.m_channels))
+			recorder.m_failed = true;
+	}
+	else
+	{
+		wav_add_data_16(recorder.m_wav, &item->data[0], item->data.size());
+	}
+	return nullptr;
+}
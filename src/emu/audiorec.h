@@ -0,0 +1,89 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    audiorec.h
+
+    Background audio recording.
+
+    Collects 16-bit interleaved samples from the mixer and writes them to
+    a WAV file, or a FLAC file if the name ends in .flac, on an I/O worker
+    thread, so capturing audio costs the emulation thread a copy rather
+    than a write to disk.  Samples are handed over in chunks of a little
+    under a second; closing the recorder waits for everything queued to
+    be written.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_AUDIOREC_H
+#define MAME_EMU_AUDIOREC_H
+
+#pragma once
+
+#include "corefile.h"
+#include "wavwrite.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+class flac_encoder;
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> audio_recorder
+
+class audio_recorder
+{
+public:
+	// construction/destruction
+	audio_recorder();
+	~audio_recorder();
+
+	// getters
+	bool is_open() const { return m_format != format::NONE; }
+
+	// start and finish a file
+	bool open(std::string const &filename, int sample_rate, int channels);
+	void close();
+
+	// queue interleaved samples for writing
+	void add(s16 const *data, int samples);
+
+private:
+	enum class format
+	{
+		NONE,
+		WAV,
+		FLAC
+	};
+
+	// a batch of samples on its way to the worker
+	struct chunk
+	{
+		audio_recorder *    owner;
+		std::vector<s16>    data;
+	};
+
+	void queue_pending();
+	static void *write_static(void *param, int threadid);
+
+	// internal state
+	format                          m_format;           // what's being written, if anything
+	std::string                     m_filename;         // file being written, for messages
+	int                             m_channels;         // interleaved channels
+	size_t                          m_chunk_samples;    // samples to collect before handing them over
+	osd_work_queue *                m_queue;            // I/O queue the writes go through
+	std::vector<s16>                m_pending;          // samples not yet handed over
+	wav_file *                      m_wav;              // WAV output
+	util::core_file::ptr            m_file;             // FLAC output file
+	std::unique_ptr<flac_encoder>   m_flac;             // FLAC encoder writing to it
+	std::atomic<bool>               m_failed;           // a write has failed
+};
+
+#endif // MAME_EMU_AUDIOREC_H
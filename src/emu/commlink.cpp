@@ -0,0 +1,280 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    commlink.cpp
+
+    Framed link between linked cabinets.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "commlink.h"
+#include "emuopts.h"
+
+#include <cfloat>
+
+
+
+//**************************************************************************
+//  CONSTANTS
+//**************************************************************************
+
+// length (2 bytes), reserved (2), emulated seconds (4) and attoseconds (8), all little-endian
+constexpr size_t FRAME_HEADER = 16;
+
+// write queued frames out once this much is waiting, even without a flush
+constexpr size_t SEND_THRESHOLD = 0x4000;
+
+
+
+//**************************************************************************
+//  INLINE FUNCTIONS
+//**************************************************************************
+
+static inline u64 get_le(u8 const *data, int bytes)
+{
+	u64 result = 0;
+	for (int i = bytes - 1; i >= 0; i--)
+		result = (result << 8) | data[i];
+	return result;
+}
+
+static inline void put_le(u8 *data, u64 value, int bytes)
+{
+	for (int i = 0; i < bytes; i++, value >>= 8)
+		data[i] = u8(value);
+}
+
+
+
+//**************************************************************************
+//  COMM LINK
+//**************************************************************************
+
+//-------------------------------------------------
+//  comm_link - constructor
+//-------------------------------------------------
+
+comm_link::comm_link(device_t &owner, const char *name)
+	: m_owner(owner)
+	, m_name(name)
+	, m_localhost(util::string_format("socket.%s:%s", owner.mconfig().options().comm_localhost(), owner.mconfig().options().comm_localport()))
+	, m_remotehost(util::string_format("socket.%s:%s", owner.mconfig().options().comm_remotehost(), owner.mconfig().options().comm_remoteport()))
+	, m_accepted(false)
+	, m_receive_pos(0)
+{
+	memset(&m_stats, 0, sizeof(m_stats));
+	m_stats.skew_min = DBL_MAX;
+	m_stats.skew_max = -DBL_MAX;
+}
+
+
+//-------------------------------------------------
+//  ~comm_link - destructor; reports what the link
+//  carried
+//-------------------------------------------------
+
+comm_link::~comm_link()
+{
+	if (m_stats.frames_sent || m_stats.frames_received)
+	{
+		osd_printf_verbose("%s: %u frames sent in %u writes (%u bytes), %u frames received (%u bytes), %u empty polls\n",
+				m_name,
+				m_stats.frames_sent, m_stats.writes, m_stats.bytes_sent,
+				m_stats.frames_received, m_stats.bytes_received,
+				m_stats.empty_polls);
+		if (m_stats.frames_received)
+			osd_printf_verbose("%s: emulated time behind the previous cabinet: min %.3f ms, mean %.3f ms, max %.3f ms\n",
+					m_name,
+					m_stats.skew_min * 1000.0,
+					m_stats.skew_total * 1000.0 / double(m_stats.frames_received),
+					m_stats.skew_max * 1000.0);
+	}
+}
+
+
+//-------------------------------------------------
+//  connect - open whichever sockets aren't open
+//  yet
+//-------------------------------------------------
+
+bool comm_link::connect()
+{
+	if (!m_rx)
+	{
+		osd_printf_verbose("%s: listen on %s\n", m_name, m_localhost);
+		u64 filesize; // unused
+		osd_file::open(m_localhost, OPEN_FLAG_CREATE, m_rx, filesize);
+		m_accepted = false;
+		m_receive.clear();
+		m_receive_pos = 0;
+	}
+
+	if (!m_tx)
+	{
+		osd_printf_verbose("%s: connect to %s\n", m_name, m_remotehost);
+		u64 filesize; // unused
+		osd_file::open(m_remotehost, 0, m_tx, filesize);
+		m_send.clear();
+	}
+
+	return connected();
+}
+
+
+//-------------------------------------------------
+//  close - drop both sockets
+//-------------------------------------------------
+
+void comm_link::close()
+{
+	m_rx.reset();
+	m_tx.reset();
+	m_accepted = false;
+	m_receive.clear();
+	m_receive_pos = 0;
+	m_send.clear();
+}
+
+
+//-------------------------------------------------
+//  receive - take the next frame from the
+//  previous cabinet if a whole one has arrived
+//-------------------------------------------------
+
+int comm_link::receive(void *buffer, int size)
+{
+	if (!connected())
+		return -1;
+
+	// whatever the board queued may be what the ring is waiting on
+	if (!flush())
+		return -1;
+
+	// read more only once everything buffered has been taken
+	if ((m_receive.size() - m_receive_pos) < FRAME_HEADER || (m_receive.size() - m_receive_pos) < (FRAME_HEADER + get_le(&m_receive[m_receive_pos], 2)))
+	{
+		if (!fill())
+			return -1;
+	}
+
+	size_t const available = m_receive.size() - m_receive_pos;
+	u8 const *const header = m_receive.empty() ? nullptr : &m_receive[m_receive_pos];
+	if (available < FRAME_HEADER || available < (FRAME_HEADER + get_le(header, 2)))
+	{
+		m_stats.empty_polls++;
+		return 0;
+	}
+
+	// take the frame, and see how far behind its sender we are
+	int const length = int(get_le(header, 2));
+	attotime const stamp(seconds_t(get_le(&header[4], 4)), attoseconds_t(get_le(&header[8], 8)));
+	double const skew = m_owner.machine().time().as_double() - stamp.as_double();
+	m_stats.frames_received++;
+	m_stats.skew_min = std::min(m_stats.skew_min, skew);
+	m_stats.skew_max = std::max(m_stats.skew_max, skew);
+	m_stats.skew_total += skew;
+
+	memcpy(buffer, &header[FRAME_HEADER], std::min(length, size));
+	m_receive_pos += FRAME_HEADER + length;
+	if (m_receive_pos == m_receive.size())
+	{
+		m_receive.clear();
+		m_receive_pos = 0;
+	}
+	return std::min(length, size);
+}
+
+
+//-------------------------------------------------
+//  send - queue a frame for the next cabinet
+//-------------------------------------------------
+
+bool comm_link::send(void const *buffer, int size)
+{
+	if (!m_tx)
+		return false;
+
+	attotime const now = m_owner.machine().time();
+	size_t const start = m_send.size();
+	m_send.resize(start + FRAME_HEADER + size);
+	put_le(&m_send[start], size, 2);
+	put_le(&m_send[start + 2], 0, 2);
+	put_le(&m_send[start + 4], now.seconds(), 4);
+	put_le(&m_send[start + 8], now.attoseconds(), 8);
+	memcpy(&m_send[start + FRAME_HEADER], buffer, size);
+	m_stats.frames_sent++;
+
+	return (m_send.size() < SEND_THRESHOLD) || flush();
+}
+
+
+//-------------------------------------------------
+//  flush - write out everything queued
+//-------------------------------------------------
+
+bool comm_link::flush()
+{
+	if (m_send.empty())
+		return true;
+	if (!m_tx)
+		return false;
+
+	u8 const *ptr = &m_send[0];
+	u32 length = u32(m_send.size());
+	while (length > 0)
+	{
+		u32 actual = 0;
+		if (m_tx->write(ptr, 0, length, actual) != osd_file::error::NONE || actual == 0)
+		{
+			close();
+			return false;
+		}
+		m_stats.writes++;
+		m_stats.bytes_sent += actual;
+		ptr += actual;
+		length -= actual;
+	}
+	m_send.clear();
+	return true;
+}
+
+
+//-------------------------------------------------
+//  fill - read everything the socket has ready
+//-------------------------------------------------
+
+bool comm_link::fill()
+{
+	// drop what's been taken before appending
+	if (m_receive_pos)
+	{
+		m_receive.erase(m_receive.begin(), m_receive.begin() + m_receive_pos);
+		m_receive_pos = 0;
+	}
+
+	for (;;)
+	{
+		u8 buffer[4096];
+		u32 actual = 0;
+		if (m_rx->read(buffer, 0, sizeof(buffer), actual) != osd_file::error::NONE)
+			return true;
+		if (actual == 0)
+		{
+			// the first empty read is the previous cabinet connecting; after that it means it's gone
+			if (m_accepted)
+			{
+				close();
+				return false;
+			}
+			m_accepted = true;
+			continue;
+		}
+		m_accepted = true;
+		m_stats.bytes_received += actual;
+		m_receive.insert(m_receive.end(), buffer, buffer + actual);
+		if (actual < sizeof(buffer))
+			return true;
+	}
+}
@@ -0,0 +1,93 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    commlink.h
+
+    Framed link between linked cabinets.
+
+    Carries the fixed-size frames that communication boards pass around
+    their ring over the sockets given by the comm_localhost/localport and
+    comm_remotehost/remoteport options: frames are received from the
+    previous cabinet on the local port and sent on to the next one at the
+    remote address.
+
+    Each frame goes out with a small header holding its length and the
+    emulated time it was sent at.  Incoming data is read in as large
+    chunks as the socket has ready and split into frames here, and frames
+    sent in a burst are written together when the board next looks for a
+    frame or flushes, rather than with one write each.  The emulated time
+    stamps give the skew between cabinets, which is logged with the other
+    link statistics when the machine exits (-verbose).
+
+***************************************************************************/
+
+#ifndef MAME_EMU_COMMLINK_H
+#define MAME_EMU_COMMLINK_H
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> comm_link
+
+class comm_link
+{
+public:
+	// what the link has carried
+	struct statistics
+	{
+		u64             frames_sent;        // frames queued for the next cabinet
+		u64             frames_received;    // frames received from the previous cabinet
+		u64             bytes_sent;         // bytes written, headers included
+		u64             bytes_received;     // bytes read, headers included
+		u64             writes;             // socket writes the sent frames took
+		u64             empty_polls;        // looks for a frame that found none
+		double          skew_min;           // smallest local minus sender emulated time, seconds
+		double          skew_max;           // largest local minus sender emulated time, seconds
+		double          skew_total;         // sum of the above over all received frames
+	};
+
+	// construction/destruction
+	comm_link(device_t &owner, const char *name);
+	~comm_link();
+
+	// getters
+	bool connected() const { return m_rx && m_tx; }
+	statistics const &stats() const { return m_stats; }
+
+	// open whichever sockets aren't open yet; true once both are
+	bool connect();
+	void close();
+
+	// next frame from the previous cabinet: its length, 0 if none is waiting, or -1 if the link is down
+	int receive(void *buffer, int size);
+
+	// queue a frame for the next cabinet; false if the link dropped
+	bool send(void const *buffer, int size);
+	bool flush();
+
+private:
+	bool fill();
+
+	// internal state
+	device_t &                  m_owner;            // device the link belongs to
+	char const *                m_name;             // prefix for messages
+	std::string                 m_localhost;        // socket to listen on
+	std::string                 m_remotehost;       // socket to connect to
+	osd_file::ptr               m_rx;               // from the previous cabinet
+	osd_file::ptr               m_tx;               // to the next cabinet
+	bool                        m_accepted;         // the previous cabinet has connected
+	std::vector<u8>             m_receive;          // data read but not yet taken as frames
+	size_t                      m_receive_pos;      // start of the first frame not taken
+	std::vector<u8>             m_send;             // frames queued but not yet written
+	statistics                  m_stats;            // what the link has carried
+};
+
+#endif // MAME_EMU_COMMLINK_H
@@ -111,16 +111,23 @@ void configuration_manager::save_settings()
 	for (const auto &type : m_typelist)
 		type.save(config_type::INIT, nullptr);
 
+	/* build each file in memory; the machine writes out whichever differ from what's on disk */
+	auto const save = [this] (std::string &&name, config_type which_type)
+	{
+		emu_file file(OPEN_FLAG_WRITE);
+		if (file.open_ram_write() == osd_file::error::NONE && save_xml(file, which_type))
+		{
+			util::core_file &contents(file);
+			u8 const *const bytes = reinterpret_cast<u8 const *>(contents.buffer());
+			machine().queue_writeback(machine().options().cfg_directory(), std::move(name), std::vector<u8>(bytes, bytes + contents.size()));
+		}
+	};
+
 	/* save the defaults file */
-	emu_file file(machine().options().cfg_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
-	osd_file::error filerr = file.open("default.cfg");
-	if (filerr == osd_file::error::NONE)
-		save_xml(file, config_type::DEFAULT);
+	save("default.cfg", config_type::DEFAULT);
 
 	/* finally, save the game-specific file */
-	filerr = file.open(machine().basename() + ".cfg");
-	if (filerr == osd_file::error::NONE)
-		save_xml(file, config_type::GAME);
+	save(machine().basename() + ".cfg", config_type::GAME);
 
 	/* loop over all registrants and call their final function */
 	for (const auto &type : m_typelist)
@@ -112,6 +112,7 @@ debugger_commands::debugger_commands(running_machine& machine, debugger_cpu& cpu
 	: m_machine(machine)
 	, m_cpu(cpu)
 	, m_console(console)
+	, m_profiler(machine)
 {
 	m_global_array = std::make_unique<global_entry []>(MAX_GLOBALS);
 
@@ -177,6 +178,10 @@ debugger_commands::debugger_commands(running_machine& machine, debugger_cpu& cpu
 	m_console.register_command("gp",        CMDFLAG_NONE, 0, 0, 1, std::bind(&debugger_commands::execute_go_privilege, this, _1, _2));
 	m_console.register_command("next",      CMDFLAG_NONE, 0, 0, 0, std::bind(&debugger_commands::execute_next, this, _1, _2));
 	m_console.register_command("n",         CMDFLAG_NONE, 0, 0, 0, std::bind(&debugger_commands::execute_next, this, _1, _2));
+	m_console.register_command("rstep",     CMDFLAG_NONE, 0, 0, 1, std::bind(&debugger_commands::execute_rstep, this, _1, _2));
+	m_console.register_command("rs",        CMDFLAG_NONE, 0, 0, 1, std::bind(&debugger_commands::execute_rstep, this, _1, _2));
+	m_console.register_command("rgo",       CMDFLAG_NONE, 0, 0, 0, std::bind(&debugger_commands::execute_rgo, this, _1, _2));
+	m_console.register_command("rg",        CMDFLAG_NONE, 0, 0, 0, std::bind(&debugger_commands::execute_rgo, this, _1, _2));
 	m_console.register_command("focus",     CMDFLAG_NONE, 0, 1, 1, std::bind(&debugger_commands::execute_focus, this, _1, _2));
 	m_console.register_command("ignore",    CMDFLAG_NONE, 0, 0, MAX_COMMAND_PARAMS, std::bind(&debugger_commands::execute_ignore, this, _1, _2));
 	m_console.register_command("observe",   CMDFLAG_NONE, 0, 0, MAX_COMMAND_PARAMS, std::bind(&debugger_commands::execute_observe, this, _1, _2));
@@ -221,6 +226,10 @@ debugger_commands::debugger_commands(running_machine& machine, debugger_cpu& cpu
 
 	m_console.register_command("hotspot",   CMDFLAG_NONE, 0, 0, 3, std::bind(&debugger_commands::execute_hotspot, this, _1, _2));
 
+	m_console.register_command("profile",   CMDFLAG_NONE, 0, 0, 2, std::bind(&debugger_commands::execute_profile, this, _1, _2));
+	m_console.register_command("profilelist", CMDFLAG_NONE, 0, 0, 1, std::bind(&debugger_commands::execute_profilelist, this, _1, _2));
+	m_console.register_command("profilesave", CMDFLAG_NONE, 0, 1, 2, std::bind(&debugger_commands::execute_profilesave, this, _1, _2));
+
 	m_console.register_command("statesave", CMDFLAG_NONE, 0, 1, 1, std::bind(&debugger_commands::execute_statesave, this, _1, _2));
 	m_console.register_command("ss",        CMDFLAG_NONE, 0, 1, 1, std::bind(&debugger_commands::execute_statesave, this, _1, _2));
 	m_console.register_command("stateload", CMDFLAG_NONE, 0, 1, 1, std::bind(&debugger_commands::execute_stateload, this, _1, _2));
@@ -301,6 +310,7 @@ debugger_commands::debugger_commands(running_machine& machine, debugger_cpu& cpu
 	m_console.register_command("mapi",      CMDFLAG_NONE, AS_IO, 1, 1, std::bind(&debugger_commands::execute_map, this, _1, _2));
 	m_console.register_command("mapo",      CMDFLAG_NONE, AS_OPCODES, 1, 1, std::bind(&debugger_commands::execute_map, this, _1, _2));
 	m_console.register_command("memdump",   CMDFLAG_NONE, 0, 0, 1, std::bind(&debugger_commands::execute_memdump, this, _1, _2));
+	m_console.register_command("mapstats",  CMDFLAG_NONE, 0, 0, 0, std::bind(&debugger_commands::execute_mapstats, this, _1, _2));
 
 	m_console.register_command("symlist",   CMDFLAG_NONE, 0, 0, 1, std::bind(&debugger_commands::execute_symlist, this, _1, _2));
 
@@ -895,6 +905,31 @@ void debugger_commands::execute_out(int ref, const std::vector<std::string> &par
 }
 
 
+/*-------------------------------------------------
+    execute_rstep - execute the rstep command
+-------------------------------------------------*/
+
+void debugger_commands::execute_rstep(int ref, const std::vector<std::string> &params)
+{
+	/* if we have a parameter, use it */
+	u64 steps = 1;
+	if (params.size() > 0 && !validate_number_parameter(params[0], steps))
+		return;
+
+	m_cpu.reverse_step(*m_console.get_visible_cpu(), steps);
+}
+
+
+/*-------------------------------------------------
+    execute_rgo - execute the rgo command
+-------------------------------------------------*/
+
+void debugger_commands::execute_rgo(int ref, const std::vector<std::string> &params)
+{
+	m_cpu.reverse_go(*m_console.get_visible_cpu());
+}
+
+
 /*-------------------------------------------------
     execute_go - execute the go command
 -------------------------------------------------*/
@@ -1834,6 +1869,104 @@ void debugger_commands::execute_hotspot(int ref, const std::vector<std::string>
 }
 
 
+/*-------------------------------------------------
+    execute_profile - execute the profile command
+-------------------------------------------------*/
+
+void debugger_commands::execute_profile(int ref, const std::vector<std::string> &params)
+{
+	/* stop sampling, keeping what we have */
+	if (!params.empty() && !core_stricmp(params[0].c_str(), "off"))
+	{
+		if (m_profiler.running())
+		{
+			m_profiler.stop();
+			m_console.printf("Stopped profiling after %u samples\n", unsigned(m_profiler.samples()));
+		}
+		return;
+	}
+
+	/* extract parameters */
+	u64 rate = 1000;
+	if (!params.empty() && !params[0].empty() && !validate_number_parameter(params[0], rate))
+		return;
+	if (rate == 0)
+	{
+		m_console.printf("Invalid sample rate\n");
+		return;
+	}
+	device_t *device = nullptr;
+	if (params.size() > 1 && !validate_cpu_parameter(params[1].c_str(), device))
+		return;
+
+	m_profiler.start(attotime::from_hz(u32(std::min<u64>(rate, 0xffffffff))), device);
+	if (device != nullptr)
+		m_console.printf("Profiling CPU '%s' at %u samples per second\n", device->tag(), unsigned(rate));
+	else
+		m_console.printf("Profiling all CPUs at %u samples per second\n", unsigned(rate));
+}
+
+
+/*-------------------------------------------------
+    execute_profilelist - execute the profilelist
+    command
+-------------------------------------------------*/
+
+void debugger_commands::execute_profilelist(int ref, const std::vector<std::string> &params)
+{
+	u64 count = 20;
+	if (!params.empty() && !validate_number_parameter(params[0], count))
+		return;
+
+	if (m_profiler.samples() == 0)
+	{
+		m_console.printf("No profile samples\n");
+		return;
+	}
+
+	std::ostringstream report;
+	m_profiler.report(report, unsigned(count));
+
+	std::istringstream lines(report.str());
+	std::string line;
+	while (std::getline(lines, line))
+		m_console.printf("%s\n", line.c_str());
+}
+
+
+/*-------------------------------------------------
+    execute_profilesave - execute the profilesave
+    command
+-------------------------------------------------*/
+
+void debugger_commands::execute_profilesave(int ref, const std::vector<std::string> &params)
+{
+	bool folded = false;
+	if (params.size() > 1)
+	{
+		if (core_stricmp(params[1].c_str(), "folded"))
+		{
+			m_console.printf("Invalid format '%s'\n", params[1].c_str());
+			return;
+		}
+		folded = true;
+	}
+
+	std::ofstream f(params[0], std::ios::out | std::ios::trunc);
+	if (!f.is_open())
+	{
+		m_console.printf("Error opening file '%s'\n", params[0].c_str());
+		return;
+	}
+
+	if (folded)
+		m_profiler.folded(f);
+	else
+		m_profiler.report(f, 0);
+	m_console.printf("Profile saved to %s\n", params[0].c_str());
+}
+
+
 /*-------------------------------------------------
     execute_statesave - execute the statesave command
 -------------------------------------------------*/
@@ -3125,6 +3258,8 @@ void debugger_commands::execute_trace_internal(int ref, const std::vector<std::s
 	const char *action = nullptr;
 	bool detect_loops = true;
 	bool logerror = false;
+	bool binary = false;
+	bool registers = false;
 	device_t *cpu;
 	FILE *f = nullptr;
 	const char *mode;
@@ -3148,6 +3283,10 @@ void debugger_commands::execute_trace_internal(int ref, const std::vector<std::s
 				detect_loops = false;
 			else if (!core_stricmp(flag.c_str(), "logerror"))
 				logerror = true;
+			else if (!core_stricmp(flag.c_str(), "binary"))
+				binary = true;
+			else if (!core_stricmp(flag.c_str(), "registers"))
+				binary = registers = true;
 			else
 			{
 				m_console.printf("Invalid flag '%s'\n", flag.c_str());
@@ -3161,12 +3300,12 @@ void debugger_commands::execute_trace_internal(int ref, const std::vector<std::s
 	/* open the file */
 	if (core_stricmp(filename.c_str(), "off") != 0)
 	{
-		mode = "w";
+		mode = binary ? "wb" : "w";
 
 		/* opening for append? */
 		if ((filename[0] == '>') && (filename[1] == '>'))
 		{
-			mode = "a";
+			mode = binary ? "ab" : "a";
 			filename = filename.substr(2);
 		}
 
@@ -3179,7 +3318,7 @@ void debugger_commands::execute_trace_internal(int ref, const std::vector<std::s
 	}
 
 	/* do it */
-	cpu->debug()->trace(f, trace_over, detect_loops, logerror, action);
+	cpu->debug()->trace(f, trace_over, detect_loops, logerror, action, binary, registers);
 	if (f)
 		m_console.printf("Tracing CPU '%s' to file %s\n", cpu->tag(), filename.c_str());
 	else
@@ -3543,6 +3682,34 @@ void debugger_commands::execute_memdump(int ref, const std::vector<std::string>
 }
 
 
+/*-------------------------------------------------
+    execute_mapstats - execute the mapstats command
+-------------------------------------------------*/
+
+void debugger_commands::execute_mapstats(int ref, const std::vector<std::string> &params)
+{
+	double const tps = double(osd_ticks_per_second());
+	bool any = false;
+	for (device_memory_interface &memory : memory_interface_iterator(m_machine.root_device()))
+	{
+		for (int space = 0; space != memory.max_space_count(); space++)
+			if (memory.has_space(space))
+			{
+				address_space::remap_statistics const &stats = memory.space(space).remap_stats();
+				if (stats.changes == 0)
+					continue;
+				m_console.printf("%s %s: %u map changes, %u notifications (%u changes batched), %.3f ms notifying\n",
+						memory.device().tag(), memory.space(space).name(),
+						stats.changes, stats.notifications, stats.deferred,
+						1000.0 * double(stats.notify_ticks) / tps);
+				any = true;
+			}
+	}
+	if (!any)
+		m_console.printf("No address maps have changed since startup\n");
+}
+
+
 /*-------------------------------------------------
     execute_symlist - execute the symlist command
 -------------------------------------------------*/
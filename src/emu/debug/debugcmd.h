@@ -15,6 +15,7 @@
 
 #include "debugcpu.h"
 #include "debugcon.h"
+#include "debugprof.h"
 
 
 class debugger_commands
@@ -107,6 +108,8 @@ private:
 	void execute_step(int ref, const std::vector<std::string> &params);
 	void execute_over(int ref, const std::vector<std::string> &params);
 	void execute_out(int ref, const std::vector<std::string> &params);
+	void execute_rstep(int ref, const std::vector<std::string> &params);
+	void execute_rgo(int ref, const std::vector<std::string> &params);
 	void execute_go(int ref, const std::vector<std::string> &params);
 	void execute_go_vblank(int ref, const std::vector<std::string> &params);
 	void execute_go_interrupt(int ref, const std::vector<std::string> &params);
@@ -138,6 +141,9 @@ private:
 	void execute_rpdisenable(int ref, const std::vector<std::string> &params);
 	void execute_rplist(int ref, const std::vector<std::string> &params);
 	void execute_hotspot(int ref, const std::vector<std::string> &params);
+	void execute_profile(int ref, const std::vector<std::string> &params);
+	void execute_profilelist(int ref, const std::vector<std::string> &params);
+	void execute_profilesave(int ref, const std::vector<std::string> &params);
 	void execute_statesave(int ref, const std::vector<std::string> &params);
 	void execute_stateload(int ref, const std::vector<std::string> &params);
 	void execute_rewind(int ref, const std::vector<std::string> &params);
@@ -164,6 +170,7 @@ private:
 	void execute_source(int ref, const std::vector<std::string> &params);
 	void execute_map(int ref, const std::vector<std::string> &params);
 	void execute_memdump(int ref, const std::vector<std::string> &params);
+	void execute_mapstats(int ref, const std::vector<std::string> &params);
 	void execute_symlist(int ref, const std::vector<std::string> &params);
 	void execute_softreset(int ref, const std::vector<std::string> &params);
 	void execute_hardreset(int ref, const std::vector<std::string> &params);
@@ -179,6 +186,7 @@ private:
 
 	std::unique_ptr<global_entry []> m_global_array;
 	cheat_system m_cheat;
+	debug_profiler m_profiler;
 
 	static const size_t MAX_GLOBALS;
 };
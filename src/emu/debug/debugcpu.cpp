@@ -26,6 +26,11 @@
 #include "osdepend.h"
 #include "xmlfile.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 
 const size_t debugger_cpu::NUM_TEMP_VARIABLES = 10;
 
@@ -49,12 +54,28 @@ debugger_cpu::debugger_cpu(running_machine &machine)
 	, m_wpaddr(0)
 	, m_last_periodic_update_time(0)
 	, m_comments_loaded(false)
+	, m_reverse_phase(reverse_phase::NONE)
+	, m_reverse_next(reverse_phase::NONE)
+	, m_reverse_interval(attotime::from_msec(100))
+	, m_reverse_capture_ticks(0.0)
+	, m_reverse_replay_rate(0.0)
+	, m_reverse_device(nullptr)
+	, m_reverse_index(0)
+	, m_reverse_target(0)
+	, m_reverse_scan_end(0)
+	, m_reverse_found(false)
+	, m_reverse_hit(0)
+	, m_reverse_replay_ticks(0)
+	, m_input_current(nullptr)
+	, m_input_base(0)
+	, m_input_next(0)
+	, m_input_port(0)
 {
 	m_tempvar = make_unique_clear<u64[]>(NUM_TEMP_VARIABLES);
 
 	/* create a global symbol table */
 	m_symtable = std::make_unique<symbol_table>(machine);
-	m_symtable->set_memory_modified_func([this]() { set_memory_modified(true); });
+	m_symtable->set_memory_modified_func([this]() { set_memory_modified(true); reverse_invalidate(); });
 
 	/* add "wpaddr", "wpdata" to the global symbol table */
 	m_symtable->add("wpaddr", symbol_table::READ_ONLY, &m_wpaddr);
@@ -404,6 +425,405 @@ void debugger_cpu::halt_on_next_instruction(device_t *device, util::format_argum
 	}
 }
 
+//**************************************************************************
+//  REVERSE EXECUTION
+//**************************************************************************
+
+// Reverse execution keeps a ring of snapshots taken every so often while the
+// machine runs under the debugger, along with the digital input of every
+// frame since the oldest of them.  Going backwards loads the newest snapshot
+// from before the destination and runs forward again with the recorded input,
+// counting instructions on each device, until the destination is reached.
+// Emulation is deterministic, so the replay retraces what happened live.
+
+//-------------------------------------------------
+//  reverse_update - take snapshots and load them
+//  between timeslices
+//-------------------------------------------------
+
+void debugger_cpu::reverse_update()
+{
+	switch (m_reverse_phase)
+	{
+	case reverse_phase::NONE:
+		// time going backwards means a state was loaded behind our back
+		if (!m_reverse_snapshots.empty() && m_machine.time() < m_reverse_snapshots.back().time)
+			reverse_invalidate();
+
+		if ((m_reverse_snapshots.empty() || m_machine.time() >= m_reverse_snapshots.back().time + m_reverse_interval) && m_machine.scheduler().can_save())
+			reverse_capture();
+		break;
+
+	case reverse_phase::LOADING:
+		if (m_machine.scheduler().can_save())
+			reverse_load();
+		break;
+
+	default:
+		break;
+	}
+}
+
+
+//-------------------------------------------------
+//  reverse_instruction_hook - decide whether to
+//  stop while replaying towards a destination
+//-------------------------------------------------
+
+void debugger_cpu::reverse_instruction_hook(device_t &device)
+{
+	switch (m_reverse_phase)
+	{
+	case reverse_phase::LOADING:
+		// whatever happens until the snapshot is loaded is thrown away
+		m_execution_state = exec_state::RUNNING;
+		m_machine.scheduler().abort_timeslice();
+		break;
+
+	case reverse_phase::SEEK:
+		if ((&device == m_reverse_device) && (device.debug()->instruction_count() >= m_reverse_target))
+		{
+			reverse_finish();
+			m_execution_state = exec_state::STOPPED;
+		}
+		else
+		{
+			m_execution_state = exec_state::RUNNING;
+		}
+		break;
+
+	case reverse_phase::SCAN:
+		if (&device == m_reverse_device)
+		{
+			const u64 count = device.debug()->instruction_count();
+			if (count >= m_reverse_scan_end)
+			{
+				// end of this pass: go to the last hit, or search the interval before
+				reverse_measure();
+				const int devindex = reverse_device_index(device);
+				if (m_reverse_found)
+				{
+					m_reverse_target = m_reverse_hit;
+					reverse_start(device, m_reverse_index, reverse_phase::SEEK);
+				}
+				else if (m_reverse_index > 0)
+				{
+					m_reverse_scan_end = m_reverse_snapshots[m_reverse_index].counts[devindex] + 1;
+					reverse_start(device, m_reverse_index - 1, reverse_phase::SCAN);
+				}
+				else
+				{
+					m_machine.debugger().console().printf("No breakpoint hit in the recorded history\n");
+					m_reverse_target = m_reverse_snapshots[0].counts[devindex] + 1;
+					reverse_start(device, 0, reverse_phase::SEEK);
+				}
+				break;
+			}
+
+			// remember the latest stop, but keep going in case there is a later one
+			if (is_stopped())
+			{
+				m_reverse_found = true;
+				m_reverse_hit = count;
+			}
+		}
+		m_execution_state = exec_state::RUNNING;
+		break;
+
+	default:
+		break;
+	}
+}
+
+
+//-------------------------------------------------
+//  reverse_step - go back a number of
+//  instructions on a device
+//-------------------------------------------------
+
+bool debugger_cpu::reverse_step(device_t &device, u64 steps)
+{
+	if (reverse_active())
+		return false;
+
+	const int devindex = reverse_device_index(device);
+	const u64 position = device.debug()->instruction_count();
+	if ((devindex >= 0) && (steps < position))
+	{
+		// replay from the newest snapshot taken before the target
+		m_reverse_target = position - steps;
+		for (int index = int(m_reverse_snapshots.size()) - 1; index >= 0; index--)
+			if (m_reverse_snapshots[index].counts[devindex] < m_reverse_target)
+				return reverse_start(device, index, reverse_phase::SEEK);
+	}
+
+	m_machine.debugger().console().printf("Not enough history recorded to step back that far\n");
+	return false;
+}
+
+
+//-------------------------------------------------
+//  reverse_go - go back to the most recent
+//  breakpoint or watchpoint hit on a device
+//-------------------------------------------------
+
+bool debugger_cpu::reverse_go(device_t &device)
+{
+	if (reverse_active())
+		return false;
+
+	// scan forward from the newest snapshot before the current position,
+	// moving back a snapshot at a time until something is hit
+	const int devindex = reverse_device_index(device);
+	if (devindex >= 0)
+	{
+		m_reverse_scan_end = device.debug()->instruction_count();
+		for (int index = int(m_reverse_snapshots.size()) - 1; index >= 0; index--)
+			if (m_reverse_snapshots[index].counts[devindex] < m_reverse_scan_end)
+				return reverse_start(device, index, reverse_phase::SCAN);
+	}
+
+	m_machine.debugger().console().printf("No history recorded before this point\n");
+	return false;
+}
+
+
+//-------------------------------------------------
+//  reverse_invalidate - throw away the recorded
+//  history, which no longer leads to the present
+//-------------------------------------------------
+
+void debugger_cpu::reverse_invalidate()
+{
+	if (reverse_active())
+	{
+		m_machine.debugger().console().printf("Reverse execution abandoned\n");
+		m_machine.video().set_speculative(false);
+		m_machine.sound().set_speculative(false);
+		m_reverse_phase = reverse_phase::NONE;
+		m_execution_state = exec_state::STOPPED;
+	}
+
+	m_reverse_snapshots.clear();
+	m_input_journal.clear();
+	m_input_current = nullptr;
+	m_input_base = 0;
+}
+
+
+//-------------------------------------------------
+//  input_frame - start journalling or replaying
+//  the digital input of a frame
+//-------------------------------------------------
+
+void debugger_cpu::input_frame(const attotime &curtime)
+{
+	m_input_current = nullptr;
+	m_input_port = 0;
+
+	switch (m_reverse_phase)
+	{
+	case reverse_phase::NONE:
+		// input only needs to be kept once there is a snapshot to replay from
+		if (!m_input_journal.empty() && (curtime < m_input_journal.back().time))
+			reverse_invalidate();
+		if (!m_reverse_snapshots.empty())
+		{
+			m_input_journal.emplace_back();
+			m_input_journal.back().time = curtime;
+			m_input_current = &m_input_journal.back();
+		}
+		break;
+
+	case reverse_phase::SEEK:
+	case reverse_phase::SCAN:
+		{
+			// past the end of the journal, input is live again
+			const size_t index = m_input_next - m_input_base;
+			if ((index < m_input_journal.size()) && (m_input_journal[index].time == curtime))
+			{
+				m_input_current = &m_input_journal[index];
+				m_input_next++;
+			}
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+
+//-------------------------------------------------
+//  input_port_update - journal or replay the
+//  digital state of a port
+//-------------------------------------------------
+
+void debugger_cpu::input_port_update(ioport_port &port)
+{
+	if (m_input_current == nullptr)
+		return;
+
+	if (m_reverse_phase == reverse_phase::NONE)
+		m_input_current->digital.push_back(port.live().digital);
+	else if (m_input_port < m_input_current->digital.size())
+		port.live().digital = m_input_current->digital[m_input_port++];
+}
+
+
+//-------------------------------------------------
+//  reverse_device_index - index of a device's
+//  instruction count in the snapshots
+//-------------------------------------------------
+
+int debugger_cpu::reverse_device_index(device_t &device) const
+{
+	auto const found = std::find(m_reverse_devices.begin(), m_reverse_devices.end(), &device);
+	return (found != m_reverse_devices.end()) ? int(found - m_reverse_devices.begin()) : -1;
+}
+
+
+//-------------------------------------------------
+//  reverse_start - arrange for a snapshot to be
+//  loaded at the end of the timeslice
+//-------------------------------------------------
+
+bool debugger_cpu::reverse_start(device_t &device, int index, reverse_phase phase)
+{
+	reset_transient_flags();
+	m_reverse_device = &device;
+	m_reverse_index = index;
+	m_reverse_next = phase;
+	m_reverse_found = false;
+	m_reverse_phase = reverse_phase::LOADING;
+	m_execution_state = exec_state::RUNNING;
+	return true;
+}
+
+
+//-------------------------------------------------
+//  reverse_load - load the snapshot to replay
+//  from and start replaying
+//-------------------------------------------------
+
+void debugger_cpu::reverse_load()
+{
+	reverse_snapshot &snapshot = m_reverse_snapshots[m_reverse_index];
+	if (m_machine.save().read_buffer(&snapshot.state[0], snapshot.state.size()) != STATERR_NONE)
+	{
+		m_machine.debugger().console().printf("Error loading snapshot\n");
+		reverse_invalidate();
+		return;
+	}
+
+	for (size_t devindex = 0; devindex < m_reverse_devices.size(); devindex++)
+		m_reverse_devices[devindex]->debug()->set_instruction_count(snapshot.counts[devindex]);
+	m_input_next = snapshot.frame;
+
+	// nothing is shown or heard until the destination is reached
+	m_machine.video().set_speculative(true);
+	m_machine.sound().set_speculative(true);
+	m_reverse_replay_ticks = osd_ticks();
+	m_reverse_replay_time = snapshot.time;
+	m_reverse_phase = m_reverse_next;
+}
+
+
+//-------------------------------------------------
+//  reverse_capture - take a snapshot, reusing
+//  the oldest one once the ring is full
+//-------------------------------------------------
+
+void debugger_cpu::reverse_capture()
+{
+	// the device list is fixed once the machine is running
+	if (m_reverse_devices.empty())
+		for (device_t &device : device_iterator(m_machine.root_device()))
+			m_reverse_devices.push_back(&device);
+
+	// keep as many snapshots as fit in the rewind capacity, but at least two
+	const size_t size = ram_state::get_size(m_machine.save());
+	const size_t capacity = std::max<size_t>(2, size_t(m_machine.options().rewind_capacity()) * 1024 * 1024 / std::max<size_t>(size, 1));
+	reverse_snapshot snapshot;
+	if (m_reverse_snapshots.size() >= capacity)
+	{
+		snapshot = std::move(m_reverse_snapshots.front());
+		m_reverse_snapshots.pop_front();
+	}
+	snapshot.state.resize(size);
+
+	const osd_ticks_t start = osd_ticks();
+	if (m_machine.save().write_buffer(&snapshot.state[0], size) != STATERR_NONE)
+	{
+		reverse_invalidate();
+		return;
+	}
+	const double ticks = double(osd_ticks() - start);
+	m_reverse_capture_ticks = (m_reverse_capture_ticks == 0.0) ? ticks : (m_reverse_capture_ticks * 0.75 + ticks * 0.25);
+
+	snapshot.time = m_machine.time();
+	snapshot.counts.resize(m_reverse_devices.size());
+	for (size_t devindex = 0; devindex < m_reverse_devices.size(); devindex++)
+		snapshot.counts[devindex] = m_reverse_devices[devindex]->debug()->instruction_count();
+	snapshot.frame = m_input_base + m_input_journal.size();
+	m_reverse_snapshots.push_back(std::move(snapshot));
+
+	// input from before the oldest snapshot can't be replayed any more
+	while (m_input_base < m_reverse_snapshots.front().frame)
+	{
+		m_input_journal.pop_front();
+		m_input_base++;
+	}
+}
+
+
+//-------------------------------------------------
+//  reverse_measure - measure the cost of the
+//  replay just ended and retune the interval
+//  between snapshots
+//-------------------------------------------------
+
+void debugger_cpu::reverse_measure()
+{
+	const double emulated = (m_machine.time() - m_reverse_replay_time).as_double();
+	if (emulated >= 0.001)
+	{
+		const double rate = double(osd_ticks() - m_reverse_replay_ticks) / emulated;
+		m_reverse_replay_rate = (m_reverse_replay_rate == 0.0) ? rate : (m_reverse_replay_rate * 0.75 + rate * 0.25);
+	}
+	if (m_reverse_replay_rate == 0.0)
+		return;
+
+	// replaying a whole interval should take about a quarter of a second, as
+	// long as taking snapshots costs no more than a twentieth of the run time
+	double interval = 0.25 * double(osd_ticks_per_second()) / m_reverse_replay_rate;
+	interval = std::max(interval, 20.0 * m_reverse_capture_ticks / m_reverse_replay_rate);
+	interval = std::min(std::max(interval, 0.001), 10.0);
+	m_reverse_interval = attotime::from_double(interval);
+}
+
+
+//-------------------------------------------------
+//  reverse_finish - hand control back to the
+//  user at the destination
+//-------------------------------------------------
+
+void debugger_cpu::reverse_finish()
+{
+	reverse_measure();
+	m_reverse_phase = reverse_phase::NONE;
+	m_machine.video().set_speculative(false);
+	m_machine.sound().set_speculative(false);
+
+	// the recorded future no longer holds once the user takes over
+	const attotime now = m_machine.time();
+	while (!m_reverse_snapshots.empty() && (m_reverse_snapshots.back().time > now))
+		m_reverse_snapshots.pop_back();
+	if (m_input_next - m_input_base < m_input_journal.size())
+		m_input_journal.resize(m_input_next - m_input_base);
+	m_input_current = nullptr;
+}
+
 //**************************************************************************
 //  DEVICE DEBUG
 //**************************************************************************
@@ -430,6 +850,7 @@ device_debug::device_debug(device_t &device)
 	, m_endexectime(attotime::zero)
 	, m_total_cycles(0)
 	, m_last_total_cycles(0)
+	, m_instruction_count(0)
 	, m_pc_history_index(0)
 	, m_bplist()
 	, m_rplist(std::make_unique<std::forward_list<debug_registerpoint>>())
@@ -718,6 +1139,7 @@ void device_debug::instruction_hook(offs_t curpc)
 
 	// note that we are in the debugger code
 	debugcpu.set_within_instruction(true);
+	m_instruction_count++;
 
 	// update the history
 	m_pc_history[m_pc_history_index++ % HISTORY_SIZE] = curpc;
@@ -787,6 +1209,10 @@ void device_debug::instruction_hook(offs_t curpc)
 			breakpoint_check(curpc);
 	}
 
+	// reverse execution decides for itself whether to stop while replaying
+	if (debugcpu.reverse_active())
+		debugcpu.reverse_instruction_hook(m_device);
+
 	// if we are supposed to halt, do it now
 	if (debugcpu.is_stopped())
 	{
@@ -1551,14 +1977,14 @@ u32 device_debug::compute_opcode_crc32(offs_t pc) const
 //  trace - trace execution of a given device
 //-------------------------------------------------
 
-void device_debug::trace(FILE *file, bool trace_over, bool detect_loops, bool logerror, const char *action)
+void device_debug::trace(FILE *file, bool trace_over, bool detect_loops, bool logerror, const char *action, bool binary, bool registers)
 {
 	// delete any existing tracers
 	m_trace = nullptr;
 
 	// if we have a new file, make a new tracer
 	if (file != nullptr)
-		m_trace = std::make_unique<tracer>(*this, *file, trace_over, detect_loops, logerror, action);
+		m_trace = std::make_unique<tracer>(*this, *file, trace_over, detect_loops, logerror, action, binary, registers);
 }
 
 
@@ -1800,11 +2226,176 @@ void device_debug::hotspot_check(address_space &space, offs_t address)
 //  TRACER
 //**************************************************************************
 
+/*
+    Binary trace format
+
+    All values are little-endian.  The file starts with a header:
+
+        char[8]     "MAMETRC\0"
+        u16         format version (1)
+        s8          program space address shift
+        u8          program space endianness (0 = little, 1 = big)
+        u8          program space logical address width in bits
+        u16, chars  CPU tag
+        u16, chars  CPU short name
+        u16         number of registers logged, then for each:
+        u16, chars  register symbol
+
+    followed by records, each starting with a type byte:
+
+        0x00        instruction: u32 PC, u8 count, opcode bytes
+          | 0x10      then u8 count, parameter bytes (separate opcode/data spaces)
+          | 0x20      then u16 count, count * (u16 register, u64 value) changed since the last record
+        0x01        loop: u32 instructions skipped by loop detection
+        0x02        text: u32 length, then tracelog/logerror output
+
+    Opcode bytes are in address order for byte-addressed spaces, and each
+    word little-endian for word-addressed ones, as debug_disasm_buffer::data_get
+    returns them.  src/tools/unidasm.cpp reads this format with -trace.
+*/
+
+namespace {
+
+constexpr char TRACE_MAGIC[8] = { 'M', 'A', 'M', 'E', 'T', 'R', 'C', 0 };
+constexpr u16 TRACE_VERSION = 1;
+
+enum : u8
+{
+	TRACE_INSTRUCTION = 0x00,
+	TRACE_LOOP = 0x01,
+	TRACE_TEXT = 0x02,
+
+	TRACE_HAS_PARAMS = 0x10,
+	TRACE_HAS_REGISTERS = 0x20
+};
+
+} // anonymous namespace
+
+
+//-------------------------------------------------
+//  binary_writer - records are gathered in large
+//  blocks, and a ring of blocks is written out by
+//  a background thread so the emulation thread
+//  never waits on the file unless the ring fills
+//-------------------------------------------------
+
+class device_debug::tracer::binary_writer
+{
+public:
+	binary_writer(FILE &file)
+		: m_file(file)
+		, m_head(0)
+		, m_tail(0)
+		, m_queued(0)
+		, m_exiting(false)
+	{
+		for (auto &block : m_ring)
+			block.reserve(BLOCK_SIZE + 256);
+		m_thread = std::thread([this] () { run(); });
+	}
+
+	~binary_writer()
+	{
+		flush();
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_exiting = true;
+		}
+		m_ready.notify_one();
+		m_thread.join();
+	}
+
+	template <typename T> void put(T value)
+	{
+		std::vector<u8> &block = m_ring[m_head];
+		for (unsigned i = 0; i < sizeof(T); i++)
+			block.push_back(u8(u64(value) >> (8 * i)));
+	}
+
+	void put_bytes(const void *data, size_t length)
+	{
+		std::vector<u8> &block = m_ring[m_head];
+		block.insert(block.end(), reinterpret_cast<const u8 *>(data), reinterpret_cast<const u8 *>(data) + length);
+	}
+
+	void put_string(const char *str)
+	{
+		size_t const length = std::min<size_t>(strlen(str), 0xffff);
+		put<u16>(u16(length));
+		put_bytes(str, length);
+	}
+
+	// call after each complete record
+	void end_record()
+	{
+		if (m_ring[m_head].size() >= BLOCK_SIZE)
+			submit();
+	}
+
+	// hand over everything gathered so far and wait for it to reach the file
+	void flush()
+	{
+		if (!m_ring[m_head].empty())
+			submit();
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_space.wait(lock, [this] () { return m_queued == 0; });
+		fflush(&m_file);
+	}
+
+private:
+	static constexpr size_t BLOCK_SIZE = 256 * 1024;
+	static constexpr unsigned RING_BLOCKS = 8;
+
+	void submit()
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_queued++;
+		m_head = (m_head + 1) % RING_BLOCKS;
+		m_ready.notify_one();
+
+		// the next block is free once the writer has caught up with it
+		m_space.wait(lock, [this] () { return m_queued < RING_BLOCKS; });
+	}
+
+	void run()
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		while (true)
+		{
+			m_ready.wait(lock, [this] () { return m_queued != 0 || m_exiting; });
+			if (m_queued == 0)
+				break;
+
+			std::vector<u8> &block = m_ring[m_tail];
+			lock.unlock();
+			fwrite(block.data(), 1, block.size(), &m_file);
+			block.clear();
+			lock.lock();
+
+			m_tail = (m_tail + 1) % RING_BLOCKS;
+			m_queued--;
+			m_space.notify_all();
+		}
+	}
+
+	FILE &                  m_file;             // file being written
+	std::vector<u8>         m_ring[RING_BLOCKS]; // blocks being filled, queued or written
+	unsigned                m_head;             // block being filled
+	unsigned                m_tail;             // oldest queued block
+	std::thread             m_thread;           // writer thread
+	std::mutex              m_mutex;            // protects the counts below
+	std::condition_variable m_ready;            // signalled when a block is queued or on exit
+	std::condition_variable m_space;            // signalled when a block has been written
+	unsigned                m_queued;           // blocks waiting for or being written
+	bool                    m_exiting;          // writer should drain the ring and exit
+};
+
+
 //-------------------------------------------------
 //  tracer - constructor
 //-------------------------------------------------
 
-device_debug::tracer::tracer(device_debug &debug, FILE &file, bool trace_over, bool detect_loops, bool logerror, const char *action)
+device_debug::tracer::tracer(device_debug &debug, FILE &file, bool trace_over, bool detect_loops, bool logerror, const char *action, bool binary, bool registers)
 	: m_debug(debug)
 	, m_file(file)
 	, m_action((action != nullptr) ? action : "")
@@ -1816,6 +2407,21 @@ device_debug::tracer::tracer(device_debug &debug, FILE &file, bool trace_over, b
 	, m_trace_over_target(~0)
 {
 	memset(m_history, 0, sizeof(m_history));
+
+	if (binary)
+	{
+		if (registers && m_debug.m_state != nullptr)
+		{
+			for (auto &entry : m_debug.m_state->state_entries())
+				if (entry->visible() && !entry->divider())
+					m_regentries.push_back(entry.get());
+			m_regvalues.resize(m_regentries.size());
+			for (size_t i = 0; i < m_regentries.size(); i++)
+				m_regvalues[i] = m_regentries[i]->value();
+		}
+		m_binary = std::make_unique<binary_writer>(file);
+		binary_header();
+	}
 }
 
 
@@ -1825,6 +2431,9 @@ device_debug::tracer::tracer(device_debug &debug, FILE &file, bool trace_over, b
 
 device_debug::tracer::~tracer()
 {
+	// drain the writer before the file goes away
+	m_binary.reset();
+
 	// make sure we close the file if we can
 	fclose(&m_file);
 }
@@ -1862,7 +2471,16 @@ void device_debug::tracer::update(offs_t pc)
 
 		// if we just finished looping, indicate as much
 		if (m_loops != 0)
-			fprintf(&m_file, "\n   (loops for %d instructions)\n\n", m_loops);
+		{
+			if (m_binary)
+			{
+				m_binary->put<u8>(TRACE_LOOP);
+				m_binary->put<u32>(m_loops);
+				m_binary->end_record();
+			}
+			else
+				fprintf(&m_file, "\n   (loops for %d instructions)\n\n", m_loops);
+		}
 		m_loops = 0;
 	}
 
@@ -1871,13 +2489,22 @@ void device_debug::tracer::update(offs_t pc)
 		m_debug.m_device.machine().debugger().console().execute_command(m_action, false);
 
 	debug_disasm_buffer buffer(m_debug.device());
-	std::string instruction;
-	offs_t next_pc, size;
 	u32 dasmresult;
-	buffer.disassemble(pc, instruction, next_pc, size, dasmresult);
+	if (m_binary)
+	{
+		// the binary format only needs the length; the text is produced offline
+		dasmresult = buffer.disassemble_info(pc);
+		binary_update(pc, buffer, dasmresult & util::disasm_interface::LENGTHMASK);
+	}
+	else
+	{
+		std::string instruction;
+		offs_t next_pc, size;
+		buffer.disassemble(pc, instruction, next_pc, size, dasmresult);
 
-	// output the result
-	fprintf(&m_file, "%s: %s\n", buffer.pc_to_string(pc).c_str(), instruction.c_str());
+		// output the result
+		fprintf(&m_file, "%s: %s\n", buffer.pc_to_string(pc).c_str(), instruction.c_str());
+	}
 
 	// do we need to step the trace over this instruction?
 	if (m_trace_over && (dasmresult & util::disasm_interface::SUPPORTED) != 0 && (dasmresult & util::disasm_interface::STEP_OVER) != 0)
@@ -1895,7 +2522,79 @@ void device_debug::tracer::update(offs_t pc)
 	// log this PC
 	m_nextdex = (m_nextdex + 1) % TRACE_LOOPS;
 	m_history[m_nextdex] = pc;
-	fflush(&m_file);
+	if (!m_binary)
+		fflush(&m_file);
+}
+
+
+//-------------------------------------------------
+//  binary_header - write the binary format header
+//-------------------------------------------------
+
+void device_debug::tracer::binary_header()
+{
+	address_space &space = m_debug.device().memory().space(AS_PROGRAM);
+
+	m_binary->put_bytes(TRACE_MAGIC, sizeof(TRACE_MAGIC));
+	m_binary->put<u16>(TRACE_VERSION);
+	m_binary->put<s8>(space.addr_shift());
+	m_binary->put<u8>((space.endianness() == ENDIANNESS_BIG) ? 1 : 0);
+	m_binary->put<u8>(space.logaddr_width());
+	m_binary->put_string(m_debug.device().tag());
+	m_binary->put_string(m_debug.device().shortname());
+	m_binary->put<u16>(u16(m_regentries.size()));
+	for (const device_state_entry *entry : m_regentries)
+		m_binary->put_string(entry->symbol());
+	m_binary->end_record();
+}
+
+
+//-------------------------------------------------
+//  binary_update - write the record for one
+//  instruction
+//-------------------------------------------------
+
+void device_debug::tracer::binary_update(offs_t pc, const debug_disasm_buffer &buffer, offs_t size)
+{
+	buffer.data_get(pc, size, true, m_opcodes);
+	buffer.data_get(pc, size, false, m_params);
+
+	m_regchanges.clear();
+	for (size_t i = 0; i < m_regentries.size(); i++)
+	{
+		u64 const value = m_regentries[i]->value();
+		if (value != m_regvalues[i])
+		{
+			m_regvalues[i] = value;
+			m_regchanges.emplace_back(u16(i), value);
+		}
+	}
+
+	u8 type = TRACE_INSTRUCTION;
+	if (!m_params.empty())
+		type |= TRACE_HAS_PARAMS;
+	if (!m_regchanges.empty())
+		type |= TRACE_HAS_REGISTERS;
+
+	m_binary->put<u8>(type);
+	m_binary->put<u32>(pc);
+	m_binary->put<u8>(u8(std::min<size_t>(m_opcodes.size(), 0xff)));
+	m_binary->put_bytes(m_opcodes.data(), std::min<size_t>(m_opcodes.size(), 0xff));
+	if (!m_params.empty())
+	{
+		m_binary->put<u8>(u8(std::min<size_t>(m_params.size(), 0xff)));
+		m_binary->put_bytes(m_params.data(), std::min<size_t>(m_params.size(), 0xff));
+	}
+	if (!m_regchanges.empty())
+	{
+		m_binary->put<u16>(u16(m_regchanges.size()));
+		for (auto const &change : m_regchanges)
+		{
+			m_binary->put<u16>(change.first);
+			m_binary->put<u64>(change.second);
+		}
+	}
+	m_binary->end_record();
 }
 
 
@@ -1905,6 +2604,33 @@ void device_debug::tracer::update(offs_t pc)
 
 void device_debug::tracer::vprintf(const char *format, va_list va)
 {
+	if (m_binary)
+	{
+		// format into a text record
+		char buffer[1024];
+		va_list vacopy;
+		va_copy(vacopy, va);
+		int const length = vsnprintf(buffer, sizeof(buffer), format, vacopy);
+		va_end(vacopy);
+		if (length < 0)
+			return;
+
+		m_binary->put<u8>(TRACE_TEXT);
+		m_binary->put<u32>(u32(length));
+		if (size_t(length) < sizeof(buffer))
+		{
+			m_binary->put_bytes(buffer, length);
+		}
+		else
+		{
+			std::vector<char> large(length + 1);
+			vsnprintf(&large[0], large.size(), format, va);
+			m_binary->put_bytes(&large[0], length);
+		}
+		m_binary->end_record();
+		return;
+	}
+
 	// pass through to the file
 	vfprintf(&m_file, format, va);
 	fflush(&m_file);
@@ -1918,7 +2644,10 @@ void device_debug::tracer::vprintf(const char *format, va_list va)
 
 void device_debug::tracer::flush()
 {
-	fflush(&m_file);
+	if (m_binary)
+		m_binary->flush();
+	else
+		fflush(&m_file);
 }
 
 
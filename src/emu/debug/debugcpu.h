@@ -13,6 +13,7 @@
 
 #pragma once
 
+#include <deque>
 #include <set>
 
 
@@ -30,6 +31,8 @@ constexpr int COMMENT_VERSION       = 1;
 
 typedef int (*debug_instruction_hook_func)(device_t &device, offs_t curpc);
 
+class debug_disasm_buffer;
+
 
 // ======================> device_debug
 
@@ -135,6 +138,10 @@ public:
 	// history
 	offs_t history_pc(int index) const;
 
+	// instructions executed since start, for locating a point in reverse execution
+	u64 instruction_count() const { return m_instruction_count; }
+	void set_instruction_count(u64 count) { m_instruction_count = count; }
+
 	// pc tracking
 	void set_track_pc(bool value) { m_track_pc = value; }
 	bool track_pc_visited(const offs_t& pc) const;
@@ -149,7 +156,7 @@ public:
 	void track_mem_data_clear() { m_track_mem_set.clear(); }
 
 	// tracing
-	void trace(FILE *file, bool trace_over, bool detect_loops, bool logerror, const char *action);
+	void trace(FILE *file, bool trace_over, bool detect_loops, bool logerror, const char *action, bool binary = false, bool registers = false);
 	void trace_printf(const char *fmt, ...) ATTR_PRINTF(2,3);
 	void trace_flush() { if (m_trace != nullptr) m_trace->flush(); }
 
@@ -201,6 +208,7 @@ private:
 	attotime                m_endexectime;              // ending time of the current execution
 	u64                     m_total_cycles;             // current total cycles
 	u64                     m_last_total_cycles;        // last total cycles
+	u64                     m_instruction_count;        // instruction hooks called so far
 
 	// history
 	offs_t                  m_pc_history[HISTORY_SIZE]; // history of recent PCs
@@ -218,7 +226,7 @@ private:
 	class tracer
 	{
 	public:
-		tracer(device_debug &debug, FILE &file, bool trace_over, bool detect_loops, bool logerror, const char *action);
+		tracer(device_debug &debug, FILE &file, bool trace_over, bool detect_loops, bool logerror, const char *action, bool binary, bool registers);
 		~tracer();
 
 		void update(offs_t pc);
@@ -229,6 +237,11 @@ private:
 	private:
 		static const int TRACE_LOOPS = 64;
 
+		class binary_writer;
+
+		void binary_header();
+		void binary_update(offs_t pc, const debug_disasm_buffer &buffer, offs_t size);
+
 		device_debug &      m_debug;                    // reference to our owner
 		FILE &              m_file;                     // tracing file for this CPU
 		std::string         m_action;                   // action to perform during a trace
@@ -241,6 +254,12 @@ private:
 		offs_t              m_trace_over_target;        // target for tracing over
 														//    (0 = not tracing over,
 														//    ~0 = not currently tracing over)
+		std::unique_ptr<binary_writer> m_binary;        // background writer, if writing the binary format
+		std::vector<const device_state_entry *> m_regentries; // registers logged in binary records
+		std::vector<u64>    m_regvalues;                // register values as of the last binary record
+		std::vector<std::pair<u16, u64>> m_regchanges;  // scratch for changed registers
+		std::vector<u8>     m_opcodes;                  // scratch for opcode bytes
+		std::vector<u8>     m_params;                   // scratch for parameter bytes
 	};
 	std::unique_ptr<tracer>                m_trace;                    // tracer state
 
@@ -411,11 +430,52 @@ public:
 	void ensure_comments_loaded();
 	void reset_transient_flags();
 
+	// reverse execution
+	void reverse_update();
+	bool reverse_active() const { return m_reverse_phase != reverse_phase::NONE; }
+	void reverse_instruction_hook(device_t &device);
+	bool reverse_step(device_t &device, u64 steps);
+	bool reverse_go(device_t &device);
+	void reverse_invalidate();
+
+	// input journal for reverse execution, fed by the input port manager
+	void input_frame(const attotime &curtime);
+	void input_port_update(ioport_port &port);
+
 private:
 	static const size_t NUM_TEMP_VARIABLES;
 
+	// reverse execution replays forward from a snapshot to the requested point
+	enum class reverse_phase
+	{
+		NONE,       // running live, taking snapshots
+		LOADING,    // waiting for the end of the timeslice to load a snapshot
+		SEEK,       // replaying to a target instruction
+		SCAN        // replaying to find the last breakpoint hit before a point
+	};
+
+	struct reverse_snapshot
+	{
+		attotime            time;                   // machine time of the snapshot
+		std::vector<u64>    counts;                 // instruction count of each device
+		size_t              frame;                  // first input frame after the snapshot
+		std::vector<u8>     state;                  // saved machine state
+	};
+
+	struct input_record
+	{
+		attotime                    time;           // time of the input frame
+		std::vector<ioport_value>   digital;        // digital state of each port
+	};
+
 	// internal helpers
 	void on_vblank(screen_device &device, bool vblank_state);
+	int reverse_device_index(device_t &device) const;
+	bool reverse_start(device_t &device, int index, reverse_phase phase);
+	void reverse_load();
+	void reverse_capture();
+	void reverse_measure();
+	void reverse_finish();
 
 	running_machine&    m_machine;
 
@@ -442,6 +502,29 @@ private:
 	osd_ticks_t m_last_periodic_update_time;
 
 	bool        m_comments_loaded;
+
+	// reverse execution
+	reverse_phase               m_reverse_phase;            // what reverse execution is doing
+	reverse_phase               m_reverse_next;             // phase to enter once the snapshot is loaded
+	std::deque<reverse_snapshot> m_reverse_snapshots;       // snapshots, oldest first
+	std::vector<device_t *>     m_reverse_devices;          // devices whose instruction counts are saved
+	attotime                    m_reverse_interval;         // emulated time between snapshots
+	double                      m_reverse_capture_ticks;    // average cost of a snapshot
+	double                      m_reverse_replay_rate;      // average replay cost per emulated second
+	device_t *                  m_reverse_device;           // device being stepped backwards
+	int                         m_reverse_index;            // snapshot being replayed from
+	u64                         m_reverse_target;           // instruction count to stop at
+	u64                         m_reverse_scan_end;         // instruction count ending the scan
+	bool                        m_reverse_found;            // whether the scan hit a breakpoint
+	u64                         m_reverse_hit;              // instruction count of the last hit
+	osd_ticks_t                 m_reverse_replay_ticks;     // when the current replay started
+	attotime                    m_reverse_replay_time;      // machine time the current replay started at
+
+	std::deque<input_record>    m_input_journal;            // digital input per frame since the oldest snapshot
+	input_record *              m_input_current;            // record being written or replayed
+	size_t                      m_input_base;               // frame number of the oldest record
+	size_t                      m_input_next;               // frame number of the next record to replay
+	size_t                      m_input_port;               // next port in the current record
 };
 
 #endif // MAME_EMU_DEBUG_DEBUGCPU_H
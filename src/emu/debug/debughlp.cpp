@@ -126,6 +126,7 @@ static const help_item static_help_list[] =
 		"  mapd <address> -- map logical data address to physical address and bank\n"
 		"  mapi <address> -- map logical I/O address to physical address and bank\n"
 		"  memdump [<filename>] -- dump the current memory map to <filename>\n"
+		"  mapstats -- show how often each address map has changed since startup and what it cost\n"
 	},
 	{
 		"execution",
@@ -142,6 +143,8 @@ static const help_item static_help_list[] =
 		"  gt[ime] <milliseconds> -- resumes execution until the given delay has elapsed\n"
 		"  gv[blank] -- resumes execution, setting temp breakpoint on the next VBLANK (F8)\n"
 		"  n[ext] -- executes until the next CPU switch (F6)\n"
+		"  rs[tep] [<count>=1] -- steps backwards <count> instructions\n"
+		"  rg[o] -- runs backwards to the most recent breakpoint or watchpoint hit\n"
 		"  focus <CPU> -- focuses debugger only on <CPU>\n"
 		"  ignore [<CPU>[,<CPU>[,...]]] -- stops debugging on <CPU>\n"
 		"  observe [<CPU>[,<CPU>[,...]]] -- resumes debugging on <CPU>\n"
@@ -151,6 +154,9 @@ static const help_item static_help_list[] =
 		"  trace {<filename>|OFF}[,<CPU>[,<detectloops>[,<action>]]] -- trace the given CPU to a file (defaults to active CPU)\n"
 		"  traceover {<filename>|OFF}[,<CPU>[,<detectloops>[,<action>]]] -- trace the given CPU to a file, but skip subroutines (defaults to active CPU)\n"
 		"  traceflush -- flushes all open trace files\n"
+		"  profile [{<rate>|OFF}[,<CPU>]] -- samples the PC of all CPUs, or <CPU>, <rate> times per emulated second\n"
+		"  profilelist [<count>] -- lists the <count> most sampled instructions of each CPU\n"
+		"  profilesave <filename>[,folded] -- saves the profile as a report or as folded stacks\n"
 	},
 	{
 		"breakpoints",
@@ -820,6 +826,50 @@ static const help_item static_help_list[] =
 		"CPU is scheduled. Note that if you have used 'ignore' to ignore certain CPUs, you will not "
 		"stop until a non-'ignore'd CPU is scheduled.\n"
 	},
+	{
+		"rstep",
+		"\n"
+		"  rs[tep] [<count>=1]\n"
+		"\n"
+		"The rstep command steps backwards one or more instructions in the currently executing CPU. "
+		"While the machine runs under the debugger, snapshots of its state are kept in memory, up to "
+		"the size given by the rewind_capacity option, along with the digital input of every frame. "
+		"Stepping backwards loads the most recent snapshot from before the destination and runs "
+		"forward again, replaying the recorded input, until the destination is reached. How often "
+		"snapshots are taken is adjusted automatically so replaying from one takes a fraction of a "
+		"second.\n"
+		"\n"
+		"This relies on the machine's save state support, and on the emulation running the same way "
+		"the second time. Analog input is not recorded, so while replaying it is taken from the "
+		"current state of the controls. Modifying memory from the debugger, or loading a state, "
+		"discards the recorded history; registers changed from the debugger are not replayed. Breakpoints hit on the way are reported, but only stop "
+		"execution at the destination.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"rs\n"
+		"  Steps backwards one instruction on the current CPU.\n"
+		"\n"
+		"rstep 100\n"
+		"  Steps backwards one hundred instructions on the current CPU.\n"
+	},
+	{
+		"rgo",
+		"\n"
+		"  rg[o]\n"
+		"\n"
+		"The rgo command runs the currently executing CPU backwards until the most recent point at "
+		"which a breakpoint or watchpoint stopped execution, searching the recorded history one "
+		"snapshot at a time from the most recent. If nothing is hit, it stops at the earliest "
+		"instruction recorded. See 'help rstep' for how the history is recorded and its limitations; "
+		"in addition, breakpoint and watchpoint actions are run every time they are hit during the "
+		"search.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"rg\n"
+		"  Runs backwards to the last breakpoint or watchpoint hit on the current CPU.\n"
+	},
 	{
 		"focus",
 		"\n"
@@ -876,7 +926,7 @@ static const help_item static_help_list[] =
 	{
 		"trace",
 		"\n"
-		"  trace {<filename>|OFF}[,<CPU>[,[noloop|logerror][,<action>]]]\n"
+		"  trace {<filename>|OFF}[,<CPU>[,[noloop|logerror|binary|registers][,<action>]]]\n"
 		"\n"
 		"Starts or stops tracing of the execution of the specified <CPU>. If <CPU> is omitted, "
 		"the currently active CPU is specified. When enabling tracing, specify the filename in the "
@@ -884,7 +934,10 @@ static const help_item static_help_list[] =
 		"<detectloops> should be either true or false. If 'noloop' is omitted, the trace "
 		"will have loops detected and condensed to a single line. If 'noloop' is specified, the trace "
 		"will contain every opcode as it is executed. If 'logerror' is specified, logerror output "
-		"will augment the trace.  If you "
+		"will augment the trace. If 'binary' is specified, the trace is written in a compact binary "
+		"format from a background thread, which is much faster for long sessions; use unidasm -trace "
+		"to disassemble and search it afterwards. 'registers' implies 'binary' and also records the "
+		"registers that changed before each instruction. If you "
 		"wish to log additional information on each trace, you can append an <action> parameter which "
 		"is a command that is executed before each trace is logged. Generally, this is used to include "
 		"a 'tracelog' command. Note that you may need to embed the action within braces { } in order "
@@ -908,6 +961,9 @@ static const help_item static_help_list[] =
 		"trace starswep.tr,0,logerror|noloop\n"
 		"  Begin tracing the execution of CPU #0, logging output (along with logerror output) to starswep.tr, with loop detection disabled.\n"
 		"\n"
+		"trace robotron.trb,0,binary|noloop\n"
+		"  Begin tracing the execution of CPU #0 in binary format to robotron.trb, with loop detection disabled.\n"
+		"\n"
 		"trace >>pigskin.tr\n"
 		"  Begin tracing the currently active CPU, appending log output to pigskin.tr.\n"
 		"\n"
@@ -1187,6 +1243,61 @@ static const help_item static_help_list[] =
 		"  Looks for hotspots on CPU 1 using a search buffer of 64 entries, reporting any entries which "
 		"end up with 1000 or more hits.\n"
 	},
+	{
+		"profile",
+		"\n"
+		"  profile [{<rate>|OFF}[,<CPU>]]\n"
+		"\n"
+		"The profile command discards any previous samples and starts recording the PC of each CPU "
+		"<rate> times per second of emulated time, which defaults to #1000. If <CPU> is given, only "
+		"that CPU is sampled. Samples are taken by a timer, so the CPUs run at full speed between them "
+		"and the counts show where each CPU spends its cycles; the timer does add scheduling points, "
+		"so very high rates change timing slightly. 'profile off' stops sampling but keeps the samples "
+		"for profilelist and profilesave.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"profile\n"
+		"  Samples every CPU 1000 times per emulated second.\n"
+		"\n"
+		"profile #10000,maincpu\n"
+		"  Samples only the CPU tagged 'maincpu' 10000 times per emulated second.\n"
+		"\n"
+		"profile off\n"
+		"  Stops sampling.\n"
+	},
+	{
+		"profilelist",
+		"\n"
+		"  profilelist [<count>]\n"
+		"\n"
+		"The profilelist command shows the <count> most sampled instructions of each profiled CPU, "
+		"defaulting to #20, with the share of samples, the sample count, the disassembly and any "
+		"comment. The disassembly is of memory as it is now, which can differ from what ran if the "
+		"code has since been overwritten.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"profilelist #50\n"
+		"  Shows the 50 most sampled instructions of each CPU.\n"
+	},
+	{
+		"profilesave",
+		"\n"
+		"  profilesave <filename>[,folded]\n"
+		"\n"
+		"The profilesave command writes every sampled instruction of each profiled CPU to <filename>, "
+		"in the format used by profilelist. With 'folded', each line is instead '<CPU>;<instruction> "
+		"<count>', the folded stack format read by flame graph tools.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"profilesave robby.prof\n"
+		"  Saves the full profile report to robby.prof.\n"
+		"\n"
+		"profilesave robby.folded,folded\n"
+		"  Saves the profile as folded stacks to robby.folded, e.g. for flamegraph.pl.\n"
+	},
 	{
 		"rpset",
 		"\n"
@@ -1300,6 +1411,15 @@ static const help_item static_help_list[] =
 		"memdump\n"
 		"  Dumps memory to memdump.log.\n"
 	},
+	{
+		"mapstats",
+		"\n"
+		"  mapstats\n"
+		"\n"
+		"Lists every address space whose map has changed since startup, with the number of installs and "
+		"unmaps, the number of times caches and other change notifiers were told about them, how many "
+		"changes were batched into a single notification, and the time spent notifying.\n"
+	},
 	{
 		"comlist",
 		"\n"
@@ -0,0 +1,214 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/*********************************************************************
+
+    debugprof.cpp
+
+    Sampling profiler for emulated code.
+
+    A one-shot timer fires at a fixed rate of emulated time and records
+    the PC of each sampled device.  The scheduler stops every device at a
+    timer, so each sample lands on whichever instruction the device had
+    reached when its timeslice ended, which spreads samples in proportion
+    to the emulated time spent on each instruction.  Nothing is added to
+    the instruction path, so devices run at full speed between samples,
+    recompilers included.
+
+    The timer is temporary so that profiling leaves no trace in save
+    states; it re-arms itself on each sample.
+
+*********************************************************************/
+
+#include "emu.h"
+#include "debugprof.h"
+
+#include "debugbuf.h"
+#include "debugcpu.h"
+
+#include <algorithm>
+
+
+//**************************************************************************
+//  DEBUG PROFILER
+//**************************************************************************
+
+//-------------------------------------------------
+//  debug_profiler - constructor
+//-------------------------------------------------
+
+debug_profiler::debug_profiler(running_machine &machine)
+	: m_machine(machine)
+	, m_period(attotime::never)
+	, m_running(false)
+	, m_generation(0)
+	, m_samples(0)
+{
+}
+
+
+//-------------------------------------------------
+//  start - discard any previous samples and start
+//  sampling one device, or every executing device
+//  that has a PC
+//-------------------------------------------------
+
+void debug_profiler::start(const attotime &period, device_t *device)
+{
+	stop();
+	m_devices.clear();
+	m_samples = 0;
+
+	for (device_t &dev : device_iterator(machine().root_device()))
+	{
+		if (device != nullptr && &dev != device)
+			continue;
+		device_execute_interface *exec;
+		device_state_interface *state;
+		if (dev.interface(exec) && dev.interface(state) && state->state_find_entry(STATE_GENPCBASE) != nullptr)
+			m_devices.emplace_back(device_samples{ &dev, exec, state, std::unordered_map<offs_t, u64>(), 0, 0 });
+	}
+
+	m_period = period;
+	m_running = true;
+	machine().scheduler().timer_set(m_period, timer_expired_delegate(FUNC(debug_profiler::sample), this), m_generation);
+}
+
+
+//-------------------------------------------------
+//  stop - stop sampling, keeping the samples
+//-------------------------------------------------
+
+void debug_profiler::stop()
+{
+	// a timer already set will see the new generation and not re-arm
+	m_running = false;
+	m_generation++;
+}
+
+
+//-------------------------------------------------
+//  sample - record the PC of every device
+//-------------------------------------------------
+
+TIMER_CALLBACK_MEMBER(debug_profiler::sample)
+{
+	if (!m_running || param != m_generation)
+		return;
+
+	for (device_samples &samples : m_devices)
+	{
+		if (samples.exec->suspended())
+		{
+			samples.suspended++;
+		}
+		else
+		{
+			samples.hits[samples.state->pcbase()]++;
+			samples.total++;
+		}
+	}
+	m_samples++;
+
+	machine().scheduler().timer_set(m_period, timer_expired_delegate(FUNC(debug_profiler::sample), this), m_generation);
+}
+
+
+//-------------------------------------------------
+//  sorted_hits - the PCs of a device from most to
+//  least sampled
+//-------------------------------------------------
+
+std::vector<std::pair<offs_t, u64>> debug_profiler::sorted_hits(const device_samples &samples) const
+{
+	std::vector<std::pair<offs_t, u64>> result(samples.hits.begin(), samples.hits.end());
+	std::sort(result.begin(), result.end(), [] (const std::pair<offs_t, u64> &a, const std::pair<offs_t, u64> &b)
+	{
+		return (a.second != b.second) ? (a.second > b.second) : (a.first < b.first);
+	});
+	return result;
+}
+
+
+//-------------------------------------------------
+//  report - write the most sampled PCs of each
+//  device with their disassembly and comments
+//-------------------------------------------------
+
+void debug_profiler::report(std::ostream &out, unsigned count) const
+{
+	for (const device_samples &samples : m_devices)
+	{
+		u64 const all = samples.total + samples.suspended;
+		if (all == 0)
+			continue;
+		util::stream_format(out, "'%s': %u samples, %.1f%% suspended\n", samples.device->tag(), unsigned(all), 100.0 * double(samples.suspended) / double(all));
+
+		// the disassembly reflects memory as it is now, which matters for code that is overwritten
+		device_disasm_interface *dasm;
+		std::unique_ptr<debug_disasm_buffer> buffer;
+		if (samples.device->interface(dasm))
+			buffer = std::make_unique<debug_disasm_buffer>(*samples.device);
+
+		auto const hits = sorted_hits(samples);
+		for (size_t i = 0; i < hits.size() && (count == 0 || i < count); i++)
+		{
+			offs_t const pc = hits[i].first;
+			std::string text;
+			if (buffer)
+			{
+				offs_t next_pc, size;
+				u32 info;
+				buffer->disassemble(pc, text, next_pc, size, info);
+				text = buffer->pc_to_string(pc) + ": " + text;
+			}
+			else
+			{
+				text = string_format("%X", pc);
+			}
+			const char *const comment = samples.device->debug()->comment_text(pc);
+			if (comment != nullptr)
+				text += string_format("  // %s", comment);
+			util::stream_format(out, "%6.2f%% %8u  %s\n", 100.0 * double(hits[i].second) / double(all), unsigned(hits[i].second), text);
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  folded - write the samples as folded stacks,
+//  one "device;instruction count" line per PC, for
+//  flame graph tools
+//-------------------------------------------------
+
+void debug_profiler::folded(std::ostream &out) const
+{
+	for (const device_samples &samples : m_devices)
+	{
+		device_disasm_interface *dasm;
+		std::unique_ptr<debug_disasm_buffer> buffer;
+		if (samples.device->interface(dasm))
+			buffer = std::make_unique<debug_disasm_buffer>(*samples.device);
+
+		if (samples.suspended != 0)
+			util::stream_format(out, "%s;(suspended) %u\n", samples.device->tag(), unsigned(samples.suspended));
+		for (auto const &hit : sorted_hits(samples))
+		{
+			std::string text;
+			if (buffer)
+			{
+				offs_t next_pc, size;
+				u32 info;
+				buffer->disassemble(hit.first, text, next_pc, size, info);
+				text = buffer->pc_to_string(hit.first) + " " + text;
+			}
+			else
+			{
+				text = string_format("%X", hit.first);
+			}
+
+			// semicolons separate frames
+			std::replace(text.begin(), text.end(), ';', ',');
+			util::stream_format(out, "%s;%s %u\n", samples.device->tag(), text, unsigned(hit.second));
+		}
+	}
+}
@@ -0,0 +1,72 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/*********************************************************************
+
+    debugprof.h
+
+    Sampling profiler for emulated code.
+
+*********************************************************************/
+
+#ifndef MAME_EMU_DEBUG_DEBUGPROF_H
+#define MAME_EMU_DEBUG_DEBUGPROF_H
+
+#pragma once
+
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> debug_profiler
+
+// samples the PC of executing devices at a fixed rate of emulated time
+class debug_profiler
+{
+public:
+	// construction/destruction
+	debug_profiler(running_machine &machine);
+
+	// control
+	void start(const attotime &period, device_t *device);
+	void stop();
+
+	// getters
+	running_machine &machine() const { return m_machine; }
+	bool running() const { return m_running; }
+	u64 samples() const { return m_samples; }
+
+	// reports
+	void report(std::ostream &out, unsigned count) const;
+	void folded(std::ostream &out) const;
+
+private:
+	// samples for one device
+	struct device_samples
+	{
+		device_t *                          device;     // device being sampled
+		device_execute_interface *          exec;       // its execute interface
+		device_state_interface *            state;      // its state interface, for the PC
+		std::unordered_map<offs_t, u64>     hits;       // samples taken at each PC
+		u64                                 total;      // samples taken while running
+		u64                                 suspended;  // samples taken while suspended
+	};
+
+	// internal helpers
+	TIMER_CALLBACK_MEMBER(sample);
+	std::vector<std::pair<offs_t, u64>> sorted_hits(const device_samples &samples) const;
+
+	// internal state
+	running_machine &           m_machine;          // reference to our machine
+	std::vector<device_samples> m_devices;          // devices being sampled
+	attotime                    m_period;           // time between samples
+	bool                        m_running;          // true while sampling
+	int                         m_generation;       // tells stale timers from the current run
+	u64                         m_samples;          // sampling points so far
+};
+
+#endif // MAME_EMU_DEBUG_DEBUGPROF_H
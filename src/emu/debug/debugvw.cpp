@@ -78,7 +78,8 @@ debug_view::debug_view(running_machine &machine, debug_view_type type, debug_vie
 		m_update_pending(true),
 		m_osd_update_pending(true),
 		m_viewdata(m_visible.y * m_visible.x),
-		m_machine(machine)
+		m_machine(machine),
+		m_osd_cursor_visible(false)
 {
 }
 
@@ -104,15 +105,21 @@ void debug_view::end_update()
 	{
 		while (m_update_pending)
 		{
-			// no longer pending, but flag for the OSD
+			// no longer pending
 			m_update_pending = false;
-			m_osd_update_pending = true;
 
 			// resize the viewdata if needed
 			m_viewdata.resize(m_visible.x * m_visible.y);
 
 			// update the view
 			view_update();
+
+			// flag for the OSD only if it would draw something different
+			if (osd_state_changed())
+			{
+				m_osd_update_pending = true;
+				save_osd_state();
+			}
 		}
 	}
 
@@ -121,6 +128,39 @@ void debug_view::end_update()
 }
 
 
+//-------------------------------------------------
+//  osd_state_changed - determine whether the
+//  contents or geometry differ from what the OSD
+//  was last told about
+//-------------------------------------------------
+
+bool debug_view::osd_state_changed() const
+{
+	auto const differ = [] (const debug_view_xy &a, const debug_view_xy &b) { return (a.x != b.x) || (a.y != b.y); };
+	if (differ(m_visible, m_osd_visible) || differ(m_total, m_osd_total) || differ(m_topleft, m_osd_topleft) ||
+			differ(m_cursor, m_osd_cursor) || (m_cursor_visible != m_osd_cursor_visible))
+		return true;
+	return (m_viewdata.size() != m_osd_viewdata.size()) ||
+			memcmp(m_viewdata.data(), m_osd_viewdata.data(), m_viewdata.size() * sizeof(debug_view_char));
+}
+
+
+//-------------------------------------------------
+//  save_osd_state - remember what the OSD is
+//  about to be told about
+//-------------------------------------------------
+
+void debug_view::save_osd_state()
+{
+	m_osd_viewdata = m_viewdata;
+	m_osd_visible = m_visible;
+	m_osd_total = m_total;
+	m_osd_topleft = m_topleft;
+	m_osd_cursor = m_cursor;
+	m_osd_cursor_visible = m_cursor_visible;
+}
+
+
 //-------------------------------------------------
 //  flush_osd_updates - notify the OSD of any
 //  pending updates
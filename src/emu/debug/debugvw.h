@@ -219,7 +219,19 @@ protected:
 	std::vector<debug_view_char> m_viewdata;  // current array of view data
 
 private:
+	// OSD change tracking
+	bool osd_state_changed() const;
+	void save_osd_state();
+
 	running_machine &       m_machine;          // machine associated with this view
+
+	// what the OSD was last told about, so updates that change nothing aren't reported
+	std::vector<debug_view_char> m_osd_viewdata; // view data
+	debug_view_xy           m_osd_visible;      // visible size
+	debug_view_xy           m_osd_total;        // total size
+	debug_view_xy           m_osd_topleft;      // top-left visible position
+	debug_view_xy           m_osd_cursor;       // cursor position
+	bool                    m_osd_cursor_visible; // cursor visibility
 };
 
 
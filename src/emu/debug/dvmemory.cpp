@@ -114,7 +114,9 @@ debug_view_memory::debug_view_memory(running_machine &machine, debug_view_osd_up
 		m_edit_enabled(true),
 		m_maxaddr(0),
 		m_bytes_per_row(16),
-		m_byte_offset(0)
+		m_byte_offset(0),
+		m_rows_valid(false),
+		m_rows_cursor_visible(false)
 {
 	// hack: define some sane init values
 	// that don't hurt the initial computation of top_left
@@ -201,6 +203,8 @@ void debug_view_memory::enumerate_sources()
 
 void debug_view_memory::view_notify(debug_view_notification type)
 {
+	m_rows_valid = false;
+
 	if (type == VIEW_NOTIFY_CURSOR_CHANGED)
 	{
 		// normalize the cursor
@@ -379,7 +383,25 @@ void debug_view_memory::view_update()
 
 	// if we need to recompute, do it now
 	if (needs_recompute())
+	{
 		recompute();
+		m_rows_valid = false;
+	}
+
+	// rows drawn last time can be kept if nothing about the layout has changed
+	// and their data hasn't either; floating point rows are always redrawn
+	bool const keep_rows = m_rows_valid && (m_data_format <= 8) &&
+			(m_rows_visible.x == m_visible.x) && (m_rows_visible.y == m_visible.y) &&
+			(m_rows_topleft.x == m_topleft.x) && (m_rows_topleft.y == m_topleft.y) &&
+			(m_rows_cursor.x == m_cursor.x) && (m_rows_cursor.y == m_cursor.y) &&
+			(m_rows_cursor_visible == m_cursor_visible);
+	m_rows_valid = true;
+	m_rows_visible = m_visible;
+	m_rows_topleft = m_topleft;
+	m_rows_cursor = m_cursor;
+	m_rows_cursor_visible = m_cursor_visible;
+	m_row_data.resize(m_visible.y * m_chunks_per_row);
+	m_row_mapped.resize(m_visible.y * m_chunks_per_row);
 
 	// loop over visible rows
 	for (u32 row = 0; row < m_visible.y; row++)
@@ -389,6 +411,28 @@ void debug_view_memory::view_update()
 		debug_view_char *destrow = destmin - m_topleft.x;
 		u32 effrow = m_topleft.y + row;
 
+		// read the row's data and skip it if it's what was drawn last time
+		if (effrow < m_total.y && m_data_format <= 8)
+		{
+			offs_t addrbyte = m_byte_offset + effrow * m_bytes_per_row;
+			offs_t address = (source.m_space != nullptr) ? source.m_space->byte_to_address(addrbyte) : addrbyte;
+			bool unchanged = keep_rows;
+			for (int chunknum = 0; chunknum < m_chunks_per_row; chunknum++)
+			{
+				u64 chunkdata;
+				bool const ismapped = read_chunk(address, chunknum, chunkdata);
+				u32 const index = row * m_chunks_per_row + chunknum;
+				if (m_row_data[index] != chunkdata || m_row_mapped[index] != ismapped)
+				{
+					m_row_data[index] = chunkdata;
+					m_row_mapped[index] = ismapped;
+					unchanged = false;
+				}
+			}
+			if (unchanged)
+				continue;
+		}
+
 		// reset the line of data; section 1 is normal, others are ancillary, cursor is selected
 		u32 effcol = m_topleft.x;
 		for (debug_view_char *dest = destmin; dest != destmax; dest++, effcol++)
@@ -121,6 +121,15 @@ private:
 	u32                 m_byte_offset;          // (derived) offset of starting visible byte
 	std::string         m_addrformat;           // (derived) format string to use to print addresses
 
+	// rows are only regenerated when their data or the layout changes
+	bool                m_rows_valid;           // cached rows match the layout below
+	debug_view_xy       m_rows_visible;         // visible size the rows were drawn for
+	debug_view_xy       m_rows_topleft;         // top-left position the rows were drawn for
+	debug_view_xy       m_rows_cursor;          // cursor position the rows were drawn with
+	bool                m_rows_cursor_visible;  // cursor visibility the rows were drawn with
+	std::vector<u64>    m_row_data;             // chunk data drawn in each visible row
+	std::vector<bool>   m_row_mapped;           // whether each of those chunks was mapped
+
 	struct section
 	{
 		bool contains(int x) const { return x >= m_pos && x < m_pos + m_width; }
@@ -96,6 +96,17 @@ enum
 	TVL_EXECUTEFUNC
 };
 
+// compiled_op.optype values beyond the operators
+enum
+{
+	CXP_PUSH_NUMBER = 0x80,
+	CXP_PUSH_SYMBOL,
+	CXP_PUSH_MEMORY,
+	CXP_STORE_SYMBOL,
+	CXP_STORE_MEMORY,
+	CXP_STORE_MEMORYAT
+};
+
 
 
 //**************************************************************************
@@ -510,7 +521,7 @@ u64 symbol_table::read_memory(address_space &space, offs_t address, int size, bo
 //  specified memory space
 //-------------------------------------------------
 
-void symbol_table::write_memory(address_space &space, offs_t address, u64 data, int size, bool apply_translation)
+void symbol_table::write_memory(address_space &space, offs_t address, u64 data, int size, bool apply_translation, bool notify)
 {
 	if (apply_translation)
 	{
@@ -531,7 +542,52 @@ void symbol_table::write_memory(address_space &space, offs_t address, u64 data,
 	case 8:     space.write_qword_unaligned(address, data); break;
 	}
 
-	notify_memory_modified();
+	if (notify)
+		notify_memory_modified();
+}
+
+
+//-------------------------------------------------
+//  resolve_space - find the address space a
+//  logical or physical memory access goes to,
+//  so compiled expressions can skip the lookup
+//-------------------------------------------------
+
+address_space *symbol_table::resolve_space(const char *name, expression_space spacenum, bool &apply_translation)
+{
+	int spaceindex;
+	switch (spacenum)
+	{
+	case EXPSPACE_PROGRAM_LOGICAL:
+	case EXPSPACE_DATA_LOGICAL:
+	case EXPSPACE_IO_LOGICAL:
+	case EXPSPACE_SPACE3_LOGICAL:
+		spaceindex = AS_PROGRAM + (spacenum - EXPSPACE_PROGRAM_LOGICAL);
+		apply_translation = true;
+		break;
+
+	case EXPSPACE_PROGRAM_PHYSICAL:
+	case EXPSPACE_DATA_PHYSICAL:
+	case EXPSPACE_IO_PHYSICAL:
+	case EXPSPACE_SPACE3_PHYSICAL:
+		spaceindex = AS_PROGRAM + (spacenum - EXPSPACE_PROGRAM_PHYSICAL);
+		apply_translation = false;
+		break;
+
+	default:
+		return nullptr;
+	}
+
+	device_memory_interface *memory = m_memintf;
+	if (name != nullptr)
+	{
+		device_t *device = expression_get_device(name);
+		if (device != nullptr)
+			device->interface(memory);
+	}
+	if (memory == nullptr || !memory->has_space(spaceindex))
+		return nullptr;
+	return &memory->space(spaceindex);
 }
 
 
@@ -1074,10 +1130,9 @@ parsed_expression::parsed_expression(symbol_table &symtable, const char *express
 parsed_expression::parsed_expression(const parsed_expression &src)
 	: m_symtable(src.m_symtable)
 	, m_default_base(src.m_default_base)
-	, m_original_string(src.m_original_string)
 {
-	if (!m_original_string.empty())
-		parse_string_into_tokens();
+	if (!src.m_original_string.empty())
+		parse(src.m_original_string.c_str());
 }
 
 
@@ -1089,6 +1144,7 @@ void parsed_expression::parse(const char *expression)
 {
 	// copy the string and reset our parsing state
 	m_original_string.assign(expression);
+	m_program.clear();
 	m_tokenlist.clear();
 	m_stringlist.clear();
 
@@ -1097,6 +1153,9 @@ void parsed_expression::parse(const char *expression)
 
 	// convert the infix order to postfix order
 	infix_to_postfix();
+
+	// flatten it if we can
+	compile();
 }
 
 
@@ -1108,9 +1167,15 @@ void parsed_expression::copy(const parsed_expression &src)
 {
 	m_symtable = src.m_symtable;
 	m_default_base = src.m_default_base;
-	m_original_string.assign(src.m_original_string);
-	if (!m_original_string.empty())
-		parse_string_into_tokens();
+	if (!src.m_original_string.empty())
+		parse(src.m_original_string.c_str());
+	else
+	{
+		m_original_string.clear();
+		m_program.clear();
+		m_tokenlist.clear();
+		m_stringlist.clear();
+	}
 }
 
 
@@ -2196,6 +2261,317 @@ u64 parsed_expression::execute_tokens()
 }
 
 
+//-------------------------------------------------
+//  compile - flatten the postfix token list into
+//  a program over a plain value stack; memory
+//  spaces are looked up once here, and plain and
+//  compound assignments become store operations
+//-------------------------------------------------
+
+void parsed_expression::compile()
+{
+	m_program.clear();
+
+	std::vector<compiled_op> program;
+	size_t producer[MAX_PROGRAM_STACK];     // op that leaves each stack entry
+	int depth = 0;
+	for (parse_token &token : m_tokenlist)
+	{
+		compiled_op op = { 0, token.offset(), 0, nullptr, nullptr, nullptr, false };
+		if (token.is_number())
+		{
+			op.optype = CXP_PUSH_NUMBER;
+			op.value = token.value();
+			depth++;
+		}
+		else if (token.is_symbol() && !token.symbol()->is_function())
+		{
+			op.optype = CXP_PUSH_SYMBOL;
+			op.symbol = token.symbol();
+			depth++;
+		}
+		else if (token.is_memory())
+		{
+			op.optype = CXP_PUSH_MEMORY;
+			op.token = &token;
+			op.space = m_symtable.get().resolve_space(token.memory_source(), token.memory_space(), op.translate);
+			depth++;
+		}
+		else if (token.is_operator())
+		{
+			op.optype = token.optype();
+			switch (op.optype)
+			{
+				case TVL_COMPLEMENT:
+				case TVL_NOT:
+				case TVL_UPLUS:
+				case TVL_UMINUS:
+					if (depth < 1)
+						return;
+					break;
+
+				case TVL_MEMORYAT:
+					if (depth < 1)
+						return;
+					op.token = &token;
+					op.space = m_symtable.get().resolve_space(token.memory_source(), token.memory_space(), op.translate);
+					break;
+
+				case TVL_COMMA:
+					if (token.is_function_separator())
+						return;
+					// fall through
+				case TVL_MULTIPLY:
+				case TVL_DIVIDE:
+				case TVL_MODULO:
+				case TVL_ADD:
+				case TVL_SUBTRACT:
+				case TVL_LSHIFT:
+				case TVL_RSHIFT:
+				case TVL_LESS:
+				case TVL_LESSOREQUAL:
+				case TVL_GREATER:
+				case TVL_GREATEROREQUAL:
+				case TVL_EQUAL:
+				case TVL_NOTEQUAL:
+				case TVL_BAND:
+				case TVL_BXOR:
+				case TVL_BOR:
+				case TVL_LAND:
+				case TVL_LOR:
+					if (depth < 2)
+						return;
+					depth--;
+					break;
+
+				case TVL_ASSIGN:
+				case TVL_ASSIGNMULTIPLY:
+				case TVL_ASSIGNDIVIDE:
+				case TVL_ASSIGNMODULO:
+				case TVL_ASSIGNADD:
+				case TVL_ASSIGNSUBTRACT:
+				case TVL_ASSIGNLSHIFT:
+				case TVL_ASSIGNRSHIFT:
+				case TVL_ASSIGNBAND:
+				case TVL_ASSIGNBXOR:
+				case TVL_ASSIGNBOR:
+				{
+					if (depth < 2)
+						return;
+
+					// the store takes over the op that produced the left side; a
+					// memory operator's address stays on the stack for it
+					compiled_op const target = program[producer[depth - 2]];
+					if (target.optype == CXP_PUSH_SYMBOL && target.symbol->is_lval())
+						op.optype = CXP_STORE_SYMBOL;
+					else if (target.optype == CXP_PUSH_MEMORY)
+						op.optype = CXP_STORE_MEMORY;
+					else if (target.optype == TVL_MEMORYAT)
+						op.optype = CXP_STORE_MEMORYAT;
+					else
+						return;
+					op.value = token.optype();
+					op.symbol = target.symbol;
+					op.token = target.token;
+					op.space = target.space;
+					op.translate = target.translate;
+					program.erase(program.begin() + producer[depth - 2]);
+					producer[depth - 1]--;
+					depth--;
+					break;
+				}
+
+				// increments and function calls stay with the token interpreter
+				default:
+					return;
+			}
+		}
+		else
+		{
+			return;
+		}
+
+		if (depth > MAX_PROGRAM_STACK)
+			return;
+		producer[depth - 1] = program.size();
+		program.push_back(op);
+	}
+
+	// malformed expressions are left for the interpreter to report
+	if (depth == 1)
+		m_program = std::move(program);
+}
+
+
+//-------------------------------------------------
+//  execute_program - run a compiled expression
+//-------------------------------------------------
+
+u64 parsed_expression::execute_program()
+{
+	u64 stack[MAX_PROGRAM_STACK];
+	u64 *sp = stack;
+	bool modified = false;
+
+	try
+	{
+		for (const compiled_op &op : m_program)
+		{
+			switch (op.optype)
+			{
+				case CXP_PUSH_NUMBER:   *sp++ = op.value;                                   break;
+				case CXP_PUSH_SYMBOL:   *sp++ = op.symbol->value();                         break;
+				case CXP_PUSH_MEMORY:   *sp++ = read_compiled(op, op.token->address());     break;
+				case TVL_MEMORYAT:      sp[-1] = read_compiled(op, u32(sp[-1]));            break;
+
+				case CXP_STORE_SYMBOL:
+					if (op.value != TVL_ASSIGN)
+						sp[-1] = apply_assignment(op, op.symbol->value(), sp[-1]);
+					op.symbol->set_value(sp[-1]);
+					break;
+
+				case CXP_STORE_MEMORY:
+					if (op.value != TVL_ASSIGN)
+						sp[-1] = apply_assignment(op, read_compiled(op, op.token->address()), sp[-1]);
+					write_compiled(op, op.token->address(), sp[-1], modified);
+					break;
+
+				case CXP_STORE_MEMORYAT:
+					sp--;
+					if (op.value != TVL_ASSIGN)
+						sp[0] = apply_assignment(op, read_compiled(op, u32(sp[-1])), sp[0]);
+					write_compiled(op, u32(sp[-1]), sp[0], modified);
+					sp[-1] = sp[0];
+					break;
+
+				case TVL_COMPLEMENT:    sp[-1] = !sp[-1];                                   break;
+				case TVL_NOT:           sp[-1] = ~sp[-1];                                   break;
+				case TVL_UPLUS:                                                             break;
+				case TVL_UMINUS:        sp[-1] = -sp[-1];                                   break;
+
+				case TVL_DIVIDE:
+					sp--;
+					if (sp[0] == 0)
+						throw expression_error(expression_error::DIVIDE_BY_ZERO, op.offset);
+					sp[-1] /= sp[0];
+					break;
+
+				case TVL_MODULO:
+					sp--;
+					if (sp[0] == 0)
+						throw expression_error(expression_error::DIVIDE_BY_ZERO, op.offset);
+					sp[-1] %= sp[0];
+					break;
+
+				case TVL_MULTIPLY:      sp--; sp[-1] *= sp[0];                              break;
+				case TVL_ADD:           sp--; sp[-1] += sp[0];                              break;
+				case TVL_SUBTRACT:      sp--; sp[-1] -= sp[0];                              break;
+				case TVL_LSHIFT:        sp--; sp[-1] <<= sp[0];                             break;
+				case TVL_RSHIFT:        sp--; sp[-1] >>= sp[0];                             break;
+				case TVL_LESS:          sp--; sp[-1] = sp[-1] < sp[0];                      break;
+				case TVL_LESSOREQUAL:   sp--; sp[-1] = sp[-1] <= sp[0];                     break;
+				case TVL_GREATER:       sp--; sp[-1] = sp[-1] > sp[0];                      break;
+				case TVL_GREATEROREQUAL: sp--; sp[-1] = sp[-1] >= sp[0];                    break;
+				case TVL_EQUAL:         sp--; sp[-1] = sp[-1] == sp[0];                     break;
+				case TVL_NOTEQUAL:      sp--; sp[-1] = sp[-1] != sp[0];                     break;
+				case TVL_BAND:          sp--; sp[-1] &= sp[0];                              break;
+				case TVL_BXOR:          sp--; sp[-1] ^= sp[0];                              break;
+				case TVL_BOR:           sp--; sp[-1] |= sp[0];                              break;
+				case TVL_LAND:          sp--; sp[-1] = sp[-1] && sp[0];                     break;
+				case TVL_LOR:           sp--; sp[-1] = sp[-1] || sp[0];                     break;
+				case TVL_COMMA:         sp--; sp[-1] = sp[0];                               break;
+			}
+		}
+	}
+	catch (expression_error &)
+	{
+		if (modified)
+			m_symtable.get().notify_memory_modified();
+		throw;
+	}
+
+	// tell the debugger about memory writes once, not per store
+	if (modified)
+		m_symtable.get().notify_memory_modified();
+
+	return stack[0];
+}
+
+
+//-------------------------------------------------
+//  read_compiled - read memory for a compiled
+//  memory token or operator
+//-------------------------------------------------
+
+u64 parsed_expression::read_compiled(const compiled_op &op, u32 address)
+{
+	if (op.space == nullptr)
+	{
+		parse_token memory;
+		memory.configure_memory(address, *op.token);
+		return memory.get_lval_value(m_symtable);
+	}
+
+	symbol_table &table = m_symtable;
+	auto dis = table.machine().disable_side_effects(op.token->memory_side_effects());
+	return table.read_memory(*op.space, address, 1 << op.token->memory_size(), op.translate);
+}
+
+
+//-------------------------------------------------
+//  write_compiled - write memory for a compiled
+//  store, leaving the notification to the caller
+//-------------------------------------------------
+
+void parsed_expression::write_compiled(const compiled_op &op, u32 address, u64 data, bool &modified)
+{
+	if (op.space == nullptr)
+	{
+		parse_token memory;
+		memory.configure_memory(address, *op.token);
+		memory.set_lval_value(m_symtable, data);
+		return;
+	}
+
+	symbol_table &table = m_symtable;
+	auto dis = table.machine().disable_side_effects(op.token->memory_side_effects());
+	table.write_memory(*op.space, address, data, 1 << op.token->memory_size(), op.translate, false);
+	modified = true;
+}
+
+
+//-------------------------------------------------
+//  apply_assignment - combine the old value of a
+//  compiled store's target with the new value
+//-------------------------------------------------
+
+u64 parsed_expression::apply_assignment(const compiled_op &op, u64 oldvalue, u64 value)
+{
+	switch (op.value)
+	{
+		case TVL_ASSIGNMULTIPLY:    return oldvalue * value;
+		case TVL_ASSIGNADD:         return oldvalue + value;
+		case TVL_ASSIGNSUBTRACT:    return oldvalue - value;
+		case TVL_ASSIGNLSHIFT:      return oldvalue << value;
+		case TVL_ASSIGNRSHIFT:      return oldvalue >> value;
+		case TVL_ASSIGNBAND:        return oldvalue & value;
+		case TVL_ASSIGNBXOR:        return oldvalue ^ value;
+		case TVL_ASSIGNBOR:         return oldvalue | value;
+
+		case TVL_ASSIGNDIVIDE:
+			if (value == 0)
+				throw expression_error(expression_error::DIVIDE_BY_ZERO, op.offset);
+			return oldvalue / value;
+
+		case TVL_ASSIGNMODULO:
+			if (value == 0)
+				throw expression_error(expression_error::DIVIDE_BY_ZERO, op.offset);
+			return oldvalue % value;
+	}
+	return value;
+}
+
+
 
 //**************************************************************************
 //  PARSE TOKEN
@@ -19,6 +19,7 @@
 #include <functional>
 #include <list>
 #include <unordered_map>
+#include <vector>
 
 
 
@@ -174,6 +175,7 @@ public:
 	// getters
 	const std::unordered_map<std::string, std::unique_ptr<symbol_entry>> &entries() const { return m_symlist; }
 	symbol_table *parent() const { return m_parent; }
+	running_machine &machine() const { return m_machine; }
 
 	// setters
 	void set_memory_modified_func(memory_modified_func modified);
@@ -195,7 +197,9 @@ public:
 	u64 memory_value(const char *name, expression_space space, u32 offset, int size, bool disable_se);
 	void set_memory_value(const char *name, expression_space space, u32 offset, int size, u64 value, bool disable_se);
 	u64 read_memory(address_space &space, offs_t address, int size, bool apply_translation);
-	void write_memory(address_space &space, offs_t address, u64 data, int size, bool apply_translation);
+	void write_memory(address_space &space, offs_t address, u64 data, int size, bool apply_translation, bool notify = true);
+	address_space *resolve_space(const char *name, expression_space spacenum, bool &apply_translation);
+	void notify_memory_modified();
 
 private:
 	// memory helpers
@@ -204,7 +208,6 @@ private:
 	void write_program_direct(address_space &space, int opcode, offs_t address, int size, u64 data);
 	void write_memory_region(const char *rgntag, offs_t address, int size, u64 data);
 	device_t *expression_get_device(const char *tag);
-	void notify_memory_modified();
 
 	// internal state
 	running_machine &       m_machine;          // reference to the machine
@@ -237,12 +240,12 @@ public:
 	symbol_table &symbols() const { return m_symtable.get(); }
 
 	// setters
-	void set_symbols(symbol_table &symtable) { m_symtable = std::reference_wrapper<symbol_table>(symtable); }
+	void set_symbols(symbol_table &symtable) { m_symtable = std::reference_wrapper<symbol_table>(symtable); compile(); }
 	void set_default_base(int base) { assert(base == 8 || base == 10 || base == 16); m_default_base = base; }
 
 	// execution
 	void parse(const char *string);
-	u64 execute() { return execute_tokens(); }
+	u64 execute() { return m_program.empty() ? execute_tokens() : execute_program(); }
 
 private:
 	// a single token
@@ -306,6 +309,7 @@ private:
 		expression_space memory_space() const { assert(m_type == OPERATOR || m_type == MEMORY); return expression_space((m_flags & TIN_MEMORY_SPACE_MASK) >> TIN_MEMORY_SPACE_SHIFT); }
 		int memory_size() const { assert(m_type == OPERATOR || m_type == MEMORY); return (m_flags & TIN_MEMORY_SIZE_MASK) >> TIN_MEMORY_SIZE_SHIFT; }
 		bool memory_side_effects() const { assert(m_type == OPERATOR || m_type == MEMORY); return (m_flags & TIN_SIDE_EFFECT_MASK) >> TIN_SIDE_EFFECT_SHIFT; }
+		const char *memory_source() const { assert(m_type == OPERATOR || m_type == MEMORY); return m_string; }
 
 		// setters
 		parse_token &set_offset(int offset) { m_offset = offset; return *this; }
@@ -340,6 +344,18 @@ private:
 		symbol_entry *          m_symbol;           // symbol pointer
 	};
 
+	// one step of a compiled expression
+	struct compiled_op
+	{
+		u8                  optype;             // operator, or one of the push operations
+		int                 offset;             // offset within the string, for errors
+		u64                 value;              // constant to push, or assignment operator for stores
+		symbol_entry *      symbol;             // symbol to push the value of or assign to
+		parse_token *       token;              // memory token or memory operator
+		address_space *     space;              // space resolved at compile time, if possible
+		bool                translate;          // space is logical
+	};
+
 	// internal helpers
 	void copy(const parsed_expression &src);
 	void print_tokens(FILE *out);
@@ -362,8 +378,16 @@ private:
 	u64 execute_tokens();
 	void execute_function(parse_token &token);
 
+	// compiled execution
+	void compile();
+	u64 execute_program();
+	u64 read_compiled(const compiled_op &op, u32 address);
+	void write_compiled(const compiled_op &op, u32 address, u64 data, bool &modified);
+	static u64 apply_assignment(const compiled_op &op, u64 oldvalue, u64 value);
+
 	// constants
 	static const int MAX_FUNCTION_PARAMS = 16;
+	static const int MAX_PROGRAM_STACK = 32;
 
 	// internal state
 	std::reference_wrapper<symbol_table> m_symtable;    // symbol table
@@ -372,6 +396,7 @@ private:
 	std::list<parse_token> m_tokenlist;                 // token list
 	std::list<std::string> m_stringlist;                // string list
 	std::deque<parse_token> m_token_stack;              // token stack (used during execution)
+	std::vector<compiled_op> m_program;                 // flat program, unless the expression increments or calls functions
 };
 
 #endif // MAME_EMU_DEBUG_EXPRESS_H
@@ -83,7 +83,9 @@ debugger_manager::debugger_manager(running_machine &machine)
 
 debugger_manager::~debugger_manager()
 {
-	g_machine = nullptr;
+	// another machine in the process may have replaced us since
+	if (g_machine == &m_machine)
+		g_machine = nullptr;
 }
 
 /*-------------------------------------------------
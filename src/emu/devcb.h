@@ -258,6 +258,15 @@ protected:
 	template <typename Dummy> struct delegate_traits<read64smo_delegate, Dummy> { static constexpr u64 default_mask = ~u64(0); };
 	template <typename Dummy> struct delegate_traits<read_line_delegate, Dummy> { static constexpr unsigned default_mask = 1U; };
 
+	// Delegate called directly when it's the only callback and has no transforms
+	template <typename T, typename Dummy = void> struct direct_delegate;
+	template <typename Dummy> struct direct_delegate<u8, Dummy> { using type = read8smo_delegate; };
+	template <typename Dummy> struct direct_delegate<u16, Dummy> { using type = read16smo_delegate; };
+	template <typename Dummy> struct direct_delegate<u32, Dummy> { using type = read32smo_delegate; };
+	template <typename Dummy> struct direct_delegate<u64, Dummy> { using type = read64smo_delegate; };
+	template <typename Dummy> struct direct_delegate<int, Dummy> { using type = read_line_delegate; };
+	template <typename T> using direct_delegate_t = typename direct_delegate<T>::type;
+
 	using devcb_base::devcb_base;
 	~devcb_read_base();
 };
@@ -315,6 +324,15 @@ protected:
 	template <typename Dummy> struct delegate_traits<write64smo_delegate, Dummy> { using input_t = u64; static constexpr u64 default_mask = ~u64(0); };
 	template <typename Dummy> struct delegate_traits<write_line_delegate, Dummy> { using input_t = int; static constexpr unsigned default_mask = 1U; };
 
+	// Delegate called directly when it's the only callback and has no transforms
+	template <typename T, typename Dummy = void> struct direct_delegate;
+	template <typename Dummy> struct direct_delegate<u8, Dummy> { using type = write8smo_delegate; };
+	template <typename Dummy> struct direct_delegate<u16, Dummy> { using type = write16smo_delegate; };
+	template <typename Dummy> struct direct_delegate<u32, Dummy> { using type = write32smo_delegate; };
+	template <typename Dummy> struct direct_delegate<u64, Dummy> { using type = write64smo_delegate; };
+	template <typename Dummy> struct direct_delegate<int, Dummy> { using type = write_line_delegate; };
+	template <typename T> using direct_delegate_t = typename direct_delegate<T>::type;
+
 	using devcb_base::devcb_base;
 	~devcb_write_base();
 };
@@ -339,6 +357,7 @@ private:
 		virtual ~creator() { }
 		virtual void validity_check(validity_checker &valid) const = 0;
 		virtual func_t create() = 0;
+		virtual bool create_direct(direct_delegate_t<Result> &cb, std::make_unsigned_t<Result> &exor, std::make_unsigned_t<Result> &mask) { return false; }
 
 		std::make_unsigned_t<Result> mask() const { return m_mask; }
 
@@ -363,6 +382,11 @@ private:
 			return result;
 		}
 
+		virtual bool create_direct(direct_delegate_t<Result> &cb, std::make_unsigned_t<Result> &exor, std::make_unsigned_t<Result> &mask) override
+		{
+			return m_builder.build_direct(cb, exor, mask);
+		}
+
 	private:
 		T m_builder;
 	};
@@ -403,6 +427,12 @@ private:
 		builder_base &operator=(builder_base const &) = delete;
 		builder_base &operator=(builder_base &&) = default;
 
+	public:
+		// only plain delegates can be called directly; everything else goes through build
+		bool build_direct(direct_delegate_t<Result> &cb, std::make_unsigned_t<Result> &exor, std::make_unsigned_t<Result> &mask) { return false; }
+
+	protected:
+
 #ifdef MAME_DEVCB_GNUC_BROKEN_FRIEND
 	public:
 #endif
@@ -614,7 +644,27 @@ private:
 					{ return (devcb_read::invoke_read<Result>(cb, offset, mem_mask & mask) ^ exor) & mask; });
 		}
 
+		bool build_direct(direct_delegate_t<Result> &cb, input_mask_t &exor, input_mask_t &mask)
+		{
+			return build_direct_impl(cb, exor, mask);
+		}
+
 	private:
+		// templates so explicit instantiation of the builder doesn't compile the assignment for other delegate types
+		template <typename T>
+		std::enable_if_t<!std::is_same<T, Delegate>::value, bool> build_direct_impl(T &cb, input_mask_t &exor, input_mask_t &mask) { return false; }
+		template <typename T>
+		std::enable_if_t<std::is_same<T, Delegate>::value, bool> build_direct_impl(T &cb, input_mask_t &exor, input_mask_t &mask)
+		{
+			assert(this->m_consumed);
+			this->built();
+			m_delegate.resolve();
+			cb = m_delegate;
+			exor = this->exor();
+			mask = this->mask();
+			return true;
+		}
+
 		delegate_builder(delegate_builder const &) = delete;
 		delegate_builder &operator=(delegate_builder const &) = delete;
 		delegate_builder &operator=(delegate_builder &&that) = delete;
@@ -818,6 +868,12 @@ private:
 	std::vector<func_t> m_functions;
 	std::vector<typename creator::ptr> m_creators;
 
+	// a lone plain delegate is called directly with its exclusive-or and mask fused in
+	direct_delegate_t<Result> m_direct;
+	std::make_unsigned_t<Result> m_direct_exor;
+	std::make_unsigned_t<Result> m_direct_mask;
+	bool m_direct_valid;
+
 public:
 	template <unsigned Count>
 	class array : public devcb_read_base::array<devcb_read<Result, DefaultMask>, Count>
@@ -845,13 +901,17 @@ public:
 	Result operator()(offs_t offset, std::make_unsigned_t<Result> mem_mask = DefaultMask);
 	Result operator()();
 
-	bool isnull() const { return m_functions.empty() && m_creators.empty(); }
-	explicit operator bool() const { return !m_functions.empty(); }
+	bool isnull() const { return m_functions.empty() && m_creators.empty() && !m_direct_valid; }
+	explicit operator bool() const { return !m_functions.empty() || m_direct_valid; }
 };
 
 template <typename Result, std::make_unsigned_t<Result> DefaultMask>
 devcb_read<Result, DefaultMask>::devcb_read(device_t &owner)
 	: devcb_read_base(owner)
+	, m_direct(owner)
+	, m_direct_exor(0U)
+	, m_direct_mask(DefaultMask)
+	, m_direct_valid(false)
 {
 }
 
@@ -864,7 +924,7 @@ typename devcb_read<Result, DefaultMask>::binder devcb_read<Result, DefaultMask>
 template <typename Result, std::make_unsigned_t<Result> DefaultMask>
 void devcb_read<Result, DefaultMask>::reset()
 {
-	assert(m_functions.empty());
+	assert(m_functions.empty() && !m_direct_valid);
 	m_creators.clear();
 }
 
@@ -888,7 +948,13 @@ void devcb_read<Result, DefaultMask>::validity_check(validity_checker &valid) co
 template <typename Result, std::make_unsigned_t<Result> DefaultMask>
 void devcb_read<Result, DefaultMask>::resolve()
 {
-	assert(m_functions.empty());
+	assert(m_functions.empty() && !m_direct_valid);
+	if ((m_creators.size() == 1) && m_creators.front()->create_direct(m_direct, m_direct_exor, m_direct_mask))
+	{
+		m_direct_valid = true;
+		m_creators.clear();
+		return;
+	}
 	m_functions.reserve(m_creators.size());
 	for (typename creator::ptr const &c : m_creators)
 		m_functions.emplace_back(c->create());
@@ -899,14 +965,16 @@ template <typename Result, std::make_unsigned_t<Result> DefaultMask>
 void devcb_read<Result, DefaultMask>::resolve_safe(Result dflt)
 {
 	resolve();
-	if (m_functions.empty())
+	if (m_functions.empty() && !m_direct_valid)
 		m_functions.emplace_back([dflt] (offs_t offset, std::make_unsigned_t<Result> mem_mask) { return dflt; });
 }
 
 template <typename Result, std::make_unsigned_t<Result> DefaultMask>
 Result devcb_read<Result, DefaultMask>::operator()(offs_t offset, std::make_unsigned_t<Result> mem_mask)
 {
-	assert(m_creators.empty() && !m_functions.empty());
+	assert(m_creators.empty() && (m_direct_valid || !m_functions.empty()));
+	if (m_direct_valid)
+		return (invoke_read<Result>(m_direct, offset, mem_mask & m_direct_mask) ^ m_direct_exor) & m_direct_mask;
 	typename std::vector<func_t>::const_iterator it(m_functions.begin());
 	std::make_unsigned_t<Result> result((*it)(offset, mem_mask));
 	while (m_functions.end() != ++it)
@@ -940,6 +1008,7 @@ private:
 		virtual ~creator() { }
 		virtual void validity_check(validity_checker &valid) const = 0;
 		virtual func_t create() = 0;
+		virtual bool create_direct(direct_delegate_t<Input> &cb, std::make_unsigned_t<Input> &exor, std::make_unsigned_t<Input> &mask) { return false; }
 	};
 
 	template <typename T>
@@ -955,6 +1024,11 @@ private:
 			return [cb = m_builder.build()] (offs_t offset, Input data, std::make_unsigned_t<Input> mem_mask) { cb(offset, data, mem_mask); };
 		}
 
+		virtual bool create_direct(direct_delegate_t<Input> &cb, std::make_unsigned_t<Input> &exor, std::make_unsigned_t<Input> &mask) override
+		{
+			return m_builder.build_direct(cb, exor, mask);
+		}
+
 	private:
 		T m_builder;
 	};
@@ -984,6 +1058,12 @@ private:
 		builder_base &operator=(builder_base const &) = delete;
 		builder_base &operator=(builder_base &&) = default;
 
+	public:
+		// only plain delegates can be called directly; everything else goes through build
+		bool build_direct(direct_delegate_t<Input> &cb, std::make_unsigned_t<Input> &exor, std::make_unsigned_t<Input> &mask) { return false; }
+
+	protected:
+
 #ifdef MAME_DEVCB_GNUC_BROKEN_FRIEND
 	public:
 #endif
@@ -1355,6 +1435,27 @@ private:
 					[cb = std::move(this->m_delegate), exor = this->exor(), mask = this->mask()] (offs_t offset, input_t data, std::make_unsigned_t<input_t> mem_mask)
 					{ devcb_write::invoke_write<Input>(cb, offset, (data ^ exor) & mask, mem_mask & mask); };
 		}
+
+		bool build_direct(direct_delegate_t<Input> &cb, std::make_unsigned_t<Input> &exor, std::make_unsigned_t<Input> &mask)
+		{
+			return build_direct_impl(cb, exor, mask);
+		}
+
+	private:
+		// templates so explicit instantiation of the builder doesn't compile the assignment for other delegate types
+		template <typename T>
+		std::enable_if_t<!std::is_same<T, Delegate>::value, bool> build_direct_impl(T &cb, std::make_unsigned_t<Input> &exor, std::make_unsigned_t<Input> &mask) { return false; }
+		template <typename T>
+		std::enable_if_t<std::is_same<T, Delegate>::value, bool> build_direct_impl(T &cb, std::make_unsigned_t<Input> &exor, std::make_unsigned_t<Input> &mask)
+		{
+			assert(this->m_consumed);
+			this->built();
+			m_delegate.resolve();
+			cb = m_delegate;
+			exor = this->exor();
+			mask = this->mask();
+			return true;
+		}
 	};
 
 	class inputline_builder : public builder_base, public transform_base<mask_t<Input, int>, inputline_builder>
@@ -2287,6 +2388,12 @@ private:
 	std::vector<func_t> m_functions;
 	std::vector<typename creator::ptr> m_creators;
 
+	// a lone plain delegate is called directly with its exclusive-or and mask fused in
+	direct_delegate_t<Input> m_direct;
+	std::make_unsigned_t<Input> m_direct_exor;
+	std::make_unsigned_t<Input> m_direct_mask;
+	bool m_direct_valid;
+
 public:
 	template <unsigned Count>
 	class array : public devcb_write_base::array<devcb_write<Input, DefaultMask>, Count>
@@ -2314,13 +2421,17 @@ public:
 	void operator()(offs_t offset, Input data, std::make_unsigned_t<Input> mem_mask = DefaultMask);
 	void operator()(Input data);
 
-	bool isnull() const { return m_functions.empty() && m_creators.empty(); }
-	explicit operator bool() const { return !m_functions.empty(); }
+	bool isnull() const { return m_functions.empty() && m_creators.empty() && !m_direct_valid; }
+	explicit operator bool() const { return !m_functions.empty() || m_direct_valid; }
 };
 
 template <typename Input, std::make_unsigned_t<Input> DefaultMask>
 devcb_write<Input, DefaultMask>::devcb_write(device_t &owner)
 	: devcb_write_base(owner)
+	, m_direct(owner)
+	, m_direct_exor(0U)
+	, m_direct_mask(DefaultMask)
+	, m_direct_valid(false)
 {
 }
 
@@ -2333,7 +2444,7 @@ typename devcb_write<Input, DefaultMask>::binder devcb_write<Input, DefaultMask>
 template <typename Input, std::make_unsigned_t<Input> DefaultMask>
 void devcb_write<Input, DefaultMask>::reset()
 {
-	assert(m_functions.empty());
+	assert(m_functions.empty() && !m_direct_valid);
 	m_creators.clear();
 }
 
@@ -2348,7 +2459,13 @@ void devcb_write<Input, DefaultMask>::validity_check(validity_checker &valid) co
 template <typename Input, std::make_unsigned_t<Input> DefaultMask>
 void devcb_write<Input, DefaultMask>::resolve()
 {
-	assert(m_functions.empty());
+	assert(m_functions.empty() && !m_direct_valid);
+	if ((m_creators.size() == 1) && m_creators.front()->create_direct(m_direct, m_direct_exor, m_direct_mask))
+	{
+		m_direct_valid = true;
+		m_creators.clear();
+		return;
+	}
 	m_functions.reserve(m_creators.size());
 	for (typename creator::ptr const &c : m_creators)
 		m_functions.emplace_back(c->create());
@@ -2359,14 +2476,19 @@ template <typename Input, std::make_unsigned_t<Input> DefaultMask>
 void devcb_write<Input, DefaultMask>::resolve_safe()
 {
 	resolve();
-	if (m_functions.empty())
+	if (m_functions.empty() && !m_direct_valid)
 		m_functions.emplace_back([] (offs_t offset, Input data, std::make_unsigned_t<Input> mem_mask) { });
 }
 
 template <typename Input, std::make_unsigned_t<Input> DefaultMask>
 void devcb_write<Input, DefaultMask>::operator()(offs_t offset, Input data, std::make_unsigned_t<Input> mem_mask)
 {
-	assert(m_creators.empty() && !m_functions.empty());
+	assert(m_creators.empty() && (m_direct_valid || !m_functions.empty()));
+	if (m_direct_valid)
+	{
+		invoke_write<Input>(m_direct, offset, (data ^ m_direct_exor) & m_direct_mask, mem_mask & m_direct_mask);
+		return;
+	}
 	typename std::vector<func_t>::const_iterator it(m_functions.begin());
 	(*it)(offset, data, mem_mask);
 	while (m_functions.end() != ++it)
@@ -49,3 +49,14 @@ bool cpu_device::allow_drc() const
 {
 	return mconfig().options().drc() && !m_force_no_drc;
 }
+
+
+//-------------------------------------------------
+//  allow_idle_skip - return true if recompilers
+//  may cut idle loops short
+//-------------------------------------------------
+
+bool cpu_device::allow_idle_skip() const
+{
+	return mconfig().options().drc_idle_skip();
+}
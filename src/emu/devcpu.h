@@ -35,6 +35,7 @@ public:
 	// configuration helpers
 	void set_force_no_drc(bool value) { m_force_no_drc = value; }
 	bool allow_drc() const;
+	bool allow_idle_skip() const;
 
 protected:
 	// construction/destruction
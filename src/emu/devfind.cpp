@@ -104,19 +104,27 @@ bool finder_base::validate_memregion(size_t bytes, bool required) const
 	size_t bytes_found = 0;
 	std::string const region_fulltag(m_base.get().subtag(m_tag));
 
-	// look for the region
-	for (device_t const &dev : device_iterator(m_base.get().mconfig().root_device()))
+	// look for the region, in the index if configuration is complete
+	u32 indexed_length;
+	if (m_base.get().mconfig().lookup_region(region_fulltag, indexed_length))
 	{
-		for (romload::region const &region : romload::entries(dev.rom_region()).get_regions())
+		bytes_found = indexed_length;
+	}
+	else
+	{
+		for (device_t const &dev : device_iterator(m_base.get().mconfig().root_device()))
 		{
-			if (dev.subtag(region.get_tag()) == region_fulltag)
+			for (romload::region const &region : romload::entries(dev.rom_region()).get_regions())
 			{
-				bytes_found = region.get_length();
-				break;
+				if (dev.subtag(region.get_tag()) == region_fulltag)
+				{
+					bytes_found = region.get_length();
+					break;
+				}
 			}
+			if (bytes_found != 0)
+				break;
 		}
-		if (bytes_found != 0)
-			break;
 	}
 
 	// check the length and warn if other than specified
@@ -11,6 +11,7 @@
 #include "emu.h"
 #include "romload.h"
 #include "speaker.h"
+#include "startuptiming.h"
 #include "debug/debugcpu.h"
 
 #include <cstring>
@@ -343,7 +344,10 @@ void device_t::reset()
 		intf.interface_pre_reset();
 
 	// reset the device
-	device_reset();
+	{
+		startup_timing_log::scope timing(machine().startup_timing(), "device_reset", name(), tag());
+		device_reset();
+	}
 
 	// reset all child devices
 	for (device_t &child : subdevices())
@@ -873,14 +877,19 @@ device_t *device_t::subdevice_slow(const char *tag) const
 	assert(fulltag[0] == ':');
 	assert(fulltag.find("::") == std::string::npos);
 
+	// use the machine-wide index once configuration is complete, otherwise
 	// walk the device list to the final path
-	device_t *curdevice = &mconfig().root_device();
-	if (fulltag.length() > 1)
-		for (int start = 1, end = fulltag.find_first_of(':', start); start != 0 && curdevice != nullptr; start = end + 1, end = fulltag.find_first_of(':', start))
-		{
-			std::string part(fulltag, start, (end == -1) ? -1 : end - start);
-			curdevice = curdevice->subdevices().find(part);
-		}
+	device_t *curdevice = nullptr;
+	if (!mconfig().lookup_device(fulltag, curdevice))
+	{
+		curdevice = &mconfig().root_device();
+		if (fulltag.length() > 1)
+			for (int start = 1, end = fulltag.find_first_of(':', start); start != 0 && curdevice != nullptr; start = end + 1, end = fulltag.find_first_of(':', start))
+			{
+				std::string part(fulltag, start, (end == -1) ? -1 : end - start);
+				curdevice = curdevice->subdevices().find(part);
+			}
+	}
 
 	// if we got a match, add to the fast map
 	if (curdevice != nullptr)
@@ -46,11 +46,13 @@ device_execute_interface::device_execute_interface(const machine_config &mconfig
 	: device_interface(device, "execute")
 	, m_scheduler(nullptr)
 	, m_disabled(false)
+	, m_sync_domain(0)
 	, m_vblank_interrupt(device)
 	, m_vblank_interrupt_screen(nullptr)
 	, m_timed_interrupt(device)
 	, m_timed_interrupt_period(attotime::zero)
 	, m_nextexec(nullptr)
+	, m_nextdomainexec(nullptr)
 	, m_driver_irq(device)
 	, m_timedint_timer(nullptr)
 	, m_profiler(PROFILER_IDLE)
@@ -70,6 +72,7 @@ device_execute_interface::device_execute_interface(const machine_config &mconfig
 	, m_attoseconds_per_cycle(0)
 {
 	memset(&m_localtime, 0, sizeof(m_localtime));
+	memset(&m_stats, 0, sizeof(m_stats));
 
 	// configure the fast accessor
 	assert(!device.interfaces().m_execute);
@@ -97,6 +97,18 @@ class device_execute_interface : public device_interface
 	friend class testcpu_state;
 
 public:
+	// scheduler statistics, only collected while enabled in the scheduler
+	struct execute_stats
+	{
+		u64             timeslices;         // number of timeslices executed
+		u64             cycles_requested;   // cycles requested across all timeslices
+		u64             cycles_executed;    // cycles actually executed
+		u64             cycles_stolen;      // cycles given back by abort_timeslice()
+		u64             aborts;             // timeslices cut short by abort_timeslice()
+		u64             boosts;             // boost_interleave() calls made while executing
+		osd_ticks_t     run_ticks;          // host time spent in execute_run()
+	};
+
 	// construction/destruction
 	device_execute_interface(const machine_config &mconfig, device_t &device);
 	virtual ~device_execute_interface();
@@ -116,6 +128,12 @@ public:
 	// inline configuration helpers
 	void set_disable() { m_disabled = true; }
 
+	// devices in different sync domains may execute their timeslices
+	// concurrently; they must only communicate through timers (e.g.
+	// synchronize()) or other scheduler-mediated sync points
+	void set_sync_domain(u32 domain) { m_sync_domain = domain; }
+	u32 sync_domain() const { return m_sync_domain; }
+
 	template <typename... T> void set_vblank_int(const char *tag, T &&... args)
 	{
 		m_vblank_interrupt.set(std::forward<T>(args)...);
@@ -185,6 +203,7 @@ public:
 	// time and cycle accounting
 	attotime local_time() const noexcept;
 	u64 total_cycles() const noexcept;
+	const execute_stats &stats() const noexcept { return m_stats; }
 
 	// required operation overrides
 	void run() { execute_run(); }
@@ -289,6 +308,7 @@ private:
 
 	// configuration
 	bool                    m_disabled;                 // disabled from executing?
+	u32                     m_sync_domain;              // sync domain for parallel execution
 	device_interrupt_delegate m_vblank_interrupt;       // for interrupts tied to VBLANK
 	const char *            m_vblank_interrupt_screen;  // the screen that causes the VBLANK interrupt
 	device_interrupt_delegate m_timed_interrupt;        // for interrupts not tied to VBLANK
@@ -296,6 +316,7 @@ private:
 
 	// execution lists
 	device_execute_interface *m_nextexec;               // pointer to the next device to execute, in order
+	device_execute_interface *m_nextdomainexec;         // pointer to the next device to execute in our sync domain
 
 	// input states and IRQ callbacks
 	device_irq_acknowledge_delegate m_driver_irq;       // driver-specific IRQ callback
@@ -324,6 +345,9 @@ private:
 	u32                     m_cycles_per_second;        // cycles per second, adjusted for multipliers
 	attoseconds_t           m_attoseconds_per_cycle;    // attoseconds per adjusted clock cycle
 
+	// statistics
+	execute_stats           m_stats;                    // scheduler statistics
+
 	// callbacks
 	TIMER_CALLBACK_MEMBER(timed_trigger_callback) { trigger(param); }
 
@@ -32,7 +32,8 @@ device_gfx_interface::device_gfx_interface(
 	m_palette(*this, palette_tag),
 	m_gfxdecodeinfo(gfxinfo),
 	m_palette_is_disabled(false),
-	m_decoded(false)
+	m_decoded(false),
+	m_predecoded(false)
 {
 }
 
@@ -95,6 +96,27 @@ void device_gfx_interface::interface_post_start()
 {
 	if (!m_decoded)
 		decode_gfx(m_gfxdecodeinfo);
+
+	// decode everything once the machine has started and reset, so ROMs patched at start are seen
+	device().machine().add_notifier(MACHINE_NOTIFY_RESET, machine_notify_delegate(&device_gfx_interface::predecode_gfx, this));
+}
+
+
+//-------------------------------------------------
+//  predecode_gfx - decode every element of every
+//  set up front, rather than in the frame that
+//  first draws it
+//-------------------------------------------------
+
+void device_gfx_interface::predecode_gfx()
+{
+	if (m_predecoded)
+		return;
+	m_predecoded = true;
+
+	for (auto &gfx : m_gfx)
+		if (gfx)
+			gfx->decode_all();
 }
 
 
@@ -264,6 +286,8 @@ void device_gfx_interface::decode_gfx(const gfx_decode_entry *gfxdecodeinfo)
 
 		// allocate the graphics
 		m_gfx[curgfx] = std::make_unique<gfx_element>(m_palette, glcopy, (region_base != nullptr) ? region_base + gfx.start : nullptr, xormask, gfx.total_color_codes, gfx.color_codes_start);
+		if (GFXENTRY_ISPACKED(gfx.flags))
+			m_gfx[curgfx]->set_packed(true);
 	}
 
 	m_decoded = true;
@@ -350,6 +374,8 @@ void device_gfx_interface::interface_validity_check(validity_checker &valid) con
 				osd_printf_error("gfx[%d] RAW layouts can only be RGN_FRAC(1,1)\n", gfxnum);
 			if (xscale != 1 || yscale != 1)
 				osd_printf_error("gfx[%d] RAW layouts do not support xscale/yscale\n", gfxnum);
+			if (GFXENTRY_ISPACKED(gfx.flags))
+				osd_printf_error("gfx[%d] RAW layouts cannot be packed\n", gfxnum);
 		}
 
 		// verify traditional decode doesn't have too many planes,
@@ -358,6 +384,8 @@ void device_gfx_interface::interface_validity_check(validity_checker &valid) con
 		{
 			if (layout.planes > MAX_GFX_PLANES)
 				osd_printf_error("gfx[%d] planes > %d\n", gfxnum, MAX_GFX_PLANES);
+			if (GFXENTRY_ISPACKED(gfx.flags) && layout.planes > 4)
+				osd_printf_error("gfx[%d] packed layouts can have at most 4 planes\n", gfxnum);
 			if (layout.width > MAX_GFX_SIZE && layout.extxoffs == nullptr)
 				osd_printf_error("gfx[%d] width > %d but missing extended xoffset info\n", gfxnum, MAX_GFX_SIZE);
 			if (layout.height > MAX_GFX_SIZE && layout.extyoffs == nullptr)
@@ -100,6 +100,10 @@ const gfx_layout name = { width, height, RGN_FRAC(1,1), 8, { GFX_RAW }, { 0 }, {
 #define GFXENTRY_REVERSE      0x00040000
 #define GFXENTRY_ISREVERSE(x) (((x) & GFXENTRY_REVERSE) != 0)
 
+// GFXENTRY_PACKED stores decoded pixels two to a byte (16 colours or fewer only)
+#define GFXENTRY_PACKED       0x00080000
+#define GFXENTRY_ISPACKED(x)  (((x) & GFXENTRY_PACKED) != 0)
+
 
 // these macros are used for declaring gfx_decode_entry info arrays
 #define GFXDECODE_START( name ) const gfx_decode_entry name[] = {
@@ -118,6 +122,7 @@ const gfx_layout name = { width, height, RGN_FRAC(1,1), 8, { GFX_RAW }, { 0 }, {
 #define GFXDECODE_DEVICE_RAM(region,offset,layout,start,colors) { region, offset, &layout, start, colors, GFXENTRY_DEVICE | GFXENTRY_RAM },
 #define GFXDECODE_SCALE(region,offset,layout,start,colors,x,y) { region, offset, &layout, start, colors, GFXENTRY_XSCALE(x) | GFXENTRY_YSCALE(y) },
 #define GFXDECODE_REVERSEBITS(region,offset,layout,start,colors) { region, offset, &layout, start, colors, GFXENTRY_REVERSE },
+#define GFXDECODE_PACKED(region,offset,layout,start,colors) { region, offset, &layout, start, colors, GFXENTRY_PACKED },
 
 
 
@@ -194,8 +199,12 @@ private:
 	const gfx_decode_entry *    m_gfxdecodeinfo;        // pointer to array of gfx decode information
 	bool                        m_palette_is_disabled;  // no palette associated with this gfx decode
 
+	// internal helpers
+	void predecode_gfx();
+
 	// internal state
 	bool                        m_decoded;                  // have we processed our decode info yet?
+	bool                        m_predecoded;               // have we decoded every element up front yet?
 };
 
 // iterator
@@ -19,10 +19,101 @@
 #include "softlist_dev.h"
 #include "formats/ioprocs.h"
 
+#include <chrono>
 #include <cstring>
+#include <map>
+#include <mutex>
 #include <regex>
 
 
+namespace {
+
+//**************************************************************************
+//  IMAGE HASH CACHE
+//**************************************************************************
+
+// hashes of image files already read, so a file isn't read end to end again
+// when it's looked up for slot defaults and then mounted, or mounted again;
+// an entry only counts while the file's size and modification time match
+struct hash_cache_entry
+{
+	u64 size;
+	std::chrono::system_clock::time_point modified;
+	util::hash_collection hashes;
+};
+
+typedef std::pair<std::string, u32> hash_cache_key;
+
+std::mutex s_hash_cache_lock;
+std::map<hash_cache_key, hash_cache_entry> s_hash_cache;
+
+
+//-------------------------------------------------
+//  stat_for_hash_cache - key a plain file by its
+//  full path and unhashed header length
+//-------------------------------------------------
+
+bool stat_for_hash_cache(const std::string &path, u32 skip_bytes, hash_cache_key &key, u64 &size, std::chrono::system_clock::time_point &modified)
+{
+	std::string fullpath;
+	if (path.empty() || (osd_get_full_path(fullpath, path) != osd_file::error::NONE))
+		return false;
+
+	std::unique_ptr<osd::directory::entry> const entry = osd_stat(fullpath);
+	if (!entry || (entry->type != osd::directory::entry::entry_type::FILE))
+		return false;
+
+	key = hash_cache_key(std::move(fullpath), skip_bytes);
+	size = entry->size;
+	modified = entry->last_modified;
+	return true;
+}
+
+
+//-------------------------------------------------
+//  find_cached_hash - look up the hashes of a
+//  file that hasn't changed since it was hashed
+//-------------------------------------------------
+
+bool find_cached_hash(const std::string &path, u32 skip_bytes, util::hash_collection &hashes)
+{
+	hash_cache_key key;
+	u64 size;
+	std::chrono::system_clock::time_point modified;
+	if (!stat_for_hash_cache(path, skip_bytes, key, size, modified))
+		return false;
+
+	std::lock_guard<std::mutex> lock(s_hash_cache_lock);
+	auto const found = s_hash_cache.find(key);
+	if ((s_hash_cache.end() == found) || (found->second.size != size) || (found->second.modified != modified))
+		return false;
+	hashes = found->second.hashes;
+	return true;
+}
+
+
+//-------------------------------------------------
+//  cache_hash - remember the hashes of a file
+//-------------------------------------------------
+
+void cache_hash(const std::string &path, u32 skip_bytes, const util::hash_collection &hashes)
+{
+	hash_cache_key key;
+	u64 size;
+	std::chrono::system_clock::time_point modified;
+	if (!stat_for_hash_cache(path, skip_bytes, key, size, modified))
+		return;
+
+	std::lock_guard<std::mutex> lock(s_hash_cache_lock);
+	hash_cache_entry &entry = s_hash_cache[key];
+	entry.size = size;
+	entry.modified = modified;
+	entry.hashes = hashes;
+}
+
+} // anonymous namespace
+
+
 //**************************************************************************
 //  DEVICE CONFIG IMAGE INTERFACE
 //**************************************************************************
@@ -84,6 +175,18 @@ image_device_format::~image_device_format()
 //  DEVICE IMAGE INTERFACE
 //**************************************************************************
 
+// a full hash of an image file, read through its own handle so the
+// device can carry on using the mounted one
+struct device_image_interface::hash_job
+{
+	std::string path;
+	u32 skip_bytes;
+	util::hash_collection hashes;
+	bool complete;
+	osd_work_item *item;
+};
+
+
 //-------------------------------------------------
 //  device_image_interface - constructor
 //-------------------------------------------------
@@ -99,6 +202,7 @@ device_image_interface::device_image_interface(const machine_config &mconfig, de
 	, m_created(false)
 	, m_create_format(0)
 	, m_create_args(nullptr)
+	, m_hash_queue(nullptr)
 	, m_user_loadable(true)
 	, m_is_loading(false)
 	, m_is_reset_and_loading(false)
@@ -112,6 +216,9 @@ device_image_interface::device_image_interface(const machine_config &mconfig, de
 
 device_image_interface::~device_image_interface()
 {
+	wait_for_hash();
+	if (m_hash_queue)
+		osd_work_queue_free(m_hash_queue);
 }
 
 
@@ -543,7 +650,7 @@ bool device_image_interface::image_checkhash()
 {
 	// only calculate CRC if it hasn't been calculated, and the open_mode is read only
 	u32 crcval;
-	if (!m_hash.crc(crcval) && is_readonly() && !m_created)
+	if (!m_hash.crc(crcval) && !m_hash_job && is_readonly() && !m_created)
 	{
 		// do not cause a linear read of 600 megs please
 		// TODO: use SHA1 in the CHD header as the hash
@@ -554,20 +661,101 @@ bool device_image_interface::image_checkhash()
 		if (loaded_through_softlist())
 			return true;
 
+		// reuse the hash from the last time this file was read
+		if (find_cached_hash(m_image_name, unhashed_header_length(), m_hash))
+			return true;
+
+		// plain files are hashed in the background until someone asks for it
+		if (start_hash())
+			return true;
+
 		// run the hash
 		if (!run_hash(*m_file, unhashed_header_length(), m_hash, util::hash_collection::HASH_TYPES_ALL))
 			return false;
+		cache_hash(m_image_name, unhashed_header_length(), m_hash);
 	}
 	return true;
 }
 
 
-util::hash_collection device_image_interface::calculate_hash_on_file(util::core_file &file) const
+//-------------------------------------------------
+//  start_hash - queue a full hash of the image if
+//  it's a plain file that can be opened again
+//-------------------------------------------------
+
+bool device_image_interface::start_hash()
+{
+	std::unique_ptr<osd::directory::entry> const entry = osd_stat(m_image_name);
+	if (!entry || (entry->type != osd::directory::entry::entry_type::FILE))
+		return false;
+
+	if (!m_hash_queue)
+		m_hash_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+	if (!m_hash_queue)
+		return false;
+
+	auto job = std::make_unique<hash_job>();
+	job->path = m_image_name;
+	job->skip_bytes = unhashed_header_length();
+	job->complete = false;
+	job->item = osd_work_item_queue(m_hash_queue, hash_job_static, job.get(), 0);
+	if (!job->item)
+		return false;
+
+	m_hash_job = std::move(job);
+	return true;
+}
+
+
+//-------------------------------------------------
+//  hash_job_static - hash an image file on a
+//  worker thread
+//-------------------------------------------------
+
+void *device_image_interface::hash_job_static(void *param, int threadid)
+{
+	hash_job &job(*reinterpret_cast<hash_job *>(param));
+	util::core_file::ptr file;
+	if (util::core_file::open(job.path, OPEN_FLAG_READ, file) == osd_file::error::NONE)
+		job.complete = run_hash(*file, job.skip_bytes, job.hashes, util::hash_collection::HASH_TYPES_ALL);
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  wait_for_hash - collect the result of a
+//  background hash
+//-------------------------------------------------
+
+void device_image_interface::wait_for_hash()
+{
+	if (!m_hash_job)
+		return;
+
+	while (!osd_work_item_wait(m_hash_job->item, osd_ticks_per_second()))
+	{
+	}
+	osd_work_item_release(m_hash_job->item);
+
+	if (m_hash_job->complete)
+	{
+		m_hash = std::move(m_hash_job->hashes);
+		cache_hash(m_hash_job->path, m_hash_job->skip_bytes, m_hash);
+	}
+	m_hash_job.reset();
+}
+
+
+util::hash_collection device_image_interface::calculate_hash_on_file(util::core_file &file, const std::string &path) const
 {
-	// calculate the hash
+	// calculate the hash, unless the file has been hashed already
 	util::hash_collection hash;
+	if (find_cached_hash(path, unhashed_header_length(), hash))
+		return hash;
 	if (!run_hash(file, unhashed_header_length(), hash, util::hash_collection::HASH_TYPES_ALL))
 		hash.reset();
+	else
+		cache_hash(path, unhashed_header_length(), hash);
 	return hash;
 }
 
@@ -577,6 +765,7 @@ u32 device_image_interface::crc()
 	u32 crc = 0;
 
 	image_checkhash();
+	wait_for_hash();
 	m_hash.crc(crc);
 
 	return crc;
@@ -1196,6 +1385,9 @@ void device_image_interface::reset_and_load(const std::string &path)
 
 void device_image_interface::clear()
 {
+	wait_for_hash();
+	m_hash.reset();
+
 	m_mame_file.reset();
 	m_file.reset();
 
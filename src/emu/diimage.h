@@ -194,8 +194,8 @@ public:
 	bool load_software_region(const char *tag, optional_shared_ptr<u8> &ptr);
 
 	u32 crc();
-	util::hash_collection& hash() { return m_hash; }
-	util::hash_collection calculate_hash_on_file(util::core_file &file) const;
+	util::hash_collection& hash() { wait_for_hash(); return m_hash; }
+	util::hash_collection calculate_hash_on_file(util::core_file &file, const std::string &path = std::string()) const;
 
 	void battery_load(void *buffer, int length, int fill);
 	void battery_load(void *buffer, int length, const void *def_buffer);
@@ -290,6 +290,9 @@ private:
 
 	bool init_phase() const;
 	static bool run_hash(util::core_file &file, u32 skip_bytes, util::hash_collection &hashes, const char *types);
+	bool start_hash();
+	void wait_for_hash();
+	static void *hash_job_static(void *param, int threadid);
 
 	// loads an image or software items and resets - called internally when we
 	// load an is_reset_on_load() item
@@ -317,6 +320,11 @@ private:
 
 	util::hash_collection m_hash;
 
+	// full hash of a plain image file being computed in the background
+	struct hash_job;
+	std::unique_ptr<hash_job> m_hash_job;
+	osd_work_queue *m_hash_queue;
+
 	std::string m_instance_name;                // e.g. - "cartridge", "floppydisk2"
 	std::string m_brief_instance_name;          // e.g. - "cart", "flop2"
 	std::string m_canonical_instance_name;      // e.g. - "cartridge1", "floppydisk2" - only used internally in emuopts.cpp
@@ -22,6 +22,7 @@
 
 device_nvram_interface::device_nvram_interface(const machine_config &mconfig, device_t &device)
 	: device_interface(device, "nvram")
+	, m_nvram_hash_valid(false)
 {
 }
 
@@ -39,12 +39,21 @@ public:
 	void nvram_save(emu_file &file) { nvram_write(file); }
 	bool nvram_can_save() { return nvram_can_write(); }
 
+	// change detection against the contents last loaded from or written to disk
+	bool nvram_changed(const util::sha1_t &hash) const { return !m_nvram_hash_valid || (hash != m_nvram_hash); }
+	void nvram_set_stored(const util::sha1_t &hash) { m_nvram_hash = hash; m_nvram_hash_valid = true; }
+	void nvram_set_unstored() { m_nvram_hash_valid = false; }
+
 protected:
 	// derived class overrides
 	virtual void nvram_default() = 0;
 	virtual void nvram_read(emu_file &file) = 0;
 	virtual void nvram_write(emu_file &file) = 0;
 	virtual bool nvram_can_write() { return true; }
+
+private:
+	util::sha1_t    m_nvram_hash;           // hash of what's on disk
+	bool            m_nvram_hash_valid;     // whether the hash is known
 };
 
 // iterator
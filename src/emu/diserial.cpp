@@ -38,6 +38,8 @@ device_serial_interface::device_serial_interface(const machine_config &mconfig,
 	m_tra_bit_count(0),
 	m_rcv_clock(nullptr),
 	m_tra_clock(nullptr),
+	m_byte_timer(nullptr),
+	m_peer(nullptr),
 	m_rcv_rate(attotime::never),
 	m_tra_rate(attotime::never),
 	m_rcv_line(0),
@@ -71,6 +73,8 @@ void device_serial_interface::interface_pre_start()
 		m_rcv_clock = device().machine().scheduler().timer_alloc(timer_expired_delegate(FUNC(device_serial_interface::rcv_clock), this));
 	if (!m_tra_clock)
 		m_tra_clock = device().machine().scheduler().timer_alloc(timer_expired_delegate(FUNC(device_serial_interface::tra_clock), this));
+	if (!m_byte_timer)
+		m_byte_timer = device().machine().scheduler().timer_alloc(timer_expired_delegate(FUNC(device_serial_interface::byte_complete), this));
 	m_rcv_clock_state = false;
 	m_tra_clock_state = false;
 }
@@ -111,6 +115,48 @@ void device_serial_interface::set_tra_rate(const attotime &rate)
 	m_tra_rate = rate/2;
 	transmit_register_reset();
 	m_tra_clock->adjust(attotime::never);
+	m_byte_timer->adjust(attotime::never);
+}
+
+/* Devices wired straight to each other (no bit banging, nothing else on
+   the line) can be told so, and then characters are handed over whole:
+   one timer per character instead of one per half bit.  Each character
+   still goes bit by bit unless both ends run off their own rate timers
+   at the same rate with the same framing, and the receiver is idle. */
+void device_serial_interface::set_serial_peer(device_serial_interface &peer)
+{
+	m_peer = &peer;
+	peer.m_peer = this;
+}
+
+bool device_serial_interface::byte_mode_possible() const
+{
+	return m_peer
+			&& !m_tra_rate.is_never()
+			&& m_tra_rate == m_peer->m_rcv_rate
+			&& m_df_start_bit_count == m_peer->m_df_start_bit_count
+			&& m_df_word_length == m_peer->m_df_word_length
+			&& m_df_parity == m_peer->m_df_parity
+			&& m_df_stop_bit_count == m_peer->m_df_stop_bit_count
+			&& m_df_start_bit_count
+			&& (m_peer->m_rcv_flags & RECEIVE_REGISTER_WAITING_FOR_START_BIT)
+			&& (m_peer->m_rcv_register_data & 0x8000)
+			&& !(m_peer->m_rcv_flags & RECEIVE_REGISTER_FULL);
+}
+
+/* the character has been on the line for as long as it would have taken bit by bit */
+TIMER_CALLBACK_MEMBER(device_serial_interface::byte_complete)
+{
+	/* feed the peer's receive register the bits it would have sampled */
+	for (int i = 0; i < m_tra_bit_count && !m_peer->is_receive_register_full(); i++)
+		m_peer->receive_register_update_bit((m_tra_register_data >> (m_tra_bit_count - 1 - i)) & 1);
+
+	m_tra_bit_count_transmitted = m_tra_bit_count;
+	m_tra_flags |= TRANSMIT_REGISTER_EMPTY;
+
+	if (m_peer->is_receive_register_full())
+		m_peer->rcv_complete();
+	tra_complete();
 }
 
 void device_serial_interface::tra_edge()
@@ -426,6 +472,14 @@ void device_serial_interface::transmit_register_setup(u8 data_byte)
 	if (m_df_stop_bit_count)  // no stop bits for synchronous
 		for (i=0; i<=m_df_stop_bit_count; i++)   // ToDo - see if the hack on this line is still needed (was added 2016-04-10)
 			transmit_register_add_bit(1);
+
+	/* hand the whole character over if the other end can take it that way */
+	if (byte_mode_possible())
+	{
+		LOGMASKED(LOG_TX, "Transmitting %02x as a whole character\n", data_byte);
+		m_tra_clock->adjust(attotime::never);
+		m_byte_timer->adjust(m_tra_rate * (2 * m_tra_bit_count));
+	}
 }
 
 
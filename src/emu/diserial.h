@@ -81,6 +81,9 @@ public:
 	DECLARE_WRITE_LINE_MEMBER(rx_clock_w);
 	DECLARE_WRITE_LINE_MEMBER(clock_w);
 
+	// pass whole characters to a serial device wired straight to this one
+	void set_serial_peer(device_serial_interface &peer);
+
 protected:
 	void set_data_frame(int start_bit_count, int data_bit_count, parity_t parity, stop_bits_t stop_bits);
 
@@ -131,6 +134,7 @@ protected:
 private:
 	TIMER_CALLBACK_MEMBER(rcv_clock) { rx_clock_w(!m_rcv_clock_state); }
 	TIMER_CALLBACK_MEMBER(tra_clock) { tx_clock_w(!m_tra_clock_state); }
+	TIMER_CALLBACK_MEMBER(byte_complete);
 
 	u8 m_serial_parity_table[256];
 
@@ -171,6 +175,8 @@ private:
 
 	emu_timer *m_rcv_clock;
 	emu_timer *m_tra_clock;
+	emu_timer *m_byte_timer;
+	device_serial_interface *m_peer;
 	attotime m_rcv_rate;
 	attotime m_tra_rate;
 	u8 m_rcv_line;
@@ -179,6 +185,7 @@ private:
 
 	void tra_edge();
 	void rcv_edge();
+	bool byte_mode_possible() const;
 };
 
 
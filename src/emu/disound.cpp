@@ -72,7 +72,12 @@ device_sound_interface &device_sound_interface::add_route(u32 output, device_t &
 
 sound_stream *device_sound_interface::stream_alloc_legacy(int inputs, int outputs, int sample_rate)
 {
-	return device().machine().sound().stream_alloc_legacy(*this, inputs, outputs, sample_rate, stream_update_legacy_delegate(&device_sound_interface::sound_stream_update_legacy, this));
+	return device().machine().sound().stream_alloc_legacy(*this, inputs, outputs, sample_rate, stream_update_legacy_delegate(&device_sound_interface::sound_stream_update_legacy, this), STREAM_DEFAULT_FLAGS);
+}
+
+sound_stream *device_sound_interface::stream_alloc_legacy(int inputs, int outputs, int sample_rate, sound_stream_flags flags)
+{
+	return device().machine().sound().stream_alloc_legacy(*this, inputs, outputs, sample_rate, stream_update_legacy_delegate(&device_sound_interface::sound_stream_update_legacy, this), flags);
 }
 
 sound_stream *device_sound_interface::stream_alloc(int inputs, int outputs, int sample_rate)
@@ -501,12 +506,14 @@ void device_mixer_interface::sound_stream_update(sound_stream &stream, std::vect
 	std::fill(std::begin(m_output_clear), std::end(m_output_clear), false);
 
 	// loop over inputs
+	bool silent = true;
 	for (int inputnum = 0; inputnum < m_auto_allocated_inputs; inputnum++)
 	{
-		// skip if the gain is 0
+		// skip if the gain is 0 or the input has nothing to contribute
 		auto &input = inputs[inputnum];
-		if (input.gain() == 0)
+		if (input.gain() == 0 || stream.input_silent_since(inputnum, input.start_time()))
 			continue;
+		silent = false;
 
 		// either store or accumulate
 		int outputnum = m_outputmap[inputnum];
@@ -523,4 +530,8 @@ void device_mixer_interface::sound_stream_update(sound_stream &stream, std::vect
 	for (int outputnum = 0; outputnum < m_outputs; outputnum++)
 		if (!m_output_clear[outputnum])
 			outputs[outputnum].fill(0);
+
+	// let downstream mixers and resamplers skip us too
+	if (silent)
+		stream.set_update_silent();
 }
@@ -82,6 +82,7 @@ public:
 
 	// stream creation
 	sound_stream *stream_alloc_legacy(int inputs, int outputs, int sample_rate);
+	sound_stream *stream_alloc_legacy(int inputs, int outputs, int sample_rate, sound_stream_flags flags);
 	sound_stream *stream_alloc(int inputs, int outputs, int sample_rate);
 	sound_stream *stream_alloc(int inputs, int outputs, int sample_rate, sound_stream_flags flags);
 
@@ -11,6 +11,9 @@
 #include "emu.h"
 #include "drawgfxt.ipp"
 
+#include <future>
+#include <thread>
+
 
 /***************************************************************************
     INLINE FUNCTIONS
@@ -27,6 +30,32 @@ static inline int readbit(const u8 *src, unsigned int bitnum)
 }
 
 
+/*-------------------------------------------------
+    planar_expand - table turning one byte of a
+    bit plane into eight pixels, one per byte,
+    leftmost pixel in the lowest address
+-------------------------------------------------*/
+
+static const u64 *planar_expand()
+{
+	static const struct expand_table
+	{
+		expand_table()
+		{
+			for (int b = 0; b < 256; b++)
+			{
+				u8 pixels[8];
+				for (int i = 0; i < 8; i++)
+					pixels[i] = BIT(b, 7 - i);
+				memcpy(&table[b], pixels, sizeof(pixels));
+			}
+		}
+		u64 table[256];
+	} s_expand;
+	return s_expand.table;
+}
+
+
 /*-------------------------------------------------
     normalize_xscroll - normalize an X scroll
     value for a bitmap to be positive and less
@@ -51,6 +80,514 @@ static inline s32 normalize_yscroll(const bitmap_t &bitmap, s32 yscroll)
 }
 
 
+/***************************************************************************
+    VECTORIZED SPANS
+***************************************************************************/
+
+// use SSE or NEON for the common unzoomed blitters where it can be assumed;
+// table lookups for priority and transparency masks need a byte shuffle
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)) || defined(_M_X64))
+#define DRAWGFX_SSE (1)
+#include <emmintrin.h>
+#if defined(__SSSE3__)
+#define DRAWGFX_LOOKUP (1)
+#include <tmmintrin.h>
+#endif
+#elif (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__ARM_NEON) || defined(__ARM_NEON__)) && defined(__aarch64__)
+#define DRAWGFX_NEON (1)
+#define DRAWGFX_LOOKUP (1)
+#include <arm_neon.h>
+#endif
+
+#if defined(DRAWGFX_SSE) || defined(DRAWGFX_NEON)
+
+namespace {
+
+/*-------------------------------------------------
+    drawgfx_spans - clip an unzoomed element
+    and hand each visible row to span_op as
+    (dest, priority, source, count, flipped);
+    priority is nullptr if not supplied, and a
+    flipped source is read right to left
+-------------------------------------------------*/
+
+template <typename BitmapType, typename SpanFunction>
+void drawgfx_spans(gfx_element &gfx, BitmapType &dest, const rectangle &cliprect, u32 code, int flipx, int flipy, s32 destx, s32 desty, bitmap_ind8 *priority, SpanFunction span_op)
+{
+	g_profiler.start(PROFILER_DRAWGFX);
+	do {
+		assert(dest.valid());
+		assert(dest.cliprect().contains(cliprect));
+		assert(code < gfx.elements());
+
+		// ignore empty/invalid cliprects
+		if (cliprect.empty())
+			break;
+
+		// clip in X and exit if we are entirely clipped
+		s32 destendx = destx + gfx.width() - 1;
+		if (destx > cliprect.right() || destendx < cliprect.left())
+			break;
+		s32 srcx = 0;
+		if (destx < cliprect.left())
+		{
+			srcx = cliprect.left() - destx;
+			destx = cliprect.left();
+		}
+		if (destendx > cliprect.right())
+			destendx = cliprect.right();
+
+		// clip in Y and exit if we are entirely clipped
+		s32 destendy = desty + gfx.height() - 1;
+		if (desty > cliprect.bottom() || destendy < cliprect.top())
+			break;
+		s32 srcy = 0;
+		if (desty < cliprect.top())
+		{
+			srcy = cliprect.top() - desty;
+			desty = cliprect.top();
+		}
+		if (destendy > cliprect.bottom())
+			destendy = cliprect.bottom();
+
+		// apply flipping
+		if (flipx)
+			srcx = gfx.width() - 1 - srcx;
+		s32 dy = gfx.rowbytes();
+		if (flipy)
+		{
+			srcy = gfx.height() - 1 - srcy;
+			dy = -dy;
+		}
+
+		// iterate over rows
+		const u8 *srcdata = gfx.get_data(code) + srcy * gfx.rowbytes() + srcx;
+		s32 const count = destendx + 1 - destx;
+		for (s32 cury = desty; cury <= destendy; cury++, srcdata += dy)
+			span_op(&dest.pix(cury, destx), priority ? &priority->pix8(cury, destx) : nullptr, srcdata, count, flipx != 0);
+	} while (0);
+	g_profiler.stop();
+}
+
+
+#if defined(DRAWGFX_SSE)
+
+/*-------------------------------------------------
+    load_pens - fetch 16 source pens in
+    destination order
+-------------------------------------------------*/
+
+inline __m128i load_pens(const u8 *src, s32 x, bool flipped)
+{
+	if (!flipped)
+		return _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + x));
+
+	// reverse the words, then the bytes within each word
+	__m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src - x - 15));
+	value = _mm_shufflelo_epi16(value, 0x1b);
+	value = _mm_shufflehi_epi16(value, 0x1b);
+	value = _mm_shuffle_epi32(value, 0x4e);
+	return _mm_or_si128(_mm_slli_epi16(value, 8), _mm_srli_epi16(value, 8));
+}
+
+
+/*-------------------------------------------------
+    blend_rebase - store color + pens to 16
+    pixels wherever keep is zero
+-------------------------------------------------*/
+
+inline void blend_rebase(u16 *dest, __m128i pens, __m128i keep, __m128i base)
+{
+	__m128i const zero = _mm_setzero_si128();
+	__m128i const keeplo = _mm_unpacklo_epi8(keep, keep);
+	__m128i const keephi = _mm_unpackhi_epi8(keep, keep);
+	__m128i const lo = _mm_add_epi16(_mm_unpacklo_epi8(pens, zero), base);
+	__m128i const hi = _mm_add_epi16(_mm_unpackhi_epi8(pens, zero), base);
+	__m128i *const out = reinterpret_cast<__m128i *>(dest);
+	_mm_storeu_si128(out + 0, _mm_or_si128(_mm_and_si128(keeplo, _mm_loadu_si128(out + 0)), _mm_andnot_si128(keeplo, lo)));
+	_mm_storeu_si128(out + 1, _mm_or_si128(_mm_and_si128(keephi, _mm_loadu_si128(out + 1)), _mm_andnot_si128(keephi, hi)));
+}
+
+
+/*-------------------------------------------------
+    remap_masked - store paldata[pen] to each of
+    16 pixels whose bit is set in draw
+-------------------------------------------------*/
+
+inline void remap_masked(u32 *dest, __m128i pens, u32 draw, const pen_t *paldata)
+{
+	u8 pen[16];
+	_mm_storeu_si128(reinterpret_cast<__m128i *>(pen), pens);
+	for (int i = 0; draw != 0; i++, draw >>= 1)
+		if (draw & 1)
+			dest[i] = paldata[pen[i]];
+}
+
+
+#if defined(DRAWGFX_LOOKUP)
+
+/*-------------------------------------------------
+    make_table - expand each bit of a 32-bit mask
+    to a byte of all ones or all zeros
+-------------------------------------------------*/
+
+inline void make_table(u32 mask, __m128i &lo, __m128i &hi)
+{
+	u8 table[32];
+	for (int i = 0; i < 32; i++)
+		table[i] = BIT(mask, i) ? 0xff : 0x00;
+	lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&table[0]));
+	hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&table[16]));
+}
+
+
+/*-------------------------------------------------
+    lookup32 - look up the low five bits of each
+    byte in a table built by make_table
+-------------------------------------------------*/
+
+inline __m128i lookup32(__m128i lo, __m128i hi, __m128i index)
+{
+	index = _mm_and_si128(index, _mm_set1_epi8(0x1f));
+	__m128i const upper = _mm_cmpgt_epi8(index, _mm_set1_epi8(0x0f));
+	__m128i const low4 = _mm_and_si128(index, _mm_set1_epi8(0x0f));
+	return _mm_or_si128(_mm_and_si128(upper, _mm_shuffle_epi8(hi, low4)), _mm_andnot_si128(upper, _mm_shuffle_epi8(lo, low4)));
+}
+
+#endif // DRAWGFX_LOOKUP
+
+
+/*-------------------------------------------------
+    span kernels - each handles whole groups of 16
+    pixels and returns how many it did, leaving
+    the rest of the span to the scalar pixel op
+-------------------------------------------------*/
+
+s32 span_rebase_opaque(u16 *dest, const u8 *src, s32 count, bool flipped, u32 color)
+{
+	__m128i const base = _mm_set1_epi16(s16(color));
+	__m128i const none = _mm_setzero_si128();
+	s32 x = 0;
+	for ( ; x + 16 <= count; x += 16)
+		blend_rebase(dest + x, load_pens(src, x, flipped), none, base);
+	return x;
+}
+
+s32 span_rebase_transpen(u16 *dest, const u8 *src, s32 count, bool flipped, u32 color, u32 trans_pen)
+{
+	__m128i const base = _mm_set1_epi16(s16(color));
+	__m128i const trans = _mm_set1_epi8(s8(trans_pen));
+	s32 x = 0;
+	for ( ; x + 16 <= count; x += 16)
+	{
+		__m128i const pens = load_pens(src, x, flipped);
+		__m128i const keep = _mm_cmpeq_epi8(pens, trans);
+		if (_mm_movemask_epi8(keep) != 0xffff)
+			blend_rebase(dest + x, pens, keep, base);
+	}
+	return x;
+}
+
+s32 span_remap_transpen(u32 *dest, const u8 *src, s32 count, bool flipped, const pen_t *paldata, u32 trans_pen)
+{
+	__m128i const trans = _mm_set1_epi8(s8(trans_pen));
+	s32 x = 0;
+	for ( ; x + 16 <= count; x += 16)
+	{
+		__m128i const pens = load_pens(src, x, flipped);
+		u32 const draw = ~_mm_movemask_epi8(_mm_cmpeq_epi8(pens, trans)) & 0xffff;
+		if (draw != 0)
+			remap_masked(dest + x, pens, draw, paldata);
+	}
+	return x;
+}
+
+#if defined(DRAWGFX_LOOKUP)
+
+s32 span_rebase_transmask(u16 *dest, const u8 *src, s32 count, bool flipped, u32 color, u32 trans_mask)
+{
+	__m128i const base = _mm_set1_epi16(s16(color));
+	__m128i tlo, thi;
+	make_table(trans_mask, tlo, thi);
+	s32 x = 0;
+	for ( ; x + 16 <= count; x += 16)
+	{
+		__m128i const pens = load_pens(src, x, flipped);
+		__m128i const keep = lookup32(tlo, thi, pens);
+		if (_mm_movemask_epi8(keep) != 0xffff)
+			blend_rebase(dest + x, pens, keep, base);
+	}
+	return x;
+}
+
+s32 span_remap_transmask(u32 *dest, const u8 *src, s32 count, bool flipped, const pen_t *paldata, u32 trans_mask)
+{
+	__m128i tlo, thi;
+	make_table(trans_mask, tlo, thi);
+	s32 x = 0;
+	for ( ; x + 16 <= count; x += 16)
+	{
+		__m128i const pens = load_pens(src, x, flipped);
+		u32 const draw = ~_mm_movemask_epi8(lookup32(tlo, thi, pens)) & 0xffff;
+		if (draw != 0)
+			remap_masked(dest + x, pens, draw, paldata);
+	}
+	return x;
+}
+
+// shared by the priority kernels: returns the pixels to store and updates the
+// priority of every opaque pixel to 31
+inline __m128i priority_transpen(u8 *pri, s32 x, __m128i pens, __m128i trans, __m128i plo, __m128i phi, bool &any)
+{
+	__m128i const transparent = _mm_cmpeq_epi8(pens, trans);
+	any = _mm_movemask_epi8(transparent) != 0xffff;
+	if (!any)
+		return _mm_setzero_si128();
+	__m128i *const priptr = reinterpret_cast<__m128i *>(pri + x);
+	__m128i const oldpri = _mm_loadu_si128(priptr);
+	__m128i const blocked = lookup32(plo, phi, oldpri);
+	_mm_storeu_si128(priptr, _mm_or_si128(_mm_and_si128(transparent, oldpri), _mm_andnot_si128(transparent, _mm_set1_epi8(31))));
+	return _mm_andnot_si128(_mm_or_si128(transparent, blocked), _mm_set1_epi8(-1));
+}
+
+s32 span_rebase_prio_transpen(u16 *dest, u8 *pri, const u8 *src, s32 count, bool flipped, u32 color, u32 pmask, u32 trans_pen)
+{
+	__m128i const base = _mm_set1_epi16(s16(color));
+	__m128i const trans = _mm_set1_epi8(s8(trans_pen));
+	__m128i plo, phi;
+	make_table(pmask, plo, phi);
+	s32 x = 0;
+	for ( ; x + 16 <= count; x += 16)
+	{
+		bool any;
+		__m128i const pens = load_pens(src, x, flipped);
+		__m128i const draw = priority_transpen(pri, x, pens, trans, plo, phi, any);
+		if (any)
+			blend_rebase(dest + x, pens, _mm_cmpeq_epi8(draw, _mm_setzero_si128()), base);
+	}
+	return x;
+}
+
+s32 span_remap_prio_transpen(u32 *dest, u8 *pri, const u8 *src, s32 count, bool flipped, const pen_t *paldata, u32 pmask, u32 trans_pen)
+{
+	__m128i const trans = _mm_set1_epi8(s8(trans_pen));
+	__m128i plo, phi;
+	make_table(pmask, plo, phi);
+	s32 x = 0;
+	for ( ; x + 16 <= count; x += 16)
+	{
+		bool any;
+		__m128i const pens = load_pens(src, x, flipped);
+		__m128i const draw = priority_transpen(pri, x, pens, trans, plo, phi, any);
+		if (any)
+			remap_masked(dest + x, pens, _mm_movemask_epi8(draw), paldata);
+	}
+	return x;
+}
+
+#endif // DRAWGFX_LOOKUP
+
+#else // DRAWGFX_NEON
+
+/*-------------------------------------------------
+    load_pens - fetch 16 source pens in
+    destination order
+-------------------------------------------------*/
+
+inline uint8x16_t load_pens(const u8 *src, s32 x, bool flipped)
+{
+	if (!flipped)
+		return vld1q_u8(src + x);
+	uint8x16_t const value = vrev64q_u8(vld1q_u8(src - x - 15));
+	return vextq_u8(value, value, 8);
+}
+
+
+/*-------------------------------------------------
+    blend_rebase - store color + pens to 16
+    pixels wherever keep is zero
+-------------------------------------------------*/
+
+inline void blend_rebase(u16 *dest, uint8x16_t pens, uint8x16_t keep, uint16x8_t base)
+{
+	uint16x8_t const keeplo = vreinterpretq_u16_s16(vmovl_s8(vreinterpret_s8_u8(vget_low_u8(keep))));
+	uint16x8_t const keephi = vreinterpretq_u16_s16(vmovl_s8(vreinterpret_s8_u8(vget_high_u8(keep))));
+	uint16x8_t const lo = vaddq_u16(vmovl_u8(vget_low_u8(pens)), base);
+	uint16x8_t const hi = vaddq_u16(vmovl_u8(vget_high_u8(pens)), base);
+	vst1q_u16(dest + 0, vbslq_u16(keeplo, vld1q_u16(dest + 0), lo));
+	vst1q_u16(dest + 8, vbslq_u16(keephi, vld1q_u16(dest + 8), hi));
+}
+
+
+/*-------------------------------------------------
+    remap_masked - store paldata[pen] to each of
+    16 pixels whose byte is set in draw
+-------------------------------------------------*/
+
+inline void remap_masked(u32 *dest, uint8x16_t pens, uint8x16_t draw, const pen_t *paldata)
+{
+	if (vmaxvq_u8(draw) == 0)
+		return;
+	u8 pen[16], flag[16];
+	vst1q_u8(pen, pens);
+	vst1q_u8(flag, draw);
+	for (int i = 0; i < 16; i++)
+		if (flag[i] != 0)
+			dest[i] = paldata[pen[i]];
+}
+
+
+/*-------------------------------------------------
+    make_table - expand each bit of a 32-bit mask
+    to a byte of all ones or all zeros
+-------------------------------------------------*/
+
+inline uint8x16x2_t make_table(u32 mask)
+{
+	u8 table[32];
+	for (int i = 0; i < 32; i++)
+		table[i] = BIT(mask, i) ? 0xff : 0x00;
+	uint8x16x2_t result;
+	result.val[0] = vld1q_u8(&table[0]);
+	result.val[1] = vld1q_u8(&table[16]);
+	return result;
+}
+
+
+/*-------------------------------------------------
+    lookup32 - look up the low five bits of each
+    byte in a table built by make_table
+-------------------------------------------------*/
+
+inline uint8x16_t lookup32(uint8x16x2_t const &table, uint8x16_t index)
+{
+	return vqtbl2q_u8(table, vandq_u8(index, vdupq_n_u8(0x1f)));
+}
+
+
+/*-------------------------------------------------
+    span kernels - each handles whole groups of 16
+    pixels and returns how many it did, leaving
+    the rest of the span to the scalar pixel op
+-------------------------------------------------*/
+
+s32 span_rebase_opaque(u16 *dest, const u8 *src, s32 count, bool flipped, u32 color)
+{
+	uint16x8_t const base = vdupq_n_u16(u16(color));
+	uint8x16_t const none = vdupq_n_u8(0);
+	s32 x = 0;
+	for ( ; x + 16 <= count; x += 16)
+		blend_rebase(dest + x, load_pens(src, x, flipped), none, base);
+	return x;
+}
+
+s32 span_rebase_transpen(u16 *dest, const u8 *src, s32 count, bool flipped, u32 color, u32 trans_pen)
+{
+	uint16x8_t const base = vdupq_n_u16(u16(color));
+	uint8x16_t const trans = vdupq_n_u8(u8(trans_pen));
+	s32 x = 0;
+	for ( ; x + 16 <= count; x += 16)
+	{
+		uint8x16_t const pens = load_pens(src, x, flipped);
+		uint8x16_t const keep = vceqq_u8(pens, trans);
+		if (vminvq_u8(keep) == 0)
+			blend_rebase(dest + x, pens, keep, base);
+	}
+	return x;
+}
+
+s32 span_remap_transpen(u32 *dest, const u8 *src, s32 count, bool flipped, const pen_t *paldata, u32 trans_pen)
+{
+	uint8x16_t const trans = vdupq_n_u8(u8(trans_pen));
+	s32 x = 0;
+	for ( ; x + 16 <= count; x += 16)
+	{
+		uint8x16_t const pens = load_pens(src, x, flipped);
+		remap_masked(dest + x, pens, vmvnq_u8(vceqq_u8(pens, trans)), paldata);
+	}
+	return x;
+}
+
+s32 span_rebase_transmask(u16 *dest, const u8 *src, s32 count, bool flipped, u32 color, u32 trans_mask)
+{
+	uint16x8_t const base = vdupq_n_u16(u16(color));
+	uint8x16x2_t const table = make_table(trans_mask);
+	s32 x = 0;
+	for ( ; x + 16 <= count; x += 16)
+	{
+		uint8x16_t const pens = load_pens(src, x, flipped);
+		uint8x16_t const keep = lookup32(table, pens);
+		if (vminvq_u8(keep) == 0)
+			blend_rebase(dest + x, pens, keep, base);
+	}
+	return x;
+}
+
+s32 span_remap_transmask(u32 *dest, const u8 *src, s32 count, bool flipped, const pen_t *paldata, u32 trans_mask)
+{
+	uint8x16x2_t const table = make_table(trans_mask);
+	s32 x = 0;
+	for ( ; x + 16 <= count; x += 16)
+	{
+		uint8x16_t const pens = load_pens(src, x, flipped);
+		remap_masked(dest + x, pens, vmvnq_u8(lookup32(table, pens)), paldata);
+	}
+	return x;
+}
+
+// shared by the priority kernels: returns the pixels to store and updates the
+// priority of every opaque pixel to 31
+inline uint8x16_t priority_transpen(u8 *pri, s32 x, uint8x16_t pens, uint8x16_t trans, uint8x16x2_t const &ptable, bool &any)
+{
+	uint8x16_t const transparent = vceqq_u8(pens, trans);
+	any = vminvq_u8(transparent) == 0;
+	if (!any)
+		return vdupq_n_u8(0);
+	uint8x16_t const oldpri = vld1q_u8(pri + x);
+	vst1q_u8(pri + x, vbslq_u8(transparent, oldpri, vdupq_n_u8(31)));
+	return vmvnq_u8(vorrq_u8(transparent, lookup32(ptable, oldpri)));
+}
+
+s32 span_rebase_prio_transpen(u16 *dest, u8 *pri, const u8 *src, s32 count, bool flipped, u32 color, u32 pmask, u32 trans_pen)
+{
+	uint16x8_t const base = vdupq_n_u16(u16(color));
+	uint8x16_t const trans = vdupq_n_u8(u8(trans_pen));
+	uint8x16x2_t const ptable = make_table(pmask);
+	s32 x = 0;
+	for ( ; x + 16 <= count; x += 16)
+	{
+		bool any;
+		uint8x16_t const pens = load_pens(src, x, flipped);
+		uint8x16_t const draw = priority_transpen(pri, x, pens, trans, ptable, any);
+		if (any)
+			blend_rebase(dest + x, pens, vmvnq_u8(draw), base);
+	}
+	return x;
+}
+
+s32 span_remap_prio_transpen(u32 *dest, u8 *pri, const u8 *src, s32 count, bool flipped, const pen_t *paldata, u32 pmask, u32 trans_pen)
+{
+	uint8x16_t const trans = vdupq_n_u8(u8(trans_pen));
+	uint8x16x2_t const ptable = make_table(pmask);
+	s32 x = 0;
+	for ( ; x + 16 <= count; x += 16)
+	{
+		bool any;
+		uint8x16_t const pens = load_pens(src, x, flipped);
+		uint8x16_t const draw = priority_transpen(pri, x, pens, trans, ptable, any);
+		if (any)
+			remap_masked(dest + x, pens, draw, paldata);
+	}
+	return x;
+}
+
+#endif // DRAWGFX_SSE / DRAWGFX_NEON
+
+} // anonymous namespace
+
+#endif // DRAWGFX_SSE || DRAWGFX_NEON
+
+
 
 //**************************************************************************
 //  DEVICE DEFINITIONS
@@ -71,6 +608,9 @@ gfxdecode_device::gfxdecode_device(const machine_config &mconfig, const char *ta
     GRAPHICS ELEMENTS
 ***************************************************************************/
 
+constexpr u32 gfx_element::UNPACKED_POOL_SIZE;
+constexpr u32 gfx_element::NOT_UNPACKED;
+
 
 //-------------------------------------------------
 //  gfx_element - constructor
@@ -96,8 +636,13 @@ gfx_element::gfx_element(device_palette_interface *palette, u8 *base, u16 width,
 		m_gfxdata(base),
 		m_layout_is_raw(true),
 		m_layout_planes(0),
+		m_layout_decode(DECODE_BITS),
 		m_layout_xormask(0),
-		m_layout_charincrement(0)
+		m_layout_charincrement(0),
+		m_packed(false),
+		m_packed_line_modulo(0),
+		m_packed_char_modulo(0),
+		m_unpacked_next(0)
 {
 }
 
@@ -121,8 +666,13 @@ gfx_element::gfx_element(device_palette_interface *palette, const gfx_layout &gl
 		m_gfxdata(nullptr),
 		m_layout_is_raw(false),
 		m_layout_planes(0),
+		m_layout_decode(DECODE_BITS),
 		m_layout_xormask(xormask),
-		m_layout_charincrement(0)
+		m_layout_charincrement(0),
+		m_packed(false),
+		m_packed_line_modulo(0),
+		m_packed_char_modulo(0),
+		m_unpacked_next(0)
 {
 	// set the layout
 	set_layout(gl, srcdata);
@@ -185,12 +735,13 @@ void gfx_element::set_layout(const gfx_layout &gl, const u8 *srcdata)
 		// we get to pick our own modulos
 		m_line_modulo = m_origwidth;
 		m_char_modulo = m_line_modulo * m_origheight;
-
-		// allocate memory for the data
-		m_gfxdata_allocated.resize(m_total_elements * m_char_modulo);
-		m_gfxdata = &m_gfxdata_allocated[0];
+		m_packed_line_modulo = (m_origwidth + 1) / 2;
+		m_packed_char_modulo = m_packed_line_modulo * m_origheight;
 	}
 
+	classify_layout();
+	allocate_data();
+
 	// mark everything dirty
 	m_dirty.resize(m_total_elements);
 	memset(&m_dirty[0], 1, m_total_elements);
@@ -252,15 +803,9 @@ void gfx_element::set_source_and_total(const u8 *source, u32 total)
 		m_pen_usage.resize(m_total_elements);
 
 	if (m_layout_is_raw)
-	{
 		m_gfxdata = const_cast<u8 *>(source);
-	}
 	else
-	{
-		// allocate memory for the data
-		m_gfxdata_allocated.resize(m_total_elements * m_char_modulo);
-		m_gfxdata = &m_gfxdata_allocated[0];
-	}
+		allocate_data();
 }
 
 
@@ -282,17 +827,229 @@ void gfx_element::set_source_clip(u32 xoffs, u32 width, u32 yoffs, u32 height)
 }
 
 
+//-------------------------------------------------
+//  set_packed - store decoded pixels two to a
+//  byte, halving the memory a set of 16 colour
+//  elements takes; recently drawn elements are
+//  kept unpacked in a small pool
+//-------------------------------------------------
+
+void gfx_element::set_packed(bool packed)
+{
+	packed = packed && !m_layout_is_raw && m_color_depth <= 16;
+	if (packed == m_packed)
+		return;
+
+	m_packed = packed;
+	allocate_data();
+	memset(&m_dirty[0], 1, elements());
+}
+
+
+//-------------------------------------------------
+//  allocate_data - size the decoded pixel store
+//  for the element count and storage mode
+//-------------------------------------------------
+
+void gfx_element::allocate_data()
+{
+	if (m_layout_is_raw || m_color_depth > 16)
+		m_packed = false;
+
+	if (m_layout_is_raw)
+	{
+		m_gfxdata_allocated.clear();
+	}
+	else if (m_packed)
+	{
+		m_gfxdata_allocated.resize(m_total_elements * m_packed_char_modulo);
+		m_gfxdata_allocated.shrink_to_fit();
+		m_gfxdata = m_gfxdata_allocated.empty() ? nullptr : &m_gfxdata_allocated[0];
+		m_unpacked_pool.resize(UNPACKED_POOL_SIZE * m_char_modulo);
+		m_unpacked_code.assign(UNPACKED_POOL_SIZE, NOT_UNPACKED);
+		m_unpacked_slot.assign(m_total_elements, NOT_UNPACKED);
+		m_unpacked_next = 0;
+	}
+	else
+	{
+		m_gfxdata_allocated.resize(m_total_elements * m_char_modulo);
+		m_gfxdata = m_gfxdata_allocated.empty() ? nullptr : &m_gfxdata_allocated[0];
+		m_unpacked_pool.clear();
+		m_unpacked_code.clear();
+		m_unpacked_slot.clear();
+	}
+}
+
+
+//-------------------------------------------------
+//  unpacked - return a packed element expanded
+//  to 8bpp, reusing the oldest pool slot if it
+//  isn't there already
+//-------------------------------------------------
+
+const u8 *gfx_element::unpacked(u32 code)
+{
+	u32 slot = m_unpacked_slot[code];
+	if (slot == NOT_UNPACKED)
+	{
+		slot = m_unpacked_next;
+		m_unpacked_next = (m_unpacked_next + 1) % UNPACKED_POOL_SIZE;
+		if (m_unpacked_code[slot] != NOT_UNPACKED)
+			m_unpacked_slot[m_unpacked_code[slot]] = NOT_UNPACKED;
+		m_unpacked_code[slot] = code;
+		m_unpacked_slot[code] = slot;
+
+		// even pixels are in the low nibble
+		const u8 *src = m_gfxdata + code * m_packed_char_modulo;
+		u8 *dst = &m_unpacked_pool[slot * m_char_modulo];
+		for (int y = 0; y < m_origheight; y++, src += m_packed_line_modulo, dst += m_line_modulo)
+			for (int x = 0; x < m_origwidth; x++)
+				dst[x] = (src[x / 2] >> ((x & 1) * 4)) & 0x0f;
+	}
+	return &m_unpacked_pool[slot * m_char_modulo];
+}
+
+
 //-------------------------------------------------
 //  decode - decode a single character
 //-------------------------------------------------
 
+//-------------------------------------------------
+//  classify_layout - work out which fast decode
+//  path, if any, every element of the layout
+//  can take
+//-------------------------------------------------
+
+void gfx_element::classify_layout()
+{
+	m_layout_decode = DECODE_BITS;
+	if (m_layout_is_raw)
+		return;
+
+	auto const all_aligned = [this] (u32 align, u32 planes)
+	{
+		if (m_layout_charincrement % align)
+			return false;
+		for (u32 p = 0; p < planes; p++)
+			if (m_layout_planeoffset[p] % align)
+				return false;
+		for (u32 offs : m_layout_yoffset)
+			if (offs % align)
+				return false;
+		return true;
+	};
+
+	// planar: each byte of a plane covers eight neighbouring pixels, msb first
+	bool planar = !(m_origwidth % 8) && all_aligned(8, m_layout_planes);
+	for (int x = 0; planar && x < m_origwidth; x++)
+		planar = (x % 8) ? (m_layout_xoffset[x] == m_layout_xoffset[x - x % 8] + x % 8) : !(m_layout_xoffset[x] % 8);
+	if (planar)
+	{
+		m_layout_decode = DECODE_PLANAR;
+		return;
+	}
+
+	// packed: a pixel's planes are consecutive bits, most significant first, never straddling a byte
+	u32 const planes = m_layout_planes;
+	bool packed = !(8 % planes) && all_aligned(planes, 1);
+	for (u32 p = 1; packed && p < planes; p++)
+		packed = (m_layout_planeoffset[p] == m_layout_planeoffset[0] + p);
+	for (int x = 0; packed && x < m_origwidth; x++)
+		packed = !(m_layout_xoffset[x] % planes);
+	if (packed)
+		m_layout_decode = DECODE_PACKED;
+}
+
+
+//-------------------------------------------------
+//  decode_all - decode every dirty element now,
+//  splitting large sets across threads, rather
+//  than one at a time on first use
+//-------------------------------------------------
+
+void gfx_element::decode_all()
+{
+	// nothing to decode from yet
+	if (!m_layout_is_raw && !m_srcdata)
+		return;
+
+	u32 const MIN_CHUNK = 1024;
+	u32 const total = elements();
+	u32 const threads = std::max<u32>(std::min<u32>(std::thread::hardware_concurrency(), total / MIN_CHUNK), 1);
+	u32 const chunk = (total + threads - 1) / threads;
+
+	// elements are independent, so each worker takes its own range
+	std::vector<std::future<void>> workers;
+	for (u32 first = chunk; first < total; first += chunk)
+		workers.emplace_back(std::async(std::launch::async, [this, first, chunk, total] () { decode_range(first, std::min(first + chunk, total)); }));
+	decode_range(0, std::min(chunk, total));
+	for (auto &worker : workers)
+		worker.get();
+}
+
+
+//-------------------------------------------------
+//  decode_range - decode the dirty elements in
+//  [first, last)
+//-------------------------------------------------
+
+void gfx_element::decode_range(u32 first, u32 last)
+{
+	for (u32 code = first; code < last; code++)
+		if (m_dirty[code])
+			decode(code);
+}
+
+
 void gfx_element::decode(u32 code)
 {
+	// packed elements are decoded to 8bpp on the side, then packed
+	static thread_local std::vector<u8> s_unpacked;
+	if (m_packed)
+		s_unpacked.resize(m_char_modulo);
+	u8 *const decode_base = m_packed ? &s_unpacked[0] : (m_gfxdata + code * m_char_modulo);
+
+	// planar layouts: eight pixels of a plane at a time
+	if (m_layout_decode == DECODE_PLANAR && !(m_layout_xormask % 8))
+	{
+		u64 const *const expand = planar_expand();
+		for (int y = 0; y < m_origheight; y++)
+		{
+			u8 *const dp = decode_base + y * m_line_modulo;
+			u32 const yoffs = code * m_layout_charincrement + m_layout_yoffset[y];
+			for (int x = 0; x < m_origwidth; x += 8)
+			{
+				u64 pixels = 0;
+				for (int plane = 0; plane < m_layout_planes; plane++)
+				{
+					u32 const offs = (yoffs + m_layout_planeoffset[plane] + m_layout_xoffset[x]) ^ m_layout_xormask;
+					pixels |= expand[m_srcdata[offs / 8]] << (m_layout_planes - 1 - plane);
+				}
+				memcpy(dp + x, &pixels, sizeof(pixels));
+			}
+		}
+	}
+
+	// packed layouts: one shift and mask per pixel
+	else if (m_layout_decode == DECODE_PACKED && !(m_layout_xormask % m_layout_planes))
+	{
+		u8 const mask = (1 << m_layout_planes) - 1;
+		for (int y = 0; y < m_origheight; y++)
+		{
+			u8 *const dp = decode_base + y * m_line_modulo;
+			u32 const yoffs = code * m_layout_charincrement + m_layout_planeoffset[0] + m_layout_yoffset[y];
+			for (int x = 0; x < m_origwidth; x++)
+			{
+				u32 const offs = (yoffs + m_layout_xoffset[x]) ^ m_layout_xormask;
+				dp[x] = (m_srcdata[offs / 8] >> (8 - m_layout_planes - offs % 8)) & mask;
+			}
+		}
+	}
+
 	// don't decode GFX_RAW
-	if (!m_layout_is_raw)
+	else if (!m_layout_is_raw)
 	{
 		// zap the data to 0
-		u8 *decode_base = m_gfxdata + code * m_char_modulo;
 		memset(decode_base, 0, m_char_modulo);
 
 		// iterate over planes
@@ -321,7 +1078,7 @@ void gfx_element::decode(u32 code)
 	if (code < m_pen_usage.size())
 	{
 		// iterate over data, creating a bitmask of live pens
-		const u8 *dp = m_gfxdata + code * m_char_modulo;
+		const u8 *dp = decode_base;
 		u32 usage = 0;
 		for (int y = 0; y < m_origheight; y++)
 		{
@@ -334,6 +1091,23 @@ void gfx_element::decode(u32 code)
 		m_pen_usage[code] = usage;
 	}
 
+	// pack two pixels to a byte, even pixels in the low nibble, and forget any stale unpacked copy
+	if (m_packed)
+	{
+		u8 *dst = m_gfxdata + code * m_packed_char_modulo;
+		const u8 *src = decode_base;
+		for (int y = 0; y < m_origheight; y++, src += m_line_modulo, dst += m_packed_line_modulo)
+			for (int x = 0; x < m_origwidth; x += 2)
+				dst[x / 2] = src[x] | (((x + 1 < m_origwidth) ? src[x + 1] : 0) << 4);
+
+		u32 const slot = m_unpacked_slot[code];
+		if (slot != NOT_UNPACKED)
+		{
+			m_unpacked_code[slot] = NOT_UNPACKED;
+			m_unpacked_slot[code] = NOT_UNPACKED;
+		}
+	}
+
 	// no longer dirty
 	m_dirty[code] = 0;
 }
@@ -354,7 +1128,16 @@ void gfx_element::opaque(bitmap_ind16 &dest, const rectangle &cliprect,
 {
 	color = colorbase() + granularity() * (color % colors());
 	code %= elements();
+#if defined(DRAWGFX_SSE) || defined(DRAWGFX_NEON)
+	drawgfx_spans(*this, dest, cliprect, code, flipx, flipy, destx, desty, nullptr, [color](u16 *destp, u8 *pri, const u8 *srcp, s32 count, bool flipped)
+	{
+		s32 const dx = flipped ? -1 : 1;
+		for (s32 x = span_rebase_opaque(destp, srcp, count, flipped, color); x < count; x++)
+			PIXEL_OP_REBASE_OPAQUE(destp[x], srcp[x * dx]);
+	});
+#else
 	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_OPAQUE(destp, srcp); });
+#endif
 }
 
 void gfx_element::opaque(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -395,7 +1178,16 @@ void gfx_element::transpen(bitmap_ind16 &dest, const rectangle &cliprect,
 
 	// render
 	color = colorbase() + granularity() * (color % colors());
+#if defined(DRAWGFX_SSE) || defined(DRAWGFX_NEON)
+	drawgfx_spans(*this, dest, cliprect, code, flipx, flipy, destx, desty, nullptr, [trans_pen, color](u16 *destp, u8 *pri, const u8 *srcp, s32 count, bool flipped)
+	{
+		s32 const dx = flipped ? -1 : 1;
+		for (s32 x = span_rebase_transpen(destp, srcp, count, flipped, color, trans_pen); x < count; x++)
+			PIXEL_OP_REBASE_TRANSPEN(destp[x], srcp[x * dx]);
+	});
+#else
 	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); });
+#endif
 }
 
 void gfx_element::transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -422,7 +1214,16 @@ void gfx_element::transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	// render
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
+#if defined(DRAWGFX_SSE) || defined(DRAWGFX_NEON)
+	drawgfx_spans(*this, dest, cliprect, code, flipx, flipy, destx, desty, nullptr, [trans_pen, paldata](u32 *destp, u8 *pri, const u8 *srcp, s32 count, bool flipped)
+	{
+		s32 const dx = flipped ? -1 : 1;
+		for (s32 x = span_remap_transpen(destp, srcp, count, flipped, paldata, trans_pen); x < count; x++)
+			PIXEL_OP_REMAP_TRANSPEN(destp[x], srcp[x * dx]);
+	});
+#else
 	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, paldata](u32 &destp, const u8 &srcp) { PIXEL_OP_REMAP_TRANSPEN(destp, srcp); });
+#endif
 }
 
 
@@ -442,7 +1243,16 @@ void gfx_element::transpen_raw(bitmap_ind16 &dest, const rectangle &cliprect,
 		return;
 
 	// render
+#if defined(DRAWGFX_SSE) || defined(DRAWGFX_NEON)
+	drawgfx_spans(*this, dest, cliprect, code, flipx, flipy, destx, desty, nullptr, [trans_pen, color](u16 *destp, u8 *pri, const u8 *srcp, s32 count, bool flipped)
+	{
+		s32 const dx = flipped ? -1 : 1;
+		for (s32 x = span_rebase_transpen(destp, srcp, count, flipped, color, trans_pen); x < count; x++)
+			PIXEL_OP_REBASE_TRANSPEN(destp[x], srcp[x * dx]);
+	});
+#else
 	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); });
+#endif
 }
 
 void gfx_element::transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -489,7 +1299,16 @@ void gfx_element::transmask(bitmap_ind16 &dest, const rectangle &cliprect,
 
 	// render
 	color = colorbase() + granularity() * (color % colors());
+#if defined(DRAWGFX_LOOKUP)
+	drawgfx_spans(*this, dest, cliprect, code, flipx, flipy, destx, desty, nullptr, [trans_mask, color](u16 *destp, u8 *pri, const u8 *srcp, s32 count, bool flipped)
+	{
+		s32 const dx = flipped ? -1 : 1;
+		for (s32 x = span_rebase_transmask(destp, srcp, count, flipped, color, trans_mask); x < count; x++)
+			PIXEL_OP_REBASE_TRANSMASK(destp[x], srcp[x * dx]);
+	});
+#else
 	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_mask, color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSMASK(destp, srcp); });
+#endif
 }
 
 void gfx_element::transmask(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -516,7 +1335,16 @@ void gfx_element::transmask(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	// render
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
+#if defined(DRAWGFX_LOOKUP)
+	drawgfx_spans(*this, dest, cliprect, code, flipx, flipy, destx, desty, nullptr, [trans_mask, paldata](u32 *destp, u8 *pri, const u8 *srcp, s32 count, bool flipped)
+	{
+		s32 const dx = flipped ? -1 : 1;
+		for (s32 x = span_remap_transmask(destp, srcp, count, flipped, paldata, trans_mask); x < count; x++)
+			PIXEL_OP_REMAP_TRANSMASK(destp[x], srcp[x * dx]);
+	});
+#else
 	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_mask, paldata](u32 &destp, const u8 &srcp) { PIXEL_OP_REMAP_TRANSMASK(destp, srcp); });
+#endif
 }
 
 
@@ -936,7 +1764,16 @@ void gfx_element::prio_transpen(bitmap_ind16 &dest, const rectangle &cliprect,
 
 	// render
 	color = colorbase() + granularity() * (color % colors());
+#if defined(DRAWGFX_LOOKUP)
+	drawgfx_spans(*this, dest, cliprect, code, flipx, flipy, destx, desty, &priority, [pmask, trans_pen, color](u16 *destp, u8 *pri, const u8 *srcp, s32 count, bool flipped)
+	{
+		s32 const dx = flipped ? -1 : 1;
+		for (s32 x = span_rebase_prio_transpen(destp, pri, srcp, count, flipped, color, pmask, trans_pen); x < count; x++)
+			PIXEL_OP_REBASE_TRANSPEN_PRIORITY(destp[x], pri[x], srcp[x * dx]);
+	});
+#else
 	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, priority, [pmask, trans_pen, color](u16 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN_PRIORITY(destp, pri, srcp); });
+#endif
 }
 
 void gfx_element::prio_transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -966,7 +1803,16 @@ void gfx_element::prio_transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	// render
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
+#if defined(DRAWGFX_LOOKUP)
+	drawgfx_spans(*this, dest, cliprect, code, flipx, flipy, destx, desty, &priority, [pmask, trans_pen, paldata](u32 *destp, u8 *pri, const u8 *srcp, s32 count, bool flipped)
+	{
+		s32 const dx = flipped ? -1 : 1;
+		for (s32 x = span_remap_prio_transpen(destp, pri, srcp, count, flipped, paldata, pmask, trans_pen); x < count; x++)
+			PIXEL_OP_REMAP_TRANSPEN_PRIORITY(destp[x], pri[x], srcp[x * dx]);
+	});
+#else
 	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, priority, [pmask, trans_pen, paldata](u32 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REMAP_TRANSPEN_PRIORITY(destp, pri, srcp); });
+#endif
 }
 
 
@@ -989,7 +1835,16 @@ void gfx_element::prio_transpen_raw(bitmap_ind16 &dest, const rectangle &cliprec
 	pmask |= 1 << 31;
 
 	// render
+#if defined(DRAWGFX_LOOKUP)
+	drawgfx_spans(*this, dest, cliprect, code, flipx, flipy, destx, desty, &priority, [pmask, trans_pen, color](u16 *destp, u8 *pri, const u8 *srcp, s32 count, bool flipped)
+	{
+		s32 const dx = flipped ? -1 : 1;
+		for (s32 x = span_rebase_prio_transpen(destp, pri, srcp, count, flipped, color, pmask, trans_pen); x < count; x++)
+			PIXEL_OP_REBASE_TRANSPEN_PRIORITY(destp[x], pri[x], srcp[x * dx]);
+	});
+#else
 	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, priority, [pmask, trans_pen, color](u16 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN_PRIORITY(destp, pri, srcp); });
+#endif
 }
 
 void gfx_element::prio_transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprect,
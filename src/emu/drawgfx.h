@@ -167,6 +167,7 @@ public:
 	u32 rowbytes() const { return m_line_modulo; }
 	bool has_pen_usage() const { return !m_pen_usage.empty(); }
 	bool has_palette() const { return m_palette; }
+	size_t allocated_bytes() const { return m_gfxdata_allocated.size() + m_dirty.size() + (m_pen_usage.size() * sizeof(u32)); }
 
 	// used by tilemaps
 	u32 dirtyseq() const { return m_dirtyseq; }
@@ -182,17 +183,22 @@ public:
 	void set_colorbase(u16 colorbase) { m_color_base = colorbase; }
 	void set_granularity(u16 granularity) { m_color_granularity = granularity; }
 	void set_source_clip(u32 xoffs, u32 width, u32 yoffs, u32 height);
+	void set_packed(bool packed);
 
 	// operations
 	void mark_dirty(u32 code) { if (code < elements()) { m_dirty[code] = 1; m_dirtyseq++; } }
 	void mark_all_dirty() { memset(&m_dirty[0], 1, elements()); }
+	void decode_all();
 
+	// for packed elements the data comes from a pool of recently used elements, and
+	// stays valid until UNPACKED_POOL_SIZE - 1 other elements have been fetched
 	const u8 *get_data(u32 code)
 	{
 		assert(code < elements());
 		if (code < m_dirty.size() && m_dirty[code]) decode(code);
-		return m_gfxdata + code * m_char_modulo + m_starty * m_line_modulo + m_startx;
+		return (m_packed ? unpacked(code) : (m_gfxdata + code * m_char_modulo)) + m_starty * m_line_modulo + m_startx;
 	}
+	bool packed() const { return m_packed; }
 
 	u32 pen_usage(u32 code)
 	{
@@ -280,8 +286,24 @@ public:
 	void alphatable(bitmap_rgb32 &dest, const rectangle &cliprect, u32 code, u32 color, int flipx, int flipy, s32 destx, s32 desty, int fixedalpha, u8 *alphatable);
 
 private:
+	// fast paths a layout allows for decode
+	enum : u8
+	{
+		DECODE_BITS,        // any layout: one bit at a time
+		DECODE_PLANAR,      // each plane stores 8 neighbouring pixels per byte
+		DECODE_PACKED       // each pixel's planes are adjacent bits within one byte
+	};
+
+	// packed elements unpacked at once
+	static constexpr u32 UNPACKED_POOL_SIZE = 512;
+	static constexpr u32 NOT_UNPACKED = ~u32(0);
+
 	// internal helpers
 	void decode(u32 code);
+	void decode_range(u32 first, u32 last);
+	void classify_layout();
+	void allocate_data();
+	const u8 *unpacked(u32 code);
 
 	// internal state
 	device_palette_interface *m_palette;    // palette used for drawing (optional when used as a pure decoder)
@@ -312,11 +334,20 @@ private:
 
 	bool            m_layout_is_raw;        // raw layout?
 	u8              m_layout_planes;        // bit planes in the layout
+	u8              m_layout_decode;        // fastest decode path the layout allows
 	u32             m_layout_xormask;       // xor mask applied to each bit offset
 	u32             m_layout_charincrement; // per-character increment in source data
 	std::vector<u32>  m_layout_planeoffset;// plane offsets
 	std::vector<u32>  m_layout_xoffset; // X offsets
 	std::vector<u32>  m_layout_yoffset; // Y offsets
+
+	bool            m_packed;               // decoded pixels stored two to a byte?
+	u32             m_packed_line_modulo;   // bytes between each row of packed data
+	u32             m_packed_char_modulo;   // bytes between each packed element
+	std::vector<u8> m_unpacked_pool;        // recently used packed elements, unpacked to 8bpp
+	std::vector<u32> m_unpacked_code;       // element held in each pool slot
+	std::vector<u32> m_unpacked_slot;       // pool slot holding each element
+	u32             m_unpacked_next;        // next pool slot to reuse
 };
 
 
@@ -491,9 +491,10 @@ inline void gfx_element::drawgfx_core(BitmapType &dest, const rectangle &cliprec
 		if (!flipx)
 		{
 			// iterate over pixels in Y
-			for (s32 cury = desty; cury <= destendy; cury++)
+			auto destrow = dest.rows(desty, destx);
+			for (s32 cury = desty; cury <= destendy; cury++, ++destrow)
 			{
-				auto *destptr = &dest.pix(cury, destx);
+				auto *destptr = *destrow;
 				const u8 *srcptr = srcdata;
 				srcdata += dy;
 
@@ -523,9 +524,10 @@ inline void gfx_element::drawgfx_core(BitmapType &dest, const rectangle &cliprec
 		else
 		{
 			// iterate over pixels in Y
-			for (s32 cury = desty; cury <= destendy; cury++)
+			auto destrow = dest.rows(desty, destx);
+			for (s32 cury = desty; cury <= destendy; cury++, ++destrow)
 			{
-				auto *destptr = &dest.pix(cury, destx);
+				auto *destptr = *destrow;
 				const u8 *srcptr = srcdata;
 				srcdata += dy;
 
@@ -629,10 +631,12 @@ inline void gfx_element::drawgfx_core(BitmapType &dest, const rectangle &cliprec
 		if (!flipx)
 		{
 			// iterate over pixels in Y
-			for (s32 cury = desty; cury <= destendy; cury++)
+			auto prirow = priority.rows(desty, destx);
+			auto destrow = dest.rows(desty, destx);
+			for (s32 cury = desty; cury <= destendy; cury++, ++destrow, ++prirow)
 			{
-				auto *priptr = &priority.pix(cury, destx);
-				auto *destptr = &dest.pix(cury, destx);
+				auto *priptr = *prirow;
+				auto *destptr = *destrow;
 				const u8 *srcptr = srcdata;
 				srcdata += dy;
 
@@ -664,10 +668,12 @@ inline void gfx_element::drawgfx_core(BitmapType &dest, const rectangle &cliprec
 		else
 		{
 			// iterate over pixels in Y
-			for (s32 cury = desty; cury <= destendy; cury++)
+			auto prirow = priority.rows(desty, destx);
+			auto destrow = dest.rows(desty, destx);
+			for (s32 cury = desty; cury <= destendy; cury++, ++destrow, ++prirow)
 			{
-				auto *priptr = &priority.pix(cury, destx);
-				auto *destptr = &dest.pix(cury, destx);
+				auto *priptr = *prirow;
+				auto *destptr = *destrow;
 				const u8 *srcptr = srcdata;
 				srcdata += dy;
 
@@ -799,9 +805,10 @@ inline void gfx_element::drawgfxzoom_core(BitmapType &dest, const rectangle &cli
 		u32 leftovers = (destendx + 1 - destx) - 4 * numblocks;
 
 		// iterate over pixels in Y
-		for (s32 cury = desty; cury <= destendy; cury++)
+		auto destrow = dest.rows(desty, destx);
+		for (s32 cury = desty; cury <= destendy; cury++, ++destrow)
 		{
-			auto *destptr = &dest.pix(cury, destx);
+			auto *destptr = *destrow;
 			const u8 *srcptr = srcdata + (srcy >> 16) * rowbytes();
 			s32 cursrcx = srcx;
 			srcy += dy;
@@ -916,10 +923,12 @@ inline void gfx_element::drawgfxzoom_core(BitmapType &dest, const rectangle &cli
 		u32 leftovers = (destendx + 1 - destx) - 4 * numblocks;
 
 		// iterate over pixels in Y
-		for (s32 cury = desty; cury <= destendy; cury++)
+		auto prirow = priority.rows(desty, destx);
+		auto destrow = dest.rows(desty, destx);
+		for (s32 cury = desty; cury <= destendy; cury++, ++destrow, ++prirow)
 		{
-			auto *priptr = &priority.pix(cury, destx);
-			auto *destptr = &dest.pix(cury, destx);
+			auto *priptr = *prirow;
+			auto *destptr = *destrow;
 			const u8 *srcptr = srcdata + (srcy >> 16) * rowbytes();
 			s32 cursrcx = srcx;
 			srcy += dy;
@@ -1048,9 +1057,10 @@ inline void copybitmap_core(BitmapType &dest, const BitmapType &src, int flipx,
 		if (!flipx)
 		{
 			// iterate over pixels in Y
-			for (s32 cury = desty; cury <= destendy; cury++)
+			auto destrow = dest.rows(desty, destx);
+			for (s32 cury = desty; cury <= destendy; cury++, ++destrow)
 			{
-				auto *destptr = &dest.pix(cury, destx);
+				auto *destptr = *destrow;
 				const auto *srcptr = srcdata;
 				srcdata += dy;
 
@@ -1080,9 +1090,10 @@ inline void copybitmap_core(BitmapType &dest, const BitmapType &src, int flipx,
 		else
 		{
 			// iterate over pixels in Y
-			for (s32 cury = desty; cury <= destendy; cury++)
+			auto destrow = dest.rows(desty, destx);
+			for (s32 cury = desty; cury <= destendy; cury++, ++destrow)
 			{
-				auto *destptr = &dest.pix(cury, destx);
+				auto *destptr = *destrow;
 				const auto *srcptr = srcdata;
 				srcdata += dy;
 
@@ -1189,10 +1200,12 @@ inline void copybitmap_core(BitmapType &dest, const BitmapType &src, int flipx,
 		if (!flipx)
 		{
 			// iterate over pixels in Y
-			for (s32 cury = desty; cury <= destendy; cury++)
+			auto prirow = priority.rows(desty, destx);
+			auto destrow = dest.rows(desty, destx);
+			for (s32 cury = desty; cury <= destendy; cury++, ++destrow, ++prirow)
 			{
-				auto *priptr = &priority.pix(cury, destx);
-				auto *destptr = &dest.pix(cury, destx);
+				auto *priptr = *prirow;
+				auto *destptr = *destrow;
 				const auto *srcptr = srcdata;
 				srcdata += dy;
 
@@ -1224,10 +1237,12 @@ inline void copybitmap_core(BitmapType &dest, const BitmapType &src, int flipx,
 		else
 		{
 			// iterate over pixels in Y
-			for (s32 cury = desty; cury <= destendy; cury++)
+			auto prirow = priority.rows(desty, destx);
+			auto destrow = dest.rows(desty, destx);
+			for (s32 cury = desty; cury <= destendy; cury++, ++destrow, ++prirow)
 			{
-				auto *priptr = &priority.pix(cury, destx);
-				auto *destptr = &dest.pix(cury, destx);
+				auto *priptr = *prirow;
+				auto *destptr = *destrow;
 				const auto *srcptr = srcdata;
 				srcdata += dy;
 
@@ -1317,9 +1332,10 @@ inline void copyrozbitmap_core(BitmapType &dest, const rectangle &cliprect, cons
 		if (!wraparound)
 		{
 			// iterate over pixels in Y
-			for (s32 cury = cliprect.top(); cury <= cliprect.bottom(); cury++)
+			auto destrow = dest.rows(cliprect.top(), cliprect.left());
+			for (s32 cury = cliprect.top(); cury <= cliprect.bottom(); cury++, ++destrow)
 			{
-				auto *destptr = &dest.pix(cury, cliprect.left());
+				auto *destptr = *destrow;
 				s32 srcx = startx;
 				s32 srcy = starty;
 
@@ -1374,9 +1390,10 @@ inline void copyrozbitmap_core(BitmapType &dest, const rectangle &cliprect, cons
 			starty &= srcfixheight;
 
 			// iterate over pixels in Y
-			for (s32 cury = cliprect.top(); cury <= cliprect.bottom(); cury++)
+			auto destrow = dest.rows(cliprect.top(), cliprect.left());
+			for (s32 cury = cliprect.top(); cury <= cliprect.bottom(); cury++, ++destrow)
 			{
-				auto *destptr = &dest.pix(cury, cliprect.left());
+				auto *destptr = *destrow;
 				const auto *srcptr = &src.pix(starty >> 16);
 				s32 srcx = startx;
 
@@ -1418,9 +1435,10 @@ inline void copyrozbitmap_core(BitmapType &dest, const rectangle &cliprect, cons
 		if (!wraparound)
 		{
 			// iterate over pixels in Y
-			for (s32 cury = cliprect.top(); cury <= cliprect.bottom(); cury++)
+			auto destrow = dest.rows(cliprect.top(), cliprect.left());
+			for (s32 cury = cliprect.top(); cury <= cliprect.bottom(); cury++, ++destrow)
 			{
-				auto *destptr = &dest.pix(cury, cliprect.left());
+				auto *destptr = *destrow;
 				s32 srcx = startx;
 				s32 srcy = starty;
 
@@ -1490,9 +1508,10 @@ inline void copyrozbitmap_core(BitmapType &dest, const rectangle &cliprect, cons
 			starty &= srcfixheight;
 
 			// iterate over pixels in Y
-			for (s32 cury = cliprect.top(); cury <= cliprect.bottom(); cury++)
+			auto destrow = dest.rows(cliprect.top(), cliprect.left());
+			for (s32 cury = cliprect.top(); cury <= cliprect.bottom(); cury++, ++destrow)
 			{
-				auto *destptr = &dest.pix(cury, cliprect.left());
+				auto *destptr = *destrow;
 				s32 srcx = startx;
 				s32 srcy = starty;
 
@@ -1579,10 +1598,12 @@ inline void copyrozbitmap_core(BitmapType &dest, const rectangle &cliprect, cons
 		if (!wraparound)
 		{
 			// iterate over pixels in Y
-			for (s32 cury = cliprect.top(); cury <= cliprect.bottom(); cury++)
+			auto prirow = priority.rows(cliprect.top(), cliprect.left());
+			auto destrow = dest.rows(cliprect.top(), cliprect.left());
+			for (s32 cury = cliprect.top(); cury <= cliprect.bottom(); cury++, ++destrow, ++prirow)
 			{
-				auto *priptr = &priority.pix(cury, cliprect.left());
-				auto *destptr = &dest.pix(cury, cliprect.left());
+				auto *priptr = *prirow;
+				auto *destptr = *destrow;
 				s32 srcx = startx;
 				s32 srcy = starty;
 
@@ -1639,10 +1660,12 @@ inline void copyrozbitmap_core(BitmapType &dest, const rectangle &cliprect, cons
 			starty &= srcfixheight;
 
 			// iterate over pixels in Y
-			for (s32 cury = cliprect.top(); cury <= cliprect.bottom(); cury++)
+			auto prirow = priority.rows(cliprect.top(), cliprect.left());
+			auto destrow = dest.rows(cliprect.top(), cliprect.left());
+			for (s32 cury = cliprect.top(); cury <= cliprect.bottom(); cury++, ++destrow, ++prirow)
 			{
-				auto *priptr = &priority.pix(cury, cliprect.left());
-				auto *destptr = &dest.pix(cury, cliprect.left());
+				auto *priptr = *prirow;
+				auto *destptr = *destrow;
 				const auto *srcptr = &src.pix(starty >> 16);
 				s32 srcx = startx;
 
@@ -1686,10 +1709,12 @@ inline void copyrozbitmap_core(BitmapType &dest, const rectangle &cliprect, cons
 		if (!wraparound)
 		{
 			// iterate over pixels in Y
-			for (s32 cury = cliprect.top(); cury <= cliprect.bottom(); cury++)
+			auto prirow = priority.rows(cliprect.top(), cliprect.left());
+			auto destrow = dest.rows(cliprect.top(), cliprect.left());
+			for (s32 cury = cliprect.top(); cury <= cliprect.bottom(); cury++, ++destrow, ++prirow)
 			{
-				auto *priptr = &priority.pix(cury, cliprect.left());
-				auto *destptr = &dest.pix(cury, cliprect.left());
+				auto *priptr = *prirow;
+				auto *destptr = *destrow;
 				s32 srcx = startx;
 				s32 srcy = starty;
 
@@ -1761,10 +1786,12 @@ inline void copyrozbitmap_core(BitmapType &dest, const rectangle &cliprect, cons
 			starty &= srcfixheight;
 
 			// iterate over pixels in Y
-			for (s32 cury = cliprect.top(); cury <= cliprect.bottom(); cury++)
+			auto prirow = priority.rows(cliprect.top(), cliprect.left());
+			auto destrow = dest.rows(cliprect.top(), cliprect.left());
+			for (s32 cury = cliprect.top(); cury <= cliprect.bottom(); cury++, ++destrow, ++prirow)
 			{
-				auto *priptr = &priority.pix(cury, cliprect.left());
-				auto *destptr = &dest.pix(cury, cliprect.left());
+				auto *priptr = *prirow;
+				auto *destptr = *destrow;
 				s32 srcx = startx;
 				s32 srcy = starty;
 
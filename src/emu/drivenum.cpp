@@ -13,6 +13,8 @@
 #include "softlist_dev.h"
 
 #include <algorithm>
+#include <future>
+#include <vector>
 
 #include <cctype>
 
@@ -80,7 +82,9 @@ driver_enumerator::driver_enumerator(emu_options &options)
 	, m_filtered_count(0)
 	, m_options(options)
 	, m_included(s_driver_count)
-	, m_config(CONFIG_CACHE_COUNT)
+	, m_config_devices(0)
+	, m_config_limit(CONFIG_CACHE_DEVICES)
+	, m_config_threads(1)
 {
 	include_all();
 }
@@ -119,12 +123,84 @@ std::shared_ptr<machine_config> const &driver_enumerator::config(std::size_t ind
 {
 	assert(index < s_driver_count);
 
-	// if we don't have it cached, add it
-	std::shared_ptr<machine_config> &config = m_config[index];
-	if (!config)
-		config = std::make_shared<machine_config>(*s_drivers_sorted[index], options);
+	// if we have it cached, make it the most recently used
+	auto const found = m_config.find(index);
+	if (found != m_config.end())
+	{
+		m_config_lru.splice(m_config_lru.end(), m_config_lru, found->second);
+		return found->second->config;
+	}
+
+	// build the configurations we're about to iterate over along with it
+	if ((1U < m_config_threads) && (int(index) == m_current))
+		prefetch_configs(index, options);
+	else
+		add_config(index, std::make_shared<machine_config>(*s_drivers_sorted[index], options));
+
+	return m_config.find(index)->second->config;
+}
+
+
+//-------------------------------------------------
+//  prefetch_configs - build configurations for
+//  the given driver and the next included drivers
+//  in parallel; each task builds one
+//  configuration and shares nothing else
+//-------------------------------------------------
+
+void driver_enumerator::prefetch_configs(std::size_t index, emu_options &options) const
+{
+	// find uncached included drivers following this one
+	std::vector<std::size_t> batch;
+	std::size_t const limit = m_config_threads * CONFIG_PREFETCH_PER_THREAD;
+	batch.reserve(limit);
+	batch.emplace_back(index);
+	for (std::size_t next = index + 1; (next < s_driver_count) && (batch.size() < limit); ++next)
+	{
+		if (m_included[next] && (m_config.find(next) == m_config.end()))
+			batch.emplace_back(next);
+	}
+
+	// build them all
+	std::vector<std::future<std::shared_ptr<machine_config> > > futures;
+	futures.reserve(batch.size());
+	for (std::size_t const driver : batch)
+	{
+		futures.emplace_back(std::async(
+				std::launch::async,
+				[driver, &options] () { return std::make_shared<machine_config>(*s_drivers_sorted[driver], options); }));
+	}
+
+	// add them so the requested configuration is most recently used and
+	// the furthest ahead is evicted first if they don't all fit
+	for (std::size_t i = batch.size(); 0 < i--; )
+		add_config(batch[i], futures[i].get());
+}
+
+
+//-------------------------------------------------
+//  add_config - add a configuration to the cache,
+//  evicting the least recently used ones until
+//  the cache is within its device limit
+//-------------------------------------------------
+
+std::shared_ptr<machine_config> const &driver_enumerator::add_config(std::size_t index, std::shared_ptr<machine_config> &&config) const
+{
+	std::size_t const devices = device_iterator(config->root_device()).count();
+
+	// never evict the configuration being added
+	while (!m_config_lru.empty() && ((m_config_devices + devices) > m_config_limit))
+	{
+		cached_config const &oldest = m_config_lru.front();
+		m_config_devices -= oldest.devices;
+		m_config.erase(oldest.index);
+		m_config_lru.pop_front();
+	}
 
-	return config;
+	m_config_devices += devices;
+	auto const inserted = m_config_lru.emplace(m_config_lru.end(), cached_config{ index, std::move(config), devices });
+	m_config.emplace(index, inserted);
+	return inserted->config;
 }
 
 
@@ -340,7 +416,7 @@ void driver_enumerator::release_current() const
 		if (cached != m_config.end())
 		{
 			// iterate over software lists in this entry and reset
-			for (software_list_device &swlistdev : software_list_device_iterator(cached->second->root_device()))
+			for (software_list_device &swlistdev : software_list_device_iterator(cached->second->config->root_device()))
 				swlistdev.release();
 		}
 	}
@@ -15,7 +15,9 @@
 
 #include <algorithm>
 #include <cassert>
+#include <list>
 #include <memory>
+#include <unordered_map>
 
 
 //**************************************************************************
@@ -121,20 +123,43 @@ public:
 	void set_current(std::size_t index) { assert(index < s_driver_count); m_current = index; }
 	void find_approximate_matches(std::string const &string, std::size_t count, int *results);
 
-private:
-	static constexpr std::size_t CONFIG_CACHE_COUNT = 100;
+	// machine configuration cache control
+	std::size_t config_cache_devices() const { return m_config_devices; }
+	void set_config_cache_limit(std::size_t devices) { m_config_limit = std::max<std::size_t>(devices, 1U); }
+	void set_config_threads(unsigned threads) { m_config_threads = std::max(threads, 1U); }
 
-	typedef util::lru_cache_map<std::size_t, std::shared_ptr<machine_config> > machine_config_cache;
+private:
+	// cached configurations are charged by device count, which tracks their
+	// memory use far better than a fixed number of configurations
+	static constexpr std::size_t CONFIG_CACHE_DEVICES = 10000;
+
+	// configurations built ahead per thread when a miss occurs while iterating
+	static constexpr std::size_t CONFIG_PREFETCH_PER_THREAD = 4;
+
+	struct cached_config
+	{
+		std::size_t                     index;
+		std::shared_ptr<machine_config> config;
+		std::size_t                     devices;
+	};
+	using machine_config_lru = std::list<cached_config>;
+	using machine_config_map = std::unordered_map<std::size_t, machine_config_lru::iterator>;
 
 	// internal helpers
 	void release_current() const;
+	void prefetch_configs(std::size_t index, emu_options &options) const;
+	std::shared_ptr<machine_config> const &add_config(std::size_t index, std::shared_ptr<machine_config> &&config) const;
 
 	// internal state
 	int                             m_current;
 	std::size_t                     m_filtered_count;
 	emu_options &                   m_options;
 	std::vector<bool>               m_included;
-	mutable machine_config_cache    m_config;
+	mutable machine_config_lru      m_config_lru;       // least recently used first
+	mutable machine_config_map      m_config;           // cached configurations by driver index
+	mutable std::size_t             m_config_devices;   // devices in cached configurations
+	std::size_t                     m_config_limit;     // device limit for cached configurations
+	unsigned                        m_config_threads;   // threads used to build configurations ahead
 };
 
 #endif // MAME_EMU_DRIVENUM_H
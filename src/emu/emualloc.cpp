@@ -205,3 +205,120 @@ void resource_pool::clear()
 	while (m_ordered_head != nullptr)
 		remove(m_ordered_head->m_ptr);
 }
+
+
+
+//**************************************************************************
+//  MACHINE ARENA
+//**************************************************************************
+
+//-------------------------------------------------
+//  machine_arena - constructor
+//-------------------------------------------------
+
+machine_arena::machine_arena()
+	: m_next(nullptr),
+		m_remaining(0),
+		m_reserved(0),
+		m_destructors(nullptr)
+{
+}
+
+
+//-------------------------------------------------
+//  ~machine_arena - destructor; destroys every
+//  object made and frees the blocks
+//-------------------------------------------------
+
+machine_arena::~machine_arena()
+{
+	clear();
+}
+
+
+//-------------------------------------------------
+//  allocate - carve out memory for one object
+//-------------------------------------------------
+
+void *machine_arena::allocate(category cat, size_t size, size_t align)
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	counters &stats = m_counters[int(cat)];
+	stats.objects++;
+	stats.bytes += size;
+	return allocate_locked(size, align);
+}
+
+
+//-------------------------------------------------
+//  allocate_locked - carve out memory with the
+//  lock held
+//-------------------------------------------------
+
+void *machine_arena::allocate_locked(size_t size, size_t align)
+{
+	if (size == 0)
+		size = 1;
+
+	// large items get a block of their own, so they don't waste the rest of the current one
+	if (size > BLOCK_SIZE / 4)
+	{
+		size_t space = size + align;
+		m_blocks.emplace_back(new osd::u8[space]);
+		m_reserved += space;
+		void *result = m_blocks.back().get();
+		return std::align(align, size, result, space);
+	}
+
+	// start a new block if it doesn't fit in this one
+	void *result = m_next;
+	if (std::align(align, size, result, m_remaining) == nullptr)
+	{
+		m_blocks.emplace_back(new osd::u8[BLOCK_SIZE]);
+		m_reserved += BLOCK_SIZE;
+		result = m_blocks.back().get();
+		m_remaining = BLOCK_SIZE;
+		std::align(align, size, result, m_remaining);
+	}
+	m_next = reinterpret_cast<osd::u8 *>(result) + size;
+	m_remaining -= size;
+	return result;
+}
+
+
+//-------------------------------------------------
+//  add_destructor - remember to destroy an object
+//  on teardown
+//-------------------------------------------------
+
+void machine_arena::add_destructor(void *object, void (*destroy)(void *))
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	destructor *const entry = new (allocate_locked(sizeof(destructor), alignof(destructor))) destructor{ m_destructors, destroy, object };
+	m_destructors = entry;
+}
+
+
+//-------------------------------------------------
+//  clear - destroy every object, latest first, and
+//  free all the memory
+//-------------------------------------------------
+
+void machine_arena::clear()
+{
+	while (m_destructors != nullptr)
+	{
+		destructor *const entry = m_destructors;
+		m_destructors = entry->prev;
+		entry->destroy(entry->object);
+	}
+
+	m_blocks.clear();
+	m_next = nullptr;
+	m_remaining = 0;
+	m_reserved = 0;
+	for (counters &stats : m_counters)
+		stats = counters();
+}
@@ -16,9 +16,13 @@
 #include "osdcore.h"
 #include "coretmpl.h"
 
+#include <cstring>
 #include <memory>
 #include <mutex>
 #include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 
 //**************************************************************************
@@ -143,4 +147,79 @@ private:
 };
 
 
+// a machine_arena hands out memory for objects that are never freed individually,
+// carving them out of large blocks and destroying them all together at teardown
+class machine_arena
+{
+private:
+	machine_arena(const machine_arena &) = delete;
+	machine_arena &operator=(const machine_arena &) = delete;
+
+public:
+	// who the memory is for, for the allocation counters
+	enum class category
+	{
+		DEVICE,
+		SAVE,
+
+		COUNT
+	};
+
+	// allocations made for one category
+	struct counters
+	{
+		size_t                  objects = 0;    // number of allocations
+		size_t                  bytes = 0;      // bytes requested
+	};
+
+	machine_arena();
+	~machine_arena();
+
+	void *allocate(category cat, size_t size, size_t align);
+	template <class ObjectClass, typename... Params> ObjectClass &make(category cat, Params &&... args)
+	{
+		ObjectClass *const object = new (allocate(cat, sizeof(ObjectClass), alignof(ObjectClass))) ObjectClass(std::forward<Params>(args)...);
+		if (!std::is_trivially_destructible<ObjectClass>::value)
+			add_destructor(object, [] (void *ptr) { reinterpret_cast<ObjectClass *>(ptr)->~ObjectClass(); });
+		return *object;
+	}
+	template <class ObjectClass, typename... Params> ObjectClass &make_clear(category cat, Params &&... args)
+	{
+		void *const ptr = allocate(cat, sizeof(ObjectClass), alignof(ObjectClass));
+		std::memset(ptr, 0, sizeof(ObjectClass));
+		ObjectClass *const object = new (ptr) ObjectClass(std::forward<Params>(args)...);
+		if (!std::is_trivially_destructible<ObjectClass>::value)
+			add_destructor(object, [] (void *ptr) { reinterpret_cast<ObjectClass *>(ptr)->~ObjectClass(); });
+		return *object;
+	}
+	void clear();
+
+	const counters &stats(category cat) const { return m_counters[int(cat)]; }
+	size_t reserved() const { return m_reserved; }
+
+private:
+	// blocks are carved up in order; anything over a quarter of one gets its own
+	static constexpr size_t BLOCK_SIZE = 64 * 1024;
+
+	// objects to destroy on teardown, allocated from the arena too
+	struct destructor
+	{
+		destructor *            prev;           // previously made object
+		void                    (*destroy)(void *);
+		void *                  object;
+	};
+
+	void *allocate_locked(size_t size, size_t align);
+	void add_destructor(void *object, void (*destroy)(void *));
+
+	std::mutex              m_lock;
+	std::vector<std::unique_ptr<osd::u8 []>> m_blocks;  // every block allocated
+	osd::u8 *               m_next;         // next free byte in the current block
+	size_t                  m_remaining;    // bytes left in the current block
+	size_t                  m_reserved;     // total bytes in all blocks
+	destructor *            m_destructors;  // most recently made object needing destruction
+	counters                m_counters[int(category::COUNT)];
+};
+
+
 #endif // MAME_EMU_EMUALLOC_H
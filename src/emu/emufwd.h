@@ -68,6 +68,9 @@ namespace util { namespace xml { class data_node; } }
 class address_map;
 class address_map_entry;
 
+// declared in audiorec.h
+class audio_recorder;
+
 // declared in bookkeeping.h
 class bookkeeping_manager;
 
@@ -154,9 +157,15 @@ class memory_share;
 // declared in emuopts.h
 class emu_options;
 
+// declared in frametiming.h
+class frame_timing_log;
+
 // declared in gamedrv.h
 class game_driver;
 
+// declared in httpmem.h
+class http_memory_feed;
+
 // declared in input.h
 class input_manager;
 
@@ -185,9 +194,15 @@ class running_machine;
 namespace emu { namespace detail { class machine_config_replace; } }
 class machine_config;
 
+// declared in memusage.h
+class memory_usage_manager;
+
 // declared in natkeyboard.h
 class natural_keyboard;
 
+// declared in netplay.h
+class netplay_manager;
+
 // declared in network.h
 class network_manager;
 
@@ -221,6 +236,8 @@ class screen_device;
 // declared in softlist.h
 class software_info;
 class software_part;
+struct software_index_entry;
+struct software_index_part;
 
 // declared in softlist_dev.h
 class software_list_device;
@@ -233,6 +250,9 @@ class sound_stream;
 // declared in speaker.h
 class speaker_device;
 
+// declared in startuptiming.h
+class startup_timing_log;
+
 // declared in tilemap.h
 class tilemap_device;
 class tilemap_manager;
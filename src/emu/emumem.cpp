@@ -596,6 +596,17 @@ public:
 		return m_root_write->get_ptr(address);
 	}
 
+	// block transfers
+	virtual void read_block(offs_t address, void *data, u32 count) override
+	{
+		memory_read_block<Width, AddrShift, Endian>(m_root_read, m_addrmask, address, static_cast<NativeType *>(data), count);
+	}
+
+	virtual void write_block(offs_t address, const void *data, u32 count) override
+	{
+		memory_write_block<Width, AddrShift, Endian>(m_root_write, m_addrmask, address, static_cast<const NativeType *>(data), count);
+	}
+
 	// native read
 	NativeType read_native(offs_t offset, NativeType mask)
 	{
@@ -1183,8 +1194,11 @@ address_space::address_space(memory_manager &manager, device_memory_interface &m
 		m_logaddrchars((m_config.logaddr_width() + 3) / 4),
 		m_notifier_id(0),
 		m_in_notification(0),
+		m_remap_depth(0),
+		m_remap_pending(0),
 		m_manager(manager)
 {
+	memset(&m_remap_stats, 0, sizeof(m_remap_stats));
 }
 
 
@@ -2325,6 +2339,47 @@ void address_space::remove_change_notifier(int id)
 	fatalerror("Unknown notifier id %d, double remove?\n", id);
 }
 
+void address_space::invalidate_caches(read_or_write mode)
+{
+	if(m_manager.m_initialized)
+		m_remap_stats.changes++;
+
+	// inside a batch, just remember what needs telling
+	if(m_remap_depth) {
+		m_remap_pending |= u32(mode);
+		m_remap_stats.deferred++;
+		return;
+	}
+
+	notify_changes(mode);
+}
+
+void address_space::notify_changes(read_or_write mode)
+{
+	if(u32(mode) & ~m_in_notification) {
+		u32 old = m_in_notification;
+		m_in_notification |= u32(mode);
+		osd_ticks_t start = osd_ticks();
+		for(const auto &n : m_notifiers)
+			n.m_notifier(mode);
+		m_remap_stats.notify_ticks += osd_ticks() - start;
+		m_remap_stats.notifications++;
+		m_in_notification = old;
+	}
+}
+
+void address_space::end_remap()
+{
+	assert(m_remap_depth > 0);
+	if(--m_remap_depth || !m_remap_pending)
+		return;
+
+	// one notification for everything the batch changed
+	read_or_write mode = read_or_write(m_remap_pending);
+	m_remap_pending = 0;
+	notify_changes(mode);
+}
+
 
 //**************************************************************************
 //  BANKING HELPERS
@@ -2422,6 +2477,7 @@ memory_block::~memory_block()
 
 memory_bank::memory_bank(address_space &space, int index, offs_t addrstart, offs_t addrend, const char *tag)
 	: m_machine(space.m_manager.machine()),
+	  m_base(nullptr),
 	  m_anonymous(tag == nullptr),
 	  m_addrstart(addrstart),
 	  m_addrend(addrend),
@@ -2440,7 +2496,10 @@ memory_bank::memory_bank(address_space &space, int index, offs_t addrstart, offs
 	}
 
 	if (!m_anonymous && machine().save().registration_allowed())
+	{
 		machine().save().save_item(&space.device(), "memory", m_tag.c_str(), 0, NAME(m_curentry));
+		machine().save().register_postload(save_prepost_delegate(FUNC(memory_bank::postload), this));
+	}
 }
 
 
@@ -2497,7 +2556,7 @@ void memory_bank::set_base(void *base)
 		m_entries.resize(1);
 		m_curentry = 0;
 	}
-	m_entries[m_curentry] = reinterpret_cast<u8 *>(base);
+	m_entries[m_curentry] = m_base = reinterpret_cast<u8 *>(base);
 	for(const auto &cb : m_alloc_notifier)
 		cb(base);
 	m_alloc_notifier.clear();
@@ -2527,7 +2586,21 @@ void memory_bank::set_entry(int entrynum)
 	if (m_entries[entrynum] == nullptr)
 		throw emu_fatalerror("memory_bank::set_entry called for bank '%s' with invalid bank entry %d", m_tag.c_str(), entrynum);
 
+	// the handlers read the base directly, so switching invalidates nothing
 	m_curentry = entrynum;
+	m_base = m_entries[entrynum];
+}
+
+
+//-------------------------------------------------
+//  postload - pick up the entry restored from a
+//  saved state
+//-------------------------------------------------
+
+void memory_bank::postload()
+{
+	if (m_curentry >= 0 && m_curentry < int(m_entries.size()))
+		m_base = m_entries[m_curentry];
 }
 
 
@@ -2547,6 +2620,8 @@ void memory_bank::configure_entry(int entrynum, void *base)
 
 	// set the entry
 	m_entries[entrynum] = reinterpret_cast<u8 *>(base);
+	if (entrynum == m_curentry)
+		m_base = m_entries[entrynum];
 }
 
 
@@ -2562,6 +2637,8 @@ void memory_bank::configure_entries(int startentry, int numentries, void *base,
 	// fill in the requested bank entries
 	for (int entrynum = 0; entrynum < numentries; entrynum ++)
 		m_entries[entrynum + startentry] = reinterpret_cast<u8 *>(base) +  entrynum * stride ;
+	if (m_curentry >= startentry && m_curentry < startentry + numentries)
+		m_base = m_entries[m_curentry];
 }
 
 
@@ -17,6 +17,7 @@
 #ifndef MAME_EMU_EMUMEM_H
 #define MAME_EMU_EMUMEM_H
 
+#include <algorithm>
 #include <type_traits>
 
 using s8 = std::int8_t;
@@ -480,6 +481,7 @@ public:
 	static constexpr u32 F_DISPATCH    = 0x00000001; // handler that forwards the access to other handlers
 	static constexpr u32 F_UNITS       = 0x00000002; // handler that merges/splits an access among multiple handlers (unitmask support)
 	static constexpr u32 F_PASSTHROUGH = 0x00000004; // handler that passes through the request to another handler
+	static constexpr u32 F_MEMORY      = 0x00000008; // handler that accesses a fixed, non-banked memory block
 
 	// Start/end of range flags
 	static constexpr u8 START = 1;
@@ -509,6 +511,7 @@ public:
 	inline bool is_dispatch() const { return m_flags & F_DISPATCH; }
 	inline bool is_units() const { return m_flags & F_UNITS; }
 	inline bool is_passthrough() const { return m_flags & F_PASSTHROUGH; }
+	inline bool is_memory() const { return m_flags & F_MEMORY; }
 
 	virtual void dump_map(std::vector<memory_entry> &map) const;
 
@@ -988,9 +991,72 @@ template<int Level, int Width, int AddrShift, endianness_t Endian> void dispatch
 }
 
 
+// ======================> Block transfers
+
+// Transfer count native units in host order, resolving the handler once per contiguous run
+// Runs backed by memory are copied directly, anything else goes through the handler per unit
+
+template<int Width, int AddrShift, endianness_t Endian> void memory_read_block(const handler_entry_read<Width, AddrShift, Endian> *root, offs_t addrmask, offs_t address, typename emu::detail::handler_entry_size<Width>::uX *data, u32 count)
+{
+	using NativeType = typename emu::detail::handler_entry_size<Width>::uX;
+	constexpr u32 NATIVE_BYTES = 1 << Width;
+	constexpr u32 NATIVE_STEP = AddrShift >= 0 ? NATIVE_BYTES << iabs(AddrShift) : NATIVE_BYTES >> iabs(AddrShift);
+	constexpr u32 NATIVE_MASK = Width + AddrShift >= 0 ? (1 << (Width + AddrShift)) - 1 : 0;
+
+	while(count) {
+		address &= addrmask & ~NATIVE_MASK;
+		offs_t start, end;
+		handler_entry_read<Width, AddrShift, Endian> *handler;
+		root->lookup(address, start, end, handler);
+
+		u64 avail = (u64(end) - address) / NATIVE_STEP + 1;
+		u32 run = count < avail ? count : u32(avail);
+		const void *ptr = handler->get_ptr(address);
+		if(ptr)
+			memcpy(data, ptr, run * sizeof(NativeType));
+		else
+			for(u32 i = 0; i != run; i++)
+				data[i] = handler->read(address + i * NATIVE_STEP, NativeType(0xffffffffffffffffU));
+
+		data += run;
+		count -= run;
+		address += run * NATIVE_STEP;
+	}
+}
+
+template<int Width, int AddrShift, endianness_t Endian> void memory_write_block(const handler_entry_write<Width, AddrShift, Endian> *root, offs_t addrmask, offs_t address, const typename emu::detail::handler_entry_size<Width>::uX *data, u32 count)
+{
+	using NativeType = typename emu::detail::handler_entry_size<Width>::uX;
+	constexpr u32 NATIVE_BYTES = 1 << Width;
+	constexpr u32 NATIVE_STEP = AddrShift >= 0 ? NATIVE_BYTES << iabs(AddrShift) : NATIVE_BYTES >> iabs(AddrShift);
+	constexpr u32 NATIVE_MASK = Width + AddrShift >= 0 ? (1 << (Width + AddrShift)) - 1 : 0;
+
+	while(count) {
+		address &= addrmask & ~NATIVE_MASK;
+		offs_t start, end;
+		handler_entry_write<Width, AddrShift, Endian> *handler;
+		root->lookup(address, start, end, handler);
+
+		u64 avail = (u64(end) - address) / NATIVE_STEP + 1;
+		u32 run = count < avail ? count : u32(avail);
+		void *ptr = handler->get_ptr(address);
+		if(ptr)
+			memcpy(ptr, data, run * sizeof(NativeType));
+		else
+			for(u32 i = 0; i != run; i++)
+				handler->write(address + i * NATIVE_STEP, data[i], NativeType(0xffffffffffffffffU));
+
+		data += run;
+		count -= run;
+		address += run * NATIVE_STEP;
+	}
+}
+
+
 // ======================> memory_access_specific
 
 // memory_access_specific does uncached but faster accesses by shortcutting the address_space virtual call
+// Reads that hit fixed ram/rom go through a small flat region table and skip the dispatch entirely
 
 namespace emu { namespace detail {
 
@@ -1001,6 +1067,14 @@ template<int Level, int Width, int AddrShift, endianness_t Endian> class memory_
 	using NativeType = typename emu::detail::handler_entry_size<Width>::uX;
 	static constexpr u32 NATIVE_BYTES = 1 << Width;
 	static constexpr u32 NATIVE_MASK = Width + AddrShift >= 0 ? (1 << (Width + AddrShift)) - 1 : 0;
+	static constexpr u32 FLAT_REGIONS = 8;
+
+	// a contiguous range of the space backed by fixed memory
+	struct flat_region {
+		offs_t start;
+		offs_t end;
+		const NativeType *base;
+	};
 
 public:
 	// construction/destruction
@@ -1008,7 +1082,11 @@ public:
 		: m_space(nullptr),
 		  m_addrmask(0),
 		  m_dispatch_read(nullptr),
-		  m_dispatch_write(nullptr)
+		  m_dispatch_write(nullptr),
+		  m_root_read(nullptr),
+		  m_flat_count(0),
+		  m_flat_dirty(true),
+		  m_notifier_id(-1)
 	{
 	}
 
@@ -1052,15 +1130,31 @@ private:
 	const handler_entry_read<Width, AddrShift, Endian> *const *m_dispatch_read;
 	const handler_entry_write<Width, AddrShift, Endian> *const *m_dispatch_write;
 
+	const handler_entry_read<Width, AddrShift, Endian> *m_root_read; // decode tree root, for rebuilding the flat table
+
+	flat_region                 m_flat[FLAT_REGIONS];      // fixed memory regions, largest first
+	u32                         m_flat_count;              // number of valid regions
+	bool                        m_flat_dirty;              // map changed since the table was built
+	int                         m_notifier_id;             // change notifier registration
+
 	NativeType read_native(offs_t address, NativeType mask = ~NativeType(0)) {
-		return dispatch_read<Level, Width, AddrShift, Endian>(offs_t(-1), address & m_addrmask, mask, m_dispatch_read);;
+		address &= m_addrmask;
+		for(u32 i = 0; i != m_flat_count; i++)
+			if(address >= m_flat[i].start && address <= m_flat[i].end)
+				return m_flat[i].base[(address - m_flat[i].start) >> (Width + AddrShift)];
+		if(m_flat_dirty)
+			return read_native_rebuild(address, mask);
+		return dispatch_read<Level, Width, AddrShift, Endian>(offs_t(-1), address, mask, m_dispatch_read);
 	}
 
+	NativeType read_native_rebuild(offs_t address, NativeType mask);
+	void rebuild_flat();
+
 	void write_native(offs_t address, NativeType data, NativeType mask = ~NativeType(0)) {
 		dispatch_write<Level, Width, AddrShift, Endian>(offs_t(-1), address & m_addrmask, data, mask, m_dispatch_write);;
 	}
 
-	void set(address_space *space, std::pair<const void *, const void *> rw);
+	void set(address_space *space, std::pair<const void *, const void *> rw, const void *root);
 };
 
 
@@ -1147,6 +1241,10 @@ public:
 	void write_qword_unaligned(offs_t address, u64 data) { memory_write_generic<Width, AddrShift, Endian, 3, false>([this](offs_t offset, NativeType data, NativeType mask) { write_native(offset, data, mask); }, address, data, 0xffffffffffffffffU); }
 	void write_qword_unaligned(offs_t address, u64 data, u64 mask) { memory_write_generic<Width, AddrShift, Endian, 3, false>([this](offs_t offset, NativeType data, NativeType mask) { write_native(offset, data, mask); }, address, data, mask); }
 
+	// block accessors, count native units in host order
+	void read_block(offs_t address, void *data, u32 count) { memory_read_block<Width, AddrShift, Endian>(m_root_read, m_addrmask, address, static_cast<NativeType *>(data), count); }
+	void write_block(offs_t address, const void *data, u32 count) { memory_write_block<Width, AddrShift, Endian>(m_root_write, m_addrmask, address, static_cast<const NativeType *>(data), count); }
+
 private:
 	address_space *             m_space;
 
@@ -1279,21 +1377,39 @@ public:
 			fatalerror("Requesting spefific() with endianness %s while the config says %s\n",
 					   endianness_names[Endian], endianness_names[m_config.endianness()]);
 
-		v.set(this, get_specific_info());
+		v.set(this, get_specific_info(), get_cache_info().first);
 	}
 
 	int add_change_notifier(std::function<void (read_or_write)> n);
 	void remove_change_notifier(int id);
 
-	void invalidate_caches(read_or_write mode) {
-		if(u32(mode) & ~m_in_notification) {
-			u32 old = m_in_notification;
-			m_in_notification |= u32(mode);
-			for(const auto &n : m_notifiers)
-				n.m_notifier(mode);
-			m_in_notification = old;
-		}
-	}
+	void invalidate_caches(read_or_write mode);
+
+	// map changes made between begin_remap and end_remap notify the caches and
+	// change notifiers once, at the end; nothing may access the space in between
+	void begin_remap() { m_remap_depth++; }
+	void end_remap();
+
+	// calls begin_remap and end_remap for a scope
+	class remap_batch
+	{
+	public:
+		remap_batch(address_space &space) : m_space(space) { m_space.begin_remap(); }
+		~remap_batch() { m_space.end_remap(); }
+
+	private:
+		address_space &m_space;
+	};
+
+	// what changing the map has cost
+	struct remap_statistics
+	{
+		u64                     changes;            // installs and unmaps made after startup
+		u64                     notifications;      // times the change notifiers were called
+		u64                     deferred;           // changes whose notification waited for the end of a batch
+		osd_ticks_t             notify_ticks;       // time spent in the change notifiers
+	};
+	const remap_statistics &remap_stats() const { return m_remap_stats; }
 
 	virtual void validate_reference_counts() const = 0;
 
@@ -1324,6 +1440,10 @@ public:
 	virtual void *get_read_ptr(offs_t address) const = 0;
 	virtual void *get_write_ptr(offs_t address) const = 0;
 
+	// block accessors, count native units in host order, resolved once per contiguous run
+	virtual void read_block(offs_t address, void *data, u32 count) = 0;
+	virtual void write_block(offs_t address, const void *data, u32 count) = 0;
+
 	// read accessors
 	virtual u8 read_byte(offs_t address) = 0;
 	virtual u16 read_word(offs_t address) = 0;
@@ -1605,6 +1725,7 @@ protected:
 	virtual std::pair<void *, void *> get_cache_info() = 0;
 	virtual std::pair<const void *, const void *> get_specific_info() = 0;
 
+	void notify_changes(read_or_write mode);
 	void populate_map_entry(const address_map_entry &entry, read_or_write readorwrite);
 	virtual void unmap_generic(offs_t addrstart, offs_t addrend, offs_t addrmirror, read_or_write readorwrite, bool quiet) = 0;
 	virtual void install_ram_generic(offs_t addrstart, offs_t addrend, offs_t addrmirror, read_or_write readorwrite, void *baseptr) = 0;
@@ -1643,6 +1764,9 @@ protected:
 	std::vector<notifier_t> m_notifiers;        // notifier list for address map change
 	int                     m_notifier_id;      // next notifier id
 	u32                     m_in_notification;  // notification(s) currently being done
+	int                     m_remap_depth;      // begin_remap calls not yet ended
+	u32                     m_remap_pending;    // notification(s) deferred to the end of the batch
+	remap_statistics        m_remap_stats;      // what changing the map has cost
 	memory_manager &        m_manager;          // reference to the owning manager
 };
 
@@ -1721,7 +1845,7 @@ public:
 	int entry() const { return m_curentry; }
 	bool anonymous() const { return m_anonymous; }
 	offs_t addrstart() const { return m_addrstart; }
-	void *base() const { return m_entries.empty() ? nullptr : m_entries[m_curentry]; }
+	void *base() const { return m_base; }
 	const char *tag() const { return m_tag.c_str(); }
 	const char *name() const { return m_name.c_str(); }
 
@@ -1745,8 +1869,11 @@ public:
 	void add_notifier(std::function<void (void *)> cb);
 
 private:
+	void postload();
+
 	// internal state
 	running_machine &       m_machine;              // need the machine to free our memory
+	u8 *                    m_base;                 // current entry, read directly by the handlers
 	std::vector<u8 *>       m_entries;              // the entries
 	bool                    m_anonymous;            // are we anonymous or explicit?
 	offs_t                  m_addrstart;            // start offset
@@ -1967,14 +2094,67 @@ void memory_passthrough_handler::remove()
 
 template<int Level, int Width, int AddrShift, endianness_t Endian>
 void emu::detail::memory_access_specific<Level, Width, AddrShift, Endian>::
-set(address_space *space, std::pair<const void *, const void *> rw)
+set(address_space *space, std::pair<const void *, const void *> rw, const void *root)
 {
+	if(m_space && m_notifier_id != -1)
+		m_space->remove_change_notifier(m_notifier_id);
+
 	m_space = space;
 	m_addrmask = space->addrmask();
 	m_dispatch_read  = (const handler_entry_read <Width, AddrShift, Endian> *const *)(rw.first);
 	m_dispatch_write = (const handler_entry_write<Width, AddrShift, Endian> *const *)(rw.second);
+	m_root_read = (const handler_entry_read<Width, AddrShift, Endian> *)(root);
+
+	// The table is rebuilt lazily, on the first read after a change to the map
+	m_flat_count = 0;
+	m_flat_dirty = true;
+	m_notifier_id = space->add_change_notifier([this](read_or_write mode) {
+													if(u32(mode) & u32(read_or_write::READ)) {
+														m_flat_count = 0;
+														m_flat_dirty = true;
+													}
+												});
+}
+
+template<int Level, int Width, int AddrShift, endianness_t Endian>
+typename emu::detail::handler_entry_size<Width>::uX
+emu::detail::memory_access_specific<Level, Width, AddrShift, Endian>::
+read_native_rebuild(offs_t address, typename emu::detail::handler_entry_size<Width>::uX mask)
+{
+	rebuild_flat();
+	return read_native(address, mask);
 }
 
+template<int Level, int Width, int AddrShift, endianness_t Endian>
+void emu::detail::memory_access_specific<Level, Width, AddrShift, Endian>::
+rebuild_flat()
+{
+	m_flat_count = 0;
+	m_flat_dirty = false;
+
+	std::vector<memory_entry> map;
+	m_root_read->dump_map(map);
+
+	// Gather the fixed memory ranges, merging neighbours that continue the same block
+	std::vector<flat_region> regions;
+	for(const memory_entry &e : map) {
+		if(!e.entry->is_memory())
+			continue;
+		auto const base = static_cast<const NativeType *>(static_cast<const handler_entry_read<Width, AddrShift, Endian> *>(e.entry)->get_ptr(e.start));
+		if(!regions.empty() && regions.back().end + 1 == e.start && regions.back().base + ((e.start - regions.back().start) >> (Width + AddrShift)) == base)
+			regions.back().end = e.end;
+		else
+			regions.emplace_back(flat_region{ e.start, e.end, base });
+	}
+
+	// Keep the largest ones, bigger regions are the likelier hits
+	std::stable_sort(regions.begin(), regions.end(), [](const flat_region &a, const flat_region &b) { return a.end - a.start > b.end - b.start; });
+	for(const flat_region &r : regions) {
+		if(m_flat_count == FLAT_REGIONS)
+			break;
+		m_flat[m_flat_count++] = r;
+	}
+}
 
 template<int Width, int AddrShift, endianness_t Endian>
 void emu::detail::memory_access_cache<Width, AddrShift, Endian>::
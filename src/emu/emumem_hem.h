@@ -11,7 +11,7 @@ public:
 	using uX = typename emu::detail::handler_entry_size<Width>::uX;
 	using inh = handler_entry_read_address<Width, AddrShift, Endian>;
 
-	handler_entry_read_memory(address_space *space) : handler_entry_read_address<Width, AddrShift, Endian>(space, 0) {}
+	handler_entry_read_memory(address_space *space) : handler_entry_read_address<Width, AddrShift, Endian>(space, inh::F_MEMORY) {}
 	~handler_entry_read_memory() = default;
 
 	uX read(offs_t offset, uX mem_mask) const override;
@@ -31,7 +31,7 @@ public:
 	using uX = typename emu::detail::handler_entry_size<Width>::uX;
 	using inh = handler_entry_write_address<Width, AddrShift, Endian>;
 
-	handler_entry_write_memory(address_space *space) : handler_entry_write_address<Width, AddrShift, Endian>(space, 0) {}
+	handler_entry_write_memory(address_space *space) : handler_entry_write_address<Width, AddrShift, Endian>(space, inh::F_MEMORY) {}
 	~handler_entry_write_memory() = default;
 
 	void write(offs_t offset, uX data, uX mem_mask) const override;
@@ -57,6 +57,8 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SNAPSHOT_DIRECTORY,                         "snap",      OPTION_STRING,     "directory to save/load screenshots" },
 	{ OPTION_DIFF_DIRECTORY,                             "diff",      OPTION_STRING,     "directory to save hard drive image difference files" },
 	{ OPTION_COMMENT_DIRECTORY,                          "comments",  OPTION_STRING,     "directory to save debugger comments" },
+	{ OPTION_HASH_CACHE,                                 nullptr,     OPTION_STRING,     "database to cache ROM hashes in, skipping rehashing of unchanged files (empty to disable)" },
+	{ OPTION_SWINDEX_DIRECTORY,                          "swindex",   OPTION_STRING,     "directory to save software list indexes (empty to disable)" },
 
 	// state/playback options
 	{ nullptr,                                           nullptr,     OPTION_HEADER,     "CORE STATE/PLAYBACK OPTIONS" },
@@ -64,6 +66,7 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_AUTOSAVE,                                   "0",         OPTION_BOOLEAN,    "automatically restore state on start and save on exit for supported systems" },
 	{ OPTION_REWIND,                                     "0",         OPTION_BOOLEAN,    "enable rewind savestates" },
 	{ OPTION_REWIND_CAPACITY "(1-2048)",                 "100",       OPTION_INTEGER,    "rewind buffer size in megabytes" },
+	{ OPTION_RUNAHEAD "(0-4)",                           "0",         OPTION_INTEGER,    "number of frames to emulate ahead of the one shown, hiding built-in input lag (set per system in its INI file)" },
 	{ OPTION_PLAYBACK ";pb",                             nullptr,     OPTION_STRING,     "playback an input file" },
 	{ OPTION_RECORD ";rec",                              nullptr,     OPTION_STRING,     "record an input file" },
 	{ OPTION_RECORD_TIMECODE,                            "0",         OPTION_BOOLEAN,    "record an input timecode file (requires -record option)" },
@@ -71,11 +74,16 @@ const options_entry emu_options::s_option_entries[] =
 
 	{ OPTION_MNGWRITE,                                   nullptr,     OPTION_STRING,     "optional filename to write a MNG movie of the current session" },
 	{ OPTION_AVIWRITE,                                   nullptr,     OPTION_STRING,     "optional filename to write an AVI movie of the current session" },
+	{ OPTION_Y4MWRITE,                                   nullptr,     OPTION_STRING,     "optional file, pipe or socket.host:port to stream uncompressed YUV4MPEG2 video of the current session" },
+	{ OPTION_PCMWRITE,                                   nullptr,     OPTION_STRING,     "optional file, pipe or socket.host:port to stream raw 16-bit stereo PCM audio of the current session" },
 	{ OPTION_WAVWRITE,                                   nullptr,     OPTION_STRING,     "optional filename to write a WAV file of the current session" },
 	{ OPTION_SNAPNAME,                                   "%g/%i",     OPTION_STRING,     "override of the default snapshot/movie naming; %g == gamename, %i == index" },
 	{ OPTION_SNAPSIZE,                                   "auto",      OPTION_STRING,     "specify snapshot/movie resolution (<width>x<height>) or 'auto' to use minimal size " },
 	{ OPTION_SNAPVIEW,                                   "internal",  OPTION_STRING,     "specify snapshot/movie view or 'internal' to use internal pixel-aspect views" },
 	{ OPTION_SNAPBILINEAR,                               "1",         OPTION_BOOLEAN,    "specify if the snapshot/movie should have bilinear filtering applied" },
+	{ OPTION_SNAPFAST,                                   "0",         OPTION_BOOLEAN,    "write snapshots and MNG movies with fast PNG compression, giving somewhat larger files" },
+	{ OPTION_MOVIEQUEUE,                                 "8",         OPTION_INTEGER,    "number of movie frames to queue for encoding on a separate thread, or 0 to encode in the emulation thread" },
+	{ OPTION_MOVIEDROP,                                  "0",         OPTION_BOOLEAN,    "repeat the previous movie frame instead of waiting when the encoder falls behind" },
 	{ OPTION_STATENAME,                                  "%g",        OPTION_STRING,     "override of the default state subfolder naming; %g == gamename" },
 	{ OPTION_BURNIN,                                     "0",         OPTION_BOOLEAN,    "create burn-in snapshots for each screen" },
 
@@ -89,6 +97,13 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SPEED "(0.01-100)",                         "1.0",       OPTION_FLOAT,      "controls the speed of gameplay, relative to realtime; smaller numbers are slower" },
 	{ OPTION_REFRESHSPEED ";rs",                         "0",         OPTION_BOOLEAN,    "automatically adjust emulation speed to keep the emulated refresh rate slower than the host screen" },
 	{ OPTION_LOWLATENCY ";lolat",                        "0",         OPTION_BOOLEAN,    "draws new frame before throttling to reduce input latency" },
+	{ OPTION_LATEINPUT,                                  "0",         OPTION_BOOLEAN,    "poll input when the system first reads it each frame rather than at the end of the previous frame; ignored while recording, playing back, running ahead or in a netplay session" },
+	{ OPTION_FRAMEPACING,                                "0",         OPTION_BOOLEAN,    "with -waitvsync, delay emulating each frame so it finishes just before the next vertical blank; needs a display refresh rate within 1% of the system's" },
+	{ OPTION_VRR,                                        "0",         OPTION_BOOLEAN,    "present each frame as soon as it is due, for displays with variable refresh rate (G-Sync, FreeSync); implies -waitvsync" },
+	{ OPTION_ADAPTIVE_QUANTUM,                           "0",         OPTION_BOOLEAN,    "only apply perfect interleave while CPUs are seen contending for shared memory" },
+	{ OPTION_TILEMAP_BANDS "(0-16)",                     "0",         OPTION_INTEGER,    "split each tilemap draw into this many horizontal bands drawn in parallel; 0 or 1 draws serially" },
+	{ OPTION_SPRITE_BANDS "(0-16)",                      "0",         OPTION_INTEGER,    "split each batched sprite list draw into this many horizontal bands drawn in parallel; 0 or 1 draws serially" },
+	{ OPTION_RENDER_BANDS "(0-16)",                      "0",         OPTION_INTEGER,    "split software rendering of snapshots, movies and software video modes into this many horizontal bands drawn in parallel; 0 or 1 draws serially" },
 
 	// render options
 	{ nullptr,                                           nullptr,     OPTION_HEADER,     "CORE RENDER OPTIONS" },
@@ -179,6 +194,10 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_UPDATEINPAUSE,                              "0",         OPTION_BOOLEAN,    "keep calling video updates while in pause" },
 	{ OPTION_DEBUGSCRIPT,                                nullptr,     OPTION_STRING,     "script for debugger" },
 	{ OPTION_DEBUGLOG,                                   "0",         OPTION_BOOLEAN,    "write debug console output to debug.log" },
+	{ OPTION_SCHEDSTATS,                                 nullptr,     OPTION_STRING,     "write per-device scheduler statistics to the given .json or .csv file on exit" },
+	{ OPTION_BENCHLOG,                                   nullptr,     OPTION_STRING,     "write per-frame timing to the given file as JSON lines, followed by a summary on exit" },
+	{ OPTION_BENCHWARMUP,                                "0",         OPTION_FLOAT,      "number of emulated seconds to leave out of the -benchlog timing" },
+	{ OPTION_STARTUPLOG,                                 nullptr,     OPTION_STRING,     "write the host time taken by each startup phase and device to the given file as Chrome trace-event JSON" },
 
 	// comm options
 	{ nullptr,                                           nullptr,     OPTION_HEADER,     "CORE COMM OPTIONS" },
@@ -194,6 +213,10 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_DRC_USE_C,                                  "0",         OPTION_BOOLEAN,    "force DRC to use C backend" },
 	{ OPTION_DRC_LOG_UML,                                "0",         OPTION_BOOLEAN,    "write DRC UML disassembly log" },
 	{ OPTION_DRC_LOG_NATIVE,                             "0",         OPTION_BOOLEAN,    "write DRC native disassembly log" },
+	{ OPTION_DRC_PERSIST,                                "0",         OPTION_BOOLEAN,    "remember compiled DRC blocks in the NVRAM directory and precompile them on the next run" },
+	{ OPTION_DRC_BACKGROUND,                             "0",         OPTION_BOOLEAN,    "generate DRC code on a worker thread, interpreting meanwhile where the CPU core supports it" },
+	{ OPTION_DRC_CACHE_SIZE "(0-1024)",                  "0",         OPTION_INTEGER,    "size of each DRC code cache in megabytes, or 0 to use the CPU core's default" },
+	{ OPTION_DRC_IDLE_SKIP,                              "1",         OPTION_BOOLEAN,    "let DRC CPU cores give up the rest of the timeslice in loops that only poll memory" },
 	{ OPTION_BIOS,                                       nullptr,     OPTION_STRING,     "select the system BIOS to use" },
 	{ OPTION_CHEAT ";c",                                 "0",         OPTION_BOOLEAN,    "enable cheat subsystem" },
 	{ OPTION_SKIP_GAMEINFO,                              "0",         OPTION_BOOLEAN,    "skip displaying the system information screen at startup" },
@@ -204,6 +227,9 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_UI_MOUSE,                                   "1",         OPTION_BOOLEAN,    "display UI mouse cursor" },
 	{ OPTION_LANGUAGE ";lang",                           "English",   OPTION_STRING,     "set UI display language" },
 	{ OPTION_NVRAM_SAVE ";nvwrite",                      "1",         OPTION_BOOLEAN,    "save NVRAM data on exit" },
+	{ OPTION_NVRAM_CHECKPOINT,                           "60",        OPTION_INTEGER,    "also save changed NVRAM this often while running, in seconds (0 = only on exit)" },
+	{ OPTION_PARALLEL_START,                             "1",         OPTION_BOOLEAN,    "let devices build their startup tables on worker threads while other devices start" },
+	{ OPTION_WARM_RESTART,                               "0",         OPTION_BOOLEAN,    "hard reset by restoring the state from just after startup, keeping ROMs, graphics and compiled code, where the system supports save states" },
 
 	{ nullptr,                                           nullptr,     OPTION_HEADER,     "SCRIPTING OPTIONS" },
 	{ OPTION_AUTOBOOT_COMMAND ";ab",                     nullptr,     OPTION_STRING,     "command to execute after machine boot" },
@@ -218,6 +244,13 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_HTTP,                                       "0",         OPTION_BOOLEAN,    "enable HTTP server" },
 	{ OPTION_HTTP_PORT,                                  "8080",      OPTION_INTEGER,    "HTTP server port" },
 	{ OPTION_HTTP_ROOT,                                  "web",       OPTION_STRING,     "HTTP server document root" },
+	{ OPTION_SERVER,                                     "0",         OPTION_BOOLEAN,    "keep running when a system exits, and accept /api/launch requests over HTTP" },
+
+	{ nullptr,                                           nullptr,     OPTION_HEADER,     "NETPLAY OPTIONS" },
+	{ OPTION_NETPLAY_LISTEN "(0-65535)",                 "0",         OPTION_INTEGER,    "TCP port to wait for a netplay peer on, or 0 to disable" },
+	{ OPTION_NETPLAY_CONNECT,                            nullptr,     OPTION_STRING,     "host:port of a netplay peer to connect to" },
+	{ OPTION_NETPLAY_DELAY "(1-15)",                     "2",         OPTION_INTEGER,    "frames of delay applied to local input during netplay" },
+	{ OPTION_NETPLAY_ROLLBACK "(1-30)",                  "8",         OPTION_INTEGER,    "maximum number of frames to roll back when remote input was mispredicted" },
 
 	{ nullptr }
 };
@@ -793,9 +826,9 @@ std::string emu_options::get_default_card_software(device_slot_interface &slot)
 	{
 		image_path = image_option(image->instance_name()).value();
 
-		get_hashfile_extrainfo = [image, this](util::core_file &file, std::string &extrainfo)
+		get_hashfile_extrainfo = [image, image_path, this](util::core_file &file, std::string &extrainfo)
 		{
-			util::hash_collection hashes = image->calculate_hash_on_file(file);
+			util::hash_collection hashes = image->calculate_hash_on_file(file, image_path);
 
 			return hashfile_extrainfo(
 					hash_path(),
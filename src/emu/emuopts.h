@@ -47,23 +47,31 @@
 #define OPTION_SNAPSHOT_DIRECTORY   "snapshot_directory"
 #define OPTION_DIFF_DIRECTORY       "diff_directory"
 #define OPTION_COMMENT_DIRECTORY    "comment_directory"
+#define OPTION_HASH_CACHE           "hash_cache"
+#define OPTION_SWINDEX_DIRECTORY    "swindex_directory"
 
 // core state/playback options
 #define OPTION_STATE                "state"
 #define OPTION_AUTOSAVE             "autosave"
 #define OPTION_REWIND               "rewind"
 #define OPTION_REWIND_CAPACITY      "rewind_capacity"
+#define OPTION_RUNAHEAD             "runahead"
 #define OPTION_PLAYBACK             "playback"
 #define OPTION_RECORD               "record"
 #define OPTION_RECORD_TIMECODE      "record_timecode"
 #define OPTION_EXIT_AFTER_PLAYBACK  "exit_after_playback"
 #define OPTION_MNGWRITE             "mngwrite"
 #define OPTION_AVIWRITE             "aviwrite"
+#define OPTION_Y4MWRITE             "y4mwrite"
+#define OPTION_PCMWRITE             "pcmwrite"
 #define OPTION_WAVWRITE             "wavwrite"
 #define OPTION_SNAPNAME             "snapname"
 #define OPTION_SNAPSIZE             "snapsize"
 #define OPTION_SNAPVIEW             "snapview"
 #define OPTION_SNAPBILINEAR         "snapbilinear"
+#define OPTION_SNAPFAST             "snapfast"
+#define OPTION_MOVIEQUEUE           "moviequeue"
+#define OPTION_MOVIEDROP            "moviedrop"
 #define OPTION_STATENAME            "statename"
 #define OPTION_BURNIN               "burnin"
 
@@ -76,6 +84,13 @@
 #define OPTION_SPEED                "speed"
 #define OPTION_REFRESHSPEED         "refreshspeed"
 #define OPTION_LOWLATENCY           "lowlatency"
+#define OPTION_LATEINPUT            "lateinput"
+#define OPTION_FRAMEPACING          "framepacing"
+#define OPTION_VRR                  "vrr"
+#define OPTION_ADAPTIVE_QUANTUM     "adaptive_quantum"
+#define OPTION_TILEMAP_BANDS        "tilemap_bands"
+#define OPTION_SPRITE_BANDS         "sprite_bands"
+#define OPTION_RENDER_BANDS         "render_bands"
 
 // core render options
 #define OPTION_KEEPASPECT           "keepaspect"
@@ -157,12 +172,20 @@
 #define OPTION_UPDATEINPAUSE        "update_in_pause"
 #define OPTION_DEBUGSCRIPT          "debugscript"
 #define OPTION_DEBUGLOG             "debuglog"
+#define OPTION_SCHEDSTATS           "schedstats"
+#define OPTION_BENCHLOG             "benchlog"
+#define OPTION_BENCHWARMUP          "benchwarmup"
+#define OPTION_STARTUPLOG           "startuplog"
 
 // core misc options
 #define OPTION_DRC                  "drc"
 #define OPTION_DRC_USE_C            "drc_use_c"
 #define OPTION_DRC_LOG_UML          "drc_log_uml"
 #define OPTION_DRC_LOG_NATIVE       "drc_log_native"
+#define OPTION_DRC_PERSIST          "drc_persist"
+#define OPTION_DRC_BACKGROUND       "drc_background"
+#define OPTION_DRC_CACHE_SIZE       "drc_cache_size"
+#define OPTION_DRC_IDLE_SKIP        "drc_idle_skip"
 #define OPTION_BIOS                 "bios"
 #define OPTION_CHEAT                "cheat"
 #define OPTION_SKIP_GAMEINFO        "skip_gameinfo"
@@ -170,6 +193,9 @@
 #define OPTION_UI                   "ui"
 #define OPTION_RAMSIZE              "ramsize"
 #define OPTION_NVRAM_SAVE           "nvram_save"
+#define OPTION_NVRAM_CHECKPOINT     "nvram_checkpoint"
+#define OPTION_PARALLEL_START       "parallel_start"
+#define OPTION_WARM_RESTART         "warm_restart"
 
 // core comm options
 #define OPTION_COMM_LOCAL_HOST      "comm_localhost"
@@ -195,6 +221,12 @@
 #define OPTION_HTTP                 "http"
 #define OPTION_HTTP_PORT            "http_port"
 #define OPTION_HTTP_ROOT            "http_root"
+#define OPTION_SERVER               "server"
+
+#define OPTION_NETPLAY_LISTEN       "netplay_listen"
+#define OPTION_NETPLAY_CONNECT      "netplay_connect"
+#define OPTION_NETPLAY_DELAY        "netplay_delay"
+#define OPTION_NETPLAY_ROLLBACK     "netplay_rollback"
 
 //**************************************************************************
 //  TYPE DEFINITIONS
@@ -328,23 +360,31 @@ public:
 	const char *snapshot_directory() const { return value(OPTION_SNAPSHOT_DIRECTORY); }
 	const char *diff_directory() const { return value(OPTION_DIFF_DIRECTORY); }
 	const char *comment_directory() const { return value(OPTION_COMMENT_DIRECTORY); }
+	const char *hash_cache() const { return value(OPTION_HASH_CACHE); }
+	const char *swindex_directory() const { return value(OPTION_SWINDEX_DIRECTORY); }
 
 	// core state/playback options
 	const char *state() const { return value(OPTION_STATE); }
 	bool autosave() const { return bool_value(OPTION_AUTOSAVE); }
 	int rewind() const { return bool_value(OPTION_REWIND); }
 	int rewind_capacity() const { return int_value(OPTION_REWIND_CAPACITY); }
+	int runahead() const { return int_value(OPTION_RUNAHEAD); }
 	const char *playback() const { return value(OPTION_PLAYBACK); }
 	const char *record() const { return value(OPTION_RECORD); }
 	bool record_timecode() const { return bool_value(OPTION_RECORD_TIMECODE); }
 	bool exit_after_playback() const { return bool_value(OPTION_EXIT_AFTER_PLAYBACK); }
 	const char *mng_write() const { return value(OPTION_MNGWRITE); }
 	const char *avi_write() const { return value(OPTION_AVIWRITE); }
+	const char *y4m_write() const { return value(OPTION_Y4MWRITE); }
+	const char *pcm_write() const { return value(OPTION_PCMWRITE); }
 	const char *wav_write() const { return value(OPTION_WAVWRITE); }
 	const char *snap_name() const { return value(OPTION_SNAPNAME); }
 	const char *snap_size() const { return value(OPTION_SNAPSIZE); }
 	const char *snap_view() const { return value(OPTION_SNAPVIEW); }
 	bool snap_bilinear() const { return bool_value(OPTION_SNAPBILINEAR); }
+	bool snap_fast() const { return bool_value(OPTION_SNAPFAST); }
+	int movie_queue() const { return int_value(OPTION_MOVIEQUEUE); }
+	bool movie_drop() const { return bool_value(OPTION_MOVIEDROP); }
 	const char *state_name() const { return value(OPTION_STATENAME); }
 	bool burnin() const { return bool_value(OPTION_BURNIN); }
 
@@ -357,6 +397,13 @@ public:
 	float speed() const { return float_value(OPTION_SPEED); }
 	bool refresh_speed() const { return m_refresh_speed; }
 	bool low_latency() const { return bool_value(OPTION_LOWLATENCY); }
+	bool late_input() const { return bool_value(OPTION_LATEINPUT); }
+	bool frame_pacing() const { return bool_value(OPTION_FRAMEPACING); }
+	bool vrr() const { return bool_value(OPTION_VRR); }
+	bool adaptive_quantum() const { return bool_value(OPTION_ADAPTIVE_QUANTUM); }
+	int tilemap_bands() const { return int_value(OPTION_TILEMAP_BANDS); }
+	int sprite_bands() const { return int_value(OPTION_SPRITE_BANDS); }
+	int render_bands() const { return int_value(OPTION_RENDER_BANDS); }
 
 	// core render options
 	bool keep_aspect() const { return bool_value(OPTION_KEEPASPECT); }
@@ -436,12 +483,20 @@ public:
 	const char *debug_script() const { return value(OPTION_DEBUGSCRIPT); }
 	bool update_in_pause() const { return bool_value(OPTION_UPDATEINPAUSE); }
 	bool debuglog() const { return bool_value(OPTION_DEBUGLOG); }
+	const char *schedstats() const { return value(OPTION_SCHEDSTATS); }
+	const char *bench_log() const { return value(OPTION_BENCHLOG); }
+	float bench_warmup() const { return float_value(OPTION_BENCHWARMUP); }
+	const char *startup_log() const { return value(OPTION_STARTUPLOG); }
 
 	// core misc options
 	bool drc() const { return bool_value(OPTION_DRC); }
 	bool drc_use_c() const { return bool_value(OPTION_DRC_USE_C); }
 	bool drc_log_uml() const { return bool_value(OPTION_DRC_LOG_UML); }
 	bool drc_log_native() const { return bool_value(OPTION_DRC_LOG_NATIVE); }
+	bool drc_persist() const { return bool_value(OPTION_DRC_PERSIST); }
+	bool drc_background() const { return bool_value(OPTION_DRC_BACKGROUND); }
+	int drc_cache_size() const { return int_value(OPTION_DRC_CACHE_SIZE); }
+	bool drc_idle_skip() const { return bool_value(OPTION_DRC_IDLE_SKIP); }
 	const char *bios() const { return value(OPTION_BIOS); }
 	bool cheat() const { return bool_value(OPTION_CHEAT); }
 	bool skip_gameinfo() const { return bool_value(OPTION_SKIP_GAMEINFO); }
@@ -449,6 +504,9 @@ public:
 	ui_option ui() const { return m_ui; }
 	const char *ram_size() const { return value(OPTION_RAMSIZE); }
 	bool nvram_save() const { return bool_value(OPTION_NVRAM_SAVE); }
+	int nvram_checkpoint() const { return int_value(OPTION_NVRAM_CHECKPOINT); }
+	bool parallel_start() const { return bool_value(OPTION_PARALLEL_START); }
+	bool warm_restart() const { return bool_value(OPTION_WARM_RESTART); }
 
 	// core comm options
 	const char *comm_localhost() const { return value(OPTION_COMM_LOCAL_HOST); }
@@ -478,6 +536,13 @@ public:
 	bool  http() const { return bool_value(OPTION_HTTP); }
 	short http_port() const { return int_value(OPTION_HTTP_PORT); }
 	const char *http_root() const { return value(OPTION_HTTP_ROOT); }
+	bool server() const { return bool_value(OPTION_SERVER); }
+
+	// netplay options
+	int netplay_listen() const { return int_value(OPTION_NETPLAY_LISTEN); }
+	const char *netplay_connect() const { return value(OPTION_NETPLAY_CONNECT); }
+	int netplay_delay() const { return int_value(OPTION_NETPLAY_DELAY); }
+	int netplay_rollback() const { return int_value(OPTION_NETPLAY_ROLLBACK); }
 
 	// slots and devices - the values for these are stored outside of the core_options
 	// structure
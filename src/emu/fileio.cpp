@@ -11,8 +11,13 @@
 #include "emu.h"
 #include "fileio.h"
 
+#include "hashcache.h"
 #include "unzip.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
 //#define VERBOSE 1
 #define LOG_OUTPUT_FUNC osd_printf_verbose
 #include "logmacro.h"
@@ -213,7 +218,10 @@ emu_file::emu_file(u32 openflags, empty_t)
 	, m_first(true)
 	, m_crc(0)
 	, m_openflags(openflags)
+	, m_hash_cache(nullptr)
+	, m_cachestamp(0)
 	, m_zipfile(nullptr)
+	, m_zipmapped(nullptr)
 	, m_ziplength(0)
 	, m_remove_on_close(false)
 	, m_restrict_to_mediapath(0)
@@ -270,6 +278,21 @@ util::hash_collection &emu_file::hashes(const char *types)
 	if (needed.empty())
 		return m_hashes;
 
+	// if the cache knows the file, take the hashes from there
+	if (m_hash_cache && !m_cachepath.empty())
+	{
+		util::hash_collection cached;
+		if (m_hash_cache->lookup(m_cachepath, m_cachemember, size(), m_cachestamp, cached))
+		{
+			std::string const have = cached.hash_types();
+			if (std::all_of(types, types + strlen(types), [&have] (char type) { return have.find_first_of(type) != std::string::npos; }))
+			{
+				m_hashes = cached;
+				return m_hashes;
+			}
+		}
+	}
+
 	// load the ZIP file if needed
 	if (compressed_file_ready())
 		return m_hashes;
@@ -280,6 +303,7 @@ util::hash_collection &emu_file::hashes(const char *types)
 	if (!m_zipdata.empty())
 	{
 		m_hashes.compute(&m_zipdata[0], m_zipdata.size(), needed.c_str());
+		cache_hashes();
 		return m_hashes;
 	}
 
@@ -290,10 +314,23 @@ util::hash_collection &emu_file::hashes(const char *types)
 
 	// compute the hash
 	m_hashes.compute(filedata, m_file->size(), needed.c_str());
+	cache_hashes();
 	return m_hashes;
 }
 
 
+//-------------------------------------------------
+//  cache_hashes - record the hashes we computed
+//  in the persistent cache
+//-------------------------------------------------
+
+void emu_file::cache_hashes()
+{
+	if (m_hash_cache && !m_cachepath.empty())
+		m_hash_cache->store(m_cachepath, m_cachemember, size(), m_cachestamp, m_hashes);
+}
+
+
 //-------------------------------------------------
 //  open - open a file by searching paths
 //-------------------------------------------------
@@ -383,6 +420,19 @@ osd_file::error emu_file::open_next()
 		// attempt to open the file directly
 		LOG("emu_file: attempting to open '%s' directly\n", m_fullpath);
 		filerr = util::core_file::open(m_fullpath, m_openflags, m_file);
+		if (osd_file::error::NONE == filerr)
+		{
+			// plain files are known to the hash cache by modification time
+			m_cachepath = m_fullpath;
+			m_cachemember.clear();
+			m_cachestamp = 0;
+			if (m_hash_cache)
+			{
+				auto const entry(osd_stat(m_fullpath));
+				if (entry)
+					m_cachestamp = std::chrono::duration_cast<std::chrono::seconds>(entry->last_modified.time_since_epoch()).count();
+			}
+		}
 
 		// if we're opening for read-only we have other options
 		if ((osd_file::error::NONE != filerr) && ((m_openflags & (OPEN_FLAG_READ | OPEN_FLAG_WRITE)) == OPEN_FLAG_READ))
@@ -411,6 +461,21 @@ osd_file::error emu_file::open_ram(const void *data, u32 length)
 }
 
 
+//-------------------------------------------------
+//  open_ram_write - open an empty "file" in
+//  memory that grows as it is written
+//-------------------------------------------------
+
+osd_file::error emu_file::open_ram_write()
+{
+	// set a fake filename and CRC
+	m_filename = "RAM";
+	m_crc = 0;
+
+	return util::core_file::open_ram_write(m_openflags, m_file);
+}
+
+
 //-------------------------------------------------
 //  close - close a file and free all data; also
 //  remove the file if requested
@@ -421,6 +486,7 @@ void emu_file::close()
 	// close files and free memory
 	m_zipfile.reset();
 	m_file.reset();
+	m_zipmapped.reset();
 
 	m_zipdata.clear();
 
@@ -431,6 +497,8 @@ void emu_file::close()
 	// reset our hashes and path as well
 	m_hashes.reset();
 	m_fullpath.clear();
+	m_cachepath.clear();
+	m_cachemember.clear();
 }
 
 
@@ -751,6 +819,7 @@ osd_file::error emu_file::attempt_zipped()
 			// attempt to open the archive file
 			util::archive_file::ptr zip;
 			util::archive_file::error ziperr = open_funcs[i](m_fullpath, zip);
+			std::string const archivepath(m_fullpath);
 
 			// chop the archive suffix back off the filename before continuing
 			m_fullpath = m_fullpath.substr(0, dirsep);
@@ -782,6 +851,11 @@ osd_file::error emu_file::attempt_zipped()
 				// build a hash with just the CRC
 				m_hashes.reset();
 				m_hashes.add_crc(m_zipfile->current_crc());
+
+				// archive members are known to the hash cache by the CRC in the directory
+				m_cachepath = archivepath;
+				m_cachemember = m_zipfile->current_name();
+				m_cachestamp = m_zipfile->current_crc();
 				return (m_openflags & OPEN_FLAG_NO_PRELOAD) ? osd_file::error::NONE : load_zipped_file();
 			}
 
@@ -803,6 +877,16 @@ osd_file::error emu_file::load_zipped_file()
 	assert(m_zipdata.empty());
 	assert(m_zipfile);
 
+	// use the data in place if the archive can provide a view of it; the
+	// archive has to stay open for as long as the view is in use
+	void const *view;
+	if ((m_zipfile->map_current(view) == util::archive_file::error::NONE) &&
+		(util::core_file::open_ram(view, m_ziplength, m_openflags, m_file) == osd_file::error::NONE))
+	{
+		m_zipmapped = std::move(m_zipfile);
+		return osd_file::error::NONE;
+	}
+
 	// allocate some memory
 	m_zipdata.resize(m_ziplength);
 
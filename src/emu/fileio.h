@@ -32,6 +32,9 @@
 //  TYPE DEFINITIONS
 //**************************************************************************
 
+class hash_cache;
+
+
 // ======================> path_iterator
 
 // helper class for iterating over configured paths
@@ -154,12 +157,14 @@ public:
 	void remove_on_close() { m_remove_on_close = true; }
 	void set_openflags(u32 openflags) { assert(!m_file); m_openflags = openflags; }
 	void set_restrict_to_mediapath(int rtmp) { m_restrict_to_mediapath = rtmp; }
+	void set_hash_cache(hash_cache *cache) { m_hash_cache = cache; }
 
 	// open/close
 	osd_file::error open(const std::string &name);
 	osd_file::error open(const std::string &name, u32 crc);
 	osd_file::error open_next();
 	osd_file::error open_ram(const void *data, u32 length);
+	osd_file::error open_ram_write();
 	void close();
 
 	// control
@@ -210,6 +215,7 @@ private:
 
 	bool part_of_mediapath(const std::string &path);
 	bool compressed_file_ready();
+	void cache_hashes();
 
 	// internal helpers
 	osd_file::error attempt_zipped();
@@ -225,8 +231,13 @@ private:
 	u32                     m_crc;                  // file's CRC
 	u32                     m_openflags;            // flags we used for the open
 	util::hash_collection   m_hashes;               // collection of hashes
+	hash_cache *            m_hash_cache;           // persistent hash cache, or nullptr
+	std::string             m_cachepath;            // file or archive path for the cache
+	std::string             m_cachemember;          // archive member name for the cache
+	s64                     m_cachestamp;           // CRC or modification time for the cache
 
 	std::unique_ptr<util::archive_file> m_zipfile;  // ZIP file pointer
+	std::unique_ptr<util::archive_file> m_zipmapped; // archive backing a mapped member
 	std::vector<u8>         m_zipdata;              // ZIP file data
 	u64                     m_ziplength;            // ZIP file length
 
@@ -0,0 +1,147 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    frametiming.cpp
+
+    Per-frame timing log for benchmarking.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "frametiming.h"
+
+#include <algorithm>
+
+
+
+//**************************************************************************
+//  FRAME TIMING LOG
+//**************************************************************************
+
+//-------------------------------------------------
+//  frame_timing_log - constructor
+//-------------------------------------------------
+
+frame_timing_log::frame_timing_log(running_machine &machine, std::unique_ptr<emu_file> &&file, const attotime &warmup)
+	: m_machine(machine)
+	, m_file(std::move(file))
+	, m_warmup_end(warmup)
+	, m_ticks_per_second(double(osd_ticks_per_second()))
+	, m_last_time(attotime::zero)
+	, m_last_ticks(osd_ticks())
+	, m_video_ticks(0)
+	, m_sound_ticks(0)
+	, m_total_video_ticks(0)
+	, m_total_sound_ticks(0)
+	, m_measured_time(attotime::zero)
+	, m_frames(0)
+	, m_warmup_frames(0)
+{
+	// device run times come from the scheduler statistics
+	machine.scheduler().enable_statistics();
+	for (device_execute_interface &exec : execute_interface_iterator(machine.root_device()))
+		m_devices.push_back(device_timing{ &exec, exec.stats().run_ticks, 0 });
+
+	machine.add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&frame_timing_log::frame_update, this));
+	machine.add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&frame_timing_log::write_summary, this));
+}
+
+
+//-------------------------------------------------
+//  ~frame_timing_log - destructor
+//-------------------------------------------------
+
+frame_timing_log::~frame_timing_log()
+{
+}
+
+
+//-------------------------------------------------
+//  frame_update - write the timing for the frame
+//  that just ended
+//-------------------------------------------------
+
+void frame_timing_log::frame_update()
+{
+	osd_ticks_t const now_ticks = osd_ticks();
+	attotime const now_time = machine().time();
+	osd_ticks_t const wall_ticks = now_ticks - m_last_ticks;
+	attotime const emulated = now_time - m_last_time;
+
+	if (m_last_time < m_warmup_end)
+	{
+		// still warming up; just move the baselines along
+		m_warmup_frames++;
+		for (device_timing &device : m_devices)
+			device.last_ticks = device.exec->stats().run_ticks;
+	}
+	else
+	{
+		m_frames++;
+		m_frame_seconds.push_back(seconds(wall_ticks));
+		m_measured_time += emulated;
+		m_total_video_ticks += m_video_ticks;
+		m_total_sound_ticks += m_sound_ticks;
+
+		m_file->printf("{\"frame\": %u, \"time\": %s, \"emulated\": %.9f, \"wall\": %.9f, \"video\": %.9f, \"sound\": %.9f, \"devices\": {",
+				m_frames, now_time.as_string(9), emulated.as_double(), seconds(wall_ticks), seconds(m_video_ticks), seconds(m_sound_ticks));
+		char const *separator = "";
+		for (device_timing &device : m_devices)
+		{
+			osd_ticks_t const run_ticks = device.exec->stats().run_ticks;
+			m_file->printf("%s\"%s\": %.9f", separator, device.exec->device().tag(), seconds(run_ticks - device.last_ticks));
+			device.total_ticks += run_ticks - device.last_ticks;
+			device.last_ticks = run_ticks;
+			separator = ", ";
+		}
+		m_file->printf("}}\n");
+	}
+
+	m_video_ticks = 0;
+	m_sound_ticks = 0;
+	m_last_time = now_time;
+	m_last_ticks = osd_ticks();
+}
+
+
+//-------------------------------------------------
+//  write_summary - write totals and frame time
+//  percentiles at exit
+//-------------------------------------------------
+
+void frame_timing_log::write_summary()
+{
+	// nearest-rank percentiles of the host time per frame
+	std::vector<double> sorted(m_frame_seconds);
+	std::sort(sorted.begin(), sorted.end());
+	auto const percentile = [&sorted] (unsigned p) -> double
+	{
+		if (sorted.empty())
+			return 0.0;
+		std::size_t const rank = (sorted.size() * p + 99) / 100;
+		return sorted[std::max<std::size_t>(rank, 1) - 1];
+	};
+	double wall = 0.0;
+	for (double frame : m_frame_seconds)
+		wall += frame;
+	double const mean = m_frames ? (wall / double(m_frames)) : 0.0;
+	double const speed = (wall > 0.0) ? (m_measured_time.as_double() * 100.0 / wall) : 0.0;
+
+	m_file->printf("{\"summary\": {\"frames\": %u, \"warmup_frames\": %u, \"emulated\": %.9f, \"wall\": %.9f, \"speed\": %.2f, ",
+			m_frames, m_warmup_frames, m_measured_time.as_double(), wall, speed);
+	m_file->printf("\"frame_wall\": {\"mean\": %.9f, \"p50\": %.9f, \"p90\": %.9f, \"p99\": %.9f, \"max\": %.9f}, ",
+			mean, percentile(50), percentile(90), percentile(99), sorted.empty() ? 0.0 : sorted.back());
+	m_file->printf("\"video\": %.9f, \"sound\": %.9f, \"devices\": {", seconds(m_total_video_ticks), seconds(m_total_sound_ticks));
+	char const *separator = "";
+	for (device_timing const &device : m_devices)
+	{
+		m_file->printf("%s\"%s\": %.9f", separator, device.exec->device().tag(), seconds(device.total_ticks));
+		separator = ", ";
+	}
+	m_file->printf("}}}\n");
+	m_file.reset();
+
+	osd_printf_info("Frame time: mean %.3f ms, p50 %.3f ms, p99 %.3f ms over %u frames\n",
+			mean * 1000.0, percentile(50) * 1000.0, percentile(99) * 1000.0, m_frames);
+}
@@ -0,0 +1,77 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    frametiming.h
+
+    Per-frame timing log for benchmarking.
+
+    Writes one JSON object per line for every emulated frame, giving the
+    emulated and host time the frame took, and how much of the host time
+    went to each executing device, to video updates and to sound updates.
+    Frames in the warmup period are left out.  A final line summarises the
+    run with totals and frame time percentiles.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_FRAMETIMING_H
+#define MAME_EMU_FRAMETIMING_H
+
+#pragma once
+
+#include <vector>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> frame_timing_log
+
+class frame_timing_log
+{
+public:
+	// construction/destruction
+	frame_timing_log(running_machine &machine, std::unique_ptr<emu_file> &&file, const attotime &warmup);
+	~frame_timing_log();
+
+	// getters
+	running_machine &machine() const { return m_machine; }
+
+	// host time spent outside device execution during the current frame
+	void add_video_ticks(osd_ticks_t ticks) { m_video_ticks += ticks; }
+	void add_sound_ticks(osd_ticks_t ticks) { m_sound_ticks += ticks; }
+
+private:
+	// per-device state
+	struct device_timing
+	{
+		device_execute_interface *  exec;           // device being measured
+		osd_ticks_t                 last_ticks;     // run ticks at the start of the frame
+		osd_ticks_t                 total_ticks;    // run ticks in measured frames
+	};
+
+	// internal helpers
+	void frame_update();
+	void write_summary();
+	double seconds(osd_ticks_t ticks) const { return double(ticks) / m_ticks_per_second; }
+
+	// internal state
+	running_machine &           m_machine;          // reference to our machine
+	std::unique_ptr<emu_file>   m_file;             // file to write
+	attotime                    m_warmup_end;       // emulated time measurement starts
+	double                      m_ticks_per_second; // host tick rate
+	std::vector<device_timing>  m_devices;          // executing devices
+	std::vector<double>         m_frame_seconds;    // host time for each measured frame
+	attotime                    m_last_time;        // emulated time at the start of the frame
+	osd_ticks_t                 m_last_ticks;       // host time at the start of the frame
+	osd_ticks_t                 m_video_ticks;      // video ticks this frame
+	osd_ticks_t                 m_sound_ticks;      // sound ticks this frame
+	osd_ticks_t                 m_total_video_ticks; // video ticks in measured frames
+	osd_ticks_t                 m_total_sound_ticks; // sound ticks in measured frames
+	attotime                    m_measured_time;    // emulated time in measured frames
+	u64                         m_frames;           // frames measured
+	u64                         m_warmup_frames;    // frames skipped
+};
+
+#endif // MAME_EMU_FRAMETIMING_H
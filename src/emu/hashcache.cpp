@@ -0,0 +1,136 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    hashcache.cpp
+
+    Persistent cache of file hashes.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "hashcache.h"
+
+#include "sqlite3.h"
+
+
+//**************************************************************************
+//  HASH CACHE
+//**************************************************************************
+
+//-------------------------------------------------
+//  hash_cache - constructor; opens or creates
+//  the database, leaving the cache disabled if
+//  that fails
+//-------------------------------------------------
+
+hash_cache::hash_cache(const std::string &filename)
+	: m_db(nullptr)
+	, m_select(nullptr)
+	, m_insert(nullptr)
+{
+	if (filename.empty())
+		return;
+
+	if (sqlite3_open(filename.c_str(), &m_db) != SQLITE_OK)
+	{
+		osd_printf_warning("Unable to open hash cache %s: %s\n", filename, sqlite3_errmsg(m_db));
+		close();
+		return;
+	}
+
+	// a lost update only costs a rehash, so don't sync every store
+	char const *const setup =
+			"PRAGMA journal_mode=WAL;"
+			"PRAGMA synchronous=NORMAL;"
+			"CREATE TABLE IF NOT EXISTS hashes ("
+			" path TEXT NOT NULL,"
+			" member TEXT NOT NULL,"
+			" size INTEGER NOT NULL,"
+			" stamp INTEGER NOT NULL,"
+			" hashes TEXT NOT NULL,"
+			" PRIMARY KEY (path, member));";
+	if ((sqlite3_exec(m_db, setup, nullptr, nullptr, nullptr) != SQLITE_OK) ||
+		(sqlite3_prepare_v2(m_db, "SELECT size, stamp, hashes FROM hashes WHERE path = ?1 AND member = ?2;", -1, &m_select, nullptr) != SQLITE_OK) ||
+		(sqlite3_prepare_v2(m_db, "INSERT OR REPLACE INTO hashes (path, member, size, stamp, hashes) VALUES (?1, ?2, ?3, ?4, ?5);", -1, &m_insert, nullptr) != SQLITE_OK))
+	{
+		osd_printf_warning("Unable to set up hash cache %s: %s\n", filename, sqlite3_errmsg(m_db));
+		close();
+	}
+}
+
+
+//-------------------------------------------------
+//  ~hash_cache - destructor
+//-------------------------------------------------
+
+hash_cache::~hash_cache()
+{
+	close();
+}
+
+
+//-------------------------------------------------
+//  close - release the statements and database
+//-------------------------------------------------
+
+void hash_cache::close()
+{
+	sqlite3_finalize(m_select);
+	sqlite3_finalize(m_insert);
+	sqlite3_close(m_db);
+	m_select = nullptr;
+	m_insert = nullptr;
+	m_db = nullptr;
+}
+
+
+//-------------------------------------------------
+//  lookup - get the cached hashes of a file if
+//  it has not changed since they were stored
+//-------------------------------------------------
+
+bool hash_cache::lookup(const std::string &path, const std::string &member, u64 size, s64 stamp, util::hash_collection &hashes)
+{
+	if (!enabled())
+		return false;
+
+	std::lock_guard<std::mutex> guard(m_mutex);
+	sqlite3_reset(m_select);
+	sqlite3_bind_text(m_select, 1, path.c_str(), path.length(), SQLITE_TRANSIENT);
+	sqlite3_bind_text(m_select, 2, member.c_str(), member.length(), SQLITE_TRANSIENT);
+
+	bool found = false;
+	if ((sqlite3_step(m_select) == SQLITE_ROW) &&
+		(u64(sqlite3_column_int64(m_select, 0)) == size) &&
+		(sqlite3_column_int64(m_select, 1) == stamp))
+	{
+		char const *const text = reinterpret_cast<char const *>(sqlite3_column_text(m_select, 2));
+		found = text && hashes.from_internal_string(text);
+	}
+	sqlite3_reset(m_select);
+	return found;
+}
+
+
+//-------------------------------------------------
+//  store - record the hashes of a file
+//-------------------------------------------------
+
+void hash_cache::store(const std::string &path, const std::string &member, u64 size, s64 stamp, const util::hash_collection &hashes)
+{
+	if (!enabled())
+		return;
+
+	std::string const text = hashes.internal_string();
+	std::lock_guard<std::mutex> guard(m_mutex);
+	sqlite3_reset(m_insert);
+	sqlite3_bind_text(m_insert, 1, path.c_str(), path.length(), SQLITE_TRANSIENT);
+	sqlite3_bind_text(m_insert, 2, member.c_str(), member.length(), SQLITE_TRANSIENT);
+	sqlite3_bind_int64(m_insert, 3, sqlite3_int64(size));
+	sqlite3_bind_int64(m_insert, 4, stamp);
+	sqlite3_bind_text(m_insert, 5, text.c_str(), text.length(), SQLITE_TRANSIENT);
+	if (sqlite3_step(m_insert) != SQLITE_DONE)
+		osd_printf_verbose("Unable to update hash cache for %s: %s\n", path, sqlite3_errmsg(m_db));
+	sqlite3_reset(m_insert);
+}
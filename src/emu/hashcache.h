@@ -0,0 +1,62 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    hashcache.h
+
+    Persistent cache of file hashes.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_HASHCACHE_H
+#define MAME_EMU_HASHCACHE_H
+
+#pragma once
+
+#include "hash.h"
+
+#include <mutex>
+#include <string>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+struct sqlite3;
+struct sqlite3_stmt;
+
+
+// ======================> hash_cache
+
+// hashes of previously read files, stored in an SQLite database; a file is
+// identified by its path (the archive for archive members), its member name
+// within the archive, its size and a stamp that changes whenever the file
+// does (the central directory CRC for archive members, the modification
+// time for plain files)
+class hash_cache
+{
+public:
+	// construction/destruction
+	hash_cache(const std::string &filename);
+	~hash_cache();
+
+	// getters
+	bool enabled() const { return m_select != nullptr; }
+
+	// lookup and update
+	bool lookup(const std::string &path, const std::string &member, u64 size, s64 stamp, util::hash_collection &hashes);
+	void store(const std::string &path, const std::string &member, u64 size, s64 stamp, const util::hash_collection &hashes);
+
+private:
+	void close();
+
+	// internal state
+	std::mutex      m_mutex;                // protects the statements
+	sqlite3 *       m_db;                   // database handle
+	sqlite3_stmt *  m_select;               // prepared lookup statement
+	sqlite3_stmt *  m_insert;               // prepared update statement
+};
+
+
+#endif // MAME_EMU_HASHCACHE_H
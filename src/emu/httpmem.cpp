@@ -0,0 +1,271 @@
+// license:BSD-3-Clause
+// copyright-holders:Miodrag Milanovic
+/***************************************************************************
+
+    httpmem.cpp
+
+    Binary websocket feed of memory shares, regions and outputs.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "httpmem.h"
+
+#include "main.h"
+
+#include <cstring>
+#include <sstream>
+
+
+namespace {
+
+// memory is compared in blocks of this many bytes, and changed blocks next to each other go out as one run
+constexpr size_t DELTA_BLOCK = 32;
+
+enum : u8
+{
+	RECORD_BYTES = 0,
+	RECORD_OUTPUT = 1
+};
+
+template <typename T>
+void put_le(std::string &message, T value)
+{
+	for (unsigned i = 0; i < sizeof(T); i++)
+		message.push_back(char(u8(u64(value) >> (8 * i))));
+}
+
+} // anonymous namespace
+
+
+
+//**************************************************************************
+//  HTTP MEMORY FEED
+//**************************************************************************
+
+//-------------------------------------------------
+//  http_memory_feed - constructor
+//-------------------------------------------------
+
+http_memory_feed::http_memory_feed(running_machine &machine)
+	: m_machine(machine)
+	, m_queue(std::make_shared<request_queue>())
+	, m_frame(0)
+{
+	// the server thread only queues work; everything touching the machine happens at the end of a frame
+	std::shared_ptr<request_queue> queue(m_queue);
+	auto post = [queue] (http_manager::websocket_connection_ptr &&connection, std::string &&command, bool closed)
+	{
+		std::lock_guard<std::mutex> lock(queue->mutex);
+		if (queue->open)
+			queue->requests.push_back(request{ std::move(connection), std::move(command), closed });
+	};
+	machine.manager().http()->add_endpoint("/api/memory",
+			nullptr,
+			[post] (http_manager::websocket_connection_ptr connection, const std::string &payload, int)
+			{
+				post(std::move(connection), std::string(payload), false);
+			},
+			[post] (http_manager::websocket_connection_ptr connection, int, const std::string &)
+			{
+				post(std::move(connection), std::string(), true);
+			},
+			[post] (http_manager::websocket_connection_ptr connection, const std::error_code &)
+			{
+				post(std::move(connection), std::string(), true);
+			});
+
+	machine.add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&http_memory_feed::frame_update, this));
+}
+
+
+//-------------------------------------------------
+//  ~http_memory_feed - destructor
+//-------------------------------------------------
+
+http_memory_feed::~http_memory_feed()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_queue->mutex);
+		m_queue->open = false;
+		m_queue->requests.clear();
+	}
+	machine().manager().http()->remove_endpoint("/api/memory");
+}
+
+
+//-------------------------------------------------
+//  frame_update - apply queued commands and send
+//  each client what changed this frame
+//-------------------------------------------------
+
+void http_memory_feed::frame_update()
+{
+	m_frame++;
+
+	{
+		std::vector<request> requests;
+		{
+			std::lock_guard<std::mutex> lock(m_queue->mutex);
+			requests.swap(m_queue->requests);
+		}
+		for (const request &req : requests)
+			apply(req);
+	}
+
+	std::string message;
+	for (auto &client : m_clients)
+	{
+		message.clear();
+		put_le<u64>(message, m_frame);
+		size_t const header = message.size();
+
+		for (size_t index = 0; index < client.second.size(); index++)
+		{
+			subscription &sub = client.second[index];
+			if (sub.base)
+			{
+				add_deltas(sub, u16(index), message);
+			}
+			else
+			{
+				s32 const value = machine().output().get_value(sub.output.c_str());
+				if (!sub.sent || (value != sub.value))
+				{
+					message.push_back(char(RECORD_OUTPUT));
+					put_le<u16>(message, u16(index));
+					put_le<s32>(message, value);
+					sub.value = value;
+					sub.sent = true;
+				}
+			}
+		}
+
+		// nothing changed, nothing to send
+		if (message.size() > header)
+			client.first->send_message(message, 2);
+	}
+}
+
+
+//-------------------------------------------------
+//  apply - carry out a command from a client
+//-------------------------------------------------
+
+void http_memory_feed::apply(const request &req)
+{
+	if (req.closed)
+	{
+		m_clients.erase(req.connection);
+		return;
+	}
+
+	std::istringstream stream(req.command);
+	std::string verb, name;
+	stream >> verb >> name;
+
+	std::vector<subscription> &subs = m_clients[req.connection];
+	if (verb == "clear")
+	{
+		subs.clear();
+		req.connection->send_message("ok", 1);
+		return;
+	}
+
+	subscription sub{ nullptr, 0, std::string(), 0, false, std::vector<u8>() };
+	if (name.empty())
+	{
+		req.connection->send_message("error missing name", 1);
+		return;
+	}
+	else if (verb == "share")
+	{
+		auto const found = machine().memory().shares().find(name);
+		if (found == machine().memory().shares().end() || !found->second->ptr())
+		{
+			req.connection->send_message("error unknown share " + name, 1);
+			return;
+		}
+		sub.base = reinterpret_cast<const u8 *>(found->second->ptr());
+		sub.bytes = found->second->bytes();
+	}
+	else if (verb == "region")
+	{
+		auto const found = machine().memory().regions().find(name);
+		if (found == machine().memory().regions().end())
+		{
+			req.connection->send_message("error unknown region " + name, 1);
+			return;
+		}
+		sub.base = found->second->base();
+		sub.bytes = found->second->bytes();
+	}
+	else if (verb == "output")
+	{
+		sub.output = name;
+	}
+	else
+	{
+		req.connection->send_message("error unknown command " + verb, 1);
+		return;
+	}
+
+	if (subs.size() > 0xffff)
+	{
+		req.connection->send_message("error too many subscriptions", 1);
+		return;
+	}
+	subs.emplace_back(std::move(sub));
+	req.connection->send_message(string_format("ok %u %u", unsigned(subs.size() - 1), unsigned(subs.back().bytes)), 1);
+}
+
+
+//-------------------------------------------------
+//  add_deltas - append the runs of a memory block
+//  that changed since they were last sent
+//-------------------------------------------------
+
+void http_memory_feed::add_deltas(subscription &sub, u16 index, std::string &message)
+{
+	if (!sub.sent)
+	{
+		sub.shadow.assign(sub.base, sub.base + sub.bytes);
+		message.push_back(char(RECORD_BYTES));
+		put_le<u16>(message, index);
+		put_le<u32>(message, 0);
+		put_le<u32>(message, u32(sub.bytes));
+		message.append(reinterpret_cast<const char *>(sub.base), sub.bytes);
+		sub.sent = true;
+		return;
+	}
+
+	size_t offset = 0;
+	while (offset < sub.bytes)
+	{
+		// skip blocks that haven't changed
+		size_t chunk = std::min(DELTA_BLOCK, sub.bytes - offset);
+		if (!std::memcmp(&sub.shadow[offset], sub.base + offset, chunk))
+		{
+			offset += chunk;
+			continue;
+		}
+
+		// extend the run over changed neighbours
+		size_t end = offset + chunk;
+		while (end < sub.bytes)
+		{
+			chunk = std::min(DELTA_BLOCK, sub.bytes - end);
+			if (!std::memcmp(&sub.shadow[end], sub.base + end, chunk))
+				break;
+			end += chunk;
+		}
+
+		std::memcpy(&sub.shadow[offset], sub.base + offset, end - offset);
+		message.push_back(char(RECORD_BYTES));
+		put_le<u16>(message, index);
+		put_le<u32>(message, u32(offset));
+		put_le<u32>(message, u32(end - offset));
+		message.append(reinterpret_cast<const char *>(sub.base + offset), end - offset);
+		offset = end;
+	}
+}
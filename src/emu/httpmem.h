@@ -0,0 +1,98 @@
+// license:BSD-3-Clause
+// copyright-holders:Miodrag Milanovic
+/***************************************************************************
+
+    httpmem.h
+
+    Binary websocket feed of memory shares, regions and outputs.
+
+    Clients connect to /api/memory and send text commands to choose what
+    they want to follow:
+
+        share <tag>     follow a memory share, e.g. "share :mainram"
+        region <tag>    follow a memory region
+        output <name>   follow an output value
+        clear           stop following everything
+
+    Each command is answered with "ok <index> <bytes>" or "error <reason>".
+    At the end of every frame in which something followed has changed,
+    the client gets one binary message, all values little-endian:
+
+        u64 frame number
+        records, each starting with u8 type and u16 index:
+            type 0 (bytes):  u32 offset, u32 length, then length bytes
+            type 1 (output): s32 value
+
+    The first frame after subscribing sends a block in full; afterwards
+    only the runs that differ from the last frame sent are included.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_HTTPMEM_H
+#define MAME_EMU_HTTPMEM_H
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> http_memory_feed
+
+class http_memory_feed
+{
+public:
+	// construction/destruction
+	http_memory_feed(running_machine &machine);
+	~http_memory_feed();
+
+	// getters
+	running_machine &machine() const { return m_machine; }
+
+private:
+	// one thing a client follows
+	struct subscription
+	{
+		const u8 *          base;               // memory block, or nullptr for an output
+		size_t              bytes;              // size of the memory block
+		std::string         output;             // output name
+		s32                 value;              // last output value sent
+		bool                sent;               // true once the first state has gone out
+		std::vector<u8>     shadow;             // memory contents as last sent
+	};
+
+	// a command or disconnect from the server thread, applied on the emulation thread
+	struct request
+	{
+		http_manager::websocket_connection_ptr  connection;
+		std::string                             command;
+		bool                                    closed;
+	};
+
+	// shared with the server's handlers, which can outlive us
+	struct request_queue
+	{
+		std::mutex              mutex;          // protects everything below
+		std::vector<request>    requests;       // requests not yet applied
+		bool                    open = true;    // false once the feed is gone
+	};
+
+	// internal helpers
+	void frame_update();
+	void apply(const request &req);
+	void add_deltas(subscription &sub, u16 index, std::string &message);
+
+	// internal state
+	running_machine &       m_machine;          // reference to our machine
+	std::shared_ptr<request_queue> m_queue;     // requests from the server thread
+	std::map<http_manager::websocket_connection_ptr, std::vector<subscription>> m_clients;
+	u64                     m_frame;            // frames seen
+};
+
+#endif // MAME_EMU_HTTPMEM_H
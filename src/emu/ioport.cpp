@@ -98,6 +98,9 @@
 #include "ui/uimain.h"
 #include "inputdev.h"
 #include "natkeyboard.h"
+#include "netplay.h"
+#include "debugger.h"
+#include "debug/debugcpu.h"
 
 #include "osdepend.h"
 
@@ -931,6 +934,7 @@ void ioport_field::set_user_settings(const user_settings &settings) noexcept
 		m_live->analog->m_delta = settings.delta;
 		m_live->analog->m_centerdelta = settings.centerdelta;
 		m_live->analog->m_reverse = settings.reverse;
+		m_port.live().analogvalid = false;
 	}
 	else
 	{
@@ -1448,6 +1452,9 @@ ioport_value ioport_port::read()
 	if (!manager().safe_to_read())
 		throw emu_fatalerror("Input ports cannot be read at init time!");
 
+	// the first read of a frame brings in fresh input
+	manager().late_poll();
+
 	// start with the digital state
 	ioport_value result = m_live->digital;
 
@@ -1458,9 +1465,17 @@ ioport_value ioport_port::read()
 	// apply active high/low state to digital and dynamic read inputs
 	result ^= m_live->defvalue;
 
-	// insert analog portions
-	for (analog_field &analog : m_live->analoglist)
-		analog.read(result);
+	// insert analog portions; values that only move once per frame are merged in one go
+	if (!m_live->analogvalid)
+	{
+		m_live->analogbits = 0;
+		for (analog_field *analog : m_live->frameanalog)
+			analog->read(m_live->analogbits);
+		m_live->analogvalid = true;
+	}
+	result = (result & ~m_live->analogmask) | m_live->analogbits;
+	for (analog_field *analog : m_live->readanalog)
+		analog->read(result);
 
 	return result;
 }
@@ -1488,6 +1503,7 @@ void ioport_port::frame_update()
 {
 	// start with 0 values for the digital bits
 	m_live->digital = 0;
+	m_live->analogvalid = false;
 
 	// now loop back and modify based on the inputs
 	for (ioport_field &field : fields())
@@ -1610,7 +1626,10 @@ void ioport_port::update_defvalue(bool flush_defaults)
 ioport_port_live::ioport_port_live(ioport_port &port)
 	: defvalue(0),
 		digital(0),
-		outputvalue(0)
+		outputvalue(0),
+		analogmask(0),
+		analogbits(0),
+		analogvalid(false)
 {
 	// iterate over fields
 	for (ioport_field &field : port.fields())
@@ -1631,6 +1650,23 @@ ioport_port_live::ioport_port_live(ioport_port &port)
 		// let the field initialize its live state
 		field.init_live_state(analog);
 	}
+
+	// interpolated and conditional analog fields are sampled per read, as are
+	// overlapping ones so they still merge in list order
+	for (analog_field &analog : analoglist)
+	{
+		bool overlaps = false;
+		for (analog_field &other : analoglist)
+			if (&other != &analog && (other.field().mask() & analog.field().mask()))
+				overlaps = true;
+		if (analog.per_frame() && !overlaps)
+		{
+			frameanalog.push_back(&analog);
+			analogmask |= analog.field().mask();
+		}
+		else
+			readanalog.push_back(&analog);
+	}
 }
 
 
@@ -1648,6 +1684,8 @@ ioport_manager::ioport_manager(running_machine &machine)
 		m_safe_to_read(false),
 		m_last_frame_time(attotime::zero),
 		m_last_delta_nsec(0),
+		m_late_input(machine.options().late_input()),
+		m_late_pending(false),
 		m_record_file(machine.options().input_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS),
 		m_playback_file(machine.options().input_directory(), OPEN_FLAG_READ),
 		m_playback_accumulated_speed(0),
@@ -1966,9 +2004,58 @@ digital_joystick &ioport_manager::digjoystick(int player, int number)
 
 void ioport_manager::frame_update_callback()
 {
-	// if we're paused, don't do anything
-	if (!machine().paused())
-		frame_update();
+	// if we're paused, don't do anything; frames emulated ahead keep the current input
+	if (!machine().paused() && !machine().running_ahead())
+	{
+		if (late_input_usable())
+		{
+			// leave the update to the first read of the next frame; if
+			// nothing was read this frame, catch up with it now
+			if (m_late_pending)
+				late_frame_update();
+			m_late_pending = true;
+		}
+		else
+		{
+			m_late_pending = false;
+			frame_update();
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  late_frame_update - poll the OSD input modules
+//  and do the deferred update for this frame
+//-------------------------------------------------
+
+void ioport_manager::late_frame_update()
+{
+	// paused means no frame updates, the same as without late input
+	if (machine().paused())
+		return;
+
+	// clear first, frame_update reads the ports itself
+	m_late_pending = false;
+	machine().osd().input_update();
+	frame_update();
+}
+
+
+//-------------------------------------------------
+//  late_input_usable - true if input can be
+//  polled mid-frame without breaking anything
+//  that needs it on frame boundaries
+//-------------------------------------------------
+
+bool ioport_manager::late_input_usable()
+{
+	// recordings, netplay and run-ahead all need input to change only between frames
+	return m_late_input
+			&& !m_record_file.is_open()
+			&& !m_playback_file.is_open()
+			&& !machine().netplay().enabled()
+			&& machine().options().runahead() == 0;
 }
 
 
@@ -2001,6 +2088,15 @@ void ioport_manager::frame_update()
 	for (auto &port : m_portlist)
 		port.second->update_defvalue(false);
 
+	// merge in the input of a netplay peer
+	netplay_manager &netplay = machine().netplay();
+	netplay.frame_begin();
+
+	// journal input for reverse execution in the debugger, or replay it
+	debugger_cpu *const debugcpu = (machine().debug_flags & DEBUG_FLAG_ENABLED) ? &machine().debugger().cpu() : nullptr;
+	if (debugcpu)
+		debugcpu->input_frame(curtime);
+
 	// loop over all input ports
 	for (auto &port : m_portlist)
 	{
@@ -2008,6 +2104,9 @@ void ioport_manager::frame_update()
 
 		// handle playback/record
 		playback_port(*port.second.get());
+		netplay.port_update(*port.second.get());
+		if (debugcpu)
+			debugcpu->input_port_update(*port.second.get());
 		record_port(*port.second.get());
 
 		// call device line write handlers
@@ -2016,6 +2115,7 @@ void ioport_manager::frame_update()
 			if (dynfield.field().type() != IPT_OUTPUT)
 				dynfield.write(newvalue);
 	}
+	netplay.frame_end();
 
 	g_profiler.stop();
 }
@@ -2591,6 +2691,7 @@ void ioport_manager::playback_port(ioport_port &port)
 		// read the default value and the digital state
 		playback_read(port.live().defvalue);
 		playback_read(port.live().digital);
+		port.live().analogvalid = false;
 
 		// loop over analog ports and save their data
 		for (analog_field &analog : port.live().analoglist)
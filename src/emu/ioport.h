@@ -1262,6 +1262,7 @@ public:
 	bool reverse() const noexcept { return m_reverse; }
 	s32 delta() const noexcept { return m_delta; }
 	s32 centerdelta() const noexcept { return m_centerdelta; }
+	bool per_frame() const noexcept { return !m_interpolate && m_field.condition().none(); }
 
 	// readers
 	void read(ioport_value &value);
@@ -1364,9 +1365,14 @@ struct ioport_port_live
 	simple_list<analog_field> analoglist;       // list of analog port info
 	simple_list<dynamic_field> readlist;        // list of dynamic read fields
 	simple_list<dynamic_field> writelist;       // list of dynamic write fields
+	std::vector<analog_field *> frameanalog;    // analog fields that only change once per frame
+	std::vector<analog_field *> readanalog;     // analog fields that must be sampled on every read
 	ioport_value            defvalue;           // combined default value across the port
 	ioport_value            digital;            // current value from all digital inputs
 	ioport_value            outputvalue;        // current value for outputs
+	ioport_value            analogmask;         // bits covered by the once-per-frame analog fields
+	ioport_value            analogbits;         // their combined value, valid until the next frame
+	bool                    analogvalid;        // true if analogbits is current
 };
 
 
@@ -1389,6 +1395,9 @@ public:
 	running_machine &machine() const noexcept { return m_machine; }
 	const ioport_list &ports() const noexcept { return m_portlist; }
 	bool safe_to_read() const noexcept { return m_safe_to_read; }
+
+	// with late input, the first port read of a frame polls and updates input
+	void late_poll() { if (m_late_pending) late_frame_update(); }
 	natural_keyboard &natkeyboard() noexcept { assert(m_natkeyboard != nullptr); return *m_natkeyboard; }
 
 	// type helpers
@@ -1415,6 +1424,8 @@ private:
 
 	void frame_update_callback();
 	void frame_update();
+	void late_frame_update();
+	bool late_input_usable();
 
 	ioport_port *port(const char *tag) const { if (tag) { auto search = m_portlist.find(tag); if (search != m_portlist.end()) return search->second.get(); else return nullptr; } else return nullptr; }
 	void exit();
@@ -1465,6 +1476,10 @@ private:
 	attotime                m_last_frame_time;      // time of the last frame callback
 	attoseconds_t           m_last_delta_nsec;      // nanoseconds that passed since the previous callback
 
+	// late input polling
+	bool                    m_late_input;           // late polling requested
+	bool                    m_late_pending;         // this frame's input update has not happened yet
+
 	// playback/record information
 	emu_file                m_record_file;          // recording file (nullptr if not recording)
 	emu_file                m_playback_file;        // playback file (nullptr if not recording)
@@ -81,8 +81,13 @@
 #include "debug/debugcpu.h"
 #include "dirtc.h"
 #include "image.h"
+#include "memusage.h"
+#include "netplay.h"
+#include "frametiming.h"
+#include "httpmem.h"
 #include "network.h"
 #include "romload.h"
+#include "startuptiming.h"
 #include "tilemap.h"
 #include "ui/uimain.h"
 #include <ctime>
@@ -126,6 +131,15 @@ running_machine::running_machine(const machine_config &_config, machine_manager
 		m_saveload_schedule(saveload_schedule::NONE),
 		m_saveload_schedule_time(attotime::zero),
 		m_saveload_searchpath(nullptr),
+		m_runahead_frames(0),
+		m_runahead_count(0),
+		m_runahead_pending(false),
+		m_running_ahead(false),
+		m_startup_queue(nullptr),
+		m_writeback_queue(nullptr),
+		m_writeback_failures(0),
+		m_nvram_checkpoint_period(0),
+		m_nvram_checkpoint_time(0),
 
 		m_save(*this),
 		m_memory(*this),
@@ -156,6 +170,20 @@ running_machine::running_machine(const machine_config &_config, machine_manager
 
 running_machine::~running_machine()
 {
+	wait_writeback();
+	if (m_writeback_queue != nullptr)
+		osd_work_queue_free(m_writeback_queue);
+
+	static char const *const names[] = { "device", "save" };
+	static_assert(ARRAY_LENGTH(names) == int(machine_arena::category::COUNT), "arena category names out of step");
+	for (int cat = 0; cat < int(machine_arena::category::COUNT); cat++)
+	{
+		machine_arena::counters const &stats = m_arena.stats(machine_arena::category(cat));
+		if (stats.objects != 0)
+			osd_printf_verbose("Arena: %u %s objects, %u bytes\n", unsigned(stats.objects), names[cat], unsigned(stats.bytes));
+	}
+	if (m_arena.reserved() != 0)
+		osd_printf_verbose("Arena: %u bytes reserved\n", unsigned(m_arena.reserved()));
 }
 
 
@@ -202,11 +230,17 @@ void running_machine::start()
 	m_ui_input = make_unique_clear<ui_input_manager>(*this);
 
 	// init the osd layer
-	m_manager.osd().init(*this);
+	{
+		startup_timing_log::scope phase(m_startup_timing.get(), "phase", "OSD init");
+		m_manager.osd().init(*this);
+	}
 
 	// create the video manager
-	m_video = std::make_unique<video_manager>(*this);
-	m_ui = manager().create_ui(*this);
+	{
+		startup_timing_log::scope phase(m_startup_timing.get(), "phase", "video and UI init");
+		m_video = std::make_unique<video_manager>(*this);
+		m_ui = manager().create_ui(*this);
+	}
 
 	// initialize the base time (needed for doing record/playback)
 	::time(&m_base_time);
@@ -214,9 +248,12 @@ void running_machine::start()
 	// initialize the input system and input ports for the game
 	// this must be done before memory_init in order to allow specifying
 	// callbacks based on input port tags
-	time_t newbase = m_ioport.initialize();
-	if (newbase != 0)
-		m_base_time = newbase;
+	{
+		startup_timing_log::scope phase(m_startup_timing.get(), "phase", "input port init");
+		time_t newbase = m_ioport.initialize();
+		if (newbase != 0)
+			m_base_time = newbase;
+	}
 
 	// initialize the streams engine before the sound devices start
 	m_sound = std::make_unique<sound_manager>(*this);
@@ -230,8 +267,14 @@ void running_machine::start()
 	// needs rom bases), and finally initialize CPUs (which needs
 	// complete address spaces).  These operations must proceed in this
 	// order
-	m_rom_load = make_unique_clear<rom_load_manager>(*this);
-	m_memory.initialize();
+	{
+		startup_timing_log::scope phase(m_startup_timing.get(), "phase", "ROM load");
+		m_rom_load = make_unique_clear<rom_load_manager>(*this);
+	}
+	{
+		startup_timing_log::scope phase(m_startup_timing.get(), "phase", "memory init");
+		m_memory.initialize();
+	}
 
 	// save the random seed or save states might be broken in drivers that use the rand() method
 	save().save_item(NAME(m_rand_seed));
@@ -249,7 +292,27 @@ void running_machine::start()
 		m_debugger = std::make_unique<debugger_manager>(*this);
 	}
 
-	manager().create_custom(*this);
+	// set up netplay, which needs the debugger for its statistics command
+	m_netplay = std::make_unique<netplay_manager>(*this);
+
+	// run ahead of the real frame if requested and possible
+	m_runahead_frames = options().runahead();
+	if (m_runahead_frames != 0)
+	{
+		if ((m_system.flags & MACHINE_SUPPORTS_SAVE) == 0)
+			disable_runahead("system does not support save states");
+		else if (m_netplay->enabled())
+			disable_runahead("not available during netplay");
+		else if ((debug_flags & DEBUG_FLAG_ENABLED) != 0)
+			disable_runahead("not available with the debugger");
+		else
+			add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&running_machine::runahead_frame, this));
+	}
+
+	{
+		startup_timing_log::scope phase(m_startup_timing.get(), "phase", "frontend init");
+		manager().create_custom(*this);
+	}
 
 	// resolve objects that are created by memory maps
 	for (device_t &device : device_iterator(root_device()))
@@ -258,17 +321,48 @@ void running_machine::start()
 	// register callbacks for the devices, then start them
 	add_notifier(MACHINE_NOTIFY_RESET, machine_notify_delegate(&running_machine::reset_all_devices, this));
 	add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&running_machine::stop_all_devices, this));
+	if (options().schedstats()[0] != 0)
+	{
+		// collect scheduler statistics and write them out when we're done
+		m_scheduler.enable_statistics();
+		add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&device_scheduler::write_statistics_file, &m_scheduler));
+	}
+
+	// account for memory use, reporting at exit before the devices stop
+	m_memory_usage = std::make_unique<memory_usage_manager>(*this);
+	m_memory_usage->add_source("save state", root_device(), "run-ahead", [this] () { return m_runahead_state.size() + (m_runahead_dirty.size() / 8); });
+	m_memory_usage->add_source("save state", root_device(), "warm restart", [this] () { return m_warm_state.size(); });
+	m_memory_usage->add_source("save state", root_device(), "rewind", [this] () { return m_save.rewind() ? m_save.rewind()->allocated_bytes() : 0; });
+	m_memory_usage->add_source("save state", root_device(), "netplay", [this] () { return m_netplay->snapshot_bytes(); });
+	if (options().bench_log()[0] != 0)
+	{
+		// log the timing of every frame
+		auto file = std::make_unique<emu_file>(OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+		if (file->open(options().bench_log()) != osd_file::error::NONE)
+			osd_printf_error("Unable to open benchmark log file %s\n", options().bench_log());
+		else
+			m_frame_timing = std::make_unique<frame_timing_log>(*this, std::move(file), attotime::from_double(options().bench_warmup()));
+	}
 	save().register_presave(save_prepost_delegate(FUNC(running_machine::presave_all_devices), this));
-	start_all_devices();
+	{
+		startup_timing_log::scope phase(m_startup_timing.get(), "phase", "device start");
+		start_all_devices();
+	}
 	save().register_postload(save_prepost_delegate(FUNC(running_machine::postload_all_devices), this));
 
+	// now that memory is fully mapped, watch shared memory if using adaptive interleave
+	m_scheduler.start_adaptive_quantum();
+
 	// save outputs created before start time
 	output().register_save();
 
 	m_render->resolve_tags();
 
 	// load cheat files
-	manager().load_cheatfiles(*this);
+	{
+		startup_timing_log::scope phase(m_startup_timing.get(), "phase", "cheat load");
+		manager().load_cheatfiles(*this);
+	}
 
 	// start recording movie if specified
 	const char *filename = options().mng_write();
@@ -279,6 +373,10 @@ void running_machine::start()
 	if (filename[0] != 0 && !m_video->is_recording())
 		m_video->begin_recording(filename, movie_recording::format::AVI);
 
+	filename = options().y4m_write();
+	if (filename[0] != 0 && !m_video->is_recording())
+		m_video->begin_recording(filename, movie_recording::format::Y4M);
+
 	// if we're coming in with a savegame request, process it now
 	const char *savegame = options().state();
 	if (savegame[0] != 0)
@@ -328,20 +426,43 @@ int running_machine::run(bool quiet)
 				throw emu_fatalerror("running_machine::run: unable to open debug.log file");
 		}
 
+		// time startup if requested
+		if (options().startup_log()[0] != 0)
+		{
+			auto file = std::make_unique<emu_file>(OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+			if (file->open(options().startup_log()) != osd_file::error::NONE)
+				osd_printf_error("Unable to open startup log file %s\n", options().startup_log());
+			else
+				m_startup_timing = std::make_unique<startup_timing_log>(std::move(file));
+		}
+
 		// then finish setting up our local machine
-		start();
+		{
+			startup_timing_log::scope phase(m_startup_timing.get(), "phase", "machine start");
+			start();
+		}
 
 		// load the configuration settings
-		manager().before_load_settings(*this);
-		m_configuration->load_settings();
+		{
+			startup_timing_log::scope phase(m_startup_timing.get(), "phase", "configuration load");
+			manager().before_load_settings(*this);
+			m_configuration->load_settings();
+		}
 
 		// disallow save state registrations starting here.
 		// Don't do it earlier, config load can create network
 		// devices with timers.
 		m_save.allow_registration(false);
 
+		// keep the state as the devices left it, to hard reset without tearing down
+		if (options().warm_restart())
+			capture_warm_state();
+
 		// load the NVRAM
-		nvram_load();
+		{
+			startup_timing_log::scope phase(m_startup_timing.get(), "phase", "NVRAM load");
+			nvram_load();
+		}
 
 		// set the time on RTCs (this may overwrite parts of NVRAM)
 		set_rtc_datetime(system_time(m_base_time));
@@ -352,18 +473,33 @@ int running_machine::run(bool quiet)
 
 		// initialize ui lists
 		// display the startup screens
-		manager().ui_initialize(*this);
+		{
+			startup_timing_log::scope phase(m_startup_timing.get(), "phase", "UI lists");
+			manager().ui_initialize(*this);
+		}
 
 		// perform a soft reset -- this takes us to the running phase
-		soft_reset();
+		{
+			startup_timing_log::scope phase(m_startup_timing.get(), "phase", "reset");
+			soft_reset();
+		}
 
 		// handle initial load
 		if (m_saveload_schedule != saveload_schedule::NONE)
+		{
+			startup_timing_log::scope phase(m_startup_timing.get(), "phase", "state load");
 			handle_saveload();
+		}
+
+		// startup is over; write out the timings
+		m_startup_timing.reset();
 
 		export_http_api();
 
 		m_hard_reset_pending = false;
+		if (options().nvram_save() && (options().nvram_checkpoint() > 0))
+			m_nvram_checkpoint_period = osd_ticks_per_second() * options().nvram_checkpoint();
+		m_nvram_checkpoint_time = osd_ticks();
 
 #if defined(__EMSCRIPTEN__)
 		// break out to our async javascript loop and halt
@@ -382,10 +518,30 @@ int running_machine::run(bool quiet)
 			else
 				m_video->frame_update();
 
+			// take netplay snapshots and roll back between timeslices
+			if (!m_paused)
+				m_netplay->update();
+
+			// take and load reverse execution snapshots likewise
+			if (!m_paused && (debug_flags & DEBUG_FLAG_ENABLED) != 0)
+				m_debugger->cpu().reverse_update();
+
+			// show the future of a frame that has just begun
+			if (m_runahead_pending && !m_paused)
+				run_ahead();
+
 			// handle save/load
 			if (m_saveload_schedule != saveload_schedule::NONE)
 				handle_saveload();
 
+			// restart in place if we can and the configuration hasn't changed
+			if (m_hard_reset_pending && !m_exit_pending && !m_warm_state.empty() && (warm_restart_config() == m_warm_config) && warm_restart())
+				m_hard_reset_pending = false;
+
+			// save changed NVRAM now and then in case we don't get to exit cleanly
+			if (m_nvram_checkpoint_period && ((osd_ticks() - m_nvram_checkpoint_time) >= m_nvram_checkpoint_period))
+				nvram_save();
+
 			g_profiler.stop();
 		}
 		m_manager.http()->clear();
@@ -398,6 +554,7 @@ int running_machine::run(bool quiet)
 		if (options().nvram_save())
 			nvram_save();
 		m_configuration->save_settings();
+		wait_writeback();
 	}
 	catch (emu_fatalerror &fatal)
 	{
@@ -739,6 +896,164 @@ void running_machine::rewind_invalidate()
 }
 
 
+//-------------------------------------------------
+//  runahead_frame - count frame boundaries for
+//  run-ahead
+//-------------------------------------------------
+
+void running_machine::runahead_frame()
+{
+	m_runahead_count++;
+	if (m_runahead_frames != 0 && !m_running_ahead)
+		m_runahead_pending = true;
+}
+
+
+//-------------------------------------------------
+//  run_ahead - snapshot the machine, emulate a
+//  few frames with the current input showing
+//  only the last, then restore; the real frames
+//  are heard but never shown, so games that act
+//  on input a frame or two late respond at once
+//-------------------------------------------------
+
+void running_machine::run_ahead()
+{
+	m_runahead_pending = false;
+
+	// we can only come back if the machine can be saved right now
+	if (!m_scheduler.can_save())
+	{
+		disable_runahead("system uses anonymous timers");
+		return;
+	}
+	m_runahead_state.resize(ram_state::get_size(m_save));
+	if (m_save.update_buffer(&m_runahead_state[0], m_runahead_state.size(), m_runahead_dirty) != STATERR_NONE)
+	{
+		disable_runahead("unable to save state");
+		return;
+	}
+
+	// input ports keep their values, and nothing is heard
+	m_running_ahead = true;
+	m_sound->set_speculative(true);
+	u32 const start = m_runahead_count;
+	while (u32(m_runahead_count - start) < u32(m_runahead_frames))
+	{
+		// show the last frame only
+		if (u32(m_runahead_count - start) == u32(m_runahead_frames - 1))
+			m_video->set_speculative(false);
+		m_scheduler.timeslice();
+	}
+	m_video->set_speculative(true);
+
+	// return to the real timeline
+	save_error const error = m_save.read_buffer(&m_runahead_state[0], m_runahead_state.size());
+	m_sound->set_speculative(false);
+	m_running_ahead = false;
+	if (error != STATERR_NONE)
+		disable_runahead("unable to restore state");
+}
+
+
+//-------------------------------------------------
+//  disable_runahead - go back to showing the real
+//  frames
+//-------------------------------------------------
+
+void running_machine::disable_runahead(const char *reason)
+{
+	osd_printf_warning("Run-ahead disabled: %s\n", reason);
+	m_runahead_frames = 0;
+	m_runahead_pending = false;
+	if (m_video)
+		m_video->set_speculative(false);
+}
+
+
+//-------------------------------------------------
+//  capture_warm_state - remember the state from
+//  just after startup, before NVRAM and reset
+//-------------------------------------------------
+
+void running_machine::capture_warm_state()
+{
+	// the state has to capture everything, and input recordings need a fresh start
+	if (!(m_system.flags & MACHINE_SUPPORTS_SAVE) || !m_scheduler.can_save())
+	{
+		osd_printf_verbose("Warm restart not available: system does not fully support save states\n");
+		return;
+	}
+	if (options().playback()[0] != 0 || options().record()[0] != 0)
+	{
+		osd_printf_verbose("Warm restart not available while recording or playing back input\n");
+		return;
+	}
+
+	m_warm_state.resize(ram_state::get_size(m_save));
+	if (m_save.write_buffer(&m_warm_state[0], m_warm_state.size()) != STATERR_NONE)
+	{
+		osd_printf_warning("Warm restart not available: unable to save state\n");
+		m_warm_state.clear();
+	}
+	m_warm_config = warm_restart_config();
+}
+
+
+//-------------------------------------------------
+//  warm_restart_config - describe the options a
+//  hard reset has to start from scratch for if
+//  they change
+//-------------------------------------------------
+
+std::string running_machine::warm_restart_config() const
+{
+	std::string result = util::string_format("%s;%s;%s", options().system_name(), options().bios(), options().software_name());
+	for (device_slot_interface &slot : slot_interface_iterator(root_device()))
+	{
+		const ::slot_option *opt = options().find_slot_option(slot.slot_name());
+		result.append(util::string_format(";%s=%s", slot.slot_name(), opt ? opt->value() : std::string()));
+	}
+	for (device_image_interface &image : image_interface_iterator(root_device()))
+	{
+		if (options().has_image_option(image.instance_name()))
+			result.append(util::string_format(";%s=%s", image.instance_name(), options().image_option(image.instance_name()).value()));
+	}
+	return result;
+}
+
+
+//-------------------------------------------------
+//  warm_restart - hard reset by going back to the
+//  state captured at startup; ROMs, decoded
+//  graphics, compiled code and layouts are kept,
+//  just as they are across a state load
+//-------------------------------------------------
+
+bool running_machine::warm_restart()
+{
+	logerror("Warm restart\n");
+
+	// NVRAM goes out and comes back in, as it would across a full restart
+	if (options().nvram_save())
+		nvram_save();
+	if (m_save.read_buffer(&m_warm_state[0], m_warm_state.size()) != STATERR_NONE)
+	{
+		osd_printf_warning("Unable to restore startup state; restarting fully\n");
+		m_warm_state.clear();
+		return false;
+	}
+	rewind_invalidate();
+	nvram_load();
+
+	::time(&m_base_time);
+	set_rtc_datetime(system_time(m_base_time));
+
+	soft_reset();
+	return true;
+}
+
+
 //-------------------------------------------------
 //  pause - pause the system
 //-------------------------------------------------
@@ -1041,45 +1356,220 @@ void running_machine::start_all_devices()
 {
 	m_dummy_space.start();
 
+	// devices may hand work off to this while starting
+	if (options().parallel_start())
+		m_startup_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+
 	// iterate through the devices
 	int last_failed_starts = -1;
-	while (last_failed_starts != 0)
+	try
 	{
-		// iterate over all devices
-		int failed_starts = 0;
-		for (device_t &device : device_iterator(root_device()))
-			if (!device.started())
-			{
-				// attempt to start the device, catching any expected exceptions
-				try
+		while (last_failed_starts != 0)
+		{
+			// iterate over all devices
+			int failed_starts = 0;
+			for (device_t &device : device_iterator(root_device()))
+				if (!device.started())
 				{
-					// if the device doesn't have a machine yet, set it first
-					if (device.m_machine == nullptr)
-						device.set_machine(*this);
+					// attempt to start the device, catching any expected exceptions
+					try
+					{
+						// if the device doesn't have a machine yet, set it first
+						if (device.m_machine == nullptr)
+							device.set_machine(*this);
+
+						// now start the device
+						osd_printf_verbose("Starting %s '%s'\n", device.name(), device.tag());
+						startup_timing_log::scope timing(m_startup_timing.get(), "device_start", device.name(), device.tag());
+						device.start();
+					}
 
-					// now start the device
-					osd_printf_verbose("Starting %s '%s'\n", device.name(), device.tag());
-					device.start();
+					// handle missing dependencies by moving the device to the end
+					catch (device_missing_dependencies &)
+					{
+						// if we're the end, fail
+						osd_printf_verbose("  (missing dependencies; rescheduling)\n");
+						failed_starts++;
+					}
 				}
 
-				// handle missing dependencies by moving the device to the end
-				catch (device_missing_dependencies &)
-				{
-					// if we're the end, fail
-					osd_printf_verbose("  (missing dependencies; rescheduling)\n");
-					failed_starts++;
-				}
-			}
+			// each iteration should reduce the number of failed starts; error if
+			// this doesn't happen
+			if (failed_starts == last_failed_starts)
+				throw emu_fatalerror("Circular dependency in device startup!");
+			last_failed_starts = failed_starts;
+		}
+	}
+	catch (...)
+	{
+		// the work may still be touching devices, so let it finish before unwinding
+		finish_startup_work();
+		throw;
+	}
+
+	// nothing is reset until every device's work is done
+	std::exception_ptr const error = finish_startup_work();
+	if (error)
+		std::rethrow_exception(error);
+}
 
-		// each iteration should reduce the number of failed starts; error if
-		// this doesn't happen
-		if (failed_starts == last_failed_starts)
-			throw emu_fatalerror("Circular dependency in device startup!");
-		last_failed_starts = failed_starts;
+
+//-------------------------------------------------
+//  add_startup_work - run work for a device that
+//  is starting, on a worker thread if allowed;
+//  it must only touch the device's own state, as
+//  it may still be running while other devices
+//  start, and it is finished before any device is
+//  reset
+//-------------------------------------------------
+
+void running_machine::add_startup_work(std::function<void ()> &&work)
+{
+	assert(m_current_phase == machine_phase::INIT);
+
+	m_startup_work.push_back(startup_work{ std::move(work), nullptr });
+	startup_work &item = m_startup_work.back();
+	if (m_startup_queue == nullptr || osd_work_item_queue(m_startup_queue, startup_work_static, &item, WORK_ITEM_FLAG_AUTO_RELEASE) == nullptr)
+	{
+		// no queue, or it couldn't take it: do it here
+		startup_work_static(&item, 0);
 	}
 }
 
 
+//-------------------------------------------------
+//  startup_work_static - run one piece of startup
+//  work, keeping what it throws for the starting
+//  thread
+//-------------------------------------------------
+
+void *running_machine::startup_work_static(void *param, int threadid)
+{
+	startup_work &item = *reinterpret_cast<startup_work *>(param);
+	try
+	{
+		item.func();
+	}
+	catch (...)
+	{
+		item.error = std::current_exception();
+	}
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  finish_startup_work - wait for the work devices
+//  handed off while starting, and return the
+//  first error it raised
+//-------------------------------------------------
+
+std::exception_ptr running_machine::finish_startup_work()
+{
+	if (m_startup_queue != nullptr)
+	{
+		while (!osd_work_queue_wait(m_startup_queue, osd_ticks_per_second()))
+		{
+		}
+		osd_work_queue_free(m_startup_queue);
+		m_startup_queue = nullptr;
+	}
+
+	std::exception_ptr error;
+	for (startup_work &item : m_startup_work)
+		if (item.error && !error)
+			error = item.error;
+	m_startup_work.clear();
+	return error;
+}
+
+
+//-------------------------------------------------
+//  queue_writeback - hand a file's contents to a
+//  worker thread to write out
+//-------------------------------------------------
+
+void running_machine::queue_writeback(const char *searchpath, std::string &&name, std::vector<u8> &&data)
+{
+	if (m_writeback_queue == nullptr)
+		m_writeback_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+
+	auto item = std::make_unique<writeback_item>(writeback_item{ this, searchpath, std::move(name), std::move(data) });
+	if (m_writeback_queue != nullptr && osd_work_item_queue(m_writeback_queue, writeback_static, item.get(), WORK_ITEM_FLAG_AUTO_RELEASE) != nullptr)
+		item.release();
+	else
+		writeback_static(item.release(), 0);
+}
+
+
+//-------------------------------------------------
+//  wait_writeback - wait for queued files to be
+//  written, and report any that couldn't be
+//-------------------------------------------------
+
+void running_machine::wait_writeback()
+{
+	if (m_writeback_queue != nullptr)
+	{
+		while (!osd_work_queue_wait(m_writeback_queue, osd_ticks_per_second()))
+		{
+		}
+	}
+
+	unsigned const failures = m_writeback_failures.exchange(0);
+	if (failures != 0)
+		osd_printf_error("Unable to save %u NVRAM or configuration file(s)\n", failures);
+}
+
+
+//-------------------------------------------------
+//  writeback_static - write one file, through a
+//  temporary file so a crash part way through
+//  leaves the old one intact
+//-------------------------------------------------
+
+void *running_machine::writeback_static(void *param, int threadid)
+{
+	std::unique_ptr<writeback_item> const item(reinterpret_cast<writeback_item *>(param));
+
+	// leave the file alone if it already holds this
+	{
+		emu_file existing(item->searchpath, OPEN_FLAG_READ);
+		if ((existing.open(item->name) == osd_file::error::NONE) && (existing.size() == item->data.size()))
+		{
+			std::vector<u8> current(item->data.size());
+			if (current.empty() || ((existing.read(&current[0], current.size()) == current.size()) && (current == item->data)))
+				return nullptr;
+		}
+	}
+
+	emu_file file(item->searchpath, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(item->name + ".new") != osd_file::error::NONE)
+	{
+		item->machine->m_writeback_failures++;
+		return nullptr;
+	}
+	bool const written = item->data.empty() || (file.write(&item->data[0], item->data.size()) == item->data.size());
+	std::string const temp = file.fullpath();
+	file.close();
+
+	// renaming over the old file is atomic where the host allows it
+	std::string const target = temp.substr(0, temp.length() - 4);
+	bool replaced = written && (std::rename(temp.c_str(), target.c_str()) == 0);
+	if (written && !replaced)
+	{
+		osd_file::remove(target);
+		replaced = (std::rename(temp.c_str(), target.c_str()) == 0);
+	}
+	if (!replaced)
+	{
+		osd_file::remove(temp);
+		item->machine->m_writeback_failures++;
+	}
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  reset_all_devices - reset all devices in the
 //  hierarchy
@@ -1181,6 +1671,9 @@ std::string running_machine::nvram_filename(device_t &device) const
 
 void running_machine::nvram_load()
 {
+	// anything still being written has to land first
+	wait_writeback();
+
 	for (device_nvram_interface &nvram : nvram_interface_iterator(root_device()))
 	{
 		emu_file file(options().nvram_directory(), OPEN_FLAG_READ);
@@ -1188,9 +1681,19 @@ void running_machine::nvram_load()
 		{
 			nvram.nvram_load(file);
 			file.close();
+
+			// remember what was loaded, so it isn't written back unchanged
+			std::vector<u8> data;
+			if (nvram.nvram_can_save() && nvram_contents(nvram, data))
+				nvram.nvram_set_stored(util::sha1_creator::simple(data.empty() ? nullptr : &data[0], data.size()));
+			else
+				nvram.nvram_set_unstored();
 		}
 		else
+		{
 			nvram.nvram_reset();
+			nvram.nvram_set_unstored();
+		}
 	}
 }
 
@@ -1201,21 +1704,43 @@ void running_machine::nvram_load()
 
 void running_machine::nvram_save()
 {
+	m_nvram_checkpoint_time = osd_ticks();
 	for (device_nvram_interface &nvram : nvram_interface_iterator(root_device()))
 	{
-		if (nvram.nvram_can_save())
+		// only what has changed since it was loaded or last saved goes out, in the background
+		std::vector<u8> data;
+		if (nvram.nvram_can_save() && nvram_contents(nvram, data))
 		{
-			emu_file file(options().nvram_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
-			if (file.open(nvram_filename(nvram.device())) == osd_file::error::NONE)
+			util::sha1_t const hash = util::sha1_creator::simple(data.empty() ? nullptr : &data[0], data.size());
+			if (nvram.nvram_changed(hash))
 			{
-				nvram.nvram_save(file);
-				file.close();
+				queue_writeback(options().nvram_directory(), nvram_filename(nvram.device()), std::move(data));
+				nvram.nvram_set_stored(hash);
 			}
 		}
 	}
 }
 
 
+/*-------------------------------------------------
+    nvram_contents - write a device's NVRAM into
+    memory
+-------------------------------------------------*/
+
+bool running_machine::nvram_contents(device_nvram_interface &nvram, std::vector<u8> &data)
+{
+	emu_file file(OPEN_FLAG_WRITE);
+	if (file.open_ram_write() != osd_file::error::NONE)
+		return false;
+	nvram.nvram_save(file);
+
+	util::core_file &contents(file);
+	u8 const *const bytes = reinterpret_cast<u8 const *>(contents.buffer());
+	data.assign(bytes, bytes + contents.size());
+	return true;
+}
+
+
 //**************************************************************************
 //  OUTPUT
 //**************************************************************************
@@ -1280,6 +1805,8 @@ void running_machine::export_http_api()
 			response->set_content_type("application/json");
 			response->set_body(s.GetString());
 		});
+
+		m_http_memory = std::make_unique<http_memory_feed>(*this);
 	}
 }
 
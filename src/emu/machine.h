@@ -17,6 +17,8 @@
 #ifndef MAME_EMU_MACHINE_H
 #define MAME_EMU_MACHINE_H
 
+#include <atomic>
+#include <exception>
 #include <functional>
 
 #include <ctime>
@@ -154,6 +156,7 @@ class running_machine
 
 	// must be at top of member variables
 	resource_pool           m_respool;              // pool of resources for this machine
+	machine_arena           m_arena;                // objects that live as long as this machine
 
 public:
 	// construction/destruction
@@ -167,6 +170,7 @@ public:
 	osd_interface &osd() const;
 	machine_manager &manager() const { return m_manager; }
 	resource_pool &respool() { return m_respool; }
+	machine_arena &arena() { return m_arena; }
 	device_scheduler &scheduler() { return m_scheduler; }
 	save_manager &save() { return m_save; }
 	memory_manager &memory() { return m_memory; }
@@ -177,6 +181,10 @@ public:
 	sound_manager &sound() const { assert(m_sound != nullptr); return *m_sound; }
 	video_manager &video() const { assert(m_video != nullptr); return *m_video; }
 	network_manager &network() const { assert(m_network != nullptr); return *m_network; }
+	netplay_manager &netplay() const { assert(m_netplay != nullptr); return *m_netplay; }
+	memory_usage_manager &memory_usage() const { assert(m_memory_usage != nullptr); return *m_memory_usage; }
+	frame_timing_log *frame_timing() const { return m_frame_timing.get(); }
+	startup_timing_log *startup_timing() const { return m_startup_timing.get(); }
 	bookkeeping_manager &bookkeeping() const { assert(m_network != nullptr); return *m_bookkeeping; }
 	configuration_manager  &configuration() const { assert(m_configuration != nullptr); return *m_configuration; }
 	output_manager  &output() const { assert(m_output != nullptr); return *m_output; }
@@ -193,8 +201,10 @@ public:
 	bool paused() const { return m_paused || (m_current_phase != machine_phase::RUNNING); }
 	bool exit_pending() const { return m_exit_pending; }
 	bool hard_reset_pending() const { return m_hard_reset_pending; }
+	bool running_ahead() const { return m_running_ahead; }
 	bool ui_active() const { return m_ui_active; }
 	const std::string &basename() const { return m_basename; }
+	std::string nvram_filename(device_t &device) const;
 	int sample_rate() const { return m_sample_rate; }
 	bool save_or_load_pending() const { return !m_saveload_pending_file.empty(); }
 
@@ -246,6 +256,13 @@ public:
 	void current_datetime(system_time &systime);
 	void set_rtc_datetime(const system_time &systime);
 
+	// hand off self-contained work (e.g. building large tables) from device_start
+	void add_startup_work(std::function<void ()> &&work);
+
+	// write a file out in the background, replacing it only if the contents differ
+	void queue_writeback(const char *searchpath, std::string &&name, std::vector<u8> &&data);
+	void wait_writeback();
+
 	// misc
 	address_space &dummy_space() const { return m_dummy_space.space(AS_PROGRAM); }
 	void popmessage() const { popmessage(static_cast<char const *>(nullptr)); }
@@ -298,10 +315,16 @@ private:
 	void start();
 	void set_saveload_filename(std::string &&filename);
 	void handle_saveload();
+	void runahead_frame();
+	void run_ahead();
+	void disable_runahead(const char *reason);
+	void capture_warm_state();
+	std::string warm_restart_config() const;
+	bool warm_restart();
 	void soft_reset(void *ptr = nullptr, s32 param = 0);
-	std::string nvram_filename(device_t &device) const;
 	void nvram_load();
 	void nvram_save();
+	static bool nvram_contents(device_nvram_interface &nvram, std::vector<u8> &data);
 	void popup_clear() const;
 	void popup_message(util::format_argument_pack<std::ostream> const &args) const;
 
@@ -312,6 +335,9 @@ private:
 	void start_all_devices();
 	void reset_all_devices();
 	void stop_all_devices();
+	std::exception_ptr finish_startup_work();
+	static void *startup_work_static(void *param, int threadid);
+	static void *writeback_static(void *param, int threadid);
 	void presave_all_devices();
 	void postload_all_devices();
 
@@ -329,6 +355,11 @@ private:
 	std::unique_ptr<tilemap_manager> m_tilemap;        // internal data from tilemap.cpp
 	std::unique_ptr<debug_view_manager> m_debug_view;  // internal data from debugvw.cpp
 	std::unique_ptr<network_manager> m_network;        // internal data from network.cpp
+	std::unique_ptr<netplay_manager> m_netplay;        // internal data from netplay.cpp
+	std::unique_ptr<memory_usage_manager> m_memory_usage; // internal data from memusage.cpp
+	std::unique_ptr<frame_timing_log> m_frame_timing;  // internal data from frametiming.cpp
+	std::unique_ptr<startup_timing_log> m_startup_timing; // internal data from startuptiming.cpp, while starting up
+	std::unique_ptr<http_memory_feed> m_http_memory;   // internal data from httpmem.cpp
 	std::unique_ptr<bookkeeping_manager> m_bookkeeping;// internal data from bookkeeping.cpp
 	std::unique_ptr<configuration_manager> m_configuration; // internal data from config.cpp
 	std::unique_ptr<output_manager> m_output;          // internal data from output.cpp
@@ -365,6 +396,40 @@ private:
 	std::string             m_saveload_pending_file;
 	const char *            m_saveload_searchpath;
 
+	// run-ahead
+	int                     m_runahead_frames;      // frames emulated beyond the real one, 0 if disabled
+	u32                     m_runahead_count;       // frame boundaries passed
+	bool                    m_runahead_pending;     // a real frame began during the last timeslice
+	bool                    m_running_ahead;        // emulating frames that will be undone
+	std::vector<u8>         m_runahead_state;       // snapshot of the real timeline
+	std::vector<bool>       m_runahead_dirty;       // scratch for incremental snapshots
+
+	// warm restart
+	std::vector<u8>         m_warm_state;           // state just after startup, empty if hard resets tear down
+	std::string             m_warm_config;          // system, BIOS, slots and media the state was captured with
+
+	// work handed off by devices while starting
+	struct startup_work
+	{
+		std::function<void ()>  func;               // the work itself
+		std::exception_ptr      error;              // what it threw, if anything
+	};
+	osd_work_queue *        m_startup_queue;        // queue running it, while devices are starting
+	std::list<startup_work> m_startup_work;         // everything queued so far
+
+	// NVRAM and configuration written out in the background
+	struct writeback_item
+	{
+		running_machine *       machine;            // machine to report failures to
+		std::string             searchpath;         // directory to write to
+		std::string             name;               // file name within it
+		std::vector<u8>         data;               // complete contents
+	};
+	osd_work_queue *        m_writeback_queue;      // serial queue doing the writing
+	std::atomic<unsigned>   m_writeback_failures;   // files that couldn't be written since the last wait
+	osd_ticks_t             m_nvram_checkpoint_period; // how often to save NVRAM while running, 0 for never
+	osd_ticks_t             m_nvram_checkpoint_time;   // when NVRAM was last saved
+
 	// notifier callbacks
 	struct notifier_callback_item
 	{
@@ -10,6 +10,7 @@
 
 #include "emu.h"
 #include "emuopts.h"
+#include "romload.h"
 #include "screen.h"
 
 #include <cctype>
@@ -46,6 +47,7 @@ machine_config::machine_config(const game_driver &gamedrv, emu_options &options)
 	, m_current_device(nullptr)
 	, m_maximum_quantums([] (char const *a, char const *b) { return 0 > std::strcmp(a, b); })
 	, m_perfect_quantum_device(nullptr, "")
+	, m_tag_index_valid(false)
 {
 	// add the root device
 	device_add("root", gamedrv.type, 0);
@@ -311,6 +313,7 @@ std::tuple<const char *, device_t *, device_t *> machine_config::prepare_replace
 device_t &machine_config::add_device(std::unique_ptr<device_t> &&device, device_t *owner)
 {
 	current_device_stack const context(*this);
+	invalidate_tag_index();
 	if (owner)
 	{
 		// allocate the new device and append it to the owner's list
@@ -337,6 +340,7 @@ device_t &machine_config::add_device(std::unique_ptr<device_t> &&device, device_
 device_t &machine_config::replace_device(std::unique_ptr<device_t> &&device, device_t &owner, device_t *existing)
 {
 	current_device_stack const context(*this);
+	invalidate_tag_index();
 	device_t &result(existing
 			? owner.subdevices().m_list.replace_and_remove(*device.release(), *existing)
 			: owner.subdevices().m_list.append(*device.release()));
@@ -382,6 +386,78 @@ void machine_config::remove_references(device_t &device)
 	// iterate over all devices and remove any references
 	for (device_t &scan : device_iterator(root_device()))
 		scan.subdevices().m_tagmap.clear();
+	invalidate_tag_index();
+}
+
+
+//-------------------------------------------------
+//  lookup_device - find a device by full tag in
+//  the index; returns false while the tree can
+//  still change, leaving the caller to walk it
+//-------------------------------------------------
+
+bool machine_config::lookup_device(std::string const &fulltag, device_t *&device) const
+{
+	if (m_current_device || !m_root_device)
+		return false;
+
+	build_tag_index();
+	auto const found = m_device_index.find(fulltag);
+	device = (m_device_index.end() != found) ? found->second : nullptr;
+	return true;
+}
+
+
+//-------------------------------------------------
+//  lookup_region - find the length of a ROM
+//  region by full tag, zero if there isn't one
+//-------------------------------------------------
+
+bool machine_config::lookup_region(std::string const &fulltag, u32 &length) const
+{
+	if (m_current_device || !m_root_device)
+		return false;
+
+	build_tag_index();
+	auto const found = m_region_index.find(fulltag);
+	length = (m_region_index.end() != found) ? found->second : 0;
+	return true;
+}
+
+
+//-------------------------------------------------
+//  build_tag_index - index every device and ROM
+//  region by full tag
+//-------------------------------------------------
+
+void machine_config::build_tag_index() const
+{
+	if (m_tag_index_valid)
+		return;
+
+	for (device_t &device : device_iterator(root_device()))
+	{
+		m_device_index.emplace(device.tag(), &device);
+		for (romload::region const &region : romload::entries(device.rom_region()).get_regions())
+		{
+			if (region.get_length() != 0)
+				m_region_index.emplace(device.subtag(region.get_tag()), region.get_length());
+		}
+	}
+	m_tag_index_valid = true;
+}
+
+
+//-------------------------------------------------
+//  invalidate_tag_index - forget the index when
+//  devices are added, replaced or removed
+//-------------------------------------------------
+
+void machine_config::invalidate_tag_index()
+{
+	m_tag_index_valid = false;
+	m_device_index.clear();
+	m_region_index.clear();
 }
 
 
@@ -17,6 +17,7 @@
 #include <tuple>
 #include <type_traits>
 #include <typeinfo>
+#include <unordered_map>
 #include <utility>
 
 
@@ -114,6 +115,10 @@ public:
 	attotime maximum_quantum(attotime const &default_quantum) const;
 	device_execute_interface *perfect_quantum_device() const;
 
+	// tag index lookups, usable once configuration is complete
+	bool lookup_device(std::string const &fulltag, device_t *&device) const;
+	bool lookup_region(std::string const &fulltag, u32 &length) const;
+
 	/// \brief Apply visitor to internal layouts
 	///
 	/// Calls the supplied visitor for each device with an internal
@@ -238,6 +243,8 @@ private:
 	device_t &replace_device(std::unique_ptr<device_t> &&device, device_t &owner, device_t *existing);
 	void remove_references(device_t &device);
 	void set_perfect_quantum(device_t &device, std::string tag);
+	void build_tag_index() const;
+	void invalidate_tag_index();
 
 	// internal state
 	game_driver const &                 m_gamedrv;
@@ -247,6 +254,11 @@ private:
 	device_t *                          m_current_device;
 	maximum_quantum_map                 m_maximum_quantums;
 	std::pair<device_t *, std::string>  m_perfect_quantum_device;
+
+	// devices and ROM regions by full tag, built on first use after configuration
+	mutable bool                        m_tag_index_valid;
+	mutable std::unordered_map<std::string, device_t *> m_device_index;
+	mutable std::unordered_map<std::string, u32> m_region_index;
 };
 
 #endif // MAME_EMU_MCONFIG_H
@@ -0,0 +1,226 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    memusage.cpp
+
+    Memory use accounting.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "memusage.h"
+
+#include "debugger.h"
+#include "debug/debugcon.h"
+
+#include <algorithm>
+
+
+
+//**************************************************************************
+//  CONSTANTS
+//**************************************************************************
+
+// frames between measurements
+static constexpr u32 MEMUSAGE_INTERVAL = 60;
+
+
+
+//**************************************************************************
+//  MEMORY USAGE MANAGER
+//**************************************************************************
+
+//-------------------------------------------------
+//  memory_usage_manager - constructor
+//-------------------------------------------------
+
+memory_usage_manager::memory_usage_manager(running_machine &machine)
+	: m_machine(machine)
+	, m_category(nullptr)
+	, m_total(0)
+	, m_peak_total(0)
+	, m_frames(MEMUSAGE_INTERVAL)
+{
+	// the allocations the core makes itself
+	add_source("region", [] (memory_usage_manager &usage)
+			{
+				for (auto &region : usage.machine().memory().regions())
+					usage.report(usage.owner(region.first), region.second->name(), region.second->bytes());
+			});
+	add_source("share", [] (memory_usage_manager &usage)
+			{
+				for (auto &share : usage.machine().memory().shares())
+					usage.report(usage.owner(share.first), share.first, share.second->bytes());
+			});
+	add_source("gfx", [] (memory_usage_manager &usage)
+			{
+				for (device_gfx_interface &gfx : gfx_interface_iterator(usage.machine().root_device()))
+					for (int index = 0; index < MAX_GFX_ELEMENTS; index++)
+						if (gfx.gfx(index) != nullptr)
+							usage.report(gfx.device(), util::string_format("gfx %d", index), gfx.gfx(index)->allocated_bytes());
+			});
+	add_source("arena", machine.root_device(), "machine arena", [&machine] () { return machine.arena().reserved(); });
+
+	machine.add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&memory_usage_manager::frame_update, this));
+	machine.add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&memory_usage_manager::exit, this));
+
+	if (machine.debug_enabled())
+	{
+		machine.debugger().console().register_command("memusage", CMDFLAG_NONE, 0, 0, 0,
+				[this] (int ref, std::vector<std::string> const &params)
+				{
+					m_machine.debugger().console().printf("%s\n", report_text());
+				});
+	}
+}
+
+
+//-------------------------------------------------
+//  ~memory_usage_manager - destructor
+//-------------------------------------------------
+
+memory_usage_manager::~memory_usage_manager()
+{
+}
+
+
+//-------------------------------------------------
+//  add_source - add something that reports
+//  allocations of its own
+//-------------------------------------------------
+
+void memory_usage_manager::add_source(const char *category, source_func &&source)
+{
+	m_sources.push_back({ category, std::move(source) });
+}
+
+void memory_usage_manager::add_source(const char *category, device_t &device, std::string &&name, std::function<size_t ()> &&bytes)
+{
+	add_source(category, [&device, name = std::move(name), bytes = std::move(bytes)] (memory_usage_manager &usage)
+			{
+				usage.report(device, name, bytes());
+			});
+}
+
+
+//-------------------------------------------------
+//  report - record one allocation for the source
+//  being measured
+//-------------------------------------------------
+
+void memory_usage_manager::report(device_t &device, std::string const &name, size_t bytes)
+{
+	assert(m_category != nullptr);
+
+	// empty buffers aren't worth listing
+	if (bytes == 0)
+		return;
+
+	size_t &peak = m_peaks[util::string_format("%s/%s/%s", m_category, device.tag(), name)];
+	peak = std::max(peak, bytes);
+	m_entries.push_back({ m_category, &device, name, bytes, peak });
+	m_total += bytes;
+}
+
+
+//-------------------------------------------------
+//  update - measure everything now
+//-------------------------------------------------
+
+void memory_usage_manager::update()
+{
+	m_entries.clear();
+	m_total = 0;
+	for (source &src : m_sources)
+	{
+		m_category = src.category;
+		src.func(*this);
+	}
+	m_category = nullptr;
+	m_peak_total = std::max(m_peak_total, m_total);
+}
+
+
+//-------------------------------------------------
+//  report_text - describe what's allocated now,
+//  by category
+//-------------------------------------------------
+
+std::string memory_usage_manager::report_text()
+{
+	update();
+
+	std::string result = util::string_format("Memory use: %u KB, peak %u KB", u32(m_total >> 10), u32(m_peak_total >> 10));
+
+	// categories in the order their sources were added, largest entries first
+	std::vector<entry> sorted(m_entries);
+	std::stable_sort(sorted.begin(), sorted.end(), [] (entry const &a, entry const &b) { return a.bytes > b.bytes; });
+	std::vector<const char *> categories;
+	for (source const &src : m_sources)
+		if (std::find_if(categories.begin(), categories.end(), [&src] (const char *category) { return !strcmp(category, src.category); }) == categories.end())
+			categories.push_back(src.category);
+	for (const char *category : categories)
+	{
+		size_t bytes = 0, peak = 0;
+		std::string lines;
+		for (entry const &ent : sorted)
+		{
+			if (strcmp(ent.category, category))
+				continue;
+			bytes += ent.bytes;
+			peak += ent.peak;
+			lines += util::string_format("\n    %-24s %-24s %8u KB, peak %8u KB", ent.device->tag(), ent.name, u32((ent.bytes + 1023) >> 10), u32((ent.peak + 1023) >> 10));
+		}
+		if (!lines.empty())
+			result += util::string_format("\n  %s: %u KB, peak %u KB", category, u32((bytes + 1023) >> 10), u32((peak + 1023) >> 10)) + lines;
+	}
+	return result;
+}
+
+
+//-------------------------------------------------
+//  frame_update - measure once in a while to
+//  catch peaks
+//-------------------------------------------------
+
+void memory_usage_manager::frame_update()
+{
+	if (--m_frames == 0)
+	{
+		m_frames = MEMUSAGE_INTERVAL;
+		update();
+	}
+}
+
+
+//-------------------------------------------------
+//  exit - log what the machine used, while the
+//  devices are still around to report
+//-------------------------------------------------
+
+void memory_usage_manager::exit()
+{
+	osd_printf_verbose("%s\n", report_text());
+}
+
+
+//-------------------------------------------------
+//  owner - find the device a region or share tag
+//  belongs to: the device with that tag, or the
+//  nearest one above it
+//-------------------------------------------------
+
+device_t &memory_usage_manager::owner(std::string const &tag) const
+{
+	std::string path(tag);
+	while (!path.empty() && path != ":")
+	{
+		device_t *const device = m_machine.root_device().subdevice(path.c_str());
+		if (device != nullptr)
+			return *device;
+		std::string::size_type const colon = path.find_last_of(':');
+		path.resize((colon == std::string::npos) ? 0 : colon);
+	}
+	return m_machine.root_device();
+}
@@ -0,0 +1,99 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    memusage.h
+
+    Memory use accounting.
+
+    Attributes the large allocations a running machine makes to the
+    device responsible and to a category: memory regions, memory shares,
+    decoded graphics, the machine arena, save state buffers (rewind,
+    run-ahead, warm restart and netplay snapshots) and recompiler code
+    caches.  Anything else that allocates a lot can add a source of its
+    own.
+
+    Everything is measured every 60 frames, so the peak of each entry is
+    known as well as its current size.  The result is
+    available from the "memusage" debugger command and from Lua, and is
+    logged when the machine exits (-verbose).
+
+***************************************************************************/
+
+#ifndef MAME_EMU_MEMUSAGE_H
+#define MAME_EMU_MEMUSAGE_H
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> memory_usage_manager
+
+class memory_usage_manager
+{
+public:
+	// one allocation, or group of allocations, attributed to a device
+	struct entry
+	{
+		const char *    category;       // what the memory is for
+		device_t *      device;         // device responsible
+		std::string     name;           // region, share or buffer name
+		size_t          bytes;          // allocated when last measured
+		size_t          peak;           // most allocated at any measurement
+	};
+
+	// calls report() for each allocation it knows about
+	typedef std::function<void (memory_usage_manager &)> source_func;
+
+	// construction/destruction
+	memory_usage_manager(running_machine &machine);
+	~memory_usage_manager();
+
+	// getters
+	running_machine &machine() const { return m_machine; }
+	std::vector<entry> const &entries() const { return m_entries; }
+	size_t total() const { return m_total; }
+	size_t peak_total() const { return m_peak_total; }
+
+	// add a source of allocations the core doesn't know about
+	void add_source(const char *category, source_func &&source);
+	void add_source(const char *category, device_t &device, std::string &&name, std::function<size_t ()> &&bytes);
+
+	// called by sources while measuring
+	void report(device_t &device, std::string const &name, size_t bytes);
+
+	// measure everything now
+	void update();
+	std::string report_text();
+
+private:
+	struct source
+	{
+		const char *    category;
+		source_func     func;
+	};
+
+	void frame_update();
+	void exit();
+	device_t &owner(std::string const &tag) const;
+
+	// internal state
+	running_machine &                       m_machine;          // reference to the owning machine
+	std::vector<source>                     m_sources;          // everything that reports allocations
+	std::vector<entry>                      m_entries;          // results of the last measurement
+	std::unordered_map<std::string, size_t> m_peaks;            // peak of every entry seen, by category, tag and name
+	const char *                            m_category;         // category of the source being measured
+	size_t                                  m_total;            // total of the last measurement
+	size_t                                  m_peak_total;       // largest total measured
+	u32                                     m_frames;           // frames until the next measurement
+};
+
+#endif // MAME_EMU_MEMUSAGE_H
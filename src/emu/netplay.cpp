@@ -0,0 +1,665 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    netplay.cpp
+
+    Rollback netplay between two running machines.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "netplay.h"
+
+#include "emuopts.h"
+#include "debugger.h"
+#include "screen.h"
+#include "debug/debugcon.h"
+
+#include "hashing.h"
+
+#include <algorithm>
+
+
+
+//**************************************************************************
+//  CONSTANTS
+//**************************************************************************
+
+// bump whenever the messages change
+static constexpr u32 NETPLAY_VERSION = 1;
+
+// message tags
+static constexpr u32 NETPLAY_HELLO = 0x4c504e4d; // 'MNPL'
+static constexpr u32 NETPLAY_INPUT = 0x49504e4d; // 'MNPI'
+
+// seconds to wait for the peer before giving up
+static constexpr int NETPLAY_CONNECT_TIMEOUT = 60;
+static constexpr int NETPLAY_PEER_TIMEOUT = 10;
+
+
+
+//**************************************************************************
+//  INLINE HELPERS
+//**************************************************************************
+
+//-------------------------------------------------
+//  field_owner - player whose peer drives a
+//  field; coin and start buttons belong to the
+//  player they are numbered for
+//-------------------------------------------------
+
+static inline int field_owner(ioport_field const &field)
+{
+	if (field.type() >= IPT_START1 && field.type() <= IPT_START10)
+		return field.type() - IPT_START1;
+	if (field.type() >= IPT_COIN1 && field.type() <= IPT_COIN12)
+		return field.type() - IPT_COIN1;
+	return field.player();
+}
+
+
+//-------------------------------------------------
+//  get_u32 - read a little-endian word from a
+//  receive buffer
+//-------------------------------------------------
+
+static inline u32 get_u32(u8 const *data)
+{
+	return u32(data[0]) | (u32(data[1]) << 8) | (u32(data[2]) << 16) | (u32(data[3]) << 24);
+}
+
+
+
+//**************************************************************************
+//  NETPLAY MANAGER
+//**************************************************************************
+
+//-------------------------------------------------
+//  netplay_manager - constructor
+//-------------------------------------------------
+
+netplay_manager::netplay_manager(running_machine &machine)
+	: m_machine(machine)
+	, m_enabled(false)
+	, m_connected(false)
+	, m_peer(0)
+	, m_delay(std::min(std::max(machine.options().netplay_delay(), 1), 15))
+	, m_max_rollback(std::min(std::max(machine.options().netplay_rollback(), 1), 30))
+	, m_frame(0)
+	, m_confirmed(-1)
+	, m_rollback_frame(-1)
+	, m_resim_target(0)
+	, m_port_index(0)
+	, m_capture_pending(false)
+	, m_resimulating(false)
+	, m_stats()
+{
+	emu_options &options = machine.options();
+	int const listen = options.netplay_listen();
+	const char *const peer = options.netplay_connect();
+	if (listen == 0 && peer[0] == 0)
+		return;
+
+	if (listen != 0 && peer[0] != 0)
+	{
+		osd_printf_error("Netplay: specify either -%s or -%s, not both\n", OPTION_NETPLAY_LISTEN, OPTION_NETPLAY_CONNECT);
+		return;
+	}
+	if (options.record()[0] != 0 || options.playback()[0] != 0)
+	{
+		osd_printf_error("Netplay: cannot be combined with input recording or playback\n");
+		return;
+	}
+
+	m_peer = (listen != 0) ? 0 : 1;
+	m_address = (listen != 0) ? util::string_format("socket.0.0.0.0:%d", listen) : util::string_format("socket.%s", peer);
+	m_enabled = true;
+
+	// the peer may send input up to twice the delay and rollback window ahead of us
+	m_history.resize(2 * (m_delay + m_max_rollback) + 2);
+
+	machine.add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&netplay_manager::exit, this));
+
+	if (machine.debug_enabled())
+	{
+		machine.debugger().console().register_command("netstats", CMDFLAG_NONE, 0, 0, 0,
+				[this] (int ref, std::vector<std::string> const &params)
+				{
+					m_machine.debugger().console().printf("%s\n", statistics_text());
+				});
+	}
+}
+
+
+//-------------------------------------------------
+//  ~netplay_manager - destructor
+//-------------------------------------------------
+
+netplay_manager::~netplay_manager()
+{
+}
+
+
+//-------------------------------------------------
+//  statistics_text - describe what rolling back
+//  has cost so far
+//-------------------------------------------------
+
+std::string netplay_manager::statistics_text() const
+{
+	double const tps = double(osd_ticks_per_second());
+	double const frames = double(std::max<u64>(m_stats.frames, 1));
+
+	screen_device *const screen = screen_device_iterator(machine().root_device()).first();
+	double const budget = ((screen != nullptr) ? screen->frame_period() : attotime::from_hz(60)).as_double() * 1000.0;
+
+	double const capture = 1000.0 * double(m_stats.capture_ticks) / tps / frames;
+	double const rollback = 1000.0 * double(m_stats.rollback_ticks) / tps / frames;
+	double const resim = m_stats.resimulated ? (1000.0 * double(m_stats.rollback_ticks) / tps / double(m_stats.resimulated)) : 0.0;
+	double const worst = 1000.0 * double(m_stats.max_rollback_ticks) / tps;
+	double const stall = 1000.0 * double(m_stats.stall_ticks) / tps / frames;
+
+	return util::string_format(
+			"Netplay: %u frames, %u rollbacks (deepest %u frames), %u frames resimulated\n"
+			"  snapshot %.3f ms/frame, rollback %.3f ms/frame (%.3f ms per resimulated frame, worst %.3f ms)\n"
+			"  waiting for peer %.3f ms/frame, rollback overhead %.1f%% of the %.3f ms frame",
+			m_stats.frames, m_stats.rollbacks, m_stats.max_depth, m_stats.resimulated,
+			capture, rollback, resim, worst,
+			stall, 100.0 * (capture + rollback) / budget, budget);
+}
+
+
+//-------------------------------------------------
+//  snapshot_bytes - memory held by the frame
+//  snapshots
+//-------------------------------------------------
+
+size_t netplay_manager::snapshot_bytes() const
+{
+	size_t bytes = 0;
+	for (frame_record const &record : m_history)
+		bytes += record.state.size();
+	return bytes;
+}
+
+
+//-------------------------------------------------
+//  frame_begin - called once the default values
+//  for a new frame are known
+//-------------------------------------------------
+
+void netplay_manager::frame_begin()
+{
+	if (!m_enabled || (!m_connected && !connect()))
+		return;
+
+	poll();
+
+	// don't run further ahead of the peer than we can roll back
+	if (m_enabled && !m_resimulating && (m_frame - m_confirmed) > m_max_rollback)
+	{
+		osd_ticks_t const start = osd_ticks();
+		while (m_enabled && (m_frame - m_confirmed) > m_max_rollback)
+		{
+			if ((osd_ticks() - start) > (NETPLAY_PEER_TIMEOUT * osd_ticks_per_second()))
+				disconnect("peer is not responding");
+			else
+			{
+				osd_sleep(osd_ticks_per_second() / 1000);
+				poll();
+			}
+		}
+		m_stats.stall_ticks += osd_ticks() - start;
+	}
+	m_port_index = 0;
+}
+
+
+//-------------------------------------------------
+//  port_update - replace the digital state of a
+//  port with the input of both peers
+//-------------------------------------------------
+
+void netplay_manager::port_update(ioport_port &port)
+{
+	if (!m_enabled || !m_connected)
+		return;
+
+	size_t const index = m_port_index++;
+	if (index >= m_ports.size() || m_ports[index] != &port)
+	{
+		disconnect("input ports changed");
+		return;
+	}
+	ioport_port_live &live = port.live();
+
+	// sample live local input, which takes effect once the delay has passed
+	if (!m_resimulating)
+		record(m_frame + m_delay).local[index] = live.digital & m_local_mask[index];
+
+	// predict remote input that has not arrived yet
+	frame_record &rec = record(m_frame);
+	if (!rec.confirmed)
+		rec.remote[index] = m_last_remote[index];
+
+	ioport_value const owned = m_local_mask[index] | m_remote_mask[index];
+	live.digital = (live.digital & ~owned) | rec.local[index] | (rec.remote[index] & m_remote_mask[index]);
+}
+
+
+//-------------------------------------------------
+//  frame_end - send the input sampled this frame
+//  and move on to the next
+//-------------------------------------------------
+
+void netplay_manager::frame_end()
+{
+	if (!m_enabled || !m_connected)
+		return;
+
+	if (!m_resimulating)
+	{
+		send_input(m_frame + m_delay, record(m_frame + m_delay).local);
+		m_stats.frames++;
+	}
+	m_frame++;
+	m_capture_pending = true;
+}
+
+
+//-------------------------------------------------
+//  record - return the record for a frame,
+//  recycling the slot of a frame long gone
+//-------------------------------------------------
+
+netplay_manager::frame_record &netplay_manager::record(s64 frame)
+{
+	frame_record &rec = m_history[frame % m_history.size()];
+	if (rec.frame != frame)
+	{
+		// keep the snapshot buffer, so later snapshots only rewrite what changed
+		rec.frame = frame;
+		rec.local.assign(m_ports.size(), 0);
+		rec.remote.assign(m_ports.size(), 0);
+		rec.confirmed = false;
+		rec.state_valid = false;
+	}
+	return rec;
+}
+
+
+//-------------------------------------------------
+//  process - take the snapshot for the frame
+//  that just began, or roll back if input was
+//  mispredicted
+//-------------------------------------------------
+
+void netplay_manager::process()
+{
+	// rolling back takes fresh snapshots of every frame it replays
+	if (m_rollback_frame >= 0)
+		rollback();
+	else if (m_capture_pending)
+		capture();
+}
+
+
+//-------------------------------------------------
+//  capture - snapshot the machine between
+//  timeslices, just after a frame began
+//-------------------------------------------------
+
+void netplay_manager::capture()
+{
+	m_capture_pending = false;
+
+	osd_ticks_t const start = osd_ticks();
+	frame_record &rec = record(m_frame - 1);
+	rec.state_valid = false;
+	if (machine().scheduler().can_save())
+	{
+		rec.state.resize(ram_state::get_size(machine().save()));
+		rec.state_valid = machine().save().update_buffer(&rec.state[0], rec.state.size(), m_dirty) == STATERR_NONE;
+	}
+	m_stats.capture_ticks += osd_ticks() - start;
+}
+
+
+//-------------------------------------------------
+//  rollback - restore the machine to before the
+//  first mispredicted frame and replay up to the
+//  present
+//-------------------------------------------------
+
+void netplay_manager::rollback()
+{
+	osd_ticks_t const start = osd_ticks();
+	s64 const target = m_frame;
+
+	// the snapshot of the mispredicted frame itself was taken after its input
+	// was applied, so start from the newest good one before it
+	s64 restore = m_rollback_frame - 1;
+	m_rollback_frame = -1;
+	while (restore >= 0 && (target - restore) < s64(m_history.size()))
+	{
+		frame_record const &rec = m_history[restore % m_history.size()];
+		if (rec.frame == restore && rec.state_valid)
+			break;
+		restore--;
+	}
+	if (restore < 0 || (target - restore) >= s64(m_history.size()))
+	{
+		disconnect("no snapshot to roll back to");
+		return;
+	}
+
+	frame_record const &rec = m_history[restore % m_history.size()];
+	if (machine().save().read_buffer(&rec.state[0], rec.state.size()) != STATERR_NONE)
+	{
+		disconnect("unable to restore snapshot");
+		return;
+	}
+	apply_inputs(rec);
+
+	// replay unseen and unheard up to where we were
+	m_resimulating = true;
+	m_resim_target = target;
+	m_frame = restore + 1;
+	m_capture_pending = false;
+	machine().video().set_speculative(true);
+	machine().sound().set_speculative(true);
+	while (m_enabled && m_frame < m_resim_target)
+	{
+		machine().scheduler().timeslice();
+		if (m_capture_pending)
+			capture();
+	}
+	machine().sound().set_speculative(false);
+	machine().video().set_speculative(false);
+	m_resimulating = false;
+
+	// account for it
+	osd_ticks_t const elapsed = osd_ticks() - start;
+	u32 const depth = u32(target - restore - 1);
+	m_stats.rollbacks++;
+	m_stats.resimulated += depth;
+	m_stats.max_depth = std::max(m_stats.max_depth, depth);
+	m_stats.rollback_ticks += elapsed;
+	m_stats.max_rollback_ticks = std::max(m_stats.max_rollback_ticks, elapsed);
+}
+
+
+//-------------------------------------------------
+//  apply_inputs - put the input of a frame back
+//  into the ports after restoring a snapshot
+//-------------------------------------------------
+
+void netplay_manager::apply_inputs(frame_record const &rec)
+{
+	for (size_t index = 0; index < m_ports.size(); index++)
+	{
+		ioport_port &port = *m_ports[index];
+		ioport_port_live &live = port.live();
+		ioport_value const owned = m_local_mask[index] | m_remote_mask[index];
+		live.digital = (live.digital & ~owned) | rec.local[index] | (rec.remote[index] & m_remote_mask[index]);
+
+		// call device line write handlers
+		ioport_value const newvalue = port.read();
+		for (dynamic_field &dynfield : live.writelist)
+			if (dynfield.field().type() != IPT_OUTPUT)
+				dynfield.write(newvalue);
+	}
+}
+
+
+//-------------------------------------------------
+//  connect - open the connection and check that
+//  both peers are running the same thing
+//-------------------------------------------------
+
+bool netplay_manager::connect()
+{
+	// split the digital bits of every port between the peers
+	m_ports.clear();
+	m_local_mask.clear();
+	m_remote_mask.clear();
+	for (auto &port : machine().ioport().ports())
+	{
+		ioport_value local = 0, remote = 0;
+		for (ioport_field &field : port.second->fields())
+			if (!field.is_analog())
+				((field_owner(field) & 1) == m_peer ? local : remote) |= field.mask();
+		m_ports.push_back(port.second.get());
+		m_local_mask.push_back(local);
+		m_remote_mask.push_back(remote & ~local);
+	}
+	m_last_remote.assign(m_ports.size(), 0);
+
+	osd_printf_info("Netplay: %s %s\n", m_peer ? "connecting to" : "waiting for a peer on", m_address.c_str() + strlen("socket."));
+	u64 filesize;
+	u32 const flags = OPEN_FLAG_READ | OPEN_FLAG_WRITE | (m_peer ? 0 : OPEN_FLAG_CREATE);
+	if (osd_file::open(m_address, flags, m_socket, filesize) != osd_file::error::NONE)
+	{
+		disconnect("unable to open the connection");
+		return false;
+	}
+
+	// a listening socket accepts the connection on its first successful read
+	osd_ticks_t const start = osd_ticks();
+	if (m_peer == 0)
+	{
+		u8 dummy;
+		u32 actual;
+		while (m_socket->read(&dummy, 0, 1, actual) != osd_file::error::NONE)
+		{
+			if ((osd_ticks() - start) > (NETPLAY_CONNECT_TIMEOUT * osd_ticks_per_second()))
+			{
+				disconnect("no peer connected");
+				return false;
+			}
+			osd_sleep(osd_ticks_per_second() / 100);
+		}
+	}
+
+	// exchange greetings
+	u32 const hello[4] = {
+		little_endianize_int32(NETPLAY_HELLO),
+		little_endianize_int32(NETPLAY_VERSION),
+		little_endianize_int32(session_checksum()),
+		little_endianize_int32(u32(m_ports.size())) };
+	if (!send(hello, sizeof(hello)))
+		return false;
+
+	m_connected = true;
+	while (m_enabled && m_receive.size() < sizeof(hello))
+	{
+		if ((osd_ticks() - start) > (NETPLAY_CONNECT_TIMEOUT * osd_ticks_per_second()))
+		{
+			disconnect("peer did not answer");
+			return false;
+		}
+		osd_sleep(osd_ticks_per_second() / 100);
+		poll();
+	}
+	if (!m_enabled)
+		return false;
+
+	// poll() leaves the greeting alone until it has seen one
+	if (get_u32(&m_receive[0]) != NETPLAY_HELLO || get_u32(&m_receive[4]) != NETPLAY_VERSION)
+	{
+		disconnect("peer is running an incompatible version");
+		return false;
+	}
+	if (get_u32(&m_receive[8]) != session_checksum() || get_u32(&m_receive[12]) != m_ports.size())
+	{
+		disconnect("peer is running a different system or configuration");
+		return false;
+	}
+	m_receive.erase(m_receive.begin(), m_receive.begin() + sizeof(hello));
+	osd_printf_info("Netplay: connected as player %d\n", m_peer + 1);
+
+	// nobody has input for the frames covered by the delay
+	for (s64 frame = 0; frame < m_delay; frame++)
+		send_input(frame, record(frame).local);
+
+	poll();
+	return m_enabled;
+}
+
+
+//-------------------------------------------------
+//  disconnect - give up on the peer and carry on
+//  alone
+//-------------------------------------------------
+
+void netplay_manager::disconnect(const char *reason)
+{
+	osd_printf_error("Netplay: %s, continuing without the peer\n", reason);
+	machine().popmessage("Netplay: %s", reason);
+	m_socket.reset();
+	m_enabled = false;
+	m_connected = false;
+}
+
+
+//-------------------------------------------------
+//  poll - read whatever the peer has sent and
+//  note any misprediction
+//-------------------------------------------------
+
+void netplay_manager::poll()
+{
+	if (!m_socket)
+		return;
+
+	// drain the socket
+	for (;;)
+	{
+		u8 buffer[4096];
+		u32 actual = 0;
+		if (m_socket->read(buffer, 0, sizeof(buffer), actual) != osd_file::error::NONE)
+			break;
+		if (actual == 0)
+		{
+			disconnect("peer closed the connection");
+			return;
+		}
+		m_receive.insert(m_receive.end(), buffer, buffer + actual);
+	}
+
+	// the greeting is handled by connect()
+	size_t const input_size = 8 + (m_ports.size() * 4);
+	size_t offset = 0;
+	while ((m_receive.size() - offset) >= 4 && get_u32(&m_receive[offset]) != NETPLAY_HELLO)
+	{
+		if (get_u32(&m_receive[offset]) != NETPLAY_INPUT)
+		{
+			disconnect("peer sent a malformed message");
+			return;
+		}
+		if ((m_receive.size() - offset) < input_size)
+			break;
+
+		// input arrives in order, one message per frame
+		s64 const frame = get_u32(&m_receive[offset + 4]);
+		if (frame != m_confirmed + 1)
+		{
+			disconnect("peer sent input out of sequence");
+			return;
+		}
+		frame_record &rec = record(frame);
+		bool mispredicted = false;
+		for (size_t index = 0; index < m_ports.size(); index++)
+		{
+			ioport_value const value = get_u32(&m_receive[offset + 8 + (index * 4)]) & m_remote_mask[index];
+			mispredicted |= (rec.remote[index] != value);
+			rec.remote[index] = value;
+			m_last_remote[index] = value;
+		}
+		rec.confirmed = true;
+		m_confirmed = frame;
+		offset += input_size;
+
+		// frames already emulated with the wrong input must be replayed
+		if (mispredicted && frame < m_frame && (m_rollback_frame < 0 || frame < m_rollback_frame))
+			m_rollback_frame = frame;
+	}
+	m_receive.erase(m_receive.begin(), m_receive.begin() + offset);
+}
+
+
+//-------------------------------------------------
+//  send - write a whole message to the peer
+//-------------------------------------------------
+
+bool netplay_manager::send(void const *data, u32 length)
+{
+	u8 const *ptr = reinterpret_cast<u8 const *>(data);
+	while (length > 0)
+	{
+		u32 actual = 0;
+		if (m_socket->write(ptr, 0, length, actual) != osd_file::error::NONE || actual == 0)
+		{
+			disconnect("unable to send to the peer");
+			return false;
+		}
+		ptr += actual;
+		length -= actual;
+	}
+	return true;
+}
+
+
+//-------------------------------------------------
+//  send_input - send the local input for a frame
+//-------------------------------------------------
+
+void netplay_manager::send_input(s64 frame, std::vector<ioport_value> const &values)
+{
+	if (!m_enabled)
+		return;
+
+	std::vector<u32> message;
+	message.reserve(2 + values.size());
+	message.push_back(little_endianize_int32(NETPLAY_INPUT));
+	message.push_back(little_endianize_int32(u32(frame)));
+	for (ioport_value value : values)
+		message.push_back(little_endianize_int32(value));
+	send(&message[0], message.size() * sizeof(u32));
+}
+
+
+//-------------------------------------------------
+//  session_checksum - hash what both peers must
+//  agree on
+//-------------------------------------------------
+
+u32 netplay_manager::session_checksum() const
+{
+	util::crc32_creator crc;
+	crc.append(machine().system().name, strlen(machine().system().name));
+	u32 const size = little_endianize_int32(u32(ram_state::get_size(machine().save())));
+	crc.append(&size, sizeof(size));
+	for (size_t index = 0; index < m_ports.size(); index++)
+	{
+		u32 const data[2] = {
+			little_endianize_int32(m_ports[index]->live().defvalue),
+			little_endianize_int32(m_local_mask[index] | m_remote_mask[index]) };
+		crc.append(m_ports[index]->tag(), strlen(m_ports[index]->tag()));
+		crc.append(data, sizeof(data));
+	}
+	return crc.finish();
+}
+
+
+//-------------------------------------------------
+//  exit - report the cost of the session
+//-------------------------------------------------
+
+void netplay_manager::exit()
+{
+	if (m_stats.frames != 0)
+		osd_printf_verbose("%s\n", statistics_text());
+	m_socket.reset();
+}
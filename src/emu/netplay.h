@@ -0,0 +1,128 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    netplay.h
+
+    Rollback netplay between two running machines.
+
+    Each peer owns the digital inputs of alternate players (the listening
+    peer players 1, 3, ..., the connecting peer players 2, 4, ...).  Local
+    input is delayed by a few frames and sent to the other peer; remote
+    input that has not arrived yet is predicted by repeating the last
+    input received.  A snapshot of the machine is kept for every recent
+    frame, and when a prediction turns out wrong the machine is restored
+    to the frame before it and the frames since are emulated again,
+    unseen and unheard, with the corrected input.
+
+    Analog controls, DIP switches and configuration are not exchanged;
+    both peers must run the same system with the same settings, which is
+    checked when they connect.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_NETPLAY_H
+#define MAME_EMU_NETPLAY_H
+
+#pragma once
+
+#include <vector>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> netplay_manager
+
+class netplay_manager
+{
+public:
+	// per-session cost of rolling back
+	struct statistics
+	{
+		u64             frames;             // frames emulated live
+		u64             rollbacks;          // mispredictions corrected
+		u64             resimulated;        // frames emulated again
+		u32             max_depth;          // deepest rollback in frames
+		osd_ticks_t     capture_ticks;      // time spent taking snapshots
+		osd_ticks_t     rollback_ticks;     // time spent restoring and resimulating
+		osd_ticks_t     max_rollback_ticks; // longest single rollback
+		osd_ticks_t     stall_ticks;        // time spent waiting for the peer
+	};
+
+	// construction/destruction
+	netplay_manager(running_machine &machine);
+	~netplay_manager();
+
+	// getters
+	running_machine &machine() const { return m_machine; }
+	bool enabled() const { return m_enabled; }
+	bool resimulating() const { return m_resimulating; }
+	statistics const &stats() const { return m_stats; }
+	std::string statistics_text() const;
+	size_t snapshot_bytes() const;
+
+	// per-frame input hooks, called from ioport_manager::frame_update
+	void frame_begin();
+	void port_update(ioport_port &port);
+	void frame_end();
+
+	// called between timeslices to take snapshots and roll back
+	void update() { if (m_enabled && (m_capture_pending || m_rollback_frame >= 0)) process(); }
+
+private:
+	// everything known about one frame
+	struct frame_record
+	{
+		s64                         frame = -1;             // frame number, or -1 if unused
+		std::vector<ioport_value>   local;                  // local input in effect
+		std::vector<ioport_value>   remote;                 // remote input, received or predicted
+		bool                        confirmed = false;      // remote input has been received
+		std::vector<u8>             state;                  // snapshot taken just after the frame began
+		bool                        state_valid = false;    // snapshot can be restored
+	};
+
+	// internal helpers
+	frame_record &record(s64 frame);
+	void process();
+	void capture();
+	void rollback();
+	void apply_inputs(frame_record const &rec);
+	bool connect();
+	void disconnect(const char *reason);
+	void poll();
+	bool send(void const *data, u32 length);
+	void send_input(s64 frame, std::vector<ioport_value> const &values);
+	u32 session_checksum() const;
+	void exit();
+
+	// internal state
+	running_machine &           m_machine;              // reference to our machine
+	bool                        m_enabled;              // netplay is active
+	bool                        m_connected;            // handshake has completed
+	int                         m_peer;                 // 0 if listening, 1 if connecting
+	int                         m_delay;                // frames of local input delay
+	int                         m_max_rollback;         // frames we may run ahead of the peer
+	std::string                 m_address;              // socket specification
+	osd_file::ptr               m_socket;               // connection to the peer
+
+	std::vector<ioport_port *>  m_ports;                // ports in a fixed order
+	std::vector<ioport_value>   m_local_mask;           // digital bits owned by this peer
+	std::vector<ioport_value>   m_remote_mask;          // digital bits owned by the peer
+	std::vector<ioport_value>   m_last_remote;          // last remote input received
+	std::vector<frame_record>   m_history;              // recent and pending frames
+	std::vector<bool>           m_dirty;                // scratch for incremental snapshots
+	std::vector<u8>             m_receive;              // partially received messages
+
+	s64                         m_frame;                // frame whose input is applied next
+	s64                         m_confirmed;            // last frame with remote input received
+	s64                         m_rollback_frame;       // earliest mispredicted frame, or -1
+	s64                         m_resim_target;         // frame at which resimulation ends
+	size_t                      m_port_index;           // next port within the current frame
+	bool                        m_capture_pending;      // a frame began during the last timeslice
+	bool                        m_resimulating;         // replaying frames after a rollback
+	statistics                  m_stats;                // cost metrics
+};
+
+#endif // MAME_EMU_NETPLAY_H
@@ -9,10 +9,19 @@
 ***************************************************************************/
 
 #include "emu.h"
+#include "emuopts.h"
 #include "screen.h"
 #include "aviio.h"
 #include "png.h"
 
+#include <cstring>
+
+// use SSE2 for the luma conversion where it can be assumed
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)) || defined(_M_X64))
+#define RECORDING_SSE (1)
+#include <emmintrin.h>
+#endif
+
 
 namespace
 {
@@ -23,12 +32,13 @@ namespace
 			: movie_recording(screen)
 		{
 		}
+		~avi_movie_recording();
 
 		bool initialize(running_machine &machine, std::unique_ptr<emu_file> &&file, int32_t width, int32_t height);
-		virtual bool add_sound_to_recording(const s16 *sound, int numsamples) override;
 
 	protected:
 		virtual bool append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries) override;
+		virtual bool append_sound_samples(const s16 *sound, int numsamples) override;
 
 	private:
 		avi_file::ptr m_avi_file; // handle to the open movie file
@@ -38,19 +48,98 @@ namespace
 	class mng_movie_recording : public movie_recording
 	{
 	public:
-		mng_movie_recording(screen_device *screen, std::map<std::string, std::string> &&info_fields);
+		mng_movie_recording(screen_device *screen, std::map<std::string, std::string> &&info_fields, png_encode encode);
 		~mng_movie_recording();
 
 		bool initialize(std::unique_ptr<emu_file> &&file, bitmap_t &snap_bitmap);
-		virtual bool add_sound_to_recording(const s16 *sound, int numsamples) override;
 
 	protected:
 		virtual bool append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries) override;
+		virtual bool append_sound_samples(const s16 *sound, int numsamples) override;
 
 	private:
 		std::unique_ptr<emu_file> m_mng_file; // handle to the open movie file
 		std::map<std::string, std::string> m_info_fields;
+		png_encode m_encode; // PNG speed/size trade-off
+	};
+
+
+	class y4m_movie_recording : public movie_recording
+	{
+	public:
+		y4m_movie_recording(screen_device *screen)
+			: movie_recording(screen)
+			, m_width(0)
+			, m_height(0)
+		{
+		}
+		~y4m_movie_recording();
+
+		bool initialize(std::unique_ptr<emu_file> &&file, int32_t width, int32_t height);
+
+	protected:
+		virtual bool append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries) override;
+		virtual bool append_sound_samples(const s16 *sound, int numsamples) override;
+
+	private:
+		std::unique_ptr<emu_file> m_y4m_file; // handle to the open stream
+		int32_t m_width;                    // frame width given in the stream header
+		int32_t m_height;                   // frame height given in the stream header
+		std::vector<u8> m_frame;            // frame marker and planes, written in one go
 	};
+
+
+	// convert a row of RGB pixels to BT.601 limited range luma
+	void convert_luma_row(const u32 *src, u8 *dst, int32_t width)
+	{
+		int32_t x = 0;
+#if defined(RECORDING_SSE)
+		__m128i const mask = _mm_set1_epi32(0xff);
+		__m128i const rcoeff = _mm_set1_epi32(66);
+		__m128i const gcoeff = _mm_set1_epi32(129);
+		__m128i const bcoeff = _mm_set1_epi32(25);
+		__m128i const round = _mm_set1_epi32(128);
+		__m128i const offset = _mm_set1_epi16(16);
+		for ( ; (width - x) >= 8; x += 8)
+		{
+			__m128i result[2];
+			for (int half = 0; 2 > half; half++)
+			{
+				// all products fit in 16 bits, so a 16-bit multiply of the low halves is enough
+				__m128i const pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + x + (half * 4)));
+				__m128i const r = _mm_and_si128(_mm_srli_epi32(pixels, 16), mask);
+				__m128i const g = _mm_and_si128(_mm_srli_epi32(pixels, 8), mask);
+				__m128i const b = _mm_and_si128(pixels, mask);
+				__m128i sum = _mm_add_epi32(_mm_mullo_epi16(r, rcoeff), _mm_mullo_epi16(g, gcoeff));
+				sum = _mm_add_epi32(sum, _mm_mullo_epi16(b, bcoeff));
+				result[half] = _mm_srli_epi32(_mm_add_epi32(sum, round), 8);
+			}
+			__m128i const luma = _mm_add_epi16(_mm_packs_epi32(result[0], result[1]), offset);
+			_mm_storel_epi64(reinterpret_cast<__m128i *>(dst + x), _mm_packus_epi16(luma, luma));
+		}
+#endif
+		for ( ; width > x; x++)
+		{
+			rgb_t const pixel(src[x]);
+			dst[x] = u8((((66 * pixel.r()) + (129 * pixel.g()) + (25 * pixel.b()) + 128) >> 8) + 16);
+		}
+	}
+
+
+	// convert a pair of RGB rows to half-resolution BT.601 limited range chroma
+	void convert_chroma_row(const u32 *src0, const u32 *src1, u8 *dstu, u8 *dstv, int32_t width)
+	{
+		for (int32_t x = 0; width > x; x += 2)
+		{
+			int32_t const x1 = std::min(x + 1, width - 1);
+			rgb_t const p00(src0[x]), p01(src0[x1]), p10(src1[x]), p11(src1[x1]);
+			int const r = (p00.r() + p01.r() + p10.r() + p11.r() + 2) >> 2;
+			int const g = (p00.g() + p01.g() + p10.g() + p11.g() + 2) >> 2;
+			int const b = (p00.b() + p01.b() + p10.b() + p11.b() + 2) >> 2;
+			dstu[x >> 1] = u8((((-38 * r) - (74 * g) + (112 * b) + 128) >> 8) + 128);
+			dstv[x >> 1] = u8((((112 * r) - (94 * g) - (18 * b) + 128) >> 8) + 128);
+		}
+	}
 };
 
 
@@ -67,6 +156,12 @@ movie_recording::movie_recording(screen_device *screen)
 	, m_frame_period(attotime::zero)
 	, m_next_frame_time(attotime::zero)
 	, m_frame(0)
+	, m_queue_frames(0)
+	, m_pending_frames(0)
+	, m_drop(false)
+	, m_exiting(false)
+	, m_failed(false)
+	, m_dropped(0)
 {
 }
 
@@ -77,6 +172,8 @@ movie_recording::movie_recording(screen_device *screen)
 
 movie_recording::~movie_recording()
 {
+	// the derived class should already have done this
+	assert(!m_encoder.joinable());
 }
 
 
@@ -91,21 +188,207 @@ bool movie_recording::append_video_frame(bitmap_rgb32 &bitmap, attotime curtime)
 	const rgb_t *palette = has_palette ? screen()->palette().palette()->entry_list_adjusted() : nullptr;
 	int palette_entries = has_palette ? screen()->palette().entries() : 0;
 
-	// keep appending frames until we're at curtime
+	// count the movie frames this bitmap covers to get us to curtime
+	int repeat = 0;
 	while (next_frame_time() <= curtime)
+	{
+		repeat++;
+		set_next_frame_time(next_frame_time() + frame_period());
+	}
+	if (!repeat)
+		return true;
+
+	// without an encoder thread, write it now
+	if (!m_encoder.joinable())
+		return write_video_frame(bitmap, palette, palette_entries, repeat);
+
+	std::unique_lock<std::mutex> lock(m_queue_mutex);
+	if (m_failed)
+		return false;
+
+	// if the encoder has fallen behind, either stretch the newest queued frame or wait for it
+	if (m_pending_frames >= m_queue_frames)
+	{
+		if (m_drop)
+		{
+			for (auto it = m_queue.rbegin(); m_queue.rend() != it; ++it)
+			{
+				if ((*it)->repeat)
+				{
+					(*it)->repeat += repeat;
+					m_dropped += repeat;
+					return true;
+				}
+			}
+		}
+		m_queue_space.wait(lock, [this] () { return (m_pending_frames < m_queue_frames) || m_failed; });
+		if (m_failed)
+			return false;
+	}
+
+	// copy the frame while holding the lock only to take an item
+	queued_item_ptr item(alloc_item());
+	lock.unlock();
+	item->bitmap.resize(bitmap.width(), bitmap.height());
+	for (s32 y = 0; bitmap.height() > y; y++)
+		std::memcpy(&item->bitmap.pix32(y), &bitmap.pix32(y), bitmap.width() * sizeof(u32));
+	item->palette.assign(palette, palette + palette_entries);
+	item->repeat = repeat;
+	lock.lock();
+	m_queue.emplace_back(std::move(item));
+	m_pending_frames++;
+	m_queue_ready.notify_one();
+	return true;
+}
+
+
+//-------------------------------------------------
+//  movie_recording::add_sound_to_recording
+//-------------------------------------------------
+
+bool movie_recording::add_sound_to_recording(const s16 *sound, int numsamples)
+{
+	g_profiler.start(PROFILER_MOVIE_REC);
+
+	bool result;
+	if (!m_encoder.joinable())
+	{
+		result = append_sound_samples(sound, numsamples);
+	}
+	else
+	{
+		// sound is small and never dropped, so it doesn't count against the queue
+		std::unique_lock<std::mutex> lock(m_queue_mutex);
+		result = !m_failed;
+		if (result)
+		{
+			queued_item_ptr item(alloc_item());
+			item->repeat = 0;
+			item->sound.assign(sound, sound + (numsamples * 2));
+			m_queue.emplace_back(std::move(item));
+			m_queue_ready.notify_one();
+		}
+	}
+
+	g_profiler.stop();
+	return result;
+}
+
+
+//-------------------------------------------------
+//  movie_recording::start_encoder - move encoding
+//  and writing to a thread of its own
+//-------------------------------------------------
+
+void movie_recording::start_encoder(unsigned queue_frames, bool drop)
+{
+	assert(!m_encoder.joinable());
+	if (!queue_frames)
+		return;
+
+	m_queue_frames = queue_frames;
+	m_drop = drop;
+	m_exiting = false;
+	m_failed = false;
+	m_dropped = 0;
+	m_encoder = std::thread([this] () { encoder_main(); });
+}
+
+
+//-------------------------------------------------
+//  movie_recording::stop_encoder - write anything
+//  still queued and wait for the thread to exit
+//-------------------------------------------------
+
+void movie_recording::stop_encoder()
+{
+	if (!m_encoder.joinable())
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(m_queue_mutex);
+		m_exiting = true;
+		m_queue_ready.notify_one();
+	}
+	m_encoder.join();
+
+	if (m_dropped)
+		osd_printf_warning("Movie encoder fell behind; %u frames were repeated in place of new frames\n", m_dropped);
+	m_queue.clear();
+	m_free_items.clear();
+}
+
+
+//-------------------------------------------------
+//  movie_recording::write_video_frame - append a
+//  bitmap for the given number of movie frames
+//-------------------------------------------------
+
+bool movie_recording::write_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries, int repeat)
+{
+	while (repeat--)
 	{
 		// append this bitmap as a single frame
 		if (!append_single_video_frame(bitmap, palette, palette_entries))
 			return false;
 		m_frame++;
-
-		// advance time
-		set_next_frame_time(next_frame_time() + frame_period());
 	}
 	return true;
 }
 
 
+//-------------------------------------------------
+//  movie_recording::alloc_item - get a queue item,
+//  re-using one if possible; called with the
+//  queue locked
+//-------------------------------------------------
+
+movie_recording::queued_item_ptr movie_recording::alloc_item()
+{
+	if (m_free_items.empty())
+		return std::make_unique<queued_item>();
+
+	queued_item_ptr result(std::move(m_free_items.back()));
+	m_free_items.pop_back();
+	return result;
+}
+
+
+//-------------------------------------------------
+//  movie_recording::encoder_main - encode and
+//  write queued items in order until told to exit
+//-------------------------------------------------
+
+void movie_recording::encoder_main()
+{
+	std::unique_lock<std::mutex> lock(m_queue_mutex);
+	while (true)
+	{
+		m_queue_ready.wait(lock, [this] () { return m_exiting || !m_queue.empty(); });
+		if (m_queue.empty())
+			break;
+
+		// take the oldest item and encode it without holding the lock
+		queued_item_ptr item(std::move(m_queue.front()));
+		m_queue.pop_front();
+		bool const failed = m_failed;
+		lock.unlock();
+		bool const ok = !failed && (item->repeat
+				? write_video_frame(item->bitmap, item->palette.data(), item->palette.size(), item->repeat)
+				: append_sound_samples(item->sound.data(), item->sound.size() / 2));
+		lock.lock();
+
+		// keep the buffers for the next frame
+		if (!ok)
+			m_failed = true;
+		if (item->repeat)
+			m_pending_frames--;
+		m_free_items.emplace_back(std::move(item));
+		m_queue_space.notify_one();
+	}
+}
+
+
 //-------------------------------------------------
 //  movie_recording::create - creates a new recording
 //  for the specified format
@@ -124,13 +407,21 @@ movie_recording::ptr movie_recording::create(running_machine &machine, screen_de
 		}
 		break;
 
+	case movie_recording::format::Y4M:
+		{
+			auto y4m_recording = std::make_unique<y4m_movie_recording>(screen);
+			if (y4m_recording->initialize(std::move(file), snap_bitmap.width(), snap_bitmap.height()))
+				result = std::move(y4m_recording);
+		}
+		break;
+
 	case movie_recording::format::MNG:
 		{
 			std::map<std::string, std::string> info_fields;
 			info_fields["Software"] = std::string(emulator_info::get_appname()).append(" ").append(emulator_info::get_build_version());
 			info_fields["System"] = std::string(machine.system().manufacturer).append(" ").append(machine.system().type.fullname());
 
-			auto mng_recording = std::make_unique<mng_movie_recording>(screen, std::move(info_fields));
+			auto mng_recording = std::make_unique<mng_movie_recording>(screen, std::move(info_fields), machine.options().snap_fast() ? PNG_ENCODE_FAST : PNG_ENCODE_DEFAULT);
 			if (mng_recording->initialize(std::move(file), snap_bitmap))
 				result = std::move(mng_recording);
 		}
@@ -142,7 +433,10 @@ movie_recording::ptr movie_recording::create(running_machine &machine, screen_de
 
 	// if we successfully create a recording, set the current time and return it
 	if (result)
+	{
 		result->set_next_frame_time(machine.time());
+		result->start_encoder(std::max(machine.options().movie_queue(), 0), machine.options().movie_drop());
+	}
 	return result;
 }
 
@@ -157,11 +451,22 @@ const char *movie_recording::format_file_extension(movie_recording::format fmt)
 	{
 		case format::AVI:   return "avi";
 		case format::MNG:   return "mng";
+		case format::Y4M:   return "y4m";
 		default:            throw false;
 	}
 }
 
 
+//-------------------------------------------------
+//  avi_movie_recording - destructor
+//-------------------------------------------------
+
+avi_movie_recording::~avi_movie_recording()
+{
+	stop_encoder();
+}
+
+
 //-------------------------------------------------
 //  avi_movie_recording::initialize
 //-------------------------------------------------
@@ -213,19 +518,16 @@ bool avi_movie_recording::append_single_video_frame(bitmap_rgb32 &bitmap, const
 
 
 //-------------------------------------------------
-//  avi_movie_recording::append_video_frame
+//  avi_movie_recording::append_sound_samples
 //-------------------------------------------------
 
-bool avi_movie_recording::add_sound_to_recording(const s16 *sound, int numsamples)
+bool avi_movie_recording::append_sound_samples(const s16 *sound, int numsamples)
 {
-	g_profiler.start(PROFILER_MOVIE_REC);
-
 	// write the next frame
 	avi_file::error avierr = m_avi_file->append_sound_samples(0, sound + 0, numsamples, 1);
 	if (avierr == avi_file::error::NONE)
 		avierr = m_avi_file->append_sound_samples(1, sound + 1, numsamples, 1);
 
-	g_profiler.stop();
 	return avierr == avi_file::error::NONE;
 }
 
@@ -234,9 +536,10 @@ bool avi_movie_recording::add_sound_to_recording(const s16 *sound, int numsample
 //  mng_movie_recording - constructor
 //-------------------------------------------------
 
-mng_movie_recording::mng_movie_recording(screen_device *screen, std::map<std::string, std::string> &&info_fields)
+mng_movie_recording::mng_movie_recording(screen_device *screen, std::map<std::string, std::string> &&info_fields, png_encode encode)
 	: movie_recording(screen)
 	, m_info_fields(std::move(info_fields))
+	, m_encode(encode)
 {
 }
 
@@ -247,6 +550,7 @@ mng_movie_recording::mng_movie_recording(screen_device *screen, std::map<std::st
 
 mng_movie_recording::~mng_movie_recording()
 {
+	stop_encoder();
 	if (m_mng_file)
 		mng_capture_stop(*m_mng_file);
 }
@@ -285,17 +589,100 @@ bool mng_movie_recording::append_single_video_frame(bitmap_rgb32 &bitmap, const
 			pnginfo.add_text(ent.first.c_str(), ent.second.c_str());
 	}
 
-	png_error error = mng_capture_frame(*m_mng_file, pnginfo, bitmap, palette_entries, palette);
+	png_error error = mng_capture_frame(*m_mng_file, pnginfo, bitmap, palette_entries, palette, m_encode);
 	return error == png_error::PNGERR_NONE;
 }
 
 
 //-------------------------------------------------
-//  mng_movie_recording::add_sound_to_recording
+//  mng_movie_recording::append_sound_samples
 //-------------------------------------------------
 
-bool mng_movie_recording::add_sound_to_recording(const s16 *sound, int numsamples)
+bool mng_movie_recording::append_sound_samples(const s16 *sound, int numsamples)
 {
 	// not supported; do nothing
 	return true;
 }
+
+
+//-------------------------------------------------
+//  y4m_movie_recording - destructor
+//-------------------------------------------------
+
+y4m_movie_recording::~y4m_movie_recording()
+{
+	stop_encoder();
+}
+
+
+//-------------------------------------------------
+//  y4m_movie_recording::initialize
+//-------------------------------------------------
+
+bool y4m_movie_recording::initialize(std::unique_ptr<emu_file> &&file, int32_t width, int32_t height)
+{
+	// use the same millihertz rate as AVI recording
+	u32 const rate = u32(1000 * (screen() ? screen()->frame_period().as_hz() : screen_device::DEFAULT_FRAME_RATE));
+	set_frame_period(attotime::from_seconds(1000) / rate);
+
+	// the frame marker and 4:2:0 planes are assembled in a single buffer
+	m_y4m_file = std::move(file);
+	m_width = width;
+	m_height = height;
+	std::size_t const chroma = std::size_t((width + 1) / 2) * ((height + 1) / 2);
+	m_frame.resize(6 + (std::size_t(width) * height) + (2 * chroma));
+	std::memcpy(&m_frame[0], "FRAME\n", 6);
+
+	std::string const header = util::string_format("YUV4MPEG2 W%d H%d F%u:1000 Ip A1:1 C420jpeg\n", width, height, rate);
+	if (m_y4m_file->write(header.c_str(), header.length()) != header.length())
+	{
+		osd_printf_error("Error writing Y4M stream header\n");
+		return false;
+	}
+	return true;
+}
+
+
+//-------------------------------------------------
+//  y4m_movie_recording::append_single_video_frame
+//-------------------------------------------------
+
+bool y4m_movie_recording::append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries)
+{
+	// the stream can't change size, so crop or pad with the edge pixels
+	if ((bitmap.width() <= 0) || (bitmap.height() <= 0))
+		return false;
+	int32_t const srcwidth = std::min(bitmap.width(), m_width);
+	u8 *const yplane = &m_frame[6];
+	u8 *const uplane = yplane + (std::size_t(m_width) * m_height);
+	u8 *const vplane = uplane + (std::size_t((m_width + 1) / 2) * ((m_height + 1) / 2));
+	for (int32_t y = 0; m_height > y; y++)
+	{
+		u8 *const dst = yplane + (std::size_t(y) * m_width);
+		convert_luma_row(&bitmap.pix32(std::min(y, bitmap.height() - 1)), dst, srcwidth);
+		std::fill(dst + srcwidth, dst + m_width, dst[srcwidth - 1]);
+	}
+	for (int32_t y = 0; m_height > y; y += 2)
+	{
+		std::size_t const offs = std::size_t(y >> 1) * ((m_width + 1) / 2);
+		u32 const *const src0 = &bitmap.pix32(std::min(y, bitmap.height() - 1));
+		u32 const *const src1 = &bitmap.pix32(std::min(y + 1, std::min(m_height, bitmap.height()) - 1));
+		convert_chroma_row(src0, src1, uplane + offs, vplane + offs, srcwidth);
+		int32_t const done = (srcwidth + 1) / 2;
+		std::fill(uplane + offs + done, uplane + offs + ((m_width + 1) / 2), uplane[offs + done - 1]);
+		std::fill(vplane + offs + done, vplane + offs + ((m_width + 1) / 2), vplane[offs + done - 1]);
+	}
+
+	return m_y4m_file->write(&m_frame[0], m_frame.size()) == m_frame.size();
+}
+
+
+//-------------------------------------------------
+//  y4m_movie_recording::append_sound_samples
+//-------------------------------------------------
+
+bool y4m_movie_recording::append_sound_samples(const s16 *sound, int numsamples)
+{
+	// YUV4MPEG2 carries no audio; it can be streamed separately with -pcmwrite
+	return true;
+}
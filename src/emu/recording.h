@@ -17,7 +17,12 @@
 #ifndef MAME_EMU_RECORDING_H
 #define MAME_EMU_RECORDING_H
 
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include "attotime.h"
 #include "palette.h"
@@ -38,7 +43,8 @@ public:
 	enum class format
 	{
 		MNG,
-		AVI
+		AVI,
+		Y4M
 	};
 
 	typedef std::unique_ptr<movie_recording> ptr;
@@ -54,9 +60,7 @@ public:
 
 	// methods
 	bool append_video_frame(bitmap_rgb32 &bitmap, attotime curtime);
-
-	// virtuals
-	virtual bool add_sound_to_recording(const s16 *sound, int numsamples) = 0;
+	bool add_sound_to_recording(const s16 *sound, int numsamples);
 
 	// statics
 	static movie_recording::ptr create(running_machine &machine, screen_device *screen, format fmt, std::unique_ptr<emu_file> &&file, bitmap_rgb32 &snap_bitmap);
@@ -68,18 +72,52 @@ protected:
 	movie_recording(const movie_recording &) = delete;
 	movie_recording(movie_recording &&) = delete;
 
-	// virtuals
+	// virtuals; called on the encoder thread once it has been started
 	virtual bool append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries) = 0;
+	virtual bool append_sound_samples(const s16 *sound, int numsamples) = 0;
+
+	// encoder thread; derived classes must stop it before they are destroyed
+	void start_encoder(unsigned queue_frames, bool drop);
+	void stop_encoder();
 
 	// accessors
 	int current_frame() const { return m_frame; }
 	void set_frame_period(attotime time) { m_frame_period = time; }
 
 private:
+	// a frame or block of samples waiting to be encoded
+	struct queued_item
+	{
+		bitmap_rgb32        bitmap;             // copy of the frame
+		std::vector<rgb_t>  palette;            // copy of the adjusted palette
+		int                 repeat;             // number of movie frames covered, or 0 for sound
+		std::vector<s16>    sound;              // interleaved stereo samples
+	};
+	typedef std::unique_ptr<queued_item> queued_item_ptr;
+
+	// internal helpers
+	bool write_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries, int repeat);
+	queued_item_ptr alloc_item();
+	void encoder_main();
+
 	screen_device * m_screen;               // screen associated with this movie (can be nullptr)
 	attotime        m_frame_period;         // duration of movie frame
 	attotime        m_next_frame_time;      // time of next frame
 	int             m_frame;                // current movie frame number
+
+	// encoder thread state
+	std::thread                 m_encoder;          // thread encoding and writing queued items
+	std::mutex                  m_queue_mutex;      // protects everything below
+	std::condition_variable     m_queue_ready;      // signalled when items are queued or on exit
+	std::condition_variable     m_queue_space;      // signalled when a frame has been written
+	std::deque<queued_item_ptr> m_queue;            // items waiting to be encoded
+	std::vector<queued_item_ptr> m_free_items;      // items available for re-use
+	unsigned        m_queue_frames;         // maximum frames queued or being encoded
+	unsigned        m_pending_frames;       // frames queued or being encoded
+	bool            m_drop;                 // repeat the last queued frame rather than waiting
+	bool            m_exiting;              // encoder should drain the queue and exit
+	bool            m_failed;               // encoder got an error
+	u32             m_dropped;              // frames replaced by repeats
 };
 
 
@@ -294,9 +294,15 @@ render_texture::render_texture()
 		m_old_id(~0ULL),
 		m_scaler(nullptr),
 		m_param(nullptr),
-		m_curseq(0)
+		m_curseq(0),
+		m_threaded_scaling(false),
+		m_track_dirty(false),
+		m_dirty_top(0),
+		m_dirty_bottom(0),
+		m_palette_serial(0)
 {
 	m_sbounds.set(0, -1, 0, -1);
+	m_dirty.set(0, -1, 0, -1);
 	memset(m_scaled, 0, sizeof(m_scaled));
 }
 
@@ -336,6 +342,10 @@ void render_texture::reset(render_manager &manager, texture_scaler_func scaler,
 
 void render_texture::release()
 {
+	// wait for any scaling in progress
+	cancel_scaling();
+	m_threaded_scaling = false;
+
 	// free all scaled versions
 	for (auto & elem : m_scaled)
 	{
@@ -351,6 +361,8 @@ void render_texture::release()
 	m_sbounds.set(0, -1, 0, -1);
 	m_format = TEXFORMAT_ARGB32;
 	m_curseq = 0;
+	m_track_dirty = false;
+	m_dirty.set(0, -1, 0, -1);
 }
 
 
@@ -370,6 +382,13 @@ void render_texture::set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, text
 	if (&bitmap != m_bitmap && m_bitmap != nullptr)
 		m_manager->invalidate_all(m_bitmap);
 
+	// anything but new contents for the same area invalidates everything
+	if (&bitmap != m_bitmap || sbounds != m_sbounds || format != m_format)
+		m_dirty = sbounds;
+
+	// the worker may still be reading the old source
+	cancel_scaling();
+
 	// set the new bitmap/palette
 	m_bitmap = &bitmap;
 	m_sbounds = sbounds;
@@ -389,6 +408,35 @@ void render_texture::set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, text
 }
 
 
+//-------------------------------------------------
+//  set_dirty_tracking - choose whether the texture
+//  reports new contents on every request or only
+//  after areas have been marked dirty
+//-------------------------------------------------
+
+void render_texture::set_dirty_tracking(bool enable)
+{
+	m_track_dirty = enable;
+	m_dirty = m_sbounds;
+}
+
+
+//-------------------------------------------------
+//  mark_dirty - note an area of the bitmap, in
+//  bitmap coordinates, whose contents changed
+//-------------------------------------------------
+
+void render_texture::mark_dirty(const rectangle &rect)
+{
+	if (rect.empty())
+		return;
+	if (m_dirty.empty())
+		m_dirty = rect;
+	else
+		m_dirty |= rect;
+}
+
+
 //-------------------------------------------------
 //  hq_scale - generic high quality resampling
 //  scaler
@@ -406,7 +454,7 @@ void render_texture::hq_scale(bitmap_argb32 &dest, bitmap_argb32 &source, const
 //  get_scaled - get a scaled bitmap (if we can)
 //-------------------------------------------------
 
-void render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo, render_primitive_list &primlist, u32 flags)
+void render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo, render_primitive_list &primlist, u32 flags, u32 palette_serial)
 {
 	// source width/height come from the source bounds
 	int swidth = m_sbounds.width();
@@ -433,7 +481,36 @@ void render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo
 		texinfo.width = swidth;
 		texinfo.height = sheight;
 		// palette will be set later
-		texinfo.seqid = ++m_curseq;
+
+		// without dirty tracking, assume everything changed
+		if (!m_track_dirty)
+		{
+			texinfo.seqid = ++m_curseq;
+			texinfo.dirty_top = 0;
+			texinfo.dirty_bottom = sheight - 1;
+		}
+
+		// otherwise only start a new sequence number if something changed; pixels
+		// depend on the adjusted palette, so a palette change dirties everything
+		else
+		{
+			if (palette_serial != m_palette_serial)
+			{
+				m_palette_serial = palette_serial;
+				m_dirty = m_sbounds;
+			}
+			m_dirty &= m_sbounds;
+			if (!m_dirty.empty())
+			{
+				m_curseq++;
+				m_dirty_top = m_dirty.top() - m_sbounds.top();
+				m_dirty_bottom = m_dirty.bottom() - m_sbounds.top();
+				m_dirty.set(0, -1, 0, -1);
+			}
+			texinfo.seqid = m_curseq;
+			texinfo.dirty_top = m_dirty_top;
+			texinfo.dirty_bottom = m_dirty_bottom;
+		}
 	}
 	else
 	{
@@ -441,6 +518,13 @@ void render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo
 		bitmap_argb32 dummy;
 		bitmap_argb32 &srcbitmap = (m_bitmap != nullptr) ? downcast<bitmap_argb32 &>(*m_bitmap) : dummy;
 
+		// pick up a size finished by the worker
+		if (m_scale_job && m_scale_job->done)
+		{
+			alloc_scaled(primlist, m_scale_job->bitmap);
+			m_scale_job.reset();
+		}
+
 		// is it a size we already have?
 		scaled_texture *scaled = nullptr;
 		int scalenum;
@@ -456,40 +540,136 @@ void render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo
 		// did we get one?
 		if (scalenum == ARRAY_LENGTH(m_scaled))
 		{
-			int lowest = -1;
-
-			// didn't find one -- take the entry with the lowest seqnum
-			for (scalenum = 0; scalenum < ARRAY_LENGTH(m_scaled); scalenum++)
-				if ((lowest == -1 || m_scaled[scalenum].seqid < m_scaled[lowest].seqid) && !primlist.has_reference(m_scaled[scalenum].bitmap))
-					lowest = scalenum;
-			if (-1 == lowest)
-				throw emu_fatalerror("render_texture::get_scaled: Too many live texture instances!");
-
-			// throw out any existing entries
-			scaled = &m_scaled[lowest];
-			if (scaled->bitmap != nullptr)
+			// if we can, scale on a worker and keep showing the last size until it's done
+			scaled = m_threaded_scaling ? latest_scaled() : nullptr;
+			if (scaled != nullptr)
 			{
-				m_manager->invalidate_all(scaled->bitmap);
-				global_free(scaled->bitmap);
+				if (!m_scale_job)
+					start_scaling(dwidth, dheight);
+			}
+			else
+			{
+				// otherwise allocate a new bitmap and let the scaler do the work now
+				scaled = &alloc_scaled(primlist, global_alloc(bitmap_argb32(dwidth, dheight)));
+				(*m_scaler)(*scaled->bitmap, srcbitmap, m_sbounds, m_param);
 			}
-
-			// allocate a new bitmap
-			scaled->bitmap = global_alloc(bitmap_argb32(dwidth, dheight));
-			scaled->seqid = ++m_curseq;
-
-			// let the scaler do the work
-			(*m_scaler)(*scaled->bitmap, srcbitmap, m_sbounds, m_param);
 		}
 
 		// finally fill out the new info
 		primlist.add_reference(scaled->bitmap);
 		texinfo.base = &scaled->bitmap->pix32(0);
 		texinfo.rowpixels = scaled->bitmap->rowpixels();
-		texinfo.width = dwidth;
-		texinfo.height = dheight;
+		texinfo.width = scaled->bitmap->width();
+		texinfo.height = scaled->bitmap->height();
 		// palette will be set later
 		texinfo.seqid = scaled->seqid;
+		texinfo.dirty_top = 0;
+		texinfo.dirty_bottom = texinfo.height - 1;
+	}
+}
+
+
+//-------------------------------------------------
+//  alloc_scaled - store a scaled bitmap in the
+//  least recently created free entry
+//-------------------------------------------------
+
+render_texture::scaled_texture &render_texture::alloc_scaled(render_primitive_list &primlist, bitmap_argb32 *bitmap)
+{
+	int lowest = -1;
+
+	// take the entry with the lowest seqnum that isn't in use
+	for (int scalenum = 0; scalenum < ARRAY_LENGTH(m_scaled); scalenum++)
+		if ((lowest == -1 || m_scaled[scalenum].seqid < m_scaled[lowest].seqid) && !primlist.has_reference(m_scaled[scalenum].bitmap))
+			lowest = scalenum;
+	if (-1 == lowest)
+	{
+		global_free(bitmap);
+		throw emu_fatalerror("render_texture::get_scaled: Too many live texture instances!");
+	}
+
+	// throw out any existing entries
+	scaled_texture &scaled = m_scaled[lowest];
+	if (scaled.bitmap != nullptr)
+	{
+		m_manager->invalidate_all(scaled.bitmap);
+		global_free(scaled.bitmap);
+	}
+
+	scaled.bitmap = bitmap;
+	scaled.seqid = ++m_curseq;
+	return scaled;
+}
+
+
+//-------------------------------------------------
+//  latest_scaled - return the most recently
+//  created scaled entry, if any
+//-------------------------------------------------
+
+render_texture::scaled_texture *render_texture::latest_scaled()
+{
+	scaled_texture *latest = nullptr;
+	for (auto &elem : m_scaled)
+		if (elem.bitmap != nullptr && (latest == nullptr || elem.seqid > latest->seqid))
+			latest = &elem;
+	return latest;
+}
+
+
+//-------------------------------------------------
+//  start_scaling - queue a new size to be scaled
+//  on a worker
+//-------------------------------------------------
+
+void render_texture::start_scaling(u32 dwidth, u32 dheight)
+{
+	m_scale_job = std::make_unique<scale_job>();
+	m_scale_job->texture = this;
+	m_scale_job->bitmap = global_alloc(bitmap_argb32(dwidth, dheight));
+	m_scale_job->done = false;
+	osd_work_queue *const queue = m_manager->scale_queue();
+	if (queue == nullptr || osd_work_item_queue(queue, scale_callback, m_scale_job.get(), WORK_ITEM_FLAG_AUTO_RELEASE) == nullptr)
+		scale_callback(m_scale_job.get(), 0);
+}
+
+
+//-------------------------------------------------
+//  cancel_scaling - wait for the worker and
+//  throw away what it produced
+//-------------------------------------------------
+
+void render_texture::cancel_scaling()
+{
+	if (!m_scale_job)
+		return;
+
+	if (!m_scale_job->done)
+	{
+		while (!osd_work_queue_wait(m_manager->m_scale_queue, osd_ticks_per_second()))
+		{
+		}
 	}
+	global_free(m_scale_job->bitmap);
+	m_scale_job.reset();
+}
+
+
+//-------------------------------------------------
+//  scale_callback - run the scaler for a queued
+//  size
+//-------------------------------------------------
+
+void *render_texture::scale_callback(void *param, int threadid)
+{
+	scale_job &job(*reinterpret_cast<scale_job *>(param));
+	render_texture &texture(*job.texture);
+
+	bitmap_argb32 dummy;
+	bitmap_argb32 &srcbitmap = (texture.m_bitmap != nullptr) ? downcast<bitmap_argb32 &>(*texture.m_bitmap) : dummy;
+	(*texture.m_scaler)(*job.bitmap, srcbitmap, texture.m_sbounds, texture.m_param);
+	job.done = true;
+	return nullptr;
 }
 
 
@@ -528,6 +708,192 @@ const rgb_t *render_texture::get_adjusted_palette(render_container &container, u
 
 
 
+//**************************************************************************
+//  RENDER ELEMENT ATLAS
+//**************************************************************************
+
+//-------------------------------------------------
+//  render_element_atlas - constructor/destructor
+//-------------------------------------------------
+
+render_element_atlas::render_element_atlas(render_manager &manager)
+	: m_manager(manager)
+	, m_generation(0)
+	, m_full(false)
+	, m_frames(0)
+{
+}
+
+render_element_atlas::~render_element_atlas()
+{
+	flush();
+}
+
+
+//-------------------------------------------------
+//  find - get the placement of a scaled element
+//  texture, drawing it into a page the first
+//  time it is requested
+//-------------------------------------------------
+
+const render_element_atlas::placement *render_element_atlas::find(render_texture &texture, s32 width, s32 height)
+{
+	// only textures drawn by a scaler can be redrawn into a page, and large ones aren't worth it
+	if (!texture.m_scaler || (width > MAX_IMAGE_SIZE) || (height > MAX_IMAGE_SIZE))
+		return nullptr;
+	if (width <= 0) width = 1;
+	if (height <= 0) height = 1;
+
+	// is it a size we already have?
+	std::vector<entry> &entries(m_entries[&texture]);
+	for (entry const &existing : entries)
+	{
+		if ((existing.width == width) && (existing.height == height))
+			return &existing.place;
+	}
+
+	// find some space
+	unsigned pagenum;
+	rectangle rect;
+	if (!allocate(width, height, pagenum, rect))
+	{
+		m_full = true;
+		return nullptr;
+	}
+	page &dest(m_pages[pagenum]);
+
+	// let the scaler draw inside the padding
+	bitmap_argb32 dummy;
+	bitmap_argb32 image(*dest.bitmap, rectangle(rect.left() + 1, rect.right() - 1, rect.top() + 1, rect.bottom() - 1));
+	(*texture.m_scaler)(image, dummy, texture.m_sbounds, texture.m_param);
+
+	// repeat the edges into the padding so filtering doesn't pick up the neighbours
+	for (s32 y = rect.top() + 1; rect.bottom() > y; y++)
+	{
+		dest.bitmap->pix32(y, rect.left()) = dest.bitmap->pix32(y, rect.left() + 1);
+		dest.bitmap->pix32(y, rect.right()) = dest.bitmap->pix32(y, rect.right() - 1);
+	}
+	memcpy(&dest.bitmap->pix32(rect.top(), rect.left()), &dest.bitmap->pix32(rect.top() + 1, rect.left()), rect.width() * sizeof(u32));
+	memcpy(&dest.bitmap->pix32(rect.bottom(), rect.left()), &dest.bitmap->pix32(rect.bottom() - 1, rect.left()), rect.width() * sizeof(u32));
+	dest.texture->mark_dirty(rect);
+
+	entry added;
+	added.width = width;
+	added.height = height;
+	added.place.page = dest.texture;
+	added.place.uv.x0 = float(rect.left() + 1) / float(PAGE_WIDTH);
+	added.place.uv.y0 = float(rect.top() + 1) / float(PAGE_HEIGHT);
+	added.place.uv.x1 = float(rect.right()) / float(PAGE_WIDTH);
+	added.place.uv.y1 = float(rect.bottom()) / float(PAGE_HEIGHT);
+	entries.push_back(added);
+	return &entries.back().place;
+}
+
+
+//-------------------------------------------------
+//  trim - discard a full atlas, but not so often
+//  that images are redrawn every frame when the
+//  working set doesn't fit
+//-------------------------------------------------
+
+void render_element_atlas::trim()
+{
+	if (FLUSH_INTERVAL > m_frames)
+		m_frames++;
+	else if (m_full)
+		flush();
+}
+
+
+//-------------------------------------------------
+//  forget - drop the entries for a texture that
+//  is being freed; the space is reclaimed when
+//  the atlas is next flushed
+//-------------------------------------------------
+
+void render_element_atlas::forget(const render_texture &texture)
+{
+	m_entries.erase(&texture);
+}
+
+
+//-------------------------------------------------
+//  flush - free all pages and invalidate all
+//  placements handed out
+//-------------------------------------------------
+
+void render_element_atlas::flush()
+{
+	m_entries.clear();
+	for (page &p : m_pages)
+		m_manager.texture_free(p.texture);
+	m_pages.clear();
+	m_full = false;
+	m_frames = 0;
+	m_generation++;
+}
+
+
+//-------------------------------------------------
+//  allocate - find space for an image and its
+//  padding, adding a page if necessary
+//-------------------------------------------------
+
+bool render_element_atlas::allocate(s32 width, s32 height, unsigned &pagenum, rectangle &rect)
+{
+	s32 const paddedwidth(width + 2);
+	s32 const paddedheight(height + 2);
+
+	// prefer the existing shelf that wastes the fewest rows, within reason
+	shelf *best = nullptr;
+	for (unsigned i = 0; m_pages.size() > i; i++)
+	{
+		for (shelf &row : m_pages[i].shelves)
+		{
+			if ((row.height >= paddedheight) && ((row.height - paddedheight) <= (paddedheight / 2)) && ((PAGE_WIDTH - row.left) >= paddedwidth) && (!best || (row.height < best->height)))
+			{
+				best = &row;
+				pagenum = i;
+			}
+		}
+	}
+
+	// otherwise start a new shelf, in a new page if need be
+	if (!best)
+	{
+		for (pagenum = 0; m_pages.size() > pagenum; pagenum++)
+		{
+			if ((PAGE_HEIGHT - m_pages[pagenum].bottom) >= paddedheight)
+				break;
+		}
+		if (m_pages.size() == pagenum)
+		{
+			if (MAX_PAGES <= m_pages.size())
+				return false;
+
+			page added;
+			added.bitmap = std::make_unique<bitmap_argb32>(PAGE_WIDTH, PAGE_HEIGHT);
+			added.bitmap->fill(0);
+			added.texture = m_manager.texture_alloc();
+			added.texture->set_bitmap(*added.bitmap, added.bitmap->cliprect(), TEXFORMAT_ARGB32);
+			added.texture->set_dirty_tracking(true);
+			added.bottom = 0;
+			m_pages.emplace_back(std::move(added));
+		}
+
+		page &dest(m_pages[pagenum]);
+		dest.shelves.push_back(shelf{ dest.bottom, paddedheight, 0 });
+		dest.bottom += paddedheight;
+		best = &dest.shelves.back();
+	}
+
+	rect.set(best->left, best->left + paddedwidth - 1, best->top, best->top + paddedheight - 1);
+	best->left += paddedwidth;
+	return true;
+}
+
+
+
 //**************************************************************************
 //  RENDER CONTAINER
 //**************************************************************************
@@ -542,6 +908,7 @@ render_container::render_container(render_manager &manager, screen_device *scree
 	, m_screen(screen)
 	, m_overlaybitmap(nullptr)
 	, m_overlaytexture(nullptr)
+	, m_palette_serial(0)
 {
 	// make sure it is empty
 	empty();
@@ -643,6 +1010,10 @@ void render_container::add_char(float x0, float y0, float height, float aspect,
 	bounds.y0 = y0;
 	render_texture *texture = font.get_char_texture_and_bounds(height, aspect, ch, bounds);
 
+	// blank glyphs like spaces have nothing to draw
+	if (!texture)
+		return;
+
 	// add it like a quad
 	item &newitem = add_generic(CONTAINER_ITEM_QUAD, bounds.x0, bounds.y0, bounds.x1, bounds.y1, argb);
 	newitem.m_texture = texture;
@@ -774,6 +1145,8 @@ render_container::item &render_container::add_generic(u8 type, float x0, float y
 
 void render_container::recompute_lookups()
 {
+	m_palette_serial++;
+
 	// recompute the 256 entry lookup table
 	for (int i = 0; i < 0x100; i++)
 	{
@@ -826,6 +1199,7 @@ void render_container::update_palette()
 	// iterate over dirty items and update them
 	if (dirty != nullptr)
 	{
+		m_palette_serial++;
 		palette_t &palette = m_palclient->palette();
 		const rgb_t *adjusted_palette = palette.entry_list_adjusted();
 
@@ -907,6 +1281,7 @@ template <typename T> render_target::render_target(render_manager &manager, T &&
 	, m_base_orientation(ROT0)
 	, m_maxtexwidth(65536)
 	, m_maxtexheight(65536)
+	, m_element_cache_key()
 	, m_transform_container(true)
 	, m_external_artwork(false)
 {
@@ -1344,35 +1719,45 @@ render_primitive_list &render_target::get_primitives()
 
 	if (m_manager.machine().phase() >= machine_phase::RESET)
 	{
+		// element primitives only depend on their state until the layout or atlas changes
+		m_manager.m_element_atlas.trim();
+		element_cache_key const key{
+				&current_view(), current_view().recompute_count(), visibility_mask(),
+				root_xform.xoffs, root_xform.yoffs, root_xform.xscale, root_xform.yscale, root_xform.orientation,
+				m_width, m_height, m_maxtexwidth, m_maxtexheight, m_manager.m_element_atlas.generation() };
+		if (key != m_element_cache_key)
+		{
+			m_element_cache_key = key;
+			m_element_cache.clear();
+			m_element_cache.resize(current_view().items().size(), element_cache_entry{ -1 });
+		}
+
 		// we're running - iterate over items in the view
+		auto cached = m_element_cache.begin();
 		for (layout_view::item &curitem : current_view().items())
 		{
 			if ((visibility_mask() & curitem.visibility_mask()) == curitem.visibility_mask())
 			{
-				// first apply orientation to the bounds
-				render_bounds bounds = curitem.bounds();
-				apply_orientation(bounds, root_xform.orientation);
-				normalize_bounds(bounds);
-
-				// apply the transform to the item
-				object_transform item_xform;
-				item_xform.xoffs = root_xform.xoffs + bounds.x0 * root_xform.xscale;
-				item_xform.yoffs = root_xform.yoffs + bounds.y0 * root_xform.yscale;
-				item_xform.xscale = (bounds.x1 - bounds.x0) * root_xform.xscale;
-				item_xform.yscale = (bounds.y1 - bounds.y0) * root_xform.yscale;
-				item_xform.color.r = curitem.color().r * root_xform.color.r;
-				item_xform.color.g = curitem.color().g * root_xform.color.g;
-				item_xform.color.b = curitem.color().b * root_xform.color.b;
-				item_xform.color.a = curitem.color().a * root_xform.color.a;
-				item_xform.orientation = orientation_add(curitem.orientation(), root_xform.orientation);
-				item_xform.no_center = false;
-
 				// if there is no associated element, it must be a screen element
+				object_transform item_xform;
 				if (curitem.screen())
+				{
+					item_transform(root_xform, curitem, item_xform);
 					add_container_primitives(list, root_xform, item_xform, curitem.screen()->container(), curitem.blend_mode());
+				}
 				else
-					add_element_primitives(list, item_xform, *curitem.element(), curitem.state(), curitem.blend_mode());
+				{
+					// limit state range to non-negative values, and rebuild only if it changed
+					int const state = std::max(curitem.state(), 0);
+					if (cached->state != state)
+					{
+						item_transform(root_xform, curitem, item_xform);
+						build_element_primitive(*cached, item_xform, *curitem.element(), state, curitem.blend_mode());
+					}
+					add_element_primitives(list, *cached);
+				}
 			}
+			++cached;
 		}
 	}
 	else
@@ -2142,11 +2527,16 @@ bool render_target::load_layout_file(const char *dirname, const internal_layout
 		return false;
 	}
 
-	util::xml::file::ptr rootnode(util::xml::file::string_read(reinterpret_cast<char const *>(tempout.get()), nullptr));
+	// layouts compiled to binary documents are read without parsing
+	util::xml::file::ptr rootnode;
+	if (util::xml::file::is_binary(tempout.get(), layout_data.decompressed_size))
+		rootnode = util::xml::file::binary_read(tempout.get(), layout_data.decompressed_size);
+	else
+		rootnode = util::xml::file::string_read(reinterpret_cast<char const *>(tempout.get()), nullptr);
 	tempout.reset();
 
 	// if we didn't get a properly-formatted XML file, record a warning and exit
-	if (!load_layout_file(device ? *device : m_manager.machine().root_device(), dirname, *rootnode))
+	if (!rootnode || !load_layout_file(device ? *device : m_manager.machine().root_device(), dirname, *rootnode))
 	{
 		osd_printf_warning("Improperly formatted XML string, ignoring\n");
 		return false;
@@ -2284,6 +2674,11 @@ void render_target::add_container_primitives(render_primitive_list &list, const
 		container_xform.color = xform.color;
 	}
 
+	// vector displays add thousands of lines, mostly in a handful of
+	// colours, so remember the last brightness/contrast/gamma result
+	render_color line_color_in = { -1.0f, -1.0f, -1.0f, -1.0f };
+	render_color line_color_out = { 0.0f, 0.0f, 0.0f, 0.0f };
+
 	// iterate over elements
 	for (render_container::item &curitem : container.items())
 	{
@@ -2334,10 +2729,15 @@ void render_target::add_container_primitives(render_primitive_list &list, const
 		{
 			case CONTAINER_ITEM_LINE:
 				// adjust the color for brightness/contrast/gamma
-				prim->color.a = container.apply_brightness_contrast_gamma_fp(prim->color.a);
-				prim->color.r = container.apply_brightness_contrast_gamma_fp(prim->color.r);
-				prim->color.g = container.apply_brightness_contrast_gamma_fp(prim->color.g);
-				prim->color.b = container.apply_brightness_contrast_gamma_fp(prim->color.b);
+				if (prim->color.a != line_color_in.a || prim->color.r != line_color_in.r || prim->color.g != line_color_in.g || prim->color.b != line_color_in.b)
+				{
+					line_color_in = prim->color;
+					line_color_out.a = container.apply_brightness_contrast_gamma_fp(prim->color.a);
+					line_color_out.r = container.apply_brightness_contrast_gamma_fp(prim->color.r);
+					line_color_out.g = container.apply_brightness_contrast_gamma_fp(prim->color.g);
+					line_color_out.b = container.apply_brightness_contrast_gamma_fp(prim->color.b);
+				}
+				prim->color = line_color_out;
 
 				// set the line type
 				prim->type = render_primitive::LINE;
@@ -2378,7 +2778,7 @@ void render_target::add_container_primitives(render_primitive_list &list, const
 					width = std::min(width, m_maxtexwidth);
 					height = std::min(height, m_maxtexheight);
 
-					curitem.texture()->get_scaled(width, height, prim->texture, list, curitem.flags());
+					curitem.texture()->get_scaled(width, height, prim->texture, list, curitem.flags(), container.palette_serial());
 
 					// set the palette
 					prim->texture.palette = curitem.texture()->get_adjusted_palette(container, prim->texture.palette_length);
@@ -2505,39 +2905,55 @@ void render_target::add_container_primitives(render_primitive_list &list, const
 
 
 //-------------------------------------------------
-//  add_element_primitives - add the primitive
-//  for an element in the current state
+//  add_element_primitives - add the cached
+//  primitive for an element item
 //-------------------------------------------------
 
-void render_target::add_element_primitives(render_primitive_list &list, const object_transform &xform, layout_element &element, int state, int blendmode)
+void render_target::add_element_primitives(render_primitive_list &list, const element_cache_entry &entry)
 {
-	// limit state range to non-negative values
-	if (state < 0)
-		state = 0;
+	// nothing to do if there is no texture or we're clipped out
+	if (!entry.texture || entry.clipped)
+		return;
+
+	render_primitive *prim = list.alloc(render_primitive::QUAD);
+	prim->color = entry.color;
+	prim->flags = entry.flags;
+	prim->bounds = entry.bounds;
+	prim->full_bounds = entry.full_bounds;
+	prim->texcoords = entry.texcoords;
 
+	// get the scaled texture every time, as it holds a reference for the list
+	entry.texture->get_scaled(entry.texwidth, entry.texheight, prim->texture, list, prim->flags);
+	list.append(*prim);
+}
+
+
+//-------------------------------------------------
+//  build_element_primitive - compute everything
+//  about the primitive for an element in a given
+//  state that does not change from frame to frame
+//-------------------------------------------------
+
+void render_target::build_element_primitive(element_cache_entry &entry, const object_transform &xform, layout_element &element, int state, int blendmode)
+{
 	// get a pointer to the relevant texture
-	render_texture *texture = element.state_texture(state);
-	if (texture)
+	entry.state = state;
+	entry.texture = element.state_texture(state);
+	if (entry.texture)
 	{
-		render_primitive *prim = list.alloc(render_primitive::QUAD);
-
 		// configure the basics
-		prim->color = xform.color;
-		prim->flags = PRIMFLAG_TEXORIENT(xform.orientation) | PRIMFLAG_BLENDMODE(blendmode) | PRIMFLAG_TEXFORMAT(texture->format());
+		entry.color = xform.color;
+		entry.flags = PRIMFLAG_TEXORIENT(xform.orientation) | PRIMFLAG_BLENDMODE(blendmode) | PRIMFLAG_TEXFORMAT(entry.texture->format());
 
 		// compute the bounds
 		s32 width = render_round_nearest(xform.xscale);
 		s32 height = render_round_nearest(xform.yscale);
-		set_render_bounds_wh(prim->bounds, render_round_nearest(xform.xoffs), render_round_nearest(xform.yoffs), (float) width, (float) height);
-		prim->full_bounds = prim->bounds;
+		set_render_bounds_wh(entry.bounds, render_round_nearest(xform.xoffs), render_round_nearest(xform.yoffs), (float) width, (float) height);
+		entry.full_bounds = entry.bounds;
 		if (xform.orientation & ORIENTATION_SWAP_XY)
 			std::swap(width, height);
-		width = std::min(width, m_maxtexwidth);
-		height = std::min(height, m_maxtexheight);
-
-		// get the scaled texture and append it
-
-		texture->get_scaled(width, height, prim->texture, list, prim->flags);
+		entry.texwidth = std::min(width, m_maxtexwidth);
+		entry.texheight = std::min(height, m_maxtexheight);
 
 		// compute the clip rect
 		render_bounds cliprect;
@@ -2548,15 +2964,56 @@ void render_target::add_element_primitives(render_primitive_list &list, const ob
 		sect_render_bounds(cliprect, m_bounds);
 
 		// determine UV coordinates and apply clipping
-		prim->texcoords = oriented_texcoords[xform.orientation];
-		bool clipped = render_clip_quad(&prim->bounds, &cliprect, &prim->texcoords);
+		entry.texcoords = oriented_texcoords[xform.orientation];
+		entry.clipped = render_clip_quad(&entry.bounds, &cliprect, &entry.texcoords);
 
-		// add to the list or free if we're clipped out
-		list.append_or_return(*prim, clipped);
+		// draw small images into a shared page so they can be batched
+		render_element_atlas &atlas(m_manager.m_element_atlas);
+		if (!entry.clipped && (m_maxtexwidth >= atlas.page_width()) && (m_maxtexheight >= atlas.page_height()))
+		{
+			render_element_atlas::placement const *const place(atlas.find(*entry.texture, entry.texwidth, entry.texheight));
+			if (place)
+			{
+				entry.texture = place->page;
+				entry.texwidth = atlas.page_width();
+				entry.texheight = atlas.page_height();
+				for (render_texuv *uv : { &entry.texcoords.tl, &entry.texcoords.tr, &entry.texcoords.bl, &entry.texcoords.br })
+				{
+					uv->u = place->uv.x0 + (uv->u * place->uv.width());
+					uv->v = place->uv.y0 + (uv->v * place->uv.height());
+				}
+			}
+		}
 	}
 }
 
 
+//-------------------------------------------------
+//  item_transform - compute the transform for an
+//  item in the current view
+//-------------------------------------------------
+
+void render_target::item_transform(const object_transform &root_xform, layout_view::item &item, object_transform &xform)
+{
+	// first apply orientation to the bounds
+	render_bounds bounds = item.bounds();
+	apply_orientation(bounds, root_xform.orientation);
+	normalize_bounds(bounds);
+
+	// apply the transform to the item
+	xform.xoffs = root_xform.xoffs + bounds.x0 * root_xform.xscale;
+	xform.yoffs = root_xform.yoffs + bounds.y0 * root_xform.yscale;
+	xform.xscale = (bounds.x1 - bounds.x0) * root_xform.xscale;
+	xform.yscale = (bounds.y1 - bounds.y0) * root_xform.yscale;
+	xform.color.r = item.color().r * root_xform.color.r;
+	xform.color.g = item.color().g * root_xform.color.g;
+	xform.color.b = item.color().b * root_xform.color.b;
+	xform.color.a = item.color().a * root_xform.color.a;
+	xform.orientation = orientation_add(item.orientation(), root_xform.orientation);
+	xform.no_center = false;
+}
+
+
 //-------------------------------------------------
 //  map_point_internal - internal logic for
 //  mapping points
@@ -3055,6 +3512,8 @@ render_manager::render_manager(running_machine &machine)
 		m_ui_target(nullptr),
 		m_live_textures(0),
 		m_texture_id(0),
+		m_element_atlas(*this),
+		m_scale_queue(nullptr),
 		m_ui_container(global_alloc(render_container(*this)))
 {
 	// register callbacks
@@ -3072,12 +3531,29 @@ render_manager::render_manager(running_machine &machine)
 
 render_manager::~render_manager()
 {
+	// let any textures being scaled finish before their owners go away
+	if (m_scale_queue != nullptr)
+	{
+		while (!osd_work_queue_wait(m_scale_queue, osd_ticks_per_second()))
+		{
+		}
+	}
+
 	// free all the containers since they may own textures
 	container_free(m_ui_container);
 	m_screen_container_list.reset();
 
+	// the atlas owns textures too
+	m_element_atlas.flush();
+
 	// better not be any outstanding textures when we die
 	assert(m_live_textures == 0);
+
+	if (m_scale_queue != nullptr)
+	{
+		osd_work_queue_free(m_scale_queue);
+		m_scale_queue = nullptr;
+	}
 }
 
 
@@ -3232,6 +3708,19 @@ render_texture *render_manager::texture_alloc(texture_scaler_func scaler, void *
 }
 
 
+//-------------------------------------------------
+//  scale_queue - return the queue for scaling
+//  textures off the main thread
+//-------------------------------------------------
+
+osd_work_queue *render_manager::scale_queue()
+{
+	if (m_scale_queue == nullptr)
+		m_scale_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	return m_scale_queue;
+}
+
+
 //-------------------------------------------------
 //  texture_free - release a texture
 //-------------------------------------------------
@@ -3241,6 +3730,7 @@ void render_manager::texture_free(render_texture *texture)
 	if (texture != nullptr)
 	{
 		m_live_textures--;
+		m_element_atlas.forget(*texture);
 		texture->release();
 	}
 	m_texture_allocator.reclaim(texture);
@@ -49,6 +49,7 @@
 #include "screen.h"
 
 #include <array>
+#include <atomic>
 #include <cmath>
 #include <functional>
 #include <map>
@@ -229,6 +230,11 @@ struct render_texinfo
 	u64                 old_id;             // previously allocated id, if applicable
 	const rgb_t *       palette;            // palette for PALETTE16 textures, bcg lookup table for RGB32/YUY16
 	u32                 palette_length;
+	u32                 dirty_top;          // first row changed since sequence ID seqid - 1
+	u32                 dirty_bottom;       // last row changed since sequence ID seqid - 1
+
+	// true if a copy last updated at cached_seqid only needs rows dirty_top..dirty_bottom
+	bool partial_update(u32 cached_seqid) const { return seqid == cached_seqid + 1 && (dirty_top != 0 || dirty_bottom != height - 1); }
 };
 
 
@@ -376,6 +382,7 @@ class render_texture
 	friend class fixed_allocator<render_texture>;
 	friend class render_manager;
 	friend class render_target;
+	friend class render_element_atlas;
 
 	// construction/destruction
 	render_texture();
@@ -398,12 +405,20 @@ public:
 	// set a unique identifier
 	void set_id(u64 id) { m_old_id = m_id; m_id = id; }
 
+	// dirty tracking; once enabled, new contents are only reported for areas marked dirty
+	void set_dirty_tracking(bool enable);
+	void mark_dirty(const rectangle &rect);
+	void mark_dirty() { mark_dirty(m_sbounds); }
+
+	// allow new sizes to be scaled on a worker; the scaler must then be safe to call off the main thread
+	void set_threaded_scaling(bool enable) { m_threaded_scaling = enable; }
+
 	// generic high-quality bitmap scaler
 	static void hq_scale(bitmap_argb32 &dest, bitmap_argb32 &source, const rectangle &sbounds, void *param);
 
 private:
 	// internal helpers
-	void get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo, render_primitive_list &primlist, u32 flags = 0);
+	void get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo, render_primitive_list &primlist, u32 flags = 0, u32 palette_serial = 0);
 	const rgb_t *get_adjusted_palette(render_container &container, u32 &out_length);
 
 	static const int MAX_TEXTURE_SCALES = 16;
@@ -415,6 +430,21 @@ private:
 		u32                 seqid;                  // sequence number
 	};
 
+	// a scale_job is a size being scaled on a worker
+	struct scale_job
+	{
+		render_texture *    texture;                // texture being scaled
+		bitmap_argb32 *     bitmap;                 // destination bitmap
+		std::atomic<bool>   done;                   // set by the worker when the bitmap is ready
+	};
+
+	// scaling helpers
+	scaled_texture &alloc_scaled(render_primitive_list &primlist, bitmap_argb32 *bitmap);
+	scaled_texture *latest_scaled();
+	void start_scaling(u32 dwidth, u32 dheight);
+	void cancel_scaling();
+	static void *scale_callback(void *param, int threadid);
+
 	// internal state
 	render_manager *    m_manager;                  // reference to our manager
 	render_texture *    m_next;                     // next texture (for free list)
@@ -429,6 +459,93 @@ private:
 	void *              m_param;                    // scaling callback parameter
 	u32                 m_curseq;                   // current sequence number
 	scaled_texture      m_scaled[MAX_TEXTURE_SCALES];// array of scaled variants of this texture
+	bool                m_threaded_scaling;         // scale new sizes on a worker
+	std::unique_ptr<scale_job> m_scale_job;         // size being scaled on a worker, if any
+
+	// dirty tracking state
+	bool                m_track_dirty;              // only bump the sequence number when marked dirty
+	rectangle           m_dirty;                    // area of the bitmap changed since the last sequence number
+	u32                 m_dirty_top;                // first row changed in the current sequence number
+	u32                 m_dirty_bottom;             // last row changed in the current sequence number
+	u32                 m_palette_serial;           // container palette serial seen with the current sequence number
+};
+
+
+// ======================> render_element_atlas
+
+// packs small scaled element textures into shared pages, so quads for many
+// elements reference the same texture and can be drawn together
+class render_element_atlas
+{
+public:
+	// where a scaled texture lives in the atlas
+	struct placement
+	{
+		render_texture *    page;               // page texture
+		render_bounds       uv;                 // texture coordinates of the image within the page
+	};
+
+	// construction/destruction
+	render_element_atlas(render_manager &manager);
+	~render_element_atlas();
+
+	// getters
+	u32 generation() const { return m_generation; }
+	s32 page_width() const { return PAGE_WIDTH; }
+	s32 page_height() const { return PAGE_HEIGHT; }
+
+	// find or draw a scaled element texture, or return nullptr if it should not be packed
+	const placement *find(render_texture &texture, s32 width, s32 height);
+
+	// once per frame, discard everything if the atlas filled up
+	void trim();
+
+	// drop entries for a texture being freed, or everything
+	void forget(const render_texture &texture);
+	void flush();
+
+private:
+	static constexpr s32 PAGE_WIDTH = 1024;
+	static constexpr s32 PAGE_HEIGHT = 1024;
+	static constexpr s32 MAX_IMAGE_SIZE = 254;      // largest image side packed; others keep their own textures
+	static constexpr unsigned MAX_PAGES = 8;
+	static constexpr unsigned FLUSH_INTERVAL = 120; // minimum frames between discarding a full atlas
+
+	// a row of images of similar height within a page
+	struct shelf
+	{
+		s32                 top;                // first row
+		s32                 height;             // rows including padding
+		s32                 left;               // first free column
+	};
+
+	// a page bitmap and its packing state
+	struct page
+	{
+		std::unique_ptr<bitmap_argb32> bitmap;  // packed images
+		render_texture *    texture;            // texture wrapping the bitmap
+		std::vector<shelf>  shelves;            // rows allocated so far
+		s32                 bottom;             // first row not in a shelf
+	};
+
+	// a scaled texture packed into a page
+	struct entry
+	{
+		s32                 width;              // scaled width
+		s32                 height;             // scaled height
+		placement           place;              // where it was packed
+	};
+
+	// internal helpers
+	bool allocate(s32 width, s32 height, unsigned &pagenum, rectangle &rect);
+
+	// internal state
+	render_manager &    m_manager;              // reference to our manager
+	std::vector<page>   m_pages;                // pages allocated so far
+	std::unordered_map<const render_texture *, std::vector<entry>> m_entries; // packed images by source texture
+	u32                 m_generation;           // incremented when placements are invalidated
+	bool                m_full;                 // an image did not fit since the last flush
+	unsigned            m_frames;               // frames since the last flush
 };
 
 
@@ -493,6 +610,7 @@ public:
 
 	// brightness/contrast/gamma helpers
 	bool has_brightness_contrast_gamma_changes() const { return (m_user.m_brightness != 1.0f || m_user.m_contrast != 1.0f || m_user.m_gamma != 1.0f); }
+	u32 palette_serial() const { return m_palette_serial; }
 	u8 apply_brightness_contrast_gamma(u8 value);
 	float apply_brightness_contrast_gamma_fp(float value);
 	const rgb_t *bcg_lookup_table(int texformat, u32 &out_length, palette_t *palette = nullptr);
@@ -550,6 +668,7 @@ private:
 	std::unique_ptr<palette_client> m_palclient;    // client to the screen palette
 	std::vector<rgb_t>      m_bcglookup;            // copy of screen palette with bcg adjustment
 	rgb_t                   m_bcglookup256[0x400];  // lookup table for brightness/contrast/gamma
+	u32                     m_palette_serial;       // bumped whenever either lookup table changes
 };
 
 
@@ -612,6 +731,9 @@ private:
 		// operations
 		virtual void draw(running_machine &machine, bitmap_argb32 &dest, const rectangle &bounds, int state) = 0;
 
+		// load anything draw needs up front; returns true if draw is then safe to call off the main thread
+		virtual bool prepare_threaded(running_machine &machine) { return false; }
+
 	protected:
 		// helper
 		virtual int maxstate() const { return -1; }
@@ -914,6 +1036,7 @@ public:
 	const visibility_toggle_vector &visibility_toggles() const { return m_vistoggles; }
 	u32 default_visibility_mask() const { return m_defvismask; }
 	bool has_art() const { return m_has_art; }
+	u32 recompute_count() const { return m_recompute_count; }
 
 	// operations
 	void recompute(u32 visibility_mask, bool zoom_to_screens);
@@ -950,6 +1073,7 @@ private:
 	edge_vector                 m_interactive_edges_x;
 	edge_vector                 m_interactive_edges_y;
 	screen_ref_vector           m_screens;          // list screens visible in current configuration
+	u32                         m_recompute_count;  // bumped whenever item bounds are recomputed
 
 	// cold items
 	visibility_toggle_vector    m_vistoggles;       // collections of items that can be shown/hidden
@@ -1084,6 +1208,43 @@ private:
 	// private classes declared in render.cpp
 	struct object_transform;
 
+	// primitive built for one layout element item, reused until its state changes
+	struct element_cache_entry
+	{
+		int                 state;                  // state the entry was built for, or -1 if never built
+		render_texture *    texture;                // texture for that state, or nullptr if none
+		s32                 texwidth;               // width to request the texture scaled to
+		s32                 texheight;              // height to request the texture scaled to
+		u32                 flags;                  // primitive flags
+		render_bounds       bounds;                 // clipped bounds
+		render_bounds       full_bounds;            // unclipped bounds
+		render_color        color;                  // primitive color
+		render_quad_texuv   texcoords;              // clipped texture coordinates
+		bool                clipped;                // entirely outside the target
+	};
+
+	// everything outside an item that affects its element primitive
+	struct element_cache_key
+	{
+		bool operator==(const element_cache_key &that) const
+		{
+			return view == that.view && recompute_count == that.recompute_count && visibility_mask == that.visibility_mask &&
+					xoffs == that.xoffs && yoffs == that.yoffs && xscale == that.xscale && yscale == that.yscale &&
+					orientation == that.orientation && width == that.width && height == that.height &&
+					maxtexwidth == that.maxtexwidth && maxtexheight == that.maxtexheight && atlas_generation == that.atlas_generation;
+		}
+		bool operator!=(const element_cache_key &that) const { return !(*this == that); }
+
+		layout_view *       view;
+		u32                 recompute_count;
+		u32                 visibility_mask;
+		float               xoffs, yoffs, xscale, yscale;
+		int                 orientation;
+		s32                 width, height;
+		int                 maxtexwidth, maxtexheight;
+		u32                 atlas_generation;
+	};
+
 	// internal helpers
 	enum constructor_impl_t { CONSTRUCTOR_IMPL };
 	template <typename T> render_target(render_manager &manager, T&& layout, u32 flags, constructor_impl_t);
@@ -1095,7 +1256,9 @@ private:
 	bool load_layout_file(const char *dirname, const internal_layout &layout_data, device_t *device = nullptr);
 	bool load_layout_file(device_t &device, const char *dirname, util::xml::data_node const &rootnode);
 	void add_container_primitives(render_primitive_list &list, const object_transform &root_xform, const object_transform &xform, render_container &container, int blendmode);
-	void add_element_primitives(render_primitive_list &list, const object_transform &xform, layout_element &element, int state, int blendmode);
+	void item_transform(const object_transform &root_xform, layout_view::item &item, object_transform &xform);
+	void build_element_primitive(element_cache_entry &entry, const object_transform &xform, layout_element &element, int state, int blendmode);
+	void add_element_primitives(render_primitive_list &list, const element_cache_entry &entry);
 	std::pair<float, float> map_point_internal(s32 target_x, s32 target_y);
 
 	// config callbacks
@@ -1144,6 +1307,8 @@ private:
 	int                     m_maxtexwidth;              // maximum width of a texture
 	int                     m_maxtexheight;             // maximum height of a texture
 	simple_list<render_container> m_debug_containers;   // list of debug containers
+	element_cache_key       m_element_cache_key;        // conditions the element cache was built under
+	std::vector<element_cache_entry> m_element_cache;   // cached element primitives, indexed by item
 	s32                     m_clear_extent_count;       // number of clear extents
 	s32                     m_clear_extents[MAX_CLEAR_EXTENTS]; // array of clear extents
 	bool                    m_transform_container;      // determines whether the screen container is transformed by the core renderer,
@@ -1158,6 +1323,7 @@ private:
 class render_manager
 {
 	friend class render_target;
+	friend class render_texture;
 
 public:
 	// construction/destruction
@@ -1201,6 +1367,9 @@ public:
 	// resolve tag lookups
 	void resolve_tags();
 
+	// queue for scaling textures off the main thread
+	osd_work_queue *scale_queue();
+
 private:
 	// containers
 	render_container *container_alloc(screen_device *screen = nullptr);
@@ -1221,6 +1390,8 @@ private:
 	u32                             m_live_textures;    // number of live textures
 	u64                             m_texture_id;       // rolling texture ID counter
 	fixed_allocator<render_texture> m_texture_allocator;// texture allocator
+	render_element_atlas            m_element_atlas;    // shared pages for small element textures
+	osd_work_queue *                m_scale_queue;      // queue for scaling textures off the main thread
 
 	// containers for the UI and for screens
 	render_container *              m_ui_container;     // UI container
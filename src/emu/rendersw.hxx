@@ -14,6 +14,17 @@
 #include "video/rgbutil.h"
 #include "render.h"
 
+#include <algorithm>
+
+// use SIMD arithmetic for bilinear spans where it is always available
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)) || defined(_M_X64))
+#include <emmintrin.h>
+#define RENDERSW_SSE 1
+#elif (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__ARM_NEON) || defined(__ARM_NEON__)) && defined(__aarch64__)
+#include <arm_neon.h>
+#define RENDERSW_NEON 1
+#endif
+
 
 template<typename _PixelType, int _SrcShiftR, int _SrcShiftG, int _SrcShiftB, int _DstShiftR, int _DstShiftG, int _DstShiftB, bool _NoDestRead = false, bool _BilinearFilter = false>
 class software_renderer
@@ -28,6 +39,27 @@ private:
 		s32 endx, endy;
 	};
 
+	// one horizontal band of a parallel draw
+	struct band_params
+	{
+		const render_primitive_list *primlist;
+		_PixelType *dstdata;
+		u32 width, height, pitch;
+		s32 miny, maxy;
+	};
+
+	// internal constants
+	static constexpr int MAX_BANDS = 16;            // most bands a draw is split into
+	static constexpr int MIN_BAND_HEIGHT = 32;      // bands shorter than this are not worth a thread
+	static constexpr int SPAN_TEXELS = 64;          // texels filtered at once by the span path
+
+	// filter whole spans at once when SIMD arithmetic is available
+#if defined(RENDERSW_SSE) || defined(RENDERSW_NEON)
+	static constexpr bool SPAN_FILTER = _BilinearFilter;
+#else
+	static constexpr bool SPAN_FILTER = false;
+#endif
+
 	// internal helpers
 	static inline bool is_opaque(float alpha) { return (alpha >= (_NoDestRead ? 0.5f : 1.0f)); }
 	static inline bool is_transparent(float alpha) { return (alpha < (_NoDestRead ? 0.5f : 0.0001f)); }
@@ -315,6 +347,164 @@ private:
 	}
 
 
+	//-------------------------------------------------
+	//  filter_texel - bilinear filter one texel the
+	//  same way as filter_texels4
+	//-------------------------------------------------
+
+	static inline u32 filter_texel(u32 c00, u32 c01, u32 c10, u32 c11, u32 u, u32 v)
+	{
+		u32 result = 0;
+		for (int shift = 0; shift < 32; shift += 8)
+		{
+			const u32 top = (((c00 >> shift) & 0xff) * (256 - u) + ((c01 >> shift) & 0xff) * u) >> 8;
+			const u32 bottom = (((c10 >> shift) & 0xff) * (256 - u) + ((c11 >> shift) & 0xff) * u) >> 8;
+			result |= ((top * (256 - v) + bottom * v) >> 8) << shift;
+		}
+		return result;
+	}
+
+
+	//-------------------------------------------------
+	//  filter_texels4 - bilinear filter four texels
+	//  from their corners and 8-bit weights
+	//-------------------------------------------------
+
+	static inline void filter_texels4(const u32 *c00, const u32 *c01, const u32 *c10, const u32 *c11, const u16 *u, const u16 *v, u32 *dest)
+	{
+#if defined(RENDERSW_SSE)
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i one = _mm_set1_epi16(256);
+		const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(c00));
+		const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(c01));
+		const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(c10));
+		const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(c11));
+		const __m128i ulo = _mm_set_epi16(u[1], u[1], u[1], u[1], u[0], u[0], u[0], u[0]);
+		const __m128i uhi = _mm_set_epi16(u[3], u[3], u[3], u[3], u[2], u[2], u[2], u[2]);
+		const __m128i vlo = _mm_set_epi16(v[1], v[1], v[1], v[1], v[0], v[0], v[0], v[0]);
+		const __m128i vhi = _mm_set_epi16(v[3], v[3], v[3], v[3], v[2], v[2], v[2], v[2]);
+		const __m128i iulo = _mm_sub_epi16(one, ulo), iuhi = _mm_sub_epi16(one, uhi);
+		const __m128i ivlo = _mm_sub_epi16(one, vlo), ivhi = _mm_sub_epi16(one, vhi);
+
+		// each sum fits in 16 unsigned bits because the weights add up to 256
+		const __m128i toplo = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(a, zero), iulo), _mm_mullo_epi16(_mm_unpacklo_epi8(b, zero), ulo)), 8);
+		const __m128i tophi = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(a, zero), iuhi), _mm_mullo_epi16(_mm_unpackhi_epi8(b, zero), uhi)), 8);
+		const __m128i botlo = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(c, zero), iulo), _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), ulo)), 8);
+		const __m128i bothi = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(c, zero), iuhi), _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), uhi)), 8);
+		const __m128i lo = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(toplo, ivlo), _mm_mullo_epi16(botlo, vlo)), 8);
+		const __m128i hi = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(tophi, ivhi), _mm_mullo_epi16(bothi, vhi)), 8);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(dest), _mm_packus_epi16(lo, hi));
+#elif defined(RENDERSW_NEON)
+		const uint8x16_t a = vreinterpretq_u8_u32(vld1q_u32(c00));
+		const uint8x16_t b = vreinterpretq_u8_u32(vld1q_u32(c01));
+		const uint8x16_t c = vreinterpretq_u8_u32(vld1q_u32(c10));
+		const uint8x16_t d = vreinterpretq_u8_u32(vld1q_u32(c11));
+		const uint16x8_t one = vdupq_n_u16(256);
+		const uint16x8_t ulo = vcombine_u16(vdup_n_u16(u[0]), vdup_n_u16(u[1]));
+		const uint16x8_t uhi = vcombine_u16(vdup_n_u16(u[2]), vdup_n_u16(u[3]));
+		const uint16x8_t vlo = vcombine_u16(vdup_n_u16(v[0]), vdup_n_u16(v[1]));
+		const uint16x8_t vhi = vcombine_u16(vdup_n_u16(v[2]), vdup_n_u16(v[3]));
+		const uint16x8_t iulo = vsubq_u16(one, ulo), iuhi = vsubq_u16(one, uhi);
+		const uint16x8_t ivlo = vsubq_u16(one, vlo), ivhi = vsubq_u16(one, vhi);
+
+		// each sum fits in 16 unsigned bits because the weights add up to 256
+		const uint16x8_t toplo = vshrq_n_u16(vmlaq_u16(vmulq_u16(vmovl_u8(vget_low_u8(a)), iulo), vmovl_u8(vget_low_u8(b)), ulo), 8);
+		const uint16x8_t tophi = vshrq_n_u16(vmlaq_u16(vmulq_u16(vmovl_u8(vget_high_u8(a)), iuhi), vmovl_u8(vget_high_u8(b)), uhi), 8);
+		const uint16x8_t botlo = vshrq_n_u16(vmlaq_u16(vmulq_u16(vmovl_u8(vget_low_u8(c)), iulo), vmovl_u8(vget_low_u8(d)), ulo), 8);
+		const uint16x8_t bothi = vshrq_n_u16(vmlaq_u16(vmulq_u16(vmovl_u8(vget_high_u8(c)), iuhi), vmovl_u8(vget_high_u8(d)), uhi), 8);
+		const uint16x8_t lo = vshrq_n_u16(vmlaq_u16(vmulq_u16(toplo, ivlo), botlo, vlo), 8);
+		const uint16x8_t hi = vshrq_n_u16(vmlaq_u16(vmulq_u16(tophi, ivhi), bothi, vhi), 8);
+		vst1q_u32(dest, vreinterpretq_u32_u8(vcombine_u8(vmovn_u16(lo), vmovn_u16(hi))));
+#else
+		for (int i = 0; i < 4; i++)
+			dest[i] = filter_texel(c00[i], c01[i], c10[i], c11[i], u[i], v[i]);
+#endif
+	}
+
+
+	//-------------------------------------------------
+	//  get_texels_bilinear - fetch and filter a run
+	//  of texels along a span; 16bpp sources are
+	//  looked up in palbase, 32bpp ones used as-is
+	//-------------------------------------------------
+
+	template <typename _SourceType>
+	static void get_texels_bilinear(const render_texinfo &texture, const rgb_t *palbase, s32 curu, s32 curv, s32 dudx, s32 dvdx, s32 count, u32 *texels)
+	{
+		const _SourceType *const base = reinterpret_cast<const _SourceType *>(texture.base);
+		u32 c00[4], c01[4], c10[4], c11[4];
+		u16 u[4], v[4];
+		int index = 0;
+
+		for (s32 x = 0; x < count; x++)
+		{
+			// clamp the corners exactly as the single texel fetches do
+			s32 u0 = curu >> 16;
+			s32 u1 = 1;
+			if (u0 < 0) u0 = u1 = 0;
+			else if (u0 + 1 >= texture.width) u0 = texture.width - 1, u1 = 0;
+			s32 v0 = curv >> 16;
+			s32 v1 = texture.rowpixels;
+			if (v0 < 0) v0 = v1 = 0;
+			else if (v0 + 1 >= texture.height) v0 = texture.height - 1, v1 = 0;
+
+			const _SourceType *const texbase = base + v0 * texture.rowpixels + u0;
+			if (sizeof(_SourceType) == 2)
+			{
+				c00[index] = palbase[texbase[0]];
+				c01[index] = palbase[texbase[u1]];
+				c10[index] = palbase[texbase[v1]];
+				c11[index] = palbase[texbase[u1 + v1]];
+			}
+			else
+			{
+				c00[index] = texbase[0];
+				c01[index] = texbase[u1];
+				c10[index] = texbase[v1];
+				c11[index] = texbase[u1 + v1];
+			}
+			u[index] = (curu >> 8) & 0xff;
+			v[index] = (curv >> 8) & 0xff;
+			curu += dudx;
+			curv += dvdx;
+
+			// filter whenever four texels are ready
+			if (++index == 4)
+			{
+				filter_texels4(c00, c01, c10, c11, u, v, texels);
+				texels += 4;
+				index = 0;
+			}
+		}
+
+		// and the leftovers one at a time
+		for (int i = 0; i < index; i++)
+			*texels++ = filter_texel(c00[i], c01[i], c10[i], c11[i], u[i], v[i]);
+	}
+
+
+	//-------------------------------------------------
+	//  draw_span_bilinear - draw a run of opaque,
+	//  uncoloured, bilinear filtered texels
+	//-------------------------------------------------
+
+	template <typename _SourceType>
+	static void draw_span_bilinear(const render_texinfo &texture, _PixelType *dest, s32 curu, s32 curv, s32 dudx, s32 dvdx, s32 count)
+	{
+		u32 texels[SPAN_TEXELS];
+		while (count > 0)
+		{
+			const s32 chunk = std::min<s32>(count, SPAN_TEXELS);
+			get_texels_bilinear<_SourceType>(texture, texture.palette, curu, curv, dudx, dvdx, chunk, texels);
+			for (s32 x = 0; x < chunk; x++)
+				*dest++ = source32_to_dest(texels[x]);
+			curu += chunk * dudx;
+			curv += chunk * dvdx;
+			count -= chunk;
+		}
+	}
+
+
 	//-------------------------------------------------
 	//  draw_aa_pixel - draw an antialiased pixel
 	//-------------------------------------------------
@@ -334,13 +524,33 @@ private:
 
 
 	//-------------------------------------------------
-	//  draw_line - draw a line or point
+	//  cosine_table - return the beam width table for
+	//  antialiased lines, building it on first use
+	//-------------------------------------------------
+
+	static const u32 *cosine_table()
+	{
+		// local statics are initialised once even if several bands get here together
+		static const struct table
+		{
+			table()
+			{
+				for (int entry = 0; entry <= 2048; entry++)
+					entries[entry] = int(double(1.0 / cos(atan(double(entry) / 2048.0))) * 0x10000000 + 0.5);
+			}
+			u32 entries[2049];
+		} s_table;
+		return s_table.entries;
+	}
+
+
+	//-------------------------------------------------
+	//  draw_line - draw a line or point, touching
+	//  only rows miny to maxy - 1
 	//-------------------------------------------------
 
-	static void draw_line(const render_primitive &prim, _PixelType *dstdata, s32 width, s32 height, u32 pitch)
+	static void draw_line(const render_primitive &prim, _PixelType *dstdata, s32 width, s32 miny, s32 maxy, u32 pitch)
 	{
-		// internal tables
-		static u32 s_cosine_table[2049];
 
 		// compute the start/end coordinates
 		int x1 = int(prim.bounds.x0 * 65536.0f);
@@ -353,10 +563,7 @@ private:
 
 		if (PRIMFLAG_GET_ANTIALIAS(prim.flags))
 		{
-			// build up the cosine table if we haven't yet
-			if (s_cosine_table[0] == 0)
-				for (int entry = 0; entry <= 2048; entry++)
-					s_cosine_table[entry] = int(double(1.0 / cos(atan(double(entry) / 2048.0))) * 0x10000000 + 0.5);
+			const u32 *const s_cosine_table = cosine_table();
 
 			int beam = prim.width * 65536.0f;
 			if (beam < 0x00010000)
@@ -382,7 +589,7 @@ private:
 					{
 						dx = bwidth;    // init diameter of beam
 						dy = y1 >> 16;
-						if (dy >= 0 && dy < height)
+						if (dy >= miny && dy < maxy)
 							draw_aa_pixel(dstdata, pitch, x1, dy, apply_intensity(0xff & (~y1 >> 8), col));
 						dy++;
 						dx -= 0x10000 - (0xffff & y1); // take off amount plotted
@@ -390,11 +597,11 @@ private:
 						dx >>= 16;                   // adjust to pixel (solid) count
 						while (dx--)                 // plot rest of pixels
 						{
-							if (dy >= 0 && dy < height)
+							if (dy >= miny && dy < maxy)
 								draw_aa_pixel(dstdata, pitch, x1, dy, col);
 							dy++;
 						}
-						if (dy >= 0 && dy < height)
+						if (dy >= miny && dy < maxy)
 							draw_aa_pixel(dstdata, pitch, x1, dy, apply_intensity(a1,col));
 					}
 					if (x1 == xx) break;
@@ -414,7 +621,7 @@ private:
 				x1 -= bwidth >> 1; // start back half the width
 				for (;;)
 				{
-					if (y1 >= 0 && y1 < height)
+					if (y1 >= miny && y1 < maxy)
 					{
 						dy = bwidth;    // calc diameter of beam
 						dx = x1 >> 16;
@@ -457,7 +664,7 @@ private:
 			{
 				for (;;)
 				{
-					if (x1 >= 0 && x1 < width && y1 >= 0 && y1 < height)
+					if (x1 >= 0 && x1 < width && y1 >= miny && y1 < maxy)
 						draw_aa_pixel(dstdata, pitch, x1, y1, col);
 					if (x1 == x2) break;
 					x1 += sx;
@@ -473,7 +680,7 @@ private:
 			{
 				for (;;)
 				{
-					if (x1 >= 0 && x1 < width && y1 >= 0 && y1 < height)
+					if (x1 >= 0 && x1 < width && y1 >= miny && y1 < maxy)
 						draw_aa_pixel(dstdata, pitch, x1, y1, col);
 					if (y1 == y2) break;
 					y1 += sy;
@@ -495,10 +702,11 @@ private:
 	//**************************************************************************
 
 	//-------------------------------------------------
-	//  draw_rect - draw a solid rectangle
+	//  draw_rect - draw a solid rectangle, touching
+	//  only rows miny to maxy - 1
 	//-------------------------------------------------
 
-	static void draw_rect(const render_primitive &prim, _PixelType *dstdata, s32 width, s32 height, u32 pitch)
+	static void draw_rect(const render_primitive &prim, _PixelType *dstdata, s32 width, s32 miny, s32 maxy, u32 pitch)
 	{
 		render_bounds fpos = prim.bounds;
 		assert(fpos.x0 <= fpos.x1);
@@ -515,10 +723,10 @@ private:
 		if (startx >= width) startx = width;
 		if (endx < 0) endx = 0;
 		if (endx >= width) endx = width;
-		if (starty < 0) starty = 0;
-		if (starty >= height) starty = height;
-		if (endy < 0) endy = 0;
-		if (endy >= height) endy = height;
+		if (starty < miny) starty = miny;
+		if (starty >= maxy) starty = maxy;
+		if (endy < miny) endy = miny;
+		if (endy >= maxy) endy = maxy;
 
 		// bail if nothing left
 		if (fpos.x0 > fpos.x1 || fpos.y0 > fpos.y1)
@@ -618,13 +826,20 @@ private:
 				s32 curu = setup.startu + (y - setup.starty) * setup.dudy;
 				s32 curv = setup.startv + (y - setup.starty) * setup.dvdy;
 
-				// loop over cols
-				for (s32 x = setup.startx; x < setup.endx; x++)
+				// filter the whole row at once if we can
+				if (SPAN_FILTER)
+					draw_span_bilinear<u16>(prim.texture, dest, curu, curv, setup.dudx, setup.dvdx, setup.endx - setup.startx);
+
+				// otherwise loop over cols
+				else
 				{
-					const u32 pix = get_texel_palette16(prim.texture, curu, curv);
-					*dest++ = source32_to_dest(pix);
-					curu += setup.dudx;
-					curv += setup.dvdx;
+					for (s32 x = setup.startx; x < setup.endx; x++)
+					{
+						const u32 pix = get_texel_palette16(prim.texture, curu, curv);
+						*dest++ = source32_to_dest(pix);
+						curu += setup.dudx;
+						curv += setup.dvdx;
+					}
 				}
 			}
 		}
@@ -999,13 +1214,20 @@ private:
 				// no lookup case
 				if (palbase == nullptr)
 				{
-					// loop over cols
-					for (s32 x = setup.startx; x < setup.endx; x++)
+					// filter the whole row at once if we can
+					if (SPAN_FILTER)
+						draw_span_bilinear<u32>(prim.texture, dest, curu, curv, setup.dudx, setup.dvdx, setup.endx - setup.startx);
+
+					// otherwise loop over cols
+					else
 					{
-						const u32 pix = get_texel_rgb32(prim.texture, curu, curv);
-						*dest++ = source32_to_dest(pix);
-						curu += setup.dudx;
-						curv += setup.dvdx;
+						for (s32 x = setup.startx; x < setup.endx; x++)
+						{
+							const u32 pix = get_texel_rgb32(prim.texture, curu, curv);
+							*dest++ = source32_to_dest(pix);
+							curu += setup.dudx;
+							curv += setup.dvdx;
+						}
 					}
 				}
 
@@ -1694,10 +1916,11 @@ private:
 	//-------------------------------------------------
 	//  setup_and_draw_textured_quad - perform setup
 	//  and then dispatch to a texture-mode-specific
-	//  drawing routine
+	//  drawing routine, touching only rows miny to
+	//  maxy - 1
 	//-------------------------------------------------
 
-	static void setup_and_draw_textured_quad(const render_primitive &prim, _PixelType *dstdata, s32 width, s32 height, u32 pitch)
+	static void setup_and_draw_textured_quad(const render_primitive &prim, _PixelType *dstdata, s32 width, s32 height, s32 miny, s32 maxy, u32 pitch)
 	{
 		assert(prim.bounds.x0 <= prim.bounds.x1);
 		assert(prim.bounds.y0 <= prim.bounds.y1);
@@ -1744,6 +1967,16 @@ private:
 			setup.startv -= 0x8000;
 		}
 
+		// trim to the band, stepping U/V on so the texels match a full draw
+		if (setup.starty < miny)
+		{
+			setup.startu += (miny - setup.starty) * setup.dudy;
+			setup.startv += (miny - setup.starty) * setup.dvdy;
+			setup.starty = miny;
+		}
+		if (setup.endy > maxy)
+			setup.endy = maxy;
+
 		// render based on the texture coordinates
 		switch (prim.flags & (PRIMFLAG_TEXFORMAT_MASK | PRIMFLAG_BLENDMODE_MASK))
 		{
@@ -1806,24 +2039,89 @@ private:
 
 public:
 	static void draw_primitives(const render_primitive_list &primlist, void *dstdata, u32 width, u32 height, u32 pitch)
+	{
+		draw_band(primlist, reinterpret_cast<_PixelType *>(dstdata), width, height, pitch, 0, height);
+	}
+
+	//-------------------------------------------------
+	//  draw_primitives - draw a series of primitives,
+	//  splitting the target into up to the requested
+	//  number of horizontal bands drawn in parallel
+	//  on the given work queue
+	//-------------------------------------------------
+
+	static void draw_primitives(const render_primitive_list &primlist, void *dstdata, u32 width, u32 height, u32 pitch, osd_work_queue *queue, int bands)
+	{
+		bands = std::min(std::min(bands, MAX_BANDS), int(height) / MIN_BAND_HEIGHT);
+		if (queue == nullptr || bands < 2)
+		{
+			draw_primitives(primlist, dstdata, width, height, pitch);
+			return;
+		}
+
+		// divide the target evenly, giving any remainder to the leading bands
+		band_params params[MAX_BANDS];
+		s32 top = 0;
+		for (int band = 0; band < bands; band++)
+		{
+			const s32 rows = s32(height) / bands + ((band < s32(height) % bands) ? 1 : 0);
+			params[band].primlist = &primlist;
+			params[band].dstdata = reinterpret_cast<_PixelType *>(dstdata);
+			params[band].width = width;
+			params[band].height = height;
+			params[band].pitch = pitch;
+			params[band].miny = top;
+			params[band].maxy = top + rows;
+			top += rows;
+		}
+
+		// hand all but the first to the work queue and draw that one here
+		osd_work_item_queue_multiple(queue, draw_band_callback, bands - 1, &params[1], sizeof(params[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		draw_band(primlist, params[0].dstdata, width, height, pitch, params[0].miny, params[0].maxy);
+
+		// the target must be complete when we return
+		while (!osd_work_queue_wait(queue, osd_ticks_per_second()))
+		{
+		}
+	}
+
+private:
+	//-------------------------------------------------
+	//  draw_band - draw every primitive, touching
+	//  only rows miny to maxy - 1 of the target
+	//-------------------------------------------------
+
+	static void draw_band(const render_primitive_list &primlist, _PixelType *dstdata, u32 width, u32 height, u32 pitch, s32 miny, s32 maxy)
 	{
 		// loop over the list and render each element
 		for (const render_primitive *prim = primlist.first(); prim != nullptr; prim = prim->next())
 			switch (prim->type)
 			{
 				case render_primitive::LINE:
-					draw_line(*prim, reinterpret_cast<_PixelType *>(dstdata), width, height, pitch);
+					draw_line(*prim, dstdata, width, miny, maxy, pitch);
 					break;
 
 				case render_primitive::QUAD:
 					if (!prim->texture.base)
-						draw_rect(*prim, reinterpret_cast<_PixelType *>(dstdata), width, height, pitch);
+						draw_rect(*prim, dstdata, width, miny, maxy, pitch);
 					else
-						setup_and_draw_textured_quad(*prim, reinterpret_cast<_PixelType *>(dstdata), width, height, pitch);
+						setup_and_draw_textured_quad(*prim, dstdata, width, height, miny, maxy, pitch);
 					break;
 
 				default:
 					throw emu_fatalerror("Unexpected render_primitive type");
 			}
 	}
+
+	//-------------------------------------------------
+	//  draw_band_callback - work queue callback for
+	//  drawing one band
+	//-------------------------------------------------
+
+	static void *draw_band_callback(void *param, int threadid)
+	{
+		const band_params &band = *reinterpret_cast<const band_params *>(param);
+		draw_band(*band.primlist, band.dstdata, band.width, band.height, band.pitch, band.miny, band.maxy);
+		return nullptr;
+	}
 };
@@ -117,7 +117,7 @@ class bdc_header
 {
 public:
 	static constexpr unsigned MAJVERSION = 1;
-	static constexpr unsigned MINVERSION = 0;
+	static constexpr unsigned MINVERSION = 1;
 
 	bool read(emu_file &f)
 	{
@@ -264,8 +264,9 @@ u8 const bdc_header::MAGIC[OFFS_MAJVERSION - OFFS_MAGIC] = { 'b', 'd', 'c', 'f',
 class bdc_table_entry
 {
 public:
-	bdc_table_entry(void *bytes)
+	bdc_table_entry(void *bytes, unsigned minver = bdc_header::MINVERSION)
 		: m_ptr(reinterpret_cast<u8 *>(bytes))
+		, m_minver(minver)
 	{
 	}
 	bdc_table_entry(bdc_table_entry const &that) = default;
@@ -273,7 +274,11 @@ public:
 
 	bdc_table_entry get_next() const
 	{
-		return bdc_table_entry(m_ptr + OFFS_END);
+		return bdc_table_entry(m_ptr + size(m_minver), m_minver);
+	}
+	bool has_data_offset() const
+	{
+		return m_minver >= 1;
 	}
 
 	u32 get_encoding() const
@@ -314,6 +319,14 @@ public:
 				(u16(m_ptr[OFFS_BBHEIGHT + 0]) << (1 * 8)) |
 				(u16(m_ptr[OFFS_BBHEIGHT + 1]) << (0 * 8));
 	}
+	u32 get_data_offset() const
+	{
+		return
+				(u32(m_ptr[OFFS_DATAOFFS + 0]) << (3 * 8)) |
+				(u32(m_ptr[OFFS_DATAOFFS + 1]) << (2 * 8)) |
+				(u32(m_ptr[OFFS_DATAOFFS + 2]) << (1 * 8)) |
+				(u32(m_ptr[OFFS_DATAOFFS + 3]) << (0 * 8));
+	}
 
 	void set_encoding(u32 value)
 	{
@@ -347,13 +360,21 @@ public:
 		m_ptr[OFFS_BBHEIGHT + 0] = u8((value >> (1 * 8)) & 0x00ff);
 		m_ptr[OFFS_BBHEIGHT + 1] = u8((value >> (0 * 8)) & 0x00ff);
 	}
+	void set_data_offset(u32 value)
+	{
+		m_ptr[OFFS_DATAOFFS + 0] = u8((value >> (3 * 8)) & 0x00ff);
+		m_ptr[OFFS_DATAOFFS + 1] = u8((value >> (2 * 8)) & 0x00ff);
+		m_ptr[OFFS_DATAOFFS + 2] = u8((value >> (1 * 8)) & 0x00ff);
+		m_ptr[OFFS_DATAOFFS + 3] = u8((value >> (0 * 8)) & 0x00ff);
+	}
 
 	bdc_table_entry &operator=(bdc_table_entry const &that) = default;
 	bdc_table_entry &operator=(bdc_table_entry &&that) = default;
 
-	static std::size_t size()
+	// version 1.0 entries have no data offset, so glyphs can only be found by walking the whole table
+	static std::size_t size(unsigned minver = bdc_header::MINVERSION)
 	{
-		return OFFS_END;
+		return minver ? OFFS_END : OFFS_DATAOFFS;
 	}
 
 private:
@@ -364,9 +385,12 @@ private:
 	static constexpr std::size_t    OFFS_BBYOFFSET  = 0x0a; // 0x02 bytes (big-endian binary integer)
 	static constexpr std::size_t    OFFS_BBWIDTH    = 0x0c; // 0x02 bytes (big-endian binary integer)
 	static constexpr std::size_t    OFFS_BBHEIGHT   = 0x0e; // 0x02 bytes (big-endian binary integer)
-	static constexpr std::size_t    OFFS_END        = 0x10;
+	static constexpr std::size_t    OFFS_DATAOFFS   = 0x10; // 0x04 bytes (big-endian binary integer, from the end of the table; version 1.1 and later)
+	// four bytes reserved
+	static constexpr std::size_t    OFFS_END        = 0x18;
 
 	u8                              *m_ptr;
+	unsigned                        m_minver;
 };
 
 } // anonymous namespace
@@ -445,6 +469,7 @@ void convert_command_glyph(std::string &str)
 
 
 const u64 render_font::CACHED_BDF_HASH_SIZE;
+constexpr int render_font::glyph_atlas::PAGE_SIZE;
 
 //**************************************************************************
 //  INLINE FUNCTIONS
@@ -523,7 +548,7 @@ inline render_font::glyph &render_font::get_char(char32_t chnum)
 			gl.bmwidth = int(glyph_ch.bmwidth * scale + 0.5f);
 			gl.bmheight = int(glyph_ch.bmheight * scale + 0.5f);
 
-			gl.bitmap.allocate(gl.bmwidth, gl.bmheight);
+			m_atlas.place(gl.bitmap, gl.bmwidth, gl.bmheight);
 			rectangle clip(
 					0, glyph_ch.bitmap.width() - 1,
 					0, glyph_ch.bitmap.height() - 1);
@@ -544,6 +569,49 @@ inline render_font::glyph &render_font::get_char(char32_t chnum)
 
 
 
+//-------------------------------------------------
+//  glyph_atlas::place - point a glyph bitmap at
+//  free space in the atlas
+//-------------------------------------------------
+
+void render_font::glyph_atlas::place(bitmap_argb32 &dest, int width, int height)
+{
+	// handle empty requests the way allocate does
+	if ((width <= 0) || (height <= 0))
+	{
+		dest.reset();
+		return;
+	}
+
+	// anything too big for a page gets one to itself
+	if ((width > PAGE_SIZE) || (height > PAGE_SIZE))
+	{
+		m_pages.emplace_back(std::make_unique<bitmap_argb32>(width, height));
+		bitmap_argb32 &page(*m_pages.back());
+		dest.wrap(&page.pix(0), width, height, page.rowpixels());
+		return;
+	}
+
+	// glyphs go left to right along shelves, leaving a pixel between neighbours so filtering can't bleed
+	if ((m_x + width) > PAGE_SIZE)
+	{
+		m_x = 0;
+		m_y += m_shelf + 1;
+		m_shelf = 0;
+	}
+	if (!m_page || ((m_y + height) > PAGE_SIZE))
+	{
+		m_pages.emplace_back(std::make_unique<bitmap_argb32>(PAGE_SIZE, PAGE_SIZE));
+		m_page = m_pages.back().get();
+		m_x = m_y = m_shelf = 0;
+	}
+	dest.wrap(&m_page->pix(m_y, m_x), width, height, m_page->rowpixels());
+	m_x += width + 1;
+	m_shelf = (std::max)(m_shelf, height);
+}
+
+
+
 //**************************************************************************
 //  RENDER FONT
 //**************************************************************************
@@ -654,9 +722,8 @@ void render_font::char_expand(char32_t chnum, glyph &gl)
 		if (gl.bmwidth == 0 || gl.bmheight == 0 || gl.rawdata == nullptr)
 			return;
 
-		// allocate a new bitmap of the size we need
-		gl.bitmap.allocate(gl.bmwidth, m_height_cmd);
-		gl.bitmap.fill(0);
+		// find space for the bitmap in the atlas
+		m_atlas.place(gl.bitmap, gl.bmwidth, m_height_cmd);
 
 		// extract the data
 		const char *ptr = gl.rawdata;
@@ -686,7 +753,8 @@ void render_font::char_expand(char32_t chnum, glyph &gl)
 			LOG("render_font::char_expand: previously failed to get bitmap from OSD font\n");
 			return;
 		}
-		if (!m_osdfont->get_bitmap(chnum, gl.bitmap, gl.width, gl.xoffs, gl.yoffs))
+		bitmap_argb32 tempbitmap;
+		if (!m_osdfont->get_bitmap(chnum, tempbitmap, gl.width, gl.xoffs, gl.yoffs))
 		{
 			// attempt to get the font bitmap failed - set bmwidth to -1
 			LOG("render_font::char_expand: get bitmap from OSD font failed\n");
@@ -696,10 +764,13 @@ void render_font::char_expand(char32_t chnum, glyph &gl)
 		}
 		else
 		{
-			// populate the bmwidth/bmheight fields
-			LOG("render_font::char_expand: got %dx%d bitmap from OSD font\n", gl.bitmap.width(), gl.bitmap.height());
-			gl.bmwidth = gl.bitmap.width();
-			gl.bmheight = gl.bitmap.height();
+			// populate the bmwidth/bmheight fields and move the bitmap into the atlas
+			LOG("render_font::char_expand: got %dx%d bitmap from OSD font\n", tempbitmap.width(), tempbitmap.height());
+			gl.bmwidth = tempbitmap.width();
+			gl.bmheight = tempbitmap.height();
+			m_atlas.place(gl.bitmap, gl.bmwidth, gl.bmheight);
+			for (int y = 0; gl.bitmap.valid() && (y < gl.bmheight); y++)
+				std::copy_n(&tempbitmap.pix(y), gl.bmwidth, &gl.bitmap.pix(y));
 		}
 	}
 	else if (!gl.bmwidth || !gl.bmheight || !gl.rawdata)
@@ -713,9 +784,8 @@ void render_font::char_expand(char32_t chnum, glyph &gl)
 		// other formats need to parse their data
 		LOG("render_font::char_expand: building bitmap from raw data\n");
 
-		// allocate a new bitmap of the size we need
-		gl.bitmap.allocate(gl.bmwidth, m_height);
-		gl.bitmap.fill(0);
+		// find space for the bitmap in the atlas
+		m_atlas.place(gl.bitmap, gl.bmwidth, m_height);
 
 		// extract the data
 		const char *ptr = gl.rawdata;
@@ -1361,7 +1431,7 @@ bool render_font::load_cached(emu_file &file, u64 length, u32 hash)
 		osd_printf_warning("render_font::load_cached: error reading BDC header\n");
 		return false;
 	}
-	else if (!header.check_magic() || (bdc_header::MAJVERSION != header.get_major_version()) || (bdc_header::MINVERSION != header.get_minor_version()))
+	else if (!header.check_magic() || (bdc_header::MAJVERSION != header.get_major_version()) || (bdc_header::MINVERSION < header.get_minor_version()))
 	{
 		LOG("render_font::load_cached: incompatible BDC file\n");
 		return false;
@@ -1371,6 +1441,12 @@ bool render_font::load_cached(emu_file &file, u64 length, u32 hash)
 		LOG("render_font::load_cached: BDC file does not match original BDF file\n");
 		return false;
 	}
+	else if (length && (bdc_header::MINVERSION != header.get_minor_version()))
+	{
+		// regenerate caches written by older versions so they pick up the glyph data offsets
+		LOG("render_font::load_cached: outdated BDC file\n");
+		return false;
+	}
 
 	// get global properties from the header
 	m_height = header.get_height();
@@ -1378,7 +1454,7 @@ bool render_font::load_cached(emu_file &file, u64 length, u32 hash)
 	m_yoffs = header.get_y_offset();
 	m_defchar = header.get_default_character();
 	u32 const numchars(header.get_glyph_count());
-	if ((file.tell() + (u64(numchars) * bdc_table_entry::size())) > filesize)
+	if ((file.tell() + (u64(numchars) * bdc_table_entry::size(header.get_minor_version()))) > filesize)
 	{
 		LOG("render_font::load_cached: BDC file is too small to hold glyph table\n");
 		return false;
@@ -1407,48 +1483,72 @@ bool render_font::load_cached(emu_file &file, u64 length, u32 hash)
 	}
 
 	// extract the data from the data
-	std::size_t offset(std::size_t(numchars) * bdc_table_entry::size());
-	bdc_table_entry entry(m_rawdata.empty() ? nullptr : &m_rawdata[0]);
+	if (!load_glyph_table(m_rawdata, numchars, header.get_minor_version(), m_glyphs, "load_cached"))
+		return false;
+
+	// got everything
+	m_format = format::CACHED;
+	return true;
+}
+
+
+//-------------------------------------------------
+//  load_glyph_table - fill in glyphs from the
+//  table at the start of BDC data
+//-------------------------------------------------
+
+bool render_font::load_glyph_table(std::vector<char> &rawdata, u32 numchars, unsigned minver, glyph **pages, const char *caller)
+{
+	std::size_t const table(std::size_t(numchars) * bdc_table_entry::size(minver));
+	std::size_t offset(table);
+	bdc_table_entry entry(rawdata.empty() ? nullptr : &rawdata[0], minver);
 	for (unsigned chindex = 0; chindex < numchars; chindex++, entry = entry.get_next())
 	{
+		u32 const chnum(entry.get_encoding());
+		LOG("render_font::%s: loading character %u\n", caller, unsigned(chnum));
+		if ((chnum / 256) >= ARRAY_LENGTH(m_glyphs))
+		{
+			osd_printf_verbose("render_font::%s: BDC file has out of range character %u\n", caller, unsigned(chnum));
+			rawdata.clear();
+			return false;
+		}
+
 		// if we don't have a subtable yet, make one
-		int const chnum(entry.get_encoding());
-		LOG("render_font::load_cached: loading character %d\n", chnum);
-		if (!m_glyphs[chnum / 256])
+		if (!pages[chnum / 256])
 		{
 			try
 			{
-				m_glyphs[chnum / 256] = new glyph[256];
+				pages[chnum / 256] = new glyph[256];
 			}
 			catch (...)
 			{
-				osd_printf_error("render_font::load_cached: allocation error\n");
-				m_rawdata.clear();
+				osd_printf_error("render_font::%s: allocation error\n", caller);
+				rawdata.clear();
 				return false;
 			}
 		}
 
 		// fill in the entry
-		glyph &gl = m_glyphs[chnum / 256][chnum % 256];
+		glyph &gl = pages[chnum / 256][chnum % 256];
 		gl.width = entry.get_x_advance();
 		gl.xoffs = entry.get_bb_x_offset();
 		gl.yoffs = entry.get_bb_y_offset();
 		gl.bmwidth = entry.get_bb_width();
 		gl.bmheight = entry.get_bb_height();
-		gl.rawdata = &m_rawdata[offset];
 
-		// advance the offset past the character
-		offset += (gl.bmwidth * gl.bmheight + 7) / 8;
-		if (m_rawdata.size() < offset)
+		// newer files say where the data is, older ones pack it in table order
+		if (entry.has_data_offset())
+			offset = table + entry.get_data_offset();
+		std::size_t const end(offset + (gl.bmwidth * gl.bmheight + 7) / 8);
+		if ((rawdata.size() < end) || (end < offset))
 		{
-			osd_printf_verbose("render_font::load_cached: BDC file too small to hold all glyphs\n");
-			m_rawdata.clear();
+			osd_printf_verbose("render_font::%s: BDC file too small to hold all glyphs\n", caller);
+			rawdata.clear();
 			return false;
 		}
+		gl.rawdata = &rawdata[0] + offset;
+		offset = end;
 	}
-
-	// got everything
-	m_format = format::CACHED;
 	return true;
 }
 
@@ -1512,12 +1612,16 @@ bool render_font::save_cached(const char *filename, u64 length, u32 hash)
 
 		// loop over all characters
 		bdc_table_entry table_entry(chartable.empty() ? nullptr : &chartable[0]);
+		u64 dataoffs(0);
 		for (unsigned chnum = 0; chnum < (256 * ARRAY_LENGTH(m_glyphs)); chnum++)
 		{
 			if (m_glyphs[chnum / 256] && (0 < m_glyphs[chnum / 256][chnum % 256].width))
 			{
 				LOG("render_font::save_cached: writing glyph %u\n", chnum);
 				glyph &gl(get_char(chnum));
+				if (dataoffs > std::numeric_limits<u32>::max())
+					throw emu_fatalerror("Too much glyph data for cached file");
+				table_entry.set_data_offset(u32(dataoffs));
 
 				// write out a bit-compressed bitmap if we have one
 				if (gl.bitmap.valid())
@@ -1553,6 +1657,7 @@ bool render_font::save_cached(const char *filename, u64 length, u32 hash)
 					bytes_written = file.write(&tempbuffer[0], dest - &tempbuffer[0]);
 					if (bytes_written != dest - &tempbuffer[0])
 						throw emu_fatalerror("Error writing cached file");
+					dataoffs += bytes_written;
 
 					// free the bitmap and texture
 					m_manager.texture_free(gl.texture);
@@ -1613,7 +1718,7 @@ void render_font::render_font_command_glyph()
 			osd_printf_warning("render_font::render_font_command_glyph: error reading BDC header\n");
 			return;
 		}
-		else if (!header.check_magic() || (bdc_header::MAJVERSION != header.get_major_version()) || (bdc_header::MINVERSION != header.get_minor_version()))
+		else if (!header.check_magic() || (bdc_header::MAJVERSION != header.get_major_version()) || (bdc_header::MINVERSION < header.get_minor_version()))
 		{
 			LOG("render_font::render_font_command_glyph: incompatible BDC file\n");
 			return;
@@ -1623,7 +1728,7 @@ void render_font::render_font_command_glyph()
 		m_height_cmd = header.get_height();
 		m_yoffs_cmd = header.get_y_offset();
 		u32 const numchars(header.get_glyph_count());
-		if ((file.tell() + (u64(numchars) * bdc_table_entry::size())) > filesize)
+		if ((file.tell() + (u64(numchars) * bdc_table_entry::size(header.get_minor_version()))) > filesize)
 		{
 			LOG("render_font::render_font_command_glyph: BDC file is too small to hold glyph table\n");
 			return;
@@ -1652,44 +1757,6 @@ void render_font::render_font_command_glyph()
 		}
 
 		// extract the data from the data
-		std::size_t offset(std::size_t(numchars) * bdc_table_entry::size());
-		bdc_table_entry entry(m_rawdata_cmd.empty() ? nullptr : &m_rawdata_cmd[0]);
-		for (unsigned chindex = 0; chindex < numchars; chindex++, entry = entry.get_next())
-		{
-			// if we don't have a subtable yet, make one
-			int const chnum(entry.get_encoding());
-			LOG("render_font::render_font_command_glyph: loading character %d\n", chnum);
-			if (!m_glyphs_cmd[chnum / 256])
-			{
-				try
-				{
-					m_glyphs_cmd[chnum / 256] = new glyph[256];
-				}
-				catch (...)
-				{
-					osd_printf_error("render_font::render_font_command_glyph: allocation error\n");
-					m_rawdata_cmd.clear();
-					return;
-				}
-			}
-
-			// fill in the entry
-			glyph &gl = m_glyphs_cmd[chnum / 256][chnum % 256];
-			gl.width = entry.get_x_advance();
-			gl.xoffs = entry.get_bb_x_offset();
-			gl.yoffs = entry.get_bb_y_offset();
-			gl.bmwidth = entry.get_bb_width();
-			gl.bmheight = entry.get_bb_height();
-			gl.rawdata = &m_rawdata_cmd[offset];
-
-			// advance the offset past the character
-			offset += (gl.bmwidth * gl.bmheight + 7) / 8;
-			if (m_rawdata_cmd.size() < offset)
-			{
-				osd_printf_verbose("render_font::render_font_command_glyph: BDC file too small to hold all glyphs\n");
-				m_rawdata_cmd.clear();
-				return;
-			}
-		}
+		load_glyph_table(m_rawdata_cmd, numchars, header.get_minor_version(), m_glyphs_cmd, "render_font_command_glyph");
 	}
 }
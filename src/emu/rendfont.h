@@ -13,6 +13,9 @@
 
 #include "render.h"
 
+#include <memory>
+#include <vector>
+
 //**************************************************************************
 //  TYPE DEFINITIONS
 //**************************************************************************
@@ -69,6 +72,23 @@ private:
 		rgb_t               color;
 	};
 
+	// glyph bitmaps are packed into shared atlas pages rather than allocated one by one
+	class glyph_atlas
+	{
+	public:
+		glyph_atlas() : m_page(nullptr), m_x(0), m_y(0), m_shelf(0) { }
+
+		void place(bitmap_argb32 &dest, int width, int height);
+
+	private:
+		static constexpr int PAGE_SIZE = 256;
+
+		std::vector<std::unique_ptr<bitmap_argb32> > m_pages;
+		bitmap_argb32 *     m_page;             // page currently being filled
+		int                 m_x, m_y;           // next free position on the current shelf
+		int                 m_shelf;            // height of the current shelf
+	};
+
 	// internal format
 	enum class format
 	{
@@ -84,6 +104,7 @@ private:
 	bool load_cached_bdf(const char *filename);
 	bool load_bdf();
 	bool load_cached(emu_file &file, u64 length, u32 hash);
+	bool load_glyph_table(std::vector<char> &rawdata, u32 numchars, unsigned minver, glyph **pages, const char *caller);
 	bool save_cached(const char *filename, u64 length, u32 hash);
 
 	void render_font_command_glyph();
@@ -99,6 +120,7 @@ private:
 	std::vector<char>   m_rawdata;          // pointer to the raw data for the font
 	u64                 m_rawsize;          // size of the raw font data
 	std::unique_ptr<osd_font> m_osdfont;    // handle to the OSD font
+	glyph_atlas         m_atlas;            // pages holding the expanded glyph bitmaps
 
 	int                 m_height_cmd;       // height of the font, from ascent to descent
 	int                 m_yoffs_cmd;        // y offset from baseline to descent
@@ -1296,6 +1296,12 @@ render_texture *layout_element::state_texture(int state)
 		m_elemtex[state].m_element = this;
 		m_elemtex[state].m_state = state;
 		m_elemtex[state].m_texture = machine().render().texture_alloc(element_scale, &m_elemtex[state]);
+
+		// new sizes can be scaled on a worker if every component can be drawn there
+		bool threaded = true;
+		for (auto const &curcomp : m_complist)
+			threaded = curcomp->prepare_threaded(machine()) && threaded;
+		m_elemtex[state].m_texture->set_threaded_scaling(threaded);
 	}
 	return m_elemtex[state].m_texture;
 }
@@ -1347,6 +1353,13 @@ public:
 
 protected:
 	// overrides
+	virtual bool prepare_threaded(running_machine &machine) override
+	{
+		if (!m_bitmap.valid())
+			load_bitmap(machine);
+		return true;
+	}
+
 	virtual void draw(running_machine &machine, bitmap_argb32 &dest, const rectangle &bounds, int state) override
 	{
 		if (!m_bitmap.valid())
@@ -1459,6 +1472,8 @@ public:
 
 protected:
 	// overrides
+	virtual bool prepare_threaded(running_machine &machine) override { return true; }
+
 	virtual void draw(running_machine &machine, bitmap_argb32 &dest, const rectangle &bounds, int state) override
 	{
 		// compute premultiplied colors
@@ -1506,6 +1521,8 @@ public:
 
 protected:
 	// overrides
+	virtual bool prepare_threaded(running_machine &machine) override { return true; }
+
 	virtual void draw(running_machine &machine, bitmap_argb32 &dest, const rectangle &bounds, int state) override
 	{
 		// compute premultiplied colors
@@ -3328,6 +3345,7 @@ layout_view::layout_view(
 	: m_name(make_name(env, viewnode))
 	, m_effaspect(1.0f)
 	, m_items()
+	, m_recompute_count(0U)
 	, m_defvismask(0U)
 	, m_has_art(false)
 {
@@ -3448,6 +3466,9 @@ bool layout_view::has_screen(screen_device &screen) const
 
 void layout_view::recompute(u32 visibility_mask, bool zoom_to_screen)
 {
+	// anything built from the old item bounds is now stale
+	m_recompute_count++;
+
 	// reset the bounds and collected active items
 	render_bounds scrbounds{ 0.0f, 0.0f, 0.0f, 0.0f };
 	m_bounds = scrbounds;
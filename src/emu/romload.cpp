@@ -635,15 +635,11 @@ void rom_load_manager::region_post_process(memory_region *region, bool invert)
     up the parent and loading by checksum
 -------------------------------------------------*/
 
-std::unique_ptr<emu_file> rom_load_manager::open_rom_file(std::initializer_list<std::reference_wrapper<const std::vector<std::string> > > searchpath, const rom_entry *romp, std::vector<std::string> &tried_file_names, bool from_list)
+std::unique_ptr<emu_file> rom_load_manager::open_rom_file(std::initializer_list<std::reference_wrapper<const std::vector<std::string> > > searchpath, const rom_entry *romp, std::vector<std::string> &tried_file_names)
 {
 	osd_file::error filerr = osd_file::error::NOT_FOUND;
-	u32 const romsize = rom_file_size(romp);
 	tried_file_names.clear();
 
-	// update status display
-	display_loading_rom_message(ROM_GETNAME(romp), from_list);
-
 	// extract CRC to use for searching
 	u32 crc = 0;
 	bool const has_crc = util::hash_collection(ROM_GETHASHDATA(romp)).crc(crc);
@@ -658,10 +654,6 @@ std::unique_ptr<emu_file> rom_load_manager::open_rom_file(std::initializer_list<
 			break;
 	}
 
-	// update counters
-	m_romsloaded++;
-	m_romsloadedsize += romsize;
-
 	// return the result
 	if (osd_file::error::NONE != filerr)
 		return nullptr;
@@ -678,6 +670,8 @@ std::unique_ptr<emu_file> rom_load_manager::open_rom_file(const std::vector<std:
 	// attempt to open the file
 	std::unique_ptr<emu_file> result(new emu_file(machine().options().media_path(), paths, OPEN_FLAG_READ));
 	result->set_restrict_to_mediapath(1);
+	if (m_hash_cache->enabled())
+		result->set_hash_cache(m_hash_cache.get());
 	if (has_crc)
 		filerr = result->open(name, crc);
 	else
@@ -691,6 +685,60 @@ std::unique_ptr<emu_file> rom_load_manager::open_rom_file(const std::vector<std:
 }
 
 
+/*-------------------------------------------------
+    prefetch_rom_file - work item to open a ROM
+    file and hash its contents
+-------------------------------------------------*/
+
+void *rom_load_manager::prefetch_rom_file(void *param, int threadid)
+{
+	rom_prefetch &prefetch = *reinterpret_cast<rom_prefetch *>(param);
+	prefetch.m_file = prefetch.m_manager.open_rom_file(prefetch.m_searchpath, prefetch.m_romp, prefetch.m_tried_file_names);
+
+	// hashing pulls the whole file into memory, so assembly only copies it out
+	util::hash_collection const hashes(ROM_GETHASHDATA(prefetch.m_romp));
+	if (prefetch.m_file && !hashes.flag(util::hash_collection::FLAG_NO_DUMP))
+		prefetch.m_file->hashes(hashes.hash_types().c_str());
+	return nullptr;
+}
+
+
+/*-------------------------------------------------
+    queue_rom_prefetch - start opening a ROM file
+    on the work queue
+-------------------------------------------------*/
+
+void rom_load_manager::queue_rom_prefetch(rom_prefetch &prefetch)
+{
+	if (!m_work_queue)
+		m_work_queue.reset(osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI));
+	if (m_work_queue)
+		prefetch.m_item = osd_work_item_queue(m_work_queue.get(), prefetch_rom_file, &prefetch, 0);
+
+	// if it couldn't be queued, do it here
+	if (prefetch.m_item == nullptr)
+		prefetch_rom_file(&prefetch, 0);
+}
+
+
+/*-------------------------------------------------
+    rom_prefetch::wait - wait until the file has
+    been opened and hashed
+-------------------------------------------------*/
+
+void rom_load_manager::rom_prefetch::wait()
+{
+	if (m_item != nullptr)
+	{
+		while (!osd_work_item_wait(m_item, osd_ticks_per_second()))
+		{
+		}
+		osd_work_item_release(m_item);
+		m_item = nullptr;
+	}
+}
+
+
 /*-------------------------------------------------
     rom_fread - cheesy fread that fills with
     random data for a nullptr file
@@ -899,6 +947,18 @@ void rom_load_manager::process_rom_entries(std::initializer_list<std::reference_
 	u32 lastflags = 0;
 	std::vector<std::string> tried_file_names;
 
+	// open and hash the files of this region on the work queue, a few
+	// ahead of the one being assembled; only assembly happens here
+	std::vector<std::unique_ptr<rom_prefetch> > prefetch;
+	for (const rom_entry *scan = romp; !ROMENTRY_ISREGIONEND(scan); scan++)
+	{
+		if (ROMENTRY_ISFILE(scan) && (!ROM_GETBIOSFLAGS(scan) || (ROM_GETBIOSFLAGS(scan) == bios)))
+			prefetch.emplace_back(std::make_unique<rom_prefetch>(*this, searchpath, scan));
+	}
+	for (size_t index = 0; (index < prefetch.size()) && (index < PREFETCH_FILES); index++)
+		queue_rom_prefetch(*prefetch[index]);
+	size_t nextfile = 0;
+
 	// loop until we hit the end of this region
 	while (!ROMENTRY_ISREGIONEND(romp))
 	{
@@ -936,7 +996,20 @@ void rom_load_manager::process_rom_entries(std::initializer_list<std::reference_
 			std::unique_ptr<emu_file> file;
 			if (!irrelevantbios)
 			{
-				file = open_rom_file(searchpath, romp, tried_file_names, from_list);
+				display_loading_rom_message(ROM_GETNAME(romp), from_list);
+
+				rom_prefetch &current = *prefetch[nextfile];
+				if (nextfile + PREFETCH_FILES < prefetch.size())
+					queue_rom_prefetch(*prefetch[nextfile + PREFETCH_FILES]);
+				current.wait();
+				file = std::move(current.m_file);
+				tried_file_names = std::move(current.m_tried_file_names);
+				prefetch[nextfile++].reset();
+
+				// update counters
+				m_romsloaded++;
+				m_romsloadedsize += rom_file_size(romp);
+
 				if (!file)
 					handle_missing_file(romp, tried_file_names, CHDERR_NONE);
 			}
@@ -1418,6 +1491,7 @@ void rom_load_manager::process_region_list()
 
 rom_load_manager::rom_load_manager(running_machine &machine)
 	: m_machine(machine)
+	, m_hash_cache(std::make_unique<hash_cache>(machine.options().hash_cache()))
 {
 	// figure out which BIOS we are using
 	std::map<std::string, std::string> card_bios;
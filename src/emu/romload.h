@@ -14,6 +14,7 @@
 #pragma once
 
 #include "chd.h"
+#include "hashcache.h"
 
 #include <functional>
 #include <initializer_list>
@@ -400,6 +401,28 @@ class rom_load_manager
 		chd_file            m_diffchd;              /* handle to the diff CHD */
 	};
 
+	// ROM file opened and hashed on the work queue ahead of region assembly
+	struct rom_prefetch
+	{
+		rom_prefetch(rom_load_manager &manager, std::initializer_list<std::reference_wrapper<const std::vector<std::string> > > const &searchpath, const rom_entry *romp)
+			: m_manager(manager), m_searchpath(searchpath), m_romp(romp), m_item(nullptr) { }
+		~rom_prefetch() { wait(); }
+
+		void wait();
+
+		rom_load_manager &          m_manager;              /* manager doing the load */
+		std::initializer_list<std::reference_wrapper<const std::vector<std::string> > > const &m_searchpath;
+		const rom_entry *           m_romp;                 /* ROM_LOAD entry */
+		std::vector<std::string>    m_tried_file_names;     /* set names searched */
+		std::unique_ptr<emu_file>   m_file;                 /* opened file or nullptr */
+		osd_work_item *             m_item;                 /* work item while queued */
+	};
+
+	struct work_queue_deleter { void operator()(osd_work_queue *queue) const { osd_work_queue_free(queue); } };
+
+	// number of ROM files opened ahead of the one being assembled
+	static constexpr size_t PREFETCH_FILES = 8;
+
 public:
 	// construction/destruction
 	rom_load_manager(running_machine &machine);
@@ -442,8 +465,10 @@ private:
 	void display_loading_rom_message(const char *name, bool from_list);
 	void display_rom_load_results(bool from_list);
 	void region_post_process(memory_region *region, bool invert);
-	std::unique_ptr<emu_file> open_rom_file(std::initializer_list<std::reference_wrapper<const std::vector<std::string> > > searchpath, const rom_entry *romp, std::vector<std::string> &tried_file_names, bool from_list);
+	std::unique_ptr<emu_file> open_rom_file(std::initializer_list<std::reference_wrapper<const std::vector<std::string> > > searchpath, const rom_entry *romp, std::vector<std::string> &tried_file_names);
 	std::unique_ptr<emu_file> open_rom_file(const std::vector<std::string> &paths, std::vector<std::string> &tried, bool has_crc, u32 crc, const std::string &name, osd_file::error &filerr);
+	static void *prefetch_rom_file(void *param, int threadid);
+	void queue_rom_prefetch(rom_prefetch &prefetch);
 	int rom_fread(emu_file *file, u8 *buffer, int length, const rom_entry *parent_region);
 	int read_rom_data(emu_file *file, const rom_entry *parent_region, const rom_entry *romp);
 	void fill_rom_data(const rom_entry *romp);
@@ -468,6 +493,9 @@ private:
 
 	std::vector<std::unique_ptr<open_chd>> m_chd_list;     /* disks */
 
+	std::unique_ptr<osd_work_queue, work_queue_deleter> m_work_queue; // queue for opening and hashing ROM files
+	std::unique_ptr<hash_cache> m_hash_cache; // persistent hashes of unchanged ROM files
+
 	memory_region *     m_region;             // info about current region
 
 	std::string         m_errorstring;        // error string
@@ -26,6 +26,8 @@
 #include "emuopts.h"
 #include "coreutil.h"
 
+#include <zlib.h>
+
 
 //**************************************************************************
 //  DEBUGGING
@@ -42,8 +44,22 @@
 //**************************************************************************
 
 const int SAVE_VERSION      = 2;
+const int SAVE_VERSION_CHUNKED = 3;
 const int HEADER_SIZE       = 32;
 
+// chunked save files close a chunk at the first device boundary past the
+// minimum size, and split anything larger than the maximum
+const size_t CHUNK_MIN_SIZE = 16 * 1024;
+const size_t CHUNK_MAX_SIZE = 1024 * 1024;
+const int CHUNK_INDEX_WORDS = 5;
+
+// chunk storage methods
+enum
+{
+	CHUNK_STORED = 0,
+	CHUNK_DEFLATE = 1
+};
+
 // Available flags
 enum
 {
@@ -63,12 +79,24 @@ enum
 save_manager::save_manager(running_machine &machine)
 	: m_machine(machine)
 	, m_reg_allowed(true)
+	, m_work_queue(nullptr)
 	, m_illegal_regs(0)
 {
 	m_rewind = std::make_unique<rewinder>(*this);
 }
 
 
+//-------------------------------------------------
+//  ~save_manager - destructor
+//-------------------------------------------------
+
+save_manager::~save_manager()
+{
+	if (m_work_queue != nullptr)
+		osd_work_queue_free(m_work_queue);
+}
+
+
 //-------------------------------------------------
 //  allow_registration - allow/disallow
 //  registrations to happen
@@ -82,7 +110,7 @@ void save_manager::allow_registration(bool allowed)
 	{
 		// look for duplicates
 		std::sort(m_entry_list.begin(), m_entry_list.end(),
-				[] (std::unique_ptr<state_entry> const& a, std::unique_ptr<state_entry> const& b) { return a->m_name < b->m_name; });
+				[] (state_entry const *a, state_entry const *b) { return a->m_name < b->m_name; });
 
 		int dupes_found = 0;
 		for (int i = 1; i < m_entry_list.size(); i++)
@@ -115,7 +143,7 @@ const char *save_manager::indexed_item(int index, void *&base, u32 &valsize, u32
 	if (index >= m_entry_list.size() || index < 0)
 		return nullptr;
 
-	state_entry *entry = m_entry_list.at(index).get();
+	state_entry *entry = m_entry_list.at(index);
 	base = entry->m_data;
 	valsize = entry->m_typesize;
 	valcount = entry->m_typecount;
@@ -147,6 +175,29 @@ void save_manager::register_presave(save_prepost_delegate func)
 }
 
 
+//-------------------------------------------------
+//  register_preload - register a function to be
+//  called before saved state overwrites memory,
+//  for anything still working on it from another
+//  thread
+//-------------------------------------------------
+
+void save_manager::register_preload(save_prepost_delegate func)
+{
+	// check for invalid timing
+	if (!m_reg_allowed)
+		fatalerror("Attempt to register callback function after state registration is closed!\n");
+
+	// scan for duplicates and push through to the end
+	for (auto &cb : m_preload_list)
+		if (cb->m_func == func)
+			fatalerror("Duplicate save state function (%s/%s)\n", cb->m_func.name(), func.name());
+
+	// allocate a new entry
+	m_preload_list.push_back(std::make_unique<state_callback>(func));
+}
+
+
 //-------------------------------------------------
 //  state_save_register_postload -
 //  register a post-load function callback
@@ -196,7 +247,7 @@ void save_manager::save_memory(device_t *device, const char *module, const char
 		totalname = string_format("%s/%X/%s", module, index, name);
 
 	// insert us into the list
-	m_entry_list.emplace_back(std::make_unique<state_entry>(val, totalname.c_str(), device, module, tag ? tag : "", index, valsize, valcount, blockcount, stride));
+	m_entry_list.emplace_back(&machine().arena().make<state_entry>(machine_arena::category::SAVE, val, totalname.c_str(), device, module, tag ? tag : "", index, valsize, valcount, blockcount, stride));
 }
 
 
@@ -239,6 +290,18 @@ void save_manager::dispatch_postload()
 }
 
 
+//-------------------------------------------------
+//  dispatch_preload - invoke all registered
+//  preload callbacks
+//-------------------------------------------------
+
+void save_manager::dispatch_preload()
+{
+	for (auto &func : m_preload_list)
+		func->m_func();
+}
+
+
 //-------------------------------------------------
 //  dispatch_presave - invoke all registered
 //  presave callbacks for updates
@@ -251,26 +314,77 @@ void save_manager::dispatch_presave()
 }
 
 
+//-------------------------------------------------
+//  save_manager::file_chunk - one piece of a
+//  chunked save file
+//-------------------------------------------------
+
+struct save_manager::file_chunk
+{
+	u8 *            raw;                    // uncompressed data within the whole state
+	u32             raw_size;               // size of the uncompressed data
+	u32             method;                 // CHUNK_STORED or CHUNK_DEFLATE
+	std::vector<u8> packed;                 // compressed data, empty if stored
+	bool            ok;                     // compression or expansion succeeded
+};
+
+
 //-------------------------------------------------
 //  write_file - writes the data to a file
 //-------------------------------------------------
 
 save_error save_manager::write_file(emu_file &file)
 {
-	return do_write(
-			[] (size_t total_size) { return true; },
-			[&file] (const void *data, size_t size) { return file.write(data, size) == size; },
-			[&file] ()
-			{
-				file.compress(FCOMPRESS_NONE);
-				file.seek(0, SEEK_SET);
-				return true;
-			},
-			[&file] ()
-			{
-				file.compress(FCOMPRESS_MEDIUM);
-				return true;
-			});
+	// serialise everything in one pass
+	std::vector<u8> raw(ram_state::get_size(*this));
+	save_error const error = write_buffer(&raw[0], raw.size());
+	if (error != STATERR_NONE)
+		return error;
+	raw[8] = SAVE_VERSION_CHUNKED;
+
+	// compress the chunks independently across the work queue
+	std::vector<std::pair<size_t, size_t> > layout;
+	chunk_layout(layout);
+	std::vector<file_chunk> chunks(layout.size());
+	for (size_t index = 0; index < layout.size(); index++)
+	{
+		chunks[index].raw = &raw[layout[index].first];
+		chunks[index].raw_size = u32(layout[index].second - layout[index].first);
+	}
+	if (!chunks.empty())
+		run_chunks(&save_manager::compress_chunk, chunks);
+
+	// the header is followed by the chunk count and an index giving the method,
+	// sizes and file offset of each chunk, so chunks can be found without
+	// reading those before them
+	std::vector<u32> index;
+	index.reserve(1 + (chunks.size() * CHUNK_INDEX_WORDS));
+	index.push_back(little_endianize_int32(u32(chunks.size())));
+	u64 offset = HEADER_SIZE + ((1 + (chunks.size() * CHUNK_INDEX_WORDS)) * sizeof(u32));
+	for (file_chunk const &chunk : chunks)
+	{
+		u32 const stored = (chunk.method == CHUNK_STORED) ? chunk.raw_size : u32(chunk.packed.size());
+		index.push_back(little_endianize_int32(chunk.method));
+		index.push_back(little_endianize_int32(chunk.raw_size));
+		index.push_back(little_endianize_int32(stored));
+		index.push_back(little_endianize_int32(u32(offset)));
+		index.push_back(little_endianize_int32(u32(offset >> 32)));
+		offset += stored;
+	}
+
+	file.compress(FCOMPRESS_NONE);
+	file.seek(0, SEEK_SET);
+	if (file.write(&raw[0], HEADER_SIZE) != HEADER_SIZE || file.write(&index[0], index.size() * sizeof(u32)) != (index.size() * sizeof(u32)))
+		return STATERR_WRITE_ERROR;
+	for (file_chunk const &chunk : chunks)
+	{
+		bool const written = (chunk.method == CHUNK_STORED)
+				? (file.write(chunk.raw, chunk.raw_size) == chunk.raw_size)
+				: (file.write(&chunk.packed[0], chunk.packed.size()) == chunk.packed.size());
+		if (!written)
+			return STATERR_WRITE_ERROR;
+	}
+	return STATERR_NONE;
 }
 
 
@@ -280,6 +394,14 @@ save_error save_manager::write_file(emu_file &file)
 
 save_error save_manager::read_file(emu_file &file)
 {
+	// chunked files are expanded separately
+	u8 header[HEADER_SIZE];
+	file.compress(FCOMPRESS_NONE);
+	file.seek(0, SEEK_SET);
+	if (file.read(header, sizeof(header)) == sizeof(header) && header[8] == SAVE_VERSION_CHUNKED)
+		return read_chunked(file, header);
+
+	// otherwise it's a single compressed stream
 	return do_read(
 			[] (size_t total_size) { return true; },
 			[&file] (void *data, size_t size) { return file.read(data, size) == size; },
@@ -297,6 +419,190 @@ save_error save_manager::read_file(emu_file &file)
 }
 
 
+//-------------------------------------------------
+//  read_chunked - read a chunked save file,
+//  expanding the chunks in parallel
+//-------------------------------------------------
+
+save_error save_manager::read_chunked(emu_file &file, const u8 *header)
+{
+	// if we have illegal registrations, return an error
+	if (m_illegal_regs > 0)
+		return STATERR_ILLEGAL_REGISTRATIONS;
+
+	// the chunks expand into one buffer laid out like write_buffer output
+	std::vector<u8> raw(ram_state::get_size(*this));
+	memcpy(&raw[0], header, HEADER_SIZE);
+
+	// read the index
+	u32 count;
+	if (file.read(&count, sizeof(count)) != sizeof(count))
+		return STATERR_READ_ERROR;
+	count = little_endianize_int32(count);
+	if (count > raw.size())
+		return STATERR_INVALID_HEADER;
+	std::vector<u32> index(count * CHUNK_INDEX_WORDS);
+	if (count != 0 && file.read(&index[0], index.size() * sizeof(u32)) != (index.size() * sizeof(u32)))
+		return STATERR_READ_ERROR;
+
+	// stored chunks are read straight into place; compressed ones are gathered
+	std::vector<file_chunk> chunks(count);
+	size_t position = HEADER_SIZE;
+	for (u32 chunknum = 0; chunknum < count; chunknum++)
+	{
+		u32 const *const entry = &index[chunknum * CHUNK_INDEX_WORDS];
+		file_chunk &chunk = chunks[chunknum];
+		chunk.method = little_endianize_int32(entry[0]);
+		chunk.raw_size = little_endianize_int32(entry[1]);
+		u32 const stored = little_endianize_int32(entry[2]);
+		u64 const offset = u64(little_endianize_int32(entry[3])) | (u64(little_endianize_int32(entry[4])) << 32);
+		if ((raw.size() - position) < chunk.raw_size || (chunk.method != CHUNK_STORED && chunk.method != CHUNK_DEFLATE))
+			return STATERR_INVALID_HEADER;
+		chunk.raw = &raw[position];
+		position += chunk.raw_size;
+
+		if (file.seek(offset, SEEK_SET) != 0)
+			return STATERR_READ_ERROR;
+		if (chunk.method == CHUNK_STORED)
+		{
+			if (stored != chunk.raw_size || file.read(chunk.raw, chunk.raw_size) != chunk.raw_size)
+				return STATERR_READ_ERROR;
+		}
+		else
+		{
+			chunk.packed.resize(stored);
+			if (stored == 0 || file.read(&chunk.packed[0], stored) != stored)
+				return STATERR_READ_ERROR;
+		}
+	}
+
+	// a file for a different set of registrations can't cover the state exactly
+	if (position != raw.size())
+		return STATERR_INVALID_HEADER;
+
+	if (!chunks.empty())
+		run_chunks(&save_manager::expand_chunk, chunks);
+	for (file_chunk const &chunk : chunks)
+		if (!chunk.ok)
+			return STATERR_READ_ERROR;
+
+	return read_buffer(&raw[0], raw.size());
+}
+
+
+//-------------------------------------------------
+//  chunk_layout - split the serialised state into
+//  chunks along device boundaries
+//-------------------------------------------------
+
+void save_manager::chunk_layout(std::vector<std::pair<size_t, size_t> > &chunks) const
+{
+	chunks.clear();
+
+	// offsets are within write_buffer output, after the header
+	size_t start = HEADER_SIZE;
+	size_t offset = HEADER_SIZE;
+	const state_entry *prev = nullptr;
+	auto const close = [&chunks] (size_t begin, size_t end)
+	{
+		for ( ; begin < end; begin += CHUNK_MAX_SIZE)
+			chunks.emplace_back(begin, std::min(end, begin + CHUNK_MAX_SIZE));
+	};
+	for (auto const &entry : m_entry_list)
+	{
+		// entries are sorted by module and tag, so each device's entries are adjacent
+		bool const boundary = prev != nullptr && (entry->m_device != prev->m_device || entry->m_module != prev->m_module);
+		if (boundary && (offset - start) >= CHUNK_MIN_SIZE)
+		{
+			close(start, offset);
+			start = offset;
+		}
+		offset += entry->m_typesize * entry->m_typecount * entry->m_blockcount;
+		prev = entry;
+	}
+	close(start, offset);
+}
+
+
+//-------------------------------------------------
+//  run_chunks - process all chunks, spreading
+//  them across the work queue
+//-------------------------------------------------
+
+void save_manager::run_chunks(osd_work_callback callback, std::vector<file_chunk> &chunks)
+{
+	bool queued = false;
+	if (chunks.size() > 1)
+	{
+		if (m_work_queue == nullptr)
+			m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+		if (m_work_queue != nullptr)
+			queued = osd_work_item_queue_multiple(m_work_queue, callback, chunks.size() - 1, &chunks[1], sizeof(file_chunk), WORK_ITEM_FLAG_AUTO_RELEASE) != nullptr;
+	}
+
+	// do the first one here, and the rest too if they couldn't be queued
+	callback(&chunks[0], 0);
+	if (queued)
+	{
+		while (!osd_work_queue_wait(m_work_queue, osd_ticks_per_second()))
+		{
+		}
+	}
+	else
+	{
+		for (size_t index = 1; index < chunks.size(); index++)
+			callback(&chunks[index], 0);
+	}
+}
+
+
+//-------------------------------------------------
+//  compress_chunk - work item to compress one
+//  chunk, favouring speed over size
+//-------------------------------------------------
+
+void *save_manager::compress_chunk(void *param, int threadid)
+{
+	file_chunk &chunk = *reinterpret_cast<file_chunk *>(param);
+	uLongf size = compressBound(chunk.raw_size);
+	chunk.packed.resize(size);
+	if (compress2(&chunk.packed[0], &size, chunk.raw, chunk.raw_size, Z_BEST_SPEED) == Z_OK && size < chunk.raw_size)
+	{
+		chunk.method = CHUNK_DEFLATE;
+		chunk.packed.resize(size);
+	}
+	else
+	{
+		// incompressible data is stored as-is and can be read straight into place
+		chunk.method = CHUNK_STORED;
+		chunk.packed.clear();
+	}
+	chunk.ok = true;
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  expand_chunk - work item to expand one chunk
+//  into place
+//-------------------------------------------------
+
+void *save_manager::expand_chunk(void *param, int threadid)
+{
+	file_chunk &chunk = *reinterpret_cast<file_chunk *>(param);
+	if (chunk.method == CHUNK_STORED)
+	{
+		chunk.ok = true;
+	}
+	else
+	{
+		uLongf size = chunk.raw_size;
+		chunk.ok = uncompress(chunk.raw, &size, &chunk.packed[0], chunk.packed.size()) == Z_OK && size == chunk.raw_size;
+	}
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  write_stream - write the current machine state
 //  to an output stream
@@ -377,6 +683,45 @@ save_error save_manager::read_buffer(const void *buf, size_t size)
 }
 
 
+//-------------------------------------------------
+//  update_buffer - bring a buffer holding an
+//  earlier snapshot up to date with the current
+//  machine state, noting which pages changed
+//-------------------------------------------------
+
+save_error save_manager::update_buffer(void *buf, size_t size, std::vector<bool> &dirty)
+{
+	// there is no portable way to trap host writes to registered memory, and
+	// devices routinely write their RAM directly rather than through an address
+	// space, so changes are found by comparing against the previous snapshot;
+	// untouched pages are only read, never rewritten
+	dirty.assign((size + DIRTY_PAGE_SIZE - 1) / DIRTY_PAGE_SIZE, false);
+	return do_write(
+			[size] (size_t total_size) { return size == total_size; },
+			[base = reinterpret_cast<u8 *>(buf), offset = size_t(0), &dirty] (const void *data, size_t size) mutable
+			{
+				const u8 *src = reinterpret_cast<const u8 *>(data);
+				while (size > 0)
+				{
+					// work up to the end of the current page
+					const size_t page = offset / DIRTY_PAGE_SIZE;
+					const size_t chunk = std::min(size, (page + 1) * DIRTY_PAGE_SIZE - offset);
+					if (dirty[page] || memcmp(base + offset, src, chunk))
+					{
+						memcpy(base + offset, src, chunk);
+						dirty[page] = true;
+					}
+					offset += chunk;
+					src += chunk;
+					size -= chunk;
+				}
+				return true;
+			},
+			[] () { return true; },
+			[] () { return true; });
+}
+
+
 //-------------------------------------------------
 //  do_write - serialisation logic
 //-------------------------------------------------
@@ -455,6 +800,9 @@ inline save_error save_manager::do_read(T check_length, U read_block, V start_he
 	// determine whether or not to flip the data when done
 	const bool flip = NATIVE_ENDIAN_VALUE_LE_BE((header[9] & SS_MSB_FIRST) != 0, (header[9] & SS_MSB_FIRST) == 0);
 
+	// call the pre-load functions
+	dispatch_preload();
+
 	// read all the data, flipping if necessary
 	for (auto &entry : m_entry_list)
 	{
@@ -530,8 +878,8 @@ save_error save_manager::validate_header(const u8 *header, const char *gamename,
 		return STATERR_INVALID_HEADER;
 	}
 
-	// check save state version
-	if (header[8] != SAVE_VERSION)
+	// check save state version; chunked files are laid out differently but hold the same data
+	if (header[8] != SAVE_VERSION && header[8] != SAVE_VERSION_CHUNKED)
 	{
 		if (errormsg != nullptr)
 			(*errormsg)("%sWrong version in save file (version %d, expected %d)", error_prefix, header[8], SAVE_VERSION);
@@ -644,7 +992,7 @@ save_error ram_state::load()
 		return STATERR_ILLEGAL_REGISTRATIONS;
 
 	// get the save manager to load state
-	return m_save.write_stream(m_data);
+	return m_save.read_stream(m_data);
 }
 
 
@@ -657,9 +1005,9 @@ rewinder::rewinder(save_manager &save)
 	, m_enabled(save.machine().options().rewind())
 	, m_capacity(save.machine().options().rewind_capacity())
 	, m_current_index(REWIND_INDEX_NONE)
-	, m_first_invalid_index(REWIND_INDEX_NONE)
 	, m_first_time_warning(true)
 	, m_first_time_note(true)
+	, m_delta_bytes(0)
 {
 }
 
@@ -693,9 +1041,9 @@ void rewinder::clamp_capacity()
 
 
 //-------------------------------------------------
-//  invalidate - mark all the future states as
-//  invalid to prevent loading them, as the
-//  current input might have changed
+//  invalidate - discard all the future states to
+//  prevent loading them, as the current input
+//  might have changed
 //-------------------------------------------------
 
 void rewinder::invalidate()
@@ -703,15 +1051,11 @@ void rewinder::invalidate()
 	if (!m_enabled)
 		return;
 
-	// is there anything to invalidate?
-	if (!current_index_is_last())
+	// drop the deltas leading past the current state
+	while (m_current_index != REWIND_INDEX_NONE && !current_index_is_last())
 	{
-		// all states starting from the current one will be invalid
-		m_first_invalid_index = m_current_index;
-
-		// actually invalidate
-		for (auto it = m_state_list.begin() + m_first_invalid_index; it < m_state_list.end(); ++it)
-			it->get()->m_valid = false;
+		m_delta_bytes -= m_delta_list.back().size();
+		m_delta_list.pop_back();
 	}
 }
 
@@ -729,51 +1073,48 @@ bool rewinder::capture()
 		return false;
 	}
 
-	if (current_index_is_last())
+	// update the mirror of the current state in place, so only changed pages are touched
+	m_scratch.resize(ram_state::get_size(m_save));
+	const save_error error = m_save.update_buffer(&m_scratch[0], m_scratch.size(), m_dirty);
+	if (error != STATERR_NONE)
 	{
-		// we need to create a new state
-		std::unique_ptr<ram_state> state = std::make_unique<ram_state>(m_save);
-		const save_error error = state->save();
+		// keep the mirror in step with the current state
+		if (m_current_index != REWIND_INDEX_NONE)
+			m_scratch = m_current;
 
-		// validate the state
-		if (error == STATERR_NONE)
-			// it's safe to append
-			m_state_list.push_back(std::move(state));
-		else
-		{
-			// internal error, complain and evacuate
-			report_error(error, rewind_operation::SAVE);
-			return false;
-		}
+		// internal error, complain and evacuate
+		report_error(error, rewind_operation::SAVE);
+		return false;
 	}
-	else
-	{
-		// invalidate the future states
-		invalidate();
 
-		// update the existing state
-		ram_state *state = m_state_list.at(m_current_index).get();
-		const save_error error = state->save();
+	// the future after the current state is about to be rewritten
+	invalidate();
+
+	// link the new state to the current one, which then only lives on as a delta
+	if (m_current_index != REWIND_INDEX_NONE)
+	{
+		m_delta_list.emplace_back();
+		encode_delta(&m_current[0], &m_scratch[0], m_scratch.size(), m_dirty, m_delta_list.back());
+		m_delta_bytes += m_delta_list.back().size();
 
-		// validate the state
-		if (error != STATERR_NONE)
+		// carry the changed pages over to the current state
+		for (size_t page = 0; page < m_dirty.size(); page++)
 		{
-			// internal error, complain and evacuate
-			report_error(error, rewind_operation::SAVE);
-			return false;
+			if (m_dirty[page])
+			{
+				const size_t start = page * save_manager::DIRTY_PAGE_SIZE;
+				memcpy(&m_current[start], &m_scratch[start], std::min(save_manager::DIRTY_PAGE_SIZE, m_scratch.size() - start));
+			}
 		}
 	}
-
-	// make sure we will fit in
-	if (!check_size())
-		// the list keeps growing
-		m_current_index++;
-
-	// update first invalid index
-	if (current_index_is_last())
-		m_first_invalid_index = REWIND_INDEX_NONE;
 	else
-		m_first_invalid_index = m_current_index + 1;
+	{
+		m_current = m_scratch;
+	}
+	m_current_index = m_delta_list.size();
+
+	// make sure we fit in
+	check_size();
 
 	// success
 	report_error(STATERR_NONE, rewind_operation::SAVE);
@@ -795,90 +1136,189 @@ bool rewinder::step()
 	}
 
 	// do we have states to load?
-	if (m_current_index <= REWIND_INDEX_FIRST || m_first_invalid_index == REWIND_INDEX_FIRST)
+	if (m_current_index <= REWIND_INDEX_FIRST)
 	{
 		// no valid states, complain and evacuate
 		report_error(STATERR_NOT_FOUND, rewind_operation::LOAD);
 		return false;
 	}
 
-	// prepare to load the last valid index if we're too far ahead
-	if (m_first_invalid_index > REWIND_INDEX_NONE && m_current_index > m_first_invalid_index)
-		m_current_index = m_first_invalid_index;
+	// if we have illegal registrations, return an error
+	if (m_save.m_illegal_regs > 0)
+	{
+		report_error(STATERR_ILLEGAL_REGISTRATIONS, rewind_operation::LOAD);
+		return false;
+	}
 
-	// step back and obtain the state pointer
-	ram_state *state = m_state_list.at(--m_current_index).get();
+	// step back by undoing the delta that led to the current state
+	std::vector<u8> const &delta = m_delta_list[m_current_index - 1];
+	if (!apply_delta(&m_current[0], m_current.size(), delta) || !apply_delta(&m_scratch[0], m_scratch.size(), delta))
+	{
+		report_error(STATERR_READ_ERROR, rewind_operation::LOAD);
+		return false;
+	}
+	m_current_index--;
 
 	// try to load and report the result
-	const save_error error = state->load();
+	const save_error error = m_save.read_buffer(&m_current[0], m_current.size());
 	report_error(error, rewind_operation::LOAD);
 
-	if (error == save_error::STATERR_NONE)
-		return true;
-
-	return false;
+	return error == STATERR_NONE;
 }
 
 
 //-------------------------------------------------
-//  check_size - shrink the state list if it is
-//  about to hit the capacity. returns true if
-//  the list got shrank
+//  check_size - drop the oldest states while the
+//  history exceeds the capacity
 //-------------------------------------------------
 
-bool rewinder::check_size()
+void rewinder::check_size()
 {
 	if (!m_enabled)
-		return false;
-
-	// state sizes in bytes
-	const size_t singlesize = ram_state::get_size(m_save);
-	size_t totalsize = m_state_list.size() * singlesize;
+		return;
 
 	// convert our limit from megabytes
 	const size_t capsize = m_capacity * 1024 * 1024;
 
-	// safety check that shouldn't be allowed to trigger
-	if (totalsize > capsize)
+	// the current state is always kept whole; deltas fill the rest
+	bool dropped = false;
+	while (!m_delta_list.empty() && m_current_index > REWIND_INDEX_FIRST && (m_current.size() + m_delta_bytes) > capsize)
 	{
-		// states to remove
-		const u32 count = (totalsize - capsize) / singlesize;
+		m_delta_bytes -= m_delta_list.front().size();
+		m_delta_list.pop_front();
+		m_current_index--;
+		dropped = true;
+	}
 
-		// drop everything that's beyond capacity
-		m_state_list.erase(m_state_list.begin(), m_state_list.begin() + count);
+	if (dropped && m_first_time_note)
+	{
+		m_save.machine().logerror("Rewind note: Capacity has been reached. Old savestates will be erased.\n");
+		m_save.machine().logerror("Capacity: %d bytes. Savestate size: %d bytes. Savestate count: %d.\n",
+			capsize, m_current.size(), m_delta_list.size() + 1);
+		m_first_time_note = false;
 	}
+}
+
 
-	// update before new check
-	totalsize = m_state_list.size() * singlesize;
+namespace {
 
-	// check if capacity will be hit by the newly captured state
-	if (totalsize + singlesize >= capsize)
+// unchanged gaps shorter than this are folded into the surrounding run,
+// since a new run costs at least two bytes of header
+constexpr size_t DELTA_MIN_GAP = 4;
+
+void put_varint(std::vector<u8> &dest, size_t value)
+{
+	while (value >= 0x80)
 	{
-		// check if we have spare states ahead
-		if (!current_index_is_last())
-			// no need to move states around
-			return false;
+		dest.push_back(u8(value | 0x80));
+		value >>= 7;
+	}
+	dest.push_back(u8(value));
+}
 
-		// we can now get the first state and invalidate it
-		std::unique_ptr<ram_state> first(std::move(m_state_list.front()));
-		first->m_valid = false;
+bool get_varint(u8 const *&src, u8 const *end, size_t &value)
+{
+	value = 0;
+	for (int shift = 0; src < end && shift < 64; shift += 7)
+	{
+		u8 const byte = *src++;
+		value |= size_t(byte & 0x7f) << shift;
+		if (!(byte & 0x80))
+			return true;
+	}
+	return false;
+}
+
+} // anonymous namespace
 
-		// move it to the end for future use
-		m_state_list.push_back(std::move(first));
-		m_state_list.erase(m_state_list.begin());
 
-		if (m_first_time_note)
+//-------------------------------------------------
+//  encode_delta - record the bytes that differ
+//  between two states as runs of XORed data;
+//  the same delta turns either state into the
+//  other, and only pages flagged as dirty are
+//  examined
+//-------------------------------------------------
+
+void rewinder::encode_delta(u8 const *prev, u8 const *cur, size_t size, std::vector<bool> const &dirty, std::vector<u8> &delta)
+{
+	delta.clear();
+	size_t last = 0;
+	for (size_t page = 0; page < dirty.size(); page++)
+	{
+		if (!dirty[page])
+			continue;
+
+		// scan each stretch of consecutive dirty pages in one go
+		size_t pos = page * save_manager::DIRTY_PAGE_SIZE;
+		while ((page + 1) < dirty.size() && dirty[page + 1])
+			page++;
+		size_t const limit = std::min(size, (page + 1) * save_manager::DIRTY_PAGE_SIZE);
+
+		while (pos < limit)
 		{
-			m_save.machine().logerror("Rewind note: Capacity has been reached. Old savestates will be erased.\n");
-			m_save.machine().logerror("Capacity: %d bytes. Savestate size: %d bytes. Savestate count: %d.\n",
-				totalsize, singlesize, m_state_list.size());
-			m_first_time_note = false;
+			// skip over unchanged data, a word at a time where possible
+			while (pos + sizeof(u64) <= limit)
+			{
+				u64 a, b;
+				memcpy(&a, &prev[pos], sizeof(a));
+				memcpy(&b, &cur[pos], sizeof(b));
+				if (a != b)
+					break;
+				pos += sizeof(u64);
+			}
+			while (pos < limit && prev[pos] == cur[pos])
+				pos++;
+			if (pos >= limit)
+				break;
+
+			// extend the run over changed data and any short unchanged gaps
+			size_t const start = pos;
+			size_t end = pos;
+			while (pos < limit && (pos - end) < DELTA_MIN_GAP)
+			{
+				if (prev[pos] != cur[pos])
+					end = pos + 1;
+				pos++;
+			}
+			pos = end;
+
+			// emit the distance from the previous run, the length, and the XORed bytes
+			put_varint(delta, start - last);
+			put_varint(delta, end - start);
+			for (size_t index = start; index < end; index++)
+				delta.push_back(prev[index] ^ cur[index]);
+			last = end;
 		}
-
-		return true;
 	}
+	delta.shrink_to_fit();
+}
 
-	return false;
+
+//-------------------------------------------------
+//  apply_delta - XOR a delta into a state,
+//  returning false if it is malformed
+//-------------------------------------------------
+
+bool rewinder::apply_delta(u8 *state, size_t size, std::vector<u8> const &delta)
+{
+	u8 const *src = delta.data();
+	u8 const *const end = src + delta.size();
+	size_t pos = 0;
+	while (src < end)
+	{
+		size_t skip, length;
+		if (!get_varint(src, end, skip) || !get_varint(src, end, length))
+			return false;
+		pos += skip;
+		if (pos + length > size || length > size_t(end - src))
+			return false;
+		for (size_t index = 0; index < length; index++)
+			state[pos + index] ^= src[index];
+		src += length;
+		pos += length;
+	}
+	return true;
 }
 
 
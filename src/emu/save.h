@@ -19,6 +19,7 @@
 
 #include <array>
 #include <cassert>
+#include <deque>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -136,6 +137,7 @@ public:
 
 	// construction/destruction
 	save_manager(running_machine &machine);
+	~save_manager();
 
 	// getters
 	running_machine &machine() const { return m_machine; }
@@ -149,10 +151,12 @@ public:
 
 	// function registration
 	void register_presave(save_prepost_delegate func);
+	void register_preload(save_prepost_delegate func);
 	void register_postload(save_prepost_delegate func);
 
 	// callback dispatching
 	void dispatch_presave();
+	void dispatch_preload();
 	void dispatch_postload();
 
 	// generic memory registration
@@ -292,6 +296,11 @@ public:
 	save_error write_buffer(void *buf, size_t size);
 	save_error read_buffer(const void *buf, size_t size);
 
+	// incremental snapshots: buf holds an earlier snapshot, only the pages that
+	// differ from the machine state are rewritten and flagged in dirty
+	static constexpr size_t DIRTY_PAGE_SIZE = 4096;
+	save_error update_buffer(void *buf, size_t size, std::vector<bool> &dirty);
+
 private:
 	// state callback item
 	class state_callback
@@ -303,7 +312,15 @@ private:
 		save_prepost_delegate m_func;                 // delegate
 	};
 
+	// one independently compressed piece of a chunked save file
+	struct file_chunk;
+
 	// internal helpers
+	void chunk_layout(std::vector<std::pair<size_t, size_t> > &chunks) const;
+	void run_chunks(osd_work_callback callback, std::vector<file_chunk> &chunks);
+	save_error read_chunked(emu_file &file, const u8 *header);
+	static void *compress_chunk(void *param, int threadid);
+	static void *expand_chunk(void *param, int threadid);
 	template <typename T, typename U, typename V, typename W>
 	save_error do_write(T check_space, U write_block, V start_header, W start_data);
 	template <typename T, typename U, typename V, typename W>
@@ -316,11 +333,13 @@ private:
 	running_machine &         m_machine;              // reference to our machine
 	std::unique_ptr<rewinder> m_rewind;               // rewinder
 	bool                      m_reg_allowed;          // are registrations allowed?
+	osd_work_queue *          m_work_queue;           // queue for compressing chunks of save files
 	s32                       m_illegal_regs;         // number of illegal registrations
 
-	std::vector<std::unique_ptr<state_entry>>    m_entry_list;       // list of registered entries
+	std::vector<state_entry *>                   m_entry_list;       // list of registered entries, made in the machine arena
 	std::vector<std::unique_ptr<ram_state>>      m_ramstate_list;    // list of ram states
 	std::vector<std::unique_ptr<state_callback>> m_presave_list;     // list of pre-save functions
+	std::vector<std::unique_ptr<state_callback>> m_preload_list;     // list of pre-load functions
 	std::vector<std::unique_ptr<state_callback>> m_postload_list;    // list of post-load functions
 };
 
@@ -345,10 +364,17 @@ class rewinder
 	bool           m_enabled;                         // enable rewind savestates
 	size_t         m_capacity;                        // total memory rewind states can occupy (MB, limited to 1-2048 in options)
 	s32            m_current_index;                   // where we are in time
-	s32            m_first_invalid_index;             // all states before this one are guarateed to be valid
 	bool           m_first_time_warning;              // keep track of warnings we report
 	bool           m_first_time_note;                 // keep track of notes
-	std::vector<std::unique_ptr<ram_state>> m_state_list; // rewinder's own ram states
+
+	// only the state at the current index is kept whole; every older state is
+	// reached by applying the XOR deltas between neighbours in turn, so
+	// stepping back costs one delta and the oldest state can be dropped freely
+	std::vector<u8>              m_current;           // full contents of the current state
+	std::vector<u8>              m_scratch;           // mirror of the current state updated in place on capture
+	std::vector<bool>            m_dirty;             // pages changed by the last capture
+	std::deque<std::vector<u8>>  m_delta_list;        // delta between state n and n + 1, oldest first
+	size_t                       m_delta_bytes;       // total size of all deltas
 
 	// load/save management
 	enum class rewind_operation
@@ -363,13 +389,18 @@ class rewinder
 		REWIND_INDEX_FIRST
 	};
 
-	bool check_size();
-	bool current_index_is_last() { return m_current_index == m_state_list.size() - 1; }
+	void check_size();
+	bool current_index_is_last() { return m_current_index == s32(m_delta_list.size()); }
 	void report_error(save_error type, rewind_operation operation);
 
+	// delta encoding
+	static void encode_delta(u8 const *prev, u8 const *cur, size_t size, std::vector<bool> const &dirty, std::vector<u8> &delta);
+	static bool apply_delta(u8 *state, size_t size, std::vector<u8> const &delta);
+
 public:
 	rewinder(save_manager &save);
 	bool enabled() { return m_enabled; }
+	size_t allocated_bytes() const { return m_current.size() + m_scratch.size() + (m_dirty.size() / 8) + m_delta_bytes; }
 	void clamp_capacity();
 	void invalidate();
 	bool capture();
@@ -10,6 +10,7 @@
 
 #include "emu.h"
 #include "debugger.h"
+#include "emuopts.h"
 
 //**************************************************************************
 //  DEBUGGING
@@ -34,6 +35,12 @@ enum
 	TRIGGER_SUSPENDTIME = -4000
 };
 
+// adaptive interleave sampling: contention is sampled over this many
+// relaxed quanta, and the quantum is tightened when at least this many
+// shared memory ownership changes are seen during a sampling period
+constexpr u32 ADAPTIVE_SAMPLE_QUANTA = 4;
+constexpr u32 ADAPTIVE_EXCHANGE_THRESHOLD = 2;
+
 
 
 //**************************************************************************
@@ -48,6 +55,8 @@ emu_timer::emu_timer() :
 	m_machine(nullptr),
 	m_next(nullptr),
 	m_prev(nullptr),
+	m_heapindex(-1),
+	m_sequence(0),
 	m_param(0),
 	m_ptr(nullptr),
 	m_enabled(false),
@@ -81,6 +90,7 @@ inline emu_timer &emu_timer::init(running_machine &machine, timer_expired_delega
 	m_machine = &machine;
 	m_next = nullptr;
 	m_prev = nullptr;
+	m_heapindex = -1;
 	m_callback = callback;
 	m_param = 0;
 	m_ptr = ptr;
@@ -113,6 +123,7 @@ inline emu_timer &emu_timer::init(device_t &device, device_timer_id id, void *pt
 	m_machine = &device.machine();
 	m_next = nullptr;
 	m_prev = nullptr;
+	m_heapindex = -1;
 	m_callback = timer_expired_delegate(FUNC(emu_timer::device_timer_expired), this);
 	m_param = 0;
 	m_ptr = ptr;
@@ -153,6 +164,8 @@ inline emu_timer &emu_timer::release()
 
 bool emu_timer::enable(bool enable)
 {
+	device_scheduler::parallel_lock lock(machine().scheduler());
+
 	// reschedule only if the state has changed
 	const bool old = m_enabled;
 	if (old != enable)
@@ -160,9 +173,8 @@ bool emu_timer::enable(bool enable)
 		// set the enable flag
 		m_enabled = enable;
 
-		// remove the timer and insert back into the list
-		machine().scheduler().timer_list_remove(*this);
-		machine().scheduler().timer_list_insert(*this);
+		// requeue the timer
+		machine().scheduler().timer_heap_update(*this);
 	}
 	return old;
 }
@@ -178,6 +190,7 @@ void emu_timer::adjust(attotime start_delay, s32 param, const attotime &period)
 {
 	// if this is the callback timer, mark it modified
 	device_scheduler &scheduler = machine().scheduler();
+	device_scheduler::parallel_lock lock(scheduler);
 	if (scheduler.m_callback_timer == this)
 		scheduler.m_callback_timer_modified = true;
 
@@ -194,12 +207,11 @@ void emu_timer::adjust(attotime start_delay, s32 param, const attotime &period)
 	m_expire = m_start + start_delay;
 	m_period = period;
 
-	// remove and re-insert the timer in its new order
-	scheduler.timer_list_remove(*this);
-	scheduler.timer_list_insert(*this);
+	// requeue the timer in its new order
+	scheduler.timer_heap_update(*this);
 
-	// if this was inserted as the head, abort the current timeslice and resync
-	if (this == scheduler.first_timer())
+	// if this is now the next timer to fire, abort the current timeslice and resync
+	if (this == &scheduler.next_timer())
 		scheduler.abort_timeslice();
 }
 
@@ -282,10 +294,8 @@ inline void emu_timer::schedule_next_period()
 	m_start = m_expire;
 	m_expire += m_period;
 
-	// remove and re-insert us
-	device_scheduler &scheduler = machine().scheduler();
-	scheduler.timer_list_remove(*this);
-	scheduler.timer_list_insert(*this);
+	// requeue us
+	machine().scheduler().timer_heap_update(*this);
 }
 
 
@@ -323,6 +333,8 @@ void emu_timer::device_timer_expired(emu_timer &timer, void *ptr, s32 param)
 //  DEVICE SCHEDULER
 //**************************************************************************
 
+thread_local device_execute_interface *device_scheduler::s_executing_device = nullptr;
+
 //-------------------------------------------------
 //  device_scheduler - constructor
 //-------------------------------------------------
@@ -333,11 +345,21 @@ device_scheduler::device_scheduler(running_machine &machine) :
 	m_execute_list(nullptr),
 	m_basetime(attotime::zero),
 	m_timer_list(nullptr),
+	m_timer_sequence(0),
 	m_callback_timer(nullptr),
 	m_callback_timer_modified(false),
 	m_callback_timer_expire_time(attotime::zero),
 	m_suspend_changes_pending(true),
-	m_quantum_minimum(ATTOSECONDS_IN_NSEC(1) / 1000)
+	m_quantum_minimum(ATTOSECONDS_IN_NSEC(1) / 1000),
+	m_domain_queue(nullptr),
+	m_parallel_active(false),
+	m_adaptive_timer(nullptr),
+	m_adaptive_quantum(attotime::zero),
+	m_adaptive_period(attotime::zero),
+	m_adaptive_exchanges(0),
+	m_statistics_enabled(false),
+	m_stats_timeslices(0),
+	m_stats_boosts(0)
 {
 	// append a single never-expiring timer so there is always one in the list
 	m_timer_list = &m_timer_allocator.alloc()->init(machine, timer_expired_delegate(), nullptr, true);
@@ -359,6 +381,10 @@ device_scheduler::~device_scheduler()
 	// remove all timers
 	while (m_timer_list != nullptr)
 		m_timer_allocator.reclaim(m_timer_list->release());
+
+	// free the sync domain work queue
+	if (m_domain_queue != nullptr)
+		osd_work_queue_free(m_domain_queue);
 }
 
 
@@ -374,7 +400,8 @@ attotime device_scheduler::time() const noexcept
 
 	// if we're executing as a particular CPU, use its local time as a base
 	// otherwise, return the global base time
-	return (m_executing_device != nullptr) ? m_executing_device->local_time() : m_basetime;
+	device_execute_interface *const exec = currently_executing();
+	return (exec != nullptr) ? exec->local_time() : m_basetime;
 }
 
 
@@ -441,14 +468,14 @@ void device_scheduler::timeslice()
 		m_quantum_allocator.reclaim(m_quantum_list.detach_head());
 
 	// loop until we hit the next timer
-	while (m_basetime < m_timer_list->m_expire)
+	while (m_basetime < next_timer().m_expire)
 	{
 		// by default, assume our target is the end of the next quantum
 		attotime target(m_basetime + attotime(0, m_quantum_list.first()->m_actual));
 
 		// however, if the next timer is going to fire before then, override
-		if (m_timer_list->m_expire < target)
-			target = m_timer_list->m_expire;
+		if (next_timer().m_expire < target)
+			target = next_timer().m_expire;
 
 		LOG("------------------\n");
 		LOG("cpu_timeslice: target = %s\n", target.as_string(PRECISION));
@@ -457,91 +484,177 @@ void device_scheduler::timeslice()
 		if (m_suspend_changes_pending)
 			apply_suspend_changes();
 
-		// loop over all CPUs
-		for (device_execute_interface *exec = m_execute_list; exec != nullptr; exec = exec->m_nextexec)
+		if (m_statistics_enabled)
+			m_stats_timeslices++;
+
+		// execute all CPUs, concurrently if we have more than one sync domain
+		if (m_sync_domains.size() > 1 && !call_debugger)
+			execute_domains(target);
+		else
+			execute_devices<false>(m_execute_list, target, call_debugger);
+
+		// update the base time
+		m_basetime = target;
+	}
+
+	// execute timers
+	execute_timers();
+}
+
+
+//-------------------------------------------------
+//  execute_devices - execute a list of devices
+//  up to the given target, pulling the target in
+//  if any device stops short of it
+//-------------------------------------------------
+
+template <bool Parallel>
+inline void device_scheduler::execute_devices(device_execute_interface *list, attotime &target, bool call_debugger)
+{
+	// loop over all CPUs
+	for (device_execute_interface *exec = list; exec != nullptr; exec = Parallel ? exec->m_nextdomainexec : exec->m_nextexec)
+	{
+		// only process if this CPU is executing or truly halted (not yielding)
+		// and if our target is later than the CPU's current time (coarse check)
+		if (EXPECTED((exec->m_suspend == 0 || exec->m_eatcycles) && target.seconds() >= exec->m_localtime.seconds()))
 		{
-			// only process if this CPU is executing or truly halted (not yielding)
-			// and if our target is later than the CPU's current time (coarse check)
-			if (EXPECTED((exec->m_suspend == 0 || exec->m_eatcycles) && target.seconds() >= exec->m_localtime.seconds()))
+			// compute how many attoseconds to execute this CPU
+			attoseconds_t delta = target.attoseconds() - exec->m_localtime.attoseconds();
+			if (delta < 0 && target.seconds() > exec->m_localtime.seconds())
+				delta += ATTOSECONDS_PER_SECOND;
+			assert(delta == (target - exec->m_localtime).as_attoseconds());
+
+			if (exec->m_attoseconds_per_cycle == 0)
+			{
+				exec->m_localtime = target;
+			}
+			// if we have enough for at least 1 cycle, do the math
+			else if (delta >= exec->m_attoseconds_per_cycle)
 			{
-				// compute how many attoseconds to execute this CPU
-				attoseconds_t delta = target.attoseconds() - exec->m_localtime.attoseconds();
-				if (delta < 0 && target.seconds() > exec->m_localtime.seconds())
-					delta += ATTOSECONDS_PER_SECOND;
-				assert(delta == (target - exec->m_localtime).as_attoseconds());
+				// compute how many cycles we want to execute
+				int ran = exec->m_cycles_running = divu_64x32(u64(delta) >> exec->m_divshift, exec->m_divisor);
+				LOG("  cpu '%s': %d (%d cycles)\n", exec->device().tag(), delta, exec->m_cycles_running);
 
-				if (exec->m_attoseconds_per_cycle == 0)
+				// if we're not suspended, actually execute
+				if (exec->m_suspend == 0)
 				{
-					exec->m_localtime = target;
-				}
-				// if we have enough for at least 1 cycle, do the math
-				else if (delta >= exec->m_attoseconds_per_cycle)
-				{
-					// compute how many cycles we want to execute
-					int ran = exec->m_cycles_running = divu_64x32(u64(delta) >> exec->m_divshift, exec->m_divisor);
-					LOG("  cpu '%s': %d (%d cycles)\n", exec->device().tag(), delta, exec->m_cycles_running);
-
-					// if we're not suspended, actually execute
-					if (exec->m_suspend == 0)
-					{
+					// the profiler is not thread-safe, so only use it when running serially
+					if (!Parallel)
 						g_profiler.start(exec->m_profiler);
+					osd_ticks_t const start_ticks = m_statistics_enabled ? osd_ticks() : 0;
 
-						// note that this global variable cycles_stolen can be modified
-						// via the call to cpu_execute
-						exec->m_cycles_stolen = 0;
+					// note that this global variable cycles_stolen can be modified
+					// via the call to cpu_execute
+					exec->m_cycles_stolen = 0;
+					if (Parallel)
+						s_executing_device = exec;
+					else
 						m_executing_device = exec;
-						*exec->m_icountptr = exec->m_cycles_running;
-						if (!call_debugger)
-							exec->run();
-						else
-						{
-							exec->debugger_start_cpu_hook(target);
-							exec->run();
-							exec->debugger_stop_cpu_hook();
-						}
-
-						// adjust for any cycles we took back
-						assert(ran >= *exec->m_icountptr);
-						ran -= *exec->m_icountptr;
-						assert(ran >= exec->m_cycles_stolen);
-						ran -= exec->m_cycles_stolen;
-						g_profiler.stop();
-					}
-
-					// account for these cycles
-					exec->m_totalcycles += ran;
-
-					// update the local time for this CPU
-					attotime deltatime;
-					if (ran < exec->m_cycles_per_second)
-						deltatime = attotime(0, exec->m_attoseconds_per_cycle * ran);
+					*exec->m_icountptr = exec->m_cycles_running;
+					if (!call_debugger)
+						exec->run();
 					else
 					{
-						u32 remainder;
-						s32 secs = divu_64x32_rem(ran, exec->m_cycles_per_second, &remainder);
-						deltatime = attotime(secs, u64(remainder) * exec->m_attoseconds_per_cycle);
+						exec->debugger_start_cpu_hook(target);
+						exec->run();
+						exec->debugger_stop_cpu_hook();
 					}
-					assert(deltatime >= attotime::zero);
-					exec->m_localtime += deltatime;
-					LOG("         %d ran, %d total, time = %s\n", ran, s32(exec->m_totalcycles), exec->m_localtime.as_string(PRECISION));
 
-					// if the new local CPU time is less than our target, move the target up, but not before the base
-					if (exec->m_localtime < target)
+					// adjust for any cycles we took back
+					assert(ran >= *exec->m_icountptr);
+					ran -= *exec->m_icountptr;
+					assert(ran >= exec->m_cycles_stolen);
+					ran -= exec->m_cycles_stolen;
+					if (!Parallel)
+						g_profiler.stop();
+
+					// record statistics if requested
+					if (m_statistics_enabled)
 					{
-						target = std::max(exec->m_localtime, m_basetime);
-						LOG("         (new target)\n");
+						device_execute_interface::execute_stats &stats = exec->m_stats;
+						stats.timeslices++;
+						stats.cycles_requested += ran + *exec->m_icountptr + exec->m_cycles_stolen;
+						stats.cycles_executed += ran;
+						stats.cycles_stolen += exec->m_cycles_stolen;
+						if (exec->m_cycles_stolen != 0)
+							stats.aborts++;
+						stats.run_ticks += osd_ticks() - start_ticks;
 					}
 				}
+
+				// account for these cycles
+				exec->m_totalcycles += ran;
+
+				// update the local time for this CPU
+				attotime deltatime;
+				if (ran < exec->m_cycles_per_second)
+					deltatime = attotime(0, exec->m_attoseconds_per_cycle * ran);
+				else
+				{
+					u32 remainder;
+					s32 secs = divu_64x32_rem(ran, exec->m_cycles_per_second, &remainder);
+					deltatime = attotime(secs, u64(remainder) * exec->m_attoseconds_per_cycle);
+				}
+				assert(deltatime >= attotime::zero);
+				exec->m_localtime += deltatime;
+				LOG("         %d ran, %d total, time = %s\n", ran, s32(exec->m_totalcycles), exec->m_localtime.as_string(PRECISION));
+
+				// if the new local CPU time is less than our target, move the target up, but not before the base
+				if (exec->m_localtime < target)
+				{
+					target = std::max(exec->m_localtime, m_basetime);
+					LOG("         (new target)\n");
+				}
 			}
 		}
+	}
+
+	if (Parallel)
+		s_executing_device = nullptr;
+	else
 		m_executing_device = nullptr;
+}
 
-		// update the base time
-		m_basetime = target;
+
+//-------------------------------------------------
+//  execute_domains - execute all sync domains
+//  concurrently up to the given target; the
+//  first domain runs on the calling thread
+//-------------------------------------------------
+
+void device_scheduler::execute_domains(attotime &target)
+{
+	// every domain starts out aiming for the same target
+	for (sync_domain &domain : m_sync_domains)
+		domain.m_target = target;
+
+	// hand the secondary domains to the work queue and run the first one here
+	m_parallel_active = true;
+	osd_work_item_queue_multiple(m_domain_queue, execute_domain_callback, m_sync_domains.size() - 1, &m_sync_domains[1], sizeof(sync_domain), WORK_ITEM_FLAG_AUTO_RELEASE);
+	execute_devices<true>(m_sync_domains[0].m_execute_list, m_sync_domains[0].m_target, false);
+
+	// rendezvous with the other domains before touching shared state again
+	while (!osd_work_queue_wait(m_domain_queue, osd_ticks_per_second()))
+	{
 	}
+	m_parallel_active = false;
 
-	// execute timers
-	execute_timers();
+	// the timeslice ends where the earliest domain stopped
+	for (sync_domain &domain : m_sync_domains)
+		target = std::min(target, domain.m_target);
+}
+
+
+//-------------------------------------------------
+//  execute_domain_callback - work queue callback
+//  for executing a secondary sync domain
+//-------------------------------------------------
+
+void *device_scheduler::execute_domain_callback(void *param, int threadid)
+{
+	sync_domain &domain = *reinterpret_cast<sync_domain *>(param);
+	domain.m_scheduler->execute_devices<true>(domain.m_execute_list, domain.m_target, false);
+	return nullptr;
 }
 
 
@@ -552,8 +665,9 @@ void device_scheduler::timeslice()
 
 void device_scheduler::abort_timeslice()
 {
-	if (m_executing_device != nullptr)
-		m_executing_device->abort_timeslice();
+	device_execute_interface *const exec = currently_executing();
+	if (exec != nullptr)
+		exec->abort_timeslice();
 }
 
 
@@ -563,6 +677,8 @@ void device_scheduler::abort_timeslice()
 
 void device_scheduler::trigger(int trigid, const attotime &after)
 {
+	parallel_lock lock(*this);
+
 	// ensure we have a list of executing devices
 	if (m_execute_list == nullptr)
 		rebuild_execute_list();
@@ -588,6 +704,16 @@ void device_scheduler::boost_interleave(const attotime &timeslice_time, const at
 	// ignore timeslices > 1 second
 	if (timeslice_time.seconds() > 0)
 		return;
+	parallel_lock lock(*this);
+
+	// count boosts against the requesting device if there is one
+	if (m_statistics_enabled)
+	{
+		device_execute_interface *const exec = currently_executing();
+		if (exec != nullptr)
+			exec->m_stats.boosts++;
+		m_stats_boosts++;
+	}
 	add_scheduling_quantum(timeslice_time, boost_duration);
 }
 
@@ -599,6 +725,7 @@ void device_scheduler::boost_interleave(const attotime &timeslice_time, const at
 
 emu_timer *device_scheduler::timer_alloc(timer_expired_delegate callback, void *ptr)
 {
+	parallel_lock lock(*this);
 	return &m_timer_allocator.alloc()->init(machine(), callback, ptr, false);
 }
 
@@ -611,6 +738,7 @@ emu_timer *device_scheduler::timer_alloc(timer_expired_delegate callback, void *
 
 void device_scheduler::timer_set(const attotime &duration, timer_expired_delegate callback, int param, void *ptr)
 {
+	parallel_lock lock(*this);
 	m_timer_allocator.alloc()->init(machine(), callback, ptr, true).adjust(duration, param);
 }
 
@@ -622,6 +750,7 @@ void device_scheduler::timer_set(const attotime &duration, timer_expired_delegat
 
 emu_timer *device_scheduler::timer_alloc(device_t &device, device_timer_id id, void *ptr)
 {
+	parallel_lock lock(*this);
 	return &m_timer_allocator.alloc()->init(device, id, ptr, false);
 }
 
@@ -634,6 +763,7 @@ emu_timer *device_scheduler::timer_alloc(device_t &device, device_timer_id id, v
 
 void device_scheduler::timer_set(const attotime &duration, device_t &device, device_timer_id id, int param, void *ptr)
 {
+	parallel_lock lock(*this);
 	m_timer_allocator.alloc()->init(device, id, ptr, true).adjust(duration, param);
 }
 
@@ -681,25 +811,32 @@ void device_scheduler::presave()
 
 void device_scheduler::postload()
 {
-	// remove all timers and make a private list of permanent ones
-	simple_list<emu_timer> private_list;
-	while (m_timer_list != nullptr)
+	// temporary timers go away entirely (except our special never-expiring one)
+	emu_timer *next;
+	for (emu_timer *timer = m_timer_list; timer != nullptr; timer = next)
 	{
-		emu_timer &timer = *m_timer_list;
-
-		// temporary timers go away entirely (except our special never-expiring one)
-		if (timer.m_temporary && !timer.expire().is_never())
-			m_timer_allocator.reclaim(timer.release());
-
-		// permanent ones get added to our private list
-		else
-			private_list.append(timer_list_remove(timer));
+		next = timer->next();
+		if (timer->m_temporary && !timer->expire().is_never())
+			m_timer_allocator.reclaim(timer->release());
 	}
 
-	// now re-insert them; this effectively re-sorts them by time
-	emu_timer *timer;
-	while ((timer = private_list.detach_head()) != nullptr)
-		timer_list_insert(*timer);
+	// the enabled state and expiry times have changed underneath the heap, so
+	// rebuild it, keeping the previous order for timers that expire together
+	std::vector<emu_timer *> queued;
+	for (emu_timer *timer = m_timer_list; timer != nullptr; timer = timer->next())
+	{
+		if (timer->m_heapindex >= 0)
+			queued.push_back(timer);
+		timer->m_heapindex = -1;
+	}
+	std::sort(queued.begin(), queued.end(), [] (emu_timer const *a, emu_timer const *b) { return a->m_sequence < b->m_sequence; });
+	m_timer_heap.clear();
+	for (emu_timer *timer : queued)
+		if (timer->m_enabled)
+			timer_heap_insert(*timer);
+	for (emu_timer *timer = m_timer_list; timer != nullptr; timer = timer->next())
+		if (timer->m_enabled && timer->m_heapindex < 0)
+			timer_heap_insert(*timer);
 
 	m_suspend_changes_pending = true;
 	rebuild_execute_list();
@@ -770,8 +907,9 @@ void device_scheduler::rebuild_execute_list()
 		attotime min_quantum = machine().config().maximum_quantum(attotime::from_hz(60));
 
 		// if the configuration specifies a device to make perfect, pick that as the minimum
+		// (in adaptive mode, it is only applied while contention is observed)
 		device_execute_interface *const exec(machine().config().perfect_quantum_device());
-		if (exec)
+		if (exec && !machine().options().adaptive_quantum())
 			min_quantum = (std::min)(attotime(0, exec->minimum_quantum()), min_quantum);
 
 		// inform the timer system of our decision
@@ -805,59 +943,206 @@ void device_scheduler::rebuild_execute_list()
 
 	// append the suspend list to the end of the active list
 	*active_tailptr = suspend_list;
+
+	// split the list up by sync domain
+	rebuild_domain_lists();
 }
 
 
 //-------------------------------------------------
-//  timer_list_insert - insert a new timer into
-//  the list at the appropriate location
+//  rebuild_domain_lists - split the execute list
+//  into per-sync domain lists, preserving order
 //-------------------------------------------------
 
-inline emu_timer &device_scheduler::timer_list_insert(emu_timer &timer)
+void device_scheduler::rebuild_domain_lists()
 {
-	// disabled timers sort to the end
-	const attotime expire = timer.m_enabled ? timer.m_expire : attotime::never;
+	// gather the domains in use, lowest numbered first
+	std::vector<u32> domains;
+	for (device_execute_interface *exec = m_execute_list; exec != nullptr; exec = exec->m_nextexec)
+	{
+		auto const pos = std::lower_bound(domains.begin(), domains.end(), exec->sync_domain());
+		if (pos == domains.end() || *pos != exec->sync_domain())
+			domains.insert(pos, exec->sync_domain());
+	}
 
-	// loop over the timer list
-	emu_timer *prevtimer = nullptr;
-	for (emu_timer *curtimer = m_timer_list; curtimer != nullptr; prevtimer = curtimer, curtimer = curtimer->next())
+	// build a list for each one
+	m_sync_domains.clear();
+	m_sync_domains.resize(domains.size(), sync_domain{ this, nullptr, attotime::zero });
+	std::vector<device_execute_interface **> tailptrs;
+	for (sync_domain &domain : m_sync_domains)
+		tailptrs.push_back(&domain.m_execute_list);
+	for (device_execute_interface *exec = m_execute_list; exec != nullptr; exec = exec->m_nextexec)
+	{
+		auto const index = std::lower_bound(domains.begin(), domains.end(), exec->sync_domain()) - domains.begin();
+		exec->m_nextdomainexec = nullptr;
+		*tailptrs[index] = exec;
+		tailptrs[index] = &exec->m_nextdomainexec;
+	}
+
+	// allocate a work queue the first time we need to run in parallel
+	if (m_sync_domains.size() > 1 && m_domain_queue == nullptr)
+		m_domain_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+}
+
+
+//-------------------------------------------------
+//  start_adaptive_quantum - when adaptive
+//  interleave is enabled, find memory shared
+//  between executing devices and start watching
+//  it for contention
+//-------------------------------------------------
+
+void device_scheduler::start_adaptive_quantum()
+{
+	// only applies to configurations that ask for a perfect quantum
+	device_execute_interface *const perfect(machine().config().perfect_quantum_device());
+	if (!perfect || !machine().options().adaptive_quantum())
+		return;
+
+	// gather the places each shared memory block is mapped into executing devices' spaces
+	struct share_mapping
+	{
+		device_execute_interface *  exec;
+		address_space *             space;
+		offs_t                      start, end, mirror;
+	};
+	std::map<std::string, std::vector<share_mapping> > shares;
+	for (device_execute_interface &exec : execute_interface_iterator(machine().root_device()))
 	{
-		// if the current list entry expires after us, we should be inserted before it
-		if (curtimer->m_expire > expire)
+		device_memory_interface *memory;
+		if (!exec.device().interface(memory))
+			continue;
+		for (int spacenum = 0; spacenum < memory->max_space_count(); spacenum++)
 		{
-			// link the new guy in before the current list entry
-			timer.m_prev = prevtimer;
-			timer.m_next = curtimer;
+			if (!memory->has_space(spacenum) || !memory->space(spacenum).map())
+				continue;
+			address_space &space = memory->space(spacenum);
+			for (address_map_entry &entry : space.map()->m_entrylist)
+				if (entry.m_share != nullptr)
+					shares[entry.m_devbase.subtag(entry.m_share)].push_back(share_mapping{ &exec, &space, entry.m_addrstart, entry.m_addrend, entry.m_addrmirror });
+		}
+	}
 
-			if (prevtimer != nullptr)
-				prevtimer->m_next = &timer;
-			else
-				m_timer_list = &timer;
+	// watch the ones that more than one device can see
+	for (auto const &share : shares)
+	{
+		bool const contended = std::find_if(share.second.begin(), share.second.end(), [&share] (share_mapping const &mapping) { return mapping.exec != share.second.front().exec; }) != share.second.end();
+		if (!contended)
+			continue;
 
-			curtimer->m_prev = &timer;
-			return timer;
+		u32 const index = m_adaptive_owners.size();
+		m_adaptive_owners.push_back(nullptr);
+		for (share_mapping const &mapping : share.second)
+		{
+			switch (mapping.space->data_width())
+			{
+			case 8:     install_contention_taps<u8>(*mapping.space, mapping.start, mapping.end, mapping.mirror, index);  break;
+			case 16:    install_contention_taps<u16>(*mapping.space, mapping.start, mapping.end, mapping.mirror, index); break;
+			case 32:    install_contention_taps<u32>(*mapping.space, mapping.start, mapping.end, mapping.mirror, index); break;
+			case 64:    install_contention_taps<u64>(*mapping.space, mapping.start, mapping.end, mapping.mirror, index); break;
+			}
 		}
+		LOG("adaptive_quantum: watching shared memory '%s'\n", share.first);
 	}
 
-	// need to insert after the last one
-	if (prevtimer != nullptr)
-		prevtimer->m_next = &timer;
-	else
-		m_timer_list = &timer;
+	// if there's nothing to watch, fall back to a permanent perfect quantum
+	if (m_adaptive_owners.empty())
+	{
+		add_scheduling_quantum(attotime(0, perfect->minimum_quantum()), attotime::never);
+		return;
+	}
+
+	// sample contention over a few relaxed quanta
+	m_adaptive_quantum = attotime(0, perfect->minimum_quantum());
+	m_adaptive_period = machine().config().maximum_quantum(attotime::from_hz(60)) * ADAPTIVE_SAMPLE_QUANTA;
+	m_adaptive_timer = timer_alloc(timer_expired_delegate(FUNC(device_scheduler::adaptive_quantum_sample), this));
+	m_adaptive_timer->adjust(m_adaptive_period, 0, m_adaptive_period);
+}
 
-	timer.m_prev = prevtimer;
-	timer.m_next = nullptr;
+
+//-------------------------------------------------
+//  install_contention_taps - install taps that
+//  report accesses to a watched shared region
+//-------------------------------------------------
+
+template <typename T>
+void device_scheduler::install_contention_taps(address_space &space, offs_t start, offs_t end, offs_t mirror, u32 index)
+{
+	space.install_readwrite_tap(start, end, mirror, "adaptive_quantum",
+			[this, index] (offs_t offset, T &data, T mem_mask) { shared_memory_access(index); },
+			[this, index] (offs_t offset, T &data, T mem_mask) { shared_memory_access(index); });
+}
+
+
+//-------------------------------------------------
+//  shared_memory_access - note an access to a
+//  watched shared region, counting changes of
+//  the device touching it
+//-------------------------------------------------
+
+void device_scheduler::shared_memory_access(u32 index)
+{
+	device_execute_interface *const exec = currently_executing();
+	if (exec != nullptr && m_adaptive_owners[index] != exec)
+	{
+		if (m_adaptive_owners[index] != nullptr)
+			m_adaptive_exchanges++;
+		m_adaptive_owners[index] = exec;
+	}
+}
+
+
+//-------------------------------------------------
+//  adaptive_quantum_sample - tighten the quantum
+//  for a while if devices have been passing
+//  shared memory back and forth
+//-------------------------------------------------
+
+TIMER_CALLBACK_MEMBER(device_scheduler::adaptive_quantum_sample)
+{
+	// boost for two periods so sustained contention doesn't flap between samples
+	if (m_adaptive_exchanges >= ADAPTIVE_EXCHANGE_THRESHOLD)
+	{
+		LOG("adaptive_quantum: %d exchanges, tightening quantum\n", m_adaptive_exchanges);
+		boost_interleave(m_adaptive_quantum, m_adaptive_period * 2);
+	}
+	m_adaptive_exchanges = 0;
+}
+
+
+//-------------------------------------------------
+//  timer_list_insert - add a new timer to the
+//  list, and queue it if it is enabled
+//-------------------------------------------------
+
+inline emu_timer &device_scheduler::timer_list_insert(emu_timer &timer)
+{
+	// link it in at the head of the list
+	timer.m_prev = nullptr;
+	timer.m_next = m_timer_list;
+	if (m_timer_list != nullptr)
+		m_timer_list->m_prev = &timer;
+	m_timer_list = &timer;
+
+	// enabled timers also go into the heap
+	timer.m_heapindex = -1;
+	if (timer.m_enabled)
+		timer_heap_insert(timer);
 	return timer;
 }
 
 
 //-------------------------------------------------
 //  timer_list_remove - remove a timer from the
-//  linked list
+//  list and the heap
 //-------------------------------------------------
 
 inline emu_timer &device_scheduler::timer_list_remove(emu_timer &timer)
 {
+	// remove it from the heap
+	if (timer.m_heapindex >= 0)
+		timer_heap_remove(timer);
+
 	// remove it from the list
 	if (timer.m_prev != nullptr)
 		timer.m_prev->m_next = timer.m_next;
@@ -871,19 +1156,137 @@ inline emu_timer &device_scheduler::timer_list_remove(emu_timer &timer)
 }
 
 
+//-------------------------------------------------
+//  timer_heap_update - requeue a timer after its
+//  enabled state or expiry time has changed
+//-------------------------------------------------
+
+inline void device_scheduler::timer_heap_update(emu_timer &timer)
+{
+	if (timer.m_heapindex < 0)
+	{
+		// not queued yet; only enabled timers get queued
+		if (timer.m_enabled)
+			timer_heap_insert(timer);
+	}
+	else if (!timer.m_enabled)
+	{
+		// disabled timers are removed from the heap
+		timer_heap_remove(timer);
+	}
+	else
+	{
+		// requeued timers sort after any others expiring at the same time
+		timer.m_sequence = m_timer_sequence++;
+		timer_heap_sift_up(timer.m_heapindex);
+		timer_heap_sift_down(timer.m_heapindex);
+	}
+}
+
+
+//-------------------------------------------------
+//  timer_heap_insert - add a timer to the heap
+//-------------------------------------------------
+
+inline void device_scheduler::timer_heap_insert(emu_timer &timer)
+{
+	assert(timer.m_heapindex < 0);
+	timer.m_sequence = m_timer_sequence++;
+	timer.m_heapindex = m_timer_heap.size();
+	m_timer_heap.push_back(&timer);
+	timer_heap_sift_up(timer.m_heapindex);
+}
+
+
+//-------------------------------------------------
+//  timer_heap_remove - remove a timer from the
+//  heap
+//-------------------------------------------------
+
+inline void device_scheduler::timer_heap_remove(emu_timer &timer)
+{
+	assert(timer.m_heapindex >= 0);
+	u32 const index = timer.m_heapindex;
+	timer.m_heapindex = -1;
+
+	// move the last entry into the hole and restore the heap order
+	emu_timer *const last = m_timer_heap.back();
+	m_timer_heap.pop_back();
+	if (last != &timer)
+	{
+		m_timer_heap[index] = last;
+		last->m_heapindex = index;
+		timer_heap_sift_up(index);
+		timer_heap_sift_down(last->m_heapindex);
+	}
+}
+
+
+//-------------------------------------------------
+//  timer_heap_sift_up - move an entry towards the
+//  top of the heap until it is in order
+//-------------------------------------------------
+
+inline void device_scheduler::timer_heap_sift_up(u32 index)
+{
+	emu_timer *const timer = m_timer_heap[index];
+	while (index > 0)
+	{
+		u32 const parent = (index - 1) / 2;
+		if (!timer_heap_before(*timer, *m_timer_heap[parent]))
+			break;
+		m_timer_heap[index] = m_timer_heap[parent];
+		m_timer_heap[index]->m_heapindex = index;
+		index = parent;
+	}
+	m_timer_heap[index] = timer;
+	timer->m_heapindex = index;
+}
+
+
+//-------------------------------------------------
+//  timer_heap_sift_down - move an entry towards
+//  the bottom of the heap until it is in order
+//-------------------------------------------------
+
+inline void device_scheduler::timer_heap_sift_down(u32 index)
+{
+	emu_timer *const timer = m_timer_heap[index];
+	u32 const count = m_timer_heap.size();
+	while (true)
+	{
+		// find the earlier of the two children
+		u32 child = (index * 2) + 1;
+		if (child >= count)
+			break;
+		if ((child + 1) < count && timer_heap_before(*m_timer_heap[child + 1], *m_timer_heap[child]))
+			child++;
+
+		// stop if we're already earlier than it
+		if (!timer_heap_before(*m_timer_heap[child], *timer))
+			break;
+		m_timer_heap[index] = m_timer_heap[child];
+		m_timer_heap[index]->m_heapindex = index;
+		index = child;
+	}
+	m_timer_heap[index] = timer;
+	timer->m_heapindex = index;
+}
+
+
 //-------------------------------------------------
 //  execute_timers - execute timers that are due
 //-------------------------------------------------
 
 inline void device_scheduler::execute_timers()
 {
-	LOG("execute_timers: new=%s head->expire=%s\n", m_basetime.as_string(PRECISION), m_timer_list->m_expire.as_string(PRECISION));
+	LOG("execute_timers: new=%s head->expire=%s\n", m_basetime.as_string(PRECISION), next_timer().m_expire.as_string(PRECISION));
 
 	// now process any timers that are overdue
-	while (m_timer_list->m_expire <= m_basetime)
+	while (next_timer().m_expire <= m_basetime)
 	{
 		// if this is a one-shot timer, disable it now
-		emu_timer &timer = *m_timer_list;
+		emu_timer &timer = next_timer();
 		bool was_enabled = timer.m_enabled;
 		if (timer.m_period.is_zero() || timer.m_period.is_never())
 			timer.m_enabled = false;
@@ -985,3 +1388,73 @@ void device_scheduler::dump_timers() const
 		timer->dump();
 	machine().logerror("=============================================\n");
 }
+
+
+//-------------------------------------------------
+//  reset_statistics - clear all collected
+//  scheduler statistics
+//-------------------------------------------------
+
+void device_scheduler::reset_statistics()
+{
+	m_stats_timeslices = 0;
+	m_stats_boosts = 0;
+	for (device_execute_interface &exec : execute_interface_iterator(machine().root_device()))
+		memset(&exec.m_stats, 0, sizeof(exec.m_stats));
+}
+
+
+//-------------------------------------------------
+//  write_statistics - write per-device scheduler
+//  statistics as JSON or CSV
+//-------------------------------------------------
+
+void device_scheduler::write_statistics(emu_file &file, bool json) const
+{
+	double const ticks_per_second = double(osd_ticks_per_second());
+	if (json)
+	{
+		file.printf("{\n");
+		file.printf("\t\"time\": %s,\n", m_basetime.as_string(9));
+		file.printf("\t\"timeslices\": %u,\n", m_stats_timeslices);
+		file.printf("\t\"boosts\": %u,\n", m_stats_boosts);
+		file.printf("\t\"devices\": [");
+		char const *separator = "\n";
+		for (device_execute_interface &exec : execute_interface_iterator(machine().root_device()))
+		{
+			device_execute_interface::execute_stats const &stats = exec.stats();
+			file.printf("%s\t\t{ \"tag\": \"%s\", \"timeslices\": %u, \"cycles_requested\": %u, \"cycles_executed\": %u, \"cycles_stolen\": %u, \"aborts\": %u, \"boosts\": %u, \"run_seconds\": %.6f }",
+					separator, exec.device().tag(), stats.timeslices, stats.cycles_requested, stats.cycles_executed, stats.cycles_stolen, stats.aborts, stats.boosts, double(stats.run_ticks) / ticks_per_second);
+			separator = ",\n";
+		}
+		file.printf("\n\t]\n}\n");
+	}
+	else
+	{
+		file.printf("tag,timeslices,cycles_requested,cycles_executed,cycles_stolen,aborts,boosts,run_seconds\n");
+		for (device_execute_interface &exec : execute_interface_iterator(machine().root_device()))
+		{
+			device_execute_interface::execute_stats const &stats = exec.stats();
+			file.printf("%s,%u,%u,%u,%u,%u,%u,%.6f\n",
+					exec.device().tag(), stats.timeslices, stats.cycles_requested, stats.cycles_executed, stats.cycles_stolen, stats.aborts, stats.boosts, double(stats.run_ticks) / ticks_per_second);
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  write_statistics_file - write statistics to
+//  the file specified in the options at exit
+//-------------------------------------------------
+
+void device_scheduler::write_statistics_file()
+{
+	std::string const filename(machine().options().schedstats());
+	emu_file file(OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(filename) != osd_file::error::NONE)
+	{
+		osd_printf_error("Unable to open scheduler statistics file %s\n", filename);
+		return;
+	}
+	write_statistics(file, core_filename_ends_with(filename, ".json"));
+}
@@ -17,6 +17,8 @@
 #ifndef MAME_EMU_SCHEDULE_H
 #define MAME_EMU_SCHEDULE_H
 
+#include <mutex>
+
 
 //**************************************************************************
 //  MACROS
@@ -83,8 +85,10 @@ private:
 
 	// internal state
 	running_machine *   m_machine;      // reference to the owning machine
-	emu_timer *         m_next;         // next timer in order in the list
-	emu_timer *         m_prev;         // previous timer in order in the list
+	emu_timer *         m_next;         // next timer in the list
+	emu_timer *         m_prev;         // previous timer in the list
+	s32                 m_heapindex;    // index in the scheduler's timer heap, or -1 if not queued
+	u64                 m_sequence;     // insertion order, used to break ties between equal expiry times
 	timer_expired_delegate m_callback;  // callback function
 	s32                 m_param;        // integer parameter
 	void *              m_ptr;          // pointer parameter
@@ -114,8 +118,9 @@ public:
 	running_machine &machine() const noexcept { return m_machine; }
 	attotime time() const noexcept;
 	emu_timer *first_timer() const { return m_timer_list; }
-	device_execute_interface *currently_executing() const noexcept { return m_executing_device; }
+	device_execute_interface *currently_executing() const noexcept { return m_parallel_active ? s_executing_device : m_executing_device; }
 	bool can_save() const;
+	bool parallel_active() const noexcept { return m_parallel_active; }
 
 	// execution
 	void timeslice();
@@ -123,6 +128,7 @@ public:
 	void trigger(int trigid, const attotime &after = attotime::zero);
 	void boost_interleave(const attotime &timeslice_time, const attotime &boost_duration);
 	void suspend_resume_changed() { m_suspend_changes_pending = true; }
+	void start_adaptive_quantum();
 
 	// timers, specified by callback/name
 	emu_timer *timer_alloc(timer_expired_delegate callback, void *ptr = nullptr);
@@ -133,6 +139,15 @@ public:
 	emu_timer *timer_alloc(device_t &device, device_timer_id id = 0, void *ptr = nullptr);
 	void timer_set(const attotime &duration, device_t &device, device_timer_id id = 0, int param = 0, void *ptr = nullptr);
 
+	// statistics
+	bool statistics_enabled() const noexcept { return m_statistics_enabled; }
+	void enable_statistics(bool enable = true) { m_statistics_enabled = enable; }
+	void reset_statistics();
+	u64 statistics_timeslices() const { return m_stats_timeslices; }
+	u64 statistics_boosts() const { return m_stats_boosts; }
+	void write_statistics(emu_file &file, bool json) const;
+	void write_statistics_file();
+
 	// debugging
 	void dump_timers() const;
 
@@ -148,12 +163,28 @@ private:
 	// scheduling helpers
 	void compute_perfect_interleave();
 	void rebuild_execute_list();
+	void rebuild_domain_lists();
 	void apply_suspend_changes();
 	void add_scheduling_quantum(const attotime &quantum, const attotime &duration);
+	template <bool Parallel> void execute_devices(device_execute_interface *list, attotime &target, bool call_debugger);
+	void execute_domains(attotime &target);
+	static void *execute_domain_callback(void *param, int threadid);
+
+	// adaptive interleave helpers
+	template <typename T> void install_contention_taps(address_space &space, offs_t start, offs_t end, offs_t mirror, u32 index);
+	void shared_memory_access(u32 index);
+	TIMER_CALLBACK_MEMBER(adaptive_quantum_sample);
 
 	// timer helpers
 	emu_timer &timer_list_insert(emu_timer &timer);
 	emu_timer &timer_list_remove(emu_timer &timer);
+	void timer_heap_update(emu_timer &timer);
+	void timer_heap_insert(emu_timer &timer);
+	void timer_heap_remove(emu_timer &timer);
+	void timer_heap_sift_up(u32 index);
+	void timer_heap_sift_down(u32 index);
+	static bool timer_heap_before(const emu_timer &a, const emu_timer &b) { return (a.m_expire < b.m_expire) || ((a.m_expire == b.m_expire) && (a.m_sequence < b.m_sequence)); }
+	emu_timer &next_timer() const { return *m_timer_heap.front(); }
 	void execute_timers();
 
 	// internal state
@@ -163,7 +194,9 @@ private:
 	attotime                    m_basetime;                 // global basetime; everything moves forward from here
 
 	// list of active timers
-	emu_timer *                 m_timer_list;               // head of the active list
+	emu_timer *                 m_timer_list;               // head of the list of all allocated timers
+	std::vector<emu_timer *>    m_timer_heap;               // binary heap of enabled timers, earliest expiry first
+	u64                         m_timer_sequence;           // sequence number for the next timer inserted into the heap
 	fixed_allocator<emu_timer>  m_timer_allocator;          // allocator for timers
 
 	// other internal states
@@ -188,6 +221,43 @@ private:
 	simple_list<quantum_slot>   m_quantum_list;             // list of active quanta
 	fixed_allocator<quantum_slot> m_quantum_allocator;      // allocator for quanta
 	attoseconds_t               m_quantum_minimum;          // duration of minimum quantum
+
+	// sync domains for parallel execution
+	struct sync_domain
+	{
+		device_scheduler *          m_scheduler;            // owning scheduler
+		device_execute_interface *  m_execute_list;         // devices in this domain, in execution order
+		attotime                    m_target;               // requested target on entry, reached target on exit
+	};
+
+	// lock held around scheduler state changes while domains run in parallel
+	class parallel_lock
+	{
+	public:
+		parallel_lock(device_scheduler &scheduler) : m_mutex(scheduler.m_parallel_active ? &scheduler.m_parallel_mutex : nullptr) { if (m_mutex) m_mutex->lock(); }
+		~parallel_lock() { if (m_mutex) m_mutex->unlock(); }
+
+	private:
+		std::recursive_mutex *  m_mutex;
+	};
+
+	std::vector<sync_domain>    m_sync_domains;             // list of sync domains, lowest numbered first
+	osd_work_queue *            m_domain_queue;             // work queue for executing secondary domains
+	bool                        m_parallel_active;          // true while domains are executing in parallel
+	std::recursive_mutex        m_parallel_mutex;           // protects timers and quanta during parallel execution
+	static thread_local device_execute_interface *s_executing_device; // currently executing device on this thread
+
+	// adaptive interleave
+	std::vector<device_execute_interface *> m_adaptive_owners; // last device to touch each watched shared region
+	emu_timer *                 m_adaptive_timer;           // timer for sampling contention
+	attotime                    m_adaptive_quantum;         // quantum to apply while contention is observed
+	attotime                    m_adaptive_period;          // contention sampling period
+	u32                         m_adaptive_exchanges;       // shared region ownership changes seen this period
+
+	// statistics
+	bool                        m_statistics_enabled;       // collect per-device statistics?
+	u64                         m_stats_timeslices;         // number of timeslices executed
+	u64                         m_stats_boosts;             // number of boost_interleave() calls
 };
 
 
@@ -554,6 +554,8 @@ screen_device::screen_device(const machine_config &mconfig, const char *tag, dev
 	, m_yscale(1.0f)
 	, m_screen_update_ind16(*this)
 	, m_screen_update_rgb32(*this)
+	, m_deferred_capture(*this)
+	, m_deferred_restore(*this)
 	, m_screen_vblank(*this)
 	, m_scanline_cb(*this)
 	, m_palette(*this, finder_base::DUMMY_TAG)
@@ -691,6 +693,10 @@ void screen_device::device_validity_check(validity_checker &valid) const
 		// sanity check screen formats
 		if (m_screen_update_ind16.isnull() && m_screen_update_rgb32.isnull())
 			osd_printf_error("Missing SCREEN_UPDATE function\n");
+
+		// deferred bands are drawn into the frame bitmap, not per-scanline bitmaps
+		if (!m_deferred_capture.isnull() && (m_video_attributes & VIDEO_VARIABLE_WIDTH))
+			osd_printf_error("Deferred updates cannot be used with a variable width\n");
 	}
 	else
 	{
@@ -785,6 +791,8 @@ void screen_device::device_resolve_objects()
 	// bind our handlers
 	m_screen_update_ind16.resolve();
 	m_screen_update_rgb32.resolve();
+	m_deferred_capture.resolve();
+	m_deferred_restore.resolve();
 	m_screen_vblank.resolve_safe();
 	m_scanline_cb.resolve();
 
@@ -839,6 +847,8 @@ void screen_device::device_start()
 	m_texture[0]->set_id(u64(m_unique_id) << 57);
 	m_texture[1] = machine().render().texture_alloc();
 	m_texture[1]->set_id((u64(m_unique_id) << 57) | 1);
+	m_texture[0]->set_dirty_tracking(true);
+	m_texture[1]->set_dirty_tracking(true);
 
 	// configure the default cliparea
 	render_container::user_settings settings;
@@ -1136,6 +1146,9 @@ void screen_device::realloc_screen_bitmaps()
 	}
 	m_texture[0]->set_bitmap(m_bitmap[0], m_visarea, m_bitmap[0].texformat());
 	m_texture[1]->set_bitmap(m_bitmap[1], m_visarea, m_bitmap[1].texformat());
+	m_texture[0]->mark_dirty();
+	m_texture[1]->mark_dirty();
+	m_prev_dirty = m_visarea;
 
 	allocate_scan_bitmaps();
 }
@@ -1234,6 +1247,10 @@ bool screen_device::update_partial(int scanline)
 			m_partial_updates_this_frame++;
 		}
 	}
+	else if (defer_band(clip))
+	{
+		m_partial_updates_this_frame++;
+	}
 	else
 	{
 		if (m_type != SCREEN_TYPE_SVG)
@@ -1339,7 +1356,7 @@ void screen_device::update_now()
 						case BITMAP_FORMAT_RGB32:   flags = m_screen_update_rgb32(*this, *(bitmap_rgb32 *)m_scan_bitmaps[m_curbitmap][m_last_partial_scan], clip);   break;
 					}
 				}
-				else
+				else if (!defer_band(clip))
 				{
 					switch (curbitmap.format())
 					{
@@ -1392,7 +1409,7 @@ void screen_device::update_now()
 				case BITMAP_FORMAT_RGB32:   flags = m_screen_update_rgb32(*this, *(bitmap_rgb32 *)m_scan_bitmaps[m_curbitmap][current_vpos], clip);   break;
 			}
 		}
-		else
+		else if (!defer_band(clip))
 		{
 			switch (curbitmap.format())
 			{
@@ -1422,6 +1439,7 @@ void screen_device::update_now()
 
 void screen_device::reset_partial_updates()
 {
+	flush_deferred_updates();
 	m_last_partial_scan = 0;
 	m_partial_scan_hpos = -1;
 	m_partial_updates_this_frame = 0;
@@ -1429,6 +1447,64 @@ void screen_device::reset_partial_updates()
 }
 
 
+//-------------------------------------------------
+//  defer_band - queue a region for drawing at the
+//  end of the frame, along with the raster state
+//  the driver has now
+//-------------------------------------------------
+
+bool screen_device::defer_band(const rectangle &clip)
+{
+	if (m_deferred_capture.isnull())
+		return false;
+
+	m_deferred_capture(*this, int(m_deferred_bands.size()));
+	m_deferred_bands.push_back(clip);
+	return true;
+}
+
+
+//-------------------------------------------------
+//  flush_deferred_updates - draw every queued band
+//  in order, each with the raster state captured
+//  when it was queued
+//-------------------------------------------------
+
+void screen_device::flush_deferred_updates()
+{
+	if (m_deferred_bands.empty())
+		return;
+
+	// the slot after the last band holds the live state, put back once we're done
+	int const bands = m_deferred_bands.size();
+	m_deferred_capture(*this, bands);
+
+	g_profiler.start(PROFILER_VIDEO);
+
+	screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
+	for (int band = 0; band < bands; band++)
+	{
+		m_deferred_restore(*this, band);
+
+		u32 flags;
+		switch (curbitmap.format())
+		{
+			default:
+			case BITMAP_FORMAT_IND16:   flags = m_screen_update_ind16(*this, curbitmap.as_ind16(), m_deferred_bands[band]);   break;
+			case BITMAP_FORMAT_RGB32:   flags = m_screen_update_rgb32(*this, curbitmap.as_rgb32(), m_deferred_bands[band]);   break;
+		}
+
+		// if we modified the bitmap, we have to commit
+		m_changed |= ~flags & UPDATE_HAS_NOT_CHANGED;
+	}
+
+	g_profiler.stop();
+
+	m_deferred_restore(*this, bands);
+	m_deferred_bands.clear();
+}
+
+
 //-------------------------------------------------
 //  pixel - returns the RGB value of the specified
 //  pixel location
@@ -1436,6 +1512,9 @@ void screen_device::reset_partial_updates()
 
 u32 screen_device::pixel(s32 x, s32 y)
 {
+	// queued bands have to land before anyone looks at the bitmap
+	flush_deferred_updates();
+
 	screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
 	if (!curbitmap.valid())
 		return 0;
@@ -1483,6 +1562,9 @@ u32 screen_device::pixel(s32 x, s32 y)
 
 void screen_device::pixels(u32 *buffer)
 {
+	// queued bands have to land before anyone looks at the bitmap
+	flush_deferred_updates();
+
 	screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
 	if (!curbitmap.valid())
 		return;
@@ -1761,6 +1843,35 @@ void screen_device::create_composited_bitmap()
 }
 
 
+//-------------------------------------------------
+//  changed_rows - return the rows of the visible
+//  area where the bitmap being drawn differs from
+//  the one on display
+//-------------------------------------------------
+
+rectangle screen_device::changed_rows()
+{
+	// until both textures hold a frame, or with composited bitmaps, assume everything changed
+	if (m_curtexture == m_curbitmap || (m_video_attributes & VIDEO_VARIABLE_WIDTH))
+		return m_visarea;
+
+	bitmap_t &curbitmap = m_bitmap[m_curbitmap];
+	bitmap_t &prevbitmap = m_bitmap[m_curtexture];
+	size_t const bytes = m_visarea.width() * curbitmap.bpp() / 8;
+
+	// scan inwards from the top and bottom to find the first and last differing rows
+	s32 top = m_visarea.top();
+	while (top <= m_visarea.bottom() && memcmp(curbitmap.raw_pixptr(top, m_visarea.left()), prevbitmap.raw_pixptr(top, m_visarea.left()), bytes) == 0)
+		top++;
+	if (top > m_visarea.bottom())
+		return rectangle(0, -1, 0, -1);
+	s32 bottom = m_visarea.bottom();
+	while (bottom > top && memcmp(curbitmap.raw_pixptr(bottom, m_visarea.left()), prevbitmap.raw_pixptr(bottom, m_visarea.left()), bytes) == 0)
+		bottom--;
+	return rectangle(m_visarea.left(), m_visarea.right(), top, bottom);
+}
+
+
 //-------------------------------------------------
 //  update_quads - set up the quads for this
 //  screen
@@ -1781,9 +1892,20 @@ bool screen_device::update_quads()
 				{
 					create_composited_bitmap();
 				}
-				m_texture[m_curbitmap]->set_bitmap(m_bitmap[m_curbitmap], m_visarea, m_bitmap[m_curbitmap].texformat());
-				m_curtexture = m_curbitmap;
-				m_curbitmap = 1 - m_curbitmap;
+				// find the rows that differ from the frame on display; if there
+				// are none, keep showing it and draw over the same bitmap again
+				rectangle const dirty = changed_rows();
+				if (!dirty.empty())
+				{
+					// the texture last held the frame before the one on display,
+					// so it also needs the rows that changed in that frame
+					m_texture[m_curbitmap]->set_bitmap(m_bitmap[m_curbitmap], m_visarea, m_bitmap[m_curbitmap].texformat());
+					m_texture[m_curbitmap]->mark_dirty(dirty);
+					m_texture[m_curbitmap]->mark_dirty(m_prev_dirty);
+					m_prev_dirty = dirty;
+					m_curtexture = m_curbitmap;
+					m_curbitmap = 1 - m_curbitmap;
+				}
 			}
 
 			// brightness adjusted render color
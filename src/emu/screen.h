@@ -165,6 +165,7 @@ typedef delegate<void (screen_device &, bool)> vblank_state_delegate;
 
 typedef device_delegate<u32 (screen_device &, bitmap_ind16 &, const rectangle &)> screen_update_ind16_delegate;
 typedef device_delegate<u32 (screen_device &, bitmap_rgb32 &, const rectangle &)> screen_update_rgb32_delegate;
+typedef device_delegate<void (screen_device &, int)> screen_band_state_delegate;
 
 
 // ======================> screen_device
@@ -365,6 +366,16 @@ public:
 		m_screen_update_rgb32.set(std::forward<T>(target), std::forward<F>(callback), name);
 	}
 
+	// defer partial updates to the end of the frame; capture saves the driver's
+	// raster state into slot n, restore puts slot n back before the band is drawn
+	template <typename F, typename G>
+	screen_device &set_deferred_update(F &&capture, const char *capture_name, G &&restore, const char *restore_name)
+	{
+		m_deferred_capture.set(std::forward<F>(capture), capture_name);
+		m_deferred_restore.set(std::forward<G>(restore), restore_name);
+		return *this;
+	}
+
 	auto screen_vblank() { return m_screen_vblank.bind(); }
 	auto scanline() { m_video_attributes |= VIDEO_UPDATE_SCANLINE; return m_scanline_cb.bind(); }
 	template <typename T> screen_device &set_palette(T &&tag) { m_palette.set_tag(std::forward<T>(tag)); return *this; }
@@ -412,6 +423,7 @@ public:
 	bool update_partial(int scanline);
 	void update_now();
 	void reset_partial_updates();
+	void flush_deferred_updates();
 
 	// additional helpers
 	void register_vblank_callback(vblank_state_delegate vblank_callback);
@@ -457,7 +469,9 @@ private:
 	void update_scan_bitmap_size(int y);
 	void pre_update_scanline(int y);
 	void create_composited_bitmap();
+	rectangle changed_rows();
 	void destroy_scan_bitmaps();
+	bool defer_band(const rectangle &clip);
 	void allocate_scan_bitmaps();
 
 	// inline configuration data
@@ -471,6 +485,8 @@ private:
 	float               m_xscale, m_yscale;         // default X/Y scale factor
 	screen_update_ind16_delegate m_screen_update_ind16; // screen update callback (16-bit palette)
 	screen_update_rgb32_delegate m_screen_update_rgb32; // screen update callback (32-bit RGB)
+	screen_band_state_delegate m_deferred_capture;  // save raster state for a deferred band
+	screen_band_state_delegate m_deferred_restore;  // restore raster state for a deferred band
 	devcb_write_line    m_screen_vblank;            // screen vblank line callback
 	devcb_write32       m_scanline_cb;              // screen scanline callback
 	optional_device<device_palette_interface> m_palette;      // our palette
@@ -497,8 +513,10 @@ private:
 	u8                  m_curbitmap;                // current bitmap index
 	u8                  m_curtexture;               // current texture index
 	bool                m_changed;                  // has this bitmap changed?
+	rectangle           m_prev_dirty;               // rows that changed in the previous texture update
 	s32                 m_last_partial_scan;        // scanline of last partial update
 	s32                 m_partial_scan_hpos;        // horizontal pixel last rendered on this partial scanline
+	std::vector<rectangle> m_deferred_bands;        // partial updates waiting for the end of the frame
 	bitmap_argb32       m_screen_overlay_bitmap;    // screen overlay bitmap
 	u32                 m_unique_id;                // unique id for this screen_device
 	rgb_t               m_color;                    // render color
@@ -27,6 +27,37 @@
 static std::regex s_potenial_softlist_regex("\\w+(\\:\\w+)*");
 
 
+//**************************************************************************
+//  HELPERS
+//**************************************************************************
+
+//-------------------------------------------------
+//  interface_in_list - determine if an interface
+//  is in a comma-separated list
+//-------------------------------------------------
+
+static bool interface_in_list(const std::string &interface, const char *interface_list) noexcept
+{
+	// if we have no interface, then we match by default
+	if (interface.empty())
+		return true;
+
+	// find our interface at the beginning of the list or immediately following a comma
+	while (true)
+	{
+		char const *const found(std::strstr(interface_list, interface.c_str()));
+		if (!found)
+			return false;
+		if (((found == interface_list) || (',' == found[-1])) && ((',' == found[interface.size()]) || !found[interface.size()]))
+			return true;
+		interface_list = std::strchr(interface_list, ',');
+		if (!interface_list)
+			return false;
+		++interface_list;
+	}
+}
+
+
 //**************************************************************************
 //  FEATURE LIST ITEM
 //**************************************************************************
@@ -98,23 +129,22 @@ const char *software_part::feature(const std::string &feature_name) const noexce
 
 bool software_part::matches_interface(const char *interface_list) const noexcept
 {
-	// if we have no interface, then we match by default
-	if (m_interface.empty())
-		return true;
+	return interface_in_list(m_interface, interface_list);
+}
 
-	// find our interface at the beginning of the list or immediately following a comma
-	while (true)
-	{
-		char const *const found(std::strstr(interface_list, m_interface.c_str()));
-		if (!found)
-			return false;
-		if (((found == interface_list) || (',' == found[-1])) && ((',' == found[m_interface.size()]) || !found[m_interface.size()]))
-			return true;
-		interface_list = std::strchr(interface_list, ',');
-		if (!interface_list)
-			return false;
-		++interface_list;
-	}
+
+//**************************************************************************
+//  SOFTWARE INDEX PART
+//**************************************************************************
+
+//-------------------------------------------------
+//  matches_interface - determine if we match
+//  an interface in the provided list
+//-------------------------------------------------
+
+bool software_index_part::matches_interface(const char *interface_list) const noexcept
+{
+	return interface_in_list(interface, interface_list);
 }
 
 
@@ -192,11 +222,12 @@ bool software_info::has_multiple_parts(const char *interface) const
 //  softlist_parser - constructor
 //-------------------------------------------------
 
-softlist_parser::softlist_parser(util::core_file &file, const std::string &filename, std::string &description, std::list<software_info> &infolist, std::ostringstream &errors) :
+softlist_parser::softlist_parser(util::core_file &file, const std::string &filename, std::string &description, std::list<software_info> &infolist, std::ostringstream &errors, std::vector<std::pair<u64, u64> > *extents) :
 	m_file(file),
 	m_filename(filename),
 	m_infolist(infolist),
 	m_errors(errors),
+	m_extents(extents),
 	m_done(false),
 	m_description(description),
 	m_data_accum_expected(false),
@@ -430,6 +461,14 @@ void softlist_parser::end_handler(void *data, const char *name)
 			break;
 
 		case POS_MAIN:
+			// extend the item to the end of its end tag (empty element tags have no separate end)
+			if (state->m_extents && state->m_current_info)
+			{
+				auto &extent(state->m_extents->back());
+				u64 const end(XML_GetCurrentByteIndex(state->m_parser) + XML_GetCurrentByteCount(state->m_parser));
+				if (end > (extent.first + extent.second))
+					extent.second = end - extent.first;
+			}
 			state->m_current_info = nullptr;
 			break;
 
@@ -511,6 +550,8 @@ void softlist_parser::parse_main_start(const char *tagname, const char **attribu
 		{
 			m_infolist.emplace_back(std::move(attrvalues[0]), std::move(attrvalues[1]), attrvalues[2].c_str());
 			m_current_info = &m_infolist.back();
+			if (m_extents)
+				m_extents->emplace_back(XML_GetCurrentByteIndex(m_parser), XML_GetCurrentByteCount(m_parser));
 		}
 		else
 			parse_error("No name defined for item");
@@ -19,6 +19,8 @@
 #include "corefile.h"
 
 #include <list>
+#include <utility>
+#include <vector>
 
 
 //**************************************************************************
@@ -144,13 +146,46 @@ private:
 };
 
 
+// ======================> software_index_part
+
+// a part of a software item as recorded in the index
+struct software_index_part
+{
+	std::string             name;
+	std::string             interface;
+	std::string             compatibility;      // value of the compatibility feature
+	std::string             incompatibility;    // value of the incompatibility feature
+
+	bool matches_interface(const char *interface_list) const noexcept;
+};
+
+
+// ======================> software_index_entry
+
+// enough of a software item to list it and to find it in the file again
+// without parsing the whole software list
+struct software_index_entry
+{
+	std::string                         shortname;
+	std::string                         longname;
+	std::string                         parentname;
+	std::string                         year;
+	std::string                         publisher;
+	std::string                         usage;      // value of the usage info item
+	u32                                 supported;
+	u64                                 offset;     // byte offset of the software element
+	u64                                 length;     // byte length of the software element
+	std::vector<software_index_part>    parts;
+};
+
+
 // ======================> softlist_parser
 
 class softlist_parser
 {
 public:
 	// construction (== execution)
-	softlist_parser(util::core_file &file, const std::string &filename, std::string &description, std::list<software_info> &infolist, std::ostringstream &errors);
+	softlist_parser(util::core_file &file, const std::string &filename, std::string &description, std::list<software_info> &infolist, std::ostringstream &errors, std::vector<std::pair<u64, u64> > *extents = nullptr);
 
 private:
 	enum parse_position
@@ -196,6 +231,7 @@ private:
 	std::string                         m_filename;
 	std::list<software_info> &  m_infolist;
 	std::ostringstream &        m_errors;
+	std::vector<std::pair<u64, u64> > *m_extents;  // offset and length of each item, if wanted
 	struct XML_ParserStruct *   m_parser;
 	bool                        m_done;
 	std::string &               m_description;
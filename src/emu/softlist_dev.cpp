@@ -17,6 +17,7 @@
 #include "validity.h"
 
 #include <cctype>
+#include <cstring>
 
 
 //**************************************************************************
@@ -25,6 +26,106 @@
 
 typedef std::unordered_map<std::string, const software_info *> softlist_map;
 
+namespace {
+
+// index files are written in host byte order - they're only a cache of the
+// software list, and are rebuilt if they can't be read
+constexpr char SWINDEX_MAGIC[4] = { 'M', 'S', 'W', 'X' };
+constexpr u32 SWINDEX_FORMAT = 1U;
+
+struct swindex_header
+{
+	char    magic[4];
+	u32     format;
+	u64     size;       // size of the software list file
+	s64     stamp;      // modification time of the software list file
+	u32     count;      // number of items
+	u32     reserved;
+};
+
+
+// appends values and length-prefixed strings to an index
+class swindex_writer
+{
+public:
+	std::vector<u8> &data() { return m_data; }
+
+	template <typename T> void value(T const &value)
+	{
+		u8 const *const bytes(reinterpret_cast<u8 const *>(&value));
+		m_data.insert(m_data.end(), bytes, bytes + sizeof(value));
+	}
+
+	void string(std::string const &value)
+	{
+		this->value(u32(value.length()));
+		m_data.insert(m_data.end(), value.begin(), value.end());
+	}
+
+private:
+	std::vector<u8> m_data;
+};
+
+
+// reads values and strings back, noting whether it ever ran off the end
+class swindex_reader
+{
+public:
+	swindex_reader(u8 const *data, std::size_t length) : m_ptr(data), m_end(data + length), m_good(true) { }
+
+	bool good() const { return m_good; }
+	bool done() const { return m_ptr == m_end; }
+
+	template <typename T> T value()
+	{
+		T result;
+		if ((m_end - m_ptr) < std::ptrdiff_t(sizeof(result)))
+		{
+			m_good = false;
+			std::memset(&result, 0, sizeof(result));
+			return result;
+		}
+		std::memcpy(&result, m_ptr, sizeof(result));
+		m_ptr += sizeof(result);
+		return result;
+	}
+
+	std::string string()
+	{
+		u32 const length(value<u32>());
+		if ((m_end - m_ptr) < std::ptrdiff_t(length))
+		{
+			m_good = false;
+			return std::string();
+		}
+		std::string result(reinterpret_cast<char const *>(m_ptr), length);
+		m_ptr += length;
+		return result;
+	}
+
+private:
+	u8 const *m_ptr;
+	u8 const *m_end;
+	bool m_good;
+};
+
+
+//-------------------------------------------------
+//  file_stamp - get the modification time of a
+//  plain file, or false if it isn't one
+//-------------------------------------------------
+
+bool file_stamp(emu_file &file, s64 &stamp)
+{
+	auto const entry(osd_stat(file.fullpath()));
+	if (!entry || (entry->type != osd::directory::entry::entry_type::FILE))
+		return false;
+	stamp = std::chrono::duration_cast<std::chrono::seconds>(entry->last_modified.time_since_epoch()).count();
+	return true;
+}
+
+} // anonymous namespace
+
 
 //**************************************************************************
 //  GLOBAL VARIABLES
@@ -87,7 +188,8 @@ software_list_device::software_list_device(const machine_config &mconfig, const
 	m_filter(nullptr),
 	m_parsed(false),
 	m_file(mconfig.options().hash_path(), OPEN_FLAG_READ),
-	m_description("")
+	m_description(""),
+	m_indexed(false)
 {
 }
 
@@ -178,6 +280,11 @@ void software_list_device::release()
 	m_description.clear();
 	m_errors.clear();
 	m_infolist.clear();
+	m_indexed = false;
+	m_prolog.clear();
+	m_index.clear();
+	m_loaded.clear();
+	m_lazylist.clear();
 }
 
 
@@ -252,18 +359,38 @@ const software_info *software_list_device::find(const std::string &look_for)
 		return nullptr;
 
 	const bool iswild = look_for.find_first_of("*?") != std::string::npos;
+	auto const matches =
+			[&look_for, iswild] (const std::string &shortname)
+			{
+				return (iswild && core_strwildcmp(look_for.c_str(), shortname.c_str()) == 0)
+						|| core_stricmp(look_for.c_str(), shortname.c_str()) == 0;
+			};
+
+	// if we have an index and haven't parsed everything, parse just the item
+	const auto &index_list = index();
+	if (!m_parsed)
+	{
+		auto const entry = std::find_if(
+				index_list.begin(),
+				index_list.end(),
+				[&matches] (const software_index_entry &entry) { return matches(entry.shortname); });
+		if (entry == index_list.end())
+			return nullptr;
+		const software_info *const result = load_item(std::distance(index_list.begin(), entry));
+		if (result)
+			return result;
+
+		// the index is out of date - fall back to parsing the whole list
+		osd_printf_verbose("Index for %s is out of date, parsing the whole list\n", m_list_name);
+		parse();
+	}
 
 	// find a match (will cause a parse if needed when calling get_info)
 	const auto &info_list = get_info();
 	auto iter = std::find_if(
 			info_list.begin(),
 			info_list.end(),
-			[&look_for, iswild] (const software_info &info)
-			{
-				const char *shortname = info.shortname().c_str();
-				return (iswild && core_strwildcmp(look_for.c_str(), shortname) == 0)
-						|| core_stricmp(look_for.c_str(), shortname) == 0;
-			});
+			[&matches] (const software_info &info) { return matches(info.shortname()); });
 
 	return iter != info_list.end() ? &*iter : nullptr;
 }
@@ -288,24 +415,289 @@ void software_list_device::parse()
 	{
 		// parse if no error
 		std::ostringstream errs;
-		softlist_parser parser(m_file, m_file.filename(), m_description, m_infolist, errs);
-		m_file.close();
+		std::vector<std::pair<u64, u64> > extents;
+		softlist_parser parser(m_file, m_file.filename(), m_description, m_infolist, errs, &extents);
 		m_errors = errs.str();
+
+		// build the index from what we parsed, and save it if the file can be identified later
+		if (!m_indexed)
+		{
+			m_prolog.clear();
+			if (!extents.empty())
+			{
+				m_prolog.resize(extents.front().first);
+				if (m_file.seek(0, SEEK_SET) || (m_file.read(&m_prolog[0], m_prolog.size()) != m_prolog.size()))
+					m_prolog.clear();
+			}
+			build_index(extents);
+
+			s64 stamp;
+			if (!m_prolog.empty() && m_errors.empty() && file_stamp(m_file, stamp))
+				save_index(m_file.size(), stamp);
+		}
+		m_file.close();
 	}
 	else
+	{
 		m_errors = string_format("Error opening file: %s\n", filename());
+		m_indexed = true;
+	}
 
 	// indicate that we've been parsed
 	m_parsed = true;
 }
 
 
+//-------------------------------------------------
+//  build_index - summarise parsed items for
+//  listing and finding them later
+//-------------------------------------------------
+
+void software_list_device::build_index(std::vector<std::pair<u64, u64> > const &extents)
+{
+	assert(extents.size() == m_infolist.size());
+
+	m_index.clear();
+	m_index.reserve(m_infolist.size());
+	auto extent = extents.begin();
+	for (const software_info &swinfo : m_infolist)
+	{
+		software_index_entry &entry = *m_index.emplace(m_index.end());
+		entry.shortname = swinfo.shortname();
+		entry.longname = swinfo.longname();
+		entry.parentname = swinfo.parentname();
+		entry.year = swinfo.year();
+		entry.publisher = swinfo.publisher();
+		for (const feature_list_item &feature : swinfo.other_info())
+		{
+			if (feature.name() == "usage")
+			{
+				entry.usage = feature.value();
+				break;
+			}
+		}
+		entry.supported = swinfo.supported();
+		entry.offset = extent->first;
+		entry.length = extent->second;
+		++extent;
+
+		entry.parts.reserve(swinfo.parts().size());
+		for (const software_part &swpart : swinfo.parts())
+		{
+			software_index_part &part = *entry.parts.emplace(entry.parts.end());
+			const char *const compatibility = swpart.feature("compatibility");
+			const char *const incompatibility = swpart.feature("incompatibility");
+			part.name = swpart.name();
+			part.interface = swpart.interface();
+			part.compatibility = compatibility ? compatibility : "";
+			part.incompatibility = incompatibility ? incompatibility : "";
+		}
+	}
+	m_loaded.assign(m_index.size(), nullptr);
+	m_indexed = true;
+}
+
+
+//-------------------------------------------------
+//  save_index - write the index to the index
+//  directory
+//-------------------------------------------------
+
+void software_list_device::save_index(u64 size, s64 stamp) const
+{
+	if (!*mconfig().options().swindex_directory())
+		return;
+
+	swindex_header header;
+	std::memcpy(header.magic, SWINDEX_MAGIC, sizeof(header.magic));
+	header.format = SWINDEX_FORMAT;
+	header.size = size;
+	header.stamp = stamp;
+	header.count = m_index.size();
+	header.reserved = 0U;
+
+	swindex_writer writer;
+	writer.value(header);
+	writer.string(m_file.fullpath());
+	writer.string(m_description);
+	writer.string(m_prolog);
+	for (const software_index_entry &entry : m_index)
+	{
+		writer.string(entry.shortname);
+		writer.string(entry.longname);
+		writer.string(entry.parentname);
+		writer.string(entry.year);
+		writer.string(entry.publisher);
+		writer.string(entry.usage);
+		writer.value(entry.supported);
+		writer.value(entry.offset);
+		writer.value(entry.length);
+		writer.value(u32(entry.parts.size()));
+		for (const software_index_part &part : entry.parts)
+		{
+			writer.string(part.name);
+			writer.string(part.interface);
+			writer.string(part.compatibility);
+			writer.string(part.incompatibility);
+		}
+	}
+
+	emu_file file(mconfig().options().swindex_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(m_list_name + ".idx") == osd_file::error::NONE)
+	{
+		if (file.write(&writer.data()[0], writer.data().size()) != writer.data().size())
+			osd_printf_verbose("Error writing software list index %s\n", file.fullpath());
+	}
+}
+
+
+//-------------------------------------------------
+//  load_index - read the saved index if it was
+//  made from the current software list file
+//-------------------------------------------------
+
+bool software_list_device::load_index()
+{
+	if (!*mconfig().options().swindex_directory())
+		return false;
+
+	// identify the software list file
+	if (m_file.open(m_list_name + ".xml") != osd_file::error::NONE)
+		return false;
+	std::string const fullpath(m_file.fullpath());
+	u64 const size(m_file.size());
+	s64 stamp;
+	bool const plain(file_stamp(m_file, stamp));
+	m_file.close();
+	if (!plain)
+		return false;
+
+	// read the index
+	std::vector<u8> data;
+	{
+		emu_file file(mconfig().options().swindex_directory(), OPEN_FLAG_READ);
+		if (file.open(m_list_name + ".idx") != osd_file::error::NONE)
+			return false;
+		data.resize(file.size());
+		if (data.empty() || (file.read(&data[0], data.size()) != data.size()))
+			return false;
+	}
+
+	// check that it describes this file
+	swindex_reader reader(&data[0], data.size());
+	swindex_header const header(reader.value<swindex_header>());
+	if (!reader.good() ||
+		std::memcmp(header.magic, SWINDEX_MAGIC, sizeof(header.magic)) ||
+		(SWINDEX_FORMAT != header.format) ||
+		(size != header.size) ||
+		(stamp != header.stamp) ||
+		(reader.string() != fullpath))
+	{
+		return false;
+	}
+	std::string description(reader.string());
+	std::string prolog(reader.string());
+
+	std::vector<software_index_entry> index;
+	index.reserve(header.count);
+	for (u32 i = 0; reader.good() && (header.count > i); ++i)
+	{
+		software_index_entry &entry = *index.emplace(index.end());
+		entry.shortname = reader.string();
+		entry.longname = reader.string();
+		entry.parentname = reader.string();
+		entry.year = reader.string();
+		entry.publisher = reader.string();
+		entry.usage = reader.string();
+		entry.supported = reader.value<u32>();
+		entry.offset = reader.value<u64>();
+		entry.length = reader.value<u64>();
+		u32 const parts(reader.value<u32>());
+		for (u32 j = 0; reader.good() && (parts > j); ++j)
+		{
+			software_index_part &part = *entry.parts.emplace(entry.parts.end());
+			part.name = reader.string();
+			part.interface = reader.string();
+			part.compatibility = reader.string();
+			part.incompatibility = reader.string();
+		}
+	}
+	if (!reader.good() || !reader.done())
+		return false;
+
+	osd_printf_verbose("Loaded index for %s\n", fullpath);
+	m_description = std::move(description);
+	m_prolog = std::move(prolog);
+	m_index = std::move(index);
+	m_loaded.assign(m_index.size(), nullptr);
+	m_indexed = true;
+	return true;
+}
+
+
+//-------------------------------------------------
+//  load_item - parse a single item found in the
+//  index, returning nullptr if the file no longer
+//  matches the index
+//-------------------------------------------------
+
+const software_info *software_list_device::load_item(std::size_t index)
+{
+	if (m_loaded[index])
+		return m_loaded[index];
+
+	// read the item, and wrap it in the start of the file so it parses on its own
+	software_index_entry const &entry(m_index[index]);
+	if (m_prolog.empty() || (m_file.open(m_list_name + ".xml") != osd_file::error::NONE))
+		return nullptr;
+	std::string text(m_prolog);
+	text.resize(m_prolog.size() + entry.length);
+	bool const ok = !m_file.seek(entry.offset, SEEK_SET) && (m_file.read(&text[m_prolog.size()], entry.length) == entry.length);
+	m_file.close();
+	if (!ok)
+		return nullptr;
+	text.append("\n</softwarelist>\n");
+
+	util::core_file::ptr file;
+	if (util::core_file::open_ram(text.data(), text.size(), OPEN_FLAG_READ, file) != osd_file::error::NONE)
+		return nullptr;
+	std::string description;
+	std::list<software_info> items;
+	std::ostringstream errs;
+	softlist_parser parser(*file, m_file.filename(), description, items, errs);
+	if ((items.size() != 1) || (items.front().shortname() != entry.shortname) || !errs.str().empty())
+		return nullptr;
+
+	m_lazylist.splice(m_lazylist.end(), items);
+	m_loaded[index] = &m_lazylist.back();
+	return m_loaded[index];
+}
+
+
 //-------------------------------------------------
 //  is_compatible - determine if we are compatible
 //  with the given software_list_device
 //-------------------------------------------------
 
 software_compatibility software_list_device::is_compatible(const software_part &swpart) const
+{
+	return check_compatibility(swpart.feature("compatibility"), swpart.feature("incompatibility"));
+}
+
+software_compatibility software_list_device::is_compatible(const software_index_part &swpart) const
+{
+	return check_compatibility(
+			swpart.compatibility.empty() ? nullptr : swpart.compatibility.c_str(),
+			swpart.incompatibility.empty() ? nullptr : swpart.incompatibility.c_str());
+}
+
+
+//-------------------------------------------------
+//  check_compatibility - check a part's
+//  compatibility features against our filter
+//-------------------------------------------------
+
+software_compatibility software_list_device::check_compatibility(const char *compatibility, const char *incompatibility) const
 {
 	// get the softlist filter; if null, assume compatible
 	if (m_filter == nullptr)
@@ -315,7 +707,6 @@ software_compatibility software_list_device::is_compatible(const software_part &
 	std::string filt = std::string(m_filter).append(",");
 
 	// get the incompatibility filter and test against it first if it exists
-	const char *incompatibility = swpart.feature("incompatibility");
 	if (incompatibility != nullptr)
 	{
 		// copy the comma-delimited string and ensure it ends with a final comma
@@ -331,7 +722,6 @@ software_compatibility software_list_device::is_compatible(const software_part &
 	}
 
 	// get the compatibility feature; if null, assume compatible
-	const char *compatibility = swpart.feature("compatibility");
 	if (compatibility == nullptr)
 		return SOFTWARE_IS_COMPATIBLE;
 
@@ -118,16 +118,20 @@ public:
 	const char *filename() { return m_file.filename(); }
 
 	// getters that may trigger a parse
-	const std::string &description() { if (!m_parsed) parse(); return m_description; }
-	bool valid() { if (!m_parsed) parse(); return !m_infolist.empty(); }
+	const std::string &description() { index(); return m_description; }
+	bool valid() { return !index().empty(); }
 	const char *errors_string() { if (!m_parsed) parse(); return m_errors.c_str(); }
 	const std::list<software_info> &get_info() { if (!m_parsed) parse(); return m_infolist; }
 
+	// getters that use the index if possible, and only parse if it can't be loaded
+	const std::vector<software_index_entry> &index() { if (!m_indexed && !load_index()) parse(); return m_index; }
+
 	// operations
 	const software_info *find(const std::string &look_for);
 	void find_approx_matches(const std::string &name, int matches, const software_info **list, const char *interface);
 	void release();
 	software_compatibility is_compatible(const software_part &part) const;
+	software_compatibility is_compatible(const software_index_part &part) const;
 
 	// static helpers
 	static software_list_device *find_by_name(const machine_config &mconfig, const std::string &name);
@@ -143,6 +147,11 @@ protected:
 private:
 	// internal helpers
 	void parse();
+	bool load_index();
+	void build_index(std::vector<std::pair<u64, u64> > const &extents);
+	void save_index(u64 size, s64 stamp) const;
+	const software_info *load_item(std::size_t index);
+	software_compatibility check_compatibility(const char *compatibility, const char *incompatibility) const;
 	void internal_validity_check(validity_checker &valid) ATTR_COLD;
 
 	// configuration state
@@ -156,6 +165,13 @@ private:
 	std::string                 m_description;
 	std::string                 m_errors;
 	std::list<software_info>    m_infolist;
+
+	// index state
+	bool                                m_indexed;
+	std::string                         m_prolog;       // file contents before the first item
+	std::vector<software_index_entry>   m_index;        // every item in file order
+	std::vector<const software_info *>  m_loaded;       // items parsed on their own, by index position
+	std::list<software_info>            m_lazylist;     // storage for items parsed on their own
 };
 
 
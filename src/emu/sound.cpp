@@ -11,9 +11,20 @@
 #include "emu.h"
 #include "speaker.h"
 #include "emuopts.h"
+#include "fileio.h"
 #include "osdepend.h"
 #include "config.h"
-#include "wavwrite.h"
+#include "audiorec.h"
+#include "frametiming.h"
+
+// use SSE or NEON for the mixing kernels where it can be assumed
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)) || defined(_M_X64))
+#define SOUND_MIX_SSE (1)
+#include <emmintrin.h>
+#elif (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define SOUND_MIX_NEON (1)
+#include <arm_neon.h>
+#endif
 
 
 
@@ -43,6 +54,116 @@ const attotime sound_manager::STREAMS_UPDATE_ATTOTIME = attotime::from_hz(STREAM
 
 
 
+//**************************************************************************
+//  MIXING KERNELS
+//**************************************************************************
+
+namespace {
+
+using sample_t = stream_buffer::sample_t;
+
+//-------------------------------------------------
+//  mix_scale - dest = src * gain
+//-------------------------------------------------
+
+void mix_scale(sample_t *dest, sample_t const *src, sample_t gain, s32 count)
+{
+	s32 index = 0;
+#if defined(SOUND_MIX_SSE)
+	__m128 const vgain = _mm_set1_ps(gain);
+	for ( ; index + 4 <= count; index += 4)
+		_mm_storeu_ps(&dest[index], _mm_mul_ps(_mm_loadu_ps(&src[index]), vgain));
+#elif defined(SOUND_MIX_NEON)
+	for ( ; index + 4 <= count; index += 4)
+		vst1q_f32(&dest[index], vmulq_n_f32(vld1q_f32(&src[index]), gain));
+#endif
+	for ( ; index < count; index++)
+		dest[index] = src[index] * gain;
+}
+
+
+//-------------------------------------------------
+//  mix_accumulate - dest += src * gain
+//-------------------------------------------------
+
+void mix_accumulate(sample_t *dest, sample_t const *src, sample_t gain, s32 count)
+{
+	s32 index = 0;
+#if defined(SOUND_MIX_SSE)
+	__m128 const vgain = _mm_set1_ps(gain);
+	for ( ; index + 4 <= count; index += 4)
+		_mm_storeu_ps(&dest[index], _mm_add_ps(_mm_loadu_ps(&dest[index]), _mm_mul_ps(_mm_loadu_ps(&src[index]), vgain)));
+#elif defined(SOUND_MIX_NEON)
+	for ( ; index + 4 <= count; index += 4)
+		vst1q_f32(&dest[index], vaddq_f32(vld1q_f32(&dest[index]), vmulq_n_f32(vld1q_f32(&src[index]), gain)));
+#endif
+	for ( ; index < count; index++)
+		dest[index] += src[index] * gain;
+}
+
+
+//-------------------------------------------------
+//  mix_peak - return the largest absolute value
+//  in the buffer, or the initial peak if larger
+//-------------------------------------------------
+
+sample_t mix_peak(sample_t const *src, s32 count, sample_t peak)
+{
+	s32 index = 0;
+#if defined(SOUND_MIX_SSE)
+	__m128 const vsign = _mm_set1_ps(-0.0f);
+	__m128 vpeak = _mm_set1_ps(peak);
+	for ( ; index + 4 <= count; index += 4)
+		vpeak = _mm_max_ps(vpeak, _mm_andnot_ps(vsign, _mm_loadu_ps(&src[index])));
+	vpeak = _mm_max_ps(vpeak, _mm_shuffle_ps(vpeak, vpeak, _MM_SHUFFLE(1, 0, 3, 2)));
+	vpeak = _mm_max_ps(vpeak, _mm_shuffle_ps(vpeak, vpeak, _MM_SHUFFLE(2, 3, 0, 1)));
+	peak = _mm_cvtss_f32(vpeak);
+#elif defined(SOUND_MIX_NEON)
+	float32x4_t vpeak = vdupq_n_f32(peak);
+	for ( ; index + 4 <= count; index += 4)
+		vpeak = vmaxq_f32(vpeak, vabsq_f32(vld1q_f32(&src[index])));
+	float32x2_t vhalf = vmax_f32(vget_low_f32(vpeak), vget_high_f32(vpeak));
+	peak = vget_lane_f32(vpmax_f32(vhalf, vhalf), 0);
+#endif
+	for ( ; index < count; index++)
+		peak = std::max(peak, std::fabs(src[index]));
+	return peak;
+}
+
+
+
+//-------------------------------------------------
+//  mix_dot - return the dot product of two
+//  buffers
+//-------------------------------------------------
+
+sample_t mix_dot(sample_t const *src, sample_t const *coeffs, s32 count)
+{
+	s32 index = 0;
+	sample_t result = 0;
+#if defined(SOUND_MIX_SSE)
+	__m128 vsum = _mm_setzero_ps();
+	for ( ; index + 4 <= count; index += 4)
+		vsum = _mm_add_ps(vsum, _mm_mul_ps(_mm_loadu_ps(&src[index]), _mm_loadu_ps(&coeffs[index])));
+	vsum = _mm_add_ps(vsum, _mm_shuffle_ps(vsum, vsum, _MM_SHUFFLE(1, 0, 3, 2)));
+	vsum = _mm_add_ps(vsum, _mm_shuffle_ps(vsum, vsum, _MM_SHUFFLE(2, 3, 0, 1)));
+	result = _mm_cvtss_f32(vsum);
+#elif defined(SOUND_MIX_NEON)
+	float32x4_t vsum = vdupq_n_f32(0);
+	for ( ; index + 4 <= count; index += 4)
+		vsum = vaddq_f32(vsum, vmulq_f32(vld1q_f32(&src[index]), vld1q_f32(&coeffs[index])));
+	float32x2_t vhalf = vadd_f32(vget_low_f32(vsum), vget_high_f32(vsum));
+	result = vget_lane_f32(vpadd_f32(vhalf, vhalf), 0);
+#endif
+	for ( ; index < count; index++)
+		result += src[index] * coeffs[index];
+	return result;
+}
+
+} // anonymous namespace
+
+
+
 //**************************************************************************
 //  STREAM BUFFER
 //**************************************************************************
@@ -177,7 +298,9 @@ void stream_buffer::open_wav(char const *filename)
 {
 	// always open at 48k so that sound programs can handle it
 	// re-sample as needed
-	m_wav_file = wav_open(filename, 48000, 1);
+	m_wav_file = std::make_unique<audio_recorder>();
+	if (!m_wav_file->open(filename, 48000, 1))
+		m_wav_file.reset();
 }
 #endif
 
@@ -211,7 +334,7 @@ void stream_buffer::flush_wav()
 			buffer[sampindex] = s16(view.get(samplebase + sampindex) * 32768.0);
 
 		// write to the WAV
-		wav_add_data_16(m_wav_file, buffer, cursamples);
+		m_wav_file->add(buffer, cursamples);
 	}
 }
 #endif
@@ -224,9 +347,7 @@ void stream_buffer::flush_wav()
 #if (SOUND_DEBUG)
 void stream_buffer::close_wav()
 {
-	if (m_wav_file != nullptr)
-		wav_close(m_wav_file);
-	m_wav_file = nullptr;
+	m_wav_file.reset();
 }
 #endif
 
@@ -354,6 +475,105 @@ void stream_buffer::backfill_upsample(sample_t const *src, int samples, attotime
 
 
 
+//**************************************************************************
+//  STREAM VIEWS
+//**************************************************************************
+
+//-------------------------------------------------
+//  read - fetch gain-scaled samples into a linear
+//  buffer
+//-------------------------------------------------
+
+void read_stream_view::read(sample_t *dest, s32 start, s32 count) const
+{
+	while (count > 0)
+	{
+		s32 chunk = contiguous(start, count);
+		mix_scale(dest, rawdata(start), m_gain, chunk);
+		dest += chunk;
+		start += chunk;
+		count -= chunk;
+	}
+}
+
+
+//-------------------------------------------------
+//  add_to - accumulate gain-scaled samples into a
+//  linear buffer
+//-------------------------------------------------
+
+void read_stream_view::add_to(sample_t *dest, s32 start, s32 count) const
+{
+	while (count > 0)
+	{
+		s32 chunk = contiguous(start, count);
+		mix_accumulate(dest, rawdata(start), m_gain, chunk);
+		dest += chunk;
+		start += chunk;
+		count -= chunk;
+	}
+}
+
+
+//-------------------------------------------------
+//  fill - fill part of the view with the given
+//  value
+//-------------------------------------------------
+
+void write_stream_view::fill(sample_t value, s32 start, s32 count)
+{
+	if (start + count > samples())
+		count = samples() - start;
+	while (count > 0)
+	{
+		s32 chunk = contiguous(start, count);
+		std::fill_n(rawdata(start), chunk, value);
+		start += chunk;
+		count -= chunk;
+	}
+}
+
+
+//-------------------------------------------------
+//  copy - copy gain-scaled data from another view
+//-------------------------------------------------
+
+void write_stream_view::copy(read_stream_view const &src, s32 start, s32 count)
+{
+	if (start + count > samples())
+		count = samples() - start;
+	while (count > 0)
+	{
+		// each chunk has to be contiguous in both buffers
+		s32 chunk = src.contiguous(start, contiguous(start, count));
+		mix_scale(rawdata(start), src.rawdata(start), src.gain(), chunk);
+		start += chunk;
+		count -= chunk;
+	}
+}
+
+
+//-------------------------------------------------
+//  add - add gain-scaled data from another view
+//  to our current values
+//-------------------------------------------------
+
+void write_stream_view::add(read_stream_view const &src, s32 start, s32 count)
+{
+	if (start + count > samples())
+		count = samples() - start;
+	while (count > 0)
+	{
+		// each chunk has to be contiguous in both buffers
+		s32 chunk = src.contiguous(start, contiguous(start, count));
+		mix_accumulate(rawdata(start), src.rawdata(start), src.gain(), chunk);
+		start += chunk;
+		count -= chunk;
+	}
+}
+
+
+
 //**************************************************************************
 //  SOUND STREAM OUTPUT
 //**************************************************************************
@@ -553,7 +773,12 @@ sound_stream::sound_stream(device_t &device, u32 inputs, u32 outputs, u32 output
 	m_output_adaptive(sample_rate == SAMPLE_RATE_OUTPUT_ADAPTIVE),
 	m_synchronous((flags & STREAM_SYNCHRONOUS) != 0),
 	m_resampling_disabled((flags & STREAM_DISABLE_INPUT_RESAMPLING) != 0),
+	m_parallel_update((flags & STREAM_PARALLEL_UPDATE) != 0),
 	m_sync_timer(nullptr),
+	m_idle(false),
+	m_update_silent(false),
+	m_silent_start(attotime::never),
+	m_write_next(0),
 	m_input(inputs),
 	m_input_array(inputs),
 	m_input_view(inputs),
@@ -574,6 +799,7 @@ sound_stream::sound_stream(device_t &device, u32 inputs, u32 outputs, u32 output
 	// create a unique tag for saving
 	std::string state_tag = string_format("%d", m_device.machine().sound().unique_id());
 	auto &save = m_device.machine().save();
+	save.register_presave(save_prepost_delegate(FUNC(sound_stream::presave), this));
 	save.register_postload(save_prepost_delegate(FUNC(sound_stream::postload), this));
 
 	// initialize all inputs
@@ -714,7 +940,22 @@ read_stream_view sound_stream::update_view(attotime start, attotime end, u32 out
 		start = end;
 
 	g_profiler.start(PROFILER_SOUND);
+	generate(end, outputnum);
+	g_profiler.stop();
 
+	// return the requested view
+	return read_stream_view(m_output[outputnum].view(start, end));
+}
+
+
+//-------------------------------------------------
+//  generate - run the update callback from the
+//  current end of the given output up to the
+//  given end time
+//-------------------------------------------------
+
+void sound_stream::generate(attotime end, u32 outputnum)
+{
 	// reposition our start to coincide with the current buffer end
 	attotime update_start = m_output[outputnum].end_time();
 	if (update_start <= end)
@@ -740,14 +981,33 @@ read_stream_view sound_stream::update_view(attotime start, attotime end, u32 out
 				sound_assert(m_resampling_disabled || m_input_view[inputnum].sample_rate() == m_sample_rate);
 			}
 
+			// idle streams just fill with silence, unless there are writes to apply
+			if (m_idle && m_write_queue.empty())
+			{
+				for (unsigned int outindex = 0; outindex < m_output.size(); outindex++)
+					m_output_view[outindex].fill(0);
+				m_update_silent = true;
+			}
+			else
+			{
 #if (SOUND_DEBUG)
-			// clear each output view to NANs before we call the callback
-			for (unsigned int outindex = 0; outindex < m_output.size(); outindex++)
-				m_output_view[outindex].fill(NAN);
+				// clear each output view to NANs before we call the callback
+				for (unsigned int outindex = 0; outindex < m_output.size(); outindex++)
+					m_output_view[outindex].fill(NAN);
 #endif
 
-			// if we have an extended callback, that's all we need
-			m_callback_ex(*this, m_input_view, m_output_view);
+				// if we have an extended callback, that's all we need
+				m_update_silent = false;
+				place_queued_writes(update_start);
+				m_callback_ex(*this, m_input_view, m_output_view);
+				retire_queued_writes();
+			}
+
+			// extend or break the current run of silence
+			if (!m_update_silent)
+				m_silent_start = attotime::never;
+			else if (m_silent_start.is_never())
+				m_silent_start = update_start;
 
 #if (SOUND_DEBUG)
 			// make sure everything was overwritten
@@ -760,10 +1020,37 @@ read_stream_view sound_stream::update_view(attotime start, attotime end, u32 out
 #endif
 		}
 	}
-	g_profiler.stop();
+}
 
-	// return the requested view
-	return read_stream_view(m_output[outputnum].view(start, end));
+
+//-------------------------------------------------
+//  independent - return true if the stream can be
+//  generated on its own, without pulling from any
+//  other stream
+//-------------------------------------------------
+
+bool sound_stream::independent() const
+{
+	if (!m_parallel_update || m_synchronous || m_idle || m_sample_rate < SAMPLE_RATE_MINIMUM)
+		return false;
+	for (sound_stream_input const &input : m_input)
+		if (input.valid())
+			return false;
+	return true;
+}
+
+
+//-------------------------------------------------
+//  input_silent_since - return true if the given
+//  input has been silent since at least the given
+//  time; disconnected inputs are always silent
+//-------------------------------------------------
+
+bool sound_stream::input_silent_since(int inputnum, attotime time) const
+{
+	sound_assert(inputnum >= 0 && inputnum < m_input.size());
+	sound_stream_input const &input = m_input[inputnum];
+	return !input.valid() || input.source().stream().silent_since(time);
 }
 
 
@@ -859,12 +1146,77 @@ void sound_stream::sample_rate_changed()
 }
 
 
+//-------------------------------------------------
+//  queue_write - queue a register write for the
+//  update callback to apply in sample order
+//-------------------------------------------------
+
+void sound_stream::queue_write(offs_t offset, u32 data)
+{
+	m_write_queue.push_back(queued_write{ m_device.machine().time(), 0, offset, data });
+}
+
+
+//-------------------------------------------------
+//  place_queued_writes - work out which sample of
+//  the update starting at the given time each
+//  queued write is due at
+//-------------------------------------------------
+
+void sound_stream::place_queued_writes(attotime start)
+{
+	// a write lands on the first sample that update() at the time of the
+	// write wouldn't have generated yet, i.e. the first starting at or
+	// after it; anything left over from an earlier update is due at once
+	attoseconds_t const period = sample_period_attoseconds();
+	m_write_next = 0;
+	for (queued_write &write : m_write_queue)
+	{
+		if (write.time <= start)
+			write.sample = 0;
+		else if ((write.time - start).seconds() > 0)
+			write.sample = std::numeric_limits<int>::max();
+		else
+			write.sample = int(((write.time - start).attoseconds() + period - 1) / period);
+	}
+}
+
+
+//-------------------------------------------------
+//  retire_queued_writes - drop the writes the
+//  update callback applied
+//-------------------------------------------------
+
+void sound_stream::retire_queued_writes()
+{
+	m_write_queue.erase(m_write_queue.begin(), m_write_queue.begin() + m_write_next);
+	m_write_next = 0;
+}
+
+
+//-------------------------------------------------
+//  presave - save/restore callback
+//-------------------------------------------------
+
+void sound_stream::presave()
+{
+	// queued writes aren't saved, so get them into the device's state first
+	if (!m_write_queue.empty())
+		update();
+}
+
+
 //-------------------------------------------------
 //  postload - save/restore callback
 //-------------------------------------------------
 
 void sound_stream::postload()
 {
+	// forget any silence, and any writes made, from before the load
+	m_silent_start = attotime::never;
+	m_write_queue.clear();
+	m_write_next = 0;
+
 	// recompute the sample rate information
 	sample_rate_changed();
 }
@@ -966,6 +1318,56 @@ read_stream_view sound_stream::empty_view(attotime start, attotime end)
 
 
 
+//**************************************************************************
+//  RESAMPLER FILTER BANK
+//**************************************************************************
+
+//-------------------------------------------------
+//  resampler_filter_bank - build the polyphase
+//  coefficient tables for a rate ratio
+//-------------------------------------------------
+
+resampler_filter_bank::resampler_filter_bank(u32 input_rate, u32 output_rate)
+{
+	// zero crossings of the sinc on each side at full bandwidth, and a cap on
+	// the width for heavily oversampled inputs to bound the cost per sample
+	static constexpr int ZERO_CROSSINGS = 8;
+	static constexpr int MAX_HALF_TAPS = 64;
+
+	// when downsampling, the cutoff drops to the output Nyquist frequency and
+	// the filter widens proportionally in input samples
+	double const cutoff = std::min(1.0, double(output_rate) / double(input_rate));
+	m_half_taps = std::min(MAX_HALF_TAPS, int(std::ceil(ZERO_CROSSINGS / cutoff)));
+	m_coefficients.resize((PHASES + 1) * taps());
+
+	for (int phasenum = 0; phasenum <= PHASES; phasenum++)
+	{
+		// tap k sits at k - (half - 1) - frac input samples from the center
+		double const frac = double(phasenum) / double(PHASES);
+		sample_t *const dest = &m_coefficients[phasenum * taps()];
+		double sum = 0;
+		for (int tapnum = 0; tapnum < taps(); tapnum++)
+		{
+			double const x = double(tapnum - (m_half_taps - 1)) - frac;
+			double const arg = M_PI * cutoff * x;
+			double const sinc = (x == 0) ? 1.0 : (std::sin(arg) / arg);
+
+			// Blackman window spanning the full width of the filter
+			double const w = M_PI * x / double(m_half_taps);
+			double const window = (std::abs(x) >= double(m_half_taps)) ? 0.0 : (0.42 + 0.5 * std::cos(w) + 0.08 * std::cos(2.0 * w));
+			double const coeff = cutoff * sinc * window;
+			dest[tapnum] = sample_t(coeff);
+			sum += coeff;
+		}
+
+		// normalize each phase to unity gain at DC
+		for (int tapnum = 0; tapnum < taps(); tapnum++)
+			dest[tapnum] = sample_t(dest[tapnum] / sum);
+	}
+}
+
+
+
 //**************************************************************************
 //  RESAMPLER STREAM
 //**************************************************************************
@@ -977,7 +1379,10 @@ read_stream_view sound_stream::empty_view(attotime start, attotime end)
 
 default_resampler_stream::default_resampler_stream(device_t &device) :
 	sound_stream(device, 1, 1, 0, SAMPLE_RATE_OUTPUT_ADAPTIVE, stream_update_delegate(&default_resampler_stream::resampler_sound_update, this), STREAM_DISABLE_INPUT_RESAMPLING),
-	m_max_latency(0)
+	m_max_latency(0),
+	m_bank(nullptr),
+	m_bank_input_rate(0),
+	m_bank_output_rate(0)
 {
 	// create a name
 	m_name = "Default Resampler '";
@@ -1004,6 +1409,7 @@ void default_resampler_stream::resampler_sound_update(sound_stream &stream, std:
 	if (input.sample_rate() <= 1)
 	{
 		output.fill(0);
+		stream.set_update_silent();
 		return;
 	}
 
@@ -1015,24 +1421,36 @@ void default_resampler_stream::resampler_sound_update(sound_stream &stream, std:
 		return;
 	}
 
-	// compute the stepping value and the inverse
-	stream_buffer::sample_t step = stream_buffer::sample_t(input.sample_rate()) / stream_buffer::sample_t(output.sample_rate());
-	stream_buffer::sample_t stepinv = 1.0 / step;
+	// fetch the shared filter bank if the rates have changed
+	if (m_bank == nullptr || m_bank_input_rate != input.sample_rate() || m_bank_output_rate != output.sample_rate())
+	{
+		m_bank = &device().machine().sound().resampler_bank(input.sample_rate(), output.sample_rate());
+		m_bank_input_rate = input.sample_rate();
+		m_bank_output_rate = output.sample_rate();
+	}
+	resampler_filter_bank const &bank = *m_bank;
+	s32 const half = bank.half_taps();
+	s32 const taps = bank.taps();
 
-	// determine the latency we need to introduce, in input samples:
-	//    1 input sample for undersampled inputs
-	//    1 + step input samples for oversampled inputs
-	s64 latency_samples = 1 + ((step < 1.0) ? 0 : s32(step));
+	// compute the stepping value in input samples per output sample
+	double const step = double(input.sample_rate()) / double(output.sample_rate());
+
+	// determine the latency we need to introduce, in input samples; the
+	// filter looks half its width ahead of the point being reconstructed
+	s64 latency_samples = half + 1;
 	if (latency_samples <= m_max_latency)
 		latency_samples = m_max_latency;
 	else
 		m_max_latency = latency_samples;
 	attotime latency = latency_samples * input.sample_period();
 
+	// the filter also needs half its width of history behind that point
+	attotime lead = latency + half * input.sample_period();
+
 	// clamp the latency to the start (only relevant at the beginning)
 	s32 dstindex = 0;
 	attotime output_start = output.start_time();
-	while (latency > output_start && dstindex < numsamples)
+	while (lead > output_start && dstindex < numsamples)
 	{
 		output.put(dstindex++, 0);
 		output_start += output.sample_period();
@@ -1040,68 +1458,51 @@ void default_resampler_stream::resampler_sound_update(sound_stream &stream, std:
 	if (dstindex >= numsamples)
 		return;
 
+	// if the input has been silent across the whole filter window, so are we
+	if (stream.input_silent_since(0, output_start - lead))
+	{
+		output.fill(0);
+		stream.set_update_silent();
+		return;
+	}
+
 	// create a rebased input buffer around the adjusted start time
-	read_stream_view rebased(input, output_start - latency);
-	sound_assert(rebased.start_time() + latency <= output_start);
+	read_stream_view rebased(input, output_start - lead);
+	sound_assert(rebased.start_time() + lead <= output_start);
 
 	// compute the fractional input start position
-	attotime delta = output_start - (rebased.start_time() + latency);
+	attotime delta = output_start - (rebased.start_time() + lead);
 	sound_assert(delta.seconds() == 0);
-	stream_buffer::sample_t srcpos = stream_buffer::sample_t(double(delta.attoseconds()) / double(rebased.sample_period_attoseconds()));
-	sound_assert(srcpos <= 1.0f);
-
-	// input is undersampled: point sample except where our sample period covers a boundary
-	s32 srcindex = 0;
-	if (step < 1.0)
-	{
-		stream_buffer::sample_t cursample = rebased.get(srcindex++);
-		for ( ; dstindex < numsamples; dstindex++)
-		{
-			// if still within the current sample, just replicate
-			if (srcpos <= 1.0)
-				output.put(dstindex, cursample);
-
-			// if crossing a sample boundary, blend with the neighbor
-			else
-			{
-				srcpos -= 1.0;
-				sound_assert(srcpos <= step + 1e-5);
-				stream_buffer::sample_t prevsample = cursample;
-				cursample = rebased.get(srcindex++);
-				output.put(dstindex, stepinv * (prevsample * (step - srcpos) + srcpos * cursample));
-			}
-			srcpos += step;
-		}
-		sound_assert(srcindex <= rebased.samples());
-	}
+	double srcpos = double(delta.attoseconds()) / double(rebased.sample_period_attoseconds());
+	sound_assert(srcpos <= 1.0);
 
-	// input is oversampled: sum the energy
-	else
+	// convolve each output sample with the nearest two phases and blend
+	stream_buffer::sample_t const gain = rebased.gain();
+	for ( ; dstindex < numsamples; dstindex++)
 	{
-		float cursample = rebased.get(srcindex++);
-		for ( ; dstindex < numsamples; dstindex++)
+		s32 const center = s32(srcpos);
+		double const phasepos = (srcpos - double(center)) * double(resampler_filter_bank::PHASES);
+		s32 const phasenum = s32(phasepos);
+		stream_buffer::sample_t const blend = stream_buffer::sample_t(phasepos - double(phasenum));
+		stream_buffer::sample_t const *const coeffs0 = bank.phase(phasenum);
+		stream_buffer::sample_t const *const coeffs1 = bank.phase(phasenum + 1);
+
+		// the taps start half - 1 samples before the center, which in turn
+		// sits half samples into the rebased view; split at the buffer wrap
+		s32 srcindex = center + 1;
+		sound_assert(srcindex + taps <= rebased.samples());
+		stream_buffer::sample_t sum0 = 0, sum1 = 0;
+		for (s32 tapnum = 0; tapnum < taps; )
 		{
-			// compute the partial first sample and advance
-			stream_buffer::sample_t scale = 1.0 - srcpos;
-			stream_buffer::sample_t sample = cursample * scale;
-
-			// add in complete samples until we only have a fraction left
-			stream_buffer::sample_t remaining = step - scale;
-			while (remaining >= 1.0)
-			{
-				sample += rebased.get(srcindex++);
-				remaining -= 1.0;
-			}
-
-			// add in the final partial sample
-			cursample = rebased.get(srcindex++);
-			sample += cursample * remaining;
-			output.put(dstindex, sample * stepinv);
-
-			// our position is now the remainder
-			srcpos = remaining;
-			sound_assert(srcindex <= rebased.samples());
+			s32 const chunk = rebased.contiguous(srcindex, taps - tapnum);
+			stream_buffer::sample_t const *const src = rebased.rawdata(srcindex);
+			sum0 += mix_dot(src, &coeffs0[tapnum], chunk);
+			sum1 += mix_dot(src, &coeffs1[tapnum], chunk);
+			srcindex += chunk;
+			tapnum += chunk;
 		}
+		output.put(dstindex, gain * (sum0 + blend * (sum1 - sum0)));
+		srcpos += step;
 	}
 }
 
@@ -1118,6 +1519,8 @@ void default_resampler_stream::resampler_sound_update(sound_stream &stream, std:
 sound_manager::sound_manager(running_machine &machine) :
 	m_machine(machine),
 	m_update_timer(nullptr),
+	m_update_frequency(STREAMS_UPDATE_FREQUENCY),
+	m_update_period(STREAMS_UPDATE_ATTOTIME),
 	m_update_number(0),
 	m_last_update(attotime::zero),
 	m_finalmix_leftover(0),
@@ -1127,21 +1530,35 @@ sound_manager::sound_manager(running_machine &machine) :
 	m_rightmix(machine.sample_rate()),
 	m_compressor_scale(1.0),
 	m_compressor_counter(0),
+	m_compressor_recovery(1.01f),
 	m_muted(0),
 	m_nosound_mode(machine.osd().no_sound()),
+	m_speculative(false),
 	m_attenuation(0),
 	m_unique_id(0),
-	m_wavfile(nullptr),
+	m_update_queue(nullptr),
 	m_first_reset(true)
 {
 	// get filename for WAV file or AVI file if specified
 	const char *wavfile = machine.options().wav_write();
 	const char *avifile = machine.options().avi_write();
+	const char *pcmfile = machine.options().pcm_write();
 
-	// handle -nosound and lower sample rate if not recording WAV or AVI
-	if (m_nosound_mode && wavfile[0] == 0 && avifile[0] == 0)
+	// handle -nosound and lower sample rate if not recording WAV, AVI or PCM
+	if (m_nosound_mode && wavfile[0] == 0 && avifile[0] == 0 && pcmfile[0] == 0)
 		machine.m_sample_rate = 11025;
 
+	// in low-latency mode, mix in batches of a quarter of the host's target
+	// so that the buffer can stay short without running dry
+	int queued, target;
+	if (!m_nosound_mode && machine.osd().audio_buffer_status(queued, target) && target > 0)
+	{
+		m_update_frequency = std::min<int>(std::max<int>(4 * machine.sample_rate() / target, STREAMS_UPDATE_FREQUENCY), LOW_LATENCY_MAX_UPDATE_FREQUENCY);
+		m_update_period = attotime::from_hz(m_update_frequency);
+		m_compressor_recovery = std::pow(1.01f, float(STREAMS_UPDATE_FREQUENCY) / float(m_update_frequency));
+		osd_printf_verbose("Sound: low-latency mode, %d updates per second for a %d sample target\n", m_update_frequency, target);
+	}
+
 	// count the mixers
 #if VERBOSE
 	mixer_interface_iterator iter(machine.root_device());
@@ -1163,7 +1580,7 @@ sound_manager::sound_manager(running_machine &machine) :
 
 	// start the periodic update flushing timer
 	m_update_timer = machine.scheduler().timer_alloc(timer_expired_delegate(FUNC(sound_manager::update), this));
-	m_update_timer->adjust(STREAMS_UPDATE_ATTOTIME, 0, STREAMS_UPDATE_ATTOTIME);
+	m_update_timer->adjust(m_update_period, 0, m_update_period);
 }
 
 
@@ -1173,6 +1590,9 @@ sound_manager::sound_manager(running_machine &machine) :
 
 sound_manager::~sound_manager()
 {
+	// free the parallel update work queue
+	if (m_update_queue != nullptr)
+		osd_work_queue_free(m_update_queue);
 }
 
 
@@ -1180,7 +1600,7 @@ sound_manager::~sound_manager()
 //  stream_alloc_legacy - allocate a new stream
 //-------------------------------------------------
 
-sound_stream *sound_manager::stream_alloc_legacy(device_t &device, u32 inputs, u32 outputs, u32 sample_rate, stream_update_legacy_delegate callback)
+sound_stream *sound_manager::stream_alloc_legacy(device_t &device, u32 inputs, u32 outputs, u32 sample_rate, stream_update_legacy_delegate callback, sound_stream_flags flags)
 {
 	// determine output base
 	u32 output_base = 0;
@@ -1188,7 +1608,7 @@ sound_stream *sound_manager::stream_alloc_legacy(device_t &device, u32 inputs, u
 		if (&stream->device() == &device)
 			output_base += stream->output_count();
 
-	m_stream_list.push_back(std::make_unique<sound_stream>(device, inputs, outputs, output_base, sample_rate, callback));
+	m_stream_list.push_back(std::make_unique<sound_stream>(device, inputs, outputs, output_base, sample_rate, callback, flags));
 	return m_stream_list.back().get();
 }
 
@@ -1219,8 +1639,26 @@ void sound_manager::start_recording()
 {
 	// open the output WAV file if specified
 	const char *wavfile = machine().options().wav_write();
-	if (wavfile[0] != 0 && m_wavfile == nullptr)
-		m_wavfile = wav_open(wavfile, machine().sample_rate(), 2);
+	if (wavfile[0] != 0 && !m_wavfile)
+	{
+		m_wavfile = std::make_unique<audio_recorder>();
+		if (!m_wavfile->open(wavfile, machine().sample_rate(), 2))
+		{
+			osd_printf_error("Error opening audio recording %s\n", wavfile);
+			m_wavfile.reset();
+		}
+	}
+
+	// open the raw PCM stream if specified; it may well be a pipe or socket
+	const char *pcmfile = machine().options().pcm_write();
+	if (pcmfile[0] != 0 && !m_pcmfile)
+	{
+		auto file = std::make_unique<emu_file>(OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+		if (file->open(pcmfile) == osd_file::error::NONE)
+			m_pcmfile = std::move(file);
+		else
+			osd_printf_error("Error opening PCM stream %s\n", pcmfile);
+	}
 }
 
 
@@ -1230,10 +1668,9 @@ void sound_manager::start_recording()
 
 void sound_manager::stop_recording()
 {
-	// close any open WAV file
-	if (m_wavfile != nullptr)
-		wav_close(m_wavfile);
-	m_wavfile = nullptr;
+	// close any open WAV file, once everything queued has been written
+	m_wavfile.reset();
+	m_pcmfile.reset();
 }
 
 
@@ -1289,6 +1726,80 @@ void sound_manager::samples(s16 *buffer)
 }
 
 
+//-------------------------------------------------
+//  update_independent_streams - generate every
+//  stream that has no inputs and has opted in to
+//  parallel updates, spread across the work queue
+//-------------------------------------------------
+
+void sound_manager::update_independent_streams(attotime endtime)
+{
+	// gather the leaves of the stream graph that have work to do
+	m_parallel_updates.clear();
+	for (auto &stream : m_stream_list)
+		if (stream->independent() && stream->sample_time() < endtime)
+			m_parallel_updates.push_back(parallel_update{ stream.get(), endtime });
+
+	// not worth the overhead for fewer than two streams; the mixers will pull them normally
+	if (m_parallel_updates.size() < 2)
+		return;
+
+	// hand all but the first to the work queue and generate that one here
+	g_profiler.start(PROFILER_SOUND);
+	osd_work_item_queue_multiple(work_queue(), update_independent_callback, m_parallel_updates.size() - 1, &m_parallel_updates[1], sizeof(parallel_update), WORK_ITEM_FLAG_AUTO_RELEASE);
+	m_parallel_updates[0].m_stream->generate(endtime);
+
+	// join before anything downstream reads the results
+	while (!osd_work_queue_wait(m_update_queue, osd_ticks_per_second()))
+	{
+	}
+	g_profiler.stop();
+}
+
+
+//-------------------------------------------------
+//  work_queue - return the worker pool shared by
+//  parallel sound generation, allocating it the
+//  first time it's needed
+//-------------------------------------------------
+
+osd_work_queue *sound_manager::work_queue()
+{
+	if (m_update_queue == nullptr)
+		m_update_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	return m_update_queue;
+}
+
+
+//-------------------------------------------------
+//  update_independent_callback - work queue
+//  callback for generating one leaf stream
+//-------------------------------------------------
+
+void *sound_manager::update_independent_callback(void *param, int threadid)
+{
+	parallel_update &update = *reinterpret_cast<parallel_update *>(param);
+	update.m_stream->generate(update.m_end);
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  resampler_bank - return the filter bank for
+//  the given rates, creating it on first use
+//-------------------------------------------------
+
+resampler_filter_bank const &sound_manager::resampler_bank(u32 input_rate, u32 output_rate)
+{
+	// banks depend only on the ratio, so share them across equivalent pairs
+	u32 const divisor = util::euclid_gcd(input_rate, output_rate);
+	auto &bank = m_resampler_banks[std::make_pair(input_rate / divisor, output_rate / divisor)];
+	if (!bank)
+		bank = std::make_unique<resampler_filter_bank>(input_rate, output_rate);
+	return *bank;
+}
+
+
 //-------------------------------------------------
 //  mute - mute sound output
 //-------------------------------------------------
@@ -1519,6 +2030,36 @@ stream_buffer::sample_t sound_manager::adjust_toward_compressor_scale(stream_buf
 }
 
 
+//-------------------------------------------------
+//  write_pcm - write interleaved samples to the
+//  raw PCM stream as little-endian 16-bit words
+//-------------------------------------------------
+
+void sound_manager::write_pcm(const s16 *samples, int count)
+{
+	u32 const length = count * sizeof(s16);
+	u32 written;
+	if (ENDIANNESS_NATIVE == ENDIANNESS_LITTLE)
+	{
+		written = m_pcmfile->write(samples, length);
+	}
+	else
+	{
+		std::vector<s16> swapped(samples, samples + count);
+		for (s16 &sample : swapped)
+			sample = little_endianize_int16(sample);
+		written = m_pcmfile->write(&swapped[0], length);
+	}
+
+	// a consumer going away shouldn't stop emulation
+	if (written != length)
+	{
+		osd_printf_warning("Error writing PCM stream, closing it\n");
+		m_pcmfile.reset();
+	}
+}
+
+
 //-------------------------------------------------
 //  update - mix everything down to its final form
 //  and send it to the OSD layer
@@ -1529,6 +2070,8 @@ void sound_manager::update(void *ptr, int param)
 	VPRINTF(("sound_update\n"));
 
 	g_profiler.start(PROFILER_SOUND);
+	frame_timing_log *const timing = machine().frame_timing();
+	osd_ticks_t const start_ticks = timing ? osd_ticks() : 0;
 
 	// determine the duration of this update
 	attotime update_period = machine().time() - m_last_update;
@@ -1545,26 +2088,16 @@ void sound_manager::update(void *ptr, int param)
 	std::fill_n(&m_leftmix[0], m_samples_this_update, 0);
 	std::fill_n(&m_rightmix[0], m_samples_this_update, 0);
 
+	// generate independent chip streams across the work queue first
+	update_independent_streams(endtime);
+
 	// force all the speaker streams to generate the proper number of samples
 	for (speaker_device &speaker : speaker_device_iterator(machine().root_device()))
 		speaker.mix(&m_leftmix[0], &m_rightmix[0], m_last_update, endtime, m_samples_this_update, (m_muted & MUTE_REASON_SYSTEM));
 
 	// determine the maximum in this section
-	stream_buffer::sample_t curmax = 0;
-	for (int sampindex = 0; sampindex < m_samples_this_update; sampindex++)
-	{
-		auto sample = m_leftmix[sampindex];
-		if (sample < 0)
-			sample = -sample;
-		if (sample > curmax)
-			curmax = sample;
-
-		sample = m_rightmix[sampindex];
-		if (sample < 0)
-			sample = -sample;
-		if (sample > curmax)
-			curmax = sample;
-	}
+	stream_buffer::sample_t curmax = mix_peak(&m_leftmix[0], m_samples_this_update, 0);
+	curmax = mix_peak(&m_rightmix[0], m_samples_this_update, curmax);
 
 	// pull in current compressor scale factor before modifying
 	stream_buffer::sample_t lscale = m_compressor_scale;
@@ -1574,7 +2107,7 @@ void sound_manager::update(void *ptr, int param)
 	if (curmax * m_compressor_scale > 1.0)
 	{
 		m_compressor_scale = 1.0 / curmax;
-		m_compressor_counter = STREAMS_UPDATE_FREQUENCY / 5;
+		m_compressor_counter = m_update_frequency / 5;
 	}
 
 	// if we're currently scaled, wait a bit to see if we can trend back toward 1.0
@@ -1584,7 +2117,7 @@ void sound_manager::update(void *ptr, int param)
 	// try to migrate toward 0 unless we're going to introduce clipping
 	else if (m_compressor_scale < 1.0 && curmax * 1.01 * m_compressor_scale < 1.0)
 	{
-		m_compressor_scale *= 1.01f;
+		m_compressor_scale *= m_compressor_recovery;
 		if (m_compressor_scale > 1.0)
 			m_compressor_scale = 1.0;
 	}
@@ -1597,14 +2130,29 @@ void sound_manager::update(void *ptr, int param)
 	// track whether there are pending scale changes in left/right
 	stream_buffer::sample_t lprev = 0, rprev = 0;
 
+	// determine the output stepping; in low-latency mode, trim it so the
+	// host buffer converges on its target instead of drifting
+	u32 finalmix_step = machine().video().speed_factor() * (FINALMIX_PRECISION / 1000);
+	int queued, target;
+	if (machine().video().throttled() && machine().osd().audio_buffer_status(queued, target) && target > 0)
+	{
+		double const skew = std::min(std::max(double(queued - target) / double(target), -1.0), 1.0);
+		finalmix_step = u32(double(finalmix_step) * (1.0 + LOW_LATENCY_MAX_RATE_ADJUST * skew));
+	}
+
+	// also mix to float if the OSD takes it, which keeps what the 16-bit clamp would lose
+	int const float_channels = m_nosound_mode ? 0 : machine().osd().audio_float_channels();
+	if (float_channels != 0 && m_finalmix_float.size() != (m_finalmix.size() / 2) * float_channels)
+		m_finalmix_float.resize((m_finalmix.size() / 2) * float_channels);
+	u32 float_offset = 0;
+
 	// now downmix the final result
-	u32 finalmix_step = machine().video().speed_factor();
 	u32 finalmix_offset = 0;
 	s16 *finalmix = &m_finalmix[0];
 	int sample;
-	for (sample = m_finalmix_leftover; sample < m_samples_this_update * 1000; sample += finalmix_step)
+	for (sample = m_finalmix_leftover; sample < m_samples_this_update * FINALMIX_PRECISION; sample += finalmix_step)
 	{
-		int sampindex = sample / 1000;
+		int sampindex = sample / FINALMIX_PRECISION;
 
 		// ensure that changing the compression won't reverse direction to reduce "pops"
 		stream_buffer::sample_t lsamp = m_leftmix[sampindex];
@@ -1631,18 +2179,33 @@ void sound_manager::update(void *ptr, int param)
 		else if (rsamp < -1.0)
 			rsamp = -1.0;
 		finalmix[finalmix_offset++] = s16(rsamp * 32767.0);
+
+		// mono gets both sides, anything past stereo is silent for now
+		if (float_channels == 1)
+			m_finalmix_float[float_offset++] = 0.5f * (lprev + rprev);
+		else if (float_channels != 0)
+		{
+			m_finalmix_float[float_offset++] = lprev;
+			m_finalmix_float[float_offset++] = rprev;
+			for (int channel = 2; channel < float_channels; channel++)
+				m_finalmix_float[float_offset++] = 0.0f;
+		}
 	}
-	m_finalmix_leftover = sample - m_samples_this_update * 1000;
+	m_finalmix_leftover = sample - m_samples_this_update * FINALMIX_PRECISION;
 
 	// play the result
-	if (finalmix_offset > 0)
+	if (finalmix_offset > 0 && !m_speculative)
 	{
-		if (!m_nosound_mode)
+		if (float_channels != 0)
+			machine().osd().update_audio_stream_float(&m_finalmix_float[0], float_channels, finalmix_offset / 2);
+		else if (!m_nosound_mode)
 			machine().osd().update_audio_stream(finalmix, finalmix_offset / 2);
 		machine().osd().add_audio_to_recording(finalmix, finalmix_offset / 2);
 		machine().video().add_sound_to_recording(finalmix, finalmix_offset / 2);
-		if (m_wavfile != nullptr)
-			wav_add_data_16(m_wavfile, finalmix, finalmix_offset);
+		if (m_wavfile)
+			m_wavfile->add(finalmix, finalmix_offset);
+		if (m_pcmfile)
+			write_pcm(finalmix, finalmix_offset);
 	}
 
 	// update any orphaned streams so they don't get too far behind
@@ -1659,5 +2222,7 @@ void sound_manager::update(void *ptr, int param)
 	// notify that new samples have been generated
 	emulator_info::sound_hook();
 
+	if (timing)
+		timing->add_sound_ticks(osd_ticks() - start_ticks);
 	g_profiler.stop();
 }
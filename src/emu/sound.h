@@ -209,7 +209,7 @@ public:
 
 private:
 	// internal debugging state
-	wav_file *m_wav_file = nullptr;       // pointer to the current WAV file
+	std::unique_ptr<audio_recorder> m_wav_file; // WAV file being logged to
 	u32 m_last_written = 0;               // last written sample index
 #endif
 };
@@ -323,7 +323,34 @@ public:
 		return m_buffer->get(index);
 	}
 
+	// return the number of samples, up to count, starting at the given index
+	// that are contiguous in the underlying buffer
+	s32 contiguous(s32 index, s32 count) const
+	{
+		sound_assert(u32(index) < samples() || count == 0);
+		return std::min<s32>(count, m_buffer->size() - buffer_index(index));
+	}
+
+	// return a pointer to the raw samples starting at the given index; only
+	// contiguous() samples may be accessed through it
+	sample_t const *rawdata(s32 index) const { return &m_buffer->m_buffer[buffer_index(index)]; }
+
+	// bulk fetch gain-scaled samples into a linear buffer
+	void read(sample_t *dest, s32 start, s32 count) const;
+
+	// bulk accumulate gain-scaled samples into a linear buffer
+	void add_to(sample_t *dest, s32 start, s32 count) const;
+
 protected:
+	// convert an index within the view to an index within the buffer
+	u32 buffer_index(s32 index) const
+	{
+		index += m_start;
+		if (index >= m_buffer->size())
+			index -= m_buffer->size();
+		return index;
+	}
+
 	// normalize start/end
 	void normalize_start_end()
 	{
@@ -384,48 +411,22 @@ public:
 		m_buffer->put(index, m_buffer->get(index) + sample);
 	}
 
+	// return a writable pointer to the raw samples starting at the given index
+	using read_stream_view::rawdata;
+	sample_t *rawdata(s32 index) { return &m_buffer->m_buffer[buffer_index(index)]; }
+
 	// fill part of the view with the given value
-	void fill(sample_t value, s32 start, s32 count)
-	{
-		if (start + count > samples())
-			count = samples() - start;
-		u32 index = start + m_start;
-		for (s32 sampindex = 0; sampindex < count; sampindex++)
-		{
-			m_buffer->put(index, value);
-			index = m_buffer->next_index(index);
-		}
-	}
+	void fill(sample_t value, s32 start, s32 count);
 	void fill(sample_t value, s32 start) { fill(value, start, samples() - start); }
 	void fill(sample_t value) { fill(value, 0, samples()); }
 
 	// copy data from another view
-	void copy(read_stream_view const &src, s32 start, s32 count)
-	{
-		if (start + count > samples())
-			count = samples() - start;
-		u32 index = start + m_start;
-		for (s32 sampindex = 0; sampindex < count; sampindex++)
-		{
-			m_buffer->put(index, src.get(start + sampindex));
-			index = m_buffer->next_index(index);
-		}
-	}
+	void copy(read_stream_view const &src, s32 start, s32 count);
 	void copy(read_stream_view const &src, s32 start) { copy(src, start, samples() - start); }
 	void copy(read_stream_view const &src) { copy(src, 0, samples()); }
 
 	// add data from another view to our current values
-	void add(read_stream_view const &src, s32 start, s32 count)
-	{
-		if (start + count > samples())
-			count = samples() - start;
-		u32 index = start + m_start;
-		for (s32 sampindex = 0; sampindex < count; sampindex++)
-		{
-			m_buffer->put(index, m_buffer->get(index) + src.get(start + sampindex));
-			index = m_buffer->next_index(index);
-		}
-	}
+	void add(read_stream_view const &src, s32 start, s32 count);
 	void add(read_stream_view const &src, s32 start) { add(src, start, samples() - start); }
 	void add(read_stream_view const &src) { add(src, 0, samples()); }
 };
@@ -558,7 +559,13 @@ enum sound_stream_flags : u32
 
 	// specify that input streams should not be resampled; stream update handler
 	// must be able to accommodate multiple strams of differing input rates
-	STREAM_DISABLE_INPUT_RESAMPLING = 0x02
+	STREAM_DISABLE_INPUT_RESAMPLING = 0x02,
+
+	// specify that the update handler only touches its own device's state and
+	// may be run on a worker thread alongside other streams; it must not call
+	// into other devices, the scheduler, timers or logging, and only takes
+	// effect for streams with no inputs
+	STREAM_PARALLEL_UPDATE = 0x04
 };
 
 
@@ -585,6 +592,7 @@ public:
 	bool output_adaptive() const { return m_output_adaptive; }
 	bool synchronous() const { return m_synchronous; }
 	bool resampling_disabled() const { return m_resampling_disabled; }
+	bool parallel_update() const { return m_parallel_update; }
 
 	// input and output getters
 	u32 input_count() const { return m_input.size(); }
@@ -611,6 +619,49 @@ public:
 	// force an update to the current time, returning a view covering the given time period
 	read_stream_view update_view(attotime start, attotime end, u32 outputnum = 0);
 
+	// declare that all outputs are silent from the current end of the stream
+	// until the flag is cleared; while idle, updates fill zeros instead of
+	// calling the update callback, so update() first if the state changes
+	void set_idle(bool idle) { m_idle = idle; }
+	bool idle() const { return m_idle; }
+
+	// called from within the update callback to note that every output
+	// generated by this update is silence
+	void set_update_silent() { m_update_silent = true; }
+
+	// return true if all outputs have been silent since at least the given time
+	bool silent_since(attotime time) const { return m_silent_start <= time; }
+
+	// queue a register write, stamped with the current time, for the update
+	// callback to apply at the sample it was made in; this replaces calling
+	// update() before every write, so rapid writes no longer break the
+	// stream into tiny updates
+	void queue_write(offs_t offset, u32 data);
+
+	// called from within the update callback: apply, in order, every queued
+	// write due at or before the given sample of this update; a callback
+	// using queued writes must call this for every sample it generates
+	template <typename T>
+	void apply_queued_writes(int sampindex, T &&apply)
+	{
+		while ((m_write_next < m_write_queue.size()) && (m_write_queue[m_write_next].sample <= sampindex))
+		{
+			queued_write const &write = m_write_queue[m_write_next++];
+			apply(write.offset, write.data);
+		}
+	}
+
+	// called from within the update callback: return the sample of this
+	// update the next queued write is due at, or limit if there's none
+	// before it, so callbacks can generate in runs between writes
+	int next_queued_write(int limit) const
+	{
+		return ((m_write_next < m_write_queue.size()) && (m_write_queue[m_write_next].sample < limit)) ? m_write_queue[m_write_next].sample : limit;
+	}
+
+	// return true if the given input has been silent since at least the given time
+	bool input_silent_since(int inputnum, attotime time) const;
+
 	// apply any pending sample rate changes; should only be called by the sound manager
 	void apply_sample_rate_changes(u32 updatenum, u32 downstream_rate);
 
@@ -627,12 +678,23 @@ private:
 	// perform most of the initialization here
 	void init_common(u32 inputs, u32 outputs, u32 sample_rate, sound_stream_flags flags);
 
+	// generate samples up to the given time without profiling
+	void generate(attotime end, u32 outputnum = 0);
+
+	// return true if the stream can be generated without pulling on any other
+	bool independent() const;
+
 	// if the sample rate has changed, this gets called to update internals
 	void sample_rate_changed();
 
-	// handle updates after a save state load
+	// handle updates around save states
+	void presave();
 	void postload();
 
+	// place queued writes within the update starting at the given time, and drop the ones applied
+	void place_queued_writes(attotime start);
+	void retire_queued_writes();
+
 	// re-print the synchronization timer
 	void reprime_sync_timer();
 
@@ -657,8 +719,25 @@ private:
 	bool m_output_adaptive;                        // adaptive stream that runs at the sample rate of its output
 	bool m_synchronous;                            // synchronous stream that runs at the rate of its input
 	bool m_resampling_disabled;                    // is resampling of input streams disabled?
+	bool m_parallel_update;                        // may be generated on a worker thread
 	emu_timer *m_sync_timer;                       // update timer for synchronous streams
 
+	// silence tracking
+	bool m_idle;                                   // device has declared the outputs silent
+	bool m_update_silent;                          // callback has declared this update silent
+	attotime m_silent_start;                       // start of the current run of silence, or never
+
+	// queued register writes
+	struct queued_write
+	{
+		attotime time;                             // when the write was made
+		int sample;                                // sample of the current update it's due at
+		offs_t offset;                             // register written
+		u32 data;                                  // value written
+	};
+	std::vector<queued_write> m_write_queue;       // writes not yet applied, oldest first
+	unsigned m_write_next;                         // first write the callback hasn't applied this update
+
 	// input information
 	std::vector<sound_stream_input> m_input;       // list of streams we directly depend upon
 	std::vector<stream_sample_t *> m_input_array;  // array of inputs for passing to the callback
@@ -678,6 +757,38 @@ private:
 };
 
 
+// ======================> resampler_filter_bank
+
+// polyphase windowed-sinc FIR coefficients for one input/output rate ratio;
+// banks are owned by the sound_manager and shared by every resampler that
+// converts between the same pair of rates
+class resampler_filter_bank
+{
+public:
+	using sample_t = stream_buffer::sample_t;
+
+	// number of fractional phases; an extra phase is stored at the end so
+	// that coefficients can be interpolated between neighbors
+	static constexpr int PHASES = 256;
+
+	// construction/destruction
+	resampler_filter_bank(u32 input_rate, u32 output_rate);
+
+	// getters
+	int half_taps() const { return m_half_taps; }
+	int taps() const { return 2 * m_half_taps; }
+
+	// return the coefficients for the given phase, in order of increasing
+	// input index, starting half_taps() - 1 samples before the center
+	sample_t const *phase(int index) const { return &m_coefficients[index * taps()]; }
+
+private:
+	// internal state
+	int m_half_taps;                      // taps on each side of the center
+	std::vector<sample_t> m_coefficients; // (PHASES + 1) * taps coefficients
+};
+
+
 // ======================> default_resampler_stream
 
 class default_resampler_stream : public sound_stream
@@ -692,6 +803,9 @@ public:
 private:
 	// internal state
 	u32 m_max_latency;
+	resampler_filter_bank const *m_bank;  // filter bank for the current rates
+	u32 m_bank_input_rate;                // input rate the bank was fetched for
+	u32 m_bank_output_rate;               // output rate the bank was fetched for
 };
 
 
@@ -718,6 +832,14 @@ class sound_manager
 	// stream updates
 	static const attotime STREAMS_UPDATE_ATTOTIME;
 
+	// low-latency mode: most updates per second, and the largest output
+	// rate trim used to hold the host buffer at its target level
+	static constexpr int LOW_LATENCY_MAX_UPDATE_FREQUENCY = 500;
+	static constexpr double LOW_LATENCY_MAX_RATE_ADJUST = 0.005;
+
+	// fractional precision of the final mix stepping
+	static constexpr u32 FINALMIX_PRECISION = 100000;
+
 public:
 	static constexpr int STREAMS_UPDATE_FREQUENCY = 50;
 
@@ -730,11 +852,12 @@ public:
 	int attenuation() const { return m_attenuation; }
 	const std::vector<std::unique_ptr<sound_stream>> &streams() const { return m_stream_list; }
 	attotime last_update() const { return m_last_update; }
+	int update_frequency() const { return m_update_frequency; }
 	int sample_count() const { return m_samples_this_update; }
 	int unique_id() { return m_unique_id++; }
 
 	// allocate a new stream with the old-style callback
-	sound_stream *stream_alloc_legacy(device_t &device, u32 inputs, u32 outputs, u32 sample_rate, stream_update_legacy_delegate callback);
+	sound_stream *stream_alloc_legacy(device_t &device, u32 inputs, u32 outputs, u32 sample_rate, stream_update_legacy_delegate callback, sound_stream_flags flags = STREAM_DEFAULT_FLAGS);
 
 	// allocate a new stream with a new-style callback
 	sound_stream *stream_alloc(device_t &device, u32 inputs, u32 outputs, u32 sample_rate, stream_update_delegate callback, sound_stream_flags flags);
@@ -748,15 +871,24 @@ public:
 	// set the global OSD attenuation level
 	void set_attenuation(float attenuation);
 
+	// worker pool shared by everything that generates sound in parallel
+	osd_work_queue *work_queue();
+
 	// mute sound for one of various independent reasons
 	void ui_mute(bool turn_off = true) { mute(turn_off, MUTE_REASON_UI); }
 	void debugger_mute(bool turn_off = true) { mute(turn_off, MUTE_REASON_DEBUGGER); }
 	void system_mute(bool turn_off = true) { mute(turn_off, MUTE_REASON_SYSTEM); }
 	void system_enable(bool turn_on = true) { mute(!turn_on, MUTE_REASON_SYSTEM); }
 
+	// discard output while frames already heard are emulated again
+	void set_speculative(bool speculative = true) { m_speculative = speculative; }
+
 	// return information about the given mixer input, by index
 	bool indexed_mixer_input(int index, mixer_input &info) const;
 
+	// return the shared resampling filter bank for a pair of rates
+	resampler_filter_bank const &resampler_bank(u32 input_rate, u32 output_rate);
+
 	// fill the given buffer with 16-bit stereo audio samples
 	void samples(s16 *buffer);
 
@@ -787,30 +919,53 @@ private:
 	// periodic sound update, called STREAMS_UPDATE_FREQUENCY per second
 	void update(void *ptr = nullptr, s32 param = 0);
 
+	// write mixed samples to the raw PCM stream
+	void write_pcm(const s16 *samples, int count);
+
+	// generate independent streams in parallel
+	void update_independent_streams(attotime endtime);
+	static void *update_independent_callback(void *param, int threadid);
+
+	// a leaf stream generated on the work queue
+	struct parallel_update
+	{
+		sound_stream *m_stream;           // stream to generate
+		attotime m_end;                   // time to generate up to
+	};
+
 	// internal state
 	running_machine &m_machine;           // reference to the running machine
 	emu_timer *m_update_timer;            // timer that runs the update function
+	int m_update_frequency;               // periodic updates per second
+	attotime m_update_period;             // period of the update timer
 
 	u32 m_update_number;                  // current update index; used for sample rate updates
 	attotime m_last_update;               // time of the last update
 	u32 m_finalmix_leftover;              // leftover samples in the final mix
 	u32 m_samples_this_update;            // number of samples this update
 	std::vector<s16> m_finalmix;          // final mix, in 16-bit signed format
+	std::vector<float> m_finalmix_float;  // final mix, as interleaved float for the OSD if it takes it
 	std::vector<stream_buffer::sample_t> m_leftmix; // left speaker mix, in native format
 	std::vector<stream_buffer::sample_t> m_rightmix; // right speaker mix, in native format
 
 	stream_buffer::sample_t m_compressor_scale; // current compressor scale factor
 	int m_compressor_counter;             // compressor update counter for backoff
+	stream_buffer::sample_t m_compressor_recovery; // compressor scale recovery per update
 
 	u8 m_muted;                           // bitmask of muting reasons
 	bool m_nosound_mode;                  // true if we're in "nosound" mode
+	bool m_speculative;                   // true if output is being discarded
 	int m_attenuation;                    // current attentuation level (at the OSD)
 	int m_unique_id;                      // unique ID used for stream identification
-	wav_file *m_wavfile;                  // WAV file for streaming
+	std::unique_ptr<audio_recorder> m_wavfile; // WAV or FLAC file for streaming
+	std::unique_ptr<emu_file> m_pcmfile;  // raw PCM file, pipe or socket for streaming
 
 	// streams data
 	std::vector<std::unique_ptr<sound_stream>> m_stream_list; // list of streams
 	std::map<sound_stream *, u8> m_orphan_stream_list; // list of orphaned streams
+	std::map<std::pair<u32, u32>, std::unique_ptr<resampler_filter_bank>> m_resampler_banks; // filter banks by reduced rate ratio
+	std::vector<parallel_update> m_parallel_updates; // independent streams for this update
+	osd_work_queue *m_update_queue;                  // shared work queue for parallel generation
 	bool m_first_reset;                   // is this our first reset?
 };
 
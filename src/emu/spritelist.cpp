@@ -0,0 +1,172 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    spritelist.cpp
+
+    Batched sprite rendering.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "spritelist.h"
+
+#include "emuopts.h"
+
+#include "parallel.h"
+
+#include <algorithm>
+
+
+//**************************************************************************
+//  CONSTANTS
+//**************************************************************************
+
+// bands shorter than this are not worth the cost of handing to another thread
+static constexpr int MIN_BAND_HEIGHT = 16;
+
+
+
+//**************************************************************************
+//  SPRITE LIST
+//**************************************************************************
+
+//-------------------------------------------------
+//  gfx_sprite_list - constructor
+//-------------------------------------------------
+
+gfx_sprite_list::gfx_sprite_list(running_machine &machine)
+	: m_machine(machine)
+	, m_bands(machine.options().sprite_bands())
+	, m_work_queue(nullptr)
+{
+#ifdef MAME_PROFILER
+	// the profiler is not safe to enter from several threads at once
+	m_bands = 0;
+#endif
+}
+
+
+//-------------------------------------------------
+//  ~gfx_sprite_list - destructor
+//-------------------------------------------------
+
+gfx_sprite_list::~gfx_sprite_list()
+{
+	if (m_work_queue != nullptr)
+		osd_work_queue_free(m_work_queue);
+}
+
+
+//-------------------------------------------------
+//  draw - draw every sprite in the list
+//-------------------------------------------------
+
+void gfx_sprite_list::draw(bitmap_ind16 &dest, const rectangle &cliprect, bitmap_ind8 *priority)
+{
+	draw_common(dest, cliprect, priority);
+}
+
+void gfx_sprite_list::draw(bitmap_rgb32 &dest, const rectangle &cliprect, bitmap_ind8 *priority)
+{
+	draw_common(dest, cliprect, priority);
+}
+
+
+//-------------------------------------------------
+//  prepare - order the sprites, drop those that
+//  cannot draw anything, and decode the rest so
+//  that no gfx state changes while drawing
+//-------------------------------------------------
+
+void gfx_sprite_list::prepare(const rectangle &cliprect)
+{
+	// sort by order, keeping submission order within each order value
+	std::stable_sort(m_sprites.begin(), m_sprites.end(), [] (sprite const &a, sprite const &b) { return a.m_order < b.m_order; });
+
+	m_visible.clear();
+	for (sprite &spr : m_sprites)
+	{
+		gfx_element &gfx = *spr.m_gfx;
+
+		// compute the covered area the same way the zoom renderers do
+		s32 const width = (spr.m_scalex * gfx.width() + 0x8000) >> 16;
+		s32 const height = (spr.m_scaley * gfx.height() + 0x8000) >> 16;
+		if (width < 1 || height < 1)
+			continue;
+		spr.m_bounds.set(spr.m_x, spr.m_x + width - 1, spr.m_y, spr.m_y + height - 1);
+		spr.m_bounds &= cliprect;
+		if (spr.m_bounds.empty())
+			continue;
+
+		// skip elements that only use the transparent pen
+		spr.m_code %= gfx.elements();
+		if (gfx.has_pen_usage() && spr.m_transpen <= 0xff && (gfx.pen_usage(spr.m_code) & ~(1 << spr.m_transpen)) == 0)
+			continue;
+
+		// make sure the element is decoded here rather than on a worker
+		gfx.get_data(spr.m_code);
+		m_visible.push_back(&spr);
+	}
+}
+
+
+//-------------------------------------------------
+//  draw_common - cull the list, then draw it
+//  either here or in bands on the work queue
+//-------------------------------------------------
+
+template <typename BitmapType>
+void gfx_sprite_list::draw_common(BitmapType &dest, const rectangle &cliprect, bitmap_ind8 *priority)
+{
+	prepare(cliprect);
+	if (m_visible.empty())
+		return;
+
+	// draw small areas serially
+	int const height = cliprect.height();
+	int const bands = std::min(m_bands, height / MIN_BAND_HEIGHT);
+	if (bands < 2 || m_visible.size() < 2)
+	{
+		draw_visible(dest, cliprect, priority);
+		return;
+	}
+
+	// allocate a work queue the first time we need one
+	if (m_work_queue == nullptr)
+		m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+
+	// draw each band of rows clipped to itself; this returns only once all are done
+	util::parallel_for(m_work_queue, cliprect.top(), cliprect.bottom() + 1, (height + bands - 1) / bands,
+			[this, &dest, &cliprect, priority] (s32 first, s32 last)
+			{
+				rectangle band = cliprect;
+				band.sety(first, last - 1);
+				draw_visible(dest, band, priority);
+			});
+}
+
+
+//-------------------------------------------------
+//  draw_visible - draw the culled sprites that
+//  overlap the given cliprect, in order
+//-------------------------------------------------
+
+template <typename BitmapType>
+void gfx_sprite_list::draw_visible(BitmapType &dest, const rectangle &cliprect, bitmap_ind8 *priority)
+{
+	for (sprite const *spr : m_visible)
+	{
+		if (spr->m_bounds.bottom() < cliprect.top() || spr->m_bounds.top() > cliprect.bottom())
+			continue;
+
+		gfx_element &gfx = *spr->m_gfx;
+		if (spr->m_priority)
+		{
+			assert(priority != nullptr);
+			gfx.prio_zoom_transpen(dest, cliprect, spr->m_code, spr->m_color, spr->m_flipx, spr->m_flipy, spr->m_x, spr->m_y, spr->m_scalex, spr->m_scaley, *priority, spr->m_pmask, spr->m_transpen);
+		}
+		else
+			gfx.zoom_transpen(dest, cliprect, spr->m_code, spr->m_color, spr->m_flipx, spr->m_flipy, spr->m_x, spr->m_y, spr->m_scalex, spr->m_scaley, spr->m_transpen);
+	}
+}
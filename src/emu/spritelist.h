@@ -0,0 +1,107 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    spritelist.h
+
+    Batched sprite rendering.
+
+    Instead of calling the gfx_element drawing methods once per sprite
+    while walking sprite RAM, a driver can describe each sprite to a
+    gfx_sprite_list and draw the whole list at once:
+
+        m_sprites.reset();
+        for (each sprite in the buffered RAM, back to front)
+            m_sprites.add(*m_gfxdecode->gfx(0), code, color, flipx, flipy, sx, sy, 15)
+                    .set_zoom(zoomx, zoomy)
+                    .set_pmask(pri_mask)
+                    .set_order(layer);
+        m_sprites.draw(bitmap, cliprect, &screen.priority());
+
+    Sprites are drawn in ascending order, and in submission order within
+    an order value, so the result is identical to the serial loop it
+    replaces.  Sprites that fall outside the cliprect or use only their
+    transparent pen are dropped before drawing.  If the "sprite_bands"
+    option is 2 or more, tall cliprects are split into horizontal bands
+    drawn in parallel; each band draws every sprite overlapping it in
+    the same order, so only its own rows of the destination and priority
+    bitmaps are touched.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_SPRITELIST_H
+#define MAME_EMU_SPRITELIST_H
+
+#pragma once
+
+#include <vector>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> gfx_sprite_list
+
+class gfx_sprite_list
+{
+public:
+	// one sprite to draw
+	struct sprite
+	{
+		// optional parameters
+		sprite &set_zoom(u32 scalex, u32 scaley) { m_scalex = scalex; m_scaley = scaley; return *this; }
+		sprite &set_pmask(u32 pmask) { m_pmask = pmask; m_priority = true; return *this; }
+		sprite &set_order(s32 order) { m_order = order; return *this; }
+
+		gfx_element *   m_gfx;          // graphics to draw from
+		u32             m_code;         // element within the graphics
+		u32             m_color;        // color code
+		bool            m_flipx;        // draw mirrored horizontally
+		bool            m_flipy;        // draw mirrored vertically
+		s32             m_x;            // left edge on the destination
+		s32             m_y;            // top edge on the destination
+		u32             m_scalex;       // horizontal scale as 16.16, 0x10000 for none
+		u32             m_scaley;       // vertical scale as 16.16, 0x10000 for none
+		u32             m_transpen;     // transparent pen, or above 0xff for opaque
+		u32             m_pmask;        // priority mask when m_priority is set
+		bool            m_priority;     // check against the priority bitmap
+		s32             m_order;        // drawing order, lowest first
+		rectangle       m_bounds;       // destination area covered, computed when drawing
+	};
+
+	// construction/destruction
+	gfx_sprite_list(running_machine &machine);
+	~gfx_sprite_list();
+
+	// getters
+	running_machine &machine() const { return m_machine; }
+	size_t count() const { return m_sprites.size(); }
+
+	// building the list
+	void reset() { m_sprites.clear(); }
+	sprite &add(gfx_element &gfx, u32 code, u32 color, int flipx, int flipy, s32 x, s32 y, u32 transpen)
+	{
+		m_sprites.push_back(sprite{ &gfx, code, color, flipx != 0, flipy != 0, x, y, 0x10000, 0x10000, transpen, 0, false, 0, rectangle() });
+		return m_sprites.back();
+	}
+
+	// drawing; a priority bitmap is required if any sprite has a pmask
+	void draw(bitmap_ind16 &dest, const rectangle &cliprect, bitmap_ind8 *priority = nullptr);
+	void draw(bitmap_rgb32 &dest, const rectangle &cliprect, bitmap_ind8 *priority = nullptr);
+
+private:
+	// internal helpers
+	void prepare(const rectangle &cliprect);
+	template <typename BitmapType> void draw_common(BitmapType &dest, const rectangle &cliprect, bitmap_ind8 *priority);
+	template <typename BitmapType> void draw_visible(BitmapType &dest, const rectangle &cliprect, bitmap_ind8 *priority);
+
+	// internal state
+	running_machine &           m_machine;      // reference to our machine
+	std::vector<sprite>         m_sprites;      // sprites submitted since the last reset
+	std::vector<sprite const *> m_visible;      // sprites surviving culling, in drawing order
+	int                         m_bands;        // bands to split draws into, or 0 to draw serially
+	osd_work_queue *            m_work_queue;   // work queue for drawing bands in parallel
+};
+
+#endif // MAME_EMU_SPRITELIST_H
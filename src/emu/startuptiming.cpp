@@ -0,0 +1,92 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    startuptiming.cpp
+
+    Startup timing log.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "startuptiming.h"
+
+#include <rapidjson/writer.h>
+#include <rapidjson/stringbuffer.h>
+
+
+
+//**************************************************************************
+//  STARTUP TIMING LOG
+//**************************************************************************
+
+//-------------------------------------------------
+//  startup_timing_log - constructor
+//-------------------------------------------------
+
+startup_timing_log::startup_timing_log(std::unique_ptr<emu_file> &&file)
+	: m_file(std::move(file))
+	, m_origin(osd_ticks())
+{
+}
+
+
+//-------------------------------------------------
+//  ~startup_timing_log - destructor; writes out
+//  everything recorded as trace events
+//-------------------------------------------------
+
+startup_timing_log::~startup_timing_log()
+{
+	// complete ("X") events on a single thread nest by time, so devices show up under their phase
+	double const micros_per_tick = 1000000.0 / double(osd_ticks_per_second());
+	rapidjson::StringBuffer s;
+	rapidjson::Writer<rapidjson::StringBuffer> writer(s);
+	writer.StartObject();
+	writer.Key("displayTimeUnit");
+	writer.String("ms");
+	writer.Key("traceEvents");
+	writer.StartArray();
+	for (const event &ev : m_events)
+	{
+		writer.StartObject();
+		writer.Key("name");
+		writer.String(ev.name.c_str());
+		writer.Key("cat");
+		writer.String(ev.category);
+		writer.Key("ph");
+		writer.String("X");
+		writer.Key("ts");
+		writer.Double(double(ev.start - m_origin) * micros_per_tick);
+		writer.Key("dur");
+		writer.Double(double(ev.end - ev.start) * micros_per_tick);
+		writer.Key("pid");
+		writer.Int(1);
+		writer.Key("tid");
+		writer.Int(1);
+		if (!ev.tag.empty())
+		{
+			writer.Key("args");
+			writer.StartObject();
+			writer.Key("tag");
+			writer.String(ev.tag.c_str());
+			writer.EndObject();
+		}
+		writer.EndObject();
+	}
+	writer.EndArray();
+	writer.EndObject();
+
+	m_file->puts(s.GetString());
+	m_file->puts("\n");
+}
+
+
+//-------------------------------------------------
+//  add_event - record a completed span
+//-------------------------------------------------
+
+void startup_timing_log::add_event(const char *category, const char *name, const char *tag, osd_ticks_t start, osd_ticks_t end)
+{
+	m_events.push_back(event{ category, name, tag ? tag : "", start, end });
+}
@@ -0,0 +1,79 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    startuptiming.h
+
+    Startup timing log.
+
+    Records how much host time each phase of machine startup takes, and
+    each device's start and reset within it, and writes the result as a
+    Chrome trace-event JSON file (load it in chrome://tracing or
+    Perfetto) once the machine has reached its first frame.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_STARTUPTIMING_H
+#define MAME_EMU_STARTUPTIMING_H
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> startup_timing_log
+
+class startup_timing_log
+{
+public:
+	// times one phase or device from construction to destruction; does nothing given a null log
+	class scope
+	{
+	public:
+		scope(startup_timing_log *log, const char *category, const char *name, const char *tag = nullptr)
+			: m_log(log), m_category(category), m_name(name), m_tag(tag), m_start(log ? osd_ticks() : 0)
+		{
+		}
+		~scope()
+		{
+			if (m_log)
+				m_log->add_event(m_category, m_name, m_tag, m_start, osd_ticks());
+		}
+
+	private:
+		startup_timing_log *    m_log;
+		const char *            m_category;
+		const char *            m_name;
+		const char *            m_tag;
+		osd_ticks_t             m_start;
+	};
+
+	// construction/destruction
+	startup_timing_log(std::unique_ptr<emu_file> &&file);
+	~startup_timing_log();
+
+	// record a completed span
+	void add_event(const char *category, const char *name, const char *tag, osd_ticks_t start, osd_ticks_t end);
+
+private:
+	struct event
+	{
+		const char *    category;           // "phase", "device_start" or "device_reset"
+		std::string     name;               // phase or device name
+		std::string     tag;                // device tag, empty for phases
+		osd_ticks_t     start;              // host time the span started
+		osd_ticks_t     end;                // host time the span ended
+	};
+
+	// internal state
+	std::unique_ptr<emu_file>   m_file;             // file to write
+	osd_ticks_t                 m_origin;           // host time the log was created
+	std::vector<event>          m_events;           // spans recorded so far
+};
+
+#endif // MAME_EMU_STARTUPTIMING_H
@@ -11,8 +11,253 @@
 #include "emu.h"
 #include "tilemap.h"
 
+#include "emuopts.h"
 #include "screen.h"
 
+// use SSE or NEON to decode tiles where it can be assumed
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)) || defined(_M_X64))
+#define TILEMAP_DECODE_SSE (1)
+#include <emmintrin.h>
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+#elif (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__ARM_NEON) || defined(__ARM_NEON__)) && defined(__aarch64__)
+#define TILEMAP_DECODE_NEON (1)
+#include <arm_neon.h>
+#endif
+
+
+//**************************************************************************
+//  CONSTANTS
+//**************************************************************************
+
+// bands shorter than this are not worth the cost of handing to another thread
+static constexpr int MIN_BAND_HEIGHT = 32;
+
+// rotated ROZ rows are sampled this many pixels at a time
+static constexpr int ROZ_CHUNK = 64;
+
+
+
+//**************************************************************************
+//  TILE DECODING
+//**************************************************************************
+
+namespace {
+
+#if defined(TILEMAP_DECODE_SSE) || defined(TILEMAP_DECODE_NEON)
+
+// decodes rows of tiles whose width is a multiple of 8, eight pixels at a
+// time; pens are looked up in the flags table with a byte shuffle when they
+// fit in 4 bits and the host has one, and one at a time otherwise
+class tile_row_decoder
+{
+public:
+	tile_row_decoder(const u8 *penmap, u8 pen_mask, u32 palette_base, u8 category)
+		: m_penmap(penmap)
+		, m_pen_mask(pen_mask)
+		, m_lookup16(pen_mask < 0x10)
+#if defined(TILEMAP_DECODE_SSE)
+		, m_vpenmask(_mm_set1_epi8(s8(pen_mask)))
+		, m_vbase(_mm_set1_epi16(s16(palette_base)))
+		, m_vcategory(_mm_set1_epi8(s8(category)))
+		, m_vmap(_mm_loadu_si128(reinterpret_cast<const __m128i *>(penmap)))
+		, m_vand(_mm_set1_epi8(-1))
+		, m_vor(_mm_setzero_si128())
+#else
+		, m_vpenmask(vdup_n_u8(pen_mask))
+		, m_vbase(vdupq_n_u16(u16(palette_base)))
+		, m_vcategory(vdup_n_u8(category))
+		, m_vmap(vld1q_u8(penmap))
+		, m_vand(vdup_n_u8(0xff))
+		, m_vor(vdup_n_u8(0))
+#endif
+	{
+	}
+
+	// decode one row; pixptr and flagsptr address the leftmost destination
+	// pixel, or the rightmost if flipx is set
+	void row(u16 *pixptr, u8 *flagsptr, const u8 *pendata, int width, bool flipx)
+	{
+		for (int x = 0; x < width; x += 8)
+		{
+#if defined(TILEMAP_DECODE_SSE)
+			__m128i const pens = _mm_and_si128(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(pendata + x)), m_vpenmask);
+			__m128i map;
+#if defined(__SSSE3__)
+			if (m_lookup16)
+				map = _mm_unpacklo_epi64(_mm_shuffle_epi8(m_vmap, pens), _mm_setzero_si128());
+			else
+#endif
+				map = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(lookup(pendata + x)));
+			m_vand = _mm_and_si128(m_vand, map);
+			m_vor = _mm_or_si128(m_vor, map);
+
+			__m128i pix = _mm_add_epi16(_mm_unpacklo_epi8(pens, _mm_setzero_si128()), m_vbase);
+			__m128i flags = _mm_or_si128(map, m_vcategory);
+			if (!flipx)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(pixptr + x), pix);
+				_mm_storel_epi64(reinterpret_cast<__m128i *>(flagsptr + x), flags);
+			}
+			else
+			{
+				pix = reverse16(pix);
+				flags = reverse16(_mm_unpacklo_epi8(flags, _mm_setzero_si128()));
+				flags = _mm_packus_epi16(flags, flags);
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(pixptr - x - 7), pix);
+				_mm_storel_epi64(reinterpret_cast<__m128i *>(flagsptr - x - 7), flags);
+			}
+#else
+			uint8x8_t const pens = vand_u8(vld1_u8(pendata + x), m_vpenmask);
+			uint8x8_t const map = m_lookup16 ? vqtbl1_u8(m_vmap, pens) : vld1_u8(lookup(pendata + x));
+			m_vand = vand_u8(m_vand, map);
+			m_vor = vorr_u8(m_vor, map);
+
+			uint16x8_t pix = vaddq_u16(vmovl_u8(pens), m_vbase);
+			uint8x8_t flags = vorr_u8(map, m_vcategory);
+			if (!flipx)
+			{
+				vst1q_u16(pixptr + x, pix);
+				vst1_u8(flagsptr + x, flags);
+			}
+			else
+			{
+				pix = vrev64q_u16(pix);
+				vst1q_u16(pixptr - x - 7, vcombine_u16(vget_high_u16(pix), vget_low_u16(pix)));
+				vst1_u8(flagsptr - x - 7, vrev64_u8(flags));
+			}
+#endif
+		}
+	}
+
+	// return the bits that vary across the decoded pixels
+	u8 result() const
+	{
+		u8 ands[16], ors[16];
+#if defined(TILEMAP_DECODE_SSE)
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(ands), m_vand);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(ors), m_vor);
+#else
+		vst1_u8(ands, m_vand);
+		vst1_u8(ors, m_vor);
+#endif
+		u8 andmask = ~0, ormask = 0;
+		for (int i = 0; i < 8; i++)
+		{
+			andmask &= ands[i];
+			ormask |= ors[i];
+		}
+		return andmask ^ ormask;
+	}
+
+private:
+	// look up eight pens one at a time
+	const u8 *lookup(const u8 *pendata)
+	{
+		for (int i = 0; i < 8; i++)
+			m_scratch[i] = m_penmap[pendata[i] & m_pen_mask];
+		return m_scratch;
+	}
+
+#if defined(TILEMAP_DECODE_SSE)
+	// reverse the order of eight 16-bit lanes
+	static __m128i reverse16(__m128i value)
+	{
+		value = _mm_shufflelo_epi16(value, 0x1b);
+		value = _mm_shufflehi_epi16(value, 0x1b);
+		return _mm_shuffle_epi32(value, 0x4e);
+	}
+#endif
+
+	const u8 *      m_penmap;
+	u8              m_pen_mask;
+	bool            m_lookup16;
+	u8              m_scratch[8];
+#if defined(TILEMAP_DECODE_SSE)
+	__m128i         m_vpenmask;
+	__m128i         m_vbase;
+	__m128i         m_vcategory;
+	__m128i         m_vmap;
+	__m128i         m_vand;
+	__m128i         m_vor;
+#else
+	uint8x8_t       m_vpenmask;
+	uint16x8_t      m_vbase;
+	uint8x8_t       m_vcategory;
+	uint8x16_t      m_vmap;
+	uint8x8_t       m_vand;
+	uint8x8_t       m_vor;
+#endif
+};
+
+#endif
+
+
+// works out where count consecutive ROZ samples come from in the pixmap,
+// as offsets shared by the pixmap and flagsmap (which have the same
+// layout); without wraparound, samples outside the pixmap get -1.  There
+// is no dependency between samples, so with SSE2 four are done at once
+// whenever the pixmap is small enough for 16-bit multiplies
+template <bool Wrap>
+void roz_offsets(s32 *offsets, int count, u32 cx, u32 cy, int incxx, int incxy, int xmask, int ymask, u32 widthshifted, u32 heightshifted, int stride)
+{
+	int i = 0;
+
+#if defined(TILEMAP_DECODE_SSE)
+	if (stride < 0x8000 && (widthshifted >> 16) < 0x8000 && (heightshifted >> 16) < 0x8000)
+	{
+		__m128i const bias = _mm_set1_epi32(s32(0x80000000));
+		__m128i const vmaxx = _mm_xor_si128(_mm_set1_epi32(s32(widthshifted)), bias);
+		__m128i const vmaxy = _mm_xor_si128(_mm_set1_epi32(s32(heightshifted)), bias);
+		__m128i const vxmask = _mm_set1_epi32(xmask);
+		__m128i const vymask = _mm_set1_epi32(ymask);
+		__m128i const vstride = _mm_set1_epi32(stride | (1 << 16));
+		__m128i const stepx = _mm_set1_epi32(4 * incxx);
+		__m128i const stepy = _mm_set1_epi32(4 * incxy);
+		__m128i vx = _mm_add_epi32(_mm_set1_epi32(s32(cx)), _mm_set_epi32(3 * incxx, 2 * incxx, incxx, 0));
+		__m128i vy = _mm_add_epi32(_mm_set1_epi32(s32(cy)), _mm_set_epi32(3 * incxy, 2 * incxy, incxy, 0));
+
+		for ( ; i + 4 <= count; i += 4)
+		{
+			__m128i px = _mm_srli_epi32(vx, 16);
+			__m128i py = _mm_srli_epi32(vy, 16);
+			if (Wrap)
+			{
+				px = _mm_and_si128(px, vxmask);
+				py = _mm_and_si128(py, vymask);
+			}
+
+			// py * stride + px in one multiply-add, with py in the low half of each lane and px in the high half
+			__m128i offs = _mm_madd_epi16(_mm_or_si128(py, _mm_slli_epi32(px, 16)), vstride);
+			if (!Wrap)
+			{
+				__m128i const inside = _mm_and_si128(
+						_mm_cmplt_epi32(_mm_xor_si128(vx, bias), vmaxx),
+						_mm_cmplt_epi32(_mm_xor_si128(vy, bias), vmaxy));
+				offs = _mm_or_si128(_mm_and_si128(offs, inside), _mm_xor_si128(inside, _mm_set1_epi32(-1)));
+			}
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(offsets + i), offs);
+
+			vx = _mm_add_epi32(vx, stepx);
+			vy = _mm_add_epi32(vy, stepy);
+		}
+	}
+#endif
+
+	for ( ; i < count; i++)
+	{
+		u32 const x = cx + u32(i) * incxx;
+		u32 const y = cy + u32(i) * incxy;
+		if (Wrap)
+			offsets[i] = ((y >> 16) & ymask) * stride + ((x >> 16) & xmask);
+		else
+			offsets[i] = (x < widthshifted && y < heightshifted) ? ((y >> 16) * stride + (x >> 16)) : -1;
+	}
+}
+
+} // anonymous namespace
+
 
 //**************************************************************************
 //  INLINE FUNCTIONS
@@ -380,6 +625,7 @@ void tilemap_t::init_common(
 	m_attributes = 0;
 	m_all_tiles_dirty = true;
 	m_all_tiles_clean = false;
+	m_dirty_list_valid = false;
 	m_palette_offset = 0;
 	m_gfx_used = 0;
 	memset(m_gfx_dirtyseq, 0, sizeof(m_gfx_dirtyseq));
@@ -505,6 +751,18 @@ void tilemap_t::mark_tile_dirty(tilemap_memory_index memindex)
 		logical_index logindex = m_memory_to_logical[memindex];
 		if (logindex != INVALID_LOGICAL_INDEX)
 		{
+			// remember newly dirtied tiles so pixmap_update need not scan them all;
+			// tiles cleaned by drawing may be listed more than once, so cap the list
+			if (m_dirty_list_valid && m_tileflags[logindex] != TILE_FLAG_DIRTY)
+			{
+				if (m_dirty_list.size() < m_tileflags.size())
+					m_dirty_list.push_back(logindex);
+				else
+				{
+					m_dirty_list.clear();
+					m_dirty_list_valid = false;
+				}
+			}
 			m_tileflags[logindex] = TILE_FLAG_DIRTY;
 			m_all_tiles_clean = false;
 		}
@@ -755,6 +1013,8 @@ inline void tilemap_t::realize_all_dirty_tiles()
 		memset(&m_tileflags[0], TILE_FLAG_DIRTY, m_tileflags.size());
 		m_all_tiles_dirty = false;
 		m_gfx_used = 0;
+		m_dirty_list.clear();
+		m_dirty_list_valid = false;
 	}
 }
 
@@ -777,14 +1037,27 @@ g_profiler.start(PROFILER_TILEMAP_DRAW);
 	// flush the dirty state to all tiles as appropriate
 	realize_all_dirty_tiles();
 
-	// iterate over rows and columns
-	logical_index logindex = 0;
-	for (u32 row = 0; row < m_rows; row++)
-		for (u32 col = 0; col < m_cols; col++, logindex++)
+	// if every dirty tile is listed, update just those
+	if (m_dirty_list_valid)
+	{
+		for (logical_index logindex : m_dirty_list)
 			if (m_tileflags[logindex] == TILE_FLAG_DIRTY)
-				tile_update(logindex, col, row);
+				tile_update(logindex, logindex % m_cols, logindex / m_cols);
+	}
 
-	// mark it all clean
+	// otherwise iterate over rows and columns
+	else
+	{
+		logical_index logindex = 0;
+		for (u32 row = 0; row < m_rows; row++)
+			for (u32 col = 0; col < m_cols; col++, logindex++)
+				if (m_tileflags[logindex] == TILE_FLAG_DIRTY)
+					tile_update(logindex, col, row);
+	}
+
+	// mark it all clean, and start listing dirty tiles afresh
+	m_dirty_list.clear();
+	m_dirty_list_valid = true;
 	m_all_tiles_clean = true;
 
 g_profiler.stop();
@@ -855,8 +1128,20 @@ u8 tilemap_t::tile_draw(const u8 *pendata, u32 x0, u32 y0, u32 palette_base, u8
 		dx0 = -1;
 	}
 
-	// iterate over rows
 	const u8 *penmap = m_pen_to_flags + group * MAX_PEN_TO_FLAGS;
+
+#if defined(TILEMAP_DECODE_SSE) || defined(TILEMAP_DECODE_NEON)
+	// decode eight pixels at a time when whole groups fit in a row
+	if ((m_tilewidth & 7) == 0)
+	{
+		tile_row_decoder decoder(penmap, pen_mask, palette_base, category);
+		for (u16 ty = 0; ty < m_tileheight; ty++, y0 += dy0, pendata += m_tilewidth)
+			decoder.row(&m_pixmap.pix16(y0, x0), &m_flagsmap.pix8(y0, x0), pendata, m_tilewidth, dx0 < 0);
+		return decoder.result();
+	}
+#endif
+
+	// iterate over rows
 	u8 andmask = ~0, ormask = 0;
 	for (u16 ty = 0; ty < m_tileheight; ty++)
 	{
@@ -1012,6 +1297,59 @@ g_profiler.start(PROFILER_TILEMAP_DRAW);
 	u32 const xextent = visarea.right() + visarea.left() + 1; // x0 + x1 + 1 for calculating horizontal centre as (x0 + x1 + 1) >> 1
 	u32 const yextent = visarea.bottom() + visarea.top() + 1; // y0 + y1 + 1 for calculating vertical centre as (y0 + y1 + 1) >> 1
 
+	// split tall regions into bands if enabled; each band only touches its own rows of
+	// the destination and priority bitmaps, so they can be drawn concurrently
+	int const height = blit.cliprect.height();
+	int const bands = std::min(m_manager->draw_bands(), height / MIN_BAND_HEIGHT);
+	if (bands < 2)
+	{
+		draw_scrolled(screen, dest, blit, xextent, yextent);
+g_profiler.stop();
+		return;
+	}
+
+	// draw_instance updates dirty tiles lazily, which must not happen on a worker thread
+	pixmap_update();
+
+	// divide the cliprect evenly, giving any remainder to the leading bands
+	std::vector<draw_band<_BitmapClass> > work(bands);
+	int top = blit.cliprect.top();
+	for (int band = 0; band < bands; band++)
+	{
+		int const rows = height / bands + ((band < height % bands) ? 1 : 0);
+		draw_band<_BitmapClass> &item = work[band];
+		item.tilemap = this;
+		item.screen = &screen;
+		item.dest = &dest;
+		item.blit = blit;
+		item.blit.cliprect.sety(top, top + rows - 1);
+		item.xextent = xextent;
+		item.yextent = yextent;
+		top += rows;
+	}
+
+	// hand all but the first to the work queue and draw that one here
+	osd_work_queue *const queue = m_manager->draw_queue();
+	osd_work_item_queue_multiple(queue, draw_band_callback<_BitmapClass>, bands - 1, &work[1], sizeof(work[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	draw_scrolled(screen, dest, work[0].blit, xextent, yextent);
+
+	// join before the caller draws anything else over the result
+	while (!osd_work_queue_wait(queue, osd_ticks_per_second()))
+	{
+	}
+g_profiler.stop();
+}
+
+
+//-------------------------------------------------
+//  draw_scrolled - draw every visible instance of
+//  the tilemap within blit.cliprect, applying
+//  row or column scroll
+//-------------------------------------------------
+
+template<class _BitmapClass>
+void tilemap_t::draw_scrolled(screen_device &screen, _BitmapClass &dest, blit_parameters blit, u32 xextent, u32 yextent)
+{
 	// XY scrolling playfield
 	if (m_scrollrows == 1 && m_scrollcols == 1)
 	{
@@ -1095,9 +1433,23 @@ g_profiler.start(PROFILER_TILEMAP_DRAW);
 			}
 		}
 	}
-g_profiler.stop();
 }
 
+
+//-------------------------------------------------
+//  draw_band_callback - work queue callback for
+//  drawing one horizontal band
+//-------------------------------------------------
+
+template<class _BitmapClass>
+void *tilemap_t::draw_band_callback(void *param, int threadid)
+{
+	draw_band<_BitmapClass> &band = *reinterpret_cast<draw_band<_BitmapClass> *>(param);
+	band.tilemap->draw_scrolled(*band.screen, *band.dest, band.blit, band.xextent, band.yextent);
+	return nullptr;
+}
+
+
 void tilemap_t::draw(screen_device &screen, bitmap_ind16 &dest, const rectangle &cliprect, u32 flags, u8 priority, u8 priority_mask)
 { draw_common(screen, dest, cliprect, flags, priority, priority_mask); }
 
@@ -1370,6 +1722,14 @@ void tilemap_t::draw_roz_core(screen_device &screen, _BitmapClass &destbitmap, c
 	int ex = blit.cliprect.right();
 	int ey = blit.cliprect.bottom();
 
+	// the rotated loops sample anywhere in the pixmap, so keep its layout in locals
+	// rather than reloading it through the tilemap after every destination write
+	const u16 *const pixbase = &m_pixmap.pix16(0);
+	const u8 *const flagsbase = &m_flagsmap.pix8(0);
+	const int pixstride = m_pixmap.rowpixels();
+	s32 offsets[ROZ_CHUNK];
+	assert(m_flagsmap.rowpixels() == pixstride);
+
 	// optimized loop for the not rotated case
 	if (incxy == 0 && incyx == 0 && !wraparound)
 	{
@@ -1442,24 +1802,31 @@ void tilemap_t::draw_roz_core(screen_device &screen, _BitmapClass &destbitmap, c
 			typename _BitmapClass::pixel_t *dest = &destbitmap.pix(sy, sx);
 			u8 *pri = (priority != 0xff00) ? &priority_bitmap.pix8(sy, sx) : nullptr;
 
-			// loop over columns
+			// loop over columns a chunk at a time
 			while (x <= ex)
 			{
-				// plot if we match the mask
-				if ((m_flagsmap.pix8((cy >> 16) & ymask, (cx >> 16) & xmask) & mask) == value)
+				int const count = std::min(ex + 1 - x, ROZ_CHUNK);
+				roz_offsets<true>(offsets, count, cx, cy, incxx, incxy, xmask, ymask, widthshifted, heightshifted, pixstride);
+
+				for (int i = 0; i < count; i++)
 				{
-					ROZ_PLOT_PIXEL(m_pixmap.pix16((cy >> 16) & ymask, (cx >> 16) & xmask));
+					// plot if we match the mask
+					if ((flagsbase[offsets[i]] & mask) == value)
+					{
+						ROZ_PLOT_PIXEL(pixbase[offsets[i]]);
+						if (priority != 0xff00)
+							*pri = (*pri & (priority >> 8)) | priority;
+					}
+
+					++dest;
 					if (priority != 0xff00)
-						*pri = (*pri & (priority >> 8)) | priority;
+						pri++;
 				}
 
 				// advance in X
-				cx += incxx;
-				cy += incxy;
-				x++;
-				++dest;
-				if (priority != 0xff00)
-					pri++;
+				cx += u32(count) * incxx;
+				cy += u32(count) * incxy;
+				x += count;
 			}
 
 			// advance in Y
@@ -1484,25 +1851,31 @@ void tilemap_t::draw_roz_core(screen_device &screen, _BitmapClass &destbitmap, c
 			typename _BitmapClass::pixel_t *dest = &destbitmap.pix(sy, sx);
 			u8 *pri = (priority != 0xff00) ? &priority_bitmap.pix8(sy, sx) : nullptr;
 
-			// loop over columns
+			// loop over columns a chunk at a time
 			while (x <= ex)
 			{
-				// plot if we're within the bitmap and we match the mask
-				if (cx < widthshifted && cy < heightshifted)
-					if ((m_flagsmap.pix8(cy >> 16, cx >> 16) & mask) == value)
+				int const count = std::min(ex + 1 - x, ROZ_CHUNK);
+				roz_offsets<false>(offsets, count, cx, cy, incxx, incxy, xmask, ymask, widthshifted, heightshifted, pixstride);
+
+				for (int i = 0; i < count; i++)
+				{
+					// plot if we're within the bitmap and we match the mask
+					if (offsets[i] >= 0 && (flagsbase[offsets[i]] & mask) == value)
 					{
-						ROZ_PLOT_PIXEL(m_pixmap.pix16(cy >> 16, cx >> 16));
+						ROZ_PLOT_PIXEL(pixbase[offsets[i]]);
 						if (priority != 0xff00)
 							*pri = (*pri & (priority >> 8)) | priority;
 					}
 
+					++dest;
+					if (priority != 0xff00)
+						pri++;
+				}
+
 				// advance in X
-				cx += incxx;
-				cy += incxy;
-				x++;
-				++dest;
-				if (priority != 0xff00)
-					pri++;
+				cx += u32(count) * incxx;
+				cy += u32(count) * incxy;
+				x += count;
 			}
 
 			// advance in Y
@@ -1576,7 +1949,9 @@ void tilemap_t::get_info_debug(u32 col, u32 row, u8 &gfxnum, u32 &code, u32 &col
 
 tilemap_manager::tilemap_manager(running_machine &machine)
 	: m_machine(machine),
-		m_instance(0)
+		m_instance(0),
+		m_draw_bands(machine.options().tilemap_bands()),
+		m_draw_queue(nullptr)
 {
 }
 
@@ -1600,6 +1975,22 @@ tilemap_manager::~tilemap_manager()
 				break;
 			}
 	}
+
+	if (m_draw_queue != nullptr)
+		osd_work_queue_free(m_draw_queue);
+}
+
+
+//-------------------------------------------------
+//  draw_queue - return the work queue used for
+//  drawing bands, allocating it on first use
+//-------------------------------------------------
+
+osd_work_queue *tilemap_manager::draw_queue()
+{
+	if (m_draw_queue == nullptr)
+		m_draw_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	return m_draw_queue;
 }
 
 
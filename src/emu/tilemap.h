@@ -527,6 +527,17 @@ private:
 		u8                  alpha;
 	};
 
+	// one horizontal band of a parallel draw
+	template<class _BitmapClass> struct draw_band
+	{
+		tilemap_t *         tilemap;
+		screen_device *     screen;
+		_BitmapClass *      dest;
+		blit_parameters     blit;
+		u32                 xextent;
+		u32                 yextent;
+	};
+
 	// inline helpers
 	s32 effective_rowscroll(int index, u32 screen_width);
 	s32 effective_colscroll(int index, u32 screen_height);
@@ -555,6 +566,8 @@ private:
 	u8 tile_apply_bitmask(const u8 *maskdata, u32 x0, u32 y0, u8 category, u8 flags);
 	void configure_blit_parameters(blit_parameters &blit, bitmap_ind8 &priority_bitmap, const rectangle &cliprect, u32 flags, u8 priority, u8 priority_mask);
 	template<class _BitmapClass> void draw_common(screen_device &screen, _BitmapClass &dest, const rectangle &cliprect, u32 flags, u8 priority, u8 priority_mask);
+	template<class _BitmapClass> void draw_scrolled(screen_device &screen, _BitmapClass &dest, blit_parameters blit, u32 xextent, u32 yextent);
+	template<class _BitmapClass> static void *draw_band_callback(void *param, int threadid);
 	template<class _BitmapClass> void draw_roz_common(screen_device &screen, _BitmapClass &dest, const rectangle &cliprect, u32 startx, u32 starty, int incxx, int incxy, int incyx, int incyy, bool wraparound, u32 flags, u8 priority, u8 priority_mask);
 	template<class _BitmapClass> void draw_instance(screen_device &screen, _BitmapClass &dest, const blit_parameters &blit, int xpos, int ypos);
 	template<class _BitmapClass> void draw_roz_core(screen_device &screen, _BitmapClass &destbitmap, const blit_parameters &blit, u32 startx, u32 starty, int incxx, int incxy, int incyx, int incyy, bool wraparound);
@@ -608,6 +621,8 @@ private:
 	// transparency mapping
 	bitmap_ind8                 m_flagsmap;             // per-pixel flags
 	std::vector<u8>             m_tileflags;            // per-tile flags
+	std::vector<logical_index>  m_dirty_list;           // tiles dirtied since the last pixmap update
+	bool                        m_dirty_list_valid;     // true if every dirty tile is in the list
 	u8                          m_pen_to_flags[MAX_PEN_TO_FLAGS * TILEMAP_NUM_GROUPS]; // mapping of pens to flags
 };
 
@@ -643,6 +658,10 @@ public:
 	void mark_all_dirty();
 	void set_flip_all(u32 attributes);
 
+	// parallel drawing
+	int draw_bands() const { return m_draw_bands; }
+	osd_work_queue *draw_queue();
+
 private:
 	// tilemap creation
 	tilemap_t &create(device_gfx_interface &decoder, tilemap_get_info_delegate tile_get_info, tilemap_mapper_delegate mapper, u16 tilewidth, u16 tileheight, u32 cols, u32 rows, tilemap_t *allocated);
@@ -655,6 +674,8 @@ private:
 	running_machine &       m_machine;
 	simple_list<tilemap_t>  m_tilemap_list;
 	int                     m_instance;
+	int                     m_draw_bands;       // horizontal bands to split draws into, or 0 to draw serially
+	osd_work_queue *        m_draw_queue;       // work queue for drawing bands in parallel
 };
 
 
@@ -15,15 +15,30 @@
 #include "romload.h"
 #include "video/rgbutil.h"
 
+#include <algorithm>
 #include <cctype>
+#include <future>
+#include <queue>
 #include <type_traits>
 #include <typeinfo>
 
 
+// drivers checked by each worker when validating in parallel
+#define DRIVERS_PER_CHUNK   32
+
+
 //**************************************************************************
 //  TYPE DEFINITIONS
 //**************************************************************************
 
+namespace {
+
+// worker checker running on this thread, which receives messages sent to
+// the checker on the output stack
+thread_local validity_checker *s_worker_checker = nullptr;
+
+} // anonymous namespace
+
 //**************************************************************************
 //  INLINE FUNCTIONS
 //**************************************************************************
@@ -138,6 +153,8 @@ validity_checker::validity_checker(emu_options &options, bool quick)
 	, m_current_ioport(nullptr)
 	, m_checking_card(false)
 	, m_quick(quick)
+	, m_parent(nullptr)
+	, m_threads(1)
 {
 	// pre-populate the defstr map with all the default strings
 	for (int strnum = 1; strnum < INPUT_STRING_COUNT; strnum++)
@@ -148,13 +165,31 @@ validity_checker::validity_checker(emu_options &options, bool quick)
 	}
 }
 
+validity_checker::validity_checker(validity_checker &parent)
+	: m_drivlist(parent.m_drivlist.options())
+	, m_errors(0)
+	, m_warnings(0)
+	, m_print_verbose(parent.m_print_verbose)
+	, m_defstr_map(parent.m_defstr_map)
+	, m_current_driver(nullptr)
+	, m_current_device(nullptr)
+	, m_current_ioport(nullptr)
+	, m_checking_card(false)
+	, m_quick(parent.m_quick)
+	, m_parent(&parent)
+	, m_threads(1)
+{
+}
+
 //-------------------------------------------------
 //  validity_checker - destructor
 //-------------------------------------------------
 
 validity_checker::~validity_checker()
 {
-	validate_end();
+	// workers are never on the output stack
+	if (!m_parent)
+		validate_end();
 }
 
 //-------------------------------------------------
@@ -218,15 +253,22 @@ bool validity_checker::check_all_matching(const char *string)
 	}
 
 	// then iterate over all drivers and check them
+	std::vector<game_driver const *> drivers;
 	m_drivlist.reset();
-	bool validated_any = false;
 	while (m_drivlist.next())
 	{
 		if (driver_list::matches(string, m_drivlist.driver().name))
-		{
-			validate_one(m_drivlist.driver());
-			validated_any = true;
-		}
+			drivers.emplace_back(&m_drivlist.driver());
+	}
+	bool const validated_any = !drivers.empty();
+	if ((1U < m_threads) && (DRIVERS_PER_CHUNK < drivers.size()))
+	{
+		validate_parallel(drivers);
+	}
+	else
+	{
+		for (game_driver const *driver : drivers)
+			validate_one(*driver);
 	}
 
 	// validate devices
@@ -346,6 +388,62 @@ void validity_checker::validate_one(const game_driver &driver)
 }
 
 
+//-------------------------------------------------
+//  validate_parallel - check chunks of drivers
+//  on worker threads, each with its own checker,
+//  and emit their reports in driver order
+//-------------------------------------------------
+
+void validity_checker::validate_parallel(std::vector<game_driver const *> const &drivers)
+{
+	struct chunk_result
+	{
+		std::string report;
+		int errors;
+		int warnings;
+	};
+
+	// duplicate names and descriptions are reported against the later
+	// driver, so record the first of each before any worker starts
+	for (game_driver const *driver : drivers)
+	{
+		m_names_map.emplace(driver->name, driver);
+		m_descriptions_map.emplace(driver->type.fullname(), driver);
+	}
+
+	// keep a couple of chunks per thread in flight
+	std::size_t const max_queued = m_threads * 2;
+	std::queue<std::future<chunk_result> > queue;
+	auto next = drivers.begin();
+	while (!queue.empty() || (drivers.end() != next))
+	{
+		while ((queue.size() < max_queued) && (drivers.end() != next))
+		{
+			auto const end = next + std::min<std::ptrdiff_t>(DRIVERS_PER_CHUNK, drivers.end() - next);
+			queue.push(std::async(std::launch::async, [this, begin = next, end] ()
+			{
+				// state like already-checked software lists is per chunk,
+				// so the report doesn't depend on the thread count
+				validity_checker worker(*this);
+				s_worker_checker = &worker;
+				for (auto it = begin; end != it; ++it)
+					worker.validate_one(**it);
+				s_worker_checker = nullptr;
+				return chunk_result{ std::move(worker.m_report), worker.m_errors, worker.m_warnings };
+			}));
+			next = end;
+		}
+
+		chunk_result const result = queue.front().get();
+		queue.pop();
+		m_errors += result.errors;
+		m_warnings += result.warnings;
+		if (!result.report.empty())
+			output_via_delegate(OSD_OUTPUT_CHANNEL_ERROR, "%s", result.report);
+	}
+}
+
+
 //-------------------------------------------------
 //  validate_core - validate core internal systems
 //-------------------------------------------------
@@ -1458,17 +1556,23 @@ void validity_checker::validate_rgb()
 
 void validity_checker::validate_driver(device_t &root)
 {
-	// check for duplicate names
-	if (!m_names_map.insert(std::make_pair(m_current_driver->name, m_current_driver)).second)
+	// check for duplicate names (workers use the parent's complete maps)
+	game_driver_map::const_iterator const dupname(m_parent
+			? m_parent->m_names_map.find(m_current_driver->name)
+			: m_names_map.emplace(m_current_driver->name, m_current_driver).first);
+	if (dupname->second != m_current_driver)
 	{
-		const game_driver *match = m_names_map.find(m_current_driver->name)->second;
+		const game_driver *match = dupname->second;
 		osd_printf_error("Driver name is a duplicate of %s(%s)\n", core_filename_extract_base(match->type.source()), match->name);
 	}
 
 	// check for duplicate descriptions
-	if (!m_descriptions_map.insert(std::make_pair(m_current_driver->type.fullname(), m_current_driver)).second)
+	game_driver_map::const_iterator const dupdesc(m_parent
+			? m_parent->m_descriptions_map.find(m_current_driver->type.fullname())
+			: m_descriptions_map.emplace(m_current_driver->type.fullname(), m_current_driver).first);
+	if (dupdesc->second != m_current_driver)
 	{
-		const game_driver *match = m_descriptions_map.find(m_current_driver->type.fullname())->second;
+		const game_driver *match = dupdesc->second;
 		osd_printf_error("Driver description is a duplicate of %s(%s)\n", core_filename_extract_base(match->type.source()), match->name);
 	}
 
@@ -2258,6 +2362,14 @@ void validity_checker::build_output_prefix(std::ostream &str) const
 
 void validity_checker::output_callback(osd_output_channel channel, const util::format_argument_pack<std::ostream> &args)
 {
+	// messages from a worker thread belong to that worker
+	validity_checker *const worker(s_worker_checker);
+	if (worker && (worker != this))
+	{
+		worker->output_callback(channel, args);
+		return;
+	}
+
 	std::ostringstream output;
 	switch (channel)
 	{
@@ -2298,7 +2410,16 @@ void validity_checker::output_callback(osd_output_channel channel, const util::f
 		break;
 
 	default:
-		chain_output(channel, args);
+		if (m_parent)
+		{
+			std::lock_guard<std::mutex> guard(m_parent->m_output_mutex);
+			m_parent->chain_output(channel, args);
+		}
+		else
+		{
+			std::lock_guard<std::mutex> guard(m_output_mutex);
+			chain_output(channel, args);
+		}
 		break;
 	}
 }
@@ -2312,8 +2433,17 @@ void validity_checker::output_callback(osd_output_channel channel, const util::f
 template <typename Format, typename... Params>
 void validity_checker::output_via_delegate(osd_output_channel channel, Format &&fmt, Params &&...args)
 {
-	// call through to the delegate with the proper parameters
-	chain_output(channel, util::make_format_argument_pack(std::forward<Format>(fmt), std::forward<Params>(args)...));
+	if (m_parent)
+	{
+		// workers collect their reports for the parent to emit in order
+		m_report.append(util::string_format(std::forward<Format>(fmt), std::forward<Params>(args)...));
+	}
+	else
+	{
+		// call through to the delegate with the proper parameters
+		std::lock_guard<std::mutex> guard(m_output_mutex);
+		chain_output(channel, util::make_format_argument_pack(std::forward<Format>(fmt), std::forward<Params>(args)...));
+	}
 }
 
 //-------------------------------------------------
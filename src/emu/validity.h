@@ -16,6 +16,8 @@
 #include "drivenum.h"
 #include "emuopts.h"
 
+#include <mutex>
+
 
 //**************************************************************************
 //  TYPE DEFINITIONS
@@ -33,8 +35,9 @@ public:
 	int warnings() const { return m_warnings; }
 	bool quick() const { return m_quick; }
 
-	// setter
+	// setters
 	void set_verbose(bool verbose) { m_print_verbose = verbose; }
+	void set_threads(unsigned threads) { m_threads = threads; }
 
 	// operations
 	void check_driver(const game_driver &driver);
@@ -59,6 +62,9 @@ private:
 	using int_map = std::unordered_map<std::string, uintptr_t>;
 	using string_set = std::unordered_set<std::string>;
 
+	// worker checker for a chunk of drivers
+	validity_checker(validity_checker &parent);
+
 	// internal helpers
 	const char *ioport_string_from_index(u32 index);
 	int get_defstr_index(const char *string, bool suppress_error = false);
@@ -67,6 +73,7 @@ private:
 	void validate_begin();
 	void validate_end();
 	void validate_one(const game_driver &driver);
+	void validate_parallel(std::vector<game_driver const *> const &drivers);
 
 	// internal sub-checks
 	void validate_core();
@@ -121,6 +128,12 @@ private:
 	string_set              m_already_checked;
 	bool                    m_checking_card;
 	bool const              m_quick;
+
+	// parallel validation
+	validity_checker *const m_parent;               // checker that started this worker, if any
+	unsigned                m_threads;              // worker threads to use for multiple drivers
+	std::mutex              m_output_mutex;         // serialises output from workers
+	std::string             m_report;               // worker output, emitted by the parent in driver order
 };
 
 #endif // MAME_EMU_VALIDITY_H
@@ -15,6 +15,7 @@
 #include "crsshair.h"
 #include "rendersw.hxx"
 #include "output.h"
+#include "frametiming.h"
 
 #include "png.h"
 #include "xmlfile.h"
@@ -87,10 +88,17 @@ video_manager::video_manager(running_machine &machine)
 	, m_throttled(machine.options().throttle())
 	, m_throttle_rate(1.0f)
 	, m_fastforward(false)
+	, m_speculative(false)
 	, m_seconds_to_run(machine.options().seconds_to_run())
 	, m_auto_frameskip(machine.options().auto_frameskip())
 	, m_speed(original_speed_setting())
-	, m_low_latency(machine.options().low_latency())
+	, m_low_latency(machine.options().low_latency() && !machine.options().vrr())
+	, m_vrr(machine.options().vrr())
+	, m_frame_pacing(machine.options().frame_pacing() && !machine.options().vrr())
+	, m_pacing_active(false)
+	, m_pacing_resume_ticks(0)
+	, m_pacing_work_ticks(0)
+	, m_pacing_work_deviation(0)
 	, m_empty_skip_count(0)
 	, m_frameskip_max(m_auto_frameskip ? machine.options().frameskip() : 0)
 	, m_frameskip_level(m_auto_frameskip ? 0 : machine.options().frameskip())
@@ -102,6 +110,10 @@ video_manager::video_manager(running_machine &machine)
 	, m_snap_native(true)
 	, m_snap_width(0)
 	, m_snap_height(0)
+	, m_snap_bands(machine.options().render_bands())
+	, m_snap_queue(nullptr)
+	, m_snap_write_queue(nullptr)
+	, m_snap_fast(machine.options().snap_fast())
 	, m_timecode_enabled(false)
 	, m_timecode_write(false)
 	, m_timecode_text("")
@@ -209,7 +221,18 @@ void video_manager::set_frameskip(int frameskip)
 
 void video_manager::frame_update(bool from_debugger)
 {
+	// frames emulated speculatively (netplay rollback, the real frames behind
+	// run-ahead) are never shown or throttled, but still drive the per-frame
+	// callbacks; while paused, updates are always shown
+	if (m_speculative && !from_debugger && !machine().paused())
+	{
+		machine().call_notifiers(MACHINE_NOTIFY_FRAME);
+		return;
+	}
+
 	// only render sound and video if we're in the running phase
+	frame_timing_log *const timing = machine().frame_timing();
+	osd_ticks_t const start_ticks = timing ? osd_ticks() : 0;
 	machine_phase const phase = machine().phase();
 	bool skipped_it = m_skipping_this_frame;
 	if (phase == machine_phase::RUNNING && (!machine().paused() || machine().options().update_in_pause()))
@@ -227,19 +250,33 @@ void video_manager::frame_update(bool from_debugger)
 
 	// draw the user interface
 	emulator_info::draw_user_interface(machine());
+	if (timing)
+		timing->add_video_ticks(osd_ticks() - start_ticks);
 
-	// if we're throttling, synchronize before rendering
+	// when pacing to the display, presenting with vsync does the throttling
 	attotime current_time = machine().time();
-	if (!from_debugger && !skipped_it && phase > machine_phase::INIT && !m_low_latency && effective_throttle())
+	bool const throttle = !from_debugger && !skipped_it && phase > machine_phase::INIT && effective_throttle();
+	osd_ticks_t last_present, period;
+	bool const pacing = throttle && m_frame_pacing && !machine().paused() && frame_pacing_possible(last_present, period);
+	if (!pacing)
+		m_pacing_active = false;
+
+	// if we're throttling, synchronize before rendering
+	if (throttle && !pacing && !m_low_latency)
 		update_throttle(current_time);
 
 	// ask the OSD to update
 	g_profiler.start(PROFILER_BLIT);
+	osd_ticks_t const blit_ticks = (timing || pacing) ? osd_ticks() : 0;
 	machine().osd().update(!from_debugger && skipped_it);
+	if (timing)
+		timing->add_video_ticks(osd_ticks() - blit_ticks);
 	g_profiler.stop();
 
 	// we synchronize after rendering instead of before, if low latency mode is enabled
-	if (!from_debugger && !skipped_it && phase > machine_phase::INIT && m_low_latency && effective_throttle())
+	if (pacing)
+		pace_frame(blit_ticks);
+	else if (throttle && m_low_latency)
 		update_throttle(current_time);
 
 	// get most recent input now
@@ -313,6 +350,17 @@ std::string video_manager::speed_text()
 }
 
 
+// a snapshot waiting to be encoded and written
+struct video_manager::snapshot_job
+{
+	std::unique_ptr<emu_file>   file;           // file to write, already open
+	bitmap_rgb32                bitmap;         // copy of the snapshot bitmap
+	std::vector<rgb_t>          palette;        // copy of the adjusted palette
+	png_info                    pnginfo;        // text entries
+	png_encode                  encode;         // speed/size trade-off
+};
+
+
 //-------------------------------------------------
 //  save_snapshot - save a snapshot to the given
 //  file handle
@@ -327,18 +375,85 @@ void video_manager::save_snapshot(screen_device *screen, emu_file &file)
 	create_snapshot_bitmap(screen);
 
 	// add two text entries describing the image
-	std::string text1 = std::string(emulator_info::get_appname()).append(" ").append(emulator_info::get_build_version());
-	std::string text2 = std::string(machine().system().manufacturer).append(" ").append(machine().system().type.fullname());
 	png_info pnginfo;
-	pnginfo.add_text("Software", text1.c_str());
-	pnginfo.add_text("System", text2.c_str());
+	add_snapshot_text(pnginfo);
 
 	// now do the actual work
 	const rgb_t *palette = (screen != nullptr && screen->has_palette()) ? screen->palette().palette()->entry_list_adjusted() : nullptr;
 	int entries = (screen != nullptr && screen->has_palette()) ? screen->palette().entries() : 0;
-	png_error error = png_write_bitmap(file, &pnginfo, m_snap_bitmap, entries, palette);
+	png_error error = png_write_bitmap(file, &pnginfo, m_snap_bitmap, entries, palette, m_snap_fast ? PNG_ENCODE_FAST : PNG_ENCODE_DEFAULT);
+	if (error != PNGERR_NONE)
+		osd_printf_error("Error generating PNG for snapshot: png_error = %d\n", error);
+}
+
+
+//-------------------------------------------------
+//  add_snapshot_text - add the text entries
+//  describing a snapshot
+//-------------------------------------------------
+
+void video_manager::add_snapshot_text(png_info &pnginfo) const
+{
+	std::string text1 = std::string(emulator_info::get_appname()).append(" ").append(emulator_info::get_build_version());
+	std::string text2 = std::string(machine().system().manufacturer).append(" ").append(machine().system().type.fullname());
+	pnginfo.add_text("Software", text1.c_str());
+	pnginfo.add_text("System", text2.c_str());
+}
+
+
+//-------------------------------------------------
+//  queue_snapshot - render a snapshot now, but
+//  encode and write it on a worker thread
+//-------------------------------------------------
+
+void video_manager::queue_snapshot(screen_device *screen, std::unique_ptr<emu_file> &&file)
+{
+	// validate
+	assert(!m_snap_native || screen != nullptr);
+
+	// rendering uses the snapshot target, so it has to happen here
+	create_snapshot_bitmap(screen);
+
+	// take a copy of everything the encoder needs
+	auto job = std::make_unique<snapshot_job>();
+	job->file = std::move(file);
+	job->bitmap.allocate(m_snap_bitmap.width(), m_snap_bitmap.height());
+	for (s32 y = 0; m_snap_bitmap.height() > y; y++)
+		std::copy_n(&m_snap_bitmap.pix32(y), m_snap_bitmap.width(), &job->bitmap.pix32(y));
+	if (screen != nullptr && screen->has_palette())
+	{
+		const rgb_t *palette = screen->palette().palette()->entry_list_adjusted();
+		job->palette.assign(palette, palette + screen->palette().entries());
+	}
+	add_snapshot_text(job->pnginfo);
+	job->encode = m_snap_fast ? PNG_ENCODE_FAST : PNG_ENCODE_DEFAULT;
+
+	if (m_snap_write_queue == nullptr)
+		m_snap_write_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO | WORK_QUEUE_FLAG_MULTI);
+
+	// if snapshots are being taken faster than they can be written, catch up before adding more
+	if (m_snap_write_queue != nullptr && osd_work_queue_items(m_snap_write_queue) >= MAX_PENDING_SNAPSHOTS)
+		osd_work_queue_wait(m_snap_write_queue, osd_ticks_per_second() * 10);
+
+	if (m_snap_write_queue == nullptr || !osd_work_item_queue(m_snap_write_queue, write_snapshot_callback, job.get(), WORK_ITEM_FLAG_AUTO_RELEASE))
+		write_snapshot_callback(job.release(), 0);
+	else
+		job.release();
+}
+
+
+//-------------------------------------------------
+//  write_snapshot_callback - encode and write a
+//  queued snapshot, then free it
+//-------------------------------------------------
+
+void *video_manager::write_snapshot_callback(void *param, int threadid)
+{
+	std::unique_ptr<snapshot_job> job(reinterpret_cast<snapshot_job *>(param));
+	png_error error = png_write_bitmap(*job->file, &job->pnginfo, job->bitmap, job->palette.size(), job->palette.empty() ? nullptr : &job->palette[0], job->encode);
 	if (error != PNGERR_NONE)
 		osd_printf_error("Error generating PNG for snapshot: png_error = %d\n", error);
+	return nullptr;
 }
 
 
@@ -356,20 +471,20 @@ void video_manager::save_active_screen_snapshots()
 		for (screen_device &screen : screen_device_iterator(machine().root_device()))
 			if (machine().render().is_live(screen))
 			{
-				emu_file file(machine().options().snapshot_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
-				osd_file::error filerr = open_next(file, "png");
+				auto file = std::make_unique<emu_file>(machine().options().snapshot_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+				osd_file::error filerr = open_next(*file, "png");
 				if (filerr == osd_file::error::NONE)
-					save_snapshot(&screen, file);
+					queue_snapshot(&screen, std::move(file));
 			}
 	}
 
 	// otherwise, just write a single snapshot
 	else
 	{
-		emu_file file(machine().options().snapshot_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
-		osd_file::error filerr = open_next(file, "png");
+		auto file = std::make_unique<emu_file>(machine().options().snapshot_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+		osd_file::error filerr = open_next(*file, "png");
 		if (filerr == osd_file::error::NONE)
-			save_snapshot(nullptr, file);
+			queue_snapshot(nullptr, std::move(file));
 	}
 }
 
@@ -424,7 +539,7 @@ void video_manager::begin_recording_screen(const std::string &filename, uint32_t
 	const char *extension = movie_recording::format_file_extension(format);
 
 	// create the emu_file
-	bool is_absolute_path = !filename.empty() && osd_is_absolute_path(filename);
+	bool is_absolute_path = !filename.empty() && (osd_is_absolute_path(filename) || !filename.compare(0, 7, "socket."));
 	std::unique_ptr<emu_file> movie_file = std::make_unique<emu_file>(
 		is_absolute_path ? "" : machine().options().snapshot_directory(),
 		OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
@@ -517,6 +632,17 @@ void video_manager::exit()
 	// free the snapshot target
 	machine().render().target_free(m_snap_target);
 	m_snap_bitmap.reset();
+	if (m_snap_queue != nullptr)
+		osd_work_queue_free(m_snap_queue);
+	m_snap_queue = nullptr;
+
+	// finish writing any snapshots
+	if (m_snap_write_queue != nullptr)
+	{
+		osd_work_queue_wait(m_snap_write_queue, osd_ticks_per_second() * 60);
+		osd_work_queue_free(m_snap_write_queue);
+	}
+	m_snap_write_queue = nullptr;
 
 	// print a final result if we have at least 2 seconds' worth of data
 	if (!emulator_info::standalone() && m_overall_emutime.seconds() >= 1)
@@ -645,6 +771,7 @@ bool video_manager::finish_screen_updates()
 		if (screen.partial_scan_hpos() >= 0) // previous update ended mid-scanline
 			screen.update_now();
 		screen.update_partial(screen.visible_area().max_y);
+		screen.flush_deferred_updates();
 
 		if (machine().render().is_live(screen))
 			has_live_screen = true;
@@ -829,6 +956,94 @@ void video_manager::update_throttle(attotime emutime)
 }
 
 
+//-------------------------------------------------
+//  frame_pacing_possible - check whether the OSD
+//  is presenting in step with the display, at
+//  close enough to the emulated frame rate
+//-------------------------------------------------
+
+bool video_manager::frame_pacing_possible(osd_ticks_t &last_present, osd_ticks_t &period) const
+{
+	screen_device *const screen = screen_device_iterator(machine().root_device()).first();
+	if (!screen || !machine().osd().present_timing(last_present, period))
+		return false;
+
+	// pacing runs one emulated frame per refresh, so the rates have to match
+	double const frame_seconds = screen->frame_period().as_double() * 1000.0 / double(m_speed ? m_speed : 1000);
+	double const refresh_seconds = double(period) / double(osd_ticks_per_second());
+	return std::abs(frame_seconds - refresh_seconds) < (refresh_seconds * 0.01);
+}
+
+
+//-------------------------------------------------
+//  pace_frame - having presented a frame, wait
+//  so that emulating the next one finishes just
+//  before the following vertical blank
+//-------------------------------------------------
+
+void video_manager::pace_frame(osd_ticks_t present_start)
+{
+/*
+
+   Frame pacing theory:
+
+   With vsync, presenting a frame blocks until the display shows it, and
+   the emulated frame rate matches the refresh rate, so the display
+   throttles emulation by itself.  However, the frame is emulated as soon
+   as the previous one is shown, using input read at that point, and then
+   sits waiting for the next vertical blank for most of a refresh.
+
+   Instead, wait after presenting, then read input and emulate the frame
+   as late as we dare: the next vertical blank, less the time frames have
+   been taking to emulate and draw, less a margin for how much that time
+   varies.  Any wait shortens the time between reading the input and the
+   frame reaching the screen by the same amount.
+
+*/
+	osd_ticks_t last_present, period;
+	if (!machine().osd().present_timing(last_present, period))
+		return;
+
+	// measure how long the frame just shown took, from resuming emulation to presenting
+	if (m_pacing_active && present_start > m_pacing_resume_ticks)
+	{
+		s64 const work = present_start - m_pacing_resume_ticks;
+		s64 const error = work - s64(m_pacing_work_ticks);
+		m_pacing_work_ticks = s64(m_pacing_work_ticks) + error / 8;
+		m_pacing_work_deviation = s64(m_pacing_work_deviation) + ((error < 0 ? -error : error) - s64(m_pacing_work_deviation)) / 8;
+
+		// a frame that takes much longer than usual shows up straight away
+		if (osd_ticks_t(work) > m_pacing_work_ticks)
+			m_pacing_work_ticks = std::max<osd_ticks_t>(m_pacing_work_ticks, work - m_pacing_work_deviation);
+	}
+	else
+	{
+		// no history yet - don't wait at all this time
+		m_pacing_work_ticks = period;
+		m_pacing_work_deviation = 0;
+	}
+
+	// find the next vertical blank
+	osd_ticks_t const now = osd_ticks();
+	osd_ticks_t next_vblank = last_present + period;
+	while (next_vblank <= now)
+		next_vblank += period;
+
+	// allow for the average, twice the deviation, and a little for scheduling noise
+	osd_ticks_t const budget = m_pacing_work_ticks + 2 * m_pacing_work_deviation + period / 20;
+	if (budget < next_vblank - now)
+	{
+		osd_ticks_t const target = next_vblank - budget;
+		if (LOG_THROTTLE)
+			machine().logerror("Pacing: waiting %d ticks (work %d, deviation %d)\n", int(target - now), int(m_pacing_work_ticks), int(m_pacing_work_deviation));
+		throttle_until_ticks(target);
+	}
+
+	m_pacing_active = true;
+	m_pacing_resume_ticks = osd_ticks();
+}
+
+
 //-------------------------------------------------
 //  throttle_until_ticks - spin until the
 //  specified target time, calling the OSD code
@@ -846,10 +1061,13 @@ osd_ticks_t video_manager::throttle_until_ticks(osd_ticks_t target_ticks)
 	osd_ticks_t current_ticks = osd_ticks();
 	while (current_ticks < target_ticks)
 	{
-		// compute how much time to sleep for, taking into account the average oversleep
+		// compute how much time to sleep for, taking into account the average oversleep;
+		// with variable refresh the display shows the frame when we present it, so spin
+		// through the last millisecond rather than risk oversleeping
 		osd_ticks_t delta = target_ticks - current_ticks;
-		if (delta > m_average_oversleep / 1000)
-			delta -= m_average_oversleep / 1000;
+		osd_ticks_t const margin = m_average_oversleep / 1000 + (m_vrr ? (osd_ticks_per_second() / 1000) : 0);
+		if (delta > margin)
+			delta -= margin;
 		else
 			delta = 0;
 
@@ -1030,10 +1248,10 @@ void video_manager::recompute_speed(const attotime &emutime)
 	if (m_seconds_to_run != 0 && emutime.seconds() >= m_seconds_to_run)
 	{
 		// create a final screenshot
-		emu_file file(machine().options().snapshot_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
-		osd_file::error filerr = file.open(machine().basename() + PATH_SEPARATOR "final.png");
+		auto file = std::make_unique<emu_file>(machine().options().snapshot_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+		osd_file::error filerr = file->open(machine().basename() + PATH_SEPARATOR "final.png");
 		if (filerr == osd_file::error::NONE)
-			save_snapshot(nullptr, file);
+			queue_snapshot(nullptr, std::move(file));
 
 		//printf("Scheduled exit at %f\n", emutime.as_double());
 		// schedule our demise
@@ -1071,13 +1289,17 @@ void video_manager::create_snapshot_bitmap(screen_device *screen)
 	if (!m_snap_bitmap.valid() || width != m_snap_bitmap.width() || height != m_snap_bitmap.height())
 		m_snap_bitmap.allocate(width, height);
 
+	// allocate a work queue the first time we can use one
+	if (m_snap_bands >= 2 && m_snap_queue == nullptr)
+		m_snap_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+
 	// render the screen there
 	render_primitive_list &primlist = m_snap_target->get_primitives();
 	primlist.acquire_lock();
 	if (machine().options().snap_bilinear())
-		snap_renderer_bilinear::draw_primitives(primlist, &m_snap_bitmap.pix32(0), width, height, m_snap_bitmap.rowpixels());
+		snap_renderer_bilinear::draw_primitives(primlist, &m_snap_bitmap.pix32(0), width, height, m_snap_bitmap.rowpixels(), m_snap_queue, m_snap_bands);
 	else
-		snap_renderer::draw_primitives(primlist, &m_snap_bitmap.pix32(0), width, height, m_snap_bitmap.rowpixels());
+		snap_renderer::draw_primitives(primlist, &m_snap_bitmap.pix32(0), width, height, m_snap_bitmap.rowpixels(), m_snap_queue, m_snap_bands);
 	primlist.release_lock();
 }
 
@@ -1296,8 +1518,9 @@ void video_manager::toggle_record_movie(movie_recording::format format)
 {
 	if (!is_recording())
 	{
+		std::string name(movie_recording::format_file_extension(format));
 		begin_recording(nullptr, format);
-		machine().popmessage("REC START (%s)", format == movie_recording::format::MNG ? "MNG" : "AVI");
+		machine().popmessage("REC START (%s)", strmakeupper(name));
 	}
 	else
 	{
@@ -33,6 +33,9 @@ constexpr int MAX_FRAMESKIP = FRAMESKIP_LEVELS - 2;
 //  TYPE DEFINITIONS
 //**************************************************************************
 
+class png_info;
+
+
 // ======================> video_manager
 
 class video_manager
@@ -45,12 +48,13 @@ public:
 
 	// getters
 	running_machine &machine() const { return m_machine; }
-	bool skip_this_frame() const { return m_skipping_this_frame; }
+	bool skip_this_frame() const { return m_skipping_this_frame || m_speculative; }
 	int speed_factor() const { return m_speed; }
 	int frameskip() const { return m_auto_frameskip ? -1 : m_frameskip_level; }
 	bool throttled() const { return m_throttled; }
 	float throttle_rate() const { return m_throttle_rate; }
 	bool fastforward() const { return m_fastforward; }
+	bool speculative() const { return m_speculative; }
 	bool is_recording() const;
 
 	// setters
@@ -58,6 +62,7 @@ public:
 	void set_throttled(bool throttled = true) { m_throttled = throttled; }
 	void set_throttle_rate(float throttle_rate) { m_throttle_rate = throttle_rate; }
 	void set_fastforward(bool ffwd = true) { m_fastforward = ffwd; }
+	void set_speculative(bool speculative = true) { m_speculative = speculative; }
 	void set_output_changed() { m_output_changed = true; }
 
 	// misc
@@ -110,12 +115,18 @@ private:
 	bool finish_screen_updates();
 	void update_throttle(attotime emutime);
 	osd_ticks_t throttle_until_ticks(osd_ticks_t target_ticks);
+	bool frame_pacing_possible(osd_ticks_t &last_present, osd_ticks_t &period) const;
+	void pace_frame(osd_ticks_t present_start);
 	void update_frameskip();
 	void update_refresh_speed();
 	void recompute_speed(const attotime &emutime);
 
 	// snapshot/movie helpers
+	struct snapshot_job;
 	void create_snapshot_bitmap(screen_device *screen);
+	void add_snapshot_text(png_info &pnginfo) const;
+	void queue_snapshot(screen_device *screen, std::unique_ptr<emu_file> &&file);
+	static void *write_snapshot_callback(void *param, int threadid);
 	void record_frame();
 
 	// movies
@@ -149,10 +160,19 @@ private:
 	bool                m_throttled;                // flag: true if we're currently throttled
 	float               m_throttle_rate;            // target rate for throttling
 	bool                m_fastforward;              // flag: true if we're currently fast-forwarding
+	bool                m_speculative;              // flag: true if frames are being emulated unseen
 	u32                 m_seconds_to_run;           // number of seconds to run before quitting
 	bool                m_auto_frameskip;           // flag: true if we're automatically frameskipping
 	u32                 m_speed;                    // overall speed (*1000)
 	bool                m_low_latency;              // flag: true if we are throttling after blitting
+	bool                m_vrr;                      // flag: true if the display refreshes when we present
+
+	// frame pacing
+	bool                m_frame_pacing;             // flag: true if we are pacing to the display
+	bool                m_pacing_active;            // flag: true if the last frame was paced
+	osd_ticks_t         m_pacing_resume_ticks;      // time emulation resumed after pacing
+	osd_ticks_t         m_pacing_work_ticks;        // average time to emulate and draw a frame
+	osd_ticks_t         m_pacing_work_deviation;    // average deviation from that time
 
 	// frameskipping
 	u8                  m_empty_skip_count;         // number of empty frames we have skipped
@@ -169,6 +189,10 @@ private:
 	bool                m_snap_native;              // are we using native per-screen layouts?
 	s32                 m_snap_width;               // width of snapshots (0 == auto)
 	s32                 m_snap_height;              // height of snapshots (0 == auto)
+	int                 m_snap_bands;               // bands to split snapshot rendering into
+	osd_work_queue *    m_snap_queue;               // work queue for rendering snapshot bands
+	osd_work_queue *    m_snap_write_queue;         // work queue for encoding and writing snapshots
+	bool                m_snap_fast;                // use fast PNG encoding
 
 	// movie recordings
 	std::vector<movie_recording::ptr> m_movie_recordings;
@@ -177,6 +201,7 @@ private:
 
 	static const attoseconds_t ATTOSECONDS_PER_SPEED_UPDATE = ATTOSECONDS_PER_SECOND / 4;
 	static const int PAUSED_REFRESH_RATE = 30;
+	static const int MAX_PENDING_SNAPSHOTS = 8;
 
 	bool                m_timecode_enabled;     // inp.timecode record enabled
 	bool                m_timecode_write;       // Show/hide timer at right (partial time)
@@ -15,12 +15,15 @@
 
 #include "emuopts.h"
 #include "drivenum.h"
+#include "hashcache.h"
 #include "romload.h"
 #include "softlist_dev.h"
 
 #include "chd.h"
 
 #include <algorithm>
+#include <future>
+#include <queue>
 
 
 //**************************************************************************
@@ -31,9 +34,20 @@
 //  media_auditor - constructor
 //-------------------------------------------------
 
-media_auditor::media_auditor(const driver_enumerator &enumerator)
+media_auditor::media_auditor(const driver_enumerator &enumerator, hash_cache *shared_cache)
 	: m_enumerator(enumerator)
 	, m_validation(AUDIT_VALIDATE_FULL)
+	, m_own_hash_cache(shared_cache ? nullptr : std::make_unique<hash_cache>(enumerator.options().hash_cache()))
+	, m_hash_cache(shared_cache ? shared_cache : m_own_hash_cache.get())
+{
+}
+
+
+//-------------------------------------------------
+//  ~media_auditor - destructor
+//-------------------------------------------------
+
+media_auditor::~media_auditor()
 {
 }
 
@@ -415,6 +429,8 @@ media_auditor::audit_record &media_auditor::audit_one_rom(const std::vector<std:
 	// find the file and checksum it, getting the file length along the way
 	emu_file file(m_enumerator.options().media_path(), searchpath, OPEN_FLAG_READ | OPEN_FLAG_NO_PRELOAD);
 	file.set_restrict_to_mediapath(1);
+	if (m_hash_cache->enabled())
+		file.set_hash_cache(m_hash_cache);
 
 	// open the file if we can
 	osd_file::error filerr;
@@ -582,3 +598,167 @@ media_auditor::audit_record::audit_record(const char *name, media_type type)
 	, m_shared_device(nullptr)
 {
 }
+
+
+
+//**************************************************************************
+//  PARALLEL AUDITOR
+//**************************************************************************
+
+//-------------------------------------------------
+//  parallel_auditor - constructor
+//-------------------------------------------------
+
+parallel_auditor::parallel_auditor(emu_options &options, unsigned threads)
+	: m_options(options)
+	, m_threads(std::max(threads, 1U))
+	, m_hash_cache(std::make_unique<hash_cache>(options.hash_cache()))
+{
+}
+
+
+//-------------------------------------------------
+//  ~parallel_auditor - destructor
+//-------------------------------------------------
+
+parallel_auditor::~parallel_auditor()
+{
+}
+
+
+//-------------------------------------------------
+//  audit_media - audit the given drivers,
+//  keeping a couple per thread in flight
+//-------------------------------------------------
+
+void parallel_auditor::audit_media(const std::vector<int> &drivers, const result_callback &callback, const char *validation)
+{
+	// the auditor refers to its enumerator's configuration, so keep them
+	// together until the result has been delivered
+	struct result
+	{
+		result(emu_options &options, hash_cache *cache, int index)
+			: enumerator(options)
+			, auditor(enumerator, cache)
+		{
+			enumerator.set_current(index);
+		}
+
+		driver_enumerator enumerator;
+		media_auditor auditor;
+		media_auditor::summary summary;
+	};
+
+	std::size_t const max_queued = m_threads * 2;
+	std::queue<std::pair<int, std::future<std::unique_ptr<result> > > > queue;
+	auto next = drivers.begin();
+	while (!queue.empty() || (drivers.end() != next))
+	{
+		while ((queue.size() < max_queued) && (drivers.end() != next))
+		{
+			int const index = *next++;
+			queue.emplace(index, std::async(std::launch::async, [this, index, validation] ()
+			{
+				auto audit = std::make_unique<result>(m_options, m_hash_cache.get(), index);
+				audit->summary = audit->auditor.audit_media(validation);
+				return audit;
+			}));
+		}
+
+		std::unique_ptr<result> const audit = queue.front().second.get();
+		int const index = queue.front().first;
+		queue.pop();
+		callback(index, audit->auditor, audit->summary);
+	}
+}
+
+
+//-------------------------------------------------
+//  audit_software - audit the software in the
+//  given lists, each named with a system that
+//  has it; lists are parsed ahead on their own
+//  threads while the items of the current list
+//  are audited
+//-------------------------------------------------
+
+void parallel_auditor::audit_software(const std::vector<std::pair<int, std::string> > &lists, const software_callback &callback, const char *validation)
+{
+	// the software list lives in the configuration of its enumerator, so
+	// keep them together until all the items have been audited
+	struct parsed_list
+	{
+		parsed_list(emu_options &options, int index, const std::string &name)
+			: enumerator(options)
+			, swlist(nullptr)
+		{
+			enumerator.set_current(index);
+			for (software_list_device &swlistdev : software_list_device_iterator(enumerator.config()->root_device()))
+			{
+				if (swlistdev.list_name() == name)
+				{
+					// parse and index it now, so the auditing threads only ever read it
+					swlist = &swlistdev;
+					swlist->get_info();
+					swlist->index();
+					break;
+				}
+			}
+		}
+
+		driver_enumerator enumerator;
+		software_list_device *swlist;
+	};
+
+	struct result
+	{
+		result(const driver_enumerator &enumerator, hash_cache *cache) : auditor(enumerator, cache) { }
+
+		media_auditor auditor;
+		media_auditor::summary summary;
+	};
+
+	std::queue<std::future<std::unique_ptr<parsed_list> > > parsing;
+	auto next_list = lists.begin();
+	auto const parse_ahead =
+			[this, &parsing, &next_list, &lists] ()
+			{
+				while ((parsing.size() < m_threads) && (lists.end() != next_list))
+				{
+					auto const &list = *next_list++;
+					parsing.emplace(std::async(std::launch::async, [this, &list] () { return std::make_unique<parsed_list>(m_options, list.first, list.second); }));
+				}
+			};
+
+	std::size_t const max_queued = m_threads * 2;
+	parse_ahead();
+	while (!parsing.empty())
+	{
+		std::unique_ptr<parsed_list> const list = parsing.front().get();
+		parsing.pop();
+		parse_ahead();
+		if (!list->swlist)
+			continue;
+
+		std::queue<std::pair<const software_info *, std::future<std::unique_ptr<result> > > > queue;
+		auto const &infolist = list->swlist->get_info();
+		auto next = infolist.begin();
+		while (!queue.empty() || (infolist.end() != next))
+		{
+			while ((queue.size() < max_queued) && (infolist.end() != next))
+			{
+				const software_info &swinfo = *next++;
+				queue.emplace(&swinfo, std::async(std::launch::async, [this, &list, &swinfo, validation] ()
+				{
+					auto audit = std::make_unique<result>(list->enumerator, m_hash_cache.get());
+					audit->summary = audit->auditor.audit_software(*list->swlist, swinfo, validation);
+					return audit;
+				}));
+			}
+
+			std::unique_ptr<result> const audit = queue.front().second.get();
+			const software_info &swinfo = *queue.front().first;
+			queue.pop();
+			callback(*list->swlist, swinfo, audit->auditor, audit->summary);
+		}
+	}
+}
@@ -12,9 +12,13 @@
 
 #pragma once
 
+#include <functional>
 #include <iosfwd>
 #include <list>
+#include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 
 
@@ -35,6 +39,7 @@
 
 // forward declarations
 class driver_enumerator;
+class hash_cache;
 class software_list_device;
 
 
@@ -148,7 +153,8 @@ public:
 	using record_list = std::list<audit_record>;
 
 	// construction/destruction
-	media_auditor(const driver_enumerator &enumerator);
+	media_auditor(const driver_enumerator &enumerator, hash_cache *shared_cache = nullptr);
+	~media_auditor();
 
 	// getters
 	const record_list &records() const { return m_record_list; }
@@ -172,6 +178,36 @@ private:
 	record_list                 m_record_list;
 	const driver_enumerator &   m_enumerator;
 	const char *                m_validation;
+	std::unique_ptr<hash_cache> m_own_hash_cache;
+	hash_cache *                m_hash_cache;
+};
+
+
+
+// ======================> parallel_auditor
+
+// audits systems on worker threads, each with its own driver enumerator and
+// auditor, sharing a hash cache; results are delivered on the calling thread
+// in the order the systems were given, as soon as each is available
+class parallel_auditor
+{
+public:
+	using result_callback = std::function<void (int index, const media_auditor &auditor, media_auditor::summary summary)>;
+	using software_callback = std::function<void (software_list_device &swlist, const software_info &swinfo, const media_auditor &auditor, media_auditor::summary summary)>;
+
+	// construction/destruction
+	parallel_auditor(emu_options &options, unsigned threads);
+	~parallel_auditor();
+
+	// audit operations
+	void audit_media(const std::vector<int> &drivers, const result_callback &callback, const char *validation = AUDIT_VALIDATE_FULL);
+	void audit_software(const std::vector<std::pair<int, std::string> > &lists, const software_callback &callback, const char *validation = AUDIT_VALIDATE_FULL);
+
+private:
+	// internal state
+	emu_options &               m_options;
+	unsigned const              m_threads;
+	std::unique_ptr<hash_cache> m_hash_cache;
 };
 
 
@@ -37,6 +37,10 @@
 #include <algorithm>
 #include <new>
 #include <cctype>
+#include <future>
+#include <queue>
+#include <sstream>
+#include <thread>
 
 
 //**************************************************************************
@@ -176,6 +180,32 @@ void print_summary(
 	}
 }
 
+
+void verify_software_lists(
+		emu_options &options, const std::vector<std::pair<int, std::string> > &lists,
+		unsigned &correct, unsigned &incorrect, unsigned &notfound, unsigned &nrlists)
+{
+	// lists without any software produce no results, so aren't counted
+	util::ovectorstream summary_string;
+	std::string lastlist;
+	parallel_auditor(options, std::thread::hardware_concurrency()).audit_software(
+			lists,
+			[&] (software_list_device &swlistdev, const software_info &swinfo, media_auditor const &auditor, media_auditor::summary summary)
+			{
+				if (swlistdev.list_name() != lastlist)
+				{
+					++nrlists;
+					lastlist = swlistdev.list_name();
+				}
+				print_summary(
+						auditor, summary, false,
+						"rom", util::string_format("%s:%s", swlistdev.list_name(), swinfo.shortname()).c_str(), nullptr,
+						correct, incorrect, notfound,
+						summary_string);
+			},
+			AUDIT_VALIDATE_FAST);
+}
+
 } // anonymous namespace
 
 
@@ -883,30 +913,34 @@ void cli_frontend::verifyroms(const std::vector<std::string> &args)
 	unsigned incorrect = 0;
 	unsigned notfound = 0;
 
-	// iterate over drivers
+	// find the matching drivers; if it wasn't a wildcard, there can only be one
 	driver_enumerator drivlist(m_options);
-	media_auditor auditor(drivlist);
-	util::ovectorstream summary_string;
+	std::vector<int> drivers;
 	while (drivlist.next())
 	{
 		if (included(drivlist.driver().name))
-		{
-			// audit the ROMs in this set
-			media_auditor::summary summary = auditor.audit_media(AUDIT_VALIDATE_FAST);
-
-			auto const clone_of = drivlist.clone();
-			print_summary(
-					auditor, summary, true,
-					"rom", drivlist.driver().name, (clone_of >= 0) ? drivlist.driver(clone_of).name : nullptr,
-					correct, incorrect, notfound,
-					summary_string);
-
-			// if it wasn't a wildcard, there can only be one
-			if (!iswild)
-				break;
-		}
+			drivers.emplace_back(drivlist.current());
 	}
+	if (!iswild && (1U < drivers.size()))
+		drivers.resize(1);
+
+	// audit them on all threads, reporting in order
+	util::ovectorstream summary_string;
+	parallel_auditor(m_options, iswild ? std::thread::hardware_concurrency() : 1U).audit_media(
+			drivers,
+			[&] (int index, media_auditor const &auditor, media_auditor::summary summary)
+			{
+				auto const clone_of = driver_list::clone(index);
+				print_summary(
+						auditor, summary, true,
+						"rom", driver_list::driver(index).name, (clone_of >= 0) ? driver_list::driver(clone_of).name : nullptr,
+						correct, incorrect, notfound,
+						summary_string);
+			},
+			AUDIT_VALIDATE_FAST);
 
+	// device types are audited on this thread
+	media_auditor auditor(drivlist);
 	if (iswild || !matchcount)
 	{
 		machine_config config(GAME_NAME(___empty), m_options);
@@ -1200,6 +1234,100 @@ void cli_frontend::output_single_softlist(std::ostream &out, software_list_devic
 }
 
 
+/*-------------------------------------------------
+    softlist_output - parses and formats software
+    lists on worker threads, writing them out in
+    the order they were added
+-------------------------------------------------*/
+
+class cli_frontend::softlist_output
+{
+public:
+	softlist_output(cli_frontend &frontend)
+		: m_frontend(frontend)
+		, m_max_queued(std::max(std::thread::hardware_concurrency(), 1U) * 2)
+		, m_first(true)
+	{
+	}
+
+	// a list belonging to a system is parsed from a fresh configuration of
+	// the system on a worker thread
+	void add(int driver, const std::string &name)
+	{
+		make_room();
+		cli_frontend &frontend(m_frontend);
+		m_queue.emplace(std::async(std::launch::async, [&frontend, driver, name] ()
+		{
+			driver_enumerator drivlist(frontend.m_options);
+			drivlist.set_current(driver);
+			std::ostringstream out;
+			for (software_list_device &swlistdev : software_list_device_iterator(drivlist.config()->root_device()))
+			{
+				if (swlistdev.list_name() == name)
+				{
+					if (!swlistdev.get_info().empty())
+						frontend.output_single_softlist(out, swlistdev);
+					break;
+				}
+			}
+			return out.str();
+		}));
+	}
+
+	// a list belonging to a device is formatted right away, as the device
+	// only exists for the duration of the action
+	void add(software_list_device &swlistdev)
+	{
+		make_room();
+		std::ostringstream out;
+		if (!swlistdev.get_info().empty())
+			m_frontend.output_single_softlist(out, swlistdev);
+		std::promise<std::string> text;
+		text.set_value(out.str());
+		m_queue.emplace(text.get_future());
+	}
+
+	// write out everything still pending, returning whether any list was written
+	bool finish()
+	{
+		while (!m_queue.empty())
+			write_front();
+		if (!m_first)
+			std::cout << "</softwarelists>\n";
+		return !m_first;
+	}
+
+private:
+	void make_room()
+	{
+		while (m_queue.size() >= m_max_queued)
+			write_front();
+	}
+
+	void write_front()
+	{
+		std::string const text(m_queue.front().get());
+		m_queue.pop();
+		if (!text.empty())
+		{
+			if (m_first)
+			{
+				if (m_frontend.m_options.bool_value(CLIOPTION_DTD))
+					std::cout << s_softlist_xml_dtd;
+				std::cout << "<softwarelists>\n";
+				m_first = false;
+			}
+			std::cout << text;
+		}
+	}
+
+	cli_frontend &                          m_frontend;
+	std::size_t const                       m_max_queued;
+	std::queue<std::future<std::string> >   m_queue;
+	bool                                    m_first;
+};
+
+
 /*-------------------------------------------------
     info_listsoftware - output the list of
     software supported by a given game or set of
@@ -1210,33 +1338,31 @@ void cli_frontend::output_single_softlist(std::ostream &out, software_list_devic
 void cli_frontend::listsoftware(const std::vector<std::string> &args)
 {
 	std::unordered_set<std::string> list_map;
-	bool firstlist(true);
-	apply_device_action(
+	softlist_output output(*this);
+	machine_config config(GAME_NAME(___empty), m_options);
+	machine_config::token const tok(config.begin_configuration(config.root_device()));
+	apply_action(
 			args,
-			[this, &list_map, &firstlist] (device_t &root, char const *type, bool first)
+			[&list_map, &output] (driver_enumerator &drivlist, bool first)
 			{
-				for (software_list_device &swlistdev : software_list_device_iterator(root))
+				for (software_list_device &swlistdev : software_list_device_iterator(drivlist.config()->root_device()))
 				{
 					if (list_map.insert(swlistdev.list_name()).second)
-					{
-						if (!swlistdev.get_info().empty())
-						{
-							if (firstlist)
-							{
-								if (m_options.bool_value(CLIOPTION_DTD))
-									std::cout << s_softlist_xml_dtd;
-								std::cout << "<softwarelists>\n";
-								firstlist = false;
-							}
-							output_single_softlist(std::cout, swlistdev);
-						}
-					}
+						output.add(drivlist.current(), swlistdev.list_name());
+				}
+			},
+			[&list_map, &output, &config] (device_type type, bool first)
+			{
+				device_t *const dev = config.device_add("_tmp", type, 0);
+				for (software_list_device &swlistdev : software_list_device_iterator(*dev))
+				{
+					if (list_map.insert(swlistdev.list_name()).second)
+						output.add(swlistdev);
 				}
+				config.device_remove("_tmp");
 			});
 
-	if (!firstlist)
-		std::cout << "</softwarelists>\n";
-	else
+	if (!output.finish())
 		fprintf(stdout, "No software lists found for this system\n"); // TODO: should this go to stderr instead?
 }
 
@@ -1262,37 +1388,22 @@ void cli_frontend::verifysoftware(const std::vector<std::string> &args)
 	if (drivlist.count() == 0)
 		throw emu_fatalerror(EMU_ERR_NO_SUCH_SYSTEM, "No matching systems found for '%s'", gamename);
 
-	media_auditor auditor(drivlist);
-	util::ovectorstream summary_string;
+	// collect each list once, with the first system that has it
+	std::vector<std::pair<int, std::string> > lists;
 	while (drivlist.next())
 	{
 		matched++;
 
 		for (software_list_device &swlistdev : software_list_device_iterator(drivlist.config()->root_device()))
 		{
-			if (swlistdev.is_original())
-			{
-				if (list_map.insert(swlistdev.list_name()).second)
-				{
-					if (!swlistdev.get_info().empty())
-					{
-						nrlists++;
-						for (const software_info &swinfo : swlistdev.get_info())
-						{
-							media_auditor::summary summary = auditor.audit_software(swlistdev, swinfo, AUDIT_VALIDATE_FAST);
-
-							print_summary(
-									auditor, summary, false,
-									"rom", util::string_format("%s:%s", swlistdev.list_name(), swinfo.shortname()).c_str(), nullptr,
-									correct, incorrect, notfound,
-									summary_string);
-						}
-					}
-				}
-			}
+			if (swlistdev.is_original() && list_map.insert(swlistdev.list_name()).second)
+				lists.emplace_back(drivlist.current(), swlistdev.list_name());
 		}
 	}
 
+	// audit them on all threads, reporting in order
+	verify_software_lists(m_options, lists, correct, incorrect, notfound, nrlists);
+
 	// clear out any cached files
 	util::archive_file::cache_clear();
 
@@ -1325,33 +1436,31 @@ void cli_frontend::getsoftlist(const std::vector<std::string> &args)
 	const char *gamename = args.empty() ? "*" : args[0].c_str();
 
 	std::unordered_set<std::string> list_map;
-	bool firstlist(true);
-	apply_device_action(
+	softlist_output output(*this);
+	machine_config config(GAME_NAME(___empty), m_options);
+	machine_config::token const tok(config.begin_configuration(config.root_device()));
+	apply_action(
 			std::vector<std::string>(),
-			[this, gamename, &list_map, &firstlist] (device_t &root, char const *type, bool first)
+			[gamename, &list_map, &output] (driver_enumerator &drivlist, bool first)
 			{
-				for (software_list_device &swlistdev : software_list_device_iterator(root))
+				for (software_list_device &swlistdev : software_list_device_iterator(drivlist.config()->root_device()))
 				{
 					if (core_strwildcmp(gamename, swlistdev.list_name().c_str()) == 0 && list_map.insert(swlistdev.list_name()).second)
-					{
-						if (!swlistdev.get_info().empty())
-						{
-							if (firstlist)
-							{
-								if (m_options.bool_value(CLIOPTION_DTD))
-									std::cout << s_softlist_xml_dtd;
-								std::cout << "<softwarelists>\n";
-								firstlist = false;
-							}
-							output_single_softlist(std::cout, swlistdev);
-						}
-					}
+						output.add(drivlist.current(), swlistdev.list_name());
+				}
+			},
+			[gamename, &list_map, &output, &config] (device_type type, bool first)
+			{
+				device_t *const dev = config.device_add("_tmp", type, 0);
+				for (software_list_device &swlistdev : software_list_device_iterator(*dev))
+				{
+					if (core_strwildcmp(gamename, swlistdev.list_name().c_str()) == 0 && list_map.insert(swlistdev.list_name()).second)
+						output.add(swlistdev);
 				}
+				config.device_remove("_tmp");
 			});
 
-	if (!firstlist)
-		std::cout << "</softwarelists>\n";
-	else
+	if (!output.finish())
 		fprintf(stdout, "No such software lists found\n"); // TODO: should this go to stderr instead?
 }
 
@@ -1369,36 +1478,21 @@ void cli_frontend::verifysoftlist(const std::vector<std::string> &args)
 	unsigned notfound = 0;
 	unsigned matched = 0;
 
+	// collect each matching list once, with the first system that has it
 	driver_enumerator drivlist(m_options);
-	media_auditor auditor(drivlist);
-	util::ovectorstream summary_string;
-
+	std::vector<std::pair<int, std::string> > lists;
 	while (drivlist.next())
 	{
 		for (software_list_device &swlistdev : software_list_device_iterator(drivlist.config()->root_device()))
 		{
 			if (core_strwildcmp(gamename, swlistdev.list_name().c_str()) == 0 && list_map.insert(swlistdev.list_name()).second)
-			{
-				if (!swlistdev.get_info().empty())
-				{
-					matched++;
-
-					// Get the actual software list contents
-					for (const software_info &swinfo : swlistdev.get_info())
-					{
-						media_auditor::summary summary = auditor.audit_software(swlistdev, swinfo, AUDIT_VALIDATE_FAST);
-
-						print_summary(
-								auditor, summary, false,
-								"rom", util::string_format("%s:%s", swlistdev.list_name(), swinfo.shortname()).c_str(), nullptr,
-								correct, incorrect, notfound,
-								summary_string);
-					}
-				}
-			}
+				lists.emplace_back(drivlist.current(), swlistdev.list_name());
 		}
 	}
 
+	// audit them on all threads, reporting in order
+	verify_software_lists(m_options, lists, correct, incorrect, notfound, matched);
+
 	// clear out any cached files
 	util::archive_file::cache_clear();
 
@@ -1633,6 +1727,7 @@ void cli_frontend::execute_commands(const char *exename)
 			return;
 		}
 		validity_checker valid(m_options, false);
+		valid.set_threads(std::max(std::thread::hardware_concurrency(), 1U));
 		const char *sysname = m_options.command_arguments().empty() ? nullptr : m_options.command_arguments()[0].c_str();
 		bool result = valid.check_all_matching(sysname);
 		if (!result)
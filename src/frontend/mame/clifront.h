@@ -37,6 +37,8 @@ public:
 	int execute(std::vector<std::string> &args);
 
 private:
+	class softlist_output;
+
 	struct info_command_struct
 	{
 		const char *option;
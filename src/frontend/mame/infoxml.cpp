@@ -30,6 +30,7 @@
 #include <cstring>
 #include <future>
 #include <queue>
+#include <thread>
 #include <type_traits>
 #include <unordered_set>
 #include <utility>
@@ -38,6 +39,9 @@
 #define XML_ROOT    "mame"
 #define XML_TOP     "machine"
 
+// systems described by each -listxml worker task
+#define DRIVERS_PER_CHUNK   32
+
 
 namespace {
 
@@ -377,6 +381,8 @@ void info_xml_creator::output(std::ostream &out, const std::vector<std::string>
 
 void info_xml_creator::output(std::ostream &out, const std::function<bool(const char *shortname, bool &done)> &filter, bool include_devices)
 {
+	// drivers are handed to worker threads in chunks, and the chunks are
+	// emitted in driver order so the output doesn't depend on timing
 	struct prepared_info
 	{
 		std::string     m_xml_snippet;
@@ -403,6 +409,10 @@ void info_xml_creator::output(std::ostream &out, const std::function<bool(const
 	if (include_devices && filter)
 		devfilter = std::make_unique<device_type_set>();
 
+	// keep a couple of chunks per hardware thread in flight
+	unsigned const threads = std::max(std::thread::hardware_concurrency(), 1U);
+	size_t const max_queued = threads * 2;
+
 	// prepare a queue of futures
 	std::queue<std::future<prepared_info>> queue;
 
@@ -410,23 +420,34 @@ void info_xml_creator::output(std::ostream &out, const std::function<bool(const
 	while (!queue.empty() || (!drivlist_done && !filter_done))
 	{
 		// try populating the queue
-		while (queue.size() < 20 && !drivlist_done && !filter_done)
+		while (queue.size() < max_queued && !drivlist_done && !filter_done)
 		{
-			if (!drivlist.next())
+			// the filter has state, so it is only ever called from here, in order
+			std::vector<const game_driver *> chunk;
+			chunk.reserve(DRIVERS_PER_CHUNK);
+			while (chunk.size() < DRIVERS_PER_CHUNK && !drivlist_done && !filter_done)
 			{
-				// at this point we are done enumerating through drivlist and it is no
-				// longer safe to call next(), so record that we're done
-				drivlist_done = true;
+				if (!drivlist.next())
+				{
+					// at this point we are done enumerating through drivlist and it is no
+					// longer safe to call next(), so record that we're done
+					drivlist_done = true;
+				}
+				else if (!filter || filter(drivlist.driver().name, filter_done))
+				{
+					chunk.push_back(&drivlist.driver());
+				}
 			}
-			else if (!filter || filter(drivlist.driver().name, filter_done))
+
+			if (!chunk.empty())
 			{
-				const game_driver &driver(drivlist.driver());
-				std::future<prepared_info> future_pi = std::async(std::launch::async, [&drivlist, &driver, &devfilter]
+				std::future<prepared_info> future_pi = std::async(std::launch::async, [&drivlist, chunk = std::move(chunk), &devfilter]
 				{
 					prepared_info result;
 					std::ostringstream stream;
 
-					output_one(stream, drivlist, driver, devfilter ? &result.m_dev_set : nullptr);
+					for (const game_driver *driver : chunk)
+						output_one(stream, drivlist, *driver, devfilter ? &result.m_dev_set : nullptr);
 					result.m_xml_snippet = stream.str();
 					return result;
 				});
@@ -18,6 +18,7 @@
 #include "debug/textbuf.h"
 #include "drivenum.h"
 #include "emuopts.h"
+#include "memusage.h"
 #include "ui/ui.h"
 #include "ui/pluginopt.h"
 #include "luaengine.h"
@@ -59,7 +60,12 @@ namespace sol
 		{
 			ptr = luaL_buffinitsize(L, &buff, size);
 			len = size;
+#if defined(LUAJIT_VERSION)
+			// sol2's 5.2 buffer shim over the LuaJIT 5.1 API
+			if(buff.ptr != buff.b.buffer)
+#else
 			if(buff.b != buff.initb)
+#endif
 			{
 				lua_pushvalue(L, -1);
 				lua_setfield(L, LUA_REGISTRYINDEX, "sol::buffer_temp");
@@ -67,8 +73,14 @@ namespace sol
 		}
 		~buffer()
 		{
+#if defined(LUAJIT_VERSION)
+			lua_State *L = buff.L2;
+			lua_getfield(L, LUA_REGISTRYINDEX, "sol::buffer_temp");
+			if(!lua_isnil(L, -1))
+#else
 			lua_State *L = buff.L;
 			if(lua_getfield(L, LUA_REGISTRYINDEX, "sol::buffer_temp") != LUA_TNIL)
+#endif
 			{
 				lua_pushnil(L);
 				lua_setfield(L, LUA_REGISTRYINDEX, "sol::buffer_temp");
@@ -252,10 +264,11 @@ static const enum_parser<input_seq_type, 3> s_seq_type_parser =
 };
 
 
-static const enum_parser<movie_recording::format, 2> s_movie_recording_format_parser =
+static const enum_parser<movie_recording::format, 3> s_movie_recording_format_parser =
 {
 	{ "avi", movie_recording::format::AVI },
-	{ "mng", movie_recording::format::MNG }
+	{ "mng", movie_recording::format::MNG },
+	{ "y4m", movie_recording::format::Y4M }
 };
 
 
@@ -622,6 +635,35 @@ lua_engine::lua_engine()
 	sol()["package"]["preload"]["linenoise"] = &luaopen_linenoise;
 	sol()["package"]["preload"]["lsqlite3"] = &luaopen_lsqlite3;
 
+#if defined(LUAJIT_VERSION)
+	// LuaJIT has no integer operators, bit32 or utf8 library; give plugins
+	// the bit library under the 5.2 name and the common utf8 functions
+	if(!sol()["bit32"].valid())
+		sol()["bit32"] = sol()["bit"].get<sol::object>();
+	if(!sol()["utf8"].valid())
+	{
+		sol::table utf8 = sol().create_named_table("utf8");
+		utf8["char"] = [](sol::variadic_args va) {
+				std::string result;
+				for(sol::object arg : va)
+					result += utf8_from_uchar(char32_t(arg.as<lua_Number>()));
+				return result;
+			};
+		utf8["len"] = [this](const std::string &str) -> sol::object {
+				int count = 0;
+				for(size_t pos = 0; pos < str.length(); count++)
+				{
+					char32_t uchar;
+					int const len = uchar_from_utf8(&uchar, &str[pos], str.length() - pos);
+					if(len <= 0)
+						return sol::make_object(sol(), sol::nil);
+					pos += len;
+				}
+				return sol::make_object(sol(), count);
+			};
+	}
+#endif
+
 	lua_gc(m_lua_state, LUA_GCRESTART, 0);
 }
 
@@ -701,34 +743,38 @@ bool lua_engine::menu_callback(const std::string &menu, int index, const std::st
 void lua_engine::set_machine(running_machine *machine)
 {
 	if (!machine || (machine != m_machine))
+	{
 		m_seq_poll.reset();
+		m_device_table.reset();
+	}
 	m_machine = machine;
 }
 
 int lua_engine::enumerate_functions(const char *id, std::function<bool(const sol::protected_function &func)> &&callback)
 {
 	int count = 0;
-	sol::object functable = sol().registry()[id];
-	if (functable.is<sol::table>())
+	auto const found = m_functions.find(id);
+	if (found != m_functions.end())
 	{
-		for (auto &func : functable.as<sol::table>())
+		for (const sol::protected_function &func : found->second)
 		{
-			if (func.second.is<sol::protected_function>())
-			{
-				bool cont = callback(func.second.as<sol::protected_function>());
-				count++;
-				if (!cont)
-					break;
-			}
+			bool cont = callback(func);
+			count++;
+			if (!cont)
+				break;
 		}
-		return true;
 	}
 	return count;
 }
 
 bool lua_engine::execute_function(const char *id)
 {
-	int count = enumerate_functions(id, [this](const sol::protected_function &func)
+	// this runs every frame for the frame and periodic hooks, so skip the
+	// std::function wrapper and walk the cached references directly
+	auto const found = m_functions.find(id);
+	if (found == m_functions.end())
+		return false;
+	for (const sol::protected_function &func : found->second)
 	{
 		auto ret = invoke(func);
 		if(!ret.valid())
@@ -736,18 +782,19 @@ bool lua_engine::execute_function(const char *id)
 			sol::error err = ret;
 			osd_printf_error("[LUA ERROR] in execute_function: %s\n", err.what());
 		}
-		return true;
-	});
-	return count > 0;
+	}
+	return !found->second.empty();
 }
 
 void lua_engine::register_function(sol::function func, const char *id)
 {
-	sol::object functable = sol().registry()[id];
-	if(functable.is<sol::table>())
-		functable.as<sol::table>().add(func);
+	// keep a reference rather than a registry table entry so hooks don't
+	// need a table lookup and type check on every call
+	auto const found = m_functions.find(id);
+	if (found != m_functions.end())
+		found->second.emplace_back(func);
 	else
-		sol().registry().create_named(id, 1, func);
+		m_functions.emplace(id, std::vector<sol::protected_function>{ sol::protected_function(func) });
 }
 
 void lua_engine::on_machine_prestart()
@@ -1366,6 +1413,10 @@ void lua_engine::initialize()
  * machine:input() - get input_manager
  * machine:uiinput() - get ui_input_manager
  * machine:debugger() - get debugger_manager
+ * machine:scheduler_stats_enable(state) - start or stop collecting per-device scheduler statistics
+ * machine:scheduler_stats_reset() - clear collected scheduler statistics
+ * machine:memory_usage() - measure memory use now; returns a table with total and peak bytes and
+ *     entries[], each with category, device (tag), name, bytes and peak
  *
  * machine.paused - get paused state
  * machine.samplerate - get audio sample rate
@@ -1375,6 +1426,7 @@ void lua_engine::initialize()
  * machine.devices[] - get device table (k=tag, v=device_t)
  * machine.screens[] - get screens table (k=tag, v=screen_device)
  * machine.images[] - get available image devices table (k=type, v=device_image_interface)
+ * machine.scheduler_stats[] - get per-device scheduler statistics table (k=tag, v=table)
  */
 
 	auto machine_type = sol().registry().create_simple_usertype<running_machine>("new", sol::no_constructor);
@@ -1429,6 +1481,9 @@ void lua_engine::initialize()
 	machine_type.set("exit_pending", sol::property(&running_machine::exit_pending));
 	machine_type.set("hard_reset_pending", sol::property(&running_machine::hard_reset_pending));
 	machine_type.set("devices", sol::property([this](running_machine &m) {
+			// the tree doesn't change once everything has started
+			if (m_device_table && (&m == m_machine))
+				return *m_device_table;
 			std::function<void(device_t &, sol::table)> tree;
 			sol::table table = sol().create_table();
 			tree = [&tree](device_t &root, sol::table table) {
@@ -1442,6 +1497,8 @@ void lua_engine::initialize()
 				}
 			};
 			tree(m.root_device(), table);
+			if ((&m == m_machine) && (m.phase() >= machine_phase::RESET))
+				m_device_table = std::make_unique<sol::table>(table);
 			return table;
 		}));
 	machine_type.set("screens", sol::property([this](running_machine &r) {
@@ -1466,6 +1523,47 @@ void lua_engine::initialize()
 			[](running_machine &m, const char *str) { m.popmessage("%s", str); },
 			[](running_machine &m) { m.popmessage(); }));
 	machine_type.set("logerror", [](running_machine &m, const char *str) { m.logerror("[luaengine] %s\n", str); } );
+	machine_type.set("scheduler_stats_enable", [](running_machine &m, bool state) { m.scheduler().enable_statistics(state); });
+	machine_type.set("scheduler_stats_reset", [](running_machine &m) { m.scheduler().reset_statistics(); });
+	machine_type.set("memory_usage", [this](running_machine &m) {
+			memory_usage_manager &usage = m.memory_usage();
+			usage.update();
+			sol::table entries = sol().create_table();
+			int index = 1;
+			for (memory_usage_manager::entry const &ent : usage.entries())
+			{
+				sol::table entry = sol().create_table();
+				entry["category"] = ent.category;
+				entry["device"] = ent.device->tag();
+				entry["name"] = ent.name;
+				entry["bytes"] = ent.bytes;
+				entry["peak"] = ent.peak;
+				entries[index++] = entry;
+			}
+			sol::table table = sol().create_table();
+			table["total"] = usage.total();
+			table["peak"] = usage.peak_total();
+			table["entries"] = entries;
+			return table;
+		});
+	machine_type.set("scheduler_stats", sol::property([this](running_machine &m) {
+			sol::table table = sol().create_table();
+			double const ticks_per_second = double(osd_ticks_per_second());
+			for (device_execute_interface &exec : execute_interface_iterator(m.root_device()))
+			{
+				device_execute_interface::execute_stats const &stats = exec.stats();
+				sol::table entry = sol().create_table();
+				entry["timeslices"] = stats.timeslices;
+				entry["cycles_requested"] = stats.cycles_requested;
+				entry["cycles_executed"] = stats.cycles_executed;
+				entry["cycles_stolen"] = stats.cycles_stolen;
+				entry["aborts"] = stats.aborts;
+				entry["boosts"] = stats.boosts;
+				entry["run_seconds"] = double(stats.run_ticks) / ticks_per_second;
+				table[exec.device().tag()] = entry;
+			}
+			return table;
+		}));
 	sol().registry().set_usertype("machine", machine_type);
 
 
@@ -2846,6 +2944,7 @@ void lua_engine::initialize()
  * region:write_*(addr, val)
  *
  * region.size
+ * region:ptr() - host pointer to the raw contents as light userdata, for FFI access
  */
 
 	auto region_type = sol().registry().create_simple_usertype<memory_region>("new", sol::no_constructor);
@@ -2866,6 +2965,7 @@ void lua_engine::initialize()
 	region_type.set("write_i64", &region_write<int64_t>);
 	region_type.set("write_u64", &region_write<uint64_t>);
 	region_type.set("size", sol::property(&memory_region::bytes));
+	region_type.set("ptr", [](memory_region &region) { return static_cast<void *>(region.base()); });
 	sol().registry().set_usertype("region", region_type);
 
 
@@ -2878,6 +2978,7 @@ void lua_engine::initialize()
  * share:write_*(addr, val)
  *
  * region.size
+ * share:ptr() - host pointer to the raw contents as light userdata, for FFI access
 */
 
 	auto share_type = sol().registry().create_simple_usertype<memory_share>("new", sol::no_constructor);
@@ -2898,6 +2999,7 @@ void lua_engine::initialize()
 	share_type.set("write_i64", &share_write<int64_t>);
 	share_type.set("write_u64", &share_write<uint64_t>);
 	share_type.set("size", sol::property(&memory_share::bytes));
+	share_type.set("ptr", [](memory_share &share) { return share.ptr(); });
 	sol().registry().set_usertype("share", share_type);
 
 
@@ -3032,6 +3134,8 @@ bool lua_engine::frame_hook()
 
 void lua_engine::close()
 {
+	m_device_table.reset();
+	m_functions.clear();
 	m_sol_state.reset();
 	if (m_lua_state)
 	{
@@ -3046,7 +3150,11 @@ void lua_engine::resume(void *ptr, int nparam)
 	lua_rawgeti(m_lua_state, LUA_REGISTRYINDEX, nparam);
 	lua_State *L = lua_tothread(m_lua_state, -1);
 	lua_pop(m_lua_state, 1);
+#if defined(LUAJIT_VERSION)
+	int stat = lua_resume(L, 0);
+#else
 	int stat = lua_resume(L, nullptr, 0);
+#endif
 	if((stat != LUA_OK) && (stat != LUA_YIELD))
 	{
 		osd_printf_error("[LUA ERROR] in resume: %s\n", lua_tostring(L, -1));
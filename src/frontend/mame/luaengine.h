@@ -116,8 +116,10 @@ private:
 	std::unique_ptr<sol::state_view> m_sol_state;
 	running_machine *m_machine;
 	std::unique_ptr<input_sequence_poller> m_seq_poll;
+	std::unique_ptr<sol::table> m_device_table;     // machine().devices, once every device has started
 
 	std::vector<std::string> m_menu;
+	std::map<std::string, std::vector<sol::protected_function>, std::less<>> m_functions;
 
 	running_machine &machine() const { return *m_machine; }
 
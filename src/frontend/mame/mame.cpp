@@ -25,23 +25,88 @@
 #include "ui/inifile.h"
 #include "xmlfile.h"
 
+#include <rapidjson/writer.h>
+#include <rapidjson/stringbuffer.h>
+
+
+namespace {
+
+//**************************************************************************
+//  SERVER MODE HELPERS
+//**************************************************************************
+
+// the ROM sets of a system and its parents, to read ahead of a launch
+struct prewarm_request
+{
+	std::string                 searchpath;     // media path to look in
+	std::vector<std::string>    names;          // set names, system first
+};
+
+
+//-------------------------------------------------
+//  query_value - pull one decoded value out of a
+//  URL query string
+//-------------------------------------------------
+
+std::string query_value(const std::string &query, const char *key)
+{
+	size_t const keylen = strlen(key);
+	size_t start = (!query.empty() && query[0] == '?') ? 1 : 0;
+	while (start < query.length())
+	{
+		size_t end = query.find('&', start);
+		if (end == std::string::npos)
+			end = query.length();
+		if ((end - start > keylen) && !query.compare(start, keylen, key) && (query[start + keylen] == '='))
+		{
+			std::string result;
+			for (size_t pos = start + keylen + 1; pos < end; pos++)
+			{
+				if (query[pos] == '+')
+					result.push_back(' ');
+				else if ((query[pos] == '%') && (pos + 2 < end) && isxdigit(u8(query[pos + 1])) && isxdigit(u8(query[pos + 2])))
+				{
+					result.push_back(char(std::stoi(query.substr(pos + 1, 2), nullptr, 16)));
+					pos += 2;
+				}
+				else
+					result.push_back(query[pos]);
+			}
+			return result;
+		}
+		start = end + 1;
+	}
+	return std::string();
+}
+
+} // anonymous namespace
+
+
 //**************************************************************************
 //  MACHINE MANAGER
 //**************************************************************************
 
-mame_machine_manager* mame_machine_manager::m_manager = nullptr;
+// several machines can run in one process, each on its own thread with its
+// own options, OSD and manager; threads that never created a manager, like
+// work queue threads, see the first one created
+thread_local mame_machine_manager *mame_machine_manager::s_current = nullptr;
+std::atomic<mame_machine_manager *> mame_machine_manager::s_primary(nullptr);
 
 mame_machine_manager* mame_machine_manager::instance(emu_options &options, osd_interface &osd)
 {
-	if (!m_manager)
-		m_manager = global_alloc(mame_machine_manager(options, osd));
+	if (!s_current)
+	{
+		s_current = global_alloc(mame_machine_manager(options, osd));
+		mame_machine_manager *expected = nullptr;
+		s_primary.compare_exchange_strong(expected, s_current);
+	}
 
-	return m_manager;
+	return s_current;
 }
 
 mame_machine_manager* mame_machine_manager::instance()
 {
-	return m_manager;
+	return s_current ? s_current : s_primary.load();
 }
 
 //-------------------------------------------------
@@ -54,7 +119,9 @@ mame_machine_manager::mame_machine_manager(emu_options &options,osd_interface &o
 	m_lua(global_alloc(lua_engine)),
 	m_new_driver_pending(nullptr),
 	m_firstrun(true),
-	m_autoboot_timer(nullptr)
+	m_autoboot_timer(nullptr),
+	m_launch(std::make_shared<launch_request>()),
+	m_prewarm_queue(nullptr)
 {
 }
 
@@ -65,8 +132,16 @@ mame_machine_manager::mame_machine_manager(emu_options &options,osd_interface &o
 
 mame_machine_manager::~mame_machine_manager()
 {
+	if (m_prewarm_queue != nullptr)
+	{
+		osd_work_queue_wait(m_prewarm_queue, osd_ticks_per_second() * 10);
+		osd_work_queue_free(m_prewarm_queue);
+	}
 	global_free(m_lua);
-	m_manager = nullptr;
+	if (s_current == this)
+		s_current = nullptr;
+	mame_machine_manager *expected = this;
+	s_primary.compare_exchange_strong(expected, nullptr);
 }
 
 
@@ -207,7 +282,8 @@ void mame_machine_manager::start_luaengine()
 
 int mame_machine_manager::execute()
 {
-	bool started_empty = false;
+	// in server mode, a system exiting goes back to the empty system rather than quitting
+	bool started_empty = m_options.server();
 
 	bool firstgame = true;
 
@@ -299,6 +375,9 @@ TIMER_CALLBACK_MEMBER(mame_machine_manager::autoboot_callback)
 
 void mame_machine_manager::reset()
 {
+	// a warm restart relaunches the pending system in place
+	m_new_driver_pending = nullptr;
+
 	// setup autoboot if needed
 	m_autoboot_timer->adjust(attotime(options().autoboot_delay(),0),0);
 }
@@ -338,6 +417,150 @@ void mame_machine_manager::create_custom(running_machine& machine)
 
 	// start favorite manager
 	m_favorite = std::make_unique<favorite_manager>(m_ui->options());
+
+	// take launch requests in server mode
+	if (options().server() && http()->is_active())
+	{
+		add_launch_handler(machine);
+		machine.add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&mame_machine_manager::server_frame_update, this));
+	}
+}
+
+
+//-------------------------------------------------
+//  add_launch_handler - accept /api/launch with
+//  system, software and next query parameters;
+//  called on the server thread, so the request is
+//  only recorded here
+//-------------------------------------------------
+
+void mame_machine_manager::add_launch_handler(running_machine &machine)
+{
+	std::shared_ptr<launch_request> launch(m_launch);
+	http()->add_http_handler("/api/launch", [launch] (http_manager::http_request_ptr request, http_manager::http_response_ptr response)
+	{
+		std::string const query(request->get_query());
+		std::string const systemname(query_value(query, "system"));
+		std::string const nextname(query_value(query, "next"));
+		int const system = driver_list::find(systemname.c_str());
+		int const next = nextname.empty() ? -1 : driver_list::find(nextname.c_str());
+		if (system < 0 || (!nextname.empty() && next < 0))
+		{
+			response->set_status(404);
+			response->set_content_type("text/plain");
+			response->set_body(util::string_format("Unknown system %s\n", (system < 0) ? systemname : nextname));
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(launch->mutex);
+			launch->system = &driver_list::driver(system);
+			launch->software = query_value(query, "software");
+			launch->next = (next >= 0) ? &driver_list::driver(next) : nullptr;
+		}
+
+		rapidjson::StringBuffer s;
+		rapidjson::Writer<rapidjson::StringBuffer> writer(s);
+		writer.StartObject();
+		writer.Key("system");
+		writer.String(driver_list::driver(system).name);
+		writer.EndObject();
+
+		response->set_status(202);
+		response->set_content_type("application/json");
+		response->set_body(s.GetString());
+	});
+}
+
+
+//-------------------------------------------------
+//  server_frame_update - start a launch requested
+//  over HTTP
+//-------------------------------------------------
+
+void mame_machine_manager::server_frame_update()
+{
+	const game_driver *system;
+	const game_driver *next;
+	std::string software;
+	{
+		std::lock_guard<std::mutex> lock(m_launch->mutex);
+		system = m_launch->system;
+		if (system == nullptr)
+			return;
+		next = m_launch->next;
+		software = std::move(m_launch->software);
+		m_launch->system = nullptr;
+		m_launch->next = nullptr;
+	}
+
+	// same as launching from the system selection menu
+	emu_options &moptions(machine()->options());
+	moptions.set_system_name(system->name);
+	moptions.set_value(OPTION_SOFTWARENAME, software, OPTION_PRIORITY_CMDLINE);
+	schedule_new_driver(*system);
+	machine()->schedule_hard_reset();
+
+	if (next != nullptr)
+		queue_prewarm(*next);
+}
+
+
+//-------------------------------------------------
+//  queue_prewarm - read a system's ROM sets in the
+//  background, so they come from the OS file cache
+//  when it's launched
+//-------------------------------------------------
+
+void mame_machine_manager::queue_prewarm(const game_driver &driver)
+{
+	if (m_prewarm_queue == nullptr)
+		m_prewarm_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+	if (m_prewarm_queue == nullptr)
+		return;
+
+	auto request = std::make_unique<prewarm_request>();
+	request->searchpath = options().media_path();
+	for (int index = driver_list::find(driver); index >= 0; index = driver_list::clone(index))
+		request->names.emplace_back(driver_list::driver(index).name);
+
+	if (osd_work_item_queue(m_prewarm_queue, prewarm_static, request.get(), WORK_ITEM_FLAG_AUTO_RELEASE) != nullptr)
+		request.release();
+}
+
+
+//-------------------------------------------------
+//  prewarm_static - read every archive for a
+//  prewarm request and throw the data away
+//-------------------------------------------------
+
+void *mame_machine_manager::prewarm_static(void *param, int threadid)
+{
+	std::unique_ptr<prewarm_request> const request(reinterpret_cast<prewarm_request *>(param));
+	std::vector<u8> buffer(1024 * 1024);
+	for (std::string const &name : request->names)
+	{
+		for (char const *ext : { ".zip", ".7z" })
+		{
+			path_iterator iter(request->searchpath);
+			std::string path;
+			while (iter.next(path, (name + ext).c_str()))
+			{
+				osd_file::ptr file;
+				std::uint64_t size;
+				if (osd_file::open(path, OPEN_FLAG_READ, file, size) != osd_file::error::NONE)
+					continue;
+				std::uint32_t actual;
+				for (std::uint64_t offset = 0; offset < size; offset += actual)
+				{
+					if (file->read(&buffer[0], offset, buffer.size(), actual) != osd_file::error::NONE || actual == 0)
+						break;
+				}
+				break;
+			}
+		}
+	}
+	return nullptr;
 }
 
 void mame_machine_manager::load_cheatfiles(running_machine& machine)
@@ -12,6 +12,11 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+
 class plugin_options;
 class osd_interface;
 
@@ -71,19 +76,39 @@ private:
 	mame_machine_manager &operator=(mame_machine_manager const &) = delete;
 	mame_machine_manager &operator=(mame_machine_manager &&) = delete;
 
+	// a launch requested over HTTP, applied on the emulation thread
+	struct launch_request
+	{
+		std::mutex              mutex;          // protects everything below
+		const game_driver *     system = nullptr; // system to run, or nullptr if nothing pending
+		std::string             software;       // software to run it with
+		const game_driver *     next = nullptr; // system likely to be asked for after this one
+	};
+
+	// server mode helpers
+	void add_launch_handler(running_machine &machine);
+	void server_frame_update();
+	void queue_prewarm(const game_driver &driver);
+	static void *prewarm_static(void *param, int threadid);
+
 	std::unique_ptr<plugin_options> m_plugins;              // pointer to plugin options
 	lua_engine *            m_lua;
 
 	const game_driver *     m_new_driver_pending;   // pointer to the next pending driver
 	bool                    m_firstrun;
 
-	static mame_machine_manager* m_manager;
+	static thread_local mame_machine_manager *s_current;  // manager created on this thread
+	static std::atomic<mame_machine_manager *> s_primary;  // first manager, for threads that didn't create one
 	emu_timer               *m_autoboot_timer;      // autoboot timer
 	std::unique_ptr<mame_ui_manager> m_ui;                  // internal data from ui.cpp
 	std::unique_ptr<cheat_manager> m_cheat;            // internal data from cheat.cpp
 	std::unique_ptr<inifile_manager>   m_inifile;      // internal data from inifile.c for INIs
 	std::unique_ptr<favorite_manager>  m_favorite;     // internal data from inifile.c for favorites
 
+	// server mode
+	std::shared_ptr<launch_request> m_launch;       // launch requested over HTTP, shared with the handler
+	osd_work_queue *        m_prewarm_queue;        // queue reading the next system's ROMs ahead
+
 };
 
 //**************************************************************************
@@ -15,45 +15,14 @@
 #include "jedparse.h"
 #include "softlist_dev.h"
 
+#include <algorithm>
+#include <thread>
+
 
 //**************************************************************************
 //  MEDIA IDENTIFIER
 //**************************************************************************
 
-void media_identifier::file_info::match(
-		device_t const &device,
-		romload::file const &rom,
-		util::hash_collection const &hashes)
-{
-	if (hashes == m_hashes)
-	{
-		m_matches.emplace_back(
-				device.shortname(),
-				device.name(),
-				rom.get_name(),
-				hashes.flag(util::hash_collection::FLAG_BAD_DUMP),
-				device.owner());
-	}
-}
-
-void media_identifier::file_info::match(
-		std::string const &list,
-		software_info const &software,
-		rom_entry const &rom,
-		util::hash_collection const &hashes)
-{
-	if (hashes == m_hashes)
-	{
-		m_matches.emplace_back(
-				util::string_format("%s:%s", list, software.shortname()),
-				std::string(software.longname()),
-				ROM_GETNAME(&rom),
-				hashes.flag(util::hash_collection::FLAG_BAD_DUMP),
-				false);
-	}
-}
-
-
 //-------------------------------------------------
 //  media_identifier - constructor
 //-------------------------------------------------
@@ -63,6 +32,7 @@ media_identifier::media_identifier(emu_options &options)
 	, m_total(0)
 	, m_matches(0)
 	, m_nonroms(0)
+	, m_indexed(false)
 {
 }
 
@@ -75,7 +45,9 @@ media_identifier::media_identifier(emu_options &options)
 void media_identifier::identify(const char *filename)
 {
 	std::vector<file_info> info;
-	collect_files(info, filename);
+	std::vector<std::unique_ptr<hash_job> > jobs;
+	collect_files(info, jobs, filename);
+	digest_jobs(info, jobs);
 	match_hashes(info);
 	print_results(info);
 }
@@ -111,10 +83,11 @@ void media_identifier::identify_data(const char *name, const uint8_t *data, std:
 
 //-------------------------------------------------
 //  collect_files - pre-process files for
-//  identification
+//  identification; plain files are left as jobs
+//  to be hashed in parallel
 //-------------------------------------------------
 
-void media_identifier::collect_files(std::vector<file_info> &info, char const *path)
+void media_identifier::collect_files(std::vector<file_info> &info, std::vector<std::unique_ptr<hash_job> > &jobs, char const *path)
 {
 	// first try to open as a directory
 	osd::directory::ptr const directory = osd::directory::open(path);
@@ -126,7 +99,7 @@ void media_identifier::collect_files(std::vector<file_info> &info, char const *p
 			if (entry->type == osd::directory::entry::entry_type::FILE)
 			{
 				std::string const curfile = std::string(path).append(PATH_SEPARATOR).append(entry->name);
-				collect_files(info, curfile.c_str());
+				collect_files(info, jobs, curfile.c_str());
 			}
 		}
 	}
@@ -185,11 +158,22 @@ void media_identifier::collect_files(std::vector<file_info> &info, char const *p
 		// clear out any cached files
 		util::archive_file::cache_clear();
 	}
-	else
+	else if (core_filename_ends_with(path, ".chd") || core_filename_ends_with(path, ".jed"))
 	{
-		// otherwise, identify as a raw file
+		// CHDs and fusemaps need parsing rather than hashing
 		digest_file(info, path);
 	}
+	else
+	{
+		// otherwise, hash it as a raw file along with the others
+		auto job = std::make_unique<hash_job>();
+		job->path = path;
+		job->position = info.size();
+		job->length = 0;
+		job->opened = false;
+		job->complete = false;
+		jobs.emplace_back(std::move(job));
+	}
 }
 
 
@@ -263,20 +247,11 @@ void media_identifier::digest_file(std::vector<file_info> &info, char const *pat
 		if ((osd_file::error::NONE == util::core_file::open(path, OPEN_FLAG_READ, file)) && file)
 		{
 			util::hash_collection hashes;
-			hashes.begin(util::hash_collection::HASH_TYPES_CRC_SHA1);
-			std::uint8_t buf[1024];
-			for (std::uint64_t remaining = file->size(); remaining; )
+			if (!hash_file(*file, hashes))
 			{
-				std::uint32_t const block = std::min<std::uint64_t>(remaining, sizeof(buf));
-				if (file->read(buf, block) < block)
-				{
-					osd_printf_error("%s: error reading file\n", path);
-					return;
-				}
-				remaining -= block;
-				hashes.buffer(buf, block);
+				osd_printf_error("%s: error reading file\n", path);
+				return;
 			}
-			hashes.end();
 			info.emplace_back(path, file->size(), std::move(hashes), file_flavour::RAW);
 			m_total++;
 		}
@@ -326,72 +301,261 @@ void media_identifier::digest_data(std::vector<file_info> &info, char const *nam
 
 
 //-------------------------------------------------
-//  match_hashes - find known dumps that mach
-//  collected hashes
+//  digest_jobs - hash the plain files collected
+//  on all threads, and slot the results in among
+//  the other files in the order they were found
 //-------------------------------------------------
 
-void media_identifier::match_hashes(std::vector<file_info> &info)
+void media_identifier::digest_jobs(std::vector<file_info> &info, std::vector<std::unique_ptr<hash_job> > &jobs)
 {
-	if (info.empty())
+	if (jobs.empty())
 		return;
 
-	auto match_device =
-			[&info, listnames = std::unordered_set<std::string>()] (device_t &device) mutable
+	osd_work_queue *const queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	for (std::unique_ptr<hash_job> &job : jobs)
+	{
+		if (!queue || !osd_work_item_queue(queue, hash_job_static, job.get(), WORK_ITEM_FLAG_AUTO_RELEASE))
+			hash_job_static(job.get(), 0);
+	}
+	if (queue)
+	{
+		while (!osd_work_queue_wait(queue, osd_ticks_per_second()))
+		{
+		}
+		osd_work_queue_free(queue);
+	}
+
+	std::vector<file_info> merged;
+	merged.reserve(info.size() + jobs.size());
+	auto job = jobs.begin();
+	for (std::size_t i = 0; i <= info.size(); i++)
+	{
+		for ( ; (jobs.end() != job) && ((*job)->position == i); ++job)
+		{
+			hash_job &current(**job);
+			if (!current.opened)
 			{
-				// iterate over regions and files within the region
-				for (romload::region const &region : romload::entries(device.rom_region()).get_regions())
-				{
-					for (romload::file const &rom : region.get_files())
-					{
-						util::hash_collection const romhashes(rom.get_hashdata());
-						if (!romhashes.flag(util::hash_collection::FLAG_NO_DUMP))
-						{
-							for (file_info &file : info)
-								file.match(device, rom, romhashes);
-						}
-					}
-				}
+				osd_printf_error("%s: error opening file\n", current.path);
+			}
+			else if (!current.complete)
+			{
+				osd_printf_error("%s: error reading file\n", current.path);
+			}
+			else
+			{
+				merged.emplace_back(std::move(current.path), current.length, std::move(current.hashes), file_flavour::RAW);
+				m_total++;
+			}
+		}
+		if (info.size() > i)
+			merged.emplace_back(std::move(info[i]));
+	}
+	info = std::move(merged);
+	jobs.clear();
+}
 
-				// next iterate over softlists
-				for (software_list_device &swlistdev : software_list_device_iterator(device))
-				{
-					if (!listnames.insert(swlistdev.list_name()).second)
-						continue;
 
-					for (software_info const &swinfo : swlistdev.get_info())
-					{
-						for (software_part const &part : swinfo.parts())
-						{
-							for (rom_entry const *region = part.romdata().data(); region; region = rom_next_region(region))
-							{
-								for (rom_entry const *rom = rom_first_file(region); rom; rom = rom_next_file(rom))
-								{
-									util::hash_collection romhashes(ROM_GETHASHDATA(rom));
-									if (!romhashes.flag(util::hash_collection::FLAG_NO_DUMP))
-									{
-										for (file_info &file : info)
-											file.match(swlistdev.list_name(), swinfo, *rom, romhashes);
-									}
-								}
-							}
-						}
-					}
-				}
-			};
+//-------------------------------------------------
+//  hash_file - compute the CRC and SHA1 of a
+//  file's contents
+//-------------------------------------------------
+
+bool media_identifier::hash_file(util::core_file &file, util::hash_collection &hashes)
+{
+	std::vector<std::uint8_t> buf(64 * 1024);
+	hashes.begin(util::hash_collection::HASH_TYPES_CRC_SHA1);
+	for (std::uint64_t remaining = file.size(); remaining; )
+	{
+		std::uint32_t const block = std::min<std::uint64_t>(remaining, buf.size());
+		if (file.read(&buf[0], block) < block)
+			return false;
+		remaining -= block;
+		hashes.buffer(&buf[0], block);
+	}
+	hashes.end();
+	return true;
+}
+
+
+//-------------------------------------------------
+//  hash_job_static - hash a plain file on a
+//  worker thread
+//-------------------------------------------------
+
+void *media_identifier::hash_job_static(void *param, int threadid)
+{
+	hash_job &job(*reinterpret_cast<hash_job *>(param));
+	util::core_file::ptr file;
+	if ((osd_file::error::NONE == util::core_file::open(job.path, OPEN_FLAG_READ, file)) && file)
+	{
+		job.opened = true;
+		job.length = file->size();
+		job.complete = hash_file(*file, job.hashes);
+	}
+	return nullptr;
+}
 
-	// iterate over drivers
+
+//-------------------------------------------------
+//  build_index - gather the hashes of every known
+//  dump once, so each file can be looked up
+//  rather than compared against everything
+//-------------------------------------------------
+
+void media_identifier::build_index()
+{
+	std::unordered_set<std::string> listnames;
+
+	// iterate over drivers, building configurations ahead on all threads
+	m_drivlist.set_config_threads(std::thread::hardware_concurrency());
 	m_drivlist.reset();
 	while (m_drivlist.next())
-		match_device(m_drivlist.config()->root_device());
+		index_device(m_drivlist.config()->root_device(), listnames);
 
 	// iterator over registered device types
 	machine_config config(GAME_NAME(___empty), m_drivlist.options());
 	machine_config::token const tok(config.begin_configuration(config.root_device()));
 	for (device_type type : registered_device_types)
 	{
-		match_device(*config.device_add("_tmp", type, 0));
+		index_device(*config.device_add("_tmp", type, 0), listnames);
 		config.device_remove("_tmp");
 	}
+
+	m_indexed = true;
+}
+
+
+//-------------------------------------------------
+//  index_device - add a device's dumps and those
+//  of software lists not seen before
+//-------------------------------------------------
+
+void media_identifier::index_device(device_t &device, std::unordered_set<std::string> &listnames)
+{
+	// iterate over regions and files within the region
+	std::size_t owner = m_owners.size();
+	for (romload::region const &region : romload::entries(device.rom_region()).get_regions())
+	{
+		for (romload::file const &rom : region.get_files())
+		{
+			util::hash_collection romhashes(rom.get_hashdata());
+			if (!romhashes.flag(util::hash_collection::FLAG_NO_DUMP))
+			{
+				if (m_owners.size() == owner)
+					m_owners.push_back(dump_owner{ device.shortname(), device.name(), device.owner() != nullptr });
+				add_dump(owner, rom.get_name(), std::move(romhashes));
+			}
+		}
+	}
+
+	// next iterate over softlists
+	for (software_list_device &swlistdev : software_list_device_iterator(device))
+	{
+		if (!listnames.insert(swlistdev.list_name()).second)
+			continue;
+
+		for (software_info const &swinfo : swlistdev.get_info())
+		{
+			owner = m_owners.size();
+			for (software_part const &part : swinfo.parts())
+			{
+				for (rom_entry const *region = part.romdata().data(); region; region = rom_next_region(region))
+				{
+					for (rom_entry const *rom = rom_first_file(region); rom; rom = rom_next_file(rom))
+					{
+						util::hash_collection romhashes(ROM_GETHASHDATA(rom));
+						if (!romhashes.flag(util::hash_collection::FLAG_NO_DUMP))
+						{
+							if (m_owners.size() == owner)
+							{
+								m_owners.push_back(dump_owner{
+										util::string_format("%s:%s", swlistdev.list_name(), swinfo.shortname()),
+										std::string(swinfo.longname()),
+										false });
+							}
+							add_dump(owner, ROM_GETNAME(rom), std::move(romhashes));
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  add_dump - add a known dump to the index
+//-------------------------------------------------
+
+void media_identifier::add_dump(std::size_t owner, std::string &&romname, util::hash_collection &&hashes)
+{
+	std::size_t const index = m_dumps.size();
+	std::uint32_t crc;
+	util::sha1_t sha1;
+	bool const hascrc = hashes.crc(crc);
+	bool const hassha1 = hashes.sha1(sha1);
+	if (!hascrc && !hassha1)
+		return;
+
+	if (hascrc)
+		m_crc_index.emplace(crc, index);
+	if (hassha1)
+		m_sha1_index.emplace(sha1_key(sha1), index);
+	m_dumps.push_back(known_dump{ owner, std::move(romname), std::move(hashes) });
+}
+
+
+//-------------------------------------------------
+//  match_hashes - find known dumps that mach
+//  collected hashes
+//-------------------------------------------------
+
+void media_identifier::match_hashes(std::vector<file_info> &info)
+{
+	if (info.empty())
+		return;
+
+	if (!m_indexed)
+		build_index();
+
+	std::vector<std::size_t> candidates;
+	for (file_info &file : info)
+	{
+		// anything sharing a CRC or the start of a SHA1 is a candidate
+		candidates.clear();
+		std::uint32_t crc;
+		util::sha1_t sha1;
+		if (file.hashes().crc(crc))
+		{
+			auto const range = m_crc_index.equal_range(crc);
+			for (auto it = range.first; range.second != it; ++it)
+				candidates.push_back(it->second);
+		}
+		if (file.hashes().sha1(sha1))
+		{
+			auto const range = m_sha1_index.equal_range(sha1_key(sha1));
+			for (auto it = range.first; range.second != it; ++it)
+				candidates.push_back(it->second);
+		}
+
+		// report matches in the order the dumps were found
+		std::sort(candidates.begin(), candidates.end());
+		candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+		for (std::size_t const index : candidates)
+		{
+			known_dump const &dump(m_dumps[index]);
+			if (dump.hashes == file.hashes())
+			{
+				dump_owner const &owner(m_owners[dump.owner]);
+				file.add_match(match_data(
+						std::string(owner.shortname),
+						std::string(owner.fullname),
+						std::string(dump.romname),
+						dump.hashes.flag(util::hash_collection::FLAG_BAD_DUMP),
+						owner.device));
+			}
+		}
+	}
 }
 
 
@@ -13,6 +13,10 @@
 #include "drivenum.h"
 #include "romload.h"
 
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 
@@ -105,8 +109,7 @@ private:
 		file_flavour flavour() const { return m_flavour; }
 		std::vector<match_data> const &matches() const { return m_matches; }
 
-		void match(device_t const &device, romload::file const &rom, util::hash_collection const &hashes);
-		void match(std::string const &list, software_info const &software, rom_entry const &rom, util::hash_collection const &hashes);
+		void add_match(match_data &&match) { m_matches.emplace_back(std::move(match)); }
 
 	private:
 		std::string             m_name;
@@ -116,16 +119,60 @@ private:
 		std::vector<match_data> m_matches;
 	};
 
-	void collect_files(std::vector<file_info> &info, char const *path);
+	// a plain file hashed on a worker thread, to be slotted in before
+	// the collected file at the given position
+	struct hash_job
+	{
+		std::string             path;
+		std::size_t             position;
+		std::uint64_t           length;
+		util::hash_collection   hashes;
+		bool                    opened;
+		bool                    complete;
+	};
+
+	// a device, driver or software item that known dumps belong to
+	struct dump_owner
+	{
+		std::string             shortname;
+		std::string             fullname;
+		bool                    device;
+	};
+
+	// a known dump, indexed by CRC and SHA1
+	struct known_dump
+	{
+		std::size_t             owner;
+		std::string             romname;
+		util::hash_collection   hashes;
+	};
+
+	void collect_files(std::vector<file_info> &info, std::vector<std::unique_ptr<hash_job> > &jobs, char const *path);
 	void digest_file(std::vector<file_info> &info, char const *path);
 	void digest_data(std::vector<file_info> &info, char const *name, void const *data, std::uint64_t length);
+	void digest_jobs(std::vector<file_info> &info, std::vector<std::unique_ptr<hash_job> > &jobs);
+	void build_index();
+	void index_device(device_t &device, std::unordered_set<std::string> &listnames);
+	void add_dump(std::size_t owner, std::string &&romname, util::hash_collection &&hashes);
 	void match_hashes(std::vector<file_info> &info);
 	void print_results(std::vector<file_info> const &info);
 
+	static bool hash_file(util::core_file &file, util::hash_collection &hashes);
+	static void *hash_job_static(void *param, int threadid);
+	static std::uint32_t sha1_key(util::sha1_t const &sha1) { return (std::uint32_t(sha1.m_raw[0]) << 24) | (sha1.m_raw[1] << 16) | (sha1.m_raw[2] << 8) | sha1.m_raw[3]; }
+
 	driver_enumerator       m_drivlist;
 	unsigned                m_total;
 	unsigned                m_matches;
 	unsigned                m_nonroms;
+
+	// known dumps, gathered from every driver, device and software list
+	// the first time anything needs matching
+	bool                    m_indexed;
+	std::vector<dump_owner> m_owners;
+	std::vector<known_dump> m_dumps;
+	std::unordered_multimap<std::uint32_t, std::size_t> m_crc_index;
+	std::unordered_multimap<std::uint32_t, std::size_t> m_sha1_index;
 };
 
 
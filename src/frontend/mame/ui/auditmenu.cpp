@@ -187,38 +187,52 @@ void menu_audit::handle()
 
 void menu_audit::audit_fast()
 {
+	std::vector<ui_system_info *> pending;
+	std::vector<int> drivers;
 	for (ui_system_info &info : m_availablesorted)
 	{
 		if (!info.available)
 		{
-			m_current.store(info.driver);
-			driver_enumerator enumerator(machine().options(), info.driver->name);
-			enumerator.next();
-			media_auditor auditor(enumerator);
-			media_auditor::summary const summary(auditor.audit_media(AUDIT_VALIDATE_FAST));
-			info.available = (summary == media_auditor::CORRECT) || (summary == media_auditor::BEST_AVAILABLE) || (summary == media_auditor::NONE_NEEDED);
-
-			// if everything looks good, include the driver
-			info.available = (summary == media_auditor::CORRECT) || (summary == media_auditor::BEST_AVAILABLE) || (summary == media_auditor::NONE_NEEDED);
-			++m_audited;
+			pending.emplace_back(&info);
+			drivers.emplace_back(info.index);
 		}
 	}
+
+	// results arrive in the order the drivers were given
+	auto next = pending.begin();
+	parallel_auditor(machine().options(), std::thread::hardware_concurrency()).audit_media(
+			drivers,
+			[this, &next] (int, media_auditor const &, media_auditor::summary summary)
+			{
+				ui_system_info &info(**next++);
+				m_current.store(info.driver);
+
+				// if everything looks good, include the driver
+				info.available = (summary == media_auditor::CORRECT) || (summary == media_auditor::BEST_AVAILABLE) || (summary == media_auditor::NONE_NEEDED);
+				++m_audited;
+			},
+			AUDIT_VALIDATE_FAST);
 }
 
 void menu_audit::audit_all()
 {
 	driver_enumerator enumerator(machine().options());
-	media_auditor auditor(enumerator);
-	std::vector<bool> available(driver_list::total(), false);
+	std::vector<int> drivers;
 	while (enumerator.next())
-	{
-		m_current.store(&enumerator.driver());
-		media_auditor::summary const summary(auditor.audit_media(AUDIT_VALIDATE_FAST));
+		drivers.emplace_back(enumerator.current());
 
-		// if everything looks good, include the driver
-		available[enumerator.current()] = (summary == media_auditor::CORRECT) || (summary == media_auditor::BEST_AVAILABLE) || (summary == media_auditor::NONE_NEEDED);
-		++m_audited;
-	}
+	std::vector<bool> available(driver_list::total(), false);
+	parallel_auditor(machine().options(), std::thread::hardware_concurrency()).audit_media(
+			drivers,
+			[this, &available] (int index, media_auditor const &, media_auditor::summary summary)
+			{
+				m_current.store(&driver_list::driver(index));
+
+				// if everything looks good, include the driver
+				available[index] = (summary == media_auditor::CORRECT) || (summary == media_auditor::BEST_AVAILABLE) || (summary == media_auditor::NONE_NEEDED);
+				++m_audited;
+			},
+			AUDIT_VALIDATE_FAST);
 
 	for (ui_system_info &info : m_availablesorted)
 		info.available = available[info.index];
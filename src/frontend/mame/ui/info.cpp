@@ -11,6 +11,7 @@
 #include "emu.h"
 
 #include "ui/info.h"
+#include "ui/systeminfo.h"
 #include "ui/ui.h"
 
 #include "drivenum.h"
@@ -68,6 +69,20 @@ machine_static_info::machine_static_info(const ui_options &options, machine_conf
 {
 }
 
+machine_static_info::machine_static_info(const ui_options &options, system_info_record const &record)
+	: m_options(options)
+	, m_flags(::machine_flags::type(record.machine_flags))
+	, m_unemulated_features(device_t::feature_type(record.unemulated_features))
+	, m_imperfect_features(device_t::feature_type(record.imperfect_features))
+	, m_has_bioses(record.info & system_info_record::HAS_BIOSES)
+	, m_has_dips(record.info & system_info_record::HAS_DIPS)
+	, m_has_configs(record.info & system_info_record::HAS_CONFIGS)
+	, m_has_keyboard(record.info & system_info_record::HAS_KEYBOARD)
+	, m_has_test_switch(record.info & system_info_record::HAS_TEST_SWITCH)
+	, m_has_analog(record.info & system_info_record::HAS_ANALOG)
+{
+}
+
 machine_static_info::machine_static_info(const ui_options &options, machine_config const &config, ioport_list const *ports)
 	: m_options(options)
 	, m_flags(config.gamedrv().flags)
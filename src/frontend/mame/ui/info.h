@@ -17,11 +17,14 @@
 
 namespace ui {
 
+struct system_info_record;
+
 class machine_static_info
 {
 public:
 	// construction
 	machine_static_info(const ui_options &options, machine_config const &config);
+	machine_static_info(const ui_options &options, system_info_record const &record);
 
 	// overall emulation status
 	::machine_flags::type machine_flags() const { return m_flags; }
@@ -18,6 +18,7 @@
 #include "ui/optsmenu.h"
 #include "ui/selector.h"
 #include "ui/selsoft.h"
+#include "ui/systeminfo.h"
 #include "ui/ui.h"
 
 #include "infoxml.h"
@@ -67,13 +68,16 @@ public:
 
 	~persistent_data()
 	{
+		m_cancel.store(true, std::memory_order_relaxed);
 		if (m_thread)
 			m_thread->join();
 	}
 
-	void cache_data()
+	void cache_data(std::string const &ui_path)
 	{
 		std::unique_lock<std::mutex> lock(m_mutex);
+		if (!m_started)
+			m_ui_path = ui_path;
 		do_start_caching();
 	}
 
@@ -125,9 +129,12 @@ public:
 private:
 	persistent_data()
 		: m_started(false)
+		, m_cancel(false)
 		, m_available(AVAIL_NONE)
 		, m_bios_count(0)
 	{
+		// the cache must outlive the thread building it
+		system_info_cache::instance();
 	}
 
 	void notify_available(available value)
@@ -160,6 +167,11 @@ private:
 					++m_bios_count;
 
 				m_sorted_list.emplace_back(driver, x, false);
+				if (std::strcmp(driver.parent, "0"))
+				{
+					int const cx(driver_list::find(driver.parent));
+					m_sorted_list.back().is_clone = (cx == -1) || !(driver_list::driver(cx).flags & machine_flags::IS_BIOS_ROOT);
+				}
 				m_filter_data.add_manufacturer(driver.manufacturer);
 				m_filter_data.add_year(driver.year);
 			}
@@ -199,6 +211,11 @@ private:
 			info.ucs_manufacturer_description = ustr_from_utf8(normalize_unicode(buf, unicode_normalization_form::D, true));
 		}
 		notify_available(AVAIL_UCS_MANUF_DESC);
+
+		// instantiate machine configurations for system information if the
+		// file for this build couldn't be loaded
+		if (!m_ui_path.empty())
+			system_info_cache::instance().build(m_ui_path, m_cancel);
 	}
 
 	// synchronisation
@@ -206,7 +223,9 @@ private:
 	std::condition_variable         m_condition;
 	std::unique_ptr<std::thread>    m_thread;
 	std::atomic<bool>               m_started;
+	std::atomic<bool>               m_cancel;
 	std::atomic<unsigned>           m_available;
+	std::string                     m_ui_path;
 
 	// data
 	std::vector<ui_system_info>     m_sorted_list;
@@ -234,8 +253,9 @@ menu_select_game::menu_select_game(mame_ui_manager &mui, render_container &conta
 	std::string error_string, last_filter, sub_filter;
 	ui_options &moptions = mui.options();
 
-	// load drivers cache
-	m_persistent_data.cache_data();
+	// load drivers cache and precomputed system information
+	system_info_cache::instance().load(moptions.ui_path());
+	m_persistent_data.cache_data(moptions.ui_path());
 
 	// check if there are available system icons
 	check_for_icons(nullptr);
@@ -513,23 +533,12 @@ void menu_select_game::populate(float &customtop, float &custombottom)
 		// if search is not empty, find approximate matches
 		if (!m_search.empty())
 		{
-			populate_search();
-			if (flt)
-			{
-				for (auto it = m_searchlist.begin(); (m_searchlist.end() != it) && (MAX_VISIBLE_SEARCH > m_displaylist.size()); ++it)
-				{
-					if (flt->apply(it->second))
-						m_displaylist.emplace_back(it->second);
-				}
-			}
-			else
-			{
-				std::transform(
-						m_searchlist.begin(),
-						std::next(m_searchlist.begin(), (std::min)(m_searchlist.size(), MAX_VISIBLE_SEARCH)),
-						std::back_inserter(m_displaylist),
-						[] (auto const &entry) { return entry.second; });
-			}
+			populate_search(flt);
+			std::transform(
+					m_searchlist.begin(),
+					m_searchlist.end(),
+					std::back_inserter(m_displaylist),
+					[] (auto const &entry) { return entry.second; });
 		}
 		else
 		{
@@ -548,15 +557,7 @@ void menu_select_game::populate(float &customtop, float &custombottom)
 			if (old_item_selected == -1 && elem.driver->name == reselect_last::driver())
 				old_item_selected = curitem;
 
-			bool cloneof = strcmp(elem.driver->parent, "0");
-			if (cloneof)
-			{
-				int cx = driver_list::find(elem.driver->parent);
-				if (cx != -1 && ((driver_list::driver(cx).flags & machine_flags::IS_BIOS_ROOT) != 0))
-					cloneof = false;
-			}
-
-			item_append(elem.driver->type.fullname(), "", (cloneof) ? (FLAGS_UI | FLAG_INVERT) : FLAGS_UI, (void *)elem.driver);
+			item_append(std::string(elem.driver->type.fullname()), std::string(), elem.is_clone ? (FLAGS_UI | FLAG_INVERT) : FLAGS_UI, (void *)elem.driver);
 			curitem++;
 		}
 	}
@@ -798,7 +799,7 @@ void menu_select_game::inkey_select(const event *menu_event)
 		{
 			for (software_list_device &swlistdev : software_list_device_iterator(enumerator.config()->root_device()))
 			{
-				if (!swlistdev.get_info().empty())
+				if (swlistdev.valid())
 				{
 					menu::stack_push<menu_select_software>(ui(), container(), *driver);
 					return;
@@ -868,7 +869,7 @@ void menu_select_game::inkey_select_favorite(const event *menu_event)
 		{
 			for (software_list_device &swlistdev : software_list_device_iterator(enumerator.config()->root_device()))
 			{
-				if (!swlistdev.get_info().empty())
+				if (swlistdev.valid())
 				{
 					menu::stack_push<menu_select_software>(ui(), container(), *ui_swinfo->driver);
 					return;
@@ -961,61 +962,55 @@ void menu_select_game::change_info_pane(int delta)
 //  populate search list
 //-------------------------------------------------
 
-void menu_select_game::populate_search()
+void menu_select_game::populate_search(machine_filter const *flt)
 {
-	// ensure search list is populated
-	if (m_searchlist.empty())
+	// only systems that pass the filter need scoring
+	std::vector<ui_system_info> const &sorted(m_persistent_data.sorted_list());
+	m_searchlist.clear();
+	m_searchlist.reserve(sorted.size());
+	for (ui_system_info const &info : sorted)
 	{
-		std::vector<ui_system_info> const &sorted(m_persistent_data.sorted_list());
-		m_searchlist.reserve(sorted.size());
-		for (ui_system_info const &info : sorted)
+		if (!flt || flt->apply(info))
 			m_searchlist.emplace_back(1.0, std::ref(info));
 	}
 
 	// keep track of what we matched against
 	const std::u32string ucs_search(ustr_from_utf8(normalize_unicode(m_search, unicode_normalization_form::D, true)));
-
-	// match shortnames
-	if (m_persistent_data.is_available(persistent_data::AVAIL_UCS_SHORTNAME))
-	{
+	bool const shortname(m_persistent_data.is_available(persistent_data::AVAIL_UCS_SHORTNAME));
+	bool const description(m_persistent_data.is_available(persistent_data::AVAIL_UCS_DESCRIPTION));
+	bool const manuf_desc(m_persistent_data.is_available(persistent_data::AVAIL_UCS_MANUF_DESC));
+	if (shortname)
 		m_searched_fields |= persistent_data::AVAIL_UCS_SHORTNAME;
-		for (std::pair<double, std::reference_wrapper<ui_system_info const> > &info : m_searchlist)
-			info.first = util::edit_distance(ucs_search, info.second.get().ucs_shortname);
-	}
-
-	// match descriptions
-	if (m_persistent_data.is_available(persistent_data::AVAIL_UCS_DESCRIPTION))
-	{
+	if (description)
 		m_searched_fields |= persistent_data::AVAIL_UCS_DESCRIPTION;
-		for (std::pair<double, std::reference_wrapper<ui_system_info const> > &info : m_searchlist)
-		{
-			if (info.first)
-			{
-				double const penalty(util::edit_distance(ucs_search, info.second.get().ucs_description));
-				info.first = (std::min)(penalty, info.first);
-			}
-		}
-	}
-
-	// match "<manufacturer> <description>"
-	if (m_persistent_data.is_available(persistent_data::AVAIL_UCS_MANUF_DESC))
-	{
+	if (manuf_desc)
 		m_searched_fields |= persistent_data::AVAIL_UCS_MANUF_DESC;
-		for (std::pair<double, std::reference_wrapper<ui_system_info const> > &info : m_searchlist)
-		{
-			if (info.first)
-			{
-				double const penalty(util::edit_distance(ucs_search, info.second.get().ucs_manufacturer_description));
-				info.first = (std::min)(penalty, info.first);
-			}
-		}
-	}
 
-	// sort according to edit distance
-	std::stable_sort(
+	// match shortnames, descriptions and "<manufacturer> <description>"
+	score_matches(
+			m_searchlist.begin(),
+			m_searchlist.end(),
+			[&ucs_search, shortname, description, manuf_desc] (std::pair<double, std::reference_wrapper<ui_system_info const> > &info)
+			{
+				if (shortname)
+					info.first = util::edit_distance(ucs_search, info.second.get().ucs_shortname);
+				if (description && info.first)
+					info.first = (std::min)(util::edit_distance(ucs_search, info.second.get().ucs_description), info.first);
+				if (manuf_desc && info.first)
+					info.first = (std::min)(util::edit_distance(ucs_search, info.second.get().ucs_manufacturer_description), info.first);
+			});
+
+	// keep the closest matches, breaking ties by position in the sorted list
+	auto const shown(std::next(m_searchlist.begin(), (std::min)(m_searchlist.size(), MAX_VISIBLE_SEARCH)));
+	std::partial_sort(
 			m_searchlist.begin(),
+			shown,
 			m_searchlist.end(),
-			[] (auto const &lhs, auto const &rhs) { return lhs.first < rhs.first; });
+			[] (auto const &lhs, auto const &rhs)
+			{
+				return (lhs.first < rhs.first) || ((lhs.first == rhs.first) && (&lhs.second.get() < &rhs.second.get()));
+			});
+	m_searchlist.erase(shown, m_searchlist.end());
 }
 
 //-------------------------------------------------
@@ -1223,17 +1218,6 @@ render_texture *menu_select_game::get_icon_texture(int linenum, void *selectedre
 		if (m_icon_paths.empty())
 			m_icon_paths = make_icon_paths(nullptr);
 
-		// allocate an entry or allocate a texture on forced redraw
-		if (m_icons.end() == icon)
-		{
-			icon = m_icons.emplace(driver, texture_ptr(machine().render().texture_alloc(), machine().render())).first;
-		}
-		else
-		{
-			assert(!icon->second.texture);
-			icon->second.texture.reset(machine().render().texture_alloc());
-		}
-
 		// set clone status
 		bool cloneof = strcmp(driver->parent, "0");
 		if (cloneof)
@@ -1243,17 +1227,20 @@ render_texture *menu_select_game::get_icon_texture(int linenum, void *selectedre
 				cloneof = false;
 		}
 
+		// icons are decoded in the background - draw without one until it's ready
 		bitmap_argb32 tmp;
-		emu_file snapfile(std::string(m_icon_paths), OPEN_FLAG_READ);
-		if (snapfile.open(std::string(driver->name) + ".ico") == osd_file::error::NONE)
+		if (!load_icon(m_icon_paths, driver->name, cloneof ? driver->parent : nullptr, tmp))
+			return nullptr;
+
+		// allocate an entry or allocate a texture on forced redraw
+		if (m_icons.end() == icon)
 		{
-			render_load_ico_highest_detail(snapfile, tmp);
-			snapfile.close();
+			icon = m_icons.emplace(driver, texture_ptr(machine().render().texture_alloc(), machine().render())).first;
 		}
-		if (!tmp.valid() && cloneof && (snapfile.open(std::string(driver->parent) + ".ico") == osd_file::error::NONE))
+		else
 		{
-			render_load_ico_highest_detail(snapfile, tmp);
-			snapfile.close();
+			assert(!icon->second.texture);
+			icon->second.texture.reset(machine().render().texture_alloc());
 		}
 
 		scale_icon(std::move(tmp), icon->second);
@@ -1371,20 +1358,20 @@ float menu_select_game::draw_left_panel(float x1, float y1, float x2, float y2)
 
 
 //-------------------------------------------------
-//  get selected software and/or driver
+//  get software and/or driver for an item
 //-------------------------------------------------
 
-void menu_select_game::get_selection(ui_software_info const *&software, game_driver const *&driver) const
+void menu_select_game::get_entry(void *ref, ui_software_info const *&software, game_driver const *&driver) const
 {
 	if (m_populated_favorites)
 	{
-		software = reinterpret_cast<ui_software_info const *>(get_selection_ptr());
+		software = reinterpret_cast<ui_software_info const *>(ref);
 		driver = software ? software->driver : nullptr;
 	}
 	else
 	{
 		software = nullptr;
-		driver = reinterpret_cast<game_driver const *>(get_selection_ptr());
+		driver = reinterpret_cast<game_driver const *>(ref);
 	}
 }
 
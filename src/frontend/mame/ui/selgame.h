@@ -62,7 +62,7 @@ private:
 	virtual render_texture *get_icon_texture(int linenum, void *selectedref) override;
 
 	// get selected software and/or driver
-	virtual void get_selection(ui_software_info const *&software, game_driver const *&driver) const override;
+	virtual void get_entry(void *ref, ui_software_info const *&software, game_driver const *&driver) const override;
 	virtual bool accept_search() const override { return !isfavorite(); }
 
 	// text for main top/bottom panels
@@ -82,7 +82,7 @@ private:
 	void build_available_list();
 
 	bool isfavorite() const;
-	void populate_search();
+	void populate_search(machine_filter const *flt);
 	bool load_available_machines();
 	void load_custom_filters();
 
@@ -12,8 +12,10 @@
 #include "ui/selmenu.h"
 
 #include "ui/datmenu.h"
+#include "ui/icorender.h"
 #include "ui/info.h"
 #include "ui/inifile.h"
+#include "ui/systeminfo.h"
 
 // these hold static bitmap images
 #include "ui/defimg.ipp"
@@ -36,7 +38,13 @@
 
 #include <algorithm>
 #include <cmath>
+#include <condition_variable>
 #include <cstring>
+#include <deque>
+#include <list>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 
@@ -99,6 +107,245 @@ char const *const hover_msg[] = {
 constexpr std::size_t menu_select_launch::MAX_VISIBLE_SEARCH; // stupid non-inline semantics
 
 
+//-------------------------------------------------
+//  image loader - decodes artwork and icons on a
+//  worker thread so slow storage doesn't stall
+//  the menu, keeping recently used images up to
+//  a memory budget
+//-------------------------------------------------
+
+class menu_select_launch::image_loader
+{
+public:
+	using image_ptr = std::shared_ptr<bitmap_argb32 const>;
+
+	// files to try in order, each a directory (or empty) and a file name
+	struct request
+	{
+		std::string searchpath;
+		std::vector<std::pair<std::string, std::string> > files;
+
+		void add(std::string const &dir, std::string const &name)
+		{
+			files.emplace_back(dir, name + ".png");
+			files.emplace_back(dir, name + ".jpg");
+		}
+
+		std::string key() const
+		{
+			std::string result(searchpath);
+			for (auto const &file : files)
+				result.append(1, '\n').append(file.first).append(1, '/').append(file.second);
+			return result;
+		}
+	};
+
+	image_loader()
+		: m_bytes(0)
+		, m_exit(false)
+		, m_thread([this] () { worker(); })
+	{
+	}
+
+	~image_loader()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_exit = true;
+		}
+		m_condition.notify_all();
+		m_thread.join();
+	}
+
+	// the image if it's been decoded (invalid if nothing was found), or nullptr while it's loading
+	image_ptr fetch(request &&req)
+	{
+		std::string key(req.key());
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto const found(m_index.find(key));
+		if (m_index.end() != found)
+		{
+			m_images.splice(m_images.begin(), m_images, found->second);
+			return found->second->second;
+		}
+		enqueue(std::move(key), std::move(req), true);
+		return nullptr;
+	}
+
+	// load an image that will probably be wanted soon
+	void prefetch(request &&req)
+	{
+		std::string key(req.key());
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_index.end() == m_index.find(key))
+			enqueue(std::move(key), std::move(req), false);
+	}
+
+	static request snapshot(std::string const &searchpath, ui_software_info const *software, game_driver const *driver)
+	{
+		request result;
+		result.searchpath = searchpath;
+		if (software && (!software->startempty || !driver))
+		{
+			if (software->startempty == 1)
+			{
+				// driver snapshot
+				result.add(std::string(), software->driver->name);
+			}
+			else
+			{
+				// first from the list name, then from driver name + part name
+				result.add(software->listname, software->shortname);
+				result.add(std::string(software->driver->name) + software->part, software->shortname);
+			}
+		}
+		else if (driver)
+		{
+			// saved "0000" file first, then the system, then the parent
+			result.files.emplace_back(driver->name, "0000.png");
+			result.files.emplace_back(driver->name, "0000.jpg");
+			result.add(std::string(), driver->name);
+			if (std::strcmp(driver->parent, "0"))
+			{
+				int const cx(driver_list::find(driver->parent));
+				if ((cx < 0) || !(driver_list::driver(cx).flags & machine_flags::IS_BIOS_ROOT))
+					result.add(std::string(), driver->parent);
+			}
+		}
+		return result;
+	}
+
+	static request icon(std::string const &searchpath, char const *name, char const *parent)
+	{
+		request result;
+		result.searchpath = searchpath;
+		result.files.emplace_back(std::string(), std::string(name) + ".ico");
+		if (parent)
+			result.files.emplace_back(std::string(), std::string(parent) + ".ico");
+		return result;
+	}
+
+private:
+	static constexpr std::size_t MAX_QUEUED = 64;
+	static constexpr std::size_t MAX_CACHED_BYTES = 64 * 1024 * 1024;
+
+	using image_list = std::list<std::pair<std::string, image_ptr> >;
+
+	// call with the lock held
+	void enqueue(std::string &&key, request &&req, bool urgent)
+	{
+		if (!m_queued.emplace(key).second)
+		{
+			// already waiting or being loaded - move it up if it's wanted now
+			if (urgent)
+			{
+				auto const waiting(std::find_if(m_queue.begin(), m_queue.end(), [&key] (auto const &entry) { return entry.first == key; }));
+				if ((m_queue.end() != waiting) && (m_queue.begin() != waiting))
+				{
+					auto entry(std::move(*waiting));
+					m_queue.erase(waiting);
+					m_queue.emplace_front(std::move(entry));
+				}
+			}
+			return;
+		}
+
+		// the most recent requests are the most interesting, so drop the oldest
+		if (urgent)
+			m_queue.emplace_front(std::move(key), std::move(req));
+		else
+			m_queue.emplace_back(std::move(key), std::move(req));
+		while (m_queue.size() > MAX_QUEUED)
+		{
+			m_queued.erase(m_queue.back().first);
+			m_queue.pop_back();
+		}
+		m_condition.notify_one();
+	}
+
+	void worker()
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		while (true)
+		{
+			m_condition.wait(lock, [this] () { return m_exit || !m_queue.empty(); });
+			if (m_exit)
+				return;
+
+			std::pair<std::string, request> entry(std::move(m_queue.front()));
+			m_queue.pop_front();
+			lock.unlock();
+			image_ptr image(load(entry.second));
+			lock.lock();
+
+			// keep it, then evict the least recently used images until we're back under budget
+			m_queued.erase(entry.first);
+			m_bytes += image_bytes(*image);
+			m_images.emplace_front(entry.first, std::move(image));
+			m_index[entry.first] = m_images.begin();
+			while ((m_bytes > MAX_CACHED_BYTES) && (m_images.size() > 1))
+			{
+				m_bytes -= image_bytes(*m_images.back().second);
+				m_index.erase(m_images.back().first);
+				m_images.pop_back();
+			}
+		}
+	}
+
+	static image_ptr load(request const &req)
+	{
+		auto result(std::make_shared<bitmap_argb32>());
+		try
+		{
+			emu_file file(req.searchpath, OPEN_FLAG_READ);
+			for (auto const &name : req.files)
+			{
+				char const *const dir(name.first.empty() ? nullptr : name.first.c_str());
+				std::string::size_type const len(name.second.length());
+				if ((4 <= len) && !core_stricmp(&name.second[len - 4], ".ico"))
+				{
+					if (file.open(name.second) == osd_file::error::NONE)
+					{
+						render_load_ico_highest_detail(file, *result);
+						file.close();
+					}
+				}
+				else if ((4 <= len) && !core_stricmp(&name.second[len - 4], ".jpg"))
+				{
+					render_load_jpeg(*result, file, dir, name.second.c_str());
+				}
+				else
+				{
+					render_load_png(*result, file, dir, name.second.c_str());
+				}
+				if (result->valid())
+					break;
+			}
+		}
+		catch (...)
+		{
+			result->reset();
+		}
+		return result;
+	}
+
+	static std::size_t image_bytes(bitmap_argb32 const &bitmap)
+	{
+		return bitmap.valid() ? (std::size_t(bitmap.rowpixels()) * bitmap.height() * sizeof(u32)) : 0;
+	}
+
+	std::mutex                          m_mutex;
+	std::condition_variable             m_condition;
+	std::deque<std::pair<std::string, request> > m_queue;   // waiting requests, most urgent first
+	std::unordered_set<std::string>     m_queued;           // keys waiting or being loaded
+	image_list                          m_images;           // decoded images, most recently used first
+	std::unordered_map<std::string, image_list::iterator> m_index;
+	std::size_t                         m_bytes;            // memory used by decoded images
+	bool                                m_exit;
+	std::thread                         m_thread;
+};
+
+
 class menu_select_launch::software_parts : public menu
 {
 public:
@@ -375,7 +622,8 @@ void menu_select_launch::bios_selection::custom_render(void *selectedref, float
 
 
 menu_select_launch::cache::cache(running_machine &machine)
-	: m_snapx_bitmap(std::make_unique<bitmap_argb32>(0, 0))
+	: m_images(std::make_unique<image_loader>())
+	, m_snapx_bitmap(std::make_unique<bitmap_argb32>(0, 0))
 	, m_snapx_texture(nullptr, machine.render())
 	, m_snapx_driver(nullptr)
 	, m_snapx_software(nullptr)
@@ -538,6 +786,11 @@ menu_select_launch::system_flags const &menu_select_launch::get_system_flags(gam
 	if (m_flags.end() != found)
 		return found->second;
 
+	// use the precomputed information if it's available for this build
+	system_info_record const *const record(system_info_cache::instance().find(driver_list::find(driver)));
+	if (record)
+		return m_flags.emplace(&driver, machine_static_info(ui().options(), *record)).first->second;
+
 	// aggregate flags
 	emu_options clean_options;
 	machine_config const mconfig(driver, clean_options);
@@ -1160,6 +1413,28 @@ bool menu_select_launch::scale_icon(bitmap_argb32 &&src, texture_and_bitmap &dst
 }
 
 
+//-------------------------------------------------
+//  load_icon - get a decoded icon, returning
+//  false while it's still being loaded
+//-------------------------------------------------
+
+bool menu_select_launch::load_icon(std::string const &searchpath, char const *name, char const *parent, bitmap_argb32 &bitmap)
+{
+	image_loader::image_ptr const image(m_cache->images().fetch(image_loader::icon(searchpath, name, parent)));
+	if (!image)
+		return false;
+
+	bitmap.reset();
+	if (image->valid())
+	{
+		bitmap.allocate(image->width(), image->height());
+		for (int y = 0; y < image->height(); y++)
+			std::copy_n(&image->pix32(y), image->width(), &bitmap.pix32(y));
+	}
+	return true;
+}
+
+
 template <typename T> bool menu_select_launch::select_bios(T const &driver, bool inlist)
 {
 	s_bios biosname;
@@ -2219,52 +2494,8 @@ void menu_select_launch::arts_render(float origx1, float origy1, float origx2, f
 		// loads the image if necessary
 		if (!m_cache->snapx_software_is(software) || !snapx_valid() || m_switch_image)
 		{
-			emu_file snapfile(searchstr.c_str(), OPEN_FLAG_READ);
-			bitmap_argb32 tmp_bitmap;
-
-			if (software->startempty == 1)
-			{
-				// Load driver snapshot
-				std::string fullname = std::string(software->driver->name) + ".png";
-				render_load_png(tmp_bitmap, snapfile, nullptr, fullname.c_str());
-
-				if (!tmp_bitmap.valid())
-				{
-					fullname.assign(software->driver->name).append(".jpg");
-					render_load_jpeg(tmp_bitmap, snapfile, nullptr, fullname.c_str());
-				}
-			}
-			else
-			{
-				// First attempt from name list
-				std::string pathname = software->listname;
-				std::string fullname = software->shortname + ".png";
-				render_load_png(tmp_bitmap, snapfile, pathname.c_str(), fullname.c_str());
-
-				if (!tmp_bitmap.valid())
-				{
-					fullname.assign(software->shortname).append(".jpg");
-					render_load_jpeg(tmp_bitmap, snapfile, pathname.c_str(), fullname.c_str());
-				}
-
-				if (!tmp_bitmap.valid())
-				{
-					// Second attempt from driver name + part name
-					pathname.assign(software->driver->name).append(software->part);
-					fullname.assign(software->shortname).append(".png");
-					render_load_png(tmp_bitmap, snapfile, pathname.c_str(), fullname.c_str());
-
-					if (!tmp_bitmap.valid())
-					{
-						fullname.assign(software->shortname).append(".jpg");
-						render_load_jpeg(tmp_bitmap, snapfile, pathname.c_str(), fullname.c_str());
-					}
-				}
-			}
-
-			m_cache->set_snapx_software(software);
-			m_switch_image = false;
-			arts_render_images(std::move(tmp_bitmap), origx1, origy1, origx2, origy2);
+			if (load_snapshot(searchstr, software, driver, origx1, origy1, origx2, origy2))
+				m_cache->set_snapx_software(software);
 		}
 
 		// if the image is available, loaded and valid, display it
@@ -2282,61 +2513,67 @@ void menu_select_launch::arts_render(float origx1, float origy1, float origx2, f
 		// loads the image if necessary
 		if (!m_cache->snapx_driver_is(driver) || !snapx_valid() || m_switch_image)
 		{
-			emu_file snapfile(searchstr, OPEN_FLAG_READ);
-			bitmap_argb32 tmp_bitmap;
+			if (load_snapshot(searchstr, nullptr, driver, origx1, origy1, origx2, origy2))
+				m_cache->set_snapx_driver(driver);
+		}
 
-			// try to load snapshot first from saved "0000.png" file
-			std::string fullname(driver->name);
-			render_load_png(tmp_bitmap, snapfile, fullname.c_str(), "0000.png");
+		// if the image is available, loaded and valid, display it
+		draw_snapx(origx1, origy1, origx2, origy2);
+	}
+}
 
-			if (!tmp_bitmap.valid())
-				render_load_jpeg(tmp_bitmap, snapfile, fullname.c_str(), "0000.jpg");
 
-			// if fail, attemp to load from standard file
-			if (!tmp_bitmap.valid())
-			{
-				fullname.assign(driver->name).append(".png");
-				render_load_png(tmp_bitmap, snapfile, nullptr, fullname.c_str());
+//-------------------------------------------------
+//  load_snapshot - show the artwork for an entry
+//  if it has been decoded, otherwise clear the
+//  panel and wait for the loader
+//-------------------------------------------------
 
-				if (!tmp_bitmap.valid())
-				{
-					fullname.assign(driver->name).append(".jpg");
-					render_load_jpeg(tmp_bitmap, snapfile, nullptr, fullname.c_str());
-				}
-			}
+bool menu_select_launch::load_snapshot(std::string const &searchpath, ui_software_info const *software, game_driver const *driver, float origx1, float origy1, float origx2, float origy2)
+{
+	image_loader::image_ptr const image(m_cache->images().fetch(image_loader::snapshot(searchpath, software, driver)));
+	prefetch_snapshots(searchpath);
+	if (!image)
+	{
+		m_cache->snapx_bitmap().reset();
+		return false;
+	}
 
-			// if fail again, attemp to load from parent file
-			if (!tmp_bitmap.valid())
-			{
-				// set clone status
-				bool cloneof = strcmp(driver->parent, "0");
-				if (cloneof)
-				{
-					int cx = driver_list::find(driver->parent);
-					if ((cx >= 0) && (driver_list::driver(cx).flags & machine_flags::IS_BIOS_ROOT))
-						cloneof = false;
-				}
+	bitmap_argb32 tmp_bitmap;
+	if (image->valid())
+	{
+		tmp_bitmap.allocate(image->width(), image->height());
+		for (int y = 0; y < image->height(); y++)
+			std::copy_n(&image->pix32(y), image->width(), &tmp_bitmap.pix32(y));
+	}
+	m_switch_image = false;
+	arts_render_images(std::move(tmp_bitmap), origx1, origy1, origx2, origy2);
+	return true;
+}
 
-				if (cloneof)
-				{
-					fullname.assign(driver->parent).append(".png");
-					render_load_png(tmp_bitmap, snapfile, nullptr, fullname.c_str());
 
-					if (!tmp_bitmap.valid())
-					{
-						fullname.assign(driver->parent).append(".jpg");
-						render_load_jpeg(tmp_bitmap, snapfile, nullptr, fullname.c_str());
-					}
-				}
-			}
+//-------------------------------------------------
+//  prefetch_snapshots - queue artwork for the
+//  entries either side of the selection
+//-------------------------------------------------
 
-			m_cache->set_snapx_driver(driver);
-			m_switch_image = false;
-			arts_render_images(std::move(tmp_bitmap), origx1, origy1, origx2, origy2);
-		}
+void menu_select_launch::prefetch_snapshots(std::string const &searchpath)
+{
+	static constexpr int PREFETCH_DISTANCE = 2;
 
-		// if the image is available, loaded and valid, display it
-		draw_snapx(origx1, origy1, origx2, origy2);
+	for (int distance = 1; distance <= PREFETCH_DISTANCE; distance++)
+	{
+		for (int index : { selected_index() + distance, selected_index() - distance })
+		{
+			if ((0 > index) || (item_count() <= index) || (uintptr_t(item(index).ref) <= skip_main_items))
+				continue;
+
+			ui_software_info const *software;
+			game_driver const *driver;
+			get_entry(item(index).ref, software, driver);
+			if (software || driver)
+				m_cache->images().prefetch(image_loader::snapshot(searchpath, software, driver));
+		}
 	}
 }
 
@@ -14,9 +14,13 @@
 
 #include "ui/menu.h"
 
+#include <algorithm>
+#include <future>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <vector>
 
 
@@ -35,6 +39,7 @@ public:
 protected:
 	static constexpr std::size_t MAX_ICONS_RENDER = 128;
 	static constexpr std::size_t MAX_VISIBLE_SEARCH = 200;
+	static constexpr std::size_t MIN_SEARCH_CHUNK = 1024;
 
 	// tab navigation
 	enum class focused_menu
@@ -142,6 +147,7 @@ protected:
 	void check_for_icons(char const *listname);
 	std::string make_icon_paths(char const *listname) const;
 	bool scale_icon(bitmap_argb32 &&src, texture_and_bitmap &dst) const;
+	bool load_icon(std::string const &searchpath, char const *name, char const *parent, bitmap_argb32 &bitmap);
 
 	// forcing refresh
 	void set_switch_image() { m_switch_image = true; }
@@ -149,11 +155,38 @@ protected:
 	template <typename T> bool select_bios(T const &driver, bool inlist);
 	bool select_part(software_info const &info, ui_software_info const &ui_info);
 
+	// apply a search scoring function to every candidate, spread over the hardware threads
+	template <typename Iterator, typename Function>
+	static void score_matches(Iterator first, Iterator last, Function const &score)
+	{
+		std::size_t const count(std::distance(first, last));
+		std::size_t const threads((std::min<std::size_t>)((std::max)(std::thread::hardware_concurrency(), 1U), (count + MIN_SEARCH_CHUNK - 1) / MIN_SEARCH_CHUNK));
+		if (threads <= 1)
+		{
+			std::for_each(first, last, score);
+			return;
+		}
+
+		// this thread takes the first chunk while the others work through the rest
+		std::vector<std::future<void> > workers;
+		workers.reserve(threads - 1);
+		for (std::size_t i = 1; i < threads; ++i)
+		{
+			Iterator const begin(std::next(first, count * i / threads));
+			Iterator const end(std::next(first, count * (i + 1) / threads));
+			workers.emplace_back(std::async(std::launch::async, [begin, end, &score] () { std::for_each(begin, end, score); }));
+		}
+		std::for_each(first, std::next(first, count / threads), score);
+		for (std::future<void> &worker : workers)
+			worker.get();
+	}
+
 	void *get_selection_ptr() const
 	{
 		void *const selected_ref(get_selection_ref());
 		return (uintptr_t(selected_ref) > skip_main_items) ? selected_ref : m_prev_selected;
 	}
+	void get_selection(ui_software_info const *&software, game_driver const *&driver) const { get_entry(get_selection_ptr(), software, driver); }
 
 	int         m_available_items;
 	int         skip_main_items;
@@ -172,6 +205,7 @@ private:
 
 	class software_parts;
 	class bios_selection;
+	class image_loader;
 
 	class cache
 	{
@@ -179,6 +213,8 @@ private:
 		cache(running_machine &machine);
 		~cache();
 
+		image_loader &images() { return *m_images; }
+
 		bitmap_argb32 &snapx_bitmap() { return *m_snapx_bitmap; }
 		render_texture *snapx_texture() { return m_snapx_texture.get(); }
 		bool snapx_driver_is(game_driver const *value) const { return m_snapx_driver == value; }
@@ -195,6 +231,7 @@ private:
 		texture_ptr_vector const &sw_toolbar_texture() { return m_sw_toolbar_texture; }
 
 	private:
+		std::unique_ptr<image_loader> m_images;
 		bitmap_ptr              m_snapx_bitmap;
 		texture_ptr             m_snapx_texture;
 		game_driver const       *m_snapx_driver;
@@ -229,7 +266,7 @@ private:
 	virtual void general_info(const game_driver *driver, std::string &buffer) = 0;
 
 	// get selected software and/or driver
-	virtual void get_selection(ui_software_info const *&software, game_driver const *&driver) const = 0;
+	virtual void get_entry(void *ref, ui_software_info const *&software, game_driver const *&driver) const = 0;
 	virtual bool accept_search() const { return true; }
 	void select_prev()
 	{
@@ -278,6 +315,8 @@ private:
 	void arts_render(float origx1, float origy1, float origx2, float origy2);
 	std::string arts_render_common(float origx1, float origy1, float origx2, float origy2);
 	void arts_render_images(bitmap_argb32 &&bitmap, float origx1, float origy1, float origx2, float origy2);
+	bool load_snapshot(std::string const &searchpath, ui_software_info const *software, game_driver const *driver, float origx1, float origy1, float origx2, float origy2);
+	void prefetch_snapshots(std::string const &searchpath);
 	void draw_snapx(float origx1, float origy1, float origx2, float origy2);
 
 	// text for main top/bottom panels
@@ -281,24 +281,8 @@ void menu_select_software::populate(float &customtop, float &custombottom)
 	}
 	else
 	{
-		find_matches();
-
-		if (m_filters.end() == flt)
-		{
-			std::transform(
-					m_searchlist.begin(),
-					std::next(m_searchlist.begin(), (std::min)(m_searchlist.size(), MAX_VISIBLE_SEARCH)),
-					std::back_inserter(m_displaylist),
-					[] (search_item const &entry) { return entry.software; });
-		}
-		else
-		{
-			for (auto it = m_searchlist.begin(); (m_searchlist.end() != it) && (MAX_VISIBLE_SEARCH > m_displaylist.size()); ++it)
-			{
-				if (flt->second->apply(it->software))
-					m_displaylist.emplace_back(it->software);
-			}
-		}
+		// find approximate matches
+		find_matches((m_filters.end() == flt) ? nullptr : flt->second.get());
 	}
 
 	// iterate over entries
@@ -358,25 +342,25 @@ void menu_select_software::build_software_list()
 		orphans.clear();
 		std::map<std::string, std::string> parentnames;
 		std::map<std::string, std::string>::const_iterator prevparent(parentnames.end());
-		for (const software_info &swinfo : swlist.get_info())
+		for (const software_index_entry &swinfo : swlist.index())
 		{
 			// check for previously-encountered clones
-			if (swinfo.parentname().empty())
+			if (swinfo.parentname.empty())
 			{
-				if (parentnames.emplace(swinfo.shortname(), swinfo.longname()).second)
+				if (parentnames.emplace(swinfo.shortname, swinfo.longname).second)
 				{
-					auto const clones(std::equal_range(orphans.begin(), orphans.end(), swinfo.shortname(), orphan_cmp));
+					auto const clones(std::equal_range(orphans.begin(), orphans.end(), swinfo.shortname, orphan_cmp));
 					for (auto it = clones.first; clones.second != it; ++it)
-						m_swinfo[*it].parentlongname = swinfo.longname();
+						m_swinfo[*it].parentlongname = swinfo.longname;
 					orphans.erase(clones.first, clones.second);
 				}
 				else
 				{
-					assert([] (auto const x) { return x.first == x.second; } (std::equal_range(orphans.begin(), orphans.end(), swinfo.shortname(), orphan_cmp)));
+					assert([] (auto const x) { return x.first == x.second; } (std::equal_range(orphans.begin(), orphans.end(), swinfo.shortname, orphan_cmp)));
 				}
 			}
 
-			const software_part &part = swinfo.parts().front();
+			const software_index_part &part = swinfo.parts.front();
 			if (swlist.is_compatible(part) == SOFTWARE_IS_COMPATIBLE)
 			{
 				char const *instance_name(nullptr);
@@ -396,10 +380,10 @@ void menu_select_software::build_software_list()
 				{
 					// add to collection and try to resolve parent if applicable
 					auto const ins(m_swinfo.emplace(m_swinfo.end(), swinfo, part, m_driver, swlist.list_name(), instance_name, type_name));
-					if (!swinfo.parentname().empty())
+					if (!swinfo.parentname.empty())
 					{
-						if ((parentnames.end() == prevparent) || (swinfo.parentname() != prevparent->first))
-							prevparent = parentnames.find(swinfo.parentname());
+						if ((parentnames.end() == prevparent) || (swinfo.parentname != prevparent->first))
+							prevparent = parentnames.find(swinfo.parentname);
 
 						if (parentnames.end() != prevparent)
 						{
@@ -408,7 +392,7 @@ void menu_select_software::build_software_list()
 						else
 						{
 							orphans.emplace(
-									std::upper_bound(orphans.begin(), orphans.end(), swinfo.parentname(), orphan_cmp),
+									std::upper_bound(orphans.begin(), orphans.end(), swinfo.parentname, orphan_cmp),
 									std::distance(m_swinfo.begin(), ins));
 						}
 					}
@@ -534,7 +518,7 @@ void menu_select_software::load_sw_custom_filters()
 //  find approximate matches
 //-------------------------------------------------
 
-void menu_select_software::find_matches()
+void menu_select_software::find_matches(software_filter const *flt)
 {
 	// ensure search list is populated
 	if (m_searchlist.empty())
@@ -543,16 +527,37 @@ void menu_select_software::find_matches()
 		std::copy(m_swinfo.begin(), m_swinfo.end(), std::back_inserter(m_searchlist));
 	}
 
-	// update search
-	const std::u32string ucs_search(ustr_from_utf8(normalize_unicode(m_search, unicode_normalization_form::D, true)));
+	// only software that passes the filter needs scoring
+	std::vector<search_item *> candidates;
+	candidates.reserve(m_searchlist.size());
 	for (search_item &entry : m_searchlist)
-		entry.set_penalty(ucs_search);
+	{
+		if (!flt || flt->apply(entry.software))
+			candidates.emplace_back(&entry);
+	}
 
-	// sort according to edit distance
-	std::stable_sort(
-			m_searchlist.begin(),
-			m_searchlist.end(),
-			[] (search_item const &lhs, search_item const &rhs) { return lhs.penalty < rhs.penalty; });
+	// update search
+	const std::u32string ucs_search(ustr_from_utf8(normalize_unicode(m_search, unicode_normalization_form::D, true)));
+	score_matches(
+			candidates.begin(),
+			candidates.end(),
+			[&ucs_search] (search_item *entry) { entry->set_penalty(ucs_search); });
+
+	// show the closest matches, breaking ties by position in the list
+	auto const shown(std::next(candidates.begin(), (std::min)(candidates.size(), MAX_VISIBLE_SEARCH)));
+	std::partial_sort(
+			candidates.begin(),
+			shown,
+			candidates.end(),
+			[] (search_item const *lhs, search_item const *rhs)
+			{
+				return (lhs->penalty < rhs->penalty) || ((lhs->penalty == rhs->penalty) && (lhs < rhs));
+			});
+	std::transform(
+			candidates.begin(),
+			shown,
+			std::back_inserter(m_displaylist),
+			[] (search_item const *entry) { return entry->software; });
 }
 
 //-------------------------------------------------
@@ -584,6 +589,11 @@ render_texture *menu_select_software::get_icon_texture(int linenum, void *select
 		if (m_icon_paths.end() == paths)
 			paths = m_icon_paths.emplace(swinfo->listname, make_icon_paths(swinfo->listname.c_str())).first;
 
+		// icons are decoded in the background - draw without one until it's ready
+		bitmap_argb32 tmp;
+		if (!load_icon(paths->second, swinfo->shortname.c_str(), swinfo->parentname.empty() ? nullptr : swinfo->parentname.c_str(), tmp))
+			return nullptr;
+
 		// allocate an entry or allocate a texture on forced redraw
 		if (m_icons.end() == icon)
 		{
@@ -595,19 +605,6 @@ render_texture *menu_select_software::get_icon_texture(int linenum, void *select
 			icon->second.texture.reset(machine().render().texture_alloc());
 		}
 
-		bitmap_argb32 tmp;
-		emu_file snapfile(std::string(paths->second), OPEN_FLAG_READ);
-		if (snapfile.open(std::string(swinfo->shortname) + ".ico") == osd_file::error::NONE)
-		{
-			render_load_ico_highest_detail(snapfile, tmp);
-			snapfile.close();
-		}
-		if (!tmp.valid() && !swinfo->parentname.empty() && (snapfile.open(std::string(swinfo->parentname) + ".ico") == osd_file::error::NONE))
-		{
-			render_load_ico_highest_detail(snapfile, tmp);
-			snapfile.close();
-		}
-
 		scale_icon(std::move(tmp), icon->second);
 	}
 
@@ -616,12 +613,12 @@ render_texture *menu_select_software::get_icon_texture(int linenum, void *select
 
 
 //-------------------------------------------------
-//  get selected software and/or driver
+//  get software and/or driver for an item
 //-------------------------------------------------
 
-void menu_select_software::get_selection(ui_software_info const *&software, game_driver const *&driver) const
+void menu_select_software::get_entry(void *ref, ui_software_info const *&software, game_driver const *&driver) const
 {
-	software = reinterpret_cast<ui_software_info const *>(get_selection_ptr());
+	software = reinterpret_cast<ui_software_info const *>(ref);
 	driver = software ? software->driver : nullptr;
 }
 
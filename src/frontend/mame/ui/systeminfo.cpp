@@ -0,0 +1,267 @@
+// license:BSD-3-Clause
+// copyright-holders:Vas Crabb
+/***************************************************************************
+
+    ui/systeminfo.cpp
+
+    Cache of per-system information derived from machine configurations
+
+    Instantiating a machine configuration is by far the most expensive part
+    of showing a system in the selection menu, so the results are computed
+    once per build and kept in a file in the UI path.  The file is a fixed
+    header, the build string and one record per driver in driver list
+    order.  It is mapped read-only where the OSD layer supports it.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "ui/systeminfo.h"
+
+#include "ui/info.h"
+#include "ui/moptions.h"
+
+#include "drivenum.h"
+#include "emuopts.h"
+#include "fileio.h"
+#include "romload.h"
+#include "screen.h"
+#include "softlist_dev.h"
+
+#include <cstring>
+
+
+namespace ui {
+
+namespace {
+
+constexpr char SYSINFO_MAGIC[4] = { 'M', 'S', 'Y', 'S' };
+constexpr u32 SYSINFO_FORMAT = 1U;
+
+// written in host byte order - the file is only ever read by the build
+// that wrote it
+struct sysinfo_header
+{
+	char    magic[4];
+	u32     format;
+	u32     record_size;
+	u32     count;
+	u32     build_length;
+	u32     reserved;
+};
+
+constexpr std::size_t records_offset(std::size_t build_length)
+{
+	return (sizeof(sysinfo_header) + build_length + 7) & ~std::size_t(7);
+}
+
+std::string sysinfo_filename()
+{
+	return std::string(emulator_info::get_configname()) + "_sysinfo.dat";
+}
+
+system_info_record make_record(ui_options const &options, machine_config const &config)
+{
+	machine_static_info const info(options, config);
+	system_info_record result;
+	result.machine_flags = info.machine_flags();
+	result.unemulated_features = info.unemulated_features();
+	result.imperfect_features = info.imperfect_features();
+	result.info =
+			(info.has_bioses() ? system_info_record::HAS_BIOSES : 0U) |
+			(info.has_dips() ? system_info_record::HAS_DIPS : 0U) |
+			(info.has_configs() ? system_info_record::HAS_CONFIGS : 0U) |
+			(info.has_keyboard() ? system_info_record::HAS_KEYBOARD : 0U) |
+			(info.has_test_switch() ? system_info_record::HAS_TEST_SWITCH : 0U) |
+			(info.has_analog() ? system_info_record::HAS_ANALOG : 0U);
+	result.rom_bytes = 0U;
+
+	if (software_list_device_iterator(config.root_device()).first())
+		result.info |= system_info_record::HAS_SOFTWARE_LISTS;
+
+	for (screen_device &screen : screen_device_iterator(config.root_device()))
+	{
+		switch (screen.screen_type())
+		{
+		case SCREEN_TYPE_RASTER:    result.info |= system_info_record::SCREEN_RASTER;   break;
+		case SCREEN_TYPE_VECTOR:    result.info |= system_info_record::SCREEN_VECTOR;   break;
+		case SCREEN_TYPE_LCD:       result.info |= system_info_record::SCREEN_LCD;      break;
+		case SCREEN_TYPE_SVG:       result.info |= system_info_record::SCREEN_SVG;      break;
+		default: break;
+		}
+	}
+
+	for (device_t &device : device_iterator(config.root_device()))
+	{
+		for (rom_entry const *region = rom_first_region(device); region; region = rom_next_region(region))
+			result.rom_bytes += ROMREGION_GETLENGTH(region);
+	}
+
+	return result;
+}
+
+} // anonymous namespace
+
+
+
+//-------------------------------------------------
+//  instance - get the single cache
+//-------------------------------------------------
+
+system_info_cache &system_info_cache::instance()
+{
+	static system_info_cache cache;
+	return cache;
+}
+
+
+//-------------------------------------------------
+//  system_info_cache - constructor/destructor
+//-------------------------------------------------
+
+system_info_cache::system_info_cache()
+	: m_records(nullptr)
+	, m_count(0U)
+{
+}
+
+system_info_cache::~system_info_cache()
+{
+}
+
+
+//-------------------------------------------------
+//  load - map or read the file for this build
+//-------------------------------------------------
+
+bool system_info_cache::load(std::string const &path)
+{
+	std::lock_guard<std::mutex> guard(m_mutex);
+	if (m_records.load(std::memory_order_acquire))
+		return true;
+
+	auto file(std::make_unique<emu_file>(path, OPEN_FLAG_READ));
+	if (file->open(sysinfo_filename()) != osd_file::error::NONE)
+		return false;
+
+	// prefer a view of the file, falling back to reading it
+	void const *view;
+	u64 length;
+	util::core_file &core(*file);
+	if (core.map_view(view, length) == osd_file::error::NONE)
+	{
+		if (parse(reinterpret_cast<u8 const *>(view), length))
+		{
+			m_file = std::move(file);
+			m_records.store(reinterpret_cast<system_info_record const *>(reinterpret_cast<u8 const *>(view) + (length - m_count * sizeof(system_info_record))), std::memory_order_release);
+			return true;
+		}
+		return false;
+	}
+
+	std::vector<u8> data(file->size());
+	if (data.empty() || (file->read(&data[0], data.size()) != data.size()) || !parse(&data[0], data.size()))
+		return false;
+	m_data = std::move(data);
+	m_records.store(reinterpret_cast<system_info_record const *>(&m_data[m_data.size() - (m_count * sizeof(system_info_record))]), std::memory_order_release);
+	return true;
+}
+
+
+//-------------------------------------------------
+//  build - instantiate every machine
+//  configuration and save the results
+//-------------------------------------------------
+
+bool system_info_cache::build(std::string const &path, std::atomic<bool> const &cancel)
+{
+	if (m_records.load(std::memory_order_acquire))
+		return true;
+
+	char const *const build(emulator_info::get_build_version());
+	std::size_t const buildlen(std::strlen(build));
+	std::size_t const offset(records_offset(buildlen));
+	std::size_t const count(driver_list::total());
+	std::vector<u8> data(offset + (count * sizeof(system_info_record)), 0U);
+
+	sysinfo_header header;
+	std::memcpy(header.magic, SYSINFO_MAGIC, sizeof(header.magic));
+	header.format = SYSINFO_FORMAT;
+	header.record_size = sizeof(system_info_record);
+	header.count = count;
+	header.build_length = buildlen;
+	header.reserved = 0U;
+	std::memcpy(&data[0], &header, sizeof(header));
+	std::memcpy(&data[sizeof(header)], build, buildlen);
+
+	ui_options const options;
+	emu_options clean_options;
+	system_info_record *const records(reinterpret_cast<system_info_record *>(&data[offset]));
+	for (std::size_t i = 0; count > i; ++i)
+	{
+		if (cancel.load(std::memory_order_relaxed))
+			return false;
+		machine_config const config(driver_list::driver(i), clean_options);
+		records[i] = make_record(options, config);
+	}
+
+	// save it before publishing so nothing else is touching the buffer
+	emu_file file(path, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(sysinfo_filename()) == osd_file::error::NONE)
+	{
+		if (file.write(&data[0], data.size()) != data.size())
+			osd_printf_verbose("Error writing system information cache %s\n", file.fullpath());
+		file.close();
+	}
+
+	std::lock_guard<std::mutex> guard(m_mutex);
+	if (!m_records.load(std::memory_order_acquire))
+	{
+		m_data = std::move(data);
+		m_count = count;
+		m_records.store(reinterpret_cast<system_info_record const *>(&m_data[offset]), std::memory_order_release);
+	}
+	return true;
+}
+
+
+//-------------------------------------------------
+//  find - get the record for a driver
+//-------------------------------------------------
+
+system_info_record const *system_info_cache::find(int index) const
+{
+	system_info_record const *const records(m_records.load(std::memory_order_acquire));
+	if (!records || (0 > index) || (m_count <= std::size_t(index)))
+		return nullptr;
+	return &records[index];
+}
+
+
+//-------------------------------------------------
+//  parse - check that file contents belong to
+//  this build and driver list
+//-------------------------------------------------
+
+bool system_info_cache::parse(u8 const *data, u64 length)
+{
+	sysinfo_header header;
+	if (sizeof(header) > length)
+		return false;
+	std::memcpy(&header, data, sizeof(header));
+	if (std::memcmp(header.magic, SYSINFO_MAGIC, sizeof(header.magic)) || (SYSINFO_FORMAT != header.format) || (sizeof(system_info_record) != header.record_size))
+		return false;
+
+	char const *const build(emulator_info::get_build_version());
+	std::size_t const count(driver_list::total());
+	if ((count != header.count) || (std::strlen(build) != header.build_length))
+		return false;
+	if ((records_offset(header.build_length) + (count * sizeof(system_info_record))) != length)
+		return false;
+	if (std::memcmp(data + sizeof(header), build, header.build_length))
+		return false;
+
+	m_count = count;
+	return true;
+}
+
+} // namespace ui
@@ -0,0 +1,82 @@
+// license:BSD-3-Clause
+// copyright-holders:Vas Crabb
+/***************************************************************************
+
+    ui/systeminfo.h
+
+    Cache of per-system information derived from machine configurations
+
+***************************************************************************/
+
+#ifndef MAME_FRONTEND_UI_SYSTEMINFO_H
+#define MAME_FRONTEND_UI_SYSTEMINFO_H
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+namespace ui {
+
+// what the system selection menus need to know about a system without
+// instantiating its machine configuration
+struct system_info_record
+{
+	enum : u32
+	{
+		HAS_BIOSES          = 1U << 0,
+		HAS_DIPS            = 1U << 1,
+		HAS_CONFIGS         = 1U << 2,
+		HAS_KEYBOARD        = 1U << 3,
+		HAS_TEST_SWITCH     = 1U << 4,
+		HAS_ANALOG          = 1U << 5,
+		HAS_SOFTWARE_LISTS  = 1U << 6,
+		SCREEN_RASTER       = 1U << 8,
+		SCREEN_VECTOR       = 1U << 9,
+		SCREEN_LCD          = 1U << 10,
+		SCREEN_SVG          = 1U << 11
+	};
+
+	u32     machine_flags;          // aggregated machine flags
+	u32     unemulated_features;    // aggregated unemulated features
+	u32     imperfect_features;     // aggregated imperfect features
+	u32     info;                   // HAS_... and SCREEN_... bits
+	u64     rom_bytes;              // total size of all ROM regions
+};
+
+
+// records for every system in the driver list, kept in a file that is
+// tied to the build and mapped when the UI starts
+class system_info_cache
+{
+public:
+	static system_info_cache &instance();
+
+	// load the records for this build, or build and save them; building
+	// stops early and returns false if cancel becomes set
+	bool load(std::string const &path);
+	bool build(std::string const &path, std::atomic<bool> const &cancel);
+
+	// get the record for a driver list index, or nullptr if not loaded
+	system_info_record const *find(int index) const;
+
+private:
+	system_info_cache();
+	~system_info_cache();
+
+	bool parse(u8 const *data, u64 length);
+
+	std::mutex                                      m_mutex;        // serialises loading and publishing
+	std::unique_ptr<emu_file>                       m_file;         // mapped file, if any
+	std::vector<u8>                                 m_data;         // data read or built
+	std::atomic<system_info_record const *>         m_records;      // records in driver list order
+	std::size_t                                     m_count;        // number of records
+};
+
+} // namespace ui
+
+#endif // MAME_FRONTEND_UI_SYSTEMINFO_H
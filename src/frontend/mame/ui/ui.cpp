@@ -243,7 +243,9 @@ void mame_ui_manager::exit()
 	machine().render().texture_free(m_mouse_arrow_texture);
 	m_mouse_arrow_texture = nullptr;
 
-	// free the font
+	// free the font and everything laid out with it
+	m_layouts.clear();
+	m_old_layouts.clear();
 	if (m_font != nullptr)
 	{
 		machine().render().font_free(m_font);
@@ -578,8 +580,10 @@ void mame_ui_manager::set_startup_text(const char *text, bool force)
 
 void mame_ui_manager::update_and_render(render_container &container)
 {
-	// always start clean
+	// always start clean, and forget layouts that weren't drawn last frame
 	container.empty();
+	m_old_layouts.swap(m_layouts);
+	m_layouts.clear();
 
 	// if we're paused, dim the whole screen
 	if (machine().phase() >= machine_phase::RESET && (single_step() || machine().paused()))
@@ -759,17 +763,18 @@ void mame_ui_manager::draw_text(render_container &container, const char *buf, fl
 
 void mame_ui_manager::draw_text_full(render_container &container, const char *origs, float x, float y, float origwrapwidth, ui::text_layout::text_justify justify, ui::text_layout::word_wrapping wrap, draw_mode draw, rgb_t fgcolor, rgb_t bgcolor, float *totalwidth, float *totalheight, float text_size)
 {
-	// create the layout
-	auto layout = create_layout(container, origwrapwidth, justify, wrap);
-
-	// append text to it
-	layout.add_text(
+	// menus draw the same text every frame, so reuse the layout when we can
+	ui::text_layout &layout(cached_layout(
+			container,
 			origs,
+			origwrapwidth,
+			justify,
+			wrap,
 			fgcolor,
 			draw == OPAQUE_ ? bgcolor : rgb_t::transparent(),
-			text_size);
+			text_size));
 
-	// and emit it (if we are asked to do so)
+	// emit it (if we are asked to do so)
 	if (draw != NONE)
 		layout.emit(container, x, y);
 
@@ -781,6 +786,58 @@ void mame_ui_manager::draw_text_full(render_container &container, const char *or
 }
 
 
+//-------------------------------------------------
+//  cached_layout - return a layout of the text,
+//  reusing one from this or the last frame if
+//  it was laid out the same way
+//-------------------------------------------------
+
+ui::text_layout &mame_ui_manager::cached_layout(render_container &container, const char *origs, float width, ui::text_layout::text_justify justify, ui::text_layout::word_wrapping wrap, rgb_t fgcolor, rgb_t bgcolor, float text_size)
+{
+	// bound the cache for callers that measure far more text than fits on screen
+	static constexpr std::size_t MAX_LAYOUTS = 1024;
+
+	// the key is everything that affects the layout followed by the text itself
+	float const yscale = get_line_height();
+	float const xscale = yscale * machine().render().ui_aspect(&container);
+	std::string key;
+	auto const append = [&key] (auto const &value) { key.append(reinterpret_cast<const char *>(&value), sizeof(value)); };
+	append(xscale);
+	append(yscale);
+	append(width);
+	append(justify);
+	append(wrap);
+	append(u32(fgcolor));
+	append(u32(bgcolor));
+	append(text_size);
+	key.append(origs);
+
+	auto found = m_layouts.find(key);
+	if (found != m_layouts.end())
+		return *found->second;
+
+	if (m_layouts.size() >= MAX_LAYOUTS)
+	{
+		m_old_layouts.swap(m_layouts);
+		m_layouts.clear();
+	}
+
+	auto const old = m_old_layouts.find(key);
+	if (old != m_old_layouts.end())
+	{
+		found = m_layouts.emplace(std::move(key), std::move(old->second)).first;
+		m_old_layouts.erase(old);
+	}
+	else
+	{
+		std::unique_ptr<ui::text_layout> layout = std::make_unique<ui::text_layout>(create_layout(container, width, justify, wrap));
+		layout->add_text(origs, fgcolor, bgcolor, text_size);
+		found = m_layouts.emplace(std::move(key), std::move(layout)).first;
+	}
+	return *found->second;
+}
+
+
 //-------------------------------------------------
 //  draw_text_box - draw a multiline text
 //  message with a box around it
@@ -24,6 +24,7 @@
 #include <ctime>
 #include <functional>
 #include <set>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -269,6 +270,7 @@ public:
 private:
 	using handler_callback_func = std::function<uint32_t (render_container &)>;
 	using device_feature_set = std::set<std::pair<std::string, std::string> >;
+	using layout_cache = std::unordered_map<std::string, std::unique_ptr<ui::text_layout> >;
 
 	// instance variables
 	render_font *           m_font;
@@ -294,6 +296,8 @@ private:
 	device_feature_set      m_imperfect_features;
 	std::time_t             m_last_launch_time;
 	std::time_t             m_last_warning_time;
+	layout_cache            m_layouts;          // text laid out by draw_text_full this frame
+	layout_cache            m_old_layouts;      // and in the frame before
 
 	// static variables
 	static std::string      messagebox_text;
@@ -312,6 +316,7 @@ private:
 
 	// private methods
 	void exit();
+	ui::text_layout &cached_layout(render_container &container, const char *origs, float width, ui::text_layout::text_justify justify, ui::text_layout::word_wrapping wrap, rgb_t fgcolor, rgb_t bgcolor, float text_size);
 	void config_load(config_type cfg_type, util::xml::data_node const *parentnode);
 	void config_save(config_type cfg_type, util::xml::data_node *parentnode);
 	std::unique_ptr<slider_state> slider_alloc(int id, const char *title, int32_t minval, int32_t defval, int32_t maxval, int32_t incval, void *arg);
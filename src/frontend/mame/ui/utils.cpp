@@ -1877,32 +1877,24 @@ std::vector<std::string> tokenize(const std::string &text, char sep)
 
 
 ui_software_info::ui_software_info(
-		software_info const &info,
-		software_part const &p,
+		software_index_entry const &info,
+		software_index_part const &p,
 		game_driver const &d,
 		std::string const &li,
 		std::string const &is,
 		std::string const &de)
-	: shortname(info.shortname()), longname(info.longname()), parentname(info.parentname())
-	, year(info.year()), publisher(info.publisher())
-	, supported(info.supported())
-	, part(p.name())
+	: shortname(info.shortname), longname(info.longname), parentname(info.parentname)
+	, year(info.year), publisher(info.publisher)
+	, supported(info.supported)
+	, part(p.name)
 	, driver(&d)
-	, listname(li), interface(p.interface()), instance(is)
+	, listname(li), interface(p.interface), instance(is)
 	, startempty(0)
 	, parentlongname()
-	, usage()
+	, usage(info.usage)
 	, devicetype(de)
 	, available(false)
 {
-	for (feature_list_item const &feature : info.other_info())
-	{
-		if (feature.name() == "usage")
-		{
-			usage = feature.value();
-			break;
-		}
-	}
 }
 
 // info for starting empty
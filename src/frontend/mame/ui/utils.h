@@ -34,6 +34,7 @@ struct ui_system_info
 	game_driver const *driver = nullptr;
 	int index;
 	bool available = false;
+	bool is_clone = false; // has a parent that isn't a BIOS
 
 	std::u32string ucs_shortname;
 	std::u32string ucs_description;
@@ -46,8 +47,8 @@ struct ui_software_info
 
 	// info for software list item
 	ui_software_info(
-			software_info const &info,
-			software_part const &p,
+			software_index_entry const &info,
+			software_index_part const &p,
 			game_driver const &d,
 			std::string const &li,
 			std::string const &is,
@@ -63,6 +63,11 @@ int dfi_format::identify(io_generic *io, uint32_t form_factor)
 	return memcmp(sign, "DFE2", 4) ? 0 : 100;
 }
 
+bool dfi_format::prefilter(const uint8_t *header, size_t length, uint64_t size, uint32_t form_factor) const
+{
+	return length >= 4 && !memcmp(header, "DFE2", 4);
+}
+
 bool dfi_format::load(io_generic *io, uint32_t form_factor, floppy_image *image)
 {
 	char sign[4];
@@ -912,6 +912,14 @@ floppy_image::~floppy_image()
 {
 }
 
+void floppy_image::set_track_generator(int track_count, int head_count, track_generator &&_generator)
+{
+	generator = std::move(_generator);
+	for(int track=0; track < track_count && track < tracks; track++)
+		for(int head=0; head < head_count && head < heads; head++)
+			track_array[track*4][head].pending = true;
+}
+
 void floppy_image::get_maximal_geometry(int &_tracks, int &_heads) const
 {
 	_tracks = tracks;
@@ -924,7 +932,7 @@ void floppy_image::get_actual_geometry(int &_tracks, int &_heads)
 
 	while(maxt >= 0) {
 		for(int i=0; i<=maxh; i++)
-			if(!track_array[maxt][i].cell_data.empty())
+			if(has_data(maxt, i))
 				goto track_done;
 		maxt--;
 	}
@@ -932,7 +940,7 @@ void floppy_image::get_actual_geometry(int &_tracks, int &_heads)
 	if(maxt >= 0)
 		while(maxh >= 0) {
 			for(int i=0; i<=maxt; i++)
-				if(!track_array[i][maxh].cell_data.empty())
+				if(has_data(i, maxh))
 					goto head_done;
 			maxh--;
 		}
@@ -946,7 +954,7 @@ int floppy_image::get_resolution() const
 	int mask = 0;
 	for(int i=0; i<=(tracks-1)*4; i++)
 		for(int j=0; j<heads; j++)
-			if(!track_array[i][j].cell_data.empty())
+			if(has_data(i, j))
 				mask |= 1 << (i & 3);
 	if(mask & 0xa)
 		return 2;
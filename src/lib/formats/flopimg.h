@@ -17,6 +17,7 @@
 #include "opresolv.h"
 #include "coretmpl.h"
 
+#include <functional>
 #include <vector>
 
 #ifndef LOG_FORMATS
@@ -237,6 +238,19 @@ public:
 	*/
 	virtual int identify(io_generic *io, uint32_t form_factor) = 0;
 
+	/*! @brief Cheap check run before identify.
+	  Formats with a fixed signature can reject an image from its
+	  first bytes without reading the rest of it.
+	  @param header start of the image, padded with the filler byte
+	  when the image is shorter.
+	  @param length number of bytes in header.
+	  @param size size of the whole image.
+	  @param form_factor Physical form factor of disk, from the enum
+	  in floppy_image
+	  @return false if identify would certainly reject the image.
+	*/
+	virtual bool prefilter(const uint8_t *header, size_t length, uint64_t size, uint32_t form_factor) const { return true; }
+
 	/*! @brief Load an image.
 	  The load function opens an image file and converts it to the
 	  internal MESS floppy representation.
@@ -748,7 +762,21 @@ public:
 	  @param head head number
 	  @return a pointer to the data buffer for this track and head
 	*/
-	std::vector<uint32_t> &get_buffer(int track, int head, int subtrack = 0) { assert(track < tracks && head < heads); return track_array[track*4+subtrack][head].cell_data; }
+	std::vector<uint32_t> &get_buffer(int track, int head, int subtrack = 0) { assert(track < tracks && head < heads); return materialize(track*4+subtrack, head).cell_data; }
+
+	//! Builds the cells of one whole track and head the first time they are needed.
+	typedef std::function<void (floppy_image *image, int track, int head)> track_generator;
+
+	/*! Defers generating tracks [0, track_count) on heads
+	    [0, head_count) until one is first accessed, when the
+	    generator fills it in through get_buffer.  Formats that can
+	    rebuild any track from the data they read call this from load
+	    instead of generating every track up front.
+	    @param track_count
+	    @param head_count
+	    @param generator
+	*/
+	void set_track_generator(int track_count, int head_count, track_generator &&generator);
 
 	//! Sets the write splice position.
 	//! The "track splice" information indicates where to start writing
@@ -762,9 +790,9 @@ public:
 	    @param head
 	    @param pos the position
 	*/
-	void set_write_splice_position(int track, int head, uint32_t pos, int subtrack = 0) { assert(track < tracks && head < heads); track_array[track*4+subtrack][head].write_splice = pos; }
+	void set_write_splice_position(int track, int head, uint32_t pos, int subtrack = 0) { assert(track < tracks && head < heads); materialize(track*4+subtrack, head).write_splice = pos; }
 	//! @return the current write splice position.
-	uint32_t get_write_splice_position(int track, int head, int subtrack = 0) const { assert(track < tracks && head < heads); return track_array[track*4+subtrack][head].write_splice; }
+	uint32_t get_write_splice_position(int track, int head, int subtrack = 0) { assert(track < tracks && head < heads); return materialize(track*4+subtrack, head).write_splice; }
 	//! @return the maximal geometry supported by this format.
 	void get_maximal_geometry(int &tracks, int &heads) const;
 
@@ -789,13 +817,26 @@ private:
 	{
 		std::vector<uint32_t> cell_data;
 		uint32_t write_splice;
+		bool pending;   // still to be built by the track generator
 
-		track_info() { write_splice = 0; }
+		track_info() { write_splice = 0; pending = false; }
 	};
 
 	// track number multiplied by 4 then head
 	// last array size may be bigger than actual track size
 	std::vector<std::vector<track_info> > track_array;
+	track_generator generator;
+
+	track_info &materialize(int index, int head)
+	{
+		track_info &info = track_array[index][head];
+		if(info.pending) {
+			info.pending = false;
+			generator(this, index >> 2, head);
+		}
+		return info;
+	}
+	bool has_data(int index, int head) const { return track_array[index][head].pending || !track_array[index][head].cell_data.empty(); }
 };
 
 #endif // MAME_FORMATS_FLOPIMG_H
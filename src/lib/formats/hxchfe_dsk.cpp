@@ -155,6 +155,11 @@ int hfe_format::identify(io_generic *io, uint32_t form_factor)
 	return 0;
 }
 
+bool hfe_format::prefilter(const uint8_t *header, size_t length, uint64_t size, uint32_t form_factor) const
+{
+	return length >= 8 && !memcmp(header, HFE_FORMAT_HEADER, 8);
+}
+
 bool hfe_format::load(io_generic *io, uint32_t form_factor, floppy_image *image)
 {
 	uint8_t header[HEADER_LENGTH];
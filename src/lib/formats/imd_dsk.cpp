@@ -420,6 +420,11 @@ int imd_format::identify(io_generic *io, uint32_t form_factor)
 	return 0;
 }
 
+bool imd_format::prefilter(const uint8_t *header, size_t length, uint64_t size, uint32_t form_factor) const
+{
+	return length >= 4 && !memcmp(header, "IMD ", 4);
+}
+
 bool imd_format::load(io_generic *io, uint32_t form_factor, floppy_image *image)
 {
 	uint64_t size = io_generic_size(io);
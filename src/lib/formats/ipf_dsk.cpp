@@ -42,6 +42,11 @@ int ipf_format::identify(io_generic *io, uint32_t form_factor)
 	return 0;
 }
 
+bool ipf_format::prefilter(const uint8_t *header, size_t length, uint64_t size, uint32_t form_factor) const
+{
+	return length >= 4 && !memcmp(header, "CAPS", 4);
+}
+
 bool ipf_format::load(io_generic *io, uint32_t form_factor, floppy_image *image)
 {
 	uint64_t size = io_generic_size(io);
@@ -15,6 +15,7 @@ public:
 	ipf_format();
 
 	virtual int identify(io_generic *io, uint32_t form_factor) override;
+	virtual bool prefilter(const uint8_t *header, size_t length, uint64_t size, uint32_t form_factor) const override;
 	virtual bool load(io_generic *io, uint32_t form_factor, floppy_image *image) override;
 
 	virtual const char *name() const override;
@@ -108,6 +108,11 @@ int mfi_format::identify(io_generic *io, uint32_t form_factor)
 	return 0;
 }
 
+bool mfi_format::prefilter(const uint8_t *header, size_t length, uint64_t size, uint32_t form_factor) const
+{
+	return length >= sizeof(sign) && !memcmp(header, sign, sizeof(sign));
+}
+
 bool mfi_format::load(io_generic *io, uint32_t form_factor, floppy_image *image)
 {
 	header h;
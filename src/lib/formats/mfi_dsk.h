@@ -13,6 +13,7 @@ public:
 	mfi_format();
 
 	virtual int identify(io_generic *io, uint32_t form_factor) override;
+	virtual bool prefilter(const uint8_t *header, size_t length, uint64_t size, uint32_t form_factor) const override;
 	virtual bool load(io_generic *io, uint32_t form_factor, floppy_image *image) override;
 	virtual bool save(io_generic *io, floppy_image *image) override;
 
@@ -831,6 +831,11 @@ int td0_format::identify(io_generic *io, uint32_t form_factor)
 	return 0;
 }
 
+bool td0_format::prefilter(const uint8_t *header, size_t length, uint64_t size, uint32_t form_factor) const
+{
+	return length >= 2 && (((header[0] == 'T') && (header[1] == 'D')) || ((header[0] == 't') && (header[1] == 'd')));
+}
+
 bool td0_format::load(io_generic *io, uint32_t form_factor, floppy_image *image)
 {
 	int track_count = 0;
@@ -10,6 +10,10 @@
 
 #include "formats/wd177x_dsk.h"
 
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
 
 wd177x_format::wd177x_format(const format *_formats)
 {
@@ -204,54 +208,82 @@ bool wd177x_format::load(io_generic *io, uint32_t form_factor, floppy_image *ima
 
 	const format &f = formats[type];
 
+	// check every track layout fits before any of them is built
 	for(int track=0; track < f.track_count; track++)
 		for(int head=0; head < f.head_count; head++) {
-			uint8_t sectdata[40*512];
-			desc_s sectors[40];
-			floppy_image_format_t::desc_e *desc;
+			const format &tf = get_track_format(f, head, track);
 			int current_size;
 			int end_gap_index;
-			const format &tf = get_track_format(f, head, track);
-
-			switch (tf.encoding)
-			{
-			case floppy_image::FM:
-				desc = get_desc_fm(tf, current_size, end_gap_index);
-				break;
-			case floppy_image::MFM:
-			default:
-				desc = get_desc_mfm(tf, current_size, end_gap_index);
-				break;
-			}
+			if (tf.encoding == floppy_image::FM)
+				get_desc_fm(tf, current_size, end_gap_index);
+			else
+				get_desc_mfm(tf, current_size, end_gap_index);
 
 			int total_size = 200000000/tf.cell_size;
-			int remaining_size = total_size - current_size;
-			if(remaining_size < 0) {
+			if(total_size < current_size) {
 				osd_printf_error("wd177x_format: Incorrect track layout, max_size=%d, current_size=%d\n", total_size, current_size);
 				return false;
 			}
-
-			// Fixup the end gap
-			desc[end_gap_index].p2 = remaining_size / 16;
-			desc[end_gap_index + 1].p2 = remaining_size & 15;
-			desc[end_gap_index + 1].p1 >>= 16-(remaining_size & 15);
-
-			if (tf.encoding == floppy_image::FM)
-				desc[14].p1 = get_track_dam_fm(tf, head, track);
-			else
-				desc[16].p1 = get_track_dam_mfm(tf, head, track);
-
-			build_sector_description(tf, sectdata, sectors, track, head);
-			int track_size = compute_track_size(tf);
-			io_generic_read(io, sectdata, get_image_offset(f, head, track), track_size);
-			generate_track(desc, track, head, sectors, tf.sector_count, total_size, image);
 		}
 
+	// tracks are built from a copy of the sectors the first time the drive reaches them
+	auto data = std::make_shared<std::vector<uint8_t>>(io_generic_size(io));
+	if(!data->empty())
+		io_generic_read(io, &(*data)[0], 0, data->size());
+	image->set_track_generator(f.track_count, f.head_count,
+			[this, &f, data] (floppy_image *image, int track, int head)
+			{
+				build_track(f, track, head, *data, image);
+			});
+
 	image->set_variant(f.variant);
 
 	return true;
 }
 
+void wd177x_format::build_track(const format &f, int track, int head, const std::vector<uint8_t> &data, floppy_image *image)
+{
+	uint8_t sectdata[40*512];
+	desc_s sectors[40];
+	floppy_image_format_t::desc_e *desc;
+	int current_size;
+	int end_gap_index;
+	const format &tf = get_track_format(f, head, track);
+
+	switch (tf.encoding)
+	{
+	case floppy_image::FM:
+		desc = get_desc_fm(tf, current_size, end_gap_index);
+		break;
+	case floppy_image::MFM:
+	default:
+		desc = get_desc_mfm(tf, current_size, end_gap_index);
+		break;
+	}
+
+	int total_size = 200000000/tf.cell_size;
+	int remaining_size = total_size - current_size;
+
+	// Fixup the end gap
+	desc[end_gap_index].p2 = remaining_size / 16;
+	desc[end_gap_index + 1].p2 = remaining_size & 15;
+	desc[end_gap_index + 1].p1 >>= 16-(remaining_size & 15);
+
+	if (tf.encoding == floppy_image::FM)
+		desc[14].p1 = get_track_dam_fm(tf, head, track);
+	else
+		desc[16].p1 = get_track_dam_mfm(tf, head, track);
+
+	build_sector_description(tf, sectdata, sectors, track, head);
+	int track_size = compute_track_size(tf);
+	int offset = get_image_offset(f, head, track);
+	int avail = std::max<int>(0, std::min<int>(track_size, int(data.size()) - offset));
+	if(avail)
+		memcpy(sectdata, &data[offset], avail);
+	memset(sectdata + avail, 0xff, track_size - avail);
+	generate_track(desc, track, head, sectors, tf.sector_count, total_size, image);
+}
+
 bool wd177x_format::supports_save() const
 {
 	return true;
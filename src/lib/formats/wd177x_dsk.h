@@ -60,6 +60,7 @@ protected:
 	virtual void build_sector_description(const format &d, uint8_t *sectdata, desc_s *sectors, int track, int head) const;
 	virtual void check_compatibility(floppy_image *image, std::vector<int> &candidates);
 	void extract_sectors(floppy_image *image, const format &f, desc_s *sdesc, int track, int head);
+	void build_track(const format &f, int track, int head, const std::vector<uint8_t> &data, floppy_image *image);
 };
 
 #endif // MAME_FORMATS_WD177X_DSK_H
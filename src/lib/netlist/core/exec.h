@@ -109,6 +109,9 @@ namespace netlist
 		//PALIGNAS(16)
 		detail::queue_t                     m_queue;
 		bool                                m_use_stats;
+#if (NL_USE_QUEUE_TRACE)
+		std::unique_ptr<std::ostream>       m_queue_trace;
+#endif
 		// performance
 		plib::pperftime_t<true>             m_stat_mainloop;
 		plib::pperfcount_t<true>            m_perf_out_processed;
@@ -63,8 +63,9 @@ namespace netlist
 			{
 				if (has_connections())
 				{
+					// the queued time lets queues locate the entry faster
 					if (!!is_queued())
-						exec().qremove(this);
+						exec().qremove(detail::queue_t::entry_t(m_next_scheduled_time, this));
 
 					const auto nst(exec().time() + delay);
 					m_next_scheduled_time = nst;
@@ -27,11 +27,18 @@ namespace netlist
 	namespace detail {
 		// Use timed_queue_heap to use stdc++ heap functions instead of linear processing.
 		// This slows down processing by about 25% on a Kaby Lake.
-		// template <class T, bool TS>
-		// using timed_queue = plib::timed_queue_heap<T, TS>;
 
 		template <class T, bool TS>
-		using timed_queue = plib::timed_queue_linear<T, TS>;
+		using timed_queue_calendar = plib::timed_queue_calendar<T, TS,
+			config::CALENDAR_QUEUE_BUCKETS::value, config::CALENDAR_QUEUE_SHIFT::value>;
+
+		template <class T, bool TS>
+		using timed_queue_selected = std::conditional_t<NL_QUEUE_TYPE == 2, timed_queue_calendar<T, TS>,
+			std::conditional_t<NL_QUEUE_TYPE == 1, plib::timed_queue_heap<T, TS>, plib::timed_queue_linear<T, TS>>>;
+
+		template <class T, bool TS>
+		using timed_queue = std::conditional_t<NL_USE_QUEUE_TRACE,
+			plib::timed_queue_trace<timed_queue_selected<T, TS>>, timed_queue_selected<T, TS>>;
 
 		// -----------------------------------------------------------------------------
 		// queue_t
@@ -40,19 +47,19 @@ namespace netlist
 		// We don't need a thread-safe queue currently. Parallel processing of
 		// solvers will update inputs after parallel processing.
 
-		template <typename O, bool TS>
+		template <typename O, template <class, bool> class Q, bool TS>
 		class queue_base :
-				public timed_queue<plib::pqentry_t<netlist_time_ext, O *>, false>,
+				public Q<plib::pqentry_t<netlist_time_ext, O *>, false>,
 				public plib::state_manager_t::callback_t
 		{
 		public:
 			using entry_t = plib::pqentry_t<netlist_time_ext, O *>;
-			using base_queue = timed_queue<entry_t, false>;
+			using base_queue = Q<entry_t, false>;
 			using id_delegate = plib::pmfp<std::size_t, const O *>;
 			using obj_delegate = plib::pmfp<O *, std::size_t>;
 
 			explicit queue_base(std::size_t size, id_delegate get_id, obj_delegate get_obj)
-			: timed_queue<plib::pqentry_t<netlist_time_ext, O *>, false>(size)
+			: base_queue(size)
 			, m_qsize(0)
 			, m_times(size)
 			, m_net_ids(size)
@@ -82,8 +89,8 @@ namespace netlist
 				m_qsize = this->size();
 				for (std::size_t i = 0; i < m_qsize; i++ )
 				{
-					m_times[i] =  this->listptr()[i].exec_time().as_raw();
-					m_net_ids[i] = m_get_id(this->listptr()[i].object());
+					m_times[i] =  (*this)[i].exec_time().as_raw();
+					m_net_ids[i] = m_get_id((*this)[i].object());
 				}
 			}
 			void on_post_load(plib::state_manager_t &manager) override
@@ -105,7 +112,7 @@ namespace netlist
 			obj_delegate m_obj_by_id;
 		};
 
-		using queue_t = queue_base<net_t, false>;
+		using queue_t = queue_base<net_t, timed_queue, false>;
 
 	} // namespace detail
 } // namespace netlist
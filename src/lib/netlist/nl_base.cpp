@@ -8,6 +8,7 @@
 #include "plib/pdynlib.h"
 #include "plib/pfmtlog.h"
 #include "plib/pmempool.h"
+#include "plib/pstream.h"
 #include "plib/putil.h"
 
 #include "core/setup.h"
@@ -97,6 +98,10 @@ namespace netlist
 	{
 		state.save(*this, static_cast<plib::state_manager_t::callback_t &>(m_queue), aname, "m_queue");
 		state.save(*this, m_time, aname, "m_time");
+#if (NL_USE_QUEUE_TRACE)
+		m_queue_trace = std::make_unique<plib::ofstream>(plib::util::environment("NL_QUEUE_TRACE", "nlqueue.trace"));
+		m_queue.trace_to(m_queue_trace.get());
+#endif
 	}
 
 	// ----------------------------------------------------------------------------------------
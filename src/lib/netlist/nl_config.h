@@ -66,6 +66,37 @@
 #define NL_USE_QUEUE_STATS             (0)
 #endif
 
+/// \brief  Event queue implementation.
+///
+/// - 0: sorted list, plib::timed_queue_linear
+/// - 1: binary heap, plib::timed_queue_heap
+/// - 2: calendar queue, plib::timed_queue_calendar
+///
+/// The sorted list is best for small queues. Netlists with many
+/// pending events, e.g. large TTL netlists, may be faster with the
+/// calendar queue. Its geometry is set by CALENDAR_QUEUE_BUCKETS and
+/// CALENDAR_QUEUE_SHIFT below. The heap returns events of equal time in
+/// a different order and thus may give slightly different results.
+///
+/// Use the queue benchmark in tests/test_ptimed_queue.cpp together with
+/// \ref NL_USE_QUEUE_TRACE to choose empirically.
+///
+
+#ifndef NL_QUEUE_TYPE
+#define NL_QUEUE_TYPE                  (0)
+#endif
+
+/// \brief  Record event queue operations.
+///
+/// Set to 1 to write all operations on the main event queue to the file
+/// named by the environment variable NL_QUEUE_TRACE. This is slow and
+/// only intended to record traces for the queue benchmark.
+///
+
+#ifndef NL_USE_QUEUE_TRACE
+#define NL_USE_QUEUE_TRACE             (0)
+#endif
+
 /// \brief  Compile in academic solvers
 ///
 /// Set to 0 to disable compiling the following solvers:
@@ -146,6 +177,16 @@
 //#define NL_USE_LONG_DOUBLE_MATRIX 1
 #endif
 
+/// \brief Disable loading of static solvers from shared libraries.
+///
+/// Set to 1 to only use static solvers compiled into the binary. This
+/// disables the nltool --boost_lib option and the static solver cache
+/// of the MAME netlist device.
+
+#ifndef NL_DISABLE_DYNAMIC_LOAD
+#define NL_DISABLE_DYNAMIC_LOAD (0)
+#endif
+
 //============================================================
 //  DEBUGGING
 //============================================================
@@ -208,6 +249,17 @@ namespace netlist
 		///
 		using MAX_SOLVER_QUEUE_SIZE = std::integral_constant<std::size_t, 512>; // NOLINT
 
+		/// \brief Number of buckets of the calendar queue
+		///
+		/// Must be a power of two.
+		using CALENDAR_QUEUE_BUCKETS = std::integral_constant<std::size_t, 256>; // NOLINT
+
+		/// \brief Bucket width of the calendar queue
+		///
+		/// Each bucket covers 2^CALENDAR_QUEUE_SHIFT units of \ref INTERNAL_RES.
+		/// The default of 12.8 ns is in the range of TTL gate delays.
+		using CALENDAR_QUEUE_SHIFT = std::integral_constant<unsigned, 7>; // NOLINT
+
 		using use_float_matrix = std::integral_constant<bool, NL_USE_FLOAT_MATRIX>;
 		using use_long_double_matrix = std::integral_constant<bool, NL_USE_LONG_DOUBLE_MATRIX>;
 		using use_float128_matrix = std::integral_constant<bool, NL_USE_FLOAT128>;
@@ -16,10 +16,25 @@
 
 #include "solver/nld_solver.h"
 
+#include <algorithm>
+#include <mutex>
 #include <sstream>
+#include <unordered_map>
 
 namespace netlist
 {
+	namespace
+	{
+		// Token streams of preprocessed text sources, shared by every setup in
+		// the process. Validation and device start parse the same netlists, as
+		// do repeated runs in nltool. The key holds the source name, the defines
+		// in effect and the raw text, so a changed source is parsed again.
+		// Included sources are expected not to change while the process runs.
+		// Entries are never removed, so references stay valid after unlocking.
+		std::mutex s_token_cache_lock;
+		std::unordered_map<putf8string, parser_t::token_store> s_token_cache;
+	} // anonymous namespace
+
 	// ----------------------------------------------------------------------------------------
 	// nl_parse_t
 	// ----------------------------------------------------------------------------------------
@@ -360,33 +375,47 @@ namespace netlist
 
 	bool nlparse_t::parse_stream(plib::istream_uptr &&istrm, const pstring &name)
 	{
-#if 0
-		auto key = istrm.filename();
+		const auto filename = istrm.filename();
+		std::stringstream raw;
+		raw << istrm->rdbuf();
 
-		if (m_source_cache.find(key) != m_source_cache.end())
+		// key on everything the preprocessor output depends on
+		std::vector<putf8string> defines;
+		for (const auto &d : m_defines)
 		{
-			return parser_t(*this).parse(m_source_cache[key], name);
+			putf8string def(putf8string(d.second.m_name) + "=" + putf8string(d.second.m_replace));
+			for (const auto &p : d.second.m_params)
+				def += "," + putf8string(p);
+			defines.push_back(std::move(def));
 		}
-		else
+		std::sort(defines.begin(), defines.end());
+		auto key = putf8string(filename);
+		for (const auto &def : defines)
+			key += "\n" + def;
+		key += "\n\n";
+		key += putf8string(raw.str());
+
+		const parser_t::token_store *st = nullptr;
 		{
-			auto preprocessed = std::make_unique<std::stringstream>(
-					plib::ppreprocessor(m_includes, &m_defines).process(std::move(istrm), istrm.filename()));
-
-			parser_t::token_store &st = m_source_cache[key];
-			parser_t parser(*this);
-			parser.parse_tokens(plib::istream_uptr(std::move(preprocessed), key), st);
-			return parser.parse(st, name);
+			std::lock_guard<std::mutex> lock(s_token_cache_lock);
+			auto found = s_token_cache.find(key);
+			if (found != s_token_cache.end())
+				st = &found->second;
 		}
-#else
-		const auto filename = istrm.filename();
-		auto preprocessed = std::make_unique<std::stringstream>(putf8string(
-				plib::ppreprocessor(m_includes, &m_defines).process(std::move(istrm), filename)));
 
-		parser_t::token_store st;
 		parser_t parser(*this);
-		parser.parse_tokens(plib::istream_uptr(std::move(preprocessed), filename), st);
-		return parser.parse(st, name);
-#endif
+		if (st == nullptr)
+		{
+			auto preprocessed = std::make_unique<std::stringstream>(putf8string(
+					plib::ppreprocessor(m_includes, &m_defines).process(plib::istream_uptr(std::make_unique<std::stringstream>(raw.str()), filename), filename)));
+
+			parser_t::token_store tokens;
+			parser.parse_tokens(plib::istream_uptr(std::move(preprocessed), filename), tokens);
+
+			std::lock_guard<std::mutex> lock(s_token_cache_lock);
+			st = &s_token_cache.emplace(std::move(key), std::move(tokens)).first->second;
+		}
+		return parser.parse(*st, name);
 	}
 
 	void nlparse_t::add_define(const pstring &defstr)
@@ -19,6 +19,7 @@
 #include "pstate.h"
 #include "ptypes.h"
 #include "putil.h"
+#include "vector_ops.h"
 
 #include <algorithm>
 #include <array>
@@ -186,11 +187,9 @@ namespace plib
 			const std::size_t oe = nz_num;
 			while (k < oe)
 			{
-				T tmp = plib::constants<T>::zero();
 				const std::size_t e = row_idx[row+1];
-				for (; k < e; k++)
-					tmp += A[k] * x[col_idx[k]];
-				res[row++] = tmp;
+				res[row++] = vec_mult_sparse<T>(e - k, &A[k], &col_idx[k], x);
+				k = e;
 			}
 #endif
 		}
@@ -408,11 +407,10 @@ namespace plib
 
 			for (std::size_t j = iN - 1; j-- > 0;)
 			{
-				typename base::value_type tmp = 0;
 				const auto jdiag = base::diag[j];
 				const std::size_t e = base::row_idx[j+1];
-				for (std::size_t pk = jdiag + 1; pk < e; pk++)
-					tmp += base::A[pk] * V[base::col_idx[pk]];
+				const auto tmp(vec_mult_sparse<typename base::value_type>(e - jdiag - 1,
+					&base::A[jdiag + 1], &base::col_idx[jdiag + 1], V));
 				V[j] = (RHS[j] - tmp) / base::A[jdiag];
 			}
 		}
@@ -426,11 +424,10 @@ namespace plib
 
 			for (std::size_t j = iN - 1; j-- > 0;)
 			{
-				typename base::value_type tmp = 0;
 				const auto jdiag = base::diag[j];
 				const std::size_t e = base::row_idx[j+1];
-				for (std::size_t pk = jdiag + 1; pk < e; pk++)
-					tmp += base::A[pk] * V[base::col_idx[pk]];
+				const auto tmp(vec_mult_sparse<typename base::value_type>(e - jdiag - 1,
+					&base::A[jdiag + 1], &base::col_idx[jdiag + 1], V));
 				V[j] = (V[j] - tmp) / base::A[jdiag];
 			}
 		}
@@ -627,22 +624,19 @@ namespace plib
 		{
 			for (std::size_t i = 1; i < base::size(); ++i )
 			{
-				typename base::value_type tmp(0);
 				const auto j1(base::row_idx[i]);
 				const auto j2(base::diag[i]);
 
-				for (auto j = j1; j < j2; ++j )
-					tmp +=  base::A[j] * r[base::col_idx[j]];
-				r[i] -= tmp;
+				r[i] -= vec_mult_sparse<typename base::value_type>(narrow_cast<std::size_t>(j2 - j1),
+					&base::A[j1], &base::col_idx[j1], r);
 			}
 			// i now is equal to n;
 			for (std::size_t i = base::size(); i-- > 0; )
 			{
-				typename base::value_type tmp(0);
 				const auto di(base::diag[i]);
 				const auto j2(base::row_idx[i+1]);
-				for (std::size_t j = di + 1; j < j2; j++ )
-					tmp += base::A[j] * r[base::col_idx[j]];
+				const auto tmp(vec_mult_sparse<typename base::value_type>(narrow_cast<std::size_t>(j2 - di - 1),
+					&base::A[di + 1], &base::col_idx[di + 1], r));
 				r[i] = (r[i] - tmp) / base::A[di];
 			}
 		}
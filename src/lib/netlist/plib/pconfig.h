@@ -36,6 +36,16 @@
 #define PUSE_OPENMP              (1)
 #endif
 
+/// \brief Use SSE2 kernels for vector operations.
+///
+/// vector_ops.h and mat_cr.h use SSE2 versions of the dense and sparse
+/// vector kernels for float and double if the target supports SSE2.
+/// The selection is done at compile time.
+///
+#ifndef PUSE_SSE2
+#define PUSE_SSE2                (1)
+#endif
+
 /// \brief Use aligned optimizations.
 ///
 /// Set this to one if you want to use aligned storage optimizations.
@@ -160,6 +170,16 @@ typedef __float128 FLOAT128;
 #define PHAS_OPENMP (0)
 #endif
 
+//============================================================
+// Check for SSE2
+//============================================================
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define PHAS_SSE2 (1)
+#else
+#define PHAS_SSE2 (0)
+#endif
+
 
 //============================================================
 //  WARNINGS
@@ -173,6 +193,13 @@ typedef __float128 FLOAT128;
 #endif
 #endif
 
+#if (PUSE_SSE2)
+#if (!(PHAS_SSE2))
+#undef PUSE_SSE2
+#define PUSE_SSE2 (0)
+#endif
+#endif
+
 #if (PUSE_FLOAT128)
 #if defined(__has_include)
 #if !__has_include(<quadmath.h>)
@@ -14,8 +14,10 @@
 #include <atomic>
 #include <condition_variable>
 #include <mutex>
+#include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace plib {
 
@@ -82,6 +84,146 @@ namespace plib {
 		long m_count;
 	};
 
+	///
+	/// \brief Persistent worker threads for short fork/join batches
+	///
+	/// run() hands the indices of a batch out through an atomic counter.
+	/// The calling thread takes part in the batch and returns once all
+	/// indices have been processed and every worker has left the batch.
+	///
+	/// Batches are expected to be in the microsecond range. Workers
+	/// therefore spin for a while after a batch before going to sleep,
+	/// since a condition variable wake-up alone would cost more than the
+	/// work handed out.
+	///
+	/// The callable must not throw.
+	///
+	class pthread_pool
+	{
+	public:
+		static constexpr const unsigned SPIN_COUNT = 20000;
+
+		explicit pthread_pool(std::size_t workers)
+		: m_func(nullptr)
+		, m_ctx(nullptr)
+		, m_count(0)
+		, m_next(0)
+		, m_tokens(0)
+		, m_sleepers(0)
+		, m_finished(0)
+		, m_stop(false)
+		{
+			for (std::size_t i = 0; i < workers; i++)
+				m_threads.emplace_back([this]() { this->worker(); });
+		}
+
+		pthread_pool(const pthread_pool &) = delete;
+		pthread_pool &operator=(const pthread_pool &) = delete;
+		pthread_pool(pthread_pool &&) = delete;
+		pthread_pool &operator=(pthread_pool &&) = delete;
+
+		~pthread_pool()
+		{
+			m_stop = true;
+			post(static_cast<long>(m_threads.size()));
+			for (auto &t : m_threads)
+				t.join();
+		}
+
+		std::size_t workers() const noexcept { return m_threads.size(); }
+
+		///
+		/// \brief Call f(i) for every i in [0, count)
+		///
+		/// The order in which indices are processed is unspecified.
+		///
+		template <typename F>
+		void run(std::size_t count, F &f)
+		{
+			const auto nw(std::min(m_threads.size(), count > 0 ? count - 1 : 0));
+			if (nw == 0)
+			{
+				for (std::size_t i = 0; i < count; i++)
+					f(i);
+				return;
+			}
+			m_func = [](void *ctx, std::size_t i) { (*static_cast<F *>(ctx))(i); };
+			m_ctx = &f;
+			m_count = count;
+			m_next.store(0, std::memory_order_relaxed);
+			m_finished.store(0, std::memory_order_relaxed);
+			post(static_cast<long>(nw));
+			process();
+			while (m_finished.load(std::memory_order_acquire) != nw)
+				;
+		}
+
+	private:
+		void post(long tokens)
+		{
+			m_tokens.fetch_add(tokens);
+			if (m_sleepers.load() > 0)
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_cv.notify_all();
+			}
+		}
+
+		void acquire()
+		{
+			for (unsigned spin = 0; ; spin++)
+			{
+				auto t(m_tokens.load());
+				if (t > 0)
+				{
+					if (m_tokens.compare_exchange_weak(t, t - 1))
+						return;
+				}
+				else if (spin >= SPIN_COUNT)
+				{
+					std::unique_lock<std::mutex> lock(m_mutex);
+					++m_sleepers;
+					m_cv.wait(lock, [this]() { return m_tokens.load() > 0; });
+					--m_sleepers;
+					spin = 0;
+				}
+			}
+		}
+
+		void process()
+		{
+			for (auto i = m_next.fetch_add(1, std::memory_order_relaxed); i < m_count;
+				i = m_next.fetch_add(1, std::memory_order_relaxed))
+			{
+				m_func(m_ctx, i);
+			}
+		}
+
+		void worker()
+		{
+			for (;;)
+			{
+				acquire();
+				if (m_stop)
+					return;
+				process();
+				m_finished.fetch_add(1, std::memory_order_release);
+			}
+		}
+
+		void (*m_func)(void *, std::size_t);
+		void *m_ctx;
+		std::size_t m_count;
+		std::atomic<std::size_t> m_next;
+		std::atomic<long> m_tokens;
+		std::atomic<long> m_sleepers;
+		std::atomic<std::size_t> m_finished;
+		std::atomic<bool> m_stop;
+		std::mutex m_mutex;
+		std::condition_variable m_cv;
+		std::vector<std::thread> m_threads;
+	};
+
 
 } // namespace plib
 
@@ -14,8 +14,11 @@
 #include "ptypes.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <mutex>
+#include <ostream>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -251,6 +254,12 @@ namespace plib {
 		std::size_t capacity() const noexcept { return m_list.capacity(); }
 		bool empty() const noexcept { return &m_list[0] == m_end; }
 
+		template<bool KEEPSTAT, typename... Args>
+		void emplace(Args&&... args) noexcept
+		{
+			push<KEEPSTAT>(T(std::forward<Args>(args)...));
+		}
+
 		template <bool KEEPSTAT>
 		void push(T &&e) noexcept
 		{
@@ -312,14 +321,13 @@ namespace plib {
 		void clear()
 		{
 			lock_guard_type lck(m_lock);
-			m_list.clear();
 			m_end = &m_list[0];
 		}
 
 		// save state support & mame disasm
 
 		constexpr const T *listptr() const { return &m_list[0]; }
-		constexpr std::size_t size() const noexcept { return m_list.size(); }
+		std::size_t size() const noexcept { return narrow_cast<std::size_t>(m_end - &m_list[0]); }
 		constexpr const T & operator[](const std::size_t index) const { return m_list[ 0 + index]; }
 	private:
 		using mutex_type = pspin_mutex<TS>;
@@ -337,6 +345,348 @@ namespace plib {
 		pperfcount_t<true> m_prof_retime; // NOLINT
 	};
 
+	///
+	/// \brief Calendar queue
+	///
+	/// Entries are hashed by time into BUCKETS buckets each covering
+	/// 2^SHIFT raw time units. Every bucket is sorted like
+	/// \ref timed_queue_linear, so short insertion runs replace the long
+	/// ones of a single sorted list. This pays off for queues holding
+	/// many entries spread over a few bucket widths, as is typical for
+	/// TTL netlists.
+	///
+	/// Entries with equal time are returned in the same order as by
+	/// \ref timed_queue_linear.
+	///
+	/// remove can locate the bucket directly if passed an entry with the
+	/// time it was queued with. Otherwise all buckets are searched.
+	///
+	/// Indexed access for save states returns the entries unsorted.
+	///
+	template <class T, bool TS, std::size_t BUCKETS, unsigned SHIFT>
+	class timed_queue_calendar
+	{
+	public:
+		static_assert((BUCKETS & (BUCKETS - 1)) == 0, "BUCKETS must be a power of two");
+
+		explicit timed_queue_calendar(const std::size_t list_size)
+		: m_buckets(BUCKETS)
+		, m_never(T::never())
+		{
+			for (auto &b : m_buckets)
+				b.reserve(list_size / BUCKETS + 2);
+			clear();
+		}
+		~timed_queue_calendar() = default;
+
+		PCOPYASSIGNMOVE(timed_queue_calendar, delete)
+
+		bool empty() const noexcept { return m_size == 0; }
+
+		template<bool KEEPSTAT, typename... Args>
+		void emplace(Args&&... args) noexcept
+		{
+			push<KEEPSTAT>(T(std::forward<Args>(args)...));
+		}
+
+		template<bool KEEPSTAT>
+		void push(T && e) noexcept
+		{
+			// Lock
+			lock_guard_type lck(m_lock);
+			insert<KEEPSTAT>(std::move(e), false);
+			if (KEEPSTAT)
+				m_prof_call.inc();
+		}
+
+		void pop() noexcept
+		{
+			auto &b(m_buckets[m_min]);
+			const auto slot(time_slot(b.back()));
+			b.pop_back();
+			--m_size;
+			find_min(slot);
+		}
+
+		const T &top() const noexcept { return m_size == 0 ? m_never : m_buckets[m_min].back(); }
+
+		template <bool KEEPSTAT, class R>
+		void remove(const R &elem) noexcept
+		{
+			// Lock
+			lock_guard_type lck(m_lock);
+			if (KEEPSTAT)
+				m_prof_remove.inc();
+			if (remove_from(m_buckets[bucket_hint(elem)], elem))
+				return;
+			for (auto &b : m_buckets)
+				if (remove_from(b, elem))
+					return;
+		}
+
+		template <bool KEEPSTAT, class R>
+		void retime(R && elem) noexcept
+		{
+			// Lock
+			lock_guard_type lck(m_lock);
+			if (KEEPSTAT)
+				m_prof_retime.inc();
+			for (auto &b : m_buckets)
+			{
+				for (T * i = &b.back(); i > &b[0]; --i)
+				{
+					if (*i == elem) // partial equal!
+					{
+						// Like timed_queue_linear, an entry moved to an
+						// earlier time is queued after entries of equal time.
+						const bool earlier(elem < *i);
+						remove_at(b, i);
+						insert<false>(T(std::forward<R>(elem)), earlier);
+						return;
+					}
+				}
+			}
+		}
+
+		void clear() noexcept
+		{
+			lock_guard_type lck(m_lock);
+			// put an empty element with maximum time into each bucket.
+			// the insert algo above will run into this element and doesn't
+			// need a comparison with bucket start.
+			for (auto &b : m_buckets)
+			{
+				b.clear();
+				b.push_back(T::never());
+			}
+			m_size = 0;
+			m_min = 0;
+		}
+
+		// save state support & mame disasm
+
+		std::size_t size() const noexcept { return m_size; }
+		const T & operator[](std::size_t index) const noexcept
+		{
+			for (const auto &b : m_buckets)
+			{
+				if (index < b.size() - 1)
+					return b[1 + index];
+				index -= b.size() - 1;
+			}
+			return m_never;
+		}
+
+	private:
+		using mutex_type       = pspin_mutex<TS>;
+		using lock_guard_type  = std::lock_guard<mutex_type>;
+
+		static std::uint64_t time_slot(const T &e) noexcept
+		{
+			return static_cast<std::uint64_t>(e.exec_time().as_raw() >> SHIFT);
+		}
+
+		static std::size_t bucket(const T &e) noexcept
+		{
+			return static_cast<std::size_t>(time_slot(e) & (BUCKETS - 1));
+		}
+
+		static std::size_t bucket_hint(const T &e) noexcept { return bucket(e); }
+
+		template <class R>
+		static std::size_t bucket_hint(const R &elem) noexcept
+		{
+			plib::unused_var(elem);
+			return 0;
+		}
+
+		// Entries of equal time are passed if after_equal is set.
+		template<bool KEEPSTAT>
+		void insert(T &&e, bool after_equal) noexcept
+		{
+			const std::size_t bi(bucket(e));
+			auto &b(m_buckets[bi]);
+			b.push_back(std::move(e));
+			T * i(&b.back());
+			for (; *(i-1) < *i || (after_equal && *(i-1) <= *i); --i)
+			{
+				std::swap(*(i-1), *(i));
+				if (KEEPSTAT)
+					m_prof_sortmove.inc();
+			}
+			if (m_size++ == 0 || b.back() <= top())
+				m_min = bi;
+		}
+
+		void remove_at(aligned_vector<T> &b, T *i) noexcept
+		{
+			const bool was_top(i == &top());
+			const auto slot(time_slot(*i));
+			std::copy(i+1, &b.back() + 1, i);
+			b.pop_back();
+			--m_size;
+			if (was_top)
+				find_min(slot);
+		}
+
+		template <class R>
+		bool remove_from(aligned_vector<T> &b, const R &elem) noexcept
+		{
+			for (T * i = &b.back(); i > &b[0]; --i)
+			{
+				// == operator ignores time!
+				if (*i == elem)
+				{
+					remove_at(b, i);
+					return true;
+				}
+			}
+			return false;
+		}
+
+		// All entries are at or after slot. The first bucket in calendar
+		// order holding an entry for its slot of the current year holds
+		// the minimum. If there is none, search directly.
+		void find_min(std::uint64_t slot) noexcept
+		{
+			if (m_size == 0)
+				return;
+			for (std::size_t i = 0; i < BUCKETS; i++, slot++)
+			{
+				const auto &b(m_buckets[slot & (BUCKETS - 1)]);
+				if (b.size() > 1 && time_slot(b.back()) == slot)
+				{
+					m_min = static_cast<std::size_t>(slot & (BUCKETS - 1));
+					return;
+				}
+			}
+			const T *best(&m_never);
+			for (std::size_t i = 0; i < BUCKETS; i++)
+			{
+				if (m_buckets[i].size() > 1 && m_buckets[i].back() < *best)
+				{
+					best = &m_buckets[i].back();
+					m_min = i;
+				}
+			}
+		}
+
+		mutex_type                       m_lock;
+		std::vector<aligned_vector<T>>   m_buckets;
+		std::size_t                      m_size;
+		std::size_t                      m_min;
+		T                                m_never;
+
+	public:
+		// profiling
+		pperfcount_t<true> m_prof_sortmove; // NOLINT
+		pperfcount_t<true> m_prof_call; // NOLINT
+		pperfcount_t<true> m_prof_remove; // NOLINT
+		pperfcount_t<true> m_prof_retime; // NOLINT
+	};
+
+	///
+	/// \brief Record the operations on a timed queue
+	///
+	/// Writes one line per operation to the stream passed to trace_to:
+	///
+	///     p <time> <id>    push
+	///     r <time> <id>    remove, time is -1 if not known
+	///     t <time> <id>    retime
+	///     o                pop
+	///     c                clear
+	///
+	/// Objects are numbered in order of first appearance, 0 is nullptr.
+	/// Times are raw. The traces can be replayed by the queue benchmark
+	/// in the netlist tests.
+	///
+	template <class Q>
+	class timed_queue_trace : public Q
+	{
+	public:
+		explicit timed_queue_trace(const std::size_t list_size)
+		: Q(list_size)
+		, m_strm(nullptr)
+		{
+		}
+
+		void trace_to(std::ostream *strm) noexcept { m_strm = strm; }
+
+		template<bool KEEPSTAT, typename... Args>
+		void emplace(Args&&... args) noexcept
+		{
+			push<KEEPSTAT>(typename value_type<Q>::type(std::forward<Args>(args)...));
+		}
+
+		template<bool KEEPSTAT, class T>
+		void push(T && e) noexcept
+		{
+			trace('p', e.exec_time().as_raw(), e.object());
+			Q::template push<KEEPSTAT>(std::forward<T>(e));
+		}
+
+		void pop() noexcept
+		{
+			if (m_strm != nullptr)
+				*m_strm << "o\n";
+			Q::pop();
+		}
+
+		template <bool KEEPSTAT, class R>
+		void remove(const R &elem) noexcept
+		{
+			trace_remove(elem);
+			Q::template remove<KEEPSTAT>(elem);
+		}
+
+		template <bool KEEPSTAT, class R>
+		void retime(R && elem) noexcept
+		{
+			trace('t', elem.exec_time().as_raw(), elem.object());
+			Q::template retime<KEEPSTAT>(std::forward<R>(elem));
+		}
+
+		void clear() noexcept
+		{
+			if (m_strm != nullptr)
+				*m_strm << "c\n";
+			Q::clear();
+		}
+
+	private:
+		template <class C>
+		struct value_type
+		{
+			using type = std::remove_cv_t<std::remove_reference_t<decltype(std::declval<C>().top())>>;
+		};
+
+		template <typename TT>
+		void trace(char op, TT t, const void *obj) noexcept
+		{
+			if (m_strm == nullptr)
+				return;
+			auto it(m_ids.find(obj));
+			if (it == m_ids.end())
+				it = m_ids.insert({obj, m_ids.size()}).first;
+			*m_strm << op << ' ' << static_cast<std::int64_t>(t) << ' ' << it->second << '\n';
+		}
+
+		template <class R>
+		void trace_remove(const R &elem) noexcept
+		{
+			trace('r', elem.exec_time().as_raw(), elem.object());
+		}
+
+		template <class R>
+		void trace_remove(R * const &elem) noexcept
+		{
+			trace('r', -1, elem);
+		}
+
+		std::ostream *m_strm;
+		std::unordered_map<const void *, std::size_t> m_ids { {nullptr, 0} };
+	};
+
 } // namespace plib
 
 #endif // PTIMED_QUEUE_H_
@@ -9,6 +9,10 @@
 ///
 /// Base vector operations
 ///
+/// Containers passed to these functions must store their elements
+/// contiguously. For float and double the SSE2 kernels are used if
+/// \ref PUSE_SSE2 is enabled. These sum in a different order than the
+/// scalar loops, results may thus differ in the last bits.
 ///
 #include "pconfig.h"
 #include "pmath.h"
@@ -16,6 +20,11 @@
 #include <algorithm>
 #include <array>
 #include <type_traits>
+#include <utility>
+
+#if (PUSE_SSE2)
+#include <emmintrin.h>
+#endif
 
 #if !defined(__clang__) && !defined(_MSC_VER) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ > 6))
 #if !(__GNUC__ > 7 || (__GNUC__ == 7 && __GNUC_MINOR__ > 3))
@@ -26,6 +35,383 @@
 
 namespace plib
 {
+	namespace detail
+	{
+		template <typename V>
+		using vec_value_t = typename std::decay<decltype(std::declval<const V &>()[0])>::type;
+
+		/// \brief SIMD lanes used by the vector kernels.
+		///
+		/// Types without a specialization use the scalar loops.
+		///
+		template <typename T>
+		struct simd_t
+		{
+			static constexpr const bool enabled = false;
+		};
+
+#if (PUSE_SSE2)
+		template <>
+		struct simd_t<double>
+		{
+			static constexpr const bool enabled = true;
+			static constexpr const std::size_t lanes = 2;
+			using type = __m128d;
+
+			static type zero() noexcept { return _mm_setzero_pd(); }
+			static type set1(double v) noexcept { return _mm_set1_pd(v); }
+			static type load(const double *p) noexcept { return _mm_loadu_pd(p); }
+			static void store(double *p, type v) noexcept { _mm_storeu_pd(p, v); }
+			template <typename C>
+			static type gather(const double *p, const C *idx) noexcept { return _mm_set_pd(p[idx[1]], p[idx[0]]); }
+			static type add(type a, type b) noexcept { return _mm_add_pd(a, b); }
+			static type sub(type a, type b) noexcept { return _mm_sub_pd(a, b); }
+			static type mul(type a, type b) noexcept { return _mm_mul_pd(a, b); }
+			static type max(type a, type b) noexcept { return _mm_max_pd(a, b); }
+			static type abs(type a) noexcept { return _mm_andnot_pd(_mm_set1_pd(-0.0), a); }
+			static double hsum(type a) noexcept { return _mm_cvtsd_f64(_mm_add_sd(a, _mm_unpackhi_pd(a, a))); }
+			static double hmax(type a) noexcept { return _mm_cvtsd_f64(_mm_max_sd(a, _mm_unpackhi_pd(a, a))); }
+		};
+
+		template <>
+		struct simd_t<float>
+		{
+			static constexpr const bool enabled = true;
+			static constexpr const std::size_t lanes = 4;
+			using type = __m128;
+
+			static type zero() noexcept { return _mm_setzero_ps(); }
+			static type set1(float v) noexcept { return _mm_set1_ps(v); }
+			static type load(const float *p) noexcept { return _mm_loadu_ps(p); }
+			static void store(float *p, type v) noexcept { _mm_storeu_ps(p, v); }
+			template <typename C>
+			static type gather(const float *p, const C *idx) noexcept { return _mm_set_ps(p[idx[3]], p[idx[2]], p[idx[1]], p[idx[0]]); }
+			static type add(type a, type b) noexcept { return _mm_add_ps(a, b); }
+			static type sub(type a, type b) noexcept { return _mm_sub_ps(a, b); }
+			static type mul(type a, type b) noexcept { return _mm_mul_ps(a, b); }
+			static type max(type a, type b) noexcept { return _mm_max_ps(a, b); }
+			static type abs(type a) noexcept { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+			static float hsum(type a) noexcept
+			{
+				a = _mm_add_ps(a, _mm_movehl_ps(a, a));
+				return _mm_cvtss_f32(_mm_add_ss(a, _mm_shuffle_ps(a, a, 1)));
+			}
+			static float hmax(type a) noexcept
+			{
+				a = _mm_max_ps(a, _mm_movehl_ps(a, a));
+				return _mm_cvtss_f32(_mm_max_ss(a, _mm_shuffle_ps(a, a, 1)));
+			}
+		};
+#endif
+
+		/// \brief True if all containers hold elements of type T and T has SIMD lanes.
+		///
+		template <typename T, typename... V>
+		struct use_simd;
+
+		template <typename T>
+		struct use_simd<T> : public std::integral_constant<bool, simd_t<T>::enabled> { };
+
+		template <typename T, typename V, typename... VS>
+		struct use_simd<T, V, VS...> : public std::integral_constant<bool,
+			std::is_same<T, vec_value_t<V>>::value && use_simd<T, VS...>::value> { };
+
+		// The kernels below use two accumulators to hide the add latency.
+
+		template <typename T>
+		T simd_mult(const std::size_t n, const T *v1, const T *v2) noexcept
+		{
+			using S = simd_t<T>;
+			constexpr const std::size_t L = S::lanes;
+			auto s0(S::zero());
+			auto s1(S::zero());
+			std::size_t i = 0;
+			for (; i + 2 * L <= n; i += 2 * L)
+			{
+				s0 = S::add(s0, S::mul(S::load(v1 + i), S::load(v2 + i)));
+				s1 = S::add(s1, S::mul(S::load(v1 + i + L), S::load(v2 + i + L)));
+			}
+			if (i + L <= n)
+			{
+				s0 = S::add(s0, S::mul(S::load(v1 + i), S::load(v2 + i)));
+				i += L;
+			}
+			T ret(S::hsum(S::add(s0, s1)));
+			for (; i < n; i++)
+				ret += v1[i] * v2[i];
+			return ret;
+		}
+
+		template <typename T>
+		T simd_sum(const std::size_t n, const T *v) noexcept
+		{
+			using S = simd_t<T>;
+			constexpr const std::size_t L = S::lanes;
+			auto s0(S::zero());
+			auto s1(S::zero());
+			std::size_t i = 0;
+			for (; i + 2 * L <= n; i += 2 * L)
+			{
+				s0 = S::add(s0, S::load(v + i));
+				s1 = S::add(s1, S::load(v + i + L));
+			}
+			if (i + L <= n)
+			{
+				s0 = S::add(s0, S::load(v + i));
+				i += L;
+			}
+			T ret(S::hsum(S::add(s0, s1)));
+			for (; i < n; i++)
+				ret += v[i];
+			return ret;
+		}
+
+		template <typename T>
+		T simd_maxabs(const std::size_t n, const T *v) noexcept
+		{
+			using S = simd_t<T>;
+			constexpr const std::size_t L = S::lanes;
+			auto m(S::zero());
+			std::size_t i = 0;
+			for (; i + L <= n; i += L)
+				m = S::max(S::abs(S::load(v + i)), m);
+			T ret(S::hmax(m));
+			for (; i < n; i++)
+				ret = std::max(ret, plib::abs(v[i]));
+			return ret;
+		}
+
+		template <typename T, typename C>
+		T simd_mult_sparse(const std::size_t n, const T *v, const C *idx, const T *x) noexcept
+		{
+			using S = simd_t<T>;
+			constexpr const std::size_t L = S::lanes;
+			auto s(S::zero());
+			std::size_t i = 0;
+			for (; i + L <= n; i += L)
+				s = S::add(s, S::mul(S::load(v + i), S::gather(x, idx + i)));
+			T ret(S::hsum(s));
+			for (; i < n; i++)
+				ret += v[i] * x[idx[i]];
+			return ret;
+		}
+
+		// result = s * v + a * result, a being 0 or 1
+		template <bool ADD, typename T>
+		void simd_mult_scalar(const std::size_t n, T *result, const T *v, T scalar) noexcept
+		{
+			using S = simd_t<T>;
+			constexpr const std::size_t L = S::lanes;
+			const auto s(S::set1(scalar));
+			std::size_t i = 0;
+			for (; i + L <= n; i += L)
+			{
+				const auto t(S::mul(s, S::load(v + i)));
+				S::store(result + i, ADD ? S::add(S::load(result + i), t) : t);
+			}
+			for (; i < n; i++)
+				result[i] = ADD ? result[i] + scalar * v[i] : scalar * v[i];
+		}
+
+		template <typename T>
+		void simd_add_ip(const std::size_t n, T *result, const T *v) noexcept
+		{
+			using S = simd_t<T>;
+			constexpr const std::size_t L = S::lanes;
+			std::size_t i = 0;
+			for (; i + L <= n; i += L)
+				S::store(result + i, S::add(S::load(result + i), S::load(v + i)));
+			for (; i < n; i++)
+				result[i] += v[i];
+		}
+
+		template <typename T>
+		void simd_sub(const std::size_t n, T *result, const T *v1, const T *v2) noexcept
+		{
+			using S = simd_t<T>;
+			constexpr const std::size_t L = S::lanes;
+			std::size_t i = 0;
+			for (; i + L <= n; i += L)
+				S::store(result + i, S::sub(S::load(v1 + i), S::load(v2 + i)));
+			for (; i < n; i++)
+				result[i] = v1[i] - v2[i];
+		}
+
+		template <typename T>
+		void simd_scale(const std::size_t n, T *v, T scalar) noexcept
+		{
+			using S = simd_t<T>;
+			constexpr const std::size_t L = S::lanes;
+			const auto s(S::set1(scalar));
+			std::size_t i = 0;
+			for (; i + L <= n; i += L)
+				S::store(v + i, S::mul(S::load(v + i), s));
+			for (; i < n; i++)
+				v[i] *= scalar;
+		}
+
+		// Scalar and SIMD versions of the operations below. The SIMD
+		// versions are selected by use_simd.
+
+		template<typename T, typename V1, typename V2>
+		T vec_mult(const std::size_t n, const V1 & v1, const V2 & v2, std::false_type) noexcept
+		{
+			using b8 = std::array<T, 8>; // NOLINT
+			PALIGNAS_VECTOROPT() b8 value = {0};
+			for (std::size_t i = 0; i < n ; i++ )
+			{
+				value[i & 7] += v1[i] * v2[i]; // NOLINT
+			}
+			return value[0] + value[1] + value[2] + value[3] + value[4] + value[5] + value[6] + value[7]; // NOLINT
+		}
+
+		template<typename T, typename V1, typename V2>
+		T vec_mult(const std::size_t n, const V1 & v1, const V2 & v2, std::true_type) noexcept
+		{
+			return simd_mult<T>(n, &v1[0], &v2[0]);
+		}
+
+		template<typename T, typename VT>
+		T vec_mult2(const std::size_t n, const VT &v, std::false_type) noexcept
+		{
+			using b8 = std::array<T, 8>;
+			PALIGNAS_VECTOROPT() b8 value = {0};
+			for (std::size_t i = 0; i < n ; i++ )
+			{
+				value[i & 7] += v[i] * v[i];
+			}
+			return value[0] + value[1] + value[2] + value[3] + value[4] + value[5] + value[6] + value[7];
+		}
+
+		template<typename T, typename VT>
+		T vec_mult2(const std::size_t n, const VT &v, std::true_type) noexcept
+		{
+			return simd_mult<T>(n, &v[0], &v[0]);
+		}
+
+		template<typename T, typename VT>
+		T vec_sum(const std::size_t n, const VT &v, std::false_type) noexcept
+		{
+			if (n<8)
+			{
+				T value(0);
+				for (std::size_t i = 0; i < n ; i++ )
+					value += v[i];
+
+				return value;
+			}
+
+			using b8 = std::array<T, 8>;
+			PALIGNAS_VECTOROPT() b8 value = {0};
+			for (std::size_t i = 0; i < n ; i++ )
+				value[i & 7] += v[i];
+
+			return ((value[0] + value[1]) + (value[2] + value[3])) + ((value[4] + value[5]) + (value[6] + value[7]));
+		}
+
+		template<typename T, typename VT>
+		T vec_sum(const std::size_t n, const VT &v, std::true_type) noexcept
+		{
+			return simd_sum<T>(n, &v[0]);
+		}
+
+		template<typename T, typename V, typename VI, typename VX>
+		T vec_mult_sparse(const std::size_t n, const V &v, const VI &idx, const VX &x, std::false_type) noexcept
+		{
+			T value(0);
+			for (std::size_t i = 0; i < n; i++)
+				value += v[i] * x[idx[i]];
+			return value;
+		}
+
+		template<typename T, typename V, typename VI, typename VX>
+		T vec_mult_sparse(const std::size_t n, const V &v, const VI &idx, const VX &x, std::true_type) noexcept
+		{
+			return simd_mult_sparse<T>(n, &v[0], &idx[0], &x[0]);
+		}
+
+		template<typename VV, typename T, typename VR>
+		void vec_mult_scalar(const std::size_t n, VR & result, const VV & v, const T & s, std::false_type) noexcept
+		{
+			for ( std::size_t i = 0; i < n; i++ )
+				result[i] = s * v[i];
+		}
+
+		template<typename VV, typename T, typename VR>
+		void vec_mult_scalar(const std::size_t n, VR & result, const VV & v, const T & s, std::true_type) noexcept
+		{
+			simd_mult_scalar<false, T>(n, &result[0], &v[0], s);
+		}
+
+		template<typename VR, typename VV, typename T>
+		void vec_add_mult_scalar(const std::size_t n, VR & result, const VV & v, const T & s, std::false_type) noexcept
+		{
+			for ( std::size_t i = 0; i < n; i++ )
+				result[i] += s * v[i];
+		}
+
+		template<typename VR, typename VV, typename T>
+		void vec_add_mult_scalar(const std::size_t n, VR & result, const VV & v, const T & s, std::true_type) noexcept
+		{
+			simd_mult_scalar<true, T>(n, &result[0], &v[0], s);
+		}
+
+		template<typename R, typename V>
+		void vec_add_ip(const std::size_t n, R & result, const V & v, std::false_type) noexcept
+		{
+			for ( std::size_t i = 0; i < n; i++ )
+				result[i] += v[i];
+		}
+
+		template<typename R, typename V>
+		void vec_add_ip(const std::size_t n, R & result, const V & v, std::true_type) noexcept
+		{
+			simd_add_ip(n, &result[0], &v[0]);
+		}
+
+		template<typename VR, typename V1, typename V2>
+		void vec_sub(const std::size_t n, VR & result, const V1 &v1, const V2 & v2, std::false_type) noexcept
+		{
+			for ( std::size_t i = 0; i < n; i++ )
+				result[i] = v1[i] - v2[i];
+		}
+
+		template<typename VR, typename V1, typename V2>
+		void vec_sub(const std::size_t n, VR & result, const V1 &v1, const V2 & v2, std::true_type) noexcept
+		{
+			simd_sub(n, &result[0], &v1[0], &v2[0]);
+		}
+
+		template<typename V, typename T>
+		void vec_scale(const std::size_t n, V & v, const T & s, std::false_type) noexcept
+		{
+			for ( std::size_t i = 0; i < n; i++ )
+				v[i] *= s;
+		}
+
+		template<typename V, typename T>
+		void vec_scale(const std::size_t n, V & v, const T & s, std::true_type) noexcept
+		{
+			simd_scale(n, &v[0], s);
+		}
+
+		template<typename T, typename V>
+		T vec_maxabs(const std::size_t n, const V & v, std::false_type) noexcept
+		{
+			T ret = 0.0;
+			for ( std::size_t i = 0; i < n; i++ )
+				ret = std::max(ret, plib::abs(v[i]));
+
+			return ret;
+		}
+
+		template<typename T, typename V>
+		T vec_maxabs(const std::size_t n, const V & v, std::true_type) noexcept
+		{
+			return simd_maxabs<T>(n, &v[0]);
+		}
+	} // namespace detail
+
 	template<typename VT, typename T>
 	void vec_set_scalar(const std::size_t n, VT &v, T && scalar) noexcept
 	{
@@ -44,100 +430,77 @@ namespace plib
 	template<typename T, typename V1, typename V2>
 	T vec_mult(const std::size_t n, const V1 & v1, const V2 & v2 ) noexcept
 	{
-		using b8 = std::array<T, 8>; // NOLINT
-		PALIGNAS_VECTOROPT() b8 value = {0};
-		for (std::size_t i = 0; i < n ; i++ )
-		{
-			value[i & 7] += v1[i] * v2[i]; // NOLINT
-		}
-		return value[0] + value[1] + value[2] + value[3] + value[4] + value[5] + value[6] + value[7]; // NOLINT
+		return detail::vec_mult<T>(n, v1, v2, detail::use_simd<T, V1, V2>());
 	}
 
 	template<typename T, typename VT>
 	T vec_mult2(const std::size_t n, const VT &v) noexcept
 	{
-		using b8 = std::array<T, 8>;
-		PALIGNAS_VECTOROPT() b8 value = {0};
-		for (std::size_t i = 0; i < n ; i++ )
-		{
-			value[i & 7] += v[i] * v[i];
-		}
-		return value[0] + value[1] + value[2] + value[3] + value[4] + value[5] + value[6] + value[7];
+		return detail::vec_mult2<T>(n, v, detail::use_simd<T, VT>());
 	}
 
 	template<typename T, typename VT>
 	T vec_sum(const std::size_t n, const VT &v) noexcept
 	{
-		if (n<8)
-		{
-			T value(0);
-			for (std::size_t i = 0; i < n ; i++ )
-				value += v[i];
-
-			return value;
-		}
-
-		using b8 = std::array<T, 8>;
-		PALIGNAS_VECTOROPT() b8 value = {0};
-		for (std::size_t i = 0; i < n ; i++ )
-			value[i & 7] += v[i];
+		return detail::vec_sum<T>(n, v, detail::use_simd<T, VT>());
+	}
 
-		return ((value[0] + value[1]) + (value[2] + value[3])) + ((value[4] + value[5]) + (value[6] + value[7]));
+	/// \brief Product of a sparse row with a vector
+	///
+	/// Returns the sum of v[i] * x[idx[i]] for i in [0, n).
+	///
+	template<typename T, typename V, typename VI, typename VX>
+	T vec_mult_sparse(const std::size_t n, const V &v, const VI &idx, const VX &x) noexcept
+	{
+		return detail::vec_mult_sparse<T>(n, v, idx, x, detail::use_simd<T, V, VX>());
 	}
 
 	template<typename VV, typename T, typename VR>
 	void vec_mult_scalar(const std::size_t n, VR & result, const VV & v, T && scalar) noexcept
 	{
-		const typename std::remove_reference<decltype(v[0])>::type s(std::forward<T>(scalar));
-		for ( std::size_t i = 0; i < n; i++ )
-			result[i] = s * v[i];
+		using VT = detail::vec_value_t<VV>;
+		const VT s(std::forward<T>(scalar));
+		detail::vec_mult_scalar(n, result, v, s, detail::use_simd<VT, VR, VV>());
 	}
 
 	template<typename VR, typename VV, typename T>
 	void vec_add_mult_scalar(const std::size_t n, VR & result, const VV & v, T && scalar) noexcept
 	{
-		const typename std::remove_reference<decltype(v[0])>::type s(std::forward<T>(scalar));
-		for ( std::size_t i = 0; i < n; i++ )
-			result[i] += s * v[i];
+		using VT = detail::vec_value_t<VV>;
+		const VT s(std::forward<T>(scalar));
+		detail::vec_add_mult_scalar(n, result, v, s, detail::use_simd<VT, VR, VV>());
 	}
 
 	template<typename T>
 	void vec_add_mult_scalar_p(const std::size_t n, T * result, const T * v, T scalar) noexcept
 	{
-		for ( std::size_t i = 0; i < n; i++ )
-			result[i] += scalar * v[i];
+		detail::vec_add_mult_scalar(n, result, v, scalar, detail::use_simd<T, T *>());
 	}
 
 	template<typename R, typename V>
 	void vec_add_ip(const std::size_t n, R & result, const V & v) noexcept
 	{
-		for ( std::size_t i = 0; i < n; i++ )
-			result[i] += v[i];
+		detail::vec_add_ip(n, result, v, detail::use_simd<detail::vec_value_t<V>, R, V>());
 	}
 
 	template<typename VR, typename V1, typename V2>
 	void vec_sub(const std::size_t n, VR & result, const V1 &v1, const V2 & v2) noexcept
 	{
-		for ( std::size_t i = 0; i < n; i++ )
-			result[i] = v1[i] - v2[i];
+		detail::vec_sub(n, result, v1, v2, detail::use_simd<detail::vec_value_t<V1>, VR, V1, V2>());
 	}
 
 	template<typename V, typename T>
 	void vec_scale(const std::size_t n, V & v, T &&scalar) noexcept
 	{
-		const typename std::remove_reference<decltype(v[0])>::type s(std::forward<T>(scalar));
-		for ( std::size_t i = 0; i < n; i++ )
-			v[i] *= s;
+		using VT = detail::vec_value_t<V>;
+		const VT s(std::forward<T>(scalar));
+		detail::vec_scale(n, v, s, detail::use_simd<VT, V>());
 	}
 
 	template<typename T, typename V>
 	T vec_maxabs(const std::size_t n, const V & v) noexcept
 	{
-		T ret = 0.0;
-		for ( std::size_t i = 0; i < n; i++ )
-			ret = std::max(ret, plib::abs(v[i]));
-
-		return ret;
+		return detail::vec_maxabs<T>(n, v, detail::use_simd<T, V>());
 	}
 } // namespace plib
 
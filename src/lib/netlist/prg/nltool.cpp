@@ -27,10 +27,6 @@
 #include <ios>
 #include <iostream> // scanf
 
-#ifndef NL_DISABLE_DYNAMIC_LOAD
-#define NL_DISABLE_DYNAMIC_LOAD 0
-#endif
-
 extern const plib::dynlib_static_sym nl_static_solver_syms[];
 
 // Forward declarations
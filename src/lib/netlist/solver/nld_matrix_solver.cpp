@@ -52,6 +52,8 @@ namespace solver
 		, m_stat_vsolver_calls(*this, "m_stat_vsolver_calls", 0)
 		, m_last_step(*this, "m_last_step", netlist_time_ext::zero())
 		, m_ops(0)
+		, m_warn_nr_invocation(false)
+		, m_warn_nr_failed(false)
 	{
 		setup_base(this->state().setup(), nets);
 
@@ -402,6 +404,13 @@ namespace solver
 
 	void matrix_solver_t::update_inputs()
 	{
+		if (m_warn_nr_invocation)
+			log().warning(MW_NEWTON_LOOPS_EXCEEDED_INVOCATION_3(100, this->name(), exec().time().as_double() * 1e6));
+		if (m_warn_nr_failed)
+			log().warning(MW_NEWTON_LOOPS_EXCEEDED_ON_NET_2(this->name(), exec().time().as_double() * 1e6));
+		m_warn_nr_invocation = false;
+		m_warn_nr_failed = false;
+
 		// avoid recursive calls. Inputs are updated outside this call
 		for (auto &inp : m_inps)
 			inp->push(inp->proxied_net()->Q_Analog());
@@ -490,13 +499,14 @@ namespace solver
 			next_time_step = compute_next_timestep(next_time_step.as_fp<nl_fptype>(), m_params.m_min_ts_ts(), m_params.m_max_timestep);
 		}
 
+		// solve may run on a worker thread, warnings are logged by update_inputs
 		if (m_stat_newton_raphson % 100 == 0)
-			log().warning(MW_NEWTON_LOOPS_EXCEEDED_INVOCATION_3(100, this->name(), exec().time().as_double() * 1e6));
+			m_warn_nr_invocation = true;
 
 		if (resched)
 		{
 			// reschedule ....
-			log().warning(MW_NEWTON_LOOPS_EXCEEDED_ON_NET_2(this->name(), exec().time().as_double() * 1e6));
+			m_warn_nr_failed = true;
 			return netlist_time::from_fp(m_params.m_nr_recalc_delay());
 		}
 		if (m_params.m_dynamic_ts)
@@ -12,6 +12,7 @@
 #include "nl_errstr.h"
 #include "plib/mat_cr.h"
 #include "plib/palloc.h"
+#include "plib/pdynlib.h"
 #include "plib/penum.h"
 #include "plib/pmatrix2d.h"
 #include "plib/pmempool.h"
@@ -235,6 +236,8 @@ namespace solver
 
 		// after every call to solve, update inputs must be called.
 		// this can be done as well as a batch to ease parallel processing.
+		// solve of different solvers may run concurrently, update_inputs
+		// is always called on the netlist thread.
 
 		netlist_time solve(netlist_time_ext now, const char *source);
 		void update_inputs();
@@ -307,6 +310,20 @@ namespace solver
 			return std::pair<pstring, pstring>("", plib::pfmt("/* solver doesn't support static compile */\n\n"));
 		}
 
+		/// \brief Resolve the static solver from a library
+		///
+		/// Solvers supporting static compile look up their static solver
+		/// in the netlist's static solver library on construction. This
+		/// allows a library built later on to be used as well. Solvers
+		/// which already have a static solver keep it.
+		///
+		virtual void load_static_solver(plib::dynlib_base &lib)
+		{
+			plib::unused_var(lib);
+		}
+
+		virtual bool has_static_solver() const noexcept { return false; }
+
 		// return number of floating point operations for solve
 		constexpr std::size_t ops() const { return m_ops; }
 
@@ -381,6 +398,8 @@ namespace solver
 		plib::aligned_vector<device_arena::unique_ptr<proxied_analog_output_t>> m_inps;
 
 		std::size_t m_ops;
+		bool m_warn_nr_invocation;
+		bool m_warn_nr_failed;
 
 		plib::aligned_vector<terms_for_net_t> m_rails_temp; // setup only
 	};
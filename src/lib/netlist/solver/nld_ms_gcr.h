@@ -100,19 +100,24 @@ namespace solver
 			// extended validation this will be different (and non-functional)
 			if (!this->state().is_extended_validation() && this->state().static_solver_lib().isLoaded())
 			{
-				pstring symname = static_compile_name();
-				m_proc.load(this->state().static_solver_lib(), symname);
-				if (m_proc.resolved())
-				{
-					this->state().log().info("External static solver {1} found ...", symname);
-				}
-				else
-				{
-					this->state().log().warning("External static solver {1} not found ...", symname);
-				}
+				load_static_solver(this->state().static_solver_lib());
+				if (!m_proc.resolved())
+					this->state().log().warning("External static solver {1} not found ...", static_compile_name());
 			}
 		}
 
+		void load_static_solver(plib::dynlib_base &lib) override
+		{
+			if (m_proc.resolved())
+				return;
+			pstring symname = static_compile_name();
+			m_proc.load(lib, symname);
+			if (m_proc.resolved())
+				this->state().log().info("External static solver {1} found ...", symname);
+		}
+
+		bool has_static_solver() const noexcept override { return m_proc.resolved(); }
+
 		void vsolve_non_dynamic() override;
 
 		std::pair<pstring, pstring> create_solver_code(static_compile_target target) override;
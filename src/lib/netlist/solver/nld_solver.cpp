@@ -20,6 +20,7 @@
 #include "plib/ptimed_queue.h"
 
 #include <algorithm>
+#include <thread>
 #include <type_traits>
 
 namespace netlist
@@ -43,6 +44,7 @@ namespace devices
 
 	void NETLIB_NAME(solver)::stop()
 	{
+		m_pool = nullptr;
 		for (auto &s : m_mat_solvers)
 			s->log_stats();
 	}
@@ -53,8 +55,6 @@ namespace devices
 	NETLIB_HANDLER(solver, fb_step)
 	{
 		const netlist_time_ext now(exec().time());
-		const std::size_t nthreads = m_params.m_parallel() < 2 ? 1 : std::min(static_cast<std::size_t>(m_params.m_parallel()), plib::omp::get_max_threads());
-		const netlist_time_ext sched(now + (nthreads <= 1 ? netlist_time_ext::zero() : netlist_time_ext::from_nsec(100)));
 		plib::uninitialised_array<solver::matrix_solver_t *, config::MAX_SOLVER_QUEUE_SIZE::value> tmp; //NOLINT
 		plib::uninitialised_array<netlist_time, config::MAX_SOLVER_QUEUE_SIZE::value> nt; //NOLINT
 		std::size_t p=0;
@@ -64,53 +64,55 @@ namespace devices
 			const auto t = m_queue.top().exec_time();
 			auto *o = m_queue.top().object();
 			if (t != now)
-				if (t > sched)
-					break;
+				break;
 			tmp[p++] = o;
 			m_queue.pop();
 		}
 
-		// FIXME: Disabled for now since parallel processing will decrease performance
-		//        for tested applications. More testing required here
-		if (true || nthreads < 2)
+		if (!KEEP_STATS)
 		{
-			if (!KEEP_STATS)
+			if (p < 2 || !m_pool)
 			{
 				for (std::size_t i = 0; i < p; i++)
-						nt[i] = tmp[i]->solve(now, "no-parallel");
+					nt[i] = tmp[i]->solve(now, "no-parallel");
 			}
 			else
 			{
-				stats()->m_stat_total_time.stop();
-				for (std::size_t i = 0; i < p; i++)
+				// Each solver only touches the nets of its own group, so
+				// the groups can be solved concurrently. Inputs are
+				// updated below in queue order on this thread, which
+				// keeps the results identical to serial execution.
+				auto f = [&tmp, &nt, now](std::size_t i)
 				{
-					tmp[i]->stats()->m_stat_call_count.inc();
-					auto g(tmp[i]->stats()->m_stat_total_time.guard());
-					nt[i] = tmp[i]->solve(now, "no-parallel");
-				}
-				stats()->m_stat_total_time.start();
-			}
-
-			for (std::size_t i = 0; i < p; i++)
-			{
-				if (nt[i] != netlist_time::zero())
-					m_queue.push<false>({now + nt[i], tmp[i]});
-				tmp[i]->update_inputs();
+					nt[i] = tmp[i]->solve(now, "parallel");
+				};
+				m_pool->run(p, f);
 			}
 		}
 		else
 		{
-			plib::omp::set_num_threads(nthreads);
-			plib::omp::for_static(static_cast<std::size_t>(0), p, [&tmp, &nt,now](std::size_t i)
-				{
-					nt[i] = tmp[i]->solve(now, "parallel");
-				});
-			for (std::size_t i = 0; i < p; i++)
+			stats()->m_stat_total_time.stop();
+			auto f = [&tmp, &nt, now](std::size_t i)
 			{
-				if (nt[i] != netlist_time::zero())
-					m_queue.push<false>({now + nt[i], tmp[i]});
-				tmp[i]->update_inputs();
+				tmp[i]->stats()->m_stat_call_count.inc();
+				auto g(tmp[i]->stats()->m_stat_total_time.guard());
+				nt[i] = tmp[i]->solve(now, "parallel");
+			};
+			if (p < 2 || !m_pool)
+			{
+				for (std::size_t i = 0; i < p; i++)
+					f(i);
 			}
+			else
+				m_pool->run(p, f);
+			stats()->m_stat_total_time.start();
+		}
+
+		for (std::size_t i = 0; i < p; i++)
+		{
+			if (nt[i] != netlist_time::zero())
+				m_queue.push<false>({now + nt[i], tmp[i]});
+			tmp[i]->update_inputs();
 		}
 		if (!m_queue.empty())
 			m_Q_step.net().toggle_and_push_to_queue(m_queue.top().exec_time() - now);
@@ -429,13 +431,25 @@ namespace devices
 			m_mat_solvers.push_back(std::move(ms));
 		}
 
+		// Solvers due at the same time are independent of each other and
+		// are spread across PARALLEL threads. The calling thread takes part.
+		const auto hw(std::max(std::thread::hardware_concurrency(), 1U));
+		const auto nthreads(std::min({static_cast<std::size_t>(std::max(m_params.m_parallel(), 1)),
+			static_cast<std::size_t>(hw), m_mat_solvers.size()}));
+		if (nthreads > 1)
+		{
+			log().verbose("Solving net groups on {1} threads", nthreads);
+			m_pool = std::make_unique<plib::pthread_pool>(nthreads - 1);
+		}
 	}
 
-	solver::static_compile_container NETLIB_NAME(solver)::create_solver_code(solver::static_compile_target target)
+	solver::static_compile_container NETLIB_NAME(solver)::create_solver_code(solver::static_compile_target target, bool missing_only)
 	{
 		solver::static_compile_container mp;
 		for (auto & s : m_mat_solvers)
 		{
+			if (missing_only && s->has_static_solver())
+				continue;
 			auto r = s->create_solver_code(target);
 			if (!r.first.empty()) // ignore solvers not supporting static compile
 				mp.push_back(r);
@@ -443,6 +457,12 @@ namespace devices
 		return mp;
 	}
 
+	void NETLIB_NAME(solver)::load_static_solvers(plib::dynlib_base &lib)
+	{
+		for (auto & s : m_mat_solvers)
+			s->load_static_solver(lib);
+	}
+
 	std::size_t NETLIB_NAME(solver)::get_solver_id(const solver::matrix_solver_t *net) const
 	{
 		for (std::size_t i=0; i < m_mat_solvers.size(); i++)
@@ -9,6 +9,7 @@
 ///
 
 #include "../nl_base.h"
+#include "../plib/pmulti_threading.h"
 #include "../plib/pstream.h"
 #include "nld_matrix_solver.h"
 
@@ -27,7 +28,7 @@ namespace devices
 	NETLIB_OBJECT(solver)
 	{
 	public:
-		using queue_type = detail::queue_base<solver::matrix_solver_t, false>;
+		using queue_type = detail::queue_base<solver::matrix_solver_t, plib::timed_queue_linear, false>;
 		using solver_arena = device_arena;
 
 		NETLIB_CONSTRUCTOR(solver)
@@ -49,7 +50,8 @@ namespace devices
 
 		auto gmin() const -> decltype(solver::solver_parameters_t::m_gmin()) { return m_params.m_gmin(); }
 
-		solver::static_compile_container create_solver_code(solver::static_compile_target target);
+		solver::static_compile_container create_solver_code(solver::static_compile_target target, bool missing_only = false);
+		void load_static_solvers(plib::dynlib_base &lib);
 
 		NETLIB_RESETI();
 		// NETLIB_UPDATE_PARAMI();
@@ -75,6 +77,7 @@ namespace devices
 
 		solver::solver_parameters_t m_params;
 		queue_type m_queue;
+		std::unique_ptr<plib::pthread_pool> m_pool;
 
 		template <typename FT, int SIZE>
 		solver_ptr create_solver(std::size_t size, const pstring &solvername,
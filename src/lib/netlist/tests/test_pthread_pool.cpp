@@ -0,0 +1,47 @@
+// license:GPL-2.0+
+// copyright-holders:Couriersud
+
+///
+/// \file test_pthread_pool.cpp
+///
+/// tests for pthread_pool
+///
+
+#include "plib/ptests.h"
+
+#include "plib/pmulti_threading.h"
+
+#include <atomic>
+#include <vector>
+
+PTEST(pthread_pool, all_indices_once)
+{
+	plib::pthread_pool pool(3);
+	for (std::size_t n = 0; n < 50; n++)
+	{
+		std::vector<std::atomic<int>> hits(n);
+		for (auto &h : hits)
+			h = 0;
+		auto f = [&hits](std::size_t i) { hits[i]++; };
+		pool.run(n, f);
+		std::size_t ok = 0;
+		for (auto &h : hits)
+			if (h == 1)
+				ok++;
+		PEXPECT_EQ(ok, n);
+	}
+}
+
+PTEST(pthread_pool, repeated_batches)
+{
+	plib::pthread_pool pool(2);
+	std::vector<std::size_t> res(8, 0);
+	auto f = [&res](std::size_t i) { res[i] += i; };
+	for (std::size_t k = 0; k < 10000; k++)
+		pool.run(res.size(), f);
+	std::size_t ok = 0;
+	for (std::size_t i = 0; i < res.size(); i++)
+		if (res[i] == i * 10000)
+			ok++;
+	PEXPECT_EQ(ok, res.size());
+}
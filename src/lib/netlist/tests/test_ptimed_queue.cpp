@@ -0,0 +1,215 @@
+// license:GPL-2.0+
+// copyright-holders:Couriersud
+
+///
+/// \file test_ptimed_queue.cpp
+///
+/// tests and benchmark for the timed queues
+///
+/// The benchmark replays the queue trace named by the environment
+/// variable NL_QUEUE_TRACE. Such traces are written by netlists compiled
+/// with NL_USE_QUEUE_TRACE, e.g. by running pong in nltool. Without a
+/// trace a synthetic TTL like load is used.
+///
+
+#include "plib/ptests.h"
+
+#include "plib/ptime.h"
+#include "plib/ptimed_queue.h"
+#include "plib/putil.h"
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+	struct qobj { std::size_t id; };
+
+	using qtime = plib::ptime<std::int64_t, 10'000'000'000LL>;
+	using qentry = plib::pqentry_t<qtime, qobj *>;
+
+	struct trace_op
+	{
+		char op;
+		std::int64_t time;
+		std::size_t id;
+	};
+
+	struct trace_t
+	{
+		std::vector<trace_op> ops;
+		std::size_t objects = 0;
+	};
+
+	// Nets toggling after gate delays of 10 to 30 ns, each pop triggering
+	// up to three further events. A net queued again is removed first, as
+	// done by the netlist core.
+	trace_t synthetic_trace(std::size_t nets, std::size_t pops)
+	{
+		trace_t tr;
+		tr.objects = nets + 1;
+		std::vector<std::int64_t> queued(nets + 1, -1);
+		std::uint32_t rnd = 12345;
+		auto next = [&rnd](std::uint32_t range) { rnd = rnd * 1664525U + 1013904223U; return (rnd >> 8) % range; };
+
+		plib::timed_queue_linear<qentry, false> q(1024);
+		std::vector<qobj> objs(nets + 1);
+		for (std::size_t i = 0; i < objs.size(); i++)
+			objs[i].id = i;
+
+		auto push = [&](std::int64_t t, std::size_t id)
+		{
+			if (queued[id] >= 0)
+			{
+				tr.ops.push_back({'r', queued[id], id});
+				q.remove<false>(qentry(qtime::from_raw(queued[id]), &objs[id]));
+			}
+			tr.ops.push_back({'p', t, id});
+			q.push<false>(qentry(qtime::from_raw(t), &objs[id]));
+			queued[id] = t;
+		};
+
+		for (std::size_t i = 1; i <= nets / 4; i++)
+			push(static_cast<std::int64_t>(next(1000)), i);
+
+		for (std::size_t i = 0; i < pops && !q.empty(); i++)
+		{
+			const auto t(q.top().exec_time().as_raw());
+			const auto id(q.top().object()->id);
+			tr.ops.push_back({'o', 0, 0});
+			q.pop();
+			queued[id] = -1;
+			const auto n(next(4));
+			for (std::size_t k = 0; k < n; k++)
+				push(t + 100 + next(200), 1 + next(static_cast<std::uint32_t>(nets)));
+			if (q.empty())
+				push(t + 100, 1 + next(static_cast<std::uint32_t>(nets)));
+		}
+		return tr;
+	}
+
+	trace_t load_trace(const pstring &filename)
+	{
+		trace_t tr;
+		std::ifstream strm(putf8string(filename).c_str());
+		char op;
+		while (strm >> op)
+		{
+			trace_op e{op, 0, 0};
+			if (op != 'o' && op != 'c')
+				strm >> e.time >> e.id;
+			tr.objects = std::max(tr.objects, e.id + 1);
+			tr.ops.push_back(e);
+		}
+		return tr;
+	}
+
+	// Replays the trace and returns the popped entries.
+	template <typename Q>
+	std::vector<trace_op> replay(const trace_t &tr, double &seconds)
+	{
+		std::vector<qobj> objs(tr.objects);
+		for (std::size_t i = 0; i < objs.size(); i++)
+			objs[i].id = i;
+		auto obj = [&objs](std::size_t id) { return id == 0 ? nullptr : &objs[id]; };
+
+		std::vector<trace_op> popped;
+		popped.reserve(tr.ops.size());
+		Q q(1024);
+		auto start(std::chrono::steady_clock::now());
+		for (const auto &e : tr.ops)
+		{
+			switch (e.op)
+			{
+				case 'p':
+					q.template push<false>(qentry(qtime::from_raw(e.time), obj(e.id)));
+					break;
+				case 'r':
+					if (e.time < 0)
+						q.template remove<false>(obj(e.id));
+					else
+						q.template remove<false>(qentry(qtime::from_raw(e.time), obj(e.id)));
+					break;
+				case 't':
+					q.template retime<false>(qentry(qtime::from_raw(e.time), obj(e.id)));
+					break;
+				case 'o':
+					popped.push_back({'o', q.top().exec_time().as_raw(), q.top().object() == nullptr ? 0 : q.top().object()->id});
+					q.pop();
+					break;
+				case 'c':
+					q.clear();
+					break;
+				default:
+					break;
+			}
+		}
+		seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		return popped;
+	}
+
+	bool same(const std::vector<trace_op> &a, const std::vector<trace_op> &b)
+	{
+		if (a.size() != b.size())
+			return false;
+		for (std::size_t i = 0; i < a.size(); i++)
+			if (a[i].time != b[i].time || a[i].id != b[i].id)
+				return false;
+		return true;
+	}
+
+	using queue_linear = plib::timed_queue_linear<qentry, false>;
+	using queue_heap = plib::timed_queue_heap<qentry, false>;
+	using queue_calendar = plib::timed_queue_calendar<qentry, false, 256, 7>;
+	// small geometry to exercise wrap around and direct search
+	using queue_calendar_small = plib::timed_queue_calendar<qentry, false, 4, 3>;
+
+} // namespace
+
+PTEST(ptimed_queue, calendar_order)
+{
+	const auto tr(synthetic_trace(200, 20000));
+	double t = 0.0;
+	const auto ref(replay<queue_linear>(tr, t));
+	PEXPECT_TRUE(same(ref, replay<queue_calendar>(tr, t)));
+	PEXPECT_TRUE(same(ref, replay<queue_calendar_small>(tr, t)));
+}
+
+PTEST(ptimed_queue, calendar_retime)
+{
+	std::vector<qobj> objs(4);
+	queue_calendar_small q(16);
+	q.push<false>(qentry(qtime::from_raw(100), &objs[1]));
+	q.push<false>(qentry(qtime::from_raw(50), &objs[2]));
+	q.push<false>(qentry(qtime::from_raw(500), nullptr));
+	// moved to an earlier time the entry is queued after equal entries
+	q.retime<false>(qentry(qtime::from_raw(50), nullptr));
+	PEXPECT_EQ(q.top().object(), &objs[2]);
+	q.pop();
+	PEXPECT_TRUE(q.top().object() == nullptr);
+	q.pop();
+	PEXPECT_EQ(q.top().object(), &objs[1]);
+	q.pop();
+	PEXPECT_TRUE(q.empty());
+}
+
+PTEST(ptimed_queue, benchmark)
+{
+	const pstring filename(plib::util::environment("NL_QUEUE_TRACE", ""));
+	const auto tr(filename.empty() ? synthetic_trace(300, 200000) : load_trace(filename));
+	double tl = 0.0;
+	double th = 0.0;
+	double tc = 0.0;
+	const auto ref(replay<queue_linear>(tr, tl));
+	const auto heap(replay<queue_heap>(tr, th));
+	const auto cal(replay<queue_calendar>(tr, tc));
+	std::cout << "\t" << tr.ops.size() << " operations from " << (filename.empty() ? "synthetic load" : putf8string(filename)) << "\n";
+	std::cout << "\tlinear   " << tl * 1000.0 << " ms\n";
+	std::cout << "\theap     " << th * 1000.0 << " ms\n";
+	std::cout << "\tcalendar " << tc * 1000.0 << " ms\n";
+	PEXPECT_EQ(heap.size(), ref.size());
+	PEXPECT_TRUE(same(ref, cal));
+}
@@ -0,0 +1,109 @@
+// license:GPL-2.0+
+// copyright-holders:Couriersud
+
+///
+/// \file test_vector_ops.cpp
+///
+/// tests for the vector operations
+///
+/// The results are compared against the scalar loops. Lengths are chosen
+/// to cover the vector bodies as well as the remainders.
+///
+
+#include "plib/ptests.h"
+
+#include "plib/vector_ops.h"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+	template <typename T>
+	std::vector<T> test_vector(std::size_t n, unsigned seed)
+	{
+		std::vector<T> v(n);
+		std::uint32_t rnd = seed;
+		for (auto &e : v)
+		{
+			rnd = rnd * 1664525U + 1013904223U;
+			e = static_cast<T>((static_cast<int>(rnd >> 16) & 0xffff) - 0x8000) / static_cast<T>(1000);
+		}
+		return v;
+	}
+
+	template <typename T>
+	bool near(T a, T b)
+	{
+		return std::abs(a - b) <= static_cast<T>(1e-4) * std::max(static_cast<T>(1), std::abs(b));
+	}
+
+	template <typename T>
+	bool check_reductions()
+	{
+		bool ok = true;
+		for (std::size_t n = 0; n < 20; n++)
+		{
+			const auto a(test_vector<T>(n, 1));
+			const auto b(test_vector<T>(n, 2));
+			std::vector<std::uint16_t> idx(n);
+			for (std::size_t i = 0; i < n; i++)
+				idx[i] = static_cast<std::uint16_t>((i * 7) % n);
+
+			ok = ok && near(plib::vec_mult<T>(n, a, b), plib::detail::vec_mult<T>(n, a, b, std::false_type()));
+			ok = ok && near(plib::vec_mult2<T>(n, a), plib::detail::vec_mult2<T>(n, a, std::false_type()));
+			ok = ok && near(plib::vec_sum<T>(n, a), plib::detail::vec_sum<T>(n, a, std::false_type()));
+			ok = ok && plib::vec_maxabs<T>(n, a) == plib::detail::vec_maxabs<T>(n, a, std::false_type());
+			ok = ok && near(plib::vec_mult_sparse<T>(n, a, idx, b),
+				plib::detail::vec_mult_sparse<T>(n, a, idx, b, std::false_type()));
+		}
+		return ok;
+	}
+
+	template <typename T>
+	bool check_updates()
+	{
+		bool ok = true;
+		for (std::size_t n = 1; n < 20; n++)
+		{
+			const auto a(test_vector<T>(n, 3));
+			const auto b(test_vector<T>(n, 4));
+			auto r1(test_vector<T>(n, 5));
+			auto r2(r1);
+			const T s(static_cast<T>(1.5));
+
+			plib::vec_add_mult_scalar(n, r1, a, s);
+			plib::detail::vec_add_mult_scalar(n, r2, a, s, std::false_type());
+			ok = ok && r1 == r2;
+			plib::vec_add_mult_scalar_p(n, &r1[0], &b[0], s);
+			plib::detail::vec_add_mult_scalar(n, r2, b, s, std::false_type());
+			ok = ok && r1 == r2;
+			plib::vec_mult_scalar(n, r1, a, s);
+			plib::detail::vec_mult_scalar(n, r2, a, s, std::false_type());
+			ok = ok && r1 == r2;
+			plib::vec_add_ip(n, r1, b);
+			plib::detail::vec_add_ip(n, r2, b, std::false_type());
+			ok = ok && r1 == r2;
+			plib::vec_sub(n, r1, a, b);
+			plib::detail::vec_sub(n, r2, a, b, std::false_type());
+			ok = ok && r1 == r2;
+			plib::vec_scale(n, r1, s);
+			plib::detail::vec_scale(n, r2, s, std::false_type());
+			ok = ok && r1 == r2;
+		}
+		return ok;
+	}
+} // namespace
+
+PTEST(vector_ops, reductions)
+{
+	PEXPECT_TRUE(check_reductions<double>());
+	PEXPECT_TRUE(check_reductions<float>());
+}
+
+PTEST(vector_ops, updates)
+{
+	PEXPECT_TRUE(check_updates<double>());
+	PEXPECT_TRUE(check_updates<float>());
+}
@@ -217,6 +217,33 @@ public:
 	PixelType &pix16(int32_t y, int32_t x = 0) const { static_assert(PixelBits == 16, "must be 16bpp"); return pixt<PixelType>(y, x); }
 	PixelType &pix32(int32_t y, int32_t x = 0) const { static_assert(PixelBits == 32, "must be 32bpp"); return pixt<PixelType>(y, x); }
 	PixelType &pix64(int32_t y, int32_t x = 0) const { static_assert(PixelBits == 64, "must be 64bpp"); return pixt<PixelType>(y, x); }
+
+	// walks down a column of rows by adding the row stride, so loops over
+	// rows don't redo the y * rowpixels multiply or reload the bitmap
+	class row_iterator
+	{
+	public:
+		row_iterator(PixelType *ptr, int32_t stride) : m_ptr(ptr), m_stride(stride) { }
+
+		PixelType *operator*() const { return m_ptr; }
+		PixelType &operator[](int32_t x) const { return m_ptr[x]; }
+		row_iterator &operator++() { m_ptr += m_stride; return *this; }
+		row_iterator &operator--() { m_ptr -= m_stride; return *this; }
+
+	private:
+		PixelType *     m_ptr;
+		int32_t         m_stride;
+	};
+
+	// row accessors
+	row_iterator rows(int32_t y, int32_t x = 0) const { return row_iterator(&pixt<PixelType>(y, x), rowpixels()); }
+	template <typename Func> void for_each_row(const rectangle &clip, Func &&func) const
+	{
+		PixelType *rowptr = &pixt<PixelType>(clip.top(), clip.left());
+		int32_t const stride = rowpixels();
+		for (int32_t y = clip.top(); y <= clip.bottom(); y++, rowptr += stride)
+			func(rowptr, y);
+	}
 };
 
 // 8bpp bitmaps
@@ -189,6 +189,13 @@ inline void chd_file::file_read(uint64_t offset, void *dest, uint32_t length)
 	if (m_file == nullptr)
 		throw CHDERR_NOT_OPEN;
 
+	// copy from the view if the file is mapped
+	if (m_mapview != nullptr && offset <= m_mapviewbytes && length <= m_mapviewbytes - offset)
+	{
+		memcpy(dest, m_mapview + offset, length);
+		return;
+	}
+
 	// seek and read
 	m_file->seek(offset, SEEK_SET);
 	uint32_t count = m_file->read(dest, length);
@@ -289,10 +296,18 @@ inline uint8_t chd_file::bits_for_value(uint64_t value)
 
 chd_file::chd_file()
 	: m_file(nullptr),
-		m_owns_file(false)
+		m_owns_file(false),
+		m_mapview(nullptr),
+		m_mapviewbytes(0),
+		m_cachehunks(DEFAULT_CACHE_HUNKS),
+		m_cacheclock(0),
+		m_readaheadhunks(DEFAULT_READAHEAD_HUNKS),
+		m_readahead_next(0),
+		m_readahead_queue(nullptr)
 {
 	// reset state
 	memset(m_decompressor, 0, sizeof(m_decompressor));
+	memset(m_readahead_decompressor, 0, sizeof(m_readahead_decompressor));
 	close();
 }
 
@@ -788,7 +803,6 @@ chd_error chd_file::open(util::core_file &file, bool writeable, chd_file *parent
 	m_file = &file;
 	m_owns_file = false;
 	m_parent = parent;
-	m_cachehunk = ~0;
 	return open_common(writeable);
 }
 
@@ -802,6 +816,17 @@ chd_error chd_file::open(util::core_file &file, bool writeable, chd_file *parent
 
 void chd_file::close()
 {
+	// stop decompressing ahead before the buffers go away
+	readahead_reset();
+	if (m_readahead_queue != nullptr)
+		osd_work_queue_free(m_readahead_queue);
+	m_readahead_queue = nullptr;
+	for (auto & elem : m_readahead_decompressor)
+	{
+		delete elem;
+		elem = nullptr;
+	}
+
 	// reset file characteristics
 	if (m_owns_file && m_file)
 		delete m_file;
@@ -841,10 +866,16 @@ void chd_file::close()
 		elem = nullptr;
 	}
 	m_compressed.clear();
+	m_zstd_dictionary.clear();
+
+	// drop the view; it belongs to the file
+	m_mapview = nullptr;
+	m_mapviewbytes = 0;
+	m_mapverified.clear();
 
 	// reset caching
 	m_cache.clear();
-	m_cachehunk = ~0;
+	m_readahead.clear();
 }
 
 /**
@@ -1064,14 +1095,16 @@ chd_error chd_file::write_hunk(uint32_t hunknum, const void *buffer)
 			be_write(rawmap, rawentry, 4);
 			file_write(m_mapoffset + hunknum * 4, rawmap, 4);
 
-			// update the cached hunk if we just wrote it
-			if (hunknum == m_cachehunk && buffer != &m_cache[0])
-				memcpy(&m_cache[0], buffer, m_hunkbytes);
 		}
 
 		// otherwise, just overwrite
 		else
 			file_write(uint64_t(rawentry) * uint64_t(m_hunkbytes), buffer, m_hunkbytes);
+
+		// update the cached hunk if we just wrote it
+		cache_entry *entry = cache_find(hunknum);
+		if (entry != nullptr && buffer != &entry->m_data[0])
+			memcpy(&entry->m_data[0], buffer, m_hunkbytes);
 		return CHDERR_NONE;
 	}
 
@@ -1147,22 +1180,24 @@ chd_error chd_file::read_bytes(uint64_t offset, void *buffer, uint32_t bytes)
 		uint32_t startoffs = (curhunk == first_hunk) ? (offset % m_hunkbytes) : 0;
 		uint32_t endoffs = (curhunk == last_hunk) ? ((offset + bytes - 1) % m_hunkbytes) : (m_hunkbytes - 1);
 
-		// if it's a full block, just read directly from disk unless it's the cached hunk
+		// hunks stored raw in a mapped file are copied straight from the view
 		chd_error err = CHDERR_NONE;
-		if (startoffs == 0 && endoffs == m_hunkbytes - 1 && curhunk != m_cachehunk)
+		const uint8_t *mapped = mapped_hunk(curhunk);
+		if (mapped != nullptr)
+			memcpy(dest, &mapped[startoffs], endoffs + 1 - startoffs);
+
+		// if it's a full block, just read directly from disk unless it's cached or being read ahead
+		else if (startoffs == 0 && endoffs == m_hunkbytes - 1 && cache_find(curhunk) == nullptr && readahead_find(curhunk) == nullptr)
 			err = read_hunk(curhunk, dest);
 
 		// otherwise, read from the cache
 		else
 		{
-			if (curhunk != m_cachehunk)
-			{
-				err = read_hunk(curhunk, &m_cache[0]);
-				if (err != CHDERR_NONE)
-					return err;
-				m_cachehunk = curhunk;
-			}
-			memcpy(dest, &m_cache[startoffs], endoffs + 1 - startoffs);
+			cache_entry *entry;
+			err = cache_fetch(curhunk, entry);
+			if (err != CHDERR_NONE)
+				return err;
+			memcpy(dest, &entry->m_data[startoffs], endoffs + 1 - startoffs);
 		}
 
 		// handle errors and advance
@@ -1200,23 +1235,20 @@ chd_error chd_file::write_bytes(uint64_t offset, const void *buffer, uint32_t by
 		uint32_t startoffs = (curhunk == first_hunk) ? (offset % m_hunkbytes) : 0;
 		uint32_t endoffs = (curhunk == last_hunk) ? ((offset + bytes - 1) % m_hunkbytes) : (m_hunkbytes - 1);
 
-		// if it's a full block, just write directly to disk unless it's the cached hunk
+		// if it's a full block, just write directly to disk unless it's cached
 		chd_error err = CHDERR_NONE;
-		if (startoffs == 0 && endoffs == m_hunkbytes - 1 && curhunk != m_cachehunk)
+		if (startoffs == 0 && endoffs == m_hunkbytes - 1 && cache_find(curhunk) == nullptr)
 			err = write_hunk(curhunk, source);
 
 		// otherwise, write from the cache
 		else
 		{
-			if (curhunk != m_cachehunk)
-			{
-				err = read_hunk(curhunk, &m_cache[0]);
-				if (err != CHDERR_NONE)
-					return err;
-				m_cachehunk = curhunk;
-			}
-			memcpy(&m_cache[startoffs], source, endoffs + 1 - startoffs);
-			err = write_hunk(curhunk, &m_cache[0]);
+			cache_entry *entry;
+			err = cache_fetch(curhunk, entry);
+			if (err != CHDERR_NONE)
+				return err;
+			memcpy(&entry->m_data[startoffs], source, endoffs + 1 - startoffs);
+			err = write_hunk(curhunk, &entry->m_data[0]);
 		}
 
 		// handle errors and advance
@@ -1227,6 +1259,93 @@ chd_error chd_file::write_bytes(uint64_t offset, const void *buffer, uint32_t by
 	return CHDERR_NONE;
 }
 
+/**
+ * @fn  chd_error chd_file::read_hunks_parallel(uint32_t hunknum, uint32_t count, const std::function<void (uint32_t hunknum, const uint8_t *data)> &callback, uint32_t inflight)
+ *
+ * @brief   -------------------------------------------------
+ *            read_hunks_parallel - read a range of hunks, decompressing up to
+ *            inflight of them at once on all processors; the callback is
+ *            called once per hunk, in order, on this thread
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum     The first hunk.
+ * @param   count       Number of hunks.
+ * @param   callback    Called with each hunk's data, which is only valid during the call.
+ * @param   inflight    Maximum number of hunks held in memory at once.
+ *
+ * @return  A chd_error; hunks after a failed one are not passed to the callback.
+ */
+
+chd_error chd_file::read_hunks_parallel(uint32_t hunknum, uint32_t count, const std::function<void (uint32_t hunknum, const uint8_t *data)> &callback, uint32_t inflight)
+{
+	// validate the range
+	if (hunknum > m_hunkcount || count > m_hunkcount - hunknum)
+		return CHDERR_HUNK_OUT_OF_RANGE;
+	if (count == 0)
+		return CHDERR_NONE;
+	inflight = std::max(1U, std::min(inflight, count));
+
+	osd_work_queue *queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	if (queue == nullptr)
+		return CHDERR_OUT_OF_MEMORY;
+	std::vector<readahead_item> items(inflight);
+	chd_decompressor *codecs[WORK_MAX_THREADS + 1][4] = { };
+
+	// read the compressed data here and decompress on the queue; anything
+	// else is read directly
+	uint32_t next = 0;
+	auto queue_next = [&]()
+	{
+		readahead_item &item = items[next % inflight];
+		if (!async_decompress_queue(item, hunknum + next, queue, codecs))
+		{
+			item.m_data.resize(m_hunkbytes);
+			item.m_err = read_hunk(hunknum + next, &item.m_data[0]);
+		}
+		next++;
+	};
+
+	// waits for everything in flight before the items and codecs go away
+	auto cleanup = [&]()
+	{
+		for (auto &item : items)
+			if (item.m_osd != nullptr)
+				readahead_finish(item);
+		osd_work_queue_free(queue);
+		for (auto &thread : codecs)
+			for (auto &codec : thread)
+				delete codec;
+	};
+
+	chd_error err = CHDERR_NONE;
+	try
+	{
+		while (next < inflight)
+			queue_next();
+
+		// hand the hunks out in order, refilling each slot once it has been used
+		for (uint32_t done = 0; done < count; done++)
+		{
+			readahead_item &item = items[done % inflight];
+			if (item.m_osd != nullptr)
+				readahead_finish(item);
+			err = item.m_err;
+			if (err != CHDERR_NONE)
+				break;
+			callback(hunknum + done, &item.m_data[0]);
+			if (next < count)
+				queue_next();
+		}
+	}
+	catch (...)
+	{
+		cleanup();
+		throw;
+	}
+	cleanup();
+	return err;
+}
+
 /**
  * @fn  chd_error chd_file::read_metadata(chd_metadata_tag searchtag, uint32_t searchindex, std::string &output)
  *
@@ -1535,6 +1654,10 @@ chd_error chd_file::clone_all_metadata(chd_file &source)
 		metaentry.flags = 0;
 		for (bool has_data = source.metadata_find(CHDMETATAG_WILDCARD, 0, metaentry); has_data; has_data = source.metadata_find(CHDMETATAG_WILDCARD, 0, metaentry, true))
 		{
+			// the source's dictionary only matches the source's compression
+			if (metaentry.metatag == ZSTD_DICTIONARY_METADATA_TAG)
+				continue;
+
 			// read the metadata item
 			filedata.resize(metaentry.length);
 			source.file_read(metaentry.offset + METADATA_HEADER_SIZE, &filedata[0], metaentry.length);
@@ -1642,6 +1765,27 @@ chd_error chd_file::codec_configure(chd_codec_type codec, int param, void *confi
 	}
 }
 
+/**
+ * @fn  void chd_file::configure_cache(uint32_t hunks, uint32_t readahead)
+ *
+ * @brief   -------------------------------------------------
+ *            configure_cache - set the number of hunks kept in the cache and the number of
+ *            hunks decompressed ahead of sequential reads
+ *          -------------------------------------------------.
+ *
+ * @param   hunks       Number of hunks in the cache, at least one.
+ * @param   readahead   Number of hunks to read ahead, zero to disable read-ahead.
+ */
+
+void chd_file::configure_cache(uint32_t hunks, uint32_t readahead)
+{
+	readahead_reset();
+	m_cachehunks = std::max<uint32_t>(hunks, 1);
+	m_readaheadhunks = readahead;
+	if (m_file != nullptr)
+		cache_reset();
+}
+
 /**
  * @fn  const char *chd_file::error_string(chd_error err)
  *
@@ -2386,6 +2530,18 @@ chd_error chd_file::open_common(bool writeable)
 		// reads are always permitted
 		m_allow_reads = true;
 
+		// read-only files are mapped if possible, so reads come straight from the page cache
+		if (!writeable)
+		{
+			const void *view;
+			uint64_t viewbytes;
+			if (m_file->map_view(view, viewbytes) == osd_file::error::NONE)
+			{
+				m_mapview = reinterpret_cast<const uint8_t *>(view);
+				m_mapviewbytes = viewbytes;
+			}
+		}
+
 		// read the raw header
 		uint8_t rawheader[MAX_HEADER_SIZE];
 		file_read(0, rawheader, sizeof(rawheader));
@@ -2426,6 +2582,8 @@ chd_error chd_file::open_common(bool writeable)
 
 		// finish opening the file
 		create_open_common();
+		if (m_mapview != nullptr)
+			m_mapverified.assign(m_hunkcount, false);
 		return CHDERR_NONE;
 	}
 
@@ -2450,6 +2608,16 @@ chd_error chd_file::open_common(bool writeable)
 
 void chd_file::create_open_common()
 {
+	// the zstd codecs are created with the file's dictionary, if there is one
+	m_zstd_dictionary.clear();
+	for (chd_codec_type type : m_compression)
+		if (type == CHD_CODEC_ZSTD || type == CHD_CODEC_CD_ZSTD)
+		{
+			if (read_metadata(ZSTD_DICTIONARY_METADATA_TAG, 0, m_zstd_dictionary) != CHDERR_NONE)
+				m_zstd_dictionary.clear();
+			break;
+		}
+
 	// verify the compression types and initialize the codecs
 	for (int decompnum = 0; decompnum < ARRAY_LENGTH(m_compression); decompnum++)
 	{
@@ -2465,9 +2633,9 @@ void chd_file::create_open_common()
 	else
 		file_read(m_mapoffset, &m_rawmap[0], m_rawmap.size());
 
-	// allocate the temporary compressed buffer and a buffer for caching
+	// allocate the temporary compressed buffer and the cache
 	m_compressed.resize(m_hunkbytes);
-	m_cache.resize(m_hunkbytes);
+	cache_reset();
 }
 
 /**
@@ -2737,6 +2905,330 @@ int CLIB_DECL chd_file::metadata_hash_compare(const void *elem1, const void *ele
 	return memcmp(elem1, elem2, sizeof(metadata_hash));
 }
 
+/**
+ * @fn  chd_file::cache_entry *chd_file::cache_find(uint32_t hunknum)
+ *
+ * @brief   -------------------------------------------------
+ *            cache_find - return the cache entry holding the given hunk, or nullptr
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum The hunknum.
+ *
+ * @return  null if it fails, else a cache_entry*.
+ */
+
+chd_file::cache_entry *chd_file::cache_find(uint32_t hunknum)
+{
+	for (auto &entry : m_cache)
+		if (entry.m_hunknum == hunknum)
+			return &entry;
+	return nullptr;
+}
+
+/**
+ * @fn  chd_error chd_file::cache_fetch(uint32_t hunknum, cache_entry *&entry)
+ *
+ * @brief   -------------------------------------------------
+ *            cache_fetch - get the given hunk into the cache, replacing the least recently used
+ *            entry; a hunk following a cached one starts decompressing the next hunks ahead
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum         The hunknum.
+ * @param [out] entry       The cache entry holding the hunk.
+ *
+ * @return  A chd_error.
+ */
+
+chd_error chd_file::cache_fetch(uint32_t hunknum, cache_entry *&entry)
+{
+	entry = cache_find(hunknum);
+	if (entry == nullptr)
+	{
+		// replace the entry that was used longest ago
+		bool const sequential = hunknum > 0 && cache_find(hunknum - 1) != nullptr;
+		entry = &m_cache[0];
+		for (auto &candidate : m_cache)
+			if (m_cacheclock - candidate.m_lastuse > m_cacheclock - entry->m_lastuse)
+				entry = &candidate;
+		entry->m_hunknum = ~uint32_t(0);
+
+		// take the hunk from the read-ahead if it got there first
+		readahead_item *item = readahead_find(hunknum);
+		if (item != nullptr && readahead_finish(*item))
+			entry->m_data.swap(item->m_data);
+		else
+		{
+			chd_error err = read_hunk(hunknum, &entry->m_data[0]);
+			if (err != CHDERR_NONE)
+				return err;
+		}
+		entry->m_hunknum = hunknum;
+
+		if (sequential)
+			for (uint32_t ahead = 1; ahead <= m_readaheadhunks; ahead++)
+				readahead_start(hunknum + ahead);
+	}
+	entry->m_lastuse = ++m_cacheclock;
+	return CHDERR_NONE;
+}
+
+/**
+ * @fn  void chd_file::cache_reset()
+ *
+ * @brief   -------------------------------------------------
+ *            cache_reset - allocate an empty cache of m_cachehunks hunks
+ *          -------------------------------------------------.
+ */
+
+void chd_file::cache_reset()
+{
+	readahead_reset();
+	m_cache.clear();
+	m_cache.resize(m_cachehunks);
+	for (auto &entry : m_cache)
+		entry.m_data.resize(m_hunkbytes);
+	m_cacheclock = 0;
+
+	// two streams, e.g. CD audio and data, can read ahead at the same time
+	m_readahead.clear();
+	m_readahead.resize(2 * m_readaheadhunks);
+	m_readahead_next = 0;
+}
+
+/**
+ * @fn  const uint8_t *chd_file::mapped_hunk(uint32_t hunknum)
+ *
+ * @brief   -------------------------------------------------
+ *            mapped_hunk - return the data of a hunk stored uncompressed within the mapped
+ *            view, or nullptr if it has to be read some other way
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum The hunknum.
+ *
+ * @return  null if the hunk is not available in the view, else a pointer to its data.
+ */
+
+const uint8_t *chd_file::mapped_hunk(uint32_t hunknum)
+{
+	if (m_mapview == nullptr || m_version < 5 || hunknum >= m_hunkcount)
+		return nullptr;
+
+	// only hunks stored as-is qualify
+	const uint8_t *rawmap = &m_rawmap[m_mapentrybytes * hunknum];
+	uint64_t blockoffs;
+	if (!compressed())
+		blockoffs = uint64_t(be_read(rawmap, 4)) * uint64_t(m_hunkbytes);
+	else if (rawmap[0] == COMPRESSION_NONE)
+		blockoffs = be_read(&rawmap[4], 6);
+	else
+		return nullptr;
+	if (blockoffs == 0 || blockoffs > m_mapviewbytes || m_hunkbytes > m_mapviewbytes - blockoffs)
+		return nullptr;
+
+	// check the CRC on first use; on a mismatch read_hunk reports the error
+	const uint8_t *data = m_mapview + blockoffs;
+	if (compressed() && !m_mapverified[hunknum])
+	{
+		if (util::crc16_creator::simple(data, m_hunkbytes) != util::crc16_t(be_read(&rawmap[10], 2)))
+			return nullptr;
+		m_mapverified[hunknum] = true;
+	}
+	return data;
+}
+
+/**
+ * @fn  chd_file::readahead_item *chd_file::readahead_find(uint32_t hunknum)
+ *
+ * @brief   -------------------------------------------------
+ *            readahead_find - return the read-ahead item for the given hunk, or nullptr
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum The hunknum.
+ *
+ * @return  null if it fails, else a readahead_item*.
+ */
+
+chd_file::readahead_item *chd_file::readahead_find(uint32_t hunknum)
+{
+	for (auto &item : m_readahead)
+		if (item.m_osd != nullptr && item.m_hunknum == hunknum)
+			return &item;
+	return nullptr;
+}
+
+/**
+ * @fn  void chd_file::readahead_start(uint32_t hunknum)
+ *
+ * @brief   -------------------------------------------------
+ *            readahead_start - read the compressed data for the given hunk and queue its
+ *            decompression; only hunks of read-only v5 files using a lossless codec qualify
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum The hunknum.
+ */
+
+void chd_file::readahead_start(uint32_t hunknum)
+{
+	// skip hunks that are already there
+	if (m_readahead.empty() || m_allow_writes || hunknum >= m_hunkcount)
+		return;
+	if (cache_find(hunknum) != nullptr || readahead_find(hunknum) != nullptr)
+		return;
+
+	// the queue is set up on first use; an I/O queue always gets exactly one thread
+	if (m_readahead_queue == nullptr)
+	{
+		m_readahead_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+		if (m_readahead_queue == nullptr)
+			return;
+	}
+
+	// recycle the oldest item
+	readahead_item &item = m_readahead[m_readahead_next];
+	m_readahead_next = (m_readahead_next + 1) % m_readahead.size();
+	if (item.m_osd != nullptr)
+		readahead_finish(item);
+	async_decompress_queue(item, hunknum, m_readahead_queue, &m_readahead_decompressor);
+}
+
+/**
+ * @fn  bool chd_file::readahead_finish(readahead_item &item)
+ *
+ * @brief   -------------------------------------------------
+ *            readahead_finish - wait for a read-ahead item and release it
+ *          -------------------------------------------------.
+ *
+ * @param [in,out]  item    The item.
+ *
+ * @return  true if the hunk was decompressed successfully.
+ */
+
+bool chd_file::readahead_finish(readahead_item &item)
+{
+	while (!osd_work_item_wait(item.m_osd, osd_ticks_per_second())) { }
+	osd_work_item_release(item.m_osd);
+	item.m_osd = nullptr;
+	item.m_hunknum = ~uint32_t(0);
+	return item.m_err == CHDERR_NONE;
+}
+
+/**
+ * @fn  void chd_file::readahead_reset()
+ *
+ * @brief   -------------------------------------------------
+ *            readahead_reset - wait for and drop all read-ahead items
+ *          -------------------------------------------------.
+ */
+
+void chd_file::readahead_reset()
+{
+	for (auto &item : m_readahead)
+		if (item.m_osd != nullptr)
+			readahead_finish(item);
+}
+
+/**
+ * @fn  bool chd_file::async_decompress_queue(readahead_item &item, uint32_t hunknum, osd_work_queue *queue, chd_decompressor *(*codecs)[4])
+ *
+ * @brief   -------------------------------------------------
+ *            async_decompress_queue - read the compressed data for the given hunk and
+ *            queue its decompression
+ *          -------------------------------------------------.
+ *
+ * @param [in,out]  item    The item to fill in.
+ * @param   hunknum         The hunk number.
+ * @param [in,out]  queue   The queue to decompress on.
+ * @param [in,out]  codecs  Decompressors indexed by thread id, created on first use.
+ *
+ * @return  false if the hunk is not compressed with a lossless codec of this file, or
+ *          its data could not be read; it must then be read with read_hunk.
+ */
+
+bool chd_file::async_decompress_queue(readahead_item &item, uint32_t hunknum, osd_work_queue *queue, chd_decompressor *(*codecs)[4])
+{
+	// only v5 hunks with a lossless codec of this file qualify; lossy codecs check the compressed data
+	if (m_version < 5 || !compressed() || hunknum >= m_hunkcount)
+		return false;
+	const uint8_t *rawmap = &m_rawmap[m_mapentrybytes * hunknum];
+	if (rawmap[0] > COMPRESSION_TYPE_3 || m_decompressor[rawmap[0]]->lossy())
+		return false;
+
+	item.m_compressed.resize(m_hunkbytes);
+	item.m_data.resize(m_hunkbytes);
+
+	// reading the file stays on this thread
+	item.m_chd = this;
+	item.m_codecs = codecs;
+	item.m_compression = rawmap[0];
+	item.m_complen = be_read(&rawmap[1], 3);
+	item.m_crc16 = be_read(&rawmap[10], 2);
+	item.m_err = CHDERR_NONE;
+	try
+	{
+		file_read(be_read(&rawmap[4], 6), &item.m_compressed[0], item.m_complen);
+	}
+	catch (chd_error &)
+	{
+		return false;
+	}
+	item.m_hunknum = hunknum;
+	item.m_osd = osd_work_item_queue(queue, async_decompress_static, &item, 0);
+	return item.m_osd != nullptr;
+}
+
+/**
+ * @fn  void *chd_file::async_decompress_static(void *param, int threadid)
+ *
+ * @brief   -------------------------------------------------
+ *            async_decompress_static - thread entry point for decompressing a hunk
+ *          -------------------------------------------------.
+ *
+ * @param [in,out]  param   If non-null, the parameter.
+ * @param   threadid        The threadid.
+ *
+ * @return  null if it fails, else a void*.
+ */
+
+void *chd_file::async_decompress_static(void *param, int threadid)
+{
+	auto *item = reinterpret_cast<readahead_item *>(param);
+	item->m_chd->async_decompress(*item, threadid);
+	return nullptr;
+}
+
+/**
+ * @fn  void chd_file::async_decompress(readahead_item &item, int threadid)
+ *
+ * @brief   -------------------------------------------------
+ *            async_decompress - decompress a hunk and verify its CRC-16
+ *          -------------------------------------------------.
+ *
+ * @param [in,out]  item    The item.
+ * @param   threadid        The threadid.
+ */
+
+void chd_file::async_decompress(readahead_item &item, int threadid)
+{
+	try
+	{
+		// each thread gets its own codec, since codecs keep state
+		chd_decompressor *&codec = item.m_codecs[threadid][item.m_compression];
+		if (codec == nullptr)
+			codec = chd_codec_list::new_decompressor(m_compression[item.m_compression], *this);
+		codec->decompress(&item.m_compressed[0], item.m_complen, &item.m_data[0], m_hunkbytes);
+		if (util::crc16_creator::simple(&item.m_data[0], m_hunkbytes) != item.m_crc16)
+			item.m_err = CHDERR_DECOMPRESSION_ERROR;
+	}
+	catch (chd_error &err)
+	{
+		item.m_err = err;
+	}
+	catch (...)
+	{
+		item.m_err = CHDERR_DECOMPRESSION_ERROR;
+	}
+}
+
 
 
 //**************************************************************************
@@ -2838,6 +3330,66 @@ void chd_file_compressor::compress_begin()
 	m_write_hunk = 0;
 }
 
+/**
+ * @fn  chd_error chd_file_compressor::train_zstd_dictionary(uint32_t maxbytes)
+ *
+ * @brief   -------------------------------------------------
+ *            train_zstd_dictionary - build a dictionary for the zstd codecs from hunks spread
+ *            over the input and store it as metadata; call before compress_begin
+ *          -------------------------------------------------.
+ *
+ * @param   maxbytes    The maximum dictionary size.
+ *
+ * @return  A chd_error.
+ */
+
+chd_error chd_file_compressor::train_zstd_dictionary(uint32_t maxbytes)
+{
+	// only the zstd codecs use a dictionary
+	bool zstd = false;
+	for (chd_codec_type type : m_compression)
+		if (type == CHD_CODEC_ZSTD || type == CHD_CODEC_CD_ZSTD)
+			zstd = true;
+	if (!zstd || maxbytes == 0 || hunk_count() == 0)
+		return CHDERR_INVALID_PARAMETER;
+
+	// sample about a hundred times the dictionary size, evenly spaced
+	uint32_t samplehunks = std::min<uint64_t>(hunk_count(), std::max<uint64_t>(1, uint64_t(maxbytes) * 100 / hunk_bytes()));
+	std::vector<uint8_t> samples(uint64_t(samplehunks) * hunk_bytes());
+	std::vector<size_t> sizes;
+	size_t used = 0;
+	for (uint32_t samplenum = 0; samplenum < samplehunks; samplenum++)
+	{
+		uint64_t offset = uint64_t(samplenum) * hunk_count() / samplehunks * hunk_bytes();
+		uint32_t length = std::min<uint64_t>(hunk_bytes(), logical_bytes() - offset);
+		uint32_t bytes = read_data(&samples[used], offset, length);
+		if (bytes == 0)
+			continue;
+		sizes.push_back(bytes);
+		used += bytes;
+	}
+	if (sizes.empty())
+		return CHDERR_READ_ERROR;
+
+	// train and store it
+	std::vector<uint8_t> dictionary;
+	if (!chd_codec_list::train_zstd_dictionary(samples, sizes, maxbytes, dictionary))
+		return CHDERR_CODEC_ERROR;
+	// it describes the encoding rather than the data, so it stays out of the overall SHA-1
+	chd_error err = write_metadata(ZSTD_DICTIONARY_METADATA_TAG, 0, dictionary, 0);
+	if (err != CHDERR_NONE)
+		return err;
+
+	// recreate the decompressors so they see it too
+	m_zstd_dictionary = std::move(dictionary);
+	for (int decompnum = 0; decompnum < ARRAY_LENGTH(m_compression); decompnum++)
+	{
+		delete m_decompressor[decompnum];
+		m_decompressor[decompnum] = chd_codec_list::new_decompressor(m_compression[decompnum], *this);
+	}
+	return CHDERR_NONE;
+}
+
 /**
  * @fn  chd_error chd_file_compressor::compress_continue(double &progress, double &ratio)
  *
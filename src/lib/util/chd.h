@@ -22,6 +22,8 @@
 #include "hashing.h"
 #include "chdcodec.h"
 #include <atomic>
+#include <functional>
+#include <vector>
 
 /***************************************************************************
 
@@ -237,6 +239,9 @@ extern const char *AV_METADATA_FORMAT;
 // A/V laserdisc frame metadata
 const chd_metadata_tag AV_LD_METADATA_TAG = CHD_MAKE_TAG('A','V','L','D');
 
+// dictionary shared by the zstd codecs
+const chd_metadata_tag ZSTD_DICTIONARY_METADATA_TAG = CHD_MAKE_TAG('Z','D','I','C');
+
 // error types
 enum chd_error
 {
@@ -299,6 +304,13 @@ class chd_file
 	static const uint32_t MAX_HEADER_SIZE = V5_HEADER_SIZE;
 
 public:
+	// default cache configuration
+	static const uint32_t DEFAULT_CACHE_HUNKS = 8;
+	static const uint32_t DEFAULT_READAHEAD_HUNKS = 2;
+
+	// default number of hunks in flight for read_hunks_parallel
+	static const uint32_t PARALLEL_READ_HUNKS = 64;
+
 	// construction/destruction
 	chd_file();
 	virtual ~chd_file();
@@ -316,6 +328,7 @@ public:
 	uint64_t unit_count() const { return m_unitcount; }
 	bool compressed() const { return (m_compression[0] != CHD_CODEC_NONE); }
 	chd_codec_type compression(int index) const { return m_compression[index]; }
+	const std::vector<uint8_t> &zstd_dictionary() const { return m_zstd_dictionary; }
 	chd_file *parent() const { return m_parent; }
 	util::sha1_t sha1();
 	util::sha1_t raw_sha1();
@@ -346,6 +359,7 @@ public:
 	chd_error write_units(uint64_t unitnum, const void *buffer, uint32_t count = 1);
 	chd_error read_bytes(uint64_t offset, void *buffer, uint32_t bytes);
 	chd_error write_bytes(uint64_t offset, const void *buffer, uint32_t bytes);
+	chd_error read_hunks_parallel(uint32_t hunknum, uint32_t count, const std::function<void (uint32_t hunknum, const uint8_t *data)> &callback, uint32_t inflight = PARALLEL_READ_HUNKS);
 
 	// metadata management
 	chd_error read_metadata(chd_metadata_tag searchtag, uint32_t searchindex, std::string &output);
@@ -364,6 +378,9 @@ public:
 	// codec interfaces
 	chd_error codec_configure(chd_codec_type codec, int param, void *config);
 
+	// cache configuration
+	void configure_cache(uint32_t hunks, uint32_t readahead);
+
 	// static helpers
 	static const char *error_string(chd_error err);
 
@@ -371,6 +388,29 @@ private:
 	struct metadata_entry;
 	struct metadata_hash;
 
+	// a decompressed hunk in the cache
+	struct cache_entry
+	{
+		uint32_t              m_hunknum = ~uint32_t(0); // which hunk is in this entry?
+		uint32_t              m_lastuse = 0;      // value of m_cacheclock at the last access
+		std::vector<uint8_t>  m_data;             // decompressed hunk data
+	};
+
+	// a hunk being decompressed on another thread
+	struct readahead_item
+	{
+		chd_file *            m_chd = nullptr;    // pointer back to the file
+		osd_work_item *       m_osd = nullptr;    // OSD work item decompressing this hunk
+		chd_decompressor *(*m_codecs)[4] = nullptr; // codecs to use, indexed by thread id
+		uint32_t              m_hunknum = ~uint32_t(0); // which hunk is being decompressed?
+		uint8_t               m_compression = 0;  // index of the codec to use
+		uint32_t              m_complen = 0;      // compressed data length
+		util::crc16_t         m_crc16;            // expected CRC-16 of the decompressed data
+		chd_error             m_err = CHDERR_NONE; // result of the decompression
+		std::vector<uint8_t>  m_compressed;       // compressed data read from the file
+		std::vector<uint8_t>  m_data;             // decompressed hunk data
+	};
+
 	// inline helpers
 	uint64_t be_read(const uint8_t *base, int numbytes);
 	void be_write(uint8_t *base, uint64_t value, int numbytes);
@@ -399,6 +439,17 @@ private:
 	void metadata_set_previous_next(uint64_t prevoffset, uint64_t nextoffset);
 	void metadata_update_hash();
 	static int CLIB_DECL metadata_hash_compare(const void *elem1, const void *elem2);
+	cache_entry *cache_find(uint32_t hunknum);
+	chd_error cache_fetch(uint32_t hunknum, cache_entry *&entry);
+	void cache_reset();
+	const uint8_t *mapped_hunk(uint32_t hunknum);
+	readahead_item *readahead_find(uint32_t hunknum);
+	void readahead_start(uint32_t hunknum);
+	bool readahead_finish(readahead_item &item);
+	void readahead_reset();
+	bool async_decompress_queue(readahead_item &item, uint32_t hunknum, osd_work_queue *queue, chd_decompressor *(*codecs)[4]);
+	static void *async_decompress_static(void *param, int threadid);
+	void async_decompress(readahead_item &item, int threadid);
 
 	// file characteristics
 	util::core_file *       m_file;             // handle to the open core file
@@ -433,10 +484,24 @@ private:
 	// compression management
 	chd_decompressor *      m_decompressor[4];  // array of decompression codecs
 	std::vector<uint8_t>          m_compressed;       // temporary buffer for compressed data
+	std::vector<uint8_t>          m_zstd_dictionary;  // dictionary for the zstd codecs, if any
+
+	// memory mapping; only used when the file is opened read-only
+	const uint8_t *           m_mapview;          // read-only view of the whole file, or nullptr
+	uint64_t                  m_mapviewbytes;     // length of the view
+	std::vector<bool>         m_mapverified;      // has each raw hunk's CRC been checked in the view?
 
 	// caching
-	std::vector<uint8_t>          m_cache;            // single-hunk cache for partial reads/writes
-	uint32_t                  m_cachehunk;        // which hunk is in the cache?
+	std::vector<cache_entry>  m_cache;            // LRU cache of hunks for partial reads/writes
+	uint32_t                  m_cachehunks;       // number of hunks in the cache
+	uint32_t                  m_cacheclock;       // incremented on each cache access
+
+	// read-ahead; the queue has a single thread, so all items share m_readahead_decompressor
+	std::vector<readahead_item> m_readahead;      // hunks being decompressed ahead of time
+	uint32_t                  m_readaheadhunks;   // number of hunks to read ahead
+	uint32_t                  m_readahead_next;   // next item to use, items are recycled in order
+	osd_work_queue *          m_readahead_queue;  // work queue for decompressing ahead
+	chd_decompressor *        m_readahead_decompressor[4]; // codecs used by the read-ahead items
 };
 
 
@@ -453,6 +518,7 @@ public:
 	// compression management
 	void compress_begin();
 	chd_error compress_continue(double &progress, double &ratio);
+	chd_error train_zstd_dictionary(uint32_t maxbytes);
 
 protected:
 	// required override: read more data
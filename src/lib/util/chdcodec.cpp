@@ -18,6 +18,10 @@
 #include <zlib.h>
 #include "lzma/C/LzmaEnc.h"
 #include "lzma/C/LzmaDec.h"
+#if CHDCODEC_USE_ZSTD
+#include <zstd.h>
+#include <zdict.h>
+#endif
 #include <new>
 
 
@@ -159,6 +163,50 @@ private:
 };
 
 
+#if CHDCODEC_USE_ZSTD
+
+// ======================> chd_zstd_compressor
+
+// Zstandard compressor
+class chd_zstd_compressor : public chd_compressor
+{
+public:
+	// construction/destruction
+	chd_zstd_compressor(chd_file &chd, uint32_t hunkbytes, bool lossy);
+	~chd_zstd_compressor();
+
+	// core functionality
+	virtual uint32_t compress(const uint8_t *src, uint32_t srclen, uint8_t *dest) override;
+
+private:
+	// internal state
+	ZSTD_CCtx *             m_stream;
+	ZSTD_CDict *            m_dictionary;
+};
+
+
+// ======================> chd_zstd_decompressor
+
+// Zstandard decompressor
+class chd_zstd_decompressor : public chd_decompressor
+{
+public:
+	// construction/destruction
+	chd_zstd_decompressor(chd_file &chd, uint32_t hunkbytes, bool lossy);
+	~chd_zstd_decompressor();
+
+	// core functionality
+	virtual void decompress(const uint8_t *src, uint32_t complen, uint8_t *dest, uint32_t destlen) override;
+
+private:
+	// internal state
+	ZSTD_DCtx *             m_stream;
+	ZSTD_DDict *            m_dictionary;
+};
+
+#endif
+
+
 // ======================> chd_huffman_compressor
 
 // Huffman compressor
@@ -468,11 +516,17 @@ const chd_codec_list::codec_entry chd_codec_list::s_codec_list[] =
 	{ CHD_CODEC_LZMA,       false,  "LZMA",                 &chd_codec_list::construct_compressor<chd_lzma_compressor>,     &chd_codec_list::construct_decompressor<chd_lzma_decompressor> },
 	{ CHD_CODEC_HUFFMAN,    false,  "Huffman",              &chd_codec_list::construct_compressor<chd_huffman_compressor>,  &chd_codec_list::construct_decompressor<chd_huffman_decompressor> },
 	{ CHD_CODEC_FLAC,       false,  "FLAC",                 &chd_codec_list::construct_compressor<chd_flac_compressor>,     &chd_codec_list::construct_decompressor<chd_flac_decompressor> },
+#if CHDCODEC_USE_ZSTD
+	{ CHD_CODEC_ZSTD,       false,  "Zstandard",            &chd_codec_list::construct_compressor<chd_zstd_compressor>,     &chd_codec_list::construct_decompressor<chd_zstd_decompressor> },
+#endif
 
 	// general codecs with CD frontend
 	{ CHD_CODEC_CD_ZLIB,    false,  "CD Deflate",           &chd_codec_list::construct_compressor<chd_cd_compressor<chd_zlib_compressor, chd_zlib_compressor> >,        &chd_codec_list::construct_decompressor<chd_cd_decompressor<chd_zlib_decompressor, chd_zlib_decompressor> > },
 	{ CHD_CODEC_CD_LZMA,    false,  "CD LZMA",              &chd_codec_list::construct_compressor<chd_cd_compressor<chd_lzma_compressor, chd_zlib_compressor> >,        &chd_codec_list::construct_decompressor<chd_cd_decompressor<chd_lzma_decompressor, chd_zlib_decompressor> > },
 	{ CHD_CODEC_CD_FLAC,    false,  "CD FLAC",              &chd_codec_list::construct_compressor<chd_cd_flac_compressor>,  &chd_codec_list::construct_decompressor<chd_cd_flac_decompressor> },
+#if CHDCODEC_USE_ZSTD
+	{ CHD_CODEC_CD_ZSTD,    false,  "CD Zstandard",         &chd_codec_list::construct_compressor<chd_cd_compressor<chd_zstd_compressor, chd_zstd_compressor> >,        &chd_codec_list::construct_decompressor<chd_cd_decompressor<chd_zstd_decompressor, chd_zstd_decompressor> > },
+#endif
 
 	// A/V codecs
 	{ CHD_CODEC_AVHUFF,     false,  "A/V Huffman",          &chd_codec_list::construct_compressor<chd_avhuff_compressor>,   &chd_codec_list::construct_decompressor<chd_avhuff_decompressor> },
@@ -590,6 +644,27 @@ const char *chd_codec_list::codec_name(chd_codec_type type)
 }
 
 
+//-------------------------------------------------
+//  train_zstd_dictionary - build a dictionary of
+//  up to maxbytes for the zstd codecs from the
+//  given samples, packed one after another
+//-------------------------------------------------
+
+bool chd_codec_list::train_zstd_dictionary(const std::vector<uint8_t> &samples, const std::vector<size_t> &sizes, uint32_t maxbytes, std::vector<uint8_t> &dictionary)
+{
+#if CHDCODEC_USE_ZSTD
+	dictionary.resize(maxbytes);
+	size_t result = ZDICT_trainFromBuffer(&dictionary[0], dictionary.size(), &samples[0], &sizes[0], sizes.size());
+	if (ZDICT_isError(result))
+		return false;
+	dictionary.resize(result);
+	return true;
+#else
+	return false;
+#endif
+}
+
+
 //-------------------------------------------------
 //  find_in_list - create a new compressor
 //  instance of the given type
@@ -1193,6 +1268,129 @@ void chd_lzma_decompressor::decompress(const uint8_t *src, uint32_t complen, uin
 
 
 
+#if CHDCODEC_USE_ZSTD
+
+//**************************************************************************
+//  ZSTD COMPRESSOR
+//**************************************************************************
+
+//-------------------------------------------------
+//  chd_zstd_compressor - constructor
+//-------------------------------------------------
+
+chd_zstd_compressor::chd_zstd_compressor(chd_file &chd, uint32_t hunkbytes, bool lossy)
+	: chd_compressor(chd, hunkbytes, lossy),
+		m_stream(ZSTD_createCCtx()),
+		m_dictionary(nullptr)
+{
+	if (m_stream == nullptr)
+		throw std::bad_alloc();
+
+	// the sizes are known from the map, so leave them out of each frame
+	ZSTD_CCtx_setParameter(m_stream, ZSTD_c_compressionLevel, ZSTD_maxCLevel());
+	ZSTD_CCtx_setParameter(m_stream, ZSTD_c_contentSizeFlag, 0);
+	ZSTD_CCtx_setParameter(m_stream, ZSTD_c_dictIDFlag, 0);
+
+	// use the file's dictionary if it has one
+	const std::vector<uint8_t> &dictionary = chd.zstd_dictionary();
+	if (!dictionary.empty())
+	{
+		m_dictionary = ZSTD_createCDict(&dictionary[0], dictionary.size(), ZSTD_maxCLevel());
+		if (m_dictionary == nullptr || ZSTD_isError(ZSTD_CCtx_refCDict(m_stream, m_dictionary)))
+		{
+			ZSTD_freeCDict(m_dictionary);
+			ZSTD_freeCCtx(m_stream);
+			throw CHDERR_CODEC_ERROR;
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  ~chd_zstd_compressor - destructor
+//-------------------------------------------------
+
+chd_zstd_compressor::~chd_zstd_compressor()
+{
+	ZSTD_freeCCtx(m_stream);
+	ZSTD_freeCDict(m_dictionary);
+}
+
+
+//-------------------------------------------------
+//  compress - compress data using the Zstandard
+//  codec
+//-------------------------------------------------
+
+uint32_t chd_zstd_compressor::compress(const uint8_t *src, uint32_t srclen, uint8_t *dest)
+{
+	// if we ended up with more data than we started with, return an error
+	size_t result = ZSTD_compress2(m_stream, dest, srclen, src, srclen);
+	if (ZSTD_isError(result) || result >= srclen)
+		throw CHDERR_COMPRESSION_ERROR;
+	return result;
+}
+
+
+
+//**************************************************************************
+//  ZSTD DECOMPRESSOR
+//**************************************************************************
+
+//-------------------------------------------------
+//  chd_zstd_decompressor - constructor
+//-------------------------------------------------
+
+chd_zstd_decompressor::chd_zstd_decompressor(chd_file &chd, uint32_t hunkbytes, bool lossy)
+	: chd_decompressor(chd, hunkbytes, lossy),
+		m_stream(ZSTD_createDCtx()),
+		m_dictionary(nullptr)
+{
+	if (m_stream == nullptr)
+		throw std::bad_alloc();
+
+	// use the file's dictionary if it has one
+	const std::vector<uint8_t> &dictionary = chd.zstd_dictionary();
+	if (!dictionary.empty())
+	{
+		m_dictionary = ZSTD_createDDict(&dictionary[0], dictionary.size());
+		if (m_dictionary == nullptr || ZSTD_isError(ZSTD_DCtx_refDDict(m_stream, m_dictionary)))
+		{
+			ZSTD_freeDDict(m_dictionary);
+			ZSTD_freeDCtx(m_stream);
+			throw CHDERR_CODEC_ERROR;
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  ~chd_zstd_decompressor - destructor
+//-------------------------------------------------
+
+chd_zstd_decompressor::~chd_zstd_decompressor()
+{
+	ZSTD_freeDCtx(m_stream);
+	ZSTD_freeDDict(m_dictionary);
+}
+
+
+//-------------------------------------------------
+//  decompress - decompress data using the
+//  Zstandard codec
+//-------------------------------------------------
+
+void chd_zstd_decompressor::decompress(const uint8_t *src, uint32_t complen, uint8_t *dest, uint32_t destlen)
+{
+	size_t result = ZSTD_decompressDCtx(m_stream, dest, destlen, src, complen);
+	if (ZSTD_isError(result) || result != destlen)
+		throw CHDERR_DECOMPRESSION_ERROR;
+}
+
+#endif
+
+
+
 //**************************************************************************
 //  HUFFMAN COMPRESSOR
 //**************************************************************************
@@ -19,6 +19,11 @@
 
 #define CHDCODEC_VERIFY_COMPRESSION 0
 
+// the zstd codecs need libzstd, which is not bundled
+#ifndef CHDCODEC_USE_ZSTD
+#define CHDCODEC_USE_ZSTD 0
+#endif
+
 
 //**************************************************************************
 //  MACROS
@@ -112,6 +117,9 @@ public:
 	static bool codec_exists(chd_codec_type type) { return (find_in_list(type) != nullptr); }
 	static const char *codec_name(chd_codec_type type);
 
+	// dictionaries
+	static bool train_zstd_dictionary(const std::vector<uint8_t> &samples, const std::vector<size_t> &sizes, uint32_t maxbytes, std::vector<uint8_t> &dictionary);
+
 private:
 	// an entry in the list
 	struct codec_entry
@@ -175,11 +183,13 @@ const chd_codec_type CHD_CODEC_ZLIB         = CHD_MAKE_TAG('z','l','i','b');
 const chd_codec_type CHD_CODEC_LZMA         = CHD_MAKE_TAG('l','z','m','a');
 const chd_codec_type CHD_CODEC_HUFFMAN      = CHD_MAKE_TAG('h','u','f','f');
 const chd_codec_type CHD_CODEC_FLAC         = CHD_MAKE_TAG('f','l','a','c');
+const chd_codec_type CHD_CODEC_ZSTD         = CHD_MAKE_TAG('z','s','t','d');
 
 // general codecs with CD frontend
 const chd_codec_type CHD_CODEC_CD_ZLIB      = CHD_MAKE_TAG('c','d','z','l');
 const chd_codec_type CHD_CODEC_CD_LZMA      = CHD_MAKE_TAG('c','d','l','z');
 const chd_codec_type CHD_CODEC_CD_FLAC      = CHD_MAKE_TAG('c','d','f','l');
+const chd_codec_type CHD_CODEC_CD_ZSTD      = CHD_MAKE_TAG('c','d','z','s');
 
 // A/V codecs
 const chd_codec_type CHD_CODEC_AVHUFF       = CHD_MAKE_TAG('a','v','h','u');
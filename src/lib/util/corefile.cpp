@@ -156,6 +156,7 @@ public:
 	virtual int ungetc(int c) override { return m_file.ungetc(c); }
 	virtual char *gets(char *s, int n) override { return m_file.gets(s, n); }
 	virtual const void *buffer() override { return m_file.buffer(); }
+	virtual osd_file::error map_view(const void *&data, std::uint64_t &length) override { return m_file.map_view(data, length); }
 
 	virtual std::uint32_t write(const void *buffer, std::uint32_t length) override { return m_file.write(buffer, length); }
 	virtual int puts(const char *s) override { return m_file.puts(s); }
@@ -242,6 +243,7 @@ public:
 
 	virtual std::uint32_t read(void *buffer, std::uint32_t length) override;
 	virtual void const *buffer() override { return m_data; }
+	virtual osd_file::error map_view(void const *&data, std::uint64_t &length) override;
 
 	virtual std::uint32_t write(void const *buffer, std::uint32_t length) override { return 0; }
 	virtual osd_file::error truncate(std::uint64_t offset) override;
@@ -293,6 +295,31 @@ private:
 };
 
 
+class core_growable_file : public core_text_file
+{
+public:
+	core_growable_file(std::uint32_t openflags) : core_text_file(openflags), m_offset(0) { }
+	virtual osd_file::error compress(int level) override { return osd_file::error::INVALID_ACCESS; }
+
+	virtual int seek(std::int64_t offset, int whence) override;
+	virtual std::uint64_t tell() const override { return m_offset; }
+	virtual bool eof() const override { return !has_putback() && (m_offset >= m_data.size()); }
+	virtual std::uint64_t size() const override { return m_data.size(); }
+
+	virtual std::uint32_t read(void *buffer, std::uint32_t length) override;
+	virtual void const *buffer() override { return m_data.empty() ? nullptr : &m_data[0]; }
+	virtual osd_file::error map_view(void const *&data, std::uint64_t &length) override { data = buffer(); length = m_data.size(); return osd_file::error::NONE; }
+
+	virtual std::uint32_t write(void const *buffer, std::uint32_t length) override;
+	virtual osd_file::error truncate(std::uint64_t offset) override;
+	virtual osd_file::error flush() override { clear_putback(); return osd_file::error::NONE; }
+
+private:
+	std::vector<std::uint8_t>   m_data;         // file data
+	std::uint64_t               m_offset;       // current file offset
+};
+
+
 class core_osd_file : public core_in_memory_file
 {
 public:
@@ -312,6 +339,7 @@ public:
 
 	virtual std::uint32_t read(void *buffer, std::uint32_t length) override;
 	virtual void const *buffer() override;
+	virtual osd_file::error map_view(void const *&data, std::uint64_t &length) override;
 
 	virtual std::uint32_t write(void const *buffer, std::uint32_t length) override;
 	virtual osd_file::error truncate(std::uint64_t offset) override;
@@ -669,6 +697,22 @@ std::uint32_t core_in_memory_file::read(void *buffer, std::uint32_t length)
 }
 
 
+/*-------------------------------------------------
+    map_view - get a read-only view of the file
+    data
+-------------------------------------------------*/
+
+osd_file::error core_in_memory_file::map_view(void const *&data, std::uint64_t &length)
+{
+	if (!m_data)
+		return osd_file::error::FAILURE;
+
+	data = m_data;
+	length = m_length;
+	return osd_file::error::NONE;
+}
+
+
 /*-------------------------------------------------
     truncate - truncate a file
 -------------------------------------------------*/
@@ -708,6 +752,93 @@ std::size_t core_in_memory_file::safe_buffer_copy(
 
 
 
+/***************************************************************************
+    core_growable_file
+***************************************************************************/
+
+/*-------------------------------------------------
+    seek - seek within a file
+-------------------------------------------------*/
+
+int core_growable_file::seek(std::int64_t offset, int whence)
+{
+	clear_putback();
+	switch (whence)
+	{
+	case SEEK_SET:
+		m_offset = offset;
+		break;
+
+	case SEEK_CUR:
+		m_offset += offset;
+		break;
+
+	case SEEK_END:
+		m_offset = m_data.size() + offset;
+		break;
+	}
+	return 0;
+}
+
+
+/*-------------------------------------------------
+    read - read from a file
+-------------------------------------------------*/
+
+std::uint32_t core_growable_file::read(void *buffer, std::uint32_t length)
+{
+	clear_putback();
+	if (m_offset >= m_data.size())
+		return 0;
+
+	std::uint32_t const bytes_read = std::uint32_t((std::min<std::uint64_t>)(length, m_data.size() - m_offset));
+	std::memcpy(buffer, &m_data[m_offset], bytes_read);
+	m_offset += bytes_read;
+	return bytes_read;
+}
+
+
+/*-------------------------------------------------
+    write - write to a file, growing it as needed
+-------------------------------------------------*/
+
+std::uint32_t core_growable_file::write(void const *buffer, std::uint32_t length)
+{
+	clear_putback();
+	if (!length)
+		return 0;
+
+	try
+	{
+		if ((m_offset + length) > m_data.size())
+			m_data.resize(m_offset + length, 0);
+	}
+	catch (...)
+	{
+		return 0;
+	}
+	std::memcpy(&m_data[m_offset], buffer, length);
+	m_offset += length;
+	return length;
+}
+
+
+/*-------------------------------------------------
+    truncate - truncate a file
+-------------------------------------------------*/
+
+osd_file::error core_growable_file::truncate(std::uint64_t offset)
+{
+	if (m_data.size() < offset)
+		return osd_file::error::FAILURE;
+
+	m_data.resize(offset);
+	m_offset = (std::min<std::uint64_t>)(m_offset, offset);
+	return osd_file::error::NONE;
+}
+
+
+
 /***************************************************************************
     core_osd_file
 ***************************************************************************/
@@ -883,6 +1014,25 @@ void const *core_osd_file::buffer()
 }
 
 
+/*-------------------------------------------------
+    map_view - get a read-only view of the file
+    data, mapping the file unless it is in RAM
+-------------------------------------------------*/
+
+osd_file::error core_osd_file::map_view(void const *&data, std::uint64_t &length)
+{
+	// RAM-based data is already a view
+	if (is_loaded())
+		return core_in_memory_file::map_view(data, length);
+
+	// the file holds compressed data when streaming compression is on
+	if (m_zdata)
+		return osd_file::error::INVALID_ACCESS;
+
+	return m_file->map_view(data, length);
+}
+
+
 /*-------------------------------------------------
     write - write to a file
 -------------------------------------------------*/
@@ -1142,6 +1292,25 @@ osd_file::error core_file::open_ram_copy(void const *data, std::size_t length, s
 }
 
 
+/*-------------------------------------------------
+    open_ram_write - open an empty RAM-based
+    "file" that grows as it is written
+-------------------------------------------------*/
+
+osd_file::error core_file::open_ram_write(std::uint32_t openflags, ptr &file)
+{
+	try
+	{
+		file = std::make_unique<core_growable_file>(openflags);
+		return osd_file::error::NONE;
+	}
+	catch (...)
+	{
+		return osd_file::error::OUT_OF_MEMORY;
+	}
+}
+
+
 /*-------------------------------------------------
     open_proxy - open a proxy to an existing file
     object and return an error code
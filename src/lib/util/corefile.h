@@ -57,6 +57,9 @@ public:
 	// open a RAM-based "file" using the given data and length (read-only), copying the data
 	static osd_file::error open_ram_copy(const void *data, std::size_t length, std::uint32_t openflags, ptr &file);
 
+	// open an empty RAM-based "file" that grows as it is written; buffer() and size() give the result
+	static osd_file::error open_ram_write(std::uint32_t openflags, ptr &file);
+
 	// open a proxy "file" that forwards requests to another file object
 	static osd_file::error open_proxy(core_file &file, ptr &proxy);
 
@@ -100,6 +103,9 @@ public:
 	// this function may cause the full file data to be read
 	virtual const void *buffer() = 0;
 
+	// get a read-only view of the full file data without reading it, mapping the file if possible
+	virtual osd_file::error map_view(const void *&data, std::uint64_t &length) = 0;
+
 	// open a file with the specified filename, read it into memory, and return a pointer
 	static osd_file::error load(std::string const &filename, void **data, std::uint32_t &length);
 	static osd_file::error load(std::string const &filename, std::vector<uint8_t> &data);
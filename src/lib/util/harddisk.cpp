@@ -11,7 +11,9 @@
 #include <cassert>
 #include "harddisk.h"
 #include "osdcore.h"
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
 
 /***************************************************************************
     TYPE DEFINITIONS
@@ -222,3 +224,89 @@ uint32_t hard_disk_write(hard_disk_file *file, uint32_t lbasector, const void *b
 		return (actual == file->info.sectorbytes);
 	}
 }
+
+
+
+/***************************************************************************
+    SECTOR PREFETCH
+***************************************************************************/
+
+constexpr uint32_t hard_disk_prefetch::MAX_SECTORS;
+
+/*-------------------------------------------------
+    start - begin reading a run of sectors on a
+    worker thread
+-------------------------------------------------*/
+
+void hard_disk_prefetch::start(hard_disk_file *file, uint32_t lba, uint32_t count)
+{
+	cancel();
+	if (file == nullptr || count == 0)
+		return;
+
+	m_file = file;
+	m_lba = lba;
+	m_count = std::min(count, MAX_SECTORS);
+	m_ready.store(0, std::memory_order_relaxed);
+	m_data.resize(size_t(m_count) * file->info.sectorbytes);
+	m_worker = std::async(std::launch::async, [this] ()
+	{
+		uint32_t const bytes = m_file->info.sectorbytes;
+		for (uint32_t i = 0; i < m_count && !m_stop.load(std::memory_order_relaxed); i++)
+		{
+			if (!hard_disk_read(m_file, m_lba + i, &m_data[size_t(i) * bytes]))
+			{
+				m_ready.store(~uint32_t(0), std::memory_order_release);
+				return;
+			}
+			m_ready.store(i + 1, std::memory_order_release);
+		}
+	});
+}
+
+
+/*-------------------------------------------------
+    read - read a sector, taking it from the run
+    when it's there
+-------------------------------------------------*/
+
+uint32_t hard_disk_prefetch::read(hard_disk_file *file, uint32_t lbasector, void *buffer)
+{
+	if (m_worker.valid() && file == m_file && lbasector >= m_lba && lbasector - m_lba < m_count)
+	{
+		uint32_t const index = lbasector - m_lba;
+		uint32_t ready = m_ready.load(std::memory_order_acquire);
+		if (ready != ~uint32_t(0) && index >= ready)
+		{
+			m_worker.wait();
+			ready = m_ready.load(std::memory_order_acquire);
+		}
+		if (ready != ~uint32_t(0) && index < ready)
+		{
+			uint32_t const bytes = file->info.sectorbytes;
+			memcpy(buffer, &m_data[size_t(index) * bytes], bytes);
+			return 1;
+		}
+	}
+
+	// not covered, or the worker hit an error: go to the disk ourselves
+	cancel();
+	return hard_disk_read(file, lbasector, buffer);
+}
+
+
+/*-------------------------------------------------
+    cancel - stop the worker and forget the run
+-------------------------------------------------*/
+
+void hard_disk_prefetch::cancel()
+{
+	if (m_worker.valid())
+	{
+		m_stop.store(true, std::memory_order_relaxed);
+		m_worker.get();
+		m_stop.store(false, std::memory_order_relaxed);
+	}
+	m_file = nullptr;
+	m_count = 0;
+}
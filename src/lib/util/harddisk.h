@@ -16,6 +16,10 @@
 #include "osdcore.h"
 #include "chd.h"
 
+#include <atomic>
+#include <future>
+#include <vector>
+
 
 /***************************************************************************
     TYPE DEFINITIONS
@@ -49,4 +53,41 @@ hard_disk_info *hard_disk_get_info(hard_disk_file *file);
 uint32_t hard_disk_read(hard_disk_file *file, uint32_t lbasector, void *buffer);
 uint32_t hard_disk_write(hard_disk_file *file, uint32_t lbasector, const void *buffer);
 
+
+
+/***************************************************************************
+    SECTOR PREFETCH
+***************************************************************************/
+
+// reads the sectors of a command on a worker thread while the emulated
+// drive is still seeking, so the emulation thread doesn't wait on the
+// host for them; everything else touching the disk must cancel() first
+class hard_disk_prefetch
+{
+public:
+	// most sectors read ahead for one command
+	static constexpr uint32_t MAX_SECTORS = 256;
+
+	hard_disk_prefetch() : m_file(nullptr), m_lba(0), m_count(0), m_ready(0), m_stop(false) { }
+	~hard_disk_prefetch() { cancel(); }
+
+	// start reading [lba, lba + count) in the background, dropping any earlier run
+	void start(hard_disk_file *file, uint32_t lba, uint32_t count);
+
+	// read a sector, from the run when it covers it and directly otherwise
+	uint32_t read(hard_disk_file *file, uint32_t lbasector, void *buffer);
+
+	// stop the worker and drop the run
+	void cancel();
+
+private:
+	hard_disk_file *        m_file;         // disk the run was read from
+	uint32_t                m_lba;          // first sector of the run
+	uint32_t                m_count;        // sectors in the run
+	std::atomic<uint32_t>   m_ready;        // sectors read so far, or ~0 after an error
+	std::atomic<bool>       m_stop;         // asks the worker to give up early
+	std::vector<uint8_t>    m_data;         // the run's data
+	std::future<void>       m_worker;       // worker reading the run
+};
+
 #endif // MAME_UTIL_HARDDISK_H
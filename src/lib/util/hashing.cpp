@@ -12,9 +12,42 @@
 
 #include <zlib.h>
 
+#include <algorithm>
 #include <iomanip>
+#include <iterator>
 #include <sstream>
 
+// CPU specific kernels; the x86 ones are built for their own target and
+// only called when CPUID reports the extensions, while the ARM ones need
+// the extensions enabled for the whole build
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define HASHING_USE_X86 1
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define HASHING_TARGET(x)
+#else
+#include <cpuid.h>
+#define HASHING_TARGET(x) __attribute__((target(x)))
+#endif
+#include <immintrin.h>
+#else
+#define HASHING_USE_X86 0
+#endif
+
+#if (defined(__aarch64__) || defined(__arm__)) && (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_SHA2))
+#define HASHING_USE_ARM_SHA1 1
+#include <arm_neon.h>
+#else
+#define HASHING_USE_ARM_SHA1 0
+#endif
+
+#if (defined(__aarch64__) || defined(__arm__)) && defined(__ARM_FEATURE_CRC32)
+#define HASHING_USE_ARM_CRC32 1
+#include <arm_acle.h>
+#else
+#define HASHING_USE_ARM_CRC32 0
+#endif
+
 
 namespace util {
 
@@ -103,6 +136,376 @@ inline void sha1_process(std::array<uint32_t, 5> &st, uint32_t *data)
 		st[i] += d[i];
 }
 
+
+//-------------------------------------------------
+//  sha1_blocks_generic - digest whole 64-byte
+//  blocks in portable code
+//-------------------------------------------------
+
+void sha1_blocks_generic(std::array<uint32_t, 5> &st, const uint8_t *data, std::size_t blocks)
+{
+#ifdef LSB_FIRST
+	constexpr unsigned swizzle = 3U;
+#else
+	constexpr unsigned swizzle = 0U;
+#endif
+	uint32_t buf[16];
+	for ( ; blocks; blocks--, data += 64)
+	{
+		for (unsigned i = 0U; i < 64U; i++)
+			reinterpret_cast<uint8_t *>(buf)[i ^ swizzle] = data[i];
+		sha1_process(st, buf);
+	}
+}
+
+
+//-------------------------------------------------
+//  crc32_generic - append data to a CRC-32 using
+//  zlib
+//-------------------------------------------------
+
+uint32_t crc32_generic(uint32_t crc, const uint8_t *data, std::size_t length)
+{
+	return crc32(crc, reinterpret_cast<const Bytef *>(data), length);
+}
+
+
+#if HASHING_USE_X86
+
+//-------------------------------------------------
+//  sha1_ni_group - four rounds using the SHA
+//  extensions; the message schedule is kept in
+//  four registers and rotated through
+//-------------------------------------------------
+
+template <int G>
+HASHING_TARGET("sha,sse4.1,ssse3") inline void sha1_ni_group(__m128i &abcd, __m128i (&e)[2], __m128i (&msg)[4])
+{
+	// E alternates between two registers, so only rounds 0-3 add it directly
+	if (G == 0)
+		e[0] = _mm_add_epi32(e[0], msg[0]);
+	else
+		e[G & 1] = _mm_sha1nexte_epu32(e[G & 1], msg[G & 3]);
+	e[(G + 1) & 1] = abcd;
+	if ((G >= 3) && (G <= 18))
+		msg[(G + 1) & 3] = _mm_sha1msg2_epu32(msg[(G + 1) & 3], msg[G & 3]);
+	abcd = _mm_sha1rnds4_epu32(abcd, e[G & 1], G / 5);
+	if ((G >= 1) && (G <= 16))
+		msg[(G + 3) & 3] = _mm_sha1msg1_epu32(msg[(G + 3) & 3], msg[G & 3]);
+	if ((G >= 2) && (G <= 17))
+		msg[(G + 2) & 3] = _mm_xor_si128(msg[(G + 2) & 3], msg[G & 3]);
+}
+
+
+//-------------------------------------------------
+//  sha1_blocks_ni - digest whole 64-byte blocks
+//  using the SHA extensions
+//-------------------------------------------------
+
+HASHING_TARGET("sha,sse4.1,ssse3") void sha1_blocks_ni(std::array<uint32_t, 5> &st, const uint8_t *data, std::size_t blocks)
+{
+	// the state is kept E first, so D, C, B, A load straight into lanes 0-3
+	__m128i const mask = _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+	__m128i abcd = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&st[1]));
+	__m128i e[2] = { _mm_set_epi32(st[0], 0, 0, 0), _mm_setzero_si128() };
+	for ( ; blocks; blocks--, data += 64)
+	{
+		__m128i const abcd_save = abcd;
+		__m128i const e_save = e[0];
+		__m128i msg[4];
+		for (unsigned i = 0U; i < 4U; i++)
+			msg[i] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + (i * 16U))), mask);
+
+		sha1_ni_group<0>(abcd, e, msg);
+		sha1_ni_group<1>(abcd, e, msg);
+		sha1_ni_group<2>(abcd, e, msg);
+		sha1_ni_group<3>(abcd, e, msg);
+		sha1_ni_group<4>(abcd, e, msg);
+		sha1_ni_group<5>(abcd, e, msg);
+		sha1_ni_group<6>(abcd, e, msg);
+		sha1_ni_group<7>(abcd, e, msg);
+		sha1_ni_group<8>(abcd, e, msg);
+		sha1_ni_group<9>(abcd, e, msg);
+		sha1_ni_group<10>(abcd, e, msg);
+		sha1_ni_group<11>(abcd, e, msg);
+		sha1_ni_group<12>(abcd, e, msg);
+		sha1_ni_group<13>(abcd, e, msg);
+		sha1_ni_group<14>(abcd, e, msg);
+		sha1_ni_group<15>(abcd, e, msg);
+		sha1_ni_group<16>(abcd, e, msg);
+		sha1_ni_group<17>(abcd, e, msg);
+		sha1_ni_group<18>(abcd, e, msg);
+		sha1_ni_group<19>(abcd, e, msg);
+
+		e[0] = _mm_sha1nexte_epu32(e[0], e_save);
+		abcd = _mm_add_epi32(abcd, abcd_save);
+	}
+	_mm_storeu_si128(reinterpret_cast<__m128i *>(&st[1]), abcd);
+	st[0] = uint32_t(_mm_extract_epi32(e[0], 3));
+}
+
+
+//-------------------------------------------------
+//  crc32_clmul_fold - fold one 128-bit block
+//  into the next
+//-------------------------------------------------
+
+HASHING_TARGET("pclmul,sse4.1") inline __m128i crc32_clmul_fold(__m128i x, __m128i y, __m128i k)
+{
+	__m128i const lo = _mm_clmulepi64_si128(x, k, 0x00);
+	return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x11), y), lo);
+}
+
+
+//-------------------------------------------------
+//  crc32_clmul - append data to a CRC-32 folding
+//  64 bytes at a time with carry-less multiplies
+//  (Intel, "Fast CRC Computation for Generic
+//  Polynomials Using PCLMULQDQ Instruction")
+//-------------------------------------------------
+
+HASHING_TARGET("pclmul,sse4.1") uint32_t crc32_clmul(uint32_t crc, const uint8_t *data, std::size_t length)
+{
+	if (length < 64U)
+		return crc32_generic(crc, data, length);
+
+	// fold by four, fold by one, 64-bit reduction, and Barrett constants
+	__m128i const k1k2 = _mm_set_epi64x(0x01c6e41596ULL, 0x0154442bd4ULL);
+	__m128i const k3k4 = _mm_set_epi64x(0x00ccaa009eULL, 0x01751997d0ULL);
+	__m128i const k5 = _mm_set_epi64x(0, 0x0163cd6124ULL);
+	__m128i const poly = _mm_set_epi64x(0x01f7011641ULL, 0x01db710641ULL);
+	__m128i const mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+
+	__m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 0x00));
+	__m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 0x10));
+	__m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 0x20));
+	__m128i x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 0x30));
+	x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(int(~crc)));
+	std::size_t done = 64U;
+
+	// fold four blocks at a time
+	for ( ; (length - done) >= 64U; done += 64U)
+	{
+		__m128i const x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+		__m128i const x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+		__m128i const x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+		__m128i const x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+		x1 = _mm_xor_si128(_mm_clmulepi64_si128(x1, k1k2, 0x11), x5);
+		x2 = _mm_xor_si128(_mm_clmulepi64_si128(x2, k1k2, 0x11), x6);
+		x3 = _mm_xor_si128(_mm_clmulepi64_si128(x3, k1k2, 0x11), x7);
+		x4 = _mm_xor_si128(_mm_clmulepi64_si128(x4, k1k2, 0x11), x8);
+		x1 = _mm_xor_si128(x1, _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + done + 0x00)));
+		x2 = _mm_xor_si128(x2, _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + done + 0x10)));
+		x3 = _mm_xor_si128(x3, _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + done + 0x20)));
+		x4 = _mm_xor_si128(x4, _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + done + 0x30)));
+	}
+
+	// fold down to one block, then fold in any remaining whole blocks
+	x1 = crc32_clmul_fold(x1, x2, k3k4);
+	x1 = crc32_clmul_fold(x1, x3, k3k4);
+	x1 = crc32_clmul_fold(x1, x4, k3k4);
+	for ( ; (length - done) >= 16U; done += 16U)
+		x1 = crc32_clmul_fold(x1, _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + done)), k3k4);
+
+	// reduce to 64 bits
+	x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+	x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+	x2 = _mm_srli_si128(x1, 4);
+	x1 = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k5, 0x00), x2);
+
+	// Barrett reduction to 32 bits
+	x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), poly, 0x10);
+	x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask32), poly, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+	crc = ~uint32_t(_mm_extract_epi32(x1, 1));
+
+	return crc32_generic(crc, data + done, length - done);
+}
+
+
+//-------------------------------------------------
+//  x86_features - check for the SHA extensions
+//  and carry-less multiply
+//-------------------------------------------------
+
+void x86_features(bool &sha, bool &clmul)
+{
+	unsigned regs1[4] = { 0, 0, 0, 0 };
+	unsigned regs7[4] = { 0, 0, 0, 0 };
+#if defined(_MSC_VER) && !defined(__clang__)
+	int info[4];
+	__cpuid(info, 0);
+	unsigned const maxleaf = info[0];
+	__cpuid(info, 1);
+	std::copy(std::begin(info), std::end(info), std::begin(regs1));
+	if (maxleaf >= 7)
+	{
+		__cpuidex(info, 7, 0);
+		std::copy(std::begin(info), std::end(info), std::begin(regs7));
+	}
+#else
+	unsigned const maxleaf = __get_cpuid_max(0, nullptr);
+	if (maxleaf >= 1)
+		__cpuid(1, regs1[0], regs1[1], regs1[2], regs1[3]);
+	if (maxleaf >= 7)
+		__cpuid_count(7, 0, regs7[0], regs7[1], regs7[2], regs7[3]);
+#endif
+	bool const ssse3 = (regs1[2] >> 9) & 1U;
+	bool const sse41 = (regs1[2] >> 19) & 1U;
+	sha = ssse3 && sse41 && ((regs7[1] >> 29) & 1U);
+	clmul = sse41 && ((regs1[2] >> 1) & 1U);
+}
+
+#endif // HASHING_USE_X86
+
+
+#if HASHING_USE_ARM_SHA1
+
+//-------------------------------------------------
+//  sha1_arm_group - four rounds using the ARMv8
+//  cryptography extensions; tmp holds the next
+//  two groups of message words plus constants
+//-------------------------------------------------
+
+template <int G>
+inline void sha1_arm_group(uint32x4_t &abcd, uint32_t (&e)[2], uint32x4_t (&tmp)[2], uint32x4_t (&msg)[4])
+{
+	static constexpr uint32_t k[4] = { 0x5a827999U, 0x6ed9eba1U, 0x8f1bbcdcU, 0xca62c1d6U };
+
+	e[(G + 1) & 1] = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+	if (G < 5)
+		abcd = vsha1cq_u32(abcd, e[G & 1], tmp[G & 1]);
+	else if ((G >= 10) && (G < 15))
+		abcd = vsha1mq_u32(abcd, e[G & 1], tmp[G & 1]);
+	else
+		abcd = vsha1pq_u32(abcd, e[G & 1], tmp[G & 1]);
+	if (G <= 17)
+		tmp[G & 1] = vaddq_u32(msg[(G + 2) & 3], vdupq_n_u32(k[(G + 2) / 5]));
+	if ((G >= 1) && (G <= 16))
+		msg[(G + 3) & 3] = vsha1su1q_u32(msg[(G + 3) & 3], msg[(G + 2) & 3]);
+	if (G <= 15)
+		msg[G & 3] = vsha1su0q_u32(msg[G & 3], msg[(G + 1) & 3], msg[(G + 2) & 3]);
+}
+
+
+//-------------------------------------------------
+//  sha1_blocks_arm - digest whole 64-byte blocks
+//  using the ARMv8 cryptography extensions
+//-------------------------------------------------
+
+void sha1_blocks_arm(std::array<uint32_t, 5> &st, const uint8_t *data, std::size_t blocks)
+{
+	// the state is kept E first, so A, B, C, D have to be gathered in reverse
+	uint32_t const init[4] = { st[4], st[3], st[2], st[1] };
+	uint32x4_t abcd = vld1q_u32(init);
+	uint32_t e[2] = { st[0], 0 };
+	for ( ; blocks; blocks--, data += 64)
+	{
+		uint32x4_t const abcd_save = abcd;
+		uint32_t const e_save = e[0];
+		uint32x4_t msg[4];
+		for (unsigned i = 0U; i < 4U; i++)
+			msg[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + (i * 16U))));
+		uint32x4_t tmp[2] = { vaddq_u32(msg[0], vdupq_n_u32(0x5a827999U)), vaddq_u32(msg[1], vdupq_n_u32(0x5a827999U)) };
+
+		sha1_arm_group<0>(abcd, e, tmp, msg);
+		sha1_arm_group<1>(abcd, e, tmp, msg);
+		sha1_arm_group<2>(abcd, e, tmp, msg);
+		sha1_arm_group<3>(abcd, e, tmp, msg);
+		sha1_arm_group<4>(abcd, e, tmp, msg);
+		sha1_arm_group<5>(abcd, e, tmp, msg);
+		sha1_arm_group<6>(abcd, e, tmp, msg);
+		sha1_arm_group<7>(abcd, e, tmp, msg);
+		sha1_arm_group<8>(abcd, e, tmp, msg);
+		sha1_arm_group<9>(abcd, e, tmp, msg);
+		sha1_arm_group<10>(abcd, e, tmp, msg);
+		sha1_arm_group<11>(abcd, e, tmp, msg);
+		sha1_arm_group<12>(abcd, e, tmp, msg);
+		sha1_arm_group<13>(abcd, e, tmp, msg);
+		sha1_arm_group<14>(abcd, e, tmp, msg);
+		sha1_arm_group<15>(abcd, e, tmp, msg);
+		sha1_arm_group<16>(abcd, e, tmp, msg);
+		sha1_arm_group<17>(abcd, e, tmp, msg);
+		sha1_arm_group<18>(abcd, e, tmp, msg);
+		sha1_arm_group<19>(abcd, e, tmp, msg);
+
+		// twenty groups leave the final E in e[0]
+		e[0] += e_save;
+		abcd = vaddq_u32(abcd, abcd_save);
+	}
+	st[0] = e[0];
+	st[1] = vgetq_lane_u32(abcd, 3);
+	st[2] = vgetq_lane_u32(abcd, 2);
+	st[3] = vgetq_lane_u32(abcd, 1);
+	st[4] = vgetq_lane_u32(abcd, 0);
+}
+
+#endif // HASHING_USE_ARM_SHA1
+
+
+#if HASHING_USE_ARM_CRC32
+
+//-------------------------------------------------
+//  crc32_arm - append data to a CRC-32 using the
+//  ARMv8 CRC instructions
+//-------------------------------------------------
+
+uint32_t crc32_arm(uint32_t crc, const uint8_t *data, std::size_t length)
+{
+	crc = ~crc;
+	for ( ; length && (uintptr_t(data) & 7U); length--)
+		crc = __crc32b(crc, *data++);
+	for ( ; length >= 8U; length -= 8U, data += 8U)
+	{
+		uint64_t value;
+		memcpy(&value, data, sizeof(value));
+		crc = __crc32d(crc, value);
+	}
+	for ( ; length; length--)
+		crc = __crc32b(crc, *data++);
+	return ~crc;
+}
+
+#endif // HASHING_USE_ARM_CRC32
+
+
+//-------------------------------------------------
+//  hash_kernels - the block functions to use on
+//  this CPU, chosen on first use
+//-------------------------------------------------
+
+struct hash_kernels
+{
+	hash_kernels()
+		: sha1_blocks(&sha1_blocks_generic)
+		, crc32(&crc32_generic)
+	{
+#if HASHING_USE_X86
+		bool sha, clmul;
+		x86_features(sha, clmul);
+		if (sha)
+			sha1_blocks = &sha1_blocks_ni;
+		if (clmul)
+			crc32 = &crc32_clmul;
+#endif
+#if HASHING_USE_ARM_SHA1
+		sha1_blocks = &sha1_blocks_arm;
+#endif
+#if HASHING_USE_ARM_CRC32
+		crc32 = &crc32_arm;
+#endif
+	}
+
+	void (*sha1_blocks)(std::array<uint32_t, 5> &st, const uint8_t *data, std::size_t blocks);
+	uint32_t (*crc32)(uint32_t crc, const uint8_t *data, std::size_t length);
+};
+
+hash_kernels const &kernels()
+{
+	static hash_kernels const result;
+	return result;
+}
+
 } // anonymous namespace
 
 
@@ -200,12 +603,9 @@ void sha1_creator::append(const void *data, uint32_t length)
 				reinterpret_cast<uint8_t *>(m_buf)[(offset + residual) ^ swizzle] = reinterpret_cast<const uint8_t *>(data)[offset];
 			sha1_process(m_st, m_buf);
 		}
-		while ((length - offset) >= 64U)
-		{
-			for (residual = 0U; residual < 64U; residual++, offset++)
-				reinterpret_cast<uint8_t *>(m_buf)[residual ^ swizzle] = reinterpret_cast<const uint8_t *>(data)[offset];
-			sha1_process(m_st, m_buf);
-		}
+		uint32_t const blocks = (length - offset) >> 6;
+		kernels().sha1_blocks(m_st, reinterpret_cast<const uint8_t *>(data) + offset, blocks);
+		offset += blocks << 6;
 		residual = 0U;
 	}
 	for ( ; offset < length; residual++, offset++)
@@ -330,7 +730,7 @@ std::string crc32_t::as_string() const
 
 void crc32_creator::append(const void *data, uint32_t length)
 {
-	m_accum.m_raw = crc32(m_accum, reinterpret_cast<const Bytef *>(data), length);
+	m_accum.m_raw = kernels().crc32(m_accum, reinterpret_cast<const uint8_t *>(data), length);
 }
 
 
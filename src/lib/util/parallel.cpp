@@ -0,0 +1,104 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    parallel.cpp
+
+    Typed helpers for running work on an OSD work queue.
+
+***************************************************************************/
+
+#include "parallel.h"
+
+#include <cassert>
+
+
+namespace util {
+
+//**************************************************************************
+//  TASK GRAPH
+//**************************************************************************
+
+//-------------------------------------------------
+//  add - add a task that starts once every task
+//  in depends has finished
+//-------------------------------------------------
+
+task_graph::task_id task_graph::add(std::function<void ()> &&func, std::initializer_list<task_id> depends)
+{
+	task_id const id = m_tasks.size();
+	auto t = std::make_unique<task>();
+	t->graph = this;
+	t->func = std::move(func);
+	for (task_id dep : depends)
+	{
+		assert(dep < id);
+		m_tasks[dep]->successors.push_back(id);
+		t->prerequisites++;
+	}
+	m_tasks.push_back(std::move(t));
+	return id;
+}
+
+
+//-------------------------------------------------
+//  run - run every task, blocking until all have
+//  finished
+//-------------------------------------------------
+
+void task_graph::run(osd_work_queue *queue)
+{
+	// dependencies always precede their dependents, so the order added is a valid order
+	if (queue == nullptr)
+	{
+		for (auto &t : m_tasks)
+			t->func();
+		return;
+	}
+
+	// reset the counts before anything starts, since tasks release each other
+	m_queue = queue;
+	for (auto &t : m_tasks)
+		t->remaining = t->prerequisites;
+
+	// start the roots; each finished task starts any dependents it releases, so the
+	// queue never drains until the whole graph is done
+	for (auto &t : m_tasks)
+		if (t->prerequisites == 0)
+			start(*t);
+	while (!osd_work_queue_wait(queue, osd_ticks_per_second()))
+	{
+	}
+	m_queue = nullptr;
+}
+
+
+//-------------------------------------------------
+//  start - queue a task whose prerequisites have
+//  all finished
+//-------------------------------------------------
+
+void task_graph::start(task &t)
+{
+	osd_work_item_queue(m_queue, task_callback, &t, WORK_ITEM_FLAG_AUTO_RELEASE);
+}
+
+
+//-------------------------------------------------
+//  task_callback - work queue callback running
+//  one task and releasing its dependents
+//-------------------------------------------------
+
+void *task_graph::task_callback(void *param, int threadid)
+{
+	task &t = *reinterpret_cast<task *>(param);
+	t.func();
+
+	task_graph &graph = *t.graph;
+	for (task_id succ : t.successors)
+		if (--graph.m_tasks[succ]->remaining == 0)
+			graph.start(*graph.m_tasks[succ]);
+	return nullptr;
+}
+
+} // namespace util
@@ -0,0 +1,174 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    parallel.h
+
+    Typed helpers for running work on an OSD work queue.
+
+    parallel_for splits a range of indices into chunks of at least the
+    given grain size and calls a function for each chunk, handing all
+    but the first to the work queue and running the first on the calling
+    thread:
+
+        util::parallel_for(m_queue, 0, height, 16, [&] (int32_t first, int32_t last) {
+            for (int32_t y = first; y < last; y++)
+                draw_row(y);
+        });
+
+    task_graph runs a set of tasks, each starting only once every task it
+    depends on has finished:
+
+        util::task_graph graph;
+        auto a = graph.add([&] { decode(); });
+        auto b = graph.add([&] { mix(); });
+        graph.add([&] { present(); }, { a, b });
+        graph.run(m_queue);
+
+    Both block until all of their work is complete, and share the queue
+    with anything else queued on it.  With a null queue everything runs
+    on the calling thread, in order.  Work must not wait on its own
+    queue; express the ordering as task dependencies instead.
+
+***************************************************************************/
+
+#pragma once
+
+#ifndef MAME_LIB_UTIL_PARALLEL_H
+#define MAME_LIB_UTIL_PARALLEL_H
+
+#include "osdcore.h"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+
+namespace util {
+
+//**************************************************************************
+//  PARALLEL FOR
+//**************************************************************************
+
+namespace detail {
+
+// one chunk of a parallel_for
+template <typename Func>
+struct parallel_chunk
+{
+	Func *      func;
+	int32_t     first;
+	int32_t     last;
+};
+
+template <typename Func>
+void *parallel_chunk_callback(void *param, int threadid)
+{
+	parallel_chunk<Func> const &chunk = *reinterpret_cast<parallel_chunk<Func> const *>(param);
+	(*chunk.func)(chunk.first, chunk.last);
+	return nullptr;
+}
+
+// block until the queue has drained
+inline void parallel_wait(osd_work_queue *queue)
+{
+	while (!osd_work_queue_wait(queue, osd_ticks_per_second()))
+	{
+	}
+}
+
+} // namespace detail
+
+
+//-------------------------------------------------
+//  parallel_for - call func(first, last) for
+//  chunks of [begin, end) no smaller than grain,
+//  spreading them over the work queue
+//-------------------------------------------------
+
+template <typename Func>
+void parallel_for(osd_work_queue *queue, int32_t begin, int32_t end, int32_t grain, Func &&func)
+{
+	if (end <= begin)
+		return;
+
+	// one chunk per grain, but never more than the queue could possibly run at once
+	int32_t const count = end - begin;
+	int32_t const chunks = std::min<int32_t>((count + std::max<int32_t>(grain, 1) - 1) / std::max<int32_t>(grain, 1), WORK_MAX_THREADS);
+	if (queue == nullptr || chunks < 2)
+	{
+		func(begin, end);
+		return;
+	}
+
+	// divide the range evenly, giving any remainder to the leading chunks
+	using func_type = std::remove_reference_t<Func>;
+	std::vector<detail::parallel_chunk<func_type> > work(chunks);
+	int32_t first = begin;
+	for (int32_t chunk = 0; chunk < chunks; chunk++)
+	{
+		int32_t const size = count / chunks + ((chunk < count % chunks) ? 1 : 0);
+		work[chunk].func = &func;
+		work[chunk].first = first;
+		work[chunk].last = first + size;
+		first += size;
+	}
+
+	// hand all but the first to the work queue and run that one here
+	osd_work_item_queue_multiple(queue, detail::parallel_chunk_callback<func_type>, chunks - 1, &work[1], sizeof(work[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	func(work[0].first, work[0].last);
+	detail::parallel_wait(queue);
+}
+
+
+
+//**************************************************************************
+//  TASK GRAPH
+//**************************************************************************
+
+// ======================> task_graph
+
+class task_graph
+{
+public:
+	using task_id = size_t;
+
+	// construction/destruction
+	task_graph() = default;
+	task_graph(task_graph const &) = delete;
+	task_graph &operator=(task_graph const &) = delete;
+
+	// building the graph; every dependency must already have been added
+	task_id add(std::function<void ()> &&func, std::initializer_list<task_id> depends = {});
+	void clear() { m_tasks.clear(); }
+	size_t count() const { return m_tasks.size(); }
+
+	// run every task, blocking until all have finished
+	void run(osd_work_queue *queue);
+
+private:
+	struct task
+	{
+		task_graph *            graph;              // owning graph
+		std::function<void ()>  func;               // work to do
+		std::vector<task_id>    successors;         // tasks waiting on this one
+		uint32_t                prerequisites = 0;  // number of tasks this one waits on
+		std::atomic<uint32_t>   remaining;          // prerequisites not yet finished during a run
+	};
+
+	// internal helpers
+	void start(task &t);
+	static void *task_callback(void *param, int threadid);
+
+	// internal state
+	std::vector<std::unique_ptr<task> > m_tasks;    // tasks in the order added
+	osd_work_queue *                    m_queue = nullptr; // queue for the current run
+};
+
+} // namespace util
+
+#endif // MAME_LIB_UTIL_PARALLEL_H
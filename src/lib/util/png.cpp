@@ -915,7 +915,7 @@ static png_error write_chunk(util::core_file &fp, const uint8_t *data, uint32_t
     chunk to the given file by deflating it
 -------------------------------------------------*/
 
-static png_error write_deflated_chunk(util::core_file &fp, uint8_t *data, uint32_t type, uint32_t length)
+static png_error write_deflated_chunk(util::core_file &fp, uint8_t *data, uint32_t type, uint32_t length, int level)
 {
 	uint64_t lengthpos = fp.tell();
 	uint8_t tempbuff[8192];
@@ -937,7 +937,7 @@ static png_error write_deflated_chunk(util::core_file &fp, uint8_t *data, uint32
 	memset(&stream, 0, sizeof(stream));
 	stream.next_in = data;
 	stream.avail_in = length;
-	zerr = deflateInit(&stream, Z_DEFAULT_COMPRESSION);
+	zerr = deflateInit(&stream, level);
 	if (zerr != Z_OK)
 		return PNGERR_COMPRESS_ERROR;
 
@@ -1134,12 +1134,58 @@ static png_error convert_bitmap_to_image_rgb(png_info &pnginfo, const bitmap_t &
 }
 
 
+/*-------------------------------------------------
+    filter_image_fast - choose a filter for each
+    row of an RGB image and apply it in place
+-------------------------------------------------*/
+
+static void filter_image_fast(png_info &pnginfo)
+{
+	// palette indices rarely benefit from filtering
+	if (pnginfo.color_type == 3)
+		return;
+
+	int const bpp = (pnginfo.color_type == 6) ? 4 : 3;
+	int const rowbytes = compute_rowbytes(pnginfo);
+
+	// work from the bottom up and right to left, so the unfiltered bytes each filter needs are still there
+	for (int y = pnginfo.height - 1; y >= 0; y--)
+	{
+		uint8_t *const row = &pnginfo.image[y * (rowbytes + 1)];
+		uint8_t *const src = row + 1;
+		uint8_t const *const prev = y ? (src - (rowbytes + 1)) : nullptr;
+
+		// estimate each filter's output with the sum of absolute signed values
+		uint32_t none = 0, sub = 0, up = 0;
+		for (int x = 0; x < rowbytes; x++)
+		{
+			none += std::abs(int(int8_t(src[x])));
+			sub += std::abs(int(int8_t(uint8_t(src[x] - ((x >= bpp) ? src[x - bpp] : 0)))));
+			up += std::abs(int(int8_t(uint8_t(src[x] - (prev ? prev[x] : 0)))));
+		}
+
+		if ((sub < none) && (sub <= up))
+		{
+			row[0] = PNG_PF_Sub;
+			for (int x = rowbytes - 1; x >= bpp; x--)
+				src[x] -= src[x - bpp];
+		}
+		else if (prev && (up < none))
+		{
+			row[0] = PNG_PF_Up;
+			for (int x = 0; x < rowbytes; x++)
+				src[x] -= prev[x];
+		}
+	}
+}
+
+
 /*-------------------------------------------------
     write_png_stream - stream a series of PNG
     chunks to the given file
 -------------------------------------------------*/
 
-static png_error write_png_stream(util::core_file &fp, png_info &pnginfo, const bitmap_t &bitmap, int palette_length, const rgb_t *palette)
+static png_error write_png_stream(util::core_file &fp, png_info &pnginfo, const bitmap_t &bitmap, int palette_length, const rgb_t *palette, png_encode encode)
 {
 	uint8_t tempbuff[16];
 	png_error error;
@@ -1152,7 +1198,9 @@ static png_error write_png_stream(util::core_file &fp, png_info &pnginfo, const
 	if (error != PNGERR_NONE)
 		return error;
 
-	// if we wanted to get clever and do filtering, we would do it here
+	// the fastest compression level relies on filtering to find matches
+	if (encode == PNG_ENCODE_FAST)
+		filter_image_fast(pnginfo);
 
 	// write the IHDR chunk
 	put_32bit(tempbuff + 0, pnginfo.width);
@@ -1173,7 +1221,7 @@ static png_error write_png_stream(util::core_file &fp, png_info &pnginfo, const
 		return error;
 
 	// write a single IDAT chunk */
-	error = write_deflated_chunk(fp, pnginfo.image.get(), PNG_CN_IDAT, pnginfo.height * (compute_rowbytes(pnginfo) + 1));
+	error = write_deflated_chunk(fp, pnginfo.image.get(), PNG_CN_IDAT, pnginfo.height * (compute_rowbytes(pnginfo) + 1), (encode == PNG_ENCODE_FAST) ? Z_BEST_SPEED : Z_DEFAULT_COMPRESSION);
 	if (error != PNGERR_NONE)
 		return error;
 
@@ -1222,7 +1270,7 @@ static png_error write_png_stream(util::core_file &fp, png_info &pnginfo, const
 }
 
 
-png_error png_write_bitmap(util::core_file &fp, png_info *info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette)
+png_error png_write_bitmap(util::core_file &fp, png_info *info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette, png_encode encode)
 {
 	// use a dummy pnginfo if none passed to us
 	png_info pnginfo;
@@ -1234,7 +1282,7 @@ png_error png_write_bitmap(util::core_file &fp, png_info *info, bitmap_t const &
 		return PNGERR_FILE_ERROR;
 
 	/* write the rest of the PNG data */
-	return write_png_stream(fp, *info, bitmap, palette_length, palette);
+	return write_png_stream(fp, *info, bitmap, palette_length, palette, encode);
 }
 
 
@@ -1273,7 +1321,7 @@ png_error mng_capture_start(util::core_file &fp, bitmap_t &bitmap, unsigned rate
 }
 
 /**
- * @fn  png_error mng_capture_frame(util::core_file &fp, png_info *info, bitmap_t &bitmap, int palette_length, const rgb_t *palette)
+ * @fn  png_error mng_capture_frame(util::core_file &fp, png_info *info, bitmap_t &bitmap, int palette_length, const rgb_t *palette, png_encode encode)
  *
  * @brief   Mng capture frame.
  *
@@ -1282,13 +1330,14 @@ png_error mng_capture_start(util::core_file &fp, bitmap_t &bitmap, unsigned rate
  * @param [in,out]  bitmap  The bitmap.
  * @param   palette_length  Length of the palette.
  * @param   palette         The palette.
+ * @param   encode          Speed/size trade-off.
  *
  * @return  A png_error.
  */
 
-png_error mng_capture_frame(util::core_file &fp, png_info &info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette)
+png_error mng_capture_frame(util::core_file &fp, png_info &info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette, png_encode encode)
 {
-	return write_png_stream(fp, info, bitmap, palette_length, palette);
+	return write_png_stream(fp, info, bitmap, palette_length, palette, encode);
 }
 
 /**
@@ -44,6 +44,13 @@ enum png_error
 	PNGERR_UNSUPPORTED_FORMAT
 };
 
+/* Encoding trade-offs */
+enum png_encode
+{
+	PNG_ENCODE_DEFAULT,     // unfiltered rows, default compression level
+	PNG_ENCODE_FAST         // rows filtered for speed, fastest compression level
+};
+
 
 
 /***************************************************************************
@@ -101,10 +108,10 @@ private:
 
 png_error png_read_bitmap(util::core_file &fp, bitmap_argb32 &bitmap);
 
-png_error png_write_bitmap(util::core_file &fp, png_info *info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette);
+png_error png_write_bitmap(util::core_file &fp, png_info *info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette, png_encode encode = PNG_ENCODE_DEFAULT);
 
 png_error mng_capture_start(util::core_file &fp, bitmap_t &bitmap, unsigned rate);
-png_error mng_capture_frame(util::core_file &fp, png_info &info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette);
+png_error mng_capture_frame(util::core_file &fp, png_info &info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette, png_encode encode = PNG_ENCODE_DEFAULT);
 png_error mng_capture_stop(util::core_file &fp);
 
 #endif // MAME_LIB_UTIL_PNG_H
@@ -25,10 +25,12 @@
 #include <array>
 #include <cassert>
 #include <chrono>
+#include <condition_variable>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
+#include <list>
 #include <mutex>
 #include <ratio>
 #include <utility>
@@ -99,8 +101,6 @@ public:
 
 	virtual ~m7z_file_impl()
 	{
-		if (m_out_buffer)
-			IAlloc_Free(&m_alloc_imp, m_out_buffer);
 		if (m_inited)
 			SzArEx_Free(&m_db, &m_alloc_imp);
 	}
@@ -125,8 +125,25 @@ public:
 	static void cache_clear()
 	{
 		// clear call cache entries
-		std::lock_guard<std::mutex> guard(s_cache_mutex);
-		for (std::size_t cachenum = 0; cachenum < s_cache.size(); s_cache[cachenum++].reset()) { }
+		{
+			std::lock_guard<std::mutex> guard(s_cache_mutex);
+			for (std::size_t cachenum = 0; cachenum < s_cache.size(); s_cache[cachenum++].reset()) { }
+		}
+
+		// drop decoded solid blocks that aren't being decoded right now
+		std::lock_guard<std::mutex> guard(s_block_mutex);
+		for (auto it = s_blocks.begin(); s_blocks.end() != it; )
+		{
+			if ((*it)->data)
+			{
+				s_block_bytes -= (*it)->size;
+				it = s_blocks.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
 	}
 
 	archive_file::error initialize();
@@ -154,8 +171,19 @@ public:
 	std::uint32_t current_crc() const { return m_curr_crc; }
 
 	archive_file::error decompress(void *buffer, std::uint32_t length);
+	archive_file::error map_current(const void *&data);
 
 private:
+	// a decoded solid block, shared by all open instances of an archive
+	struct solid_block
+	{
+		std::string                     filename;
+		std::uint64_t                   length;     // archive length, to notice replaced files
+		UInt32                          index;
+		std::shared_ptr<Byte const>     data;       // empty while being decoded
+		std::size_t                     size;
+	};
+
 	m7z_file_impl(const m7z_file_impl &) = delete;
 	m7z_file_impl(m7z_file_impl &&) = delete;
 	m7z_file_impl &operator=(const m7z_file_impl &) = delete;
@@ -170,11 +198,23 @@ private:
 			bool partialpath);
 	void make_utf8_name(int index);
 	void set_curr_modified();
+	archive_file::error reopen();
+	archive_file::error get_current_data(Byte const *&data);
+	archive_file::error get_block(UInt32 index);
+	archive_file::error decode_block(UInt32 index, std::shared_ptr<Byte const> &data, std::size_t &size);
 
 	static constexpr std::size_t            CACHE_SIZE = 8;
 	static std::array<ptr, CACHE_SIZE>      s_cache;
 	static std::mutex                       s_cache_mutex;
 
+	// decoded solid blocks are kept up to a memory limit, so members opened
+	// at the same time or one after the other don't decode a block again
+	static constexpr std::size_t                    BLOCK_CACHE_BYTES = 256 * 1024 * 1024;
+	static std::list<std::shared_ptr<solid_block> > s_blocks;       // most recently used first
+	static std::size_t                              s_block_bytes;
+	static std::mutex                               s_block_mutex;
+	static std::condition_variable                  s_block_decoded;
+
 	const std::string                       m_filename;             // copy of _7Z filename (for caching)
 
 	int                                     m_curr_file_idx;        // current file index
@@ -195,11 +235,10 @@ private:
 	ISzAlloc                                m_alloc_temp_imp;
 	bool                                    m_inited;
 
-	// cached stuff for solid blocks
+	// most recently used solid block
 	UInt32                                  m_block_index;
-	Byte *                                  m_out_buffer;
-	std::size_t                             m_out_buffer_size;
-
+	std::shared_ptr<Byte const>             m_block;
+	std::size_t                             m_block_size;
 };
 
 
@@ -232,6 +271,7 @@ public:
 	virtual std::uint32_t current_crc() const override { return m_impl->current_crc(); }
 
 	virtual error decompress(void *buffer, std::uint32_t length) override { return m_impl->decompress(buffer, length); }
+	virtual error map_current(const void *&data) override { return m_impl->map_current(data); }
 
 private:
 	m7z_file_impl::ptr m_impl;
@@ -245,6 +285,10 @@ private:
 
 std::array<m7z_file_impl::ptr, m7z_file_impl::CACHE_SIZE> m7z_file_impl::s_cache;
 std::mutex m7z_file_impl::s_cache_mutex;
+std::list<std::shared_ptr<m7z_file_impl::solid_block> > m7z_file_impl::s_blocks;
+std::size_t m7z_file_impl::s_block_bytes = 0;
+std::mutex m7z_file_impl::s_block_mutex;
+std::condition_variable m7z_file_impl::s_block_decoded;
 
 
 
@@ -293,8 +337,8 @@ m7z_file_impl::m7z_file_impl(const std::string &filename)
 	, m_utf8_buf(512)
 	, m_inited(false)
 	, m_block_index(0)
-	, m_out_buffer(nullptr)
-	, m_out_buffer_size(0)
+	, m_block()
+	, m_block_size(0)
 {
 	m_alloc_imp.Alloc = &SzAlloc;
 	m_alloc_imp.Free = &SzFree;
@@ -391,7 +435,41 @@ archive_file::error m7z_file_impl::decompress(void *buffer, std::uint32_t length
 		return archive_file::error::BUFFER_TOO_SMALL;
 	}
 
-	// make sure the file is open..
+	// copy the file out of its solid block
+	Byte const *data;
+	archive_file::error const err = get_current_data(data);
+	if (err != archive_file::error::NONE)
+		return err;
+	if (m_curr_length)
+		std::memcpy(buffer, data, m_curr_length);
+	return archive_file::error::NONE;
+}
+
+
+/*-------------------------------------------------
+    map_current - get a view of the current file
+    within its decoded solid block, valid until
+    another file is decompressed or mapped or the
+    archive is closed
+-------------------------------------------------*/
+
+archive_file::error m7z_file_impl::map_current(const void *&data)
+{
+	Byte const *block_data;
+	archive_file::error const err = get_current_data(block_data);
+	if (err != archive_file::error::NONE)
+		return err;
+	data = block_data;
+	return archive_file::error::NONE;
+}
+
+
+/*-------------------------------------------------
+    reopen - make sure the archive file is open
+-------------------------------------------------*/
+
+archive_file::error m7z_file_impl::reopen()
+{
 	if (!m_archive_stream.osdfile)
 	{
 		m_archive_stream.currfpos = 0;
@@ -403,16 +481,168 @@ archive_file::error m7z_file_impl::decompress(void *buffer, std::uint32_t length
 		}
 		osd_printf_verbose("un7z: reopened archive file %s\n", m_filename);
 	}
+	return archive_file::error::NONE;
+}
+
+
+/*-------------------------------------------------
+    get_current_data - find the current file in
+    its solid block and check its CRC
+-------------------------------------------------*/
+
+archive_file::error m7z_file_impl::get_current_data(Byte const *&data)
+{
+	// empty files don't belong to a block
+	UInt32 const block(m_db.FileToFolder[m_curr_file_idx]);
+	if (UInt32(-1) == block)
+	{
+		static Byte const empty = 0;
+		data = &empty;
+		return archive_file::error::NONE;
+	}
+
+	archive_file::error const err = get_block(block);
+	if (err != archive_file::error::NONE)
+		return err;
+
+	UInt64 const start(m_db.UnpackPositions[m_curr_file_idx]);
+	std::size_t const offset(start - m_db.UnpackPositions[m_db.FolderToFile[block]]);
+	std::size_t const size(m_db.UnpackPositions[m_curr_file_idx + 1] - start);
+	if ((offset + size) > m_block_size)
+	{
+		osd_printf_error("un7z: error decompressing %s from %s (%d)\n", m_curr_name, m_filename, int(SZ_ERROR_FAIL));
+		return archive_file::error::DECOMPRESS_ERROR;
+	}
+	if (SzBitWithVals_Check(&m_db.CRCs, m_curr_file_idx) && (CrcCalc(m_block.get() + offset, size) != m_db.CRCs.Vals[m_curr_file_idx]))
+	{
+		osd_printf_error("un7z: error decompressing %s from %s (%d)\n", m_curr_name, m_filename, int(SZ_ERROR_CRC));
+		return archive_file::error::DECOMPRESS_ERROR;
+	}
+
+	data = m_block.get() + offset;
+	return archive_file::error::NONE;
+}
+
+
+/*-------------------------------------------------
+    get_block - make a solid block current, taking
+    it from the shared cache, waiting for another
+    instance that's decoding it, or decoding it
+-------------------------------------------------*/
+
+archive_file::error m7z_file_impl::get_block(UInt32 index)
+{
+	if (m_block && (m_block_index == index))
+		return archive_file::error::NONE;
+	m_block.reset();
+
+	std::unique_lock<std::mutex> lock(s_block_mutex);
+	while (true)
+	{
+		auto const found(std::find_if(
+				s_blocks.begin(),
+				s_blocks.end(),
+				[this, index] (std::shared_ptr<solid_block> const &block)
+				{
+					return (block->index == index) && (block->length == m_archive_stream.length) && (block->filename == m_filename);
+				}));
+		if (s_blocks.end() == found)
+			break;
+
+		std::shared_ptr<solid_block> const block(*found);
+		if (block->data)
+		{
+			s_blocks.splice(s_blocks.begin(), s_blocks, found);
+			m_block_index = index;
+			m_block = block->data;
+			m_block_size = block->size;
+			return archive_file::error::NONE;
+		}
+
+		// another instance is decoding it - if that fails it's removed
+		s_block_decoded.wait(lock);
+	}
+
+	// claim the block and decode it without holding the lock
+	auto const block(std::make_shared<solid_block>());
+	block->filename = m_filename;
+	block->length = m_archive_stream.length;
+	block->index = index;
+	block->size = 0;
+	s_blocks.emplace_front(block);
+	lock.unlock();
+
+	std::shared_ptr<Byte const> data;
+	std::size_t size(0);
+	archive_file::error const err = decode_block(index, data, size);
+
+	lock.lock();
+	if (err != archive_file::error::NONE)
+	{
+		s_blocks.remove(block);
+		s_block_decoded.notify_all();
+		return err;
+	}
+	block->data = data;
+	block->size = size;
+	s_block_bytes += size;
+
+	// evict least recently used blocks, keeping ones being decoded
+	for (auto it = s_blocks.end(); (s_block_bytes > BLOCK_CACHE_BYTES) && (s_blocks.begin() != it); )
+	{
+		--it;
+		if ((*it)->data && (*it != block))
+		{
+			s_block_bytes -= (*it)->size;
+			it = s_blocks.erase(it);
+		}
+	}
+	s_block_decoded.notify_all();
+	lock.unlock();
+
+	m_block_index = index;
+	m_block = std::move(data);
+	m_block_size = size;
+	return archive_file::error::NONE;
+}
+
+
+/*-------------------------------------------------
+    decode_block - decode a solid block into a
+    newly allocated buffer
+-------------------------------------------------*/
+
+archive_file::error m7z_file_impl::decode_block(UInt32 index, std::shared_ptr<Byte const> &data, std::size_t &size)
+{
+	archive_file::error const err = reopen();
+	if (err != archive_file::error::NONE)
+		return err;
+
+	UInt64 const unpack_size(SzAr_GetFolderUnpackSize(&m_db.db, index));
+	SRes res = SZ_OK;
+	size = std::size_t(unpack_size);
+	if (size != unpack_size)
+	{
+		res = SZ_ERROR_MEM;
+	}
+	else
+	{
+		// blocks can outlive this instance, so don't free through its allocator
+		Byte *const buffer(size ? reinterpret_cast<Byte *>(SzAlloc(nullptr, size)) : nullptr);
+		if (size && !buffer)
+		{
+			res = SZ_ERROR_MEM;
+		}
+		else
+		{
+			data = std::shared_ptr<Byte const>(buffer, [] (Byte const *p) { SzFree(nullptr, const_cast<Byte *>(p)); });
+			res = SzAr_DecodeFolder(&m_db.db, index, &m_look_stream.s, m_db.dataPos, buffer, size, &m_alloc_temp_imp);
+		}
+	}
 
-	std::size_t offset(0);
-	std::size_t out_size_processed(0);
-	SRes const res = SzArEx_Extract(
-			&m_db, &m_look_stream.s, m_curr_file_idx,           // requested file
-			&m_block_index, &m_out_buffer, &m_out_buffer_size,  // solid block caching
-			&offset, &out_size_processed,                       // data size/offset
-			&m_alloc_imp, &m_alloc_temp_imp);                   // allocator helpers
 	if (res != SZ_OK)
 	{
+		data.reset();
 		osd_printf_error("un7z: error decompressing %s from %s (%d)\n", m_curr_name, m_filename, int(res));
 		switch (res)
 		{
@@ -422,9 +652,6 @@ archive_file::error m7z_file_impl::decompress(void *buffer, std::uint32_t length
 		default:                    return archive_file::error::DECOMPRESS_ERROR;
 		}
 	}
-
-	// copy to destination buffer
-	std::memcpy(buffer, m_out_buffer + offset, (std::min<std::size_t>)(length, out_size_processed));
 	return archive_file::error::NONE;
 }
 
@@ -26,6 +26,7 @@
 #include <cstring>
 #include <cstdlib>
 #include <ctime>
+#include <list>
 #include <mutex>
 #include <ratio>
 #include <utility>
@@ -79,6 +80,8 @@ public:
 		// clear call cache entries
 		std::lock_guard<std::mutex> guard(s_cache_mutex);
 		for (std::size_t cachenum = 0; cachenum < s_cache.size(); s_cache[cachenum++].reset()) { }
+		s_directories.clear();
+		s_directory_bytes = 0;
 	}
 
 	archive_file::error initialize()
@@ -105,8 +108,14 @@ public:
 			return archive_file::error::UNSUPPORTED;
 		}
 
+		// another instance may already have read the central directory
+		m_cd = find_directory();
+		if (m_cd)
+			return archive_file::error::NONE;
+
 		// allocate memory for the central directory
-		try { m_cd.resize(std::size_t(m_ecd.cd_size)); }
+		auto cd = std::make_shared<std::vector<std::uint8_t> >();
+		try { cd->resize(std::size_t(m_ecd.cd_size)); }
 		catch (...)
 		{
 			osd_printf_error("unzip: %s failed to allocate memory for central directory\n", m_filename);
@@ -120,7 +129,7 @@ public:
 		{
 			std::uint32_t const chunk(std::uint32_t((std::min<std::uint64_t>)(std::numeric_limits<std::uint32_t>::max(), cd_remaining)));
 			std::uint32_t read_length(0);
-			auto const filerr = m_file->read(&m_cd[cd_offs], m_ecd.cd_start_disk_offset + cd_offs, chunk, read_length);
+			auto const filerr = m_file->read(&(*cd)[cd_offs], m_ecd.cd_start_disk_offset + cd_offs, chunk, read_length);
 			if (filerr != osd_file::error::NONE)
 			{
 				osd_printf_error("unzip: %s error reading central directory (%d)\n", m_filename, int(filerr));
@@ -134,6 +143,8 @@ public:
 			cd_remaining -= read_length;
 			cd_offs += read_length;
 		}
+		m_cd = std::move(cd);
+		add_directory();
 		osd_printf_verbose("unzip: read %s central directory\n", m_filename);
 
 		return archive_file::error::NONE;
@@ -180,8 +191,18 @@ public:
 	std::uint32_t current_crc() const { return m_header.crc; }
 
 	archive_file::error decompress(void *buffer, std::uint32_t length);
+	archive_file::error map_current(const void *&data);
 
 private:
+	// a central directory shared by all open instances of an archive
+	struct cached_directory
+	{
+		std::string                                         filename;
+		std::uint64_t                                       length;     // archive length, to notice replaced files
+		std::uint64_t                                       offset;     // directory offset
+		std::shared_ptr<std::vector<std::uint8_t> const>    data;
+	};
+
 	zip_file_impl(const zip_file_impl &) = delete;
 	zip_file_impl(zip_file_impl &&) = delete;
 	zip_file_impl &operator=(const zip_file_impl &) = delete;
@@ -189,6 +210,32 @@ private:
 
 	int search(std::uint32_t search_crc, const std::string &search_filename, bool matchcrc, bool matchname, bool partialpath);
 
+	std::shared_ptr<std::vector<std::uint8_t> const> find_directory()
+	{
+		std::lock_guard<std::mutex> guard(s_cache_mutex);
+		for (auto it = s_directories.begin(); s_directories.end() != it; ++it)
+		{
+			if ((it->length == m_length) && (it->offset == m_ecd.cd_start_disk_offset) && (it->data->size() == m_ecd.cd_size) && (it->filename == m_filename))
+			{
+				s_directories.splice(s_directories.begin(), s_directories, it);
+				osd_printf_verbose("unzip: found %s central directory in cache\n", m_filename);
+				return it->data;
+			}
+		}
+		return nullptr;
+	}
+	void add_directory()
+	{
+		std::lock_guard<std::mutex> guard(s_cache_mutex);
+		s_directories.emplace_front(cached_directory{ m_filename, m_length, m_ecd.cd_start_disk_offset, m_cd });
+		s_directory_bytes += m_cd->size();
+		while ((s_directory_bytes > DIRECTORY_CACHE_BYTES) && (s_directories.size() > 1))
+		{
+			s_directory_bytes -= s_directories.back().data->size();
+			s_directories.pop_back();
+		}
+	}
+
 	archive_file::error reopen()
 	{
 		if (!m_file)
@@ -266,7 +313,10 @@ private:
 
 	static constexpr std::size_t        DECOMPRESS_BUFSIZE = 16384;
 	static constexpr std::size_t        CACHE_SIZE = 8; // number of open files to cache
+	static constexpr std::size_t        DIRECTORY_CACHE_BYTES = 16 * 1024 * 1024; // central directory bytes to cache
 	static std::array<ptr, CACHE_SIZE>  s_cache;
+	static std::list<cached_directory>  s_directories;  // most recently used first
+	static std::size_t                  s_directory_bytes;
 	static std::mutex                   s_cache_mutex;
 
 	const std::string           m_filename;                 // copy of ZIP filename (for caching)
@@ -275,7 +325,7 @@ private:
 
 	ecd                         m_ecd;                      // end of central directory
 
-	std::vector<std::uint8_t>   m_cd;                       // central directory raw data
+	std::shared_ptr<std::vector<std::uint8_t> const> m_cd; // central directory raw data
 	std::uint32_t               m_cd_pos;                   // position in central directory
 	file_header                 m_header;                   // current file header
 	bool                        m_curr_is_dir;              // current file is directory
@@ -313,6 +363,7 @@ public:
 	virtual std::uint32_t current_crc() const override { return m_impl->current_crc(); }
 
 	virtual error decompress(void *buffer, std::uint32_t length) override { return m_impl->decompress(buffer, length); }
+	virtual error map_current(const void *&data) override { return m_impl->map_current(data); }
 
 private:
 	zip_file_impl::ptr m_impl;
@@ -653,6 +704,8 @@ private:
 ***************************************************************************/
 
 std::array<zip_file_impl::ptr, zip_file_impl::CACHE_SIZE> zip_file_impl::s_cache;
+std::list<zip_file_impl::cached_directory> zip_file_impl::s_directories;
+std::size_t zip_file_impl::s_directory_bytes = 0;
 std::mutex zip_file_impl::s_cache_mutex;
 
 
@@ -707,7 +760,7 @@ int zip_file_impl::search(std::uint32_t search_crc, const std::string &search_fi
 	while ((m_cd_pos + central_dir_entry_reader::minimum_length()) <= m_ecd.cd_size)
 	{
 		// make sure we have enough data
-		central_dir_entry_reader const reader(&m_cd[0] + m_cd_pos);
+		central_dir_entry_reader const reader(&(*m_cd)[0] + m_cd_pos);
 		if (!reader.signature_correct() || ((m_cd_pos + reader.total_length()) > m_ecd.cd_size))
 			break;
 
@@ -865,6 +918,40 @@ archive_file::error zip_file_impl::decompress(void *buffer, std::uint32_t length
 
 
 
+/*-------------------------------------------------
+    map_current - get a view of a stored file
+    within the mapped archive
+-------------------------------------------------*/
+
+archive_file::error zip_file_impl::map_current(const void *&data)
+{
+	// only stored files can be viewed in place
+	if ((m_header.compression != 0) || (m_header.compressed_length != m_header.uncompressed_length))
+		return archive_file::error::UNSUPPORTED;
+
+	// get the data offset
+	std::uint64_t offset;
+	auto const ziperr = get_compressed_data_offset(offset);
+	if (ziperr != archive_file::error::NONE)
+		return ziperr;
+
+	// map the archive if the OSD layer supports it
+	void const *view;
+	std::uint64_t view_length;
+	if (m_file->map_view(view, view_length) != osd_file::error::NONE)
+		return archive_file::error::UNSUPPORTED;
+	if ((offset > view_length) || ((view_length - offset) < m_header.compressed_length))
+	{
+		osd_printf_error("unzip: unexpectedly reached end-of-file while reading %s from %s\n", m_header.file_name, m_filename);
+		return archive_file::error::FILE_TRUNCATED;
+	}
+
+	data = reinterpret_cast<std::uint8_t const *>(view) + offset;
+	return archive_file::error::NONE;
+}
+
+
+
 /***************************************************************************
     ZIP FILE PARSING
 ***************************************************************************/
@@ -83,6 +83,11 @@ public:
 
 	// decompress the most recently found file in the ZIP
 	virtual error decompress(void *buffer, std::uint32_t length) = 0;
+
+	// get a read-only view of the most recently found file without copying
+	// it, if it's stored uncompressed or already decoded; the view is valid
+	// until another file is decompressed or mapped or the archive is closed
+	virtual error map_current(const void *&data) = 0;
 };
 
 } // namespace util
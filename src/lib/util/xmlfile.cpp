@@ -6,6 +6,11 @@
 
     XML file parsing code.
 
+    Documents own the memory for their nodes and attributes, which is
+    carved out of large blocks, and keep a single lowercase copy of each
+    element and attribute name.  Nodes that are deleted keep their memory
+    until the document is destroyed.
+
 ***************************************************************************/
 
 #include "xmlfile.h"
@@ -15,11 +20,15 @@
 #include <algorithm>
 #include <cassert>
 #include <cctype>
+#include <cstddef>
 #include <cstdlib>
 #include <cstring>
 #include <iomanip>
+#include <iterator>
 #include <locale>
+#include <new>
 #include <sstream>
+#include <unordered_map>
 
 
 namespace util { namespace xml {
@@ -30,7 +39,12 @@ namespace {
     CONSTANTS
 ***************************************************************************/
 
-constexpr unsigned TEMP_BUFFER_SIZE(4096U);
+constexpr unsigned TEMP_BUFFER_SIZE(65536U);
+constexpr std::size_t NODE_BLOCK_SIZE(65536U);
+
+// binary documents start with a NUL so they can't be mistaken for XML
+constexpr uint8_t BINARY_MAGIC[4] = { 0x00, 'M', 'X', 'B' };
+constexpr uint8_t BINARY_VERSION(1U);
 std::locale const f_portable_locale("C");
 
 
@@ -64,6 +78,74 @@ void write_escaped(core_file &file, std::string const &str)
 	}
 }
 
+
+/*-------------------------------------------------
+    binary document encoding - unsigned LEB128
+    integers and length-prefixed strings
+-------------------------------------------------*/
+
+void write_varint(std::vector<uint8_t> &data, uint32_t value)
+{
+	while (value >= 0x80U)
+	{
+		data.push_back(uint8_t(value | 0x80U));
+		value >>= 7;
+	}
+	data.push_back(uint8_t(value));
+}
+
+void write_string(std::vector<uint8_t> &data, char const *str, std::size_t length)
+{
+	write_varint(data, uint32_t(length));
+	data.insert(data.end(), str, str + length);
+}
+
+class binary_reader
+{
+public:
+	binary_reader(uint8_t const *data, std::size_t length) : m_ptr(data), m_end(data + length), m_good(true) { }
+
+	bool good() const { return m_good; }
+	bool done() const { return m_ptr == m_end; }
+
+	uint32_t varint()
+	{
+		uint32_t result = 0U;
+		for (unsigned shift = 0U; m_good; shift += 7U)
+		{
+			if ((m_ptr == m_end) || (shift > 28U))
+			{
+				m_good = false;
+				break;
+			}
+			uint8_t const byte(*m_ptr++);
+			result |= uint32_t(byte & 0x7fU) << shift;
+			if (!(byte & 0x80U))
+				break;
+		}
+		return result;
+	}
+
+	char const *string(std::size_t &length)
+	{
+		length = varint();
+		if (!m_good || (std::size_t(m_end - m_ptr) < length))
+		{
+			m_good = false;
+			length = 0U;
+			return "";
+		}
+		char const *const result(reinterpret_cast<char const *>(m_ptr));
+		m_ptr += length;
+		return result;
+	}
+
+private:
+	uint8_t const *m_ptr;
+	uint8_t const *m_end;
+	bool m_good;
+};
+
 } // anonymous namespace
 
 
@@ -75,9 +157,26 @@ void write_escaped(core_file &file, std::string const &str)
 struct parse_info
 {
 	XML_Parser      parser;
-	file::ptr       rootnode;
-	data_node *     curnode;
-	uint32_t        flags;
+	parse_handler * handler;
+};
+
+
+// builds a tree from streamed elements
+class tree_builder : public parse_handler
+{
+public:
+	tree_builder(file::ptr &&rootnode, uint32_t flags) : m_rootnode(std::move(rootnode)), m_curnode(m_rootnode.get()), m_flags(flags) { }
+
+	file::ptr &rootnode() { return m_rootnode; }
+
+	virtual void start_element(const char *name, const char **attributes, int line) override;
+	virtual void character_data(const char *s, int len) override;
+	virtual void end_element(const char *name) override;
+
+private:
+	file::ptr       m_rootnode;
+	data_node *     m_curnode;
+	uint32_t        m_flags;
 };
 
 
@@ -87,7 +186,8 @@ struct parse_info
 ***************************************************************************/
 
 /* expat interfaces */
-static bool expat_setup_parser(parse_info &info, parse_options const *opts);
+static XML_Parser expat_setup_parser(parse_info &info, parse_handler &handler, parse_options const *opts);
+static void expat_report_error(parse_info const &info, parse_options const *opts);
 static void expat_element_start(void *data, const XML_Char *name, const XML_Char **attributes);
 static void expat_data(void *data, const XML_Char *s, int len);
 static void expat_element_end(void *data, const XML_Char *name);
@@ -98,8 +198,66 @@ static void expat_element_end(void *data, const XML_Char *name);
     XML FILE OBJECTS
 ***************************************************************************/
 
-file::file() { }
-file::~file() { }
+file::file()
+	: m_block_ptr(nullptr)
+	, m_block_remaining(0U)
+{
+	m_document = this;
+}
+
+file::~file()
+{
+	// children live in our blocks, so they have to go before the blocks do
+	free_children();
+}
+
+
+/*-------------------------------------------------
+    allocate - get memory for a node or
+    attribute from the document's blocks
+-------------------------------------------------*/
+
+void *file::allocate(std::size_t size)
+{
+	constexpr std::size_t align(alignof(std::max_align_t));
+	size = (size + align - 1) & ~(align - 1);
+
+	// large requests get a block of their own so the current one isn't wasted
+	if (size > (NODE_BLOCK_SIZE / 4))
+	{
+		std::unique_ptr<char []> block(new char [size]);
+		char *const result(block.get());
+		m_blocks.emplace_back(std::move(block));
+		return result;
+	}
+
+	if (size > m_block_remaining)
+	{
+		m_blocks.emplace_back(new char [NODE_BLOCK_SIZE]);
+		m_block_ptr = m_blocks.back().get();
+		m_block_remaining = NODE_BLOCK_SIZE;
+	}
+	char *const result(m_block_ptr);
+	m_block_ptr += size;
+	m_block_remaining -= size;
+	return result;
+}
+
+
+/*-------------------------------------------------
+    intern - get the single lowercase copy of
+    an element or attribute name
+-------------------------------------------------*/
+
+const char *file::intern(const char *name)
+{
+	m_name_buffer.assign(name);
+	std::transform(m_name_buffer.begin(), m_name_buffer.end(), m_name_buffer.begin(), [] (char ch) { return std::tolower(uint8_t(ch)); });
+	auto found(m_names.find(m_name_buffer));
+	if (m_names.end() == found)
+		found = m_names.emplace(m_name_buffer).first;
+	return found->c_str();
+}
 
 
 /*-------------------------------------------------
@@ -119,81 +277,195 @@ file::ptr file::create()
 
 file::ptr file::read(util::core_file &file, parse_options const *opts)
 {
-	parse_info info;
-	int done;
+	/* create a root node */
+	ptr rootnode(create());
+	if (!rootnode)
+		return ptr();
 
-	/* set up the parser */
-	if (!expat_setup_parser(info, opts))
+	/* stream the file into a tree */
+	tree_builder builder(std::move(rootnode), opts ? opts->flags : 0);
+	if (!parse_stream(file, builder, opts))
 		return ptr();
+	return std::move(builder.rootnode());
+}
 
-	/* loop through the file and parse it */
-	do
-	{
-		char tempbuf[TEMP_BUFFER_SIZE];
 
-		/* read as much as we can */
-		int bytes = file.read(tempbuf, sizeof(tempbuf));
-		done = file.eof();
+/*-------------------------------------------------
+    string_read - parse an XML string into its
+    nodes
+-------------------------------------------------*/
 
-		/* parse the data */
-		if (XML_Parse(info.parser, tempbuf, bytes, done) == XML_STATUS_ERROR)
-		{
-			if (opts != nullptr && opts->error != nullptr)
-			{
-				opts->error->error_message = XML_ErrorString(XML_GetErrorCode(info.parser));
-				opts->error->error_line = XML_GetCurrentLineNumber(info.parser);
-				opts->error->error_column = XML_GetCurrentColumnNumber(info.parser);
-			}
+file::ptr file::string_read(const char *string, parse_options const *opts)
+{
+	/* create a root node */
+	ptr rootnode(create());
+	if (!rootnode)
+		return ptr();
 
-			info.rootnode.reset();
-			XML_ParserFree(info.parser);
-			return ptr();
-		}
-	}
-	while (!done);
+	/* stream the string into a tree */
+	tree_builder builder(std::move(rootnode), opts ? opts->flags : 0);
+	if (!parse_string(string, builder, opts))
+		return ptr();
+	return std::move(builder.rootnode());
+}
 
-	/* free the parser */
-	XML_ParserFree(info.parser);
 
-	/* return the root node */
-	return std::move(info.rootnode);
+/*-------------------------------------------------
+    is_binary - check whether data starts like
+    a binary document
+-------------------------------------------------*/
+
+bool file::is_binary(const void *data, std::size_t length)
+{
+	return (length > sizeof(BINARY_MAGIC)) && !std::memcmp(data, BINARY_MAGIC, sizeof(BINARY_MAGIC));
 }
 
 
 /*-------------------------------------------------
-    string_read - parse an XML string into its
-    nodes
+    binary_read - build a tree from a binary
+    document without parsing any text
 -------------------------------------------------*/
 
-file::ptr file::string_read(const char *string, parse_options const *opts)
+file::ptr file::binary_read(const void *data, std::size_t length)
 {
-	parse_info info;
-	int length = (int)strlen(string);
+	if (!is_binary(data, length))
+		return ptr();
+	binary_reader reader(reinterpret_cast<uint8_t const *>(data) + sizeof(BINARY_MAGIC), length - sizeof(BINARY_MAGIC));
+	if (reader.varint() != BINARY_VERSION)
+		return ptr();
 
-	/* set up the parser */
-	if (!expat_setup_parser(info, opts))
+	ptr rootnode(create());
+	if (!rootnode)
 		return ptr();
 
-	/* parse the data */
-	if (XML_Parse(info.parser, string, length, 1) == XML_STATUS_ERROR)
+	try
 	{
-		if (opts != nullptr && opts->error != nullptr)
+		// intern the name table once up front
+		std::vector<char const *> names(reader.varint());
+		std::string name;
+		for (std::size_t i = 0; reader.good() && (names.size() > i); ++i)
 		{
-			opts->error->error_message = XML_ErrorString(XML_GetErrorCode(info.parser));
-			opts->error->error_line = XML_GetCurrentLineNumber(info.parser);
-			opts->error->error_column = XML_GetCurrentColumnNumber(info.parser);
+			std::size_t len;
+			char const *const str(reader.string(len));
+			names[i] = rootnode->intern(name.assign(str, len).c_str());
 		}
 
-		info.rootnode.reset();
-		XML_ParserFree(info.parser);
+		// nodes are written depth-first, with a zero ending each list of children
+		data_node *curnode = rootnode.get();
+		while (reader.good())
+		{
+			uint32_t const tag(reader.varint());
+			if (!tag)
+			{
+				if (curnode == rootnode.get())
+					break;
+				curnode = curnode->get_parent();
+				continue;
+			}
+			if (tag > names.size())
+				return ptr();
+
+			data_node *const newnode = curnode->add_interned_child(names[tag - 1]);
+			newnode->line = int(reader.varint());
+			for (uint32_t attrs = reader.varint(); reader.good() && attrs; --attrs)
+			{
+				uint32_t const attrname(reader.varint());
+				std::size_t len;
+				char const *const value(reader.string(len));
+				if (!attrname || (attrname > names.size()))
+					return ptr();
+				newnode->add_interned_attribute(names[attrname - 1], value, len);
+			}
+			std::size_t len;
+			char const *const value(reader.string(len));
+			newnode->m_value.assign(value, len);
+			curnode = newnode;
+		}
+	}
+	catch (...)
+	{
 		return ptr();
 	}
 
-	/* free the parser */
-	XML_ParserFree(info.parser);
+	if (!reader.good() || !reader.done())
+		return ptr();
+	return rootnode;
+}
+
 
-	/* return the root node */
-	return std::move(info.rootnode);
+/*-------------------------------------------------
+    write_binary - write an XML tree as a
+    binary document
+-------------------------------------------------*/
+
+void file::write_binary(std::vector<uint8_t> &data) const
+{
+	// number the names in the order they're first used
+	std::vector<char const *> names;
+	std::unordered_map<char const *, uint32_t> numbers;
+	auto const number =
+			[&names, &numbers] (char const *name)
+			{
+				auto const ins(numbers.emplace(name, uint32_t(names.size() + 1)));
+				if (ins.second)
+					names.push_back(name);
+				return ins.first->second;
+			};
+	for (data_node const *node = get_first_child(); node; )
+	{
+		number(node->m_name);
+		for (attribute_node const *anode = node->m_first_attribute; anode; anode = anode->next)
+			number(anode->name);
+
+		// depth-first traversal
+		if (node->get_first_child())
+		{
+			node = node->get_first_child();
+		}
+		else
+		{
+			while ((node != this) && !node->get_next_sibling())
+				node = node->get_parent();
+			node = (node != this) ? node->get_next_sibling() : nullptr;
+		}
+	}
+
+	data.insert(data.end(), std::begin(BINARY_MAGIC), std::end(BINARY_MAGIC));
+	write_varint(data, BINARY_VERSION);
+	write_varint(data, uint32_t(names.size()));
+	for (char const *name : names)
+		write_string(data, name, std::strlen(name));
+
+	for (data_node const *node = get_first_child(); node; )
+	{
+		write_varint(data, numbers[node->m_name]);
+		write_varint(data, uint32_t((std::max)(node->line, 0)));
+		write_varint(data, uint32_t(node->count_attributes()));
+		for (attribute_node const *anode = node->m_first_attribute; anode; anode = anode->next)
+		{
+			write_varint(data, numbers[anode->name]);
+			write_string(data, anode->value.c_str(), anode->value.length());
+		}
+		write_string(data, node->m_value.c_str(), node->m_value.length());
+
+		// children follow their parent, and each list of children ends with a zero
+		if (node->get_first_child())
+		{
+			node = node->get_first_child();
+		}
+		else
+		{
+			write_varint(data, 0U);
+			while ((node != this) && !node->get_next_sibling())
+			{
+				node = node->get_parent();
+				if (node != this)
+					write_varint(data, 0U);
+			}
+			node = (node != this) ? node->get_next_sibling() : nullptr;
+		}
+	}
+	write_varint(data, 0U);
 }
 
 
@@ -224,23 +496,28 @@ data_node::data_node()
 	: line(0)
 	, m_next(nullptr)
 	, m_first_child(nullptr)
-	, m_name()
+	, m_last_child(nullptr)
+	, m_name(nullptr)
 	, m_value()
 	, m_parent(nullptr)
-	, m_attributes()
+	, m_document(nullptr)
+	, m_first_attribute(nullptr)
+	, m_last_attribute(nullptr)
 {
 }
 
-data_node::data_node(data_node *parent, const char *name, const char *value)
+data_node::data_node(file &document, data_node *parent, const char *name, const char *value)
 	: line(0)
 	, m_next(nullptr)
 	, m_first_child(nullptr)
+	, m_last_child(nullptr)
 	, m_name(name)
 	, m_value(value ? value : "")
 	, m_parent(parent)
-	, m_attributes()
+	, m_document(&document)
+	, m_first_attribute(nullptr)
+	, m_last_attribute(nullptr)
 {
-	std::transform(m_name.begin(), m_name.end(), m_name.begin(), [] (char ch) { return std::tolower(uint8_t(ch)); });
 }
 
 
@@ -252,6 +529,7 @@ data_node::data_node(data_node *parent, const char *name, const char *value)
 data_node::~data_node()
 {
 	free_children();
+	free_attributes();
 }
 
 
@@ -261,8 +539,32 @@ void data_node::free_children()
 	{
 		/* note the next node and free this node */
 		nchild = m_first_child->get_next_sibling();
-		delete m_first_child;
+		m_first_child->destroy();
+	}
+	m_last_child = nullptr;
+}
+
+
+void data_node::free_attributes()
+{
+	for (attribute_node *nattr = nullptr; m_first_attribute; m_first_attribute = nattr)
+	{
+		nattr = m_first_attribute->next;
+		m_first_attribute->~attribute_node();
 	}
+	m_last_attribute = nullptr;
+}
+
+
+/*-------------------------------------------------
+    destroy - destroy a node that lives in the
+    document's blocks; the memory is reclaimed
+    with the document
+-------------------------------------------------*/
+
+void data_node::destroy()
+{
+	this->~data_node();
 }
 
 
@@ -316,7 +618,10 @@ std::size_t data_node::count_children() const
 
 std::size_t data_node::count_attributes() const
 {
-	return m_attributes.size();
+	std::size_t count = 0;
+	for (attribute_node const *anode = m_first_attribute; anode; anode = anode->next)
+		count++;
+	return count;
 }
 
 
@@ -398,22 +703,41 @@ data_node *data_node::add_child(const char *name, const char *value)
 	if (!name || !*name)
 		return nullptr;
 
-	/* new element: create a new node */
+	/* new element: create a new node in the document's blocks */
 	data_node *node;
-	try { node = new data_node(this, name, value); }
+	try { node = new (m_document->allocate(sizeof(data_node))) data_node(*m_document, this, m_document->intern(name), value); }
 	catch (...) { return nullptr; }
 
-	if (!node->get_name() || (!node->get_value() && value))
+	if (!node->get_value() && value)
 	{
-		delete node;
+		node->destroy();
 		return nullptr;
 	}
 
 	/* add us to the end of the list of siblings */
-	data_node **pnode;
-	for (pnode = &m_first_child; *pnode; pnode = &(*pnode)->m_next) { }
-	*pnode = node;
+	if (m_last_child)
+		m_last_child->m_next = node;
+	else
+		m_first_child = node;
+	m_last_child = node;
+
+	return node;
+}
+
+
+/*-------------------------------------------------
+    add_interned_child - add a child with a name
+    already interned in the document
+-------------------------------------------------*/
 
+data_node *data_node::add_interned_child(const char *name)
+{
+	data_node *const node = new (m_document->allocate(sizeof(data_node))) data_node(*m_document, this, name, nullptr);
+	if (m_last_child)
+		m_last_child->m_next = node;
+	else
+		m_first_child = node;
+	m_last_child = node;
 	return node;
 }
 
@@ -439,14 +763,16 @@ data_node *data_node::get_or_add_child(const char *name, const char *value)
 data_node *data_node::copy_into(data_node &parent) const
 {
 	data_node *const result = parent.add_child(get_name(), get_value());
-	result->m_attributes = m_attributes;
+	for (attribute_node const *anode = m_first_attribute; anode; anode = anode->next)
+		result->add_attribute(anode->name, anode->value.c_str());
 
 	data_node *dst = result;
 	data_node const *src = get_first_child();
 	while (src && (&parent != dst))
 	{
 		dst = dst->add_child(src->get_name(), src->get_value());
-		dst->m_attributes = src->m_attributes;
+		for (attribute_node const *anode = src->m_first_attribute; anode; anode = anode->next)
+			dst->add_attribute(anode->name, anode->value.c_str());
 		data_node const *next = src->get_first_child();
 		if (next)
 		{
@@ -483,17 +809,20 @@ void data_node::delete_node()
 	if (m_parent)
 	{
 		/* first unhook us from the list of children of our parent */
-		for (data_node **pnode = &m_parent->m_first_child; *pnode; pnode = &(*pnode)->m_next)
+		data_node *prev = nullptr;
+		for (data_node **pnode = &m_parent->m_first_child; *pnode; prev = *pnode, pnode = &(*pnode)->m_next)
 		{
 			if (*pnode == this)
 			{
 				*pnode = this->m_next;
+				if (m_parent->m_last_child == this)
+					m_parent->m_last_child = prev;
 				break;
 			}
 		}
 
 		/* now free ourselves and our children */
-		delete this;
+		destroy();
 	}
 	else
 	{
@@ -587,18 +916,18 @@ bool data_node::has_attribute(const char *attribute) const
 data_node::attribute_node *data_node::get_attribute(const char *attribute)
 {
 	/* loop over attributes and find a match */
-	for (attribute_node &anode : m_attributes)
-		if (strcmp(anode.name.c_str(), attribute) == 0)
-			return &anode;
+	for (attribute_node *anode = m_first_attribute; anode; anode = anode->next)
+		if (strcmp(anode->name, attribute) == 0)
+			return anode;
 	return nullptr;
 }
 
 data_node::attribute_node const *data_node::get_attribute(const char *attribute) const
 {
 	/* loop over attributes and find a match */
-	for (attribute_node const &anode : m_attributes)
-		if (strcmp(anode.name.c_str(), attribute) == 0)
-			return &anode;
+	for (attribute_node const *anode = m_first_attribute; anode; anode = anode->next)
+		if (strcmp(anode->name, attribute) == 0)
+			return anode;
 	return nullptr;
 }
 
@@ -789,87 +1118,112 @@ const char *normalize_string(const char *string)
 ***************************************************************************/
 
 /*-------------------------------------------------
-    expat_malloc/expat_realloc/expat_free -
-    wrappers for memory allocation functions so
-    that they pass through out memory tracking
-    systems
+    expat_setup_parser - set up expat for parsing
 -------------------------------------------------*/
 
-static void *expat_malloc(size_t size)
+static XML_Parser expat_setup_parser(parse_info &info, parse_handler &handler, parse_options const *opts)
 {
-	auto *result = (uint32_t *)malloc(size + 4 * sizeof(uint32_t));
-	*result = size;
-	return &result[4];
-}
+	/* setup info structure */
+	info.parser = nullptr;
+	info.handler = &handler;
+	if (opts != nullptr && opts->error != nullptr)
+	{
+		opts->error->error_message = nullptr;
+		opts->error->error_line = 0;
+		opts->error->error_column = 0;
+	}
 
-static void expat_free(void *ptr)
-{
-	if (ptr != nullptr)
-		free(&((uint32_t *)ptr)[-4]);
+	/* create the XML parser */
+	info.parser = XML_ParserCreate(nullptr);
+	if (info.parser == nullptr)
+		return nullptr;
+
+	/* configure the parser */
+	XML_SetElementHandler(info.parser, expat_element_start, expat_element_end);
+	XML_SetCharacterDataHandler(info.parser, expat_data);
+	XML_SetUserData(info.parser, &info);
+
+	/* optional parser initialization step */
+	if (opts != nullptr && opts->init_parser != nullptr)
+		(*opts->init_parser)(info.parser);
+	return info.parser;
 }
 
-static void *expat_realloc(void *ptr, size_t size)
+
+/*-------------------------------------------------
+    expat_report_error - fill in extended error
+    information if requested
+-------------------------------------------------*/
+
+static void expat_report_error(parse_info const &info, parse_options const *opts)
 {
-	void *newptr = expat_malloc(size);
-	if (newptr == nullptr)
-		return nullptr;
-	if (ptr != nullptr)
+	if (opts != nullptr && opts->error != nullptr)
 	{
-		uint32_t oldsize = ((uint32_t *)ptr)[-4];
-		memcpy(newptr, ptr, oldsize);
-		expat_free(ptr);
+		opts->error->error_message = XML_ErrorString(XML_GetErrorCode(info.parser));
+		opts->error->error_line = XML_GetCurrentLineNumber(info.parser);
+		opts->error->error_column = XML_GetCurrentColumnNumber(info.parser);
 	}
-	return newptr;
 }
 
 
 /*-------------------------------------------------
-    expat_setup_parser - set up expat for parsing
+    parse_stream - parse an XML file, passing
+    elements to a handler
 -------------------------------------------------*/
 
-static bool expat_setup_parser(parse_info &info, parse_options const *opts)
+bool parse_stream(util::core_file &file, parse_handler &handler, parse_options const *opts)
 {
-	XML_Memory_Handling_Suite memcallbacks;
+	parse_info info;
+	if (!expat_setup_parser(info, handler, opts))
+		return false;
 
-	/* setup info structure */
-	memset(&info, 0, sizeof(info));
-	if (opts != nullptr)
+	/* read straight into the parser's buffer to avoid copying */
+	bool done;
+	do
 	{
-		info.flags = opts->flags;
-		if (opts->error != nullptr)
+		void *const buffer = XML_GetBuffer(info.parser, TEMP_BUFFER_SIZE);
+		if (buffer == nullptr)
 		{
-			opts->error->error_message = nullptr;
-			opts->error->error_line = 0;
-			opts->error->error_column = 0;
+			expat_report_error(info, opts);
+			XML_ParserFree(info.parser);
+			return false;
+		}
+		int const bytes = file.read(buffer, TEMP_BUFFER_SIZE);
+		done = file.eof();
+		if (XML_ParseBuffer(info.parser, bytes, done) == XML_STATUS_ERROR)
+		{
+			expat_report_error(info, opts);
+			XML_ParserFree(info.parser);
+			return false;
 		}
 	}
+	while (!done);
 
-	/* create a root node */
-	info.rootnode = file::create();
-	if (!info.rootnode)
-		return false;
-	info.curnode = info.rootnode.get();
+	/* free the parser */
+	XML_ParserFree(info.parser);
+	return true;
+}
 
-	/* create the XML parser */
-	memcallbacks.malloc_fcn = expat_malloc;
-	memcallbacks.realloc_fcn = expat_realloc;
-	memcallbacks.free_fcn = expat_free;
-	info.parser = XML_ParserCreate_MM(nullptr, &memcallbacks, nullptr);
-	if (info.parser == nullptr)
-	{
-		info.rootnode.reset();
+
+/*-------------------------------------------------
+    parse_string - parse an XML string, passing
+    elements to a handler
+-------------------------------------------------*/
+
+bool parse_string(const char *string, parse_handler &handler, parse_options const *opts)
+{
+	parse_info info;
+	if (!expat_setup_parser(info, handler, opts))
 		return false;
-	}
 
-	/* configure the parser */
-	XML_SetElementHandler(info.parser, expat_element_start, expat_element_end);
-	XML_SetCharacterDataHandler(info.parser, expat_data);
-	XML_SetUserData(info.parser, &info);
+	/* parse the data */
+	bool const result = XML_Parse(info.parser, string, int(strlen(string)), 1) != XML_STATUS_ERROR;
+	if (!result)
+		expat_report_error(info, opts);
 
-	/* optional parser initialization step */
-	if (opts != nullptr && opts->init_parser != nullptr)
-		(*opts->init_parser)(info.parser);
-	return true;
+	/* free the parser */
+	XML_ParserFree(info.parser);
+	return result;
 }
 
 
@@ -881,56 +1235,87 @@ static bool expat_setup_parser(parse_info &info, parse_options const *opts)
 static void expat_element_start(void *data, const XML_Char *name, const XML_Char **attributes)
 {
 	auto *info = (parse_info *) data;
-	data_node **curnode = &info->curnode;
-	data_node *newnode;
-	int attr;
+	info->handler->start_element(name, attributes, XML_GetCurrentLineNumber(info->parser));
+}
+
+
+/*-------------------------------------------------
+    expat_data - expat callback for an additional
+    element data
+-------------------------------------------------*/
+
+static void expat_data(void *data, const XML_Char *s, int len)
+{
+	auto *info = (parse_info *) data;
+	info->handler->character_data(s, len);
+}
 
+
+/*-------------------------------------------------
+    expat_element_end - expat callback for the end
+    of an element
+-------------------------------------------------*/
+
+static void expat_element_end(void *data, const XML_Char *name)
+{
+	auto *info = (parse_info *) data;
+	info->handler->end_element(name);
+}
+
+
+
+/***************************************************************************
+    TREE BUILDING
+***************************************************************************/
+
+/*-------------------------------------------------
+    start_element - add a new child node to the
+    current node
+-------------------------------------------------*/
+
+void tree_builder::start_element(const char *name, const char **attributes, int line)
+{
 	/* add a new child node to the current node */
-	newnode = (*curnode)->add_child(name, nullptr);
+	data_node *const newnode = m_curnode->add_child(name, nullptr);
 	if (newnode == nullptr)
 		return;
 
 	/* remember the line number */
-	newnode->line = XML_GetCurrentLineNumber(info->parser);
+	newnode->line = line;
 
 	/* add all the attributes as well */
-	for (attr = 0; attributes[attr]; attr += 2)
+	for (int attr = 0; attributes[attr]; attr += 2)
 		newnode->add_attribute(attributes[attr+0], attributes[attr+1]);
 
 	/* set us up as the current node */
-	*curnode = newnode;
+	m_curnode = newnode;
 }
 
 
 /*-------------------------------------------------
-    expat_data - expat callback for an additional
-    element data
+    character_data - add data to the current
+    node's value
 -------------------------------------------------*/
 
-static void expat_data(void *data, const XML_Char *s, int len)
+void tree_builder::character_data(const char *s, int len)
 {
-	auto *info = (parse_info *) data;
-	data_node **curnode = &info->curnode;
-	(*curnode)->append_value(s, len);
+	m_curnode->append_value(s, len);
 }
 
 
 /*-------------------------------------------------
-    expat_element_end - expat callback for the end
-    of an element
+    end_element - finish the current node and
+    back up to its parent
 -------------------------------------------------*/
 
-static void expat_element_end(void *data, const XML_Char *name)
+void tree_builder::end_element(const char *name)
 {
-	auto *info = (parse_info *) data;
-	data_node **curnode = &info->curnode;
-
 	/* strip leading/trailing spaces from the value data */
-	if (!(info->flags & PARSE_FLAG_WHITESPACE_SIGNIFICANT))
-		(*curnode)->trim_whitespace();
+	if (!(m_flags & PARSE_FLAG_WHITESPACE_SIGNIFICANT))
+		m_curnode->trim_whitespace();
 
 	/* back us up a node */
-	*curnode = (*curnode)->get_parent();
+	m_curnode = m_curnode->get_parent();
 }
 
 
@@ -948,8 +1333,12 @@ void data_node::add_attribute(const char *name, const char *value)
 {
 	try
 	{
-		attribute_node &anode = *m_attributes.emplace(m_attributes.end(), name, value);
-		std::transform(anode.name.begin(), anode.name.end(), anode.name.begin(), [] (char ch) { return std::tolower(uint8_t(ch)); });
+		attribute_node *const anode = new (m_document->allocate(sizeof(attribute_node))) attribute_node(m_document->intern(name), value);
+		if (m_last_attribute)
+			m_last_attribute->next = anode;
+		else
+			m_first_attribute = anode;
+		m_last_attribute = anode;
 	}
 	catch (...)
 	{
@@ -959,6 +1348,23 @@ void data_node::add_attribute(const char *name, const char *value)
 
 
 
+/*-------------------------------------------------
+    add_interned_attribute - add an attribute
+    with a name already interned in the document
+-------------------------------------------------*/
+
+void data_node::add_interned_attribute(const char *name, const char *value, std::size_t length)
+{
+	attribute_node *const anode = new (m_document->allocate(sizeof(attribute_node))) attribute_node(name, std::string(value, length));
+	if (m_last_attribute)
+		m_last_attribute->next = anode;
+	else
+		m_first_attribute = anode;
+	m_last_attribute = anode;
+}
+
+
+
 /***************************************************************************
     RECURSIVE TREE OPERATIONS
 ***************************************************************************/
@@ -982,10 +1388,10 @@ void data_node::write_recursive(int indent, util::core_file &file) const
 		file.printf("%*s<%s", indent, "", get_name());
 
 		/* output any attributes, escaping as necessary */
-		for (attribute_node const &anode : m_attributes)
+		for (attribute_node const *anode = m_first_attribute; anode; anode = anode->next)
 		{
-			file.printf(" %s=\"", anode.name);
-			write_escaped(file, anode.value);
+			file.printf(" %s=\"", anode->name);
+			write_escaped(file, anode->value);
 			file.puts("\"");
 		}
 
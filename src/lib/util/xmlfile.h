@@ -16,9 +16,11 @@
 #include "osdcore.h"
 #include "corefile.h"
 
-#include <list>
+#include <memory>
 #include <string>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 
 // forward type declarations
@@ -27,6 +29,8 @@ struct XML_ParserStruct;
 
 namespace util { namespace xml {
 
+class file;
+
 /***************************************************************************
     CONSTANTS
 ***************************************************************************/
@@ -64,6 +68,19 @@ struct parse_options
 };
 
 
+// receives elements as they are parsed, without building a tree
+class parse_handler
+{
+public:
+	virtual ~parse_handler() = default;
+
+	// attributes are name/value pairs terminated by nullptr
+	virtual void start_element(const char *name, const char **attributes, int line) = 0;
+	virtual void character_data(const char *s, int len) = 0;
+	virtual void end_element(const char *name) = 0;
+};
+
+
 // a node representing a data item and its relationships
 class data_node
 {
@@ -79,7 +96,7 @@ public:
 
 	/* ----- XML node management ----- */
 
-	char const *get_name() const { return m_name.empty() ? nullptr : m_name.c_str(); }
+	char const *get_name() const { return m_name; }
 
 	char const *get_value() const { return m_value.empty() ? nullptr : m_value.c_str(); }
 	void set_value(char const *value);
@@ -169,20 +186,27 @@ protected:
 	~data_node();
 
 	void write_recursive(int indent, util::core_file &file) const;
+	void free_children();
 
 
 private:
-	// a node representing an attribute
+	friend class file;
+
+	// a node representing an attribute; names are interned in the document
 	struct attribute_node
 	{
-		template <typename T, typename U> attribute_node(T &&name, U &&value) : name(std::forward<T>(name)), value(std::forward<U>(value)) { }
+		template <typename T> attribute_node(const char *name, T &&value) : next(nullptr), name(name), value(std::forward<T>(value)) { }
 
-		std::string name;
-		std::string value;
+		attribute_node *    next;
+		const char *        name;
+		std::string         value;
 	};
 
 
-	data_node(data_node *parent, const char *name, const char *value);
+	data_node(file &document, data_node *parent, const char *name, const char *value);
+
+	data_node *add_interned_child(const char *name);
+	void add_interned_attribute(const char *name, const char *value, std::size_t length);
 
 	data_node(data_node const &) = delete;
 	data_node(data_node &&) = delete;
@@ -197,15 +221,19 @@ private:
 	attribute_node *get_attribute(const char *attribute);
 	attribute_node const *get_attribute(const char *attribute) const;
 
-	void free_children();
+	void free_attributes();
+	void destroy();
 
 
 	data_node *                 m_next;
 	data_node *                 m_first_child;
-	std::string                 m_name;
+	data_node *                 m_last_child;
+	const char *                m_name;         // interned in the document, nullptr for the root
 	std::string                 m_value;
 	data_node *                 m_parent;
-	std::list<attribute_node>   m_attributes;
+	file *                      m_document;
+	attribute_node *            m_first_attribute;
+	attribute_node *            m_last_attribute;
 };
 
 
@@ -230,9 +258,29 @@ public:
 	// write an XML tree to a file
 	void write(util::core_file &file) const;
 
+	// check for and read a document written by write_binary
+	static bool is_binary(const void *data, std::size_t length);
+	static ptr binary_read(const void *data, std::size_t length);
+
+	// write an XML tree in a form that can be read back without parsing
+	void write_binary(std::vector<uint8_t> &data) const;
+
 
 private:
+	friend class data_node;
+
 	file();
+
+	// nodes and attributes live in blocks owned by the document and are
+	// only released with it; names are lowercased and stored once
+	void *allocate(std::size_t size);
+	const char *intern(const char *name);
+
+	std::vector<std::unique_ptr<char []> >  m_blocks;
+	char *                                  m_block_ptr;
+	std::size_t                             m_block_remaining;
+	std::unordered_set<std::string>         m_names;
+	std::string                             m_name_buffer;
 };
 
 
@@ -241,6 +289,15 @@ private:
     FUNCTION PROTOTYPES
 ***************************************************************************/
 
+/* ----- streaming interfaces ----- */
+
+/* parse an XML file, passing elements to a handler without building a tree */
+bool parse_stream(util::core_file &file, parse_handler &handler, parse_options const *opts);
+
+/* parse an XML string, passing elements to a handler without building a tree */
+bool parse_string(const char *string, parse_handler &handler, parse_options const *opts);
+
+
 /* ----- miscellaneous interfaces ----- */
 
 /* normalize a string into something that can be written to an XML file */
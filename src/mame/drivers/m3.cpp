@@ -31,7 +31,7 @@ public:
 	void m3(machine_config &config);
 
 private:
-	MC6845_UPDATE_ROW(crtc_update_row);
+	MC6845_UPDATE_FRAME(crtc_update_frame);
 
 	void io_map(address_map &map);
 	void mem_map(address_map &map);
@@ -60,35 +60,42 @@ void m3_state::io_map(address_map &map)
 static INPUT_PORTS_START( m3 )
 INPUT_PORTS_END
 
-MC6845_UPDATE_ROW( m3_state::crtc_update_row )
+MC6845_UPDATE_FRAME( m3_state::crtc_update_frame )
 {
 	const rgb_t *pens = m_palette->palette()->entry_list_raw();
-	uint8_t chr,gfx,inv;
-	uint16_t mem,x;
-	uint32_t *p = &bitmap.pix32(y);
+	uint8_t chr[256], inv[256];
+	int row_ma = -1;
 
-	for (x = 0; x < x_count; x++)
+	for (const mc6845_device::scanline_info &line : frame.lines)
 	{
-		inv = (x == cursor_x) ? 0xff : 0;
-		mem = (ma + x) & 0x7ff;
-		chr = m_p_videoram[mem];
-		if (BIT(chr, 7))
+		uint32_t *p = &bitmap.pix32(line.y);
+
+		// the characters only change when a new row starts
+		if (line.ma != row_ma)
 		{
-			inv ^= 0xff;
-			chr &= 0x7f;
+			row_ma = line.ma;
+			for (uint16_t x = 0; x < frame.x_count; x++)
+			{
+				chr[x] = m_p_videoram[(row_ma + x) & 0x7ff];
+				inv[x] = BIT(chr[x], 7) ? 0xff : 0;
+				chr[x] &= 0x7f;
+			}
 		}
 
-		/* get pattern of pixels for that character scanline */
-		gfx = m_p_chargen[(chr<<4) | ra] ^ inv;
-
-		/* Display a scanline of a character (8 pixels) */
-		*p++ = pens[BIT(gfx, 6)];
-		*p++ = pens[BIT(gfx, 5)];
-		*p++ = pens[BIT(gfx, 4)];
-		*p++ = pens[BIT(gfx, 3)];
-		*p++ = pens[BIT(gfx, 2)];
-		*p++ = pens[BIT(gfx, 1)];
-		*p++ = pens[BIT(gfx, 0)];
+		for (uint16_t x = 0; x < frame.x_count; x++)
+		{
+			/* get pattern of pixels for that character scanline */
+			uint8_t gfx = m_p_chargen[(chr[x]<<4) | line.ra] ^ inv[x] ^ ((x == line.cursor_x) ? 0xff : 0);
+
+			/* Display a scanline of a character (8 pixels) */
+			*p++ = pens[BIT(gfx, 6)];
+			*p++ = pens[BIT(gfx, 5)];
+			*p++ = pens[BIT(gfx, 4)];
+			*p++ = pens[BIT(gfx, 3)];
+			*p++ = pens[BIT(gfx, 2)];
+			*p++ = pens[BIT(gfx, 1)];
+			*p++ = pens[BIT(gfx, 0)];
+		}
 	}
 }
 
@@ -136,7 +143,7 @@ void m3_state::m3(machine_config &config)
 	crtc.set_screen("screen");
 	crtc.set_show_border_area(false);
 	crtc.set_char_width(7);
-	crtc.set_update_row_callback(FUNC(m3_state::crtc_update_row));
+	crtc.set_update_frame_callback(FUNC(m3_state::crtc_update_frame));
 }
 
 ROM_START( m3 )
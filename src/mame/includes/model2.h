@@ -627,7 +627,7 @@ public:
 
 public:
 	model2_renderer(model2_state& state)
-		: poly_manager<float, m2_poly_extra_data, 4, 0x10000>(state.machine())
+		: poly_manager<float, m2_poly_extra_data, 4, 0x10000>(state.machine(), FLAG_BINNED)
 		, m_state(state)
 		, m_destmap(512, 512)
 	{
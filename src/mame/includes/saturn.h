@@ -105,6 +105,8 @@ protected:
 
 		int       local_x;
 		int       local_y;
+		int       draw_local_x;     // local co-ordinates of the command being drawn
+		int       draw_local_y;
 	}m_vdp1;
 
 	struct {
@@ -212,6 +214,12 @@ protected:
 	void stv_clear_framebuffer( int which_framebuffer );
 	void stv_vdp1_state_save_postload( void );
 	int stv_vdp1_start ( void );
+	void stv_vdp1_exit( void );
+
+	/* VDP1 command list drawing, done on a worker */
+	void stv_vdp1_draw_commands( void );
+	static void *stv_vdp1_draw_static(void *param, int threadid);
+	void stv_vdp1_sync( void );
 
 	struct stv_vdp1_poly_scanline
 	{
@@ -244,6 +252,17 @@ protected:
 
 	} stv2_current_sprite;
 
+	struct stv_vdp1_queued_command
+	{
+		stv_vdp2_sprite_list sprite;
+		rectangle cliprect;
+		int local_x, local_y;
+	};
+
+	std::vector<stv_vdp1_queued_command> m_vdp1_commands; // drawing commands of the current list
+	osd_work_queue *m_vdp1_queue;
+	bool m_vdp1_drawing;                                  // worker may still be drawing m_vdp1_commands
+
 	/* Gouraud shading */
 
 	struct _stv_gouraud_shading
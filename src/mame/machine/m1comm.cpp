@@ -145,22 +145,11 @@ m1comm_device::m1comm_device(const machine_config &mconfig, const char *tag, dev
 	m_cpu(*this, Z80_TAG),
 	m_dma(*this, "commdma"),
 	m_dlc(*this, "commdlc")
+#ifdef M1COMM_SIMULATION
+	, m_link(*this, "M1COMM")
+#endif
 {
 #ifdef M1COMM_SIMULATION
-	// prepare localhost "filename"
-	m_localhost[0] = 0;
-	strcat(m_localhost, "socket.");
-	strcat(m_localhost, mconfig.options().comm_localhost());
-	strcat(m_localhost, ":");
-	strcat(m_localhost, mconfig.options().comm_localport());
-
-	// prepare remotehost "filename"
-	m_remotehost[0] = 0;
-	strcat(m_remotehost, "socket.");
-	strcat(m_remotehost, mconfig.options().comm_remotehost());
-	strcat(m_remotehost, ":");
-	strcat(m_remotehost, mconfig.options().comm_remoteport());
-
 	m_framesync = mconfig.options().comm_framesync() ? 0x01 : 0x00;
 #endif
 }
@@ -307,6 +296,7 @@ void m1comm_device::check_vint_irq()
 	}
 #else
 	comm_tick();
+	m_link.flush();
 #endif
 }
 
@@ -337,24 +327,8 @@ void m1comm_device::comm_tick()
 			// link not yet established...
 			m_shared[0] = 0x05;
 
-			// check rx socket
-			if (!m_line_rx)
-			{
-				osd_printf_verbose("M1COMM: listen on %s\n", m_localhost);
-				uint64_t filesize; // unused
-				osd_file::open(m_localhost, OPEN_FLAG_CREATE, m_line_rx, filesize);
-			}
-
-			// check tx socket
-			if (!m_line_tx)
-			{
-				osd_printf_verbose("M1COMM: connect to %s\n", m_remotehost);
-				uint64_t filesize; // unused
-				osd_file::open(m_remotehost, 0, m_line_tx, filesize);
-			}
-
 			// if both sockets are there check ring
-			if (m_line_rx && m_line_tx)
+			if (m_link.connect())
 			{
 				// try to read one message
 				recv = read_frame(dataSize);
@@ -555,52 +529,18 @@ void m1comm_device::comm_tick()
 
 int m1comm_device::read_frame(int dataSize)
 {
-	if (!m_line_rx)
-		return 0;
-
 	// try to read a message
-	std::uint32_t recv = 0;
-	osd_file::error filerr = m_line_rx->read(m_buffer0, 0, dataSize, recv);
-	if (recv > 0)
-	{
-		// check if message complete
-		if (recv != dataSize)
-		{
-			// only part of a message - read on
-			std::uint32_t togo = dataSize - recv;
-			int offset = recv;
-			while (togo > 0)
-			{
-				filerr = m_line_rx->read(m_buffer1, 0, togo, recv);
-				if (recv > 0)
-				{
-					for (int i = 0 ; i < recv ; i++)
-					{
-						m_buffer0[offset + i] = m_buffer1[i];
-					}
-					togo -= recv;
-					offset += recv;
-				}
-				else if (filerr == osd_file::error::NONE && recv == 0)
-				{
-					togo = 0;
-				}
-			}
-		}
-	}
-	else if (filerr == osd_file::error::NONE && recv == 0)
+	int const recv = m_link.receive(m_buffer0, dataSize);
+	if (recv < 0)
 	{
 		if (m_linkalive == 0x01)
 		{
 			osd_printf_verbose("M1COMM: rx connection lost\n");
 			m_linkalive = 0x02;
 			m_linktimer = 0x00;
-
 			m_shared[0] = 0xff;
-
-			m_line_rx.reset();
-			m_line_tx.reset();
 		}
+		return 0;
 	}
 	return recv;
 }
@@ -615,26 +555,16 @@ void m1comm_device::send_data(uint8_t frameType, int frameStart, int frameSize,
 	send_frame(dataSize);
 }
 
-void m1comm_device::send_frame(int dataSize){
-	if (!m_line_tx)
-		return;
-
-	osd_file::error filerr;
-	std::uint32_t written;
-
-	filerr = m_line_tx->write(&m_buffer0, 0, dataSize, written);
-	if (filerr != osd_file::error::NONE)
+void m1comm_device::send_frame(int dataSize)
+{
+	if (!m_link.send(m_buffer0, dataSize))
 	{
 		if (m_linkalive == 0x01)
 		{
 			osd_printf_verbose("M1COMM: tx connection lost\n");
 			m_linkalive = 0x02;
 			m_linktimer = 0x00;
-
 			m_shared[0] = 0xff;
-
-			m_line_rx.reset();
-			m_line_tx.reset();
 		}
 	}
 }
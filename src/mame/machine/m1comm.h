@@ -7,7 +7,7 @@
 
 #define M1COMM_SIMULATION
 
-#include "osdcore.h"
+#include "commlink.h"
 #include "cpu/z80/z80.h"
 #include "machine/am9517a.h"
 #include "machine/mb89374.h"
@@ -85,12 +85,8 @@ private:
 	uint8_t m_fg;             // flip gate, bit0 is stored, bit7 is connected to ZFG bit 0
 
 #ifdef M1COMM_SIMULATION
-	osd_file::ptr m_line_rx;  // rx line - can be either differential, simple serial or toslink
-	osd_file::ptr m_line_tx;  // tx line - is differential, simple serial and toslink
-	char m_localhost[256];
-	char m_remotehost[256];
+	comm_link m_link;         // ring to the other cabinets
 	uint8_t m_buffer0[0x200];
-	uint8_t m_buffer1[0x200];
 	uint8_t m_framesync;
 
 	uint8_t m_linkenable;
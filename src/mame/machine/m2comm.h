@@ -7,7 +7,7 @@
 
 #define M2COMM_SIMULATION
 
-#include "osdcore.h"
+#include "commlink.h"
 
 //**************************************************************************
 //  TYPE DEFINITIONS
@@ -56,12 +56,8 @@ private:
 	uint8_t m_cn;             // bit0 is used to enable/disable the comm board
 	uint8_t m_fg;             // i960 flip gate - bit0 is stored, bit7 is connected to ZFG bit 0
 
-	osd_file::ptr m_line_rx;  // rx line - can be either differential, simple serial or toslink
-	osd_file::ptr m_line_tx;  // tx line - is differential, simple serial and toslink
-	char m_localhost[256];
-	char m_remotehost[256];
+	comm_link m_link;         // ring to the other cabinets
 	uint8_t m_buffer0[0x1000];
-	uint8_t m_buffer1[0x1000];
 	uint8_t m_framesync;
 	uint16_t m_frameoffset;
 
@@ -97,22 +97,9 @@ void s32comm_device::device_add_mconfig(machine_config &config)
 //-------------------------------------------------
 
 s32comm_device::s32comm_device(const machine_config &mconfig, const char *tag, device_t *owner, uint32_t clock) :
-	device_t(mconfig, S32COMM, tag, owner, clock)
+	device_t(mconfig, S32COMM, tag, owner, clock),
+	m_link(*this, "S32COMM")
 {
-	// prepare localhost "filename"
-	m_localhost[0] = 0;
-	strcat(m_localhost, "socket.");
-	strcat(m_localhost, mconfig.options().comm_localhost());
-	strcat(m_localhost, ":");
-	strcat(m_localhost, mconfig.options().comm_localport());
-
-	// prepare remotehost "filename"
-	m_remotehost[0] = 0;
-	strcat(m_remotehost, "socket.");
-	strcat(m_remotehost, mconfig.options().comm_remotehost());
-	strcat(m_remotehost, ":");
-	strcat(m_remotehost, mconfig.options().comm_remoteport());
-
 	m_framesync = mconfig.options().comm_framesync() ? 0x01 : 0x00;
 }
 
@@ -257,52 +244,22 @@ void s32comm_device::comm_tick()
 			comm_tick_15612();
 			break;
 	}
+	m_link.flush();
 }
 
 int s32comm_device::read_frame(int dataSize)
 {
-	if (!m_line_rx)
-		return 0;
-
 	// try to read a message
-	std::uint32_t recv = 0;
-	osd_file::error filerr = m_line_rx->read(m_buffer0, 0, dataSize, recv);
-	if (recv > 0)
-	{
-		// check if message complete
-		if (recv != dataSize)
-		{
-			// only part of a message - read on
-			std::uint32_t togo = dataSize - recv;
-			int offset = recv;
-			while (togo > 0)
-			{
-				filerr = m_line_rx->read(m_buffer1, 0, togo, recv);
-				if (recv > 0)
-				{
-					for (int i = 0 ; i < recv ; i++)
-					{
-						m_buffer0[offset + i] = m_buffer1[i];
-					}
-					togo -= recv;
-					offset += recv;
-				}
-				else if (filerr == osd_file::error::NONE && recv == 0)
-				{
-					togo = 0;
-				}
-			}
-		}
-	}
-	else if (filerr == osd_file::error::NONE && recv == 0)
+	int const recv = m_link.receive(m_buffer0, dataSize);
+	if (recv < 0)
 	{
 		if (m_linkalive == 0x01)
 		{
 			osd_printf_verbose("S32COMM: rx connection lost\n");
 			m_linkalive = 0x02;
 			m_linktimer = 0x00;
-			m_line_rx.reset();
 		}
+		return 0;
 	}
 	return recv;
 }
@@ -318,22 +275,15 @@ void s32comm_device::send_data(uint8_t frameType, int frameStart, int frameSize,
 	send_frame(dataSize);
 }
 
-void s32comm_device::send_frame(int dataSize){
-	if (!m_line_tx)
-		return;
-
-	osd_file::error filerr;
-	std::uint32_t written;
-
-	filerr = m_line_tx->write(&m_buffer0, 0, dataSize, written);
-	if (filerr != osd_file::error::NONE)
+void s32comm_device::send_frame(int dataSize)
+{
+	if (!m_link.send(m_buffer0, dataSize))
 	{
 		if (m_linkalive == 0x01)
 		{
 			osd_printf_verbose("S32COMM: tx connection lost\n");
 			m_linkalive = 0x02;
 			m_linktimer = 0x00;
-			m_line_tx.reset();
 		}
 	}
 }
@@ -368,24 +318,8 @@ void s32comm_device::comm_tick_14084()
 			// link not yet established...
 			m_shared[4] = 0x00;
 
-			// check rx socket
-			if (!m_line_rx)
-			{
-				osd_printf_verbose("S32COMM: listen on %s\n", m_localhost);
-				uint64_t filesize; // unused
-				osd_file::open(m_localhost, OPEN_FLAG_CREATE, m_line_rx, filesize);
-			}
-
-			// check tx socket
-			if (!m_line_tx)
-			{
-				osd_printf_verbose("S32COMM: connect to %s\n", m_remotehost);
-				uint64_t filesize; // unused
-				osd_file::open(m_remotehost, 0, m_line_tx, filesize);
-			}
-
 			// if both sockets are there check ring
-			if (m_line_rx && m_line_tx)
+			if (m_link.connect())
 			{
 				// try to read one message
 				recv = read_frame(dataSize);
@@ -625,24 +559,8 @@ void s32comm_device::comm_tick_15033()
 			// waiting...
 			m_shared[4] = 0x00;
 
-			// check rx socket
-			if (!m_line_rx)
-			{
-				osd_printf_verbose("S32COMM: listen on %s\n", m_localhost);
-				uint64_t filesize; // unused
-				osd_file::open(m_localhost, OPEN_FLAG_CREATE, m_line_rx, filesize);
-			}
-
-			// check tx socket
-			if (!m_line_tx)
-			{
-				osd_printf_verbose("S32COMM: connect to %s\n", m_remotehost);
-				uint64_t filesize; // unused
-				osd_file::open(m_remotehost, 0, m_line_tx, filesize);
-			}
-
 			// if both sockets are there check ring
-			if (m_line_rx && m_line_tx)
+			if (m_link.connect())
 			{
 				// try to read one messages
 				recv = read_frame(dataSize);
@@ -868,24 +786,8 @@ void s32comm_device::comm_tick_15612()
 			// link not yet established...
 			m_shared[0] = 0x05;
 
-			// check rx socket
-			if (!m_line_rx)
-			{
-				osd_printf_verbose("S32COMM: listen on %s\n", m_localhost);
-				uint64_t filesize; // unused
-				osd_file::open(m_localhost, OPEN_FLAG_CREATE, m_line_rx, filesize);
-			}
-
-			// check tx socket
-			if (!m_line_tx)
-			{
-				osd_printf_verbose("S32COMM: connect to %s\n", m_remotehost);
-				uint64_t filesize; // unused
-				osd_file::open(m_remotehost, 0, m_line_tx, filesize);
-			}
-
 			// if both sockets are there check ring
-			if (m_line_rx && m_line_tx)
+			if (m_link.connect())
 			{
 				// try to read one message
 				recv = read_frame(dataSize);
@@ -364,6 +364,7 @@ WRITE_LINE_MEMBER( saturn_state::system_reset_w )
 	memset(m_vdp2_regs.get(),0x00,0x040000);
 	memset(m_vdp2_vram.get(),0x00,0x100000);
 	memset(m_vdp2_cram.get(),0x00,0x080000);
+	stv_vdp1_sync();
 	memset(m_vdp1_vram.get(),0x00,0x100000);
 	//A-Bus
 }
@@ -150,6 +150,8 @@ uint32_t n64_state::screen_update_n64(screen_device &screen, bitmap_rgb32 &bitma
 	}
 	*/
 
+	// the VI scans out of RDRAM, so everything drawn so far has to land first
+	m_rdp->sync_render("VI scanout");
 	m_rdp->mark_frame();
 
 	if (m_rcp_periphs->vi_blank)
@@ -1961,6 +1963,12 @@ void n64_rdp::draw_triangle(bool shade, bool texture, bool zbuffer, bool rect)
 	memset(spans, 0xcc, sizeof(spans));
 #endif
 
+	// span userdata stays live until the spans are drawn, so reclaim the buffer only once they have been
+	if (m_aux_buf_ptr + ARRAY_LENGTH(spans) * sizeof(rdp_span_aux) > EXTENT_AUX_COUNT)
+	{
+		sync_render("span aux buffer full");
+	}
+
 	m_span_base.m_span_drdy = drdy;
 	m_span_base.m_span_dgdy = dgdy;
 	m_span_base.m_span_dbdy = dbdy;
@@ -2194,7 +2202,6 @@ void n64_rdp::draw_triangle(bool shade, bool texture, bool zbuffer, bool rect)
 	{
 		render_spans(yh >> 2, yl >> 2, tilenum, flip ? true : false, spans, rect, object);
 	}
-	m_aux_buf_ptr = 0;  // Spans can be reused once render completes
 	//wait("draw_triangle");
 }
 
@@ -2354,7 +2361,8 @@ void n64_rdp::cmd_sync_tile(uint64_t w1)
 
 void n64_rdp::cmd_sync_full(uint64_t w1)
 {
-	//wait("SyncFull");
+	// the CPU is free to read anything the RDP has drawn once it sees the full sync
+	sync_render("SyncFull");
 	m_n64_periphs->dp_full_sync();
 }
 
@@ -2468,6 +2476,11 @@ void n64_rdp::cmd_load_tlut(uint64_t w1)
 		fatalerror("Load tlut: tl=%d, th=%d\n",tl,th);
 	}
 
+	if (pending_overlap(m_misc_state.m_ti_address & 0x007fffff, ((((th >> 2) + 1) * m_misc_state.m_ti_width) << m_misc_state.m_ti_size) >> 1))
+	{
+		sync_render("LoadTLUT");
+	}
+
 	m_capture.data_begin();
 
 	const int32_t count = ((sh >> 2) - (sl >> 2) + 1) << 2;
@@ -2557,6 +2570,11 @@ void n64_rdp::cmd_load_block(uint64_t w1)
 
 	const uint32_t src = (m_misc_state.m_ti_address >> 1) + (tl * tiwinwords) + slinwords;
 
+	if (pending_overlap(m_misc_state.m_ti_address & 0x007fffff, (((tl * tiwinwords) + slinwords) << 1) + (width << 3)))
+	{
+		sync_render("LoadBlock");
+	}
+
 	m_capture.data_begin();
 
 	if (dxt != 0)
@@ -2753,6 +2771,11 @@ void n64_rdp::cmd_load_tile(uint64_t w1)
     topad = 0; // ????
 */
 
+	if (pending_overlap(m_misc_state.m_ti_address & 0x007fffff, (((th + 1) * m_misc_state.m_ti_width) << m_misc_state.m_ti_size) >> 1))
+	{
+		sync_render("LoadTile");
+	}
+
 	m_capture.data_begin();
 
 	switch (m_misc_state.m_ti_size)
@@ -3151,6 +3174,8 @@ n64_rdp::n64_rdp(n64_state &state, uint32_t* rdram, uint32_t* dmem) : poly_manag
 	m_aux_buf_ptr = 0;
 	m_aux_buf = nullptr;
 	m_pipe_clean = true;
+	m_pending_start = 0;
+	m_pending_end = 0;
 
 	m_pending_mode_block = false;
 
@@ -3260,6 +3285,15 @@ void n64_rdp::render_spans(int32_t start, int32_t end, int32_t tilenum, bool fli
 	object->m_fill_color = m_fill_color;
 	object->rect = rect;
 
+	// note what the spans may write, so that texture loads from it wait for them
+	const uint32_t rows = uint32_t(end) + 1;
+	add_pending_range(m_misc_state.m_fb_address & 0x007fffff, ((m_misc_state.m_fb_width * rows) << m_misc_state.m_fb_size) >> 1);
+	if (m_other_modes.z_update_en)
+	{
+		add_pending_range(m_misc_state.m_zb_address & 0x007fffff, m_misc_state.m_fb_width * rows * 2);
+	}
+	m_pipe_clean = false;
+
 	switch(m_other_modes.cycle_type)
 	{
 		case CYCLE_TYPE_1:
@@ -3278,7 +3312,36 @@ void n64_rdp::render_spans(int32_t start, int32_t end, int32_t tilenum, bool fli
 			render_triangle_custom(clip, render_delegate(&n64_rdp::span_draw_fill, this), start, (end - start) + 1, spans + offset);
 			break;
 	}
-	wait("render spans");
+}
+
+void n64_rdp::add_pending_range(uint32_t start, uint32_t length)
+{
+	if (m_pipe_clean)
+	{
+		m_pending_start = start;
+		m_pending_end = start + length;
+	}
+	else
+	{
+		m_pending_start = std::min(m_pending_start, start);
+		m_pending_end = std::max(m_pending_end, start + length);
+	}
+}
+
+bool n64_rdp::pending_overlap(uint32_t start, uint32_t length) const
+{
+	return !m_pipe_clean && start < m_pending_end && (start + length) > m_pending_start;
+}
+
+void n64_rdp::sync_render(const char *reason)
+{
+	// block until every queued span has been drawn, after which their userdata can be reused
+	if (!m_pipe_clean)
+	{
+		wait(reason);
+		m_pipe_clean = true;
+	}
+	m_aux_buf_ptr = 0;
 }
 
 void n64_rdp::rgbaz_clip(int32_t sr, int32_t sg, int32_t sb, int32_t sa, int32_t* sz, rdp_span_aux* userdata)
@@ -163,6 +163,7 @@ public:
 	}
 
 	void        process_command_list();
+	void        sync_render(const char *reason);
 	uint64_t      read_data(uint32_t address);
 	void        disassemble(char* buffer);
 
@@ -314,6 +315,12 @@ public:
 	uint32_t          m_aux_buf_ptr;
 	uint32_t          m_aux_buf_index;
 
+	// RDRAM range that queued spans may still write, valid while !m_pipe_clean
+	uint32_t          m_pending_start;
+	uint32_t          m_pending_end;
+	bool            pending_overlap(uint32_t start, uint32_t length) const;
+	void            add_pending_range(uint32_t start, uint32_t length);
+
 	bool            rdp_range_check(uint32_t addr);
 
 	n64_tile_t      m_tiles[8];
@@ -232,6 +232,14 @@ void mac_osd_interface::extract_video_config()
 		video_config.syncrefresh = 0;
 	}
 
+	video_config.vrr           = options().vrr();
+	if (video_config.vrr)
+	{
+		// the display waits for each frame, so vsync no longer holds us to a fixed rate
+		video_config.waitvsync = 1;
+		video_config.syncrefresh = 0;
+	}
+
 	if (video_config.prescale < 1 || video_config.prescale > 8)
 	{
 		osd_printf_warning("Invalid prescale option, reverting to '1'\n");
@@ -521,7 +521,7 @@ void mac_window_info::update()
 				if( video_config.perftest )
 					measure_fps(update);
 				else
-					renderer().draw(update);
+					draw_and_present(update);
 			}
 
 			/* all done, ready for next */
@@ -656,7 +656,7 @@ void mac_window_info::measure_fps(int update)
 
 	t0 = osd_ticks();
 
-	renderer().draw(update);
+	draw_and_present(update);
 
 	frames++;
 	currentTime = osd_ticks();
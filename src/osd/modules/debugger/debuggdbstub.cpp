@@ -318,6 +318,7 @@ public:
 		m_extended_mode(false),
 		m_send_stop_packet(false),
 		m_target_xml_sent(false),
+		m_no_ack(false),
 		m_triggered_breakpoint(nullptr),
 		m_triggered_watchpoint(nullptr),
 		m_readbuf_len(0),
@@ -374,10 +375,15 @@ public:
 	cmd_reply handle_p(const char *buf);
 	cmd_reply handle_P(const char *buf);
 	cmd_reply handle_q(const char *buf);
+	cmd_reply handle_Q(const char *buf);
 	cmd_reply handle_s(const char *buf);
+	cmd_reply handle_v(const char *buf);
+	cmd_reply handle_X(const char *buf);
 	cmd_reply handle_z(const char *buf);
 	cmd_reply handle_Z(const char *buf);
 
+	void read_memory(offs_t offset, uint8_t *data, size_t length);
+
 	enum readbuf_state
 	{
 		PACKET_START,
@@ -411,6 +417,7 @@ private:
 	bool m_extended_mode;
 	bool m_send_stop_packet;
 	bool m_target_xml_sent;     // the 'g', 'G', 'p', and 'P' commands only work once target.xml has been sent
+	bool m_no_ack;              // QStartNoAckMode: packets are no longer acknowledged
 
 	struct gdb_register
 	{
@@ -637,13 +644,15 @@ void debug_gdbstub::debugger_update()
 //-------------------------------------------------------------------------
 void debug_gdbstub::send_nack()
 {
-	m_socket.puts("-");
+	if ( !m_no_ack )
+		m_socket.puts("-");
 }
 
 //-------------------------------------------------------------------------
 void debug_gdbstub::send_ack()
 {
-	m_socket.puts("+");
+	if ( !m_no_ack )
+		m_socket.puts("+");
 }
 
 //-------------------------------------------------------------------------
@@ -772,21 +781,52 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_m(const char *buf)
 	if ( !m_memory->translate(m_address_space->spacenum(), TRANSLATE_READ_DEBUG, offset) )
 		return REPLY_ENN;
 
-	// Disable side effects while reading memory.
-	auto dis = m_machine->disable_side_effects();
+	// The reply can't be larger than the packet size we advertised.
+	length = std::min<uint64_t>(length, MAX_PACKET_SIZE / 2);
 
+	std::vector<uint8_t> data(length);
+	read_memory(offset, &data[0], length);
+
+	static const char hex_digits[] = "0123456789abcdef";
 	std::string reply;
 	reply.reserve(length * 2);
-	for ( int i = 0; i < length; i++ )
+	for ( uint8_t value: data )
 	{
-		uint8_t value = m_address_space->read_byte(offset + i);
-		reply += string_format("%02x", value);
+		reply += hex_digits[value >> 4];
+		reply += hex_digits[value & 0x0f];
 	}
 	send_reply(reply.c_str());
 
 	return REPLY_NONE;
 }
 
+//-------------------------------------------------------------------------
+void debug_gdbstub::read_memory(offs_t offset, uint8_t *data, size_t length)
+{
+	// Disable side effects while reading memory.
+	auto dis = m_machine->disable_side_effects();
+
+	// On wide byte-addressed buses, read whole bus words for the aligned
+	// part of the range rather than dispatching once per byte.
+	size_t const bytes = m_address_space->data_width() / 8;
+	size_t i = 0;
+	if ( m_address_space->addr_shift() == 0 && bytes > 1 )
+	{
+		for ( ; i < length && ((offset + i) & (bytes - 1)) != 0; i++ )
+			data[i] = m_address_space->read_byte(offset + i);
+		for ( ; length - i >= bytes; i += bytes )
+		{
+			uint64_t value = (bytes == 8) ? m_address_space->read_qword(offset + i)
+						   : (bytes == 4) ? m_address_space->read_dword(offset + i)
+						   :                m_address_space->read_word(offset + i);
+			for ( size_t b = 0; b < bytes; b++ )
+				data[i + b] = value >> (8 * (m_is_be ? (bytes - 1 - b) : b));
+		}
+	}
+	for ( ; i < length; i++ )
+		data[i] = m_address_space->read_byte(offset + i);
+}
+
 //-------------------------------------------------------------------------
 static bool hex_decode(std::vector<uint8_t> *_data, const char *buf, size_t length)
 {
@@ -827,6 +867,46 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_M(const char *buf)
 	return REPLY_OK;
 }
 
+//-------------------------------------------------------------------------
+// Write memory, binary data.
+debug_gdbstub::cmd_reply debug_gdbstub::handle_X(const char *buf)
+{
+	uint64_t address;
+	uint64_t length;
+	int buf_offset;
+	if ( sscanf(buf, "%" PRIx64 ",%" PRIx64 ":%n", &address, &length, &buf_offset) != 2 || length > MAX_PACKET_SIZE )
+		return REPLY_ENN;
+
+	offs_t offset = address;
+	if ( !m_memory->translate(m_address_space->spacenum(), TRANSLATE_READ_DEBUG, offset) )
+		return REPLY_ENN;
+
+	// The data may contain NULs, so go by the packet length rather than
+	// the terminator; '}' escapes the next byte, xored with 0x20.
+	const char *ptr = buf + buf_offset;
+	const char *end = (const char *) m_packet_buf + m_packet_len;
+	std::vector<uint8_t> data;
+	data.reserve(length);
+	while ( ptr < end )
+	{
+		uint8_t value = *ptr++;
+		if ( value == '}' )
+		{
+			if ( ptr == end )
+				return REPLY_ENN;
+			value = *ptr++ ^ 0x20;
+		}
+		data.push_back(value);
+	}
+	if ( data.size() != length )
+		return REPLY_ENN;
+
+	for ( int i = 0; i < length; i++ )
+		m_address_space->write_byte(offset + i, data[i]);
+
+	return REPLY_OK;
+}
+
 //-------------------------------------------------------------------------
 // Read the value of register n.
 debug_gdbstub::cmd_reply debug_gdbstub::handle_p(const char *buf)
@@ -921,6 +1001,8 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_q(const char *buf)
 	{
 		std::string reply = string_format("PacketSize=%x", MAX_PACKET_SIZE);
 		reply += ";qXfer:features:read+";
+		reply += ";QStartNoAckMode+";
+		reply += ";vContSupported+";
 		send_reply(reply.c_str());
 		return REPLY_NONE;
 	}
@@ -962,6 +1044,21 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_q(const char *buf)
 	return REPLY_UNSUPPORTED;
 }
 
+//-------------------------------------------------------------------------
+// General set.
+debug_gdbstub::cmd_reply debug_gdbstub::handle_Q(const char *buf)
+{
+	if ( strcmp(buf, "StartNoAckMode") == 0 )
+	{
+		// This reply is still acknowledged; nothing after it is.
+		send_reply("OK");
+		m_no_ack = true;
+		return REPLY_NONE;
+	}
+
+	return REPLY_UNSUPPORTED;
+}
+
 //-------------------------------------------------------------------------
 // Single step, resuming at addr.
 debug_gdbstub::cmd_reply debug_gdbstub::handle_s(const char *buf)
@@ -975,6 +1072,44 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_s(const char *buf)
 	return REPLY_NONE;
 }
 
+//-------------------------------------------------------------------------
+// Multi-letter packets.
+debug_gdbstub::cmd_reply debug_gdbstub::handle_v(const char *buf)
+{
+	if ( strcmp(buf, "Cont?") == 0 )
+	{
+		send_reply("vCont;c;C;s;S");
+		return REPLY_NONE;
+	}
+
+	if ( strncmp(buf, "Cont;", 5) == 0 )
+	{
+		// There's only one thread, so the first action applies to it;
+		// signals can't be delivered, so C and S act like c and s.
+		char action = buf[5];
+		const char *thread = strchr(buf + 5, ':');
+		const char *next = strchr(buf + 5, ';');
+		if ( thread != nullptr && (next == nullptr || thread < next) )
+		{
+			std::string id(thread + 1, (next != nullptr) ? next : thread + 1 + strlen(thread + 1));
+			if ( !is_thread_id_ok(id.c_str()) )
+				return REPLY_ENN;
+		}
+
+		device_debug *debug = m_debugger_console->get_visible_cpu()->debug();
+		if ( action == 'c' || action == 'C' )
+			debug->go();
+		else if ( action == 's' || action == 'S' )
+			debug->single_step();
+		else
+			return REPLY_UNSUPPORTED;
+		m_send_stop_packet = true;
+		return REPLY_NONE;
+	}
+
+	return REPLY_UNSUPPORTED;
+}
+
 //-------------------------------------------------------------------------
 static bool remove_breakpoint(device_debug *debug, uint64_t address, int /*kind*/)
 {
@@ -1144,7 +1279,10 @@ void debug_gdbstub::handle_packet()
 		case 'p': reply = handle_p(buf); break;
 		case 'P': reply = handle_P(buf); break;
 		case 'q': reply = handle_q(buf); break;
+		case 'Q': reply = handle_Q(buf); break;
 		case 's': reply = handle_s(buf); break;
+		case 'v': reply = handle_v(buf); break;
+		case 'X': reply = handle_X(buf); break;
 		case 'z': reply = handle_z(buf); break;
 		case 'Z': reply = handle_Z(buf); break;
 	}
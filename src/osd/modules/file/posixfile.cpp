@@ -51,7 +51,14 @@
 
 #include <fcntl.h>
 #include <climits>
+#include <limits>
 #include <sys/stat.h>
+#if !defined(WIN32) && !defined(__EMSCRIPTEN__)
+#include <sys/mman.h>
+#define POSIX_OSD_FILE_MMAP 1
+#else
+#define POSIX_OSD_FILE_MMAP 0
+#endif
 #include <cstdlib>
 #include <unistd.h>
 
@@ -79,13 +86,17 @@ public:
 	posix_osd_file& operator=(posix_osd_file const &) = delete;
 	posix_osd_file& operator=(posix_osd_file &&) = delete;
 
-	posix_osd_file(int fd) : m_fd(fd)
+	posix_osd_file(int fd, bool stream) : m_fd(fd), m_stream(stream), m_view(nullptr), m_viewlength(0)
 	{
 		assert(m_fd >= 0);
 	}
 
 	virtual ~posix_osd_file() override
 	{
+#if POSIX_OSD_FILE_MMAP
+		if (m_view)
+			::munmap(m_view, m_viewlength);
+#endif
 		::close(m_fd);
 	}
 
@@ -93,15 +104,23 @@ public:
 	{
 		ssize_t result;
 
+		// pipes and devices can't seek, so the offset is meaningless
+		if (m_stream)
+		{
+			result = ::read(m_fd, buffer, size_t(count));
+		}
+		else
+		{
 #if defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__) || defined(__bsdi__) || defined(__DragonFly__) || defined(__EMSCRIPTEN__) || defined(__ANDROID__)
-		result = ::pread(m_fd, buffer, size_t(count), off_t(std::make_unsigned_t<off_t>(offset)));
+			result = ::pread(m_fd, buffer, size_t(count), off_t(std::make_unsigned_t<off_t>(offset)));
 #elif defined(WIN32) || defined(SDLMAME_NO64BITIO)
-		if (lseek(m_fd, off_t(std::make_unsigned_t<off_t>(offset)), SEEK_SET) < 0)
-			return errno_to_file_error(errno)
-		result = ::read(m_fd, buffer, size_t(count));
+			if (lseek(m_fd, off_t(std::make_unsigned_t<off_t>(offset)), SEEK_SET) < 0)
+				return errno_to_file_error(errno)
+			result = ::read(m_fd, buffer, size_t(count));
 #else
-		result = ::pread64(m_fd, buffer, size_t(count), off64_t(offset));
+			result = ::pread64(m_fd, buffer, size_t(count), off64_t(offset));
 #endif
+		}
 
 		if (result < 0)
 			return errno_to_file_error(errno);
@@ -114,15 +133,22 @@ public:
 	{
 		ssize_t result;
 
+		if (m_stream)
+		{
+			result = ::write(m_fd, buffer, size_t(count));
+		}
+		else
+		{
 #if defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__) || defined(__bsdi__) || defined(__DragonFly__) || defined(__EMSCRIPTEN__) || defined(__ANDROID__)
-		result = ::pwrite(m_fd, buffer, size_t(count), off_t(std::make_unsigned_t<off_t>(offset)));
+			result = ::pwrite(m_fd, buffer, size_t(count), off_t(std::make_unsigned_t<off_t>(offset)));
 #elif defined(WIN32) || defined(SDLMAME_NO64BITIO)
-		if (lseek(m_fd, off_t(std::make_unsigned_t<off_t>(offset)), SEEK_SET) < 0)
-			return errno_to_file_error(errno)
-		result = ::write(m_fd, buffer, size_t(count));
+			if (lseek(m_fd, off_t(std::make_unsigned_t<off_t>(offset)), SEEK_SET) < 0)
+				return errno_to_file_error(errno)
+			result = ::write(m_fd, buffer, size_t(count));
 #else
-		result = ::pwrite64(m_fd, buffer, size_t(count), off64_t(offset));
+			result = ::pwrite64(m_fd, buffer, size_t(count), off64_t(offset));
 #endif
+		}
 
 		if (result < 0)
 			return errno_to_file_error(errno);
@@ -153,8 +179,38 @@ public:
 		return error::NONE;
 	}
 
+	virtual error map_view(void const *&data, std::uint64_t &length) override
+	{
+#if POSIX_OSD_FILE_MMAP
+		if (!m_view)
+		{
+			struct stat st;
+			if (::fstat(m_fd, &st) < 0)
+				return errno_to_file_error(errno);
+			if ((st.st_size <= 0) || (std::uint64_t(st.st_size) > std::numeric_limits<std::size_t>::max()))
+				return error::FAILURE;
+
+			// a shared mapping sees writes made with pwrite through the page cache
+			void *const view = ::mmap(nullptr, std::size_t(st.st_size), PROT_READ, MAP_SHARED, m_fd, 0);
+			if (view == MAP_FAILED)
+				return errno_to_file_error(errno);
+			m_view = view;
+			m_viewlength = std::size_t(st.st_size);
+		}
+
+		data = m_view;
+		length = m_viewlength;
+		return error::NONE;
+#else
+		return error::FAILURE;
+#endif
+	}
+
 private:
 	int m_fd;
+	bool m_stream;
+	void *m_view;
+	std::size_t m_viewlength;
 };
 
 
@@ -302,7 +358,7 @@ osd_file::error osd_file::open(std::string const &path, std::uint32_t openflags,
 
 	try
 	{
-		file = std::make_unique<posix_osd_file>(fd);
+		file = std::make_unique<posix_osd_file>(fd, S_ISFIFO(st.st_mode) || S_ISCHR(st.st_mode));
 		return error::NONE;
 	}
 	catch (...)
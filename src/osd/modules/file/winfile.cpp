@@ -20,6 +20,7 @@
 
 #include <cassert>
 #include <cstring>
+#include <limits>
 
 // standard windows headers
 #include <windows.h>
@@ -43,7 +44,7 @@ public:
 	win_osd_file& operator=(win_osd_file const &) = delete;
 	win_osd_file& operator=(win_osd_file &&) = delete;
 
-	win_osd_file(HANDLE handle) : m_handle(handle)
+	win_osd_file(HANDLE handle) : m_handle(handle), m_mapping(nullptr), m_view(nullptr), m_viewlength(0)
 	{
 		assert(m_handle);
 		assert(INVALID_HANDLE_VALUE != m_handle);
@@ -51,6 +52,10 @@ public:
 
 	virtual ~win_osd_file() override
 	{
+		if (m_view)
+			UnmapViewOfFile(m_view);
+		if (m_mapping)
+			CloseHandle(m_mapping);
 		FlushFileBuffers(m_handle);
 		CloseHandle(m_handle);
 	}
@@ -110,8 +115,42 @@ public:
 		return error::NONE;
 	}
 
+	virtual error map_view(void const *&data, std::uint64_t &length) override
+	{
+		if (!m_view)
+		{
+			LARGE_INTEGER size;
+			if (!GetFileSizeEx(m_handle, &size))
+				return win_error_to_file_error(GetLastError());
+			if ((size.QuadPart <= 0) || (std::uint64_t(size.QuadPart) > (std::numeric_limits<SIZE_T>::max)()))
+				return error::FAILURE;
+
+			// views of the same mapping are coherent with WriteFile on the handle
+			HANDLE const mapping = CreateFileMapping(m_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (!mapping)
+				return win_error_to_file_error(GetLastError());
+			void *const view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			if (!view)
+			{
+				DWORD const err = GetLastError();
+				CloseHandle(mapping);
+				return win_error_to_file_error(err);
+			}
+			m_mapping = mapping;
+			m_view = view;
+			m_viewlength = std::uint64_t(size.QuadPart);
+		}
+
+		data = m_view;
+		length = m_viewlength;
+		return error::NONE;
+	}
+
 private:
 	HANDLE m_handle;
+	HANDLE m_mapping;
+	void *m_view;
+	std::uint64_t m_viewlength;
 };
 
 
@@ -15,10 +15,11 @@
 
 #include "inputdev.h"
 
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <memory>
 #include <mutex>
-#include <queue>
 #include <algorithm>
 #include <functional>
 
@@ -240,47 +241,56 @@ public:
 //  event_based_device
 //============================================================
 
-#define DEFAULT_EVENT_QUEUE_SIZE 20
+// must be a power of two
+#define DEFAULT_EVENT_QUEUE_SIZE 64
 
 template <class TEvent>
 class event_based_device : public device_info
 {
 private:
-	std::queue<TEvent>   m_event_queue;
+	// single-producer single-consumer ring: the window or event thread
+	// queues, the emulation thread drains it in poll(), and neither one
+	// ever waits on the other
+	static_assert((DEFAULT_EVENT_QUEUE_SIZE & (DEFAULT_EVENT_QUEUE_SIZE - 1)) == 0, "event queue size must be a power of two");
+	std::array<TEvent, DEFAULT_EVENT_QUEUE_SIZE> m_event_queue;
+	std::atomic<unsigned> m_event_head;     // next slot to fill, written by the producer only
+	std::atomic<unsigned> m_event_tail;     // next slot to drain, written by the consumer only
 
 protected:
-	std::mutex           m_device_lock;
-
 	virtual void process_event(TEvent &ev) = 0;
 
 public:
 	event_based_device(running_machine &machine, const char *name, const char *id, input_device_class deviceclass, input_module &module)
 		: device_info(machine, name, id, deviceclass, module)
+		, m_event_head(0)
+		, m_event_tail(0)
 	{
 	}
 
 	void queue_events(const TEvent *events, int count)
 	{
-		std::lock_guard<std::mutex> scope_lock(m_device_lock);
+		unsigned head = m_event_head.load(std::memory_order_relaxed);
+		unsigned const tail = m_event_tail.load(std::memory_order_acquire);
 		for (int i = 0; i < count; i++)
-			m_event_queue.push(events[i]);
-
-		// If we've gone over the size, remove old events from the queue
-		while (m_event_queue.size() > DEFAULT_EVENT_QUEUE_SIZE)
-			m_event_queue.pop();
+		{
+			// if the ring is full, drop what's left; the slots ahead of us belong to the consumer
+			if (head - tail == DEFAULT_EVENT_QUEUE_SIZE)
+				break;
+			m_event_queue[head & (DEFAULT_EVENT_QUEUE_SIZE - 1)] = events[i];
+			head++;
+		}
+		m_event_head.store(head, std::memory_order_release);
 	}
 
 	void virtual poll() override
 	{
-		std::lock_guard<std::mutex> scope_lock(m_device_lock);
+		unsigned tail = m_event_tail.load(std::memory_order_relaxed);
+		unsigned const head = m_event_head.load(std::memory_order_acquire);
 
 		// Process each event until the queue is empty
-		while (!m_event_queue.empty())
-		{
-			TEvent &next_event = m_event_queue.front();
-			process_event(next_event);
-			m_event_queue.pop();
-		}
+		for ( ; tail != head; tail++)
+			process_event(m_event_queue[tail & (DEFAULT_EVENT_QUEUE_SIZE - 1)]);
+		m_event_tail.store(tail, std::memory_order_release);
 	}
 };
 
@@ -12,6 +12,8 @@
 #include "emu.h"
 #include "osdepend.h"
 #include "modules/lib/osdobj_common.h"
+#include "modules/osdwindow.h"
+#include "osdsync.h"
 
 #include <iostream>
 
@@ -50,6 +52,8 @@ const options_entry osd_options::s_option_entries[] =
 
 	{ nullptr,                                nullptr,          OPTION_HEADER,    "OSD PERFORMANCE OPTIONS" },
 	{ OSDOPTION_NUMPROCESSORS ";np",          OSDOPTVAL_AUTO,   OPTION_STRING,    "number of processors; this overrides the number the system reports" },
+	{ OSDOPTION_EMU_AFFINITY,                 "",               OPTION_STRING,    "cores to run the emulation and rendering thread on, such as 0-3,8; empty for any" },
+	{ OSDOPTION_WORK_AFFINITY,                "",               OPTION_STRING,    "cores to spread work queue threads over, such as 4-7; empty for any" },
 	{ OSDOPTION_BENCH,                        "0",              OPTION_INTEGER,   "benchmark for the given number of emulated seconds; implies -video none -sound none -nothrottle" },
 
 	{ nullptr,                                nullptr,          OPTION_HEADER,    "OSD VIDEO OPTIONS" },
@@ -60,6 +64,7 @@ const options_entry osd_options::s_option_entries[] =
 	{ OSDOPTION_MAXIMIZE ";max",              "1",              OPTION_BOOLEAN,   "default to maximized windows" },
 	{ OSDOPTION_WAITVSYNC ";vs",              "0",              OPTION_BOOLEAN,   "enable waiting for the start of VBLANK before flipping screens (reduces tearing effects)" },
 	{ OSDOPTION_SYNCREFRESH ";srf",           "0",              OPTION_BOOLEAN,   "enable using the start of VBLANK for throttling instead of the game time" },
+	{ OSDOPTION_RENDERTHREAD,                 "0",              OPTION_BOOLEAN,   "draw on a separate thread, overlapping GPU submission with emulation (OpenGL only)" },
 	{ OSD_MONITOR_PROVIDER,                   OSDOPTVAL_AUTO,   OPTION_STRING,    "monitor discovery method: " },
 
 	// per-window options
@@ -130,6 +135,7 @@ const options_entry osd_options::s_option_entries[] =
 	{ nullptr,                                nullptr,          OPTION_HEADER,    "OSD SOUND OPTIONS" },
 	{ OSDOPTION_SOUND,                        OSDOPTVAL_AUTO,   OPTION_STRING,    "sound output method: " },
 	{ OSDOPTION_AUDIO_LATENCY "(1-5)",        "2",              OPTION_INTEGER,   "set audio latency (increase to reduce glitches, decrease for responsiveness)" },
+	{ OSDOPTION_AUDIO_TARGET_LATENCY "(0-100)", "0",            OPTION_INTEGER,   "target audio latency in milliseconds for low-latency output with dynamic rate control (0 = use audio_latency)" },
 
 #ifndef NO_USE_PORTAUDIO
 	{ nullptr,                                nullptr,          OPTION_HEADER,    "PORTAUDIO OPTIONS" },
@@ -281,6 +287,7 @@ void osd_common_t::register_options()
 	REGISTER_MODULE(m_mod_man, OUTPUT_NONE);
 	REGISTER_MODULE(m_mod_man, OUTPUT_CONSOLE);
 	REGISTER_MODULE(m_mod_man, OUTPUT_NETWORK);
+	REGISTER_MODULE(m_mod_man, OUTPUT_SHMEM);
 	REGISTER_MODULE(m_mod_man, OUTPUT_WIN32);
 
 
@@ -482,11 +489,34 @@ void osd_common_t::update(bool skip_redraw)
 	if (m_watchdog != nullptr)
 		m_watchdog->reset();
 
+	if (m_output != nullptr)
+		m_output->update();
+
 	update_slider_list();
 
 }
 
 
+//-------------------------------------------------
+//  present_timing - report when the main window
+//  last presented and the display refresh period
+//-------------------------------------------------
+
+bool osd_common_t::present_timing(osd_ticks_t &last_present, osd_ticks_t &period)
+{
+	//
+	// Returns false unless presents are synchronised to the display, the
+	// refresh period has been measured, and it is steady.  Otherwise,
+	// last_present is when the most recent frame was presented and period
+	// is the interval between vertical blanks, both in osd_ticks units;
+	// the core uses these to finish each frame just before it is shown.
+	//
+	if (!video_config.waitvsync || video_config.vrr || s_window_list.empty())
+		return false;
+	return s_window_list.front()->present_timing(last_present, period);
+}
+
+
 //-------------------------------------------------
 //  init_debugger - perform debugger-specific
 //  initialization
@@ -541,6 +571,58 @@ void osd_common_t::update_audio_stream(const int16_t *buffer, int samples_this_f
 }
 
 
+//-------------------------------------------------
+//  audio_float_channels - number of interleaved
+//  float channels the sound module takes
+//-------------------------------------------------
+
+int osd_common_t::audio_float_channels()
+{
+	//
+	// Returns 0 if the sound module only takes 16-bit stereo samples through
+	// update_audio_stream.  Otherwise the core mixes straight to float and
+	// calls update_audio_stream_float with this many interleaved channels,
+	// skipping the round trip through 16-bit samples.
+	//
+	int channels = 0;
+	if ((m_sound == nullptr) || !m_sound->float_output(channels))
+		return 0;
+	return channels;
+}
+
+
+//-------------------------------------------------
+//  update_audio_stream_float - update the audio
+//  stream with float samples
+//-------------------------------------------------
+
+void osd_common_t::update_audio_stream_float(const float *buffer, int channels, int samples_this_frame)
+{
+	//
+	// The samples are nominally in the range -1.0 to 1.0, but are not
+	// clipped; samples_this_frame counts frames of all channels.
+	//
+	m_sound->update_audio_stream_float(m_machine->video().throttled(), buffer, channels, samples_this_frame);
+}
+
+
+//-------------------------------------------------
+//  audio_buffer_status - report the host audio
+//  buffer level in low-latency mode
+//-------------------------------------------------
+
+bool osd_common_t::audio_buffer_status(int &queued, int &target)
+{
+	//
+	// Returns false unless the sound module is running in low-latency mode.
+	// Otherwise, queued is the number of stereo samples waiting to be played
+	// and target is the number the module is trying to keep queued; the core
+	// uses these to trim its output rate so the two stay aligned.
+	//
+	return (m_sound != nullptr) && m_sound->buffer_status(queued, target);
+}
+
+
 //-------------------------------------------------
 //  set_mastervolume - set the system volume
 //-------------------------------------------------
@@ -646,6 +728,12 @@ static void output_notifier_callback(const char *outname, int32_t value, void *p
 
 void osd_common_t::init_subsystems()
 {
+	// pin threads before the video modules allocate any work queues
+	if (!osd_set_current_thread_affinity(options().emu_affinity()))
+		osd_printf_warning("Unable to apply %s \"%s\"\n", OSDOPTION_EMU_AFFINITY, options().emu_affinity());
+	if (!osd_set_work_queue_affinity(options().work_affinity()))
+		osd_printf_warning("Unable to apply %s \"%s\"\n", OSDOPTION_WORK_AFFINITY, options().work_affinity());
+
 	// monitors have to be initialized before video init
 	m_monitor_module = select_module_options<monitor_module *>(options(), OSD_MONITOR_PROVIDER);
 	assert(m_monitor_module != nullptr);
@@ -669,6 +757,7 @@ void osd_common_t::init_subsystems()
 	m_sound = select_module_options<sound_module *>(options(), OSD_SOUND_PROVIDER);
 	m_sound->m_sample_rate = options().sample_rate();
 	m_sound->m_audio_latency = options().audio_latency();
+	m_sound->m_audio_target_latency = options().audio_target_latency();
 
 	m_debugger = select_module_options<debug_module *>(options(), OSD_DEBUG_PROVIDER);
 
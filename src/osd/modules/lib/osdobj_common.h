@@ -43,6 +43,8 @@
 #define OSDOPTION_WATCHDOG              "watchdog"
 
 #define OSDOPTION_NUMPROCESSORS         "numprocessors"
+#define OSDOPTION_EMU_AFFINITY          "emu_affinity"
+#define OSDOPTION_WORK_AFFINITY         "work_affinity"
 #define OSDOPTION_BENCH                 "bench"
 
 #define OSDOPTION_VIDEO                 "video"
@@ -51,6 +53,7 @@
 #define OSDOPTION_MAXIMIZE              "maximize"
 #define OSDOPTION_WAITVSYNC             "waitvsync"
 #define OSDOPTION_SYNCREFRESH           "syncrefresh"
+#define OSDOPTION_RENDERTHREAD          "renderthread"
 
 #define OSDOPTION_SCREEN                "screen"
 #define OSDOPTION_ASPECT                "aspect"
@@ -73,6 +76,7 @@
 
 #define OSDOPTION_SOUND                 "sound"
 #define OSDOPTION_AUDIO_LATENCY         "audio_latency"
+#define OSDOPTION_AUDIO_TARGET_LATENCY  "audio_target_latency"
 
 #define OSDOPTION_PA_API                "pa_api"
 #define OSDOPTION_PA_DEVICE             "pa_device"
@@ -114,6 +118,8 @@ public:
 
 	// performance options
 	const char *numprocessors() const { return value(OSDOPTION_NUMPROCESSORS); }
+	const char *emu_affinity() const { return value(OSDOPTION_EMU_AFFINITY); }
+	const char *work_affinity() const { return value(OSDOPTION_WORK_AFFINITY); }
 	int bench() const { return int_value(OSDOPTION_BENCH); }
 
 	// video options
@@ -123,6 +129,7 @@ public:
 	bool maximize() const { return bool_value(OSDOPTION_MAXIMIZE); }
 	bool wait_vsync() const { return bool_value(OSDOPTION_WAITVSYNC); }
 	bool sync_refresh() const { return bool_value(OSDOPTION_SYNCREFRESH); }
+	bool render_thread() const { return bool_value(OSDOPTION_RENDERTHREAD); }
 
 	// per-window options
 	const char *screen() const { return value(OSDOPTION_SCREEN); }
@@ -154,6 +161,7 @@ public:
 	// sound options
 	const char *sound() const { return value(OSDOPTION_SOUND); }
 	int audio_latency() const { return int_value(OSDOPTION_AUDIO_LATENCY); }
+	int audio_target_latency() const { return int_value(OSDOPTION_AUDIO_TARGET_LATENCY); }
 
 	// CoreAudio specific options
 	const char *audio_output() const { return value(OSDOPTION_AUDIO_OUTPUT); }
@@ -193,6 +201,7 @@ public:
 	// general overridables
 	virtual void init(running_machine &machine) override;
 	virtual void update(bool skip_redraw) override;
+	virtual bool present_timing(osd_ticks_t &last_present, osd_ticks_t &period) override;
 
 	// debugger overridables
 	virtual void init_debugger() override;
@@ -200,8 +209,11 @@ public:
 
 	// audio overridables
 	virtual void update_audio_stream(const int16_t *buffer, int samples_this_frame) override;
+	virtual int audio_float_channels() override;
+	virtual void update_audio_stream_float(const float *buffer, int channels, int samples_this_frame) override;
 	virtual void set_mastervolume(int attenuation) override;
 	virtual bool no_sound() override;
+	virtual bool audio_buffer_status(int &queued, int &target) override;
 
 	// input overridables
 	virtual void customize_input_type_list(std::vector<input_type_entry> &typelist) override;
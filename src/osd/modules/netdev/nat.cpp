@@ -0,0 +1,1005 @@
+// license:BSD-3-Clause
+// copyright-holders:Carl
+/***************************************************************************
+
+    nat.cpp
+
+    User-mode NAT network device.
+
+    Puts the emulated system on a private 10.0.2.0/24 network behind a
+    virtual router, with no privileges or host network configuration
+    needed.  The router answers ARP and ping, hands out 10.0.2.15 over
+    DHCP, and relays the guest's traffic through ordinary host sockets:
+
+        TCP     each connection the guest opens is terminated here and
+                carried over a host TCP connection
+        UDP     each guest port gets a host UDP socket
+        DNS     queries to 10.0.2.3 go to the host's first nameserver
+
+    10.0.2.2 stands for the host itself (127.0.0.1).  Connections from
+    outside to the guest are not supported.
+
+    Everything runs on the emulation thread: the host sockets are asio
+    sockets polled whenever the network device polls for frames.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "osdnet.h"
+
+#include "asio.h"
+
+#include <deque>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <vector>
+
+
+namespace {
+
+//============================================================
+//  CONSTANTS
+//============================================================
+
+constexpr u32 NAT_GATEWAY = 0x0a000202;     // 10.0.2.2, also the host's loopback
+constexpr u32 NAT_DNS = 0x0a000203;         // 10.0.2.3
+constexpr u32 NAT_GUEST = 0x0a00020f;       // 10.0.2.15, handed out by DHCP
+constexpr u32 NAT_NETMASK = 0xffffff00;
+constexpr u8 NAT_MAC[6] = { 0x52, 0x55, 0x0a, 0x00, 0x02, 0x02 };
+
+constexpr int ETHERNET_MIN_FRAME = 64;
+constexpr int ETHERNET_HEADER = 14;
+constexpr int IP_HEADER = 20;
+constexpr int TCP_HEADER = 20;
+constexpr int UDP_HEADER = 8;
+
+constexpr u8 IP_ICMP = 1;
+constexpr u8 IP_TCP = 6;
+constexpr u8 IP_UDP = 17;
+
+constexpr u8 SEG_FIN = 0x01;
+constexpr u8 SEG_SYN = 0x02;
+constexpr u8 SEG_RST = 0x04;
+constexpr u8 SEG_PSH = 0x08;
+constexpr u8 SEG_ACK = 0x10;
+
+constexpr u16 SEG_MSS = 1460;               // segment size offered to the guest
+constexpr size_t TCP_BUFFER = 65535;        // data held per direction per connection
+constexpr int RETRANSMIT_MS = 300;          // resend unacknowledged data after this long
+constexpr int UDP_IDLE_SECONDS = 120;       // close UDP sockets unused for this long
+
+
+//============================================================
+//  HELPERS
+//============================================================
+
+inline u16 get16(const u8 *p) { return (p[0] << 8) | p[1]; }
+inline u32 get32(const u8 *p) { return (u32(p[0]) << 24) | (u32(p[1]) << 16) | (u32(p[2]) << 8) | p[3]; }
+inline void put16(u8 *p, u16 v) { p[0] = v >> 8; p[1] = v; }
+inline void put32(u8 *p, u32 v) { p[0] = v >> 24; p[1] = v >> 16; p[2] = v >> 8; p[3] = v; }
+
+// ones' complement sum of big-endian 16-bit words
+u32 checksum_add(u32 sum, const u8 *data, size_t length)
+{
+	for ( ; length > 1; data += 2, length -= 2)
+		sum += get16(data);
+	if (length)
+		sum += data[0] << 8;
+	return sum;
+}
+
+u16 checksum_finish(u32 sum)
+{
+	while (sum >> 16)
+		sum = (sum & 0xffff) + (sum >> 16);
+	return ~sum;
+}
+
+// TCP and UDP checksums cover a pseudo-header too
+u16 l4_checksum(u8 protocol, u32 src, u32 dst, const u8 *data, size_t length)
+{
+	u8 pseudo[12];
+	put32(&pseudo[0], src);
+	put32(&pseudo[4], dst);
+	pseudo[8] = 0;
+	pseudo[9] = protocol;
+	put16(&pseudo[10], length);
+	return checksum_finish(checksum_add(checksum_add(0, pseudo, sizeof(pseudo)), data, length));
+}
+
+// pad to the Ethernet minimum and append the frame check sequence, as a real
+// receiver would see it (see taptun.cpp)
+void finalise_frame(std::vector<u8> &frame)
+{
+	if (frame.size() < ETHERNET_MIN_FRAME - 4)
+		frame.resize(ETHERNET_MIN_FRAME - 4, 0);
+
+	u32 const fcs = util::crc32_creator::simple(&frame[0], frame.size());
+	frame.push_back(fcs >> 0);
+	frame.push_back(fcs >> 8);
+	frame.push_back(fcs >> 16);
+	frame.push_back(fcs >> 24);
+}
+
+// first nameserver the host is configured with, or 0 if there isn't one we can find
+u32 host_nameserver()
+{
+#if !defined(WIN32)
+	std::ifstream resolv("/etc/resolv.conf");
+	std::string line;
+	while (std::getline(resolv, line))
+	{
+		if (line.compare(0, 11, "nameserver ") != 0)
+			continue;
+		asio::error_code err;
+		asio::ip::address_v4 const address(asio::ip::make_address_v4(line.substr(11, line.find_first_of(" \t\r", 11) - 11), err));
+		if (!err && !address.is_loopback())
+			return address.to_uint();
+	}
+#endif
+	return 0;
+}
+
+} // anonymous namespace
+
+
+//============================================================
+//  netdev_nat
+//============================================================
+
+class netdev_nat : public osd_netdev
+{
+public:
+	netdev_nat(const char *name, class device_network_interface *ifdev, int rate);
+	~netdev_nat();
+
+	int send(uint8_t *buf, int len) override;
+	void set_mac(const char *mac) override;
+
+protected:
+	int recv_dev_batch(int max) override;
+
+private:
+	// one guest TCP connection and the host connection carrying it
+	struct tcp_conn
+	{
+		enum class state { CONNECTING, SYN_SENT, ESTABLISHED, CLOSED };
+
+		tcp_conn(asio::io_context &io) : socket(io) { }
+
+		asio::ip::tcp::socket   socket;
+		state                   st = state::CONNECTING;
+		u32                     guest_ip = 0;
+		u16                     guest_port = 0;
+		u32                     remote_ip = 0;          // as the guest sees it
+		u16                     remote_port = 0;
+		u16                     guest_mss = 536;
+		u32                     guest_window = 0;
+		u32                     iss = 0;                // our initial sequence number
+		u32                     snd_una = 0;            // oldest sequence number the guest hasn't acknowledged
+		u32                     snd_nxt = 0;            // next sequence number to send
+		u32                     data_seq = 0;           // sequence number of to_guest[0]
+		u32                     rcv_nxt = 0;            // next sequence number expected from the guest
+		std::deque<u8>          to_guest;               // host data the guest hasn't acknowledged
+		std::vector<u8>         to_host;                // guest data not yet written to the host
+		bool                    reading = false;
+		bool                    writing = false;
+		bool                    host_eof = false;       // the host closed its side
+		bool                    fin_sent = false;
+		bool                    fin_acked = false;
+		bool                    guest_fin = false;      // the guest closed its side
+		bool                    host_shutdown = false;
+		osd_ticks_t             last_progress = 0;
+		u8                      read_buf[16384];
+		std::vector<u8>         write_buf;
+	};
+	using tcp_key = std::tuple<u16, u32, u16>;      // guest port, remote address, remote port
+
+	// one guest UDP port and the host socket standing in for it
+	struct udp_binding
+	{
+		udp_binding(asio::io_context &io) : socket(io) { }
+
+		asio::ip::udp::socket   socket;
+		u32                     guest_ip = 0;
+		u16                     guest_port = 0;
+		bool                    closed = false;
+		osd_ticks_t             last_used = 0;
+		asio::ip::udp::endpoint from;
+		u8                      buf[65536];
+	};
+
+	// frame construction
+	std::vector<u8> ip_frame(u8 protocol, u32 src, u32 dst, size_t payload);
+	void emit(std::vector<u8> &&frame);
+	void send_udp(u32 src, u16 srcport, u32 dst, u16 dstport, const u8 *data, size_t length);
+
+	// guest traffic
+	void handle_arp(const u8 *frame, int len);
+	void handle_ip(const u8 *frame, int len);
+	void handle_icmp(const u8 *ip, size_t iplen);
+	void handle_udp(const u8 *ip, size_t iplen);
+	void handle_dhcp(const u8 *data, size_t length);
+	void handle_tcp(const u8 *ip, size_t iplen);
+
+	// TCP relay
+	asio::ip::address_v4 host_address(u32 guest_view) const;
+	void tcp_segment(tcp_conn &conn, u8 flags, u32 seq, const u8 *data, size_t length, bool mss);
+	void tcp_reset(u32 src, u16 srcport, u32 dst, u16 dstport, u32 seq, u32 ack);
+	void tcp_pump(tcp_conn &conn);
+	void tcp_ack(tcp_conn &conn);
+	void tcp_read(std::shared_ptr<tcp_conn> conn);
+	void tcp_write(std::shared_ptr<tcp_conn> conn);
+	void tcp_close(tcp_conn &conn);
+	u16 tcp_window(const tcp_conn &conn) const;
+
+	// UDP relay
+	void udp_receive(std::shared_ptr<udp_binding> binding);
+
+	void service_timers();
+
+	asio::io_context                                m_io;           // must outlive the sockets below
+	u8                                              m_mac[6];       // guest's MAC address
+	u32                                             m_guest_ip;     // guest's address, as last seen
+	u32                                             m_nameserver;   // host's DNS server, 0 if unknown
+	u32                                             m_next_iss;     // next initial sequence number
+	std::deque<std::vector<u8>>                     m_pending;      // frames for the guest, not yet queued
+	std::map<tcp_key, std::shared_ptr<tcp_conn>>    m_tcp;          // TCP connections
+	std::map<u16, std::shared_ptr<udp_binding>>     m_udp;          // UDP sockets by guest port
+};
+
+
+netdev_nat::netdev_nat(const char *name, class device_network_interface *ifdev, int rate)
+	: osd_netdev(ifdev, rate)
+	, m_guest_ip(NAT_GUEST)
+	, m_nameserver(host_nameserver())
+	, m_next_iss(u32(osd_ticks()))
+{
+	memset(m_mac, 0, sizeof(m_mac));
+}
+
+netdev_nat::~netdev_nat()
+{
+	// close everything and let the aborted operations finish before the sockets go
+	for (auto &conn : m_tcp)
+		tcp_close(*conn.second);
+	for (auto &binding : m_udp)
+	{
+		binding.second->closed = true;
+		binding.second->socket.close();
+	}
+	m_io.restart();
+	m_io.poll();
+	m_tcp.clear();
+	m_udp.clear();
+}
+
+void netdev_nat::set_mac(const char *mac)
+{
+	memcpy(m_mac, mac, 6);
+}
+
+
+//-------------------------------------------------
+//  recv_dev_batch - run whatever the host sockets
+//  have ready and queue the frames that result
+//-------------------------------------------------
+
+int netdev_nat::recv_dev_batch(int max)
+{
+	m_io.restart();
+	m_io.poll();
+	service_timers();
+
+	int count = 0;
+	while ((count < max) && !m_pending.empty() && queue_frame(&m_pending.front()[0], m_pending.front().size()))
+	{
+		m_pending.pop_front();
+		count++;
+	}
+	return count;
+}
+
+
+//-------------------------------------------------
+//  send - take a frame from the guest
+//-------------------------------------------------
+
+int netdev_nat::send(uint8_t *buf, int len)
+{
+	if (len < ETHERNET_HEADER)
+		return len;
+
+	// only frames for us, or for everyone
+	if (memcmp(buf, NAT_MAC, 6) && !(buf[0] & 1))
+		return len;
+	memcpy(m_mac, &buf[6], 6);
+
+	switch (get16(&buf[12]))
+	{
+	case 0x0806:
+		handle_arp(buf, len);
+		break;
+	case 0x0800:
+		handle_ip(buf, len);
+		break;
+	}
+	return len;
+}
+
+
+//-------------------------------------------------
+//  ip_frame - start a frame for the guest, with
+//  Ethernet and IP headers filled in
+//-------------------------------------------------
+
+std::vector<u8> netdev_nat::ip_frame(u8 protocol, u32 src, u32 dst, size_t payload)
+{
+	std::vector<u8> frame(ETHERNET_HEADER + IP_HEADER + payload, 0);
+	memcpy(&frame[0], (dst == 0xffffffff) ? reinterpret_cast<const u8 *>("\xff\xff\xff\xff\xff\xff") : m_mac, 6);
+	memcpy(&frame[6], NAT_MAC, 6);
+	put16(&frame[12], 0x0800);
+
+	u8 *const ip = &frame[ETHERNET_HEADER];
+	ip[0] = 0x45;
+	put16(&ip[2], IP_HEADER + payload);
+	put16(&ip[6], 0x4000); // don't fragment
+	ip[8] = 64;
+	ip[9] = protocol;
+	put32(&ip[12], src);
+	put32(&ip[16], dst);
+	put16(&ip[10], checksum_finish(checksum_add(0, ip, IP_HEADER)));
+	return frame;
+}
+
+void netdev_nat::emit(std::vector<u8> &&frame)
+{
+	finalise_frame(frame);
+	m_pending.emplace_back(std::move(frame));
+}
+
+void netdev_nat::send_udp(u32 src, u16 srcport, u32 dst, u16 dstport, const u8 *data, size_t length)
+{
+	std::vector<u8> frame(ip_frame(IP_UDP, src, dst, UDP_HEADER + length));
+	u8 *const udp = &frame[ETHERNET_HEADER + IP_HEADER];
+	put16(&udp[0], srcport);
+	put16(&udp[2], dstport);
+	put16(&udp[4], UDP_HEADER + length);
+	memcpy(&udp[UDP_HEADER], data, length);
+	u16 const sum = l4_checksum(IP_UDP, src, dst, udp, UDP_HEADER + length);
+	put16(&udp[6], sum ? sum : 0xffff);
+	emit(std::move(frame));
+}
+
+
+//-------------------------------------------------
+//  handle_arp - answer for every address on the
+//  network other than the guest's own
+//-------------------------------------------------
+
+void netdev_nat::handle_arp(const u8 *frame, int len)
+{
+	if (len < ETHERNET_HEADER + 28)
+		return;
+	const u8 *const arp = &frame[ETHERNET_HEADER];
+	u32 const sender = get32(&arp[14]);
+	u32 const target = get32(&arp[24]);
+	if (get16(&arp[6]) != 1 || ((target & NAT_NETMASK) != (NAT_GATEWAY & NAT_NETMASK)) || target == sender)
+		return;
+
+	std::vector<u8> reply(ETHERNET_HEADER + 28);
+	memcpy(&reply[0], &frame[6], 6);
+	memcpy(&reply[6], NAT_MAC, 6);
+	put16(&reply[12], 0x0806);
+	u8 *const out = &reply[ETHERNET_HEADER];
+	memcpy(&out[0], &arp[0], 6);    // hardware and protocol types and sizes
+	put16(&out[6], 2);
+	memcpy(&out[8], NAT_MAC, 6);
+	put32(&out[14], target);
+	memcpy(&out[18], &arp[8], 6);
+	put32(&out[24], sender);
+	emit(std::move(reply));
+}
+
+
+//-------------------------------------------------
+//  handle_ip - dispatch an IPv4 packet
+//-------------------------------------------------
+
+void netdev_nat::handle_ip(const u8 *frame, int len)
+{
+	const u8 *const ip = &frame[ETHERNET_HEADER];
+	if (len < ETHERNET_HEADER + IP_HEADER || (ip[0] >> 4) != 4)
+		return;
+	size_t const hlen = (ip[0] & 0x0f) * 4;
+	size_t const total = get16(&ip[2]);
+	if (hlen < IP_HEADER || total < hlen || total > size_t(len - ETHERNET_HEADER))
+		return;
+
+	// fragments aren't reassembled
+	if (get16(&ip[6]) & 0x3fff)
+		return;
+
+	u32 const src = get32(&ip[12]);
+	if (src != 0)
+		m_guest_ip = src;
+
+	switch (ip[9])
+	{
+	case IP_ICMP:
+		handle_icmp(ip, total);
+		break;
+	case IP_UDP:
+		handle_udp(ip, total);
+		break;
+	case IP_TCP:
+		handle_tcp(ip, total);
+		break;
+	}
+}
+
+
+//-------------------------------------------------
+//  handle_icmp - answer pings to the router
+//-------------------------------------------------
+
+void netdev_nat::handle_icmp(const u8 *ip, size_t iplen)
+{
+	size_t const hlen = (ip[0] & 0x0f) * 4;
+	u32 const dst = get32(&ip[16]);
+	if (iplen < hlen + 8 || ip[hlen] != 8 || (dst != NAT_GATEWAY && dst != NAT_DNS))
+		return;
+
+	size_t const length = iplen - hlen;
+	std::vector<u8> frame(ip_frame(IP_ICMP, dst, get32(&ip[12]), length));
+	u8 *const icmp = &frame[ETHERNET_HEADER + IP_HEADER];
+	memcpy(icmp, &ip[hlen], length);
+	icmp[0] = 0;
+	put16(&icmp[2], 0);
+	put16(&icmp[2], checksum_finish(checksum_add(0, icmp, length)));
+	emit(std::move(frame));
+}
+
+
+//-------------------------------------------------
+//  handle_udp - relay a datagram through the
+//  guest port's host socket
+//-------------------------------------------------
+
+void netdev_nat::handle_udp(const u8 *ip, size_t iplen)
+{
+	size_t const hlen = (ip[0] & 0x0f) * 4;
+	if (iplen < hlen + UDP_HEADER)
+		return;
+	const u8 *const udp = &ip[hlen];
+	size_t const length = std::min<size_t>(get16(&udp[4]), iplen - hlen);
+	if (length < UDP_HEADER)
+		return;
+	u16 const srcport = get16(&udp[0]);
+	u32 const dst = get32(&ip[16]);
+	u16 const dstport = get16(&udp[2]);
+
+	if (dstport == 67)
+	{
+		handle_dhcp(&udp[UDP_HEADER], length - UDP_HEADER);
+		return;
+	}
+
+	// work out where it's really going
+	asio::ip::udp::endpoint target;
+	if (dst == NAT_DNS && dstport == 53 && m_nameserver)
+		target = asio::ip::udp::endpoint(asio::ip::address_v4(m_nameserver), 53);
+	else if (dst == NAT_GATEWAY)
+		target = asio::ip::udp::endpoint(asio::ip::address_v4::loopback(), dstport);
+	else if ((dst & NAT_NETMASK) != (NAT_GATEWAY & NAT_NETMASK) && dst != 0xffffffff)
+		target = asio::ip::udp::endpoint(asio::ip::address_v4(dst), dstport);
+	else
+		return;
+
+	auto found = m_udp.find(srcport);
+	if (found == m_udp.end())
+	{
+		auto binding = std::make_shared<udp_binding>(m_io);
+		asio::error_code err;
+		binding->socket.open(asio::ip::udp::v4(), err);
+		if (!err)
+			binding->socket.bind(asio::ip::udp::endpoint(asio::ip::udp::v4(), 0), err);
+		if (err)
+		{
+			osd_printf_verbose("nat: unable to open UDP socket: %s\n", err.message());
+			return;
+		}
+		binding->guest_port = srcport;
+		found = m_udp.emplace(srcport, binding).first;
+		udp_receive(binding);
+	}
+
+	udp_binding &binding(*found->second);
+	binding.guest_ip = get32(&ip[12]);
+	binding.last_used = osd_ticks();
+	asio::error_code err;
+	binding.socket.send_to(asio::buffer(&udp[UDP_HEADER], length - UDP_HEADER), target, 0, err);
+}
+
+void netdev_nat::udp_receive(std::shared_ptr<udp_binding> binding)
+{
+	binding->socket.async_receive_from(asio::buffer(binding->buf), binding->from,
+			[this, binding] (const asio::error_code &err, std::size_t length)
+			{
+				if (binding->closed)
+					return;
+				if (!err)
+				{
+					// show the reply as coming from the address the guest sent to
+					asio::ip::address_v4 const from(binding->from.address().to_v4());
+					u32 src = from.to_uint();
+					if (from.is_loopback())
+						src = NAT_GATEWAY;
+					else if (src == m_nameserver && binding->from.port() == 53)
+						src = NAT_DNS;
+					binding->last_used = osd_ticks();
+					send_udp(src, binding->from.port(), binding->guest_ip, binding->guest_port, binding->buf, length);
+				}
+				if (err != asio::error::operation_aborted)
+					udp_receive(binding);
+			});
+}
+
+
+//-------------------------------------------------
+//  handle_dhcp - give the guest its address
+//-------------------------------------------------
+
+void netdev_nat::handle_dhcp(const u8 *data, size_t length)
+{
+	// fixed BOOTP part, then the magic cookie
+	if (length < 240 || data[0] != 1 || get32(&data[236]) != 0x63825363)
+		return;
+
+	u8 type = 0;
+	for (size_t pos = 240; pos < length && data[pos] != 255; )
+	{
+		if (data[pos] == 0)
+		{
+			pos++;
+			continue;
+		}
+		if (pos + 1 >= length || pos + 2 + data[pos + 1] > length)
+			break;
+		if (data[pos] == 53 && data[pos + 1] >= 1)
+			type = data[pos + 2];
+		pos += 2 + data[pos + 1];
+	}
+	if (type != 1 && type != 3)
+		return;
+
+	std::vector<u8> reply(240, 0);
+	reply[0] = 2;
+	reply[1] = 1;
+	reply[2] = 6;
+	memcpy(&reply[4], &data[4], 4);     // transaction ID
+	memcpy(&reply[10], &data[10], 2);   // flags
+	put32(&reply[16], NAT_GUEST);
+	put32(&reply[20], NAT_GATEWAY);
+	memcpy(&reply[28], &data[28], 16);  // client hardware address
+	put32(&reply[236], 0x63825363);
+
+	auto option = [&reply] (u8 code, u32 value)
+	{
+		reply.push_back(code);
+		reply.push_back(4);
+		reply.resize(reply.size() + 4);
+		put32(&reply[reply.size() - 4], value);
+	};
+	reply.push_back(53);
+	reply.push_back(1);
+	reply.push_back((type == 1) ? 2 : 5);   // offer or acknowledge
+	option(54, NAT_GATEWAY);
+	option(51, 86400);
+	option(1, NAT_NETMASK);
+	option(3, NAT_GATEWAY);
+	if (m_nameserver)
+		option(6, NAT_DNS);
+	reply.push_back(255);
+
+	send_udp(NAT_GATEWAY, 67, 0xffffffff, 68, &reply[0], reply.size());
+}
+
+
+//-------------------------------------------------
+//  host_address - where a connection to an address
+//  on the guest's side really goes
+//-------------------------------------------------
+
+asio::ip::address_v4 netdev_nat::host_address(u32 guest_view) const
+{
+	return (guest_view == NAT_GATEWAY) ? asio::ip::address_v4::loopback() : asio::ip::address_v4(guest_view);
+}
+
+
+//-------------------------------------------------
+//  handle_tcp - process a segment from the guest
+//-------------------------------------------------
+
+void netdev_nat::handle_tcp(const u8 *ip, size_t iplen)
+{
+	size_t const hlen = (ip[0] & 0x0f) * 4;
+	if (iplen < hlen + TCP_HEADER)
+		return;
+	const u8 *const tcp = &ip[hlen];
+	size_t const thlen = (tcp[12] >> 4) * 4;
+	if (thlen < TCP_HEADER || iplen < hlen + thlen)
+		return;
+
+	u32 const src = get32(&ip[12]);
+	u32 const dst = get32(&ip[16]);
+	u16 const srcport = get16(&tcp[0]);
+	u16 const dstport = get16(&tcp[2]);
+	u32 const seq = get32(&tcp[4]);
+	u32 const ack = get32(&tcp[8]);
+	u8 const flags = tcp[13];
+	const u8 *const payload = &tcp[thlen];
+	size_t const length = iplen - hlen - thlen;
+
+	tcp_key const key(srcport, dst, dstport);
+	auto found = m_tcp.find(key);
+	if (found == m_tcp.end())
+	{
+		if (flags & SEG_RST)
+			return;
+		if ((flags & (SEG_SYN | SEG_ACK)) != SEG_SYN || ((dst & NAT_NETMASK) == (NAT_GATEWAY & NAT_NETMASK) && dst != NAT_GATEWAY))
+		{
+			tcp_reset(dst, dstport, src, srcport, (flags & SEG_ACK) ? ack : 0, seq + length + ((flags & SEG_SYN) ? 1 : 0));
+			return;
+		}
+
+		// a new connection: reach the far end before answering the guest
+		auto conn = std::make_shared<tcp_conn>(m_io);
+		conn->guest_ip = src;
+		conn->guest_port = srcport;
+		conn->remote_ip = dst;
+		conn->remote_port = dstport;
+		conn->rcv_nxt = seq + 1;
+		conn->guest_window = get16(&tcp[14]);
+		conn->iss = m_next_iss;
+		m_next_iss += 0x10000;
+		for (size_t pos = TCP_HEADER; pos < thlen && tcp[pos] != 0; )
+		{
+			if (tcp[pos] == 1)
+			{
+				pos++;
+				continue;
+			}
+			if (pos + 1 >= thlen || tcp[pos + 1] < 2)
+				break;
+			if (tcp[pos] == 2 && tcp[pos + 1] == 4 && pos + 4 <= thlen)
+				conn->guest_mss = std::max<u16>(get16(&tcp[pos + 2]), 64);
+			pos += tcp[pos + 1];
+		}
+		m_tcp.emplace(key, conn);
+
+		conn->socket.async_connect(asio::ip::tcp::endpoint(host_address(dst), dstport),
+				[this, conn] (const asio::error_code &err)
+				{
+					if (conn->st == tcp_conn::state::CLOSED)
+						return;
+					if (err)
+					{
+						tcp_reset(conn->remote_ip, conn->remote_port, conn->guest_ip, conn->guest_port, 0, conn->rcv_nxt);
+						tcp_close(*conn);
+						return;
+					}
+					asio::error_code ignored;
+					conn->socket.set_option(asio::ip::tcp::no_delay(true), ignored);
+					conn->st = tcp_conn::state::SYN_SENT;
+					conn->snd_una = conn->iss;
+					conn->snd_nxt = conn->iss + 1;
+					conn->data_seq = conn->iss + 1;
+					conn->last_progress = osd_ticks();
+					tcp_segment(*conn, SEG_SYN | SEG_ACK, conn->iss, nullptr, 0, true);
+				});
+		return;
+	}
+
+	tcp_conn &conn(*found->second);
+	if (flags & SEG_RST)
+	{
+		tcp_close(conn);
+		return;
+	}
+	if (conn.st == tcp_conn::state::CONNECTING)
+		return; // a retransmitted SYN; we answer once the host connects
+
+	// acknowledgement of what we've sent
+	if ((flags & SEG_ACK) && s32(ack - conn.snd_una) > 0 && s32(ack - conn.snd_nxt) <= 0)
+	{
+		if (conn.st == tcp_conn::state::SYN_SENT)
+		{
+			conn.st = tcp_conn::state::ESTABLISHED;
+			tcp_read(found->second);
+		}
+		u32 const acked = std::min<u32>(ack - conn.data_seq, conn.to_guest.size() + (conn.fin_sent ? 1 : 0));
+		size_t const data = std::min<size_t>(acked, conn.to_guest.size());
+		conn.to_guest.erase(conn.to_guest.begin(), conn.to_guest.begin() + data);
+		conn.data_seq += data;
+		if (conn.fin_sent && ack == conn.data_seq + 1)
+			conn.fin_acked = true;
+		conn.snd_una = ack;
+		conn.last_progress = osd_ticks();
+
+		// there may be room to read more now
+		if (!conn.reading && !conn.host_eof && conn.st == tcp_conn::state::ESTABLISHED)
+			tcp_read(found->second);
+	}
+	if (flags & SEG_ACK)
+		conn.guest_window = get16(&tcp[14]);
+	if (conn.st == tcp_conn::state::SYN_SENT)
+		return;
+
+	// data and FIN from the guest, in order only
+	bool need_ack = false;
+	if (length || (flags & SEG_FIN))
+	{
+		need_ack = true;
+		if (seq == conn.rcv_nxt && !conn.guest_fin)
+		{
+			size_t const room = TCP_BUFFER - std::min(TCP_BUFFER, conn.to_host.size());
+			size_t const take = std::min(length, room);
+			conn.to_host.insert(conn.to_host.end(), payload, payload + take);
+			conn.rcv_nxt += take;
+			if ((flags & SEG_FIN) && take == length)
+			{
+				conn.rcv_nxt++;
+				conn.guest_fin = true;
+			}
+			if (!conn.writing)
+				tcp_write(found->second);
+		}
+	}
+	if (need_ack)
+		tcp_ack(conn);
+
+	tcp_pump(conn);
+
+	// both sides finished
+	if (conn.guest_fin && conn.fin_acked && conn.to_host.empty() && !conn.writing)
+	{
+		tcp_close(conn);
+		m_tcp.erase(found);
+	}
+}
+
+
+//-------------------------------------------------
+//  tcp_segment - send one segment to the guest
+//-------------------------------------------------
+
+void netdev_nat::tcp_segment(tcp_conn &conn, u8 flags, u32 seq, const u8 *data, size_t length, bool mss)
+{
+	size_t const optlen = mss ? 4 : 0;
+	std::vector<u8> frame(ip_frame(IP_TCP, conn.remote_ip, conn.guest_ip, TCP_HEADER + optlen + length));
+	u8 *const tcp = &frame[ETHERNET_HEADER + IP_HEADER];
+	put16(&tcp[0], conn.remote_port);
+	put16(&tcp[2], conn.guest_port);
+	put32(&tcp[4], seq);
+	put32(&tcp[8], conn.rcv_nxt);
+	tcp[12] = ((TCP_HEADER + optlen) / 4) << 4;
+	tcp[13] = flags;
+	put16(&tcp[14], tcp_window(conn));
+	if (mss)
+	{
+		tcp[20] = 2;
+		tcp[21] = 4;
+		put16(&tcp[22], SEG_MSS);
+	}
+	if (length)
+		memcpy(&tcp[TCP_HEADER + optlen], data, length);
+	put16(&tcp[16], l4_checksum(IP_TCP, conn.remote_ip, conn.guest_ip, tcp, TCP_HEADER + optlen + length));
+	emit(std::move(frame));
+}
+
+void netdev_nat::tcp_reset(u32 src, u16 srcport, u32 dst, u16 dstport, u32 seq, u32 ack)
+{
+	tcp_conn conn(m_io);
+	conn.remote_ip = src;
+	conn.remote_port = srcport;
+	conn.guest_ip = dst;
+	conn.guest_port = dstport;
+	conn.rcv_nxt = ack;
+	conn.to_host.resize(TCP_BUFFER); // advertise no window
+	tcp_segment(conn, SEG_RST | SEG_ACK, seq, nullptr, 0, false);
+}
+
+void netdev_nat::tcp_ack(tcp_conn &conn)
+{
+	tcp_segment(conn, SEG_ACK, conn.snd_nxt, nullptr, 0, false);
+}
+
+u16 netdev_nat::tcp_window(const tcp_conn &conn) const
+{
+	return TCP_BUFFER - std::min(TCP_BUFFER, conn.to_host.size());
+}
+
+
+//-------------------------------------------------
+//  tcp_pump - send the guest as much host data as
+//  its window allows, then our FIN once the host
+//  has closed
+//-------------------------------------------------
+
+void netdev_nat::tcp_pump(tcp_conn &conn)
+{
+	if (conn.st != tcp_conn::state::ESTABLISHED)
+		return;
+
+	u32 const mss = std::min<u32>(conn.guest_mss, SEG_MSS);
+	u8 segment[SEG_MSS];
+	if (conn.snd_nxt == conn.snd_una)
+		conn.last_progress = osd_ticks(); // retransmit timer starts with the first byte in flight
+	for (;;)
+	{
+		u32 const offset = conn.snd_nxt - conn.data_seq;
+		if (offset >= conn.to_guest.size())
+			break;
+		u32 const in_flight = conn.snd_nxt - conn.snd_una;
+		if (in_flight >= conn.guest_window)
+			break;
+		u32 const length = std::min<u32>({ mss, u32(conn.to_guest.size() - offset), conn.guest_window - in_flight });
+		std::copy_n(conn.to_guest.begin() + offset, length, segment);
+		bool const last = (offset + length) == conn.to_guest.size();
+		tcp_segment(conn, SEG_ACK | (last ? SEG_PSH : 0), conn.snd_nxt, segment, length, false);
+		conn.snd_nxt += length;
+	}
+
+	if (conn.host_eof && !conn.fin_sent && (conn.snd_nxt - conn.data_seq) == conn.to_guest.size())
+	{
+		tcp_segment(conn, SEG_FIN | SEG_ACK, conn.snd_nxt, nullptr, 0, false);
+		conn.snd_nxt++;
+		conn.fin_sent = true;
+	}
+}
+
+
+//-------------------------------------------------
+//  tcp_read - read from the host while there's
+//  room to hold what the guest hasn't taken
+//-------------------------------------------------
+
+void netdev_nat::tcp_read(std::shared_ptr<tcp_conn> conn)
+{
+	if (conn->reading || conn->host_eof || conn->to_guest.size() >= TCP_BUFFER)
+		return;
+	conn->reading = true;
+	conn->socket.async_read_some(asio::buffer(conn->read_buf),
+			[this, conn] (const asio::error_code &err, std::size_t length)
+			{
+				conn->reading = false;
+				if (conn->st == tcp_conn::state::CLOSED)
+					return;
+				if (err)
+					conn->host_eof = true;
+				else
+					conn->to_guest.insert(conn->to_guest.end(), conn->read_buf, conn->read_buf + length);
+				tcp_pump(*conn);
+				tcp_read(conn);
+			});
+}
+
+
+//-------------------------------------------------
+//  tcp_write - write guest data to the host, and
+//  pass on the guest's FIN once it's all gone
+//-------------------------------------------------
+
+void netdev_nat::tcp_write(std::shared_ptr<tcp_conn> conn)
+{
+	if (conn->writing)
+		return;
+	if (conn->to_host.empty())
+	{
+		if (conn->guest_fin && !conn->host_shutdown)
+		{
+			asio::error_code ignored;
+			conn->socket.shutdown(asio::ip::tcp::socket::shutdown_send, ignored);
+			conn->host_shutdown = true;
+		}
+		return;
+	}
+
+	// the guest's window reopens as this drains
+	conn->write_buf.swap(conn->to_host);
+	conn->to_host.clear();
+	conn->writing = true;
+	asio::async_write(conn->socket, asio::buffer(conn->write_buf),
+			[this, conn] (const asio::error_code &err, std::size_t length)
+			{
+				conn->writing = false;
+				if (conn->st == tcp_conn::state::CLOSED)
+					return;
+				if (err)
+				{
+					tcp_reset(conn->remote_ip, conn->remote_port, conn->guest_ip, conn->guest_port, conn->snd_nxt, conn->rcv_nxt);
+					tcp_close(*conn);
+					return;
+				}
+				tcp_ack(*conn);
+				tcp_write(conn);
+			});
+}
+
+void netdev_nat::tcp_close(tcp_conn &conn)
+{
+	conn.st = tcp_conn::state::CLOSED;
+	asio::error_code ignored;
+	conn.socket.close(ignored);
+}
+
+
+//-------------------------------------------------
+//  service_timers - resend what the guest hasn't
+//  acknowledged, and tidy up finished relays
+//-------------------------------------------------
+
+void netdev_nat::service_timers()
+{
+	osd_ticks_t const now = osd_ticks();
+	osd_ticks_t const retransmit = osd_ticks_per_second() * RETRANSMIT_MS / 1000;
+
+	for (auto it = m_tcp.begin(); it != m_tcp.end(); )
+	{
+		tcp_conn &conn(*it->second);
+		if (conn.st == tcp_conn::state::CLOSED)
+		{
+			it = m_tcp.erase(it);
+			continue;
+		}
+		if (conn.snd_nxt != conn.snd_una && (now - conn.last_progress) > retransmit)
+		{
+			// go back to the oldest unacknowledged byte
+			conn.last_progress = now;
+			if (conn.st == tcp_conn::state::SYN_SENT)
+				tcp_segment(conn, SEG_SYN | SEG_ACK, conn.iss, nullptr, 0, true);
+			else
+			{
+				conn.snd_nxt = conn.snd_una;
+				if (conn.fin_sent && !conn.fin_acked)
+					conn.fin_sent = false;
+				tcp_pump(conn);
+			}
+		}
+		else if (conn.st == tcp_conn::state::ESTABLISHED && conn.guest_window == 0 && !conn.to_guest.empty() && (now - conn.last_progress) > retransmit)
+		{
+			// probe a closed window with one byte
+			conn.last_progress = now;
+			u8 const probe = conn.to_guest[conn.snd_una - conn.data_seq];
+			tcp_segment(conn, SEG_ACK, conn.snd_una, &probe, 1, false);
+		}
+		++it;
+	}
+
+	osd_ticks_t const idle = osd_ticks_per_second() * UDP_IDLE_SECONDS;
+	for (auto it = m_udp.begin(); it != m_udp.end(); )
+	{
+		if ((now - it->second->last_used) > idle)
+		{
+			it->second->closed = true;
+			it->second->socket.close();
+			it = m_udp.erase(it);
+		}
+		else
+			++it;
+	}
+}
+
+
+static CREATE_NETDEV(create_nat)
+{
+	auto *dev = global_alloc(netdev_nat(ifname, ifdev, rate));
+	return dynamic_cast<osd_netdev *>(dev);
+}
+
+void add_nat_netdev()
+{
+	add_netdev("nat", "User-mode NAT", create_nat);
+}
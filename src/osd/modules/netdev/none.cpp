@@ -5,6 +5,8 @@
  *
  */
 
+#include "emu.h"
+#include "osdnet.h"
 #include "netdev_module.h"
 #include "modules/osdmodule.h"
 
@@ -17,7 +19,8 @@ public:
 	}
 
 	virtual ~netdev_none() { }
-	virtual int init(const osd_options &options) override { return 0; }
+	virtual int init(const osd_options &options) override { add_nat_netdev(); return 0; }
+	virtual void exit() override { clear_netdev(); }
 };
 
 MODULE_DEFINITION(NETDEV_NONE, netdev_none)
@@ -115,7 +115,14 @@ public:
 	virtual void set_mac(const char *mac) override;
 protected:
 	virtual int recv_dev(uint8_t **buf) override;
+#ifndef SDLMAME_MACOSX
+	virtual int recv_dev_batch(int max) override;
+#endif
 private:
+#ifndef SDLMAME_MACOSX
+	static void queue_handler(u_char *user, const struct pcap_pkthdr *h, const u_char *bytes);
+#endif
+
 	pcap_t *m_p;
 #ifdef SDLMAME_MACOSX
 	struct netdev_pcap_context m_ctx;
@@ -237,6 +244,21 @@ int netdev_pcap::recv_dev(uint8_t **buf)
 #endif
 }
 
+#ifndef SDLMAME_MACOSX
+// take everything pcap has buffered in one call rather than a call per frame
+int netdev_pcap::recv_dev_batch(int max)
+{
+	if(!m_p) return 0;
+	int const count = (*module->pcap_dispatch_dl)(m_p, max, queue_handler, reinterpret_cast<u_char *>(this));
+	return (count > 0) ? count : 0;
+}
+
+void netdev_pcap::queue_handler(u_char *user, const struct pcap_pkthdr *h, const u_char *bytes)
+{
+	reinterpret_cast<netdev_pcap *>(user)->queue_frame(bytes, h->caplen);
+}
+#endif
+
 netdev_pcap::~netdev_pcap()
 {
 #ifdef SDLMAME_MACOSX
@@ -277,6 +299,7 @@ int pcap_module::init(const osd_options &options)
 		}
 		devs = devs->next;
 	}
+	add_nat_netdev();
 	return 0;
 }
 
@@ -349,6 +349,7 @@ int taptun_module::init(const osd_options &options)
 #else
 	add_netdev("tap", "TAP/TUN Device", create_tap);
 #endif
+	add_nat_netdev();
 	return 0;
 }
 
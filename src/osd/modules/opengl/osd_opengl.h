@@ -53,6 +53,7 @@
 		osd_gl_context() { }
 		virtual ~osd_gl_context() { }
 		virtual void MakeCurrent() = 0;
+		virtual void ReleaseCurrent() = 0;
 		virtual const char *LastErrorMsg() = 0;
 		virtual void *getProcAddress(const char *proc) = 0;
 		/*
@@ -20,6 +20,9 @@
 #elif defined(OSD_SDL)
 #include "render/draw13.h"
 #include "render/drawsdl.h"
+#if (USE_VULKAN)
+#include "render/drawvk.h"
+#endif
 #endif
 
 float osd_window::pixel_aspect() const
@@ -27,6 +30,128 @@ float osd_window::pixel_aspect() const
 	return monitor()->pixel_aspect();
 }
 
+int osd_window::draw_and_present(int update)
+{
+	int const result = renderer().draw(update);
+
+	// with vsync on, draw returns just after the swap, so the time it
+	// returns tracks the display's vertical blanking
+	osd_ticks_t const now = osd_ticks();
+	osd_ticks_t const last = m_last_present.exchange(now, std::memory_order_relaxed);
+	osd_ticks_t const period = m_present_period.load(std::memory_order_relaxed);
+	osd_ticks_t const interval = now - last;
+	if (last == 0)
+	{
+	}
+	else if (period == 0)
+	{
+		// only start from something that looks like a refresh interval
+		if ((interval > osd_ticks_per_second() / 250) && (interval < osd_ticks_per_second() / 20))
+			m_present_period.store(interval, std::memory_order_relaxed);
+	}
+	else if ((interval + period / PRESENT_TOLERANCE > period) && (interval < period + period / PRESENT_TOLERANCE))
+	{
+		m_present_period.store(period + (s64(interval) - s64(period)) / 16, std::memory_order_relaxed);
+		if (m_present_stable.load(std::memory_order_relaxed) < PRESENT_STABLE_COUNT)
+			m_present_stable.fetch_add(1, std::memory_order_relaxed);
+	}
+	else if ((interval + period / PRESENT_TOLERANCE) < period)
+	{
+		// presenting faster than the estimate means it's wrong, or vsync is off
+		m_present_period.store(0, std::memory_order_relaxed);
+		m_present_stable.store(0, std::memory_order_relaxed);
+	}
+	else
+	{
+		// a missed refresh doesn't change the estimate, but stop trusting it for a bit
+		m_present_stable.store(0, std::memory_order_relaxed);
+	}
+	return result;
+}
+
+bool osd_window::present_timing(osd_ticks_t &last_present, osd_ticks_t &period) const
+{
+	if (m_present_stable.load(std::memory_order_relaxed) < PRESENT_STABLE_COUNT)
+		return false;
+	last_present = m_last_present.load(std::memory_order_relaxed);
+	period = m_present_period.load(std::memory_order_relaxed);
+	return period != 0;
+}
+
+void osd_window::start_render_thread()
+{
+	if (m_render_thread.joinable() || !has_renderer() || !renderer().can_draw_on_thread())
+		return;
+
+	// let the render thread take over the renderer's context
+	renderer().release_thread();
+	m_render_pending = nullptr;
+	m_render_busy = false;
+	m_render_exit = false;
+	m_render_thread = std::thread([this] () { render_thread_main(); });
+}
+
+void osd_window::stop_render_thread()
+{
+	if (!m_render_thread.joinable())
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(m_render_mutex);
+		m_render_exit = true;
+	}
+	m_render_cv.notify_all();
+	m_render_thread.join();
+	m_render_thread = std::thread();
+}
+
+bool osd_window::submit_to_render_thread(render_primitive_list &primlist, int update, osd_ticks_t timeout)
+{
+	std::unique_lock<std::mutex> lock(m_render_mutex);
+
+	// wait for the previous frame if we're allowed to, otherwise drop this one
+	if (m_render_busy && timeout)
+	{
+		std::chrono::microseconds const limit(timeout * 1000000 / osd_ticks_per_second());
+		m_render_cv.wait_for(lock, limit, [this] () { return !m_render_busy; });
+	}
+	if (m_render_busy)
+		return false;
+
+	m_render_pending = &primlist;
+	m_render_update = update;
+	m_render_busy = true;
+	lock.unlock();
+	m_render_cv.notify_all();
+	return true;
+}
+
+void osd_window::render_thread_main()
+{
+	std::unique_lock<std::mutex> lock(m_render_mutex);
+	while (true)
+	{
+		m_render_cv.wait(lock, [this] () { return m_render_exit || m_render_pending; });
+		if (m_render_exit)
+			break;
+
+		// the render target keeps several lists, so this one stays intact while the next is built
+		m_primlist = m_render_pending;
+		int const update = m_render_update;
+		m_render_pending = nullptr;
+		lock.unlock();
+
+		draw_and_present(update);
+
+		lock.lock();
+		m_render_busy = false;
+		m_render_cv.notify_all();
+	}
+
+	// hand the renderer back to the thread that owns the window
+	renderer().release_thread();
+}
+
 std::unique_ptr<osd_renderer> osd_renderer::make_for_type(int mode, std::shared_ptr<osd_window> window, int extra_flags)
 {
 	switch(mode)
@@ -51,6 +176,10 @@ std::unique_ptr<osd_renderer> osd_renderer::make_for_type(int mode, std::shared_
 			return std::make_unique<renderer_sdl2>(window, extra_flags);
 		case VIDEO_MODE_SOFT:
 			return std::make_unique<renderer_sdl1>(window, extra_flags);
+#if (USE_VULKAN)
+		case VIDEO_MODE_VULKAN:
+			return std::make_unique<renderer_vulkan>(window);
+#endif
 #endif
 		default:
 			return nullptr;
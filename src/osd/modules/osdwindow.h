@@ -13,6 +13,11 @@
 #include "osdhelper.h"
 #include "../frontend/mame/ui/menuitem.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 // standard windows headers
 #ifdef OSD_WINDOWS
 #include <windows.h>
@@ -39,6 +44,9 @@ enum
 	VIDEO_MODE_BGFX,
 #if defined(USE_OPENGL) && USE_OPENGL
 	VIDEO_MODE_OPENGL,
+#endif
+#if defined(USE_VULKAN) && USE_VULKAN
+	VIDEO_MODE_VULKAN,
 #endif
 	VIDEO_MODE_SDL2ACCEL,
 	VIDEO_MODE_D3D,
@@ -75,10 +83,17 @@ public:
 		m_index(0),
 		m_prescale(1),
 		m_renderer(nullptr),
-		m_main(nullptr)
+		m_main(nullptr),
+		m_last_present(0),
+		m_present_period(0),
+		m_present_stable(0),
+		m_render_pending(nullptr),
+		m_render_update(0),
+		m_render_busy(false),
+		m_render_exit(false)
 		{}
 
-	virtual ~osd_window() { }
+	virtual ~osd_window() { stop_render_thread(); }
 
 	virtual render_target *target() = 0;
 	virtual int fullscreen() const = 0;
@@ -124,6 +139,20 @@ public:
 	virtual void update() = 0;
 	virtual void destroy() = 0;
 
+	// draw with the renderer and note when the frame was presented
+	int draw_and_present(int update);
+
+	// time of the last present and the measured interval between presents,
+	// once the interval has been steady for a while
+	bool present_timing(osd_ticks_t &last_present, osd_ticks_t &period) const;
+
+	// drawing on a separate thread, so the GPU driver doesn't hold up emulation;
+	// at most one frame is waiting or being drawn at a time
+	void start_render_thread();
+	void stop_render_thread();
+	bool render_threaded() const { return m_render_thread.joinable(); }
+	bool submit_to_render_thread(render_primitive_list &primlist, int update, osd_ticks_t timeout);
+
 #if defined(OSD_WINDOWS) || defined(OSD_UWP)
 	virtual bool win_has_menu() = 0;
 #endif
@@ -138,8 +167,26 @@ public:
 protected:
 	int                     m_prescale;
 private:
+	// presents within this fraction of the period count towards the estimate
+	static constexpr int PRESENT_TOLERANCE = 8;
+	// steady presents needed before the period is reported
+	static constexpr int PRESENT_STABLE_COUNT = 30;
+
 	std::unique_ptr<osd_renderer>  m_renderer;
 	std::shared_ptr<osd_window>    m_main;
+	std::atomic<osd_ticks_t>       m_last_present;     // time the last draw returned
+	std::atomic<osd_ticks_t>       m_present_period;   // smoothed interval between presents
+	std::atomic<int>               m_present_stable;   // consecutive presents close to the period
+
+	void render_thread_main();
+
+	std::thread                    m_render_thread;    // thread calling the renderer, if any
+	std::mutex                     m_render_mutex;     // protects the hand-over state below
+	std::condition_variable        m_render_cv;        // signalled on submission, completion and exit
+	render_primitive_list *        m_render_pending;   // list waiting to be drawn
+	int                            m_render_update;    // update flag for the pending list
+	bool                           m_render_busy;      // a list is waiting or being drawn
+	bool                           m_render_exit;      // the thread should stop
 };
 
 template <class TWindowHandle>
@@ -172,6 +219,7 @@ public:
 	static const int FLAG_NONE                  = 0x0000;
 	static const int FLAG_NEEDS_OPENGL          = 0x0001;
 	static const int FLAG_HAS_VECTOR_SCREEN     = 0x0002;
+	static const int FLAG_NEEDS_VULKAN          = 0x0004;
 
 	/* SDL 1.2 flags */
 	static const int FLAG_NEEDS_DOUBLEBUF       = 0x0100;
@@ -216,6 +264,11 @@ public:
 	virtual void toggle_fsfx() { };
 	virtual bool sliders_dirty() { return m_sliders_dirty; }
 
+	// renderers that can draw from a thread other than the one that created
+	// them return true, and give up any thread affinity in release_thread
+	virtual bool can_draw_on_thread() const { return false; }
+	virtual void release_thread() { }
+
 	static std::unique_ptr<osd_renderer> make_for_type(int mode, std::shared_ptr<osd_window> window, int extra_flags = FLAG_NONE);
 
 protected:
@@ -261,6 +314,8 @@ struct osd_video_config
 	int                 mode;                       // output mode
 	int                 waitvsync;                  // spin until vsync
 	int                 syncrefresh;                // sync only to refresh rate
+	int                 vrr;                        // display refresh follows our presents
+	int                 renderthread;               // draw on a separate thread
 	int                 switchres;                  // switch resolutions
 
 	// d3d, accel, opengl
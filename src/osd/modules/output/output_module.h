@@ -29,6 +29,9 @@ public:
 
 	virtual void notify(const char *outname, int32_t value) = 0;
 
+	// called once per frame, for modules that batch their notifications
+	virtual void update() { }
+
 	void set_machine(running_machine *machine) { m_machine = machine;  };
 	running_machine &machine() const { return *m_machine; }
 private:
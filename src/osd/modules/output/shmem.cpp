@@ -0,0 +1,237 @@
+// license:BSD-3-Clause
+// copyright-holders:Miodrag Milanovic
+/***************************************************************************
+
+    shmem.cpp
+
+    Shared memory output interface.
+
+    Publishes every output as a binary table in a named shared memory
+    block ("mame_outputs"; "/mame_outputs" under POSIX) so external
+    displays can read lamp and digit state without parsing a stream.
+    Changes are collected as they happen and written once per frame,
+    together with a ring of the individual changes for readers that want
+    every transition rather than the latest state.
+
+    The header's sequence counter is odd while a frame's changes are
+    being written.  Readers copy what they need between two reads of the
+    counter and retry if it was odd or moved.
+
+***************************************************************************/
+
+#include "output_module.h"
+#include "modules/osdmodule.h"
+#include "modules/lib/osdobj_common.h"
+
+#if defined(WIN32) || defined(__unix__) || defined(__APPLE__)
+
+#include "emu.h"
+
+#if defined(WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+namespace {
+
+//============================================================
+//  CONSTANTS
+//============================================================
+
+constexpr uint32_t TABLE_MAGIC = 0x54554f4d; // "MOUT"
+constexpr uint32_t TABLE_VERSION = 1;
+constexpr uint32_t MAX_OUTPUTS = 4096;
+constexpr uint32_t RING_SIZE = 16384;        // must be a power of two
+constexpr size_t NAME_LENGTH = 56;
+
+
+//============================================================
+//  TYPE DEFINITIONS
+//============================================================
+
+// layout of the shared block: header, then the output table, then the change ring
+struct table_header
+{
+	uint32_t                magic;          // TABLE_MAGIC
+	uint32_t                version;        // TABLE_VERSION
+	uint32_t                max_outputs;    // entries in the table
+	uint32_t                ring_size;      // entries in the change ring
+	std::atomic<uint32_t>   sequence;       // odd while being written
+	uint32_t                count;          // table entries in use
+	uint32_t                ring_head;      // changes written so far; the newest is at (ring_head - 1) % ring_size
+	uint32_t                frame;          // frames with changes published so far
+};
+
+struct table_entry
+{
+	char                    name[NAME_LENGTH];  // NUL-terminated output name
+	int32_t                 value;          // current value
+	uint32_t                frame;          // frame the value last changed in
+};
+
+struct change_entry
+{
+	uint32_t                index;          // table entry that changed
+	int32_t                 value;          // value it changed to
+};
+
+constexpr size_t TABLE_BYTES = sizeof(table_header) + MAX_OUTPUTS * sizeof(table_entry) + RING_SIZE * sizeof(change_entry);
+
+} // anonymous namespace
+
+
+//============================================================
+//  output_shmem
+//============================================================
+
+class output_shmem : public osd_module, public output_module
+{
+public:
+	output_shmem()
+	: osd_module(OSD_OUTPUT_PROVIDER, "shmem"), output_module(),
+	  m_block(nullptr), m_header(nullptr), m_table(nullptr), m_ring(nullptr)
+#if defined(WIN32)
+	  , m_mapping(nullptr)
+#endif
+	{
+	}
+	virtual ~output_shmem() { }
+
+	virtual int init(const osd_options &options) override
+	{
+#if defined(WIN32)
+		m_mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, DWORD(TABLE_BYTES), "mame_outputs");
+		if (m_mapping == nullptr)
+			return -1;
+		m_block = MapViewOfFile(m_mapping, FILE_MAP_ALL_ACCESS, 0, 0, TABLE_BYTES);
+		if (m_block == nullptr)
+		{
+			CloseHandle(m_mapping);
+			m_mapping = nullptr;
+			return -1;
+		}
+#else
+		int const fd = shm_open("/mame_outputs", O_CREAT | O_RDWR, 0644);
+		if (fd < 0)
+			return -1;
+		if (ftruncate(fd, TABLE_BYTES) != 0)
+		{
+			::close(fd);
+			return -1;
+		}
+		void *const block = mmap(nullptr, TABLE_BYTES, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		::close(fd);
+		if (block == MAP_FAILED)
+			return -1;
+		m_block = block;
+#endif
+
+		// start from an empty table; the magic goes in last so readers never see a half-built header
+		std::memset(m_block, 0, TABLE_BYTES);
+		m_header = reinterpret_cast<table_header *>(m_block);
+		m_table = reinterpret_cast<table_entry *>(m_header + 1);
+		m_ring = reinterpret_cast<change_entry *>(m_table + MAX_OUTPUTS);
+		m_header->version = TABLE_VERSION;
+		m_header->max_outputs = MAX_OUTPUTS;
+		m_header->ring_size = RING_SIZE;
+		m_header->sequence.store(0, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		m_header->magic = TABLE_MAGIC;
+		return 0;
+	}
+
+	virtual void exit() override
+	{
+		if (m_block == nullptr)
+			return;
+#if defined(WIN32)
+		UnmapViewOfFile(m_block);
+		CloseHandle(m_mapping);
+		m_mapping = nullptr;
+#else
+		munmap(m_block, TABLE_BYTES);
+		shm_unlink("/mame_outputs");
+#endif
+		m_block = nullptr;
+		m_header = nullptr;
+		m_table = nullptr;
+		m_ring = nullptr;
+	}
+
+	// output_module
+
+	virtual void notify(const char *outname, int32_t value) override
+	{
+		if (m_header == nullptr || outname == nullptr)
+			return;
+
+		// give new outputs a table entry; these only appear while a driver starts up
+		auto found = m_index.find(outname);
+		if (found == m_index.end())
+		{
+			if (m_index.size() >= MAX_OUTPUTS)
+				return;
+			found = m_index.emplace(outname, uint32_t(m_index.size())).first;
+			m_names.emplace_back(found->second, outname);
+		}
+		m_pending.push_back(change_entry{ found->second, value });
+	}
+
+	virtual void update() override
+	{
+		if (m_header == nullptr || (m_pending.empty() && m_names.empty()))
+			return;
+
+		uint32_t const sequence = m_header->sequence.load(std::memory_order_relaxed);
+		m_header->sequence.store(sequence + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		uint32_t const frame = m_header->frame + 1;
+		for (auto const &name : m_names)
+			std::strncpy(m_table[name.first].name, name.second.c_str(), NAME_LENGTH - 1);
+		m_header->count = uint32_t(m_index.size());
+
+		uint32_t head = m_header->ring_head;
+		for (change_entry const &change : m_pending)
+		{
+			m_table[change.index].value = change.value;
+			m_table[change.index].frame = frame;
+			m_ring[head++ & (RING_SIZE - 1)] = change;
+		}
+		m_header->ring_head = head;
+		m_header->frame = frame;
+
+		m_header->sequence.store(sequence + 2, std::memory_order_release);
+
+		m_names.clear();
+		m_pending.clear();
+	}
+
+private:
+	void *                                      m_block;        // mapped shared block
+	table_header *                              m_header;       // header at the start of the block
+	table_entry *                               m_table;        // output table
+	change_entry *                              m_ring;         // change ring
+#if defined(WIN32)
+	HANDLE                                      m_mapping;      // file mapping object
+#endif
+	std::unordered_map<std::string, uint32_t>   m_index;        // table entry for each output name
+	std::vector<std::pair<uint32_t, std::string>> m_names;      // entries named since the last update
+	std::vector<change_entry>                   m_pending;      // changes since the last update
+};
+
+#else
+	MODULE_NOT_SUPPORTED(output_shmem, OSD_OUTPUT_PROVIDER, "shmem")
+#endif
+
+MODULE_DEFINITION(OUTPUT_SHMEM, output_shmem)
@@ -28,6 +28,7 @@
 #include "suppressor.h"
 
 #include "render.h"
+#include "../frontend/mame/ui/slider.h"
 
 
 bgfx_chain_entry::bgfx_chain_entry(std::string name, bgfx_effect* effect, clear_state* clear, std::vector<bgfx_suppressor*> suppressors, std::vector<bgfx_input_pair*> inputs, std::vector<bgfx_entry_uniform*> uniforms, target_manager& targets, std::string output, bool apply_tint)
@@ -40,6 +41,9 @@ bgfx_chain_entry::bgfx_chain_entry(std::string name, bgfx_effect* effect, clear_
 	, m_targets(targets)
 	, m_output(output)
 	, m_apply_tint(apply_tint)
+	, m_last_view(-1)
+	, m_cached(false)
+	, m_gpu_time(0.0)
 {
 }
 
@@ -60,16 +64,12 @@ bgfx_chain_entry::~bgfx_chain_entry()
 
 void bgfx_chain_entry::submit(int view, chain_manager::screen_prim &prim, texture_manager& textures, uint16_t screen_count, uint16_t screen_width, uint16_t screen_height, float screen_scale_x, float screen_scale_y, float screen_offset_x, float screen_offset_y, uint32_t rotation_type, bool swap_xy, uint64_t blend, int32_t screen)
 {
-	if (!setup_view(textures, view, screen_width, screen_height, screen))
+	bgfx_target* output = m_targets.target(screen, m_output);
+	if (output != nullptr && output->width() == 0)
 	{
 		return;
 	}
 
-	for (bgfx_input_pair* input : m_inputs)
-	{
-		input->bind(m_effect, screen);
-	}
-
 	uint32_t tint = 0xffffffff;
 	if (m_apply_tint)
 	{
@@ -80,10 +80,6 @@ void bgfx_chain_entry::submit(int view, chain_manager::screen_prim &prim, textur
 		tint = (a << 24) | (b << 16) | (g << 8) | r;
 	}
 
-	bgfx::TransientVertexBuffer buffer;
-	put_screen_buffer(prim.m_screen_width, prim.m_screen_height, tint, &buffer);
-	bgfx::setVertexBuffer(0, &buffer);
-
 	setup_auto_uniforms(prim, textures, screen_count, screen_width, screen_height, screen_scale_x, screen_scale_y, screen_offset_x, screen_offset_y, rotation_type, swap_xy, screen);
 
 	for (bgfx_entry_uniform* uniform : m_uniforms)
@@ -94,14 +90,101 @@ void bgfx_chain_entry::submit(int view, chain_manager::screen_prim &prim, textur
 		}
 	}
 
+	// A pass rendering to a single-buffered target can be left out when nothing
+	// it reads has changed and nothing else has written its target since; the
+	// backbuffer is redrawn every frame and double-buffered targets feed back
+	// into themselves, so those passes always run
+	const bool cacheable = output != nullptr && !output->double_buffered();
+	uint64_t hash = 0;
+	if (cacheable)
+	{
+		while (size_t(screen) >= m_pass_states.size())
+		{
+			m_pass_states.push_back(pass_state{ 0, 0, false });
+		}
+		hash = state_hash(textures, output, prim, screen_width, screen_height, tint, blend, screen);
+		const pass_state &state = m_pass_states[screen];
+		if (state.m_valid && state.m_hash == hash && state.m_output_revision == output->revision())
+		{
+			m_last_view = -1;
+			m_cached = true;
+			return;
+		}
+	}
+
+	if (!setup_view(textures, view, screen_width, screen_height, screen))
+	{
+		return;
+	}
+
+	for (bgfx_input_pair* input : m_inputs)
+	{
+		input->bind(m_effect, screen);
+	}
+
+	bgfx::TransientVertexBuffer buffer;
+	put_screen_buffer(prim.m_screen_width, prim.m_screen_height, tint, &buffer);
+	bgfx::setVertexBuffer(0, &buffer);
+
 	m_effect->submit(view, blend);
+	m_last_view = view;
+	m_cached = false;
 
-	if (m_targets.target(screen, m_output) != nullptr)
+	if (output != nullptr)
 	{
-		m_targets.target(screen, m_output)->page_flip();
+		output->page_flip();
+	}
+
+	if (cacheable)
+	{
+		m_pass_states[screen] = pass_state{ hash, output->revision(), true };
 	}
 }
 
+uint64_t bgfx_chain_entry::state_hash(texture_manager& textures, bgfx_target* output, chain_manager::screen_prim &prim, uint16_t screen_width, uint16_t screen_height, uint32_t tint, uint64_t blend, int32_t screen) const
+{
+	// FNV-1a over everything that affects the pass output
+	uint64_t hash = 0xcbf29ce484222325ULL;
+	auto add = [&hash] (const void *data, size_t size)
+	{
+		const auto *bytes = reinterpret_cast<const uint8_t *>(data);
+		for (size_t i = 0; i < size; i++)
+		{
+			hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+		}
+	};
+
+	for (bgfx_input_pair* input : m_inputs)
+	{
+		std::string name = input->texture() + std::to_string(screen);
+		bgfx_texture_handle_provider* provider = textures.provider(name);
+		const uint32_t values[3] = {
+			provider ? provider->revision() : 0,
+			textures.handle(name).idx,
+			provider ? ((uint32_t(provider->width()) << 16) | provider->height()) : 0 };
+		add(values, sizeof(values));
+	}
+
+	for (const std::pair<const std::string, bgfx_uniform*> &uniform : m_effect->uniforms())
+	{
+		if (uniform.second->size() > 0)
+		{
+			add(uniform.second->data(), uniform.second->size());
+		}
+	}
+
+	const uint32_t values[5] = {
+		output->target().idx,
+		(uint32_t(output->width()) << 16) | output->height(),
+		(uint32_t(screen_width) << 16) | screen_height,
+		(uint32_t(prim.m_screen_width) << 16) | prim.m_screen_height,
+		tint };
+	add(values, sizeof(values));
+	add(&blend, sizeof(blend));
+
+	return hash;
+}
+
 void bgfx_chain_entry::setup_screensize_uniforms(texture_manager& textures, uint16_t screen_width, uint16_t screen_height, int32_t screen)
 {
 	float width = screen_width;
@@ -267,6 +350,7 @@ bool bgfx_chain_entry::setup_view(texture_manager &textures, int view, uint16_t
 		height = output->height();
 	}
 
+	bgfx::setViewName(view, m_name.c_str());
 	bgfx::setViewFrameBuffer(view, handle);
 	bgfx::setViewRect(view, 0, 0, width, height);
 
@@ -390,3 +474,51 @@ bool bgfx_chain_entry::skip()
 
 	return (and_count != 0 && and_suppressed == and_count) || or_suppress;
 }
+
+slider_state* bgfx_chain_entry::timing_slider()
+{
+	if (!m_timing_slider)
+	{
+		m_timing_slider = make_unique_clear<slider_state>();
+		m_timing_slider->minval = 0;
+		m_timing_slider->defval = 0;
+		m_timing_slider->maxval = 0;
+		m_timing_slider->incval = 1;
+
+		using namespace std::placeholders;
+		m_timing_slider->update = std::bind(&bgfx_chain_entry::timing_changed, this, _1, _2, _3, _4, _5);
+		m_timing_slider->arg = this;
+		m_timing_slider->id = 0;
+		m_timing_slider->description = m_name + " GPU Time";
+	}
+	return m_timing_slider.get();
+}
+
+int32_t bgfx_chain_entry::timing_changed(running_machine &machine, void *arg, int id, std::string *str, int32_t newval)
+{
+	if (str != nullptr)
+	{
+		*str = m_cached ? std::string("cached") : string_format("%.3f ms", m_gpu_time);
+	}
+	return 0;
+}
+
+void bgfx_chain_entry::update_timing(const bgfx::Stats* stats)
+{
+	if (m_last_view < 0 || stats->gpuTimerFreq <= 0)
+	{
+		return;
+	}
+
+	for (uint16_t index = 0; index < stats->numViews; index++)
+	{
+		const bgfx::ViewStats &view = stats->viewStats[index];
+		if (view.view == m_last_view)
+		{
+			// smooth over a few frames so the figure is readable
+			const double time = double(view.gpuTimeEnd - view.gpuTimeBegin) * 1000.0 / double(stats->gpuTimerFreq);
+			m_gpu_time += (time - m_gpu_time) * 0.1;
+			break;
+		}
+	}
+}
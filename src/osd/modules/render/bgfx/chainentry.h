@@ -16,6 +16,7 @@
 
 #include <bgfx/bgfx.h>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -30,6 +31,7 @@ class bgfx_suppressor;
 class clear_state;
 class texture_manager;
 class target_manager;
+struct slider_state;
 
 class bgfx_chain_entry
 {
@@ -43,8 +45,23 @@ public:
 	std::string name() const { return m_name; }
 	std::vector<bgfx_input_pair*>& inputs() { return m_inputs; }
 	bool skip();
+	slider_state* timing_slider();
+
+	// Picks up the GPU time of the last pass submitted from the renderer statistics
+	void update_timing(const bgfx::Stats* stats);
 
 private:
+	// Inputs, uniforms and outputs as seen by the last submitted pass for one screen
+	struct pass_state
+	{
+		uint64_t    m_hash;
+		uint32_t    m_output_revision;
+		bool        m_valid;
+	};
+
+	uint64_t state_hash(texture_manager& textures, bgfx_target* output, chain_manager::screen_prim &prim, uint16_t screen_width, uint16_t screen_height, uint32_t tint, uint64_t blend, int32_t screen) const;
+	int32_t timing_changed(running_machine &machine, void *arg, int id, std::string *str, int32_t newval);
+
 	void setup_auto_uniforms(chain_manager::screen_prim &prim, texture_manager& textures, uint16_t screen_count, uint16_t screen_width, uint16_t screen_height, float screen_scale_x, float screen_scale_y, float screen_offset_x, float screen_offset_y, uint32_t rotation_type, bool swap_xy, int32_t screen);
 	void setup_screensize_uniforms(texture_manager& textures, uint16_t screen_width, uint16_t screen_height, int32_t screen);
 	void setup_screenscale_uniforms(float screen_scale_x, float screen_scale_y);
@@ -70,6 +87,11 @@ private:
 	target_manager&                     m_targets;
 	std::string                         m_output;
 	bool                                m_apply_tint;
+	std::vector<pass_state>             m_pass_states;
+	int                                 m_last_view;
+	bool                                m_cached;
+	double                              m_gpu_time;
+	std::unique_ptr<slider_state>       m_timing_slider;
 };
 
 #endif // __DRAWBGFX_CHAIN_ENTRY__
@@ -464,9 +464,19 @@ uint32_t chain_manager::update_screen_textures(uint32_t view, render_primitive *
 			}
 		}
 
+		// screen textures alternate between two sources, so an upload can only be
+		// skipped when the same source comes round again with no new contents
+		while (screen >= m_screen_uploads.size())
+		{
+			m_screen_uploads.push_back(std::make_pair(nullptr, 0));
+		}
+		const std::pair<const void *, uint32_t> upload(prim.m_prim->texture.base, prim.m_prim->texture.seqid);
+		const bool unchanged = texture != nullptr && m_screen_uploads[screen] == upload;
+		m_screen_uploads[screen] = upload;
+
 		bgfx::TextureFormat::Enum dst_format = bgfx::TextureFormat::RGBA8;
 		uint16_t pitch = prim.m_rowpixels;
-		const bgfx::Memory* mem = bgfx_util::mame_texture_data_to_bgfx_texture_data(dst_format, prim.m_flags & PRIMFLAG_TEXFORMAT_MASK,
+		const bgfx::Memory* mem = unchanged ? nullptr : bgfx_util::mame_texture_data_to_bgfx_texture_data(dst_format, prim.m_flags & PRIMFLAG_TEXFORMAT_MASK,
 			prim.m_rowpixels, tex_height, prim.m_prim->texture.palette, prim.m_prim->texture.base, &pitch);
 
 		if (texture == nullptr)
@@ -500,7 +510,7 @@ uint32_t chain_manager::update_screen_textures(uint32_t view, render_primitive *
 				m_screen_palettes[screen] = palette;
 			}
 		}
-		else
+		else if (!unchanged)
 		{
 			texture->update(mem, pitch);
 
@@ -586,9 +596,30 @@ uint32_t chain_manager::process_screen_chains(uint32_t view, osd_window& window)
 
 	bgfx::setViewFrameBuffer(view + used_views, BGFX_INVALID_HANDLE);
 
+	if (m_options.bgfx_debug())
+	{
+		update_pass_timings();
+	}
+
 	return used_views;
 }
 
+void chain_manager::update_pass_timings()
+{
+	// view statistics are only gathered with the profiler enabled
+	const bgfx::Stats* stats = bgfx::getStats();
+	for (bgfx_chain* chain : m_screen_chains)
+	{
+		if (chain != nullptr)
+		{
+			for (bgfx_chain_entry* entry : chain->entries())
+			{
+				entry->update_timing(stats);
+			}
+		}
+	}
+}
+
 bool chain_manager::has_applicable_chain(uint32_t screen)
 {
 	return screen < m_screen_count && m_current_chain[screen] != CHAIN_NONE && m_screen_chains[screen] != nullptr;
@@ -705,7 +736,24 @@ std::vector<ui::menu_item> chain_manager::get_slider_list()
 			sliders.push_back(item);
 		}
 
-		if (chain_sliders.size() > 0)
+		if (m_options.bgfx_debug())
+		{
+			for (bgfx_chain_entry* entry : chain_entries)
+			{
+				slider_state* timing_slider = entry->timing_slider();
+
+				ui::menu_item item;
+				item.text = timing_slider->description;
+				item.subtext = "";
+				item.flags = 0;
+				item.ref = timing_slider;
+				item.type = ui::menu_item_type::SLIDER;
+
+				sliders.push_back(item);
+			}
+		}
+
+		if (chain_sliders.size() > 0 || (m_options.bgfx_debug() && !chain_entries.empty()))
 		{
 			ui::menu_item item;
 			item.text = MENU_SEPARATOR_ITEM;
@@ -129,6 +129,7 @@ private:
 
 	uint32_t count_screens(render_primitive* prim);
 	void process_screen_quad(uint32_t view, uint32_t screen, screen_prim &prim, osd_window& window);
+	void update_pass_timings();
 
 	running_machine&            m_machine;
 	osd_options&                m_options;
@@ -146,6 +147,7 @@ private:
 	std::vector<int32_t>        m_current_chain;
 	std::vector<bgfx_texture*>  m_screen_textures;
 	std::vector<bgfx_texture*>  m_screen_palettes;
+	std::vector<std::pair<const void *, uint32_t>> m_screen_uploads; // source base and sequence ID last uploaded per screen
 	std::vector<bgfx_effect*>   m_converters;
 	bgfx_effect *               m_adjuster;
 	std::vector<screen_prim>    m_screen_prims;
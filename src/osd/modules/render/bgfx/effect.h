@@ -27,6 +27,7 @@ public:
 
 	void submit(int view, uint64_t blend = 0L);
 	bgfx_uniform* uniform(std::string name);
+	const std::map<std::string, bgfx_uniform*>& uniforms() const { return m_uniforms; }
 
 private:
 	uint64_t                             m_state;
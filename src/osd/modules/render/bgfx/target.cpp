@@ -101,6 +101,7 @@ void bgfx_target::page_flip()
 	{
 		m_current_page = 1 - m_current_page;
 	}
+	contents_changed();
 }
 
 bgfx::FrameBufferHandle bgfx_target::target()
@@ -17,6 +17,7 @@
 class bgfx_texture_handle_provider
 {
 public:
+	bgfx_texture_handle_provider() : m_revision(next_revision()) { }
 	virtual ~bgfx_texture_handle_provider() { }
 
 	// Getters
@@ -25,6 +26,18 @@ public:
 	virtual uint16_t width() const = 0;
 	virtual uint16_t height() const = 0;
 	virtual uint16_t rowpixels() const = 0;
+
+	// Changes whenever the contents change; unique across all providers,
+	// so a recreated texture never matches the one it replaced
+	uint32_t revision() const { return m_revision; }
+
+protected:
+	void contents_changed() { m_revision = next_revision(); }
+
+private:
+	static uint32_t next_revision() { static uint32_t s_revision = 0; return ++s_revision; }
+
+	uint32_t m_revision;
 };
 
 #endif // __DRAWBGFX_TEXTURE_HANDLE_PROVIDER__
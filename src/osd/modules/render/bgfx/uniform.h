@@ -27,6 +27,8 @@ public:
 	std::string name() { return m_name; }
 	bgfx::UniformType::Enum type() const { return m_type; }
 	bgfx::UniformHandle handle() const { return m_handle; }
+	const uint8_t* data() const { return m_data; }
+	size_t size() const { return m_data_size; }
 
 	// Setters
 	bgfx_uniform* set(float* value);
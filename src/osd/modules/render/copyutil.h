@@ -11,16 +11,46 @@
 #ifndef __RENDER_COPYUTIL__
 #define __RENDER_COPYUTIL__
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
 
 class copy_util
 {
 public:
 	static inline void copyline_palette16(uint32_t *dst, const uint16_t *src, int width, const rgb_t *palette)
 	{
-		for (int x = 0; x < width; x++)
+		int x = 0;
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+		// swap red and blue within each pixel and force the alpha byte
+		const __m128i swap = _mm_setr_epi8(2, 1, 0, -1, 6, 5, 4, -1, 10, 9, 8, -1, 14, 13, 12, -1);
+		const __m128i alpha = _mm_set1_epi32(0xff000000);
+#endif
+#if defined(__AVX2__)
+		const __m256i swap8 = _mm256_broadcastsi128_si256(swap);
+		const __m256i alpha8 = _mm256_broadcastsi128_si256(alpha);
+		for ( ; (x + 8) <= width; x += 8)
+		{
+			const __m256i index = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src + x)));
+			const __m256i pixels = _mm256_i32gather_epi32(reinterpret_cast<const int *>(palette), index, 4);
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + x), _mm256_or_si256(_mm256_shuffle_epi8(pixels, swap8), alpha8));
+		}
+#elif defined(__SSSE3__)
+		for ( ; (x + 4) <= width; x += 4)
+		{
+			const __m128i pixels = _mm_setr_epi32(palette[src[x]], palette[src[x + 1]], palette[src[x + 2]], palette[src[x + 3]]);
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + x), _mm_or_si128(_mm_shuffle_epi8(pixels, swap), alpha));
+		}
+#endif
+
+		for ( ; x < width; x++)
 		{
-			rgb_t srcpixel = palette[*src++];
-			*dst++ = 0xff000000 | (srcpixel.b() << 16) | (srcpixel.g() << 8) | srcpixel.r();
+			rgb_t srcpixel = palette[src[x]];
+			dst[x] = 0xff000000 | (srcpixel.b() << 16) | (srcpixel.g() << 8) | srcpixel.r();
 		}
 	}
 
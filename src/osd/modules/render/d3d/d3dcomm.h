@@ -116,7 +116,7 @@ public:
 
 	uint32_t                get_flags() const { return m_flags; }
 
-	void                    set_data(const render_texinfo *texsource, uint32_t flags);
+	void                    set_data(const render_texinfo *texsource, uint32_t flags, bool partial = false);
 
 	uint32_t                get_hash() const { return m_hash; }
 
@@ -134,6 +134,8 @@ public:
 	vec2f &                 get_rawdims() { return m_rawdims; }
 
 private:
+	static const int DYNAMIC_RING = 3;
+
 	void prescale();
 	void compute_size(int texwidth, int texheight);
 	void compute_size_subroutine(int texwidth, int texheight, int* p_width, int* p_height);
@@ -162,6 +164,9 @@ private:
 	IDirect3DTexture9 *     m_d3dtex;                   // Direct3D texture pointer
 	IDirect3DSurface9 *     m_d3dsurface;               // Direct3D offscreen plain surface pointer
 	IDirect3DTexture9 *     m_d3dfinaltex;              // Direct3D final (post-scaled) texture
+	IDirect3DTexture9 *     m_d3dring[DYNAMIC_RING];    // dynamic textures locked in turn, so a lock doesn't wait on a frame in flight
+	int                     m_ringsize;                 // number of ring textures allocated
+	int                     m_ringindex;                // ring texture written last
 };
 
 /* poly_info holds information about a single polygon/d3d primitive */
@@ -304,8 +304,8 @@ int renderer_bgfx::create()
 		}
 		bgfx::init(init);
 		bgfx::reset(m_width[win->m_index], m_height[win->m_index], video_config.waitvsync ? BGFX_RESET_VSYNC : BGFX_RESET_NONE);
-		// Enable debug text.
-		bgfx::setDebug(m_options.bgfx_debug() ? BGFX_DEBUG_STATS : BGFX_DEBUG_TEXT);
+		// Enable debug text, and per-view timing for the post-processing passes
+		bgfx::setDebug(m_options.bgfx_debug() ? (BGFX_DEBUG_STATS | BGFX_DEBUG_PROFILER) : BGFX_DEBUG_TEXT);
 		m_dimensions = osd_dim(m_width[0], m_height[0]);
 	}
 
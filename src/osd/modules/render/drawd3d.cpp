@@ -603,7 +603,7 @@ void d3d_texture_manager::update_textures()
 				// if there is one, but with a different seqid, copy the data
 				if (texture->get_texinfo().seqid != prim.texture.seqid)
 				{
-					texture->set_data(&prim.texture, prim.flags);
+					texture->set_data(&prim.texture, prim.flags, prim.texture.partial_update(texture->get_texinfo().seqid));
 					texture->get_texinfo().seqid = prim.texture.seqid;
 				}
 			}
@@ -1907,6 +1907,16 @@ void renderer_d3d9::set_sliders_dirty()
 
 texture_info::~texture_info()
 {
+	// the ring owns the dynamic textures, whichever one is current
+	if (m_ringsize > 0)
+	{
+		if (m_d3dtex == m_d3dfinaltex)
+			m_d3dfinaltex = nullptr;
+		for (int i = 0; i < m_ringsize; i++)
+			m_d3dring[i]->Release();
+		m_d3dtex = nullptr;
+	}
+
 	if (m_d3dfinaltex != nullptr)
 	{
 		if (m_d3dtex == m_d3dfinaltex)
@@ -1943,6 +1953,8 @@ texture_info::texture_info(d3d_texture_manager *manager, const render_texinfo* t
 	m_d3dtex = nullptr;
 	m_d3dsurface = nullptr;
 	m_d3dfinaltex = nullptr;
+	m_ringsize = 0;
+	m_ringindex = 0;
 
 	// determine texture type, required to compute texture size
 	if (!PRIMFLAG_GET_SCREENTEX(flags))
@@ -2060,6 +2072,20 @@ texture_info::texture_info(d3d_texture_manager *manager, const render_texinfo* t
 				m_d3dtex = nullptr;
 			}
 		}
+
+		// add more dynamic textures of the same size, so each update can lock
+		// one the GPU has finished with instead of making the driver rename it
+		if (m_d3dtex != nullptr)
+		{
+			m_d3dring[m_ringsize++] = m_d3dtex;
+			while (m_ringsize < DYNAMIC_RING)
+			{
+				result = m_renderer->get_device()->CreateTexture(m_rawdims.c.x, m_rawdims.c.y, 1, usage, format, pool, &m_d3dring[m_ringsize], nullptr);
+				if (FAILED(result))
+					break;
+				m_ringsize++;
+			}
+		}
 	}
 
 	// copy the data to the texture
@@ -2354,16 +2380,39 @@ inline void texture_info::copyline_yuy16_to_argb(uint32_t *dst, const uint16_t *
 //  texture_set_data
 //============================================================
 
-void texture_info::set_data(const render_texinfo *texsource, uint32_t flags)
+void texture_info::set_data(const render_texinfo *texsource, uint32_t flags, bool partial)
 {
 	D3DLOCKED_RECT rect;
 	HRESULT result;
 
+	// work out which rows to copy; the discarding lock types must always be
+	// refilled completely, and the borders repeat the edge rows
+	int miny = 0 - m_yborderpix;
+	int maxy = texsource->height + m_yborderpix;
+	if (partial && m_type == TEXTURE_TYPE_PLAIN)
+	{
+		if (texsource->dirty_top != 0)
+			miny = texsource->dirty_top;
+		if (texsource->dirty_bottom != texsource->height - 1)
+			maxy = texsource->dirty_bottom + 1;
+	}
+	RECT lockrect = { 0, LONG(miny + m_yborderpix), LONG(m_rawdims.c.x), LONG(maxy + m_yborderpix) };
+
+	// move on to the next dynamic texture; an unprescaled one is also what gets drawn
+	if (m_type == TEXTURE_TYPE_DYNAMIC && m_ringsize > 1)
+	{
+		bool const unscaled = (m_d3dfinaltex == m_d3dtex);
+		m_ringindex = (m_ringindex + 1) % m_ringsize;
+		m_d3dtex = m_d3dring[m_ringindex];
+		if (unscaled)
+			m_d3dfinaltex = m_d3dtex;
+	}
+
 	// lock the texture
 	switch (m_type)
 	{
 		default:
-		case TEXTURE_TYPE_PLAIN:    result = m_d3dtex->LockRect(0, &rect, nullptr, 0);                 break;
+		case TEXTURE_TYPE_PLAIN:    result = m_d3dtex->LockRect(0, &rect, &lockrect, 0);               break;
 		case TEXTURE_TYPE_DYNAMIC:  result = m_d3dtex->LockRect(0, &rect, nullptr, D3DLOCK_DISCARD);   break;
 		case TEXTURE_TYPE_SURFACE:  result = m_d3dsurface->LockRect(&rect, nullptr, D3DLOCK_DISCARD);  break;
 	}
@@ -2382,14 +2431,14 @@ void texture_info::set_data(const render_texinfo *texsource, uint32_t flags)
 	else
 #endif
 	{
-		int miny = 0 - m_yborderpix;
-		int maxy = texsource->height + m_yborderpix;
+		// a plain texture was locked from miny, the others from the top
+		int const basey = (m_type == TEXTURE_TYPE_PLAIN) ? miny : -m_yborderpix;
 
 		for (int dsty = miny; dsty < maxy; dsty++)
 		{
 			int srcy = (dsty < 0) ? 0 : (dsty >= texsource->height) ? texsource->height - 1 : dsty;
 
-			void *dst = (BYTE *)rect.pBits + (dsty + m_yborderpix) * rect.Pitch;
+			void *dst = (BYTE *)rect.pBits + (dsty - basey) * rect.Pitch;
 
 			switch (tex_format)
 			{
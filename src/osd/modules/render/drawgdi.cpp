@@ -19,6 +19,10 @@ renderer_gdi::~renderer_gdi()
 	// free the bitmap memory
 	if (m_bmdata != nullptr)
 		global_free_array(m_bmdata);
+
+	// free the work queue
+	if (m_work_queue != nullptr)
+		osd_work_queue_free(m_work_queue);
 }
 
 //============================================================
@@ -37,6 +41,11 @@ int renderer_gdi::create()
 	m_bminfo.bmiHeader.biYPelsPerMeter   = 0;
 	m_bminfo.bmiHeader.biClrUsed         = 0;
 	m_bminfo.bmiHeader.biClrImportant    = 0;
+
+	// split drawing into bands if asked to
+	m_bands = assert_window()->machine().options().render_bands();
+	if (m_bands >= 2)
+		m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
 	return 0;
 }
 
@@ -89,7 +98,7 @@ int renderer_gdi::draw(const int update)
 
 	// draw the primitives to the bitmap
 	win->m_primlist->acquire_lock();
-	software_renderer<uint32_t, 0,0,0, 16,8,0>::draw_primitives(*win->m_primlist, m_bmdata, width, height, pitch);
+	software_renderer<uint32_t, 0,0,0, 16,8,0>::draw_primitives(*win->m_primlist, m_bmdata, width, height, pitch, m_work_queue, m_bands);
 	win->m_primlist->release_lock();
 
 	// fill in bitmap-specific info
@@ -32,6 +32,8 @@ public:
 		: osd_renderer(window, FLAG_NONE)
 		, m_bmdata(nullptr)
 		, m_bmsize(0)
+		, m_bands(0)
+		, m_work_queue(nullptr)
 	{
 	}
 	virtual ~renderer_gdi();
@@ -50,6 +52,8 @@ private:
 	BITMAPINFO              m_bminfo;
 	uint8_t *                 m_bmdata;
 	size_t                  m_bmsize;
+	int                     m_bands;
+	osd_work_queue *        m_work_queue;
 };
 
 #endif // __DRAWGDI__
@@ -111,6 +111,27 @@ typedef void (APIENTRYP PFNGLDELETERENDERBUFFERSEXTPROC) (GLsizei n, const GLuin
 #define GL_PIXEL_UNPACK_BUFFER_ARB        0x88EC
 #endif
 
+// GL_ARB_buffer_storage, GL_ARB_map_buffer_range and GL_ARB_sync, which
+// older headers don't have
+#ifndef GL_MAP_WRITE_BIT
+#define GL_MAP_WRITE_BIT                  0x0002
+#endif
+#ifndef GL_MAP_PERSISTENT_BIT
+#define GL_MAP_PERSISTENT_BIT             0x0040
+#define GL_MAP_COHERENT_BIT               0x0080
+#endif
+#ifndef GL_SYNC_GPU_COMMANDS_COMPLETE
+#define GL_SYNC_GPU_COMMANDS_COMPLETE     0x9117
+#define GL_SYNC_FLUSH_COMMANDS_BIT        0x00000001
+#endif
+
+typedef struct __GLsync *ogl_sync;
+typedef void (APIENTRYP ogl_buffer_storage_proc) (GLenum target, GLsizeiptr size, const void *data, GLbitfield flags);
+typedef void *(APIENTRYP ogl_map_buffer_range_proc) (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
+typedef ogl_sync (APIENTRYP ogl_fence_sync_proc) (GLenum condition, GLbitfield flags);
+typedef GLenum (APIENTRYP ogl_client_wait_sync_proc) (ogl_sync sync, GLbitfield flags, uint64_t timeout);
+typedef void (APIENTRYP ogl_delete_sync_proc) (ogl_sync sync);
+
 #ifndef GL_FRAMEBUFFER_EXT
 #define GL_FRAMEBUFFER_EXT              0x8D40
 #define GL_FRAMEBUFFER_COMPLETE_EXT         0x8CD5
@@ -263,6 +284,13 @@ static PFNGLBUFFERSUBDATAPROC pfn_glBufferSubData   = nullptr;
 static PFNGLMAPBUFFERPROC     pfn_glMapBuffer       = nullptr;
 static PFNGLUNMAPBUFFERPROC   pfn_glUnmapBuffer     = nullptr;
 
+// persistent PBO
+static ogl_buffer_storage_proc    pfn_glBufferStorage   = nullptr;
+static ogl_map_buffer_range_proc  pfn_glMapBufferRange  = nullptr;
+static ogl_fence_sync_proc        pfn_glFenceSync       = nullptr;
+static ogl_client_wait_sync_proc  pfn_glClientWaitSync  = nullptr;
+static ogl_delete_sync_proc       pfn_glDeleteSync      = nullptr;
+
 // FBO
 static PFNGLISFRAMEBUFFEREXTPROC   pfn_glIsFramebuffer          = nullptr;
 static PFNGLBINDFRAMEBUFFEREXTPROC pfn_glBindFramebuffer        = nullptr;
@@ -277,7 +305,7 @@ static int glsl_shader_feature = GLSL_SHADER_FEAT_PLAIN;
 //  Textures
 //============================================================
 
-static void texture_set_data(ogl_texture_info *texture, const render_texinfo *texsource, uint32_t flags);
+static void texture_set_data(ogl_texture_info *texture, const render_texinfo *texsource, uint32_t flags, uint32_t top, uint32_t bottom);
 
 //============================================================
 //  Static Variables
@@ -422,6 +450,7 @@ void renderer_ogl::initialize_gl()
 	m_texpoweroftwo = 1;
 	m_usevbo = 0;
 	m_usepbo = 0;
+	m_usepbo_persistent = 0;
 	m_usefbo = 0;
 	m_useglsl = 0;
 
@@ -504,6 +533,18 @@ void renderer_ogl::initialize_gl()
 		}
 	}
 
+	if (m_usepbo &&
+		strstr(extstr, "GL_ARB_buffer_storage") &&
+		strstr(extstr, "GL_ARB_map_buffer_range") &&
+		strstr(extstr, "GL_ARB_sync"))
+	{
+		m_usepbo_persistent = 1;
+		if (!s_shown_video_info)
+		{
+			osd_printf_verbose("OpenGL: persistent pixel buffers supported\n");
+		}
+	}
+
 	if (strstr(extstr, "GL_EXT_framebuffer_object"))
 	{
 		m_usefbo = 1;
@@ -578,7 +619,9 @@ int renderer_ogl::create()
 		osd_printf_error("%s\n", m_gl_context->LastErrorMsg());
 		return 1;
 	}
-	m_gl_context->SetSwapInterval(video_config.waitvsync ? 1 : 0);
+	// with variable refresh, prefer adaptive vsync so a late frame tears instead of waiting
+	if (!video_config.vrr || (m_gl_context->SetSwapInterval(-1) != 0))
+		m_gl_context->SetSwapInterval(video_config.waitvsync ? 1 : 0);
 
 
 	m_blittimer = 0;
@@ -671,7 +714,18 @@ void renderer_ogl::destroy_all_textures()
 
 			if(m_usepbo && texture->pbo)
 			{
-				pfn_glDeleteBuffers( 1, (GLuint *)&(texture->pbo) );
+				if (texture->pbo_map[0])
+				{
+					// deleting the buffers unmaps them
+					for (int j=0; j<ogl_texture_info::PBO_RING; j++)
+						if (texture->pbo_fence[j])
+							pfn_glDeleteSync((ogl_sync)texture->pbo_fence[j]);
+					pfn_glDeleteBuffers( ogl_texture_info::PBO_RING, (GLuint *)texture->pbo_ring );
+				}
+				else
+				{
+					pfn_glDeleteBuffers( 1, (GLuint *)&(texture->pbo) );
+				}
 				texture->pbo=0;
 			}
 
@@ -759,6 +813,14 @@ void renderer_ogl::loadGLExtensions()
 		pfn_glMapBuffer  = (PFNGLMAPBUFFERPROC) m_gl_context->getProcAddress("glMapBuffer");
 		pfn_glUnmapBuffer= (PFNGLUNMAPBUFFERPROC) m_gl_context->getProcAddress("glUnmapBuffer");
 	}
+	if ( m_usepbo_persistent )
+	{
+		pfn_glBufferStorage = (ogl_buffer_storage_proc) m_gl_context->getProcAddress("glBufferStorage");
+		pfn_glMapBufferRange = (ogl_map_buffer_range_proc) m_gl_context->getProcAddress("glMapBufferRange");
+		pfn_glFenceSync = (ogl_fence_sync_proc) m_gl_context->getProcAddress("glFenceSync");
+		pfn_glClientWaitSync = (ogl_client_wait_sync_proc) m_gl_context->getProcAddress("glClientWaitSync");
+		pfn_glDeleteSync = (ogl_delete_sync_proc) m_gl_context->getProcAddress("glDeleteSync");
+	}
 	// FBO:
 	if ( m_usefbo )
 	{
@@ -829,6 +891,44 @@ void renderer_ogl::loadGLExtensions()
 		}
 	}
 
+	if ( !m_usepbo )
+	{
+		m_usepbo_persistent=false;
+	}
+
+	if ( m_usepbo_persistent &&
+		( !pfn_glBufferStorage || !pfn_glMapBufferRange ||
+			!pfn_glFenceSync || !pfn_glClientWaitSync || !pfn_glDeleteSync
+		) )
+	{
+		m_usepbo_persistent=false;
+		if (_once)
+		{
+			osd_printf_warning("OpenGL: persistent PBO not supported, missing: ");
+			if (!pfn_glBufferStorage)
+			{
+				osd_printf_warning("glBufferStorage, ");
+			}
+			if (!pfn_glMapBufferRange)
+			{
+				osd_printf_warning("glMapBufferRange, ");
+			}
+			if (!pfn_glFenceSync)
+			{
+				osd_printf_warning("glFenceSync, ");
+			}
+			if (!pfn_glClientWaitSync)
+			{
+				osd_printf_warning("glClientWaitSync, ");
+			}
+			if (!pfn_glDeleteSync)
+			{
+				osd_printf_warning("glDeleteSync, ");
+			}
+			osd_printf_warning("\n");
+		}
+	}
+
 	if ( m_usefbo &&
 		( !pfn_glIsFramebuffer || !pfn_glBindFramebuffer || !pfn_glDeleteFramebuffers ||
 			!pfn_glGenFramebuffers || !pfn_glCheckFramebufferStatus || !pfn_glFramebufferTexture2D
@@ -879,7 +979,7 @@ void renderer_ogl::loadGLExtensions()
 
 		if ( m_usepbo )
 		{
-			osd_printf_verbose("OpenGL: PBO supported\n");
+			osd_printf_verbose("OpenGL: PBO supported%s\n", m_usepbo_persistent ? ", persistently mapped" : "");
 		}
 		else
 		{
@@ -2036,15 +2136,50 @@ ogl_texture_info *renderer_ogl::texture_create(const render_texinfo *texsource,
 	{
 		assert(m_usepbo);
 
-		// create the PBO
-		pfn_glGenBuffers(1, (GLuint *)&texture->pbo);
+		GLsizeiptr const size = texture->rawwidth * texture->rawheight * sizeof(uint32_t);
+
+		if ( m_usepbo_persistent )
+		{
+			// create a ring of PBOs that stay mapped; each update is converted
+			// straight into the next one while the GPU reads the others
+			GLbitfield const mapflags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+			bool mapped = true;
+
+			pfn_glGenBuffers(ogl_texture_info::PBO_RING, (GLuint *)texture->pbo_ring);
+			for (int i=0; i<ogl_texture_info::PBO_RING; i++)
+			{
+				pfn_glBindBuffer( GL_PIXEL_UNPACK_BUFFER_ARB, texture->pbo_ring[i]);
+				pfn_glBufferStorage(GL_PIXEL_UNPACK_BUFFER_ARB, size, nullptr, mapflags);
+				texture->pbo_map[i] = (uint32_t *) pfn_glMapBufferRange(GL_PIXEL_UNPACK_BUFFER_ARB, 0, size, mapflags);
+				mapped = mapped && texture->pbo_map[i];
+			}
 
-		pfn_glBindBuffer( GL_PIXEL_UNPACK_BUFFER_ARB, texture->pbo);
+			if (mapped)
+			{
+				texture->pbo = texture->pbo_ring[0];
+			}
+			else
+			{
+				// fall back to a single PBO mapped for each update
+				pfn_glDeleteBuffers(ogl_texture_info::PBO_RING, (GLuint *)texture->pbo_ring);
+				for (int i=0; i<ogl_texture_info::PBO_RING; i++)
+				{
+					texture->pbo_ring[i] = 0;
+					texture->pbo_map[i] = nullptr;
+				}
+			}
+		}
+
+		if ( !texture->pbo )
+		{
+			// create the PBO
+			pfn_glGenBuffers(1, (GLuint *)&texture->pbo);
+
+			pfn_glBindBuffer( GL_PIXEL_UNPACK_BUFFER_ARB, texture->pbo);
 
-		// set up the PBO dimension, ..
-		pfn_glBufferData(GL_PIXEL_UNPACK_BUFFER_ARB,
-							texture->rawwidth * texture->rawheight * sizeof(uint32_t),
-					nullptr, GL_STREAM_DRAW);
+			// set up the PBO dimension, ..
+			pfn_glBufferData(GL_PIXEL_UNPACK_BUFFER_ARB, size, nullptr, GL_STREAM_DRAW);
+		}
 	}
 
 	if ( !texture->nocopy && texture->type!=TEXTURE_TYPE_DYNAMIC )
@@ -2336,14 +2471,44 @@ static inline void copyline_yuy16_to_argb(uint32_t *dst, const uint16_t *src, in
 //  texture_set_data
 //============================================================
 
-static void texture_set_data(ogl_texture_info *texture, const render_texinfo *texsource, uint32_t flags)
+static void texture_set_data(ogl_texture_info *texture, const render_texinfo *texsource, uint32_t flags, uint32_t top, uint32_t bottom)
 {
+	// only rows top..bottom of the source are copied and uploaded; the
+	// borders are left alone unless the whole texture is being replaced
+	const bool full = (top == 0 && bottom == texsource->height - 1);
+	const int firstrow = full ? 0 : (top * texture->yprescale + texture->borderpix);
+	const int numrows = full ? texture->rawheight : ((bottom + 1 - top) * texture->yprescale);
+	const int rowlength = texture->nocopy ? texture->texinfo.rowpixels : texture->rawwidth;
+
 	if ( texture->type == TEXTURE_TYPE_DYNAMIC )
 	{
 		assert(texture->pbo);
 		assert(!texture->nocopy);
 
-		texture->data = (uint32_t *) pfn_glMapBuffer(GL_PIXEL_UNPACK_BUFFER_ARB, GL_WRITE_ONLY);
+		if (texture->pbo_map[0])
+		{
+			// move on to the next ring PBO, waiting only if the GPU is still reading it
+			texture->pbo_index = (texture->pbo_index + 1) % ogl_texture_info::PBO_RING;
+			ogl_sync const fence = (ogl_sync)texture->pbo_fence[texture->pbo_index];
+			if (fence)
+			{
+				pfn_glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+				pfn_glDeleteSync(fence);
+				texture->pbo_fence[texture->pbo_index] = nullptr;
+			}
+
+			texture->pbo = texture->pbo_ring[texture->pbo_index];
+			pfn_glBindBuffer( GL_PIXEL_UNPACK_BUFFER_ARB, texture->pbo);
+			texture->data = texture->pbo_map[texture->pbo_index];
+		}
+		else
+		{
+			// orphan the old contents so mapping doesn't wait for the GPU to finish with them
+			pfn_glBufferData(GL_PIXEL_UNPACK_BUFFER_ARB,
+								texture->rawwidth * texture->rawheight * sizeof(uint32_t),
+						nullptr, GL_STREAM_DRAW);
+			texture->data = (uint32_t *) pfn_glMapBuffer(GL_PIXEL_UNPACK_BUFFER_ARB, GL_WRITE_ONLY);
+		}
 	}
 
 	// note that nocopy and borderpix are mutually exclusive, IOW
@@ -2355,7 +2520,7 @@ static void texture_set_data(ogl_texture_info *texture, const render_texinfo *te
 	}
 
 	// always fill non-wrapping textures with an extra pixel on the top
-	if (texture->borderpix)
+	if (texture->borderpix && full)
 	{
 		memset(texture->data, 0,
 				(texsource->width * texture->xprescale + 2) * sizeof(uint32_t));
@@ -2367,7 +2532,7 @@ static void texture_set_data(ogl_texture_info *texture, const render_texinfo *te
 		int y, y2;
 		uint8_t *dst;
 
-		for (y = 0; y < texsource->height; y++)
+		for (y = top; y <= bottom; y++)
 		{
 			for (y2 = 0; y2 < texture->yprescale; y2++)
 			{
@@ -2400,7 +2565,7 @@ static void texture_set_data(ogl_texture_info *texture, const render_texinfo *te
 	}
 
 	// always fill non-wrapping textures with an extra pixel on the bottom
-	if (texture->borderpix)
+	if (texture->borderpix && full)
 	{
 		memset((uint8_t *)texture->data +
 				(texsource->height + 1) * texture->rawwidth * sizeof(uint32_t),
@@ -2418,9 +2583,9 @@ static void texture_set_data(ogl_texture_info *texture, const render_texinfo *te
 		else
 			glPixelStorei(GL_UNPACK_ROW_LENGTH, texture->rawwidth);
 
-		// and upload the image
-		glTexSubImage2D(texture->texTarget, 0, 0, 0, texture->rawwidth, texture->rawheight,
-				GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, texture->data);
+		// and upload the changed rows
+		glTexSubImage2D(texture->texTarget, 0, 0, firstrow, texture->rawwidth, numrows,
+				GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, texture->data + firstrow * rowlength);
 	}
 	else if ( texture->type == TEXTURE_TYPE_DYNAMIC )
 	{
@@ -2429,11 +2594,16 @@ static void texture_set_data(ogl_texture_info *texture, const render_texinfo *te
 		glPixelStorei(GL_UNPACK_ROW_LENGTH, texture->rawwidth);
 
 		// unmap the buffer from the CPU space so it can DMA
-		pfn_glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER_ARB);
+		if (!texture->pbo_map[0])
+			pfn_glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER_ARB);
 
 		// kick off the DMA
 		glTexSubImage2D(texture->texTarget, 0, 0, 0, texture->rawwidth, texture->rawheight,
 					GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, nullptr);
+
+		// a persistent PBO can't be written again until the GPU has read it
+		if (texture->pbo_map[0])
+			texture->pbo_fence[texture->pbo_index] = pfn_glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
 	}
 	else
 	{
@@ -2445,9 +2615,9 @@ static void texture_set_data(ogl_texture_info *texture, const render_texinfo *te
 		else
 			glPixelStorei(GL_UNPACK_ROW_LENGTH, texture->rawwidth);
 
-		// and upload the image
-		glTexSubImage2D(texture->texTarget, 0, 0, 0, texture->rawwidth, texture->rawheight,
-						GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, texture->data);
+		// and upload the changed rows
+		glTexSubImage2D(texture->texTarget, 0, 0, firstrow, texture->rawwidth, numrows,
+						GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, texture->data + firstrow * rowlength);
 	}
 }
 
@@ -2710,10 +2880,18 @@ ogl_texture_info * renderer_ogl::texture_update(const render_primitive *prim, in
 		{
 			if (prim->texture.base != nullptr && texture->texinfo.seqid != prim->texture.seqid)
 			{
+				// if we are exactly one update behind, only the dirty rows need copying;
+				// the PBO path maps and uploads the whole buffer, so it always copies everything
+				uint32_t top = 0, bottom = prim->texture.height - 1;
+				if (texture->type != TEXTURE_TYPE_DYNAMIC && prim->texture.partial_update(texture->texinfo.seqid))
+				{
+					top = prim->texture.dirty_top;
+					bottom = prim->texture.dirty_bottom;
+				}
 				texture->texinfo.seqid = prim->texture.seqid;
 
 				// if we found it, but with a different seqid, copy the data
-				texture_set_data(texture, &prim->texture, prim->flags);
+				texture_set_data(texture, &prim->texture, prim->flags, top, bottom);
 				texBound=1;
 			}
 		}
@@ -47,9 +47,15 @@ public:
 	:   hash(0), flags(0), rawwidth(0), rawheight(0),
 		rawwidth_create(0), rawheight_create(0),
 		type(0), format(0), borderpix(0), xprescale(0), yprescale(0), nocopy(0),
-		texture(0), texTarget(0), texpow2(0), mpass_dest_idx(0), pbo(0), data(nullptr),
+		texture(0), texTarget(0), texpow2(0), mpass_dest_idx(0), pbo(0), pbo_index(0), data(nullptr),
 		data_own(0), texCoordBufferName(0)
 	{
+		for (int i=0; i<PBO_RING; i++)
+		{
+			pbo_ring[i] = 0;
+			pbo_map[i] = nullptr;
+			pbo_fence[i] = nullptr;
+		}
 		for (int i=0; i<2; i++)
 		{
 			mpass_textureunit[i] = 0;
@@ -88,7 +94,13 @@ public:
 	uint32_t              mpass_texture_scrn[2];  // Multipass OpenGL texture "name"/ID for the shader
 	uint32_t              mpass_fbo_scrn[2];      // framebuffer object for this texture, multipass
 
+	static const int PBO_RING = 3;                // persistent PBOs per texture, so the CPU never waits on the one being read
+
 	uint32_t              pbo;                    // pixel buffer object for this texture (DYNAMIC only!)
+	uint32_t              pbo_ring[PBO_RING];     // persistently mapped PBOs, written in turn (DYNAMIC only!)
+	uint32_t              *pbo_map[PBO_RING];     // where each ring PBO is mapped, nullptr if not persistent
+	void                  *pbo_fence[PBO_RING];   // GLsync for the last upload from each ring PBO
+	int                   pbo_index;              // ring PBO written last
 	uint32_t              *data;                  // pixels for the texture
 	int                 data_own;               // do we own / allocated it ?
 	GLfloat             texCoord[8];
@@ -114,6 +126,7 @@ public:
 		, m_texpoweroftwo(0)
 		, m_usevbo(0)
 		, m_usepbo(0)
+		, m_usepbo_persistent(0)
 		, m_usefbo(0)
 		, m_useglsl(0)
 		, m_glsl(nullptr)
@@ -141,6 +154,10 @@ public:
 	virtual int create() override;
 	virtual int draw(const int update) override;
 
+	// draw makes the context current, so it can be called from any one thread at a time
+	virtual bool can_draw_on_thread() const override { return true; }
+	virtual void release_thread() override { if (m_gl_context) m_gl_context->ReleaseCurrent(); }
+
 #ifndef OSD_WINDOWS
 	virtual int xy_to_render_target(const int x, const int y, int *xt, int *yt) override;
 #endif
@@ -210,6 +227,7 @@ private:
 	int             m_texpoweroftwo;          // must textures be power-of-2 sized?
 	int             m_usevbo;         // runtime check if VBO is available
 	int             m_usepbo;         // runtime check if PBO is available
+	int             m_usepbo_persistent; // runtime check if PBOs can stay mapped (GL_ARB_buffer_storage)
 	int             m_usefbo;         // runtime check if FBO is available
 	int             m_useglsl;        // runtime check if GLSL is available
 
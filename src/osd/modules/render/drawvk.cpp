@@ -0,0 +1,1350 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+//============================================================
+//
+//  drawvk.cpp - native Vulkan renderer
+//
+//============================================================
+
+#include "emu.h"
+#include "render.h"
+#include "rendutil.h"
+#include "options.h"
+
+// OSD headers
+#include "osdsdl.h"
+#include "window.h"
+
+#include "drawvk.h"
+#include "copyutil.h"
+
+#include <SDL2/SDL_vulkan.h>
+
+#include "vulkan/vk_primitive.vert.h"
+#include "vulkan/vk_primitive.frag.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+//============================================================
+//  CONSTANTS
+//============================================================
+
+// initial sizes; both grow when a frame needs more
+static constexpr VkDeviceSize STAGING_SIZE = 8 * 1024 * 1024;
+static constexpr VkDeviceSize VERTEX_SIZE = 64 * 1024;
+
+static constexpr uint32_t MAX_TEXTURES = 1024;
+
+
+//============================================================
+//  INLINES
+//============================================================
+
+static inline uint8_t color_byte(float value)
+{
+	return uint8_t(std::min(std::max(value, 0.0f), 1.0f) * 255.0f + 0.5f);
+}
+
+static inline uint64_t texture_key(const render_primitive &prim)
+{
+	// the same texture can be drawn with different sampling
+	const bool filter = video_config.filter;
+	const bool wrap = PRIMFLAG_GET_TEXWRAP(prim.flags);
+	return (prim.texture.unique_id << 2) | (filter ? 1 : 0) | (wrap ? 2 : 0);
+}
+
+
+//============================================================
+//  CONSTRUCTOR & DESTRUCTOR
+//============================================================
+
+renderer_vulkan::renderer_vulkan(std::shared_ptr<osd_window> window)
+	: osd_renderer(window, FLAG_NEEDS_VULKAN)
+	, m_width(0)
+	, m_height(0)
+	, m_blit_dim(0, 0)
+	, m_instance(VK_NULL_HANDLE)
+	, m_surface(VK_NULL_HANDLE)
+	, m_physical_device(VK_NULL_HANDLE)
+	, m_queue_family(0)
+	, m_device(VK_NULL_HANDLE)
+	, m_queue(VK_NULL_HANDLE)
+	, m_swapchain(VK_NULL_HANDLE)
+	, m_swapchain_format(VK_FORMAT_UNDEFINED)
+	, m_swapchain_extent{ 0, 0 }
+	, m_present_mode(VK_PRESENT_MODE_FIFO_KHR)
+	, m_swapchain_stale(false)
+	, m_render_pass(VK_NULL_HANDLE)
+	, m_descriptor_layout(VK_NULL_HANDLE)
+	, m_descriptor_pool(VK_NULL_HANDLE)
+	, m_pipeline_layout(VK_NULL_HANDLE)
+	, m_command_pool(VK_NULL_HANDLE)
+	, m_frame_index(0)
+	, m_frame_count(0)
+{
+	memset(&m_memory_properties, 0, sizeof(m_memory_properties));
+	std::fill(std::begin(m_pipelines), std::end(m_pipelines), VkPipeline(VK_NULL_HANDLE));
+	std::fill(std::begin(m_samplers), std::end(m_samplers), VkSampler(VK_NULL_HANDLE));
+}
+
+renderer_vulkan::~renderer_vulkan()
+{
+	if (m_device != VK_NULL_HANDLE)
+	{
+		m_vk.DeviceWaitIdle(m_device);
+
+		destroy_all_textures();
+		for (auto &retired : m_retired)
+			destroy_texture(std::move(retired.second));
+		m_retired.clear();
+		if (m_white)
+			destroy_texture(std::move(m_white));
+
+		for (frame_state &frame : m_frames)
+		{
+			destroy_mapped_buffer(frame.staging);
+			destroy_mapped_buffer(frame.vertices);
+			if (frame.fence != VK_NULL_HANDLE)
+				m_vk.DestroyFence(m_device, frame.fence, nullptr);
+			if (frame.acquired != VK_NULL_HANDLE)
+				m_vk.DestroySemaphore(m_device, frame.acquired, nullptr);
+		}
+		if (m_command_pool != VK_NULL_HANDLE)
+			m_vk.DestroyCommandPool(m_device, m_command_pool, nullptr);
+
+		for (VkPipeline pipeline : m_pipelines)
+			if (pipeline != VK_NULL_HANDLE)
+				m_vk.DestroyPipeline(m_device, pipeline, nullptr);
+		for (VkSampler sampler : m_samplers)
+			if (sampler != VK_NULL_HANDLE)
+				m_vk.DestroySampler(m_device, sampler, nullptr);
+		if (m_pipeline_layout != VK_NULL_HANDLE)
+			m_vk.DestroyPipelineLayout(m_device, m_pipeline_layout, nullptr);
+		if (m_descriptor_pool != VK_NULL_HANDLE)
+			m_vk.DestroyDescriptorPool(m_device, m_descriptor_pool, nullptr);
+		if (m_descriptor_layout != VK_NULL_HANDLE)
+			m_vk.DestroyDescriptorSetLayout(m_device, m_descriptor_layout, nullptr);
+
+		destroy_swapchain();
+		if (m_render_pass != VK_NULL_HANDLE)
+			m_vk.DestroyRenderPass(m_device, m_render_pass, nullptr);
+
+		m_vk.DestroyDevice(m_device, nullptr);
+	}
+
+	if (m_instance != VK_NULL_HANDLE)
+	{
+		if (m_surface != VK_NULL_HANDLE)
+			m_vk.DestroySurfaceKHR(m_instance, m_surface, nullptr);
+		m_vk.DestroyInstance(m_instance, nullptr);
+	}
+}
+
+
+//============================================================
+//  init/exit
+//============================================================
+
+void renderer_vulkan::init(running_machine &machine)
+{
+	// SDL loads the Vulkan library when the first window is created
+}
+
+void renderer_vulkan::exit()
+{
+}
+
+
+//============================================================
+//  create
+//============================================================
+
+int renderer_vulkan::create()
+{
+	if (!create_instance() || !choose_device() || !create_device())
+		return 1;
+
+	auto win = assert_window();
+	osd_dim wdim = win->get_size();
+	m_width = wdim.width();
+	m_height = wdim.height();
+
+	if (!create_swapchain() || !create_pipelines() || !create_frames())
+		return 1;
+
+	// untextured primitives sample a single white texel
+	m_white = create_texture(1, 1, false, false);
+	if (!m_white)
+		return 1;
+
+	osd_printf_verbose("Vulkan: %ux%u swapchain of %u images, %s present mode\n",
+			m_swapchain_extent.width, m_swapchain_extent.height, unsigned(m_swapchain_views.size()),
+			(m_present_mode == VK_PRESENT_MODE_MAILBOX_KHR) ? "mailbox" : (m_present_mode == VK_PRESENT_MODE_IMMEDIATE_KHR) ? "immediate" : "FIFO");
+	return 0;
+}
+
+
+//============================================================
+//  create_instance
+//============================================================
+
+bool renderer_vulkan::create_instance()
+{
+	auto win = std::static_pointer_cast<sdl_window_info>(assert_window());
+
+	auto const get_instance_proc = reinterpret_cast<PFN_vkGetInstanceProcAddr>(SDL_Vulkan_GetVkGetInstanceProcAddr());
+	if (!get_instance_proc)
+	{
+		osd_printf_error("Vulkan: unable to load the Vulkan library: %s\n", SDL_GetError());
+		return false;
+	}
+	auto const create_instance = reinterpret_cast<PFN_vkCreateInstance>(get_instance_proc(VK_NULL_HANDLE, "vkCreateInstance"));
+
+	unsigned extension_count = 0;
+	SDL_Vulkan_GetInstanceExtensions(win->platform_window(), &extension_count, nullptr);
+	std::vector<const char *> extensions(extension_count);
+	if (!SDL_Vulkan_GetInstanceExtensions(win->platform_window(), &extension_count, extensions.data()))
+	{
+		osd_printf_error("Vulkan: unable to get instance extensions: %s\n", SDL_GetError());
+		return false;
+	}
+
+	VkApplicationInfo app_info = { VK_STRUCTURE_TYPE_APPLICATION_INFO };
+	app_info.pApplicationName = emulator_info::get_appname();
+	app_info.pEngineName = emulator_info::get_appname();
+	app_info.apiVersion = VK_API_VERSION_1_0;
+
+	VkInstanceCreateInfo instance_info = { VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO };
+	instance_info.pApplicationInfo = &app_info;
+	instance_info.enabledExtensionCount = extension_count;
+	instance_info.ppEnabledExtensionNames = extensions.data();
+	if (!create_instance || create_instance(&instance_info, nullptr, &m_instance) != VK_SUCCESS)
+	{
+		osd_printf_error("Vulkan: unable to create instance\n");
+		return false;
+	}
+
+#define VULKAN_LOAD_INSTANCE(name) m_vk.name = reinterpret_cast<PFN_vk##name>(get_instance_proc(m_instance, "vk" #name));
+	VULKAN_INSTANCE_FUNCTIONS(VULKAN_LOAD_INSTANCE)
+#undef VULKAN_LOAD_INSTANCE
+
+	if (!SDL_Vulkan_CreateSurface(win->platform_window(), m_instance, &m_surface))
+	{
+		osd_printf_error("Vulkan: unable to create surface: %s\n", SDL_GetError());
+		return false;
+	}
+	return true;
+}
+
+
+//============================================================
+//  choose_device - find a device that can draw to
+//  and present on our surface, preferring discrete
+//============================================================
+
+bool renderer_vulkan::choose_device()
+{
+	uint32_t count = 0;
+	m_vk.EnumeratePhysicalDevices(m_instance, &count, nullptr);
+	std::vector<VkPhysicalDevice> devices(count);
+	m_vk.EnumeratePhysicalDevices(m_instance, &count, devices.data());
+
+	int best_score = -1;
+	for (VkPhysicalDevice device : devices)
+	{
+		uint32_t extension_count = 0;
+		m_vk.EnumerateDeviceExtensionProperties(device, nullptr, &extension_count, nullptr);
+		std::vector<VkExtensionProperties> extensions(extension_count);
+		m_vk.EnumerateDeviceExtensionProperties(device, nullptr, &extension_count, extensions.data());
+		bool const has_swapchain = std::any_of(extensions.begin(), extensions.end(),
+				[] (VkExtensionProperties const &ext) { return !strcmp(ext.extensionName, VK_KHR_SWAPCHAIN_EXTENSION_NAME); });
+		if (!has_swapchain)
+			continue;
+
+		uint32_t family_count = 0;
+		m_vk.GetPhysicalDeviceQueueFamilyProperties(device, &family_count, nullptr);
+		std::vector<VkQueueFamilyProperties> families(family_count);
+		m_vk.GetPhysicalDeviceQueueFamilyProperties(device, &family_count, families.data());
+		for (uint32_t family = 0; family < family_count; family++)
+		{
+			VkBool32 present = VK_FALSE;
+			m_vk.GetPhysicalDeviceSurfaceSupportKHR(device, family, m_surface, &present);
+			if (!present || !(families[family].queueFlags & VK_QUEUE_GRAPHICS_BIT))
+				continue;
+
+			VkPhysicalDeviceProperties properties;
+			m_vk.GetPhysicalDeviceProperties(device, &properties);
+			int const score = (properties.deviceType == VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU) ? 2 :
+					(properties.deviceType == VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU) ? 1 : 0;
+			if (score > best_score)
+			{
+				best_score = score;
+				m_physical_device = device;
+				m_queue_family = family;
+			}
+			break;
+		}
+	}
+
+	if (m_physical_device == VK_NULL_HANDLE)
+	{
+		osd_printf_error("Vulkan: no device can present to this window\n");
+		return false;
+	}
+
+	VkPhysicalDeviceProperties properties;
+	m_vk.GetPhysicalDeviceProperties(m_physical_device, &properties);
+	m_vk.GetPhysicalDeviceMemoryProperties(m_physical_device, &m_memory_properties);
+	osd_printf_verbose("Vulkan: using %s\n", properties.deviceName);
+	return true;
+}
+
+
+//============================================================
+//  create_device
+//============================================================
+
+bool renderer_vulkan::create_device()
+{
+	float const priority = 1.0f;
+	VkDeviceQueueCreateInfo queue_info = { VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO };
+	queue_info.queueFamilyIndex = m_queue_family;
+	queue_info.queueCount = 1;
+	queue_info.pQueuePriorities = &priority;
+
+	const char *const extensions[] = { VK_KHR_SWAPCHAIN_EXTENSION_NAME };
+	VkDeviceCreateInfo device_info = { VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO };
+	device_info.queueCreateInfoCount = 1;
+	device_info.pQueueCreateInfos = &queue_info;
+	device_info.enabledExtensionCount = 1;
+	device_info.ppEnabledExtensionNames = extensions;
+	if (m_vk.CreateDevice(m_physical_device, &device_info, nullptr, &m_device) != VK_SUCCESS)
+	{
+		osd_printf_error("Vulkan: unable to create device\n");
+		return false;
+	}
+
+#define VULKAN_LOAD_DEVICE(name) m_vk.name = reinterpret_cast<PFN_vk##name>(m_vk.GetDeviceProcAddr(m_device, "vk" #name));
+	VULKAN_DEVICE_FUNCTIONS(VULKAN_LOAD_DEVICE)
+#undef VULKAN_LOAD_DEVICE
+
+	m_vk.GetDeviceQueue(m_device, m_queue_family, 0, &m_queue);
+	return true;
+}
+
+
+//============================================================
+//  create_swapchain - (re)create the swapchain for the
+//  current window size
+//============================================================
+
+bool renderer_vulkan::create_swapchain()
+{
+	VkSurfaceCapabilitiesKHR caps;
+	m_vk.GetPhysicalDeviceSurfaceCapabilitiesKHR(m_physical_device, m_surface, &caps);
+
+	VkExtent2D extent = caps.currentExtent;
+	if (extent.width == 0xffffffff)
+	{
+		extent.width = std::min(std::max(uint32_t(m_width), caps.minImageExtent.width), caps.maxImageExtent.width);
+		extent.height = std::min(std::max(uint32_t(m_height), caps.minImageExtent.height), caps.maxImageExtent.height);
+	}
+	if (extent.width == 0 || extent.height == 0)
+		return true; // minimised; try again when the window comes back
+
+	// first pass only: pick the format the render pass is built for
+	if (m_swapchain_format == VK_FORMAT_UNDEFINED)
+	{
+		uint32_t count = 0;
+		m_vk.GetPhysicalDeviceSurfaceFormatsKHR(m_physical_device, m_surface, &count, nullptr);
+		std::vector<VkSurfaceFormatKHR> formats(count);
+		m_vk.GetPhysicalDeviceSurfaceFormatsKHR(m_physical_device, m_surface, &count, formats.data());
+		if (formats.empty())
+		{
+			osd_printf_error("Vulkan: surface has no formats\n");
+			return false;
+		}
+		m_swapchain_format = (formats[0].format == VK_FORMAT_UNDEFINED) ? VK_FORMAT_B8G8R8A8_UNORM : formats[0].format;
+		for (VkSurfaceFormatKHR const &format : formats)
+		{
+			if ((format.format == VK_FORMAT_B8G8R8A8_UNORM || format.format == VK_FORMAT_R8G8B8A8_UNORM) && format.colorSpace == VK_COLOR_SPACE_SRGB_NONLINEAR_KHR)
+			{
+				m_swapchain_format = format.format;
+				break;
+			}
+		}
+	}
+
+	// with vsync the display paces us; otherwise mailbox replaces queued frames
+	// with newer ones without tearing, and immediate is the fallback
+	uint32_t mode_count = 0;
+	m_vk.GetPhysicalDeviceSurfacePresentModesKHR(m_physical_device, m_surface, &mode_count, nullptr);
+	std::vector<VkPresentModeKHR> modes(mode_count);
+	m_vk.GetPhysicalDeviceSurfacePresentModesKHR(m_physical_device, m_surface, &mode_count, modes.data());
+	auto const has_mode = [&modes] (VkPresentModeKHR mode) { return std::find(modes.begin(), modes.end(), mode) != modes.end(); };
+	m_present_mode = VK_PRESENT_MODE_FIFO_KHR;
+	if (!video_config.waitvsync)
+	{
+		if (has_mode(VK_PRESENT_MODE_MAILBOX_KHR))
+			m_present_mode = VK_PRESENT_MODE_MAILBOX_KHR;
+		else if (has_mode(VK_PRESENT_MODE_IMMEDIATE_KHR))
+			m_present_mode = VK_PRESENT_MODE_IMMEDIATE_KHR;
+	}
+
+	uint32_t image_count = caps.minImageCount + 1;
+	if (caps.maxImageCount != 0)
+		image_count = std::min(image_count, caps.maxImageCount);
+
+	VkCompositeAlphaFlagBitsKHR composite = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
+	if (!(caps.supportedCompositeAlpha & composite))
+		composite = VkCompositeAlphaFlagBitsKHR(caps.supportedCompositeAlpha & -caps.supportedCompositeAlpha);
+
+	VkSwapchainKHR const old_swapchain = m_swapchain;
+	VkSwapchainCreateInfoKHR swapchain_info = { VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR };
+	swapchain_info.surface = m_surface;
+	swapchain_info.minImageCount = image_count;
+	swapchain_info.imageFormat = m_swapchain_format;
+	swapchain_info.imageColorSpace = VK_COLOR_SPACE_SRGB_NONLINEAR_KHR;
+	swapchain_info.imageExtent = extent;
+	swapchain_info.imageArrayLayers = 1;
+	swapchain_info.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+	swapchain_info.imageSharingMode = VK_SHARING_MODE_EXCLUSIVE;
+	swapchain_info.preTransform = caps.currentTransform;
+	swapchain_info.compositeAlpha = composite;
+	swapchain_info.presentMode = m_present_mode;
+	swapchain_info.clipped = VK_TRUE;
+	swapchain_info.oldSwapchain = old_swapchain;
+	VkSwapchainKHR swapchain;
+	if (m_vk.CreateSwapchainKHR(m_device, &swapchain_info, nullptr, &swapchain) != VK_SUCCESS)
+	{
+		osd_printf_error("Vulkan: unable to create swapchain\n");
+		return false;
+	}
+	destroy_swapchain();
+	m_swapchain = swapchain;
+	m_swapchain_extent = extent;
+	m_swapchain_stale = false;
+
+	if (m_render_pass == VK_NULL_HANDLE)
+	{
+		VkAttachmentDescription attachment = { };
+		attachment.format = m_swapchain_format;
+		attachment.samples = VK_SAMPLE_COUNT_1_BIT;
+		attachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+		attachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+		attachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+		attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+		attachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		attachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+
+		VkAttachmentReference color_ref = { 0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL };
+		VkSubpassDescription subpass = { };
+		subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+		subpass.colorAttachmentCount = 1;
+		subpass.pColorAttachments = &color_ref;
+
+		// the image comes back from the presentation engine at this stage
+		VkSubpassDependency dependency = { };
+		dependency.srcSubpass = VK_SUBPASS_EXTERNAL;
+		dependency.dstSubpass = 0;
+		dependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+		dependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+		dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+
+		VkRenderPassCreateInfo pass_info = { VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO };
+		pass_info.attachmentCount = 1;
+		pass_info.pAttachments = &attachment;
+		pass_info.subpassCount = 1;
+		pass_info.pSubpasses = &subpass;
+		pass_info.dependencyCount = 1;
+		pass_info.pDependencies = &dependency;
+		if (m_vk.CreateRenderPass(m_device, &pass_info, nullptr, &m_render_pass) != VK_SUCCESS)
+		{
+			osd_printf_error("Vulkan: unable to create render pass\n");
+			return false;
+		}
+	}
+
+	uint32_t count = 0;
+	m_vk.GetSwapchainImagesKHR(m_device, m_swapchain, &count, nullptr);
+	std::vector<VkImage> images(count);
+	m_vk.GetSwapchainImagesKHR(m_device, m_swapchain, &count, images.data());
+	for (VkImage image : images)
+	{
+		VkImageViewCreateInfo view_info = { VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO };
+		view_info.image = image;
+		view_info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+		view_info.format = m_swapchain_format;
+		view_info.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+		VkImageView view;
+		if (m_vk.CreateImageView(m_device, &view_info, nullptr, &view) != VK_SUCCESS)
+			return false;
+		m_swapchain_views.push_back(view);
+
+		VkFramebufferCreateInfo framebuffer_info = { VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO };
+		framebuffer_info.renderPass = m_render_pass;
+		framebuffer_info.attachmentCount = 1;
+		framebuffer_info.pAttachments = &view;
+		framebuffer_info.width = extent.width;
+		framebuffer_info.height = extent.height;
+		framebuffer_info.layers = 1;
+		VkFramebuffer framebuffer;
+		if (m_vk.CreateFramebuffer(m_device, &framebuffer_info, nullptr, &framebuffer) != VK_SUCCESS)
+			return false;
+		m_framebuffers.push_back(framebuffer);
+
+		// one per image, since presentation may still be waiting on it when the next frame renders
+		VkSemaphoreCreateInfo semaphore_info = { VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO };
+		VkSemaphore semaphore;
+		if (m_vk.CreateSemaphore(m_device, &semaphore_info, nullptr, &semaphore) != VK_SUCCESS)
+			return false;
+		m_rendered.push_back(semaphore);
+	}
+	return true;
+}
+
+
+//============================================================
+//  destroy_swapchain - release the swapchain and
+//  everything that depends on its images
+//============================================================
+
+void renderer_vulkan::destroy_swapchain()
+{
+	for (VkFramebuffer framebuffer : m_framebuffers)
+		m_vk.DestroyFramebuffer(m_device, framebuffer, nullptr);
+	m_framebuffers.clear();
+	for (VkImageView view : m_swapchain_views)
+		m_vk.DestroyImageView(m_device, view, nullptr);
+	m_swapchain_views.clear();
+	for (VkSemaphore semaphore : m_rendered)
+		m_vk.DestroySemaphore(m_device, semaphore, nullptr);
+	m_rendered.clear();
+	if (m_swapchain != VK_NULL_HANDLE)
+		m_vk.DestroySwapchainKHR(m_device, m_swapchain, nullptr);
+	m_swapchain = VK_NULL_HANDLE;
+}
+
+
+//============================================================
+//  create_pipelines - one pipeline per blend mode
+//============================================================
+
+bool renderer_vulkan::create_pipelines()
+{
+	// samplers: bit 0 selects linear filtering, bit 1 repeat addressing
+	for (int index = 0; index < 4; index++)
+	{
+		VkSamplerCreateInfo sampler_info = { VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO };
+		sampler_info.magFilter = sampler_info.minFilter = (index & 1) ? VK_FILTER_LINEAR : VK_FILTER_NEAREST;
+		sampler_info.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+		sampler_info.addressModeU = sampler_info.addressModeV = sampler_info.addressModeW = (index & 2) ? VK_SAMPLER_ADDRESS_MODE_REPEAT : VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+		sampler_info.maxLod = 0.0f;
+		if (m_vk.CreateSampler(m_device, &sampler_info, nullptr, &m_samplers[index]) != VK_SUCCESS)
+			return false;
+	}
+
+	VkDescriptorSetLayoutBinding binding = { };
+	binding.binding = 0;
+	binding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+	binding.descriptorCount = 1;
+	binding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+	VkDescriptorSetLayoutCreateInfo layout_info = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO };
+	layout_info.bindingCount = 1;
+	layout_info.pBindings = &binding;
+	if (m_vk.CreateDescriptorSetLayout(m_device, &layout_info, nullptr, &m_descriptor_layout) != VK_SUCCESS)
+		return false;
+
+	VkDescriptorPoolSize pool_size = { VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, MAX_TEXTURES };
+	VkDescriptorPoolCreateInfo pool_info = { VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO };
+	pool_info.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+	pool_info.maxSets = MAX_TEXTURES;
+	pool_info.poolSizeCount = 1;
+	pool_info.pPoolSizes = &pool_size;
+	if (m_vk.CreateDescriptorPool(m_device, &pool_info, nullptr, &m_descriptor_pool) != VK_SUCCESS)
+		return false;
+
+	// the push constant maps window pixels to clip space
+	VkPushConstantRange push_range = { VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(float) * 4 };
+	VkPipelineLayoutCreateInfo pipeline_layout_info = { VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO };
+	pipeline_layout_info.setLayoutCount = 1;
+	pipeline_layout_info.pSetLayouts = &m_descriptor_layout;
+	pipeline_layout_info.pushConstantRangeCount = 1;
+	pipeline_layout_info.pPushConstantRanges = &push_range;
+	if (m_vk.CreatePipelineLayout(m_device, &pipeline_layout_info, nullptr, &m_pipeline_layout) != VK_SUCCESS)
+		return false;
+
+	VkShaderModule vertex_shader, fragment_shader;
+	VkShaderModuleCreateInfo shader_info = { VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO };
+	shader_info.codeSize = sizeof(vk_primitive_vert_spv);
+	shader_info.pCode = vk_primitive_vert_spv;
+	if (m_vk.CreateShaderModule(m_device, &shader_info, nullptr, &vertex_shader) != VK_SUCCESS)
+		return false;
+	shader_info.codeSize = sizeof(vk_primitive_frag_spv);
+	shader_info.pCode = vk_primitive_frag_spv;
+	if (m_vk.CreateShaderModule(m_device, &shader_info, nullptr, &fragment_shader) != VK_SUCCESS)
+	{
+		m_vk.DestroyShaderModule(m_device, vertex_shader, nullptr);
+		return false;
+	}
+
+	VkPipelineShaderStageCreateInfo stages[2] = { { VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO }, { VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO } };
+	stages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+	stages[0].module = vertex_shader;
+	stages[0].pName = "main";
+	stages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+	stages[1].module = fragment_shader;
+	stages[1].pName = "main";
+
+	VkVertexInputBindingDescription vertex_binding = { 0, sizeof(vertex), VK_VERTEX_INPUT_RATE_VERTEX };
+	VkVertexInputAttributeDescription const attributes[3] = {
+		{ 0, 0, VK_FORMAT_R32G32_SFLOAT, offsetof(vertex, x) },
+		{ 1, 0, VK_FORMAT_R32G32_SFLOAT, offsetof(vertex, u) },
+		{ 2, 0, VK_FORMAT_R8G8B8A8_UNORM, offsetof(vertex, r) } };
+	VkPipelineVertexInputStateCreateInfo vertex_input = { VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO };
+	vertex_input.vertexBindingDescriptionCount = 1;
+	vertex_input.pVertexBindingDescriptions = &vertex_binding;
+	vertex_input.vertexAttributeDescriptionCount = 3;
+	vertex_input.pVertexAttributeDescriptions = attributes;
+
+	VkPipelineInputAssemblyStateCreateInfo input_assembly = { VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO };
+	input_assembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+	VkPipelineViewportStateCreateInfo viewport = { VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO };
+	viewport.viewportCount = 1;
+	viewport.scissorCount = 1;
+
+	VkPipelineRasterizationStateCreateInfo raster = { VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO };
+	raster.polygonMode = VK_POLYGON_MODE_FILL;
+	raster.cullMode = VK_CULL_MODE_NONE;
+	raster.frontFace = VK_FRONT_FACE_CLOCKWISE;
+	raster.lineWidth = 1.0f;
+
+	VkPipelineMultisampleStateCreateInfo multisample = { VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO };
+	multisample.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+	VkDynamicState const dynamic_states[2] = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
+	VkPipelineDynamicStateCreateInfo dynamic = { VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO };
+	dynamic.dynamicStateCount = 2;
+	dynamic.pDynamicStates = dynamic_states;
+
+	bool ok = true;
+	for (int blend = 0; ok && blend < BLENDMODE_COUNT; blend++)
+	{
+		// same equations as the OpenGL renderer
+		VkPipelineColorBlendAttachmentState attachment = { };
+		attachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+		attachment.colorBlendOp = attachment.alphaBlendOp = VK_BLEND_OP_ADD;
+		switch (blend)
+		{
+		case BLENDMODE_NONE:
+			attachment.blendEnable = VK_FALSE;
+			break;
+		case BLENDMODE_ALPHA:
+			attachment.blendEnable = VK_TRUE;
+			attachment.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
+			attachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+			attachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+			attachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+			break;
+		case BLENDMODE_RGB_MULTIPLY:
+			attachment.blendEnable = VK_TRUE;
+			attachment.srcColorBlendFactor = VK_BLEND_FACTOR_DST_COLOR;
+			attachment.dstColorBlendFactor = VK_BLEND_FACTOR_ZERO;
+			attachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_DST_ALPHA;
+			attachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+			break;
+		case BLENDMODE_ADD:
+			attachment.blendEnable = VK_TRUE;
+			attachment.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
+			attachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE;
+			attachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+			attachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+			break;
+		}
+		VkPipelineColorBlendStateCreateInfo color_blend = { VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO };
+		color_blend.attachmentCount = 1;
+		color_blend.pAttachments = &attachment;
+
+		VkGraphicsPipelineCreateInfo pipeline_info = { VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO };
+		pipeline_info.stageCount = 2;
+		pipeline_info.pStages = stages;
+		pipeline_info.pVertexInputState = &vertex_input;
+		pipeline_info.pInputAssemblyState = &input_assembly;
+		pipeline_info.pViewportState = &viewport;
+		pipeline_info.pRasterizationState = &raster;
+		pipeline_info.pMultisampleState = &multisample;
+		pipeline_info.pColorBlendState = &color_blend;
+		pipeline_info.pDynamicState = &dynamic;
+		pipeline_info.layout = m_pipeline_layout;
+		pipeline_info.renderPass = m_render_pass;
+		pipeline_info.subpass = 0;
+		ok = m_vk.CreateGraphicsPipelines(m_device, VK_NULL_HANDLE, 1, &pipeline_info, nullptr, &m_pipelines[blend]) == VK_SUCCESS;
+	}
+
+	m_vk.DestroyShaderModule(m_device, vertex_shader, nullptr);
+	m_vk.DestroyShaderModule(m_device, fragment_shader, nullptr);
+	if (!ok)
+		osd_printf_error("Vulkan: unable to create pipelines\n");
+	return ok;
+}
+
+
+//============================================================
+//  create_frames - per-frame command buffers, sync
+//  objects and mapped buffers
+//============================================================
+
+bool renderer_vulkan::create_frames()
+{
+	VkCommandPoolCreateInfo pool_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+	pool_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+	pool_info.queueFamilyIndex = m_queue_family;
+	if (m_vk.CreateCommandPool(m_device, &pool_info, nullptr, &m_command_pool) != VK_SUCCESS)
+		return false;
+
+	for (frame_state &frame : m_frames)
+	{
+		VkCommandBufferAllocateInfo alloc_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+		alloc_info.commandPool = m_command_pool;
+		alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+		alloc_info.commandBufferCount = 1;
+		if (m_vk.AllocateCommandBuffers(m_device, &alloc_info, &frame.commands) != VK_SUCCESS)
+			return false;
+
+		// signalled, so the first wait on each frame returns at once
+		VkFenceCreateInfo fence_info = { VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+		fence_info.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+		VkSemaphoreCreateInfo semaphore_info = { VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO };
+		if (m_vk.CreateFence(m_device, &fence_info, nullptr, &frame.fence) != VK_SUCCESS ||
+			m_vk.CreateSemaphore(m_device, &semaphore_info, nullptr, &frame.acquired) != VK_SUCCESS)
+			return false;
+
+		if (!create_mapped_buffer(frame.staging, STAGING_SIZE, VK_BUFFER_USAGE_TRANSFER_SRC_BIT) ||
+			!create_mapped_buffer(frame.vertices, VERTEX_SIZE, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT))
+		{
+			osd_printf_error("Vulkan: unable to allocate frame buffers\n");
+			return false;
+		}
+	}
+	return true;
+}
+
+
+//============================================================
+//  mapped buffer helpers
+//============================================================
+
+uint32_t renderer_vulkan::find_memory_type(uint32_t type_bits, VkMemoryPropertyFlags required, VkMemoryPropertyFlags preferred) const
+{
+	uint32_t fallback = UINT32_MAX;
+	for (uint32_t type = 0; type < m_memory_properties.memoryTypeCount; type++)
+	{
+		VkMemoryPropertyFlags const flags = m_memory_properties.memoryTypes[type].propertyFlags;
+		if (!(type_bits & (1U << type)) || ((flags & required) != required))
+			continue;
+		if ((flags & preferred) == preferred)
+			return type;
+		if (fallback == UINT32_MAX)
+			fallback = type;
+	}
+	return fallback;
+}
+
+bool renderer_vulkan::create_mapped_buffer(mapped_buffer &buffer, VkDeviceSize size, VkBufferUsageFlags usage)
+{
+	VkBufferCreateInfo buffer_info = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+	buffer_info.size = size;
+	buffer_info.usage = usage;
+	buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+	if (m_vk.CreateBuffer(m_device, &buffer_info, nullptr, &buffer.buffer) != VK_SUCCESS)
+		return false;
+
+	VkMemoryRequirements requirements;
+	m_vk.GetBufferMemoryRequirements(m_device, buffer.buffer, &requirements);
+	uint32_t const type = find_memory_type(requirements.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+	if (type == UINT32_MAX)
+	{
+		destroy_mapped_buffer(buffer);
+		return false;
+	}
+
+	VkMemoryAllocateInfo alloc_info = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+	alloc_info.allocationSize = requirements.size;
+	alloc_info.memoryTypeIndex = type;
+	void *data = nullptr;
+	if (m_vk.AllocateMemory(m_device, &alloc_info, nullptr, &buffer.memory) != VK_SUCCESS ||
+		m_vk.BindBufferMemory(m_device, buffer.buffer, buffer.memory, 0) != VK_SUCCESS ||
+		m_vk.MapMemory(m_device, buffer.memory, 0, VK_WHOLE_SIZE, 0, &data) != VK_SUCCESS)
+	{
+		destroy_mapped_buffer(buffer);
+		return false;
+	}
+	buffer.size = size;
+	buffer.coherent = (m_memory_properties.memoryTypes[type].propertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0;
+	buffer.data = reinterpret_cast<uint8_t *>(data);
+	return true;
+}
+
+void renderer_vulkan::destroy_mapped_buffer(mapped_buffer &buffer)
+{
+	if (buffer.data)
+		m_vk.UnmapMemory(m_device, buffer.memory);
+	if (buffer.buffer != VK_NULL_HANDLE)
+		m_vk.DestroyBuffer(m_device, buffer.buffer, nullptr);
+	if (buffer.memory != VK_NULL_HANDLE)
+		m_vk.FreeMemory(m_device, buffer.memory, nullptr);
+	buffer = mapped_buffer();
+}
+
+void renderer_vulkan::flush_mapped_buffer(const mapped_buffer &buffer, VkDeviceSize size)
+{
+	if (buffer.coherent || size == 0)
+		return;
+
+	// VK_WHOLE_SIZE sidesteps the non-coherent atom alignment rules
+	VkMappedMemoryRange range = { VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE };
+	range.memory = buffer.memory;
+	range.offset = 0;
+	range.size = VK_WHOLE_SIZE;
+	m_vk.FlushMappedMemoryRanges(m_device, 1, &range);
+}
+
+
+//============================================================
+//  texture handling
+//============================================================
+
+std::unique_ptr<renderer_vulkan::texture> renderer_vulkan::create_texture(uint32_t width, uint32_t height, bool filter, bool wrap)
+{
+	auto tex = std::make_unique<texture>();
+	tex->width = width;
+	tex->height = height;
+
+	VkImageCreateInfo image_info = { VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO };
+	image_info.imageType = VK_IMAGE_TYPE_2D;
+	image_info.format = VK_FORMAT_R8G8B8A8_UNORM;
+	image_info.extent = { width, height, 1 };
+	image_info.mipLevels = 1;
+	image_info.arrayLayers = 1;
+	image_info.samples = VK_SAMPLE_COUNT_1_BIT;
+	image_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+	image_info.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+	image_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+	image_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+	if (m_vk.CreateImage(m_device, &image_info, nullptr, &tex->image) != VK_SUCCESS)
+		return nullptr;
+
+	VkMemoryRequirements requirements;
+	m_vk.GetImageMemoryRequirements(m_device, tex->image, &requirements);
+	VkMemoryAllocateInfo alloc_info = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+	alloc_info.allocationSize = requirements.size;
+	alloc_info.memoryTypeIndex = find_memory_type(requirements.memoryTypeBits, 0, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+	if (alloc_info.memoryTypeIndex == UINT32_MAX ||
+		m_vk.AllocateMemory(m_device, &alloc_info, nullptr, &tex->memory) != VK_SUCCESS ||
+		m_vk.BindImageMemory(m_device, tex->image, tex->memory, 0) != VK_SUCCESS)
+	{
+		destroy_texture(std::move(tex));
+		return nullptr;
+	}
+
+	VkImageViewCreateInfo view_info = { VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO };
+	view_info.image = tex->image;
+	view_info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+	view_info.format = VK_FORMAT_R8G8B8A8_UNORM;
+	view_info.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+	if (m_vk.CreateImageView(m_device, &view_info, nullptr, &tex->view) != VK_SUCCESS)
+	{
+		destroy_texture(std::move(tex));
+		return nullptr;
+	}
+
+	VkDescriptorSetAllocateInfo set_info = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO };
+	set_info.descriptorPool = m_descriptor_pool;
+	set_info.descriptorSetCount = 1;
+	set_info.pSetLayouts = &m_descriptor_layout;
+	if (m_vk.AllocateDescriptorSets(m_device, &set_info, &tex->descriptor) != VK_SUCCESS)
+	{
+		tex->descriptor = VK_NULL_HANDLE;
+		destroy_texture(std::move(tex));
+		return nullptr;
+	}
+
+	VkDescriptorImageInfo descriptor_image = { m_samplers[(filter ? 1 : 0) | (wrap ? 2 : 0)], tex->view, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL };
+	VkWriteDescriptorSet write = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
+	write.dstSet = tex->descriptor;
+	write.dstBinding = 0;
+	write.descriptorCount = 1;
+	write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+	write.pImageInfo = &descriptor_image;
+	m_vk.UpdateDescriptorSets(m_device, 1, &write, 0, nullptr);
+
+	return tex;
+}
+
+void renderer_vulkan::destroy_texture(std::unique_ptr<texture> &&tex)
+{
+	if (tex->descriptor != VK_NULL_HANDLE)
+		m_vk.FreeDescriptorSets(m_device, m_descriptor_pool, 1, &tex->descriptor);
+	if (tex->view != VK_NULL_HANDLE)
+		m_vk.DestroyImageView(m_device, tex->view, nullptr);
+	if (tex->image != VK_NULL_HANDLE)
+		m_vk.DestroyImage(m_device, tex->image, nullptr);
+	if (tex->memory != VK_NULL_HANDLE)
+		m_vk.FreeMemory(m_device, tex->memory, nullptr);
+	tex.reset();
+}
+
+void renderer_vulkan::destroy_all_textures()
+{
+	for (auto &entry : m_textures)
+		destroy_texture(std::move(entry.second));
+	m_textures.clear();
+}
+
+
+//============================================================
+//  collect_textures - retire textures that haven't
+//  been drawn for a while, and free retired textures
+//  no frame in flight can still be using
+//============================================================
+
+void renderer_vulkan::collect_textures()
+{
+	osd_ticks_t const now = osd_ticks();
+	for (auto it = m_textures.begin(); it != m_textures.end(); )
+	{
+		if ((now - it->second->last_access) > osd_ticks_per_second())
+		{
+			m_retired.emplace_back(m_frame_count, std::move(it->second));
+			it = m_textures.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+
+	auto const done = std::partition(m_retired.begin(), m_retired.end(),
+			[this] (std::pair<uint64_t, std::unique_ptr<texture>> const &retired) { return (retired.first + FRAMES_IN_FLIGHT) > m_frame_count; });
+	for (auto it = done; it != m_retired.end(); ++it)
+		destroy_texture(std::move(it->second));
+	m_retired.erase(done, m_retired.end());
+}
+
+
+//============================================================
+//  stage_upload - reserve staging space for rows of a
+//  texture and record the copy; returns where to write
+//  the texels, or nullptr if the staging buffer is full
+//============================================================
+
+uint8_t *renderer_vulkan::stage_upload(frame_state &frame, texture &tex, uint32_t top, uint32_t rows)
+{
+	VkDeviceSize const offset = (frame.staging_used + 15) & ~VkDeviceSize(15);
+	VkDeviceSize const size = VkDeviceSize(tex.width) * rows * 4;
+	if ((offset + size) > frame.staging.size)
+	{
+		// try again next time round with a bigger buffer
+		frame.staging_wanted = std::max(frame.staging_wanted, offset + size);
+		return nullptr;
+	}
+	frame.staging_used = offset + size;
+
+	// wait for earlier frames to finish sampling before overwriting
+	VkImageMemoryBarrier barrier = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+	barrier.srcAccessMask = 0;
+	barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	barrier.oldLayout = tex.uploaded ? VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL : VK_IMAGE_LAYOUT_UNDEFINED;
+	barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+	barrier.srcQueueFamilyIndex = barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	barrier.image = tex.image;
+	barrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+	m_vk.CmdPipelineBarrier(frame.commands, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+	VkBufferImageCopy region = { };
+	region.bufferOffset = offset;
+	region.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
+	region.imageOffset = { 0, int32_t(top), 0 };
+	region.imageExtent = { tex.width, rows, 1 };
+	m_vk.CmdCopyBufferToImage(frame.commands, frame.staging.buffer, tex.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+
+	barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+	barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+	barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+	m_vk.CmdPipelineBarrier(frame.commands, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+	tex.uploaded = true;
+	return frame.staging.data + offset;
+}
+
+
+//============================================================
+//  upload_texture - convert changed rows straight into
+//  the mapped staging buffer
+//============================================================
+
+bool renderer_vulkan::upload_texture(frame_state &frame, texture &tex, const render_texinfo &texinfo, uint32_t flags)
+{
+	// only the dirty rows need to go up if we have the previous contents
+	uint32_t top = 0;
+	uint32_t bottom = texinfo.height - 1;
+	if (tex.uploaded && texinfo.partial_update(tex.seqid))
+	{
+		top = texinfo.dirty_top;
+		bottom = texinfo.dirty_bottom;
+	}
+
+	uint8_t *const dest = stage_upload(frame, tex, top, bottom - top + 1);
+	if (!dest)
+		return false;
+
+	for (uint32_t y = top; y <= bottom; y++)
+	{
+		auto *const dst = reinterpret_cast<uint32_t *>(dest) + ((y - top) * texinfo.width);
+		auto const *const src16 = reinterpret_cast<const uint16_t *>(texinfo.base) + (y * texinfo.rowpixels);
+		auto const *const src32 = reinterpret_cast<const uint32_t *>(texinfo.base) + (y * texinfo.rowpixels);
+		switch (PRIMFLAG_GET_TEXFORMAT(flags))
+		{
+		case TEXFORMAT_PALETTE16:
+			copy_util::copyline_palette16(dst, src16, texinfo.width, texinfo.palette);
+			break;
+		case TEXFORMAT_YUY16:
+			copy_util::copyline_yuy16_to_argb(dst, src16, texinfo.width, texinfo.palette, 1);
+			break;
+		case TEXFORMAT_ARGB32:
+			copy_util::copyline_argb32(dst, src32, texinfo.width, texinfo.palette);
+			break;
+		case TEXFORMAT_RGB32:
+			copy_util::copyline_rgb32(dst, src32, texinfo.width, texinfo.palette);
+			break;
+		default:
+			osd_printf_error("Vulkan: unknown texture format %d\n", PRIMFLAG_GET_TEXFORMAT(flags));
+			break;
+		}
+	}
+
+	tex.seqid = texinfo.seqid;
+	return true;
+}
+
+
+//============================================================
+//  texture_update - find or create the texture for a
+//  primitive and bring its contents up to date
+//============================================================
+
+renderer_vulkan::texture *renderer_vulkan::texture_update(frame_state &frame, const render_primitive &prim)
+{
+	uint64_t const key = texture_key(prim);
+	auto found = m_textures.find(key);
+	if (found != m_textures.end() && (found->second->width != prim.texture.width || found->second->height != prim.texture.height))
+	{
+		// same texture with new dimensions: the old image may still be in use
+		m_retired.emplace_back(m_frame_count, std::move(found->second));
+		m_textures.erase(found);
+		found = m_textures.end();
+	}
+
+	if (found == m_textures.end())
+	{
+		std::unique_ptr<texture> tex = create_texture(prim.texture.width, prim.texture.height, video_config.filter, PRIMFLAG_GET_TEXWRAP(prim.flags));
+		if (!tex)
+			return nullptr;
+		found = m_textures.emplace(key, std::move(tex)).first;
+	}
+
+	texture &tex = *found->second;
+	tex.last_access = osd_ticks();
+	if (!tex.uploaded || tex.seqid != prim.texture.seqid)
+		upload_texture(frame, tex, prim.texture, prim.flags);
+
+	// nothing to draw until the first upload has gone through
+	return tex.uploaded ? &tex : nullptr;
+}
+
+
+//============================================================
+//  draw
+//============================================================
+
+int renderer_vulkan::draw(const int update)
+{
+	if (video_config.novideo)
+		return 0;
+
+	auto win = assert_window();
+	osd_dim const wdim = win->get_size();
+	if (has_flags(FI_CHANGED) || (wdim.width() != m_width) || (wdim.height() != m_height))
+	{
+		m_width = wdim.width();
+		m_height = wdim.height();
+		m_swapchain_stale = true;
+		clear_flags(FI_CHANGED);
+	}
+
+	if (m_swapchain_stale || m_swapchain == VK_NULL_HANDLE)
+	{
+		m_vk.DeviceWaitIdle(m_device);
+		if (!create_swapchain())
+			return 1;
+		if (m_swapchain == VK_NULL_HANDLE)
+			return 0;
+	}
+
+	// wait until this frame's resources are free; this bounds how far we get ahead of the GPU
+	frame_state &frame = m_frames[m_frame_index];
+	m_vk.WaitForFences(m_device, 1, &frame.fence, VK_TRUE, UINT64_MAX);
+
+	uint32_t image_index;
+	VkResult result = m_vk.AcquireNextImageKHR(m_device, m_swapchain, UINT64_MAX, frame.acquired, VK_NULL_HANDLE, &image_index);
+	if (result == VK_ERROR_OUT_OF_DATE_KHR)
+	{
+		m_swapchain_stale = true;
+		return 0;
+	}
+	else if (result == VK_SUBOPTIMAL_KHR)
+	{
+		m_swapchain_stale = true;
+	}
+	else if (result != VK_SUCCESS)
+	{
+		osd_printf_error("Vulkan: unable to acquire swapchain image (%d)\n", int(result));
+		return 1;
+	}
+	m_vk.ResetFences(m_device, 1, &frame.fence);
+
+	collect_textures();
+
+	// grow buffers that ran out last time this frame was used
+	if (frame.staging_wanted > frame.staging.size)
+	{
+		destroy_mapped_buffer(frame.staging);
+		if (!create_mapped_buffer(frame.staging, std::max(frame.staging_wanted, frame.staging.size * 2), VK_BUFFER_USAGE_TRANSFER_SRC_BIT))
+			create_mapped_buffer(frame.staging, STAGING_SIZE, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+	}
+	frame.staging_wanted = 0;
+	frame.staging_used = 0;
+
+	VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+	begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+	m_vk.ResetCommandBuffer(frame.commands, 0);
+	m_vk.BeginCommandBuffer(frame.commands, &begin_info);
+
+	if (!m_white->uploaded)
+	{
+		uint8_t *const white = stage_upload(frame, *m_white, 0, 1);
+		if (white)
+			memset(white, 0xff, 4);
+	}
+
+	// first pass: upload textures and build the vertex list, batching runs
+	// of primitives that share a blend mode and texture
+	win->m_primlist->acquire_lock();
+
+	VkDeviceSize const needed = VkDeviceSize(std::distance(win->m_primlist->begin(), win->m_primlist->end())) * 6 * sizeof(vertex);
+	if (needed > frame.vertices.size)
+	{
+		// this frame's previous use is complete, so the buffer can be replaced now
+		destroy_mapped_buffer(frame.vertices);
+		if (!create_mapped_buffer(frame.vertices, std::max(needed, VERTEX_SIZE * 2), VK_BUFFER_USAGE_VERTEX_BUFFER_BIT))
+		{
+			win->m_primlist->release_lock();
+			m_vk.EndCommandBuffer(frame.commands);
+			osd_printf_error("Vulkan: unable to allocate vertex buffer\n");
+			return 1;
+		}
+	}
+
+	m_batches.clear();
+	auto *const vertices = reinterpret_cast<vertex *>(frame.vertices.data);
+	uint32_t vertex_count = 0;
+	for (render_primitive &prim : *win->m_primlist)
+	{
+		float x[4], y[4], u[4] = { 0, 0, 0, 0 }, v[4] = { 0, 0, 0, 0 };
+		VkDescriptorSet descriptor = m_white->descriptor;
+
+		switch (prim.type)
+		{
+		case render_primitive::LINE:
+			{
+				// expand to a quad of the line's width
+				float dx = prim.bounds.x1 - prim.bounds.x0;
+				float dy = prim.bounds.y1 - prim.bounds.y0;
+				float const length = std::sqrt(dx * dx + dy * dy);
+				if (length < 0.0001f)
+				{
+					dx = 1.0f;
+					dy = 0.0f;
+				}
+				else
+				{
+					dx /= length;
+					dy /= length;
+				}
+				float const half = std::max(prim.width, 1.0f) * 0.5f;
+				float const nx = -dy * half;
+				float const ny = dx * half;
+				x[0] = prim.bounds.x0 + nx; y[0] = prim.bounds.y0 + ny;
+				x[1] = prim.bounds.x1 + nx; y[1] = prim.bounds.y1 + ny;
+				x[2] = prim.bounds.x0 - nx; y[2] = prim.bounds.y0 - ny;
+				x[3] = prim.bounds.x1 - nx; y[3] = prim.bounds.y1 - ny;
+			}
+			break;
+
+		case render_primitive::QUAD:
+			if (prim.texture.base != nullptr)
+			{
+				texture *const tex = texture_update(frame, prim);
+				if (!tex)
+					continue;
+				descriptor = tex->descriptor;
+				u[0] = prim.texcoords.tl.u; v[0] = prim.texcoords.tl.v;
+				u[1] = prim.texcoords.tr.u; v[1] = prim.texcoords.tr.v;
+				u[2] = prim.texcoords.bl.u; v[2] = prim.texcoords.bl.v;
+				u[3] = prim.texcoords.br.u; v[3] = prim.texcoords.br.v;
+			}
+			x[0] = prim.bounds.x0; y[0] = prim.bounds.y0;
+			x[1] = prim.bounds.x1; y[1] = prim.bounds.y0;
+			x[2] = prim.bounds.x0; y[2] = prim.bounds.y1;
+			x[3] = prim.bounds.x1; y[3] = prim.bounds.y1;
+			break;
+
+		default:
+			throw emu_fatalerror("Unexpected render_primitive type\n");
+		}
+
+		uint8_t const r = color_byte(prim.color.r);
+		uint8_t const g = color_byte(prim.color.g);
+		uint8_t const b = color_byte(prim.color.b);
+		uint8_t const a = color_byte(prim.color.a);
+		static const int corners[6] = { 0, 1, 2, 1, 3, 2 };
+		for (int corner : corners)
+			vertices[vertex_count++] = vertex{ x[corner], y[corner], u[corner], v[corner], r, g, b, a };
+
+		int const blend = PRIMFLAG_GET_BLENDMODE(prim.flags);
+		if (!m_batches.empty() && (m_batches.back().blend == blend) && (m_batches.back().descriptor == descriptor))
+			m_batches.back().count += 6;
+		else
+			m_batches.push_back(draw_batch{ blend, descriptor, vertex_count - 6, 6 });
+	}
+
+	win->m_primlist->release_lock();
+
+	flush_mapped_buffer(frame.vertices, vertex_count * sizeof(vertex));
+	flush_mapped_buffer(frame.staging, frame.staging_used);
+
+	// second pass: draw the batches
+	VkClearValue clear = { };
+	VkRenderPassBeginInfo pass_info = { VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO };
+	pass_info.renderPass = m_render_pass;
+	pass_info.framebuffer = m_framebuffers[image_index];
+	pass_info.renderArea.extent = m_swapchain_extent;
+	pass_info.clearValueCount = 1;
+	pass_info.pClearValues = &clear;
+	m_vk.CmdBeginRenderPass(frame.commands, &pass_info, VK_SUBPASS_CONTENTS_INLINE);
+
+	VkViewport viewport = { 0.0f, 0.0f, float(m_swapchain_extent.width), float(m_swapchain_extent.height), 0.0f, 1.0f };
+	VkRect2D scissor = { { 0, 0 }, m_swapchain_extent };
+	m_vk.CmdSetViewport(frame.commands, 0, 1, &viewport);
+	m_vk.CmdSetScissor(frame.commands, 0, 1, &scissor);
+
+	float const transform[4] = {
+		2.0f / float(std::max(m_blit_dim.width(), 1)),
+		2.0f / float(std::max(m_blit_dim.height(), 1)),
+		-1.0f,
+		-1.0f };
+	m_vk.CmdPushConstants(frame.commands, m_pipeline_layout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(transform), transform);
+
+	VkDeviceSize const vertex_offset = 0;
+	m_vk.CmdBindVertexBuffers(frame.commands, 0, 1, &frame.vertices.buffer, &vertex_offset);
+
+	int bound_blend = -1;
+	VkDescriptorSet bound_descriptor = VK_NULL_HANDLE;
+	for (draw_batch const &batch : m_batches)
+	{
+		if (batch.blend != bound_blend)
+		{
+			m_vk.CmdBindPipeline(frame.commands, VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipelines[batch.blend]);
+			bound_blend = batch.blend;
+		}
+		if (batch.descriptor != bound_descriptor)
+		{
+			m_vk.CmdBindDescriptorSets(frame.commands, VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline_layout, 0, 1, &batch.descriptor, 0, nullptr);
+			bound_descriptor = batch.descriptor;
+		}
+		m_vk.CmdDraw(frame.commands, batch.count, 1, batch.first, 0);
+	}
+
+	m_vk.CmdEndRenderPass(frame.commands);
+	m_vk.EndCommandBuffer(frame.commands);
+
+	VkPipelineStageFlags const wait_stage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+	VkSubmitInfo submit_info = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+	submit_info.waitSemaphoreCount = 1;
+	submit_info.pWaitSemaphores = &frame.acquired;
+	submit_info.pWaitDstStageMask = &wait_stage;
+	submit_info.commandBufferCount = 1;
+	submit_info.pCommandBuffers = &frame.commands;
+	submit_info.signalSemaphoreCount = 1;
+	submit_info.pSignalSemaphores = &m_rendered[image_index];
+	if (m_vk.QueueSubmit(m_queue, 1, &submit_info, frame.fence) != VK_SUCCESS)
+	{
+		osd_printf_error("Vulkan: queue submission failed\n");
+		return 1;
+	}
+
+	VkPresentInfoKHR present_info = { VK_STRUCTURE_TYPE_PRESENT_INFO_KHR };
+	present_info.waitSemaphoreCount = 1;
+	present_info.pWaitSemaphores = &m_rendered[image_index];
+	present_info.swapchainCount = 1;
+	present_info.pSwapchains = &m_swapchain;
+	present_info.pImageIndices = &image_index;
+	result = m_vk.QueuePresentKHR(m_queue, &present_info);
+	if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR)
+		m_swapchain_stale = true;
+
+	m_frame_index = (m_frame_index + 1) % FRAMES_IN_FLIGHT;
+	m_frame_count++;
+	return 0;
+}
+
+
+//============================================================
+//  xy_to_render_target
+//============================================================
+
+int renderer_vulkan::xy_to_render_target(int x, int y, int *xt, int *yt)
+{
+	*xt = x;
+	*yt = y;
+	if (*xt < 0 || *xt >= m_blit_dim.width())
+		return 0;
+	if (*yt < 0 || *yt >= m_blit_dim.height())
+		return 0;
+	return 1;
+}
+
+
+//============================================================
+//  get_primitives
+//============================================================
+
+render_primitive_list *renderer_vulkan::get_primitives()
+{
+	auto win = try_getwindow();
+	if (win == nullptr)
+		return nullptr;
+
+	osd_dim nd = win->get_size();
+	if (nd != m_blit_dim)
+	{
+		m_blit_dim = nd;
+		notify_changed();
+	}
+	win->target()->set_bounds(m_blit_dim.width(), m_blit_dim.height(), win->pixel_aspect());
+	return &win->target()->get_primitives();
+}
@@ -0,0 +1,251 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+//============================================================
+//
+//  drawvk.h - native Vulkan renderer
+//
+//  Draws the primitive list directly with Vulkan: textures
+//  stream through persistently mapped staging buffers, up to
+//  FRAMES_IN_FLIGHT frames are queued at once, and runs of
+//  primitives sharing a texture and blend mode are drawn
+//  with a single call.
+//
+//============================================================
+
+#pragma once
+
+#ifndef __DRAWVK__
+#define __DRAWVK__
+
+#define VK_NO_PROTOTYPES
+#include <vulkan/vulkan.h>
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// device-level and instance-level entry points, loaded at run time so
+// there's no link-time dependency on the Vulkan loader
+#define VULKAN_INSTANCE_FUNCTIONS(X) \
+	X(DestroyInstance) \
+	X(EnumeratePhysicalDevices) \
+	X(GetPhysicalDeviceProperties) \
+	X(GetPhysicalDeviceMemoryProperties) \
+	X(GetPhysicalDeviceQueueFamilyProperties) \
+	X(GetPhysicalDeviceSurfaceSupportKHR) \
+	X(GetPhysicalDeviceSurfaceCapabilitiesKHR) \
+	X(GetPhysicalDeviceSurfaceFormatsKHR) \
+	X(GetPhysicalDeviceSurfacePresentModesKHR) \
+	X(EnumerateDeviceExtensionProperties) \
+	X(CreateDevice) \
+	X(GetDeviceProcAddr) \
+	X(DestroySurfaceKHR)
+
+#define VULKAN_DEVICE_FUNCTIONS(X) \
+	X(DestroyDevice) \
+	X(GetDeviceQueue) \
+	X(DeviceWaitIdle) \
+	X(CreateSwapchainKHR) \
+	X(DestroySwapchainKHR) \
+	X(GetSwapchainImagesKHR) \
+	X(AcquireNextImageKHR) \
+	X(QueuePresentKHR) \
+	X(QueueSubmit) \
+	X(CreateImageView) \
+	X(DestroyImageView) \
+	X(CreateRenderPass) \
+	X(DestroyRenderPass) \
+	X(CreateFramebuffer) \
+	X(DestroyFramebuffer) \
+	X(CreateShaderModule) \
+	X(DestroyShaderModule) \
+	X(CreatePipelineLayout) \
+	X(DestroyPipelineLayout) \
+	X(CreateGraphicsPipelines) \
+	X(DestroyPipeline) \
+	X(CreateDescriptorSetLayout) \
+	X(DestroyDescriptorSetLayout) \
+	X(CreateDescriptorPool) \
+	X(DestroyDescriptorPool) \
+	X(AllocateDescriptorSets) \
+	X(FreeDescriptorSets) \
+	X(UpdateDescriptorSets) \
+	X(CreateSampler) \
+	X(DestroySampler) \
+	X(CreateCommandPool) \
+	X(DestroyCommandPool) \
+	X(AllocateCommandBuffers) \
+	X(BeginCommandBuffer) \
+	X(EndCommandBuffer) \
+	X(ResetCommandBuffer) \
+	X(CmdBeginRenderPass) \
+	X(CmdEndRenderPass) \
+	X(CmdBindPipeline) \
+	X(CmdBindDescriptorSets) \
+	X(CmdBindVertexBuffers) \
+	X(CmdDraw) \
+	X(CmdSetViewport) \
+	X(CmdSetScissor) \
+	X(CmdPushConstants) \
+	X(CmdCopyBufferToImage) \
+	X(CmdPipelineBarrier) \
+	X(CreateFence) \
+	X(DestroyFence) \
+	X(WaitForFences) \
+	X(ResetFences) \
+	X(CreateSemaphore) \
+	X(DestroySemaphore) \
+	X(CreateBuffer) \
+	X(DestroyBuffer) \
+	X(GetBufferMemoryRequirements) \
+	X(BindBufferMemory) \
+	X(CreateImage) \
+	X(DestroyImage) \
+	X(GetImageMemoryRequirements) \
+	X(BindImageMemory) \
+	X(AllocateMemory) \
+	X(FreeMemory) \
+	X(MapMemory) \
+	X(UnmapMemory) \
+	X(FlushMappedMemoryRanges)
+
+class renderer_vulkan : public osd_renderer
+{
+public:
+	renderer_vulkan(std::shared_ptr<osd_window> window);
+	virtual ~renderer_vulkan();
+
+	static void init(running_machine &machine);
+	static void exit();
+
+	virtual int create() override;
+	virtual int draw(const int update) override;
+	virtual int xy_to_render_target(const int x, const int y, int *xt, int *yt) override;
+	virtual render_primitive_list *get_primitives() override;
+
+	// Vulkan has no thread affinity; the window serialises access
+	virtual bool can_draw_on_thread() const override { return true; }
+
+private:
+	static constexpr unsigned FRAMES_IN_FLIGHT = 2;
+
+	// a buffer that stays mapped for its whole life
+	struct mapped_buffer
+	{
+		VkBuffer        buffer = VK_NULL_HANDLE;
+		VkDeviceMemory  memory = VK_NULL_HANDLE;
+		VkDeviceSize    size = 0;
+		bool            coherent = false;
+		uint8_t *       data = nullptr;
+	};
+
+	// per-frame resources, reused once the frame's fence signals
+	struct frame_state
+	{
+		VkCommandBuffer commands = VK_NULL_HANDLE;
+		VkFence         fence = VK_NULL_HANDLE;
+		VkSemaphore     acquired = VK_NULL_HANDLE;
+		mapped_buffer   staging;
+		VkDeviceSize    staging_used = 0;
+		VkDeviceSize    staging_wanted = 0;
+		mapped_buffer   vertices;
+	};
+
+	struct vertex
+	{
+		float           x, y;
+		float           u, v;
+		uint8_t         r, g, b, a;
+	};
+
+	// a run of primitives drawn with one call
+	struct draw_batch
+	{
+		int             blend;
+		VkDescriptorSet descriptor;
+		uint32_t        first;
+		uint32_t        count;
+	};
+
+	struct texture
+	{
+		VkImage         image = VK_NULL_HANDLE;
+		VkDeviceMemory  memory = VK_NULL_HANDLE;
+		VkImageView     view = VK_NULL_HANDLE;
+		VkDescriptorSet descriptor = VK_NULL_HANDLE;
+		uint32_t        width = 0;
+		uint32_t        height = 0;
+		uint32_t        seqid = 0;
+		bool            uploaded = false;
+		osd_ticks_t     last_access = 0;
+	};
+
+	struct instance_functions
+	{
+#define VULKAN_FUNCTION_POINTER(name) PFN_vk##name name = nullptr;
+		VULKAN_INSTANCE_FUNCTIONS(VULKAN_FUNCTION_POINTER)
+		VULKAN_DEVICE_FUNCTIONS(VULKAN_FUNCTION_POINTER)
+#undef VULKAN_FUNCTION_POINTER
+	};
+
+	bool create_instance();
+	bool choose_device();
+	bool create_device();
+	bool create_swapchain();
+	void destroy_swapchain();
+	bool create_pipelines();
+	bool create_frames();
+	bool create_mapped_buffer(mapped_buffer &buffer, VkDeviceSize size, VkBufferUsageFlags usage);
+	void destroy_mapped_buffer(mapped_buffer &buffer);
+	void flush_mapped_buffer(const mapped_buffer &buffer, VkDeviceSize size);
+	uint32_t find_memory_type(uint32_t type_bits, VkMemoryPropertyFlags required, VkMemoryPropertyFlags preferred) const;
+
+	texture *texture_update(frame_state &frame, const render_primitive &prim);
+	std::unique_ptr<texture> create_texture(uint32_t width, uint32_t height, bool filter, bool wrap);
+	uint8_t *stage_upload(frame_state &frame, texture &tex, uint32_t top, uint32_t rows);
+	bool upload_texture(frame_state &frame, texture &tex, const render_texinfo &texinfo, uint32_t flags);
+	void destroy_texture(std::unique_ptr<texture> &&tex);
+	void collect_textures();
+	void destroy_all_textures();
+
+	int                                 m_width;
+	int                                 m_height;
+	osd_dim                             m_blit_dim;
+
+	instance_functions                  m_vk;
+	VkInstance                          m_instance;
+	VkSurfaceKHR                        m_surface;
+	VkPhysicalDevice                    m_physical_device;
+	VkPhysicalDeviceMemoryProperties    m_memory_properties;
+	uint32_t                            m_queue_family;
+	VkDevice                            m_device;
+	VkQueue                             m_queue;
+
+	VkSwapchainKHR                      m_swapchain;
+	VkFormat                            m_swapchain_format;
+	VkExtent2D                          m_swapchain_extent;
+	VkPresentModeKHR                    m_present_mode;
+	std::vector<VkImageView>            m_swapchain_views;
+	std::vector<VkFramebuffer>          m_framebuffers;
+	std::vector<VkSemaphore>            m_rendered;
+	bool                                m_swapchain_stale;
+
+	VkRenderPass                        m_render_pass;
+	VkDescriptorSetLayout               m_descriptor_layout;
+	VkDescriptorPool                    m_descriptor_pool;
+	VkPipelineLayout                    m_pipeline_layout;
+	VkPipeline                          m_pipelines[BLENDMODE_COUNT];
+	VkSampler                           m_samplers[4];      // point/linear, clamp/repeat
+	VkCommandPool                       m_command_pool;
+
+	frame_state                         m_frames[FRAMES_IN_FLIGHT];
+	unsigned                            m_frame_index;
+	uint64_t                            m_frame_count;
+
+	std::unordered_map<uint64_t, std::unique_ptr<texture>> m_textures;
+	std::vector<draw_batch>             m_batches;
+	std::unique_ptr<texture>            m_white;
+	std::vector<std::pair<uint64_t, std::unique_ptr<texture>>> m_retired;    // textures waiting for the GPU to finish with them
+};
+
+#endif // __DRAWVK__
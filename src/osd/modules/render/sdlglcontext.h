@@ -37,6 +37,11 @@ public:
 		SDL_GL_MakeCurrent(m_window, m_context);
 	}
 
+	virtual void ReleaseCurrent() override
+	{
+		SDL_GL_MakeCurrent(m_window, nullptr);
+	}
+
 	virtual int SetSwapInterval(const int swap) override
 	{
 		return SDL_GL_SetSwapInterval(swap);
@@ -0,0 +1,19 @@
+#! /bin/sh
+
+##
+## Compiles the Vulkan renderer shaders to SPIR-V headers.
+## Needs glslangValidator from 3rdparty/bgfx/3rdparty/glslang.
+##
+
+compile()
+{
+	glslangValidator -V --vn $2 -o $1.tmp $1 || exit 1
+	echo "// license:BSD-3-Clause" > $1.h
+	echo "// copyright-holders:MAMEdev Team" >> $1.h
+	echo "// generated from $1 by genc.sh - do not edit" >> $1.h
+	grep -v -e "^	// " -e "pragma once" $1.tmp >> $1.h
+	rm $1.tmp
+}
+
+compile vk_primitive.vert vk_primitive_vert_spv
+compile vk_primitive.frag vk_primitive_frag_spv
@@ -0,0 +1,16 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+#version 450
+
+// untextured primitives are drawn with a 1x1 white texture
+layout(set = 0, binding = 0) uniform sampler2D s_texture;
+
+layout(location = 0) in vec2 v_texcoord;
+layout(location = 1) in vec4 v_color;
+
+layout(location = 0) out vec4 o_color;
+
+void main()
+{
+	o_color = texture(s_texture, v_texcoord) * v_color;
+}
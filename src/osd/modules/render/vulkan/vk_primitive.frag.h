@@ -0,0 +1,26 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+// generated from vk_primitive.frag by genc.sh - do not edit
+const uint32_t vk_primitive_frag_spv[] = {
+	0x07230203,0x00010000,0x00080008,0x00000018,0x00000000,0x00020011,0x00000001,0x0006000b,
+	0x00000001,0x4c534c47,0x6474732e,0x3035342e,0x00000000,0x0003000e,0x00000000,0x00000001,
+	0x0008000f,0x00000004,0x00000004,0x6e69616d,0x00000000,0x00000009,0x00000011,0x00000015,
+	0x00030010,0x00000004,0x00000007,0x00030003,0x00000002,0x000001c2,0x00040005,0x00000004,
+	0x6e69616d,0x00000000,0x00040005,0x00000009,0x6f635f6f,0x00726f6c,0x00050005,0x0000000d,
+	0x65745f73,0x72757478,0x00000065,0x00050005,0x00000011,0x65745f76,0x6f6f6378,0x00006472,
+	0x00040005,0x00000015,0x6f635f76,0x00726f6c,0x00040047,0x00000009,0x0000001e,0x00000000,
+	0x00040047,0x0000000d,0x00000022,0x00000000,0x00040047,0x0000000d,0x00000021,0x00000000,
+	0x00040047,0x00000011,0x0000001e,0x00000000,0x00040047,0x00000015,0x0000001e,0x00000001,
+	0x00020013,0x00000002,0x00030021,0x00000003,0x00000002,0x00030016,0x00000006,0x00000020,
+	0x00040017,0x00000007,0x00000006,0x00000004,0x00040020,0x00000008,0x00000003,0x00000007,
+	0x0004003b,0x00000008,0x00000009,0x00000003,0x00090019,0x0000000a,0x00000006,0x00000001,
+	0x00000000,0x00000000,0x00000000,0x00000001,0x00000000,0x0003001b,0x0000000b,0x0000000a,
+	0x00040020,0x0000000c,0x00000000,0x0000000b,0x0004003b,0x0000000c,0x0000000d,0x00000000,
+	0x00040017,0x0000000f,0x00000006,0x00000002,0x00040020,0x00000010,0x00000001,0x0000000f,
+	0x0004003b,0x00000010,0x00000011,0x00000001,0x00040020,0x00000014,0x00000001,0x00000007,
+	0x0004003b,0x00000014,0x00000015,0x00000001,0x00050036,0x00000002,0x00000004,0x00000000,
+	0x00000003,0x000200f8,0x00000005,0x0004003d,0x0000000b,0x0000000e,0x0000000d,0x0004003d,
+	0x0000000f,0x00000012,0x00000011,0x00050057,0x00000007,0x00000013,0x0000000e,0x00000012,
+	0x0004003d,0x00000007,0x00000016,0x00000015,0x00050085,0x00000007,0x00000017,0x00000013,
+	0x00000016,0x0003003e,0x00000009,0x00000017,0x000100fd,0x00010038
+};
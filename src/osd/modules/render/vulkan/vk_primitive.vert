@@ -0,0 +1,24 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+#version 450
+
+// positions arrive in window pixels; the push constant maps them to clip space
+layout(push_constant) uniform transform_block
+{
+	vec2 scale;
+	vec2 offset;
+} u_transform;
+
+layout(location = 0) in vec2 a_position;
+layout(location = 1) in vec2 a_texcoord;
+layout(location = 2) in vec4 a_color;
+
+layout(location = 0) out vec2 v_texcoord;
+layout(location = 1) out vec4 v_color;
+
+void main()
+{
+	v_texcoord = a_texcoord;
+	v_color = a_color;
+	gl_Position = vec4(a_position * u_transform.scale + u_transform.offset, 0.0, 1.0);
+}
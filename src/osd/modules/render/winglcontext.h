@@ -83,6 +83,11 @@ public:
 		(*pfn_wglMakeCurrent)(m_hdc, m_context);
 	}
 
+	virtual void ReleaseCurrent() override
+	{
+		(*pfn_wglMakeCurrent)(m_hdc, nullptr);
+	}
+
 	virtual const char *LastErrorMsg() override
 	{
 		if (m_error[0] == 0)
@@ -100,7 +105,13 @@ public:
 	{
 		if (pfn_wglSwapIntervalEXT != nullptr)
 		{
-			pfn_wglSwapIntervalEXT(swap ? 1 : 0);
+			// negative (adaptive) intervals need WGL_EXT_swap_control_tear
+			if (!pfn_wglSwapIntervalEXT((swap < 0) ? -1 : swap ? 1 : 0))
+				return -1;
+		}
+		else if (swap < 0)
+		{
+			return -1;
 		}
 		return 0;
 	}
@@ -23,6 +23,7 @@
 #include <cmath>
 #include <climits>
 #include <algorithm>
+#include <vector>
 
 #ifdef WIN32
 #include "pa_win_wasapi.h"
@@ -47,6 +48,8 @@ public:
 
 	virtual void update_audio_stream(bool is_throttled, const s16 *buffer, int samples_this_frame) override;
 	virtual void set_mastervolume(int attenuation) override;
+	virtual bool float_output(int &channels) override { channels = 2; return sample_rate() != 0; }
+	virtual void update_audio_stream_float(bool is_throttled, const float *buffer, int channels, int samples_this_frame) override;
 
 private:
 	// Lock free SPSC ring buffer
@@ -123,10 +126,10 @@ private:
 		}
 
 		void att_memcpy(T* dest, const T* data, int n, int attenuation) {
-			int level = powf(10.0, attenuation / 20.0) * 32768;
+			T level = powf(10.0, attenuation / 20.0);
 			n /= sizeof(T);
 			while (n--)
-				*dest++ = (*data++ * level) >> 15;
+				*dest++ = *data++ * level;
 		}
 	};
 
@@ -136,14 +139,15 @@ private:
 		LATENCY_MAX = 5,
 	};
 
-	int                 callback(s16* output_buffer, size_t number_of_frames);
+	int                 callback(float* output_buffer, size_t number_of_frames);
+	void                submit(const float *buffer, int samples);
 	static int          _callback(const void*,
 								  void *output_buffer,
 								  unsigned long number_of_frames,
 								  const PaStreamCallbackTimeInfo*,
 								  PaStreamCallbackFlags,
 								  void *arg) { return static_cast<sound_pa*> (arg)->
-									callback((s16*) output_buffer, number_of_frames * 2); }
+									callback((float*) output_buffer, number_of_frames * 2); }
 
 	PaDeviceIndex       list_get_devidx(const char* api_str, const char* device_str);
 
@@ -152,7 +156,8 @@ private:
 
 	int                 m_attenuation;
 
-	audio_buffer<s16>*  m_ab;
+	audio_buffer<float>* m_ab;
+	std::vector<float>  m_convert;          // 16-bit samples converted for the buffer
 
 	std::atomic<bool>   m_has_underflowed;
 	std::atomic<bool>   m_has_overflowed;
@@ -195,7 +200,7 @@ int sound_pa::init(osd_options const &options)
 	m_audio_latency         = std::min<int>(std::max<int>(m_audio_latency, LATENCY_MIN), LATENCY_MAX);
 
 	try {
-		m_ab = new audio_buffer<s16>(m_sample_rate, 2);
+		m_ab = new audio_buffer<float>(m_sample_rate, 2);
 	} catch (std::bad_alloc&) {
 		osd_printf_error("PortAudio: Unable to allocate audio buffer, sound is disabled\n");
 		goto error;
@@ -208,7 +213,7 @@ int sound_pa::init(osd_options const &options)
 	stream_params.device = list_get_devidx(options.pa_api(), options.pa_device());
 
 	stream_params.channelCount = 2;
-	stream_params.sampleFormat = paInt16;
+	stream_params.sampleFormat = paFloat32;
 	stream_params.hostApiSpecificStreamInfo = NULL;
 
 	device_info = Pa_GetDeviceInfo(stream_params.device);
@@ -246,7 +251,7 @@ int sound_pa::init(osd_options const &options)
 						&stream_params,
 						m_sample_rate,
 						frames_per_callback,
-						paClipOff,
+						paNoFlag,
 						_callback,
 						this);
 
@@ -330,7 +335,7 @@ PaDeviceIndex sound_pa::list_get_devidx(const char* api_str, const char* device_
 	return selected_devidx;
 }
 
-int sound_pa::callback(s16* output_buffer, size_t number_of_samples)
+int sound_pa::callback(float* output_buffer, size_t number_of_samples)
 {
 	int buf_ct = m_ab->count();
 
@@ -377,7 +382,7 @@ int sound_pa::callback(s16* output_buffer, size_t number_of_samples)
 	else
 	{
 		m_ab->read(output_buffer, buf_ct);
-		std::memset(output_buffer + buf_ct, 0, (number_of_samples - buf_ct) * sizeof(s16));
+		std::memset(output_buffer + buf_ct, 0, (number_of_samples - buf_ct) * sizeof(float));
 
 		// if update_audio_stream has been called, note the underflow
 		if (m_osd_ticks)
@@ -394,6 +399,23 @@ void sound_pa::update_audio_stream(bool is_throttled, const s16 *buffer, int sam
 	if (!sample_rate())
 		return;
 
+	m_convert.resize(samples_this_frame * 2);
+	for (int sample = 0; sample < samples_this_frame * 2; sample++)
+		m_convert[sample] = buffer[sample] * (1.0f / 32768.0f);
+	submit(&m_convert[0], samples_this_frame * 2);
+}
+
+void sound_pa::update_audio_stream_float(bool is_throttled, const float *buffer, int channels, int samples_this_frame)
+{
+	if (!sample_rate())
+		return;
+
+	assert(channels == 2);
+	submit(buffer, samples_this_frame * 2);
+}
+
+void sound_pa::submit(const float *buffer, int samples)
+{
 #if LOG_BUFCNT
 	if (m_log.good())
 		m_log << m_ab->count() << std::endl;
@@ -413,7 +435,7 @@ void sound_pa::update_audio_stream(bool is_throttled, const s16 *buffer, int sam
 		m_has_overflowed = false;
 	}
 
-	m_ab->write(buffer, samples_this_frame * 2, m_attenuation);
+	m_ab->write(buffer, samples, m_attenuation);
 
 	// for determining buffer overflows, take the sample here instead of in the callback
 	m_osd_ticks = osd_ticks();
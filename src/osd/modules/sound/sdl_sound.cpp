@@ -46,7 +46,7 @@ public:
 	sound_sdl() :
 		osd_module(OSD_SOUND_PROVIDER, "sdl"), sound_module(),
 		stream_in_initialized(0),
-		attenuation(0), buf_locked(0), stream_buffer(nullptr), stream_buffer_size(0), buffer_underflows(0), buffer_overflows(0)
+		attenuation(0), buf_locked(0), stream_buffer(nullptr), stream_buffer_size(0), target_samples(0), buffer_underflows(0), buffer_overflows(0)
 {
 		sdl_xfer_samples = SDL_XFER_SAMPLES;
 	}
@@ -59,6 +59,7 @@ public:
 
 	virtual void update_audio_stream(bool is_throttled, const int16_t *buffer, int samples_this_frame) override;
 	virtual void set_mastervolume(int attenuation) override;
+	virtual bool buffer_status(int &queued, int &target) override;
 
 private:
 	class ring_buffer
@@ -93,6 +94,7 @@ private:
 	int              buf_locked;
 	std::unique_ptr<ring_buffer> stream_buffer;
 	uint32_t         stream_buffer_size;
+	int              target_samples;    // stereo samples to keep queued in low-latency mode, or 0
 
 
 	// diagnostics
@@ -109,6 +111,9 @@ private:
 // maximum audio latency
 #define MAX_AUDIO_LATENCY       5
 
+// smallest transfer size requested in low-latency mode
+#define MIN_LOW_LATENCY_XFER    64
+
 //============================================================
 //  ring_buffer - constructor
 //============================================================
@@ -245,9 +250,10 @@ void sound_sdl::update_audio_stream(bool is_throttled, const int16_t *buffer, in
 
 	if (!stream_in_initialized)
 	{
-		// Fill in some zeros to prevent an initial buffer underflow
+		// Fill in some zeros to prevent an initial buffer underflow; in
+		// low-latency mode, only prime up to the target
 		int8_t zero = 0;
-		size_t zsize = stream_buffer->free_size() / 2;
+		size_t zsize = target_samples ? (target_samples * sizeof(*buffer) * 2) : (stream_buffer->free_size() / 2);
 		while (zsize--)
 			stream_buffer->append(&zero, 1);
 
@@ -277,6 +283,23 @@ void sound_sdl::update_audio_stream(bool is_throttled, const int16_t *buffer, in
 
 
 
+//============================================================
+//  buffer_status
+//============================================================
+
+bool sound_sdl::buffer_status(int &queued, int &target)
+{
+	if (!target_samples || !stream_buffer)
+		return false;
+
+	lock_buffer();
+	queued = stream_buffer->data_size() / (sizeof(int16_t) * 2);
+	unlock_buffer();
+	target = target_samples;
+	return true;
+}
+
+
 //============================================================
 //  set_mastervolume
 //============================================================
@@ -356,6 +379,12 @@ int sound_sdl::init(const osd_options &options)
 		sdl_xfer_samples = SDL_XFER_SAMPLES;
 		stream_in_initialized = 0;
 
+		// in low-latency mode, ask for transfers of at most half the target
+		target_samples = (m_audio_target_latency > 0) ? std::max(sample_rate() * m_audio_target_latency / 1000, 2 * MIN_LOW_LATENCY_XFER) : 0;
+		if (target_samples)
+			while (sdl_xfer_samples > MIN_LOW_LATENCY_XFER && sdl_xfer_samples > target_samples / 2)
+				sdl_xfer_samples /= 2;
+
 		// set up the audio specs
 		aspec.freq = sample_rate();
 		aspec.format = AUDIO_S16SYS;    // keep endian independent
@@ -371,12 +400,18 @@ int sound_sdl::init(const osd_options &options)
 							obtained.freq, obtained.channels, obtained.samples);
 
 		sdl_xfer_samples = obtained.samples;
+		if (target_samples)
+			target_samples = std::max(target_samples, sdl_xfer_samples);
 
 		// pin audio latency
 		audio_latency = std::max(std::min(m_audio_latency, MAX_AUDIO_LATENCY), 1);
 
-		// compute the buffer sizes
-		stream_buffer_size = (sample_rate() * 2 * sizeof(int16_t) * (2 + audio_latency)) / 30;
+		// compute the buffer sizes; in low-latency mode the buffer only needs
+		// headroom above the target, since the core holds it near the target
+		if (target_samples)
+			stream_buffer_size = (std::max(target_samples, sdl_xfer_samples) * 4) * 2 * sizeof(int16_t);
+		else
+			stream_buffer_size = (sample_rate() * 2 * sizeof(int16_t) * (2 + audio_latency)) / 30;
 		stream_buffer_size = (stream_buffer_size / 1024) * 1024;
 		if (stream_buffer_size < 1024)
 			stream_buffer_size = 1024;
@@ -20,17 +20,25 @@
 class sound_module
 {
 public:
-	sound_module() : m_sample_rate(0), m_audio_latency(1) { }
+	sound_module() : m_sample_rate(0), m_audio_latency(1), m_audio_target_latency(0) { }
 
 	virtual ~sound_module() { }
 
 	virtual void update_audio_stream(bool is_throttled, const int16_t *buffer, int samples_this_frame) = 0;
 	virtual void set_mastervolume(int attenuation) = 0;
 
+	// modules that take interleaved float samples return true with the channel count they want
+	virtual bool float_output(int &channels) { return false; }
+	virtual void update_audio_stream_float(bool is_throttled, const float *buffer, int channels, int samples_this_frame) { }
+
+	// low-latency modules report their queued and target stereo sample counts
+	virtual bool buffer_status(int &queued, int &target) { return false; }
+
 	int sample_rate() const { return m_sample_rate; }
 
 	int m_sample_rate;
 	int m_audio_latency;
+	int m_audio_target_latency;     // in milliseconds; 0 disables low-latency mode
 };
 
 #endif /* FONT_MODULE_H_ */
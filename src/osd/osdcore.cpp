@@ -2,6 +2,7 @@
 // copyright-holders:Aaron Giles
 
 #include "osdcore.h"
+#include <atomic>
 #include <thread>
 #include <chrono>
 
@@ -17,8 +18,25 @@
 #endif
 
 static const int MAXSTACK = 10;
-static osd_output *m_stack[MAXSTACK];
-static int m_ptr = -1;
+
+struct output_stack
+{
+	osd_output *entries[MAXSTACK];
+	int ptr = -1;
+};
+
+// the first thread to push a delegate gets the process-wide stack, which
+// threads that never push one also print to; any other thread that pushes
+// one, like a thread running a machine of its own, gets a stack of its own
+static output_stack s_process_stack;
+static std::atomic<bool> s_process_stack_claimed(false);
+static thread_local output_stack *t_stack = nullptr;
+static thread_local output_stack t_own_stack;
+
+static output_stack &current_stack()
+{
+	return t_stack ? *t_stack : s_process_stack;
+}
 
 /*-------------------------------------------------
     osd_output
@@ -26,30 +44,38 @@ static int m_ptr = -1;
 
 void osd_output::push(osd_output *delegate)
 {
-	if (m_ptr < MAXSTACK)
+	if (!t_stack)
+	{
+		bool expected = false;
+		t_stack = s_process_stack_claimed.compare_exchange_strong(expected, true) ? &s_process_stack : &t_own_stack;
+	}
+
+	output_stack &stack(*t_stack);
+	if (stack.ptr < MAXSTACK - 1)
 	{
-		delegate->m_chain = (m_ptr >= 0 ? m_stack[m_ptr] : nullptr);
-		m_ptr++;
-		m_stack[m_ptr] = delegate;
+		delegate->m_chain = (stack.ptr >= 0 ? stack.entries[stack.ptr] : nullptr);
+		stack.ptr++;
+		stack.entries[stack.ptr] = delegate;
 	}
 }
 
 void osd_output::pop(osd_output *delegate)
 {
+	output_stack &stack(current_stack());
 	int f = -1;
-	for (int i=0; i<=m_ptr; i++)
-		if (m_stack[i] == delegate)
+	for (int i=0; i<=stack.ptr; i++)
+		if (stack.entries[i] == delegate)
 		{
 			f = i;
 			break;
 		}
 	if (f >= 0)
 	{
-		if (f < m_ptr)
-			m_stack[f+1]->m_chain = m_stack[f]->m_chain;
-		m_ptr--;
-		for (int i = f; i <= m_ptr; i++)
-			m_stack[i] = m_stack[i+1];
+		if (f < stack.ptr)
+			stack.entries[f+1]->m_chain = stack.entries[f]->m_chain;
+		stack.ptr--;
+		for (int i = f; i <= stack.ptr; i++)
+			stack.entries[i] = stack.entries[i+1];
 	}
 }
 
@@ -68,7 +94,8 @@ void osd_vprintf_error(util::format_argument_pack<std::ostream> const &args)
 #if defined(SDLMAME_ANDROID)
 	SDL_LogMessage(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_ERROR, "%s", util::string_format(args).c_str());
 #else
-	if (m_ptr >= 0) m_stack[m_ptr]->output_callback(OSD_OUTPUT_CHANNEL_ERROR, args);
+	output_stack const &stack(current_stack());
+	if (stack.ptr >= 0) stack.entries[stack.ptr]->output_callback(OSD_OUTPUT_CHANNEL_ERROR, args);
 #endif
 }
 
@@ -83,7 +110,8 @@ void osd_vprintf_warning(util::format_argument_pack<std::ostream> const &args)
 #if defined(SDLMAME_ANDROID)
 	SDL_LogMessage(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_ERROR, "%s", util::string_format(args).c_str());
 #else
-	if (m_ptr >= 0) m_stack[m_ptr]->output_callback(OSD_OUTPUT_CHANNEL_WARNING, args);
+	output_stack const &stack(current_stack());
+	if (stack.ptr >= 0) stack.entries[stack.ptr]->output_callback(OSD_OUTPUT_CHANNEL_WARNING, args);
 #endif
 }
 
@@ -98,7 +126,8 @@ void osd_vprintf_info(util::format_argument_pack<std::ostream> const &args)
 #if defined(SDLMAME_ANDROID)
 	SDL_LogMessage(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO, "%s", util::string_format(args).c_str());
 #else
-	if (m_ptr >= 0) m_stack[m_ptr]->output_callback(OSD_OUTPUT_CHANNEL_INFO, args);
+	output_stack const &stack(current_stack());
+	if (stack.ptr >= 0) stack.entries[stack.ptr]->output_callback(OSD_OUTPUT_CHANNEL_INFO, args);
 #endif
 }
 
@@ -113,7 +142,8 @@ void osd_vprintf_verbose(util::format_argument_pack<std::ostream> const &args)
 #if defined(SDLMAME_ANDROID)
 	SDL_LogMessage(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_VERBOSE, "%s", util::string_format(args).c_str());
 #else
-	if (m_ptr >= 0) m_stack[m_ptr]->output_callback(OSD_OUTPUT_CHANNEL_VERBOSE, args);
+	output_stack const &stack(current_stack());
+	if (stack.ptr >= 0) stack.entries[stack.ptr]->output_callback(OSD_OUTPUT_CHANNEL_VERBOSE, args);
 #endif
 }
 
@@ -128,7 +158,8 @@ void osd_vprintf_debug(util::format_argument_pack<std::ostream> const &args)
 #if defined(SDLMAME_ANDROID)
 	SDL_LogMessage(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_DEBUG, "%s", util::string_format(args).c_str());
 #else
-	if (m_ptr >= 0) m_stack[m_ptr]->output_callback(OSD_OUTPUT_CHANNEL_DEBUG, args);
+	output_stack const &stack(current_stack());
+	if (stack.ptr >= 0) stack.entries[stack.ptr]->output_callback(OSD_OUTPUT_CHANNEL_DEBUG, args);
 #endif
 }
 
@@ -198,6 +198,20 @@ public:
 	/// \return Result of the operation.
 	virtual error flush() = 0;
 
+	/// \brief Map an open file into memory for reading
+	///
+	/// Maps the whole file read-only.  The view stays valid until the
+	/// file is closed, covers the size of the file at the time of the
+	/// first call, and reflects later writes through the handle.  Not
+	/// all files can be mapped; the default implementation fails.
+	/// \param [out] data Receives a pointer to the start of the file
+	///   data if the operation succeeds.  Not valid if the operation
+	///   fails.
+	/// \param [out] length Receives the number of bytes mapped if the
+	///   operation succeeds.  Not valid if the operation fails.
+	/// \return Result of the operation.
+	virtual error map_view(void const *&data, std::uint64_t &length) { return error::FAILURE; }
+
 	/// \brief Delete a file
 	///
 	/// \param [in] filename Path to the file to delete.
@@ -491,7 +505,8 @@ typedef void *(*osd_work_callback)(void *param, int threadid);
 
             WORK_QUEUE_FLAG_MULTI - indicates that the work queue should
                 take advantage of as many processors as it can; items queued
-                here are assumed to be fully independent or shared
+                here are assumed to be fully independent or shared, and may
+                be started in any order
 
             WORK_QUEUE_FLAG_HIGH_FREQ - indicates that items are expected
                 to be queued at high frequency and acted upon quickly; in
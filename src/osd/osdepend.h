@@ -64,6 +64,7 @@ public:
 	// general overridables
 	virtual void init(running_machine &machine) = 0;
 	virtual void update(bool skip_redraw) = 0;
+	virtual bool present_timing(osd_ticks_t &last_present, osd_ticks_t &period) = 0;
 	virtual void input_update() = 0;
 	virtual void set_verbose(bool print_verbose) = 0;
 
@@ -73,8 +74,11 @@ public:
 
 	// audio overridables
 	virtual void update_audio_stream(const int16_t *buffer, int samples_this_frame) = 0;
+	virtual int audio_float_channels() = 0;
+	virtual void update_audio_stream_float(const float *buffer, int channels, int samples_this_frame) = 0;
 	virtual void set_mastervolume(int attenuation) = 0;
 	virtual bool no_sound() = 0;
+	virtual bool audio_buffer_status(int &queued, int &target) = 0;
 
 	// input overridables
 	virtual void customize_input_type_list(std::vector<input_type_entry> &typelist) = 0;
@@ -38,8 +38,11 @@ class osd_netdev *open_netdev(int id, class device_network_interface *ifdev, int
 osd_netdev::osd_netdev(class device_network_interface *ifdev, int rate)
 {
 	m_dev = ifdev;
+	m_period = attotime::from_hz(rate);
+	m_head = 0;
+	m_count = 0;
 	m_timer = ifdev->device().machine().scheduler().timer_alloc(timer_expired_delegate(FUNC(osd_netdev::recv), this));
-	m_timer->adjust(attotime::from_hz(rate), 0, attotime::from_hz(rate));
+	m_timer->adjust(m_period, 0, m_period);
 }
 
 osd_netdev::~osd_netdev()
@@ -49,6 +52,10 @@ osd_netdev::~osd_netdev()
 void osd_netdev::start()
 {
 	m_timer->enable(true);
+
+	// anything already queued goes to the device now, not at the next poll
+	if(m_count)
+		m_timer->adjust(attotime::zero, 0, m_period);
 }
 
 void osd_netdev::stop()
@@ -63,11 +70,26 @@ int osd_netdev::send(uint8_t *buf, int len)
 
 void osd_netdev::recv(void *ptr, int param)
 {
-	uint8_t *buf;
-	int len;
+	// top up the queue; whatever doesn't fit waits in the host's buffers
+	if(m_count < RECV_QUEUE_FRAMES)
+		recv_dev_batch(RECV_QUEUE_FRAMES - m_count);
+
+	deliver();
+}
+
+void osd_netdev::deliver()
+{
 	//const char atalkmac[] = { 0x09, 0x00, 0x07, 0xff, 0xff, 0xff };
-	while(m_timer->enabled() && (len = recv_dev(&buf)))
+	// the device stops us when it starts a delayed receive, and starts us again when done
+	while(m_timer->enabled() && m_count)
 	{
+		std::vector<uint8_t> &frame = m_frames[m_head];
+		m_head = (m_head + 1) % RECV_QUEUE_FRAMES;
+		m_count--;
+
+		uint8_t *const buf = &frame[0];
+		int const len = frame.size();
+
 #if 0
 		if(buf[0] & 1)
 		{
@@ -89,6 +111,30 @@ int osd_netdev::recv_dev(uint8_t **buf)
 	return 0;
 }
 
+// read up to max frames from the host into the queue; modules that can fetch
+// several frames in one call override this
+int osd_netdev::recv_dev_batch(int max)
+{
+	uint8_t *buf;
+	int len;
+	int count = 0;
+	while((count < max) && (len = recv_dev(&buf)) > 0 && queue_frame(buf, len))
+		count++;
+	return count;
+}
+
+bool osd_netdev::queue_frame(const uint8_t *buf, int len)
+{
+	if(m_count == RECV_QUEUE_FRAMES)
+		return false;
+
+	// slots keep their storage, so steady traffic doesn't allocate
+	std::vector<uint8_t> &frame = m_frames[(m_head + m_count) % RECV_QUEUE_FRAMES];
+	frame.assign(buf, buf + len);
+	m_count++;
+	return true;
+}
+
 void osd_netdev::set_mac(const char *mac)
 {
 }
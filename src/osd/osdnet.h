@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <vector>
+
 class osd_netdev;
 
 #define CREATE_NETDEV(name) class osd_netdev *name(const char *ifname, class device_network_interface *ifdev, int rate)
@@ -34,17 +36,28 @@ public:
 
 protected:
 	virtual int recv_dev(uint8_t **buf);
+	virtual int recv_dev_batch(int max);
+	bool queue_frame(const uint8_t *buf, int len);
 
 private:
+	// frames read from the host but not yet taken by the device
+	static constexpr int RECV_QUEUE_FRAMES = 64;
+
 	void recv(void *ptr, int param);
+	void deliver();
 
 	class device_network_interface *m_dev;
 	emu_timer *m_timer;
+	attotime m_period;
+	std::vector<uint8_t> m_frames[RECV_QUEUE_FRAMES];
+	int m_head;
+	int m_count;
 };
 
 class osd_netdev *open_netdev(int id, class device_network_interface *ifdev, int rate);
 void add_netdev(const char *name, const char *description, create_netdev func);
 void clear_netdev();
+void add_nat_netdev();
 const std::vector<std::unique_ptr<osd_netdev::entry_t>>& get_netdev_list();
 int netdev_count();
 
@@ -21,6 +21,7 @@
 #include <thread>
 #include <vector>
 #include <algorithm>
+#include <memory>
 // MAME headers
 #include "osdcore.h"
 #include "osdsync.h"
@@ -43,9 +44,16 @@
 
 #define ENV_PROCESSORS               "OSDPROCESSORS"
 #define ENV_WORKQUEUEMAXTHREADS      "OSDWORKQUEUEMAXTHREADS"
+#define ENV_WORKQUEUENOSTEAL         "OSDWORKQUEUENOSTEAL"
 
 #define SPIN_LOOP_TIME          (osd_ticks_per_second() / 10000)
 
+#if defined(OSD_WINDOWS) || defined(SDLMAME_WIN32) || defined(SDLMAME_LINUX)
+#define AFFINITY_SUPPORTED      (true)
+#else
+#define AFFINITY_SUPPORTED      (false)
+#endif
+
 //============================================================
 //  MACROS
 //============================================================
@@ -110,6 +118,7 @@ struct work_thread_info
 	, id(aid)
 #if KEEP_STATISTICS
 	, itemsdone(0)
+	, steals(0)
 	, actruntime(0)
 	, runtime(0)
 	, spintime(0)
@@ -125,6 +134,7 @@ struct work_thread_info
 
 #if KEEP_STATISTICS
 	int32_t               itemsdone;
+	int32_t               steals;
 	osd_ticks_t         actruntime;
 	osd_ticks_t         runtime;
 	osd_ticks_t         spintime;
@@ -133,6 +143,16 @@ struct work_thread_info
 };
 
 
+// per-thread list of work for multi queues; the owner takes from the head, and
+// threads that run dry steal from the heads of the others
+struct alignas(64) work_deque
+{
+	std::mutex          lock;           // lock protecting this list
+	std::atomic<osd_work_item *> head;  // first item, checked without the lock
+	osd_work_item *     tail = nullptr; // last item
+};
+
+
 struct osd_work_queue
 {
 	osd_work_queue()
@@ -145,6 +165,9 @@ struct osd_work_queue
 	, exiting(0)
 	, threads(0)
 	, flags(0)
+	, stealing(false)
+	, pending(0)
+	, nextdeque(0)
 	, doneevent(true, true)     // manual reset, signalled
 #if KEEP_STATISTICS
 	, itemsqueued(0)
@@ -165,7 +188,12 @@ struct osd_work_queue
 	std::atomic<int32_t>  exiting;        // should the threads exit on their next opportunity?
 	uint32_t              threads;        // number of threads in this queue
 	uint32_t              flags;          // creation flags
+	bool                stealing;       // items are spread over per-thread deques
+	std::unique_ptr<work_deque[]> deque; // one deque per thread, including the caller
+	std::atomic<int32_t>  pending;        // items queued but not yet started, when stealing
+	std::atomic<uint32_t> nextdeque;      // deque at which to start the next submission
 	std::vector<work_thread_info *>  thread;         // array of thread information
+	std::vector<int>    cores;          // cores to pin worker threads to, if any
 	osd_event           doneevent;      // event signalled when work is complete
 
 #if KEEP_STATISTICS
@@ -207,6 +235,9 @@ struct osd_work_item
 
 int osd_num_processors = 0;
 
+// cores for work queue threads, or empty to let them float
+static std::vector<int> s_work_queue_cores;
+
 //============================================================
 //  FUNCTION PROTOTYPES
 //============================================================
@@ -215,6 +246,9 @@ static int effective_num_processors();
 static void * worker_thread_entry(void *param);
 static void worker_thread_process(osd_work_queue *queue, work_thread_info *thread);
 static bool queue_has_list_items(osd_work_queue *queue);
+static osd_work_item *queue_take_item(osd_work_queue *queue, work_thread_info *thread);
+static bool parse_core_list(const char *cores, std::vector<int> &result);
+static bool pin_current_thread(const std::vector<int> &cores);
 
 //============================================================
 //  osd_thread_adjust_priority
@@ -263,6 +297,7 @@ osd_work_queue *osd_work_queue_alloc(int flags)
 	// initialize basic queue members
 	queue->tailptr = (osd_work_item **)&queue->list;
 	queue->flags = flags;
+	queue->cores = s_work_queue_cores;
 
 	// determine how many threads to create...
 	// on a single-CPU system, create 1 thread for I/O queues, and 0 threads for everything else
@@ -296,6 +331,16 @@ osd_work_queue *osd_work_queue_alloc(int flags)
 	for (threadnum = 0; threadnum < allocthreadnum; threadnum++)
 		queue->thread.push_back(new work_thread_info(threadnum, *queue));
 
+	// multi queues with workers give each thread its own deque, so that
+	// submission and removal do not all contend for the one list lock
+	if ((flags & WORK_QUEUE_FLAG_MULTI) && queue->threads > 0 && osd_getenv(ENV_WORKQUEUENOSTEAL) == nullptr)
+	{
+		queue->stealing = true;
+		queue->deque = std::make_unique<work_deque[]>(allocthreadnum);
+		for (threadnum = 0; threadnum < allocthreadnum; threadnum++)
+			queue->deque[threadnum].head = nullptr;
+	}
+
 	// iterate over threads
 	for (threadnum = 0; threadnum < queue->threads; threadnum++)
 	{
@@ -427,8 +472,8 @@ void osd_work_queue_free(osd_work_queue *queue)
 	for (work_thread_info *thread : queue->thread)
 	{
 		osd_ticks_t total = thread->runtime + thread->waittime + thread->spintime;
-		printf("Thread %d:  items=%9d run=%5.2f%% (%5.2f%%)  spin=%5.2f%%  wait/other=%5.2f%% total=%9d\n",
-				thread->id, thread->itemsdone,
+		printf("Thread %d:  items=%9d steals=%9d run=%5.2f%% (%5.2f%%)  spin=%5.2f%%  wait/other=%5.2f%% total=%9d\n",
+				thread->id, thread->itemsdone, thread->steals,
 				(double)thread->runtime * 100.0 / (double)total,
 				(double)thread->actruntime * 100.0 / (double)total,
 				(double)thread->spintime * 100.0 / (double)total,
@@ -460,6 +505,17 @@ void osd_work_queue_free(osd_work_queue *queue)
 		delete item;
 	}
 
+	// and in the per-thread deques
+	if (queue->stealing)
+		for (int threadnum = 0; threadnum <= queue->threads; threadnum++)
+			while (queue->deque[threadnum].head.load() != nullptr)
+			{
+				auto *item = queue->deque[threadnum].head.load();
+				queue->deque[threadnum].head = item->next;
+				delete item->event;
+				delete item;
+			}
+
 #if KEEP_STATISTICS
 	printf("Items queued   = %9d\n", queue->itemsqueued.load());
 	printf("SetEvent calls = %9d\n", queue->setevents.load());
@@ -523,15 +579,52 @@ osd_work_item *osd_work_item_queue_multiple(osd_work_queue *queue, osd_work_call
 		parambase = (uint8_t *)parambase + paramstep;
 	}
 
-	// enqueue the whole thing within the critical section
+	if (queue->stealing)
 	{
-		std::lock_guard<std::mutex> lock(queue->lock);
-		*queue->tailptr = itemlist;
-		queue->tailptr = item_tailptr;
+		// count the items first so that no worker sees them before they are counted
+		queue->items += numitems;
+		queue->pending += numitems;
+
+		// split the list into one run per worker, starting where the last
+		// submission left off so that single items are spread around too
+		int const runs = std::min<int>(numitems, queue->threads);
+		uint32_t dequenum = queue->nextdeque.fetch_add(runs) % queue->threads;
+		osd_work_item *run = itemlist;
+		for (int runnum = 0; runnum < runs; runnum++)
+		{
+			int const count = numitems / runs + ((runnum < numitems % runs) ? 1 : 0);
+			osd_work_item *runlast = run;
+			for (int itemnum2 = 1; itemnum2 < count; itemnum2++)
+				runlast = runlast->next;
+			osd_work_item *const next = runlast->next;
+			runlast->next = nullptr;
+
+			// append the whole run under a single lock
+			work_deque &deque = queue->deque[dequenum];
+			{
+				std::lock_guard<std::mutex> lock(deque.lock);
+				if (deque.tail != nullptr)
+					deque.tail->next = run;
+				else
+					deque.head = run;
+				deque.tail = runlast;
+			}
+			run = next;
+			dequenum = (dequenum + 1) % queue->threads;
+		}
 	}
+	else
+	{
+		// enqueue the whole thing within the critical section
+		{
+			std::lock_guard<std::mutex> lock(queue->lock);
+			*queue->tailptr = itemlist;
+			queue->tailptr = item_tailptr;
+		}
 
-	// increment the number of items in the queue
-	queue->items += numitems;
+		// increment the number of items in the queue
+		queue->items += numitems;
+	}
 	add_to_stat(queue->itemsqueued, numitems);
 
 	// look for free threads to do the work
@@ -673,6 +766,10 @@ static void *worker_thread_entry(void *param)
 	auto *thread = (work_thread_info *)param;
 	osd_work_queue &queue = thread->queue;
 
+	// spread workers over the configured cores, one core each
+	if (!queue.cores.empty())
+		pin_current_thread(std::vector<int>{ queue.cores[thread->id % queue.cores.size()] });
+
 	// loop until we exit
 	for ( ;; )
 	{
@@ -702,7 +799,14 @@ static void *worker_thread_entry(void *param)
 			worker_thread_process(&queue, thread);
 
 			// if we're a high frequency queue, spin for a while before giving up
-			if (queue.flags & WORK_QUEUE_FLAG_HIGH_FREQ && queue.list.load() == nullptr)
+			if (queue.flags & WORK_QUEUE_FLAG_HIGH_FREQ && queue.stealing && queue.pending == 0)
+			{
+				// spin for a while looking for more work
+				begin_timing(thread->spintime);
+				spin_while<std::atomic<int32_t>, int32_t>(&queue.pending, 0, SPIN_LOOP_TIME);
+				end_timing(thread->spintime);
+			}
+			else if (queue.flags & WORK_QUEUE_FLAG_HIGH_FREQ && !queue.stealing && queue.list.load() == nullptr)
 			{
 				// spin for a while looking for more work
 				begin_timing(thread->spintime);
@@ -742,7 +846,16 @@ static void worker_thread_process(osd_work_queue *queue, work_thread_info *threa
 
 		bool end_loop = false;
 
+		// take from our own deque, or steal from another
+		if (queue->stealing)
+		{
+			item = queue_take_item(queue, thread);
+			if (item == nullptr)
+				end_loop = true;
+		}
+
 		// use a critical section to synchronize the removal of items
+		else
 		{
 			std::lock_guard<std::mutex> lock(queue->lock);
 
@@ -813,7 +926,135 @@ static void worker_thread_process(osd_work_queue *queue, work_thread_info *threa
 
 bool queue_has_list_items(osd_work_queue *queue)
 {
+	if (queue->stealing)
+		return queue->pending != 0;
+
 	std::lock_guard<std::mutex> lock(queue->lock);
 	bool has_list_items = (queue->list.load() != nullptr);
 	return has_list_items;
 }
+
+
+//============================================================
+//  queue_take_item
+//============================================================
+
+static osd_work_item *queue_take_item(osd_work_queue *queue, work_thread_info *thread)
+{
+	// start with our own deque, then move on to the others in turn
+	int const numdeques = queue->threads + 1;
+	for (int offset = 0; offset < numdeques; offset++)
+	{
+		work_deque &deque = queue->deque[(thread->id + offset) % numdeques];
+
+		// skip empty deques without taking their locks
+		if (deque.head.load(std::memory_order_relaxed) == nullptr)
+			continue;
+
+		osd_work_item *item;
+		{
+			std::lock_guard<std::mutex> lock(deque.lock);
+			item = deque.head;
+			if (item == nullptr)
+				continue;
+			deque.head = item->next;
+			if (item->next == nullptr)
+				deque.tail = nullptr;
+		}
+
+		--queue->pending;
+		if (offset != 0)
+			add_to_stat(thread->steals, 1);
+		return item;
+	}
+	return nullptr;
+}
+
+
+//============================================================
+//  osd_set_current_thread_affinity
+//============================================================
+
+bool osd_set_current_thread_affinity(const char *cores)
+{
+	std::vector<int> list;
+	if (!parse_core_list(cores, list))
+		return false;
+	return list.empty() || pin_current_thread(list);
+}
+
+
+//============================================================
+//  osd_set_work_queue_affinity
+//============================================================
+
+bool osd_set_work_queue_affinity(const char *cores)
+{
+	std::vector<int> list;
+	if (!parse_core_list(cores, list))
+		return false;
+	s_work_queue_cores = std::move(list);
+	return s_work_queue_cores.empty() || AFFINITY_SUPPORTED;
+}
+
+
+//============================================================
+//  parse_core_list
+//============================================================
+
+static bool parse_core_list(const char *cores, std::vector<int> &result)
+{
+	result.clear();
+	if (cores == nullptr)
+		return true;
+
+	const char *str = cores;
+	while (*str != 0)
+	{
+		// each entry is either a single core or an inclusive range
+		int first, last, chars;
+		if (sscanf(str, "%d-%d%n", &first, &last, &chars) != 2)
+		{
+			if (sscanf(str, "%d%n", &first, &chars) != 1)
+				return false;
+			last = first;
+		}
+		if (first < 0 || last < first || last >= 1024)
+			return false;
+		for (int core = first; core <= last; core++)
+			if (std::find(result.begin(), result.end(), core) == result.end())
+				result.push_back(core);
+		str += chars;
+
+		if (*str == ',')
+			str++;
+		else if (*str != 0)
+			return false;
+	}
+	return true;
+}
+
+
+//============================================================
+//  pin_current_thread
+//============================================================
+
+static bool pin_current_thread(const std::vector<int> &cores)
+{
+#if defined(OSD_WINDOWS) || defined(SDLMAME_WIN32)
+	DWORD_PTR mask = 0;
+	for (int core : cores)
+		if (core < int(sizeof(mask) * 8))
+			mask |= DWORD_PTR(1) << core;
+	return mask != 0 && SetThreadAffinityMask(GetCurrentThread(), mask) != 0;
+#elif defined(SDLMAME_LINUX)
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	for (int core : cores)
+		if (core < CPU_SETSIZE)
+			CPU_SET(core, &set);
+	return CPU_COUNT(&set) != 0 && pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+	return false;
+#endif
+}
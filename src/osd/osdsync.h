@@ -164,4 +164,41 @@ private:
 
 };
 
+//============================================================
+//  THREAD AFFINITY
+//============================================================
+
+/*-----------------------------------------------------------------------------
+    osd_set_current_thread_affinity: restrict the calling thread to a set
+    of cores
+
+    Parameters:
+
+        cores - a list of core numbers and ranges such as "0-3,8"; an empty
+            string leaves the thread free to run anywhere
+
+    Return value:
+
+        false if the list could not be parsed or the host does not support
+        setting thread affinity
+-----------------------------------------------------------------------------*/
+bool osd_set_current_thread_affinity(const char *cores);
+
+
+/*-----------------------------------------------------------------------------
+    osd_set_work_queue_affinity: set the cores used by the worker threads of
+    work queues allocated from now on; each worker is pinned to one core of
+    the set in turn
+
+    Parameters:
+
+        cores - a core list as for osd_set_current_thread_affinity
+
+    Return value:
+
+        false if the list could not be parsed or the host does not support
+        setting thread affinity
+-----------------------------------------------------------------------------*/
+bool osd_set_work_queue_affinity(const char *cores);
+
 #endif // MAME_OSD_OSDSYNC_H
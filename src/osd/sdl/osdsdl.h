@@ -43,6 +43,7 @@
 #define SDLOPTVAL_SOFT                  "soft"
 #define SDLOPTVAL_SDL2ACCEL             "accel"
 #define SDLOPTVAL_BGFX                  "bgfx"
+#define SDLOPTVAL_VULKAN                "vulkan"
 
 #define SDLMAME_LED(x)                  "led" #x
 
@@ -25,6 +25,7 @@
 
 // standard includes
 #if !defined(SDLMAME_WIN32)
+#include <csignal>
 #include <unistd.h>
 #endif
 
@@ -205,6 +206,9 @@ int main(int argc, char** argv)
 
 #ifdef SDLMAME_UNIX
 	sdl_entered_debugger = 0;
+
+	// a movie or audio consumer closing its pipe or socket should be a write error, not fatal
+	signal(SIGPIPE, SIG_IGN);
 #if (!defined(SDLMAME_MACOSX)) && (!defined(SDLMAME_HAIKU)) && (!defined(SDLMAME_EMSCRIPTEN)) && (!defined(SDLMAME_ANDROID))
 	FcInit();
 #endif
@@ -380,6 +384,9 @@ void sdl_osd_interface::video_register()
 	video_options_add("opengl", nullptr);
 #endif
 	video_options_add("bgfx", nullptr);
+#if USE_VULKAN
+	video_options_add("vulkan", nullptr);
+#endif
 	//video_options_add("auto", nullptr); // making d3d video default one
 }
 
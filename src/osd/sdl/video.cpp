@@ -237,6 +237,10 @@ void sdl_osd_interface::extract_video_config()
 	{
 		video_config.mode = VIDEO_MODE_BGFX;
 	}
+#if (USE_VULKAN)
+	else if (strcmp(stemp, SDLOPTVAL_VULKAN) == 0)
+		video_config.mode = VIDEO_MODE_VULKAN;
+#endif
 	else
 	{
 		osd_printf_warning("Invalid video value %s; reverting to software\n", stemp);
@@ -254,6 +258,15 @@ void sdl_osd_interface::extract_video_config()
 		video_config.syncrefresh = 0;
 	}
 
+	video_config.renderthread  = options().render_thread();
+	video_config.vrr           = options().vrr();
+	if (video_config.vrr)
+	{
+		// the display waits for each frame, so vsync no longer holds us to a fixed rate
+		video_config.waitvsync = 1;
+		video_config.syncrefresh = 0;
+	}
+
 	if (video_config.prescale < 1 || video_config.prescale > 8)
 	{
 		osd_printf_warning("Invalid prescale option, reverting to '1'\n");
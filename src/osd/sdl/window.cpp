@@ -41,6 +41,9 @@
 #if (USE_OPENGL)
 #include "modules/render/drawogl.h"
 #endif
+#if (USE_VULKAN)
+#include "modules/render/drawvk.h"
+#endif
 
 //============================================================
 //  PARAMETERS
@@ -108,6 +111,11 @@ bool sdl_osd_interface::window_init()
 		case VIDEO_MODE_SOFT:
 			renderer_sdl1::init(machine());
 			break;
+#if (USE_VULKAN)
+		case VIDEO_MODE_VULKAN:
+			renderer_vulkan::init(machine());
+			break;
+#endif
 	}
 
 	/* We may want to set a number of the hints SDL2 provides.
@@ -208,6 +216,11 @@ void sdl_osd_interface::window_exit()
 		case VIDEO_MODE_OPENGL:
 			renderer_ogl::exit();
 			break;
+#endif
+#if (USE_VULKAN)
+		case VIDEO_MODE_VULKAN:
+			renderer_vulkan::exit();
+			break;
 #endif
 		default:
 			break;
@@ -299,6 +312,7 @@ void sdl_window_info::toggle_full_screen()
 	// reset UI to main menu
 	machine().ui().menu_reset();
 	// kill off the drawers
+	stop_render_thread();
 	renderer_reset();
 	bool is_osx = false;
 #ifdef SDLMAME_MACOSX
@@ -447,6 +461,9 @@ error:
 
 void sdl_window_info::complete_destroy()
 {
+	// finish drawing before the window goes away
+	stop_render_thread();
+
 	// Release pointer grab and hide if needed
 	show_pointer();
 	release_pointer();
@@ -594,7 +611,20 @@ void sdl_window_info::update()
 		else
 			event_wait_ticks = 0;
 
-		if (m_rendered_event.wait(event_wait_ticks))
+		if (render_threaded())
+		{
+			// hand the primitives to the render thread; if it's still busy with the last
+			// frame, wait for it when throttled and drop this frame otherwise
+			render_primitive_list *const primlist = renderer().get_primitives();
+			const screen_device *screen = screen_device_iterator(machine().root_device()).byindex(m_index);
+			if ((screen != nullptr) && (screen->screen_type() == SCREEN_TYPE_VECTOR))
+				renderer().set_flags(osd_renderer::FLAG_HAS_VECTOR_SCREEN);
+			else
+				renderer().clear_flags(osd_renderer::FLAG_HAS_VECTOR_SCREEN);
+			if (primlist != nullptr)
+				submit_to_render_thread(*primlist, 1, (machine().video().throttled() || event_wait_ticks) ? osd_ticks_per_second() : 0);
+		}
+		else if (m_rendered_event.wait(event_wait_ticks))
 		{
 			const int update = 1;
 
@@ -626,7 +656,7 @@ void sdl_window_info::update()
 				if( video_config.perftest )
 					measure_fps(update);
 				else
-					renderer().draw(update);
+					draw_and_present(update);
 			}
 
 			/* all done, ready for next */
@@ -699,6 +729,10 @@ int sdl_window_info::complete_create()
 		SDL_GL_SetAttribute( SDL_GL_DOUBLEBUFFER, 1 );
 		m_extra_flags = SDL_WINDOW_OPENGL;
 	}
+#if (USE_VULKAN)
+	else if (renderer().has_flags(osd_renderer::FLAG_NEEDS_VULKAN) && !video_config.novideo)
+		m_extra_flags = SDL_WINDOW_VULKAN;
+#endif
 	else
 		m_extra_flags = 0;
 
@@ -744,6 +778,8 @@ int sdl_window_info::complete_create()
 	{
 		if (renderer().has_flags(osd_renderer::FLAG_NEEDS_OPENGL))
 			osd_printf_error("OpenGL not supported on this driver: %s\n", SDL_GetError());
+		else if (renderer().has_flags(osd_renderer::FLAG_NEEDS_VULKAN))
+			osd_printf_error("Vulkan not supported on this driver: %s\n", SDL_GetError());
 		else
 			osd_printf_error("Window creation failed: %s\n", SDL_GetError());
 		return 1;
@@ -814,6 +850,8 @@ int sdl_window_info::complete_create()
 	// initialize the drawing backend
 	if (renderer().create())
 		return 1;
+	if (video_config.renderthread && !video_config.perftest)
+		start_render_thread();
 
 	// Make sure we have a consistent state
 	SDL_ShowCursor(0);
@@ -843,7 +881,7 @@ void sdl_window_info::measure_fps(int update)
 
 	t0 = osd_ticks();
 
-	renderer().draw(update);
+	draw_and_present(update);
 
 	frames++;
 	currentTime = osd_ticks();
@@ -1436,7 +1436,7 @@ void win_window_info::draw_video_contents(HDC dc, bool update)
 		{
 			// update DC
 			m_dc = dc;
-			renderer().draw(update);
+			draw_and_present(update);
 		}
 	}
 }
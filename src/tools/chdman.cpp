@@ -93,6 +93,7 @@ const int MODE_GDI = 2;
 #define OPTION_HUNK_SIZE "hunksize"
 #define OPTION_UNIT_SIZE "unitsize"
 #define OPTION_COMPRESSION "compression"
+#define OPTION_ZSTD_DICTIONARY "zstddict"
 #define OPTION_INPUT_PARENT "inputparent"
 #define OPTION_OUTPUT_PARENT "outputparent"
 #define OPTION_IDENT "ident"
@@ -156,7 +157,7 @@ struct command_description
 	const char *name;
 	void (*handler)(parameters_map &);
 	const char *description;
-	const char *valid_options[16];
+	const char *valid_options[20];
 };
 
 
@@ -584,6 +585,7 @@ static const option_description s_options[] =
 	{ OPTION_HUNK_SIZE,             "hs",   true, " <bytes>: size of each hunk, in bytes" },
 	{ OPTION_UNIT_SIZE,             "us",   true, " <bytes>: size of each unit, in bytes" },
 	{ OPTION_COMPRESSION,           "c",    true, " <none|type1[,type2[,...]]>: which compression codecs to use (up to 4)" },
+	{ OPTION_ZSTD_DICTIONARY,       "zd",   true, " <bytes>: train a dictionary of up to this size for the zstd codecs" },
 	{ OPTION_IDENT,                 "id",   true, " <filename>: name of ident file to provide CHS information" },
 	{ OPTION_CHS,                   "chs",  true, " <cylinders,heads,sectors>: specifies CHS values directly" },
 	{ OPTION_SECTOR_SIZE,           "ss",   true, " <bytes>: size of each hard disk sector" },
@@ -630,6 +632,7 @@ static const command_description s_commands[] =
 			REQUIRED OPTION_HUNK_SIZE,
 			REQUIRED OPTION_UNIT_SIZE,
 			OPTION_COMPRESSION,
+			OPTION_ZSTD_DICTIONARY,
 			OPTION_NUMPROCESSORS
 		}
 	},
@@ -646,6 +649,7 @@ static const command_description s_commands[] =
 			OPTION_INPUT_LENGTH_HUNKS,
 			OPTION_HUNK_SIZE,
 			OPTION_COMPRESSION,
+			OPTION_ZSTD_DICTIONARY,
 			OPTION_TEMPLATE,
 			OPTION_IDENT,
 			OPTION_CHS,
@@ -663,6 +667,7 @@ static const command_description s_commands[] =
 			REQUIRED OPTION_INPUT,
 			OPTION_HUNK_SIZE,
 			OPTION_COMPRESSION,
+			OPTION_ZSTD_DICTIONARY,
 			OPTION_NUMPROCESSORS
 		}
 	},
@@ -741,6 +746,7 @@ static const command_description s_commands[] =
 			OPTION_INPUT_LENGTH_HUNKS,
 			OPTION_HUNK_SIZE,
 			OPTION_COMPRESSION,
+			OPTION_ZSTD_DICTIONARY,
 			OPTION_NUMPROCESSORS
 		}
 	},
@@ -1189,6 +1195,30 @@ static void parse_numprocessors(const parameters_map &params)
 }
 
 
+//-------------------------------------------------
+//  parse_zstd_dictionary - handle the zstddict
+//  option; the dictionary has to be in place
+//  before compression begins
+//-------------------------------------------------
+
+static void parse_zstd_dictionary(const parameters_map &params, chd_file_compressor &chd)
+{
+	auto dictionary_str = params.find(OPTION_ZSTD_DICTIONARY);
+	if (dictionary_str == params.end())
+		return;
+
+	int maxbytes = atoi(dictionary_str->second->c_str());
+	if (maxbytes <= 0)
+		report_error(1, "Invalid dictionary size");
+	progress(true, "Training dictionary...\r");
+	chd_error err = chd.train_zstd_dictionary(maxbytes);
+	if (err == CHDERR_INVALID_PARAMETER)
+		report_error(1, "A dictionary can only be used with the zstd or cdzs codecs");
+	if (err != CHDERR_NONE)
+		report_error(1, "Error training dictionary: %s", chd_file::error_string(err));
+}
+
+
 //-------------------------------------------------
 //  compression_string - create a friendly string
 //  describing a set of compressors
@@ -1564,25 +1594,21 @@ static void do_verify(parameters_map &params)
 	if (raw_sha1 == util::sha1_t::null)
 		report_error(0, "No verification to be done; CHD has no checksum");
 
-	// create an array to read into
-	std::vector<uint8_t> buffer((TEMP_BUFFER_SIZE / input_chd.hunk_bytes()) * input_chd.hunk_bytes());
-
-	// read all the data and build up an SHA-1
+	// read all the data and build up an SHA-1; hunks are decompressed in parallel
 	util::sha1_creator rawsha1;
-	for (uint64_t offset = 0; offset < input_chd.logical_bytes(); )
+	uint64_t logical_bytes = input_chd.logical_bytes();
+	uint32_t hunk_bytes = input_chd.hunk_bytes();
+	uint32_t hunk_count = (logical_bytes + hunk_bytes - 1) / hunk_bytes;
+	chd_error err = input_chd.read_hunks_parallel(0, hunk_count, [&] (uint32_t hunknum, const uint8_t *data)
 	{
-		progress(false, "Verifying, %.1f%% complete... \r", 100.0 * double(offset) / double(input_chd.logical_bytes()));
+		uint64_t offset = uint64_t(hunknum) * hunk_bytes;
+		progress(false, "Verifying, %.1f%% complete... \r", 100.0 * double(offset) / double(logical_bytes));
 
-		// determine how much to read
-		uint32_t bytes_to_read = (std::min<uint64_t>)(buffer.size(), input_chd.logical_bytes() - offset);
-		chd_error err = input_chd.read_bytes(offset, &buffer[0], bytes_to_read);
-		if (err != CHDERR_NONE)
-			report_error(1, "Error reading CHD file (%s): %s", params.find(OPTION_INPUT)->second->c_str(), chd_file::error_string(err));
-
-		// add to the checksum
-		rawsha1.append(&buffer[0], bytes_to_read);
-		offset += bytes_to_read;
-	}
+		// add to the checksum, stopping at the logical end
+		rawsha1.append(data, (std::min<uint64_t>)(hunk_bytes, logical_bytes - offset));
+	});
+	if (err != CHDERR_NONE)
+		report_error(1, "Error reading CHD file (%s): %s", params.find(OPTION_INPUT)->second->c_str(), chd_file::error_string(err));
 	util::sha1_t computed_sha1 = rawsha1.finish();
 
 	// finish up
@@ -1705,6 +1731,7 @@ static void do_create_raw(parameters_map &params)
 			chd->clone_all_metadata(output_parent);
 
 		// compress it generically
+		parse_zstd_dictionary(params, *chd);
 		compress_common(*chd);
 	}
 	catch (...)
@@ -1913,7 +1940,10 @@ static void do_create_hd(parameters_map &params)
 
 		// compress it generically
 		if (input_file)
+		{
+			parse_zstd_dictionary(params, *chd);
 			compress_common(*chd);
+		}
 	}
 	catch (...)
 	{
@@ -2002,6 +2032,7 @@ static void do_create_cd(parameters_map &params)
 			report_error(1, "Error adding CD metadata: %s", chd_file::error_string(err));
 
 		// compress it generically
+		parse_zstd_dictionary(params, *chd);
 		compress_common(*chd);
 		delete chd;
 	}
@@ -2242,6 +2273,10 @@ static void do_copy(parameters_map &params)
 				continue;
 			}
 
+			// a dictionary only matches the input's compression
+			if (metatag == ZSTD_DICTIONARY_METADATA_TAG)
+				continue;
+
 			// otherwise, clone it
 			err = chd->write_metadata(metatag, CHDMETAINDEX_APPEND, metadata, metaflags);
 			if (err != CHDERR_NONE)
@@ -2263,6 +2298,7 @@ static void do_copy(parameters_map &params)
 		}
 
 		// compress it generically
+		parse_zstd_dictionary(params, *chd);
 		compress_common(*chd);
 		delete chd;
 	}
@@ -2318,26 +2354,26 @@ static void do_extract_raw(parameters_map &params)
 		if (filerr != osd_file::error::NONE)
 			report_error(1, "Unable to open file (%s)", output_file_str->second->c_str());
 
-		// copy all data
-		std::vector<uint8_t> buffer((TEMP_BUFFER_SIZE / input_chd.hunk_bytes()) * input_chd.hunk_bytes());
-		for (uint64_t offset = input_start; offset < input_end; )
-		{
-			progress(false, "Extracting, %.1f%% complete... \r", 100.0 * double(offset - input_start) / double(input_end - input_start));
-
-			// determine how much to read
-			uint32_t bytes_to_read = (std::min<uint64_t>)(buffer.size(), input_end - offset);
-			chd_error err = input_chd.read_bytes(offset, &buffer[0], bytes_to_read);
-			if (err != CHDERR_NONE)
-				report_error(1, "Error reading CHD file (%s): %s", params.find(OPTION_INPUT)->second->c_str(), chd_file::error_string(err));
-
-			// write to the output
-			uint32_t count = output_file->write(&buffer[0], bytes_to_read);
-			if (count != bytes_to_read)
-				report_error(1, "Error writing to file; check disk space (%s)", output_file_str->second->c_str());
-
-			// advance
-			offset += bytes_to_read;
-		}
+		// copy all data; hunks are decompressed in parallel and written in order
+		uint32_t hunk_bytes = input_chd.hunk_bytes();
+		uint32_t first_hunk = input_start / hunk_bytes;
+		uint32_t last_hunk = (input_end - 1) / hunk_bytes;
+		chd_error err = CHDERR_NONE;
+		if (input_end > input_start)
+			err = input_chd.read_hunks_parallel(first_hunk, last_hunk + 1 - first_hunk, [&] (uint32_t hunknum, const uint8_t *data)
+			{
+				uint64_t offset = (std::max<uint64_t>)(input_start, uint64_t(hunknum) * hunk_bytes);
+				progress(false, "Extracting, %.1f%% complete... \r", 100.0 * double(offset - input_start) / double(input_end - input_start));
+
+				// write the part of the hunk within range to the output
+				uint32_t startoffs = offset % hunk_bytes;
+				uint32_t bytes_to_write = (std::min<uint64_t>)(hunk_bytes - startoffs, input_end - offset);
+				uint32_t count = output_file->write(&data[startoffs], bytes_to_write);
+				if (count != bytes_to_write)
+					report_error(1, "Error writing to file; check disk space (%s)", output_file_str->second->c_str());
+			});
+		if (err != CHDERR_NONE)
+			report_error(1, "Error reading CHD file (%s): %s", params.find(OPTION_INPUT)->second->c_str(), chd_file::error_string(err));
 
 		// finish up
 		output_file.reset();
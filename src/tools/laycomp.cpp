@@ -0,0 +1,99 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    laycomp.cpp
+
+    Compiles a layout file to a header containing a compressed binary
+    document, for use as an internal layout.  The binary document is read
+    back by util::xml::file::binary_read without parsing any XML, which
+    is considerably cheaper for large layouts.
+
+    Usage: laycomp <input.lay> <output.lh> <variable>
+
+***************************************************************************/
+
+#include "corefile.h"
+#include "xmlfile.h"
+
+#include <zlib.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+
+/*-------------------------------------------------
+    main - main entry point
+-------------------------------------------------*/
+
+int main(int argc, char *argv[])
+{
+	if (argc != 4)
+	{
+		fprintf(stderr, "Usage:\nlaycomp <input.lay> <output.lh> <variable>\n");
+		return 1;
+	}
+	char const *const srcfile(argv[1]);
+	char const *const dstfile(argv[2]);
+	char const *const varname(argv[3]);
+
+	// parse the layout with the same parser used at run time
+	util::core_file::ptr src;
+	if (util::core_file::open(srcfile, OPEN_FLAG_READ, src) != osd_file::error::NONE)
+	{
+		fprintf(stderr, "Error opening %s\n", srcfile);
+		return 1;
+	}
+	util::xml::parse_error err;
+	util::xml::parse_options opts;
+	opts.error = &err;
+	util::xml::file::ptr const root(util::xml::file::read(*src, &opts));
+	src.reset();
+	if (!root)
+	{
+		fprintf(stderr, "%s:%d:%d: %s\n", srcfile, err.error_line, err.error_column, err.error_message ? err.error_message : "error reading file");
+		return 1;
+	}
+	if (!root->get_child("mamelayout"))
+	{
+		fprintf(stderr, "%s: missing mamelayout element\n", srcfile);
+		return 1;
+	}
+
+	// convert to a binary document and compress it
+	std::vector<uint8_t> binary;
+	root->write_binary(binary);
+	uLongf compressed_size(compressBound(binary.size()));
+	std::vector<uint8_t> compressed(compressed_size);
+	if (compress2(&compressed[0], &compressed_size, &binary[0], binary.size(), Z_BEST_COMPRESSION) != Z_OK)
+	{
+		fprintf(stderr, "%s: error compressing layout\n", srcfile);
+		return 1;
+	}
+
+	// write the header
+	FILE *const dst(fopen(dstfile, "w"));
+	if (!dst)
+	{
+		fprintf(stderr, "Error opening %s\n", dstfile);
+		return 1;
+	}
+	fprintf(dst, "static const unsigned char %s_data[%lu] = {", varname, static_cast<unsigned long>(compressed_size));
+	for (uLongf i = 0; compressed_size > i; ++i)
+		fprintf(dst, "%s0x%02x,", (i % 16) ? " " : "\n\t", compressed[i]);
+	fprintf(dst, "\n};\n\n");
+	fprintf(dst, "extern const internal_layout %s;\n", varname);
+	fprintf(dst, "const internal_layout %s = {\n", varname);
+	fprintf(dst, "\t%lu, sizeof(%s_data), internal_layout::compression::ZLIB, %s_data\n", static_cast<unsigned long>(binary.size()), varname, varname);
+	fprintf(dst, "};\n");
+	bool const ok(!ferror(dst));
+	if (fclose(dst) || !ok)
+	{
+		fprintf(stderr, "Error writing %s\n", dstfile);
+		remove(dstfile);
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,203 @@
+#!/usr/bin/python3
+##
+## license:BSD-3-Clause
+## copyright-holders:MAMEdev Team
+
+# Emulation performance regression runner
+#
+# Runs each system listed in a manifest headless for a fixed number of
+# emulated seconds, optionally replaying recorded input, and collects the
+# overall speed, peak resident set size and frame time distribution into
+# a JSON report.  Two reports can then be compared to find regressions.
+#
+# Manifest format - one system per line, blank lines and lines starting
+# with # are ignored:
+#
+#   <system> [seconds=<n>] [warmup=<n>] [inp=<file>] [<extra options>...]
+#
+# Input recordings are .inp files made with -record; relative paths are
+# relative to the manifest.
+#
+# Usage:
+#   perftest.py run <mame> <manifest> <report.json> [-seconds n] [-warmup n] [-- options...]
+#   perftest.py compare <before.json> <after.json> [-threshold percent]
+
+import json
+import os
+import platform
+import shlex
+import subprocess
+import sys
+import tempfile
+import time
+
+
+DEFAULT_SECONDS = 60
+DEFAULT_WARMUP = 5
+DEFAULT_THRESHOLD = 5.0
+
+
+def parseManifest(filename, seconds, warmup):
+    entries = []
+    base = os.path.dirname(os.path.abspath(filename))
+    with open(filename, 'r') as f:
+        for lineno, line in enumerate(f, 1):
+            line = line.strip()
+            if not line or line.startswith('#'):
+                continue
+            fields = shlex.split(line)
+            entry = { 'system': fields[0], 'seconds': seconds, 'warmup': warmup, 'inp': None, 'options': [ ] }
+            for field in fields[1:]:
+                if field.startswith('seconds='):
+                    entry['seconds'] = int(field[8:])
+                elif field.startswith('warmup='):
+                    entry['warmup'] = float(field[7:])
+                elif field.startswith('inp='):
+                    entry['inp'] = os.path.join(base, field[4:])
+                else:
+                    entry['options'].append(field)
+            if entry['warmup'] >= entry['seconds']:
+                raise ValueError('%s:%d: warmup must be shorter than the run' % (filename, lineno))
+            entries.append(entry)
+    return entries
+
+
+def runSystem(mame, entry, options, workdir):
+    logfile = os.path.join(workdir, entry['system'] + '.jsonl')
+    if os.path.exists(logfile):
+        os.remove(logfile)
+    command = [ mame, entry['system'],
+            '-bench', str(entry['seconds']),
+            '-benchlog', logfile,
+            '-benchwarmup', str(entry['warmup']),
+            '-nodebug', '-skip_gameinfo', '-nonvram_save',
+            '-cfg_directory', os.path.join(workdir, 'cfg'),
+            '-nvram_directory', os.path.join(workdir, 'nvram') ]
+    if entry['inp']:
+        command += [ '-input_directory', os.path.dirname(entry['inp']), '-playback', os.path.basename(entry['inp']) ]
+    command += entry['options'] + options
+
+    result = { 'system': entry['system'], 'seconds': entry['seconds'], 'warmup': entry['warmup'], 'inp': entry['inp'] }
+    start = time.time()
+    with open(os.path.join(workdir, entry['system'] + '.txt'), 'w') as out:
+        process = subprocess.Popen(command, stdout=out, stderr=subprocess.STDOUT)
+        if hasattr(os, 'wait4'):
+            # wait4 gives the peak RSS of this child alone (kilobytes on Linux, bytes on macOS)
+            pid, status, usage = os.wait4(process.pid, 0)
+            process.returncode = os.waitstatus_to_exitcode(status) if hasattr(os, 'waitstatus_to_exitcode') else (status >> 8)
+            rss = usage.ru_maxrss if platform.system() == 'Darwin' else (usage.ru_maxrss * 1024)
+            result['peak_rss'] = rss
+        else:
+            process.wait()
+            result['peak_rss'] = None
+    result['elapsed'] = time.time() - start
+    result['status'] = process.returncode
+
+    # the last line of the timing log is the summary
+    summary = None
+    if os.path.exists(logfile):
+        with open(logfile, 'r') as f:
+            for line in f:
+                if line.startswith('{"summary"'):
+                    summary = json.loads(line)['summary']
+    if summary is not None:
+        result['speed'] = summary['speed']
+        result['frames'] = summary['frames']
+        result['frame_wall'] = summary['frame_wall']
+        result['video'] = summary['video']
+        result['sound'] = summary['sound']
+        result['devices'] = summary['devices']
+    return result
+
+
+def run(args):
+    seconds = DEFAULT_SECONDS
+    warmup = DEFAULT_WARMUP
+    options = [ ]
+    if '--' in args:
+        options = args[args.index('--') + 1:]
+        args = args[:args.index('--')]
+    while len(args) > 3:
+        if args[3] == '-seconds' and len(args) > 4:
+            seconds = int(args[4])
+        elif args[3] == '-warmup' and len(args) > 4:
+            warmup = float(args[4])
+        else:
+            usage()
+        args = args[:3] + args[5:]
+    if len(args) != 3:
+        usage()
+    mame, manifest, reportfile = args
+
+    entries = parseManifest(manifest, seconds, warmup)
+    workdir = tempfile.mkdtemp(prefix='perftest')
+    results = [ ]
+    for entry in entries:
+        sys.stderr.write('%s...' % entry['system'])
+        sys.stderr.flush()
+        result = runSystem(mame, entry, options, workdir)
+        if 'speed' in result:
+            sys.stderr.write(' %.2f%%, p50 %.3f ms, p99 %.3f ms\n' % (result['speed'], result['frame_wall']['p50'] * 1000.0, result['frame_wall']['p99'] * 1000.0))
+        else:
+            sys.stderr.write(' failed (status %d, see %s)\n' % (result['status'], os.path.join(workdir, entry['system'] + '.txt')))
+        results.append(result)
+
+    report = { 'mame': mame, 'host': platform.node(), 'platform': platform.platform(), 'date': time.strftime('%Y-%m-%dT%H:%M:%S'), 'results': results }
+    with open(reportfile, 'w') as f:
+        json.dump(report, f, indent=1, sort_keys=True)
+    return 0 if all('speed' in r for r in results) else 1
+
+
+def compare(args):
+    threshold = DEFAULT_THRESHOLD
+    if len(args) == 4 and args[2] == '-threshold':
+        threshold = float(args[3])
+    elif len(args) != 2:
+        usage()
+    with open(args[0], 'r') as f:
+        before = dict((r['system'], r) for r in json.load(f)['results'])
+    with open(args[1], 'r') as f:
+        after = dict((r['system'], r) for r in json.load(f)['results'])
+
+    # speed is the headline figure; p99 frame time catches stutter that averages hide
+    regressions = 0
+    sys.stdout.write('%-16s %10s %10s %8s %10s %10s %8s %10s\n' % ('system', 'speed', 'speed', 'change', 'p99 ms', 'p99 ms', 'change', 'rss MB'))
+    for system in sorted(set(before) & set(after)):
+        b = before[system]
+        a = after[system]
+        if 'speed' not in b or 'speed' not in a:
+            sys.stdout.write('%-16s not run successfully in both reports\n' % system)
+            continue
+        speed = (a['speed'] / b['speed'] - 1.0) * 100.0
+        p99 = ((a['frame_wall']['p99'] / b['frame_wall']['p99'] - 1.0) * 100.0) if b['frame_wall']['p99'] else 0.0
+        rss = ('%10.1f' % (a['peak_rss'] / 1048576.0)) if a.get('peak_rss') else ('%10s' % '-')
+        flag = ''
+        if (speed < -threshold) or (p99 > threshold):
+            flag = ' REGRESSED'
+            regressions += 1
+        elif speed > threshold:
+            flag = ' improved'
+        sys.stdout.write('%-16s %9.2f%% %9.2f%% %+7.1f%% %10.3f %10.3f %+7.1f%% %s%s\n' % (
+                system, b['speed'], a['speed'], speed, b['frame_wall']['p99'] * 1000.0, a['frame_wall']['p99'] * 1000.0, p99, rss, flag))
+    for system in sorted(set(before) ^ set(after)):
+        sys.stdout.write('%-16s only in %s\n' % (system, args[0] if system in before else args[1]))
+    return 1 if regressions else 0
+
+
+def usage():
+    sys.stderr.write(
+            'Usage:\n'
+            '%s run <mame> <manifest> <report.json> [-seconds n] [-warmup n] [-- options...]\n'
+            '%s compare <before.json> <after.json> [-threshold percent]\n' % (sys.argv[0], sys.argv[0]))
+    sys.exit(2)
+
+
+if __name__ == '__main__':
+    if len(sys.argv) < 2:
+        usage()
+    elif sys.argv[1] == 'run':
+        sys.exit(run(sys.argv[2:]))
+    elif sys.argv[1] == 'compare':
+        sys.exit(compare(sys.argv[2:]))
+    else:
+        usage()
@@ -335,6 +335,8 @@ struct options
 	const dasm_table_entry *dasm;
 	uint32_t                skip;
 	uint32_t                count;
+	uint8_t                 trace;
+	const char *            grep;
 };
 
 static const dasm_table_entry dasm_table[] =
@@ -1043,6 +1045,7 @@ static int parse_options(int argc, char *argv[], options *opts)
 	bool pending_mode = false;
 	bool pending_skip = false;
 	bool pending_count = false;
+	bool pending_grep = false;
 
 	memset(opts, 0, sizeof(*opts));
 
@@ -1052,7 +1055,7 @@ static int parse_options(int argc, char *argv[], options *opts)
 
 		// is it a switch?
 		if(curarg[0] == '-') {
-			if(pending_base || pending_arch || pending_mode || pending_skip || pending_count)
+			if(pending_base || pending_arch || pending_mode || pending_skip || pending_count || pending_grep)
 				goto usage;
 
 			if(tolower((uint8_t)curarg[1]) == 'a')
@@ -1069,6 +1072,10 @@ static int parse_options(int argc, char *argv[], options *opts)
 				pending_skip = true;
 			else if(tolower((uint8_t)curarg[1]) == 'c')
 				pending_count = true;
+			else if(tolower((uint8_t)curarg[1]) == 'g')
+				pending_grep = true;
+			else if(tolower((uint8_t)curarg[1]) == 't')
+				opts->trace = true;
 			else if(tolower((uint8_t)curarg[1]) == 'n')
 				opts->norawbytes = true;
 			else if(tolower((uint8_t)curarg[1]) == 'u')
@@ -1133,6 +1140,12 @@ static int parse_options(int argc, char *argv[], options *opts)
 			pending_count = false;
 		}
 
+		// search text
+		else if(pending_grep) {
+			opts->grep = curarg;
+			pending_grep = false;
+		}
+
 		// filename
 		else if(opts->filename == nullptr)
 			opts->filename = curarg;
@@ -1143,7 +1156,7 @@ static int parse_options(int argc, char *argv[], options *opts)
 	}
 
 	// if we have a dangling option, error
-	if(pending_base || pending_arch || pending_mode || pending_skip || pending_count)
+	if(pending_base || pending_arch || pending_mode || pending_skip || pending_count || pending_grep)
 		goto usage;
 
 	// if no file or no architecture, fail
@@ -1155,6 +1168,8 @@ usage:
 	printf("Usage: %s <filename> -arch <architecture> [-basepc <pc>] \n", argv[0]);
 	printf("   [-mode <n>] [-norawbytes] [-xchbytes] [-flipped] [-upper] [-lower]\n");
 	printf("   [-skip <n>] [-count <n>]\n");
+	printf("   %s <tracefile> -trace -arch <architecture> [-grep <text>] [-count <n>]\n", argv[0]);
+	printf("     disassembles a trace written by the debugger's 'trace <file>,<cpu>,binary'\n");
 	printf("\n");
 	printf("Supported architectures:");
 	const int colwidth = 1 + std::strlen(std::max_element(std::begin(dasm_table), std::end(dasm_table), [](const dasm_table_entry &a, const dasm_table_entry &b) { return std::strlen(a.name) < std::strlen(b.name); })->name);
@@ -1174,6 +1189,199 @@ usage:
 };
 
 
+// Reader for the binary traces written by the debugger's "trace <file>,<cpu>,binary"
+// command; the format is described with device_debug::tracer in src/emu/debug/debugcpu.cpp.
+// Traces can be far larger than memory, so they are streamed rather than loaded.
+class trace_reader
+{
+public:
+	trace_reader(FILE *file) : m_file(file), m_ok(true) {}
+
+	bool ok() const { return m_ok; }
+
+	bool at_end() {
+		int c = fgetc(m_file);
+		if(c == EOF)
+			return true;
+		ungetc(c, m_file);
+		return false;
+	}
+
+	template<typename T> T get() {
+		u8 bytes[sizeof(T)];
+		if(fread(bytes, 1, sizeof(T), m_file) != sizeof(T)) {
+			m_ok = false;
+			return 0;
+		}
+		u64 r = 0;
+		for(unsigned i=0; i != sizeof(T); i++)
+			r |= u64(bytes[i]) << (8*i);
+		return T(r);
+	}
+
+	void get_bytes(std::vector<u8> &data, size_t length) {
+		data.resize(length);
+		if(length && fread(&data[0], 1, length, m_file) != length)
+			m_ok = false;
+	}
+
+	std::string get_string() {
+		std::vector<u8> data;
+		get_bytes(data, get<u16>());
+		return std::string(data.begin(), data.end());
+	}
+
+private:
+	FILE *m_file;
+	bool m_ok;
+};
+
+static int disassemble_trace(const options &opts)
+{
+	FILE *file = fopen(opts.filename, "rb");
+	if(!file) {
+		fprintf(stderr, "Error opening file '%s'\n", opts.filename);
+		return 1;
+	}
+	trace_reader reader(file);
+
+	// Check and read the header
+	static const char magic[8] = { 'M', 'A', 'M', 'E', 'T', 'R', 'C', 0 };
+	char filemagic[8];
+	if(fread(filemagic, 1, sizeof(filemagic), file) != sizeof(filemagic) || memcmp(filemagic, magic, sizeof(magic))) {
+		fprintf(stderr, "'%s' is not a binary trace\n", opts.filename);
+		fclose(file);
+		return 1;
+	}
+	u16 version = reader.get<u16>();
+	if(version != 1) {
+		fprintf(stderr, "'%s' is trace format version %d, only version 1 is supported\n", opts.filename, version);
+		fclose(file);
+		return 1;
+	}
+	int8_t shift = reader.get<int8_t>();
+	reader.get<u8>(); // endianness, implied by the architecture
+	u8 width = reader.get<u8>();
+	std::string tag = reader.get_string();
+	std::string shortname = reader.get_string();
+	std::vector<std::string> registers(reader.get<u16>());
+	for(auto &name : registers)
+		name = reader.get_string();
+	if(!reader.ok()) {
+		fprintf(stderr, "'%s' is truncated\n", opts.filename);
+		fclose(file);
+		return 1;
+	}
+	if(shift != opts.dasm->pcshift)
+		fprintf(stderr, "Warning: trace of %s (%s) has address shift %d but %s expects %d\n", tag.c_str(), shortname.c_str(), shift, opts.dasm->name, opts.dasm->pcshift);
+
+	std::unique_ptr<util::disasm_interface> disasm(opts.dasm->alloc());
+	int pc_digits = width ? (width + 3) / 4 : 8;
+
+	// Word-addressed spaces log each word little-endian; the buffers want them in bus order
+	unsigned word_bytes = opts.dasm->pcshift < 0 ? 1 << -opts.dasm->pcshift : 1;
+	bool swap_words = opts.dasm->endian == be && word_bytes > 1;
+	auto load = [swap_words, word_bytes](unidasm_data_buffer &buffer, offs_t pc, const std::vector<u8> &bytes) {
+		buffer.data = bytes;
+		if(swap_words)
+			for(size_t i=0; i + word_bytes <= buffer.data.size(); i += word_bytes)
+				std::reverse(buffer.data.begin() + i, buffer.data.begin() + i + word_bytes);
+		buffer.data.resize(bytes.size() + 8, 0x00);
+		buffer.size = buffer.data.size();
+		buffer.base_pc = pc;
+	};
+
+	// Lines go out through the search filter and count limit
+	u32 printed = 0;
+	auto emit = [&opts, &printed](const std::string &line) -> bool {
+		if(opts.grep && line.find(opts.grep) == std::string::npos)
+			return true;
+		std::cout << line << '\n';
+		return !opts.count || ++printed < opts.count;
+	};
+
+	if(!opts.grep)
+		util::stream_format(std::cout, "; trace of %s (%s)\n", tag, shortname);
+
+	unidasm_data_buffer opcodes(disasm.get(), opts.dasm), params(disasm.get(), opts.dasm);
+	std::vector<u8> opbytes, parbytes, text;
+	std::string pending; // tracelog output, which prefixes the next instruction as in text traces
+	bool more = true;
+	while(more && !reader.at_end()) {
+		u8 type = reader.get<u8>();
+		switch(type & 0x0f) {
+		case 0x00: {
+			offs_t pc = reader.get<u32>();
+			reader.get_bytes(opbytes, reader.get<u8>());
+			parbytes.clear();
+			if(type & 0x10)
+				reader.get_bytes(parbytes, reader.get<u8>());
+			std::string changes;
+			if(type & 0x20) {
+				u16 count = reader.get<u16>();
+				for(u16 i=0; i != count; i++) {
+					u16 index = reader.get<u16>();
+					u64 value = reader.get<u64>();
+					changes += util::string_format(" %s=%X", index < registers.size() ? registers[index] : "?", value);
+				}
+			}
+			if(!reader.ok())
+				break;
+
+			load(opcodes, pc, opbytes);
+			if(!parbytes.empty())
+				load(params, pc, parbytes);
+			std::ostringstream stream;
+			disasm->disassemble(stream, pc, opcodes, parbytes.empty() ? opcodes : params);
+
+			std::string line = pending + util::string_format("%0*x: ", pc_digits, pc);
+			pending.clear();
+			if(!opts.norawbytes) {
+				std::string raw;
+				for(size_t i=0; i != opbytes.size(); i++)
+					raw += util::string_format((i && !(i % word_bytes)) ? " %02x" : "%02x", opbytes[i]);
+				line += util::string_format("%-20s  ", raw);
+			}
+			line += stream.str();
+			if(!changes.empty())
+				line += "  ;" + changes;
+			more = emit(line);
+			break;
+		}
+
+		case 0x01:
+			more = emit(util::string_format("\n   (loops for %d instructions)\n", reader.get<u32>()));
+			break;
+
+		case 0x02: {
+			reader.get_bytes(text, reader.get<u32>());
+			pending.append(text.begin(), text.end());
+			std::string::size_type eol;
+			while(more && (eol = pending.find('\n')) != std::string::npos) {
+				more = emit(pending.substr(0, eol));
+				pending.erase(0, eol + 1);
+			}
+			break;
+		}
+
+		default:
+			fprintf(stderr, "Unknown record type %02x, stopping\n", type);
+			more = false;
+			break;
+		}
+		if(!reader.ok()) {
+			fprintf(stderr, "Warning: trace ends in the middle of a record\n");
+			break;
+		}
+	}
+	if(more && !pending.empty())
+		emit(pending);
+
+	fclose(file);
+	return 0;
+}
+
+
 int main(int argc, char *argv[])
 {
 	// Parse options first
@@ -1181,6 +1389,10 @@ int main(int argc, char *argv[])
 	if(parse_options(argc, argv, &opts))
 		return 1;
 
+	// Binary traces carry their own addresses and bytes
+	if(opts.trace)
+		return disassemble_trace(opts);
+
 	// Load the file
 	void *data;
 	uint32_t length;